@@ -0,0 +1,57 @@
+// Copyright 2020 Charles Tytler
+
+// Build-time generator of the command database stored with the Property Inspector: extracts the clickabledata of
+// every module of a DCS installation and writes one command shard per module (see encode_command_shard).
+//
+// Usage: CommandDbGenerator.exe <dcs_install_path> <output_directory> [extract_clickabledata.lua]
+
+#include "pch.h"
+
+#include "../DcsInterface/CommandShard.h"
+#include "../DcsInterface/DcsIdLookup.h"
+#include "../DcsInterface/ModulePreextractor.h"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+int main(int argc, char *argv[]) {
+    if (argc < 3) {
+        std::cerr << "Usage: " << argv[0] << " <dcs_install_path> <output_directory> [extract_clickabledata.lua]"
+                  << std::endl;
+        return 1;
+    }
+    const std::string dcs_install_path = argv[1];
+    const std::filesystem::path output_directory = argv[2];
+    const std::string lua_script = (argc > 3) ? argv[3] : "extract_clickabledata.lua";
+
+    const json installed_modules_and_result = get_installed_modules(dcs_install_path, "/mods/aircraft/");
+    if (installed_modules_and_result["result"] != "success") {
+        std::cerr << installed_modules_and_result["result"].get<std::string>() << std::endl;
+        return 1;
+    }
+    std::filesystem::create_directories(output_directory);
+
+    int num_written = 0;
+    const auto module_folders = installed_modules_and_result["installed_modules"].get<std::vector<std::string>>();
+    const auto module_names = ModulePreextractor::lookup_module_names(module_folders);
+    for (const auto &module_name : module_names) {
+        const ClickabledataExtraction extraction = extract_clickabledata(dcs_install_path, module_name, lua_script);
+        if (extraction.result != "success") {
+            std::cout << "Skipped " << module_name << ": " << extraction.result << std::endl;
+            continue;
+        }
+        const std::filesystem::path shard_path = output_directory / (module_name + ".js");
+        std::ofstream shard_file(shard_path, std::ios::binary | std::ios::trunc);
+        shard_file << encode_command_shard(module_name, extraction.elements);
+        if (!shard_file) {
+            std::cerr << "Failed to write " << shard_path.string() << std::endl;
+            return 1;
+        }
+        std::cout << "Wrote " << extraction.elements.size() << " elements of " << module_name << std::endl;
+        ++num_written;
+    }
+    std::cout << "Wrote " << num_written << " of " << module_names.size() << " modules to "
+              << output_directory.string() << std::endl;
+    return (num_written > 0) ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+// Header included by DcsInterface sources built into the command database generator.
+
+#include <string>
+
+#include "../Vendor/json/src/json.hpp"
+using json = nlohmann::json;
@@ -34,6 +34,7 @@ public:
 	virtual void DidReceiveGlobalSettings(const json& inPayload) = 0;
 
 	virtual void SendToPlugin(const std::string &inAction, const std::string &inContext, const json &inPayload, const std::string &inDeviceID) = 0;
+	virtual void PropertyInspectorDidDisappear(const std::string &inAction, const std::string &inContext, const std::string &inDeviceID) = 0;
 
 protected:
 	ESDConnectionManager *mConnectionManager = nullptr;
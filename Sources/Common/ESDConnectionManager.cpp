@@ -111,6 +111,10 @@ void ESDConnectionManager::OnMessage(websocketpp::connection_hdl, WebsocketClien
 			{
 				mPlugin->SendToPlugin(action, context, payload, deviceID);
 			}
+			else if (event == kESDSDKEventPropertyInspectorDidDisappear)
+			{
+				mPlugin->PropertyInspectorDidDisappear(action, context, deviceID);
+			}
 		}
 		catch (...)
 		{
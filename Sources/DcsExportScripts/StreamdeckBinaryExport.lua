@@ -0,0 +1,268 @@
+-- Copyright 2020 Charles Tytler
+--
+-- Reference export-side encoder of the compact binary packet format received by the Streamdeck DCS Interface plugin
+-- (see Sources/DcsInterface/DcsBinaryProtocol.h), an alternative to the "header*id=value:id=value" text format which
+-- the plugin detects per packet.
+--
+-- Values with DCS ID keys are encoded as:
+--   - Booleans as true/false without payload.
+--   - Numbers, and strings which are the exact text of a number (such as "1" or "0.25"), as varint integers if
+--     integral, otherwise as float32 if the text survives float32 precision.
+--   - Anything else as strings of up to 255 bytes.
+-- Values with other keys (such as "File") are encoded as named strings. Pass numbers rather than formatted text (such
+-- as "2.00") to benefit from the number encodings, as formatted text is kept as a string so it is displayed unchanged.
+--
+-- To use with DCS-ExportScripts, dofile this file from ExportScript\Tools.lua and in ExportScript.Tools.FlushData
+-- send each packet of StreamdeckBinaryExport.encode_packets(values, 1024) instead of the text packets.
+--
+-- Alternatively, send sequenced packets so the plugin detects lost packets: create a stream with
+-- StreamdeckBinaryExport.new_stream() when export starts, send the changed values of each flush as
+-- stream:encode_packets(values, 1024), and periodically (such as every second) send them as
+-- stream:encode_keyframe(values, 1024) instead, which carries a checksum of all sent values so the plugin requests a
+-- resend ("R") only if its state differs.
+
+StreamdeckBinaryExport = {}
+
+StreamdeckBinaryExport.HEADER = "\0SDB\1"
+StreamdeckBinaryExport.SEQUENCED_HEADER = "\0SDB\2"
+
+local KEYFRAME = 1
+local STREAM_START = 2
+local MAX_SEQUENCED_HEADER_SIZE = 15
+
+local FLOAT32 = 0
+local INT = 1
+local FALSE = 2
+local TRUE = 3
+local STRING = 4
+local NAMED_STRING = 5
+
+local MAX_INT = 2147483647
+local MAX_STRING_LENGTH = 255
+
+-- Encodes a non-negative integer below 2^32 in little-endian base 128.
+local function encode_varint(number)
+	local bytes = {}
+	repeat
+		local byte = number % 128
+		number = math.floor(number / 128)
+		if number > 0 then
+			byte = byte + 128
+		end
+		bytes[#bytes + 1] = string.char(byte)
+	until number == 0
+	return table.concat(bytes)
+end
+
+local function encode_short_string(str)
+	str = string.sub(str, 1, MAX_STRING_LENGTH)
+	return string.char(#str) .. str
+end
+
+-- Returns the bits of the IEEE 754 single precision float nearest to a number.
+local function float32_bits(number)
+	if number ~= number then
+		return 0x7FC00000
+	end
+	local sign = 0
+	if number < 0 or (number == 0 and 1 / number < 0) then
+		sign = 0x80000000
+		number = -number
+	end
+	local bits
+	local mantissa, exponent = math.frexp(number)
+	if number == 0 then
+		bits = 0
+	elseif number == math.huge or exponent > 128 then
+		bits = 0x7F800000
+	elseif exponent < -125 then
+		-- Subnormal, rounding up to the smallest normal number is carried into the exponent bits.
+		bits = math.floor(number * 2 ^ 149 + 0.5)
+	else
+		-- Rounding up of the mantissa is carried into the exponent bits.
+		bits = (exponent + 126) * 2 ^ 23 + math.floor((mantissa * 2 - 1) * 2 ^ 23 + 0.5)
+		if bits >= 0x7F800000 then
+			bits = 0x7F800000
+		end
+	end
+	return sign + bits
+end
+
+local function float32_from_bits(bits)
+	local sign = 1
+	if bits >= 0x80000000 then
+		sign = -1
+		bits = bits - 0x80000000
+	end
+	local exponent = math.floor(bits / 2 ^ 23)
+	local fraction = bits % 2 ^ 23
+	if exponent == 0 then
+		return sign * fraction * 2 ^ -149
+	end
+	return sign * math.ldexp(1 + fraction / 2 ^ 23, exponent - 127)
+end
+
+local function encode_float32(number)
+	local bits = float32_bits(number)
+	local bytes = {}
+	for i = 1, 4 do
+		bytes[i] = string.char(bits % 256)
+		bits = math.floor(bits / 256)
+	end
+	return table.concat(bytes)
+end
+
+-- Encodes a value of a DCS ID.
+local function encode_value(dcs_id, value)
+	if type(value) == "boolean" then
+		return encode_varint(dcs_id * 8 + (value and TRUE or FALSE))
+	end
+
+	local number = tonumber(value)
+	local is_exact_number = type(value) == "number" or (number ~= nil and tostring(number) == value)
+	if number ~= nil and is_exact_number then
+		if number == math.floor(number) and number >= -MAX_INT - 1 and number <= MAX_INT then
+			local zigzag = number >= 0 and number * 2 or -number * 2 - 1
+			return encode_varint(dcs_id * 8 + INT) .. encode_varint(zigzag)
+		end
+		-- Numbers given as text are sent as text unless the plugin's text of the float32 (7 significant digits)
+		-- matches.
+		local float32 = float32_from_bits(float32_bits(number))
+		if type(value) == "number" or string.format("%.7g", float32) == value then
+			return encode_varint(dcs_id * 8 + FLOAT32) .. encode_float32(number)
+		end
+	end
+	return encode_varint(dcs_id * 8 + STRING) .. encode_short_string(tostring(value))
+end
+
+-- Encodes a value of any key, returning the encoded bytes and the DCS ID (nil for named strings).
+local function encode_entry(key, value)
+	local dcs_id = tonumber(key)
+	if dcs_id ~= nil and dcs_id >= 0 and dcs_id == math.floor(dcs_id) and dcs_id < 2 ^ 29 then
+		return encode_value(dcs_id, value), dcs_id
+	end
+	return encode_varint(NAMED_STRING) .. encode_short_string(tostring(key)) .. encode_short_string(tostring(value))
+end
+
+-- Hashes the encoded bytes of a value for state checksums, as hash_binary_export_value in DcsBinaryProtocol.h.
+local function hash_entry(entry)
+	local hash = 0
+	for i = 1, #entry do
+		hash = (hash * 65599 + string.byte(entry, i)) % 4294967296
+	end
+	return hash
+end
+
+local function encode_uint32(number)
+	local bytes = {}
+	for i = 1, 4 do
+		bytes[i] = string.char(number % 256)
+		number = math.floor(number / 256)
+	end
+	return table.concat(bytes)
+end
+
+-- Splits encoded entries into packets of at most max_packet_size bytes, each starting with the header returned by
+-- make_header(is_last_packet), where headers are at most header_size bytes.
+local function split_packets(entries, max_packet_size, header_size, make_header)
+	local packets = {}
+	local packet_entries = {}
+	local packet_size = header_size
+	for _, entry in ipairs(entries) do
+		if packet_size + #entry > max_packet_size and #packet_entries > 0 then
+			packets[#packets + 1] = make_header(false) .. table.concat(packet_entries)
+			packet_entries = {}
+			packet_size = header_size
+		end
+		packet_entries[#packet_entries + 1] = entry
+		packet_size = packet_size + #entry
+	end
+	if #packet_entries > 0 or #packets == 0 then
+		packets[#packets + 1] = make_header(true) .. table.concat(packet_entries)
+	end
+	return packets
+end
+
+-- Encodes a table of key/value pairs as a single packet.
+function StreamdeckBinaryExport.encode_packet(values)
+	local entries = {StreamdeckBinaryExport.HEADER}
+	for key, value in pairs(values) do
+		entries[#entries + 1] = encode_entry(key, value)
+	end
+	return table.concat(entries)
+end
+
+-- Encodes a table of key/value pairs as packets of at most max_packet_size bytes, returned as an array.
+function StreamdeckBinaryExport.encode_packets(values, max_packet_size)
+	local entries = {}
+	for key, value in pairs(values) do
+		entries[#entries + 1] = encode_entry(key, value)
+	end
+	if #entries == 0 then
+		return {}
+	end
+	return split_packets(entries, max_packet_size, #StreamdeckBinaryExport.HEADER, function()
+		return StreamdeckBinaryExport.HEADER
+	end)
+end
+
+local Stream = {}
+Stream.__index = Stream
+
+-- Creates a stream of sequenced packets, to be created again whenever the plugin's state may have been lost.
+function StreamdeckBinaryExport.new_stream()
+	return setmetatable({sequence = 0, started = false, sent_hashes = {}}, Stream)
+end
+
+-- Returns the checksum of all values sent on the stream.
+function Stream:checksum()
+	local checksum = 0
+	for _, hash in pairs(self.sent_hashes) do
+		checksum = (checksum + hash) % 4294967296
+	end
+	return checksum
+end
+
+function Stream:encode(values, max_packet_size, is_keyframe)
+	local entries = {}
+	for key, value in pairs(values) do
+		local entry, dcs_id = encode_entry(key, value)
+		if dcs_id ~= nil then
+			self.sent_hashes[dcs_id] = hash_entry(entry)
+		end
+		entries[#entries + 1] = entry
+	end
+	if #entries == 0 and not is_keyframe then
+		return {}
+	end
+	local checksum = self:checksum()
+	return split_packets(entries, max_packet_size, MAX_SEQUENCED_HEADER_SIZE, function(is_last_packet)
+		local flags = 0
+		if not self.started then
+			flags = flags + STREAM_START
+			self.started = true
+		end
+		if is_keyframe and is_last_packet then
+			flags = flags + KEYFRAME
+		end
+		local header = StreamdeckBinaryExport.SEQUENCED_HEADER .. encode_varint(self.sequence) .. string.char(flags)
+		if is_keyframe and is_last_packet then
+			header = header .. encode_uint32(checksum)
+		end
+		self.sequence = (self.sequence + 1) % 4294967296
+		return header
+	end)
+end
+
+-- Encodes changed values as sequenced delta packets of at most max_packet_size bytes, returned as an array.
+function Stream:encode_packets(values, max_packet_size)
+	return self:encode(values, max_packet_size, false)
+end
+
+-- Encodes changed values as sequenced packets like encode_packets, of which the last is a keyframe carrying the
+-- checksum of all values sent. A keyframe is sent even if there are no changed values.
+function Stream:encode_keyframe(values, max_packet_size)
+	return self:encode(values, max_packet_size, true)
+end
+
+return StreamdeckBinaryExport
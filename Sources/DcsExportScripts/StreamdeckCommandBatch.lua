@@ -0,0 +1,40 @@
+-- Copyright 2020 Charles Tytler
+--
+-- Reference export-side support for the command batches of the Streamdeck DCS Interface plugin, so commands sent
+-- together (such as by macros or synchronized switch sets) are received in one message and applied in the same frame.
+--
+-- Message received from the plugin:
+--   "C<device>,<button>,<value>\nC<device>,<button>,<value>..."  Commands separated by newlines. A batch of one
+--                                                               command is identical to a command sent on its own.
+-- The plugin only sends batches after receiving the key/value StreamdeckCommandBatch.TOKEN, otherwise it sends each
+-- command in its own message.
+--
+-- To use with DCS-ExportScripts, dofile this file from ExportScript\Tools.lua, then:
+--   - Send StreamdeckCommandBatch.TOKEN along with the "File" key of the aircraft module.
+--   - In ExportScript.Tools.ProcessInput, handle each message returned by StreamdeckCommandBatch.split for a received
+--     message as a message received on its own.
+
+StreamdeckCommandBatch = {}
+
+StreamdeckCommandBatch.TOKEN = "Batch=1"
+
+-- Returns the list of messages of a received message, which is the message itself unless it is a batch.
+function StreamdeckCommandBatch.split(message)
+	local messages = {}
+	for command in string.gmatch(message, "[^\n]+") do
+		messages[#messages + 1] = command
+	end
+	return messages
+end
+
+-- Returns the device, button and value of a command message ("C<device>,<button>,<value>"), or nil if it is not a
+-- command.
+function StreamdeckCommandBatch.parse_command(message)
+	local device, button, value = string.match(message, "^C(%d+),(%d+),(.*)$")
+	if device == nil then
+		return nil
+	end
+	return tonumber(device), tonumber(button), value
+end
+
+return StreamdeckCommandBatch
@@ -0,0 +1,89 @@
+-- Copyright 2020 Charles Tytler
+--
+-- Reference export-side support for the digest commands of the Streamdeck DCS Interface plugin, so a resync after
+-- reconnecting or subscribing to more DCS IDs resends only the values which differ from the plugin's state rather than
+-- all values.
+--
+-- Command received from the plugin:
+--   "D<bucket count>:<hash>,<hash>,..."  Hexadecimal hash of the plugin's values of each bucket of DCS IDs, which
+--                                        is the sum (modulo 2^32) of the hashes of "<DCS ID>=<value>" of each DCS ID
+--                                        in the bucket, where the bucket of a DCS ID is the DCS ID modulo the bucket
+--                                        count.
+-- The plugin only sends digest commands after receiving the key/value StreamdeckDigest.TOKEN, otherwise it sends a
+-- reset command ("R") for a resend of all values.
+--
+-- To use with DCS-ExportScripts, dofile this file from ExportScript\Tools.lua, then:
+--   - Send StreamdeckDigest.TOKEN along with the "File" key of the aircraft module.
+--   - In ExportScript.Tools.ProcessInput, pass each received message to StreamdeckDigest.handle_message with the
+--     current (subscribed) values, and send the returned values in place of handling the message.
+
+StreamdeckDigest = {}
+
+StreamdeckDigest.TOKEN = "Digest=1"
+
+local HASH_MODULUS = 4294967296
+
+-- Hashes a string as h = h * 65599 + byte (modulo 2^32), which is exact with Lua 5.1 numbers.
+function StreamdeckDigest.hash(str)
+	local hash = 0
+	for i = 1, #str do
+		hash = (hash * 65599 + string.byte(str, i)) % HASH_MODULUS
+	end
+	return hash
+end
+
+-- Returns the bucket hashes of the DCS ID values of a table of key/value pairs.
+function StreamdeckDigest.bucket_hashes(values, bucket_count)
+	local hashes = {}
+	for bucket = 0, bucket_count - 1 do
+		hashes[bucket] = 0
+	end
+	for key, value in pairs(values) do
+		local id = tonumber(key)
+		if id ~= nil then
+			local bucket = id % bucket_count
+			local hash = StreamdeckDigest.hash(tostring(key) .. "=" .. tostring(value))
+			hashes[bucket] = (hashes[bucket] + hash) % HASH_MODULUS
+		end
+	end
+	return hashes
+end
+
+-- Applies a message received from the plugin given the current values, returning nil if it is not a digest command,
+-- or otherwise the key/value pairs of DCS IDs to resend, which are all values if the digest is malformed.
+function StreamdeckDigest.handle_message(message, values)
+	if string.sub(message, 1, 1) ~= "D" then
+		return nil
+	end
+	local bucket_count, hash_list = string.match(message, "^D(%d+):(.*)$")
+	bucket_count = tonumber(bucket_count)
+	local received_hashes = {}
+	local received_count = 0
+	if hash_list ~= nil then
+		for hash in string.gmatch(hash_list, "[^,]+") do
+			received_hashes[received_count] = tonumber(hash, 16)
+			received_count = received_count + 1
+		end
+	end
+
+	local resend = {}
+	if bucket_count == nil or bucket_count < 1 or received_count ~= bucket_count then
+		for key, value in pairs(values) do
+			if tonumber(key) ~= nil then
+				resend[key] = value
+			end
+		end
+		return resend
+	end
+
+	local hashes = StreamdeckDigest.bucket_hashes(values, bucket_count)
+	for key, value in pairs(values) do
+		local id = tonumber(key)
+		if id ~= nil and hashes[id % bucket_count] ~= received_hashes[id % bucket_count] then
+			resend[key] = value
+		end
+	end
+	return resend
+end
+
+return StreamdeckDigest
@@ -0,0 +1,78 @@
+-- Copyright 2020 Charles Tytler
+--
+-- Reference export-side support for the DCS ID subscription commands of the Streamdeck DCS Interface plugin, so
+-- export scripts only send the DCS IDs referenced by the plugin's buttons.
+--
+-- Commands received from the plugin:
+--   "S<id>,<id>,..."   Replaces the subscription with the listed DCS IDs ("S" alone subscribes to all DCS IDs).
+--   "S+<id>,<id>,..."  Adds DCS IDs to the subscription, sent when a subscription is too long for one message.
+-- Keys which are not DCS IDs (e.g. "File") are always sent, as are all DCS IDs until a subscription is received.
+--
+-- To use with DCS-ExportScripts, dofile this file from ExportScript\Tools.lua and create a subscription with
+-- StreamdeckSubscription.new(), then:
+--   - In ExportScript.Tools.ProcessInput, pass each received message to subscription:handle_message before handling
+--     commands, and skip messages for which it returns true.
+--   - In ExportScript.Tools.SendData, skip keys for which subscription:is_subscribed returns false.
+
+StreamdeckSubscription = {}
+StreamdeckSubscription.__index = StreamdeckSubscription
+
+-- Creates a subscription to all DCS IDs.
+function StreamdeckSubscription.new()
+	return setmetatable({subscribed_ids = nil}, StreamdeckSubscription)
+end
+
+local function add_ids(subscribed_ids, id_list)
+	for id in string.gmatch(id_list, "[^,]+") do
+		local number = tonumber(id)
+		if number ~= nil then
+			subscribed_ids[number] = true
+		end
+	end
+end
+
+-- Applies a message received from the plugin, returning true if it was a subscription command.
+function StreamdeckSubscription:handle_message(message)
+	if string.sub(message, 1, 2) == "S+" then
+		if self.subscribed_ids ~= nil then
+			add_ids(self.subscribed_ids, string.sub(message, 3))
+		end
+		return true
+	elseif string.sub(message, 1, 1) == "S" then
+		local id_list = string.sub(message, 2)
+		if id_list == "" then
+			self.subscribed_ids = nil
+		else
+			self.subscribed_ids = {}
+			add_ids(self.subscribed_ids, id_list)
+		end
+		return true
+	end
+	return false
+end
+
+-- Returns true if the value of a key should be sent to the plugin.
+function StreamdeckSubscription:is_subscribed(key)
+	if self.subscribed_ids == nil then
+		return true
+	end
+	local id = tonumber(key)
+	return id == nil or self.subscribed_ids[id] == true
+end
+
+-- Encodes the subscribed values of a table of key/value pairs in the packet format received by the plugin
+-- ("header*key=value:key=value"), or returns nil if no values are subscribed.
+function StreamdeckSubscription:encode_packet(header, values)
+	local tokens = {}
+	for key, value in pairs(values) do
+		if self:is_subscribed(key) then
+			tokens[#tokens + 1] = tostring(key) .. "=" .. tostring(value)
+		end
+	end
+	if #tokens == 0 then
+		return nil
+	end
+	return header .. "*" .. table.concat(tokens, ":")
+end
+
+return StreamdeckSubscription
@@ -0,0 +1,37 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "ChunkedTransfer.h"
+
+#include <algorithm>
+
+ChunkedTransfer::ChunkedTransfer(const int transfer_id, std::vector<json> chunks, const size_t max_chunks_in_flight)
+    : transfer_id_(transfer_id), chunks_(std::move(chunks)),
+      max_chunks_in_flight_(std::max<size_t>(1, max_chunks_in_flight)) {}
+
+int ChunkedTransfer::get_transfer_id() const { return transfer_id_; }
+
+size_t ChunkedTransfer::num_chunks() const { return chunks_.size(); }
+
+std::vector<json> ChunkedTransfer::start() { return release_chunks(); }
+
+std::vector<json> ChunkedTransfer::acknowledge(const size_t chunk_index) {
+    if (chunk_index < num_acknowledged_ || chunk_index >= num_sent_) {
+        return {};
+    }
+    num_acknowledged_ = chunk_index + 1;
+    return release_chunks();
+}
+
+bool ChunkedTransfer::is_complete() const { return num_acknowledged_ == chunks_.size(); }
+
+std::vector<json> ChunkedTransfer::release_chunks() {
+    std::vector<json> released;
+    while (num_sent_ < chunks_.size() && num_sent_ - num_acknowledged_ < max_chunks_in_flight_) {
+        // Chunks are only sent once, so free their memory as they are released.
+        released.push_back(std::move(chunks_[num_sent_]));
+        ++num_sent_;
+    }
+    return released;
+}
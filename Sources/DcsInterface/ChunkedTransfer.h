@@ -0,0 +1,69 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "../Vendor/json/src/json.hpp"
+using json = nlohmann::json;
+
+#include <vector>
+
+/**
+ * @brief Delivers a sequence of json chunks to a receiver with a bounded number of unacknowledged chunks in flight.
+ *
+ * Further chunks are only released once the receiver acknowledges earlier ones, so a slow receiver (such as a
+ * Property Inspector rendering rows) throttles the sender rather than having its websocket queue fill up.
+ * Acknowledgements are cumulative: acknowledging a chunk also acknowledges all chunks before it.
+ */
+class ChunkedTransfer {
+  public:
+    /**
+     * @brief Construct a new Chunked Transfer.
+     *
+     * @param transfer_id Identifier of the transfer, used by the receiver to tell transfers apart.
+     * @param chunks Chunks to deliver in order.
+     * @param max_chunks_in_flight Maximum number of chunks sent but not yet acknowledged (at least 1).
+     */
+    ChunkedTransfer(const int transfer_id, std::vector<json> chunks, const size_t max_chunks_in_flight);
+
+    /**
+     * @brief Returns the identifier of the transfer.
+     */
+    int get_transfer_id() const;
+
+    /**
+     * @brief Returns the total number of chunks of the transfer.
+     */
+    size_t num_chunks() const;
+
+    /**
+     * @brief Releases the first chunks to send, up to the maximum number of chunks in flight.
+     *
+     * @return Chunks to send, in order.
+     */
+    std::vector<json> start();
+
+    /**
+     * @brief Acknowledges receipt of a chunk and releases the chunks which may now be sent.
+     *
+     * @param chunk_index Index of the received chunk, stale or out of range indices are ignored.
+     * @return Chunks to send, in order.
+     */
+    std::vector<json> acknowledge(const size_t chunk_index);
+
+    /**
+     * @brief Returns true once all chunks have been acknowledged.
+     */
+    bool is_complete() const;
+
+  private:
+    /**
+     * @brief Moves chunks out of the transfer while the number of chunks in flight allows.
+     */
+    std::vector<json> release_chunks();
+
+    int transfer_id_;
+    std::vector<json> chunks_;
+    size_t max_chunks_in_flight_;
+    size_t num_sent_ = 0;         // Number of chunks released to be sent.
+    size_t num_acknowledged_ = 0; // Number of chunks acknowledged by the receiver.
+};
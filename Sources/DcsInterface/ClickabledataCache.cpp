@@ -0,0 +1,329 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "ClickabledataCache.h"
+
+#include "DcsIdLookup.h"
+#include "DcsInterfaceParameters.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <utility>
+
+namespace {
+
+constexpr char kIndexFileMagic[8] = {'D', 'C', 'S', 'C', 'L', 'K', '0', '2'};
+
+// Attributes of each element in the order they are stored in index files.
+std::string ClickabledataElement::*const kElementAttributes[] = {&ClickabledataElement::device,
+                                                                 &ClickabledataElement::device_id,
+                                                                 &ClickabledataElement::command,
+                                                                 &ClickabledataElement::element,
+                                                                 &ClickabledataElement::class_name,
+                                                                 &ClickabledataElement::arg,
+                                                                 &ClickabledataElement::arg_value,
+                                                                 &ClickabledataElement::arg_lim_min,
+                                                                 &ClickabledataElement::arg_lim_max,
+                                                                 &ClickabledataElement::hint};
+constexpr size_t kNumElementAttributes = sizeof(kElementAttributes) / sizeof(kElementAttributes[0]);
+
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+void hash_bytes(uint64_t &hash, const void *data, const size_t size) {
+    const auto *bytes = static_cast<const unsigned char *>(data);
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * kFnvPrime;
+    }
+}
+
+void hash_string(uint64_t &hash, const std::string &str) {
+    hash_bytes(hash, str.data(), str.size());
+    // Terminate each string so concatenations of different strings hash differently.
+    hash_bytes(hash, "", 1);
+}
+
+template <typename T> void hash_value(uint64_t &hash, const T value) { hash_bytes(hash, &value, sizeof(value)); }
+
+template <typename T> void append_value(std::string &buffer, const T value) {
+    buffer.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+template <typename T> bool read_value(const std::string &buffer, size_t &offset, T &value) {
+    if (offset + sizeof(value) > buffer.size()) {
+        return false;
+    }
+    std::memcpy(&value, buffer.data() + offset, sizeof(value));
+    offset += sizeof(value);
+    return true;
+}
+
+// Hashes the path, size and modification time of a file.
+void hash_file_attributes(uint64_t &hash, const std::filesystem::path &path, const std::string &relative_path) {
+    std::error_code error;
+    const auto file_size = std::filesystem::file_size(path, error);
+    const auto write_time = std::filesystem::last_write_time(path, error);
+    hash_string(hash, relative_path);
+    hash_value(hash, static_cast<uint64_t>(error ? 0 : file_size));
+    hash_value(hash, static_cast<int64_t>(error ? 0 : write_time.time_since_epoch().count()));
+}
+
+// Returns the folder name of a module, mirroring the multi-version module handling of extract_clickabledata.lua.
+std::string module_folder(const std::string &module_name) {
+    if (module_name.find("C-101") != std::string::npos) {
+        return "C-101";
+    }
+    if (module_name.find("L-39") != std::string::npos) {
+        return "L-39C";
+    }
+    return module_name;
+}
+
+} // namespace
+
+uint64_t fingerprint_module(const std::string &dcs_install_path, const std::string &module_name) {
+    const std::filesystem::path cockpit_path =
+        std::filesystem::path(dcs_install_path + "/mods/aircraft/" + module_folder(module_name)) / "Cockpit";
+    std::error_code error;
+    if (!std::filesystem::is_directory(cockpit_path, error)) {
+        return 0;
+    }
+
+    // Sort files so the fingerprint does not depend on directory iteration order.
+    std::vector<std::pair<std::string, std::filesystem::path>> files;
+    for (auto it = std::filesystem::recursive_directory_iterator(cockpit_path, error);
+         !error && it != std::filesystem::recursive_directory_iterator();
+         it.increment(error)) {
+        if (it->is_regular_file(error)) {
+            files.emplace_back(std::filesystem::relative(it->path(), cockpit_path, error).generic_string(), it->path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    uint64_t fingerprint = kFnvOffsetBasis;
+    for (const auto &[relative_path, path] : files) {
+        hash_file_attributes(fingerprint, path, relative_path);
+    }
+    return fingerprint;
+}
+
+ClickabledataCache::ClickabledataCache(const std::string &cache_directory, const size_t max_memory_entries)
+    : cache_directory_(cache_directory), max_memory_entries_(max_memory_entries),
+      lua_states_(kMaxIdleLuaStates, {kMaxLuaInstructions, kMaxLuaMemoryBytes}) {
+    std::error_code error;
+    std::filesystem::create_directories(cache_directory_, error);
+}
+
+ClickabledataExtraction ClickabledataCache::get_clickabledata(const std::string &dcs_install_path,
+                                                              const std::string &module_name,
+                                                              const std::string &lua_script) {
+    std::string result;
+    const auto search_index = get_search_index(dcs_install_path, module_name, lua_script, result);
+    if (!search_index) {
+        return {{}, result};
+    }
+    return {search_index->get_elements(), result};
+}
+
+std::shared_ptr<const ClickabledataSearchIndex> ClickabledataCache::get_search_index(
+    const std::string &dcs_install_path,
+    const std::string &module_name,
+    const std::string &lua_script,
+    std::string &result) {
+    const std::string key = dcs_install_path + "\n" + module_name;
+    {
+        // In-memory entries are trusted until dropped by invalidate_module, so hits do not scan the module's files.
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto it = lru_index_.find(key);
+        if (it != lru_index_.end()) {
+            lru_entries_.splice(lru_entries_.begin(), lru_entries_, it->second);
+            ++stats_.memory_hits;
+            result = "success";
+            return lru_entries_.front().search_index;
+        }
+    }
+
+    uint64_t fingerprint = fingerprint_module(dcs_install_path, module_name);
+    if (fingerprint == 0) {
+        // Module not found, so let the extraction report the error.
+        ClickabledataExtraction extraction =
+            extract_clickabledata(dcs_install_path, module_name, lua_script, lua_states_);
+        result = extraction.result;
+        if (extraction.result != "success") {
+            return nullptr;
+        }
+        return std::make_shared<const ClickabledataSearchIndex>(std::move(extraction.elements));
+    }
+    // A changed extraction script invalidates all index files.
+    hash_file_attributes(fingerprint, lua_script, lua_script);
+
+    std::vector<ClickabledataElement> elements;
+    if (read_index_file(key, fingerprint, elements)) {
+        // Index outside of the lock, as other threads may be looking up other modules.
+        const CacheEntry entry = {key, std::make_shared<const ClickabledataSearchIndex>(std::move(elements))};
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++stats_.disk_hits;
+        store_in_memory(entry);
+        result = "success";
+        return entry.search_index;
+    }
+
+    ClickabledataExtraction extraction =
+        extract_clickabledata(dcs_install_path, module_name, lua_script, lua_states_);
+    result = extraction.result;
+    CacheEntry entry = {key, nullptr};
+    if (extraction.result == "success") {
+        entry.search_index = std::make_shared<const ClickabledataSearchIndex>(std::move(extraction.elements));
+        write_index_file(key, fingerprint, entry.search_index->get_elements());
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.misses;
+    if (entry.search_index) {
+        store_in_memory(entry);
+    }
+    return entry.search_index;
+}
+
+void ClickabledataCache::invalidate_module(const std::string &dcs_install_path, const std::string &module_folder_name) {
+    const std::string key_prefix = dcs_install_path + "\n";
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = lru_entries_.begin(); it != lru_entries_.end();) {
+        if (it->key.compare(0, key_prefix.size(), key_prefix) == 0 &&
+            module_folder(it->key.substr(key_prefix.size())) == module_folder_name) {
+            lru_index_.erase(it->key);
+            it = lru_entries_.erase(it);
+            ++stats_.invalidations;
+        } else {
+            ++it;
+        }
+    }
+}
+
+ClickabledataCache::CacheStats ClickabledataCache::get_stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void ClickabledataCache::store_in_memory(const CacheEntry &entry) {
+    const auto it = lru_index_.find(entry.key);
+    if (it != lru_index_.end()) {
+        lru_entries_.erase(it->second);
+        lru_index_.erase(it);
+    }
+    while (!lru_entries_.empty() && lru_entries_.size() >= max_memory_entries_) {
+        lru_index_.erase(lru_entries_.back().key);
+        lru_entries_.pop_back();
+    }
+    if (max_memory_entries_ > 0) {
+        lru_entries_.push_front(entry);
+        lru_index_[lru_entries_.front().key] = lru_entries_.begin();
+    }
+}
+
+std::string ClickabledataCache::index_file_path(const std::string &key) const {
+    uint64_t key_hash = kFnvOffsetBasis;
+    hash_string(key_hash, key);
+    std::stringstream file_name;
+    file_name << std::hex << std::setw(16) << std::setfill('0') << key_hash << ".idx";
+    return (std::filesystem::path(cache_directory_) / file_name.str()).string();
+}
+
+// Index file layout (native byte order):
+//   char     magic[8]
+//   uint64_t fingerprint
+//   uint32_t key_size,  char key[key_size]
+//   uint32_t num_elements
+//   uint32_t offsets[num_elements * kNumElementAttributes + 1] -- Offsets of each attribute into the string block.
+//   char     strings[offsets[num_elements * kNumElementAttributes]]
+bool ClickabledataCache::read_index_file(const std::string &key,
+                                         const uint64_t fingerprint,
+                                         std::vector<ClickabledataElement> &elements) const {
+    std::ifstream file(index_file_path(key), std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    const std::string buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+    size_t offset = sizeof(kIndexFileMagic);
+    if (buffer.size() < offset || std::memcmp(buffer.data(), kIndexFileMagic, sizeof(kIndexFileMagic)) != 0) {
+        return false;
+    }
+    uint64_t file_fingerprint;
+    uint32_t key_size;
+    if (!read_value(buffer, offset, file_fingerprint) || file_fingerprint != fingerprint ||
+        !read_value(buffer, offset, key_size) || offset + key_size > buffer.size() ||
+        buffer.compare(offset, key_size, key) != 0) {
+        return false;
+    }
+    offset += key_size;
+
+    uint32_t num_elements;
+    if (!read_value(buffer, offset, num_elements)) {
+        return false;
+    }
+    const size_t num_strings = static_cast<size_t>(num_elements) * kNumElementAttributes;
+    const size_t strings_start = offset + (num_strings + 1) * sizeof(uint32_t);
+    if (strings_start > buffer.size()) {
+        return false;
+    }
+
+    elements.clear();
+    elements.resize(num_elements);
+    uint32_t string_start;
+    (void)read_value(buffer, offset, string_start);
+    for (auto &element : elements) {
+        for (const auto attribute : kElementAttributes) {
+            uint32_t string_end;
+            (void)read_value(buffer, offset, string_end);
+            if (string_end < string_start || strings_start + string_end > buffer.size()) {
+                return false;
+            }
+            (element.*attribute).assign(buffer.data() + strings_start + string_start, string_end - string_start);
+            string_start = string_end;
+        }
+    }
+    return true;
+}
+
+void ClickabledataCache::write_index_file(const std::string &key,
+                                          const uint64_t fingerprint,
+                                          const std::vector<ClickabledataElement> &elements) const {
+    std::string buffer(kIndexFileMagic, sizeof(kIndexFileMagic));
+    append_value(buffer, fingerprint);
+    append_value(buffer, static_cast<uint32_t>(key.size()));
+    buffer += key;
+    append_value(buffer, static_cast<uint32_t>(elements.size()));
+    uint32_t string_offset = 0;
+    append_value(buffer, string_offset);
+    for (const auto &element : elements) {
+        for (const auto attribute : kElementAttributes) {
+            string_offset += static_cast<uint32_t>((element.*attribute).size());
+            append_value(buffer, string_offset);
+        }
+    }
+    for (const auto &element : elements) {
+        for (const auto attribute : kElementAttributes) {
+            buffer += element.*attribute;
+        }
+    }
+
+    // Write to a temporary file first so a reader never sees a partially written index.
+    const std::string file_path = index_file_path(key);
+    const std::string temp_file_path =
+        file_path + ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+    {
+        std::ofstream file(temp_file_path, std::ios::binary | std::ios::trunc);
+        if (!file.write(buffer.data(), buffer.size())) {
+            return;
+        }
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_file_path, file_path, error);
+}
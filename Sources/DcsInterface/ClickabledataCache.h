@@ -0,0 +1,132 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "ClickabledataSearchIndex.h"
+#include "DcsIdLookup.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Computes a fingerprint of the source files of a module's cockpit scripts (paths, sizes and modification
+ *        times), which changes whenever DCS updates the module.
+ *
+ * @param dcs_install_path Path to DCS World installation.
+ * @param module_name      Name of the module matching the folder naming convention (e.g. "A-10C").
+ * @return Fingerprint of the module, or 0 if the module has no cockpit scripts directory.
+ */
+uint64_t fingerprint_module(const std::string &dcs_install_path, const std::string &module_name);
+
+/**
+ * @brief Two-level cache of module clickabledata extracted by extract_clickabledata.
+ *
+ * Recently used modules are kept in memory, and every extracted module is stored on disk in a compact index file
+ * (a table of offsets into a single block of element attribute strings, which can be read in place). Entries are
+ * keyed by install path and module name. Index files hold the fingerprint of the module's source files (see
+ * fingerprint_module) so a module updated by DCS is extracted again, while in-memory entries are kept until dropped
+ * by invalidate_module so lookups served from memory do not scan the module's files.
+ */
+class ClickabledataCache {
+  public:
+    using CacheStats = struct {
+        unsigned memory_hits; // Lookups served from the in-memory cache.
+        unsigned disk_hits;   // Lookups served from an index file on disk.
+        unsigned misses;      // Lookups which ran the Lua extraction.
+        unsigned invalidations; // In-memory entries dropped by invalidate_module.
+    };
+
+    /**
+     * @brief Construct a new Clickabledata Cache.
+     *
+     * @param cache_directory    Directory to store index files in, created if it does not exist.
+     * @param max_memory_entries Maximum number of modules kept in memory.
+     */
+    ClickabledataCache(const std::string &cache_directory, const size_t max_memory_entries);
+
+    /**
+     * @brief Gets clickabledata of a module from the cache, or extracts it with extract_clickabledata if not cached or
+     *        out of date. Safe to call from multiple threads.
+     *
+     * @param dcs_install_path Path to DCS World installation.
+     * @param module_name      Name of the module matching the folder naming convention (e.g. "A-10C").
+     * @param lua_script       Lua script used for extraction (see extract_clickabledata).
+     * @return ClickabledataExtraction Extracted elements and result of the extraction.
+     */
+    ClickabledataExtraction get_clickabledata(const std::string &dcs_install_path,
+                                              const std::string &module_name,
+                                              const std::string &lua_script);
+
+    /**
+     * @brief Gets the search index of a module's clickabledata, which is built whenever a module is extracted or read
+     *        from disk and kept with the in-memory entry. Safe to call from multiple threads.
+     *
+     * @param dcs_install_path Path to DCS World installation.
+     * @param module_name      Name of the module matching the folder naming convention (e.g. "A-10C").
+     * @param lua_script       Lua script used for extraction (see extract_clickabledata).
+     * @param result           Set to "success", or a description of the extraction error.
+     * @return Search index over the module's elements, or nullptr if the extraction failed.
+     */
+    std::shared_ptr<const ClickabledataSearchIndex> get_search_index(const std::string &dcs_install_path,
+                                                                     const std::string &module_name,
+                                                                     const std::string &lua_script,
+                                                                     std::string &result);
+
+    /**
+     * @brief Drops in-memory entries of a module whose cockpit scripts have changed (e.g. as reported by
+     *        InstalledModuleWatcher), including each version of multi-version modules. Index files on disk are left
+     *        to be rejected by their fingerprint. Safe to call from multiple threads.
+     *
+     * @param dcs_install_path   Path to DCS World installation.
+     * @param module_folder_name Name of the module's folder in the installation (e.g. "L-39C").
+     */
+    void invalidate_module(const std::string &dcs_install_path, const std::string &module_folder_name);
+
+    CacheStats get_stats();
+
+  private:
+    using CacheEntry = struct {
+        std::string key;
+        std::shared_ptr<const ClickabledataSearchIndex> search_index; // Index which holds the module's elements.
+    };
+
+    /**
+     * @brief Moves an entry to the front of the in-memory cache, evicting the least recently used entry if full.
+     */
+    void store_in_memory(const CacheEntry &entry);
+
+    /**
+     * @brief Returns the path of the index file for a cache key.
+     */
+    std::string index_file_path(const std::string &key) const;
+
+    /**
+     * @brief Reads the elements of an index file.
+     *
+     * @return True if the file exists and was written for the same key and fingerprint.
+     */
+    bool read_index_file(const std::string &key,
+                         const uint64_t fingerprint,
+                         std::vector<ClickabledataElement> &elements) const;
+
+    /**
+     * @brief Writes elements to the index file of a cache key, replacing the previous file atomically.
+     */
+    void write_index_file(const std::string &key,
+                          const uint64_t fingerprint,
+                          const std::vector<ClickabledataElement> &elements) const;
+
+    std::string cache_directory_;
+    size_t max_memory_entries_;
+    LuaStatePool lua_states_; // Warmed Lua states running extractions of modules not cached.
+
+    std::mutex mutex_;                  // Protects all members below.
+    std::list<CacheEntry> lru_entries_; // In-memory entries, most recently used first.
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> lru_index_;
+    CacheStats stats_ = {0, 0, 0, 0};
+};
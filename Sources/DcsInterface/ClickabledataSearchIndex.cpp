@@ -0,0 +1,216 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "ClickabledataSearchIndex.h"
+
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+#include <sstream>
+
+namespace {
+// Indexed fields of an element, and the weight of a match in each field when ranking.
+std::string ClickabledataElement::*const kIndexedFields[] = {&ClickabledataElement::arg,
+                                                             &ClickabledataElement::element,
+                                                             &ClickabledataElement::device,
+                                                             &ClickabledataElement::hint};
+constexpr int kFieldWeights[] = {8, 4, 2, 1};
+
+// Quality of a term match within a field when ranking.
+constexpr int kWholeFieldMatch = 4;
+constexpr int kWordPrefixMatch = 2;
+constexpr int kSubstringMatch = 1;
+
+constexpr size_t kTrigramLength = 3;
+
+std::string to_upper(std::string text) {
+    std::transform(text.begin(), text.end(), text.begin(), [](unsigned char c) { return std::toupper(c); });
+    return text;
+}
+
+uint32_t trigram_key(const std::string &text, const size_t pos) {
+    return (static_cast<uint32_t>(static_cast<unsigned char>(text[pos])) << 16) |
+           (static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 1])) << 8) |
+           static_cast<uint32_t>(static_cast<unsigned char>(text[pos + 2]));
+}
+
+bool is_word_character(const char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0; }
+
+bool is_word_start(const std::string &text, const size_t pos) {
+    return pos == 0 || !is_word_character(text[pos - 1]) || !is_word_character(text[pos]);
+}
+
+// Adds an element to a sorted posting list, once.
+void add_posting(std::vector<uint32_t> &postings, const uint32_t element_index) {
+    if (postings.empty() || postings.back() != element_index) {
+        postings.push_back(element_index);
+    }
+}
+
+std::vector<uint32_t> intersect(const std::vector<uint32_t> &lhs, const std::vector<uint32_t> &rhs) {
+    std::vector<uint32_t> intersection;
+    std::set_intersection(lhs.begin(), lhs.end(), rhs.begin(), rhs.end(), std::back_inserter(intersection));
+    return intersection;
+}
+} // namespace
+
+ClickabledataSearchIndex::ClickabledataSearchIndex(std::vector<ClickabledataElement> elements)
+    : elements_(std::move(elements)) {
+    const uint32_t num_elements = static_cast<uint32_t>(elements_.size());
+
+    display_order_.resize(num_elements);
+    std::iota(display_order_.begin(), display_order_.end(), 0);
+    std::stable_sort(display_order_.begin(), display_order_.end(), [this](const uint32_t lhs, const uint32_t rhs) {
+        return clickabledata_element_less(elements_[lhs], elements_[rhs]);
+    });
+    display_rank_.resize(num_elements);
+    for (uint32_t rank = 0; rank < num_elements; ++rank) {
+        display_rank_[display_order_[rank]] = rank;
+    }
+
+    fields_.reserve(num_elements);
+    for (uint32_t i = 0; i < num_elements; ++i) {
+        IndexedFields fields;
+        for (size_t f = 0; f < kNumIndexedFields; ++f) {
+            fields[f] = to_upper(elements_[i].*kIndexedFields[f]);
+            const std::string &text = fields[f];
+            for (size_t pos = 0; pos + kTrigramLength <= text.size(); ++pos) {
+                add_posting(trigrams_[trigram_key(text, pos)], i);
+            }
+            size_t word_start = 0;
+            while (word_start < text.size()) {
+                if (!is_word_character(text[word_start])) {
+                    ++word_start;
+                    continue;
+                }
+                size_t word_end = word_start;
+                while (word_end < text.size() && is_word_character(text[word_end])) {
+                    ++word_end;
+                }
+                words_.emplace_back(text.substr(word_start, word_end - word_start), i);
+                word_start = word_end;
+            }
+        }
+        fields_.push_back(std::move(fields));
+    }
+    std::sort(words_.begin(), words_.end());
+    words_.erase(std::unique(words_.begin(), words_.end()), words_.end());
+}
+
+const std::vector<ClickabledataElement> &ClickabledataSearchIndex::get_elements() const { return elements_; }
+
+ClickabledataSearchIndex::SearchResults ClickabledataSearchIndex::search(const std::string &query,
+                                                                         const size_t max_results) const {
+    std::vector<std::string> terms;
+    std::stringstream query_stream(to_upper(query));
+    std::string term;
+    while (query_stream >> term) {
+        terms.push_back(term);
+    }
+
+    SearchResults results;
+    if (terms.empty()) {
+        results.total_matches = display_order_.size();
+        results.element_indices.assign(display_order_.begin(),
+                                       display_order_.begin() + std::min(max_results, display_order_.size()));
+        return results;
+    }
+
+    std::vector<uint32_t> matches;
+    for (size_t t = 0; t < terms.size(); ++t) {
+        const std::vector<uint32_t> term_matches = (terms[t].size() >= kTrigramLength)
+                                                       ? find_substring_matches(terms[t])
+                                                       : find_prefix_matches(terms[t]);
+        matches = (t == 0) ? term_matches : intersect(matches, term_matches);
+        if (matches.empty()) {
+            break;
+        }
+    }
+    results.total_matches = matches.size();
+
+    std::vector<std::pair<int, uint32_t>> scored_matches; // (score, element index)
+    scored_matches.reserve(matches.size());
+    for (const uint32_t element_index : matches) {
+        int score = 0;
+        for (const auto &term : terms) {
+            score += score_term(fields_[element_index], term);
+        }
+        scored_matches.emplace_back(score, element_index);
+    }
+    const size_t num_results = std::min(max_results, scored_matches.size());
+    std::partial_sort(scored_matches.begin(),
+                      scored_matches.begin() + num_results,
+                      scored_matches.end(),
+                      [this](const std::pair<int, uint32_t> &lhs, const std::pair<int, uint32_t> &rhs) {
+                          if (lhs.first != rhs.first) {
+                              return lhs.first > rhs.first;
+                          }
+                          return display_rank_[lhs.second] < display_rank_[rhs.second];
+                      });
+    results.element_indices.reserve(num_results);
+    for (size_t i = 0; i < num_results; ++i) {
+        results.element_indices.push_back(scored_matches[i].second);
+    }
+    return results;
+}
+
+std::vector<uint32_t> ClickabledataSearchIndex::find_substring_matches(const std::string &term) const {
+    // Intersect the posting lists of each trigram of the term, starting with the shortest.
+    std::vector<const std::vector<uint32_t> *> postings;
+    for (size_t pos = 0; pos + kTrigramLength <= term.size(); ++pos) {
+        const auto trigram = trigrams_.find(trigram_key(term, pos));
+        if (trigram == trigrams_.end()) {
+            return {};
+        }
+        postings.push_back(&trigram->second);
+    }
+    std::sort(postings.begin(), postings.end(), [](const auto *lhs, const auto *rhs) {
+        return lhs->size() < rhs->size();
+    });
+    std::vector<uint32_t> candidates = *postings.front();
+    for (size_t i = 1; i < postings.size() && !candidates.empty(); ++i) {
+        candidates = intersect(candidates, *postings[i]);
+    }
+
+    // Trigrams may be spread across fields or out of order, so confirm the term appears in a field.
+    std::vector<uint32_t> matches;
+    for (const uint32_t element_index : candidates) {
+        const auto &fields = fields_[element_index];
+        if (std::any_of(fields.begin(), fields.end(), [&term](const std::string &field) {
+                return field.find(term) != std::string::npos;
+            })) {
+            matches.push_back(element_index);
+        }
+    }
+    return matches;
+}
+
+std::vector<uint32_t> ClickabledataSearchIndex::find_prefix_matches(const std::string &term) const {
+    std::vector<uint32_t> matches;
+    for (auto word = std::lower_bound(words_.begin(), words_.end(), std::make_pair(term, uint32_t{0}));
+         word != words_.end() && word->first.compare(0, term.size(), term) == 0;
+         ++word) {
+        matches.push_back(word->second);
+    }
+    std::sort(matches.begin(), matches.end());
+    matches.erase(std::unique(matches.begin(), matches.end()), matches.end());
+    return matches;
+}
+
+int ClickabledataSearchIndex::score_term(const IndexedFields &fields, const std::string &term) const {
+    int best_score = 0;
+    for (size_t f = 0; f < kNumIndexedFields; ++f) {
+        const std::string &field = fields[f];
+        int quality = 0;
+        if (field == term) {
+            quality = kWholeFieldMatch;
+        } else {
+            for (size_t pos = field.find(term); pos != std::string::npos; pos = field.find(term, pos + 1)) {
+                quality = std::max(quality, is_word_start(field, pos) ? kWordPrefixMatch : kSubstringMatch);
+            }
+        }
+        best_score = std::max(best_score, quality * kFieldWeights[f]);
+    }
+    return best_score;
+}
@@ -0,0 +1,76 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "DcsIdLookup.h"
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Search index over the clickabledata elements of a module, so the ID Lookup window can query elements without
+ *        receiving the whole module.
+ *
+ * Element names, hints, device names and arg (DCS) IDs are indexed by trigram for substring queries, and by word for
+ * prefix queries shorter than a trigram. Query terms are case-insensitive and separated by spaces, and an element must
+ * match every term. Matches are ranked by which field matched (an exact arg ID first, then element name, device and
+ * hint) and how well (whole field, word prefix, then substring), with ties listed in ID Lookup window order.
+ */
+class ClickabledataSearchIndex {
+  public:
+    using SearchResults = struct {
+        std::vector<size_t> element_indices; // Indices of the top ranked matching elements, best first.
+        size_t total_matches;                // Number of matching elements, including those not returned.
+    };
+
+    /**
+     * @brief Construct a new Clickabledata Search Index over a module's elements.
+     *
+     * @param elements Extracted clickabledata elements of a module.
+     */
+    explicit ClickabledataSearchIndex(std::vector<ClickabledataElement> elements);
+
+    /**
+     * @brief Returns the indexed elements, in the order they were extracted.
+     */
+    const std::vector<ClickabledataElement> &get_elements() const;
+
+    /**
+     * @brief Searches the elements, returning the best ranked matches.
+     *
+     * @param query Space separated search terms, an empty query matches all elements in ID Lookup window order.
+     * @param max_results Maximum number of element indices returned.
+     * @return SearchResults Ranked matches and the total number of matches.
+     */
+    SearchResults search(const std::string &query, const size_t max_results) const;
+
+  private:
+    static constexpr size_t kNumIndexedFields = 4;
+    using IndexedFields = std::array<std::string, kNumIndexedFields>; // Upper case arg, element, device and hint.
+
+    /**
+     * @brief Returns the elements containing every trigram of a term, verified to contain the whole term.
+     */
+    std::vector<uint32_t> find_substring_matches(const std::string &term) const;
+
+    /**
+     * @brief Returns the elements containing a word starting with a term.
+     */
+    std::vector<uint32_t> find_prefix_matches(const std::string &term) const;
+
+    /**
+     * @brief Scores how well an element matches a term, higher is better.
+     */
+    int score_term(const IndexedFields &fields, const std::string &term) const;
+
+    std::vector<ClickabledataElement> elements_;
+    std::vector<IndexedFields> fields_;     // Normalized indexed fields of each element.
+    std::vector<uint32_t> display_rank_;    // Position of each element in ID Lookup window order.
+    std::vector<uint32_t> display_order_;   // Elements in ID Lookup window order.
+    std::unordered_map<uint32_t, std::vector<uint32_t>> trigrams_; // Sorted elements containing each trigram.
+    std::vector<std::pair<std::string, uint32_t>> words_;            // Sorted (word, element) pairs.
+};
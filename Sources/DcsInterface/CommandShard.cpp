@@ -0,0 +1,99 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "CommandShard.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+const std::string kShardPrefix = "registerCommandShard(";
+const std::string kShardSuffix = ");\n";
+
+// Attribute of each column, in the order of clickabledata_json_columns.
+std::string ClickabledataElement::*const kColumnAttributes[] = {&ClickabledataElement::device,
+                                                                &ClickabledataElement::device_id,
+                                                                &ClickabledataElement::command,
+                                                                &ClickabledataElement::element,
+                                                                &ClickabledataElement::class_name,
+                                                                &ClickabledataElement::arg,
+                                                                &ClickabledataElement::arg_value,
+                                                                &ClickabledataElement::arg_lim_min,
+                                                                &ClickabledataElement::arg_lim_max,
+                                                                &ClickabledataElement::hint};
+constexpr size_t kNumColumns = sizeof(kColumnAttributes) / sizeof(kColumnAttributes[0]);
+} // namespace
+
+std::string encode_command_shard(const std::string &module_name, const std::vector<ClickabledataElement> &elements) {
+    std::vector<const ClickabledataElement *> sorted_elements;
+    sorted_elements.reserve(elements.size());
+    for (const auto &element : elements) {
+        sorted_elements.push_back(&element);
+    }
+    std::stable_sort(sorted_elements.begin(),
+                     sorted_elements.end(),
+                     [](const ClickabledataElement *lhs, const ClickabledataElement *rhs) {
+                         return clickabledata_element_less(*lhs, *rhs);
+                     });
+
+    // Number the distinct values by frequency, so the most repeated values have the shortest indices.
+    std::unordered_map<std::string, size_t> value_counts;
+    for (const auto *element : sorted_elements) {
+        for (const auto attribute : kColumnAttributes) {
+            ++value_counts[element->*attribute];
+        }
+    }
+    std::vector<std::pair<std::string, size_t>> values(value_counts.begin(), value_counts.end());
+    std::sort(values.begin(), values.end(), [](const auto &lhs, const auto &rhs) {
+        return (lhs.second != rhs.second) ? lhs.second > rhs.second : lhs.first < rhs.first;
+    });
+    std::unordered_map<std::string, size_t> value_indices;
+    json strings = json::array();
+    for (const auto &[value, count] : values) {
+        value_indices[value] = strings.size();
+        strings.push_back(value);
+    }
+
+    json rows = json::array();
+    for (const auto *element : sorted_elements) {
+        for (const auto attribute : kColumnAttributes) {
+            rows.push_back(value_indices[element->*attribute]);
+        }
+    }
+
+    const json shard = {
+        {"module", module_name}, {"columns", clickabledata_json_columns()}, {"strings", strings}, {"rows", rows}};
+    return kShardPrefix + shard.dump() + kShardSuffix;
+}
+
+std::vector<ClickabledataElement> decode_command_shard(const std::string &shard, std::string &module_name) {
+    const bool has_prefix = shard.compare(0, kShardPrefix.size(), kShardPrefix) == 0;
+    const bool has_suffix = shard.size() >= kShardPrefix.size() + kShardSuffix.size() &&
+                            shard.compare(shard.size() - kShardSuffix.size(), kShardSuffix.size(), kShardSuffix) == 0;
+    if (!has_prefix || !has_suffix) {
+        throw std::runtime_error("Command shard does not call registerCommandShard");
+    }
+    const json contents = json::parse(
+        shard.substr(kShardPrefix.size(), shard.size() - kShardPrefix.size() - kShardSuffix.size()), nullptr, false);
+    const auto has = [&contents](const std::string &key) { return contents.is_object() && contents.count(key) > 0; };
+    if (!has("module") || !contents["module"].is_string() || !has("columns") ||
+        contents["columns"] != clickabledata_json_columns() || !has("strings") || !contents["strings"].is_array() ||
+        !has("rows") || !contents["rows"].is_array() || contents["rows"].size() % kNumColumns != 0) {
+        throw std::runtime_error("Command shard is malformed");
+    }
+
+    module_name = contents["module"];
+    const json &strings = contents["strings"];
+    const json &rows = contents["rows"];
+    std::vector<ClickabledataElement> elements(rows.size() / kNumColumns);
+    for (size_t i = 0; i < rows.size(); ++i) {
+        if (!rows[i].is_number_unsigned() || rows[i].get<size_t>() >= strings.size() ||
+            !strings[rows[i].get<size_t>()].is_string()) {
+            throw std::runtime_error("Command shard string index out of range");
+        }
+        elements[i / kNumColumns].*kColumnAttributes[i % kNumColumns] = strings[rows[i].get<size_t>()];
+    }
+    return elements;
+}
@@ -0,0 +1,34 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "DcsIdLookup.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Encodes a module's clickabledata as a command shard, the script stored with the Property Inspector for each
+ *        module and loaded on demand by the ID Lookup window when the module cannot be looked up in DCS.
+ *
+ * The shard calls registerCommandShard with a compact indexed form of the elements, sorted in ID Lookup window order:
+ *   registerCommandShard({"module": "A-10C", "columns": ["device", ...], "strings": ["BTN", "1", ...],
+ *                         "rows": [4, 12, 7, ...]});
+ * Each distinct attribute value is stored once in "strings" (most frequent first), and "rows" holds the string index
+ * of each column value of each element, one element after the other.
+ *
+ * @param module_name Name of the module (e.g. "A-10C").
+ * @param elements    Clickabledata elements of the module.
+ * @return std::string Contents of the shard script.
+ */
+std::string encode_command_shard(const std::string &module_name, const std::vector<ClickabledataElement> &elements);
+
+/**
+ * @brief Decodes a command shard written by encode_command_shard.
+ *
+ * @param shard       Contents of the shard script.
+ * @param module_name Set to the name of the module of the shard.
+ * @return std::vector<ClickabledataElement> Elements of the shard, in ID Lookup window order.
+ * @throws std::runtime_error if the shard is malformed.
+ */
+std::vector<ClickabledataElement> decode_command_shard(const std::string &shard, std::string &module_name);
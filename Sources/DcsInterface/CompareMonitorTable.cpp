@@ -0,0 +1,76 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "CompareMonitorTable.h"
+
+#include <limits>
+
+size_t CompareMonitorTable::add(const std::optional<CompareMonitor> &monitor) {
+    size_t row;
+    if (!free_rows_.empty()) {
+        row = free_rows_.back();
+        free_rows_.pop_back();
+    } else {
+        row = dcs_ids_.size();
+        dcs_ids_.push_back(0);
+        conditions_.push_back(GREATER_THAN);
+        comparison_values_.push_back(0.0);
+        game_values_.push_back(std::numeric_limits<double>::quiet_NaN());
+        states_.push_back(0);
+        row_is_active_.push_back(false);
+        row_is_used_.push_back(false);
+    }
+    row_is_used_[row] = true;
+    update(row, monitor);
+    return row;
+}
+
+void CompareMonitorTable::update(const size_t row, const std::optional<CompareMonitor> &monitor) {
+    if (row_is_active_[row]) {
+        --active_rows_;
+    }
+    row_is_active_[row] = monitor.has_value();
+    if (monitor) {
+        // The previous state is kept until the row is evaluated again, so the context does not flicker to the first
+        // state between a settings update and the next evaluation.
+        ++active_rows_;
+        dcs_ids_[row] = monitor->dcs_id;
+        conditions_[row] = static_cast<uint8_t>(monitor->condition);
+        comparison_values_[row] = monitor->comparison_value;
+    } else {
+        game_values_[row] = std::numeric_limits<double>::quiet_NaN();
+        states_[row] = 0;
+    }
+}
+
+void CompareMonitorTable::remove(const size_t row) {
+    if (row < row_is_used_.size() && row_is_used_[row]) {
+        update(row, std::nullopt);
+        row_is_used_[row] = false;
+        free_rows_.push_back(row);
+    }
+}
+
+void CompareMonitorTable::evaluate(const DcsInterface *dcs_interface) {
+    const size_t num_rows = dcs_ids_.size();
+
+    // Gather values of the monitored DCS IDs into a contiguous array.
+    constexpr double kNoValue = std::numeric_limits<double>::quiet_NaN();
+    for (size_t row = 0; row < num_rows; ++row) {
+        if (row_is_active_[row]) {
+            const DcsIdValue *dcs_id_value = dcs_interface->get_typed_value_of_dcs_id(dcs_ids_[row]);
+            game_values_[row] = (dcs_id_value != nullptr && dcs_id_value->is_number) ? dcs_id_value->number : kNoValue;
+        }
+    }
+
+    // Branch-free comparison over all rows (inactive rows hold NaN and so evaluate to state 0).
+    const double *game_values = game_values_.data();
+    const double *comparison_values = comparison_values_.data();
+    const uint8_t *conditions = conditions_.data();
+    uint8_t *states = states_.data();
+    for (size_t row = 0; row < num_rows; ++row) {
+        states[row] = static_cast<uint8_t>(
+            compare(game_values[row], static_cast<CompareConditionType>(conditions[row]), comparison_values[row]));
+    }
+}
@@ -0,0 +1,93 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "DcsInterface.h"
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using CompareConditionType = enum { GREATER_THAN, EQUAL_TO, LESS_THAN };
+
+using CompareMonitor = struct {
+    int dcs_id;                       // DCS ID to monitor.
+    CompareConditionType condition;   // Comparison to apply to the DCS ID value.
+    double comparison_value;          // Value to compare the DCS ID value to.
+};
+
+/**
+ * @brief Structure-of-arrays table of DCS ID compare monitors for many Streamdeck contexts, evaluated for all rows at
+ * once. Only the data needed for evaluation is stored here so the comparison loop runs over contiguous arrays.
+ *
+ */
+class CompareMonitorTable {
+  public:
+    /**
+     * @brief Compares a game value to a comparison value using the requested condition.
+     *        A NaN game value (used for missing or non-numeric values) never satisfies a condition.
+     */
+    static inline bool compare(const double game_value,
+                               const CompareConditionType condition,
+                               const double comparison_value) {
+        return ((condition == GREATER_THAN) & (game_value > comparison_value)) |
+               ((condition == EQUAL_TO) & (game_value == comparison_value)) |
+               ((condition == LESS_THAN) & (game_value < comparison_value));
+    }
+
+    /**
+     * @brief Adds a row to the table, reusing a previously removed row if available.
+     *
+     * @param monitor Compare monitor to evaluate in this row, or nullopt to leave the row inactive.
+     * @return Row index to use for later updates and state queries.
+     */
+    size_t add(const std::optional<CompareMonitor> &monitor);
+
+    /**
+     * @brief Replaces the compare monitor of a row, keeping the state of the row until its next evaluation.
+     *
+     * @param row     Row index returned by add().
+     * @param monitor Compare monitor to evaluate in this row, or nullopt to set the row inactive.
+     */
+    void update(const size_t row, const std::optional<CompareMonitor> &monitor);
+
+    /**
+     * @brief Removes a row from the table so it may be reused.
+     *
+     * @param row Row index returned by add().
+     */
+    void remove(const size_t row);
+
+    /**
+     * @brief Gathers current values of the monitored DCS IDs and evaluates the comparisons of all rows.
+     *
+     * @param dcs_interface Interface to DCS containing current game state.
+     */
+    void evaluate(const DcsInterface *dcs_interface);
+
+    /**
+     * @brief Returns the context state from the last evaluation (1 if comparison was satisfied, otherwise 0).
+     *
+     * @param row Row index returned by add().
+     */
+    int state(const size_t row) const { return states_[row]; }
+
+    /**
+     * @brief Returns the number of active rows in the table.
+     */
+    size_t active_rows() const { return active_rows_; }
+
+  private:
+    // Hot evaluation data, one element per row.
+    std::vector<int> dcs_ids_;
+    std::vector<uint8_t> conditions_;
+    std::vector<double> comparison_values_;
+    std::vector<double> game_values_; // Gathered game values, NaN when missing or non-numeric.
+    std::vector<uint8_t> states_;
+
+    // Row bookkeeping.
+    std::vector<uint8_t> row_is_active_; // Rows with a compare monitor set which need their value gathered.
+    std::vector<uint8_t> row_is_used_;   // Rows which have been added and not removed.
+    std::vector<size_t> free_rows_;      // Removed rows available for reuse.
+    size_t active_rows_ = 0;
+};
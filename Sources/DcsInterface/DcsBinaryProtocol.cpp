@@ -0,0 +1,152 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "DcsBinaryProtocol.h"
+
+#include <cstdio>
+#include <cstring>
+
+namespace {
+constexpr int kTypeBits = 3;       // Bits of the value type in the varint starting each value.
+constexpr int kMaxVarintBytes = 5; // Bytes of a varint encoding 32 bits.
+
+/**
+ * @brief Reads a varint of up to 32 bits, advancing pos past it.
+ *
+ * @return False if the varint is truncated or too long.
+ */
+bool read_varint(const std::string_view packet, size_t &pos, uint32_t &result) {
+    result = 0;
+    for (int i = 0; i < kMaxVarintBytes && pos < packet.size(); ++i) {
+        const uint8_t byte = static_cast<uint8_t>(packet[pos++]);
+        result |= static_cast<uint32_t>(byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @brief Reads 4 little-endian bytes at pos, which must be within the packet.
+ */
+uint32_t read_uint32(const std::string_view packet, const size_t pos) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(packet[pos])) |
+           static_cast<uint32_t>(static_cast<uint8_t>(packet[pos + 1])) << 8 |
+           static_cast<uint32_t>(static_cast<uint8_t>(packet[pos + 2])) << 16 |
+           static_cast<uint32_t>(static_cast<uint8_t>(packet[pos + 3])) << 24;
+}
+
+/**
+ * @brief Reads a length-prefixed string, advancing pos past it.
+ *
+ * @return False if the string is truncated.
+ */
+bool read_short_string(const std::string_view packet, size_t &pos, std::string_view &result) {
+    if (pos >= packet.size()) {
+        return false;
+    }
+    const size_t length = static_cast<uint8_t>(packet[pos++]);
+    if (packet.size() - pos < length) {
+        return false;
+    }
+    result = packet.substr(pos, length);
+    pos += length;
+    return true;
+}
+} // namespace
+
+bool decode_binary_export_packet(const std::string_view packet, std::vector<BinaryExportValue> &values) {
+    BinaryExportFrame frame;
+    return decode_binary_export_packet(packet, frame, values);
+}
+
+bool decode_binary_export_packet(const std::string_view packet,
+                                 BinaryExportFrame &frame,
+                                 std::vector<BinaryExportValue> &values) {
+    values.clear();
+    frame = BinaryExportFrame{};
+    if (!is_binary_export_packet(packet)) {
+        return false;
+    }
+
+    size_t pos = kBinaryExportHeader.size();
+    if (packet.substr(0, pos) == kSequencedBinaryExportHeader) {
+        frame.is_sequenced = true;
+        if (!read_varint(packet, pos, frame.sequence) || pos >= packet.size()) {
+            return false;
+        }
+        const uint8_t flags = static_cast<uint8_t>(packet[pos++]);
+        frame.is_stream_start = (flags & kBinaryExportStreamStart) != 0;
+        frame.is_keyframe = (flags & kBinaryExportKeyframe) != 0;
+        if (frame.is_keyframe) {
+            if (packet.size() - pos < 4) {
+                return false;
+            }
+            frame.checksum = read_uint32(packet, pos);
+            pos += 4;
+        }
+    }
+
+    while (pos < packet.size()) {
+        const size_t value_start = pos;
+        uint32_t id_and_type = 0;
+        if (!read_varint(packet, pos, id_and_type)) {
+            return false;
+        }
+        BinaryExportValue value{};
+        value.type = static_cast<BinaryExportValueType>(id_and_type & ((1 << kTypeBits) - 1));
+        value.dcs_id = static_cast<int>(id_and_type >> kTypeBits);
+
+        switch (value.type) {
+        case BINARY_FLOAT32: {
+            if (packet.size() - pos < 4) {
+                return false;
+            }
+            const uint32_t bits = read_uint32(packet, pos);
+            float number;
+            std::memcpy(&number, &bits, sizeof(number));
+            value.number = number;
+            pos += 4;
+            break;
+        }
+        case BINARY_INT: {
+            uint32_t zigzag = 0;
+            if (!read_varint(packet, pos, zigzag)) {
+                return false;
+            }
+            value.number = static_cast<int32_t>((zigzag >> 1) ^ (~(zigzag & 1) + 1));
+            break;
+        }
+        case BINARY_FALSE:
+        case BINARY_TRUE:
+            value.number = (value.type == BINARY_TRUE) ? 1.0 : 0.0;
+            break;
+        case BINARY_NAMED_STRING:
+            if (!read_short_string(packet, pos, value.key)) {
+                return false;
+            }
+            [[fallthrough]];
+        case BINARY_STRING:
+            if (!read_short_string(packet, pos, value.str)) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+        value.encoded = packet.substr(value_start, pos - value_start);
+        values.push_back(value);
+    }
+    return true;
+}
+
+std::string format_binary_export_number(const BinaryExportValue &value) {
+    if (value.type == BINARY_FLOAT32) {
+        char text[32];
+        std::snprintf(text, sizeof(text), "%.7g", value.number);
+        return text;
+    }
+    return std::to_string(static_cast<int32_t>(value.number));
+}
@@ -0,0 +1,111 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Compact binary alternative to the "header*id=value:id=value" text format of packets exported from DCS, sent by
+ * export scripts using DcsExportScripts/StreamdeckBinaryExport.lua.
+ *
+ * A packet is the header kBinaryExportHeader followed by values, each starting with a varint (little-endian base 128)
+ * of (DCS ID << 3 | type), followed by the payload of its type:
+ *   BINARY_FLOAT32      4 byte little-endian IEEE 754 single precision float.
+ *   BINARY_INT          Zigzag encoded varint of a 32 bit signed integer.
+ *   BINARY_FALSE/TRUE   No payload.
+ *   BINARY_STRING       Length byte followed by up to 255 bytes of string.
+ *   BINARY_NAMED_STRING Length-prefixed key followed by length-prefixed string, for keys which are not DCS IDs (such
+ *                       as "File"). The DCS ID of the value is ignored.
+ * The header starts with a NUL character, which never starts a text packet, so both formats can be received together.
+ *
+ * Sequenced packets instead start with kSequencedBinaryExportHeader, followed by a varint sequence number incremented
+ * with each packet, a flags byte and, for keyframes (flag kBinaryExportKeyframe), a 4 byte little-endian checksum of
+ * the exporter's state after the packet, before their values. Other packets are deltas holding only changed values.
+ * The state checksum is the sum (modulo 2^32) over each DCS ID of hash_binary_export_value of its last sent value.
+ * The first packet of a stream, after which the exporter has sent no earlier values, has flag kBinaryExportStreamStart.
+ */
+constexpr std::string_view kBinaryExportHeader("\0SDB\1", 5);
+constexpr std::string_view kSequencedBinaryExportHeader("\0SDB\2", 5);
+constexpr uint8_t kBinaryExportKeyframe = 0x01;
+constexpr uint8_t kBinaryExportStreamStart = 0x02;
+
+using BinaryExportValueType = enum {
+    BINARY_FLOAT32 = 0,
+    BINARY_INT = 1,
+    BINARY_FALSE = 2,
+    BINARY_TRUE = 3,
+    BINARY_STRING = 4,
+    BINARY_NAMED_STRING = 5
+};
+
+using BinaryExportValue = struct {
+    BinaryExportValueType type; // Type the value was encoded as.
+    int dcs_id;                 // DCS ID of the value, unused for named strings.
+    double number;              // Value of float, int and bool types (0 or 1).
+    std::string_view key;       // Key of named strings, referencing the decoded packet.
+    std::string_view str;       // Value of string types, referencing the decoded packet.
+    std::string_view encoded;   // Encoded bytes of the value, referencing the decoded packet.
+};
+
+using BinaryExportFrame = struct {
+    bool is_sequenced;    // True if the packet has a sequence number.
+    uint32_t sequence;    // Sequence number of a sequenced packet.
+    bool is_stream_start; // True if the packet starts a new stream.
+    bool is_keyframe;     // True if the packet carries a checksum of the exporter's state.
+    uint32_t checksum;    // State checksum of a keyframe.
+};
+
+/**
+ * @brief Returns true if a received packet is in the binary export format rather than the text format.
+ */
+inline bool is_binary_export_packet(const std::string_view packet) {
+    const std::string_view header = packet.substr(0, kBinaryExportHeader.size());
+    return header == kBinaryExportHeader || header == kSequencedBinaryExportHeader;
+}
+
+/**
+ * @brief Decodes the values of a binary export packet.
+ *
+ * @param packet Received packet, which must outlive the decoded string values.
+ * @param values [out] Decoded values, replacing previous contents so the vector can be reused between packets.
+ * @return True if the packet was decoded, false if it is not a binary export packet or is malformed, in which case
+ *         values holds those decoded before the malformed value.
+ */
+bool decode_binary_export_packet(const std::string_view packet, std::vector<BinaryExportValue> &values);
+
+/**
+ * @brief Decodes the sequence information and values of a binary export packet.
+ *
+ * @param packet Received packet, which must outlive the decoded string values.
+ * @param frame [out] Sequence information of the packet, is_sequenced is false for packets without.
+ * @param values [out] Decoded values, as for decode_binary_export_packet without frame.
+ * @return True if the packet was decoded.
+ */
+bool decode_binary_export_packet(const std::string_view packet,
+                                 BinaryExportFrame &frame,
+                                 std::vector<BinaryExportValue> &values);
+
+/**
+ * @brief Hashes the encoded bytes of a value, for the state checksum of sequenced packets.
+ *
+ * Uses h = h * 65599 + byte (modulo 2^32) from h = 0, which export scripts can compute exactly with Lua 5.1 numbers.
+ */
+inline uint32_t hash_binary_export_value(const std::string_view encoded) {
+    uint32_t hash = 0;
+    for (const char byte : encoded) {
+        hash = hash * 65599 + static_cast<uint8_t>(byte);
+    }
+    return hash;
+}
+
+/**
+ * @brief Formats a decoded number value as the text it is stored as in the game state, with up to 7 significant
+ *        digits for floats (the precision of float32).
+ *
+ * @param value Decoded value of float, int or bool type.
+ * @return Text of the value, such as "1", "-12" or "0.25".
+ */
+std::string format_binary_export_number(const BinaryExportValue &value);
@@ -0,0 +1,140 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "DcsBiosProtocol.h"
+
+#include <cstdlib>
+
+namespace {
+constexpr uint8_t kSyncByte = 0x55;
+// Address written by the sync sequence itself, which ends a frame rather than starting a record.
+constexpr uint16_t kSyncAddress = 0x5555;
+// Bits of a DCS ID representing a DCS-BIOS output, as (address << 8 | shift << 4 | (bit count - 1)).
+constexpr int kShiftBits = 4;
+constexpr int kBitCountBits = 4;
+
+/**
+ * @brief Parses an unsigned decimal or "0x" prefixed hexadecimal number of up to 16 bits.
+ */
+bool parse_uint16(const std::string_view text, uint16_t &result) {
+    const bool is_hex = text.size() > 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X');
+    const std::string digits(is_hex ? text.substr(2) : text);
+    if (digits.empty() || digits.size() > 5) {
+        return false;
+    }
+    char *end;
+    const unsigned long value = std::strtoul(digits.c_str(), &end, is_hex ? 16 : 10);
+    if (*end != '\0' || digits[0] == '-' || digits[0] == '+' || value > 0xFFFF) {
+        return false;
+    }
+    result = static_cast<uint16_t>(value);
+    return true;
+}
+} // namespace
+
+bool parse_dcs_bios_output(const std::string_view text, DcsBiosOutput &output) {
+    const size_t mask_start = text.find('/');
+    const size_t shift_start = text.find('/', mask_start + 1);
+    if (mask_start == std::string_view::npos || shift_start == std::string_view::npos) {
+        return false;
+    }
+    uint16_t shift = 0;
+    if (!parse_uint16(text.substr(0, mask_start), output.address) ||
+        !parse_uint16(text.substr(mask_start + 1, shift_start - mask_start - 1), output.mask) ||
+        !parse_uint16(text.substr(shift_start + 1), shift) || shift > 15) {
+        return false;
+    }
+    output.shift = static_cast<uint8_t>(shift);
+
+    // The mask must be a contiguous run of bits starting at the shift.
+    const unsigned shifted_mask = output.mask >> output.shift;
+    return (output.address % 2 == 0) && (shifted_mask << output.shift == output.mask) && (shifted_mask & 1) &&
+           ((shifted_mask & (shifted_mask + 1)) == 0);
+}
+
+int dcs_bios_output_to_dcs_id(const DcsBiosOutput &output) {
+    int bit_count = 0;
+    for (unsigned mask = output.mask >> output.shift; mask != 0; mask >>= 1) {
+        ++bit_count;
+    }
+    const int encoded = (output.address << (kShiftBits + kBitCountBits)) | (output.shift << kBitCountBits) |
+                        (bit_count - 1);
+    return -1 - encoded;
+}
+
+bool dcs_id_to_dcs_bios_output(const int dcs_id, DcsBiosOutput &output) {
+    if (dcs_id >= 0) {
+        return false;
+    }
+    const int encoded = -1 - dcs_id;
+    if (encoded >= (1 << (16 + kShiftBits + kBitCountBits))) {
+        return false;
+    }
+    const int bit_count = (encoded & ((1 << kBitCountBits) - 1)) + 1;
+    output.address = static_cast<uint16_t>(encoded >> (kShiftBits + kBitCountBits));
+    output.shift = static_cast<uint8_t>((encoded >> kBitCountBits) & ((1 << kShiftBits) - 1));
+    output.mask = static_cast<uint16_t>(((1u << bit_count) - 1) << output.shift);
+    return output.address % 2 == 0 && output.shift + bit_count <= 16;
+}
+
+DcsBiosStateBuffer::DcsBiosStateBuffer() : word_written_(kSize / 2), word_is_dirty_(kSize / 2) {}
+
+void DcsBiosStateBuffer::parse(const std::string_view data) {
+    for (const char c : data) {
+        const uint8_t byte = static_cast<uint8_t>(c);
+        switch (state_) {
+        case WAIT_FOR_SYNC:
+            break;
+        case ADDRESS_LOW:
+            address_ = byte;
+            state_ = ADDRESS_HIGH;
+            break;
+        case ADDRESS_HIGH:
+            address_ |= byte << 8;
+            state_ = (address_ == kSyncAddress) ? WAIT_FOR_SYNC : COUNT_LOW;
+            break;
+        case COUNT_LOW:
+            count_ = byte;
+            state_ = COUNT_HIGH;
+            break;
+        case COUNT_HIGH:
+            count_ |= byte << 8;
+            state_ = (count_ == 0) ? ADDRESS_LOW : DATA;
+            break;
+        case DATA: {
+            if (memory_[address_] != byte || !word_written_[address_ / 2]) {
+                memory_[address_] = byte;
+                const size_t word = address_ / 2;
+                if (!word_is_dirty_[word]) {
+                    word_is_dirty_[word] = 1;
+                    dirty_words_.push_back(static_cast<uint16_t>(word * 2));
+                }
+            }
+            // Words are written in pairs of bytes, so a word is written once its high byte is.
+            if (address_ % 2 == 1) {
+                word_written_[address_ / 2] = 1;
+            }
+            ++address_;
+            state_ = (--count_ == 0) ? ADDRESS_LOW : DATA;
+            break;
+        }
+        }
+
+        // As in the DCS-BIOS reference parser, the sync sequence starts a frame from any state so the parser recovers
+        // from lost or truncated packets.
+        sync_bytes_ = (byte == kSyncByte) ? sync_bytes_ + 1 : 0;
+        if (sync_bytes_ == static_cast<int>(kDcsBiosSync.size())) {
+            sync_bytes_ = 0;
+            state_ = ADDRESS_LOW;
+            ++frame_count_;
+        }
+    }
+}
+
+void DcsBiosStateBuffer::clear_dirty_words() {
+    for (const uint16_t address : dirty_words_) {
+        word_is_dirty_[address / 2] = 0;
+    }
+    dirty_words_.clear();
+}
@@ -0,0 +1,123 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * DCS-BIOS exports the cockpit state as a 64 KiB address space of 16-bit little-endian words, streamed as write
+ * records of (address, byte count, data) with 16-bit little-endian address and count. Each frame starts with the sync
+ * sequence kDcsBiosSync (which also starts each UDP packet), and writes the frame counter at address 0xFFFE.
+ *
+ * Integer outputs are read from a word as (word & mask) >> shift, which DCS-BIOS control references list as the
+ * "address", "mask" and "shift_by" of each output.
+ */
+constexpr std::string_view kDcsBiosSync("\x55\x55\x55\x55", 4);
+
+using DcsBiosOutput = struct {
+    uint16_t address; // Address of the word holding the output, which is even.
+    uint16_t mask;    // Mask of the bits of the output within the word, which are contiguous.
+    uint8_t shift;    // Position of the lowest bit of the mask.
+};
+
+/**
+ * @brief Returns true if a received packet is a DCS-BIOS export packet rather than a DCS-ExportScripts packet.
+ */
+inline bool is_dcs_bios_packet(const std::string_view packet) {
+    return packet.substr(0, kDcsBiosSync.size()) == kDcsBiosSync;
+}
+
+/**
+ * @brief Parses a DCS-BIOS integer output written as "address/mask/shift", with each number in decimal or hexadecimal
+ *        with a "0x" prefix (e.g. "0x4426/0x0100/8").
+ *
+ * @param text Text to parse.
+ * @param output [out] Parsed output.
+ * @return False if the text is not a valid output, such as having an odd address or a shift not matching the mask.
+ */
+bool parse_dcs_bios_output(const std::string_view text, DcsBiosOutput &output);
+
+/**
+ * @brief Converts a DCS-BIOS output to the negative DCS ID representing it, so it can be monitored and stored like the
+ *        DCS IDs of DCS-ExportScripts, which are never negative.
+ */
+int dcs_bios_output_to_dcs_id(const DcsBiosOutput &output);
+
+/**
+ * @brief Converts a DCS ID to the DCS-BIOS output it represents.
+ *
+ * @param dcs_id DCS ID to convert.
+ * @param output [out] DCS-BIOS output.
+ * @return False if the DCS ID does not represent a DCS-BIOS output.
+ */
+bool dcs_id_to_dcs_bios_output(const int dcs_id, DcsBiosOutput &output);
+
+/**
+ * @brief Shadow copy of the DCS-BIOS address space, updated from the received stream with per-word dirty tracking so
+ *        only outputs of changed words need to be read.
+ */
+class DcsBiosStateBuffer {
+  public:
+    static constexpr size_t kSize = 0x10000; // Bytes of the address space.
+
+    DcsBiosStateBuffer();
+
+    /**
+     * @brief Applies the write records of received stream data, which may split records and frames at any byte.
+     *        Words whose value changes are marked dirty.
+     *
+     * @param data Received bytes of the stream.
+     */
+    void parse(const std::string_view data);
+
+    /**
+     * @brief Reads the 16-bit word at an even address.
+     */
+    uint16_t read_word(const uint16_t address) const {
+        return static_cast<uint16_t>(memory_[address] | (memory_[address + 1] << 8));
+    }
+
+    /**
+     * @brief Reads the value of an integer output.
+     */
+    unsigned read(const DcsBiosOutput &output) const {
+        return (read_word(output.address) & output.mask) >> output.shift;
+    }
+
+    /**
+     * @brief Returns true if the word at an even address has been written since the stream started.
+     */
+    bool is_written(const uint16_t address) const { return word_written_[address / 2] != 0; }
+
+    /**
+     * @brief Returns the addresses of words changed since the last clear_dirty_words, in order of first change.
+     */
+    const std::vector<uint16_t> &dirty_words() const { return dirty_words_; }
+
+    /**
+     * @brief Clears the dirty words, such as after reading their outputs.
+     */
+    void clear_dirty_words();
+
+    /**
+     * @brief Returns the number of frames started in the received stream.
+     */
+    unsigned frame_count() const { return frame_count_; }
+
+  private:
+    using ParserState = enum { WAIT_FOR_SYNC, ADDRESS_LOW, ADDRESS_HIGH, COUNT_LOW, COUNT_HIGH, DATA };
+
+    std::array<uint8_t, kSize> memory_{};  // Shadow copy of the address space.
+    std::vector<uint8_t> word_written_;    // Per word, set once the word has been written.
+    std::vector<uint8_t> word_is_dirty_;   // Per word, set while the word is in dirty_words_.
+    std::vector<uint16_t> dirty_words_;    // Addresses of words changed since the last clear.
+    ParserState state_ = WAIT_FOR_SYNC;    // Position of the parser within a write record.
+    int sync_bytes_ = 0;                   // Consecutive sync bytes received.
+    uint16_t address_ = 0;                 // Address of the next byte of the current record.
+    uint16_t count_ = 0;                   // Bytes remaining in the current record.
+    unsigned frame_count_ = 0;             // Frames started in the received stream.
+};
@@ -0,0 +1,45 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "DcsCommandBatch.h"
+
+#include <charconv>
+
+namespace {
+// Buffer size for the decimal representation of any int.
+constexpr size_t kMaxIntLength = 12;
+
+std::string_view format_button_id(char (&buffer)[kMaxIntLength], const int button_id) {
+    const auto result = std::to_chars(buffer, buffer + kMaxIntLength, button_id);
+    return std::string_view(buffer, result.ptr - buffer);
+}
+
+void append_encoded_command(std::string &message, const DcsCommand &command, const std::string_view button_id) {
+    message += 'C';
+    message += command.device_id;
+    message += ',';
+    message += button_id;
+    message += ',';
+    message += command.value;
+}
+} // namespace
+
+void append_dcs_command(std::string &message, const DcsCommand &command) {
+    char buffer[kMaxIntLength];
+    append_encoded_command(message, command, format_button_id(buffer, command.button_id));
+}
+
+bool append_batched_dcs_command(std::string &batch, const DcsCommand &command) {
+    char buffer[kMaxIntLength];
+    const std::string_view button_id = format_button_id(buffer, command.button_id);
+    const size_t length = 3 + command.device_id.size() + button_id.size() + command.value.size();
+    if (!batch.empty()) {
+        if (batch.size() + 1 + length > kMaxDcsCommandBatchLength) {
+            return false;
+        }
+        batch += kDcsCommandDelimiter;
+    }
+    append_encoded_command(batch, command, button_id);
+    return true;
+}
@@ -0,0 +1,43 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <string>
+#include <string_view>
+
+/**
+ * Batches of clickable data commands sent to DCS in a single message, decoded by export scripts using
+ * DcsExportScripts/StreamdeckCommandBatch.lua.
+ *
+ * A command is encoded as "C<device ID>,<button ID>,<value>", and a batch is its commands separated by
+ * kDcsCommandDelimiter. Commands never contain the delimiter, so a batch of one command is identical to a command
+ * sent on its own. Batches are only sent after export scripts advertise the token kDcsCommandBatchToken, since
+ * export scripts without support would read a batch as a single malformed command.
+ */
+constexpr char kDcsCommandDelimiter = '\n';
+constexpr std::string_view kDcsCommandBatchToken("Batch=1");
+// Maximum length of a batch, so each fits within a single UDP datagram.
+constexpr size_t kMaxDcsCommandBatchLength = 1000;
+
+using DcsCommand = struct {
+    int button_id;              // ID number of the button.
+    std::string_view device_id; // ID number of the device.
+    std::string_view value;     // Value to set the button to.
+};
+
+/**
+ * @brief Appends the encoding of a command to a message, without allocating beyond the message's capacity.
+ *
+ * @param message [out] Message to append to.
+ * @param command Command to encode.
+ */
+void append_dcs_command(std::string &message, const DcsCommand &command);
+
+/**
+ * @brief Appends a command to a batch if the batch would not exceed kMaxDcsCommandBatchLength.
+ *
+ * @param batch [out] Batch to append to, which may be empty.
+ * @param command Command to encode.
+ * @return False if the command was not appended because the batch is full, in which case it should be sent first.
+ */
+bool append_batched_dcs_command(std::string &batch, const DcsCommand &command);
@@ -0,0 +1,67 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "DcsCommandScheduler.h"
+
+#include <algorithm>
+
+DcsCommandScheduler::DcsCommandScheduler(const size_t messages_per_frame)
+    : messages_per_frame_(std::max<size_t>(messages_per_frame, 1)) {}
+
+void DcsCommandScheduler::set_messages_per_frame(const size_t messages_per_frame) {
+    messages_per_frame_ = std::max<size_t>(messages_per_frame, 1);
+}
+
+bool DcsCommandScheduler::schedule(const DcsCommandLane lane,
+                                   const std::string_view message,
+                                   const std::string_view coalesce_key) {
+    const bool higher_lanes_empty =
+        std::all_of(lanes_.begin(), lanes_.begin() + lane + 1,
+                    [](const std::deque<QueuedMessage> &queue) { return queue.empty(); });
+    if (higher_lanes_empty && frame_messages_ < messages_per_frame_) {
+        ++frame_messages_;
+        ++stats_.sent_immediately;
+        return true;
+    }
+
+    std::deque<QueuedMessage> &queue = lanes_[lane];
+    if (!coalesce_key.empty()) {
+        const auto superseded = std::find_if(queue.begin(), queue.end(), [&coalesce_key](const QueuedMessage &queued) {
+            return queued.coalesce_key == coalesce_key;
+        });
+        // The newer message is queued last rather than in place of the superseded message, so it is never sent ahead
+        // of messages queued in between, such as a momentary press of the same button.
+        if (superseded != queue.end()) {
+            queue.erase(superseded);
+            ++stats_.coalesced;
+        }
+    }
+    queue.push_back({std::string(message), std::string(coalesce_key)});
+    stats_.queue_depth[lane] = queue.size();
+    stats_.max_queue_depth[lane] = std::max(stats_.max_queue_depth[lane], queue.size());
+    return false;
+}
+
+void DcsCommandScheduler::start_frame() {
+    frame_messages_ = 0;
+    ++stats_.frames;
+}
+
+bool DcsCommandScheduler::next_message(std::string &message) {
+    if (frame_messages_ >= messages_per_frame_) {
+        return false;
+    }
+    for (size_t lane = 0; lane < kNumCommandLanes; ++lane) {
+        std::deque<QueuedMessage> &queue = lanes_[lane];
+        if (!queue.empty()) {
+            message = std::move(queue.front().message);
+            queue.pop_front();
+            stats_.queue_depth[lane] = queue.size();
+            ++frame_messages_;
+            ++stats_.sent_deferred;
+            return true;
+        }
+    }
+    return false;
+}
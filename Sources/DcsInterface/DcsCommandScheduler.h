@@ -0,0 +1,94 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <array>
+#include <deque>
+#include <string>
+#include <string_view>
+
+using DcsCommandLane = enum {
+    COMMAND_LANE_USER_INPUT = 0, // Commands of user key presses, sent first.
+    COMMAND_LANE_AUTOMATED = 1,  // Commands sent on the user's behalf, such as macros and synchronized switch sets.
+    COMMAND_LANE_CONTROL = 2     // Resets, resyncs and subscriptions of the export scripts.
+};
+constexpr size_t kNumCommandLanes = 3;
+
+using DcsCommandQueueStats = struct {
+    std::array<size_t, kNumCommandLanes> queue_depth;     // Messages currently queued in each lane.
+    std::array<size_t, kNumCommandLanes> max_queue_depth; // Most messages queued at once in each lane.
+    unsigned sent_immediately;                            // Messages sent as soon as they were scheduled.
+    unsigned sent_deferred;                               // Messages sent from a queue in a later frame.
+    unsigned coalesced;                                   // Queued messages dropped for a newer message.
+    unsigned frames;                                      // Frames started.
+};
+
+/**
+ * @brief Paces messages sent to DCS to a budget of messages per frame of DCS, so bursts are spread over the frames
+ *        in which export scripts can apply them rather than overflowing a single frame.
+ *
+ * Messages are sent immediately while the budget of the current frame lasts and no messages of the same or higher
+ * priority lanes are queued, otherwise they are queued in their lane. Queued messages are sent at the start of later
+ * frames in lane priority order, first in first out within each lane. A queued message with a coalesce key, such as
+ * an absolute value command to a device and button, is dropped when a newer message with the same key is queued in
+ * its lane rather than both being sent. The newer message is queued last, keeping the order of all sent messages.
+ */
+class DcsCommandScheduler {
+  public:
+    static constexpr size_t kDefaultMessagesPerFrame = 16; // Default budget of messages sent per frame.
+
+    /**
+     * @brief Construct a new scheduler.
+     *
+     * @param messages_per_frame Budget of messages sent per frame, at least 1.
+     */
+    DcsCommandScheduler(const size_t messages_per_frame = kDefaultMessagesPerFrame);
+
+    /**
+     * @brief Sets the budget of messages sent per frame, starting with the next frame.
+     *
+     * @param messages_per_frame Budget of messages sent per frame, at least 1.
+     */
+    void set_messages_per_frame(const size_t messages_per_frame);
+
+    /**
+     * @brief Schedules a message to send to DCS.
+     *
+     * @param lane Priority lane of the message.
+     * @param message Message to send, only copied if it is queued.
+     * @param coalesce_key Key of messages superseded by this message, or empty to never coalesce.
+     * @return True if the message should be sent now, otherwise it has been queued.
+     */
+    bool schedule(const DcsCommandLane lane, const std::string_view message, const std::string_view coalesce_key = {});
+
+    /**
+     * @brief Starts a new frame, renewing the budget of messages.
+     */
+    void start_frame();
+
+    /**
+     * @brief Removes the next queued message to send within the budget of the current frame.
+     *
+     * @param message [out] Message to send.
+     * @return False if no message is queued or the budget of the frame is spent.
+     */
+    bool next_message(std::string &message);
+
+    /**
+     * @brief Gets statistics of the queues.
+     *
+     * @return Current and maximum queue depths, and counts of sent and coalesced messages.
+     */
+    DcsCommandQueueStats get_stats() const { return stats_; }
+
+  private:
+    using QueuedMessage = struct {
+        std::string message;      // Message to send.
+        std::string coalesce_key; // Key of messages superseded by this message, or empty.
+    };
+
+    std::array<std::deque<QueuedMessage>, kNumCommandLanes> lanes_; // Queued messages of each lane.
+    size_t messages_per_frame_;                                     // Budget of messages sent per frame.
+    size_t frame_messages_ = 0;                                     // Messages sent in the current frame.
+    DcsCommandQueueStats stats_ = {};                               // Statistics of the queues.
+};
@@ -4,13 +4,37 @@
 
 #include "DcsIdLookup.h"
 
+#include "DcsInterfaceParameters.h"
+
 #include "../Vendor/lua-5.1.5/etc/lua.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <iostream>
 #include <string>
 #include <vector>
 
+namespace {
+using ClickabledataColumn = struct {
+    const char *name;                         // Column name sent to the Property Inspector.
+    std::string ClickabledataElement::*value; // Attribute of the element shown in the column.
+};
+
+const ClickabledataColumn kClickabledataColumns[] = {{"device", &ClickabledataElement::device},
+                                                     {"device_id", &ClickabledataElement::device_id},
+                                                     {"command", &ClickabledataElement::command},
+                                                     {"element", &ClickabledataElement::element},
+                                                     {"class", &ClickabledataElement::class_name},
+                                                     {"arg", &ClickabledataElement::arg},
+                                                     {"arg_value", &ClickabledataElement::arg_value},
+                                                     {"arg_lim_min", &ClickabledataElement::arg_lim_min},
+                                                     {"arg_lim_max", &ClickabledataElement::arg_lim_max},
+                                                     {"hint", &ClickabledataElement::hint}};
+
+// Serialized size reserved for the fields of a chunk other than its rows.
+constexpr size_t kChunkHeaderBytes = 256;
+} // namespace
+
 json get_installed_modules(const std::string &dcs_install_path, const std::string &module_subdir) {
     json installed_modules_and_result;
     installed_modules_and_result["installed_modules"] = json::array();
@@ -30,50 +54,183 @@ json get_installed_modules(const std::string &dcs_install_path, const std::strin
     return installed_modules_and_result;
 }
 
-json get_clickabledata(const std::string &dcs_install_path,
-                       const std::string &module_name,
-                       const std::string &lua_script) {
+namespace {
+
+// Size of element buffer reserved before extraction, enough for most modules without reallocating.
+constexpr size_t kReservedClickabledataElements = 2048;
+
+// Reads an attribute of an element table on top of the Lua stack as a string, or empty if not a string or number.
+std::string get_element_attribute(lua_State *lua_state, const char *key) {
+    lua_getfield(lua_state, 1, key);
+    size_t length = 0;
+    const char *value = lua_isstring(lua_state, -1) ? lua_tolstring(lua_state, -1, &length) : nullptr;
+    std::string attribute = (value != nullptr) ? std::string(value, length) : "";
+    lua_pop(lua_state, 1);
+    return attribute;
+}
+
+// Lua function emit_element{...} which appends an element to the extraction held as an upvalue.
+int emit_element(lua_State *lua_state) {
+    luaL_checktype(lua_state, 1, LUA_TTABLE);
+    auto *extraction = static_cast<ClickabledataExtraction *>(lua_touserdata(lua_state, lua_upvalueindex(1)));
+    extraction->elements.push_back({get_element_attribute(lua_state, "device"),
+                                    get_element_attribute(lua_state, "device_id"),
+                                    get_element_attribute(lua_state, "command"),
+                                    get_element_attribute(lua_state, "element"),
+                                    get_element_attribute(lua_state, "class"),
+                                    get_element_attribute(lua_state, "arg"),
+                                    get_element_attribute(lua_state, "arg_value"),
+                                    get_element_attribute(lua_state, "arg_lim_min"),
+                                    get_element_attribute(lua_state, "arg_lim_max"),
+                                    get_element_attribute(lua_state, "hint")});
+    return 0;
+}
+
+} // namespace
+
+ClickabledataExtraction extract_clickabledata(const std::string &dcs_install_path,
+                                              const std::string &module_name,
+                                              const std::string &lua_script,
+                                              LuaStatePool &lua_states) {
+    ClickabledataExtraction extraction;
+    extraction.elements.reserve(kReservedClickabledataElements);
+
+    extraction.result = lua_states.run(lua_script, [&](lua_State *lua_state) {
+        // Write variables to lua, the below sends to lua: [module_name = "A-10C"]
+        lua_pushstring(lua_state, dcs_install_path.c_str());
+        lua_setglobal(lua_state, "dcs_install_path");
+        lua_pushstring(lua_state, module_name.c_str());
+        lua_setglobal(lua_state, "module_name");
+
+        // Register emit_element so the script writes each element directly into the extraction.
+        lua_pushlightuserdata(lua_state, &extraction);
+        lua_pushcclosure(lua_state, emit_element, 1);
+        lua_setglobal(lua_state, "emit_element");
+    });
+    if (extraction.result != "success") {
+        extraction.elements.clear();
+        return extraction;
+    }
+
+    if (extraction.elements.empty()) {
+        extraction.result = "No clickabledata elements found";
+    }
+    return extraction;
+}
+
+ClickabledataExtraction extract_clickabledata(const std::string &dcs_install_path,
+                                              const std::string &module_name,
+                                              const std::string &lua_script) {
+    LuaStatePool lua_states(0, {kMaxLuaInstructions, kMaxLuaMemoryBytes});
+    return extract_clickabledata(dcs_install_path, module_name, lua_script, lua_states);
+}
+
+std::string format_clickabledata_element(const ClickabledataElement &element) {
+    std::string formatted;
+    formatted.reserve(element.device.size() + element.device_id.size() + element.command.size() +
+                      element.element.size() + element.class_name.size() + element.arg.size() +
+                      element.arg_value.size() + element.arg_lim_min.size() + element.arg_lim_max.size() +
+                      element.hint.size() + 10);
+    formatted.append(element.device).append("(").append(element.device_id).append("),");
+    formatted.append(element.command).append(",");
+    formatted.append(element.element).append(",");
+    formatted.append(element.class_name).append(",");
+    formatted.append(element.arg).append(",");
+    formatted.append(element.arg_value).append(",");
+    formatted.append(element.arg_lim_min).append(",");
+    formatted.append(element.arg_lim_max).append(",");
+    formatted.append(element.hint);
+    return formatted;
+}
+
+json clickabledata_to_json(const ClickabledataExtraction &extraction) {
     json clickabledata_and_result;
     clickabledata_and_result["clickabledata_items"] = json::array();
-    clickabledata_and_result["result"] = "";
-
-    // create new Lua state
-    lua_State *lua_state;
-    lua_state = luaL_newstate();
-
-    // load Lua libraries
-    luaL_openlibs(lua_state);
-
-    // Write variables to lua, the below sends to lua: [module_name = "A-10C"]
-    lua_pushstring(lua_state, dcs_install_path.c_str());
-    lua_setglobal(lua_state, "dcs_install_path");
-    lua_pushstring(lua_state, module_name.c_str());
-    lua_setglobal(lua_state, "module_name");
-
-    // Run the lua script file, expecting multiple return values.
-    const int lua_stack_size = lua_gettop(lua_state);
-    const int file_status = luaL_loadfile(lua_state, lua_script.c_str());
-    if (file_status != 0) {
-        lua_close(lua_state);
-        clickabledata_and_result["result"] = "Lua file load error: " + std::to_string(file_status);
-        return clickabledata_and_result;
+    for (const auto &element : extraction.elements) {
+        clickabledata_and_result["clickabledata_items"].push_back(format_clickabledata_element(element));
+    }
+    clickabledata_and_result["result"] = extraction.result;
+    return clickabledata_and_result;
+}
+
+bool clickabledata_element_less(const ClickabledataElement &lhs, const ClickabledataElement &rhs) {
+    for (const auto &column : kClickabledataColumns) {
+        const int comparison = (lhs.*column.value).compare(rhs.*column.value);
+        if (comparison != 0) {
+            return comparison < 0;
+        }
     }
-    const int script_status = lua_pcall(lua_state, 0, LUA_MULTRET, 0);
-    if (script_status != 0) {
-        lua_close(lua_state);
-        clickabledata_and_result["result"] = "Lua script runtime error: " + std::to_string(script_status);
-        return clickabledata_and_result;
+    return false;
+}
+
+json clickabledata_json_columns() {
+    json columns = json::array();
+    for (const auto &column : kClickabledataColumns) {
+        columns.push_back(column.name);
     }
+    return columns;
+}
 
-    // Handle each of the return values one at a time.
-    while ((lua_gettop(lua_state) - lua_stack_size) > 0) {
-        clickabledata_and_result["result"] = "success";
-        clickabledata_and_result["clickabledata_items"].push_back(lua_tostring(lua_state, lua_gettop(lua_state)));
-        lua_pop(lua_state, 1);
+json clickabledata_element_to_json_row(const ClickabledataElement &element) {
+    json row = json::array();
+    for (const auto &column : kClickabledataColumns) {
+        row.push_back(element.*column.value);
     }
+    return row;
+}
 
-    // close the Lua state
-    lua_close(lua_state);
+std::vector<json> clickabledata_to_json_chunks(const ClickabledataExtraction &extraction,
+                                              const size_t max_chunk_bytes) {
+    const json columns = clickabledata_json_columns();
 
-    return clickabledata_and_result;
+    std::vector<const ClickabledataElement *> sorted_elements;
+    sorted_elements.reserve(extraction.elements.size());
+    for (const auto &element : extraction.elements) {
+        sorted_elements.push_back(&element);
+    }
+    std::stable_sort(sorted_elements.begin(),
+                     sorted_elements.end(),
+                     [](const ClickabledataElement *lhs, const ClickabledataElement *rhs) {
+                         return clickabledata_element_less(*lhs, *rhs);
+                     });
+
+    std::vector<json> chunks;
+    json rows = json::array();
+    size_t chunk_bytes = kChunkHeaderBytes;
+    size_t first_row = 0;
+    const auto finish_chunk = [&](const size_t next_row) {
+        json chunk;
+        chunk["chunk_index"] = chunks.size();
+        chunk["first_row"] = first_row;
+        chunk["total_rows"] = sorted_elements.size();
+        chunk["result"] = extraction.result;
+        chunk["columns"] = columns;
+        chunk["rows"] = std::move(rows);
+        chunks.push_back(std::move(chunk));
+        rows = json::array();
+        chunk_bytes = kChunkHeaderBytes;
+        first_row = next_row;
+    };
+
+    for (size_t i = 0; i < sorted_elements.size(); ++i) {
+        json row = clickabledata_element_to_json_row(*sorted_elements[i]);
+        const size_t row_bytes = row.dump().size() + 1; // Includes separating comma.
+        if (!rows.empty() && chunk_bytes + row_bytes > max_chunk_bytes) {
+            finish_chunk(i);
+        }
+        rows.push_back(std::move(row));
+        chunk_bytes += row_bytes;
+    }
+    finish_chunk(sorted_elements.size());
+
+    for (auto &chunk : chunks) {
+        chunk["num_chunks"] = chunks.size();
+    }
+    return chunks;
+}
+
+json get_clickabledata(const std::string &dcs_install_path,
+                       const std::string &module_name,
+                       const std::string &lua_script) {
+    return clickabledata_to_json(extract_clickabledata(dcs_install_path, module_name, lua_script));
 }
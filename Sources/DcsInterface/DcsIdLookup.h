@@ -2,9 +2,32 @@
 
 #pragma once
 
+#include "LuaStatePool.h"
+
 #include "../Vendor/json/src/json.hpp"
 using json = nlohmann::json;
 
+#include <string>
+#include <vector>
+
+using ClickabledataElement = struct {
+    std::string device;      // Name of the device the element belongs to (e.g. "UFC").
+    std::string device_id;   // Device ID used to send commands.
+    std::string command;     // Button (command) ID used to send commands.
+    std::string element;     // Name of the clickable cockpit element.
+    std::string class_name;  // Element class ("BTN", "TUMB", "SNGBTN", "LEV" or "NULL").
+    std::string arg;         // DCS ID of the element's argument.
+    std::string arg_value;   // Value sent when the element is clicked.
+    std::string arg_lim_min; // Lower limit of the argument.
+    std::string arg_lim_max; // Upper limit of the argument.
+    std::string hint;        // Description of the element.
+};
+
+using ClickabledataExtraction = struct {
+    std::vector<ClickabledataElement> elements;
+    std::string result; // "success", or a description of the error.
+};
+
 /**
  * @brief Get the installed modules within provided DCS installation directory.
  *
@@ -17,11 +40,82 @@ json get_installed_modules(const std::string &dcs_install_path, const std::strin
 /**
  * @brief Extract clickabledata elements from a DCS World module.
  *
+ * The Lua script is run with a registered function "emit_element" which it calls once per element with a table of
+ * the element's attributes (keys matching ClickabledataElement, with "class" for class_name), e.g.:
+ *   emit_element{device = "UFC", device_id = 25, command = 3001, element = "pnt_1", class = "BTN", arg = 1, ...}
+ * Missing attributes are left empty.
+ *
+ * @param dcs_install_path Path to DCS World installation (e.g. "C:\Program Files\Eagle Dynamics\DCS World")
+ * @param module_name      Name of the module matching the folder naming convention (e.g. "A-10C")
+ * @param lua_script       Lua script to run which should call emit_element for each clickabledata element.
+ * @return ClickabledataExtraction Elements in the order emitted, and the result of the extraction (see
+ *         LuaStatePool::run for errors of the script, which is limited to kMaxLuaInstructions and kMaxLuaMemoryBytes).
+ */
+ClickabledataExtraction extract_clickabledata(const std::string &dcs_install_path,
+                                              const std::string &module_name,
+                                              const std::string &lua_script);
+
+/**
+ * @brief Extract clickabledata elements from a DCS World module on a pooled Lua state (see extract_clickabledata).
+ *
+ * @param lua_states Pool of Lua states which runs the script, and limits its instructions and memory.
+ */
+ClickabledataExtraction extract_clickabledata(const std::string &dcs_install_path,
+                                              const std::string &module_name,
+                                              const std::string &lua_script,
+                                              LuaStatePool &lua_states);
+
+/**
+ * @brief Formats a clickabledata element as comma-separated attributes, as shown in the ID Lookup window:
+ *        "device(device_id),command,element,class,arg,arg_value,arg_lim_min,arg_lim_max,hint"
+ */
+std::string format_clickabledata_element(const ClickabledataElement &element);
+
+/**
+ * @brief Converts extracted clickabledata to the json format sent to the Property Inspector.
+ *
+ * @return json Json with "clickabledata_items" array of comma-separated strings and "result" string.
+ */
+json clickabledata_to_json(const ClickabledataExtraction &extraction);
+
+/**
+ * @brief Orders clickabledata elements as listed in the ID Lookup window, by each attribute in turn.
+ */
+bool clickabledata_element_less(const ClickabledataElement &lhs, const ClickabledataElement &rhs);
+
+/**
+ * @brief Returns the json array of column names of typed clickabledata rows: ["device", "device_id", "command",
+ *        "element", "class", "arg", "arg_value", "arg_lim_min", "arg_lim_max", "hint"]
+ */
+json clickabledata_json_columns();
+
+/**
+ * @brief Converts a clickabledata element to a typed row, with values in the order of clickabledata_json_columns.
+ */
+json clickabledata_element_to_json_row(const ClickabledataElement &element);
+
+/**
+ * @brief Splits extracted clickabledata into json chunks of typed rows for delivery to the Property Inspector.
+ *
+ * Rows are sorted as listed in the ID Lookup window so each chunk can be shown as soon as it arrives. Each chunk is:
+ *   {"chunk_index": i, "num_chunks": n, "first_row": r, "total_rows": t, "result": "success",
+ *    "columns": ["device", "device_id", "command", "element", "class", ...], "rows": [["UFC", "25", ...], ...]}
+ * At least one chunk is returned, with no rows if the extraction failed.
+ *
+ * @param extraction      Extracted clickabledata.
+ * @param max_chunk_bytes Maximum serialized size of a chunk, exceeded only by a chunk with a single oversized row.
+ * @return std::vector<json> Chunks in order.
+ */
+std::vector<json> clickabledata_to_json_chunks(const ClickabledataExtraction &extraction, const size_t max_chunk_bytes);
+
+/**
+ * @brief Extract clickabledata elements from a DCS World module (see extract_clickabledata).
+ *
  * @param dcs_install_path Path to DCS World installation (e.g. "C:\Program Files\Eagle Dynamics\DCS World")
  * @param module_name      Name of the module matching the folder naming convention (e.g. "A-10C")
- * @param lua_script       Lua script to run which should return comma-separated strings of clickabledata attributes.
+ * @param lua_script       Lua script to run which should call emit_element for each clickabledata element.
  * @return json            Json array of comma-separated strings, each array element is one clickabledata element.
  */
 json get_clickabledata(const std::string &dcs_install_path,
                        const std::string &module_name,
-                       const std::string &lua_script);
\ No newline at end of file
+                       const std::string &lua_script);
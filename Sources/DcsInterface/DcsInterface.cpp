@@ -5,66 +5,553 @@
 #include "DcsInterface.h"
 #include "StringUtilities.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+
+namespace {
+// Maximum length of a subscription command, so each fits within a single UDP datagram.
+constexpr size_t kMaxSubscriptionCommandLength = 1000;
+// Number of sequence numbers before the latest packet within which late packets are recognized.
+constexpr int32_t kSequenceWindow = 64;
+// Maximum number of buckets of a digest command, so each fits within a single UDP datagram.
+constexpr size_t kMaxDigestBuckets = 64;
+// Stored DCS IDs per bucket of a digest command, trading the length of the command against the values resent.
+constexpr size_t kDcsIdsPerDigestBucket = 8;
+// Receive timeouts without a packet after which export scripts are considered disconnected, about 1 second.
+constexpr int kDisconnectedSilentReceives = 10;
+// Time to wait for a packet from a shared memory ring, matching the receive timeout of the UDP socket.
+constexpr DWORD kSharedMemoryReceiveTimeoutMs = 100;
+// Instance ID of the next DcsInterface constructed.
+std::atomic<unsigned> next_instance_id{0};
+
+// Returns the calling thread's cleared buffer for encoding outgoing commands, reused to send without allocating. Each
+// thread has its own as commands are sent from event threads concurrently.
+std::string &command_encoding_buffer() {
+    thread_local std::string buffer;
+    buffer.reserve(kMaxDcsCommandBatchLength);
+    buffer.clear();
+    return buffer;
+}
+} // namespace
+
 DcsInterface::DcsInterface(const DcsConnectionSettings &settings)
-    : dcs_socket_(settings.ip_address, settings.rx_port, settings.tx_port), connection_settings_(settings) {
+    : connection_settings_(settings), instance_id_(next_instance_id++) {
+    if (settings.shared_memory_name.empty()) {
+        dcs_socket_ = std::make_unique<DcsSocket>(
+            settings.ip_address, settings.rx_port, settings.tx_port, settings.multicast_group);
+    } else {
+        export_ring_ = std::make_unique<SharedMemoryRing>(settings.shared_memory_name + ".export");
+        command_ring_ = std::make_unique<SharedMemoryRing>(settings.shared_memory_name + ".commands");
+    }
+    if (!settings.forward_endpoints.empty()) {
+        forwarder_ = std::make_unique<UdpForwarder>(settings.forward_endpoints);
+    }
+    if (!settings.shared_state_name.empty()) {
+        shared_state_ = std::make_unique<SharedGameStateWriter>(settings.shared_state_name);
+    }
     // Send a reset to request a resend of data in case DCS mission is already running.
     send_dcs_reset_command();
 }
 
 bool DcsInterface::connection_settings_match(const DcsConnectionSettings &settings) {
     return ((settings.rx_port == connection_settings_.rx_port) && (settings.tx_port == connection_settings_.tx_port) &&
-            (settings.ip_address == connection_settings_.ip_address));
+            (settings.ip_address == connection_settings_.ip_address) &&
+            (settings.forward_endpoints == connection_settings_.forward_endpoints) &&
+            (settings.multicast_group == connection_settings_.multicast_group) &&
+            (settings.shared_memory_name == connection_settings_.shared_memory_name) &&
+            (settings.shared_state_name == connection_settings_.shared_state_name));
 }
 
 void DcsInterface::update_dcs_state() {
-    // Receive next UDP message from DCS and strip header.
+    // Receive next message from DCS.
+    const std::string packet = receive_from_dcs();
+    // Each receive marks a frame of DCS, by its exported packet or the receive timeout, so queued commands are paced.
+    send_queued_commands();
+    if (packet.empty()) {
+        ++silent_receives_;
+        return;
+    }
+    // Forward the packet before parsing so downstream consumers are not delayed by it.
+    if (forwarder_) {
+        forwarder_->forward(packet);
+    }
+    handle_received_packet(packet);
+    publish_game_state();
+
+    // Values changed while disconnected are recovered with a digest rather than a resend of all data.
+    if (silent_receives_ >= kDisconnectedSilentReceives && exporter_supports_digest_) {
+        send_dcs_resync_command();
+    }
+    silent_receives_ = 0;
+}
+
+void DcsInterface::handle_received_packet(const std::string &recv_msg) {
+    if (is_dcs_bios_packet(recv_msg)) {
+        handle_received_dcs_bios_packet(recv_msg);
+        return;
+    }
+    if (is_binary_export_packet(recv_msg)) {
+        // Malformed packets are ignored after the values decoded before the malformed part.
+        BinaryExportFrame frame;
+        const bool is_valid = decode_binary_export_packet(recv_msg, frame, binary_values_);
+        if (frame.is_sequenced && !track_sequence(frame)) {
+            return;
+        }
+        for (const BinaryExportValue &value : binary_values_) {
+            if (value.type == BINARY_NAMED_STRING) {
+                handle_received_token(std::string(value.key), std::string(value.str));
+                continue;
+            }
+            if (frame.is_sequenced) {
+                const auto [it, inserted] = stream_values_.try_emplace(value.dcs_id);
+                // Values of late packets are not applied over values received in later packets.
+                if (!inserted && static_cast<int32_t>(frame.sequence - it->second.sequence) < 0) {
+                    continue;
+                }
+                it->second = {hash_binary_export_value(value.encoded), frame.sequence};
+            }
+            if (is_dcs_id_stored(value.dcs_id)) {
+                handle_received_dcs_id_value(value);
+            }
+        }
+        if (is_valid && frame.is_keyframe) {
+            verify_keyframe(frame.checksum);
+        }
+        return;
+    }
+
+    // Strip header of text message.
     const char header_delimiter = '*'; // Header content ends in an '*'.
-    std::stringstream recv_msg = dcs_socket_.DcsReceive();
+    size_t token_start = recv_msg.find(header_delimiter);
+    if (token_start == std::string::npos) {
+        return;
+    }
+
+    // Iterate through tokens of the form "key=value" received from single message, separated by ':'.
+    for (++token_start; token_start < recv_msg.size();) {
+        size_t token_end = recv_msg.find(':', token_start);
+        if (token_end == std::string::npos) {
+            token_end = recv_msg.size();
+        }
+        const size_t key_end = recv_msg.find('=', token_start);
+        if (key_end >= token_end || key_end == token_start) {
+            break;
+        }
+        const std::string key = recv_msg.substr(token_start, key_end - token_start);
+        const bool key_is_dcs_id = is_integer(key);
+        const int dcs_id = key_is_dcs_id ? std::stoi(key) : 0;
 
-    std::string token;
-    if (std::getline(recv_msg, token, header_delimiter)) {
-        // Iterate through tokens received from single message.
-        std::pair<std::string, std::string> key_and_value;
-        while (pop_key_and_value(recv_msg, ':', '=', key_and_value)) {
+        // Values of filtered DCS IDs are skipped without being read.
+        if (!key_is_dcs_id || is_dcs_id_stored(dcs_id)) {
             // Strip any trailing newline chars from value.
-            auto value_end_loc = key_and_value.second.find_last_not_of('\n');
-            std::string value = key_and_value.second.substr(0, value_end_loc + 1);
-            handle_received_token(key_and_value.first, value);
+            size_t value_end = token_end;
+            while (value_end > key_end + 1 && recv_msg[value_end - 1] == '\n') {
+                --value_end;
+            }
+            const std::string_view value(recv_msg.data() + key_end + 1, value_end - key_end - 1);
+            if (key_is_dcs_id) {
+                handle_received_dcs_id_value(dcs_id, value);
+            } else {
+                handle_received_token(key, std::string(value));
+            }
         }
+        token_start = token_end + 1;
     }
 }
 
+void DcsInterface::handle_received_dcs_bios_packet(const std::string_view packet) {
+    dcs_bios_state_.parse(packet);
+    if (!dcs_bios_monitors_.empty()) {
+        for (const uint16_t address : dcs_bios_state_.dirty_words()) {
+            const auto it = dcs_bios_monitors_.find(address);
+            if (it != dcs_bios_monitors_.end()) {
+                for (const int dcs_id : it->second) {
+                    store_dcs_bios_output(dcs_id);
+                }
+            }
+        }
+    }
+    dcs_bios_state_.clear_dirty_words();
+}
+
+std::vector<UdpForwardStats> DcsInterface::get_forward_stats() const {
+    return forwarder_ ? forwarder_->get_stats() : std::vector<UdpForwardStats>();
+}
+
 std::string DcsInterface::get_current_dcs_module() { return current_game_module_; }
 
 std::string DcsInterface::get_value_of_dcs_id(const int dcs_id) {
-    if (current_game_state_.count(dcs_id) > 0) {
-        return current_game_state_[dcs_id];
+    const auto it = current_game_state_.find(dcs_id);
+    if (it != current_game_state_.end()) {
+        return it->second.str;
     } else {
         return "";
     }
 }
 
-void DcsInterface::send_dcs_command(const int button_id, const std::string &device_id, const std::string &value) {
-    const std::string message_assembly = "C" + device_id + "," + std::to_string(button_id) + "," + value;
-    dcs_socket_.DcsSend(message_assembly);
+const DcsIdValue *DcsInterface::get_typed_value_of_dcs_id(const int dcs_id) const {
+    const auto it = current_game_state_.find(dcs_id);
+    return (it != current_game_state_.end()) ? &it->second : nullptr;
+}
+
+unsigned DcsInterface::get_update_count_of_dcs_id(const int dcs_id) const {
+    const auto it = current_game_state_.find(dcs_id);
+    return (it != current_game_state_.end()) ? it->second.update_count : clear_update_count_;
+}
+
+void DcsInterface::send_dcs_command(const int button_id,
+                                    const std::string &device_id,
+                                    const std::string &value,
+                                    const DcsCommandLane lane,
+                                    const bool is_absolute_value) {
+    std::string &command_buffer = command_encoding_buffer();
+    append_dcs_command(command_buffer, {button_id, device_id, value});
+    // Commands to the same device and button share the encoding before the value.
+    const std::string_view button_key(command_buffer.data(), command_buffer.size() - value.size());
+    schedule_to_dcs(lane, command_buffer, is_absolute_value ? button_key : std::string_view());
+}
+
+void DcsInterface::send_dcs_commands(const std::vector<DcsCommand> &commands, const DcsCommandLane lane) {
+    std::string &command_buffer = command_encoding_buffer();
+    for (const DcsCommand &command : commands) {
+        if (!exporter_supports_command_batch_ || !append_batched_dcs_command(command_buffer, command)) {
+            if (!command_buffer.empty()) {
+                schedule_to_dcs(lane, command_buffer);
+                command_buffer.clear();
+            }
+            append_dcs_command(command_buffer, command);
+        }
+    }
+    if (!command_buffer.empty()) {
+        schedule_to_dcs(lane, command_buffer);
+    }
+}
+
+void DcsInterface::set_commands_per_frame(const size_t messages_per_frame) {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    command_scheduler_.set_messages_per_frame(messages_per_frame);
+}
+
+DcsCommandQueueStats DcsInterface::get_command_queue_stats() {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    return command_scheduler_.get_stats();
+}
+
+void DcsInterface::send_dcs_reset_command() {
+    schedule_to_dcs(COMMAND_LANE_CONTROL, "R");
+    // Export scripts may have restarted without the subscription, so send it again unless subscribed to all IDs.
+    if (!subscribed_dcs_ids_.empty()) {
+        send_subscription();
+    }
+}
+
+void DcsInterface::send_dcs_resync_command() {
+    if (exporter_supports_digest_ && !current_game_state_.empty()) {
+        send_dcs_digest_command();
+    } else {
+        send_dcs_reset_command();
+    }
+}
+
+void DcsInterface::send_dcs_subscription_command(const std::vector<int> &dcs_ids) {
+    if (dcs_ids == subscribed_dcs_ids_) {
+        return;
+    }
+    subscribed_dcs_ids_ = dcs_ids;
+    send_subscription();
 }
 
-void DcsInterface::send_dcs_reset_command() { dcs_socket_.DcsSend("R"); }
+void DcsInterface::set_dcs_id_filter(const std::vector<int> &dcs_ids) {
+    // DCS IDs are added if their values were not stored before, which excludes all DCS IDs until a filter is set.
+    std::vector<bool> referenced_dcs_ids;
+    bool dcs_ids_added = false;
+    std::vector<int> added_dcs_bios_outputs;
+    std::unordered_map<uint16_t, std::vector<int>> dcs_bios_monitors;
+    for (const int dcs_id : dcs_ids) {
+        DcsBiosOutput output;
+        if (dcs_id_to_dcs_bios_output(dcs_id, output)) {
+            std::vector<int> &monitors = dcs_bios_monitors[output.address];
+            if (std::find(monitors.begin(), monitors.end(), dcs_id) == monitors.end()) {
+                monitors.push_back(dcs_id);
+                added_dcs_bios_outputs.push_back(dcs_id);
+            }
+            continue;
+        }
+        if (dcs_id < 0) {
+            continue;
+        }
+        if (static_cast<size_t>(dcs_id) >= referenced_dcs_ids.size()) {
+            referenced_dcs_ids.resize(dcs_id + 1);
+        }
+        referenced_dcs_ids[dcs_id] = true;
+        dcs_ids_added = dcs_ids_added || !is_dcs_id_stored(dcs_id);
+    }
+    referenced_dcs_ids_ = std::move(referenced_dcs_ids);
+    filter_dcs_ids_ = true;
+    dcs_bios_monitors_ = std::move(dcs_bios_monitors);
+    // The values of DCS-BIOS outputs are already in the shadow state, so newly monitored outputs are stored from it.
+    for (const int dcs_id : added_dcs_bios_outputs) {
+        if (current_game_state_.count(dcs_id) == 0) {
+            store_dcs_bios_output(dcs_id);
+        }
+    }
+
+    // While the filter is not applied, values of all DCS IDs remain stored, so no DCS IDs are added or need a resync.
+    drop_filtered_dcs_ids();
+    if (dcs_ids_added) {
+        send_dcs_resync_command();
+    }
+}
 
-void DcsInterface::clear_game_state() { current_game_state_.clear(); }
+void DcsInterface::set_dcs_id_filter_enabled(const bool enabled) {
+    const bool was_applied = is_dcs_id_filter_applied();
+    dcs_id_filter_enabled_ = enabled;
+    handle_dcs_id_filter_change(was_applied);
+}
 
-std::map<int, std::string> DcsInterface::debug_get_current_game_state() { return current_game_state_; }
+void DcsInterface::set_capture_all_dcs_ids(const bool capture_all) {
+    const bool was_applied = is_dcs_id_filter_applied();
+    capture_all_dcs_ids_ = capture_all;
+    handle_dcs_id_filter_change(was_applied);
+}
+
+void DcsInterface::clear_game_state() {
+    current_game_state_.clear();
+    clear_update_count_ = ++update_count_;
+    publish_game_state();
+}
+
+std::map<int, std::string> DcsInterface::debug_get_current_game_state() {
+    std::map<int, std::string> current_game_state;
+    for (const auto &[dcs_id, dcs_id_value] : current_game_state_) {
+        current_game_state[dcs_id] = dcs_id_value.str;
+    }
+    return current_game_state;
+}
 
 void DcsInterface::handle_received_token(const std::string &key, const std::string &value) {
-    if (is_integer(key)) {
-        current_game_state_[std::stoi(key)] = value;
-    } else if (key == "File") {
+    if (key == "File") {
         current_game_module_ = value;
+    } else if (key == "Digest") {
+        const bool was_applied = is_dcs_id_filter_applied();
+        exporter_supports_digest_ = (value == "1");
+        handle_dcs_id_filter_change(was_applied);
+    } else if (key == "Batch") {
+        exporter_supports_command_batch_ = (value == "1");
     } else if (key == "Ikarus" || key == "DAC" || key == "DCS") {
         // Stop is received when user has quit mission -- game state should be cleared.
         if (value == "stop") {
             clear_game_state();
             current_game_module_ = "";
+            stream_started_ = false;
+            stream_values_.clear();
+            exporter_supports_digest_ = false;
+            exporter_supports_command_batch_ = false;
+        } else if (value == "start" && !subscribed_dcs_ids_.empty()) {
+            // Export scripts restart with each mission, without the subscription.
+            send_subscription();
+        }
+    }
+}
+
+void DcsInterface::handle_received_dcs_id_value(const int dcs_id, const std::string_view value) {
+    const auto [it, inserted] = current_game_state_.try_emplace(dcs_id);
+    DcsIdValue &stored_value = it->second;
+    if (inserted || stored_value.str != value) {
+        stored_value.str = value;
+        stored_value.is_number = is_number(stored_value.str);
+        stored_value.number = stored_value.is_number ? std::strtod(stored_value.str.c_str(), nullptr) : 0.0;
+        stored_value.update_count = ++update_count_;
+    }
+}
+
+void DcsInterface::handle_received_dcs_id_value(const BinaryExportValue &value) {
+    if (value.type == BINARY_STRING) {
+        handle_received_dcs_id_value(value.dcs_id, value.str);
+        return;
+    }
+    const auto [it, inserted] = current_game_state_.try_emplace(value.dcs_id);
+    DcsIdValue &stored_value = it->second;
+    if (inserted || !stored_value.is_number || stored_value.number != value.number) {
+        stored_value.str = format_binary_export_number(value);
+        stored_value.is_number = true;
+        stored_value.number = value.number;
+        stored_value.update_count = ++update_count_;
+    }
+}
+
+bool DcsInterface::track_sequence(const BinaryExportFrame &frame) {
+    ++stream_stats_.sequenced_packets;
+    const int32_t ahead = static_cast<int32_t>(frame.sequence - next_sequence_);
+    if (!stream_started_ || frame.is_stream_start || ahead < -kSequenceWindow) {
+        // Values of a previous stream are not included in the state checksums of a new stream.
+        if (stream_started_) {
+            ++stream_stats_.stream_restarts;
         }
+        stream_started_ = true;
+        stream_values_.clear();
+        missing_sequences_ = 0;
+        next_sequence_ = frame.sequence + 1;
+        return true;
+    }
+
+    if (ahead >= 0) {
+        // Sequence numbers skipped over are missing until received late.
+        stream_stats_.lost_packets += ahead;
+        const uint64_t skipped = (ahead >= kSequenceWindow - 1) ? ~uint64_t{1} : ((uint64_t{1} << ahead) - 1) << 1;
+        missing_sequences_ = (ahead >= kSequenceWindow - 1 ? 0 : missing_sequences_ << (ahead + 1)) | skipped;
+        next_sequence_ = frame.sequence + 1;
+        return true;
+    }
+
+    const uint64_t sequence_bit = uint64_t{1} << (-ahead - 1);
+    if ((missing_sequences_ & sequence_bit) == 0) {
+        ++stream_stats_.duplicate_packets;
+        return false;
+    }
+    missing_sequences_ &= ~sequence_bit;
+    --stream_stats_.lost_packets;
+    ++stream_stats_.reordered_packets;
+    return true;
+}
+
+void DcsInterface::verify_keyframe(const uint32_t checksum) {
+    ++stream_stats_.keyframes;
+    uint32_t state_checksum = 0;
+    for (const auto &[dcs_id, stream_value] : stream_values_) {
+        state_checksum += stream_value.hash;
+    }
+    if (state_checksum != checksum) {
+        ++stream_stats_.checksum_mismatches;
+        ++stream_stats_.resync_requests;
+        send_dcs_reset_command();
+    }
+}
+
+void DcsInterface::send_dcs_digest_command() {
+    // Negative DCS IDs of DCS-BIOS outputs are not exported by the export scripts, so are excluded from the digest.
+    const size_t exported_count = std::count_if(current_game_state_.begin(),
+                                                current_game_state_.end(),
+                                                [](const auto &dcs_id_value) { return dcs_id_value.first >= 0; });
+    size_t bucket_count = 1;
+    while (bucket_count < kMaxDigestBuckets && bucket_count * kDcsIdsPerDigestBucket < exported_count) {
+        bucket_count *= 2;
+    }
+    std::vector<uint32_t> bucket_hashes(bucket_count, 0);
+    for (const auto &[dcs_id, dcs_id_value] : current_game_state_) {
+        if (dcs_id < 0) {
+            continue;
+        }
+        bucket_hashes[static_cast<unsigned>(dcs_id) % bucket_count] +=
+            hash_binary_export_value(std::to_string(dcs_id) + "=" + dcs_id_value.str);
+    }
+
+    std::string command = "D" + std::to_string(bucket_count) + ":";
+    for (size_t bucket = 0; bucket < bucket_count; ++bucket) {
+        char hash[16];
+        std::snprintf(hash, sizeof(hash), (bucket == 0) ? "%x" : ",%x", bucket_hashes[bucket]);
+        command += hash;
+    }
+    schedule_to_dcs(COMMAND_LANE_CONTROL, command);
+}
+
+void DcsInterface::store_dcs_bios_output(const int dcs_id) {
+    DcsBiosOutput output;
+    if (dcs_id_to_dcs_bios_output(dcs_id, output) && dcs_bios_state_.is_written(output.address)) {
+        handle_received_dcs_id_value(dcs_id, std::to_string(dcs_bios_state_.read(output)));
+    }
+}
+
+void DcsInterface::drop_filtered_dcs_ids() {
+    for (auto it = current_game_state_.begin(); it != current_game_state_.end();) {
+        bool is_stored = is_dcs_id_stored(it->first);
+        DcsBiosOutput output;
+        if (dcs_id_to_dcs_bios_output(it->first, output)) {
+            const auto monitors = dcs_bios_monitors_.find(output.address);
+            is_stored = (monitors != dcs_bios_monitors_.end()) &&
+                        std::count(monitors->second.begin(), monitors->second.end(), it->first) != 0;
+        }
+        it = is_stored ? std::next(it) : current_game_state_.erase(it);
+    }
+    publish_game_state();
+}
+
+void DcsInterface::handle_dcs_id_filter_change(const bool was_applied) {
+    if (is_dcs_id_filter_applied() && !was_applied) {
+        drop_filtered_dcs_ids();
+    } else if (!is_dcs_id_filter_applied() && was_applied) {
+        // Values of unreferenced DCS IDs were dropped, so they are resent to be stored again.
+        send_dcs_resync_command();
+    }
+}
+
+void DcsInterface::send_subscription() {
+    std::string command = "S";
+    bool command_has_ids = false;
+    for (const int dcs_id : subscribed_dcs_ids_) {
+        const std::string id = std::to_string(dcs_id);
+        if (command_has_ids && command.size() + 1 + id.size() > kMaxSubscriptionCommandLength) {
+            schedule_to_dcs(COMMAND_LANE_CONTROL, command);
+            command = "S+";
+            command_has_ids = false;
+        }
+        if (command_has_ids) {
+            command += ",";
+        }
+        command += id;
+        command_has_ids = true;
+    }
+    schedule_to_dcs(COMMAND_LANE_CONTROL, command);
+}
+
+std::string DcsInterface::receive_from_dcs() {
+    if (export_ring_) {
+        std::string packet;
+        export_ring_->pop(packet, kSharedMemoryReceiveTimeoutMs);
+        return packet;
+    }
+    return dcs_socket_->DcsReceive().str();
+}
+
+void DcsInterface::schedule_to_dcs(const DcsCommandLane lane,
+                                   const std::string &message,
+                                   const std::string_view coalesce_key) {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    if (command_scheduler_.schedule(lane, message, coalesce_key)) {
+        send_to_dcs(message);
+    }
+}
+
+void DcsInterface::send_queued_commands() {
+    std::lock_guard<std::mutex> lock(command_mutex_);
+    command_scheduler_.start_frame();
+    std::string message;
+    while (command_scheduler_.next_message(message)) {
+        send_to_dcs(message);
+    }
+}
+
+void DcsInterface::send_to_dcs(const std::string &message) {
+    if (command_ring_) {
+        // Commands are dropped while the exporter is not draining the ring, as they are while it is not reading UDP.
+        command_ring_->push(message);
+    } else {
+        dcs_socket_->DcsSend(message);
+    }
+}
+
+void DcsInterface::publish_game_state() {
+    if (!shared_state_ ||
+        (update_count_ == published_update_count_ && current_game_state_.size() == published_entries_)) {
+        return;
+    }
+    std::vector<std::pair<int, std::string_view>> values;
+    values.reserve(current_game_state_.size());
+    for (const auto &[dcs_id, dcs_id_value] : current_game_state_) {
+        values.emplace_back(dcs_id, dcs_id_value.str);
     }
+    shared_state_->publish(std::move(values), update_count_);
+    published_update_count_ = update_count_;
+    published_entries_ = current_game_state_.size();
 }
@@ -2,16 +2,50 @@
 
 #pragma once
 
+#include "DcsBinaryProtocol.h"
+#include "DcsBiosProtocol.h"
+#include "DcsCommandBatch.h"
+#include "DcsCommandScheduler.h"
 #include "DcsSocket.h"
+#include "SharedGameState.h"
+#include "SharedMemoryRing.h"
+#include "UdpForwarder.h"
 
+#include <atomic>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <vector>
 
 using DcsConnectionSettings = struct {
-    std::string rx_port;    // UDP port to receive updates from DCS.
-    std::string tx_port;    // UDP port to send commands to DCS.
-    std::string ip_address; //  UDP IP address to send commands to DCS (Default is LocalHost).
+    std::string rx_port;                        // UDP port to receive updates from DCS.
+    std::string tx_port;                        // UDP port to send commands to DCS.
+    std::string ip_address;                     //  UDP IP address to send commands to DCS (Default is LocalHost).
+    std::vector<std::string> forward_endpoints; // Endpoints ("ip:port") to forward each received packet to unchanged.
+    std::string multicast_group;                // Multicast group IP address to receive updates from, or "" for none.
+    std::string shared_memory_name;             // Shared memory ring name of a same-host exporter, or "" for UDP.
+    std::string shared_state_name;              // Shared memory name to publish the game state to, or "" for none.
+};
+
+using DcsIdValue = struct {
+    std::string str;       // Value as most recently received from DCS.
+    bool is_number;        // True if the received value represents a number.
+    double number;         // Numeric representation of value, only valid if is_number is true.
+    unsigned update_count; // Game state update count at which the value last changed.
+};
+
+using DcsStreamStats = struct {
+    unsigned sequenced_packets;   // Sequenced binary packets received.
+    unsigned lost_packets;        // Packets skipped in the sequence which have not been received late.
+    unsigned reordered_packets;   // Packets received late, after a later packet.
+    unsigned duplicate_packets;   // Packets received again, which are ignored.
+    unsigned stream_restarts;     // Streams started after the first, such as by export scripts restarting.
+    unsigned keyframes;           // Keyframes received.
+    unsigned checksum_mismatches; // Keyframes whose state checksum did not match the received state.
+    unsigned resync_requests;     // Reset commands sent to resync the received state.
 };
 
 class DcsInterface {
@@ -38,6 +72,37 @@ class DcsInterface {
      */
     void update_dcs_state();
 
+    /**
+     * @brief Updates the current game state from a packet received from DCS, in either the text format
+     *        ("header*key=value:key=value") or the binary format detected by its header (see DcsBinaryProtocol.h).
+     *
+     * @param packet Received packet.
+     */
+    void handle_received_packet(const std::string &packet);
+
+    /**
+     * @brief Updates the DCS-BIOS shadow state from a packet of the DCS-BIOS export stream, which is also detected by
+     *        handle_received_packet (see DcsBiosProtocol.h). Values of the DCS-BIOS outputs monitored through the DCS
+     *        ID filter (as negative DCS IDs, see dcs_bios_output_to_dcs_id) are stored in the current game state when
+     *        their word changes, so they are read like any other DCS ID. Packets can be replayed from a capture.
+     *
+     * @param packet Received packet.
+     */
+    void handle_received_dcs_bios_packet(const std::string_view packet);
+
+    /**
+     * @brief Get the shadow state of the DCS-BIOS address space received so far.
+     */
+    const DcsBiosStateBuffer &get_dcs_bios_state() const { return dcs_bios_state_; }
+
+    /**
+     * @brief Get the counters of forwarding received packets to each of the forward endpoints of the connection
+     *        settings, so export scripts only need to send to the plugin rather than also to consumers such as Ikarus.
+     *
+     * @return Counters of each forward endpoint, empty if there are none.
+     */
+    std::vector<UdpForwardStats> get_forward_stats() const;
+
     /**
      * @brief Get the name of the current DCS aircraft module.
      *
@@ -53,13 +118,71 @@ class DcsInterface {
     std::string get_value_of_dcs_id(const int dcs_id);
 
     /**
-     * @brief Sends a message to DCS to command a change in a clickable data item.
+     * @brief Get the typed value of a DCS ID from current game state.
+     *
+     * @return Pointer to stored value, or nullptr if DCS ID has not been logged.
+     */
+    const DcsIdValue *get_typed_value_of_dcs_id(const int dcs_id) const;
+
+    /**
+     * @brief Get the game state update count at which the value of a DCS ID last changed.
+     *        Can be compared against a previously returned count to detect changes in value.
+     *
+     * @return Update count of DCS ID, or update count of the last game state clear if DCS ID has not been logged.
+     */
+    unsigned get_update_count_of_dcs_id(const int dcs_id) const;
+
+    /**
+     * @brief Gets an ID unique to this DcsInterface within the process. Update counts restart with each DcsInterface,
+     *        so they are only comparable between calls to the same instance.
+     *
+     * @return Instance ID.
+     */
+    unsigned get_instance_id() const { return instance_id_; }
+
+    /**
+     * @brief Sends a message to DCS to command a change in a clickable data item, or queues it to a later frame if the
+     *        budget of commands per frame is spent.
      *
      * @param button_id ID number of the button.
      * @param device_id ID number of the device.
      * @param value     Value to set the button to.
+     * @param lane      Priority lane of the command.
+     * @param is_absolute_value True if the value is an absolute position which supersedes a queued command to the same
+     *                          button (such as a switch position), false if every value must be sent (such as the
+     *                          press and release of a momentary button).
      */
-    void send_dcs_command(const int button_id, const std::string &device_id, const std::string &value);
+    void send_dcs_command(const int button_id,
+                          const std::string &device_id,
+                          const std::string &value,
+                          const DcsCommandLane lane = COMMAND_LANE_USER_INPUT,
+                          const bool is_absolute_value = false);
+
+    /**
+     * @brief Sends messages to DCS to command changes in several clickable data items together.
+     *
+     * Commands are batched into as few messages as possible if export scripts support batches, so DCS applies them
+     * in the same frame, otherwise each command is sent on its own.
+     *
+     * @param commands Commands to send, in order.
+     * @param lane     Priority lane of the commands.
+     */
+    void send_dcs_commands(const std::vector<DcsCommand> &commands, const DcsCommandLane lane = COMMAND_LANE_AUTOMATED);
+
+    /**
+     * @brief Sets the budget of messages sent to DCS per frame, with further messages queued to later frames. A frame
+     *        starts with each call of update_dcs_state.
+     *
+     * @param messages_per_frame Budget of messages sent per frame, at least 1.
+     */
+    void set_commands_per_frame(const size_t messages_per_frame);
+
+    /**
+     * @brief Gets statistics of the queues of messages to DCS.
+     *
+     * @return Current and maximum queue depths of each lane, and counts of sent and coalesced messages.
+     */
+    DcsCommandQueueStats get_command_queue_stats();
 
     /**
      * @brief Sends a reset command ("R" char) to DCS to signify a request for a resend of data.
@@ -67,6 +190,66 @@ class DcsInterface {
      */
     void send_dcs_reset_command();
 
+    /**
+     * @brief Requests a resend of the values which differ from the current game state. If export scripts advertise
+     *        support with a "Digest" token (see DcsExportScripts/StreamdeckDigest.lua), a digest command is sent which
+     *        costs a few hundred bytes at most, and export scripts resend only the values of buckets of DCS IDs whose
+     *        hashes differ. Otherwise, or if the game state is empty, a reset command is sent for a resend of all data.
+     *
+     * The digest command is "D<bucket count>:<hash>,<hash>,..." with a hexadecimal hash for each bucket, which is the
+     * sum (modulo 2^32) of hash_binary_export_value of "<DCS ID>=<value>" of each stored DCS ID in the bucket, where
+     * the bucket of a DCS ID is the DCS ID modulo the bucket count.
+     */
+    void send_dcs_resync_command();
+
+    /**
+     * @brief Subscribes to updates of only the given DCS IDs, sending a subscription command to DCS so export scripts
+     *        which support it (see DcsExportScripts/StreamdeckSubscription.lua) stop sending other IDs. The command is
+     *        "S" followed by comma-separated DCS IDs, split into further "S+" commands that add IDs if too long for a
+     *        single message. It is only sent if the subscription has changed, and is sent again after each reset
+     *        command. Export scripts without support ignore the command and continue to send all IDs.
+     *
+     * @param dcs_ids Sorted DCS IDs to subscribe to, an empty vector subscribes to all DCS IDs.
+     */
+    void send_dcs_subscription_command(const std::vector<int> &dcs_ids);
+
+    /**
+     * @brief Stores received values of only the given DCS IDs, so memory and per-packet cost scale with the DCS IDs
+     *        referenced by contexts rather than with all DCS IDs exported for the aircraft. Values of other DCS IDs are
+     *        skipped after reading only their key, and those already stored are dropped. If DCS IDs are added, a resync
+     *        is requested (see send_dcs_resync_command) so their current values are resent. Until set, values of all
+     *        DCS IDs are stored. Negative DCS IDs representing DCS-BIOS outputs are monitored in the DCS-BIOS state.
+     *        The filter is only applied while enabled (see set_dcs_id_filter_enabled) or while export scripts support
+     *        digest commands, as a resync with other export scripts resends the values of all DCS IDs.
+     *
+     * @param dcs_ids DCS IDs to store values of.
+     */
+    void set_dcs_id_filter(const std::vector<int> &dcs_ids);
+
+    /**
+     * @brief Sets whether the DCS ID filter is applied even if export scripts do not support digest commands, trading a
+     *        resend of all values whenever DCS IDs are added to the filter for the memory of unreferenced DCS IDs.
+     *
+     * @param enabled True to apply the DCS ID filter regardless of export script support.
+     */
+    void set_dcs_id_filter_enabled(const bool enabled);
+
+    /**
+     * @brief Sets whether values of all DCS IDs are stored regardless of the DCS ID filter, such as for debugging the
+     *        received game state. A resync is requested on enabling so values of all DCS IDs are resent.
+     *
+     * @param capture_all True to store values of all DCS IDs.
+     */
+    void set_capture_all_dcs_ids(const bool capture_all);
+
+    /**
+     * @brief Get statistics of sequenced packets received (see DcsBinaryProtocol.h), which are tracked so lost packets
+     *        are only recovered, by a reset command, if the state checksum of a later keyframe does not match.
+     *
+     * @return Counts of received, lost, reordered and duplicate packets, keyframes and resyncs.
+     */
+    DcsStreamStats get_stream_stats() const { return stream_stats_; }
+
     /**
      * @brief Clears history of logged DCS current game state values.
      *
@@ -89,9 +272,159 @@ class DcsInterface {
      */
     void handle_received_token(const std::string &key, const std::string &value);
 
+    /**
+     * @brief Stores a received DCS ID value in the current game state.
+     *
+     * @param dcs_id DCS ID of updated value.
+     * @param value Updated value.
+     */
+    void handle_received_dcs_id_value(const int dcs_id, const std::string_view value);
+
+    /**
+     * @brief Stores a DCS ID value decoded from a binary packet in the current game state, formatting numbers as text
+     *        only if their value has changed.
+     *
+     * @param value Decoded value.
+     */
+    void handle_received_dcs_id_value(const BinaryExportValue &value);
+
+    /**
+     * @brief Tracks the sequence number of a sequenced packet, counting lost, reordered and duplicate packets.
+     *
+     * @param frame Sequence information of the packet.
+     * @return False if the packet is a duplicate to ignore.
+     */
+    bool track_sequence(const BinaryExportFrame &frame);
+
+    /**
+     * @brief Compares the state checksum of a keyframe to the received state, sending a reset command to resync the
+     *        state if they do not match.
+     *
+     * @param checksum State checksum of the keyframe.
+     */
+    void verify_keyframe(const uint32_t checksum);
+
+    /**
+     * @brief Sends a digest command of the current game state (see send_dcs_resync_command).
+     */
+    void send_dcs_digest_command();
+
+    /**
+     * @brief Returns true if received values of the DCS ID are stored according to the DCS ID filter.
+     */
+    bool is_dcs_id_stored(const int dcs_id) const {
+        return !is_dcs_id_filter_applied() ||
+               (dcs_id >= 0 && static_cast<size_t>(dcs_id) < referenced_dcs_ids_.size() && referenced_dcs_ids_[dcs_id]);
+    }
+
+    /**
+     * @brief Stores the value of a monitored DCS-BIOS output in the current game state.
+     *
+     * @param dcs_id Negative DCS ID representing the DCS-BIOS output.
+     */
+    void store_dcs_bios_output(const int dcs_id);
+
+    /**
+     * @brief Drops stored values of DCS IDs which are no longer stored according to the DCS ID filter, or DCS-BIOS
+     *        outputs which are no longer monitored.
+     */
+    void drop_filtered_dcs_ids();
+
+    /**
+     * @brief Determines whether the DCS ID filter is applied to received values (see set_dcs_id_filter).
+     */
+    bool is_dcs_id_filter_applied() const {
+        return filter_dcs_ids_ && !capture_all_dcs_ids_ && (dcs_id_filter_enabled_ || exporter_supports_digest_);
+    }
+
+    /**
+     * @brief Drops filtered values or requests a resync after the DCS ID filter started or stopped being applied.
+     *
+     * @param was_applied Whether the DCS ID filter was applied before the change of settings.
+     */
+    void handle_dcs_id_filter_change(const bool was_applied);
+
+    /**
+     * @brief Sends the subscription command(s) of subscribed_dcs_ids_.
+     */
+    void send_subscription();
+
+    /**
+     * @brief Receives the next packet from DCS through the selected transport.
+     *
+     * @return Received packet, or empty if none was received before the timeout.
+     */
+    std::string receive_from_dcs();
+
+    /**
+     * @brief Sends a message to DCS, or queues it if the budget of messages of the current frame is spent.
+     *
+     * @param lane Priority lane of the message.
+     * @param message Message to send.
+     * @param coalesce_key Key of queued messages superseded by this message, or empty to never coalesce.
+     */
+    void schedule_to_dcs(const DcsCommandLane lane,
+                         const std::string &message,
+                         const std::string_view coalesce_key = std::string_view());
+
+    /**
+     * @brief Starts a new frame of the command scheduler, sending queued messages within the renewed budget.
+     */
+    void send_queued_commands();
+
+    /**
+     * @brief Sends a message to DCS through the selected transport, with command_mutex_ held.
+     *
+     * @param message Message to send.
+     */
+    void send_to_dcs(const std::string &message);
+
+    /**
+     * @brief Publishes the current game state to shared memory, if enabled and changed since it was last published.
+     */
+    void publish_game_state();
+
     DcsConnectionSettings connection_settings_; // Stored connection settings used for DCS Socket.
-    DcsSocket dcs_socket_;                      // UDP Socket connection for communicating with DCS lua export scripts.
+    const unsigned instance_id_;                // ID unique to this instance within the process.
+    std::unique_ptr<DcsSocket> dcs_socket_;     // UDP Socket connection for communicating with DCS lua export scripts.
+    std::unique_ptr<SharedMemoryRing> export_ring_;  // Ring of packets from a same-host exporter, instead of UDP.
+    std::unique_ptr<SharedMemoryRing> command_ring_; // Ring of commands to a same-host exporter, instead of UDP.
+    std::unique_ptr<UdpForwarder> forwarder_;   // Forwards received packets to the forward endpoints, if any.
+    std::unique_ptr<SharedGameStateWriter> shared_state_; // Publishes the game state to local readers, if enabled.
+    unsigned published_update_count_ = 0;                 // Update count of the last published game state.
+    size_t published_entries_ = 0;                       // DCS IDs in the last published game state.
     std::string current_game_module_;           // Stores the current aircraft module name being used in game.
-    std::map<int, std::string>
-        current_game_state_; // Maps DCS ID keys of received values to their most recently published values.
+    std::vector<int> subscribed_dcs_ids_;       // DCS IDs of the last subscription command, empty for all IDs.
+    bool filter_dcs_ids_ = false;               // True once a DCS ID filter has been set.
+    bool capture_all_dcs_ids_ = false;          // True to store values of all DCS IDs regardless of the filter.
+    bool dcs_id_filter_enabled_ = false;        // True to apply the filter without export script digest support.
+    std::vector<bool> referenced_dcs_ids_;      // Bitset of DCS IDs passing the filter, indexed by DCS ID.
+    bool exporter_supports_digest_ = false;     // True once export scripts have advertised digest commands.
+    // True once export scripts have advertised command batches, read by threads sending commands.
+    std::atomic<bool> exporter_supports_command_batch_ = false;
+    // Guards the scheduler and transport, as commands are sent from event threads while update_dcs_state runs.
+    std::mutex command_mutex_;
+    DcsCommandScheduler command_scheduler_; // Paces messages to DCS per frame in priority lanes.
+    int silent_receives_ = 0;                   // Consecutive receives which timed out without a packet.
+    std::unordered_map<int, DcsIdValue>
+        current_game_state_;          // Maps DCS ID keys of received values to their most recently published values.
+    unsigned update_count_ = 0;       // Incremented each time a value in the current game state changes.
+    unsigned clear_update_count_ = 0; // Update count at which the game state was last cleared.
+
+    std::vector<BinaryExportValue> binary_values_; // Values decoded from the last binary packet.
+
+    DcsBiosStateBuffer dcs_bios_state_; // Shadow state of the DCS-BIOS address space.
+    // DCS IDs of the monitored DCS-BIOS outputs of each word address, set through the DCS ID filter.
+    std::unordered_map<uint16_t, std::vector<int>> dcs_bios_monitors_;
+
+    // State of sequenced packets, tracked for all DCS IDs regardless of the DCS ID filter to verify keyframes.
+    using StreamValue = struct {
+        uint32_t hash;     // Hash of the last received value.
+        uint32_t sequence; // Sequence number of the packet of the last received value.
+    };
+    std::unordered_map<int, StreamValue> stream_values_; // Last received values of DCS IDs in sequenced packets.
+    bool stream_started_ = false;                        // True once a sequenced packet has been received.
+    uint32_t next_sequence_ = 0;                         // Sequence number following the latest packet.
+    uint64_t missing_sequences_ = 0;                     // Bit i is set if (next_sequence_ - 1 - i) is missing.
+    DcsStreamStats stream_stats_{};                      // Statistics of sequenced packets received.
 };
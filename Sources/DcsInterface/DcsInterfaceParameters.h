@@ -7,3 +7,18 @@ const std::string kDefaultDcsListenerPort = "1725"; // Port number to receive DC
 const std::string kDefaultDcsSendPort = "26027";    // Port number which DCS commands will be sent to.
 const std::string kDefaultDcsIpAddress =
     "127.0.0.1"; // IP Address on which to communicate with DCS -- Default LocalHost.
+
+// Parameters used for Property Inspector lookup requests.
+const size_t kNumLookupWorkers = 2;  // Number of threads running ID lookup and module scanning requests.
+const size_t kMaxQueuedLookups = 16; // Maximum number of lookup requests waiting for a thread.
+const std::string kClickabledataCacheDirectory = "clickabledata_cache"; // Directory of cached module clickabledata.
+const int kInstalledModulesPollIntervalMs = 10000; // Rescan interval of installed modules without change notifications.
+const size_t kMaxCachedModulesInMemory = 8; // Maximum number of modules with clickabledata cached in memory.
+const double kDefaultPreextractCpuBudget = 0.25; // Fraction of CPU cores used to extract all modules in background.
+const int kPreextractStartDelayMs = 2000; // Delay before extracting modules, so quick settings changes restart once.
+const size_t kMaxClickabledataChunkBytes = 32 * 1024; // Maximum size of each clickabledata message to the PI.
+const size_t kMaxClickabledataChunksInFlight = 4;     // Clickabledata chunks sent before the PI must acknowledge one.
+const size_t kMaxIdSearchResults = 200; // Maximum number of ranked elements returned for an ID search query.
+const size_t kMaxIdleLuaStates = 4; // Warmed Lua states kept for reuse by clickabledata extraction.
+const uint64_t kMaxLuaInstructions = 2000000000; // Maximum Lua instructions executed extracting a module.
+const size_t kMaxLuaMemoryBytes = 512 * 1024 * 1024; // Maximum memory allocated by Lua extracting a module.
@@ -11,7 +11,10 @@
 // Set default timeout for socket.
 DWORD socket_timeout_ms = 100;
 
-DcsSocket::DcsSocket(const std::string &ip_address, const std::string &rx_port, const std::string &tx_port) {
+DcsSocket::DcsSocket(const std::string &ip_address,
+                     const std::string &rx_port,
+                     const std::string &tx_port,
+                     const std::string &multicast_group) {
     // Detect any missing input settings.
     if (rx_port.empty() || tx_port.empty() || ip_address.empty()) {
         const std::string error_msg =
@@ -19,6 +22,17 @@ DcsSocket::DcsSocket(const std::string &ip_address, const std::string &rx_port,
         throw std::runtime_error(error_msg);
     }
 
+    // Multicast group addresses are in 224.0.0.0/4.
+    ip_mreq membership;
+    memset(&membership, 0, sizeof(membership));
+    if (!multicast_group.empty()) {
+        if (inet_pton(AF_INET, multicast_group.c_str(), &membership.imr_multiaddr) != 1 ||
+            (ntohl(membership.imr_multiaddr.s_addr) >> 28) != 0xE) {
+            throw std::runtime_error("Invalid multicast group IP: " + multicast_group);
+        }
+        membership.imr_interface.s_addr = htonl(INADDR_ANY);
+    }
+
     // Initialize Windows Sockets DLL to version 2.2.
     WSADATA wsaData;
     const auto err = WSAStartup(MAKEWORD(2, 2), &wsaData);
@@ -35,9 +49,10 @@ DcsSocket::DcsSocket(const std::string &ip_address, const std::string &rx_port,
     hints.ai_socktype = SOCK_DGRAM;
     hints.ai_flags = AI_PASSIVE;
 
-    // Define local receive port.
+    // Define local receive port, on all interfaces to receive a multicast group.
     addrinfo *local_port;
-    const auto getaddr_result = getaddrinfo(ip_address.c_str(), rx_port.c_str(), &hints, &local_port);
+    const auto getaddr_result = getaddrinfo(
+        multicast_group.empty() ? ip_address.c_str() : nullptr, rx_port.c_str(), &hints, &local_port);
     if (getaddr_result != 0) {
         const std::string error_msg = "Could not get valid address info from requested IP: " + ip_address +
                                       " Rx_Port: " + rx_port + " Tx_Port: " + tx_port +
@@ -49,6 +64,11 @@ DcsSocket::DcsSocket(const std::string &ip_address, const std::string &rx_port,
     // Bind local socket to receive port.
     socket_id_ = socket(local_port->ai_family, local_port->ai_socktype, local_port->ai_protocol);
     setsockopt(socket_id_, SOL_SOCKET, SO_RCVTIMEO, (const char *)&socket_timeout_ms, sizeof(socket_timeout_ms));
+    if (!multicast_group.empty()) {
+        // Allow other listeners of the group on the same host to bind the same port.
+        const int reuse_address = 1;
+        setsockopt(socket_id_, SOL_SOCKET, SO_REUSEADDR, (const char *)&reuse_address, sizeof(reuse_address));
+    }
     const auto bind_result = bind(socket_id_, local_port->ai_addr, static_cast<int>(local_port->ai_addrlen));
     freeaddrinfo(local_port);
 
@@ -60,6 +80,16 @@ DcsSocket::DcsSocket(const std::string &ip_address, const std::string &rx_port,
         throw std::runtime_error(error_msg);
     }
 
+    if (!multicast_group.empty() &&
+        setsockopt(socket_id_, IPPROTO_IP, IP_ADD_MEMBERSHIP, (const char *)&membership, sizeof(membership)) ==
+            SOCKET_ERROR) {
+        const std::string error_msg = "Could not join multicast group " + multicast_group +
+                                      " -- WSA Error: " + std::to_string(WSAGetLastError());
+        closesocket(socket_id_);
+        WSACleanup();
+        throw std::runtime_error(error_msg);
+    }
+
     if (tx_port != "dynamic") {
         // Define send destination port.
         addrinfo *send_to_port;
@@ -82,17 +112,23 @@ std::stringstream DcsSocket::DcsReceive() {
     int sender_addr_size = sizeof(sender_addr);
 
     // Receive next UDP message.
-    constexpr int MAX_UDP_MSG_SIZE = 1024; // Maximum UDP buffer size to read.
-    char msg[MAX_UDP_MSG_SIZE] = {};
-    (void)recvfrom(socket_id_, msg, MAX_UDP_MSG_SIZE, 0, &sender_addr, &sender_addr_size);
+    char *msg = receive_buffer_.data();
+    const int max_msg_size = static_cast<int>(receive_buffer_.size());
+    const auto received_size = recvfrom(socket_id_, msg, max_msg_size, 0, &sender_addr, &sender_addr_size);
 
     if (dest_addr_len_ == 0) {
         dest_addr_ = sender_addr;
         dest_addr_len_ = sender_addr_size;
     }
 
+    // Copy the received bytes, which may include NUL characters in binary packets. The buffer holds the largest UDP
+    // payload, so messages are received whole and may be forwarded unaltered.
     std::stringstream ss;
-    ss << msg;
+    if (received_size > 0) {
+        ss.write(msg, received_size);
+    } else if (received_size == SOCKET_ERROR && WSAGetLastError() == WSAEMSGSIZE) {
+        ss.write(msg, max_msg_size);
+    }
     return ss;
 }
 
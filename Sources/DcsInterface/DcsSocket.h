@@ -3,6 +3,7 @@
 #pragma once
 
 #include <sstream>
+#include <vector>
 #include <winsock2.h>
 
 class DcsSocket {
@@ -15,8 +16,15 @@ class DcsSocket {
      * @param tx_ip_address UDP transmit IP address.
      * @param rx_port UDP receive port.
      * @param tx_port UDP transmit port, defaults to dynamic (use recvfrom address) if not provided.
+     * @param multicast_group Multicast group IP address to also receive packets sent to, such as a single export
+     *                        stream shared by plugins on several hosts. The rx port is then bound on all interfaces and
+     *                        may be shared with other listeners of the group on the same host. Messages are still sent
+     *                        unicast to the destination address.
      */
-    DcsSocket(const std::string &ip_address, const std::string &rx_port, const std::string &tx_port = "dynamic");
+    DcsSocket(const std::string &ip_address,
+              const std::string &rx_port,
+              const std::string &tx_port = "dynamic",
+              const std::string &multicast_group = "");
 
     /**
      * @brief Destroy the Dcs Socket object
@@ -45,7 +53,11 @@ class DcsSocket {
     void DcsSend(const std::string &message);
 
   private:
+    // Maximum UDP message size to read, the largest UDP payload, so forwarded datagrams are never truncated.
+    static constexpr size_t kMaxUdpMessageSize = 65536;
+
     SOCKET socket_id_;      // Socket which is binded to the rx port.
     sockaddr dest_addr_;    // UDP address info for port which will be transmitted to.
     int dest_addr_len_ = 0; // Size of dest address.
+    std::vector<char> receive_buffer_ = std::vector<char>(kMaxUdpMessageSize); // Buffer of received UDP messages.
 };
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Holds one shard of data per Streamdeck device, each protected by its own lock.
+ *
+ *  Short accesses (such as key events) take priority over long running sweeps (such as display refresh): a sweep
+ *  calls SweepLock::yield_to_priority_access() between items, which hands the shard lock over to any waiting access.
+ *  A key press therefore waits for at most one item of a sweep, and never for other devices' shards.
+ */
+template <typename T> class DeviceShardMap {
+  private:
+    using Shard = struct {
+        std::mutex mutex;
+        std::atomic<int> priority_waiters; // Number of priority accesses waiting for the shard lock.
+        T data;
+    };
+
+  public:
+    /**
+     * @brief Lock held by a sweep over a shard, which can be temporarily released to priority accesses.
+     */
+    class SweepLock {
+      public:
+        SweepLock(Shard &shard) : shard_(shard), lock_(shard.mutex) {}
+
+        /**
+         * @brief If any priority access is waiting, releases the shard lock until all waiting accesses have acquired
+         * it, then re-acquires the lock. Data in the shard may have changed when this returns.
+         */
+        void yield_to_priority_access() {
+            if (shard_.priority_waiters.load(std::memory_order_acquire) > 0) {
+                lock_.unlock();
+                while (shard_.priority_waiters.load(std::memory_order_acquire) > 0) {
+                    std::this_thread::yield();
+                }
+                lock_.lock();
+            }
+        }
+
+      private:
+        Shard &shard_;
+        std::unique_lock<std::mutex> lock_;
+    };
+
+    /**
+     * @brief Calls func(data) for the shard of a device with priority over sweeps, creating the shard if needed.
+     *
+     * @param device_id Streamdeck device ID.
+     * @param func Function to call with the shard data locked.
+     */
+    template <typename Func> void access(const std::string &device_id, Func &&func) {
+        Shard &shard = get_or_create_shard(device_id);
+        priority_access(shard, func);
+    }
+
+    /**
+     * @brief Calls func(data) for each shard in turn with priority over sweeps, until func returns true.
+     *        Used when the device is not known.
+     *
+     * @return True if func returned true for any shard.
+     */
+    template <typename Func> bool access_any(Func &&func) {
+        for (Shard *shard : snapshot_shards()) {
+            if (priority_access(*shard, func)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Calls func(data, sweep_lock) for each shard in turn, holding the shard's lock.
+     *
+     * @param func Function to call, which should call sweep_lock.yield_to_priority_access() between items.
+     */
+    template <typename Func> void sweep(Func &&func) {
+        for (Shard *shard : snapshot_shards()) {
+            SweepLock sweep_lock(*shard);
+            func(shard->data, sweep_lock);
+        }
+    }
+
+  private:
+    template <typename Func> static auto priority_access(Shard &shard, Func &func) {
+        shard.priority_waiters.fetch_add(1, std::memory_order_acq_rel);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.priority_waiters.fetch_sub(1, std::memory_order_acq_rel);
+        return func(shard.data);
+    }
+
+    Shard &get_or_create_shard(const std::string &device_id) {
+        {
+            std::shared_lock<std::shared_mutex> lock(shards_mutex_);
+            const auto it = shards_.find(device_id);
+            if (it != shards_.end()) {
+                return *it->second;
+            }
+        }
+        std::unique_lock<std::shared_mutex> lock(shards_mutex_);
+        std::unique_ptr<Shard> &shard = shards_[device_id];
+        if (!shard) {
+            shard = std::make_unique<Shard>();
+            shard->priority_waiters = 0;
+        }
+        return *shard;
+    }
+
+    // Shards are never removed, so pointers remain valid after the map lock is released.
+    std::vector<Shard *> snapshot_shards() {
+        std::shared_lock<std::shared_mutex> lock(shards_mutex_);
+        std::vector<Shard *> shards;
+        shards.reserve(shards_.size());
+        for (auto &[device_id, shard] : shards_) {
+            shards.push_back(shard.get());
+        }
+        return shards;
+    }
+
+    std::shared_mutex shards_mutex_; // Protects the map of shards (not the shard data).
+    std::map<std::string, std::unique_ptr<Shard>> shards_;
+};
@@ -0,0 +1,423 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "InstalledModuleWatcher.h"
+
+#include "ClickabledataCache.h"
+
+#include <algorithm>
+#include <filesystem>
+#include <set>
+#include <unordered_map>
+
+#if !defined(_WIN32) && defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace {
+// Interval at which the watcher thread checks for a stop request.
+constexpr auto kStopCheckInterval = std::chrono::milliseconds(100);
+// Time allowed for a burst of changes (e.g. a DCS update) to settle before modules are rescanned.
+constexpr auto kChangeSettleTime = std::chrono::milliseconds(200);
+
+#if defined(_WIN32)
+/**
+ * @brief Reports changes within the modules directory with ReadDirectoryChangesW, which watches the whole subtree.
+ */
+class ModuleChangeNotifier {
+  public:
+    ModuleChangeNotifier(const std::filesystem::path &modules_path, const bool enabled) {
+        if (!enabled) {
+            return;
+        }
+        directory_ = CreateFileW(modules_path.wstring().c_str(),
+                                 FILE_LIST_DIRECTORY,
+                                 FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                 nullptr,
+                                 OPEN_EXISTING,
+                                 FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED,
+                                 nullptr);
+        if (directory_ == INVALID_HANDLE_VALUE) {
+            return;
+        }
+        overlapped_.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+        if (overlapped_.hEvent == nullptr || !request_changes()) {
+            close();
+        }
+    }
+
+    ~ModuleChangeNotifier() { close(); }
+
+    bool is_active() const { return directory_ != INVALID_HANDLE_VALUE; }
+
+    // The subtree of the modules directory is already watched.
+    void watch_module(const std::string &) {}
+
+    /**
+     * @brief Waits for changes, adding the folders of changed modules to changed_modules ("" if the module list may
+     *        have changed), or setting rescan_all if changes were lost.
+     *
+     * @return True if any changes were reported.
+     */
+    bool wait_for_changes(const std::chrono::milliseconds timeout,
+                          std::set<std::string> &changed_modules,
+                          bool &rescan_all) {
+        if (WaitForSingleObject(overlapped_.hEvent, static_cast<DWORD>(timeout.count())) != WAIT_OBJECT_0) {
+            return false;
+        }
+        DWORD num_bytes = 0;
+        request_pending_ = false;
+        if (!GetOverlappedResult(directory_, &overlapped_, &num_bytes, FALSE) || num_bytes == 0) {
+            // The buffer overflowed and the changes were discarded.
+            rescan_all = true;
+        } else {
+            for (size_t offset = 0;;) {
+                const auto *info = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(buffer_ + offset);
+                const std::wstring name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                const size_t separator = name.find(L'\\');
+                if (separator == std::wstring::npos) {
+                    changed_modules.insert("");
+                    changed_modules.insert(std::filesystem::path(name).string());
+                } else {
+                    changed_modules.insert(std::filesystem::path(name.substr(0, separator)).string());
+                }
+                if (info->NextEntryOffset == 0) {
+                    break;
+                }
+                offset += info->NextEntryOffset;
+            }
+        }
+        if (!request_changes()) {
+            close();
+            rescan_all = true;
+        }
+        return true;
+    }
+
+  private:
+    bool request_changes() {
+        ResetEvent(overlapped_.hEvent);
+        request_pending_ = ReadDirectoryChangesW(directory_,
+                                                 buffer_,
+                                                 sizeof(buffer_),
+                                                 TRUE,
+                                                 FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+                                                     FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE,
+                                                 nullptr,
+                                                 &overlapped_,
+                                                 nullptr) != 0;
+        return request_pending_;
+    }
+
+    void close() {
+        if (directory_ != INVALID_HANDLE_VALUE) {
+            if (request_pending_) {
+                // Wait for the pending request to be cancelled, as it writes to buffer_.
+                CancelIo(directory_);
+                DWORD num_bytes = 0;
+                GetOverlappedResult(directory_, &overlapped_, &num_bytes, TRUE);
+                request_pending_ = false;
+            }
+            CloseHandle(directory_);
+            directory_ = INVALID_HANDLE_VALUE;
+        }
+        if (overlapped_.hEvent != nullptr) {
+            CloseHandle(overlapped_.hEvent);
+            overlapped_.hEvent = nullptr;
+        }
+    }
+
+    HANDLE directory_ = INVALID_HANDLE_VALUE;
+    OVERLAPPED overlapped_ = {};
+    bool request_pending_ = false;
+    alignas(DWORD) BYTE buffer_[64 * 1024]; // Network shares do not support larger buffers.
+};
+
+#elif defined(__linux__)
+/**
+ * @brief Reports changes within the modules directory with inotify, which watches the modules directory, each module
+ *        folder and every directory of the modules' cockpit scripts.
+ */
+class ModuleChangeNotifier {
+  public:
+    ModuleChangeNotifier(const std::filesystem::path &modules_path, const bool enabled) : modules_path_(modules_path) {
+        if (!enabled) {
+            return;
+        }
+        fd_ = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd_ >= 0 && add_watch(modules_path_, "") < 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+    }
+
+    ~ModuleChangeNotifier() {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+    }
+
+    bool is_active() const { return fd_ >= 0; }
+
+    // Watches a module folder and its cockpit scripts directories, including directories added since last watched.
+    void watch_module(const std::string &module_folder_name) {
+        if (!is_active()) {
+            return;
+        }
+        const std::filesystem::path module_path = modules_path_ / module_folder_name;
+        add_watch(module_path, module_folder_name);
+        std::error_code error;
+        const std::filesystem::path cockpit_path = module_path / "Cockpit";
+        if (!std::filesystem::is_directory(cockpit_path, error)) {
+            return;
+        }
+        add_watch(cockpit_path, module_folder_name);
+        for (auto it = std::filesystem::recursive_directory_iterator(cockpit_path, error);
+             !error && it != std::filesystem::recursive_directory_iterator();
+             it.increment(error)) {
+            if (it->is_directory(error)) {
+                add_watch(it->path(), module_folder_name);
+            }
+        }
+    }
+
+    /**
+     * @brief Waits for changes, adding the folders of changed modules to changed_modules ("" if the module list may
+     *        have changed), or setting rescan_all if changes were lost.
+     *
+     * @return True if any changes were reported.
+     */
+    bool wait_for_changes(const std::chrono::milliseconds timeout,
+                          std::set<std::string> &changed_modules,
+                          bool &rescan_all) {
+        pollfd poll_fd = {fd_, POLLIN, 0};
+        if (poll(&poll_fd, 1, static_cast<int>(timeout.count())) <= 0) {
+            return false;
+        }
+        alignas(inotify_event) char buffer[16 * 1024];
+        bool has_changes = false;
+        ssize_t length = 0;
+        while ((length = read(fd_, buffer, sizeof(buffer))) > 0) {
+            for (const char *next = buffer; next < buffer + length;) {
+                const auto *event = reinterpret_cast<const inotify_event *>(next);
+                next += sizeof(inotify_event) + event->len;
+                has_changes = true;
+                if (event->mask & IN_Q_OVERFLOW) {
+                    rescan_all = true;
+                    continue;
+                }
+                const auto watched = watched_modules_.find(event->wd);
+                if (watched == watched_modules_.end()) {
+                    continue;
+                }
+                if (watched->second.empty()) {
+                    // Entry of the modules directory itself.
+                    changed_modules.insert("");
+                    if (event->len > 0) {
+                        changed_modules.insert(event->name);
+                    }
+                } else {
+                    changed_modules.insert(watched->second);
+                }
+                if (event->mask & IN_IGNORED) {
+                    watched_modules_.erase(watched);
+                }
+            }
+        }
+        return has_changes;
+    }
+
+  private:
+    static constexpr uint32_t kWatchMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB |
+                                           IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_MOVE_SELF;
+
+    int add_watch(const std::filesystem::path &path, const std::string &module_folder_name) {
+        const int wd = inotify_add_watch(fd_, path.c_str(), kWatchMask);
+        if (wd >= 0) {
+            watched_modules_[wd] = module_folder_name;
+        }
+        return wd;
+    }
+
+    std::filesystem::path modules_path_;
+    int fd_ = -1;
+    std::unordered_map<int, std::string> watched_modules_; // Module folder of each watch ("" for modules directory).
+};
+
+#else
+/**
+ * @brief Change notifications are not supported on this platform, so the watcher polls.
+ */
+class ModuleChangeNotifier {
+  public:
+    ModuleChangeNotifier(const std::filesystem::path &, const bool) {}
+    bool is_active() const { return false; }
+    void watch_module(const std::string &) {}
+    bool wait_for_changes(const std::chrono::milliseconds, std::set<std::string> &, bool &) { return false; }
+};
+#endif
+
+json installed_modules_json(const std::vector<std::string> &module_folders) {
+    return json({{"installed_modules", module_folders}, {"result", "success"}});
+}
+} // namespace
+
+InstalledModuleWatcher::InstalledModuleWatcher(const std::string &module_subdir,
+                                               const std::chrono::milliseconds poll_interval,
+                                               const bool use_change_notifications,
+                                               ModuleChangedCallback on_module_changed)
+    : module_subdir_(module_subdir), poll_interval_(poll_interval),
+      use_change_notifications_(use_change_notifications), on_module_changed_(std::move(on_module_changed)) {}
+
+InstalledModuleWatcher::~InstalledModuleWatcher() { stop(); }
+
+json InstalledModuleWatcher::get_installed_modules(const std::string &dcs_install_path) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!dcs_install_path_.empty() && dcs_install_path_ == dcs_install_path) {
+            return installed_modules_json(module_folders_);
+        }
+    }
+
+    std::lock_guard<std::mutex> watch_lock(watch_mutex_);
+    {
+        // Another request may have started watching the installation while waiting.
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!dcs_install_path_.empty() && dcs_install_path_ == dcs_install_path) {
+            return installed_modules_json(module_folders_);
+        }
+    }
+    stop_watcher();
+
+    std::vector<std::string> module_folders;
+    if (dcs_install_path.empty() || !list_module_folders(dcs_install_path, module_folders)) {
+        return json({{"installed_modules", json::array()},
+                     {"result", "DCS Install path [" + dcs_install_path + module_subdir_ + "] not found."}});
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dcs_install_path_ = dcs_install_path;
+        module_folders_ = module_folders;
+    }
+    stop_requested_ = false;
+    watcher_ = std::thread(&InstalledModuleWatcher::run, this, dcs_install_path);
+    return installed_modules_json(module_folders);
+}
+
+void InstalledModuleWatcher::stop() {
+    std::lock_guard<std::mutex> watch_lock(watch_mutex_);
+    stop_watcher();
+}
+
+bool InstalledModuleWatcher::is_using_change_notifications() const { return using_change_notifications_; }
+
+bool InstalledModuleWatcher::is_watching() const { return is_watching_; }
+
+void InstalledModuleWatcher::stop_watcher() {
+    stop_requested_ = true;
+    if (watcher_.joinable()) {
+        watcher_.join();
+    }
+    using_change_notifications_ = false;
+    is_watching_ = false;
+    std::lock_guard<std::mutex> lock(mutex_);
+    dcs_install_path_.clear();
+    module_folders_.clear();
+}
+
+bool InstalledModuleWatcher::list_module_folders(const std::string &dcs_install_path,
+                                                 std::vector<std::string> &module_folders) const {
+    std::error_code error;
+    const std::filesystem::path modules_path(dcs_install_path + module_subdir_);
+    if (!std::filesystem::is_directory(modules_path, error)) {
+        return false;
+    }
+    for (auto it = std::filesystem::directory_iterator(modules_path, error);
+         !error && it != std::filesystem::directory_iterator();
+         it.increment(error)) {
+        module_folders.push_back(it->path().filename().string());
+    }
+    std::sort(module_folders.begin(), module_folders.end());
+    return true;
+}
+
+void InstalledModuleWatcher::run(const std::string dcs_install_path) {
+    ModuleChangeNotifier notifier(dcs_install_path + module_subdir_, use_change_notifications_);
+    using_change_notifications_ = notifier.is_active();
+
+    // List the modules again now they are watched, as modules may have changed since the first listing, and
+    // fingerprint them so only later changes are reported.
+    std::vector<std::string> module_folders;
+    list_module_folders(dcs_install_path, module_folders);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        module_folders_ = module_folders;
+    }
+    std::unordered_map<std::string, uint64_t> fingerprints;
+    for (const auto &module_folder_name : module_folders) {
+        if (stop_requested_) {
+            return;
+        }
+        notifier.watch_module(module_folder_name);
+        fingerprints[module_folder_name] = fingerprint_module(dcs_install_path, module_folder_name);
+    }
+    is_watching_ = true;
+
+    auto next_poll_time = std::chrono::steady_clock::now() + poll_interval_;
+    while (!stop_requested_) {
+        std::set<std::string> changed_modules;
+        bool rescan_all = false;
+        if (notifier.is_active()) {
+            if (!notifier.wait_for_changes(kStopCheckInterval, changed_modules, rescan_all)) {
+                continue;
+            }
+            std::this_thread::sleep_for(kChangeSettleTime);
+            notifier.wait_for_changes(std::chrono::milliseconds(0), changed_modules, rescan_all);
+        } else {
+            std::this_thread::sleep_for(kStopCheckInterval);
+            if (std::chrono::steady_clock::now() < next_poll_time) {
+                continue;
+            }
+            next_poll_time = std::chrono::steady_clock::now() + poll_interval_;
+            rescan_all = true;
+        }
+        using_change_notifications_ = notifier.is_active();
+
+        if (rescan_all || changed_modules.count("") > 0) {
+            std::vector<std::string> new_module_folders;
+            list_module_folders(dcs_install_path, new_module_folders);
+            for (auto it = fingerprints.begin(); it != fingerprints.end();) {
+                if (!std::binary_search(new_module_folders.begin(), new_module_folders.end(), it->first)) {
+                    on_module_changed_(dcs_install_path, it->first);
+                    it = fingerprints.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+            for (const auto &module_folder_name : new_module_folders) {
+                if (fingerprints.count(module_folder_name) == 0) {
+                    notifier.watch_module(module_folder_name);
+                    fingerprints[module_folder_name] = fingerprint_module(dcs_install_path, module_folder_name);
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex_);
+            module_folders_ = std::move(new_module_folders);
+        }
+
+        for (auto &[module_folder_name, fingerprint] : fingerprints) {
+            if (!rescan_all && changed_modules.count(module_folder_name) == 0) {
+                continue;
+            }
+            // Watch directories added to the module before fingerprinting, so files later added to them are seen.
+            notifier.watch_module(module_folder_name);
+            const uint64_t new_fingerprint = fingerprint_module(dcs_install_path, module_folder_name);
+            if (new_fingerprint != fingerprint) {
+                fingerprint = new_fingerprint;
+                on_module_changed_(dcs_install_path, module_folder_name);
+            }
+        }
+    }
+}
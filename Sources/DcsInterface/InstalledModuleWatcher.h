@@ -0,0 +1,108 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "../Vendor/json/src/json.hpp"
+using json = nlohmann::json;
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Keeps the list of installed modules of a DCS installation in memory, updated by a background thread watching
+ *        the modules directory, so listing installed modules does not read the (possibly slow or network) drive.
+ *
+ * Changes are detected with directory change notifications (ReadDirectoryChangesW on Windows, inotify on Linux), or
+ * by rescanning every poll interval where notifications are unavailable. The watcher also fingerprints the cockpit
+ * scripts of each module (see fingerprint_module) and reports modules whose scripts changed, so their cached
+ * clickabledata can be invalidated.
+ */
+class InstalledModuleWatcher {
+  public:
+    // Called from the watcher thread with the folder name of a module whose cockpit scripts changed or were removed.
+    using ModuleChangedCallback =
+        std::function<void(const std::string &dcs_install_path, const std::string &module_folder_name)>;
+
+    /**
+     * @brief Construct a new Installed Module Watcher.
+     *
+     * @param module_subdir            Subdirectory of the installation containing module folders ("/mods/aircraft/").
+     * @param poll_interval            Interval between rescans when change notifications are unavailable.
+     * @param use_change_notifications False to always rescan every poll interval.
+     * @param on_module_changed        Called when a module's cockpit scripts change.
+     */
+    InstalledModuleWatcher(const std::string &module_subdir,
+                           const std::chrono::milliseconds poll_interval,
+                           const bool use_change_notifications,
+                           ModuleChangedCallback on_module_changed);
+
+    /**
+     * @brief Stops watching.
+     */
+    ~InstalledModuleWatcher();
+
+    /**
+     * @brief Gets the installed modules of a DCS installation in the format of get_installed_modules.
+     *
+     * The first call for an installation lists its modules from disk and starts watching it (replacing the watch of a
+     * previous installation), later calls are served from memory. Safe to call from multiple threads.
+     *
+     * @param dcs_install_path Path to DCS World installation.
+     * @return json Json object with "installed_modules" array and "result" string.
+     */
+    json get_installed_modules(const std::string &dcs_install_path);
+
+    /**
+     * @brief Stops watching, after which modules are listed from disk on the next request.
+     */
+    void stop();
+
+    /**
+     * @brief Returns true if the current installation is watched with change notifications rather than polling.
+     */
+    bool is_using_change_notifications() const;
+
+    /**
+     * @brief Returns true once the modules of the current installation have been fingerprinted by the watcher thread,
+     *        after which changes to their cockpit scripts are reported.
+     */
+    bool is_watching() const;
+
+  private:
+    /**
+     * @brief Runs in the background to apply changes to the watched installation until stopped.
+     */
+    void run(const std::string dcs_install_path);
+
+    /**
+     * @brief Stops the watcher thread, must be called holding watch_mutex_.
+     */
+    void stop_watcher();
+
+    /**
+     * @brief Lists the module folders of an installation.
+     *
+     * @return True if the modules directory exists.
+     */
+    bool list_module_folders(const std::string &dcs_install_path, std::vector<std::string> &module_folders) const;
+
+    std::string module_subdir_;
+    std::chrono::milliseconds poll_interval_;
+    bool use_change_notifications_;
+    ModuleChangedCallback on_module_changed_;
+
+    std::mutex watch_mutex_; // Serializes starting and stopping the watcher thread.
+    std::thread watcher_;
+    std::atomic<bool> stop_requested_ = false;
+    std::atomic<bool> using_change_notifications_ = false;
+    std::atomic<bool> is_watching_ = false;
+
+    std::mutex mutex_;                        // Protects the members below.
+    std::string dcs_install_path_;            // Installation being watched, empty if none.
+    std::vector<std::string> module_folders_; // Sorted module folders of the watched installation.
+};
@@ -0,0 +1,218 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "LuaStatePool.h"
+
+#include "../Vendor/lua-5.1.5/etc/lua.hpp"
+
+#include <cstdlib>
+#include <limits>
+
+namespace {
+// Number of instructions between checks of the instruction limit.
+constexpr int kInstructionHookInterval = 1000;
+// Number of runs after which a state is closed, so anything a script leaked outside its environment is discarded.
+constexpr size_t kMaxRunsPerState = 64;
+
+// Accounting and limits of a Lua state, shared with its allocator and instruction hook.
+struct LuaStateUsage {
+    size_t used_bytes = 0;
+    size_t max_bytes = std::numeric_limits<size_t>::max();
+    uint64_t instructions = 0;
+    uint64_t max_instructions = std::numeric_limits<uint64_t>::max();
+    bool memory_limit_exceeded = false;
+    bool instruction_limit_exceeded = false;
+};
+
+// Lua allocator which fails allocations that would exceed the memory limit of the state.
+void *limited_alloc(void *ud, void *ptr, size_t osize, size_t nsize) {
+    auto *usage = static_cast<LuaStateUsage *>(ud);
+    if (nsize == 0) {
+        free(ptr);
+        usage->used_bytes -= osize;
+        return nullptr;
+    }
+    if (nsize > osize && usage->used_bytes + (nsize - osize) > usage->max_bytes) {
+        usage->memory_limit_exceeded = true;
+        return nullptr;
+    }
+    void *block = realloc(ptr, nsize);
+    if (block != nullptr) {
+        usage->used_bytes = usage->used_bytes - osize + nsize;
+    }
+    return block;
+}
+
+// Count hook which raises an error once the instruction limit of the state is exceeded.
+void count_instructions(lua_State *lua_state, lua_Debug *) {
+    void *ud = nullptr;
+    lua_getallocf(lua_state, &ud);
+    auto *usage = static_cast<LuaStateUsage *>(ud);
+    usage->instructions += kInstructionHookInterval;
+    if (usage->instructions > usage->max_instructions) {
+        usage->instruction_limit_exceeded = true;
+        luaL_error(lua_state, "instruction limit exceeded");
+    }
+}
+
+int write_bytecode(lua_State *, const void *data, size_t size, void *ud) {
+    static_cast<std::string *>(ud)->append(static_cast<const char *>(data), size);
+    return 0;
+}
+} // namespace
+
+struct LuaStatePool::PooledState {
+    PooledState() : lua_state(lua_newstate(limited_alloc, &usage)) { luaL_openlibs(lua_state); }
+    ~PooledState() { lua_close(lua_state); }
+
+    LuaStateUsage usage; // Declared before lua_state, which allocates through it.
+    lua_State *lua_state;
+    size_t num_runs = 0;
+    std::string loaded_script;          // Script loaded as a function in the registry.
+    uint64_t loaded_script_version = 0; // Compiled version of the loaded script.
+    int loaded_script_ref = LUA_NOREF;
+};
+
+LuaStatePool::LuaStatePool(const size_t max_idle_states, const LuaRunLimits &limits)
+    : max_idle_states_(max_idle_states), limits_(limits) {}
+
+LuaStatePool::~LuaStatePool() = default;
+
+std::string LuaStatePool::run(const std::string &lua_script, const SetGlobals &set_globals) {
+    std::shared_ptr<const CompiledScript> compiled;
+    const int compile_status = get_compiled_script(lua_script, compiled);
+    if (compile_status != 0) {
+        return "Lua file load error: " + std::to_string(compile_status);
+    }
+
+    std::unique_ptr<PooledState> state = acquire_state();
+    lua_State *lua_state = state->lua_state;
+
+    // Load the script function from bytecode, unless the state already holds the current version.
+    if (state->loaded_script != lua_script || state->loaded_script_version != compiled->version) {
+        luaL_unref(lua_state, LUA_REGISTRYINDEX, state->loaded_script_ref);
+        state->loaded_script_ref = LUA_NOREF;
+        const std::string chunk_name = "@" + lua_script;
+        const int load_status =
+            luaL_loadbuffer(lua_state, compiled->bytecode.data(), compiled->bytecode.size(), chunk_name.c_str());
+        if (load_status != 0) {
+            return "Lua file load error: " + std::to_string(load_status);
+        }
+        state->loaded_script_ref = luaL_ref(lua_state, LUA_REGISTRYINDEX);
+        state->loaded_script = lua_script;
+        state->loaded_script_version = compiled->version;
+    }
+
+    // Run on a new thread whose globals are a fresh environment reading through to the standard libraries, so chunks
+    // loaded by the script (e.g. dofile) also see the run's globals rather than those of previous runs.
+    lua_State *run_state = lua_newthread(lua_state);
+    lua_newtable(run_state);
+    lua_newtable(run_state);
+    lua_pushvalue(run_state, LUA_GLOBALSINDEX);
+    lua_setfield(run_state, -2, "__index");
+    lua_setmetatable(run_state, -2);
+    lua_pushvalue(run_state, -1);
+    lua_setfield(run_state, -2, "_G");
+    lua_replace(run_state, LUA_GLOBALSINDEX);
+
+    set_globals(run_state);
+    lua_rawgeti(run_state, LUA_REGISTRYINDEX, state->loaded_script_ref);
+    lua_pushvalue(run_state, LUA_GLOBALSINDEX);
+    lua_setfenv(run_state, -2);
+
+    // Limits are only applied within the protected call, where exceeding them raises a Lua error.
+    state->usage.instructions = 0;
+    state->usage.max_instructions = limits_.max_instructions;
+    state->usage.max_bytes = state->usage.used_bytes + limits_.max_memory_bytes;
+    lua_sethook(run_state, count_instructions, LUA_MASKCOUNT, kInstructionHookInterval);
+    const int script_status = lua_pcall(run_state, 0, 0, 0);
+
+    lua_sethook(run_state, nullptr, 0, 0);
+    state->usage.max_bytes = std::numeric_limits<size_t>::max();
+    state->usage.max_instructions = std::numeric_limits<uint64_t>::max();
+    lua_settop(lua_state, 0);
+
+    std::string result = "success";
+    if (state->usage.instruction_limit_exceeded) {
+        result = "Lua instruction limit exceeded";
+    } else if (state->usage.memory_limit_exceeded) {
+        result = "Lua memory limit exceeded";
+    } else if (script_status != 0) {
+        result = "Lua script runtime error: " + std::to_string(script_status);
+    }
+
+    // A state which hit a limit may be left inconsistent by the interrupted script, so is not reused.
+    ++state->num_runs;
+    if (!state->usage.instruction_limit_exceeded && !state->usage.memory_limit_exceeded &&
+        state->num_runs < kMaxRunsPerState) {
+        lua_gc(lua_state, LUA_GCCOLLECT, 0);
+        release_state(std::move(state));
+    }
+    return result;
+}
+
+size_t LuaStatePool::num_idle_states() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return idle_states_.size();
+}
+
+size_t LuaStatePool::num_created_states() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return num_created_states_;
+}
+
+int LuaStatePool::get_compiled_script(const std::string &lua_script, std::shared_ptr<const CompiledScript> &compiled) {
+    std::error_code error;
+    const auto last_write_time = std::filesystem::last_write_time(lua_script, error);
+    const uintmax_t file_size = error ? 0 : std::filesystem::file_size(lua_script, error);
+    if (!error) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto cached = compiled_scripts_.find(lua_script);
+        if (cached != compiled_scripts_.end() && cached->second->last_write_time == last_write_time &&
+            cached->second->file_size == file_size) {
+            compiled = cached->second;
+            return 0;
+        }
+    }
+
+    // Compile in a temporary state, which is not limited as the script is only parsed.
+    auto script = std::make_shared<CompiledScript>();
+    script->last_write_time = last_write_time;
+    script->file_size = file_size;
+    lua_State *lua_state = luaL_newstate();
+    const int load_status = luaL_loadfile(lua_state, lua_script.c_str());
+    if (load_status == 0) {
+        lua_dump(lua_state, write_bytecode, &script->bytecode);
+    }
+    lua_close(lua_state);
+    if (load_status != 0) {
+        return load_status;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    script->version = next_script_version_++;
+    compiled_scripts_[lua_script] = script;
+    compiled = script;
+    return 0;
+}
+
+std::unique_ptr<LuaStatePool::PooledState> LuaStatePool::acquire_state() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!idle_states_.empty()) {
+            std::unique_ptr<PooledState> state = std::move(idle_states_.back());
+            idle_states_.pop_back();
+            return state;
+        }
+        ++num_created_states_;
+    }
+    return std::make_unique<PooledState>();
+}
+
+void LuaStatePool::release_state(std::unique_ptr<PooledState> state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (idle_states_.size() < max_idle_states_) {
+        idle_states_.push_back(std::move(state));
+    }
+}
@@ -0,0 +1,107 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct lua_State;
+
+using LuaRunLimits = struct {
+    uint64_t max_instructions; // Maximum number of Lua VM instructions executed by a run.
+    size_t max_memory_bytes;   // Maximum memory used by the Lua state during a run.
+};
+
+/**
+ * @brief Pool of warmed Lua states (standard libraries opened and script loaded) which run Lua scripts precompiled to
+ * bytecode, so repeated runs of a script skip state setup and parsing.
+ *
+ * Each run executes in a fresh global environment (falling back to the standard libraries for reads) so globals set by
+ * one run are not seen by the next, and a full garbage collection is done before the state is reused. Each run is
+ * limited in the number of instructions executed and the memory allocated, so a misbehaving script can neither hang nor
+ * bloat the caller. States which hit a limit, or have been reused many times, are closed rather than reused.
+ *
+ * Safe to call from multiple threads; concurrent runs use separate states.
+ */
+class LuaStatePool {
+  public:
+    // Called before a run to set the globals of the run's environment on the given Lua state (e.g. lua_setglobal).
+    using SetGlobals = std::function<void(lua_State *lua_state)>;
+
+    /**
+     * @brief Construct a new Lua State Pool.
+     *
+     * @param max_idle_states Maximum number of states kept for reuse between runs (0 closes each state after its run).
+     * @param limits Limits applied to each run.
+     */
+    LuaStatePool(const size_t max_idle_states, const LuaRunLimits &limits);
+
+    ~LuaStatePool();
+
+    LuaStatePool(const LuaStatePool &) = delete;
+    LuaStatePool &operator=(const LuaStatePool &) = delete;
+
+    /**
+     * @brief Runs a Lua script file, compiling it to bytecode on first use or when the file changes.
+     *
+     * @param lua_script Path to the Lua script.
+     * @param set_globals Function which sets the globals of the run.
+     * @return "success", or "Lua file load error: N", "Lua script runtime error: N" (with the Lua error code N),
+     *         "Lua instruction limit exceeded" or "Lua memory limit exceeded".
+     */
+    std::string run(const std::string &lua_script, const SetGlobals &set_globals);
+
+    /**
+     * @brief Returns the number of states waiting for reuse.
+     */
+    size_t num_idle_states();
+
+    /**
+     * @brief Returns the number of states created since construction.
+     */
+    size_t num_created_states();
+
+  private:
+    struct PooledState;
+
+    using CompiledScript = struct {
+        std::filesystem::file_time_type last_write_time; // Modification time of the compiled file.
+        uintmax_t file_size;                              // Size of the compiled file.
+        uint64_t version;                                 // Changes each time the script is compiled.
+        std::string bytecode;                             // Output of lua_dump.
+    };
+
+    /**
+     * @brief Compiles a script if not yet compiled or changed since compiled.
+     *
+     * @param lua_script Path to the Lua script.
+     * @param compiled Set to the compiled script.
+     * @return 0 on success, or the error code of luaL_loadfile.
+     */
+    int get_compiled_script(const std::string &lua_script, std::shared_ptr<const CompiledScript> &compiled);
+
+    /**
+     * @brief Takes an idle state, or creates a new state if none are idle.
+     */
+    std::unique_ptr<PooledState> acquire_state();
+
+    /**
+     * @brief Returns a state to the idle states, or closes it if the pool is full.
+     */
+    void release_state(std::unique_ptr<PooledState> state);
+
+    size_t max_idle_states_;
+    LuaRunLimits limits_;
+
+    std::mutex mutex_; // Protects all members below.
+    std::vector<std::unique_ptr<PooledState>> idle_states_;
+    std::unordered_map<std::string, std::shared_ptr<const CompiledScript>> compiled_scripts_;
+    uint64_t next_script_version_ = 1;
+    size_t num_created_states_ = 0;
+};
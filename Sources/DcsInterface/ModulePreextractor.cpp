@@ -0,0 +1,155 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "ModulePreextractor.h"
+
+#include "DcsIdLookup.h"
+
+#include <Windows.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+ModulePreextractor::ModulePreextractor(ClickabledataCache &cache,
+                                       const std::string &lua_script,
+                                       const int start_delay_ms)
+    : cache_(cache), lua_script_(lua_script), start_delay_ms_(start_delay_ms) {}
+
+ModulePreextractor::~ModulePreextractor() {
+    // Workers reference the cache and this preextractor, so all must complete before destruction.
+    stop();
+    for (auto &[extraction, runner] : stopped_runners_) {
+        runner.join();
+    }
+}
+
+void ModulePreextractor::start(const std::string &dcs_install_path, const double cpu_budget) {
+    stop_current_extraction();
+    join_finished_runners();
+    dcs_install_path_ = dcs_install_path;
+    cpu_budget_ = cpu_budget;
+    extraction_ = std::make_shared<Extraction>();
+    extraction_->dcs_install_path = dcs_install_path;
+    runner_ = std::thread([this, extraction = extraction_, num_workers = num_workers_for_cpu_budget(cpu_budget)]() {
+        run(*extraction, num_workers);
+    });
+}
+
+void ModulePreextractor::stop() {
+    stop_current_extraction();
+    join_finished_runners();
+    dcs_install_path_.clear();
+}
+
+void ModulePreextractor::wait() {
+    if (runner_.joinable()) {
+        runner_.join();
+    }
+}
+
+void ModulePreextractor::stop_current_extraction() {
+    if (!extraction_) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(extraction_->mutex);
+        extraction_->stop_requested = true;
+    }
+    extraction_->stopped.notify_all();
+    if (runner_.joinable()) {
+        stopped_runners_.emplace_back(extraction_, std::move(runner_));
+    }
+}
+
+void ModulePreextractor::join_finished_runners() {
+    for (auto it = stopped_runners_.begin(); it != stopped_runners_.end();) {
+        if (it->first->finished) {
+            it->second.join();
+            it = stopped_runners_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+const std::string &ModulePreextractor::get_dcs_install_path() const { return dcs_install_path_; }
+
+double ModulePreextractor::get_cpu_budget() const { return cpu_budget_; }
+
+ModulePreextractor::Progress ModulePreextractor::get_progress() const {
+    if (!extraction_) {
+        return {0, 0, 0};
+    }
+    return {extraction_->total_modules, extraction_->extracted_modules, extraction_->failed_modules};
+}
+
+size_t ModulePreextractor::num_workers_for_cpu_budget(const double cpu_budget) {
+    const unsigned num_cores = std::max(1U, std::thread::hardware_concurrency());
+    const auto num_workers = static_cast<size_t>(std::floor(std::clamp(cpu_budget, 0.0, 1.0) * num_cores));
+    return std::max<size_t>(1, num_workers);
+}
+
+std::vector<std::string> ModulePreextractor::lookup_module_names(const std::vector<std::string> &module_folders) {
+    // Matches the handling of multi-version modules by the ID lookup window and extract_clickabledata.lua.
+    std::vector<std::string> module_names;
+    for (const auto &module_folder : module_folders) {
+        if (module_folder == "C-101") {
+            module_names.push_back("C-101CC");
+            module_names.push_back("C-101EB");
+        } else {
+            module_names.push_back(module_folder);
+            if (module_folder == "L-39C") {
+                module_names.push_back("L-39ZA");
+            }
+        }
+    }
+    return module_names;
+}
+
+void ModulePreextractor::run(Extraction &extraction, const size_t num_workers) {
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+
+    // Wait out the start delay, so an extraction restarted in the meantime is stopped before extracting any module.
+    {
+        std::unique_lock<std::mutex> lock(extraction.mutex);
+        const auto is_stop_requested = [&extraction]() { return extraction.stop_requested.load(); };
+        if (extraction.stopped.wait_for(lock, std::chrono::milliseconds(start_delay_ms_), is_stop_requested)) {
+            extraction.finished = true;
+            return;
+        }
+    }
+
+    const json installed_modules_and_result = get_installed_modules(extraction.dcs_install_path, "/mods/aircraft/");
+    if (installed_modules_and_result["result"] != "success") {
+        extraction.finished = true;
+        return;
+    }
+    const std::vector<std::string> module_names =
+        lookup_module_names(installed_modules_and_result["installed_modules"].get<std::vector<std::string>>());
+    extraction.total_modules = module_names.size();
+
+    // Each worker takes the next module to extract until all are done or extraction is stopped.
+    std::atomic<size_t> next_module = 0;
+    const auto extract_modules = [&]() {
+        SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+        for (size_t i = next_module++; i < module_names.size() && !extraction.stop_requested; i = next_module++) {
+            if (cache_.get_clickabledata(extraction.dcs_install_path, module_names[i], lua_script_).result ==
+                "success") {
+                ++extraction.extracted_modules;
+            } else {
+                ++extraction.failed_modules;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < std::min(num_workers, module_names.size()); ++i) {
+        workers.emplace_back(extract_modules);
+    }
+    extract_modules(); // The runner thread is also a worker.
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    extraction.finished = true;
+}
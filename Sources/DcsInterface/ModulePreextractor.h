@@ -0,0 +1,126 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "ClickabledataCache.h"
+#include "DcsInterfaceParameters.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Extracts clickabledata of every installed module in the background to populate the ClickabledataCache, so
+ *        the first ID lookup of any module is served from the cache.
+ *
+ * Modules are extracted concurrently by low priority worker threads, each running its own Lua states. The number of
+ * workers is set by a CPU budget, the fraction of the machine's cores that may be used. Starting and stopping never
+ * wait for workers, so they may be called from the thread handling Streamdeck events, and extraction begins after a
+ * start delay so settings changed in quick succession (e.g. while typing the CPU budget) restart it only once.
+ */
+class ModulePreextractor {
+  public:
+    using Progress = struct {
+        size_t total_modules;     // Number of modules found in the DCS installation.
+        size_t extracted_modules; // Number of modules extracted successfully (or already cached).
+        size_t failed_modules;    // Number of modules whose extraction failed.
+    };
+
+    /**
+     * @brief Construct a new Module Preextractor.
+     *
+     * @param cache          Cache to populate, which must outlive the preextractor.
+     * @param lua_script     Lua script used for extraction (see extract_clickabledata).
+     * @param start_delay_ms Time after start before extraction begins, unless stopped or restarted in the meantime.
+     */
+    ModulePreextractor(ClickabledataCache &cache,
+                       const std::string &lua_script,
+                       const int start_delay_ms = kPreextractStartDelayMs);
+
+    /**
+     * @brief Stops any running extraction and waits for all workers to complete.
+     */
+    ~ModulePreextractor();
+
+    /**
+     * @brief Starts extraction of all modules of a DCS installation, stopping any previous extraction without
+     *        waiting for it.
+     *
+     * @param dcs_install_path Path to DCS World installation.
+     * @param cpu_budget       Fraction of CPU cores to use for extraction (at least one worker is used).
+     */
+    void start(const std::string &dcs_install_path, const double cpu_budget);
+
+    /**
+     * @brief Stops extraction after the modules currently being extracted have completed, without waiting for them.
+     */
+    void stop();
+
+    /**
+     * @brief Blocks until the current extraction has completed.
+     */
+    void wait();
+
+    /**
+     * @brief Returns the install path and CPU budget of the last started extraction, with an empty install path if
+     *        stopped (extraction that has completed on its own is still considered started).
+     */
+    const std::string &get_dcs_install_path() const;
+    double get_cpu_budget() const;
+
+    Progress get_progress() const;
+
+    /**
+     * @brief Returns the number of worker threads used for a CPU budget.
+     */
+    static size_t num_workers_for_cpu_budget(const double cpu_budget);
+
+    /**
+     * @brief Returns the module names available for ID lookup from the module folders of a DCS installation,
+     *        including each version of multi-version modules.
+     */
+    static std::vector<std::string> lookup_module_names(const std::vector<std::string> &module_folders);
+
+  private:
+    // State of one started extraction, shared with its runner so a stopped extraction may complete in the background.
+    struct Extraction {
+        std::string dcs_install_path;
+        std::mutex mutex;                  // Protects stop_requested while the runner waits for the start delay.
+        std::condition_variable stopped;   // Notified when stop is requested.
+        std::atomic<bool> stop_requested = false;
+        std::atomic<bool> finished = false; // Set by the runner once all of its workers have completed.
+        std::atomic<size_t> total_modules = 0;
+        std::atomic<size_t> extracted_modules = 0;
+        std::atomic<size_t> failed_modules = 0;
+    };
+
+    /**
+     * @brief Runs in the background to list installed modules and extract them with a pool of workers.
+     */
+    void run(Extraction &extraction, const size_t num_workers);
+
+    /**
+     * @brief Requests the current extraction to stop, keeping its runner to be joined once finished.
+     */
+    void stop_current_extraction();
+
+    /**
+     * @brief Joins runners of stopped extractions which have finished.
+     */
+    void join_finished_runners();
+
+    ClickabledataCache &cache_;
+    std::string lua_script_;
+    int start_delay_ms_;
+    std::string dcs_install_path_;
+    double cpu_budget_ = 0.0;
+
+    std::shared_ptr<Extraction> extraction_; // Current extraction, or nullptr if never started.
+    std::thread runner_;                     // Runner of the current extraction.
+    std::vector<std::pair<std::shared_ptr<Extraction>, std::thread>> stopped_runners_; // Completing in background.
+};
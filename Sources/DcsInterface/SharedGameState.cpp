@@ -0,0 +1,185 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "SharedGameState.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+constexpr uint32_t kSharedGameStateMagic = 0x53534344; // "DCSS" in little endian.
+constexpr uint32_t kSharedGameStateVersion = 1;
+// Attempts to read without a concurrent publish before a reader gives up, such as if the writer stopped mid-publish.
+constexpr int kMaxReadAttempts = 10000;
+
+std::string mapping_name(const std::string &name) { return "Local\\" + name; }
+} // namespace
+
+// Layout shared with readers in other processes, so only fixed width types are used.
+struct SharedGameStateHeader {
+    uint32_t magic;       // kSharedGameStateMagic once initialized by the writer.
+    uint32_t version;     // Version of the layout.
+    uint32_t max_entries; // Capacity of the entries array.
+    uint32_t heap_size;   // Capacity of the heap of values.
+    // Fields below are only consistent when read while the sequence number is even and unchanged.
+    alignas(64) std::atomic<uint32_t> sequence; // Incremented before and after each publish.
+    uint32_t entry_count;                       // Published entries.
+    uint32_t update_count;                      // Game state update count of the published values.
+    uint32_t dropped_entries;                   // Values left out of the last publish because the table was full.
+};
+
+struct SharedGameStateEntry {
+    int32_t dcs_id;  // DCS ID, with entries sorted in ascending order.
+    uint32_t offset; // Offset of the value in the heap.
+    uint32_t length; // Length of the value.
+};
+
+SharedGameStateWriter::SharedGameStateWriter(const std::string &name, const uint32_t max_entries,
+                                             const uint32_t heap_size) {
+    const size_t mapping_size = sizeof(SharedGameStateHeader) + max_entries * sizeof(SharedGameStateEntry) + heap_size;
+    // A table still mapped by readers of a previous writer is reused, so those readers see the new values.
+    mapping_ = CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(mapping_size), mapping_name(name).c_str());
+    void *view = (mapping_ != nullptr) ? MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, mapping_size) : nullptr;
+    if (view == nullptr) {
+        const std::string error_msg =
+            "Could not publish game state to " + name + " -- Error: " + std::to_string(GetLastError());
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        throw std::runtime_error(error_msg);
+    }
+    header_ = static_cast<SharedGameStateHeader *>(view);
+    entries_ = reinterpret_cast<SharedGameStateEntry *>(header_ + 1);
+    heap_ = reinterpret_cast<char *>(entries_ + max_entries);
+    if (header_->magic == kSharedGameStateMagic &&
+        (header_->max_entries != max_entries || header_->heap_size != heap_size)) {
+        UnmapViewOfFile(view);
+        CloseHandle(mapping_);
+        throw std::runtime_error("Game state is already published to " + name + " with a different size");
+    }
+
+    // The layout is published along with the initial empty table.
+    header_->magic = kSharedGameStateMagic;
+    header_->version = kSharedGameStateVersion;
+    header_->max_entries = max_entries;
+    header_->heap_size = heap_size;
+    publish({}, 0);
+}
+
+SharedGameStateWriter::~SharedGameStateWriter() {
+    UnmapViewOfFile(header_);
+    CloseHandle(mapping_);
+}
+
+void SharedGameStateWriter::publish(std::vector<std::pair<int, std::string_view>> values,
+                                    const unsigned update_count) {
+    std::sort(values.begin(), values.end());
+    const uint32_t sequence = header_->sequence.load(std::memory_order_relaxed);
+    header_->sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    uint32_t entry_count = 0;
+    uint32_t heap_used = 0;
+    uint32_t dropped_entries = 0;
+    for (const auto &[dcs_id, value] : values) {
+        if (entry_count == header_->max_entries || value.size() > header_->heap_size - heap_used) {
+            ++dropped_entries;
+            continue;
+        }
+        entries_[entry_count++] = {dcs_id, heap_used, static_cast<uint32_t>(value.size())};
+        std::memcpy(heap_ + heap_used, value.data(), value.size());
+        heap_used += static_cast<uint32_t>(value.size());
+    }
+    header_->entry_count = entry_count;
+    header_->update_count = update_count;
+    header_->dropped_entries = dropped_entries;
+
+    header_->sequence.store(sequence + 2, std::memory_order_release);
+}
+
+SharedGameStateReader::SharedGameStateReader(const std::string &name) {
+    mapping_ = OpenFileMappingA(FILE_MAP_READ, FALSE, mapping_name(name).c_str());
+    const void *view = (mapping_ != nullptr) ? MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (view == nullptr) {
+        const std::string error_msg =
+            "No game state is published to " + name + " -- Error: " + std::to_string(GetLastError());
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        throw std::runtime_error(error_msg);
+    }
+    header_ = static_cast<const SharedGameStateHeader *>(view);
+    (void)header_->sequence.load(std::memory_order_acquire);
+    if (header_->magic != kSharedGameStateMagic || header_->version != kSharedGameStateVersion) {
+        UnmapViewOfFile(view);
+        CloseHandle(mapping_);
+        throw std::runtime_error("Unsupported game state layout published to " + name);
+    }
+    entries_ = reinterpret_cast<const SharedGameStateEntry *>(header_ + 1);
+    heap_ = reinterpret_cast<const char *>(entries_ + header_->max_entries);
+}
+
+SharedGameStateReader::~SharedGameStateReader() {
+    UnmapViewOfFile(header_);
+    CloseHandle(mapping_);
+}
+
+template <typename Read> bool SharedGameStateReader::read_consistent(const Read &read) const {
+    for (int attempt = 0; attempt < kMaxReadAttempts; ++attempt) {
+        const uint32_t sequence = header_->sequence.load(std::memory_order_acquire);
+        if (sequence % 2 == 0) {
+            // Reads may see a partially published table, so read only within the bounds of the layout.
+            const uint32_t entry_count = std::min(header_->entry_count, header_->max_entries);
+            read(entry_count);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (header_->sequence.load(std::memory_order_relaxed) == sequence) {
+                return true;
+            }
+        }
+        std::this_thread::yield();
+    }
+    return false;
+}
+
+bool SharedGameStateReader::read_value(const int dcs_id, std::string &value) const {
+    bool found = false;
+    const bool consistent = read_consistent([&](const uint32_t entry_count) {
+        const auto entry = std::lower_bound(
+            entries_, entries_ + entry_count, dcs_id,
+            [](const SharedGameStateEntry &entry, const int id) { return entry.dcs_id < id; });
+        found = (entry != entries_ + entry_count) && (entry->dcs_id == dcs_id);
+        if (found) {
+            const uint32_t offset = std::min(entry->offset, header_->heap_size);
+            value.assign(heap_ + offset, std::min(entry->length, header_->heap_size - offset));
+        }
+    });
+    return consistent && found;
+}
+
+bool SharedGameStateReader::read_all(std::map<int, std::string> &values) const {
+    return read_consistent([&](const uint32_t entry_count) {
+        values.clear();
+        for (uint32_t i = 0; i < entry_count; ++i) {
+            const SharedGameStateEntry &entry = entries_[i];
+            const uint32_t offset = std::min(entry.offset, header_->heap_size);
+            values[entry.dcs_id].assign(heap_ + offset, std::min(entry.length, header_->heap_size - offset));
+        }
+    });
+}
+
+unsigned SharedGameStateReader::update_count() const {
+    unsigned update_count = 0;
+    read_consistent([&](const uint32_t) { update_count = header_->update_count; });
+    return update_count;
+}
+
+unsigned SharedGameStateReader::dropped_entries() const {
+    unsigned dropped_entries = 0;
+    read_consistent([&](const uint32_t) { dropped_entries = header_->dropped_entries; });
+    return dropped_entries;
+}
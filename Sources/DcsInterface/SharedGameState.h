@@ -0,0 +1,124 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include <Windows.h>
+
+struct SharedGameStateHeader;
+struct SharedGameStateEntry;
+
+/**
+ * @brief Publishes the game state to named shared memory, for any number of local SharedGameStateReaders.
+ *
+ * The mapping "Local\<name>" starts with a header, followed by an array of entries sorted by DCS ID and a heap of
+ * their values. The header's sequence number is a seqlock: it is odd while the writer is publishing, so readers
+ * sample the table without syscalls or locks, and retry when the sequence number changed during the sample.
+ */
+class SharedGameStateWriter {
+  public:
+    static constexpr uint32_t kDefaultMaxEntries = 4096;    // Entries of DCS IDs in the table.
+    static constexpr uint32_t kDefaultHeapSize = 256 * 1024; // Bytes of values in the table.
+
+    /**
+     * @brief Creates a named table of the game state, initially empty.
+     *
+     * @param name Name of the shared memory, as opened by readers.
+     * @param max_entries Maximum number of DCS IDs published.
+     * @param heap_size Maximum total bytes of published values.
+     * @throws std::runtime_error if the shared memory cannot be created.
+     */
+    SharedGameStateWriter(const std::string &name, const uint32_t max_entries = kDefaultMaxEntries,
+                          const uint32_t heap_size = kDefaultHeapSize);
+
+    ~SharedGameStateWriter();
+
+    // Disable copy and move constructors.
+    SharedGameStateWriter(const SharedGameStateWriter &) = delete;
+    SharedGameStateWriter(SharedGameStateWriter &&) = delete;
+    SharedGameStateWriter &operator=(const SharedGameStateWriter &) = delete;
+    SharedGameStateWriter &operator=(SharedGameStateWriter &&) = delete;
+
+    /**
+     * @brief Replaces the published table with the provided values.
+     *
+     * Values which do not fit in the table are not published, and are counted as dropped entries.
+     *
+     * @param values DCS IDs and their values, in any order.
+     * @param update_count Game state update count of the values.
+     */
+    void publish(std::vector<std::pair<int, std::string_view>> values, const unsigned update_count);
+
+  private:
+    HANDLE mapping_ = nullptr;                // Handle of the named shared memory.
+    SharedGameStateHeader *header_ = nullptr; // Header at the start of the shared memory.
+    SharedGameStateEntry *entries_ = nullptr; // Entries following the header.
+    char *heap_ = nullptr;                    // Heap of values following the entries.
+};
+
+/**
+ * @brief Read-only view of a game state published by a SharedGameStateWriter, for use by tools outside the plugin.
+ */
+class SharedGameStateReader {
+  public:
+    /**
+     * @brief Opens a published table of the game state.
+     *
+     * @param name Name of the shared memory, as provided to the writer.
+     * @throws std::runtime_error if no game state is published with the name.
+     */
+    SharedGameStateReader(const std::string &name);
+
+    ~SharedGameStateReader();
+
+    // Disable copy and move constructors.
+    SharedGameStateReader(const SharedGameStateReader &) = delete;
+    SharedGameStateReader(SharedGameStateReader &&) = delete;
+    SharedGameStateReader &operator=(const SharedGameStateReader &) = delete;
+    SharedGameStateReader &operator=(SharedGameStateReader &&) = delete;
+
+    /**
+     * @brief Reads the current value of a DCS ID.
+     *
+     * @param dcs_id DCS ID to read.
+     * @param value [out] Current value, only valid if true is returned.
+     * @return True if the DCS ID is published.
+     */
+    bool read_value(const int dcs_id, std::string &value) const;
+
+    /**
+     * @brief Reads a consistent snapshot of all published values.
+     *
+     * @param values [out] Values of all published DCS IDs.
+     * @return False if no consistent snapshot could be read, such as if the writer stopped while publishing.
+     */
+    bool read_all(std::map<int, std::string> &values) const;
+
+    /**
+     * @brief Gets the game state update count of the published values, which changes with every publish.
+     */
+    unsigned update_count() const;
+
+    /**
+     * @brief Gets the number of values left out of the last publish because the table was full.
+     */
+    unsigned dropped_entries() const;
+
+  private:
+    /**
+     * @brief Calls read until it completes without a concurrent publish.
+     *
+     * @return False if every attempt overlapped a publish.
+     */
+    template <typename Read> bool read_consistent(const Read &read) const;
+
+    HANDLE mapping_ = nullptr;                     // Handle of the named shared memory.
+    const SharedGameStateHeader *header_ = nullptr; // Header at the start of the shared memory.
+    const SharedGameStateEntry *entries_ = nullptr; // Entries following the header.
+    const char *heap_ = nullptr;                    // Heap of values following the entries.
+};
@@ -0,0 +1,132 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "SharedMemoryRing.h"
+
+#include <atomic>
+#include <cstring>
+#include <stdexcept>
+
+namespace {
+constexpr size_t kCacheLineSize = 64;
+constexpr size_t kRecordAlignment = 8;
+constexpr size_t kLengthSize = sizeof(uint32_t);
+
+size_t record_size(const size_t message_size) {
+    return (kLengthSize + message_size + kRecordAlignment - 1) / kRecordAlignment * kRecordAlignment;
+}
+} // namespace
+
+// Positions are only written by one end each and kept on separate cache lines so the ends do not contend.
+struct SharedMemoryRing::Header {
+    alignas(kCacheLineSize) std::atomic<uint64_t> write_position; // Written by the producer.
+    alignas(kCacheLineSize) std::atomic<uint64_t> read_position;  // Written by the consumer.
+    alignas(kCacheLineSize) std::atomic<uint32_t> consumer_waiting; // Set by the consumer while waiting on the event.
+};
+
+SharedMemoryRing::SharedMemoryRing(const std::string &name, const size_t capacity) : capacity_(capacity) {
+    if (capacity_ == 0 || capacity_ % kRecordAlignment != 0) {
+        throw std::runtime_error("Invalid shared memory ring capacity: " + std::to_string(capacity_));
+    }
+    const std::string mapping_name = "Local\\" + name;
+    const size_t mapping_size = sizeof(Header) + capacity_;
+    // Pagefile-backed mappings are zero-initialized on creation, which is an empty ring.
+    mapping_ = CreateFileMappingA(
+        INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(mapping_size), mapping_name.c_str());
+    void *view = (mapping_ != nullptr) ? MapViewOfFile(mapping_, FILE_MAP_ALL_ACCESS, 0, 0, mapping_size) : nullptr;
+    data_event_ = CreateEventA(nullptr, FALSE, FALSE, (mapping_name + ".data").c_str());
+    if (view == nullptr || data_event_ == nullptr) {
+        const std::string error_msg =
+            "Could not open shared memory ring " + name + " -- Error: " + std::to_string(GetLastError());
+        if (view != nullptr) {
+            UnmapViewOfFile(view);
+        }
+        if (mapping_ != nullptr) {
+            CloseHandle(mapping_);
+        }
+        if (data_event_ != nullptr) {
+            CloseHandle(data_event_);
+        }
+        throw std::runtime_error(error_msg);
+    }
+    header_ = static_cast<Header *>(view);
+    records_ = static_cast<uint8_t *>(view) + sizeof(Header);
+}
+
+SharedMemoryRing::~SharedMemoryRing() {
+    UnmapViewOfFile(header_);
+    CloseHandle(mapping_);
+    CloseHandle(data_event_);
+}
+
+bool SharedMemoryRing::push(const std::string_view message) {
+    const size_t size = record_size(message.size());
+    if (size > capacity_ / 2) {
+        return false;
+    }
+    uint64_t write_position = header_->write_position.load(std::memory_order_relaxed);
+    const uint64_t read_position = header_->read_position.load(std::memory_order_acquire);
+    size_t offset = static_cast<size_t>(write_position % capacity_);
+    // Records are contiguous, so a record which does not fit before the end of the ring starts at the beginning.
+    const size_t wrap_size = (capacity_ - offset < size) ? capacity_ - offset : 0;
+    if (write_position + wrap_size + size - read_position > capacity_) {
+        return false;
+    }
+    if (wrap_size != 0) {
+        const uint32_t wrap_record = kWrapRecord;
+        std::memcpy(records_ + offset, &wrap_record, kLengthSize);
+        write_position += wrap_size;
+        offset = 0;
+    }
+    const uint32_t length = static_cast<uint32_t>(message.size());
+    std::memcpy(records_ + offset, &length, kLengthSize);
+    std::memcpy(records_ + offset + kLengthSize, message.data(), message.size());
+    header_->write_position.store(write_position + size, std::memory_order_seq_cst);
+
+    // Paired with the consumer setting consumer_waiting before checking the write position, so either the consumer
+    // sees the record or the producer sees the consumer waiting.
+    if (header_->consumer_waiting.load(std::memory_order_seq_cst) != 0) {
+        SetEvent(data_event_);
+    }
+    return true;
+}
+
+bool SharedMemoryRing::pop(std::string &message, const DWORD timeout_ms) {
+    if (try_pop(message)) {
+        return true;
+    }
+    header_->consumer_waiting.store(1, std::memory_order_seq_cst);
+    bool popped = try_pop(message);
+    if (!popped && WaitForSingleObject(data_event_, timeout_ms) == WAIT_OBJECT_0) {
+        popped = try_pop(message);
+    }
+    header_->consumer_waiting.store(0, std::memory_order_relaxed);
+    return popped;
+}
+
+bool SharedMemoryRing::try_pop(std::string &message) {
+    uint64_t read_position = header_->read_position.load(std::memory_order_relaxed);
+    const uint64_t write_position = header_->write_position.load(std::memory_order_seq_cst);
+    if (read_position == write_position) {
+        return false;
+    }
+    size_t offset = static_cast<size_t>(read_position % capacity_);
+    uint32_t length;
+    std::memcpy(&length, records_ + offset, kLengthSize);
+    if (length == kWrapRecord) {
+        read_position += capacity_ - offset;
+        offset = 0;
+        std::memcpy(&length, records_, kLengthSize);
+    }
+    // The ring is written by another process, so a record which would extend past the end of the ring or the write
+    // position is corrupt. As following records cannot be located, the ring is reset to empty.
+    if (write_position - read_position > capacity_ || length > capacity_ - offset - kLengthSize ||
+        record_size(length) > write_position - read_position) {
+        header_->read_position.store(write_position, std::memory_order_release);
+        return false;
+    }
+    message.assign(reinterpret_cast<const char *>(records_ + offset + kLengthSize), length);
+    header_->read_position.store(read_position + record_size(length), std::memory_order_release);
+    return true;
+}
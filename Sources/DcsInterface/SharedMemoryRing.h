@@ -0,0 +1,75 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <Windows.h>
+
+/**
+ * @brief Single-producer single-consumer ring buffer of messages in named shared memory, for exchanging packets with
+ *        an exporter on the same host without the loopback UDP stack.
+ *
+ * The mapping "Local\<name>" starts with a header of the producer's write position and the consumer's read position
+ * (byte counts since creation, each on its own cache line), followed by the ring of records. Each record is a 4 byte
+ * length followed by the message, padded to 8 bytes, with a length of kWrapRecord marking that the next record starts
+ * at the beginning of the ring. The consumer waits on the auto-reset event "Local\<name>.data", which the producer
+ * only sets while the consumer is waiting on an empty ring.
+ *
+ * Either end may create the ring, and both must use the same capacity.
+ */
+class SharedMemoryRing {
+  public:
+    static constexpr size_t kDefaultCapacity = 1 << 20; // Bytes of records in the ring.
+    static constexpr uint32_t kWrapRecord = 0xFFFFFFFF; // Record length marking a wrap to the start of the ring.
+
+    /**
+     * @brief Creates or opens a named ring.
+     *
+     * @param name Name of the ring, shared by the producer and consumer.
+     * @param capacity Bytes of records in the ring, a multiple of 8.
+     * @throws std::runtime_error if the shared memory or event cannot be opened.
+     */
+    SharedMemoryRing(const std::string &name, const size_t capacity = kDefaultCapacity);
+
+    ~SharedMemoryRing();
+
+    // Disable copy and move constructors.
+    SharedMemoryRing(const SharedMemoryRing &) = delete;
+    SharedMemoryRing(SharedMemoryRing &&) = delete;
+    SharedMemoryRing &operator=(const SharedMemoryRing &) = delete;
+    SharedMemoryRing &operator=(SharedMemoryRing &&) = delete;
+
+    /**
+     * @brief Appends a message, without blocking, for use only by the producer.
+     *
+     * @param message Bytes of the message.
+     * @return False if the message was dropped because the ring is full or the message is too long.
+     */
+    bool push(const std::string_view message);
+
+    /**
+     * @brief Removes the oldest message, waiting for one if the ring is empty, for use only by the consumer.
+     *
+     * @param message [out] Removed message.
+     * @param timeout_ms Maximum time to wait for a message.
+     * @return False if no message was received before the timeout.
+     */
+    bool pop(std::string &message, const DWORD timeout_ms);
+
+  private:
+    struct Header;
+
+    /**
+     * @brief Removes the oldest message if the ring is not empty. A record whose length extends past the end of the
+     *        ring or the write position is corrupt, and resets the ring to empty.
+     */
+    bool try_pop(std::string &message);
+
+    HANDLE mapping_ = nullptr;    // Handle of the named shared memory.
+    HANDLE data_event_ = nullptr; // Event set by the producer to wake a waiting consumer.
+    Header *header_ = nullptr;    // Positions at the start of the shared memory.
+    uint8_t *records_ = nullptr;  // Ring of records following the header.
+    size_t capacity_;             // Bytes of records in the ring.
+};
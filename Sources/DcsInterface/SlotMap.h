@@ -0,0 +1,103 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+using SlotMapHandle = struct {
+    uint32_t index;      // Index of slot holding the value.
+    uint32_t generation; // Generation of the slot when the value was inserted.
+};
+
+inline bool operator==(const SlotMapHandle &lhs, const SlotMapHandle &rhs) {
+    return (lhs.index == rhs.index) && (lhs.generation == rhs.generation);
+}
+inline bool operator!=(const SlotMapHandle &lhs, const SlotMapHandle &rhs) { return !(lhs == rhs); }
+
+/**
+ * @brief Container which stores values in reusable slots referenced by generational handles.
+ *        A handle to an erased value is detected as stale (even if its slot has been reused) rather than
+ *        referring to the wrong value.
+ *
+ */
+template <typename T> class SlotMap {
+  public:
+    /**
+     * @brief Inserts a value into a free slot.
+     *
+     * @return Handle referring to the inserted value.
+     */
+    SlotMapHandle insert(T value) {
+        uint32_t index;
+        if (!free_slots_.empty()) {
+            index = free_slots_.back();
+            free_slots_.pop_back();
+        } else {
+            index = static_cast<uint32_t>(slots_.size());
+            slots_.push_back({std::nullopt, 0});
+        }
+        slots_[index].value.emplace(std::move(value));
+        ++size_;
+        return SlotMapHandle{index, slots_[index].generation};
+    }
+
+    /**
+     * @brief Erases the value referred to by a handle, invalidating the handle.
+     *
+     * @return True if a value was erased, false if the handle was stale.
+     */
+    bool erase(const SlotMapHandle handle) {
+        if (!contains(handle)) {
+            return false;
+        }
+        Slot &slot = slots_[handle.index];
+        slot.value.reset();
+        ++slot.generation;
+        free_slots_.push_back(handle.index);
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Returns true if the handle refers to a value in the container.
+     */
+    bool contains(const SlotMapHandle handle) const {
+        return (handle.index < slots_.size()) && (slots_[handle.index].generation == handle.generation) &&
+               slots_[handle.index].value.has_value();
+    }
+
+    /**
+     * @brief Get the value referred to by a handle.
+     *
+     * @return Pointer to value, or nullptr if the handle is stale.
+     */
+    T *get(const SlotMapHandle handle) { return contains(handle) ? &slots_[handle.index].value.value() : nullptr; }
+    const T *get(const SlotMapHandle handle) const {
+        return contains(handle) ? &slots_[handle.index].value.value() : nullptr;
+    }
+
+    /**
+     * @brief Calls func(handle, value) for each value in the container, in slot order.
+     */
+    template <typename Func> void for_each(Func &&func) {
+        for (uint32_t index = 0; index < slots_.size(); ++index) {
+            if (slots_[index].value) {
+                func(SlotMapHandle{index, slots_[index].generation}, slots_[index].value.value());
+            }
+        }
+    }
+
+    size_t size() const { return size_; }
+
+  private:
+    using Slot = struct {
+        std::optional<T> value;
+        uint32_t generation;
+    };
+
+    std::vector<Slot> slots_;
+    std::vector<uint32_t> free_slots_;
+    size_t size_ = 0;
+};
@@ -0,0 +1,313 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "StateExpression.h"
+#include "StringUtilities.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+// Multi-character symbols must precede their single-character prefixes.
+const char *kSymbols[] = {"&&", "||", "==", "!=", ">=", "<=", ">", "<", "!", "(", ")", "[", "]", ","};
+
+using Value = struct {
+    bool is_number;         // True if number is valid.
+    double number;          // Numeric value (1.0 or 0.0 for results of comparisons).
+    const std::string *str; // String value if the operand has one, nullptr otherwise.
+};
+
+inline bool is_truthy(const Value &value) { return value.is_number && value.number != 0.0; }
+inline Value bool_value(const bool result) { return Value{true, result ? 1.0 : 0.0, nullptr}; }
+} // namespace
+
+StateExpression::StateExpression(const std::string &expression) {
+    tokenize(expression);
+    parse_or();
+    if (peek().type != Token::END) {
+        throw_parse_error("unexpected '" + peek().text + "'");
+    }
+
+    std::sort(input_dcs_ids_.begin(), input_dcs_ids_.end());
+    input_dcs_ids_.erase(std::unique(input_dcs_ids_.begin(), input_dcs_ids_.end()), input_dcs_ids_.end());
+    bytecode_.shrink_to_fit();
+    tokens_.clear();
+    tokens_.shrink_to_fit();
+}
+
+bool StateExpression::evaluate(const DcsInterface *dcs_interface) const {
+    Value stack[kMaxStackDepth];
+    size_t top = 0;
+    for (const Instruction &instruction : bytecode_) {
+        switch (instruction.op) {
+        case PUSH_DCS_ID: {
+            const DcsIdValue *dcs_id_value = dcs_interface->get_typed_value_of_dcs_id(instruction.arg);
+            if (dcs_id_value != nullptr) {
+                stack[top++] = Value{dcs_id_value->is_number, dcs_id_value->number, &dcs_id_value->str};
+            } else {
+                stack[top++] = Value{false, 0.0, nullptr};
+            }
+            break;
+        }
+        case PUSH_NUMBER:
+            stack[top++] = Value{true, instruction.number, nullptr};
+            break;
+        case PUSH_STRING:
+            stack[top++] = Value{false, 0.0, &string_literals_[instruction.arg]};
+            break;
+        case IN_RANGE: {
+            const Value &value = stack[top - 3];
+            const bool in_range = value.is_number && (value.number >= stack[top - 2].number) &&
+                                  (value.number <= stack[top - 1].number);
+            top -= 2;
+            stack[top - 1] = bool_value(in_range);
+            break;
+        }
+        case LOGICAL_NOT:
+            stack[top - 1] = bool_value(!is_truthy(stack[top - 1]));
+            break;
+        case LOGICAL_AND:
+            --top;
+            stack[top - 1] = bool_value(is_truthy(stack[top - 1]) && is_truthy(stack[top]));
+            break;
+        case LOGICAL_OR:
+            --top;
+            stack[top - 1] = bool_value(is_truthy(stack[top - 1]) || is_truthy(stack[top]));
+            break;
+        default: {
+            // Binary comparisons.
+            --top;
+            const Value &lhs = stack[top - 1];
+            const Value &rhs = stack[top];
+            bool result = false;
+            if (lhs.is_number && rhs.is_number) {
+                switch (instruction.op) {
+                case GREATER_THAN:
+                    result = lhs.number > rhs.number;
+                    break;
+                case GREATER_EQUAL:
+                    result = lhs.number >= rhs.number;
+                    break;
+                case LESS_THAN:
+                    result = lhs.number < rhs.number;
+                    break;
+                case LESS_EQUAL:
+                    result = lhs.number <= rhs.number;
+                    break;
+                case EQUAL_TO:
+                    result = lhs.number == rhs.number;
+                    break;
+                case NOT_EQUAL_TO:
+                    result = lhs.number != rhs.number;
+                    break;
+                default:
+                    break;
+                }
+            } else if (lhs.str != nullptr && rhs.str != nullptr) {
+                // String comparison when either operand is not numeric.
+                if (instruction.op == EQUAL_TO) {
+                    result = (*lhs.str == *rhs.str);
+                } else if (instruction.op == NOT_EQUAL_TO) {
+                    result = (*lhs.str != *rhs.str);
+                }
+            }
+            stack[top - 1] = bool_value(result);
+            break;
+        }
+        }
+    }
+    return (top > 0) && is_truthy(stack[top - 1]);
+}
+
+void StateExpression::tokenize(const std::string &expression) {
+    size_t pos = 0;
+    while (pos < expression.size()) {
+        const char c = expression[pos];
+        if (std::isspace(static_cast<unsigned char>(c))) {
+            ++pos;
+        } else if (std::isdigit(static_cast<unsigned char>(c)) || c == '.' ||
+                   (c == '-' && pos + 1 < expression.size() &&
+                    (std::isdigit(static_cast<unsigned char>(expression[pos + 1])) || expression[pos + 1] == '.'))) {
+            const size_t start = pos++;
+            while (pos < expression.size() &&
+                   (std::isdigit(static_cast<unsigned char>(expression[pos])) || expression[pos] == '.')) {
+                ++pos;
+            }
+            tokens_.push_back({Token::NUMBER, expression.substr(start, pos - start), start});
+        } else if (std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+            const size_t start = pos++;
+            while (pos < expression.size() &&
+                   (std::isalnum(static_cast<unsigned char>(expression[pos])) || expression[pos] == '_')) {
+                ++pos;
+            }
+            tokens_.push_back({Token::WORD, expression.substr(start, pos - start), start});
+        } else if (c == '"') {
+            const size_t end = expression.find('"', pos + 1);
+            if (end == std::string::npos) {
+                throw std::runtime_error("Unterminated string in expression at position " + std::to_string(pos));
+            }
+            tokens_.push_back({Token::STRING, expression.substr(pos + 1, end - pos - 1), pos});
+            pos = end + 1;
+        } else {
+            bool found_symbol = false;
+            for (const std::string symbol : kSymbols) {
+                if (expression.compare(pos, symbol.size(), symbol) == 0) {
+                    tokens_.push_back({Token::SYMBOL, symbol, pos});
+                    pos += symbol.size();
+                    found_symbol = true;
+                    break;
+                }
+            }
+            if (!found_symbol) {
+                throw std::runtime_error("Unexpected character '" + std::string(1, c) +
+                                         "' in expression at position " + std::to_string(pos));
+            }
+        }
+    }
+    tokens_.push_back({Token::END, "end of expression", expression.size()});
+}
+
+bool StateExpression::accept(const std::string &symbol) {
+    const Token &token = peek();
+    if ((token.type == Token::SYMBOL || token.type == Token::WORD) && token.text == symbol) {
+        ++token_idx_;
+        return true;
+    }
+    return false;
+}
+
+void StateExpression::expect(const std::string &symbol) {
+    if (!accept(symbol)) {
+        throw_parse_error("expected '" + symbol + "' but found '" + peek().text + "'");
+    }
+}
+
+void StateExpression::parse_or() {
+    parse_and();
+    while (accept("||")) {
+        parse_and();
+        bytecode_.push_back({LOGICAL_OR, 0, 0.0});
+        --stack_depth_;
+    }
+}
+
+void StateExpression::parse_and() {
+    parse_not();
+    while (accept("&&")) {
+        parse_not();
+        bytecode_.push_back({LOGICAL_AND, 0, 0.0});
+        --stack_depth_;
+    }
+}
+
+void StateExpression::parse_not() {
+    if (accept("!")) {
+        if (++nesting_depth_ > kMaxNestingDepth) {
+            throw_parse_error("expression is too deeply nested");
+        }
+        parse_not();
+        --nesting_depth_;
+        bytecode_.push_back({LOGICAL_NOT, 0, 0.0});
+    } else {
+        parse_primary();
+    }
+}
+
+void StateExpression::parse_primary() {
+    if (accept("(")) {
+        if (++nesting_depth_ > kMaxNestingDepth) {
+            throw_parse_error("expression is too deeply nested");
+        }
+        parse_or();
+        --nesting_depth_;
+        expect(")");
+        return;
+    }
+
+    if (!parse_operand()) {
+        throw_parse_error("expected operand but found '" + peek().text + "'");
+    }
+
+    const std::pair<const char *, OpCode> comparisons[] = {{">", GREATER_THAN},
+                                                           {">=", GREATER_EQUAL},
+                                                           {"<", LESS_THAN},
+                                                           {"<=", LESS_EQUAL},
+                                                           {"==", EQUAL_TO},
+                                                           {"!=", NOT_EQUAL_TO}};
+    for (const auto &[symbol, op] : comparisons) {
+        if (accept(symbol)) {
+            if (!parse_operand()) {
+                throw_parse_error("expected operand after '" + std::string(symbol) + "' but found '" + peek().text +
+                                  "'");
+            }
+            bytecode_.push_back({op, 0, 0.0});
+            --stack_depth_;
+            return;
+        }
+    }
+
+    if (accept("in")) {
+        // Range is emitted as [value, min, max] followed by IN_RANGE.
+        expect("[");
+        for (const char *delimiter : {",", "]"}) {
+            if (peek().type != Token::NUMBER) {
+                throw_parse_error("expected number in range but found '" + peek().text + "'");
+            }
+            parse_operand();
+            expect(delimiter);
+        }
+        bytecode_.push_back({IN_RANGE, 0, 0.0});
+        stack_depth_ -= 2;
+    }
+}
+
+bool StateExpression::parse_operand() {
+    const Token &token = peek();
+    Instruction instruction = {PUSH_NUMBER, 0, 0.0};
+    if (token.type == Token::NUMBER) {
+        if (!is_number(token.text)) {
+            throw_parse_error("invalid number '" + token.text + "'");
+        }
+        instruction.number = std::strtod(token.text.c_str(), nullptr);
+        ++token_idx_;
+    } else if (token.type == Token::STRING) {
+        instruction.op = PUSH_STRING;
+        instruction.arg = static_cast<int>(string_literals_.size());
+        string_literals_.push_back(token.text);
+        ++token_idx_;
+    } else if (token.type == Token::WORD && (token.text == "true" || token.text == "false")) {
+        instruction.number = (token.text == "true") ? 1.0 : 0.0;
+        ++token_idx_;
+    } else if (token.type == Token::WORD && token.text == "id") {
+        ++token_idx_;
+        if (!is_integer(peek().text)) {
+            throw_parse_error("expected DCS ID number after 'id' but found '" + peek().text + "'");
+        }
+        errno = 0;
+        const long dcs_id = std::strtol(peek().text.c_str(), nullptr, 10);
+        if (errno == ERANGE || dcs_id < std::numeric_limits<int>::min() || dcs_id > std::numeric_limits<int>::max()) {
+            throw_parse_error("DCS ID '" + peek().text + "' is out of range");
+        }
+        instruction.op = PUSH_DCS_ID;
+        instruction.arg = static_cast<int>(dcs_id);
+        input_dcs_ids_.push_back(instruction.arg);
+        ++token_idx_;
+    } else {
+        return false;
+    }
+
+    if (++stack_depth_ > kMaxStackDepth) {
+        throw_parse_error("expression is too deeply nested");
+    }
+    bytecode_.push_back(instruction);
+    return true;
+}
+
+void StateExpression::throw_parse_error(const std::string &message) const {
+    throw std::runtime_error("Expression error at position " + std::to_string(peek().position) + ": " + message);
+}
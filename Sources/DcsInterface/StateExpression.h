@@ -0,0 +1,96 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include "DcsInterface.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Boolean expression over DCS ID values, compiled once from text into a compact postfix bytecode.
+ *
+ *  Supported syntax (example: "id 404 > 0.5 && (id 372 == 1 || id 2026 == \"ON\")"):
+ *    Operands:    id <integer>, <number>, "<string>", true, false
+ *    Comparisons: >  >=  <  <=  ==  !=   and ranges as "id 404 in [0.2, 0.8]" (inclusive)
+ *    Logic:       &&  ||  !  and parentheses
+ *  A DCS ID used without a comparison is true if its value is a non-zero number.
+ *  Comparisons against DCS IDs that have no value (or a non-numeric value for numeric comparisons) are false.
+ */
+class StateExpression {
+  public:
+    /**
+     * @brief Construct a new State Expression object by compiling the provided expression text.
+     *
+     * @param expression Expression text.
+     * @throws std::runtime_error if the expression text is not valid.
+     */
+    StateExpression(const std::string &expression);
+
+    /**
+     * @brief Evaluates the expression against the current game state.
+     *
+     * @param dcs_interface Interface to DCS containing current game state.
+     * @return True if expression is satisfied.
+     */
+    bool evaluate(const DcsInterface *dcs_interface) const;
+
+    /**
+     * @brief Returns the DCS IDs which are read by the expression (sorted, without duplicates).
+     */
+    const std::vector<int> &input_dcs_ids() const { return input_dcs_ids_; }
+
+    static constexpr size_t kMaxStackDepth = 32;   // Maximum evaluation stack depth of an expression.
+    static constexpr size_t kMaxNestingDepth = 64; // Maximum nesting of parentheses and '!' bounding parser recursion.
+
+  private:
+    using OpCode = enum {
+        PUSH_DCS_ID,
+        PUSH_NUMBER,
+        PUSH_STRING,
+        GREATER_THAN,
+        GREATER_EQUAL,
+        LESS_THAN,
+        LESS_EQUAL,
+        EQUAL_TO,
+        NOT_EQUAL_TO,
+        IN_RANGE,
+        LOGICAL_AND,
+        LOGICAL_OR,
+        LOGICAL_NOT
+    };
+
+    using Instruction = struct {
+        OpCode op;
+        int arg;       // DCS ID for PUSH_DCS_ID, index into string_literals_ for PUSH_STRING.
+        double number; // Literal value for PUSH_NUMBER.
+    };
+
+    using Token = struct {
+        enum { END, NUMBER, STRING, WORD, SYMBOL } type;
+        std::string text;
+        size_t position;
+    };
+
+    // Recursive descent parser, emitting instructions in postfix order.
+    void tokenize(const std::string &expression);
+    const Token &peek() const { return tokens_[token_idx_]; }
+    bool accept(const std::string &symbol);
+    void expect(const std::string &symbol);
+    void parse_or();
+    void parse_and();
+    void parse_not();
+    void parse_primary();
+    bool parse_operand();
+    [[noreturn]] void throw_parse_error(const std::string &message) const;
+
+    std::vector<Instruction> bytecode_;        // Compiled expression in postfix order.
+    std::vector<std::string> string_literals_; // String literals referenced by PUSH_STRING instructions.
+    std::vector<int> input_dcs_ids_;           // DCS IDs read by the expression.
+
+    // Parser state, only used during construction.
+    std::vector<Token> tokens_;
+    size_t token_idx_ = 0;
+    size_t stack_depth_ = 0;
+    size_t nesting_depth_ = 0;
+};
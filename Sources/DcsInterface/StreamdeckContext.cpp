@@ -6,57 +6,93 @@
 
 #include "../Common/EPLJSONUtils.h"
 
-StreamdeckContext::StreamdeckContext(const std::string &context) { context_ = context; }
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+/**
+ * @brief Parses a monitored DCS ID setting, which is either a DCS ID or a DCS-BIOS output as "address/mask/shift"
+ *        converted to the DCS ID representing it.
+ *
+ * @return False if the setting is neither.
+ */
+bool parse_monitored_dcs_id(const std::string &setting, int &dcs_id) {
+    DcsBiosOutput output;
+    if (is_integer(setting)) {
+        dcs_id = std::stoi(setting);
+    } else if (parse_dcs_bios_output(setting, output)) {
+        dcs_id = dcs_bios_output_to_dcs_id(output);
+    } else {
+        return false;
+    }
+    return true;
+}
+} // namespace
+
+StreamdeckContext::StreamdeckContext(const std::string &context) { cold_->context = context; }
 
 StreamdeckContext::StreamdeckContext(const std::string &context, const json &settings) {
-    context_ = context;
+    cold_->context = context;
     updateContextSettings(settings);
 }
 
-void StreamdeckContext::updateContextState(DcsInterface *dcs_interface, ESDConnectionManager *mConnectionManager) {
+void StreamdeckContext::updateContextState(DcsInterface *dcs_interface,
+                                           ESDConnectionManager *mConnectionManager,
+                                           const CompareMonitorTable *compare_monitors) {
     // Initialize to default values.
-    ContextState updated_state = FIRST;
-    std::string updated_title = "";
+    int updated_state = FIRST;
 
     if (increment_monitor_is_set_) {
         const std::string current_game_value_raw = dcs_interface->get_value_of_dcs_id(dcs_id_increment_monitor_);
         if (is_number(current_game_value_raw)) {
-            current_increment_value_ = Decimal(current_game_value_raw);
+            cold_->current_increment_value = Decimal(current_game_value_raw);
         }
     }
 
-    if (compare_monitor_is_set_) {
-        const std::string current_game_value_raw = dcs_interface->get_value_of_dcs_id(dcs_id_compare_monitor_);
-        if (is_number(current_game_value_raw)) {
-            updated_state = determineStateForCompareMonitor(Decimal(current_game_value_raw));
-        }
-    }
-    if (string_monitor_is_set_) {
-        const std::string current_game_string_value = dcs_interface->get_value_of_dcs_id(dcs_id_string_monitor_);
-        if (!current_game_string_value.empty()) {
-            updated_title = determineTitleForStringMonitor(current_game_string_value);
+    if (state_expressions_is_set_) {
+        updated_state = determineStateForStateExpressions(dcs_interface);
+    } else if (compare_monitor_is_set_) {
+        if (compare_monitors != nullptr && compare_monitor_row_) {
+            updated_state = compare_monitors->state(compare_monitor_row_.value());
+        } else {
+            const DcsIdValue *current_game_value = dcs_interface->get_typed_value_of_dcs_id(dcs_id_compare_monitor_);
+            if (current_game_value != nullptr && current_game_value->is_number) {
+                updated_state = determineStateForCompareMonitor(current_game_value->number);
+            }
         }
     }
 
     if (updated_state != current_state_) {
         current_state_ = updated_state;
-        mConnectionManager->SetState(static_cast<int>(current_state_), context_);
+        mConnectionManager->SetState(current_state_, cold_->context);
     }
-    if (updated_title != current_title_) {
-        current_title_ = updated_title;
-        mConnectionManager->SetTitle(current_title_, context_, kESDSDKTarget_HardwareAndSoftware);
+
+    // Contexts without a string monitor only need their title cleared once, if it was set.
+    if (string_monitor_is_set_ || title_is_set_) {
+        std::string updated_title = "";
+        if (string_monitor_is_set_) {
+            const std::string current_game_string_value = dcs_interface->get_value_of_dcs_id(dcs_id_string_monitor_);
+            if (!current_game_string_value.empty()) {
+                updated_title = determineTitleForStringMonitor(current_game_string_value);
+            }
+        }
+        if (updated_title != cold_->current_title) {
+            cold_->current_title = updated_title;
+            title_is_set_ = !updated_title.empty();
+            mConnectionManager->SetTitle(cold_->current_title, cold_->context, kESDSDKTarget_HardwareAndSoftware);
+        }
     }
 
     if (delay_for_force_send_state_) {
         if (delay_for_force_send_state_.value()-- <= 0) {
-            mConnectionManager->SetState(static_cast<int>(current_state_), context_);
+            mConnectionManager->SetState(current_state_, cold_->context);
             delay_for_force_send_state_.reset();
         }
     }
 }
 
 void StreamdeckContext::forceSendState(ESDConnectionManager *mConnectionManager) {
-    mConnectionManager->SetState(static_cast<int>(current_state_), context_);
+    mConnectionManager->SetState(current_state_, cold_->context);
 }
 
 void StreamdeckContext::forceSendStateAfterDelay(const int delay_count) {
@@ -75,25 +111,24 @@ void StreamdeckContext::updateContextSettings(const json &settings) {
     // Set boolean from checkbox using default false value if it doesn't exist in "settings".
     const std::string string_monitor_vertical_spacing_raw =
         EPLJSONUtils::GetStringByName(settings, "string_monitor_vertical_spacing");
-    string_monitor_passthrough_ = EPLJSONUtils::GetBoolByName(settings, "string_monitor_passthrough_check", true);
+    cold_->string_monitor_passthrough = EPLJSONUtils::GetBoolByName(settings, "string_monitor_passthrough_check", true);
     std::stringstream string_monitor_mapping_raw;
     string_monitor_mapping_raw << EPLJSONUtils::GetStringByName(settings, "string_monitor_mapping");
+    std::stringstream state_expressions_raw;
+    state_expressions_raw << EPLJSONUtils::GetStringByName(settings, "dcs_id_state_expressions");
 
     // Process status of settings.
-    increment_monitor_is_set_ = is_integer(dcs_id_increment_monitor_raw);
-    const bool compare_monitor_is_populated = is_integer(dcs_id_compare_monitor_raw);
+    // Monitored DCS IDs are parsed directly into the internal settings, which are only used while set.
+    increment_monitor_is_set_ = parse_monitored_dcs_id(dcs_id_increment_monitor_raw, dcs_id_increment_monitor_);
+    const bool compare_monitor_is_populated =
+        parse_monitored_dcs_id(dcs_id_compare_monitor_raw, dcs_id_compare_monitor_);
     const bool comparison_value_is_populated = is_number(dcs_id_comparison_value_raw);
     compare_monitor_is_set_ = compare_monitor_is_populated && comparison_value_is_populated;
-    string_monitor_is_set_ = is_integer(dcs_id_string_monitor_raw);
+    string_monitor_is_set_ = parse_monitored_dcs_id(dcs_id_string_monitor_raw, dcs_id_string_monitor_);
 
     // Update internal settings of class instance.
-    if (increment_monitor_is_set_) {
-        dcs_id_increment_monitor_ = std::stoi(dcs_id_increment_monitor_raw);
-    }
-
     if (compare_monitor_is_set_) {
-        dcs_id_compare_monitor_ = std::stoi(dcs_id_compare_monitor_raw);
-        dcs_id_comparison_value_ = Decimal(dcs_id_comparison_value_raw);
+        dcs_id_comparison_value_ = std::strtod(dcs_id_comparison_value_raw.c_str(), nullptr);
         if (dcs_id_compare_condition_raw == "EQUAL_TO") {
             dcs_id_compare_condition_ = EQUAL_TO;
         } else if (dcs_id_compare_condition_raw == "LESS_THAN") {
@@ -104,16 +139,42 @@ void StreamdeckContext::updateContextSettings(const json &settings) {
         }
     }
 
+    // Each line of the state expressions is an alternative condition for the second state, with blank lines skipped.
+    // Actions have at most two states in the manifest, so an expression can not select a further state. Any invalid
+    // expression disables the state expressions.
+    std::vector<StateExpression> &state_expressions = cold_->state_expressions;
+    std::vector<int> &state_expressions_dcs_ids = cold_->state_expressions_dcs_ids;
+    state_expressions.clear();
+    state_expressions_dcs_ids.clear();
+    cold_->state_expressions_update_count.reset();
+    state_expressions_is_set_ = false;
+    std::string state_expression_line;
+    try {
+        while (std::getline(state_expressions_raw, state_expression_line)) {
+            if (state_expression_line.find_first_not_of(" \t\r") != std::string::npos) {
+                state_expressions.emplace_back(state_expression_line);
+                const std::vector<int> &dcs_ids = state_expressions.back().input_dcs_ids();
+                state_expressions_dcs_ids.insert(state_expressions_dcs_ids.end(), dcs_ids.begin(), dcs_ids.end());
+            }
+        }
+        state_expressions_is_set_ = !state_expressions.empty();
+    } catch (const std::runtime_error &) {
+        state_expressions.clear();
+        state_expressions_dcs_ids.clear();
+    }
+    std::sort(state_expressions_dcs_ids.begin(), state_expressions_dcs_ids.end());
+    state_expressions_dcs_ids.erase(std::unique(state_expressions_dcs_ids.begin(), state_expressions_dcs_ids.end()),
+                                    state_expressions_dcs_ids.end());
+
     if (string_monitor_is_set_) {
-        dcs_id_string_monitor_ = std::stoi(dcs_id_string_monitor_raw);
         if (is_integer(string_monitor_vertical_spacing_raw)) {
-            string_monitor_vertical_spacing_ = std::stoi(string_monitor_vertical_spacing_raw);
+            cold_->string_monitor_vertical_spacing = std::stoi(string_monitor_vertical_spacing_raw);
         }
-        if (!string_monitor_passthrough_) {
-            string_monitor_mapping_.clear();
+        if (!cold_->string_monitor_passthrough) {
+            cold_->string_monitor_mapping.clear();
             std::pair<std::string, std::string> key_and_value;
             while (pop_key_and_value(string_monitor_mapping_raw, ',', '=', key_and_value)) {
-                string_monitor_mapping_[key_and_value.first] = key_and_value.second;
+                cold_->string_monitor_mapping[key_and_value.first] = key_and_value.second;
             }
         }
     }
@@ -127,11 +188,13 @@ void StreamdeckContext::handleButtonEvent(DcsInterface *dcs_interface,
     const std::string device_id = EPLJSONUtils::GetStringByName(inPayload["settings"], "device_id");
 
     // Set boolean from checkbox using default false value if it doesn't exist in "settings".
-    cycle_increments_is_allowed_ =
+    cold_->cycle_increments_is_allowed =
         EPLJSONUtils::GetBoolByName(inPayload["settings"], "increment_cycle_allowed_check", false);
 
     if (is_integer(button_id) && is_integer(device_id)) {
         bool send_command = false;
+        // Switch and increment values are positions, so a value still queued to DCS is superseded by a newer one.
+        bool is_absolute_value = true;
         std::string value = "";
         if (action.find("switch") != std::string::npos) {
             const ContextState state = EPLJSONUtils::GetIntByName(inPayload, "state") == 0 ? FIRST : SECOND;
@@ -140,45 +203,81 @@ void StreamdeckContext::handleButtonEvent(DcsInterface *dcs_interface,
             send_command = determineSendValueForIncrement(event, inPayload["settings"], value);
         } else {
             send_command = determineSendValueForMomentary(event, inPayload["settings"], value);
+            is_absolute_value = false;
         }
 
         if (send_command) {
-            dcs_interface->send_dcs_command(std::stoi(button_id), device_id, value);
+            dcs_interface->send_dcs_command(
+                std::stoi(button_id), device_id, value, COMMAND_LANE_USER_INPUT, is_absolute_value);
         }
     }
 }
 
-StreamdeckContext::ContextState StreamdeckContext::determineStateForCompareMonitor(const Decimal &current_game_value) {
-    bool set_context_state_to_second = false;
-    switch (dcs_id_compare_condition_) {
-    case EQUAL_TO:
-        set_context_state_to_second = (current_game_value == dcs_id_comparison_value_);
-        break;
-    case LESS_THAN:
-        set_context_state_to_second = (current_game_value < dcs_id_comparison_value_);
-        break;
-    case GREATER_THAN:
-        set_context_state_to_second = (current_game_value > dcs_id_comparison_value_);
-        break;
+std::optional<CompareMonitor> StreamdeckContext::getCompareMonitor() const {
+    if (compare_monitor_is_set_ && !state_expressions_is_set_) {
+        return CompareMonitor{dcs_id_compare_monitor_, dcs_id_compare_condition_, dcs_id_comparison_value_};
     }
+    return std::nullopt;
+}
 
+void StreamdeckContext::appendMonitoredDcsIds(std::vector<int> &dcs_ids) const {
+    if (increment_monitor_is_set_) {
+        dcs_ids.push_back(dcs_id_increment_monitor_);
+    }
+    if (state_expressions_is_set_) {
+        dcs_ids.insert(dcs_ids.end(), cold_->state_expressions_dcs_ids.begin(), cold_->state_expressions_dcs_ids.end());
+    } else if (compare_monitor_is_set_) {
+        dcs_ids.push_back(dcs_id_compare_monitor_);
+    }
+    if (string_monitor_is_set_) {
+        dcs_ids.push_back(dcs_id_string_monitor_);
+    }
+}
+
+StreamdeckContext::ContextState StreamdeckContext::determineStateForCompareMonitor(const double current_game_value) {
+    const bool set_context_state_to_second =
+        CompareMonitorTable::compare(current_game_value, dcs_id_compare_condition_, dcs_id_comparison_value_);
     return set_context_state_to_second ? SECOND : FIRST;
 }
 
+StreamdeckContext::ContextState StreamdeckContext::determineStateForStateExpressions(DcsInterface *dcs_interface) {
+    ColdData &cold = *cold_;
+    unsigned latest_update_count = 0;
+    for (const int dcs_id : cold.state_expressions_dcs_ids) {
+        latest_update_count = (std::max)(latest_update_count, dcs_interface->get_update_count_of_dcs_id(dcs_id));
+    }
+
+    // Update counts restart when DcsInterface is replaced, so any change of instance or count is a change of inputs.
+    if (!cold.state_expressions_update_count || latest_update_count != cold.state_expressions_update_count.value() ||
+        dcs_interface->get_instance_id() != cold.state_expressions_instance_id) {
+        cold.state_expressions_state = FIRST;
+        for (const StateExpression &expression : cold.state_expressions) {
+            if (expression.evaluate(dcs_interface)) {
+                cold.state_expressions_state = SECOND;
+                break;
+            }
+        }
+        cold.state_expressions_update_count = latest_update_count;
+        cold.state_expressions_instance_id = dcs_interface->get_instance_id();
+    }
+    return cold.state_expressions_state;
+}
+
 std::string StreamdeckContext::determineTitleForStringMonitor(const std::string &current_game_string_value) {
     std::string title;
-    if (string_monitor_passthrough_) {
+    if (cold_->string_monitor_passthrough) {
         title = current_game_string_value;
     } else {
-        title = string_monitor_mapping_[current_game_string_value];
+        title = cold_->string_monitor_mapping[current_game_string_value];
     }
     // Apply vertical spacing.
-    if (string_monitor_vertical_spacing_ < 0) {
-        for (int i = 0; i > string_monitor_vertical_spacing_; --i) {
+    const int vertical_spacing = cold_->string_monitor_vertical_spacing;
+    if (vertical_spacing < 0) {
+        for (int i = 0; i > vertical_spacing; --i) {
             title = "\n" + title;
         }
     } else {
-        for (int i = 0; i < string_monitor_vertical_spacing_; ++i) {
+        for (int i = 0; i < vertical_spacing; ++i) {
             title = title + "\n";
         }
     }
@@ -226,14 +325,14 @@ bool StreamdeckContext::determineSendValueForIncrement(const KeyEvent event, con
             Decimal increment_min(increment_min_str);
             Decimal increment_max(increment_max_str);
 
-            current_increment_value_ += Decimal(increment_value_str);
+            cold_->current_increment_value += Decimal(increment_value_str);
 
-            if (current_increment_value_ < increment_min) {
-                current_increment_value_ = cycle_increments_is_allowed_ ? increment_max : increment_min;
-            } else if (current_increment_value_ > increment_max) {
-                current_increment_value_ = cycle_increments_is_allowed_ ? increment_min : increment_max;
+            if (cold_->current_increment_value < increment_min) {
+                cold_->current_increment_value = cold_->cycle_increments_is_allowed ? increment_max : increment_min;
+            } else if (cold_->current_increment_value > increment_max) {
+                cold_->current_increment_value = cold_->cycle_increments_is_allowed ? increment_min : increment_max;
             }
-            value = current_increment_value_.str();
+            value = cold_->current_increment_value.str();
             return true;
         }
     }
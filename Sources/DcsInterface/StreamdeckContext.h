@@ -2,16 +2,22 @@
 
 #pragma once
 
+#include "CompareMonitorTable.h"
 #include "DcsInterface.h"
 #include "Decimal.h"
+#include "StateExpression.h"
 #include "StringUtilities.h"
 
 #ifndef UNIT_TEST
 #include "../Common/ESDConnectionManager.h"
 #endif
 
+#include <map>
+#include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 using KeyEvent = enum { KEY_DOWN, KEY_UP };
 
@@ -26,8 +32,12 @@ class StreamdeckContext {
      *
      * @param dcs_interface Interface to DCS containing current game state.
      * @param mConnectionManager Interface to StreamDeck.
+     * @param compare_monitors Table holding the already evaluated compare monitor of this context (in the row set by
+     *                         setCompareMonitorRow), or nullptr to evaluate the compare monitor within the context.
      */
-    void updateContextState(DcsInterface *dcs_interface, ESDConnectionManager *mConnectionManager);
+    void updateContextState(DcsInterface *dcs_interface,
+                            ESDConnectionManager *mConnectionManager,
+                            const CompareMonitorTable *compare_monitors = nullptr);
 
     /**
      * @brief Forces an update to the Streamdeck of the context's current state be sent with current static values.
@@ -52,6 +62,27 @@ class StreamdeckContext {
      */
     void updateContextSettings(const json &settings);
 
+    /**
+     * @brief Get the compare monitor to be evaluated for this context.
+     *
+     * @return Compare monitor, or nullopt if the context state is not set by a compare monitor.
+     */
+    std::optional<CompareMonitor> getCompareMonitor() const;
+
+    /**
+     * @brief Appends the DCS IDs read by the context's monitors and state expressions, so updates of only the DCS IDs
+     *        referenced by contexts need to be received.
+     *
+     * @param dcs_ids Vector to append DCS IDs to, which may then contain duplicates.
+     */
+    void appendMonitoredDcsIds(std::vector<int> &dcs_ids) const;
+
+    /**
+     * @brief Sets/gets the row of a CompareMonitorTable that holds this context's compare monitor.
+     */
+    void setCompareMonitorRow(const size_t row) { compare_monitor_row_ = row; }
+    std::optional<size_t> getCompareMonitorRow() const { return compare_monitor_row_; }
+
     /**
      * @brief Sends DCS commands according to button type and settings received during Key Down/Up event.
      *
@@ -66,7 +97,6 @@ class StreamdeckContext {
                            const json &inPayload);
 
   private:
-    using CompareConditionType = enum { GREATER_THAN, EQUAL_TO, LESS_THAN };
     using ContextState = enum { FIRST = 0, SECOND };
 
     /**
@@ -76,7 +106,17 @@ class StreamdeckContext {
      * @param current_game_value Value receieved from DCS.
      * @return ContextState      State the Streamdeck context should be set to.
      */
-    ContextState determineStateForCompareMonitor(const Decimal &current_game_value);
+    ContextState determineStateForCompareMonitor(const double current_game_value);
+
+    /**
+     * @brief Determines what the context state should be according to the state expressions, re-evaluating the
+     * expressions only if one of their input DCS IDs has changed since the last evaluation.
+     *
+     * @param dcs_interface Interface to DCS containing current game state.
+     * @return ContextState State the Streamdeck context should be set to, the second state if any expression is
+     *                      satisfied.
+     */
+    ContextState determineStateForStateExpressions(DcsInterface *dcs_interface);
 
     /**
      * @brief Determines what the context title should be according to current game value and string monitor settings.
@@ -102,32 +142,47 @@ class StreamdeckContext {
                                      std::string &value);
     bool determineSendValueForIncrement(const KeyEvent event, const json &settings, std::string &value);
 
-    std::string context_; // Unique context ID used by Streamdeck to refer to instances of buttons.
+
+    // Settings and state only read for titles, state expressions, increments and messages to the Streamdeck, held out
+    // of line so each update sweep reads only the compact data needed to evaluate most contexts.
+    struct ColdData {
+        std::string context;                      // Unique context ID used by Streamdeck to refer to buttons.
+        std::string current_title = "";           // Stored title of the context.
+        Decimal current_increment_value;          // Stored value for increment button types.
+        bool cycle_increments_is_allowed = false; // Flag set by user settings for increment button types.
+        bool disable_release_value = false;       // Flag set by user settings for momentary button types.
+        int string_monitor_vertical_spacing = 0;  // Vertical spacing (number of '\n') to include before or after title.
+        bool string_monitor_passthrough = true;   // Flag set by user to passthrough string to title unaltered.
+        std::map<std::string, std::string>
+            string_monitor_mapping; // Map of received values to title text to display on context.
+        std::vector<StateExpression> state_expressions;         // Alternative conditions for the second state.
+        std::vector<int> state_expressions_dcs_ids;             // DCS IDs read by any of the state expressions.
+        std::optional<unsigned> state_expressions_update_count; // Game state update count at last evaluation.
+        unsigned state_expressions_instance_id = 0;             // DcsInterface instance ID at last evaluation.
+        ContextState state_expressions_state = FIRST;           // State selected at last evaluation.
+    };
 
     // Status of user-filled fields.
     bool increment_monitor_is_set_ = false; // True if a DCS ID increment monitor setting has been set.
     bool compare_monitor_is_set_ = false;   // True if all DCS ID comparison monitor settings have been set.
     bool string_monitor_is_set_ = false;    // True if all DCS ID string monitor settings have been set.
+    bool state_expressions_is_set_ = false; // True if valid state expressions have been set.
 
     // Optional settings.
     std::optional<int> delay_for_force_send_state_; // When populated, requests a force send of state to Streamdeck
                                                     // after counting down the stored delay value.
+    std::optional<size_t> compare_monitor_row_;     // Row of compare monitor within a CompareMonitorTable.
 
     // Context state.
-    ContextState current_state_ = FIRST;       // Stored state of the context.
-    std::string current_title_ = "";           // Stored title of the context.
-    Decimal current_increment_value_;          // Stored value for increment button types.
-    bool cycle_increments_is_allowed_ = false; // Flag set by user settings for increment button types.
-    bool disable_release_value_ = false;       // Flag set by user settings for momentary button types.
+    int current_state_ = FIRST; // Stored state of the context.
+    bool title_is_set_ = false; // True if the stored title of the context is not empty.
 
     // Stored settings extracted from user-filled fields.
     int dcs_id_increment_monitor_ = 0; // DCS ID to monitor for updating current increment value from game state.
     int dcs_id_compare_monitor_ = 0;   // DCS ID to monitor for context state setting according to value comparison.
     CompareConditionType dcs_id_compare_condition_ = GREATER_THAN; // Comparison to use for DCS ID compare monitor.
-    Decimal dcs_id_comparison_value_;                              // Value to compare DCS ID compare monitor value to.
+    double dcs_id_comparison_value_ = 0.0;                         // Value to compare DCS ID compare monitor value to.
     int dcs_id_string_monitor_ = 0;                                // DCS ID to monitor for context title.
-    int string_monitor_vertical_spacing_ = 0; // Vertical spacing (number of '\n') to include before or after title.
-    bool string_monitor_passthrough_ = true;  // Flag set by user to passthrough string to title unaltered.
-    std::map<std::string, std::string>
-        string_monitor_mapping_; // Map of received values to title text to display on context.
+
+    std::unique_ptr<ColdData> cold_ = std::make_unique<ColdData>(); // Settings and state read outside most updates.
 };
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Copyright 2020 Charles Tytler
+
+#pragma comment(lib, "Ws2_32.lib")
+
+#include "pch.h"
+
+#include "UdpForwarder.h"
+
+#include <WS2tcpip.h>
+#include <stdexcept>
+
+std::vector<std::string> parse_udp_endpoints(const std::string &endpoint_list) {
+    std::vector<std::string> endpoints;
+    size_t start = 0;
+    while (start < endpoint_list.size()) {
+        size_t end = endpoint_list.find_first_of(", \t\r\n", start);
+        if (end == std::string::npos) {
+            end = endpoint_list.size();
+        }
+        if (end > start) {
+            endpoints.push_back(endpoint_list.substr(start, end - start));
+        }
+        start = end + 1;
+    }
+    return endpoints;
+}
+
+UdpForwarder::UdpForwarder(const std::vector<std::string> &endpoints) {
+    // Initialize Windows Sockets DLL to version 2.2.
+    WSADATA wsaData;
+    if (WSAStartup(MAKEWORD(2, 2), &wsaData) != 0) {
+        throw std::runtime_error("Could not startup Windows socket library -- WSA Error: " +
+                                 std::to_string(WSAGetLastError()));
+    }
+
+    addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_INET;
+    hints.ai_socktype = SOCK_DGRAM;
+    for (const std::string &endpoint : endpoints) {
+        const size_t port_start = endpoint.rfind(':');
+        addrinfo *dest_port = nullptr;
+        if (port_start == std::string::npos || port_start == 0 ||
+            getaddrinfo(endpoint.substr(0, port_start).c_str(), endpoint.substr(port_start + 1).c_str(), &hints,
+                        &dest_port) != 0) {
+            WSACleanup();
+            throw std::runtime_error("Could not get valid address info from forward endpoint: " + endpoint);
+        }
+        dest_addrs_.push_back(*dest_port->ai_addr);
+        dest_addr_lens_.push_back(static_cast<int>(dest_port->ai_addrlen));
+        freeaddrinfo(dest_port);
+        stats_.push_back({endpoint, 0, 0, 0});
+    }
+
+    socket_id_ = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    u_long non_blocking = 1;
+    if (socket_id_ == INVALID_SOCKET || ioctlsocket(socket_id_, FIONBIO, &non_blocking) == SOCKET_ERROR) {
+        const std::string error_msg =
+            "Could not open UDP forwarding socket -- WSA Error: " + std::to_string(WSAGetLastError());
+        if (socket_id_ != INVALID_SOCKET) {
+            closesocket(socket_id_);
+        }
+        WSACleanup();
+        throw std::runtime_error(error_msg);
+    }
+}
+
+UdpForwarder::~UdpForwarder() {
+    closesocket(socket_id_);
+    WSACleanup();
+}
+
+void UdpForwarder::forward(const std::string_view datagram) {
+    for (size_t i = 0; i < dest_addrs_.size(); ++i) {
+        const auto sent = sendto(
+            socket_id_, datagram.data(), static_cast<int>(datagram.size()), 0, &dest_addrs_[i], dest_addr_lens_[i]);
+        UdpForwardStats &stats = stats_[i];
+        if (sent == static_cast<int>(datagram.size())) {
+            ++stats.datagrams_forwarded;
+            stats.bytes_sent += datagram.size();
+        } else {
+            ++stats.datagrams_dropped;
+        }
+    }
+}
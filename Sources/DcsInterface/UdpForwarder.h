@@ -0,0 +1,65 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <winsock2.h>
+
+using UdpForwardStats = struct {
+    std::string endpoint;          // Destination as "ip:port".
+    unsigned datagrams_forwarded;  // Datagrams sent to the destination.
+    unsigned long long bytes_sent; // Bytes of the datagrams sent to the destination.
+    unsigned datagrams_dropped;    // Datagrams not sent because the send would block or failed.
+};
+
+/**
+ * @brief Parses a list of UDP endpoints separated by commas or whitespace, such as "127.0.0.1:1625, 10.0.0.2:1725".
+ *
+ * @param endpoint_list List of endpoints, each "ip:port".
+ * @return Endpoints in order, empty entries skipped.
+ */
+std::vector<std::string> parse_udp_endpoints(const std::string &endpoint_list);
+
+/**
+ * @brief Forwards received datagrams unchanged to downstream UDP endpoints, such as Ikarus, so export scripts only
+ *        serialize and send each update once within DCS. Sends are non-blocking, so a destination whose send buffer
+ *        is full drops the datagram rather than delaying the caller.
+ */
+class UdpForwarder {
+  public:
+    /**
+     * @brief Construct a new Udp Forwarder sending to each endpoint.
+     *
+     * @param endpoints Destinations, each "ip:port".
+     * @throws std::runtime_error if an endpoint is invalid or the socket cannot be opened.
+     */
+    UdpForwarder(const std::vector<std::string> &endpoints);
+
+    ~UdpForwarder();
+
+    // Disable copy and move constructors.
+    UdpForwarder(const UdpForwarder &) = delete;
+    UdpForwarder(UdpForwarder &&) = delete;
+    UdpForwarder &operator=(const UdpForwarder &) = delete;
+    UdpForwarder &operator=(UdpForwarder &&) = delete;
+
+    /**
+     * @brief Sends a datagram to each destination without blocking.
+     *
+     * @param datagram Bytes of the datagram, which may include NUL characters.
+     */
+    void forward(const std::string_view datagram);
+
+    /**
+     * @brief Get the counters of each destination, in the order of the endpoints.
+     */
+    const std::vector<UdpForwardStats> &get_stats() const { return stats_; }
+
+  private:
+    SOCKET socket_id_;                   // Unbound socket used to send to all destinations.
+    std::vector<sockaddr> dest_addrs_;   // UDP address info of each destination.
+    std::vector<int> dest_addr_lens_;    // Size of each destination address.
+    std::vector<UdpForwardStats> stats_; // Counters of each destination.
+};
@@ -0,0 +1,80 @@
+// Copyright 2020 Charles Tytler
+
+#include "pch.h"
+
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+WorkerPool::WorkerPool(const size_t num_threads, const size_t max_queued_jobs) : max_queued_jobs_(max_queued_jobs) {
+    for (size_t i = 0; i < num_threads; ++i) {
+        workers_.emplace_back([this]() { run_worker(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        is_stopping_ = true;
+        queued_jobs_.clear();
+        for (auto &[owner, is_cancelled] : running_jobs_) {
+            *is_cancelled = true;
+        }
+    }
+    job_available_.notify_all();
+    for (auto &worker : workers_) {
+        worker.join();
+    }
+}
+
+bool WorkerPool::submit(const std::string &owner, Job job) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (is_stopping_ || queued_jobs_.size() >= max_queued_jobs_) {
+            return false;
+        }
+        queued_jobs_.push_back({owner, std::move(job), std::make_shared<std::atomic<bool>>(false)});
+    }
+    job_available_.notify_one();
+    return true;
+}
+
+void WorkerPool::cancel(const std::string &owner) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queued_jobs_.erase(std::remove_if(queued_jobs_.begin(),
+                                      queued_jobs_.end(),
+                                      [&owner](const QueuedJob &queued_job) { return queued_job.owner == owner; }),
+                       queued_jobs_.end());
+    const auto [begin, end] = running_jobs_.equal_range(owner);
+    for (auto it = begin; it != end; ++it) {
+        *it->second = true;
+    }
+}
+
+size_t WorkerPool::num_queued_jobs() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return queued_jobs_.size();
+}
+
+void WorkerPool::run_worker() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        job_available_.wait(lock, [this]() { return is_stopping_ || !queued_jobs_.empty(); });
+        if (is_stopping_) {
+            return;
+        }
+        QueuedJob queued_job = std::move(queued_jobs_.front());
+        queued_jobs_.pop_front();
+        const auto running_job = running_jobs_.emplace(queued_job.owner, queued_job.is_cancelled);
+
+        lock.unlock();
+        try {
+            queued_job.job(*queued_job.is_cancelled);
+        } catch (...) {
+            // A failed job must not stop the worker; jobs report their own errors.
+        }
+        lock.lock();
+
+        running_jobs_.erase(running_job);
+    }
+}
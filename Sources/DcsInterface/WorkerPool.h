@@ -0,0 +1,85 @@
+// Copyright 2020 Charles Tytler
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed number of worker threads running jobs from a bounded queue, so slow requests (such as Lua extraction of
+ * module clickabledata) are run off the thread receiving Streamdeck events.
+ *
+ * Jobs are submitted on behalf of an owner (e.g. a Streamdeck context) so that all jobs of an owner can be cancelled
+ * together. Queued jobs of a cancelled owner are discarded, and running jobs are signalled through their cancel flag so
+ * they can stop early and skip posting their results.
+ */
+class WorkerPool {
+  public:
+    using Job = std::function<void(const std::atomic<bool> &is_cancelled)>;
+
+    /**
+     * @brief Construct a new Worker Pool and start its threads.
+     *
+     * @param num_threads Number of worker threads.
+     * @param max_queued_jobs Maximum number of jobs waiting for a worker before new jobs are rejected.
+     */
+    WorkerPool(const size_t num_threads, const size_t max_queued_jobs);
+
+    /**
+     * @brief Cancels all jobs and joins the worker threads.
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /**
+     * @brief Queues a job to be run by the next available worker.
+     *
+     * @param owner Identifier of the owner of the job, used for cancellation.
+     * @param job Function to run, which should check is_cancelled before posting any results.
+     * @return True if queued, false if the queue is full.
+     */
+    bool submit(const std::string &owner, Job job);
+
+    /**
+     * @brief Discards queued jobs of an owner and signals its running jobs to cancel.
+     *
+     * @param owner Identifier of the owner of the jobs.
+     */
+    void cancel(const std::string &owner);
+
+    /**
+     * @brief Returns the number of jobs waiting for a worker.
+     */
+    size_t num_queued_jobs();
+
+  private:
+    using QueuedJob = struct {
+        std::string owner;
+        Job job;
+        std::shared_ptr<std::atomic<bool>> is_cancelled;
+    };
+
+    /**
+     * @brief Loop of each worker thread, running queued jobs until the pool is stopped.
+     */
+    void run_worker();
+
+    std::mutex mutex_; // Protects all members below.
+    std::condition_variable job_available_;
+    std::deque<QueuedJob> queued_jobs_;
+    std::multimap<std::string, std::shared_ptr<std::atomic<bool>>>
+        running_jobs_; // Cancel flags of running jobs by owner.
+    size_t max_queued_jobs_;
+    bool is_stopping_ = false;
+    std::vector<std::thread> workers_;
+};
@@ -11,6 +11,7 @@
 //==============================================================================
 
 #include "MyStreamDeckPlugin.h"
+#include <algorithm>
 #include <atomic>
 
 #include "Common/EPLJSONUtils.h"
@@ -54,7 +55,16 @@ class CallBackTimer {
     std::thread _thd;
 };
 
-MyStreamDeckPlugin::MyStreamDeckPlugin() {
+MyStreamDeckPlugin::MyStreamDeckPlugin()
+    : mClickabledataCache(kClickabledataCacheDirectory, kMaxCachedModulesInMemory),
+      mModulePreextractor(mClickabledataCache, "extract_clickabledata.lua"),
+      mInstalledModuleWatcher("/mods/aircraft/",
+                              std::chrono::milliseconds(kInstalledModulesPollIntervalMs),
+                              true,
+                              [this](const std::string &dcs_install_path, const std::string &module_folder_name) {
+                                  mClickabledataCache.invalidate_module(dcs_install_path, module_folder_name);
+                              }),
+      mLookupWorkers(kNumLookupWorkers, kMaxQueuedLookups) {
     mTimer = new CallBackTimer();
     mTimer->start(10, [this]() { this->UpdateFromGameState(); });
 }
@@ -89,6 +99,11 @@ DcsConnectionSettings MyStreamDeckPlugin::get_connection_settings(const json &gl
         connection_settings.tx_port = kDefaultDcsSendPort;
         connection_settings.ip_address = kDefaultDcsIpAddress;
     }
+    connection_settings.forward_endpoints =
+        parse_udp_endpoints(EPLJSONUtils::GetStringByName(global_settings, "forward_endpoints"));
+    connection_settings.multicast_group = EPLJSONUtils::GetStringByName(global_settings, "multicast_group");
+    connection_settings.shared_memory_name = EPLJSONUtils::GetStringByName(global_settings, "shared_memory_name");
+    connection_settings.shared_state_name = EPLJSONUtils::GetStringByName(global_settings, "shared_state_name");
     return connection_settings;
 }
 
@@ -108,10 +123,40 @@ void MyStreamDeckPlugin::DidReceiveGlobalSettings(const json &inPayload) {
     if (dcs_interface_ == nullptr) {
         try {
             dcs_interface_ = new DcsInterface(connection_settings);
+            mDcsIdSubscriptionChanged = true;
         } catch (const std::exception &e) {
             mConnectionManager->LogMessage("Caught Exception While Opening Connection: " + std::string(e.what()));
         }
     }
+
+    // Apply the budget of commands sent to DCS per frame, also to a DcsInterface re-opened with new settings.
+    const int commands_per_frame = std::atoi(EPLJSONUtils::GetStringByName(settings, "commands_per_frame").c_str());
+    if (dcs_interface_ != nullptr) {
+        dcs_interface_->set_commands_per_frame(commands_per_frame > 0 ? static_cast<size_t>(commands_per_frame)
+                                                                      : DcsCommandScheduler::kDefaultMessagesPerFrame);
+    }
+
+    // Apply the debug capture of all DCS IDs from the timer thread along with the DCS ID filter.
+    const bool capture_all_dcs_ids = EPLJSONUtils::GetBoolByName(settings, "capture_all_dcs_ids");
+    if (mCaptureAllDcsIds.exchange(capture_all_dcs_ids) != capture_all_dcs_ids) {
+        mDcsIdSubscriptionChanged = true;
+    }
+    const bool filter_dcs_ids = EPLJSONUtils::GetBoolByName(settings, "filter_dcs_ids");
+    if (mFilterDcsIds.exchange(filter_dcs_ids) != filter_dcs_ids) {
+        mDcsIdSubscriptionChanged = true;
+    }
+
+    // Optionally extract all installed modules in the background so ID lookups are served from the cache.
+    const std::string dcs_install_path = EPLJSONUtils::GetStringByName(settings, "dcs_install_path");
+    const std::string cpu_budget_percent = EPLJSONUtils::GetStringByName(settings, "preextract_cpu_budget");
+    const double cpu_budget =
+        cpu_budget_percent.empty() ? kDefaultPreextractCpuBudget : std::atof(cpu_budget_percent.c_str()) / 100.0;
+    if (!EPLJSONUtils::GetBoolByName(settings, "preextract_modules") || dcs_install_path.empty()) {
+        mModulePreextractor.stop();
+    } else if (dcs_install_path != mModulePreextractor.get_dcs_install_path() ||
+               cpu_budget != mModulePreextractor.get_cpu_budget()) {
+        mModulePreextractor.start(dcs_install_path, cpu_budget);
+    }
 }
 
 void MyStreamDeckPlugin::UpdateFromGameState() {
@@ -124,11 +169,40 @@ void MyStreamDeckPlugin::UpdateFromGameState() {
         dcs_interface_->update_dcs_state();
 
         if (mConnectionManager != nullptr) {
-            mVisibleContextsMutex.lock();
-            for (auto &elem : mVisibleContexts) {
-                elem.second.updateContextState(dcs_interface_, mConnectionManager);
+            // Collect the DCS IDs referenced by contexts while sweeping if they may have changed.
+            const bool update_subscription = mDcsIdSubscriptionChanged.exchange(false);
+            std::vector<int> referenced_dcs_ids;
+            mVisibleContexts.sweep([&](VisibleContexts &visible, DeviceShardMap<VisibleContexts>::SweepLock &lock) {
+                visible.compare_monitors.evaluate(dcs_interface_);
+
+                // Collect handles up front, as contexts may appear or disappear while the lock is yielded to events.
+                std::vector<SlotMapHandle> handles;
+                handles.reserve(visible.contexts.size());
+                visible.contexts.for_each(
+                    [&handles](const SlotMapHandle handle, StreamdeckContext &) { handles.push_back(handle); });
+
+                for (const SlotMapHandle handle : handles) {
+                    lock.yield_to_priority_access();
+                    StreamdeckContext *context = visible.contexts.get(handle);
+                    if (context != nullptr) {
+                        context->updateContextState(dcs_interface_, mConnectionManager, &visible.compare_monitors);
+                        if (update_subscription) {
+                            context->appendMonitoredDcsIds(referenced_dcs_ids);
+                        }
+                    }
+                }
+            });
+            if (update_subscription) {
+                std::sort(referenced_dcs_ids.begin(), referenced_dcs_ids.end());
+                referenced_dcs_ids.erase(std::unique(referenced_dcs_ids.begin(), referenced_dcs_ids.end()),
+                                         referenced_dcs_ids.end());
+                // Capturing all DCS IDs subscribes to all of them, as otherwise only referenced DCS IDs are exported.
+                dcs_interface_->send_dcs_subscription_command(mCaptureAllDcsIds ? std::vector<int>()
+                                                                                : referenced_dcs_ids);
+                dcs_interface_->set_capture_all_dcs_ids(mCaptureAllDcsIds);
+                dcs_interface_->set_dcs_id_filter_enabled(mFilterDcsIds);
+                dcs_interface_->set_dcs_id_filter(referenced_dcs_ids);
             }
-            mVisibleContextsMutex.unlock();
         }
     }
 }
@@ -138,9 +212,12 @@ void MyStreamDeckPlugin::KeyDownForAction(const std::string &inAction,
                                           const json &inPayload,
                                           const std::string &inDeviceID) {
     if (dcs_interface_ != nullptr) {
-        mVisibleContextsMutex.lock();
-        mVisibleContexts[inContext].handleButtonEvent(dcs_interface_, KEY_DOWN, inAction, inPayload);
-        mVisibleContextsMutex.unlock();
+        mVisibleContexts.access(inDeviceID, [&](VisibleContexts &visible) {
+            StreamdeckContext *context = visible.find(inContext);
+            if (context != nullptr) {
+                context->handleButtonEvent(dcs_interface_, KEY_DOWN, inAction, inPayload);
+            }
+        });
     }
 }
 
@@ -150,18 +227,22 @@ void MyStreamDeckPlugin::KeyUpForAction(const std::string &inAction,
                                         const std::string &inDeviceID) {
 
     if (dcs_interface_ != nullptr) {
-        mVisibleContextsMutex.lock();
-        // The Streamdeck will by default change a context's state after a KeyUp event, so a force send of the current
-        // context's state will keep the button state in sync with the plugin.
-        if (inAction.find("switch") != std::string::npos) {
-            // For switches use a delay to avoid jittering and a race condition of Streamdeck and Plugin trying to
-            // change state.
-            mVisibleContexts[inContext].forceSendStateAfterDelay(3);
-        } else {
-            mVisibleContexts[inContext].forceSendState(mConnectionManager);
-        }
-        mVisibleContexts[inContext].handleButtonEvent(dcs_interface_, KEY_UP, inAction, inPayload);
-        mVisibleContextsMutex.unlock();
+        mVisibleContexts.access(inDeviceID, [&](VisibleContexts &visible) {
+            StreamdeckContext *context = visible.find(inContext);
+            if (context == nullptr) {
+                return;
+            }
+            // The Streamdeck will by default change a context's state after a KeyUp event, so a force send of the
+            // current context's state will keep the button state in sync with the plugin.
+            if (inAction.find("switch") != std::string::npos) {
+                // For switches use a delay to avoid jittering and a race condition of Streamdeck and Plugin trying to
+                // change state.
+                context->forceSendStateAfterDelay(3);
+            } else {
+                context->forceSendState(mConnectionManager);
+            }
+            context->handleButtonEvent(dcs_interface_, KEY_UP, inAction, inPayload);
+        });
     }
 }
 
@@ -170,14 +251,19 @@ void MyStreamDeckPlugin::WillAppearForAction(const std::string &inAction,
                                              const json &inPayload,
                                              const std::string &inDeviceID) {
     // Remember the context.
-    mVisibleContextsMutex.lock();
     json settings;
     EPLJSONUtils::GetObjectByName(inPayload, "settings", settings);
-    mVisibleContexts[inContext] = StreamdeckContext(inContext, settings);
-    if (dcs_interface_ != nullptr) {
-        mVisibleContexts[inContext].forceSendState(mConnectionManager);
-    }
-    mVisibleContextsMutex.unlock();
+    StreamdeckContext new_context(inContext, settings);
+    mVisibleContexts.access(inDeviceID, [&](VisibleContexts &visible) {
+        visible.remove(inContext);
+        new_context.setCompareMonitorRow(visible.compare_monitors.add(new_context.getCompareMonitor()));
+        const SlotMapHandle handle = visible.contexts.insert(std::move(new_context));
+        visible.handles[inContext] = handle;
+        if (dcs_interface_ != nullptr) {
+            visible.contexts.get(handle)->forceSendState(mConnectionManager);
+        }
+    });
+    mDcsIdSubscriptionChanged = true;
 }
 
 void MyStreamDeckPlugin::WillDisappearForAction(const std::string &inAction,
@@ -185,9 +271,25 @@ void MyStreamDeckPlugin::WillDisappearForAction(const std::string &inAction,
                                                 const json &inPayload,
                                                 const std::string &inDeviceID) {
     // Remove the context.
-    mVisibleContextsMutex.lock();
-    mVisibleContexts.erase(inContext);
-    mVisibleContextsMutex.unlock();
+    mVisibleContexts.access(inDeviceID, [&](VisibleContexts &visible) { visible.remove(inContext); });
+    mDcsIdSubscriptionChanged = true;
+}
+
+StreamdeckContext *MyStreamDeckPlugin::VisibleContexts::find(const std::string &inContext) {
+    const auto it = handles.find(inContext);
+    return (it != handles.end()) ? contexts.get(it->second) : nullptr;
+}
+
+void MyStreamDeckPlugin::VisibleContexts::remove(const std::string &inContext) {
+    const auto it = handles.find(inContext);
+    if (it != handles.end()) {
+        const StreamdeckContext *context = contexts.get(it->second);
+        if (context != nullptr && context->getCompareMonitorRow()) {
+            compare_monitors.remove(context->getCompareMonitorRow().value());
+        }
+        contexts.erase(it->second);
+        handles.erase(it);
+    }
 }
 
 void MyStreamDeckPlugin::DeviceDidConnect(const std::string &inDeviceID, const json &inDeviceInfo) {
@@ -209,11 +311,19 @@ void MyStreamDeckPlugin::SendToPlugin(const std::string &inAction,
 
     if (event == "SettingsUpdate") {
         // Update settings for the specified context -- triggered by Property Inspector detecting a change.
-        mVisibleContextsMutex.lock();
-        if (mVisibleContexts.count(inContext) > 0) {
-            mVisibleContexts[inContext].updateContextSettings(inPayload["settings"]);
-        }
-        mVisibleContextsMutex.unlock();
+        // Events from the Property Inspector do not identify the device, so search each device's contexts.
+        mVisibleContexts.access_any([&](VisibleContexts &visible) {
+            StreamdeckContext *context = visible.find(inContext);
+            if (context == nullptr) {
+                return false;
+            }
+            context->updateContextSettings(inPayload["settings"]);
+            if (context->getCompareMonitorRow()) {
+                visible.compare_monitors.update(context->getCompareMonitorRow().value(), context->getCompareMonitor());
+            }
+            return true;
+        });
+        mDcsIdSubscriptionChanged = true;
     }
 
     if (event == "RequestDcsStateUpdate") {
@@ -230,39 +340,140 @@ void MyStreamDeckPlugin::SendToPlugin(const std::string &inAction,
             for (const auto &[key, value] : dcs_id_values) {
                 current_game_state[std::to_string(key)] = value;
             }
-            mConnectionManager->SendToPropertyInspector(
-                inAction,
-                inContext,
-                json({{"event", "DebugDcsGameState"}, {"current_game_state", current_game_state}}));
+            const DcsCommandQueueStats queue_stats = dcs_interface_->get_command_queue_stats();
+            const json command_queue_stats = {{"queue_depth", queue_stats.queue_depth},
+                                              {"max_queue_depth", queue_stats.max_queue_depth},
+                                              {"sent_immediately", queue_stats.sent_immediately},
+                                              {"sent_deferred", queue_stats.sent_deferred},
+                                              {"coalesced", queue_stats.coalesced},
+                                              {"frames", queue_stats.frames}};
+            mConnectionManager->SendToPropertyInspector(inAction,
+                                                        inContext,
+                                                        json({{"event", "DebugDcsGameState"},
+                                                              {"current_game_state", current_game_state},
+                                                              {"command_queue_stats", command_queue_stats}}));
         }
     }
 
     if (event == "RequestInstalledModules") {
         const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
-        const std::string modules_subdir = "/mods/aircraft/";
-        const json installed_modules_and_result = get_installed_modules(dcs_install_path, modules_subdir);
-        const std::string result = EPLJSONUtils::GetStringByName(installed_modules_and_result, "result");
-        if (result != "success") {
-            mConnectionManager->LogMessage("Get Installed Modules Failure: " + result);
-        }
-        mConnectionManager->SendToPropertyInspector(
-            inAction,
-            inContext,
-            json({{"event", "InstalledModules"},
-                  {"installed_modules", installed_modules_and_result["installed_modules"]}}));
+        submitLookup(inContext, [this, inAction, inContext, dcs_install_path](const std::atomic<bool> &is_cancelled) {
+            const json installed_modules_and_result = mInstalledModuleWatcher.get_installed_modules(dcs_install_path);
+            const std::string result = EPLJSONUtils::GetStringByName(installed_modules_and_result, "result");
+            if (result != "success") {
+                mConnectionManager->LogMessage("Get Installed Modules Failure: " + result);
+            }
+            if (!is_cancelled) {
+                mConnectionManager->SendToPropertyInspector(
+                    inAction,
+                    inContext,
+                    json({{"event", "InstalledModules"},
+                          {"installed_modules", installed_modules_and_result["installed_modules"]}}));
+            }
+        });
     }
 
     if (event == "RequestIdLookup") {
         const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
         const std::string module = EPLJSONUtils::GetStringByName(inPayload, "module");
-        json clickabledata_and_result = get_clickabledata(dcs_install_path, module, "extract_clickabledata.lua");
-        const std::string lua_result = EPLJSONUtils::GetStringByName(clickabledata_and_result, "result");
-        if (lua_result != "success") {
-            mConnectionManager->LogMessage(module + " Clickabledata Result: " + lua_result);
-        }
-        mConnectionManager->SendToPropertyInspector(
-            inAction,
+        submitLookup(inContext,
+                     [this, inAction, inContext, dcs_install_path, module](const std::atomic<bool> &is_cancelled) {
+                         const ClickabledataExtraction extraction = mClickabledataCache.get_clickabledata(
+                             dcs_install_path, module, "extract_clickabledata.lua");
+                         if (extraction.result != "success") {
+                             mConnectionManager->LogMessage(module + " Clickabledata Result: " + extraction.result);
+                         }
+                         if (!is_cancelled) {
+                             startClickabledataTransfer(inAction, inContext, extraction);
+                         }
+                     });
+    }
+
+    if (event == "RequestIdSearch") {
+        const std::string dcs_install_path = EPLJSONUtils::GetStringByName(inPayload, "dcs_install_path");
+        const std::string module = EPLJSONUtils::GetStringByName(inPayload, "module");
+        const std::string query = EPLJSONUtils::GetStringByName(inPayload, "query");
+        submitLookup(
             inContext,
-            json({{"event", "Clickabledata"}, {"clickabledata", clickabledata_and_result["clickabledata_items"]}}));
+            [this, inAction, inContext, dcs_install_path, module, query](const std::atomic<bool> &is_cancelled) {
+                std::string result;
+                const auto search_index = mClickabledataCache.get_search_index(
+                    dcs_install_path, module, "extract_clickabledata.lua", result);
+                json search_results = {{"event", "IdSearchResults"},
+                                       {"module", module},
+                                       {"query", query},
+                                       {"result", result},
+                                       {"total_matches", 0},
+                                       {"columns", clickabledata_json_columns()},
+                                       {"rows", json::array()}};
+                if (search_index) {
+                    const auto matches = search_index->search(query, kMaxIdSearchResults);
+                    search_results["total_matches"] = matches.total_matches;
+                    for (const size_t element_index : matches.element_indices) {
+                        search_results["rows"].push_back(
+                            clickabledata_element_to_json_row(search_index->get_elements()[element_index]));
+                    }
+                }
+                if (!is_cancelled) {
+                    mConnectionManager->SendToPropertyInspector(inAction, inContext, search_results);
+                }
+            });
+    }
+
+    if (event == "ClickabledataChunkAck") {
+        // The Property Inspector has shown a chunk, so release further chunks of its transfer.
+        const int transfer_id = EPLJSONUtils::GetIntByName(inPayload, "transfer_id");
+        const int chunk_index = EPLJSONUtils::GetIntByName(inPayload, "chunk_index");
+        std::lock_guard<std::mutex> lock(mClickabledataTransfersMutex);
+        const auto transfer = mClickabledataTransfers.find(inContext);
+        if (transfer != mClickabledataTransfers.end() && transfer->second.get_transfer_id() == transfer_id &&
+            chunk_index >= 0) {
+            sendClickabledataChunks(inAction, inContext, transfer_id, transfer->second.acknowledge(chunk_index));
+            if (transfer->second.is_complete()) {
+                mClickabledataTransfers.erase(transfer);
+            }
+        }
+    }
+}
+
+void MyStreamDeckPlugin::PropertyInspectorDidDisappear(const std::string &inAction,
+                                                       const std::string &inContext,
+                                                       const std::string &inDeviceID) {
+    // Results of lookups requested by a closed Property Inspector are no longer needed.
+    mLookupWorkers.cancel(inContext);
+    std::lock_guard<std::mutex> lock(mClickabledataTransfersMutex);
+    mClickabledataTransfers.erase(inContext);
+}
+
+void MyStreamDeckPlugin::submitLookup(const std::string &inContext, WorkerPool::Job job) {
+    if (!mLookupWorkers.submit(inContext, std::move(job))) {
+        mConnectionManager->LogMessage("Lookup request dropped for context " + inContext +
+                                       ": too many pending lookups");
+    }
+}
+
+void MyStreamDeckPlugin::startClickabledataTransfer(const std::string &inAction,
+                                                    const std::string &inContext,
+                                                    const ClickabledataExtraction &extraction) {
+    ChunkedTransfer transfer(mNextTransferId++,
+                             clickabledata_to_json_chunks(extraction, kMaxClickabledataChunkBytes),
+                             kMaxClickabledataChunksInFlight);
+    std::lock_guard<std::mutex> lock(mClickabledataTransfersMutex);
+    sendClickabledataChunks(inAction, inContext, transfer.get_transfer_id(), transfer.start());
+    if (transfer.is_complete()) {
+        mClickabledataTransfers.erase(inContext);
+    } else {
+        mClickabledataTransfers.insert_or_assign(inContext, std::move(transfer));
+    }
+}
+
+void MyStreamDeckPlugin::sendClickabledataChunks(const std::string &inAction,
+                                                 const std::string &inContext,
+                                                 const int transfer_id,
+                                                 std::vector<json> chunks) {
+    for (auto &chunk : chunks) {
+        chunk["event"] = "ClickabledataChunk";
+        chunk["transfer_id"] = transfer_id;
+        mConnectionManager->SendToPropertyInspector(inAction, inContext, chunk);
     }
 }
@@ -11,8 +11,17 @@
 //==============================================================================
 
 #include "Common/ESDBasePlugin.h"
+#include "DcsInterface/ChunkedTransfer.h"
+#include "DcsInterface/ClickabledataCache.h"
+#include "DcsInterface/CompareMonitorTable.h"
 #include "DcsInterface/DcsInterface.h"
+#include "DcsInterface/DeviceShardMap.h"
+#include "DcsInterface/InstalledModuleWatcher.h"
+#include "DcsInterface/ModulePreextractor.h"
+#include "DcsInterface/SlotMap.h"
 #include "DcsInterface/StreamdeckContext.h"
+#include "DcsInterface/WorkerPool.h"
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 
@@ -57,6 +66,10 @@ class MyStreamDeckPlugin : public ESDBasePlugin {
                       const json &inPayload,
                       const std::string &inDeviceID) override;
 
+    void PropertyInspectorDidDisappear(const std::string &inAction,
+                                       const std::string &inContext,
+                                       const std::string &inDeviceID) override;
+
   private:
     /**
      * @brief Periodic function which continually updates Streamdeck button contexts according to DCS game state.
@@ -71,8 +84,90 @@ class MyStreamDeckPlugin : public ESDBasePlugin {
      */
     DcsConnectionSettings get_connection_settings(const json &global_settings);
 
-    std::mutex mVisibleContextsMutex;
-    std::unordered_map<std::string, StreamdeckContext> mVisibleContexts = {};
+    /**
+     * @brief Queues a slow Property Inspector request to run on a lookup worker, which posts its own results.
+     *
+     * @param inContext Streamdeck context ID of the requesting Property Inspector, used to cancel its requests.
+     * @param job Function run by the worker.
+     */
+    void submitLookup(const std::string &inContext, WorkerPool::Job job);
+
+    /**
+     * @brief Starts delivering clickabledata to a Property Inspector in chunks, replacing any previous transfer.
+     *
+     * @param inAction Action of the requesting Property Inspector.
+     * @param inContext Streamdeck context ID of the requesting Property Inspector.
+     * @param extraction Extracted clickabledata to deliver.
+     */
+    void startClickabledataTransfer(const std::string &inAction,
+                                    const std::string &inContext,
+                                    const ClickabledataExtraction &extraction);
+
+    /**
+     * @brief Sends released clickabledata chunks to a Property Inspector, must be called holding
+     * mClickabledataTransfersMutex so chunks are sent in order.
+     *
+     * @param inAction Action of the requesting Property Inspector.
+     * @param inContext Streamdeck context ID of the requesting Property Inspector.
+     * @param transfer_id Identifier of the transfer the chunks belong to.
+     * @param chunks Chunks to send.
+     */
+    void sendClickabledataChunks(const std::string &inAction,
+                                 const std::string &inContext,
+                                 const int transfer_id,
+                                 std::vector<json> chunks);
+
+    /**
+     * @brief Visible contexts of a single Streamdeck device.
+     */
+    class VisibleContexts {
+      public:
+        /**
+         * @brief Finds the visible context interned for a Streamdeck context ID.
+         *
+         * @param inContext Streamdeck context ID.
+         * @return Pointer to the context, or nullptr if the context is not visible.
+         */
+        StreamdeckContext *find(const std::string &inContext);
+
+        /**
+         * @brief Removes a visible context and its compare monitor.
+         *
+         * @param inContext Streamdeck context ID.
+         */
+        void remove(const std::string &inContext);
+
+        SlotMap<StreamdeckContext> contexts; // Visible contexts, referenced internally by handle.
+        std::unordered_map<std::string, SlotMapHandle>
+            handles; // Handles of visible contexts, interned by Streamdeck context ID at WillAppear.
+        CompareMonitorTable compare_monitors; // Compare monitors of the contexts, evaluated together each update.
+    };
+
+    // Visible contexts sharded by device, so key events only wait on their own device and take priority over updates.
+    DeviceShardMap<VisibleContexts> mVisibleContexts;
+
+    ClickabledataCache mClickabledataCache; // Clickabledata of previously looked up modules.
+    ModulePreextractor mModulePreextractor; // Optionally fills mClickabledataCache with all installed modules.
+    // Installed modules of the configured DCS installation, which also invalidates mClickabledataCache entries of
+    // modules whose cockpit scripts change.
+    InstalledModuleWatcher mInstalledModuleWatcher;
+
+    // Clickabledata being delivered to each Property Inspector context, released as the chunks are acknowledged.
+    std::mutex mClickabledataTransfersMutex;
+    std::unordered_map<std::string, ChunkedTransfer> mClickabledataTransfers;
+    std::atomic<int> mNextTransferId = 0;
+
+    // Workers for ID lookup and module scanning requests from the Property Inspector, which are too slow to handle on
+    // the thread receiving Streamdeck events. Declared after the members its jobs use, so it is destroyed (cancelling
+    // and joining running jobs) before them.
+    WorkerPool mLookupWorkers;
+
+    // Set when contexts appear, disappear or change settings, so the DCS IDs subscribed to and stored are updated.
+    std::atomic<bool> mDcsIdSubscriptionChanged = true;
+    // Set by the "capture_all_dcs_ids" global setting to store all DCS IDs for debugging in the comms window.
+    std::atomic<bool> mCaptureAllDcsIds = false;
+    // Set by the "filter_dcs_ids" global setting to store only DCS IDs used by buttons with any export scripts.
+    std::atomic<bool> mFilterDcsIds = false;
 
     CallBackTimer *mTimer;
     DcsInterface *dcs_interface_ = nullptr;
@@ -0,0 +1,66 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/ChunkedTransfer.cpp"
+
+namespace test {
+
+std::vector<json> make_chunks(const int num_chunks) {
+    std::vector<json> chunks;
+    for (int i = 0; i < num_chunks; ++i) {
+        chunks.push_back(json({{"chunk_index", i}}));
+    }
+    return chunks;
+}
+
+std::vector<int> chunk_indices(const std::vector<json> &chunks) {
+    std::vector<int> indices;
+    for (const auto &chunk : chunks) {
+        indices.push_back(chunk["chunk_index"]);
+    }
+    return indices;
+}
+
+TEST(ChunkedTransferTest, start_releases_up_to_max_in_flight) {
+    ChunkedTransfer transfer(7, make_chunks(5), 2);
+    EXPECT_EQ(7, transfer.get_transfer_id());
+    EXPECT_EQ(5, transfer.num_chunks());
+    EXPECT_EQ(std::vector<int>({0, 1}), chunk_indices(transfer.start()));
+    EXPECT_FALSE(transfer.is_complete());
+}
+
+TEST(ChunkedTransferTest, acknowledge_releases_next_chunks) {
+    ChunkedTransfer transfer(0, make_chunks(5), 2);
+    (void)transfer.start();
+    EXPECT_EQ(std::vector<int>({2}), chunk_indices(transfer.acknowledge(0)));
+    EXPECT_EQ(std::vector<int>({3}), chunk_indices(transfer.acknowledge(1)));
+    EXPECT_EQ(std::vector<int>({4}), chunk_indices(transfer.acknowledge(2)));
+    EXPECT_TRUE(transfer.acknowledge(3).empty());
+    EXPECT_FALSE(transfer.is_complete());
+    EXPECT_TRUE(transfer.acknowledge(4).empty());
+    EXPECT_TRUE(transfer.is_complete());
+}
+
+TEST(ChunkedTransferTest, acknowledgements_are_cumulative) {
+    ChunkedTransfer transfer(0, make_chunks(6), 3);
+    (void)transfer.start();
+    EXPECT_EQ(std::vector<int>({3, 4}), chunk_indices(transfer.acknowledge(1)));
+}
+
+TEST(ChunkedTransferTest, stale_and_unsent_acknowledgements_ignored) {
+    ChunkedTransfer transfer(0, make_chunks(4), 1);
+    (void)transfer.start();
+    EXPECT_TRUE(transfer.acknowledge(2).empty()); // Not yet sent.
+    EXPECT_EQ(std::vector<int>({1}), chunk_indices(transfer.acknowledge(0)));
+    EXPECT_TRUE(transfer.acknowledge(0).empty()); // Duplicate.
+    EXPECT_EQ(std::vector<int>({2}), chunk_indices(transfer.acknowledge(1)));
+}
+
+TEST(ChunkedTransferTest, zero_max_in_flight_sends_one_at_a_time) {
+    ChunkedTransfer transfer(0, make_chunks(2), 0);
+    EXPECT_EQ(std::vector<int>({0}), chunk_indices(transfer.start()));
+    EXPECT_EQ(std::vector<int>({1}), chunk_indices(transfer.acknowledge(0)));
+}
+
+} // namespace test
@@ -0,0 +1,183 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/ClickabledataCache.cpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace test {
+
+class ClickabledataCacheTestFixture : public ::testing::Test {
+  public:
+    ClickabledataCacheTestFixture()
+        : test_directory((std::filesystem::temp_directory_path() / "ClickabledataCacheTest").string()),
+          dcs_install_path(test_directory + "/DCS World"), cache_directory(test_directory + "/cache"),
+          lua_script(test_directory + "/extract.lua") {
+        std::filesystem::remove_all(test_directory);
+
+        // Mock a DCS installation with a module whose clickabledata lists element names.
+        write_file(lua_script,
+                   "dofile(dcs_install_path .. '/mods/aircraft/' .. module_name .. '/Cockpit/clickabledata.lua')\n"
+                   "for _, name in ipairs(elements) do\n"
+                   "  emit_element{element = name, device_id = 1, hint = 'Hint'}\n"
+                   "end\n");
+        write_clickabledata("A-10C", "elements = {'A-10C_1', 'A-10C_2'}\n");
+        write_clickabledata("F-16C_50", "elements = {'F-16C_50_1'}\n");
+    }
+
+    ~ClickabledataCacheTestFixture() { std::filesystem::remove_all(test_directory); }
+
+    static void write_file(const std::string &path, const std::string &contents) {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        std::ofstream(path) << contents;
+    }
+
+    void write_clickabledata(const std::string &module, const std::string &contents) {
+        write_file(dcs_install_path + "/mods/aircraft/" + module + "/Cockpit/clickabledata.lua", contents);
+    }
+
+    std::string test_directory;
+    std::string dcs_install_path;
+    std::string cache_directory;
+    std::string lua_script;
+};
+
+TEST_F(ClickabledataCacheTestFixture, fingerprint_missing_module) {
+    EXPECT_EQ(0, fingerprint_module(dcs_install_path, "non-existant-module"));
+    EXPECT_NE(0, fingerprint_module(dcs_install_path, "A-10C"));
+}
+
+TEST_F(ClickabledataCacheTestFixture, fingerprint_changes_with_module_files) {
+    const uint64_t fingerprint = fingerprint_module(dcs_install_path, "A-10C");
+    EXPECT_EQ(fingerprint, fingerprint_module(dcs_install_path, "A-10C"));
+    EXPECT_NE(fingerprint, fingerprint_module(dcs_install_path, "F-16C_50"));
+
+    write_clickabledata("A-10C", "elements = {'A-10C_1', 'A-10C_2', 'A-10C_3'}\n");
+    const uint64_t modified_fingerprint = fingerprint_module(dcs_install_path, "A-10C");
+    EXPECT_NE(fingerprint, modified_fingerprint);
+
+    write_file(dcs_install_path + "/mods/aircraft/A-10C/Cockpit/Scripts/devices.lua", "devices = {}\n");
+    EXPECT_NE(modified_fingerprint, fingerprint_module(dcs_install_path, "A-10C"));
+}
+
+TEST_F(ClickabledataCacheTestFixture, memory_hit_after_extraction) {
+    ClickabledataCache cache(cache_directory, 4);
+    const json first_result = clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script));
+    EXPECT_EQ("success", first_result["result"]);
+    EXPECT_EQ(json({"(1),,A-10C_1,,,,,,Hint", "(1),,A-10C_2,,,,,,Hint"}), first_result["clickabledata_items"]);
+
+    const json second_result = clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script));
+    EXPECT_EQ(first_result, second_result);
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(1, stats.misses);
+    EXPECT_EQ(1, stats.memory_hits);
+    EXPECT_EQ(0, stats.disk_hits);
+}
+
+TEST_F(ClickabledataCacheTestFixture, disk_hit_from_new_cache) {
+    json first_result;
+    {
+        ClickabledataCache cache(cache_directory, 4);
+        first_result = clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script));
+    }
+
+    // Expect a new cache (e.g. after the plugin restarts) to read the index written by the first.
+    ClickabledataCache cache(cache_directory, 4);
+    EXPECT_EQ(first_result, clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script)));
+    EXPECT_EQ(first_result, clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script)));
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(0, stats.misses);
+    EXPECT_EQ(1, stats.disk_hits);
+    EXPECT_EQ(1, stats.memory_hits);
+}
+
+TEST_F(ClickabledataCacheTestFixture, modified_module_is_extracted_again) {
+    ClickabledataCache cache(cache_directory, 4);
+    (void)cache.get_clickabledata(dcs_install_path, "A-10C", lua_script);
+
+    // Expect the in-memory entry to be served until the module is invalidated, without scanning module files.
+    write_clickabledata("A-10C", "elements = {'A-10C_1', 'A-10C_2', 'A-10C_3'}\n");
+    json result = clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script));
+    EXPECT_EQ(2, result["clickabledata_items"].size());
+    EXPECT_EQ(1, cache.get_stats().memory_hits);
+
+    cache.invalidate_module(dcs_install_path, "A-10C");
+    result = clickabledata_to_json(cache.get_clickabledata(dcs_install_path, "A-10C", lua_script));
+    EXPECT_EQ(3, result["clickabledata_items"].size());
+    EXPECT_EQ(2, cache.get_stats().misses);
+
+    // Expect the out of date index on disk to be replaced as well.
+    ClickabledataCache new_cache(cache_directory, 4);
+    EXPECT_EQ(result, clickabledata_to_json(new_cache.get_clickabledata(dcs_install_path, "A-10C", lua_script)));
+    EXPECT_EQ(1, new_cache.get_stats().disk_hits);
+}
+
+TEST_F(ClickabledataCacheTestFixture, invalidated_module_dropped_from_memory) {
+    ClickabledataCache cache(cache_directory, 4);
+    (void)cache.get_clickabledata(dcs_install_path, "A-10C", lua_script);
+    (void)cache.get_clickabledata(dcs_install_path, "F-16C_50", lua_script);
+
+    cache.invalidate_module(dcs_install_path, "A-10C");
+    cache.invalidate_module("Other DCS World", "F-16C_50");
+    EXPECT_EQ(1, cache.get_stats().invalidations);
+
+    // Expect the invalidated module to be read from disk, and the other module to remain in memory.
+    (void)cache.get_clickabledata(dcs_install_path, "A-10C", lua_script);
+    (void)cache.get_clickabledata(dcs_install_path, "F-16C_50", lua_script);
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(1, stats.disk_hits);
+    EXPECT_EQ(1, stats.memory_hits);
+}
+
+TEST_F(ClickabledataCacheTestFixture, least_recently_used_evicted_from_memory) {
+    ClickabledataCache cache(cache_directory, 1);
+    (void)cache.get_clickabledata(dcs_install_path, "A-10C", lua_script);
+    (void)cache.get_clickabledata(dcs_install_path, "F-16C_50", lua_script);
+
+    // Expect the evicted module to be served from disk.
+    EXPECT_EQ(2, cache.get_clickabledata(dcs_install_path, "A-10C", lua_script).elements.size());
+    const auto stats = cache.get_stats();
+    EXPECT_EQ(2, stats.misses);
+    EXPECT_EQ(1, stats.disk_hits);
+    EXPECT_EQ(0, stats.memory_hits);
+}
+
+TEST_F(ClickabledataCacheTestFixture, corrupt_index_file_is_ignored) {
+    {
+        ClickabledataCache cache(cache_directory, 4);
+        (void)cache.get_clickabledata(dcs_install_path, "A-10C", lua_script);
+    }
+    for (const auto &file : std::filesystem::directory_iterator(cache_directory)) {
+        std::filesystem::resize_file(file.path(), 20);
+    }
+
+    ClickabledataCache cache(cache_directory, 4);
+    EXPECT_EQ(2, cache.get_clickabledata(dcs_install_path, "A-10C", lua_script).elements.size());
+    EXPECT_EQ(1, cache.get_stats().misses);
+}
+
+TEST_F(ClickabledataCacheTestFixture, search_index_kept_with_cached_entry) {
+    ClickabledataCache cache(cache_directory, 4);
+    std::string result;
+    const auto search_index = cache.get_search_index(dcs_install_path, "A-10C", lua_script, result);
+    EXPECT_EQ("success", result);
+    ASSERT_NE(nullptr, search_index);
+    EXPECT_EQ(2, search_index->search("a-10c_", 10).total_matches);
+    EXPECT_EQ(search_index, cache.get_search_index(dcs_install_path, "A-10C", lua_script, result));
+    EXPECT_EQ(1, cache.get_stats().memory_hits);
+
+    EXPECT_EQ(nullptr, cache.get_search_index(dcs_install_path, "non-existant-module", lua_script, result));
+    EXPECT_NE("success", result);
+}
+
+TEST_F(ClickabledataCacheTestFixture, failed_extraction_not_cached) {
+    write_clickabledata("Broken", "elements = nil\n");
+    ClickabledataCache cache(cache_directory, 4);
+    EXPECT_NE("success", cache.get_clickabledata(dcs_install_path, "Broken", lua_script).result);
+    EXPECT_NE("success", cache.get_clickabledata(dcs_install_path, "Broken", lua_script).result);
+    EXPECT_EQ(2, cache.get_stats().misses);
+}
+
+} // namespace test
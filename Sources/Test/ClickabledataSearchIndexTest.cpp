@@ -0,0 +1,76 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/ClickabledataSearchIndex.cpp"
+
+namespace test {
+
+class ClickabledataSearchIndexTestFixture : public ::testing::Test {
+  public:
+    ClickabledataSearchIndexTestFixture()
+        : index({{"UFC", "25", "3001", "pnt_1", "BTN", "101", "1", "0", "1", "UFC Button 1"},
+                 {"UFC", "25", "3002", "pnt_2", "BTN", "25", "1", "0", "1", "UFC Button 2"},
+                 {"Master Arm", "12", "3005", "pnt_250", "TUMB", "250", "1", "0", "1", "Master Arm Switch"},
+                 {"Lights", "7", "3010", "pnt_300", "LEV", "300", "0.1", "0", "1", "Console lights brightness"}}) {}
+
+    // Returns the element names of the search results.
+    std::vector<std::string> search(const std::string &query, const size_t max_results = 10) {
+        std::vector<std::string> names;
+        for (const size_t element_index : index.search(query, max_results).element_indices) {
+            names.push_back(index.get_elements()[element_index].element);
+        }
+        return names;
+    }
+
+    ClickabledataSearchIndex index;
+};
+
+TEST_F(ClickabledataSearchIndexTestFixture, empty_query_lists_all_in_display_order) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_300", "pnt_250", "pnt_1", "pnt_2"}), search(""));
+    EXPECT_EQ(std::vector<std::string>({"pnt_300", "pnt_250"}), search("  ", 2));
+    EXPECT_EQ(4, index.search("", 2).total_matches);
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, substring_query_is_case_insensitive) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_250"}), search("arm sw"));
+    EXPECT_EQ(std::vector<std::string>({"pnt_300"}), search("BRIGHT"));
+    EXPECT_EQ(std::vector<std::string>({"pnt_300"}), search("ightne"));
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, every_term_must_match) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_2"}), search("ufc 2"));
+    EXPECT_TRUE(search("ufc brightness").empty());
+    EXPECT_EQ(0, index.search("ufc brightness", 10).total_matches);
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, trigrams_must_be_in_one_field) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_250"}), search("_25"));
+    // "UFC" and "25" are the device and arg of pnt_2, but a term must be within a single field.
+    EXPECT_TRUE(search("ufc25").empty());
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, short_terms_match_word_prefixes) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_300"}), search("co"));
+    EXPECT_TRUE(search("on").empty()); // Not the start of a word.
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, exact_arg_ranked_first) {
+    EXPECT_EQ(std::vector<std::string>({"pnt_2", "pnt_250"}), search("25"));
+    EXPECT_EQ(std::vector<std::string>({"pnt_2", "pnt_250"}), search("PNT_2 "));
+}
+
+TEST_F(ClickabledataSearchIndexTestFixture, max_results_limits_returned_matches) {
+    const auto results = index.search("pnt", 1);
+    EXPECT_EQ(1, results.element_indices.size());
+    EXPECT_EQ(4, results.total_matches);
+}
+
+TEST(ClickabledataSearchIndexTest, empty_index) {
+    ClickabledataSearchIndex index({});
+    EXPECT_EQ(0, index.search("", 10).total_matches);
+    EXPECT_EQ(0, index.search("abc", 10).total_matches);
+    EXPECT_EQ(0, index.search("a", 10).total_matches);
+}
+
+} // namespace test
@@ -0,0 +1,56 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/CommandShard.cpp"
+
+namespace test {
+
+const std::vector<ClickabledataElement> kElements = {
+    {"UFC", "25", "3002", "pnt_2", "BTN", "102", "1", "0", "1", "UFC Button 2"},
+    {"AAP", "22", "3001", "pnt_1", "TUMB", "101", "0.1", "0", "1", "Steer, \"Pt\" Selector"},
+    {"UFC", "25", "3001", "pnt_1", "BTN", "101", "1", "0", "1", ""}};
+
+TEST(CommandShardTest, encode_calls_register_function) {
+    const std::string shard = encode_command_shard("A-10C", kElements);
+    EXPECT_EQ(0, shard.find("registerCommandShard({"));
+    EXPECT_EQ(shard.size() - 4, shard.rfind("});\n"));
+}
+
+TEST(CommandShardTest, round_trip_in_display_order) {
+    std::string module_name;
+    const auto elements = decode_command_shard(encode_command_shard("F/A-18C", kElements), module_name);
+    EXPECT_EQ("F/A-18C", module_name);
+    ASSERT_EQ(3, elements.size());
+    EXPECT_EQ("AAP(22),3001,pnt_1,TUMB,101,0.1,0,1,Steer, \"Pt\" Selector", format_clickabledata_element(elements[0]));
+    EXPECT_EQ("UFC(25),3001,pnt_1,BTN,101,1,0,1,", format_clickabledata_element(elements[1]));
+    EXPECT_EQ("UFC(25),3002,pnt_2,BTN,102,1,0,1,UFC Button 2", format_clickabledata_element(elements[2]));
+}
+
+TEST(CommandShardTest, repeated_values_stored_once) {
+    const std::string shard = encode_command_shard("A-10C", kElements);
+    const json contents = json::parse(shard.substr(21, shard.size() - 24));
+    // "1" is the most frequent value so is numbered first.
+    EXPECT_EQ("1", contents["strings"][0]);
+    EXPECT_EQ(1, std::count(contents["strings"].begin(), contents["strings"].end(), "UFC"));
+    EXPECT_EQ(3 * 10, contents["rows"].size());
+}
+
+TEST(CommandShardTest, empty_module) {
+    std::string module_name;
+    EXPECT_TRUE(decode_command_shard(encode_command_shard("Empty", {}), module_name).empty());
+    EXPECT_EQ("Empty", module_name);
+}
+
+TEST(CommandShardTest, malformed_shards_throw) {
+    std::string module_name;
+    EXPECT_THROW(decode_command_shard("", module_name), std::runtime_error);
+    EXPECT_THROW(decode_command_shard("var cached_commands = {};\n", module_name), std::runtime_error);
+    EXPECT_THROW(decode_command_shard("registerCommandShard({\"module\": 1});\n", module_name), std::runtime_error);
+
+    std::string shard = encode_command_shard("A-10C", kElements);
+    shard.replace(shard.find("\"rows\":[") + 8, 1, "99");
+    EXPECT_THROW(decode_command_shard(shard, module_name), std::runtime_error);
+}
+
+} // namespace test
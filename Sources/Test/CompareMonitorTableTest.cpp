@@ -0,0 +1,122 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/CompareMonitorTable.cpp"
+
+#include <cmath>
+
+namespace test {
+
+TEST(CompareMonitorTableTest, compare_conditions) {
+    EXPECT_TRUE(CompareMonitorTable::compare(2.0, GREATER_THAN, 1.0));
+    EXPECT_FALSE(CompareMonitorTable::compare(1.0, GREATER_THAN, 1.0));
+    EXPECT_TRUE(CompareMonitorTable::compare(1.0, EQUAL_TO, 1.0));
+    EXPECT_FALSE(CompareMonitorTable::compare(1.5, EQUAL_TO, 1.0));
+    EXPECT_TRUE(CompareMonitorTable::compare(-1.0, LESS_THAN, 0.0));
+    EXPECT_FALSE(CompareMonitorTable::compare(0.0, LESS_THAN, 0.0));
+}
+
+TEST(CompareMonitorTableTest, compare_nan_never_satisfied) {
+    EXPECT_FALSE(CompareMonitorTable::compare(NAN, GREATER_THAN, 0.0));
+    EXPECT_FALSE(CompareMonitorTable::compare(NAN, EQUAL_TO, 0.0));
+    EXPECT_FALSE(CompareMonitorTable::compare(NAN, LESS_THAN, 0.0));
+}
+
+TEST(CompareMonitorTableTest, rows_reused_after_remove) {
+    CompareMonitorTable table;
+    const size_t row_a = table.add(CompareMonitor{1, GREATER_THAN, 0.0});
+    const size_t row_b = table.add(std::nullopt);
+    EXPECT_NE(row_a, row_b);
+    EXPECT_EQ(1, table.active_rows());
+
+    table.remove(row_a);
+    EXPECT_EQ(0, table.active_rows());
+    EXPECT_EQ(row_a, table.add(CompareMonitor{2, LESS_THAN, 0.0}));
+    EXPECT_EQ(1, table.active_rows());
+
+    // Removing a row twice has no further effect.
+    table.remove(row_b);
+    table.remove(row_b);
+    EXPECT_EQ(row_b, table.add(std::nullopt));
+    EXPECT_EQ(row_b + 1, table.add(std::nullopt));
+}
+
+class CompareMonitorTableTestFixture : public ::testing::Test {
+  public:
+    CompareMonitorTableTestFixture()
+        : // Mock DCS socket uses the reverse rx and tx ports of dcs_interface so it can communicate with it.
+          mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port),
+          dcs_interface(connection_settings) {
+
+        // Consume intial reset command sent to to mock_dcs.
+        (void)mock_dcs.DcsReceive();
+
+        std::string mock_dcs_message = "header*761=1:765=2.00:2026=TEXT_STR:2027=0.1";
+        mock_dcs.DcsSend(mock_dcs_message);
+        dcs_interface.update_dcs_state();
+    }
+
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1"};
+    DcsSocket mock_dcs;         // A socket that will mock Send/Receive messages from DCS.
+    DcsInterface dcs_interface; // DCS Interface to test.
+    CompareMonitorTable table;
+};
+
+TEST_F(CompareMonitorTableTestFixture, evaluate_rows) {
+    const size_t row_equal = table.add(CompareMonitor{765, EQUAL_TO, 2.0});
+    const size_t row_greater = table.add(CompareMonitor{2027, GREATER_THAN, 0.5});
+    const size_t row_less = table.add(CompareMonitor{2027, LESS_THAN, 0.5});
+    const size_t row_string = table.add(CompareMonitor{2026, GREATER_THAN, 0.0});
+    const size_t row_missing = table.add(CompareMonitor{999, LESS_THAN, 100.0});
+    const size_t row_inactive = table.add(std::nullopt);
+    table.evaluate(&dcs_interface);
+
+    EXPECT_EQ(1, table.state(row_equal));
+    EXPECT_EQ(0, table.state(row_greater));
+    EXPECT_EQ(1, table.state(row_less));
+    EXPECT_EQ(0, table.state(row_string));
+    EXPECT_EQ(0, table.state(row_missing));
+    EXPECT_EQ(0, table.state(row_inactive));
+
+    // Expect updated game values are gathered on the next evaluation.
+    mock_dcs.DcsSend("header*2027=0.9:999=1");
+    dcs_interface.update_dcs_state();
+    table.evaluate(&dcs_interface);
+    EXPECT_EQ(1, table.state(row_greater));
+    EXPECT_EQ(0, table.state(row_less));
+    EXPECT_EQ(1, table.state(row_missing));
+}
+
+TEST_F(CompareMonitorTableTestFixture, update_row) {
+    const size_t row = table.add(CompareMonitor{765, EQUAL_TO, 2.0});
+    table.evaluate(&dcs_interface);
+    EXPECT_EQ(1, table.state(row));
+
+    // Expect the previous state to be kept until the updated row is evaluated.
+    table.update(row, CompareMonitor{765, LESS_THAN, 2.0});
+    EXPECT_EQ(1, table.state(row));
+    table.evaluate(&dcs_interface);
+    EXPECT_EQ(0, table.state(row));
+
+    table.update(row, std::nullopt);
+    table.evaluate(&dcs_interface);
+    EXPECT_EQ(0, table.state(row));
+    EXPECT_EQ(0, table.active_rows());
+}
+
+TEST_F(CompareMonitorTableTestFixture, many_rows) {
+    // Alternate conditions over a large table to check each row is evaluated independently.
+    std::vector<size_t> rows;
+    for (int i = 0; i < 1000; ++i) {
+        const CompareConditionType condition = (i % 2 == 0) ? GREATER_THAN : LESS_THAN;
+        rows.push_back(table.add(CompareMonitor{765, condition, static_cast<double>(i % 4)}));
+    }
+    table.evaluate(&dcs_interface);
+    for (int i = 0; i < 1000; ++i) {
+        const bool expected = (i % 2 == 0) ? (2.0 > (i % 4)) : (2.0 < (i % 4));
+        EXPECT_EQ(expected ? 1 : 0, table.state(rows[i])) << "Row " << i;
+    }
+}
+
+} // namespace test
@@ -0,0 +1,302 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DcsBinaryProtocol.cpp"
+#include "../Vendor/lua-5.1.5/etc/lua.hpp"
+
+#include <filesystem>
+#include <limits>
+#include <map>
+#include <set>
+
+namespace test {
+
+// Runs Lua code with the reference export-side encoder loaded, returning the global "packets" it sets as strings.
+std::vector<std::string> run_export_script_encoder(const std::string &lua_code) {
+    lua_State *lua_state = luaL_newstate();
+    luaL_openlibs(lua_state);
+    const auto module_path =
+        std::filesystem::path(__FILE__).parent_path() / "../DcsExportScripts/StreamdeckBinaryExport.lua";
+    if (luaL_dofile(lua_state, module_path.string().c_str()) != 0 || luaL_dostring(lua_state, lua_code.c_str()) != 0) {
+        const std::string error = lua_tostring(lua_state, -1);
+        lua_close(lua_state);
+        throw std::runtime_error(error);
+    }
+    std::vector<std::string> packets;
+    lua_getglobal(lua_state, "packets");
+    for (int i = 1; i <= static_cast<int>(lua_objlen(lua_state, -1)); ++i) {
+        lua_rawgeti(lua_state, -1, i);
+        size_t length = 0;
+        const char *packet = lua_tolstring(lua_state, -1, &length);
+        packets.emplace_back(packet, length);
+        lua_pop(lua_state, 1);
+    }
+    lua_close(lua_state);
+    return packets;
+}
+
+// Decodes a packet, expecting it to be valid, and returns its values by DCS ID (or by key for named strings).
+std::map<std::string, BinaryExportValue> decode_by_key(const std::string &packet) {
+    std::vector<BinaryExportValue> values;
+    EXPECT_TRUE(decode_binary_export_packet(packet, values));
+    std::map<std::string, BinaryExportValue> values_by_key;
+    for (const auto &value : values) {
+        values_by_key[value.type == BINARY_NAMED_STRING ? std::string(value.key) : std::to_string(value.dcs_id)] =
+            value;
+    }
+    return values_by_key;
+}
+
+TEST(DcsBinaryProtocolTest, detects_binary_packets) {
+    EXPECT_TRUE(is_binary_export_packet(std::string(kBinaryExportHeader) + "\x08\x02"));
+    EXPECT_TRUE(is_binary_export_packet(std::string(kBinaryExportHeader)));
+    EXPECT_FALSE(is_binary_export_packet("header*761=1:765=2.00"));
+    EXPECT_FALSE(is_binary_export_packet(""));
+    EXPECT_TRUE(is_binary_export_packet(std::string(kSequencedBinaryExportHeader)));
+    EXPECT_FALSE(is_binary_export_packet(std::string("\0SDB\3", 5)));
+}
+
+TEST(DcsBinaryProtocolTest, decode_all_types) {
+    std::string packet(kBinaryExportHeader);
+    packet += std::string("\xC8\x2F\x00\x00\x80\x3E", 6); // 761 float: 0.25
+    packet += "\x11\x07";                                 // 2 int: -4 (zigzag 7)
+    packet += "\x1A";                                     // 3 false
+    packet += "\x23";                                     // 4 true
+    packet += "\x2C\x03" "ABC";                           // 5 string: "ABC"
+    packet += "\x05\x04" "File" "\x08" "F-16C_50";        // named string: File=F-16C_50
+
+    std::vector<BinaryExportValue> values;
+    ASSERT_TRUE(decode_binary_export_packet(packet, values));
+    ASSERT_EQ(6, values.size());
+    EXPECT_EQ(BINARY_FLOAT32, values[0].type);
+    EXPECT_EQ(761, values[0].dcs_id);
+    EXPECT_EQ(0.25, values[0].number);
+    EXPECT_EQ(BINARY_INT, values[1].type);
+    EXPECT_EQ(2, values[1].dcs_id);
+    EXPECT_EQ(-4, values[1].number);
+    EXPECT_EQ(std::string("\x11\x07"), values[1].encoded);
+    EXPECT_EQ(BINARY_FALSE, values[2].type);
+    EXPECT_EQ(0, values[2].number);
+    EXPECT_EQ(BINARY_TRUE, values[3].type);
+    EXPECT_EQ(1, values[3].number);
+    EXPECT_EQ(BINARY_STRING, values[4].type);
+    EXPECT_EQ(5, values[4].dcs_id);
+    EXPECT_EQ("ABC", values[4].str);
+    EXPECT_EQ(BINARY_NAMED_STRING, values[5].type);
+    EXPECT_EQ("File", values[5].key);
+    EXPECT_EQ("F-16C_50", values[5].str);
+}
+
+TEST(DcsBinaryProtocolTest, decode_empty_packet) {
+    std::vector<BinaryExportValue> values = {BinaryExportValue{}};
+    EXPECT_TRUE(decode_binary_export_packet(kBinaryExportHeader, values));
+    EXPECT_EQ(0, values.size());
+}
+
+TEST(DcsBinaryProtocolTest, decode_text_packet_fails) {
+    std::vector<BinaryExportValue> values;
+    EXPECT_FALSE(decode_binary_export_packet("header*761=1", values));
+    EXPECT_EQ(0, values.size());
+}
+
+TEST(DcsBinaryProtocolTest, decode_malformed_packets) {
+    const std::string valid_value = "\x11\x07";
+    const std::vector<std::string> malformed_values = {
+        std::string("\x00\x00\x80", 3), // Truncated float.
+        "\x11",                         // Missing int.
+        "\x11\x80",                     // Truncated int varint.
+        "\x2C\x05" "ABC",               // Truncated string.
+        "\x2C",                         // Missing string length.
+        "\x05\x04" "File",              // Named string missing its value.
+        "\x0E",                         // Unknown type.
+        "\x80\x80\x80\x80\x80\x01"};    // Varint longer than 32 bits.
+
+    for (const auto &malformed_value : malformed_values) {
+        std::vector<BinaryExportValue> values;
+        EXPECT_FALSE(
+            decode_binary_export_packet(std::string(kBinaryExportHeader) + valid_value + malformed_value, values));
+        // Values before the malformed value are decoded.
+        ASSERT_EQ(1, values.size());
+        EXPECT_EQ(-4, values[0].number);
+    }
+}
+
+TEST(DcsBinaryProtocolTest, decode_sequenced_packet) {
+    std::string packet(kSequencedBinaryExportHeader);
+    packet += "\xAC\x02";                            // Sequence 300.
+    packet += "\x03";                                // Stream start keyframe.
+    packet += std::string("\x78\x56\x34\x12", 4);    // Checksum 0x12345678.
+    packet += "\x11\x07";                            // 2 int: -4
+
+    BinaryExportFrame frame;
+    std::vector<BinaryExportValue> values;
+    ASSERT_TRUE(decode_binary_export_packet(packet, frame, values));
+    EXPECT_TRUE(frame.is_sequenced);
+    EXPECT_EQ(300, frame.sequence);
+    EXPECT_TRUE(frame.is_stream_start);
+    EXPECT_TRUE(frame.is_keyframe);
+    EXPECT_EQ(0x12345678, frame.checksum);
+    ASSERT_EQ(1, values.size());
+    EXPECT_EQ(-4, values[0].number);
+
+    // Delta packets have no checksum.
+    packet = std::string(kSequencedBinaryExportHeader) + "\x01" + std::string("\x00", 1) + "\x11\x07";
+    ASSERT_TRUE(decode_binary_export_packet(packet, frame, values));
+    EXPECT_EQ(1, frame.sequence);
+    EXPECT_FALSE(frame.is_stream_start);
+    EXPECT_FALSE(frame.is_keyframe);
+    EXPECT_EQ(1, values.size());
+
+    // Unsequenced packets.
+    ASSERT_TRUE(decode_binary_export_packet(std::string(kBinaryExportHeader) + "\x11\x07", frame, values));
+    EXPECT_FALSE(frame.is_sequenced);
+    EXPECT_EQ(1, values.size());
+}
+
+TEST(DcsBinaryProtocolTest, decode_truncated_sequenced_header) {
+    BinaryExportFrame frame;
+    std::vector<BinaryExportValue> values;
+    const std::string header(kSequencedBinaryExportHeader);
+    EXPECT_FALSE(decode_binary_export_packet(header, frame, values));
+    EXPECT_FALSE(decode_binary_export_packet(header + "\x81", frame, values));
+    EXPECT_FALSE(decode_binary_export_packet(header + "\x01", frame, values));
+    EXPECT_FALSE(decode_binary_export_packet(header + "\x01\x01\x78\x56\x34", frame, values));
+}
+
+TEST(DcsBinaryProtocolTest, hash_values) {
+    EXPECT_EQ(0, hash_binary_export_value(""));
+    EXPECT_EQ(65599 + 2, hash_binary_export_value("\x01\x02"));
+    EXPECT_NE(hash_binary_export_value("\x11\x07"), hash_binary_export_value("\x11\x08"));
+}
+
+// Builds a decoded number value with every field initialized.
+BinaryExportValue number_value(const BinaryExportValueType type, const double number) {
+    return {type, 1, number, std::string_view(), std::string_view(), std::string_view()};
+}
+
+TEST(DcsBinaryProtocolTest, format_numbers) {
+    EXPECT_EQ("1", format_binary_export_number(number_value(BINARY_INT, 1.0)));
+    EXPECT_EQ("-12", format_binary_export_number(number_value(BINARY_INT, -12.0)));
+    EXPECT_EQ("1", format_binary_export_number(number_value(BINARY_TRUE, 1.0)));
+    EXPECT_EQ("0", format_binary_export_number(number_value(BINARY_FALSE, 0.0)));
+    EXPECT_EQ("0.25", format_binary_export_number(number_value(BINARY_FLOAT32, 0.25)));
+    EXPECT_EQ("0.1", format_binary_export_number(number_value(BINARY_FLOAT32, static_cast<double>(0.1f))));
+    EXPECT_EQ("2", format_binary_export_number(number_value(BINARY_FLOAT32, 2.0)));
+    EXPECT_EQ("-1234.568", format_binary_export_number(number_value(BINARY_FLOAT32, static_cast<double>(-1234.5678f))));
+}
+
+TEST(DcsBinaryProtocolTest, export_script_encodes_value_types) {
+    const auto packets = run_export_script_encoder(
+        "packets = {StreamdeckBinaryExport.encode_packet({[761] = 1, [762] = -5, [763] = 0.25, [764] = '0.1', "
+        "[765] = '2.00', [766] = true, [767] = false, [768] = 'TEXT', [769] = '08', [770] = -0.3, [771] = 1e-40, "
+        "[772] = 3e38, [773] = 1e39, [774] = 5000000000, [775] = '', File = 'F-16C_50'})}");
+    ASSERT_EQ(1, packets.size());
+    auto values = decode_by_key(packets[0]);
+    ASSERT_EQ(16, values.size());
+
+    EXPECT_EQ(BINARY_INT, values["761"].type);
+    EXPECT_EQ(1, values["761"].number);
+    EXPECT_EQ(BINARY_INT, values["762"].type);
+    EXPECT_EQ(-5, values["762"].number);
+    EXPECT_EQ(BINARY_FLOAT32, values["763"].type);
+    EXPECT_EQ(0.25, values["763"].number);
+    // Numbers given as text are encoded as numbers only if their text is unchanged by float32 precision.
+    EXPECT_EQ(BINARY_FLOAT32, values["764"].type);
+    EXPECT_EQ(0.1f, values["764"].number);
+    EXPECT_EQ(BINARY_STRING, values["765"].type);
+    EXPECT_EQ("2.00", values["765"].str);
+    EXPECT_EQ(BINARY_TRUE, values["766"].type);
+    EXPECT_EQ(BINARY_FALSE, values["767"].type);
+    EXPECT_EQ(BINARY_STRING, values["768"].type);
+    EXPECT_EQ("TEXT", values["768"].str);
+    EXPECT_EQ(BINARY_STRING, values["769"].type);
+    EXPECT_EQ("08", values["769"].str);
+    // Floats are rounded to the nearest float32, including subnormal and infinite values.
+    EXPECT_EQ(-0.3f, values["770"].number);
+    EXPECT_EQ(static_cast<double>(1e-40f), values["771"].number);
+    EXPECT_EQ(3e38f, values["772"].number);
+    EXPECT_EQ(std::numeric_limits<double>::infinity(), values["773"].number);
+    EXPECT_EQ(BINARY_FLOAT32, values["774"].type);
+    EXPECT_EQ(5000000000.0f, values["774"].number);
+    EXPECT_EQ(BINARY_STRING, values["775"].type);
+    EXPECT_EQ("", values["775"].str);
+    EXPECT_EQ(BINARY_NAMED_STRING, values["File"].type);
+    EXPECT_EQ("F-16C_50", values["File"].str);
+}
+
+TEST(DcsBinaryProtocolTest, export_script_encodes_float32_exactly) {
+    // Compare the encoding of many floats against the C++ conversion to float32.
+    const auto packets = run_export_script_encoder("local values = {} "
+                                                   "for i = 1, 2000 do values[i] = (i - 1000) * 0.0137 + i * 1e-9 end "
+                                                   "packets = StreamdeckBinaryExport.encode_packets(values, 1024)");
+    int num_values = 0;
+    for (const auto &packet : packets) {
+        for (const auto &[key, value] : decode_by_key(packet)) {
+            const int i = std::stoi(key);
+            EXPECT_EQ(static_cast<float>((i - 1000) * 0.0137 + i * 1e-9), value.number) << "value " << i;
+            ++num_values;
+        }
+    }
+    EXPECT_EQ(2000, num_values);
+}
+
+TEST(DcsBinaryProtocolTest, export_script_splits_packets) {
+    const auto packets = run_export_script_encoder("local values = {} "
+                                                   "for i = 1, 500 do values[i * 100] = 'VALUE' .. i end "
+                                                   "packets = StreamdeckBinaryExport.encode_packets(values, 200)");
+    EXPECT_GT(packets.size(), 1);
+    std::set<int> dcs_ids;
+    for (const auto &packet : packets) {
+        EXPECT_LE(packet.size(), 200);
+        for (const auto &[key, value] : decode_by_key(packet)) {
+            EXPECT_EQ("VALUE" + std::to_string(value.dcs_id / 100), value.str);
+            dcs_ids.insert(value.dcs_id);
+        }
+    }
+    EXPECT_EQ(500, dcs_ids.size());
+}
+
+TEST(DcsBinaryProtocolTest, export_script_stream) {
+    const auto packets = run_export_script_encoder(
+        "local stream = StreamdeckBinaryExport.new_stream() "
+        "packets = stream:encode_packets({[761] = 1, [765] = 0.5, File = 'F-16C_50'}, 1024) "
+        "for _, packet in ipairs(stream:encode_packets({[765] = 0.75}, 1024)) do packets[#packets + 1] = packet end "
+        "for _, packet in ipairs(stream:encode_packets({}, 1024)) do packets[#packets + 1] = packet end "
+        "local values = {} for i = 1, 300 do values[i] = 'VALUE' .. i end "
+        "for _, packet in ipairs(stream:encode_keyframe(values, 1024)) do packets[#packets + 1] = packet end "
+        "for _, packet in ipairs(stream:encode_keyframe({}, 1024)) do packets[#packets + 1] = packet end");
+
+    // Track the hash of the last value of each DCS ID to verify keyframe checksums.
+    std::map<int, uint32_t> hashes;
+    uint32_t expected_sequence = 0;
+    int num_keyframes = 0;
+    for (const auto &packet : packets) {
+        BinaryExportFrame frame;
+        std::vector<BinaryExportValue> values;
+        ASSERT_TRUE(decode_binary_export_packet(packet, frame, values));
+        EXPECT_LE(packet.size(), 1024);
+        EXPECT_TRUE(frame.is_sequenced);
+        EXPECT_EQ(expected_sequence++, frame.sequence);
+        EXPECT_EQ(frame.sequence == 0, frame.is_stream_start);
+        for (const auto &value : values) {
+            if (value.type != BINARY_NAMED_STRING) {
+                hashes[value.dcs_id] = hash_binary_export_value(value.encoded);
+            }
+        }
+        if (frame.is_keyframe) {
+            uint32_t checksum = 0;
+            for (const auto &[dcs_id, hash] : hashes) {
+                checksum += hash;
+            }
+            EXPECT_EQ(checksum, frame.checksum);
+            ++num_keyframes;
+        }
+    }
+    // Empty delta packets are not sent, keyframes of many values are split with only the last a keyframe.
+    EXPECT_GT(packets.size(), 4);
+    EXPECT_EQ(2, num_keyframes);
+    EXPECT_EQ(302, hashes.size());
+}
+
+} // namespace test
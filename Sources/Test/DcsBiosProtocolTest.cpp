@@ -0,0 +1,126 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DcsBiosProtocol.cpp"
+
+#include <set>
+
+namespace test {
+
+// Encodes a DCS-BIOS write record of 16-bit words starting at an address.
+std::string dcs_bios_write(const uint16_t address, const std::vector<uint16_t> &words) {
+    const uint16_t count = static_cast<uint16_t>(words.size() * 2);
+    std::string record = {static_cast<char>(address & 0xFF),
+                          static_cast<char>(address >> 8),
+                          static_cast<char>(count & 0xFF),
+                          static_cast<char>(count >> 8)};
+    for (const uint16_t word : words) {
+        record += static_cast<char>(word & 0xFF);
+        record += static_cast<char>(word >> 8);
+    }
+    return record;
+}
+
+TEST(DcsBiosProtocolTest, detects_dcs_bios_packets) {
+    EXPECT_TRUE(is_dcs_bios_packet(std::string(kDcsBiosSync) + dcs_bios_write(0x4426, {1})));
+    EXPECT_FALSE(is_dcs_bios_packet("header*761=1"));
+    EXPECT_FALSE(is_dcs_bios_packet("\x55\x55\x55"));
+}
+
+TEST(DcsBiosProtocolTest, parse_outputs) {
+    DcsBiosOutput output;
+    ASSERT_TRUE(parse_dcs_bios_output("0x4426/0x0100/8", output));
+    EXPECT_EQ(0x4426, output.address);
+    EXPECT_EQ(0x0100, output.mask);
+    EXPECT_EQ(8, output.shift);
+
+    ASSERT_TRUE(parse_dcs_bios_output("17446/65535/0", output));
+    EXPECT_EQ(0x4426, output.address);
+    EXPECT_EQ(0xFFFF, output.mask);
+    EXPECT_EQ(0, output.shift);
+
+    EXPECT_FALSE(parse_dcs_bios_output("0x4427/0x0100/8", output)); // Odd address.
+    EXPECT_FALSE(parse_dcs_bios_output("0x4426/0x0500/8", output)); // Mask not contiguous.
+    EXPECT_FALSE(parse_dcs_bios_output("0x4426/0x0100/7", output)); // Shift not matching mask.
+    EXPECT_FALSE(parse_dcs_bios_output("0x4426/0x0000/0", output)); // Empty mask.
+    EXPECT_FALSE(parse_dcs_bios_output("0x14426/0x0100/8", output));
+    EXPECT_FALSE(parse_dcs_bios_output("0x4426/0x0100", output));
+    EXPECT_FALSE(parse_dcs_bios_output("0x4426/-256/8", output));
+    EXPECT_FALSE(parse_dcs_bios_output("761", output));
+    EXPECT_FALSE(parse_dcs_bios_output("", output));
+}
+
+TEST(DcsBiosProtocolTest, outputs_convert_to_distinct_negative_dcs_ids) {
+    std::set<int> dcs_ids;
+    for (const auto &text : {"0x0000/0x0001/0", "0x4426/0x0100/8", "0x4426/0x0300/8", "0x4426/0xffff/0",
+                             "0x4428/0x0100/8", "0xfffe/0x8000/15"}) {
+        DcsBiosOutput output;
+        ASSERT_TRUE(parse_dcs_bios_output(text, output));
+        const int dcs_id = dcs_bios_output_to_dcs_id(output);
+        EXPECT_LT(dcs_id, 0);
+        dcs_ids.insert(dcs_id);
+
+        DcsBiosOutput converted_output;
+        ASSERT_TRUE(dcs_id_to_dcs_bios_output(dcs_id, converted_output));
+        EXPECT_EQ(output.address, converted_output.address);
+        EXPECT_EQ(output.mask, converted_output.mask);
+        EXPECT_EQ(output.shift, converted_output.shift);
+    }
+    EXPECT_EQ(6, dcs_ids.size());
+
+    DcsBiosOutput output;
+    EXPECT_FALSE(dcs_id_to_dcs_bios_output(761, output));
+    EXPECT_FALSE(dcs_id_to_dcs_bios_output(0, output));
+}
+
+TEST(DcsBiosProtocolTest, state_buffer_applies_writes) {
+    DcsBiosStateBuffer state;
+    EXPECT_FALSE(state.is_written(0x4426));
+
+    // Test that records before the first sync are ignored.
+    state.parse(dcs_bios_write(0x4426, {0x1234}));
+    EXPECT_FALSE(state.is_written(0x4426));
+
+    state.parse(std::string(kDcsBiosSync) + dcs_bios_write(0x4426, {0x0180, 0xBEEF}) + dcs_bios_write(0x1000, {7}));
+    EXPECT_EQ(1, state.frame_count());
+    EXPECT_TRUE(state.is_written(0x4426));
+    EXPECT_TRUE(state.is_written(0x4428));
+    EXPECT_FALSE(state.is_written(0x442A));
+    EXPECT_EQ(0x0180, state.read_word(0x4426));
+    EXPECT_EQ(0xBEEF, state.read_word(0x4428));
+    EXPECT_EQ(1, state.read({0x4426, 0x0100, 8}));
+    EXPECT_EQ(0x80, state.read({0x4426, 0x00FF, 0}));
+    EXPECT_EQ(std::vector<uint16_t>({0x4426, 0x4428, 0x1000}), state.dirty_words());
+
+    // Test that only changed words are dirty.
+    state.clear_dirty_words();
+    state.parse(std::string(kDcsBiosSync) + dcs_bios_write(0x4426, {0x0180, 0xBEEE}) + dcs_bios_write(0x1000, {7}));
+    EXPECT_EQ(std::vector<uint16_t>({0x4428}), state.dirty_words());
+}
+
+TEST(DcsBiosProtocolTest, state_buffer_parses_split_stream) {
+    const std::string stream = std::string(kDcsBiosSync) + dcs_bios_write(0x2000, {1, 2, 3}) +
+                               std::string(kDcsBiosSync) + dcs_bios_write(0x2002, {5}) + dcs_bios_write(0xFFFE, {2});
+    DcsBiosStateBuffer state;
+    for (const char byte : stream) {
+        state.parse(std::string(1, byte));
+    }
+    EXPECT_EQ(2, state.frame_count());
+    EXPECT_EQ(1, state.read_word(0x2000));
+    EXPECT_EQ(5, state.read_word(0x2002));
+    EXPECT_EQ(3, state.read_word(0x2004));
+    EXPECT_EQ(2, state.read_word(0xFFFE));
+}
+
+TEST(DcsBiosProtocolTest, state_buffer_resyncs_after_truncated_record) {
+    DcsBiosStateBuffer state;
+    // A record truncated by a lost packet is abandoned at the next sync sequence.
+    state.parse(std::string(kDcsBiosSync) + dcs_bios_write(0x2000, {1, 2, 3}).substr(0, 7));
+    state.parse(std::string(kDcsBiosSync) + dcs_bios_write(0x3000, {9}));
+    EXPECT_EQ(2, state.frame_count());
+    EXPECT_EQ(9, state.read_word(0x3000));
+    EXPECT_EQ(1, state.read_word(0x2000));
+}
+
+} // namespace test
@@ -0,0 +1,61 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DcsCommandBatch.cpp"
+
+#include <algorithm>
+
+namespace test {
+
+TEST(DcsCommandBatchTest, encode_command) {
+    std::string message;
+    append_dcs_command(message, {3001, "24", "1"});
+    EXPECT_EQ("C24,3001,1", message);
+
+    message.clear();
+    append_dcs_command(message, {-2147483647 - 1, "1", "-0.25"});
+    EXPECT_EQ("C1,-2147483648,-0.25", message);
+}
+
+TEST(DcsCommandBatchTest, encode_batch) {
+    std::string batch;
+    EXPECT_TRUE(append_batched_dcs_command(batch, {3001, "24", "1"}));
+    // A batch of one command is identical to the command on its own.
+    EXPECT_EQ("C24,3001,1", batch);
+    EXPECT_TRUE(append_batched_dcs_command(batch, {3002, "24", "0"}));
+    EXPECT_TRUE(append_batched_dcs_command(batch, {3250, "1", "0.5"}));
+    EXPECT_EQ("C24,3001,1\nC24,3002,0\nC1,3250,0.5", batch);
+}
+
+TEST(DcsCommandBatchTest, full_batch) {
+    std::string batch;
+    int commands = 0;
+    while (append_batched_dcs_command(batch, {3000 + commands, "24", "0.125"})) {
+        ++commands;
+    }
+    // Each command "C24,30xx,0.125" is 14 bytes, plus a delimiter between commands.
+    EXPECT_EQ(66, commands);
+    EXPECT_LE(batch.size(), kMaxDcsCommandBatchLength);
+    EXPECT_EQ(commands, std::count(batch.begin(), batch.end(), kDcsCommandDelimiter) + 1);
+
+    // A command longer than the maximum is still appended to an empty batch, so it is sent on its own.
+    const std::string long_value(kMaxDcsCommandBatchLength, '1');
+    batch.clear();
+    EXPECT_TRUE(append_batched_dcs_command(batch, {3001, "24", long_value}));
+    EXPECT_FALSE(append_batched_dcs_command(batch, {3002, "24", "1"}));
+}
+
+TEST(DcsCommandBatchTest, encode_without_allocating) {
+    std::string batch;
+    batch.reserve(kMaxDcsCommandBatchLength);
+    const char *data = batch.data();
+    for (int i = 0; i < 100; ++i) {
+        batch.clear();
+        while (append_batched_dcs_command(batch, {3000 + i, "24", "1"})) {
+        }
+    }
+    EXPECT_EQ(data, batch.data());
+}
+
+} // namespace test
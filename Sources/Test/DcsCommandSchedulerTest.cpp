@@ -0,0 +1,113 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DcsCommandScheduler.cpp"
+
+namespace test {
+
+// Returns the messages sent from the queues in a new frame.
+std::vector<std::string> send_next_frame(DcsCommandScheduler &scheduler) {
+    scheduler.start_frame();
+    std::vector<std::string> messages;
+    std::string message;
+    while (scheduler.next_message(message)) {
+        messages.push_back(message);
+    }
+    return messages;
+}
+
+TEST(DcsCommandSchedulerTest, sends_within_budget) {
+    DcsCommandScheduler scheduler(2);
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,1"));
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3002,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3003,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3004,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3005,1"));
+    EXPECT_EQ(3, scheduler.get_stats().queue_depth[COMMAND_LANE_USER_INPUT]);
+
+    EXPECT_EQ(std::vector<std::string>({"C24,3003,1", "C24,3004,1"}), send_next_frame(scheduler));
+    // Messages are queued behind queued messages of their lane, even within the budget.
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3006,1"));
+    EXPECT_EQ(std::vector<std::string>({"C24,3005,1", "C24,3006,1"}), send_next_frame(scheduler));
+    EXPECT_TRUE(send_next_frame(scheduler).empty());
+
+    const DcsCommandQueueStats stats = scheduler.get_stats();
+    EXPECT_EQ(0, stats.queue_depth[COMMAND_LANE_USER_INPUT]);
+    EXPECT_EQ(3, stats.max_queue_depth[COMMAND_LANE_USER_INPUT]);
+    EXPECT_EQ(2, stats.sent_immediately);
+    EXPECT_EQ(4, stats.sent_deferred);
+    EXPECT_EQ(3, stats.frames);
+}
+
+TEST(DcsCommandSchedulerTest, user_input_sent_first) {
+    DcsCommandScheduler scheduler(1);
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_CONTROL, "R"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_CONTROL, "S761"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_AUTOMATED, "C24,3001,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3002,1"));
+
+    EXPECT_EQ(std::vector<std::string>({"C24,3002,1"}), send_next_frame(scheduler));
+    EXPECT_EQ(std::vector<std::string>({"C24,3001,1"}), send_next_frame(scheduler));
+    // Queued messages of lower priority lanes do not delay user input within the budget.
+    scheduler.start_frame();
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3003,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_AUTOMATED, "C24,3004,1"));
+    EXPECT_EQ(std::vector<std::string>({"C24,3004,1"}), send_next_frame(scheduler));
+    EXPECT_EQ(std::vector<std::string>({"S761"}), send_next_frame(scheduler));
+}
+
+TEST(DcsCommandSchedulerTest, coalesces_superseded_messages) {
+    DcsCommandScheduler scheduler(1);
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0.1", "C24,3001,"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0.2", "C24,3001,"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3002,1", "C24,3002,"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0.3", "C24,3001,"));
+    // Messages without a key, and messages of other lanes, are never coalesced.
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3003,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3003,0"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_AUTOMATED, "C24,3001,0.4", "C24,3001,"));
+
+    std::vector<std::string> messages;
+    for (int frame = 0; frame < 5; ++frame) {
+        const std::vector<std::string> frame_messages = send_next_frame(scheduler);
+        messages.insert(messages.end(), frame_messages.begin(), frame_messages.end());
+    }
+    EXPECT_EQ(std::vector<std::string>({"C24,3002,1", "C24,3001,0.3", "C24,3003,1", "C24,3003,0", "C24,3001,0.4"}),
+              messages);
+    EXPECT_EQ(1, scheduler.get_stats().coalesced);
+    EXPECT_EQ(4, scheduler.get_stats().max_queue_depth[COMMAND_LANE_USER_INPUT]);
+}
+
+TEST(DcsCommandSchedulerTest, coalesced_message_not_sent_ahead_of_messages_queued_in_between) {
+    DcsCommandScheduler scheduler(1);
+    EXPECT_TRUE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,1", "C24,3001,"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0.5", "C24,3001,"));
+    // A momentary press and release of the same button, which the latest position must follow.
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,1"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0"));
+    EXPECT_FALSE(scheduler.schedule(COMMAND_LANE_USER_INPUT, "C24,3001,0.7", "C24,3001,"));
+
+    std::vector<std::string> messages;
+    for (int frame = 0; frame < 4; ++frame) {
+        const std::vector<std::string> frame_messages = send_next_frame(scheduler);
+        messages.insert(messages.end(), frame_messages.begin(), frame_messages.end());
+    }
+    EXPECT_EQ(std::vector<std::string>({"C24,3001,1", "C24,3001,0", "C24,3001,0.7"}), messages);
+    EXPECT_EQ(1, scheduler.get_stats().coalesced);
+}
+
+TEST(DcsCommandSchedulerTest, set_messages_per_frame) {
+    DcsCommandScheduler scheduler(1);
+    for (int i = 0; i < 6; ++i) {
+        scheduler.schedule(COMMAND_LANE_AUTOMATED, "C24,300" + std::to_string(i) + ",1");
+    }
+    scheduler.set_messages_per_frame(3);
+    EXPECT_EQ(3, send_next_frame(scheduler).size());
+    // The budget is at least one message per frame.
+    scheduler.set_messages_per_frame(0);
+    EXPECT_EQ(1, send_next_frame(scheduler).size());
+    EXPECT_EQ(1, scheduler.get_stats().queue_depth[COMMAND_LANE_AUTOMATED]);
+}
+
+} // namespace test
@@ -5,6 +5,9 @@
 #include "../Common/EPLJSONUtils.h"
 #include "../DcsInterface/DcsIdLookup.cpp"
 
+#include <filesystem>
+#include <fstream>
+
 namespace test {
 
 TEST(DcsIdLookupTest, get_installed_modules_bad_path) {
@@ -23,4 +26,140 @@ TEST(DcsIdLookupTest, nonexistant_lua_file) {
     EXPECT_EQ(0, returned_values["clickabledata_items"].size());
 }
 
+ClickabledataElement make_element(const std::string &device, const std::string &element) {
+    return {device, "1", "3001", element, "BTN", "10", "1", "0", "1", "Hint for " + element};
+}
+
+TEST(DcsIdLookupTest, json_chunks_typed_rows_sorted) {
+    ClickabledataExtraction extraction;
+    extraction.elements = {make_element("UFC", "pnt_2"), make_element("AAP", "pnt_3"), make_element("UFC", "pnt_1")};
+    extraction.result = "success";
+    const std::vector<json> chunks = clickabledata_to_json_chunks(extraction, 32 * 1024);
+    ASSERT_EQ(1, chunks.size());
+    const json &chunk = chunks[0];
+    EXPECT_EQ(0, chunk["chunk_index"]);
+    EXPECT_EQ(1, chunk["num_chunks"]);
+    EXPECT_EQ(0, chunk["first_row"]);
+    EXPECT_EQ(3, chunk["total_rows"]);
+    EXPECT_EQ("success", chunk["result"]);
+    EXPECT_EQ(json({"device",
+                    "device_id",
+                    "command",
+                    "element",
+                    "class",
+                    "arg",
+                    "arg_value",
+                    "arg_lim_min",
+                    "arg_lim_max",
+                    "hint"}),
+              chunk["columns"]);
+    ASSERT_EQ(3, chunk["rows"].size());
+    EXPECT_EQ(json({"AAP", "1", "3001", "pnt_3", "BTN", "10", "1", "0", "1", "Hint for pnt_3"}), chunk["rows"][0]);
+    EXPECT_EQ("pnt_1", chunk["rows"][1][3]);
+    EXPECT_EQ("pnt_2", chunk["rows"][2][3]);
+}
+
+TEST(DcsIdLookupTest, json_chunks_bounded_in_size) {
+    constexpr size_t kMaxChunkBytes = 4096;
+    ClickabledataExtraction extraction;
+    for (int i = 0; i < 1000; ++i) {
+        extraction.elements.push_back(make_element("Device", "element_" + std::to_string(1000 + i)));
+    }
+    extraction.result = "success";
+    const std::vector<json> chunks = clickabledata_to_json_chunks(extraction, kMaxChunkBytes);
+    ASSERT_GT(chunks.size(), 1);
+
+    size_t next_row = 0;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        EXPECT_LE(chunks[i].dump().size(), kMaxChunkBytes);
+        EXPECT_EQ(i, chunks[i]["chunk_index"]);
+        EXPECT_EQ(chunks.size(), chunks[i]["num_chunks"]);
+        EXPECT_EQ(next_row, chunks[i]["first_row"]);
+        EXPECT_EQ("element_" + std::to_string(1000 + next_row), chunks[i]["rows"][0][3]);
+        next_row += chunks[i]["rows"].size();
+    }
+    EXPECT_EQ(1000, next_row);
+}
+
+TEST(DcsIdLookupTest, json_chunks_oversized_row_sent_alone) {
+    ClickabledataExtraction extraction;
+    extraction.elements = {make_element("A", "pnt_1"), make_element("B", std::string(1000, 'x'))};
+    extraction.result = "success";
+    const std::vector<json> chunks = clickabledata_to_json_chunks(extraction, 512);
+    ASSERT_EQ(2, chunks.size());
+    EXPECT_EQ(1, chunks[0]["rows"].size());
+    EXPECT_EQ(1, chunks[1]["rows"].size());
+}
+
+TEST(DcsIdLookupTest, json_chunks_failed_extraction) {
+    ClickabledataExtraction extraction;
+    extraction.result = "Lua file load error: 6";
+    const std::vector<json> chunks = clickabledata_to_json_chunks(extraction, 32 * 1024);
+    ASSERT_EQ(1, chunks.size());
+    EXPECT_EQ(0, chunks[0]["total_rows"]);
+    EXPECT_EQ(0, chunks[0]["rows"].size());
+    EXPECT_EQ("Lua file load error: 6", chunks[0]["result"]);
+}
+
+class DcsIdLookupLuaScriptTest : public ::testing::Test {
+  public:
+    DcsIdLookupLuaScriptTest() : lua_script((std::filesystem::temp_directory_path() / "DcsIdLookupTest.lua").string()) {}
+    ~DcsIdLookupLuaScriptTest() { std::filesystem::remove(lua_script); }
+
+    void write_lua_script(const std::string &contents) { std::ofstream(lua_script) << contents; }
+
+    std::string lua_script;
+};
+
+TEST_F(DcsIdLookupLuaScriptTest, emit_element_attributes) {
+    write_lua_script("emit_element{device = 'UFC', device_id = 25, command = 3001, element = 'pnt_1', class = 'BTN',\n"
+                     "             arg = 1, arg_value = 0.5, arg_lim_min = 0, arg_lim_max = 1, hint = module_name}\n");
+    const ClickabledataExtraction extraction = extract_clickabledata("path", "F/A-18C", lua_script);
+    EXPECT_EQ("success", extraction.result);
+    ASSERT_EQ(1, extraction.elements.size());
+    const ClickabledataElement &element = extraction.elements[0];
+    EXPECT_EQ("UFC", element.device);
+    EXPECT_EQ("25", element.device_id);
+    EXPECT_EQ("3001", element.command);
+    EXPECT_EQ("pnt_1", element.element);
+    EXPECT_EQ("BTN", element.class_name);
+    EXPECT_EQ("1", element.arg);
+    EXPECT_EQ("0.5", element.arg_value);
+    EXPECT_EQ("0", element.arg_lim_min);
+    EXPECT_EQ("1", element.arg_lim_max);
+    EXPECT_EQ("F/A-18C", element.hint);
+    EXPECT_EQ("UFC(25),3001,pnt_1,BTN,1,0.5,0,1,F/A-18C", format_clickabledata_element(element));
+}
+
+TEST_F(DcsIdLookupLuaScriptTest, emit_element_missing_attributes_are_empty) {
+    write_lua_script("emit_element{element = 'pnt_2', arg = {}}\n");
+    const json returned_values = get_clickabledata("path", "module", lua_script);
+    EXPECT_EQ("success", returned_values["result"]);
+    EXPECT_EQ(json({"(),,pnt_2,,,,,,"}), returned_values["clickabledata_items"]);
+}
+
+TEST_F(DcsIdLookupLuaScriptTest, emit_element_more_elements_than_lua_stack) {
+    // Returning this many values on the Lua stack would exceed its limit.
+    write_lua_script("for i = 1, 20000 do emit_element{element = 'elem_' .. i} end\n");
+    const ClickabledataExtraction extraction = extract_clickabledata("path", "module", lua_script);
+    EXPECT_EQ("success", extraction.result);
+    ASSERT_EQ(20000, extraction.elements.size());
+    EXPECT_EQ("elem_1", extraction.elements.front().element);
+    EXPECT_EQ("elem_20000", extraction.elements.back().element);
+}
+
+TEST_F(DcsIdLookupLuaScriptTest, emit_element_requires_table) {
+    write_lua_script("emit_element{element = 'pnt_1'}\nemit_element('pnt_2')\n");
+    const ClickabledataExtraction extraction = extract_clickabledata("path", "module", lua_script);
+    EXPECT_EQ("Lua script runtime error: 2", extraction.result);
+    EXPECT_EQ(0, extraction.elements.size());
+}
+
+TEST_F(DcsIdLookupLuaScriptTest, no_elements_emitted) {
+    write_lua_script("local x = 1\n");
+    const ClickabledataExtraction extraction = extract_clickabledata("path", "module", lua_script);
+    EXPECT_EQ("No clickabledata elements found", extraction.result);
+    EXPECT_EQ(0, extraction.elements.size());
+}
+
 } // namespace test
\ No newline at end of file
@@ -3,6 +3,12 @@
 #include "gtest/gtest.h"
 
 #include "../DcsInterface/DcsInterface.cpp"
+#include "../Vendor/lua-5.1.5/etc/lua.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <random>
 
 namespace test {
 
@@ -21,6 +27,113 @@ TEST(DcsInterfaceTest, dcs_reset_command_on_construction) {
     EXPECT_EQ("R", ss.str());
 }
 
+TEST(DcsInterfaceTest, forward_received_packets) {
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1", {"127.0.0.1:1625"}};
+    DcsSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    DcsSocket ikarus("127.0.0.1", "1625", "1626");
+    DcsInterface dcs_interface(connection_settings);
+    EXPECT_FALSE(dcs_interface.connection_settings_match({"1908", "1909", "127.0.0.1"}));
+    EXPECT_TRUE(dcs_interface.connection_settings_match(connection_settings));
+
+    // Test that received packets are forwarded unchanged, as well as being parsed.
+    mock_dcs.DcsSend("header*761=1:765=2.00");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("header*761=1:765=2.00", ikarus.DcsReceive().str());
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+
+    // Test that nothing is forwarded on receive timeouts.
+    dcs_interface.update_dcs_state();
+    const std::vector<UdpForwardStats> stats = dcs_interface.get_forward_stats();
+    ASSERT_EQ(1, stats.size());
+    EXPECT_EQ(1, stats[0].datagrams_forwarded);
+    EXPECT_EQ(21, stats[0].bytes_sent);
+}
+
+TEST(DcsInterfaceTest, multicast_group_connection) {
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1", {}, "239.255.50.10"};
+    DcsSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port);
+    DcsInterface dcs_interface(connection_settings);
+    EXPECT_FALSE(dcs_interface.connection_settings_match({"1908", "1909", "127.0.0.1"}));
+    EXPECT_TRUE(dcs_interface.connection_settings_match(connection_settings));
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+
+    // Test that updates sent to the group are received, while commands are sent unicast to DCS.
+    UdpForwarder multicast_exporter({"239.255.50.10:1908"});
+    multicast_exporter.forward("header*761=1");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+    dcs_interface.send_dcs_command(3001, "1", "1");
+    EXPECT_EQ("C1,3001,1", mock_dcs.DcsReceive().str());
+}
+
+// Reference producer of a same-host exporter publishing to DcsInterface through shared memory rings.
+class MockSharedMemoryExporter {
+  public:
+    MockSharedMemoryExporter(const std::string &name)
+        : export_ring(name + ".export"), command_ring(name + ".commands") {}
+
+    // Returns the next command sent to the exporter, or "" if none was sent.
+    std::string receive_command() {
+        std::string command;
+        command_ring.pop(command, 0);
+        return command;
+    }
+
+    SharedMemoryRing export_ring;  // Ring of packets to DcsInterface.
+    SharedMemoryRing command_ring; // Ring of commands from DcsInterface.
+};
+
+TEST(DcsInterfaceTest, shared_memory_connection) {
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1", {}, "", "DcsInterfaceTest.connection"};
+    MockSharedMemoryExporter mock_exporter(connection_settings.shared_memory_name);
+    DcsSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    DcsInterface dcs_interface(connection_settings);
+    EXPECT_FALSE(dcs_interface.connection_settings_match({"1908", "1909", "127.0.0.1"}));
+    EXPECT_TRUE(dcs_interface.connection_settings_match(connection_settings));
+    EXPECT_EQ("R", mock_exporter.receive_command());
+
+    // Test that packets and commands are exchanged only through shared memory while it is selected.
+    mock_exporter.export_ring.push("header*761=1:765=2.00");
+    mock_dcs.DcsSend("header*761=0");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+    dcs_interface.send_dcs_command(3001, "1", "1");
+    EXPECT_EQ("C1,3001,1", mock_exporter.receive_command());
+    EXPECT_EQ("", mock_exporter.receive_command());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+}
+
+TEST(DcsInterfaceTest, publish_game_state_to_shared_memory) {
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1", {}, "", "", "DcsInterfaceTest.state"};
+    DcsSocket mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port);
+    DcsInterface dcs_interface(connection_settings);
+    EXPECT_FALSE(dcs_interface.connection_settings_match({"1908", "1909", "127.0.0.1"}));
+    EXPECT_TRUE(dcs_interface.connection_settings_match(connection_settings));
+    SharedGameStateReader reader(connection_settings.shared_state_name);
+
+    // Test that received values are published to readers.
+    mock_dcs.DcsSend("header*761=1:765=2.00");
+    dcs_interface.update_dcs_state();
+    std::map<int, std::string> values;
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_EQ(dcs_interface.debug_get_current_game_state(), values);
+    const unsigned update_count = reader.update_count();
+
+    // Test that values dropped by the DCS ID filter or cleared are removed from the published state.
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({765});
+    std::string value;
+    EXPECT_FALSE(reader.read_value(761, value));
+    EXPECT_TRUE(reader.read_value(765, value));
+    EXPECT_EQ("2.00", value);
+    dcs_interface.clear_game_state();
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_TRUE(values.empty());
+    EXPECT_LT(update_count, reader.update_count());
+}
+
 class DcsInterfaceTestFixture : public ::testing::Test {
   public:
     DcsInterfaceTestFixture()
@@ -170,4 +283,1046 @@ TEST_F(DcsInterfaceTestFixture, debug_print_format) {
     EXPECT_EQ(current_game_state[2026], "TEXT_STR");
     EXPECT_EQ(current_game_state[2027], "4");
 }
+
+TEST_F(DcsInterfaceTestFixture, send_dcs_subscription_command) {
+    dcs_interface.send_dcs_subscription_command({761, 2026});
+    EXPECT_EQ("S761,2026", mock_dcs.DcsReceive().str());
+
+    // Test that an unchanged subscription is not sent again.
+    dcs_interface.send_dcs_subscription_command({761, 2026});
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    // Test that an empty subscription subscribes to all DCS IDs.
+    dcs_interface.send_dcs_subscription_command({});
+    EXPECT_EQ("S", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, send_dcs_subscription_command_split) {
+    std::vector<int> dcs_ids;
+    for (int dcs_id = 1000; dcs_id < 1500; ++dcs_id) {
+        dcs_ids.push_back(dcs_id);
+    }
+    dcs_interface.send_dcs_subscription_command(dcs_ids);
+
+    // Test that a long subscription is split into a replacing "S" command followed by adding "S+" commands.
+    std::string first_message = mock_dcs.DcsReceive().str();
+    EXPECT_EQ("S1000,1001,", first_message.substr(0, 11));
+    std::string received_ids = first_message.substr(1);
+    int num_messages = 1;
+    for (std::string message = mock_dcs.DcsReceive().str(); !message.empty(); message = mock_dcs.DcsReceive().str()) {
+        EXPECT_EQ("S+", message.substr(0, 2));
+        EXPECT_LE(message.size(), 1000);
+        received_ids += "," + message.substr(2);
+        ++num_messages;
+    }
+    EXPECT_GT(num_messages, 1);
+
+    std::string expected_ids;
+    for (const int dcs_id : dcs_ids) {
+        expected_ids += (expected_ids.empty() ? "" : ",") + std::to_string(dcs_id);
+    }
+    EXPECT_EQ(expected_ids, received_ids);
+}
+
+TEST_F(DcsInterfaceTestFixture, subscription_resent_on_reset_and_mission_start) {
+    dcs_interface.send_dcs_subscription_command({761});
+    EXPECT_EQ("S761", mock_dcs.DcsReceive().str());
+
+    dcs_interface.send_dcs_reset_command();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("S761", mock_dcs.DcsReceive().str());
+
+    // Test that export scripts restarted with a new mission receive the subscription again.
+    mock_dcs.DcsSend("header*DAC=start");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("S761", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_id_filter_skips_unreferenced_dcs_ids) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({761, 2026});
+    mock_dcs.DcsSend("header*761=1:765=2.00:2026=TEXT_STR:2027=4:File=F-16C_50");
+    dcs_interface.update_dcs_state();
+
+    const std::map<int, std::string> expected_game_state = {{761, "1"}, {2026, "TEXT_STR"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_EQ("F-16C_50", dcs_interface.get_current_dcs_module());
+    EXPECT_EQ(nullptr, dcs_interface.get_typed_value_of_dcs_id(765));
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_id_filter_drops_unreferenced_values) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    mock_dcs.DcsSend("header*761=1:765=2.00:2026=TEXT_STR:2027=4");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ(4, dcs_interface.debug_get_current_game_state().size());
+
+    // Test that setting the first filter drops other values without requesting a resend, as all values were stored.
+    dcs_interface.set_dcs_id_filter({761, 765});
+    const std::map<int, std::string> expected_game_state = {{761, "1"}, {765, "2.00"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    // Test that removing DCS IDs from the filter does not request a resend.
+    dcs_interface.set_dcs_id_filter({761});
+    EXPECT_EQ(1, dcs_interface.debug_get_current_game_state().size());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_id_filter_requests_resend_of_added_dcs_ids) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({761});
+    dcs_interface.set_dcs_id_filter({761, 2026});
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+
+    mock_dcs.DcsSend("header*761=1:765=2.00:2026=TEXT_STR:2027=4");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("TEXT_STR", dcs_interface.get_value_of_dcs_id(2026));
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_id_filter_applied_only_if_enabled_or_digest_supported) {
+    mock_dcs.DcsSend("header*761=1:765=2.00:2026=TEXT_STR");
+    dcs_interface.update_dcs_state();
+
+    // Test that values of all DCS IDs remain stored, so adding DCS IDs does not request a resend of all values.
+    dcs_interface.set_dcs_id_filter({761});
+    dcs_interface.set_dcs_id_filter({761, 2026});
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+    EXPECT_EQ(3, dcs_interface.debug_get_current_game_state().size());
+
+    // Test that the filter is applied once export scripts support digest commands.
+    mock_dcs.DcsSend("header*Digest=1:765=3.00");
+    dcs_interface.update_dcs_state();
+    const std::map<int, std::string> expected_game_state = {{761, "1"}, {2026, "TEXT_STR"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    // Test that values of dropped DCS IDs are requested again once the filter is no longer applied.
+    mock_dcs.DcsSend("header*Digest=0");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_id_filter_empty) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({});
+    mock_dcs.DcsSend("header*761=1:765=2.00:File=AV8BNA");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ(0, dcs_interface.debug_get_current_game_state().size());
+    EXPECT_EQ("AV8BNA", dcs_interface.get_current_dcs_module());
+}
+
+TEST_F(DcsInterfaceTestFixture, capture_all_dcs_ids_overrides_filter) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({761});
+
+    // Test that capturing all DCS IDs requests a resend of all values and stores them.
+    dcs_interface.set_capture_all_dcs_ids(true);
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+    mock_dcs.DcsSend("header*761=1:765=2.00:2026=TEXT_STR:2027=4");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ(4, dcs_interface.debug_get_current_game_state().size());
+
+    // Test that the filter still updates while capturing, then applies once capturing stops.
+    dcs_interface.set_dcs_id_filter({761, 2027});
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+    EXPECT_EQ(4, dcs_interface.debug_get_current_game_state().size());
+    dcs_interface.set_capture_all_dcs_ids(false);
+    const std::map<int, std::string> expected_game_state = {{761, "1"}, {2027, "4"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+}
+
+TEST_F(DcsInterfaceTestFixture, update_dcs_state_malformed_token_ends_message) {
+    mock_dcs.DcsSend("header*761=1:765:2026=TEXT_STR");
+    dcs_interface.update_dcs_state();
+    const std::map<int, std::string> expected_game_state = {{761, "1"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+
+    mock_dcs.DcsSend("no header delimiter 761=1");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+}
+
+// Appends a value to a binary export packet (see DcsBinaryProtocol.h).
+void append_varint(std::string &packet, uint32_t varint) {
+    for (; varint > 0x7F; varint >>= 7) {
+        packet += static_cast<char>((varint & 0x7F) | 0x80);
+    }
+    packet += static_cast<char>(varint);
+}
+void append_binary_value(std::string &packet, const int dcs_id, const BinaryExportValueType type) {
+    append_varint(packet, (dcs_id << 3) | type);
+}
+void append_binary_float(std::string &packet, const int dcs_id, const float value) {
+    append_binary_value(packet, dcs_id, BINARY_FLOAT32);
+    char bytes[4];
+    std::memcpy(bytes, &value, sizeof(bytes));
+    packet.append(bytes, sizeof(bytes));
+}
+void append_binary_string(std::string &packet, const int dcs_id, const std::string &value) {
+    append_binary_value(packet, dcs_id, BINARY_STRING);
+    packet += static_cast<char>(value.size()) + value;
+}
+
+TEST_F(DcsInterfaceTestFixture, update_dcs_state_binary_packet) {
+    std::string packet(kBinaryExportHeader);
+    append_binary_float(packet, 761, 0.25f);
+    append_binary_value(packet, 765, BINARY_INT);
+    packet += '\x06'; // Zigzag encoded 3.
+    append_binary_value(packet, 766, BINARY_TRUE);
+    append_binary_string(packet, 2026, "TEXT_STR");
+    append_binary_value(packet, 0, BINARY_NAMED_STRING);
+    packet += std::string("\x04" "File" "\x06" "AV8BNA");
+    mock_dcs.DcsSend(packet);
+    dcs_interface.update_dcs_state();
+
+    const std::map<int, std::string> expected_game_state = {{761, "0.25"}, {765, "3"}, {766, "1"}, {2026, "TEXT_STR"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_EQ("AV8BNA", dcs_interface.get_current_dcs_module());
+    EXPECT_TRUE(dcs_interface.get_typed_value_of_dcs_id(765)->is_number);
+    EXPECT_EQ(3.0, dcs_interface.get_typed_value_of_dcs_id(765)->number);
+    EXPECT_FALSE(dcs_interface.get_typed_value_of_dcs_id(2026)->is_number);
+
+    // Test that text packets are still received along with binary packets.
+    mock_dcs.DcsSend("header*761=1:2026=NEW_STR");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+    EXPECT_EQ("NEW_STR", dcs_interface.get_value_of_dcs_id(2026));
+}
+
+TEST_F(DcsInterfaceTestFixture, update_dcs_state_binary_packet_unchanged_number) {
+    mock_dcs.DcsSend("header*765=2.00");
+    dcs_interface.update_dcs_state();
+    const unsigned update_count = dcs_interface.get_update_count_of_dcs_id(765);
+
+    // Test that an unchanged number is not updated, keeping its previous text.
+    std::string packet(kBinaryExportHeader);
+    append_binary_float(packet, 765, 2.0f);
+    dcs_interface.handle_received_packet(packet);
+    EXPECT_EQ("2.00", dcs_interface.get_value_of_dcs_id(765));
+    EXPECT_EQ(update_count, dcs_interface.get_update_count_of_dcs_id(765));
+
+    packet = kBinaryExportHeader;
+    append_binary_float(packet, 765, 2.5f);
+    dcs_interface.handle_received_packet(packet);
+    EXPECT_EQ("2.5", dcs_interface.get_value_of_dcs_id(765));
+    EXPECT_LT(update_count, dcs_interface.get_update_count_of_dcs_id(765));
+}
+
+TEST_F(DcsInterfaceTestFixture, update_dcs_state_binary_packet_filtered) {
+    dcs_interface.set_dcs_id_filter_enabled(true);
+    dcs_interface.set_dcs_id_filter({761});
+    std::string packet(kBinaryExportHeader);
+    append_binary_float(packet, 761, 0.5f);
+    append_binary_float(packet, 762, 0.5f);
+    append_binary_string(packet, 2026, "TEXT_STR");
+    dcs_interface.handle_received_packet(packet);
+
+    const std::map<int, std::string> expected_game_state = {{761, "0.5"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+}
+
+TEST_F(DcsInterfaceTestFixture, update_dcs_state_binary_packet_malformed) {
+    std::string packet(kBinaryExportHeader);
+    append_binary_float(packet, 761, 0.5f);
+    append_binary_value(packet, 762, BINARY_STRING);
+    packet += "\x10" "TRUNCATED";
+    dcs_interface.handle_received_packet(packet);
+
+    // Test that values before the malformed value are stored.
+    const std::map<int, std::string> expected_game_state = {{761, "0.5"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+}
+
+TEST_F(DcsInterfaceTestFixture, text_and_binary_packets_decode_to_same_game_state) {
+    // Packets of typical exported values (switch positions, gauge values and display strings), alternating between two
+    // sets of values so every value changes with each packet.
+    constexpr int kNumValues = 60;
+    std::string text_packets[2];
+    std::string binary_packets[2];
+    for (int set = 0; set < 2; ++set) {
+        text_packets[set] = "F-16C_50*";
+        binary_packets[set] = kBinaryExportHeader;
+        for (int i = 0; i < kNumValues; ++i) {
+            const int dcs_id = 100 + i * 7;
+            text_packets[set] += (i == 0 ? "" : ":") + std::to_string(dcs_id) + "=";
+            if (i % 5 < 2) {
+                const int value = (i + set) % 2;
+                text_packets[set] += std::to_string(value);
+                append_binary_value(binary_packets[set], dcs_id, value == 1 ? BINARY_TRUE : BINARY_FALSE);
+            } else if (i % 5 < 4) {
+                const float value = 0.0125f * static_cast<float>(i + set * 3);
+                char text[32];
+                std::snprintf(text, sizeof(text), "%.7g", value);
+                text_packets[set] += text;
+                append_binary_float(binary_packets[set], dcs_id, value);
+            } else {
+                const std::string value = "STR" + std::to_string(i * 10 + set);
+                text_packets[set] += value;
+                append_binary_string(binary_packets[set], dcs_id, value);
+            }
+        }
+    }
+
+    const auto decode_packets = [this](const std::string(&packets)[2]) {
+        dcs_interface.clear_game_state();
+        dcs_interface.handle_received_packet(packets[0]);
+        dcs_interface.handle_received_packet(packets[1]);
+        return dcs_interface.debug_get_current_game_state();
+    };
+    const std::map<int, std::string> text_game_state = decode_packets(text_packets);
+
+    // Both formats result in the same game state, with binary packets being smaller.
+    EXPECT_EQ(text_game_state, decode_packets(binary_packets));
+    EXPECT_EQ(kNumValues, text_game_state.size());
+    EXPECT_LT(binary_packets[0].size(), text_packets[0].size());
+    EXPECT_LT(binary_packets[1].size(), text_packets[1].size());
+}
+
+// Mocks export scripts sending sequenced binary packets of float values.
+class MockSequencedExporter {
+  public:
+    // Encodes changed values as the next packet in the sequence.
+    std::string encode_packet(const std::map<int, float> &changed_values, const bool is_keyframe = false) {
+        std::string packet(kSequencedBinaryExportHeader);
+        append_varint(packet, sequence_);
+        packet += static_cast<char>((sequence_ == 0 ? kBinaryExportStreamStart : 0) |
+                                    (is_keyframe ? kBinaryExportKeyframe : 0));
+        std::string values;
+        for (const auto &[dcs_id, value] : changed_values) {
+            std::string entry;
+            append_binary_float(entry, dcs_id, value);
+            sent_hashes_[dcs_id] = hash_binary_export_value(entry);
+            state[dcs_id] = value;
+            values += entry;
+        }
+        if (is_keyframe) {
+            uint32_t checksum = 0;
+            for (const auto &[dcs_id, hash] : sent_hashes_) {
+                checksum += hash;
+            }
+            char bytes[4];
+            std::memcpy(bytes, &checksum, sizeof(bytes));
+            packet.append(bytes, sizeof(bytes));
+        }
+        ++sequence_;
+        return packet + values;
+    }
+
+    std::map<int, float> state; // Last sent value of each DCS ID.
+
+  private:
+    uint32_t sequence_ = 0;
+    std::map<int, uint32_t> sent_hashes_;
+};
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_in_order) {
+    MockSequencedExporter exporter;
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 1.0f}, {765, 0.5f}}));
+    dcs_interface.handle_received_packet(exporter.encode_packet({{765, 0.75f}}));
+    dcs_interface.handle_received_packet(exporter.encode_packet({}, true));
+    EXPECT_EQ("0.75", dcs_interface.get_value_of_dcs_id(765));
+
+    const DcsStreamStats stats = dcs_interface.get_stream_stats();
+    EXPECT_EQ(3, stats.sequenced_packets);
+    EXPECT_EQ(0, stats.lost_packets);
+    EXPECT_EQ(1, stats.keyframes);
+    EXPECT_EQ(0, stats.checksum_mismatches);
+    EXPECT_EQ(0, stats.resync_requests);
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_lost_packet_resync) {
+    MockSequencedExporter exporter;
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 1.0f}, {765, 0.5f}}));
+    (void)exporter.encode_packet({{765, 0.75f}}); // Lost.
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 0.0f}}));
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().lost_packets);
+
+    // Test that the keyframe detects the state lost with the packet and requests a resync.
+    dcs_interface.handle_received_packet(exporter.encode_packet({}, true));
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().checksum_mismatches);
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().resync_requests);
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+
+    // Export scripts resend all values on reset, which the next keyframe verifies.
+    dcs_interface.handle_received_packet(exporter.encode_packet(exporter.state, true));
+    EXPECT_EQ("0.75", dcs_interface.get_value_of_dcs_id(765));
+    EXPECT_EQ(2, dcs_interface.get_stream_stats().keyframes);
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().resync_requests);
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_lost_packet_without_resync) {
+    MockSequencedExporter exporter;
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 1.0f}, {765, 0.5f}}));
+    (void)exporter.encode_packet({{765, 0.75f}}); // Lost.
+    dcs_interface.handle_received_packet(exporter.encode_packet({{765, 0.25f}}));
+
+    // Test that no resync is requested if the lost values have since been replaced.
+    dcs_interface.handle_received_packet(exporter.encode_packet({}, true));
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().lost_packets);
+    EXPECT_EQ(0, dcs_interface.get_stream_stats().resync_requests);
+    EXPECT_EQ("0.25", dcs_interface.get_value_of_dcs_id(765));
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_reordered) {
+    MockSequencedExporter exporter;
+    const std::string first = exporter.encode_packet({{761, 1.0f}});
+    const std::string second = exporter.encode_packet({{761, 0.5f}, {765, 0.5f}});
+    const std::string third = exporter.encode_packet({{761, 0.25f}}, true);
+    dcs_interface.handle_received_packet(first);
+    dcs_interface.handle_received_packet(third);
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().lost_packets);
+
+    // Test that the late packet's values are applied, except those already replaced by the later packet.
+    dcs_interface.handle_received_packet(second);
+    EXPECT_EQ("0.25", dcs_interface.get_value_of_dcs_id(761));
+    EXPECT_EQ("0.5", dcs_interface.get_value_of_dcs_id(765));
+    const DcsStreamStats stats = dcs_interface.get_stream_stats();
+    EXPECT_EQ(0, stats.lost_packets);
+    EXPECT_EQ(1, stats.reordered_packets);
+
+    // The keyframe arrived before the late packet so did not match, and the state now matches the next keyframe.
+    EXPECT_EQ(1, stats.resync_requests);
+    dcs_interface.handle_received_packet(exporter.encode_packet({}, true));
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().resync_requests);
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_duplicate) {
+    MockSequencedExporter exporter;
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 1.0f}}));
+    const std::string second = exporter.encode_packet({{761, 0.5f}});
+    dcs_interface.handle_received_packet(second);
+    dcs_interface.handle_received_packet(exporter.encode_packet({{761, 0.25f}}));
+    dcs_interface.handle_received_packet(second);
+
+    EXPECT_EQ("0.25", dcs_interface.get_value_of_dcs_id(761));
+    EXPECT_EQ(1, dcs_interface.get_stream_stats().duplicate_packets);
+    EXPECT_EQ(0, dcs_interface.get_stream_stats().lost_packets);
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_stream_restart) {
+    MockSequencedExporter exporter;
+    for (int i = 0; i < 10; ++i) {
+        dcs_interface.handle_received_packet(exporter.encode_packet({{761, static_cast<float>(i)}}));
+    }
+
+    // Test that a restarted exporter's stream is accepted, and its keyframes do not include previous values.
+    MockSequencedExporter restarted_exporter;
+    dcs_interface.handle_received_packet(restarted_exporter.encode_packet({{765, 1.0f}}));
+    dcs_interface.handle_received_packet(restarted_exporter.encode_packet({}, true));
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(765));
+    const DcsStreamStats stats = dcs_interface.get_stream_stats();
+    EXPECT_EQ(1, stats.stream_restarts);
+    EXPECT_EQ(0, stats.duplicate_packets);
+    EXPECT_EQ(0, stats.resync_requests);
+}
+
+TEST_F(DcsInterfaceTestFixture, sequenced_packets_lossy_link) {
+    // Send packets of changing values over a link which drops and reorders packets, with a keyframe every 10 packets,
+    // where the exporter resends all values when a resync is requested.
+    MockSequencedExporter exporter;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::string delayed_packet;
+    unsigned handled_resync_requests = 0;
+    for (int i = 0; i < 1000; ++i) {
+        std::map<int, float> changed_values = {{100 + i % 50, static_cast<float>(i)}, {200 + i % 7, i * 0.5f}};
+        if (dcs_interface.get_stream_stats().resync_requests > handled_resync_requests) {
+            handled_resync_requests = dcs_interface.get_stream_stats().resync_requests;
+            changed_values.insert(exporter.state.begin(), exporter.state.end());
+        }
+        const std::string packet = exporter.encode_packet(changed_values, i % 10 == 9);
+        const int chance = percent(random);
+        if (chance < 5) {
+            continue; // Dropped.
+        }
+        if (chance < 10 && delayed_packet.empty()) {
+            delayed_packet = packet;
+            continue;
+        }
+        dcs_interface.handle_received_packet(packet);
+        if (!delayed_packet.empty()) {
+            dcs_interface.handle_received_packet(delayed_packet);
+            delayed_packet.clear();
+        }
+    }
+    // Finish with a resend of all values, as export scripts do on starting a mission.
+    dcs_interface.handle_received_packet(exporter.encode_packet(exporter.state, true));
+
+    for (const auto &[dcs_id, value] : exporter.state) {
+        EXPECT_EQ(value, dcs_interface.get_typed_value_of_dcs_id(dcs_id)->number);
+    }
+    const DcsStreamStats stats = dcs_interface.get_stream_stats();
+    EXPECT_GT(stats.lost_packets, 0);
+    EXPECT_GT(stats.reordered_packets, 0);
+    EXPECT_GT(stats.resync_requests, 0);
+    // Resyncs are requested only on checksum mismatch at keyframes, fewer than the lost packets.
+    EXPECT_EQ(stats.checksum_mismatches, stats.resync_requests);
+    EXPECT_LT(stats.resync_requests, stats.lost_packets);
+}
+
+// Runs the reference export-side subscription module as export scripts in DCS would.
+class ExportScriptSubscription {
+  public:
+    ExportScriptSubscription() : lua_state_(luaL_newstate()) {
+        luaL_openlibs(lua_state_);
+        const auto module_path =
+            std::filesystem::path(__FILE__).parent_path() / "../DcsExportScripts/StreamdeckSubscription.lua";
+        if (luaL_dofile(lua_state_, module_path.string().c_str()) != 0 ||
+            luaL_dostring(lua_state_, "subscription = StreamdeckSubscription.new()") != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+    }
+
+    ~ExportScriptSubscription() { lua_close(lua_state_); }
+
+    bool handle_message(const std::string &message) {
+        push_method("handle_message");
+        lua_pushstring(lua_state_, message.c_str());
+        call_method(2);
+        const bool is_subscription_command = lua_toboolean(lua_state_, -1);
+        lua_pop(lua_state_, 1);
+        return is_subscription_command;
+    }
+
+    std::string encode_packet(const std::map<std::string, std::string> &values) {
+        push_method("encode_packet");
+        lua_pushstring(lua_state_, "header");
+        lua_newtable(lua_state_);
+        for (const auto &[key, value] : values) {
+            lua_pushstring(lua_state_, value.c_str());
+            lua_setfield(lua_state_, -2, key.c_str());
+        }
+        call_method(3);
+        const std::string packet = lua_isstring(lua_state_, -1) ? lua_tostring(lua_state_, -1) : "";
+        lua_pop(lua_state_, 1);
+        return packet;
+    }
+
+  private:
+    // Pushes subscription:method and the subscription as its self argument.
+    void push_method(const char *method) {
+        lua_getglobal(lua_state_, "subscription");
+        lua_getfield(lua_state_, -1, method);
+        lua_insert(lua_state_, -2);
+    }
+
+    void call_method(const int num_args) {
+        if (lua_pcall(lua_state_, num_args, 1, 0) != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+    }
+
+    lua_State *lua_state_;
+};
+
+TEST_F(DcsInterfaceTestFixture, export_script_sends_only_subscribed_ids) {
+    ExportScriptSubscription export_script;
+    const std::map<std::string, std::string> export_values = {
+        {"761", "1"}, {"765", "2.00"}, {"2026", "TEXT_STR"}, {"2027", "4"}, {"File", "F-16C_50"}};
+
+    // Test that all DCS IDs are sent before a subscription is received.
+    EXPECT_FALSE(export_script.handle_message("C24,3250,1"));
+    mock_dcs.DcsSend(export_script.encode_packet(export_values));
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ(4, dcs_interface.debug_get_current_game_state().size());
+
+    dcs_interface.clear_game_state();
+    dcs_interface.send_dcs_subscription_command({761, 2026});
+    EXPECT_TRUE(export_script.handle_message(mock_dcs.DcsReceive().str()));
+    mock_dcs.DcsSend(export_script.encode_packet(export_values));
+    dcs_interface.update_dcs_state();
+
+    const std::map<int, std::string> expected_game_state = {{761, "1"}, {2026, "TEXT_STR"}};
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_EQ("F-16C_50", dcs_interface.get_current_dcs_module());
+}
+
+TEST_F(DcsInterfaceTestFixture, export_script_applies_split_subscription) {
+    ExportScriptSubscription export_script;
+    std::vector<int> dcs_ids;
+    std::map<std::string, std::string> export_values;
+    for (int dcs_id = 1000; dcs_id < 1500; ++dcs_id) {
+        // Subscribe to every other exported DCS ID.
+        if (dcs_id % 2 == 0) {
+            dcs_ids.push_back(dcs_id);
+        }
+        export_values[std::to_string(dcs_id)] = "1";
+    }
+    dcs_interface.send_dcs_subscription_command(dcs_ids);
+    for (std::string message = mock_dcs.DcsReceive().str(); !message.empty(); message = mock_dcs.DcsReceive().str()) {
+        EXPECT_TRUE(export_script.handle_message(message));
+    }
+
+    // Send the subscribed values in packets small enough for the receive buffer.
+    std::map<std::string, std::string> packet_values;
+    for (const auto &[key, value] : export_values) {
+        packet_values[key] = value;
+        if (packet_values.size() == 50) {
+            mock_dcs.DcsSend(export_script.encode_packet(packet_values));
+            dcs_interface.update_dcs_state();
+            packet_values.clear();
+        }
+    }
+
+    const std::map<int, std::string> game_state = dcs_interface.debug_get_current_game_state();
+    EXPECT_EQ(dcs_ids.size(), game_state.size());
+    for (const int dcs_id : dcs_ids) {
+        EXPECT_EQ(1, game_state.count(dcs_id));
+    }
+}
+
+// Runs the reference export-side digest module (DcsExportScripts/StreamdeckDigest.lua).
+class ExportScriptDigest {
+  public:
+    ExportScriptDigest() : lua_state_(luaL_newstate()) {
+        luaL_openlibs(lua_state_);
+        const auto module_path =
+            std::filesystem::path(__FILE__).parent_path() / "../DcsExportScripts/StreamdeckDigest.lua";
+        if (luaL_dofile(lua_state_, module_path.string().c_str()) != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+    }
+
+    ~ExportScriptDigest() { lua_close(lua_state_); }
+
+    // Returns the values to resend for a digest command, or nullopt if the message is not a digest command.
+    std::optional<std::map<std::string, std::string>> handle_message(const std::string &message,
+                                                                     const std::map<std::string, std::string> &values) {
+        lua_getglobal(lua_state_, "StreamdeckDigest");
+        lua_getfield(lua_state_, -1, "handle_message");
+        lua_pushstring(lua_state_, message.c_str());
+        lua_newtable(lua_state_);
+        for (const auto &[key, value] : values) {
+            lua_pushstring(lua_state_, value.c_str());
+            lua_setfield(lua_state_, -2, key.c_str());
+        }
+        if (lua_pcall(lua_state_, 2, 1, 0) != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+        std::optional<std::map<std::string, std::string>> resend;
+        if (lua_istable(lua_state_, -1)) {
+            resend.emplace();
+            for (lua_pushnil(lua_state_); lua_next(lua_state_, -2) != 0; lua_pop(lua_state_, 1)) {
+                lua_pushvalue(lua_state_, -2); // Copy the key so lua_tostring does not convert the key in place.
+                (*resend)[lua_tostring(lua_state_, -1)] = lua_tostring(lua_state_, -2);
+                lua_pop(lua_state_, 1);
+            }
+        }
+        lua_pop(lua_state_, 2);
+        return resend;
+    }
+
+  private:
+    lua_State *lua_state_;
+};
+
+// Encodes values in the text packet format.
+std::string encode_text_packet(const std::map<std::string, std::string> &values) {
+    std::string packet = "header*";
+    for (const auto &[key, value] : values) {
+        packet += key + "=" + value + ":";
+    }
+    packet.pop_back();
+    return packet;
+}
+
+TEST_F(DcsInterfaceTestFixture, resync_command_without_digest_support) {
+    mock_dcs.DcsSend("header*File=F-16C_50:761=1");
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_resync_command();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, resync_command_digest) {
+    // Test that a reset is sent while the game state is empty, as all values must be resent.
+    mock_dcs.DcsSend("header*File=F-16C_50:Digest=1");
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_resync_command();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+
+    mock_dcs.DcsSend("header*761=1:765=2.00");
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_resync_command();
+    std::stringstream expected_command;
+    expected_command << "D1:" << std::hex << hash_binary_export_value("761=1") + hash_binary_export_value("765=2.00");
+    EXPECT_EQ(expected_command.str(), mock_dcs.DcsReceive().str());
+
+    // Test that digest support ends with the mission.
+    mock_dcs.DcsSend("header*DCS=stop");
+    dcs_interface.update_dcs_state();
+    mock_dcs.DcsSend("header*761=1");
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_resync_command();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, export_script_digest_resends_changed_buckets) {
+    ExportScriptDigest export_script;
+    EXPECT_FALSE(export_script.handle_message("C24,3250,1", {}));
+
+    std::map<std::string, std::string> export_values;
+    for (int dcs_id = 1000; dcs_id < 1500; ++dcs_id) {
+        export_values[std::to_string(dcs_id)] = std::to_string(dcs_id % 3);
+    }
+    mock_dcs.DcsSend("header*File=F-16C_50:Digest=1");
+    dcs_interface.update_dcs_state();
+    std::map<std::string, std::string> packet_values;
+    size_t full_resend_bytes = 0;
+    for (const auto &[key, value] : export_values) {
+        packet_values[key] = value;
+        if (packet_values.size() == 50) {
+            const std::string packet = encode_text_packet(packet_values);
+            full_resend_bytes += packet.size();
+            dcs_interface.handle_received_packet(packet);
+            packet_values.clear();
+        }
+    }
+
+    // Test that only buckets containing values changed while disconnected are resent.
+    export_values["1002"] = "changed";
+    export_values["1250"] = "changed";
+    dcs_interface.send_dcs_resync_command();
+    const std::string digest = mock_dcs.DcsReceive().str();
+    EXPECT_EQ("D64:", digest.substr(0, 4));
+    const auto resend = export_script.handle_message(digest, export_values);
+    ASSERT_TRUE(resend);
+    EXPECT_EQ("changed", resend->at("1002"));
+    EXPECT_EQ("changed", resend->at("1250"));
+    EXPECT_GE(2 * 8, resend->size());
+
+    const std::string resend_packet = encode_text_packet(*resend);
+    dcs_interface.handle_received_packet(resend_packet);
+    std::map<int, std::string> expected_game_state;
+    for (const auto &[key, value] : export_values) {
+        expected_game_state[std::stoi(key)] = value;
+    }
+    EXPECT_EQ(expected_game_state, dcs_interface.debug_get_current_game_state());
+    EXPECT_LT(digest.size() + resend_packet.size(), full_resend_bytes);
+
+    // Test that nothing is resent once the states match.
+    dcs_interface.send_dcs_resync_command();
+    EXPECT_EQ(0, export_script.handle_message(mock_dcs.DcsReceive().str(), export_values)->size());
+
+    // Test that all values are resent for a malformed digest.
+    EXPECT_EQ(500, export_script.handle_message("D64:1,2", export_values)->size());
+}
+
+TEST_F(DcsInterfaceTestFixture, export_script_digest_resends_added_dcs_ids) {
+    ExportScriptDigest export_script;
+    dcs_interface.set_dcs_id_filter({761});
+    (void)mock_dcs.DcsReceive();
+    mock_dcs.DcsSend("header*File=F-16C_50:Digest=1:761=1:765=2.00:2026=TEXT_STR");
+    dcs_interface.update_dcs_state();
+
+    // Test that adding a DCS ID to the filter resends the bucket of its value, a single bucket for a small state.
+    dcs_interface.set_dcs_id_filter({761, 2026});
+    const std::string digest = mock_dcs.DcsReceive().str();
+    EXPECT_EQ("D1:", digest.substr(0, 3));
+    const auto resend = export_script.handle_message(digest, {{"761", "1"}, {"2026", "TEXT_STR"}});
+    ASSERT_TRUE(resend);
+    const std::map<std::string, std::string> expected_resend = {{"761", "1"}, {"2026", "TEXT_STR"}};
+    EXPECT_EQ(expected_resend, *resend);
+}
+
+TEST_F(DcsInterfaceTestFixture, digest_resync_after_disconnect) {
+    mock_dcs.DcsSend("header*File=F-16C_50:Digest=1:761=1");
+    dcs_interface.update_dcs_state();
+    mock_dcs.DcsSend("header*761=1");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    // Test that packets resuming after a second of silence request a resync.
+    for (int i = 0; i < 10; ++i) {
+        dcs_interface.update_dcs_state();
+    }
+    mock_dcs.DcsSend("header*761=0");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ('D', mock_dcs.DcsReceive().str()[0]);
+}
+
+// Appends a DCS-BIOS write record of 16-bit words starting at an address (see DcsBiosProtocol.h).
+void append_dcs_bios_write(std::string &packet, const uint16_t address, const std::vector<uint16_t> &words) {
+    const uint16_t count = static_cast<uint16_t>(words.size() * 2);
+    for (const uint16_t word : std::vector<uint16_t>{address, count}) {
+        packet += static_cast<char>(word & 0xFF);
+        packet += static_cast<char>(word >> 8);
+    }
+    for (const uint16_t word : words) {
+        packet += static_cast<char>(word & 0xFF);
+        packet += static_cast<char>(word >> 8);
+    }
+}
+
+// Returns the DCS ID representing a DCS-BIOS output written as "address/mask/shift".
+int dcs_bios_dcs_id(const std::string &output_text) {
+    DcsBiosOutput output;
+    if (!parse_dcs_bios_output(output_text, output)) {
+        throw std::invalid_argument(output_text);
+    }
+    return dcs_bios_output_to_dcs_id(output);
+}
+
+// Runs the reference export-side command batch module, decoding received messages as export scripts in DCS would.
+class ExportScriptCommandBatch {
+  public:
+    ExportScriptCommandBatch() : lua_state_(luaL_newstate()) {
+        luaL_openlibs(lua_state_);
+        const auto module_path =
+            std::filesystem::path(__FILE__).parent_path() / "../DcsExportScripts/StreamdeckCommandBatch.lua";
+        if (luaL_dofile(lua_state_, module_path.string().c_str()) != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+    }
+
+    ~ExportScriptCommandBatch() { lua_close(lua_state_); }
+
+    // Returns the commands of a received message as "<device>,<button>,<value>".
+    std::vector<std::string> decode(const std::string &message) {
+        std::vector<std::string> commands;
+        call_function("split", message, 1);
+        const size_t count = lua_objlen(lua_state_, -1);
+        for (size_t i = 1; i <= count; ++i) {
+            lua_rawgeti(lua_state_, -1, static_cast<int>(i));
+            const std::string command = lua_tostring(lua_state_, -1);
+            lua_pop(lua_state_, 1);
+            call_function("parse_command", command, 3);
+            if (!lua_isnil(lua_state_, -3)) {
+                commands.push_back(std::to_string(lua_tointeger(lua_state_, -3)) + "," +
+                                   std::to_string(lua_tointeger(lua_state_, -2)) + "," + lua_tostring(lua_state_, -1));
+            }
+            lua_pop(lua_state_, 3);
+        }
+        lua_pop(lua_state_, 1);
+        return commands;
+    }
+
+  private:
+    void call_function(const char *function, const std::string &message, const int num_results) {
+        lua_getglobal(lua_state_, "StreamdeckCommandBatch");
+        lua_getfield(lua_state_, -1, function);
+        lua_remove(lua_state_, -2);
+        lua_pushstring(lua_state_, message.c_str());
+        if (lua_pcall(lua_state_, 1, num_results, 0) != 0) {
+            throw std::runtime_error(lua_tostring(lua_state_, -1));
+        }
+    }
+
+    lua_State *lua_state_;
+};
+
+TEST_F(DcsInterfaceTestFixture, send_dcs_commands_without_batch_support) {
+    ExportScriptCommandBatch export_script;
+    dcs_interface.send_dcs_commands({{3001, "24", "1"}, {3002, "24", "0"}, {3250, "1", "0.5"}});
+
+    // Test that each command is sent on its own, as by send_dcs_command.
+    EXPECT_EQ("C24,3001,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("C24,3002,0", mock_dcs.DcsReceive().str());
+    const std::string last_command = mock_dcs.DcsReceive().str();
+    EXPECT_EQ("C1,3250,0.5", last_command);
+    EXPECT_EQ(std::vector<std::string>({"1,3250,0.5"}), export_script.decode(last_command));
+}
+
+TEST_F(DcsInterfaceTestFixture, send_dcs_commands_batched) {
+    ExportScriptCommandBatch export_script;
+    mock_dcs.DcsSend("header*File=F-16C_50:" + std::string(kDcsCommandBatchToken));
+    dcs_interface.update_dcs_state();
+
+    // Test that commands are sent in a single message once export scripts support batches.
+    dcs_interface.send_dcs_commands({{3001, "24", "1"}, {3002, "24", "0"}, {3250, "1", "0.5"}});
+    EXPECT_EQ(std::vector<std::string>({"24,3001,1", "24,3002,0", "1,3250,0.5"}),
+              export_script.decode(mock_dcs.DcsReceive().str()));
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    // Test that single commands are unchanged.
+    dcs_interface.send_dcs_command(3001, "24", "0");
+    EXPECT_EQ("C24,3001,0", mock_dcs.DcsReceive().str());
+
+    // Test that batches too long for one datagram are split, keeping the order of the commands.
+    std::vector<std::string> values(200);
+    std::vector<DcsCommand> commands;
+    std::vector<std::string> expected_commands;
+    for (int i = 0; i < 200; ++i) {
+        values[i] = std::to_string(i * 0.01);
+        commands.push_back({3000 + i, "24", values[i]});
+        expected_commands.push_back("24," + std::to_string(3000 + i) + "," + values[i]);
+    }
+    dcs_interface.send_dcs_commands(commands);
+    std::vector<std::string> received_commands;
+    int messages = 0;
+    for (std::string message = mock_dcs.DcsReceive().str(); !message.empty(); message = mock_dcs.DcsReceive().str()) {
+        EXPECT_LE(message.size(), kMaxDcsCommandBatchLength);
+        const std::vector<std::string> decoded = export_script.decode(message);
+        received_commands.insert(received_commands.end(), decoded.begin(), decoded.end());
+        ++messages;
+    }
+    EXPECT_EQ(expected_commands, received_commands);
+    EXPECT_LT(1, messages);
+
+    // Test that batches are no longer sent once export scripts stop.
+    mock_dcs.DcsSend("header*Ikarus=stop");
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_commands({{3001, "24", "1"}, {3002, "24", "0"}});
+    EXPECT_EQ("C24,3001,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("C24,3002,0", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, commands_paced_per_frame) {
+    dcs_interface.set_commands_per_frame(2);
+    dcs_interface.update_dcs_state();
+    for (int i = 0; i < 5; ++i) {
+        dcs_interface.send_dcs_command(3000 + i, "24", "1");
+    }
+    EXPECT_EQ("C24,3000,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("C24,3001,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+    EXPECT_EQ(3, dcs_interface.get_command_queue_stats().queue_depth[COMMAND_LANE_USER_INPUT]);
+
+    // Test that queued commands are sent in later frames, which start with each received packet.
+    mock_dcs.DcsSend("header*761=1");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("C24,3002,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("C24,3003,1", mock_dcs.DcsReceive().str());
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("C24,3004,1", mock_dcs.DcsReceive().str());
+
+    const DcsCommandQueueStats stats = dcs_interface.get_command_queue_stats();
+    EXPECT_EQ(0, stats.queue_depth[COMMAND_LANE_USER_INPUT]);
+    EXPECT_EQ(3, stats.max_queue_depth[COMMAND_LANE_USER_INPUT]);
+    EXPECT_EQ(3, stats.sent_deferred);
+}
+
+TEST_F(DcsInterfaceTestFixture, user_commands_sent_before_control_messages) {
+    dcs_interface.set_commands_per_frame(1);
+    dcs_interface.update_dcs_state();
+    dcs_interface.send_dcs_command(3001, "24", "1");
+    dcs_interface.send_dcs_reset_command();
+    dcs_interface.send_dcs_command(3002, "24", "1");
+    EXPECT_EQ("C24,3001,1", mock_dcs.DcsReceive().str());
+
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("C24,3002,1", mock_dcs.DcsReceive().str());
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("R", mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, queued_absolute_value_commands_coalesced) {
+    dcs_interface.set_commands_per_frame(1);
+    dcs_interface.update_dcs_state();
+    // Dial turns while the budget is spent are reduced to the latest position, while each momentary press and release
+    // is sent.
+    dcs_interface.send_dcs_command(3001, "24", "0.1", COMMAND_LANE_USER_INPUT, true);
+    dcs_interface.send_dcs_command(3001, "24", "0.2", COMMAND_LANE_USER_INPUT, true);
+    dcs_interface.send_dcs_command(3002, "24", "1");
+    dcs_interface.send_dcs_command(3002, "24", "0");
+    dcs_interface.send_dcs_command(3001, "24", "0.3", COMMAND_LANE_USER_INPUT, true);
+    std::vector<std::string> received_commands;
+    for (int frame = 0; frame < 5; ++frame) {
+        for (std::string command = mock_dcs.DcsReceive().str(); !command.empty();
+             command = mock_dcs.DcsReceive().str()) {
+            received_commands.push_back(command);
+        }
+        dcs_interface.update_dcs_state();
+    }
+    EXPECT_EQ(std::vector<std::string>({"C24,3001,0.1", "C24,3002,1", "C24,3002,0", "C24,3001,0.3"}),
+              received_commands);
+    EXPECT_EQ(1, dcs_interface.get_command_queue_stats().coalesced);
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_bios_outputs_stored_as_dcs_ids) {
+    const int master_arm = dcs_bios_dcs_id("0x4426/0x0100/8");
+    const int gear_lever = dcs_bios_dcs_id("0x4426/0x0600/9");
+    const int fuel_qty = dcs_bios_dcs_id("0x4428/0xffff/0");
+    dcs_interface.set_dcs_id_filter({761, master_arm, gear_lever, fuel_qty});
+    (void)mock_dcs.DcsReceive();
+
+    // Replay DCS-BIOS frames through the socket, interleaved with DCS-ExportScripts packets.
+    std::string frame(kDcsBiosSync);
+    append_dcs_bios_write(frame, 0x4426, {0x0500, 1234});
+    append_dcs_bios_write(frame, 0xFFFE, {1});
+    mock_dcs.DcsSend(frame);
+    dcs_interface.update_dcs_state();
+    mock_dcs.DcsSend("header*761=1");
+    dcs_interface.update_dcs_state();
+
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(master_arm));
+    EXPECT_EQ("2", dcs_interface.get_value_of_dcs_id(gear_lever));
+    EXPECT_EQ("1234", dcs_interface.get_value_of_dcs_id(fuel_qty));
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(761));
+    EXPECT_EQ(1234, dcs_interface.get_typed_value_of_dcs_id(fuel_qty)->number);
+    EXPECT_EQ(1, dcs_interface.get_dcs_bios_state().frame_count());
+
+    // Test that only outputs whose bits changed are updated.
+    const unsigned master_arm_update_count = dcs_interface.get_update_count_of_dcs_id(master_arm);
+    const unsigned gear_lever_update_count = dcs_interface.get_update_count_of_dcs_id(gear_lever);
+    frame = std::string(kDcsBiosSync);
+    append_dcs_bios_write(frame, 0x4426, {0x0501});
+    append_dcs_bios_write(frame, 0xFFFE, {2});
+    dcs_interface.handle_received_packet(frame);
+    EXPECT_EQ(master_arm_update_count, dcs_interface.get_update_count_of_dcs_id(master_arm));
+    EXPECT_EQ(gear_lever_update_count, dcs_interface.get_update_count_of_dcs_id(gear_lever));
+
+    frame = std::string(kDcsBiosSync);
+    append_dcs_bios_write(frame, 0x4426, {0x0201});
+    dcs_interface.handle_received_packet(frame);
+    EXPECT_EQ("0", dcs_interface.get_value_of_dcs_id(master_arm));
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(gear_lever));
+    EXPECT_LT(gear_lever_update_count, dcs_interface.get_update_count_of_dcs_id(gear_lever));
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_bios_outputs_monitored_from_shadow_state) {
+    std::string frame(kDcsBiosSync);
+    append_dcs_bios_write(frame, 0x4426, {0x0100});
+    dcs_interface.handle_received_packet(frame);
+
+    // Test that outputs are stored when monitored, from the shadow state of earlier frames, and dropped when not.
+    const int master_arm = dcs_bios_dcs_id("0x4426/0x0100/8");
+    const int unwritten = dcs_bios_dcs_id("0x5000/0x0100/8");
+    dcs_interface.set_dcs_id_filter({master_arm, unwritten});
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(master_arm));
+    EXPECT_EQ(nullptr, dcs_interface.get_typed_value_of_dcs_id(unwritten));
+    // Monitoring only DCS-BIOS outputs does not request a resync from DCS-ExportScripts.
+    EXPECT_EQ("", mock_dcs.DcsReceive().str());
+
+    dcs_interface.set_dcs_id_filter({761});
+    EXPECT_EQ(nullptr, dcs_interface.get_typed_value_of_dcs_id(master_arm));
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_bios_outputs_excluded_from_digest) {
+    const int master_arm = dcs_bios_dcs_id("0x4426/0x0100/8");
+    dcs_interface.set_dcs_id_filter({761, master_arm});
+    (void)mock_dcs.DcsReceive();
+    std::string frame(kDcsBiosSync);
+    append_dcs_bios_write(frame, 0x4426, {0x0100});
+    dcs_interface.handle_received_packet(frame);
+    mock_dcs.DcsSend("header*File=F-16C_50:Digest=1:761=1");
+    dcs_interface.update_dcs_state();
+    EXPECT_EQ("1", dcs_interface.get_value_of_dcs_id(master_arm));
+
+    // Test that the digest only hashes values of the export scripts, so matching states resend nothing.
+    dcs_interface.send_dcs_resync_command();
+    std::stringstream expected_command;
+    expected_command << "D1:" << std::hex << hash_binary_export_value("761=1");
+    EXPECT_EQ(expected_command.str(), mock_dcs.DcsReceive().str());
+}
+
+TEST_F(DcsInterfaceTestFixture, dcs_bios_replay_of_split_frames) {
+    // Replay a stream of frames split across packets at arbitrary bytes, as if received with partial packets.
+    const int counter = dcs_bios_dcs_id("0x1000/0xffff/0");
+    dcs_interface.set_dcs_id_filter({counter});
+    std::string stream;
+    for (uint16_t i = 1; i <= 100; ++i) {
+        stream += kDcsBiosSync;
+        append_dcs_bios_write(stream, 0x1000, {i, static_cast<uint16_t>(i * 3)});
+        append_dcs_bios_write(stream, 0xFFFE, {i});
+    }
+    for (size_t pos = 0; pos < stream.size(); pos += 37) {
+        dcs_interface.handle_received_dcs_bios_packet(std::string_view(stream).substr(pos, 37));
+    }
+    EXPECT_EQ(100, dcs_interface.get_dcs_bios_state().frame_count());
+    EXPECT_EQ("100", dcs_interface.get_value_of_dcs_id(counter));
+    EXPECT_EQ(300, dcs_interface.get_dcs_bios_state().read_word(0x1002));
+}
+
 } // namespace test
@@ -3,6 +3,7 @@
 #include "gtest/gtest.h"
 
 #include "../DcsInterface/DcsSocket.cpp"
+#include "../DcsInterface/UdpForwarder.h"
 
 namespace test {
 
@@ -16,6 +17,28 @@ TEST(DcsSocketTest, invalid_connection_ip_addr_settings) {
     EXPECT_THROW(DcsSocket dcs_socket("127001", "1908", "1909"), std::runtime_error);
 }
 
+TEST(DcsSocketTest, invalid_multicast_group) {
+    EXPECT_THROW(DcsSocket dcs_socket("127.0.0.1", "1793", "1794", "127.0.0.1"), std::runtime_error);
+    EXPECT_THROW(DcsSocket dcs_socket("127.0.0.1", "1793", "1794", "239.255.50"), std::runtime_error);
+}
+
+TEST(DcsSocketTest, multicast_group_shared_by_listeners) {
+    // Two listeners of the group, as plugins on separate hosts would be, share the port on loopback.
+    DcsSocket first_listener("127.0.0.1", "1795", "1796", "239.255.50.10");
+    DcsSocket second_listener("127.0.0.1", "1795", "1796", "239.255.50.10");
+
+    // Test that a single packet sent to the group by a local sender is received by both listeners.
+    UdpForwarder multicast_sender({"239.255.50.10:1795"});
+    multicast_sender.forward("header*761=1");
+    EXPECT_EQ("header*761=1", first_listener.DcsReceive().str());
+    EXPECT_EQ("header*761=1", second_listener.DcsReceive().str());
+
+    // Test that messages are still sent unicast to the tx port.
+    DcsSocket command_receiver("127.0.0.1", "1796");
+    first_listener.DcsSend("C1,3001,1");
+    EXPECT_EQ("C1,3001,1", command_receiver.DcsReceive().str());
+}
+
 class DcsSocketTestFixture : public ::testing::Test {
   public:
     DcsSocketTestFixture()
@@ -34,6 +57,14 @@ TEST_F(DcsSocketTestFixture, send_and_receive) {
     EXPECT_EQ(ss_received.str(), test_message);
 }
 
+TEST_F(DcsSocketTestFixture, send_and_receive_large_message) {
+    // Expect large messages, such as batched exports to forward, to be received whole.
+    std::string test_message(60000, 'x');
+    test_message.back() = 'y';
+    sender_socket.DcsSend(test_message);
+    EXPECT_EQ(test_message, receiver_socket.DcsReceive().str());
+}
+
 TEST_F(DcsSocketTestFixture, unavailable_port_bind) {
     // Expect exception thrown if try to bind a new socket to same rx_port.
     EXPECT_THROW(DcsSocket duplicate_socket(ip_address, common_port, "1801"), std::runtime_error);
@@ -0,0 +1,89 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DeviceShardMap.h"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace test {
+
+TEST(DeviceShardMapTest, access_creates_shard_per_device) {
+    DeviceShardMap<std::vector<int>> shard_map;
+    shard_map.access("device_1", [](std::vector<int> &data) { data.push_back(1); });
+    shard_map.access("device_2", [](std::vector<int> &data) { data.push_back(2); });
+    shard_map.access("device_1", [](std::vector<int> &data) { data.push_back(3); });
+
+    std::vector<std::vector<int>> swept;
+    shard_map.sweep([&swept](std::vector<int> &data, DeviceShardMap<std::vector<int>>::SweepLock &) {
+        swept.push_back(data);
+    });
+    ASSERT_EQ(2, swept.size());
+    EXPECT_EQ(std::vector<int>({1, 3}), swept[0]);
+    EXPECT_EQ(std::vector<int>({2}), swept[1]);
+}
+
+TEST(DeviceShardMapTest, access_any_stops_at_first_match) {
+    DeviceShardMap<int> shard_map;
+    shard_map.access("device_1", [](int &data) { data = 1; });
+    shard_map.access("device_2", [](int &data) { data = 2; });
+    shard_map.access("device_3", [](int &data) { data = 3; });
+
+    int shards_visited = 0;
+    EXPECT_TRUE(shard_map.access_any([&shards_visited](int &data) {
+        ++shards_visited;
+        return data == 2;
+    }));
+    EXPECT_EQ(2, shards_visited);
+    EXPECT_FALSE(shard_map.access_any([](int &data) { return data == 4; }));
+}
+
+TEST(DeviceShardMapTest, access_any_without_shards) {
+    DeviceShardMap<int> shard_map;
+    EXPECT_FALSE(shard_map.access_any([](int &) { return true; }));
+}
+
+TEST(DeviceShardMapTest, sweep_yields_to_waiting_access_between_items) {
+    DeviceShardMap<std::vector<int>> shard_map;
+    shard_map.access("device_1", [](std::vector<int> &data) { data = {0, 1, 2}; });
+
+    // Each entry is written with the shard locked, by either the sweep (item index) or the access (-1).
+    std::vector<int> order;
+    std::atomic<bool> sweep_started = false;
+    std::atomic<bool> access_started = false;
+    std::atomic<bool> access_done = false;
+    std::thread sweep_thread([&]() {
+        shard_map.sweep([&](std::vector<int> &data, DeviceShardMap<std::vector<int>>::SweepLock &lock) {
+            for (const int item : data) {
+                lock.yield_to_priority_access();
+                order.push_back(item);
+                if (item == 0) {
+                    sweep_started = true;
+                    while (!access_started) {
+                        std::this_thread::yield();
+                    }
+                    // The access can only run once the sweep hands the lock over between items.
+                    while (!access_done) {
+                        lock.yield_to_priority_access();
+                    }
+                }
+            }
+        });
+    });
+
+    while (!sweep_started) {
+        std::this_thread::yield();
+    }
+    access_started = true;
+    shard_map.access("device_1", [&](std::vector<int> &) {
+        order.push_back(-1);
+        access_done = true;
+    });
+    sweep_thread.join();
+
+    EXPECT_EQ(std::vector<int>({0, -1, 1, 2}), order);
+}
+
+} // namespace test
@@ -0,0 +1,142 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/InstalledModuleWatcher.cpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+namespace test {
+
+class InstalledModuleWatcherTestFixture : public ::testing::TestWithParam<bool> {
+  public:
+    InstalledModuleWatcherTestFixture()
+        : test_directory((std::filesystem::temp_directory_path() / "InstalledModuleWatcherTest").string()),
+          dcs_install_path(test_directory + "/DCS World"),
+          watcher("/mods/aircraft/",
+                  std::chrono::milliseconds(200),
+                  GetParam(),
+                  [this](const std::string &install_path, const std::string &module_folder_name) {
+                      std::lock_guard<std::mutex> lock(changed_mutex);
+                      changed_modules.push_back(install_path + ":" + module_folder_name);
+                  }) {
+        std::filesystem::remove_all(test_directory);
+        write_clickabledata("F-16C_50", "elements = {}\n");
+        write_clickabledata("A-10C", "elements = {}\n");
+    }
+
+    ~InstalledModuleWatcherTestFixture() {
+        watcher.stop();
+        std::filesystem::remove_all(test_directory);
+    }
+
+    static void write_file(const std::string &path, const std::string &contents) {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        std::ofstream(path) << contents;
+    }
+
+    void write_clickabledata(const std::string &module, const std::string &contents) {
+        write_file(dcs_install_path + "/mods/aircraft/" + module + "/Cockpit/Scripts/clickabledata.lua", contents);
+    }
+
+    json installed_modules() { return watcher.get_installed_modules(dcs_install_path)["installed_modules"]; }
+
+    // Waits for the watcher to apply changes, returning true once the condition holds.
+    template <typename Condition> bool wait_until(Condition condition) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            if (condition()) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        return condition();
+    }
+
+    std::vector<std::string> get_changed_modules() {
+        std::lock_guard<std::mutex> lock(changed_mutex);
+        return changed_modules;
+    }
+
+    std::string test_directory;
+    std::string dcs_install_path;
+    std::mutex changed_mutex;
+    std::vector<std::string> changed_modules;
+    InstalledModuleWatcher watcher;
+};
+
+TEST_P(InstalledModuleWatcherTestFixture, install_path_not_found) {
+    const json installed_modules_and_result = watcher.get_installed_modules("non-existant-path");
+    EXPECT_EQ("DCS Install path [non-existant-path/mods/aircraft/] not found.",
+              installed_modules_and_result["result"]);
+    EXPECT_EQ(0, installed_modules_and_result["installed_modules"].size());
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, lists_sorted_modules) {
+    const json installed_modules_and_result = watcher.get_installed_modules(dcs_install_path);
+    EXPECT_EQ("success", installed_modules_and_result["result"]);
+    EXPECT_EQ(json({"A-10C", "F-16C_50"}), installed_modules_and_result["installed_modules"]);
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, added_and_removed_modules) {
+    EXPECT_EQ(json({"A-10C", "F-16C_50"}), installed_modules());
+
+    write_clickabledata("AV8BNA", "elements = {}\n");
+    EXPECT_TRUE(wait_until([this]() { return installed_modules() == json({"A-10C", "AV8BNA", "F-16C_50"}); }));
+
+    std::filesystem::remove_all(dcs_install_path + "/mods/aircraft/A-10C");
+    EXPECT_TRUE(wait_until([this]() { return installed_modules() == json({"AV8BNA", "F-16C_50"}); }));
+    EXPECT_TRUE(wait_until([this]() {
+        const auto changed = get_changed_modules();
+        return std::find(changed.begin(), changed.end(), dcs_install_path + ":A-10C") != changed.end();
+    }));
+    const auto changed = get_changed_modules();
+    EXPECT_EQ(changed.end(), std::find(changed.begin(), changed.end(), dcs_install_path + ":F-16C_50"));
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, reports_changed_cockpit_scripts) {
+    installed_modules();
+    // Changes are only reported once the watcher has fingerprinted the modules.
+    EXPECT_TRUE(wait_until([this]() { return watcher.is_watching(); }));
+
+    write_clickabledata("F-16C_50", "elements = {'changed'}\n");
+    EXPECT_TRUE(wait_until([this]() { return !get_changed_modules().empty(); }));
+    EXPECT_EQ(std::vector<std::string>{dcs_install_path + ":F-16C_50"}, get_changed_modules());
+
+    // Files added in new directories of the cockpit scripts are also detected.
+    write_file(dcs_install_path + "/mods/aircraft/A-10C/Cockpit/Scripts/New/devices.lua", "devices = {}\n");
+    EXPECT_TRUE(wait_until([this]() { return get_changed_modules().size() == 2; }));
+    EXPECT_EQ(dcs_install_path + ":A-10C", get_changed_modules().back());
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, watching_stops_with_watcher) {
+    EXPECT_FALSE(watcher.is_watching());
+    installed_modules();
+    EXPECT_TRUE(wait_until([this]() { return watcher.is_watching(); }));
+    watcher.stop();
+    EXPECT_FALSE(watcher.is_watching());
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, switches_install_path) {
+    installed_modules();
+    const std::string other_install_path = test_directory + "/Other DCS World";
+    write_file(other_install_path + "/mods/aircraft/FA-18C/Cockpit/Scripts/clickabledata.lua", "elements = {}\n");
+    EXPECT_EQ(json({"FA-18C"}), watcher.get_installed_modules(other_install_path)["installed_modules"]);
+    EXPECT_EQ(json({"A-10C", "F-16C_50"}), installed_modules());
+}
+
+TEST_P(InstalledModuleWatcherTestFixture, uses_change_notifications_where_supported) {
+    installed_modules();
+#if defined(_WIN32) || defined(__linux__)
+    EXPECT_TRUE(wait_until([this]() { return watcher.is_using_change_notifications() == GetParam(); }));
+#else
+    EXPECT_FALSE(watcher.is_using_change_notifications());
+#endif
+}
+
+INSTANTIATE_TEST_CASE_P(ChangeNotificationsAndPolling, InstalledModuleWatcherTestFixture, ::testing::Bool());
+
+} // namespace test
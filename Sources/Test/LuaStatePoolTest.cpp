@@ -0,0 +1,178 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/LuaStatePool.cpp"
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
+namespace test {
+
+class LuaStatePoolTest : public ::testing::Test {
+  protected:
+    LuaStatePoolTest() : pool(2, {kMaxInstructions, kMaxMemoryBytes}) {}
+
+    void TearDown() override {
+        std::error_code error;
+        std::filesystem::remove(lua_script, error);
+    }
+
+    void write_script(const std::string &contents) {
+        std::ofstream script_file(lua_script, std::ios::trunc);
+        script_file << contents;
+    }
+
+    // Runs the script, setting global "input" and registering "output" which records the value passed to it.
+    std::string run_script(const std::string &input = "") {
+        output.clear();
+        return pool.run(lua_script, [this, input](lua_State *lua_state) {
+            lua_pushstring(lua_state, input.c_str());
+            lua_setglobal(lua_state, "input");
+            lua_pushlightuserdata(lua_state, &output);
+            lua_pushcclosure(
+                lua_state,
+                [](lua_State *lua_state) {
+                    auto *output = static_cast<std::string *>(lua_touserdata(lua_state, lua_upvalueindex(1)));
+                    *output = luaL_checkstring(lua_state, 1);
+                    return 0;
+                },
+                1);
+            lua_setglobal(lua_state, "output");
+        });
+    }
+
+    static constexpr uint64_t kMaxInstructions = 1000000;
+    static constexpr size_t kMaxMemoryBytes = 4 * 1024 * 1024;
+    const std::string lua_script = "lua_state_pool_test.lua";
+    LuaStatePool pool;
+    std::string output;
+};
+
+TEST_F(LuaStatePoolTest, runs_script_with_globals) {
+    write_script("output(input .. string.upper('_done'))");
+    EXPECT_EQ("success", run_script("run"));
+    EXPECT_EQ("run_DONE", output);
+}
+
+TEST_F(LuaStatePoolTest, reuses_warmed_state) {
+    write_script("output(input)");
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ("success", run_script(std::to_string(i)));
+        EXPECT_EQ(std::to_string(i), output);
+    }
+    EXPECT_EQ(1, pool.num_created_states());
+    EXPECT_EQ(1, pool.num_idle_states());
+}
+
+TEST_F(LuaStatePoolTest, globals_reset_between_runs) {
+    write_script("output(tostring(leaked) .. ',' .. tostring(also_leaked)); leaked = 1; _G.also_leaked = 1");
+    EXPECT_EQ("success", run_script());
+    EXPECT_EQ("nil,nil", output);
+    EXPECT_EQ("success", run_script());
+    EXPECT_EQ("nil,nil", output);
+    EXPECT_EQ(1, pool.num_created_states());
+}
+
+TEST_F(LuaStatePoolTest, loaded_chunks_share_run_globals) {
+    write_script("local chunk = loadstring('output(input); chunk_global = 1'); chunk();"
+                 "if chunk_global ~= 1 then error('chunk wrote to other globals') end");
+    EXPECT_EQ("success", run_script("from chunk"));
+    EXPECT_EQ("from chunk", output);
+}
+
+TEST_F(LuaStatePoolTest, recompiles_modified_script) {
+    write_script("output('first')");
+    EXPECT_EQ("success", run_script());
+    EXPECT_EQ("first", output);
+
+    write_script("output('second version')");
+    EXPECT_EQ("success", run_script());
+    EXPECT_EQ("second version", output);
+    EXPECT_EQ(1, pool.num_created_states());
+}
+
+TEST_F(LuaStatePoolTest, file_load_error) {
+    EXPECT_EQ("Lua file load error: 6", run_script());
+    write_script("this is not lua");
+    EXPECT_EQ("Lua file load error: 3", run_script());
+}
+
+TEST_F(LuaStatePoolTest, runtime_error_keeps_state) {
+    write_script("if input == 'fail' then error('failed') end output(input)");
+    EXPECT_EQ("Lua script runtime error: 2", run_script("fail"));
+    EXPECT_EQ("success", run_script("ok"));
+    EXPECT_EQ("ok", output);
+    EXPECT_EQ(1, pool.num_created_states());
+}
+
+TEST_F(LuaStatePoolTest, instruction_limit) {
+    write_script("if input == 'loop' then while true do pcall(function() end) end end output(input)");
+    EXPECT_EQ("Lua instruction limit exceeded", run_script("loop"));
+    EXPECT_EQ(0, pool.num_idle_states());
+
+    // The interrupted state is replaced by a new state.
+    EXPECT_EQ("success", run_script("ok"));
+    EXPECT_EQ("ok", output);
+    EXPECT_EQ(2, pool.num_created_states());
+}
+
+TEST_F(LuaStatePoolTest, memory_limit) {
+    write_script("local t = {} for i = 1, 10000000 do t[i] = tostring(i) end");
+    EXPECT_EQ("Lua memory limit exceeded", run_script());
+    EXPECT_EQ(0, pool.num_idle_states());
+}
+
+TEST_F(LuaStatePoolTest, memory_limit_applies_per_run) {
+    // Each run allocates most of the limit, which is freed before the next run.
+    write_script("local t = {} for i = 1, 20000 do t[i] = {i} end output('allocated')");
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_EQ("success", run_script());
+    }
+    EXPECT_EQ(1, pool.num_created_states());
+}
+
+TEST_F(LuaStatePoolTest, concurrent_runs) {
+    write_script("local sum = 0 for i = 1, 1000 do sum = sum + i end if sum ~= 500500 then error('bad sum') end");
+    std::vector<std::thread> threads;
+    std::atomic<int> num_success = 0;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([this, &num_success]() {
+            for (int i = 0; i < 20; ++i) {
+                if (pool.run(lua_script, [](lua_State *) {}) == "success") {
+                    ++num_success;
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(80, num_success);
+    EXPECT_LE(pool.num_idle_states(), 2);
+}
+
+TEST_F(LuaStatePoolTest, repeated_runs_reuse_one_state) {
+    // A script with a large body to parse, as module clickabledata scripts are.
+    std::string script = "local elements = {}\n";
+    for (int i = 0; i < 2000; ++i) {
+        script += "elements[" + std::to_string(i) + "] = {device = 'UFC', element = 'pnt_" + std::to_string(i) +
+                  "', arg = " + std::to_string(i) + ", hint = 'Hint for element'}\n";
+    }
+    write_script(script);
+    constexpr int kNumRuns = 5;
+
+    LuaStatePool unpooled(0, {kMaxInstructions, kMaxMemoryBytes});
+    for (int i = 0; i < kNumRuns; ++i) {
+        ASSERT_EQ("success", unpooled.run(lua_script, [](lua_State *) {}));
+        ASSERT_EQ("success", run_script());
+    }
+    EXPECT_EQ(kNumRuns, unpooled.num_created_states());
+    EXPECT_EQ(0, unpooled.num_idle_states());
+    EXPECT_EQ(1, pool.num_created_states());
+    EXPECT_EQ(1, pool.num_idle_states());
+}
+
+} // namespace test
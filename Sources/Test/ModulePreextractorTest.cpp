@@ -0,0 +1,139 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/ModulePreextractor.cpp"
+
+#include <filesystem>
+#include <fstream>
+
+namespace test {
+
+class ModulePreextractorTestFixture : public ::testing::Test {
+  public:
+    ModulePreextractorTestFixture()
+        : test_directory((std::filesystem::temp_directory_path() / "ModulePreextractorTest").string()),
+          dcs_install_path(test_directory + "/DCS World"), cache_directory(test_directory + "/cache"),
+          lua_script(test_directory + "/extract.lua") {
+        std::filesystem::remove_all(test_directory);
+        write_file(lua_script,
+                   "dofile(dcs_install_path .. '/mods/aircraft/' .. module_name .. '/Cockpit/clickabledata.lua')\n"
+                   "for _, element in ipairs(elements) do emit_element(element) end\n");
+    }
+
+    ~ModulePreextractorTestFixture() { std::filesystem::remove_all(test_directory); }
+
+    static void write_file(const std::string &path, const std::string &contents) {
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+        std::ofstream(path) << contents;
+    }
+
+    // Mocks a module with a number of clickabledata elements.
+    void add_module(const std::string &module_folder, const int num_elements) {
+        write_file(dcs_install_path + "/mods/aircraft/" + module_folder + "/Cockpit/clickabledata.lua",
+                   "elements = {}\n"
+                   "for i = 1, " +
+                       std::to_string(num_elements) +
+                       " do\n"
+                       "  elements[i] = {device = 'Device', device_id = i % 50, command = 3000 + i,\n"
+                       "                 element = 'element_' .. i, class = 'BTN', arg = i, arg_value = 1,\n"
+                       "                 arg_lim_min = 0, arg_lim_max = 1, hint = 'hint'}\n"
+                       "end\n");
+    }
+
+    std::string test_directory;
+    std::string dcs_install_path;
+    std::string cache_directory;
+    std::string lua_script;
+};
+
+TEST(ModulePreextractorTest, lookup_module_names_expands_versions) {
+    const std::vector<std::string> module_folders = {"A-10C", "C-101", "L-39C"};
+    const std::vector<std::string> expected = {"A-10C", "C-101CC", "C-101EB", "L-39C", "L-39ZA"};
+    EXPECT_EQ(expected, ModulePreextractor::lookup_module_names(module_folders));
+}
+
+TEST(ModulePreextractorTest, num_workers_for_cpu_budget) {
+    const size_t num_cores = std::max(1U, std::thread::hardware_concurrency());
+    EXPECT_EQ(1, ModulePreextractor::num_workers_for_cpu_budget(0.0));
+    EXPECT_EQ(1, ModulePreextractor::num_workers_for_cpu_budget(-1.0));
+    EXPECT_EQ(num_cores, ModulePreextractor::num_workers_for_cpu_budget(1.0));
+    EXPECT_EQ(num_cores, ModulePreextractor::num_workers_for_cpu_budget(5.0));
+}
+
+TEST_F(ModulePreextractorTestFixture, extracts_all_modules_into_cache) {
+    add_module("A-10C", 10);
+    add_module("F-16C_50", 20);
+    add_module("Empty-Folder", 0);
+    std::filesystem::remove(dcs_install_path + "/mods/aircraft/Empty-Folder/Cockpit/clickabledata.lua");
+
+    ClickabledataCache cache(cache_directory, 4);
+    ModulePreextractor preextractor(cache, lua_script, 0);
+    preextractor.start(dcs_install_path, 1.0);
+    EXPECT_EQ(dcs_install_path, preextractor.get_dcs_install_path());
+    preextractor.wait();
+
+    const auto progress = preextractor.get_progress();
+    EXPECT_EQ(3, progress.total_modules);
+    EXPECT_EQ(2, progress.extracted_modules);
+    EXPECT_EQ(1, progress.failed_modules);
+
+    // Expect lookups of the extracted modules to be served from the cache.
+    EXPECT_EQ(20, cache.get_clickabledata(dcs_install_path, "F-16C_50", lua_script).elements.size());
+    EXPECT_EQ(10, cache.get_clickabledata(dcs_install_path, "A-10C", lua_script).elements.size());
+    EXPECT_EQ(2, cache.get_stats().memory_hits);
+}
+
+TEST_F(ModulePreextractorTestFixture, missing_install_path) {
+    ClickabledataCache cache(cache_directory, 4);
+    ModulePreextractor preextractor(cache, lua_script, 0);
+    preextractor.start(test_directory + "/non-existant-path", 1.0);
+    preextractor.wait();
+    EXPECT_EQ(0, preextractor.get_progress().total_modules);
+}
+
+TEST_F(ModulePreextractorTestFixture, stop_clears_settings) {
+    add_module("A-10C", 10);
+    ClickabledataCache cache(cache_directory, 4);
+    ModulePreextractor preextractor(cache, lua_script, 0);
+    preextractor.start(dcs_install_path, 0.5);
+    EXPECT_EQ(0.5, preextractor.get_cpu_budget());
+    preextractor.stop();
+    EXPECT_EQ("", preextractor.get_dcs_install_path());
+}
+
+TEST_F(ModulePreextractorTestFixture, restart_within_start_delay_extracts_once) {
+    add_module("A-10C", 10);
+    add_module("F-16C_50", 20);
+    ClickabledataCache cache(cache_directory, 4);
+    ModulePreextractor preextractor(cache, lua_script, 100);
+
+    // Expect settings changed in quick succession to stop earlier extractions before they extract any module.
+    preextractor.start(dcs_install_path, 0.25);
+    preextractor.start(dcs_install_path, 0.5);
+    preextractor.stop();
+    preextractor.start(dcs_install_path, 1.0);
+    EXPECT_EQ(1.0, preextractor.get_cpu_budget());
+    preextractor.wait();
+    EXPECT_EQ(2, preextractor.get_progress().extracted_modules);
+    EXPECT_EQ(2, cache.get_stats().misses);
+}
+
+TEST_F(ModulePreextractorTestFixture, extracts_modules_with_one_or_all_workers) {
+    constexpr int kNumModules = 8;
+    for (int i = 0; i < kNumModules; ++i) {
+        add_module("Module-" + std::to_string(i), 100);
+    }
+
+    for (const double cpu_budget : {0.0, 1.0}) {
+        std::filesystem::remove_all(cache_directory);
+        ClickabledataCache cache(cache_directory, kNumModules);
+        ModulePreextractor preextractor(cache, lua_script, 0);
+        preextractor.start(dcs_install_path, cpu_budget);
+        preextractor.wait();
+        EXPECT_EQ(kNumModules, preextractor.get_progress().extracted_modules);
+        EXPECT_EQ(kNumModules, cache.get_stats().misses);
+    }
+}
+
+} // namespace test
@@ -0,0 +1,111 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/SharedGameState.cpp"
+
+#include <atomic>
+#include <thread>
+
+namespace test {
+
+TEST(SharedGameStateTest, reader_requires_published_state) {
+    EXPECT_THROW(SharedGameStateReader("SharedGameStateTest.unpublished"), std::runtime_error);
+}
+
+TEST(SharedGameStateTest, reads_published_values) {
+    SharedGameStateWriter writer("SharedGameStateTest.values");
+    SharedGameStateReader reader("SharedGameStateTest.values");
+    std::map<int, std::string> values;
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_TRUE(values.empty());
+    EXPECT_EQ(0, reader.update_count());
+
+    writer.publish({{765, "2.00"}, {-4096, "1"}, {761, "1"}, {2026, "TEXT_STR"}}, 4);
+    std::string value;
+    EXPECT_TRUE(reader.read_value(761, value));
+    EXPECT_EQ("1", value);
+    EXPECT_TRUE(reader.read_value(2026, value));
+    EXPECT_EQ("TEXT_STR", value);
+    EXPECT_TRUE(reader.read_value(-4096, value));
+    EXPECT_EQ("1", value);
+    EXPECT_FALSE(reader.read_value(762, value));
+    EXPECT_EQ(4, reader.update_count());
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_EQ((std::map<int, std::string>{{-4096, "1"}, {761, "1"}, {765, "2.00"}, {2026, "TEXT_STR"}}), values);
+
+    // Test that each publish replaces the whole table.
+    writer.publish({{765, "3.00"}}, 5);
+    EXPECT_FALSE(reader.read_value(761, value));
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_EQ((std::map<int, std::string>{{765, "3.00"}}), values);
+}
+
+TEST(SharedGameStateTest, full_table_drops_entries) {
+    SharedGameStateWriter writer("SharedGameStateTest.full", 2, 8);
+    SharedGameStateReader reader("SharedGameStateTest.full");
+    writer.publish({{1, "1"}, {2, "TOO_LONG_STR"}, {3, "3"}, {4, "4"}}, 1);
+    std::map<int, std::string> values;
+    EXPECT_TRUE(reader.read_all(values));
+    EXPECT_EQ((std::map<int, std::string>{{1, "1"}, {3, "3"}}), values);
+    EXPECT_EQ(2, reader.dropped_entries());
+}
+
+TEST(SharedGameStateTest, reused_by_restarted_writer) {
+    auto writer = std::make_unique<SharedGameStateWriter>("SharedGameStateTest.restart");
+    SharedGameStateReader reader("SharedGameStateTest.restart");
+    writer->publish({{761, "1"}}, 1);
+    writer.reset();
+
+    // Readers which remain open see the values of the restarted writer.
+    EXPECT_THROW(SharedGameStateWriter("SharedGameStateTest.restart", 16), std::runtime_error);
+    writer = std::make_unique<SharedGameStateWriter>("SharedGameStateTest.restart");
+    writer->publish({{761, "0"}}, 1);
+    std::string value;
+    EXPECT_TRUE(reader.read_value(761, value));
+    EXPECT_EQ("0", value);
+}
+
+TEST(SharedGameStateTest, concurrent_readers_see_consistent_snapshots) {
+    SharedGameStateWriter writer("SharedGameStateTest.concurrent");
+
+    // The writer publishes tables whose values all equal the update count, so any torn snapshot has mixed values.
+    constexpr unsigned kNumPublishes = 20000;
+    constexpr int kNumReaders = 3;
+    std::atomic<bool> publishing = true;
+    std::atomic<int> torn_snapshots = 0;
+    std::atomic<int> snapshots = 0;
+    std::vector<std::thread> readers;
+    for (int i = 0; i < kNumReaders; ++i) {
+        readers.emplace_back([&]() {
+            SharedGameStateReader reader("SharedGameStateTest.concurrent");
+            std::map<int, std::string> values;
+            while (publishing) {
+                if (!reader.read_all(values) || values.empty()) {
+                    continue;
+                }
+                const std::string first_value = values.begin()->second;
+                for (const auto &[dcs_id, value] : values) {
+                    torn_snapshots += (value != first_value) ? 1 : 0;
+                }
+                ++snapshots;
+            }
+        });
+    }
+    for (unsigned update_count = 1; update_count <= kNumPublishes; ++update_count) {
+        const std::string value = std::to_string(update_count) + std::string(update_count % 7, '.');
+        std::vector<std::pair<int, std::string_view>> values;
+        for (int dcs_id = 0; dcs_id < 50 + static_cast<int>(update_count % 50); ++dcs_id) {
+            values.emplace_back(dcs_id, value);
+        }
+        writer.publish(std::move(values), update_count);
+    }
+    publishing = false;
+    for (auto &reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(0, torn_snapshots);
+    EXPECT_LT(0, snapshots);
+}
+
+} // namespace test
@@ -0,0 +1,140 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/SharedMemoryRing.cpp"
+
+#include <chrono>
+#include <thread>
+
+namespace test {
+
+TEST(SharedMemoryRingTest, invalid_capacity) {
+    EXPECT_THROW(SharedMemoryRing("SharedMemoryRingTest.invalid", 0), std::runtime_error);
+    EXPECT_THROW(SharedMemoryRing("SharedMemoryRingTest.invalid", 100), std::runtime_error);
+}
+
+TEST(SharedMemoryRingTest, messages_received_in_order) {
+    SharedMemoryRing producer("SharedMemoryRingTest.in_order");
+    SharedMemoryRing consumer("SharedMemoryRingTest.in_order");
+
+    const std::string binary_packet("\0SDB\1\x08\x02", 7);
+    EXPECT_TRUE(producer.push("header*761=1:765=2.00"));
+    EXPECT_TRUE(producer.push(binary_packet));
+    EXPECT_TRUE(producer.push(""));
+    std::string message;
+    ASSERT_TRUE(consumer.pop(message, 0));
+    EXPECT_EQ("header*761=1:765=2.00", message);
+    ASSERT_TRUE(consumer.pop(message, 0));
+    EXPECT_EQ(binary_packet, message);
+    ASSERT_TRUE(consumer.pop(message, 0));
+    EXPECT_EQ("", message);
+    EXPECT_FALSE(consumer.pop(message, 10));
+}
+
+TEST(SharedMemoryRingTest, wraps_around_end_of_ring) {
+    SharedMemoryRing ring("SharedMemoryRingTest.wrap", 64);
+    // Messages of varying lengths end at every offset within the ring, including exactly at its end.
+    std::string message;
+    for (int i = 0; i < 100; ++i) {
+        const std::string sent(static_cast<size_t>(i % 21), static_cast<char>('a' + i % 26));
+        ASSERT_TRUE(ring.push(sent));
+        ASSERT_TRUE(ring.pop(message, 0));
+        EXPECT_EQ(sent, message);
+    }
+}
+
+TEST(SharedMemoryRingTest, full_ring_drops_messages) {
+    SharedMemoryRing ring("SharedMemoryRingTest.full", 64);
+    // Messages longer than half of the ring are never accepted.
+    EXPECT_FALSE(ring.push(std::string(29, 'x')));
+
+    // Each 12 byte message occupies a 16 byte record, so 4 fill the ring.
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(ring.push("message" + std::to_string(10000 + i)));
+    }
+    EXPECT_FALSE(ring.push("message10004"));
+
+    std::string message;
+    ASSERT_TRUE(ring.pop(message, 0));
+    EXPECT_EQ("message10000", message);
+    EXPECT_TRUE(ring.push("message10004"));
+    for (int i = 1; i <= 4; ++i) {
+        ASSERT_TRUE(ring.pop(message, 0));
+        EXPECT_EQ("message" + std::to_string(10000 + i), message);
+    }
+}
+
+TEST(SharedMemoryRingTest, corrupt_record_length_resets_ring) {
+    // Test that lengths reaching past the end of the ring or past the write position are rejected.
+    for (const uint32_t corrupt_length : {uint32_t{1000}, uint32_t{61}, uint32_t{20}}) {
+        const std::string name = "SharedMemoryRingTest.corrupt" + std::to_string(corrupt_length);
+        SharedMemoryRing ring(name, 64);
+        // Open the mapping as another process writing to the ring would, where records follow the header lines.
+        const size_t mapping_size = 3 * kCacheLineSize + 64;
+        const std::string mapping_name = "Local\\" + name;
+        HANDLE mapping = CreateFileMappingA(
+            INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, static_cast<DWORD>(mapping_size), mapping_name.c_str());
+        ASSERT_NE(nullptr, mapping);
+        void *view = MapViewOfFile(mapping, FILE_MAP_ALL_ACCESS, 0, 0, mapping_size);
+        ASSERT_NE(nullptr, view);
+
+        ASSERT_TRUE(ring.push("message"));
+        std::memcpy(static_cast<uint8_t *>(view) + 3 * kCacheLineSize, &corrupt_length, kLengthSize);
+        std::string message;
+        EXPECT_FALSE(ring.pop(message, 0));
+
+        // Test that the ring was reset to empty, so following messages are received.
+        EXPECT_FALSE(ring.pop(message, 0));
+        ASSERT_TRUE(ring.push("message"));
+        ASSERT_TRUE(ring.pop(message, 0));
+        EXPECT_EQ("message", message);
+        UnmapViewOfFile(view);
+        CloseHandle(mapping);
+    }
+}
+
+TEST(SharedMemoryRingTest, waiting_consumer_woken_by_producer) {
+    SharedMemoryRing producer("SharedMemoryRingTest.wakeup");
+    SharedMemoryRing consumer("SharedMemoryRingTest.wakeup");
+
+    std::thread producer_thread([&producer]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        producer.push("header*761=1");
+    });
+    const auto start = std::chrono::steady_clock::now();
+    std::string message;
+    EXPECT_TRUE(consumer.pop(message, 5000));
+    const auto wait_time = std::chrono::steady_clock::now() - start;
+    producer_thread.join();
+    EXPECT_EQ("header*761=1", message);
+    EXPECT_LT(wait_time, std::chrono::seconds(1));
+}
+
+TEST(SharedMemoryRingTest, concurrent_producer_and_consumer) {
+    SharedMemoryRing producer("SharedMemoryRingTest.concurrent", 256);
+    SharedMemoryRing consumer("SharedMemoryRingTest.concurrent", 256);
+
+    // The producer retries when the small ring is full, so the consumer alternates between draining and waiting.
+    constexpr int kNumMessages = 100000;
+    std::thread producer_thread([&producer]() {
+        for (int i = 0; i < kNumMessages; ++i) {
+            const std::string message = std::to_string(i) + std::string(static_cast<size_t>(i % 13), '.');
+            while (!producer.push(message)) {
+                std::this_thread::yield();
+            }
+        }
+    });
+    int received = 0;
+    std::string message;
+    while (received < kNumMessages && consumer.pop(message, 1000)) {
+        if (message != std::to_string(received) + std::string(static_cast<size_t>(received % 13), '.')) {
+            break;
+        }
+        ++received;
+    }
+    producer_thread.join();
+    EXPECT_EQ(kNumMessages, received);
+}
+
+} // namespace test
@@ -0,0 +1,78 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/SlotMap.h"
+
+#include <string>
+
+namespace test {
+
+TEST(SlotMapTest, insert_and_get) {
+    SlotMap<std::string> slot_map;
+    const SlotMapHandle handle_a = slot_map.insert("a");
+    const SlotMapHandle handle_b = slot_map.insert("b");
+    EXPECT_NE(handle_a, handle_b);
+    EXPECT_EQ(2, slot_map.size());
+    ASSERT_NE(nullptr, slot_map.get(handle_a));
+    EXPECT_EQ("a", *slot_map.get(handle_a));
+    ASSERT_NE(nullptr, slot_map.get(handle_b));
+    EXPECT_EQ("b", *slot_map.get(handle_b));
+
+    // Modify value through handle.
+    *slot_map.get(handle_a) = "c";
+    EXPECT_EQ("c", *slot_map.get(handle_a));
+}
+
+TEST(SlotMapTest, erase_invalidates_handle) {
+    SlotMap<std::string> slot_map;
+    const SlotMapHandle handle = slot_map.insert("a");
+    EXPECT_TRUE(slot_map.erase(handle));
+    EXPECT_FALSE(slot_map.contains(handle));
+    EXPECT_EQ(nullptr, slot_map.get(handle));
+    EXPECT_EQ(0, slot_map.size());
+
+    // Erasing a stale handle fails safely.
+    EXPECT_FALSE(slot_map.erase(handle));
+    EXPECT_EQ(0, slot_map.size());
+}
+
+TEST(SlotMapTest, stale_handle_after_slot_reuse) {
+    SlotMap<std::string> slot_map;
+    const SlotMapHandle old_handle = slot_map.insert("old");
+    slot_map.erase(old_handle);
+    const SlotMapHandle new_handle = slot_map.insert("new");
+
+    // Expect the slot to be reused with a new generation.
+    EXPECT_EQ(old_handle.index, new_handle.index);
+    EXPECT_NE(old_handle.generation, new_handle.generation);
+    EXPECT_EQ(nullptr, slot_map.get(old_handle));
+    EXPECT_FALSE(slot_map.erase(old_handle));
+    EXPECT_EQ("new", *slot_map.get(new_handle));
+}
+
+TEST(SlotMapTest, handle_out_of_range) {
+    SlotMap<int> slot_map;
+    EXPECT_EQ(nullptr, slot_map.get(SlotMapHandle{5, 0}));
+    EXPECT_FALSE(slot_map.erase(SlotMapHandle{5, 0}));
+}
+
+TEST(SlotMapTest, for_each_visits_live_values) {
+    SlotMap<int> slot_map;
+    const SlotMapHandle handle_1 = slot_map.insert(1);
+    const SlotMapHandle handle_2 = slot_map.insert(2);
+    const SlotMapHandle handle_3 = slot_map.insert(3);
+    slot_map.erase(handle_2);
+
+    int sum = 0;
+    int count = 0;
+    slot_map.for_each([&](const SlotMapHandle handle, int &value) {
+        EXPECT_TRUE(handle == handle_1 || handle == handle_3);
+        sum += value;
+        ++count;
+    });
+    EXPECT_EQ(4, sum);
+    EXPECT_EQ(2, count);
+}
+
+} // namespace test
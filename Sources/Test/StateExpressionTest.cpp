@@ -0,0 +1,140 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/StateExpression.cpp"
+
+namespace test {
+
+TEST(StateExpressionTest, input_dcs_ids_sorted_and_unique) {
+    StateExpression expression("id 404 > 0.5 && id 372 == 1 || id 404 < 0.1");
+    EXPECT_EQ(std::vector<int>({372, 404}), expression.input_dcs_ids());
+}
+
+TEST(StateExpressionTest, invalid_expressions) {
+    EXPECT_THROW(StateExpression(""), std::runtime_error);
+    EXPECT_THROW(StateExpression("id"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id abc > 1"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 >"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 > 1 &&"), std::runtime_error);
+    EXPECT_THROW(StateExpression("(id 404 > 1"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 > 1)"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 = 1"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 == \"ON"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 in [0.1 0.2]"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 404 in [id 3, 0.2]"), std::runtime_error);
+    EXPECT_THROW(StateExpression("1.2.3 > 1"), std::runtime_error);
+}
+
+TEST(StateExpressionTest, out_of_range_dcs_id) {
+    EXPECT_THROW(StateExpression("id 99999999999 > 1"), std::runtime_error);
+    EXPECT_THROW(StateExpression("id 2147483648 > 1"), std::runtime_error);
+    EXPECT_EQ(std::vector<int>({2147483647}), StateExpression("id 2147483647 > 1").input_dcs_ids());
+}
+
+TEST(StateExpressionTest, too_deeply_nested) {
+    std::string expression = "id 1 == 1";
+    for (int i = 0; i < 40; ++i) {
+        expression = "id 1 == 1 || (" + expression + ")";
+    }
+    EXPECT_THROW(StateExpression{expression}, std::runtime_error);
+}
+
+TEST(StateExpressionTest, too_deeply_nested_parentheses_and_negations) {
+    // Expect nesting which adds no evaluation stack depth to be limited before it can exhaust the parser's stack.
+    const size_t nesting = StateExpression::kMaxNestingDepth;
+    EXPECT_NO_THROW(StateExpression{std::string(nesting, '(') + "id 1" + std::string(nesting, ')')});
+    EXPECT_NO_THROW(StateExpression{std::string(nesting, '!') + "id 1"});
+    EXPECT_THROW(StateExpression{std::string(nesting + 1, '(') + "id 1" + std::string(nesting + 1, ')')},
+                 std::runtime_error);
+    EXPECT_THROW(StateExpression{std::string(nesting + 1, '!') + "id 1"}, std::runtime_error);
+    EXPECT_THROW(StateExpression{std::string(100000, '(')}, std::runtime_error);
+    EXPECT_THROW(StateExpression{std::string(100000, '!')}, std::runtime_error);
+}
+
+class StateExpressionTestFixture : public ::testing::Test {
+  public:
+    StateExpressionTestFixture()
+        : // Mock DCS socket uses the reverse rx and tx ports of dcs_interface so it can communicate with it.
+          mock_dcs(connection_settings.ip_address, connection_settings.tx_port, connection_settings.rx_port),
+          dcs_interface(connection_settings) {
+
+        // Consume intial reset command sent to to mock_dcs.
+        (void)mock_dcs.DcsReceive();
+
+        std::string mock_dcs_message = "header*404=0.75:372=1:373=0:2026=TEXT_STR:2027=-0.5";
+        mock_dcs.DcsSend(mock_dcs_message);
+        dcs_interface.update_dcs_state();
+    }
+
+    bool evaluate(const std::string &expression) { return StateExpression(expression).evaluate(&dcs_interface); }
+
+    DcsConnectionSettings connection_settings = {"1908", "1909", "127.0.0.1"};
+    DcsSocket mock_dcs;         // A socket that will mock Send/Receive messages from DCS.
+    DcsInterface dcs_interface; // DCS Interface to test.
+};
+
+TEST_F(StateExpressionTestFixture, numeric_comparisons) {
+    EXPECT_TRUE(evaluate("id 404 > 0.5"));
+    EXPECT_FALSE(evaluate("id 404 > 0.75"));
+    EXPECT_TRUE(evaluate("id 404 >= 0.75"));
+    EXPECT_TRUE(evaluate("id 404 < 1"));
+    EXPECT_TRUE(evaluate("id 404 <= 0.75"));
+    EXPECT_TRUE(evaluate("id 404 == 0.750"));
+    EXPECT_TRUE(evaluate("id 404 != 0.7"));
+    EXPECT_TRUE(evaluate("id 2027 < -0.25"));
+    EXPECT_TRUE(evaluate("id 372 > id 373"));
+}
+
+TEST_F(StateExpressionTestFixture, logical_operators) {
+    EXPECT_TRUE(evaluate("id 404 > 0.5 && id 372 == 1"));
+    EXPECT_FALSE(evaluate("id 404 > 0.5 && id 373 == 1"));
+    EXPECT_TRUE(evaluate("id 404 > 0.9 || id 372 == 1"));
+    EXPECT_TRUE(evaluate("!(id 404 > 0.9)"));
+    EXPECT_TRUE(evaluate("id 373 == 1 || id 372 == 1 && id 404 > 0.5"));
+    EXPECT_FALSE(evaluate("(id 373 == 1 || id 372 == 1) && id 404 > 0.9"));
+    EXPECT_TRUE(evaluate("true"));
+    EXPECT_FALSE(evaluate("false"));
+}
+
+TEST_F(StateExpressionTestFixture, bare_dcs_id_is_nonzero_test) {
+    EXPECT_TRUE(evaluate("id 372"));
+    EXPECT_FALSE(evaluate("id 373"));
+    EXPECT_TRUE(evaluate("!id 373"));
+    EXPECT_FALSE(evaluate("id 2026"));
+    EXPECT_FALSE(evaluate("id 999"));
+}
+
+TEST_F(StateExpressionTestFixture, ranges) {
+    EXPECT_TRUE(evaluate("id 404 in [0.5, 1]"));
+    EXPECT_TRUE(evaluate("id 404 in [0.75, 0.75]"));
+    EXPECT_FALSE(evaluate("id 404 in [0, 0.5]"));
+    EXPECT_TRUE(evaluate("id 2027 in [-1, 0]"));
+    EXPECT_FALSE(evaluate("id 2026 in [-1, 1]"));
+}
+
+TEST_F(StateExpressionTestFixture, string_comparisons) {
+    EXPECT_TRUE(evaluate("id 2026 == \"TEXT_STR\""));
+    EXPECT_FALSE(evaluate("id 2026 != \"TEXT_STR\""));
+    EXPECT_TRUE(evaluate("id 2026 != \"OTHER\""));
+    EXPECT_FALSE(evaluate("id 2026 > \"OTHER\""));
+    EXPECT_FALSE(evaluate("id 2026 == 1"));
+}
+
+TEST_F(StateExpressionTestFixture, missing_dcs_id_comparisons_are_false) {
+    EXPECT_FALSE(evaluate("id 999 == 0"));
+    EXPECT_FALSE(evaluate("id 999 != 0"));
+    EXPECT_FALSE(evaluate("id 999 == \"\""));
+    EXPECT_TRUE(evaluate("!(id 999 == 0)"));
+}
+
+TEST_F(StateExpressionTestFixture, reevaluates_with_updated_game_state) {
+    StateExpression expression("id 404 > 0.5 && id 372 == 1");
+    EXPECT_TRUE(expression.evaluate(&dcs_interface));
+
+    mock_dcs.DcsSend("header*404=0.25");
+    dcs_interface.update_dcs_state();
+    EXPECT_FALSE(expression.evaluate(&dcs_interface));
+}
+
+} // namespace test
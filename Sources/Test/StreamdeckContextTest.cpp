@@ -362,6 +362,172 @@ TEST_F(StreamdeckContextComparisonTestFixture, dcs_id_float_compare_to_float_wit
     EXPECT_EQ(esd_connection_manager.state_, 1);
 }
 
+TEST_F(StreamdeckContextTestFixture, update_context_state_state_expressions) {
+    // Each expression line is an alternative condition for the second state.
+    const json settings = {{"dcs_id_state_expressions", "id 761 == 0\nid 765 > 1 && id 2027 < 0.5"}};
+    StreamdeckContext test_context("def456", settings);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.context_, "def456");
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+
+    // Expect the second state while another line is satisfied.
+    mock_dcs.DcsSend("header*761=0:2027=0.9");
+    dcs_interface.update_dcs_state();
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+
+    // Expect state returns to first state when no expression is satisfied.
+    mock_dcs.DcsSend("header*761=1");
+    dcs_interface.update_dcs_state();
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 0);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_state_expressions_blank_lines) {
+    const json settings = {{"dcs_id_state_expressions", "\n  \nid 761 == 1"}};
+    StreamdeckContext test_context("def456", settings);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_state_expressions_override_compare_monitor) {
+    const json settings = {{"dcs_id_compare_monitor", "765"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "2.0"},
+                           {"dcs_id_state_expressions", "id 765 == 0"}};
+    StreamdeckContext test_context("def456", settings);
+    esd_connection_manager.state_ = -1;
+    test_context.forceSendState(&esd_connection_manager);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 0);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_invalid_state_expressions_ignored) {
+    // Expect an invalid expression to disable all state expressions, falling back to the compare monitor.
+    const json settings = {{"dcs_id_compare_monitor", "765"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "2.0"},
+                           {"dcs_id_state_expressions", "id 765 == 0\nid 765 =="}};
+    StreamdeckContext test_context("def456", settings);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_state_expressions_only_on_input_change) {
+    const json settings = {{"dcs_id_state_expressions", "id 761 == 1"}};
+    StreamdeckContext test_context("def456", settings);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+
+    // A change to an unrelated DCS ID does not alter the state.
+    esd_connection_manager.clear_buffer();
+    mock_dcs.DcsSend("header*765=5");
+    dcs_interface.update_dcs_state();
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.context_, "");
+
+    // Clearing the game state is treated as a change to all inputs.
+    dcs_interface.clear_game_state();
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.context_, "def456");
+    EXPECT_EQ(esd_connection_manager.state_, 0);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_state_expressions_after_interface_replaced) {
+    const json settings = {{"dcs_id_state_expressions", "id 761 == 1"}};
+    StreamdeckContext test_context("def456", settings);
+    for (int i = 0; i < 5; ++i) {
+        mock_dcs.DcsSend("header*765=" + std::to_string(i) + ":761=1");
+        dcs_interface.update_dcs_state();
+    }
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+
+    // A new DcsInterface restarts its update counts, which must still be treated as a change of inputs.
+    const DcsConnectionSettings replaced_settings = {"2306", "2307", "127.0.0.1"};
+    DcsSocket replaced_mock_dcs(replaced_settings.ip_address, replaced_settings.tx_port, replaced_settings.rx_port);
+    DcsInterface replaced_interface(replaced_settings);
+    replaced_mock_dcs.DcsSend("header*761=0");
+    replaced_interface.update_dcs_state();
+    test_context.updateContextState(&replaced_interface, &esd_connection_manager);
+    EXPECT_EQ(esd_connection_manager.state_, 0);
+}
+
+TEST(StreamdeckContextTest, append_monitored_dcs_ids) {
+    std::vector<int> dcs_ids;
+    StreamdeckContext("abc123").appendMonitoredDcsIds(dcs_ids);
+    EXPECT_TRUE(dcs_ids.empty());
+
+    const json settings = {{"dcs_id_increment_monitor", "300"},
+                           {"dcs_id_compare_monitor", "765"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "2.0"},
+                           {"dcs_id_string_monitor", "2026"}};
+    StreamdeckContext("abc123", settings).appendMonitoredDcsIds(dcs_ids);
+    EXPECT_EQ(std::vector<int>({300, 765, 2026}), dcs_ids);
+
+    // Test that state expressions replace the compare monitor, as they do when updating the context state.
+    dcs_ids.clear();
+    json expression_settings = settings;
+    expression_settings["dcs_id_state_expressions"] = "id 761 == 0\nid 765 > 1 && id 2027 < 0.5";
+    StreamdeckContext("abc123", expression_settings).appendMonitoredDcsIds(dcs_ids);
+    EXPECT_EQ(std::vector<int>({300, 761, 765, 2027, 2026}), dcs_ids);
+}
+
+TEST(StreamdeckContextTest, append_monitored_dcs_bios_outputs) {
+    const json settings = {{"dcs_id_compare_monitor", "0x4426/0x0100/8"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "1"},
+                           {"dcs_id_string_monitor", "0x4426/0x0101/0"}};
+    std::vector<int> dcs_ids;
+    StreamdeckContext("abc123", settings).appendMonitoredDcsIds(dcs_ids);
+
+    // Test that DCS-BIOS outputs are monitored as the negative DCS IDs representing them, and invalid ones are not.
+    DcsBiosOutput output;
+    ASSERT_EQ(1, dcs_ids.size());
+    ASSERT_TRUE(dcs_id_to_dcs_bios_output(dcs_ids[0], output));
+    EXPECT_EQ(0x4426, output.address);
+    EXPECT_EQ(0x0100, output.mask);
+    EXPECT_EQ(8, output.shift);
+}
+
+TEST_F(StreamdeckContextTestFixture, update_context_state_from_compare_monitor_table) {
+    const json settings = {{"dcs_id_compare_monitor", "765"},
+                           {"dcs_id_compare_condition", "EQUAL_TO"},
+                           {"dcs_id_comparison_value", "2.0"}};
+    StreamdeckContext test_context("def456", settings);
+    CompareMonitorTable compare_monitors;
+    test_context.setCompareMonitorRow(compare_monitors.add(test_context.getCompareMonitor()));
+
+    // Expect the context state to come from the table, which has not yet been evaluated.
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager, &compare_monitors);
+    EXPECT_EQ(esd_connection_manager.context_, "");
+
+    compare_monitors.evaluate(&dcs_interface);
+    test_context.updateContextState(&dcs_interface, &esd_connection_manager, &compare_monitors);
+    EXPECT_EQ(esd_connection_manager.context_, "def456");
+    EXPECT_EQ(esd_connection_manager.state_, 1);
+}
+
+TEST_F(StreamdeckContextTestFixture, get_compare_monitor) {
+    EXPECT_FALSE(fixture_context.getCompareMonitor());
+
+    fixture_context.updateContextSettings({{"dcs_id_compare_monitor", "765"},
+                                           {"dcs_id_compare_condition", "LESS_THAN"},
+                                           {"dcs_id_comparison_value", "2.5"}});
+    const std::optional<CompareMonitor> monitor = fixture_context.getCompareMonitor();
+    ASSERT_TRUE(monitor);
+    EXPECT_EQ(765, monitor->dcs_id);
+    EXPECT_EQ(LESS_THAN, monitor->condition);
+    EXPECT_EQ(2.5, monitor->comparison_value);
+
+    // State expressions take priority over the compare monitor.
+    fixture_context.updateContextSettings({{"dcs_id_compare_monitor", "765"},
+                                           {"dcs_id_comparison_value", "2.5"},
+                                           {"dcs_id_state_expressions", "id 765 > 1"}});
+    EXPECT_FALSE(fixture_context.getCompareMonitor());
+}
+
 TEST_F(StreamdeckContextTestFixture, force_send_state_update) {
     // Test 1 -- With updateContextState and no detected state changes, no state is sent to connection manager.
     fixture_context.updateContextState(&dcs_interface, &esd_connection_manager);
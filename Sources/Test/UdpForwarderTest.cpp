@@ -0,0 +1,48 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/DcsSocket.h"
+#include "../DcsInterface/UdpForwarder.cpp"
+
+namespace test {
+
+TEST(UdpForwarderTest, parse_endpoints) {
+    EXPECT_EQ(std::vector<std::string>({"127.0.0.1:1625", "10.0.0.2:1725", "127.0.0.1:1825"}),
+              parse_udp_endpoints("127.0.0.1:1625, 10.0.0.2:1725 127.0.0.1:1825,"));
+    EXPECT_TRUE(parse_udp_endpoints("").empty());
+    EXPECT_TRUE(parse_udp_endpoints(" , ").empty());
+}
+
+TEST(UdpForwarderTest, invalid_endpoints) {
+    EXPECT_THROW(UdpForwarder({"127.0.0.1"}), std::runtime_error);
+    EXPECT_THROW(UdpForwarder({":1625"}), std::runtime_error);
+    EXPECT_THROW(UdpForwarder({"127.0.0.1:abc"}), std::runtime_error);
+}
+
+TEST(UdpForwarderTest, forwards_datagrams_unchanged) {
+    DcsSocket ikarus("127.0.0.1", "1625", "1626");
+    DcsSocket other_consumer("127.0.0.1", "1627", "1628");
+    UdpForwarder forwarder({"127.0.0.1:1625", "127.0.0.1:1627"});
+
+    const std::string text_packet = "header*761=1:765=2.00";
+    const std::string binary_packet("\0SDB\1\x08\x02", 7);
+    forwarder.forward(text_packet);
+    forwarder.forward(binary_packet);
+    EXPECT_EQ(text_packet, ikarus.DcsReceive().str());
+    EXPECT_EQ(binary_packet, ikarus.DcsReceive().str());
+    EXPECT_EQ(text_packet, other_consumer.DcsReceive().str());
+    EXPECT_EQ(binary_packet, other_consumer.DcsReceive().str());
+
+    const std::vector<UdpForwardStats> &stats = forwarder.get_stats();
+    ASSERT_EQ(2, stats.size());
+    EXPECT_EQ("127.0.0.1:1625", stats[0].endpoint);
+    EXPECT_EQ("127.0.0.1:1627", stats[1].endpoint);
+    for (const UdpForwardStats &destination_stats : stats) {
+        EXPECT_EQ(2, destination_stats.datagrams_forwarded);
+        EXPECT_EQ(text_packet.size() + binary_packet.size(), destination_stats.bytes_sent);
+        EXPECT_EQ(0, destination_stats.datagrams_dropped);
+    }
+}
+
+} // namespace test
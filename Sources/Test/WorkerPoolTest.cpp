@@ -0,0 +1,115 @@
+// Copyright 2020 Charles Tytler
+
+#include "gtest/gtest.h"
+
+#include "../DcsInterface/WorkerPool.cpp"
+
+#include <chrono>
+#include <future>
+
+namespace test {
+
+// Blocks jobs until released by the test, so the state of the queue is deterministic.
+class JobGate {
+  public:
+    void wait() { released_.wait(); }
+    void release() { release_.set_value(); }
+
+  private:
+    std::promise<void> release_;
+    std::shared_future<void> released_ = release_.get_future().share();
+};
+
+TEST(WorkerPoolTest, runs_submitted_jobs) {
+    std::atomic<int> jobs_run = 0;
+    {
+        WorkerPool worker_pool(2, 10);
+        std::promise<void> all_done;
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_TRUE(worker_pool.submit("context", [&](const std::atomic<bool> &) {
+                if (++jobs_run == 5) {
+                    all_done.set_value();
+                }
+            }));
+        }
+        EXPECT_EQ(std::future_status::ready, all_done.get_future().wait_for(std::chrono::seconds(5)));
+    }
+    EXPECT_EQ(5, jobs_run);
+}
+
+TEST(WorkerPoolTest, rejects_jobs_when_queue_full) {
+    JobGate gate;
+    std::promise<void> job_started;
+    WorkerPool worker_pool(1, 2);
+
+    // Occupy the only worker, then fill the queue.
+    EXPECT_TRUE(worker_pool.submit("context", [&](const std::atomic<bool> &) {
+        job_started.set_value();
+        gate.wait();
+    }));
+    job_started.get_future().wait();
+    EXPECT_TRUE(worker_pool.submit("context", [](const std::atomic<bool> &) {}));
+    EXPECT_TRUE(worker_pool.submit("context", [](const std::atomic<bool> &) {}));
+    EXPECT_EQ(2, worker_pool.num_queued_jobs());
+    EXPECT_FALSE(worker_pool.submit("context", [](const std::atomic<bool> &) {}));
+    gate.release();
+}
+
+TEST(WorkerPoolTest, cancel_discards_queued_and_flags_running_jobs) {
+    JobGate gate;
+    std::promise<void> job_started;
+    std::promise<bool> running_job_cancelled;
+    std::atomic<int> queued_jobs_run = 0;
+    {
+        WorkerPool worker_pool(1, 10);
+        worker_pool.submit("context_a", [&](const std::atomic<bool> &is_cancelled) {
+            job_started.set_value();
+            gate.wait();
+            running_job_cancelled.set_value(is_cancelled);
+        });
+        job_started.get_future().wait();
+        worker_pool.submit("context_a", [&](const std::atomic<bool> &) { ++queued_jobs_run; });
+        worker_pool.submit("context_b", [&](const std::atomic<bool> &) { ++queued_jobs_run; });
+        worker_pool.submit("context_a", [&](const std::atomic<bool> &) { ++queued_jobs_run; });
+        EXPECT_EQ(3, worker_pool.num_queued_jobs());
+
+        // Expect only the jobs of the cancelled owner to be discarded.
+        worker_pool.cancel("context_a");
+        EXPECT_EQ(1, worker_pool.num_queued_jobs());
+        gate.release();
+        EXPECT_TRUE(running_job_cancelled.get_future().get());
+
+        // Wait for the remaining job before destroying the pool (which would discard it).
+        while (worker_pool.num_queued_jobs() > 0 || queued_jobs_run == 0) {
+            std::this_thread::yield();
+        }
+    }
+    EXPECT_EQ(1, queued_jobs_run);
+}
+
+TEST(WorkerPoolTest, job_exception_does_not_stop_worker) {
+    WorkerPool worker_pool(1, 10);
+    std::promise<void> second_job_run;
+    worker_pool.submit("context", [](const std::atomic<bool> &) { throw std::runtime_error("Job failed"); });
+    worker_pool.submit("context", [&](const std::atomic<bool> &) { second_job_run.set_value(); });
+    EXPECT_EQ(std::future_status::ready, second_job_run.get_future().wait_for(std::chrono::seconds(5)));
+}
+
+TEST(WorkerPoolTest, destructor_cancels_running_jobs) {
+    std::promise<void> job_started;
+    std::atomic<bool> job_saw_cancel = false;
+    {
+        WorkerPool worker_pool(1, 10);
+        worker_pool.submit("context", [&](const std::atomic<bool> &is_cancelled) {
+            job_started.set_value();
+            while (!is_cancelled) {
+                std::this_thread::yield();
+            }
+            job_saw_cancel = true;
+        });
+        job_started.get_future().wait();
+    }
+    EXPECT_TRUE(job_saw_cancel);
+}
+
+} // namespace test
@@ -1,4 +1,5 @@
--- Calling script must define dcs_install_path and module_name as global variables.
+-- Calling script must define dcs_install_path and module_name as global variables, and the function
+-- emit_element(attributes) which is called with a table of attributes for each clickabledata element.
 -- Examples below:
         -- dcs_install_path = [[C:\Program Files\Eagle Dynamics\DCS World OpenBeta]]
         -- module_name = "A-10C"
@@ -83,9 +84,7 @@ function get_index_value(table, index)
 	return ""
 end
 
-function collect_element_attributes(elements)
-	collected_element_attributes = {}
-	local count = 0
+function emit_element_attributes(elements)
 	for element_id,_ in pairs(elements) do
 		local element_name = element_id
 		local hint = elements[element_id].hint
@@ -123,12 +122,11 @@ function collect_element_attributes(elements)
             if (device_id == nil) then
                 device_id = "" 
             end
-			count = count + 1
-			collected_element_attributes[count] = string.format('%s(%s),%s,%s,%s,%s,%s,%s,%s,%s',
-					device_name, device_id, command_id, element_name, class_name, arg, arg_value, arg_lim1, arg_lim2, hint)
+			emit_element{device = device_name, device_id = device_id, command = command_id, element = element_name,
+					class = class_name, arg = arg, arg_value = arg_value, arg_lim_min = arg_lim1, arg_lim_max = arg_lim2,
+					hint = hint}
 		end
 	end
-	return collected_element_attributes
 end
 
 function load_module(module_name)
@@ -152,10 +150,8 @@ function load_module(module_name)
 	end
 
 	script_to_run()
-	
-	element_list = collect_element_attributes(elements)
-	return element_list
+
+	emit_element_attributes(elements)
 end
 
-list = load_module(module_name)
-return unpack(list)
+load_module(module_name)
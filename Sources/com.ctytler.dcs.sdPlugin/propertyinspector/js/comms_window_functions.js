@@ -12,6 +12,11 @@ function callbackUpdateConnectionSettings() {
     window.opener.global_settings["ip_address"] = document.getElementById("ip_address").value;
     window.opener.global_settings["listener_port"] = document.getElementById("listener_port").value;
     window.opener.global_settings["send_port"] = document.getElementById("send_port").value;
+    window.opener.global_settings["multicast_group"] = document.getElementById("multicast_group").value;
+    window.opener.global_settings["forward_endpoints"] = document.getElementById("forward_endpoints").value;
+    window.opener.global_settings["shared_memory_name"] = document.getElementById("shared_memory_name").value;
+    window.opener.global_settings["shared_state_name"] = document.getElementById("shared_state_name").value;
+    window.opener.global_settings["commands_per_frame"] = document.getElementById("commands_per_frame").value;
     sendmessage("updateGlobalSettings", window.opener.global_settings);
 }
 
@@ -24,12 +29,35 @@ function restoreGlobalSettings(settings) {
     document.getElementById("ip_address").value = settings.ip_address;
     document.getElementById("listener_port").value = settings.listener_port;
     document.getElementById("send_port").value = settings.send_port;
+    document.getElementById("multicast_group").value = settings.multicast_group || "";
+    document.getElementById("forward_endpoints").value = settings.forward_endpoints || "";
+    document.getElementById("shared_memory_name").value = settings.shared_memory_name || "";
+    document.getElementById("shared_state_name").value = settings.shared_state_name || "";
+    document.getElementById("commands_per_frame").value = settings.commands_per_frame || "";
+    document.getElementById("capture_all_dcs_ids_check").checked = (settings.capture_all_dcs_ids == true);
+    document.getElementById("filter_dcs_ids_check").checked = (settings.filter_dcs_ids == true);
     // Fields and button remain hidden until we've received settings from PI
     // to avoid showing the wrong information.
     document.getElementById("connection_settings_div").hidden = false;
     console.log("Restored global settings: ", settings);
 }
 
+/**
+ * Sets whether the plugin stores all received DCS IDs, rather than only those used by buttons, so they can be shown.
+ */
+function callbackUpdateCaptureAllDcsIds() {
+    window.opener.global_settings["capture_all_dcs_ids"] = document.getElementById("capture_all_dcs_ids_check").checked;
+    sendmessage("updateGlobalSettings", window.opener.global_settings);
+}
+
+/**
+ * Sets whether the plugin stores only DCS IDs used by buttons even if export scripts do not support digest commands.
+ */
+function callbackUpdateFilterDcsIds() {
+    window.opener.global_settings["filter_dcs_ids"] = document.getElementById("filter_dcs_ids_check").checked;
+    sendmessage("updateGlobalSettings", window.opener.global_settings);
+}
+
 /**
  * Sends a message to the plugin requesting a refresh of the DCS game state.
  */
@@ -41,8 +69,19 @@ function callbackRefreshDcsGameState() {
  * Populates rows of table with the DCS ID and values from received DCS game state.
  * 
  * @param {json} current_game_state 
+ * @param {json} command_queue_stats Statistics of the queues of commands to DCS, per lane of priority.
  */
-function gotDcsGameState(current_game_state) {
+function gotDcsGameState(current_game_state, command_queue_stats) {
+    if (command_queue_stats != null) {
+        document.getElementById("command_queue_stats").textContent =
+            "Commands queued (user, automated, control): " + command_queue_stats.queue_depth.join(", ") +
+            " -- max " + command_queue_stats.max_queue_depth.join(", ") +
+            " | Sent immediately: " + command_queue_stats.sent_immediately +
+            ", deferred: " + command_queue_stats.sent_deferred +
+            ", coalesced: " + command_queue_stats.coalesced +
+            " | Frames: " + command_queue_stats.frames;
+    }
+
     // Create rows in a new table body so it is easy to replace any old content.
     var new_table_body = document.createElement('tbody');
 
@@ -47,6 +47,10 @@ function gotCallbackFromIdLookupWindow(parameter) {
         sendPayloadToPlugin({ event: "RequestIdLookup", dcs_install_path: parameter.payload.dcs_install_path, module: parameter.payload.module });
     }
 
+    if (parameter.event == 'RequestIdSearch') {
+        sendPayloadToPlugin({ event: "RequestIdSearch", dcs_install_path: parameter.payload.dcs_install_path, module: parameter.payload.module, query: parameter.payload.query });
+    }
+
     if (parameter.event == 'ImportDcsCommand') {
         settings["button_id"] = parameter.payload.button_id;
         settings["device_id"] = parameter.payload.device_id;
@@ -93,9 +97,15 @@ function sendToIdLookupWindowInstalledModules(installed_modules_list) {
     }
 }
 
-function sendToIdLookupWindowClickabledata(clickabledata_elements) {
+function sendToIdLookupWindowClickabledataChunk(clickabledata_chunk) {
+    if (window.idLookupWindow) {
+        window.idLookupWindow.gotClickabledataChunk(clickabledata_chunk);
+    }
+}
+
+function sendToIdLookupWindowIdSearchResults(search_results) {
     if (window.idLookupWindow) {
-        window.idLookupWindow.gotClickabledata(clickabledata_elements);
+        window.idLookupWindow.gotIdSearchResults(search_results);
     }
 }
 
@@ -119,8 +129,8 @@ function gotCallbackFromCommsWindow(parameter) {
     console.log("Callback from comms window: ", parameter);
 }
 
-function sendToCommsWindowDcsGameState(current_game_state) {
+function sendToCommsWindowDcsGameState(current_game_state, command_queue_stats) {
     if (window.commsWindow) {
-        window.commsWindow.gotDcsGameState(current_game_state);
+        window.commsWindow.gotDcsGameState(current_game_state, command_queue_stats);
     }
 }
\ No newline at end of file
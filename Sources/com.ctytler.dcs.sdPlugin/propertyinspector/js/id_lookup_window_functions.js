@@ -15,12 +15,18 @@ function loaded() {
  */
 function restoreGlobalSettings(settings) {
     document.getElementById("dcs_install_path").value = settings.dcs_install_path;
+    document.getElementById("preextract_modules_check").checked = (settings.preextract_modules == true);
+    if (settings.preextract_cpu_budget) {
+        document.getElementById("preextract_cpu_budget").value = settings.preextract_cpu_budget;
+    }
     RequestInstalledModules();
     console.log("Restored global settings: ", settings);
 }
 
 function UpdateGlobalSettings() {
     window.opener.global_settings["dcs_install_path"] = document.getElementById("dcs_install_path").value;
+    window.opener.global_settings["preextract_modules"] = document.getElementById("preextract_modules_check").checked;
+    window.opener.global_settings["preextract_cpu_budget"] = document.getElementById("preextract_cpu_budget").value;
     let select_elem = document.getElementById("select_module");
     let selected_module = ""
     if (select_elem.options.length > 0) {
@@ -108,7 +114,7 @@ function callbackRequestIdLookup() {
         else {
             var dcs_install_path = document.getElementById("dcs_install_path").value;
             var payload = { "dcs_install_path": dcs_install_path, "module": module };
-            gotClickabledata(cached_commands[module], true); // Load cached data until new data arrives.
+            loadCommandShard(module); // Show stored data until new data arrives.
             sendmessage("RequestIdLookup", payload);
             console.log("Request ID Lookup for: ", payload);
         }
@@ -149,65 +155,234 @@ function clearTableContents() {
         tbody.deleteRow(0);
     }
     selected_row = "";
+    clickabledata_from_plugin = false;
+}
+
+/**
+ * Loads the stored command shard of only the selected module, to show its clickabledata until the lookup by the
+ * plugin arrives. Shards are generated for each module by CommandDbGenerator and call registerCommandShard.
+ * 
+ * @param {string} module 
+ */
+function loadCommandShard(module) {
+    var script = document.createElement('script');
+    script.src = "json/commands/" + encodeURIComponent(module) + ".js";
+    script.onload = script.onerror = function () { script.remove(); };
+    document.head.appendChild(script);
+}
+
+/**
+ * Called by a loaded command shard with the stored clickabledata of its module.
+ * 
+ * @param {Json} shard Json with "module", "columns", "strings" (each distinct value) and "rows" (the index into
+ *                     "strings" of each column value of each element, one element after the other).
+ */
+function registerCommandShard(shard) {
+    var select_elem = document.getElementById("select_module");
+    var selected_module = select_elem.options[select_elem.selectedIndex].value;
+    if (shard.module != selected_module || clickabledata_from_plugin) {
+        return; // Module no longer selected, or already listed from the plugin's lookup.
+    }
+    var rows = [];
+    for (var i = 0; i < shard.rows.length; i += shard.columns.length) {
+        rows.push(shard.rows.slice(i, i + shard.columns.length).map(idx => shard.strings[idx]));
+    }
+    if (rows.length > 0) {
+        replaceTableBody();
+        appendTypedRows(shard.columns, rows);
+        document.getElementById("cached_data_in_use_notification").hidden = false;
+    }
 }
 
 /**
  * Populates table with clickabledata elements in each row, sorted by column values.
  * 
- * @param {Json} clickabledata_elements 
+ * @param {Json} clickabledata_elements Array of comma-separated strings, as stored in general commands.
  */
-function gotClickabledata(clickabledata_elements, is_cached_data = false) {
+function gotClickabledata(clickabledata_elements) {
     if (clickabledata_elements.length > 0) {
         // Create rows in a new table body so it is easy to replace any old content.
         var new_table_body = document.createElement('tbody');
         clickabledata_elements.sort();
         for (const element of clickabledata_elements) {
-            var split_elem = element.split(',');
-            var new_row = new_table_body.insertRow();
-            new_row.insertCell(0).appendChild(document.createTextNode(split_elem[0])); // Device
-            new_row.insertCell(1).appendChild(document.createTextNode(split_elem[1])); // Button ID
-            new_row.insertCell(2).appendChild(document.createTextNode(split_elem[2])); // Element
-            new_row.insertCell(3).appendChild(document.createTextNode(split_elem[3])); // Type
-            new_row.insertCell(4).appendChild(document.createTextNode(split_elem[4])); // DCS ID
-            new_row.insertCell(5).appendChild(document.createTextNode(split_elem[5])); // Click Value
-            new_row.insertCell(6).appendChild(document.createTextNode(split_elem[6])); // Limit Min
-            new_row.insertCell(7).appendChild(document.createTextNode(split_elem[7])); // Limit Max
-            new_row.insertCell(8).appendChild(document.createTextNode(split_elem[8])); // Description
-            new_row.addEventListener('click', function () { selectRow(this) });
+            appendClickabledataRow(new_table_body, element.split(','));
         }
         var document_table_body = document.getElementById("clickabledata_table").getElementsByTagName('tbody')[0];
         document_table_body.parentNode.replaceChild(new_table_body, document_table_body);
 
         document.getElementById("type_hints_text").hidden = false;
+        document.getElementById("cached_data_in_use_notification").hidden = true;
+        clickabledata_from_plugin = false;
+    }
+}
 
-        if (is_cached_data) {
-            document.getElementById("cached_data_in_use_notification").hidden = false;
-        } else {
+/**
+ * Appends rows of a chunk of clickabledata sent by the plugin, so the first rows are shown before the rest arrive.
+ * Chunks contain typed rows, already sorted, with values in the order of the chunk "columns".
+ * 
+ * @param {Json} chunk Json with "transfer_id", "chunk_index", "num_chunks", "first_row", "total_rows", "columns",
+ *                     "rows" and "result".
+ */
+var clickabledata_transfer_id = null;
+var clickabledata_from_plugin = false; // True when the table lists data from the plugin, which can be searched.
+function gotClickabledataChunk(chunk) {
+    if (chunk.chunk_index == 0) {
+        clickabledata_transfer_id = chunk.transfer_id;
+        if (chunk.total_rows > 0) {
+            // Replace any cached data shown while waiting for the lookup.
+            replaceTableBody();
+            clickabledata_from_plugin = true;
             document.getElementById("cached_data_in_use_notification").hidden = true;
         }
     }
+    if (chunk.transfer_id != clickabledata_transfer_id || chunk.total_rows == 0) {
+        // Ignore remaining chunks of a previous lookup, and keep any cached data if the lookup failed.
+        document.getElementById("clickabledata_progress").hidden = true;
+        return;
+    }
+
+    appendTypedRows(chunk.columns, chunk.rows);
+
+    var rows_received = chunk.first_row + chunk.rows.length;
+    var progress = document.getElementById("clickabledata_progress");
+    progress.textContent = "Loading clickabledata: " + rows_received + " of " + chunk.total_rows + " elements";
+    progress.hidden = (rows_received >= chunk.total_rows);
+}
+
+/**
+ * Replaces the table rows with the ranked results of a search by the plugin.
+ * 
+ * @param {Json} results Json with "module", "query", "result", "total_matches", "columns" and "rows".
+ */
+function gotIdSearchResults(results) {
+    if (results.query != document.getElementById("clickabledata_table_search").value) {
+        return; // Results of a query since edited.
+    }
+    if (results.result != "success") {
+        console.log("ID search failed: ", results.result);
+        return;
+    }
+    replaceTableBody();
+    appendTypedRows(results.columns, results.rows);
+    var progress = document.getElementById("clickabledata_progress");
+    progress.textContent = "Showing " + results.rows.length + " of " + results.total_matches + " matches";
+    progress.hidden = false;
+}
+
+/**
+ * Replaces the table body with an empty one, clearing any selection.
+ */
+function replaceTableBody() {
+    var new_table_body = document.createElement('tbody');
+    var document_table_body = document.getElementById("clickabledata_table").getElementsByTagName('tbody')[0];
+    document_table_body.parentNode.replaceChild(new_table_body, document_table_body);
+    selected_row = "";
+    document.getElementById("import_selection_div").hidden = true;
+    document.getElementById("type_hints_text").hidden = false;
+}
+
+/**
+ * Appends typed rows sent by the plugin to the table.
+ * 
+ * @param {Array} columns Column name of each value in the rows.
+ * @param {Array} rows Array of rows, each an array of values.
+ */
+function appendTypedRows(columns, rows) {
+    var column = {};
+    for (const [idx, name] of columns.entries()) {
+        column[name] = idx;
+    }
+    var table_body = document.getElementById("clickabledata_table").getElementsByTagName('tbody')[0];
+    for (const row of rows) {
+        appendClickabledataRow(table_body, [
+            row[column.device] + "(" + row[column.device_id] + ")",
+            row[column.command],
+            row[column.element],
+            row[column.class],
+            row[column.arg],
+            row[column.arg_value],
+            row[column.arg_lim_min],
+            row[column.arg_lim_max],
+            row[column.hint]
+        ]);
+    }
 }
 
 /**
- * Call back function that shows/hides table rows if they do/don't contain the search query.
+ * Appends a row of clickabledata element attributes to the table body.
+ * 
+ * @param {Element} table_body 
+ * @param {Array} cells Device (ID), Button ID, Element, Type, DCS ID, Click Value, Limit Min, Limit Max, Description
+ * @returns {Element} The new row.
  */
+function appendClickabledataRow(table_body, cells) {
+    var new_row = table_body.insertRow();
+    for (const [idx, cell] of cells.entries()) {
+        new_row.insertCell(idx).appendChild(document.createTextNode(cell));
+    }
+    new_row.addEventListener('click', function () { selectRow(this) });
+    return new_row;
+}
+
+/**
+ * Call back function for the search box. Data from the plugin is searched by the plugin, which returns only the best
+ * matches, while locally stored data is filtered by showing/hiding table rows that do/don't contain the search query.
+ */
+var search_timer = null;
 function searchTable() {
-    var query = document.getElementById("clickabledata_table_search").value.toUpperCase();
+    var query = document.getElementById("clickabledata_table_search").value;
+    if (clickabledata_from_plugin) {
+        // Wait for a pause in typing before searching.
+        clearTimeout(search_timer);
+        search_timer = setTimeout(function () { requestIdSearch(query); }, 150);
+        return;
+    }
     var table = document.getElementById("clickabledata_table");
     var body = table.getElementsByTagName("tbody")[0];
     var tr = body.getElementsByTagName("tr");
     for (var i = 0; i < tr.length; i++) {
-        var row_text = "";
-        var td = tr[i].getElementsByTagName("td");
-        for (j = 0; j < td.length; j++) {
-            row_text += td[j].textContent;
-        }
-        if (row_text.toUpperCase().indexOf(query) >= 0) {
-            tr[i].style.display = "";
-        }
-        else {
-            tr[i].style.display = "none";
-        }
+        filterRow(tr[i], query.toUpperCase());
+    }
+}
+
+/**
+ * Requests the plugin to search the selected module, or to list the whole module again for an empty query.
+ * 
+ * @param {string} query 
+ */
+function requestIdSearch(query) {
+    clickabledata_transfer_id = null; // Ignore any remaining chunks of the module listing.
+    var select_elem = document.getElementById("select_module");
+    var payload = {
+        "dcs_install_path": document.getElementById("dcs_install_path").value,
+        "module": select_elem.options[select_elem.selectedIndex].value
+    };
+    if (query.trim() == "") {
+        sendmessage("RequestIdLookup", payload);
+    }
+    else {
+        payload["query"] = query;
+        sendmessage("RequestIdSearch", payload);
+    }
+}
+
+/**
+ * Shows/hides a table row if it does/doesn't contain the search query.
+ * 
+ * @param {Element} row 
+ * @param {string} query Upper case search query.
+ */
+function filterRow(row, query) {
+    var row_text = "";
+    var td = row.getElementsByTagName("td");
+    for (j = 0; j < td.length; j++) {
+        row_text += td[j].textContent;
+    }
+    if (row_text.toUpperCase().indexOf(query) >= 0) {
+        row.style.display = "";
+    }
+    else {
+        row.style.display = "none";
     }
 }
 
@@ -36,15 +36,21 @@ function sendSettingsToPlugin() {
  */
 function callbackReceivedPayloadFromPlugin(payload) {
     if (payload.event == 'DebugDcsGameState') {
-        sendToCommsWindowDcsGameState(payload.current_game_state);
+        sendToCommsWindowDcsGameState(payload.current_game_state, payload.command_queue_stats);
     }
 
     if (payload.event == 'InstalledModules') {
         sendToIdLookupWindowInstalledModules(payload.installed_modules);
     }
 
-    if (payload.event == 'Clickabledata') {
-        sendToIdLookupWindowClickabledata(payload.clickabledata);
+    if (payload.event == 'ClickabledataChunk') {
+        sendToIdLookupWindowClickabledataChunk(payload);
+        // Acknowledge once the chunk is shown so the plugin releases further chunks.
+        sendPayloadToPlugin({ event: "ClickabledataChunkAck", transfer_id: payload.transfer_id, chunk_index: payload.chunk_index });
+    }
+
+    if (payload.event == 'IdSearchResults') {
+        sendToIdLookupWindowIdSearchResults(payload);
     }
 }
 
@@ -160,8 +160,10 @@ function callbackClearDcsCommand() {
  */
 function callbackClearCompareMonitor() {
     delete settings["dcs_id_compare_monitor"];
+    delete settings["dcs_id_state_expressions"];
     $SD.api.setSettings($SD.uuid, settings);
     dcs_id_compare_monitor.value = "";
+    dcs_id_state_expressions.value = "";
     sendSettingsToPlugin();
     console.log("Clear DCS ID Compare Monitor", settings);
 }
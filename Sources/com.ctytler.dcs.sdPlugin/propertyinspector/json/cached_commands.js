@@ -1,101 +0,0 @@
-var cached_commands = {
-    "A-10C": ["UFC(8),3009,PNT-BTN-UFC-9,BTN,393,1,0,1,", "MFCD_RIGHT(3),3024,PNT-MFCD-R-DSP-UP,BTN,347,1,0,1,Increase Backlight Brightness", "ENVIRONMENT_SYSTEM(41),3007,PTR-ENVCP-TEMP-PRESS,TUMB,282,-1,-1,1,Temperature/Pressure Control", "ENVIRONMENT_SYSTEM(41),3007,PTR-ENVCP-TEMP-PRESS,TUMB,282,1,-1,1,Temperature/Pressure Control", "CDU(9),3019,PNT-BTN-CDU-5,BTN,429,1,0,1,", "AUTOPILOT(38),3012,PTR-SASP-TO-TRIM,BTN,190,1,0,1,Set Takeoff Trim", "MFCD_LEFT(2),3022,PNT-MFCD-L-ADJ-DN,BTN,320,-1,-1,0,Moving Map Scale Adjust Decrease", "CDU(9),3030,PNT-BTN-CDU-D,BTN,440,1,0,1,", "NMSP(46),3001,PTR-NMSP-HARS,BTN,605,1,0,1,HARS Backup Navigation Mode", "CDU(9),3038,PNT-BTN-CDU-L,BTN,448,1,0,1,", "CDU(9),3040,PNT-BTN-CDU-N,BTN,450,1,0,1,", "UFC(8),3005,PNT-BTN-UFC-5,BTN,389,1,0,1,", "MFCD_RIGHT(3),3004,PNT-BTN-MFD-R-04,BTN,329,1,0,1,OSB 4", "FUEL_SYSTEM(36),3004,PTR-FSCP-CROSS-FEED,TUMB,109,-1,0,1,Cross Feed", "FUEL_SYSTEM(36),3004,PTR-FSCP-CROSS-FEED,TUMB,109,1,0,1,Cross Feed", "LIGHT_SYSTEM(49),3012,PTR-LGHTCP-NOSE-ILLUM,TUMB,291,-1,0,1,Nose Illumination", "LIGHT_SYSTEM(49),3012,PTR-LGHTCP-NOSE-ILLUM,TUMB,291,1,0,1,Nose Illumination", "MFCD_RIGHT(3),3009,PNT-BTN-MFD-R-09,BTN,334,1,0,1,OSB 9", "ELEC_INTERFACE(1),3004,PTR-EPP-AC-GEN-PWR-L,TUMB,244,1,0,1,Left AC Generator Power", "ELEC_INTERFACE(1),3004,PTR-EPP-AC-GEN-PWR-L,TUMB,244,-1,0,1,Left AC Generator Power", "CDU(9),3051,PNT-BTN-CDU-Y,BTN,461,1,0,1,", "UFC(8),3015,PNT-BTN-UFC-CLR,BTN,399,1,0,1,Clear", "CDU(9),3011,PNT-BTN-CDU-WP,BTN,420,1,0,1,Display Waypoint Menu (WP MENU) Page", "UFC(8),3011,PNT-BTN-UFC-SPC,BTN,396,1,0,1,Space", "MFCD_RIGHT(3),3013,PNT-BTN-MFD-R-13,BTN,338,1,0,1,OSB 13", "ELEC_INTERFACE(1),3042,PTR-CBP-INVERTER-PWR,TUMB,701,-1,0,1,INVERTER PWR", "ELEC_INTERFACE(1),3042,PTR-CBP-INVERTER-PWR,TUMB,701,1,0,1,INVERTER PWR", "MFCD_LEFT(2),3025,PNT-MFCD-L-DSP-DN,BTN,321,-1,-1,0,Decrease Backlight Brightness", "AAP(22),3005,PTR-TMB-CDU-SWITCH,TUMB,476,-1,0,1,CDU Power On/Off", "AAP(22),3005,PTR-TMB-CDU-SWITCH,TUMB,476,1,0,1,CDU Power On/Off", "MFCD_LEFT(2),3028,PNT-MFD-L-BRT-DN,BTN,322,-1,-1,0,Decrease Brightness", "CMSP(4),3011,PNT-TMB-CMSP-MWS,BTN,360,0.2,0.1,0.2,Missile Warning System (MWS). Left mouse - ON/OFF, Right mouse - MENU (No Function)", "CMSP(4),3010,PNT-TMB-CMSP-MWS,TUMB,360,0.1,0,0.1,Missile Warning System (MWS). Left mouse - ON/OFF, Right mouse - MENU (No Function)", "CMSP(4),3003,PNT-BTN-CMSP-ARW3,BTN,354,1,0,1,Edit Program Value", "DVADR(73),3001,DVADR-RC-FUNC-CONTROL-SW-PTR,TUMB,789,0.1,0,0.2,Function control toggle switch", "DVADR(73),3001,DVADR-RC-FUNC-CONTROL-SW-PTR,TUMB,789,-0.1,0,0.2,Function control toggle switch", "AHCP(7),3008,PNT-TMB-AHCP-CICU,TUMB,382,-1,0,1,Turn On/Off CICU", "AHCP(7),3008,PNT-TMB-AHCP-CICU,TUMB,382,1,0,1,Turn On/Off CICU", "FUEL_SYSTEM(36),3003,PTR-FSCP-TK-GATE,TUMB,108,-1,0,1,Tank Gate", "FUEL_SYSTEM(36),3003,PTR-FSCP-TK-GATE,TUMB,108,1,0,1,Tank Gate", "CDU(9),3044,PNT-BTN-CDU-R,BTN,454,1,0,1,", "MFCD_LEFT(2),3031,PNT-MFD-L-CON-DN,BTN,323,-1,-1,0,Decrease Contrast", "OXYGEN_SYSTEM(40),3003,PTR-OXYGENCP-EMERGENCY,BTN,601,-1,-1,0,Oxygen Flow Emergency/Normal/Test Mask", "OXYGEN_SYSTEM(40),3003,PTR-OXYGENCP-EMERGENCY,TUMB,601,1,0,1,Oxygen Flow Emergency/Normal/Test Mask", "FUEL_SYSTEM(36),3006,PTR-FSCP-BOOST-PUMPS-WING-R,TUMB,111,-1,0,1,Boost Pumps Right Wing", "FUEL_SYSTEM(36),3006,PTR-FSCP-BOOST-PUMPS-WING-R,TUMB,111,1,0,1,Boost Pumps Right Wing", "CMSP(4),3015,PNT-TMB-CMSP-RWR,BTN,362,0.2,0.1,0.2,Radar Warning Receiver (RWR). Left mouse - ON/OFF, Right mouse - MENU", "CMSP(4),3014,PNT-TMB-CMSP-RWR,TUMB,362,0.1,0,0.1,Radar Warning Receiver (RWR). Left mouse - ON/OFF, Right mouse - MENU", "FUEL_SYSTEM(36),3009,PTR-FSCP-SIG-AMPL,TUMB,114,-1,0,1,Signal Amplifier Norm/Override", "FUEL_SYSTEM(36),3009,PTR-FSCP-SIG-AMPL,TUMB,114,1,0,1,Signal Amplifier Norm/Override", "CMSP(4),3018,PNT-LEV-CMSP-MODE,TUMB,364,0.1,0,0.4,Master CMS Mode Select", "CMSP(4),3018,PNT-LEV-CMSP-MODE,TUMB,364,-0.1,0,0.4,Master CMS Mode Select", "AHCP(7),3002,PNT-TMB-AHCP-GUNPAC,TUMB,376,-0.1,0,0.2,Gun Arm Mode", "AHCP(7),3002,PNT-TMB-AHCP-GUNPAC,TUMB,376,0.1,0,0.2,Gun Arm Mode", "UFC(8),3014,PNT-BTN-UFC-LTR,BTN,398,1,0,1,Select Letter Mode", "MFCD_LEFT(2),3019,PNT-BTN-MFD-L-19,BTN,318,1,0,1,OSB 19", "CMSC(5),3001,PNT-BTN-RWR-JMR,BTN,365,1,0,1,Select Jammer Program", "CDU(9),3017,PNT-BTN-CDU-3,BTN,427,1,0,1,", "ENGINE_SYSTEM(37),3008,PTR-ENGINE-OPER-R,BTN,125,1,0,1,Engine Operate Right", "ENGINE_SYSTEM(37),3004,PTR-ENGINE-OPER-R,TUMB,125,-1,-1,0,Engine Operate Right", "AN_APN_194(67),3001,PTR-LCP-RDRALTM,TUMB,130,-1,0,1,Radar Altimeter Normal/Disabled", "AN_APN_194(67),3001,PTR-LCP-RDRALTM,TUMB,130,1,0,1,Radar Altimeter Normal/Disabled", "AUTOPILOT(38),3005,PTR-SASP-YAW-SASENGAGE-R,BTN,186,1,0,1,Yaw SAS Engage right", "UFC(8),3030,PNT-BTN-UFC-FWD,BTN,531,1,0,1,No Function", "CMSC(5),3002,PNT-BTN-RWR-MWS,BTN,366,1,0,1,Cycle Missile Warning System Programs. No function", "ENVIRONMENT_SYSTEM(41),3003,PTR-ENVCP-CANOPY-DEFOG,LEV,277,0,0,1,Canopy Defog", "MFCD_LEFT(2),3017,PNT-BTN-MFD-L-17,BTN,316,1,0,1,OSB 17", "MFCD_RIGHT(3),3022,PNT-MFCD-R-ADJ-DN,BTN,346,-1,-1,0,Moving Map Scale Adjust Decrease", "CMSP(4),3013,PNT-TMB-CMSP-JMR,BTN,361,0.2,0.1,0.2,Electronic Countermeasure Jammer (JMR). Left mouse - ON/OFF, Right mouse - MENU (No Function)", "CMSP(4),3012,PNT-TMB-CMSP-JMR,TUMB,361,0.1,0,0.1,Electronic Countermeasure Jammer (JMR). Left mouse - ON/OFF, Right mouse - MENU (No Function)", "MFCD_RIGHT(3),3011,PNT-BTN-MFD-R-11,BTN,336,1,0,1,OSB 11", "FUEL_SYSTEM(36),3001,PTR-FSCP-EXT-TANKS-WING,TUMB,106,-1,0,1,External Wing Tanks Boost Pumps", "FUEL_SYSTEM(36),3001,PTR-FSCP-EXT-TANKS-WING,TUMB,106,1,0,1,External Wing Tanks Boost Pumps", "CDU(9),3020,PNT-BTN-CDU-6,BTN,430,1,0,1,", "AUTOPILOT(38),3013,PTR-SASP-YAW-TRIM,LEV,192,0,-1,1,Yaw Trim", "AUTOPILOT(38),3014,PTR-SASP-YAW-TRIM,BTN,192,0,0,0,Yaw Trim", "CDU(9),3015,PNT-BTN-CDU-1,BTN,425,1,0,1,", "ENVIRONMENT_SYSTEM(41),3008,PTR-ENVCP-MAIN-AIR-SUPPLY,TUMB,283,-1,0,1,Main Air Supply", "ENVIRONMENT_SYSTEM(41),3008,PTR-ENVCP-MAIN-AIR-SUPPLY,TUMB,283,1,0,1,Main Air Supply", "CMSP(4),3008,PNT-TMB-CMSP-JTSN,TUMB,358,1,0,1,Jettison Countermeasures", "ENGINE_SYSTEM(37),3002,PTR-FUEL-FLOW-R,TUMB,123,-1,0,1,Right Engine Fuel Flow Control", "ENGINE_SYSTEM(37),3002,PTR-FUEL-FLOW-R,TUMB,123,1,0,1,Right Engine Fuel Flow Control", "UFC(8),3001,PNT-BTN-UFC-1,BTN,385,1,0,1,", "MFCD_LEFT(2),3013,PNT-BTN-MFD-L-13,BTN,312,1,0,1,OSB 13", "UFC(8),3008,PNT-BTN-UFC-8,BTN,392,1,0,1,", "CMSC(5),3004,PNT-BTN-RWR-SEP,BTN,370,1,0,1,Separate RWR Symbols", "CPT_MECH(39),3001,PNT-LNDGEAR,TUMB,716,1,0,1,Landing Gear Lever", "CPT_MECH(39),3001,PNT-LNDGEAR,TUMB,716,-1,0,1,Landing Gear Lever", "CDU(9),3050,PNT-BTN-CDU-X,BTN,460,1,0,1,", "HARS(44),3005,PTR-HARS-CP-LATITUDE,LEV,271,0,0,1,HARS Latitude Dial", "ENGINE_SYSTEM(37),3005,PTR-APU-START,TUMB,126,-1,0,1,APU On/Off", "ENGINE_SYSTEM(37),3005,PTR-APU-START,TUMB,126,1,0,1,APU On/Off", "UFC(8),3012,PNT-BTN-UFC-HACK,BTN,394,1,0,1,Display Hack Time", "CDU(9),3006,PNT-BTN-CDU-ARW-R2,BTN,415,1,0,1,LSK 5R", "CDU(9),3016,PNT-BTN-CDU-2,BTN,426,1,0,1,", "CDU(9),3022,PNT-BTN-CDU-8,BTN,432,1,0,1,", "AUTOPILOT(38),3022,PTR-EFCP-ELEVATOR-EMER-DISENGAGE,TUMB,180,1,-1,1,Elevator Emergency Disengage", "AUTOPILOT(38),3022,PTR-EFCP-ELEVATOR-EMER-DISENGAGE,TUMB,180,-1,-1,1,Elevator Emergency Disengage", "MFCD_RIGHT(3),3001,PNT-BTN-MFD-R-01,BTN,326,1,0,1,OSB 1", "AUTOPILOT(38),3023,PTR-EFCP-FLAP-EMER-RETR,TUMB,183,-1,0,1,Flaps Emergency Retract", "AUTOPILOT(38),3023,PTR-EFCP-FLAP-EMER-RETR,TUMB,183,1,0,1,Flaps Emergency Retract", "CMSC(5),3003,PNT-BTN-RWR-PRI,BTN,369,1,0,1,Toggle between 5 and 16 Priority Threats Displayed", "CPT_MECH(39),3012,BOARD-LADDER-BUTTON-PTR,BTN,788,1,0,1,Extend boarding ladder button", "KY_58(69),3002,PTR-ZEROIZE-SWITCH,TUMB,779,-1,0,1,Zeroise Switch", "KY_58(69),3002,PTR-ZEROIZE-SWITCH,TUMB,779,1,0,1,Zeroise Switch", "CDU(9),3003,PNT-BTN-CDU-ARW-L3,BTN,412,1,0,1,LSK 7L", "ENVIRONMENT_SYSTEM(41),3010,PTR-ENVCP-CABIN-AIR-COND-OPER,TUMB,285,-0.1,0,0.1,Air Conditioner MAN/AUTO", "ENVIRONMENT_SYSTEM(41),3010,PTR-ENVCP-CABIN-AIR-COND-OPER,TUMB,285,0.1,0,0.1,Air Conditioner MAN/AUTO", "MFCD_LEFT(2),3020,PNT-BTN-MFD-L-20,BTN,319,1,0,1,OSB 20", "UFC(8),3035,PNT-BTN-UFC-ADD-6,BTN,536,1,0,1,No Function", "CDU(9),3002,PNT-BTN-CDU-ARW-L2,BTN,411,1,0,1,LSK 5L", "CDU(9),3029,PNT-BTN-CDU-C,BTN,439,1,0,1,", "CDU(9),3039,PNT-BTN-CDU-M,BTN,449,1,0,1,", "INTERCOM(58),3018,PTR-INTERCOM-VOL,LEV,238,1,0,1,Intercom volume", "ELEC_INTERFACE(1),3006,PTR-EPP-BATTERY-PWR,TUMB,246,1,0,1,Battery Power", "ELEC_INTERFACE(1),3006,PTR-EPP-BATTERY-PWR,TUMB,246,-1,0,1,Battery Power", "UFC(8),3006,PNT-BTN-UFC-6,BTN,390,1,0,1,", "VHF_FM_RADIO(56),3006,PTR-ANARC186-VHFFM-LOAD,BTN,150,1,0,1,Load", "MFCD_RIGHT(3),3002,PNT-BTN-MFD-R-02,BTN,327,1,0,1,OSB 2", "AUTOPILOT(38),3018,PTR-EFCP-TRIM-RWINGDN,BTN,176,0.2,0,0.2,Trim Emergency Right Wing Down", "AUTOPILOT(38),3028,PTR-ANTI-SKID,BTN,654,1,0,1,Anti Skid", "UFC(8),3010,PNT-BTN-UFC-0,BTN,395,1,0,1,", "CMSC(5),3006,PNT-LEV-RWR-BRT,LEV,367,1,0.15,0.85,Adjust Display Brightness", "MFCD_LEFT(2),3011,PNT-BTN-MFD-L-11,BTN,310,1,0,1,OSB 11", "ELEC_INTERFACE(1),3033,PTR-CBP-UHF-COMM,TUMB,692,-1,0,1,UHF COMM", "ELEC_INTERFACE(1),3033,PTR-CBP-UHF-COMM,TUMB,692,1,0,1,UHF COMM", "CDU(9),3005,PNT-BTN-CDU-ARW-R1,BTN,414,1,0,1,LSK 3R", "FUEL_SYSTEM(36),3017,PTR-FQIS-SELECT,TUMB,645,0.1,0,0.4,Fuel display selector", "FUEL_SYSTEM(36),3017,PTR-FQIS-SELECT,TUMB,645,-0.1,0,0.4,Fuel display selector", "UFC(8),3026,PNT-BTN-UFC-DEPR-UP,BTN,408,1,0,1,Adjust Depressible Pipper", "CDU(9),3024,PNT-BTN-CDU-0,BTN,434,1,0,1,", "NMSP(46),3003,PTR-NMSP-TISL,BTN,609,1,0,1,TISL No Function", "NMSP(46),3004,PTR-NMSP-STARTPT,BTN,611,1,0,1,STEERPT Mode", "IFF(43),3010,PTR-IFFCP-TEST-M-1,BTN,202,1,0,1,Test M-1", "IFF(43),3010,PTR-IFFCP-TEST-M-1,TUMB,202,0,-1,0,Test M-1", "NMSP(46),3006,PTR-NMSP-TCN,BTN,615,1,0,1,TCN Mode", "TISL(57),3001,PTR-TISLCP-MODE,TUMB,622,0.1,0,0.4,TISL Mode", "TISL(57),3001,PTR-TISLCP-MODE,TUMB,622,-0.1,0,0.4,TISL Mode",
-        "ELEC_INTERFACE(1),3043,PTR-CBP-INVERTER-CONT,TUMB,702,-1,0,1,INVERTER CONT", "ELEC_INTERFACE(1),3043,PTR-CBP-INVERTER-CONT,TUMB,702,1,0,1,INVERTER CONT", "INTERCOM(58),3012,PTR-INTERCOM-IFF,LEV,231,1,0,1,IFF Switch", "INTERCOM(58),3011,PTR-INTERCOM-IFF,TUMB,232,-1,0,1,IFF Switch", "INTERCOM(58),3011,PTR-INTERCOM-IFF,TUMB,232,1,0,1,IFF Switch", "UFC(8),3002,PNT-BTN-UFC-2,BTN,386,1,0,1,", "UFC(8),3021,PNT-BTN-UFC-STEER-DN,BTN,405,-1,-1,0,Cycle Steerpoint/Waypoint", "TISL(57),3005,PTR-TISLCP-CODE-WH1,TUMB,636,0.05,0,1,TISL Code wheel 1", "TISL(57),3005,PTR-TISLCP-CODE-WH1,TUMB,636,-0.05,0,1,TISL Code wheel 1", "IFF(43),3004,PTR-IFFCP-MODE3A-WHEEL2,TUMB,212,0.1,0,0.7,MODE3A-WHEEL2", "IFF(43),3004,PTR-IFFCP-MODE3A-WHEEL2,TUMB,212,-0.1,0,0.7,MODE3A-WHEEL2", "AUTOPILOT(38),3026,PTR-LCP-EAC,BTN,129,1,0,1,EAC On/Off", "ELEC_INTERFACE(1),3007,PTR-CBP-AILERON-DISC-L,TUMB,666,-1,0,1,AILERON DISC L", "ELEC_INTERFACE(1),3007,PTR-CBP-AILERON-DISC-L,TUMB,666,1,0,1,AILERON DISC L", "IFF(43),3009,PTR-IFFCP-OUT-AUDIO-LIGHT,TUMB,201,-1,-1,1,Audio/light", "IFF(43),3009,PTR-IFFCP-OUT-AUDIO-LIGHT,TUMB,201,1,-1,1,Audio/light", "CPT_MECH(39),3010,PTR-ARM-SEAT-HANDLE,TUMB,733,-1,0,1,Seat Arm Handle", "CPT_MECH(39),3010,PTR-ARM-SEAT-HANDLE,TUMB,733,1,0,1,Seat Arm Handle", "MFCD_LEFT(2),3009,PNT-BTN-MFD-L-09,BTN,308,1,0,1,OSB 9", "UHF_RADIO(54),3012,PTR-ANARC164-TEST-DISPLAY,BTN,172,1,0,1,Test Display", "MFCD_LEFT(2),3027,PNT-MFD-L-BRT-UP,BTN,322,1,0,1,Increase Brightness", "IFF(43),3015,PTR-IFFCP-MIC-IDENT,BTN,207,1,0,1,Ident/Mic", "IFF(43),3015,PTR-IFFCP-MIC-IDENT,TUMB,207,0,-1,0,Ident/Mic", "IFF(43),3016,PTR-IFFCP-ON-OUT,TUMB,208,-1,0,1,IFF On/Out", "IFF(43),3016,PTR-IFFCP-ON-OUT,TUMB,208,1,0,1,IFF On/Out", "ELEC_INTERFACE(1),3011,PTR-CBP-ELEVATION-DISC-R,TUMB,670,-1,0,1,ELEVATION DISC R", "ELEC_INTERFACE(1),3011,PTR-CBP-ELEVATION-DISC-R,TUMB,670,1,0,1,ELEVATION DISC R", "AUTOPILOT(38),3001,PTR-LCP-AUTOPILOT-PATH-ALT,TUMB,132,-1,-1,1,Autopilot Mode Select Switch", "AUTOPILOT(38),3001,PTR-LCP-AUTOPILOT-PATH-ALT,TUMB,132,1,-1,1,Autopilot Mode Select Switch", "IFF(43),3003,PTR-IFFCP-MODE3A-WHEEL1,TUMB,211,0.1,0,0.7,MODE3A-WHEEL1", "IFF(43),3003,PTR-IFFCP-MODE3A-WHEEL1,TUMB,211,-0.1,0,0.7,MODE3A-WHEEL1", "UFC(8),3029,PNT-BTN-UFC-INTEN-LFT,BTN,409,-1,-1,0,Adjust HUD Brightness (Hold rocker)", "TISL(57),3008,PTR-TISLCP-CODE-WH4,TUMB,642,0.05,0,1,TISL Code wheel 4", "TISL(57),3008,PTR-TISLCP-CODE-WH4,TUMB,642,-0.05,0,1,TISL Code wheel 4", "ENGINE_SYSTEM(37),3001,PTR-FUEL-FLOW-L,TUMB,122,-1,0,1,Left Engine Fuel Flow Control", "ENGINE_SYSTEM(37),3001,PTR-FUEL-FLOW-L,TUMB,122,1,0,1,Left Engine Fuel Flow Control", "IFF(43),3005,PTR-IFFCP-MODE3A-WHEEL3,TUMB,213,0.1,0,0.7,MODE3A-WHEEL3", "IFF(43),3005,PTR-IFFCP-MODE3A-WHEEL3,TUMB,213,-0.1,0,0.7,MODE3A-WHEEL3", "IFF(43),3006,PTR-IFFCP-MODE3A-WHEEL4,TUMB,214,0.1,0,0.7,MODE3A-WHEEL4", "IFF(43),3006,PTR-IFFCP-MODE3A-WHEEL4,TUMB,214,-0.1,0,0.7,MODE3A-WHEEL4", "LIGHT_SYSTEM(49),3018,PTR-FSCP-RCVR-LT,LEV,116,0,0,1,Refueling Lighting Dial", "OXYGEN_SYSTEM(40),3002,PTR-OXYGENCP-OXYGEN-DILUTER,TUMB,602,-1,0,1,Oxygen Normal/100%", "OXYGEN_SYSTEM(40),3002,PTR-OXYGENCP-OXYGEN-DILUTER,TUMB,602,1,0,1,Oxygen Normal/100%", "OXYGEN_SYSTEM(40),3001,PTR-OXYGENCP-SUPPLY,TUMB,603,-1,0,1,Oxygen Supply On/Off", "OXYGEN_SYSTEM(40),3001,PTR-OXYGENCP-SUPPLY,TUMB,603,1,0,1,Oxygen Supply On/Off", "MFCD_RIGHT(3),3006,PNT-BTN-MFD-R-06,BTN,331,1,0,1,OSB 6", "AUTOPILOT(38),,PTR-EFCP-PTCHROLL-TRIM,TUMB,,-1,0,1,Pitch/Roll Trim Norm/Emergency Override", "AUTOPILOT(38),3016,PTR-EFCP-PTCHROLL-TRIM,TUMB,175,1,0,1,Pitch/Roll Trim Norm/Emergency Override", "CDU(9),3032,PNT-BTN-CDU-F,BTN,442,1,0,1,", "ENVIRONMENT_SYSTEM(41),3001,PTR-ENVCP-OXY-TEST,BTN,275,1,0,1,Oxygen Indicator Test", "MFCD_RIGHT(3),3030,PNT-MFD-R-CON-UP,BTN,349,1,0,1,Increase Contrast", "MFCD_LEFT(2),3004,PNT-BTN-MFD-L-04,BTN,303,1,0,1,OSB 4", "ELEC_INTERFACE(1),3009,PTR-CBP-SPS-RUDDER-AUTH-LIM,TUMB,668,-1,0,1,SPS & RUDDER AUTH LIMIT", "ELEC_INTERFACE(1),3009,PTR-CBP-SPS-RUDDER-AUTH-LIM,TUMB,668,1,0,1,SPS & RUDDER AUTH LIMIT", "DIGITAL_CLOCK(15),3001,PNT-LVR-WATCH-SET,BTN,68,1,0,1,Toggle Clock and Elapsed Time Modes", "AUTOPILOT(38),3009,PTR-SASP-PITCH-SASENGAGE-R,BTN,188,1,0,1,Pitch SAS Engage right", "ENVIRONMENT_SYSTEM(41),3004,PTR-ENVCP-WINDSHIELD-RREMOVE-WASH,TUMB,278,-1,-1,1,Windshield Rain Removal/Wash", "ENVIRONMENT_SYSTEM(41),3004,PTR-ENVCP-WINDSHIELD-RREMOVE-WASH,TUMB,278,1,-1,1,Windshield Rain Removal/Wash", "MFCD_LEFT(2),3007,PNT-BTN-MFD-L-07,BTN,306,1,0,1,OSB 7", "ENVIRONMENT_SYSTEM(41),3005,PTR-ENVCP-PITOT-HEAT,TUMB,279,-1,0,1,Pitot Heater", "ENVIRONMENT_SYSTEM(41),3005,PTR-ENVCP-PITOT-HEAT,TUMB,279,1,0,1,Pitot Heater", "CDU(9),3063,PNT-BTN-CDU-PG-DN,BTN,463,-1,-1,0,Page Down To Additional Pages When Available", "AHCP(7),3007,PNT-TMB-AHCP-NORM,TUMB,381,-1,0,1,NORM/Standby HUD Mode", "AHCP(7),3007,PNT-TMB-AHCP-NORM,TUMB,381,1,0,1,NORM/Standby HUD Mode", "ENVIRONMENT_SYSTEM(41),3006,PTR-ENVCP-BLEED-AIR,TUMB,280,-1,0,1,Bleed Air", "ENVIRONMENT_SYSTEM(41),3006,PTR-ENVCP-BLEED-AIR,TUMB,280,1,0,1,Bleed Air", "MFCD_RIGHT(3),3003,PNT-BTN-MFD-R-03,BTN,328,1,0,1,OSB 3", "AUTOPILOT(38),3015,PTR-EFCP-SPDBK-EMER-RETR,TUMB,174,-1,0,1,Speed Brake Emergency Retract", "AUTOPILOT(38),3015,PTR-EFCP-SPDBK-EMER-RETR,TUMB,174,1,0,1,Speed Brake Emergency Retract", "CPT_MECH(39),3015,PTR-CNP-JETT-BTN,TUMB,786,-1,0,1,Canopy Jettison Lever Unlock Button", "CPT_MECH(39),3015,PTR-CNP-JETT-BTN,TUMB,786,1,0,1,Canopy Jettison Lever Unlock Button", "UFC(8),3004,PNT-BTN-UFC-4,BTN,388,1,0,1,", "UHF_RADIO(54),3009,PTR-ANARC164-T-TONE,BTN,169,1,0,1,T-Tone", "UHF_RADIO(54),3009,PTR-ANARC164-T-TONE,BTN,169,-1,-1,0,T-Tone", "UFC(8),3033,PNT-BTN-UFC-ADD-4,BTN,534,1,0,1,No Function", "CDU(9),3053,PNT-BTN-CDU-V1,BTN,464,1,0,1,No function", "IFFCC(12),3001,PTR-EXT-STORES-JETT,BTN,101,1,0,1,Emergency Jettison External Stores", "ELEC_INTERFACE(1),3008,PTR-CBP-AILERON-DISC-R,TUMB,667,-1,0,1,AILERON DISC R", "ELEC_INTERFACE(1),3008,PTR-CBP-AILERON-DISC-R,TUMB,667,1,0,1,AILERON DISC R", "IFF(43),3007,PTR-IFFCP-CODE,BTN,199,1,0,1,Code", "IFF(43),3007,PTR-IFFCP-CODE,BTN,199,-1,-1,0,Code", "CPT_MECH(39),3002,PTR-FLAPS,TUMB,773,0.5,0,1,Flap Setting", "CPT_MECH(39),3002,PTR-FLAPS,TUMB,773,-0.5,0,1,Flap Setting", "CDU(9),3021,PNT-BTN-CDU-7,BTN,431,1,0,1,", "ENVIRONMENT_SYSTEM(41),3002,PTR-ENVCP-WINDSHIELD-DEFOG,TUMB,276,-1,0,1,Windshield Defog/Deice", "ENVIRONMENT_SYSTEM(41),3002,PTR-ENVCP-WINDSHIELD-DEFOG,TUMB,276,1,0,1,Windshield Defog/Deice", "ELEC_INTERFACE(1),3038,PTR-CBP-AUX-ESS-BUS-0A,TUMB,697,-1,0,1,AUX ESS BUS 0A", "ELEC_INTERFACE(1),3038,PTR-CBP-AUX-ESS-BUS-0A,TUMB,697,1,0,1,AUX ESS BUS 0A", "SYS_CONTROLLER(24),3002,PTR-ALCP-SIGLIGHTS-LAMP-TEST,BTN,197,1,0,1,Test Cockpit Indication Lights", "ELEC_INTERFACE(1),3012,PTR-CBP-AILERON-TAB-L,TUMB,671,-1,0,1,AILERON TAB L", "ELEC_INTERFACE(1),3012,PTR-CBP-AILERON-TAB-L,TUMB,671,1,0,1,AILERON TAB L", "CMSP(4),3007,PNT-BTN-CMSP-RTN,BTN,357,1,0,1,Save and Return Program", "CDU(9),3065,PNT-BTN-CDU-BLANC-R,BTN,469,1,0,1,Scroll Waypoint Names During Search", "AUTOPILOT(38),3021,PTR-EFCP-AILERON-EMER-DISENGAGE,TUMB,177,1,-1,1,Aileron Emergency Disengage", "AUTOPILOT(38),3021,PTR-EFCP-AILERON-EMER-DISENGAGE,TUMB,177,-1,-1,1,Aileron Emergency Disengage", "CDU(9),3010,PNT-BTN-CDU-NAV,BTN,419,1,0,1,Display Navigation (NAV) Page", "INTERCOM(58),3008,PTR-INTERCOM-UHF,LEV,227,1,0,1,UHF Switch", "INTERCOM(58),3007,PTR-INTERCOM-UHF,TUMB,228,-1,0,1,UHF Switch", "INTERCOM(58),3007,PTR-INTERCOM-UHF,TUMB,228,1,0,1,UHF Switch", "ELEC_INTERFACE(1),3016,PTR-CBP-LAND-GEAR,TUMB,675,-1,0,1,LAND GEAR", "ELEC_INTERFACE(1),3016,PTR-CBP-LAND-GEAR,TUMB,675,1,0,1,LAND GEAR", "ELEC_INTERFACE(1),3017,PTR-CBP-ENGINE-START-L,TUMB,676,-1,0,1,ENGINE START L", "ELEC_INTERFACE(1),3017,PTR-CBP-ENGINE-START-L,TUMB,676,1,0,1,ENGINE START L", "ELEC_INTERFACE(1),3020,PTR-CBP-ANG-IGNITOR-1,TUMB,679,-1,0,1,ENG IGNITOR L/R-1", "ELEC_INTERFACE(1),3020,PTR-CBP-ANG-IGNITOR-1,TUMB,679,1,0,1,ENG IGNITOR L/R-1", "ELEC_INTERFACE(1),3021,PTR-CBP-ANG-IGNITOR-2,TUMB,680,-1,0,1,ENG IGNITOR L/R-2", "ELEC_INTERFACE(1),3021,PTR-CBP-ANG-IGNITOR-2,TUMB,680,1,0,1,ENG IGNITOR L/R-2", "ELEC_INTERFACE(1),3023,PTR-CBP-EMER-FUEL-SHUTOFF-ENG-R,TUMB,682,-1,0,1,EMER FUEL SHUTOFF ENG R", "ELEC_INTERFACE(1),3023,PTR-CBP-EMER-FUEL-SHUTOFF-ENG-R,TUMB,682,1,0,1,EMER FUEL SHUTOFF ENG R", "VHF_AM_RADIO(55),3008,PTR-ANARC186-VHFAM-SQUELCH,BTN,134,1,0,1,Squelch / TONE", "VHF_AM_RADIO(55),3007,PTR-ANARC186-VHFAM-SQUELCH,TUMB,134,1,-1,0,Squelch / TONE", "CDU(9),3047,PNT-BTN-CDU-U,BTN,457,1,0,1,", "ELEC_INTERFACE(1),3025,PTR-CBP-BLEED-AIR-CONT-L,TUMB,684,-1,0,1,BLEED AIR CONT L", "ELEC_INTERFACE(1),3025,PTR-CBP-BLEED-AIR-CONT-L,TUMB,684,1,0,1,BLEED AIR CONT L", "CDU(9),3028,PNT-BTN-CDU-B,BTN,438,1,0,1,", "ELEC_INTERFACE(1),3026,PTR-CBP-BLEED-AIR-CONT-R,TUMB,685,-1,0,1,BLEED AIR CONT R", "ELEC_INTERFACE(1),3026,PTR-CBP-BLEED-AIR-CONT-R,TUMB,685,1,0,1,BLEED AIR CONT R", "MFCD_LEFT(2),3036,PNT-LVR-MFD-L,TUMB,325,-0.1,0,0.2,DAY/NIGHT/OFF", "MFCD_LEFT(2),3036,PNT-LVR-MFD-L,TUMB,325,0.1,0,0.2,DAY/NIGHT/OFF", "MFCD_LEFT(2),3005,PNT-BTN-MFD-L-05,BTN,304,1,0,1,OSB 5", "CMSP(4),3009,PNT-LEV-CMSP-BRT,LEV,359,1,0.15,0.85,Adjust Display Brightness", "AHCP(7),3006,PNT-TMB-AHCP-TIME,TUMB,380,-1,0,1,Day/Night HUD Mode", "AHCP(7),3006,PNT-TMB-AHCP-TIME,TUMB,380,1,0,1,Day/Night HUD Mode", "ELEC_INTERFACE(1),3027,PTR-CBP-EXT-STORES-JETT-1,TUMB,686,-1,0,1,EXT STORES JETT 1", "ELEC_INTERFACE(1),3027,PTR-CBP-EXT-STORES-JETT-1,TUMB,686,1,0,1,EXT STORES JETT 1", "ELEC_INTERFACE(1),3029,PTR-CBP-STBY-ATT-IND,TUMB,688,-1,0,1,STBY ATT IND", "ELEC_INTERFACE(1),3029,PTR-CBP-STBY-ATT-IND,TUMB,688,1,0,1,STBY ATT IND", "ELEC_INTERFACE(1),3018,PTR-CBP-ENGINE-START-R,TUMB,677,-1,0,1,ENGINE START R", "ELEC_INTERFACE(1),3018,PTR-CBP-ENGINE-START-R,TUMB,677,1,0,1,ENGINE START R", "AUTOPILOT(38),3019,PTR-EFCP-TRIM-NOSEUP,BTN,176,0.3,0,0.3,Trim Emergency Nose Up", "ELEC_INTERFACE(1),3030,PTR-CBP-MASTER-CAUT,TUMB,689,-1,0,1,MASTER CAUT", "ELEC_INTERFACE(1),3030,PTR-CBP-MASTER-CAUT,TUMB,689,1,0,1,MASTER CAUT",
-        "LIGHT_SYSTEM(49),3002,PTR-LGHTCP-FLIGHT-INST,LEV,292,1,0,1,Flight Instruments Lights", "ENGINE_SYSTEM(37),3007,PTR-ENGINE-OPER-L,BTN,124,1,0,1,Engine Operate Left", "ENGINE_SYSTEM(37),3003,PTR-ENGINE-OPER-L,TUMB,124,-1,-1,0,Engine Operate Left", "ELEC_INTERFACE(1),3032,PTR-CBP-IFF,TUMB,691,-1,0,1,IFF", "ELEC_INTERFACE(1),3032,PTR-CBP-IFF,TUMB,691,1,0,1,IFF", "NMSP(46),3002,PTR-NMSP-EGI,BTN,607,1,0,1,EGI Navigation Mode", "MFCD_LEFT(2),3015,PNT-BTN-MFD-L-15,BTN,314,1,0,1,OSB 15", "ELEC_INTERFACE(1),3035,PTR-CBP-GENERATOR-CONT-L,TUMB,694,-1,0,1,GENERATOR CONT L", "ELEC_INTERFACE(1),3035,PTR-CBP-GENERATOR-CONT-L,TUMB,694,1,0,1,GENERATOR CONT L", "ELEC_INTERFACE(1),3036,PTR-CBP-GENERATOR-CONT-R,TUMB,695,-1,0,1,GENERATOR CONT R", "ELEC_INTERFACE(1),3036,PTR-CBP-GENERATOR-CONT-R,TUMB,695,1,0,1,GENERATOR CONT R", "FUEL_SYSTEM(36),3015,PTR-FSCP-FILLDISABLE-MAIN-R,TUMB,120,1,0,1,Fill Disable Main Right", "UFC(8),3034,PNT-BTN-UFC-ADD-5,BTN,535,1,0,1,No Function", "ELEC_INTERFACE(1),3037,PTR-CBP-CONVERTER-L,TUMB,696,-1,0,1,CONVERTER L", "ELEC_INTERFACE(1),3037,PTR-CBP-CONVERTER-L,TUMB,696,1,0,1,CONVERTER L", "UHF_RADIO(54),3014,PTR-ANARC164-COVER,TUMB,734,-1,0,1,Cover", "UHF_RADIO(54),3014,PTR-ANARC164-COVER,TUMB,734,1,0,1,Cover", "ENVIRONMENT_SYSTEM(41),3011,PTR-ENVCP-CABIN-AIR-COND-OPER-COLD,BTN,285,0.2,0,0.2,Air Conditioner to COLD", "ELEC_INTERFACE(1),3040,PTR-CBP-AUX-ESS-BUS-0C,TUMB,699,-1,0,1,AUX ESS BUS 0C", "ELEC_INTERFACE(1),3040,PTR-CBP-AUX-ESS-BUS-0C,TUMB,699,1,0,1,AUX ESS BUS 0C", "LIGHT_SYSTEM(49),3008,PTR-LGHTCP-POSITION,TUMB,287,-1,-1,1,Position Lights, FLASH/OFF/STEADY", "LIGHT_SYSTEM(49),3008,PTR-LGHTCP-POSITION,TUMB,287,1,-1,1,Position Lights, FLASH/OFF/STEADY", "MFCD_RIGHT(3),3027,PNT-MFD-R-BRT-UP,BTN,348,1,0,1,Increase Brightness", "DVADR(73),3002,DVADR-VIDEO-SW-PTR,TUMB,790,0.1,0,0.2,Video selector toggle switch (N/A)", "DVADR(73),3002,DVADR-VIDEO-SW-PTR,TUMB,790,-0.1,0,0.2,Video selector toggle switch (N/A)", "ELEC_INTERFACE(1),3044,PTR-CBP-AUX-ESS-BUS-TIE,TUMB,703,-1,0,1,AUX ESS BUS TIE", "ELEC_INTERFACE(1),3044,PTR-CBP-AUX-ESS-BUS-TIE,TUMB,703,1,0,1,AUX ESS BUS TIE", "MFCD_RIGHT(3),3005,PNT-BTN-MFD-R-05,BTN,330,1,0,1,OSB 5", "CMSC(5),3005,PNT-BTN-RWR-UNK,BTN,371,1,0,1,Display Unknown Threats", "FM_PROXY(35),3001,PNT-ALT-LEVR-L,LEV,62,0.04,0,1,Set Pressure", "MFCD_LEFT(2),3001,PNT-BTN-MFD-L-01,BTN,300,1,0,1,OSB 1", "AUTOPILOT(38),3011,PTR-SASP-MONITOR-TEST,BTN,189,1,0,1,Monitor Test Left/Right", "AUTOPILOT(38),3011,PTR-SASP-MONITOR-TEST,BTN,189,-1,-1,0,Monitor Test Left/Right", "AAU34(62),3001,PNT-ALT-LEVR-R,BTN,60,1,0,1,ELECT/PNEU", "AAU34(62),3002,PNT-ALT-LEVR-R,BTN,60,-1,-1,0,ELECT/PNEU", "VHF_AM_RADIO(55),3014,PTR-ANARC186-VHFAM-FREQ-3,TUMB,141,0.1,0,1,Frequency Selector the 3rd", "VHF_AM_RADIO(55),3013,PTR-ANARC186-VHFAM-FREQ-3,TUMB,141,-0.1,0,1,Frequency Selector the 3rd", "CDU(9),3036,PNT-BTN-CDU-J,BTN,446,1,0,1,", "LIGHT_SYSTEM(49),3009,PTR-LGHTCP-FORMATION,LEV,288,1,0,1,Formation Lights", "INTERCOM(58),3004,PTR-INTERCOM-FM,LEV,223,1,0,1,FM Switch", "INTERCOM(58),3003,PTR-INTERCOM-FM,TUMB,224,-1,0,1,FM Switch", "INTERCOM(58),3003,PTR-INTERCOM-FM,TUMB,224,1,0,1,FM Switch", "CDU(9),3049,PNT-BTN-CDU-W,BTN,459,1,0,1,", "CDU(9),3046,PNT-BTN-CDU-T,BTN,456,1,0,1,", "LIGHT_SYSTEM(49),3001,PTR-LGHTCP-ENG-INST,LEV,290,1,0,1,Engine Instruments Lights", "UFC(8),3016,PNT-BTN-UFC-ENT,BTN,400,1,0,1,Enter", "TISL(57),3007,PTR-TISLCP-CODE-WH3,TUMB,640,0.05,0,1,TISL Code wheel 3", "TISL(57),3007,PTR-TISLCP-CODE-WH3,TUMB,640,-0.05,0,1,TISL Code wheel 3", "ELEC_INTERFACE(1),3031,PTR-CBP-PITOT-HEAT-AC,TUMB,690,-1,0,1,PITOT HEAT AC", "ELEC_INTERFACE(1),3031,PTR-CBP-PITOT-HEAT-AC,TUMB,690,1,0,1,PITOT HEAT AC", "CDU(9),3055,PNT-BTN-CDU-MK,BTN,466,1,0,1,Create Overhead Mark Point", "LIGHT_SYSTEM(49),3013,PTR-LGHTCP-SIGNAL-LTS,TUMB,294,-1,0,1,Signal Lights", "LIGHT_SYSTEM(49),3013,PTR-LGHTCP-SIGNAL-LTS,TUMB,294,1,0,1,Signal Lights", "LIGHT_SYSTEM(49),3004,PTR-LGHTCP-ACCEL-COMP,TUMB,295,-1,0,1,Accelerometer & Compass Lights", "LIGHT_SYSTEM(49),3004,PTR-LGHTCP-ACCEL-COMP,TUMB,295,1,0,1,Accelerometer & Compass Lights", "LIGHT_SYSTEM(49),3006,PTR-LGHTCP-CONSOLE,LEV,297,1,0,1,Console Light", "CDU(9),3057,PNT-BTN-CDU-SPC,BTN,468,1,0,1,Insert Space Into Scratchpad", "LIGHT_SYSTEM(49),3016,PTR-ALCP-WPNSTA,LEV,195,0,0,1,Weapon Station Lights. No function", "UHF_RADIO(54),3015,PTR-ANARC164-LOAD,BTN,735,1,0,1,Load button", "FUEL_SYSTEM(36),3005,PTR-FSCP-BOOST-PUMPS-WING-L,TUMB,110,-1,0,1,Boost Pumps Left Wing", "FUEL_SYSTEM(36),3005,PTR-FSCP-BOOST-PUMPS-WING-L,TUMB,110,1,0,1,Boost Pumps Left Wing", "SYS_CONTROLLER(24),3004,PTR-ALCP-FDBAL-TEST,BTN,198,1,0,1,Fire Detect Bleed Air Test", "FIRE_SYSTEM(50),3002,PTR-FIRE-APU-PULL,TUMB,103,-1,0,1,APU Fire T-Handle", "FIRE_SYSTEM(50),3002,PTR-FIRE-APU-PULL,TUMB,103,1,0,1,APU Fire T-Handle", "FIRE_SYSTEM(50),3003,PTR-FIRE-RENG-PULL,TUMB,104,-1,0,1,Right Engine Fire T-Handle", "FIRE_SYSTEM(50),3003,PTR-FIRE-RENG-PULL,TUMB,104,1,0,1,Right Engine Fire T-Handle", "CDU(9),3009,PNT-BTN-CDU-SYS,BTN,418,1,0,1,Display System (SYS) Page", "MFCD_RIGHT(3),3018,PNT-BTN-MFD-R-18,BTN,343,1,0,1,OSB 18", "AUTOPILOT(38),3003,PTR-SASP-YAW-SASENGAGE-L,BTN,185,1,0,1,Yaw SAS Engage left", "CDU(9),3052,PNT-BTN-CDU-Z,BTN,462,1,0,1,", "INTERCOM(58),3020,PTR-INTERCOM-CALL,BTN,240,1,0,1,Call button", "CDU(9),3034,PNT-BTN-CDU-H,BTN,444,1,0,1,", "AUTOPILOT(38),3002,PTR-LCP-AUTOPILOT-ENGAGE,BTN,131,1,0,1,Autopilot Engage/Disengage", "MFCD_RIGHT(3),3034,PNT-MFD-R-SYM-DN,BTN,350,-1,-1,0,Decrease Symbol Levels", "MFCD_LEFT(2),3033,PNT-MFD-L-SYM-UP,BTN,324,1,0,1,Increase Symbol Levels", "FIRE_SYSTEM(50),3001,PTR-FIRE-LENG-PULL,TUMB,102,-1,0,1,Left Engine Fire T-Handle", "FIRE_SYSTEM(50),3001,PTR-FIRE-LENG-PULL,TUMB,102,1,0,1,Left Engine Fire T-Handle", "HSI(45),3002,PNT-LVR-HSI-CRS,LEV,44,1,0,1,Course Set Knob", "AAP(22),3001,PNT-LVR-STEER-PT-SEL-SWITCH,TUMB,473,0.1,0,0.2,Use Steerpoint From Active Flight Plan", "AAP(22),3001,PNT-LVR-STEER-PT-SEL-SWITCH,TUMB,473,-0.1,0,0.2,Use Steerpoint From Active Flight Plan", "ADI(47),3001,PNT-LVR-ADI-KNOB,LEV,22,1,-0.5,0.5,ADI Pitch Trim Knob", "TACAN_CTRL_PANEL(74),3001,PTR-TACAN-CHANNEL-SELECTOR-1,LEV,256,0.1,0,1,Channel Selector (Tens). Rotate mouse wheel to select", "CDU(9),3014,PNT-BTN-CDU-PREV,BTN,423,1,0,1,Go to previous page", "TACAN_CTRL_PANEL(74),3004,PTR-TACAN-TEST,BTN,259,1,0,1,Test TACAN Signal on HSI", "IFFCC(12),3003,PTR-ARMGS-OVERRIDE-SWITCH,TUMB,710,-1,0,1,Arm Ground Safety Override Switch", "IFFCC(12),3003,PTR-ARMGS-OVERRIDE-SWITCH,TUMB,710,1,0,1,Arm Ground Safety Override Switch", "TACAN_CTRL_PANEL(74),3006,PTR-TACAN-MODE,TUMB,262,0.1,0,0.4,Mode Dial", "TACAN_CTRL_PANEL(74),3006,PTR-TACAN-MODE,TUMB,262,-0.1,0,0.4,Mode Dial", "STALL(52),3001,PTR-STALLWCP-STALL,LEV,704,1,0,1,Stall Volume", "CMSP(4),3017,PNT-TMB-CMSP-DISP,BTN,363,0.2,0.1,0.2,Countermeasure Dispenser (DISP). Left mouse - ON/OFF, Right mouse - MENU", "CMSP(4),3016,PNT-TMB-CMSP-DISP,TUMB,363,0.1,0,0.1,Countermeasure Dispenser (DISP). Left mouse - ON/OFF, Right mouse - MENU", "FUEL_SYSTEM(36),3008,PTR-FSCP-BOOST-PUMPS-MAIN-R,TUMB,113,-1,0,1,Boost Pumps Main Fuselage Right", "FUEL_SYSTEM(36),3008,PTR-FSCP-BOOST-PUMPS-MAIN-R,TUMB,113,1,0,1,Boost Pumps Main Fuselage Right", "STALL(52),3002,PTR-STALLWCP-PEAK,LEV,705,1,0,1,Peak Volume", "AAP(22),3002,PNT-TMB-STEER-SPRING-LD-SWITCH,BTN,474,1,0,1,Toggle Steerpoint", "AAP(22),3003,PNT-TMB-STEER-SPRING-LD-SWITCH,BTN,474,-1,-1,0,Toggle Steerpoint", "AUTOPILOT(38),3024,PTR-EFCP-MRFCS,TUMB,184,-1,0,1,Manual Reversion Flight Control System (MRFCS)", "AUTOPILOT(38),3024,PTR-EFCP-MRFCS,TUMB,184,1,0,1,Manual Reversion Flight Control System (MRFCS)", "ILS(53),3002,PTR-ILSCP-PWR,LEV,248,0.1,0,0.3,ILS Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "ILS(53),3001,PTR-ILSCP-PWR,TUMB,247,1,0,1,ILS Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "ILS(53),3001,PTR-ILSCP-PWR,TUMB,247,-1,0,1,ILS Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "UHF_RADIO(54),3001,PTR-ANARC164-CHANNEL-SELECTOR,TUMB,161,0.05,0,0.95,Preset Channel Selector", "UHF_RADIO(54),3001,PTR-ANARC164-CHANNEL-SELECTOR,TUMB,161,-0.05,0,0.95,Preset Channel Selector", "UHF_RADIO(54),3002,PTR-ANARC164-100MHZ-SELECTOR,TUMB,162,0.1,0,0.2,100 MHz Selector", "UHF_RADIO(54),3002,PTR-ANARC164-100MHZ-SELECTOR,TUMB,162,-0.1,0,0.2,100 MHz Selector", "UHF_RADIO(54),3003,PTR-ANARC164-10MHZ-SELECTOR,TUMB,163,0.1,0,0.9,10 MHz Selector", "UHF_RADIO(54),3003,PTR-ANARC164-10MHZ-SELECTOR,TUMB,163,-0.1,0,0.9,10 MHz Selector", "UHF_RADIO(54),3004,PTR-ANARC164-1MHZ-SELECTOR,TUMB,164,0.1,0,0.9,1 MHz Selector", "UHF_RADIO(54),3004,PTR-ANARC164-1MHZ-SELECTOR,TUMB,164,-0.1,0,0.9,1 MHz Selector", "CMSP(4),3002,PNT-BTN-CMSP-ARW2,BTN,353,1,0,1,Edit Program Value", "UHF_RADIO(54),3005,PTR-ANARC164-0.1MHZ-SELECTOR,TUMB,165,0.1,0,0.9,0.1 MHz Selector", "UHF_RADIO(54),3005,PTR-ANARC164-0.1MHZ-SELECTOR,TUMB,165,-0.1,0,0.9,0.1 MHz Selector", "MFCD_RIGHT(3),3025,PNT-MFCD-R-DSP-DN,BTN,347,-1,-1,0,Decrease Backlight Brightness", "UHF_RADIO(54),3007,PTR-ANARC164-FREQMODE,TUMB,167,0.1,0,0.2,Frequency Mode Dial", "UHF_RADIO(54),3007,PTR-ANARC164-FREQMODE,TUMB,167,-0.1,0,0.2,Frequency Mode Dial", "MFCD_LEFT(2),3014,PNT-BTN-MFD-L-14,BTN,313,1,0,1,OSB 14", "UHF_RADIO(54),3008,PTR-ANARC164-FUNCTION,TUMB,168,0.1,0,0.3,Function Dial", "UHF_RADIO(54),3008,PTR-ANARC164-FUNCTION,TUMB,168,-0.1,0,0.3,Function Dial", "ENVIRONMENT_SYSTEM(41),3012,PTR-ENVCP-CABIN-AIR-COND-OPER-HOT,BTN,285,0.3,0,0.3,Air Conditioner to HOT", "UHF_RADIO(54),3010,PTR-ANARC164-SQUELCH,TUMB,170,-1,0,1,Squelch", "UHF_RADIO(54),3010,PTR-ANARC164-SQUELCH,TUMB,170,1,0,1,Squelch", "ELEC_INTERFACE(1),3013,PTR-CBP-AILERON-TAB-R,TUMB,672,-1,0,1,AILERON TAB R", "ELEC_INTERFACE(1),3013,PTR-CBP-AILERON-TAB-R,TUMB,672,1,0,1,AILERON TAB R", "INTERCOM(58),3016,PTR-INTERCOM-TCN,LEV,235,1,0,1,TCN Switch", "INTERCOM(58),3015,PTR-INTERCOM-TCN,TUMB,236,-1,0,1,TCN Switch",
-        "INTERCOM(58),3015,PTR-INTERCOM-TCN,TUMB,236,1,0,1,TCN Switch", "CMSP(4),3005,PNT-BTN-CMSP-BRT-UP,BTN,356,1,0,1,Cycle Program or Value Up", "KY_58(69),3004,PTR-LVR-PANKY58-PLAIN,TUMB,781,0.1,0,0.2,C/RAD switch", "KY_58(69),3004,PTR-LVR-PANKY58-PLAIN,TUMB,781,-0.1,0,0.2,C/RAD switch", "UHF_RADIO(54),3013,PTR-ANARC164-STATUS,BTN,173,1,0,1,Status", "LIGHT_SYSTEM(49),3017,PTR-ALCP-NVIS-LTS,TUMB,194,0.1,0,0.2,Nightvision Lights", "LIGHT_SYSTEM(49),3017,PTR-ALCP-NVIS-LTS,TUMB,194,-0.1,0,0.2,Nightvision Lights", "IFF(43),3001,PTR-IFFCP-MODE1-WHEEL1,TUMB,209,0.1,0,0.7,MODE1-WHEEL1", "IFF(43),3001,PTR-IFFCP-MODE1-WHEEL1,TUMB,209,-0.1,0,0.7,MODE1-WHEEL1", "VHF_AM_RADIO(55),3001,PTR-ANARC186-VHFAM-PRESET,TUMB,137,-0.01,0,0.2,Preset Channel Selector", "VHF_AM_RADIO(55),3001,PTR-ANARC186-VHFAM-PRESET,TUMB,137,0.01,0,0.2,Preset Channel Selector", "IFF(43),3020,PTR-BTN-PANIFF-REPLY,LEV,900,0.5,0,1,Reply test", "IFF(43),3017,PTR-BTN-PANIFF-REPLY,BTN,795,1,0,1,Reply test", "CDU(9),3060,PNT-BTN-CDU-DIMBRT-L,BTN,424,-1,-1,0,Display Brightness Adjustment (Not Functional)", "AUTOPILOT(38),3017,PTR-EFCP-TRIM-NOSEDN,BTN,176,0.1,0,0.1,Trim Emergency Nose Down", "VHF_AM_RADIO(55),3003,PTR-ANARC186-VHFAM-MODE,TUMB,138,0.1,0,0.2,Frequency Mode Dial", "VHF_AM_RADIO(55),3003,PTR-ANARC186-VHFAM-MODE,TUMB,138,-0.1,0,0.2,Frequency Mode Dial", "VHF_AM_RADIO(55),3004,PTR-ANARC186-VHFAM-FREQEMER-CONTROL,TUMB,135,0.1,0,0.3,Frequency Selection Dial", "VHF_AM_RADIO(55),3004,PTR-ANARC186-VHFAM-FREQEMER-CONTROL,TUMB,135,-0.1,0,0.3,Frequency Selection Dial", "VHF_AM_RADIO(55),3005,PTR-ANARC186-VHFAM-VOLUME,LEV,133,1,0,1,Volume", "CDU(9),3066,PNT-BTN-CDU-PLUS,BTN,472,1,0,1,Increment/Decrement Data Indicated With +/- Symbol", "VHF_AM_RADIO(55),3006,PTR-ANARC186-VHFAM-LOAD,BTN,136,1,0,1,Load", "MFCD_RIGHT(3),3020,PNT-BTN-MFD-R-20,BTN,345,1,0,1,OSB 20", "CDU(9),3012,PNT-BTN-CDU-OSET,BTN,421,1,0,1,Display Offset (OFFSET) Page", "ELEC_INTERFACE(1),3024,PTR-CBP-DC-FUEL-PUMP,TUMB,683,-1,0,1,DC FUEL PUMP", "ELEC_INTERFACE(1),3024,PTR-CBP-DC-FUEL-PUMP,TUMB,683,1,0,1,DC FUEL PUMP", "AHCP(7),3003,PNT-TMB-AHCP-LARM,TUMB,377,-0.1,0,0.2,Laser Arm", "AHCP(7),3003,PNT-TMB-AHCP-LARM,TUMB,377,0.1,0,0.2,Laser Arm", "SAI(48),3003,PNT-LVR-SAI-CAGE,LEV,66,0.5,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SAI(48),3002,PNT-LVR-SAI-CAGE,BTN,67,1,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "VHF_AM_RADIO(55),3010,PTR-ANARC186-VHFAM-FREQ-1,TUMB,139,0.1,0,1,Frequency Selector the 1nd", "VHF_AM_RADIO(55),3009,PTR-ANARC186-VHFAM-FREQ-1,TUMB,139,-0.1,0,1,Frequency Selector the 1nd", "VHF_AM_RADIO(55),3012,PTR-ANARC186-VHFAM-FREQ-2,TUMB,140,0.1,0,1,Frequency Selector the 2nd", "VHF_AM_RADIO(55),3011,PTR-ANARC186-VHFAM-FREQ-2,TUMB,140,-0.1,0,1,Frequency Selector the 2nd", "ELEC_INTERFACE(1),3041,PTR-CBP-BATTERY-BUS-TRANS,TUMB,700,-1,0,1,BATTERY BUS TRANS", "ELEC_INTERFACE(1),3041,PTR-CBP-BATTERY-BUS-TRANS,TUMB,700,1,0,1,BATTERY BUS TRANS", "VHF_AM_RADIO(55),3016,PTR-ANARC186-VHFAM-FREQ-4,TUMB,142,0.25,0,1,Frequency Selector the 4th", "VHF_AM_RADIO(55),3015,PTR-ANARC186-VHFAM-FREQ-4,TUMB,142,-0.25,0,1,Frequency Selector the 4th", "AHCP(7),3009,PNT-TMB-AHCP-JTRS,TUMB,383,-1,0,1,JTRS Datalink On/Off)", "AHCP(7),3009,PNT-TMB-AHCP-JTRS,TUMB,383,1,0,1,JTRS Datalink On/Off)", "VHF_FM_RADIO(56),3001,PTR-ANARC186-VHFFM-PRESET,TUMB,151,-0.01,0,0.2,Preset Channel Selector", "VHF_FM_RADIO(56),3001,PTR-ANARC186-VHFFM-PRESET,TUMB,151,0.01,0,0.2,Preset Channel Selector", "MFCD_RIGHT(3),3031,PNT-MFD-R-CON-DN,BTN,349,-1,-1,0,Decrease Contrast", "CPT_MECH(39),3007,PTR-CANOPY-OPEN,BTN,712,0,0,0.5,Canopy Open/Hold/Close", "CPT_MECH(39),3006,PTR-CANOPY-OPEN,TUMB,712,1,0.5,1,Canopy Open/Hold/Close", "MFCD_RIGHT(3),3015,PNT-BTN-MFD-R-15,BTN,340,1,0,1,OSB 15", "CDU(9),3025,PNT-BTN-CDU-PNT,BTN,435,1,0,1,", "IFF(43),3012,PTR-IFFCP-TEST-M-3A,BTN,204,1,0,1,Test M-3A", "IFF(43),3012,PTR-IFFCP-TEST-M-3A,TUMB,204,0,-1,0,Test M-3A", "CDU(9),3035,PNT-BTN-CDU-I,BTN,445,1,0,1,", "CDU(9),3067,PNT-BTN-CDU-MINUS,BTN,472,-1,-1,0,Increment/Decrement Data Indicated With +/- Symbol", "VHF_FM_RADIO(56),3012,PTR-ANARC186-VHFFM-FREQ-2,TUMB,154,0.1,0,1,Frequency Selector the 2nd", "VHF_FM_RADIO(56),3011,PTR-ANARC186-VHFFM-FREQ-2,TUMB,154,-0.1,0,1,Frequency Selector the 2nd", "CDU(9),3041,PNT-BTN-CDU-O,BTN,451,1,0,1,", "VHF_FM_RADIO(56),3016,PTR-ANARC186-VHFFM-FREQ-4,TUMB,156,0.25,0,1,Frequency Selector the 4th", "VHF_FM_RADIO(56),3015,PTR-ANARC186-VHFFM-FREQ-4,TUMB,156,-0.25,0,1,Frequency Selector the 4th", "FUEL_SYSTEM(36),3007,PTR-FSCP-BOOST-PUMPS-MAIN-L,TUMB,112,-1,0,1,Boost Pumps Main Fuselage Left", "FUEL_SYSTEM(36),3007,PTR-FSCP-BOOST-PUMPS-MAIN-L,TUMB,112,1,0,1,Boost Pumps Main Fuselage Left", "VHF_FM_RADIO(56),3003,PTR-ANARC186-VHFFM-MODE,TUMB,152,0.1,0,0.2,Frequency Mode Dial", "VHF_FM_RADIO(56),3003,PTR-ANARC186-VHFFM-MODE,TUMB,152,-0.1,0,0.2,Frequency Mode Dial", "VHF_FM_RADIO(56),3004,PTR-ANARC186-VHFFM-FREQEMER-CONTROL,TUMB,149,0.1,0,0.3,Frequency Selection Dial", "VHF_FM_RADIO(56),3004,PTR-ANARC186-VHFFM-FREQEMER-CONTROL,TUMB,149,-0.1,0,0.3,Frequency Selection Dial", "MFCD_RIGHT(3),3019,PNT-BTN-MFD-R-19,BTN,344,1,0,1,OSB 19", "KY_58(69),3006,PTR-LVR-PANKY58-MODE,TUMB,783,0.1,0,0.2,Mode switch", "KY_58(69),3006,PTR-LVR-PANKY58-MODE,TUMB,783,-0.1,0,0.2,Mode switch", "UFC(8),3022,PNT-BTN-UFC-DATA-UP,BTN,406,1,0,1,1. Change Menu/Display Data 2. Cycle between DTS and Hot Elevation (N/A) 3. Change HACK Time Interval 4. FUNC Mode: Alternate CDU PG rocker", "CPT_MECH(39),3005,PTR-SEAT-ADJBUTTON,BTN,770,1,0,1,Seat Height Adjustment", "CPT_MECH(39),3004,PTR-SEAT-ADJBUTTON,BTN,770,-1,-1,0,Seat Height Adjustment", "VHF_FM_RADIO(56),3010,PTR-ANARC186-VHFFM-FREQ-1,TUMB,153,0.1,0,1,Frequency Selector the 1nd", "VHF_FM_RADIO(56),3009,PTR-ANARC186-VHFFM-FREQ-1,TUMB,153,-0.1,0,1,Frequency Selector the 1nd", "CDU(9),3013,PNT-BTN-CDU-FPM,BTN,422,1,0,1,Display Flight Plan Menu (FPMENU) Page", "CDU(9),3023,PNT-BTN-CDU-9,BTN,433,1,0,1,", "MFCD_RIGHT(3),3012,PNT-BTN-MFD-R-12,BTN,337,1,0,1,OSB 12", "AUTOPILOT(38),3030,PTR-EMER-BRKARM,TUMB,772,0,0,1,Emergency Brake", "AUTOPILOT(38),3030,PTR-EMER-BRKARM,TUMB,772,1,0,1,Emergency Brake", "INTERCOM(58),3002,PTR-INTERCOM-INT,LEV,221,1,0,1,INT Switch", "INTERCOM(58),3001,PTR-INTERCOM-INT,TUMB,222,-1,0,1,INT Switch", "INTERCOM(58),3001,PTR-INTERCOM-INT,TUMB,222,1,0,1,INT Switch", "UFC(8),3017,PNT-BTN-UFC-MK,BTN,401,1,0,1,Create Overhead Mark Point", "LIGHT_SYSTEM(49),3010,PTR-LGHTCP-ANTICOLLISION,BTN,289,1,0,1,Anticollision Lights", "VHF_FM_RADIO(56),3008,PTR-ANARC186-VHFFM-SQUELCH,BTN,148,1,0,1,Squelch / TONE", "VHF_FM_RADIO(56),3007,PTR-ANARC186-VHFFM-SQUELCH,TUMB,148,1,-1,0,Squelch / TONE", "MFCD_RIGHT(3),3010,PNT-BTN-MFD-R-10,BTN,335,1,0,1,OSB 10", "INTERCOM(58),3006,PTR-INTERCOM-VHF,LEV,225,1,0,1,VHF Switch", "INTERCOM(58),3005,PTR-INTERCOM-VHF,TUMB,226,-1,0,1,VHF Switch", "INTERCOM(58),3005,PTR-INTERCOM-VHF,TUMB,226,1,0,1,VHF Switch", "FUEL_SYSTEM(36),3012,PTR-FSCP-FILLDISABLE-WING-L,TUMB,117,1,0,1,Fill Disable Wing Left", "ELEC_INTERFACE(1),3015,PTR-CBP-EMER-TRIM,TUMB,674,-1,0,1,EMER TRIM", "ELEC_INTERFACE(1),3015,PTR-CBP-EMER-TRIM,TUMB,674,1,0,1,EMER TRIM", "CDU(9),3056,PNT-BTN-CDU-BCK,BTN,467,1,0,1,Erase Single Character. Hold for repeated erase", "CPT_MECH(39),3014,PTR-CNP-JETTARM,TUMB,785,-1,0,1,Canopy jettison lever", "CPT_MECH(39),3014,PTR-CNP-JETTARM,TUMB,785,1,0,1,Canopy jettison lever", "MFCD_RIGHT(3),3021,PNT-MFCD-R-ADJ-UP,BTN,346,1,0,1,Moving Map Scale Adjust Increase", "INTERCOM(58),3014,PTR-INTERCOM-ILS,LEV,233,1,0,1,ILS Switch", "INTERCOM(58),3013,PTR-INTERCOM-ILS,TUMB,234,-1,0,1,ILS Switch", "INTERCOM(58),3013,PTR-INTERCOM-ILS,TUMB,234,1,0,1,ILS Switch", "CDU(9),3026,PNT-BTN-CDU-SLASH,BTN,436,1,0,1,", "MFCD_RIGHT(3),3008,PNT-BTN-MFD-R-08,BTN,333,1,0,1,OSB 8", "ELEC_INTERFACE(1),3039,PTR-CBP-AUX-ESS-BUS-0B,TUMB,698,-1,0,1,AUX ESS BUS 0B", "ELEC_INTERFACE(1),3039,PTR-CBP-AUX-ESS-BUS-0B,TUMB,698,1,0,1,AUX ESS BUS 0B", "CDU(9),3061,PNT-BTN-CDU-DIMBRT-R,BTN,424,1,0,1,Display Brightness Adjustment (Not Functional)", "LIGHT_SYSTEM(49),3014,PTR-LIGHTS-LAND,TUMB,655,-0.1,0,0.2,Land Taxi Lights", "LIGHT_SYSTEM(49),3014,PTR-LIGHTS-LAND,TUMB,655,0.1,0,0.2,Land Taxi Lights", "UHF_RADIO(54),3011,PTR-ANARC164-VOLUME,LEV,171,1,0,1,Volume", "CPT_MECH(39),3003,PTR-DOWNLOCK-OVERRIDE,BTN,651,1,0,1,Downlock Override", "INTERCOM(58),3010,PTR-INTERCOM-AIM,LEV,229,1,0,1,AIM Switch", "INTERCOM(58),3009,PTR-INTERCOM-AIM,TUMB,230,-1,0,1,AIM Switch", "INTERCOM(58),3009,PTR-INTERCOM-AIM,TUMB,230,1,0,1,AIM Switch", "UFC(8),3003,PNT-BTN-UFC-3,BTN,387,1,0,1,", "INTERCOM(58),3017,PTR-INTERCOM-HM,TUMB,237,-1,0,1,HM Switch", "INTERCOM(58),3017,PTR-INTERCOM-HM,TUMB,237,1,0,1,HM Switch", "ELEC_INTERFACE(1),3005,PTR-EPP-AC-GEN-PWR-R,TUMB,245,1,0,1,Right AC generator Power", "ELEC_INTERFACE(1),3005,PTR-EPP-AC-GEN-PWR-R,TUMB,245,-1,0,1,Right AC generator Power", "TISL(57),3002,PTR-TISLCP-SLANT-RNG,TUMB,623,1,-1,1,Slant range", "TISL(57),3002,PTR-TISLCP-SLANT-RNG,TUMB,623,-1,-1,1,Slant range", "UFC(8),3020,PNT-BTN-UFC-STEER-UP,BTN,405,1,0,1,Cycle Steerpoint/Waypoint", "FIRE_SYSTEM(50),3004,PTR-FIRE-EXTING-DISCH,TUMB,105,1,-1,1,Fire Extinguishing Agent Discharge", "FIRE_SYSTEM(50),3004,PTR-FIRE-EXTING-DISCH,TUMB,105,-1,-1,1,Fire Extinguishing Agent Discharge", "ILS(53),3003,PTR-ILSCP-VOL,LEV,249,0.1,0,0.9,ILS Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click and hold while moving mouse to adjust volume ", "ILS(53),3004,PTR-ILSCP-VOL,TUMB,250,0.1,0,1,ILS Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click and hold while moving mouse to adjust volume ", "ILS(53),3005,PTR-ILSCP-VOL,TUMB,250,-0.1,0,1,ILS Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click and hold while moving mouse to adjust volume ", "AHCP(7),3005,PNT-TMB-AHCP-ALT,TUMB,379,-0.1,0,0.2,Altimeter Source", "AHCP(7),3005,PNT-TMB-AHCP-ALT,TUMB,379,0.1,0,0.2,Altimeter Source",
-        "CMSC(5),3007,PNT-LEV-RWR-AUD,LEV,368,1,0,1,Adjust RWR Volume", "HARS(44),3001,PTR-HARS-FAST-ERECT,BTN,711,1,0,1,HARS Fast Erect", "IFF(43),3002,PTR-IFFCP-MODE1-WHEEL2,TUMB,210,0.1,0,0.3,MODE1-WHEEL2", "IFF(43),3002,PTR-IFFCP-MODE1-WHEEL2,TUMB,210,-0.1,0,0.3,MODE1-WHEEL2", "HARS(44),3004,PTR-HARS-CP-MAG-VAR,TUMB,272,-1,-1,1,HARS MAG VAR", "HARS(44),3004,PTR-HARS-CP-MAG-VAR,TUMB,272,1,-1,1,HARS MAG VAR", "AUTOPILOT(38),3020,PTR-EFCP-TRIM-LWINGDN,BTN,176,0.4,0,0.4,Trim Emergency Left Wing Down", "MFCD_LEFT(2),3034,PNT-MFD-L-SYM-DN,BTN,324,-1,-1,0,Decrease Symbol Levels", "UHF_RADIO(54),3016,PTR-ANTSP-UHF,TUMB,707,0.5,0,1,UHF antenna switch", "UHF_RADIO(54),3016,PTR-ANTSP-UHF,TUMB,707,-0.5,0,1,UHF antenna switch", "KY_58(69),3001,PTR-ZEROIZE-COVER,TUMB,778,-1,0,1,Zeroise Cover", "KY_58(69),3001,PTR-ZEROIZE-COVER,TUMB,778,1,0,1,Zeroise Cover", "ELEC_INTERFACE(1),3002,PTR-EPP-INVERTER,BTN,242,-1,-1,0,Inverter Switch", "ELEC_INTERFACE(1),3002,PTR-EPP-INVERTER,TUMB,242,1,0,1,Inverter Switch", "MFCD_RIGHT(3),3033,PNT-MFD-R-SYM-UP,BTN,350,1,0,1,Increase Symbol Levels", "KY_58(69),3003,PTR-DELAY-SWITCH,TUMB,780,-1,0,1,Delay Switch", "KY_58(69),3003,PTR-DELAY-SWITCH,TUMB,780,1,0,1,Delay Switch", "IFF(43),3013,PTR-IFFCP-TEST-M-C,BTN,205,1,0,1,Test M-C", "IFF(43),3013,PTR-IFFCP-TEST-M-C,TUMB,205,0,-1,0,Test M-C", "KY_58(69),3005,PTR-LVR-PANKY58-1TO5,TUMB,782,0.1,0,0.5,Full switch", "KY_58(69),3005,PTR-LVR-PANKY58-1TO5,TUMB,782,-0.1,0,0.5,Full switch", "IFFCC(12),3002,PTR-ARMGS-COVER,TUMB,709,-1,0,1,Arm Ground Safety Override Cover", "IFFCC(12),3002,PTR-ARMGS-COVER,TUMB,709,1,0,1,Arm Ground Safety Override Cover", "CDU(9),3018,PNT-BTN-CDU-4,BTN,428,1,0,1,", "CDU(9),3064,PNT-BTN-CDU-BLANC-L,BTN,469,-1,-1,0,Scroll Waypoint Names During Search", "VHF_FM_RADIO(56),3005,PTR-ANARC186-VHFFM-VOLUME,LEV,147,1,0,1,Volume", "KY_58(69),3007,PTR-TMB-PANKY58-POWER,TUMB,784,-1,0,1,Power switch", "KY_58(69),3007,PTR-TMB-PANKY58-POWER,TUMB,784,1,0,1,Power switch", "CDU(9),3045,PNT-BTN-CDU-S,BTN,455,1,0,1,", "AHCP(7),3004,PNT-TMB-AHCP-TGP,TUMB,378,-1,0,1,Targeting Pod Power On/Off", "AHCP(7),3004,PNT-TMB-AHCP-TGP,TUMB,378,1,0,1,Targeting Pod Power On/Off", "CPT_MECH(39),3008,PTR-ARM-DWNC-L,TUMB,718,-1,0,1,Auxiliary Landing Gear Handle", "CPT_MECH(39),3008,PTR-ARM-DWNC-L,TUMB,718,1,0,1,Auxiliary Landing Gear Handle", "NMSP(46),3005,PTR-NMSP-ANCHR,BTN,613,1,0,1,ANCHR Mode", "MFCD_LEFT(2),3002,PNT-BTN-MFD-L-02,BTN,301,1,0,1,OSB 2", "UFC(8),3028,PNT-BTN-UFC-INTEN-RGT,BTN,409,1,0,1,Adjust HUD Brightness (Hold rocker)", "ACCELEROMETER(72),3001,ACCEL_KNOB_PTR,BTN,904,1,0,1,Push to set", "MFCD_LEFT(2),3016,PNT-BTN-MFD-L-16,BTN,315,1,0,1,OSB 16", "TISL(57),3003,PTR-TISLCP-ALT-ABV-TGT-WH1,TUMB,624,0.1,0,1,Altitude above target tens of thousands of feet", "TISL(57),3003,PTR-TISLCP-ALT-ABV-TGT-WH1,TUMB,624,-0.1,0,1,Altitude above target tens of thousands of feet", "ENVIRONMENT_SYSTEM(41),3014,ANTI-G-VALVE-PTR,BTN,776,1,0,1,Anti-G suit valve test button", "CDU(9),3062,PNT-BTN-CDU-PG-UP,BTN,463,1,0,1,Page Up To Additional Pages When Available", "MFCD_RIGHT(3),3016,PNT-BTN-MFD-R-16,BTN,341,1,0,1,OSB 16", "MFCD_LEFT(2),3006,PNT-BTN-MFD-L-06,BTN,305,1,0,1,OSB 6", "CPT_MECH(39),3013,CANOPY-DISENGAGE-LEVER-PTR,TUMB,777,-1,0,1,Internal canopy actuator disengage lever", "CPT_MECH(39),3013,CANOPY-DISENGAGE-LEVER-PTR,TUMB,777,1,0,1,Internal canopy actuator disengage lever", "TISL(57),3004,PTR-TISLCP-ALT-ABV-TGT-WH2,TUMB,626,0.1,0,1,Altitude above target units of thousands of feet", "TISL(57),3004,PTR-TISLCP-ALT-ABV-TGT-WH2,TUMB,626,-0.1,0,1,Altitude above target units of thousands of feet", "HARS(44),3003,PTR-HARS-CP-N-S,TUMB,273,-1,0,1,HARS N/S toggle switch", "HARS(44),3003,PTR-HARS-CP-N-S,TUMB,273,1,0,1,HARS N/S toggle switch", "ENVIRONMENT_SYSTEM(41),3009,PTR-ENVCP-FLOW-LEVEL,LEV,284,0,0,1,Flow Level Control", "AAP(22),3004,PNT-LEV-PAGE-SEL-SWITCH,TUMB,475,0.1,0,0.3,CDU Page Select", "AAP(22),3004,PNT-LEV-PAGE-SEL-SWITCH,TUMB,475,-0.1,0,0.3,CDU Page Select", "IFF(43),3019,PTR-ANTSP-IFF,TUMB,706,0.5,0,1,IFF antenna switch", "IFF(43),3019,PTR-ANTSP-IFF,TUMB,706,-0.5,0,1,IFF antenna switch", "MFCD_LEFT(2),3024,PNT-MFCD-L-DSP-UP,BTN,321,1,0,1,Increase Backlight Brightness", "AUTOPILOT(38),3031,PTR-ALCP-HARSSAS,TUMB,196,-1,0,1,HARS-SAS Override/NORM", "AUTOPILOT(38),3031,PTR-ALCP-HARSSAS,TUMB,196,1,0,1,HARS-SAS Override/NORM", "HARS(44),3007,PTR-HARS-CP-PUSH-TO-SYNC,LEV,268,0.5,0,1,HARS Push-To-Sync", "HARS(44),3006,PTR-HARS-CP-PUSH-TO-SYNC,BTN,267,1,0,1,HARS Push-To-Sync", "ELEC_INTERFACE(1),3022,PTR-CBP-EMER-FUEL-SHUTOFF-ENG-L,TUMB,681,-1,0,1,EMER FUEL SHUTOFF ENG L", "ELEC_INTERFACE(1),3022,PTR-CBP-EMER-FUEL-SHUTOFF-ENG-L,TUMB,681,1,0,1,EMER FUEL SHUTOFF ENG L", "ENVIRONMENT_SYSTEM(41),3013,PTR-ENVCP-TEM-LEVEL,LEV,286,0,0,1,Temp Level Control", "UHF_RADIO(54),3017,PTR-ANTSP-EGI-HQ-TOD,TUMB,708,-1,0,1,EGI HQ TOD", "UHF_RADIO(54),3017,PTR-ANTSP-EGI-HQ-TOD,TUMB,708,1,0,1,EGI HQ TOD", "MFCD_LEFT(2),3012,PNT-BTN-MFD-L-12,BTN,311,1,0,1,OSB 12", "AN_ALR69V(29),3001,PNT-LVR-RWR,LEV,16,1,0.15,0.85,Adjust Display Brightness", "CDU(9),3033,PNT-BTN-CDU-G,BTN,443,1,0,1,", "ELEC_INTERFACE(1),3014,PTR-CBP-EMER-FLAP,TUMB,673,-1,0,1,EMER FLAP", "ELEC_INTERFACE(1),3014,PTR-CBP-EMER-FLAP,TUMB,673,1,0,1,EMER FLAP", "ELEC_INTERFACE(1),3034,PTR-CBP-INTER-COMM,TUMB,693,-1,0,1,INTER COMM", "ELEC_INTERFACE(1),3034,PTR-CBP-INTER-COMM,TUMB,693,1,0,1,INTER COMM", "(0),3001,PNT-MIRROR-LEFT,TUMB,719,-1,0,1,Toggle Mirrors", "(0),3001,PNT-MIRROR-LEFT,TUMB,719,1,0,1,Toggle Mirrors", "AHCP(7),3010,PNT-TMB-AHCP-IFFCC,TUMB,384,-0.1,0,0.2,Turn On/Off/Test IFFCC", "AHCP(7),3010,PNT-TMB-AHCP-IFFCC,TUMB,384,0.1,0,0.2,Turn On/Off/Test IFFCC", "FUEL_SYSTEM(36),3014,PTR-FSCP-FILLDISABLE-MAIN-L,TUMB,119,1,0,1,Fill Disable Main Left", "(0),3001,PNT-MIRROR-FRONT,TUMB,719,-1,0,1,Toggle Mirrors", "(0),3001,PNT-MIRROR-FRONT,TUMB,719,1,0,1,Toggle Mirrors", "MFCD_LEFT(2),3008,PNT-BTN-MFD-L-08,BTN,307,1,0,1,OSB 8", "DIGITAL_CLOCK(15),3002,PNT-LVR-WATCH-CTRL,BTN,69,1,0,1,Start, Stop and Reset Elapsed Timer", "(0),3001,PNT-MIRROR-RIGHT,TUMB,719,-1,0,1,Toggle Mirrors", "(0),3001,PNT-MIRROR-RIGHT,TUMB,719,1,0,1,Toggle Mirrors", "CDU(9),3059,PNT-BTN-CDU-FA,BTN,471,1,0,1,Fault Acknowledge/Clear Fault Display", "MFCD_LEFT(2),3030,PNT-MFD-L-CON-UP,BTN,323,1,0,1,Increase Contrast", "LIGHT_SYSTEM(49),3005,PTR-LGHTCP-FLOOD,LEV,296,1,0,1,Flood Light", "CDU(9),3027,PNT-BTN-CDU-A,BTN,437,1,0,1,", "CDU(9),3031,PNT-BTN-CDU-E,BTN,441,1,0,1,", "VHF_FM_RADIO(56),3014,PTR-ANARC186-VHFFM-FREQ-3,TUMB,155,0.1,0,1,Frequency Selector the 3rd", "VHF_FM_RADIO(56),3013,PTR-ANARC186-VHFFM-FREQ-3,TUMB,155,-0.1,0,1,Frequency Selector the 3rd", "UFC(8),3027,PNT-BTN-UFC-DEPR-DN,BTN,408,-1,-1,0,Adjust Depressible Pipper", "UFC(8),3018,PNT-BTN-UFC-ALT,BTN,402,1,0,1,Display and Adjust Altitude Alert Values", "CDU(9),3008,PNT-BTN-CDU-ARW-R4,BTN,417,1,0,1,LSK 9R", "MFCD_RIGHT(3),3014,PNT-BTN-MFD-R-14,BTN,339,1,0,1,OSB 14", "CMSP(4),3001,PNT-BTN-CMSP-ARW1,BTN,352,1,0,1,Edit Program Value", "LIGHT_SYSTEM(49),3003,PTR-LGHTCP-AUX-INST,LEV,293,1,0,1,Auxiliary Instruments Lights", "UFC(8),3031,PNT-BTN-UFC-MID,BTN,532,1,0,1,No Function ", "ELEC_INTERFACE(1),3028,PTR-CBP-EXT-STORES-JETT-2,TUMB,687,-1,0,1,EXT STORES JETT 2", "ELEC_INTERFACE(1),3028,PTR-CBP-EXT-STORES-JETT-2,TUMB,687,1,0,1,EXT STORES JETT 2", "ELEC_INTERFACE(1),3010,PTR-CBP-ELEVATION-DISC-L,TUMB,669,-1,0,1,ELEVATION DISC L", "ELEC_INTERFACE(1),3010,PTR-CBP-ELEVATION-DISC-L,TUMB,669,1,0,1,ELEVATION DISC L", "HARS(44),3002,PTR-HARS-CP-SLAVE,TUMB,270,-1,0,1,HARS SLAVE-DG mode", "HARS(44),3002,PTR-HARS-CP-SLAVE,TUMB,270,1,0,1,HARS SLAVE-DG mode", "UHF_RADIO(54),3006,PTR-ANARC164-0.025MHZ-SELECTOR,TUMB,166,0.1,0,0.3,0.025 MHz Selector", "UHF_RADIO(54),3006,PTR-ANARC164-0.025MHZ-SELECTOR,TUMB,166,-0.1,0,0.3,0.025 MHz Selector", "UFC(8),3023,PNT-BTN-UFC-DATA-DN,BTN,406,-1,-1,0,1. Change Menu/Display Data 2. Cycle between DTS and Hot Elevation (N/A) 3. Change HACK Time Interval 4. FUNC Mode: Alternate CDU PG rocker", "CDU(9),3048,PNT-BTN-CDU-V,BTN,458,1,0,1,", "CDU(9),3043,PNT-BTN-CDU-Q,BTN,453,1,0,1,", "NMSP(46),3007,PTR-NMSP-ILS,BTN,617,1,0,1,ILS Mode", "ENGINE_SYSTEM(37),3009,PTR-TEMS-DATA,BTN,652,1,0,1,TEMS DATA", "CDU(9),3004,PNT-BTN-CDU-ARW-L4,BTN,413,1,0,1,LSK 9L", "FUEL_SYSTEM(36),3002,PTR-FSCP-EXT-TANKS-FUS,TUMB,107,-1,0,1,External Fuselage Tank Boost Pump", "FUEL_SYSTEM(36),3002,PTR-FSCP-EXT-TANKS-FUS,TUMB,107,1,0,1,External Fuselage Tank Boost Pump", "ENGINE_SYSTEM(37),3006,PTR-THROTTLE-FRICTION,LEV,128,1,0,1,Throttle Friction Control", "MFCD_LEFT(2),3021,PNT-MFCD-L-ADJ-UP,BTN,320,1,0,1,Moving Map Scale Adjust Increase", "LIGHT_SYSTEM(49),3007,PTR-EPP-EMER-FLOOD,TUMB,243,1,0,1,Emergency Flood Light", "LIGHT_SYSTEM(49),3007,PTR-EPP-EMER-FLOOD,TUMB,243,-1,0,1,Emergency Flood Light", "IFF(43),3021,PTR-BTN-PANIFF-TEST,LEV,901,0.5,0,1,Test test", "IFF(43),3018,PTR-BTN-PANIFF-TEST,BTN,796,1,0,1,Test test", "MFCD_LEFT(2),3010,PNT-BTN-MFD-L-10,BTN,309,1,0,1,OSB 10", "TACAN_CTRL_PANEL(74),3005,PTR-TACAN-VOL,LEV,261,1,0,1,Signal Volume", "TISL(57),3010,PTR-TISLCP-ENTER,BTN,628,1,0,1,ENTER", "FUEL_SYSTEM(36),3016,PTR-FSCP-RCVR-LEVER,TUMB,121,-1,0,1,Aerial Refueling Slipway Control Lever", "FUEL_SYSTEM(36),3016,PTR-FSCP-RCVR-LEVER,TUMB,121,1,0,1,Aerial Refueling Slipway Control Lever", "CMSP(4),3004,PNT-BTN-CMSP-ARW4,BTN,355,1,0,1,Edit Program Value", "AHCP(7),3001,PNT-TMB-AHCP-MARM,TUMB,375,-0.1,0,0.2,Master Arm", "AHCP(7),3001,PNT-TMB-AHCP-MARM,TUMB,375,0.1,0,0.2,Master Arm", "LIGHT_SYSTEM(49),3015,PTR-ALCP-RSIL,LEV,193,0,0,1,Refuel Status Indexer Lights", "MFCD_LEFT(2),3003,PNT-BTN-MFD-L-03,BTN,302,1,0,1,OSB 3", "UFC(8),3013,PNT-BTN-UFC-FUNC,BTN,397,1,0,1,Select Function Mode", "FUEL_SYSTEM(36),3010,PTR-FSCP-LINE-CHECK,BTN,115,1,0,1,Line Check", "UFC(8),3024,PNT-BTN-UFC-SEL-UP,BTN,407,1,0,1,1. HUD TEST: Navigate Menus 2. GUNS: Change Gun Reticle 3. CCIP/CCRP: Change Weapon Profile 4. AIR-to-AIR: Change Air Threat 5. FUNC Mode: Alternate CDU + Rocker", "CDU(9),3007,PNT-BTN-CDU-ARW-R3,BTN,416,1,0,1,LSK 7R", "TISL(57),3011,PTR-TISLCP-BITE,BTN,632,1,0,1,BITE",
-        "CDU(9),3001,PNT-BTN-CDU-ARW-L1,BTN,410,1,0,1,LSK 3L", "TACAN_CTRL_PANEL(74),3002,PTR-TACAN-CHANNEL-SELECTOR-2,LEV,257,0.1,0,1,Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "TACAN_CTRL_PANEL(74),3003,PTR-TACAN-CHANNEL-SELECTOR-2,TUMB,258,1,0,1,Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "TACAN_CTRL_PANEL(74),3003,PTR-TACAN-CHANNEL-SELECTOR-2,TUMB,258,-1,0,1,Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "FUEL_SYSTEM(36),3013,PTR-FSCP-FILLDISABLE-WING-R,TUMB,118,1,0,1,Fill Disable Wing Right", "TISL(57),3006,PTR-TISLCP-CODE-WH2,TUMB,638,0.05,0,1,TISL Code wheel 2", "TISL(57),3006,PTR-TISLCP-CODE-WH2,TUMB,638,-0.05,0,1,TISL Code wheel 2", "ELEC_INTERFACE(1),3001,PTR-EPP-APU-GEN-PWR,TUMB,241,1,0,1,APU Generator On/Off", "ELEC_INTERFACE(1),3001,PTR-EPP-APU-GEN-PWR,TUMB,241,-1,0,1,APU Generator On/Off", "CDU(9),3054,PNT-BTN-CDU-V2,BTN,465,1,0,1,No function", "CDU(9),3042,PNT-BTN-CDU-P,BTN,452,1,0,1,", "SYS_CONTROLLER(24),3003,PTR-LG-WRN-SILENCE,BTN,127,1,0,1,Landing Gear Horn Silence Button", "SYS_CONTROLLER(24),3001,PNT-BTN-UFC-MASTWARN,BTN,403,1,0,1,Master Caution Light", "ELEC_INTERFACE(1),3019,PTR-CBP-APU-CONT,TUMB,678,-1,0,1,APU CONT", "ELEC_INTERFACE(1),3019,PTR-CBP-APU-CONT,TUMB,678,1,0,1,APU CONT", "MFCD_RIGHT(3),3017,PNT-BTN-MFD-R-17,BTN,342,1,0,1,OSB 17", "CDU(9),3058,PNT-BTN-CDU-CLR,BTN,470,1,0,1,Erase Entire Scratchpad", "INTERCOM(58),3019,PTR-INTERCOM-MODE,TUMB,239,-0.1,0,0.4,Selector switch", "INTERCOM(58),3019,PTR-INTERCOM-MODE,TUMB,239,0.1,0,0.4,Selector switch", "CDU(9),3037,PNT-BTN-CDU-K,BTN,447,1,0,1,", "IFF(43),3008,PTR-IFFCP-MASTER,TUMB,200,0.1,0,0.4,Master", "IFF(43),3008,PTR-IFFCP-MASTER,TUMB,200,-0.1,0,0.4,Master", "UFC(8),3032,PNT-BTN-UFC-AFT,BTN,533,1,0,1,No Function", "CPT_MECH(39),3011,BOARD-LADDER-COVER-PTR,TUMB,787,-1,0,1,Extend boarding ladder cover", "CPT_MECH(39),3011,BOARD-LADDER-COVER-PTR,TUMB,787,1,0,1,Extend boarding ladder cover", "IFF(43),3014,PTR-IFFCP-RADTEST,BTN,206,1,0,1,RAD Test/Mon", "IFF(43),3014,PTR-IFFCP-RADTEST,TUMB,206,0,-1,0,RAD Test/Mon", "TISL(57),3009,PTR-TISLCP-TISL-AUX,TUMB,644,1,-1,1,TISL AUX", "TISL(57),3009,PTR-TISLCP-TISL-AUX,TUMB,644,-1,-1,1,TISL AUX", "UFC(8),3025,PNT-BTN-UFC-SEL-DN,BTN,407,-1,-1,0,1. HUD TEST: Navigate Menus 2. GUNS: Change Gun Reticle 3. CCIP/CCRP: Change Weapon Profile 4. AIR-to-AIR: Change Air Threat 5. FUNC Mode: Alternate CDU + Rocker", "HSI(45),3001,PNT-LVR-HSI-HDG,LEV,45,1,0,1,Heading Set Knob", "MFCD_RIGHT(3),3036,PNT-LVR-MFD-R,TUMB,351,-0.1,0,0.2,DAY/NIGHT/OFF", "MFCD_RIGHT(3),3036,PNT-LVR-MFD-R,TUMB,351,0.1,0,0.2,DAY/NIGHT/OFF", "UFC(8),3007,PNT-BTN-UFC-7,BTN,391,1,0,1,", "MFCD_LEFT(2),3018,PNT-BTN-MFD-L-18,BTN,317,1,0,1,OSB 18", "AUTOPILOT(38),3007,PTR-SASP-PITCH-SASENGAGE-L,BTN,187,1,0,1,Pitch SAS Engage left", "CPT_MECH(39),3009,PTR-BTN-ARM-DWNC-L,TUMB,722,-1,0,1,Auxiliary Landing Gear Handle Lock button", "CPT_MECH(39),3009,PTR-BTN-ARM-DWNC-L,TUMB,722,1,0,1,Auxiliary Landing Gear Handle Lock button", "CMSP(4),3006,PNT-BTN-CMSP-BRT-DN,BTN,356,-1,-1,0,Cycle Program or Value Down", "AAP(22),3006,PTR-TMB-EGI-SWITCH,TUMB,477,-1,0,1,EGI Power On/Off", "AAP(22),3006,PTR-TMB-EGI-SWITCH,TUMB,477,1,0,1,EGI Power On/Off", "FUEL_SYSTEM(36),3018,PTR-FQIS-TEST,BTN,646,1,0,1,Fuel Gauge Test", "NMSP(46),3008,PTR-NMSP-ABLE-STOW,TUMB,621,-1,0,1,ABLE-STOW ADI Localizer Bar", "NMSP(46),3008,PTR-NMSP-ABLE-STOW,TUMB,621,1,0,1,ABLE-STOW ADI Localizer Bar", "MFCD_RIGHT(3),3028,PNT-MFD-R-BRT-DN,BTN,348,-1,-1,0,Decrease Brightness", "IFF(43),3011,PTR-IFFCP-TEST-M-2,BTN,203,1,0,1,Test M-2", "IFF(43),3011,PTR-IFFCP-TEST-M-2,TUMB,203,0,-1,0,Test M-2", "MFCD_RIGHT(3),3007,PNT-BTN-MFD-R-07,BTN,332,1,0,1,OSB 7"],
-    "AJS37": ["LIGHTS(17),3010,PNT_3555,TUMB,3555,-1,0,1,Emergency Lights", "LIGHTS(17),3010,PNT_3555,TUMB,3555,1,0,1,Emergency Lights", "COUNTERMEASURE(28),3025,U22sel2-PTR,TUMB,318,0.1,0,0.4,Jammer Band Selector", "COUNTERMEASURE(28),3025,U22sel2-PTR,TUMB,318,-0.1,0,0.4,Jammer Band Selector", "NAVIGATION(12),3010,NavselBX-PTR,BTN,280,1,0,1,Navigation Selector Button BX", "LIGHTS(17),3004,Ledljus-PTR,TUMB,253,-1,0,1,Position Lights", "LIGHTS(17),3004,Ledljus-PTR,TUMB,253,1,0,1,Position Lights", "NAVIGATION(12),3023,Datapanel03-PTR,BTN,293,1,0,1,Datapanel Key 3", "FLIGHTDATAUNIT(22),3301,SPAK-PTR,TUMB,401,-1,0,1,SPAK", "FLIGHTDATAUNIT(22),3301,SPAK-PTR,TUMB,401,1,0,1,SPAK", "NAVIGATION(12),3025,Datapanel05-PTR,BTN,295,1,0,1,Datapanel Key 5", "FR22(31),3214,PNT_376,BTN,376,1,0,1,Flight 4", "NAVIGATION(12),3008,NavselLMAL-PTR,BTN,281,1,0,1,Navigation Selector Button L MÃL", "FR22(31),3203,PNT_365,BTN,365,1,0,1,Special 3", "WEAPON_SYSTEM(2),3800,PNT_400,TUMB,-666,1,0,1,Missile Select Button (IR-RB FRAMSTEGN)", "FR22(31),3230,PNT_2002,TUMB,-666,-1,-1,1,Base Selector", "FR22(31),3230,PNT_2002,TUMB,-666,1,-1,1,Base Selector", "FLIGHTDATAUNIT(22),3405,Seatsafe-PTR,TUMB,21,0,1,,Ejection Seat Arm", "FLIGHTDATAUNIT(22),3405,Seatsafe-PTR,TUMB,21,1,1,,Ejection Seat Arm", "NAVIGATION(12),3012,NavselB2-PTR,BTN,272,1,0,1,Navigation Selector Button B2", "ERRORPANEL(26),3002,warnpanelcheck-PTR,BTN,344,1,0,1,Warning Panel Light Test", "ENGINEPANEL(18),3921,PNT_1204,TUMB,1204,-1,0,1,IFF Channel Selector", "ENGINEPANEL(18),3921,PNT_1204,TUMB,1204,1,0,1,IFF Channel Selector", "NAVIGATION(12),3009,NavselLS-PTR,BTN,270,1,0,1,Navigation Selector Button LS", "FLIGHTDATAUNIT(22),3512,TILSSLCT-PTR,TUMB,282,0.1,0,1,TILS Channel Selection", "FLIGHTDATAUNIT(22),3512,TILSSLCT-PTR,TUMB,282,-0.1,0,1,TILS Channel Selection", "ENGINEPANEL(18),3002,LTKran-PTR,TUMB,204,-1,0,1,Low-pressure Fuel Valve", "ENGINEPANEL(18),3002,LTKran-PTR,TUMB,204,1,0,1,Low-pressure Fuel Valve", "FLIGHTDATAUNIT(22),3302,ATT-PTR,TUMB,402,-1,0,1,Attitude Hold", "FLIGHTDATAUNIT(22),3302,ATT-PTR,TUMB,402,1,0,1,Attitude Hold", "WEAPON_SYSTEM(2),3303,WepEmR-PTR,BTN,261,1,0,1,Weapon Emergency Release Button", "WEAPON_SYSTEM(2),3304,WepSEL-PTR,TUMB,264,0.1,0,0.5,Weapon Selector Knob - J/A Valjare", "WEAPON_SYSTEM(2),3304,WepSEL-PTR,TUMB,264,-0.1,0,0.5,Weapon Selector Knob - J/A Valjare", "ELECTRICSYSTEM(19),3003,Backupgen-PTR,TUMB,312,-1,0,1,Backup Generator", "ELECTRICSYSTEM(19),3003,Backupgen-PTR,TUMB,312,1,0,1,Backup Generator", "FLIGHTDATAUNIT(22),3722,PNT_175,BTN,-666,1,0,1,Max G Reset", "FLIGHTDATAUNIT(22),3918,PNT_388,TUMB,388,-1,-1,1,Emergency Yaw Trim", "FLIGHTDATAUNIT(22),3918,PNT_388,TUMB,388,1,-1,1,Emergency Yaw Trim", "NAVIGATION(12),3017,NavselB7-PTR,BTN,277,1,0,1,Navigation Selector Button B7", "WEAPON_SYSTEM(2),3300,Mastersafe-PTR,TUMB,8,-1,0,1,Trigger Safety Bracket", "WEAPON_SYSTEM(2),3300,Mastersafe-PTR,TUMB,8,1,0,1,Trigger Safety Bracket", "FR22(31),3307,PNT_360,TUMB,-666,-1,-1,1,Group Selector", "FR22(31),3307,PNT_360,TUMB,-666,1,-1,1,Group Selector", "NAVIGATIONPANEL(23),3009,Datarot-PTR,TUMB,200,0.1,0,0.6,Datapanel Selector", "NAVIGATIONPANEL(23),3009,Datarot-PTR,TUMB,200,-0.1,0,0.6,Datapanel Selector", "FLIGHTDATAUNIT(22),3719,PNT_12,TUMB,12,0,0,1,Gear Handle", "FLIGHTDATAUNIT(22),3719,PNT_12,TUMB,12,1,0,1,Gear Handle", "LIGHTS(17),3002,Lanternljus-PTR,TUMB,251,-1,-1,1,Navigation Lights", "LIGHTS(17),3002,Lanternljus-PTR,TUMB,251,1,-1,1,Navigation Lights", "RADAR(5),3209,PNT_214,TUMB,214,-1,0,1,Lin/Log Radar Gain Switch", "RADAR(5),3209,PNT_214,TUMB,214,1,0,1,Lin/Log Radar Gain Switch", "FLIGHTDATAUNIT(22),3401,PNT_11,BTN,11,1,0,1,HUD Reflector Glass Position", "FR22(31),3004,PNT_172,LEV,172,0,0,1,Radio Manual Frequency Setting Knob Outer Left", "WEAPON_SYSTEM(2),3306,WepRelmode-PTR,TUMB,266,-1,0,1,Weapon Release Mode Switch - Fallsattomkopplare", "WEAPON_SYSTEM(2),3306,WepRelmode-PTR,TUMB,266,1,0,1,Weapon Release Mode Switch - Fallsattomkopplare", "ENGINEPANEL(18),3910,PNT_307,TUMB,307,-1,0,1,CB CB Engine", "ENGINEPANEL(18),3910,PNT_307,TUMB,307,1,0,1,CB CB Engine", "ENGINEPANEL(18),3908,PNT_305,TUMB,305,-1,0,1,CB CI/SI", "ENGINEPANEL(18),3908,PNT_305,TUMB,305,1,0,1,CB CI/SI", "RADAR(5),3328,PNT_218,TUMB,218,-1,0,1,Pulse Normal/Short Switch", "RADAR(5),3328,PNT_218,TUMB,218,1,0,1,Pulse Normal/Short Switch", "RADAR(5),3914,PNT_1006,TUMB,1006,-1,0,1,Radar/EL Maintenance Test", "RADAR(5),3914,PNT_1006,TUMB,1006,1,0,1,Radar/EL Maintenance Test", "ENGINEPANEL(18),3917,PNT_396,LEV,396,0.001,,,Drysuit Ventilation Adjustment", "FR22(31),3212,PNT_374,BTN,374,1,0,1,Flight 2", "FLIGHTDATAUNIT(22),3742,PNT_1200,TUMB,666,-1,0,1,Magnetic Declination Cover", "FLIGHTDATAUNIT(22),3742,PNT_1200,TUMB,666,1,0,1,Magnetic Declination Cover", "ENGINEPANEL(18),3918,PNT_395,TUMB,395,-1,0,1,Ignition Coils", "ENGINEPANEL(18),3918,PNT_395,TUMB,395,1,0,1,Ignition Coils", "ENGINEPANEL(18),3000,PNT_308,TUMB,309,0.1,0,1,IFF Code", "ENGINEPANEL(18),3000,PNT_308,TUMB,309,-0.1,0,1,IFF Code", "FR22(31),3210,PNT_372,BTN,372,1,0,1,Flight 0", "RADARALT(20),3002,RHMtill-PTR,TUMB,283,-1,0,1,Radar Altimeter Power", "RADARALT(20),3002,RHMtill-PTR,TUMB,283,1,0,1,Radar Altimeter Power", "RADAR(5),3922,PNT_1205,BTN,1205,1,0,1,IFF Identification", "ENGINEPANEL(18),3924,PNT_384,TUMB,384,-1,-1,1,Flight Recorder", "ENGINEPANEL(18),3924,PNT_384,TUMB,384,1,-1,1,Flight Recorder", "FLIGHTDATAUNIT(22),3802,PNT_CLOCK_RIGHT,BTN,0,1,0,1,Stopwatch Start/Stop/Reset", "DOPPLER(21),3001,PNT_213,TUMB,-666,-1,0,1,Doppler Land/Sea Mode", "DOPPLER(21),3001,PNT_213,TUMB,-666,1,0,1,Doppler Land/Sea Mode", "RWR(24),3006,PNT_399,LEV,399,1,0,1,Master Volume / Sidewinder Tone", "FLIGHTDATAUNIT(22),3732,PNT_211,LEV,-666,0.01,,,Autopilot Yaw Trim", "NAVIGATION(12),3027,Datapanel07-PTR,BTN,297,1,0,1,Datapanel Key 7", "FLIGHTDATAUNIT(22),3801,PNT_CLOCK_RIGHT001,LEV,135,1,,,Clock Setting", "NAVIGATIONPANEL(23),3001,RENSA-PTR,BTN,301,1,0,1,CK37 Rensa (Clear)", "RADAR(5),3800,PNT_POOP,LEV,-666,1,,,Radar Night Filter", "FLIGHTDATAUNIT(22),3200,HojdSI-PTR,TUMB,324,-1,0,1,HÃJD CISI", "FLIGHTDATAUNIT(22),3200,HojdSI-PTR,TUMB,324,1,0,1,HÃJD CISI", "ENGINEPANEL(18),3919,PNT_DME_TILL_FRAN,TUMB,1206,-1,0,1,DME Selector", "ENGINEPANEL(18),3919,PNT_DME_TILL_FRAN,TUMB,1206,1,0,1,DME Selector", "FLIGHTDATAUNIT(22),3303,HOJD-PTR,TUMB,403,-1,0,1,Altitude Hold", "FLIGHTDATAUNIT(22),3303,HOJD-PTR,TUMB,403,1,0,1,Altitude Hold", "NAVIGATION(12),3014,NavselB4-PTR,BTN,274,1,0,1,Navigation Selector Button B4", "COUNTERMEASURE(28),3026,KBsel1-PTR,TUMB,319,0.1,0,0.4,Countermeasure Operation Mode Selector", "COUNTERMEASURE(28),3026,KBsel1-PTR,TUMB,319,-0.1,0,0.4,Countermeasure Operation Mode Selector", "ENGINEPANEL(18),3005,HTK-PTR,TUMB,202,-1,0,1,High-pressure Fuel Valve", "ENGINEPANEL(18),3005,HTK-PTR,TUMB,202,1,0,1,High-pressure Fuel Valve", "ENGINEPANEL(18),3001,StartS-PTR,TUMB,206,-1,0,1,Start System", "ENGINEPANEL(18),3001,StartS-PTR,TUMB,206,1,0,1,Start System", "ENGINEPANEL(18),3905,PNT_302,TUMB,302,-1,0,1,CB Autopilot SA", "ENGINEPANEL(18),3905,PNT_302,TUMB,302,1,0,1,CB Autopilot SA", "NAVIGATION(12),3020,Datapanel00-PTR,BTN,290,1,0,1,Datapanel Key 0", "FR22(31),3006,PNT_174,LEV,174,0,0,1,Radio Manual Frequency Setting Knob Outer Right", "FR22(31),3200,PNT_362,BTN,362,1,0,1,Channel H", "FR22(31),3216,PNT_378,BTN,378,1,0,1,Flight 6", "WEAPON_SYSTEM(2),3305,WepINT-PTR,TUMB,265,-0.1,0,1,Weapon Interval Selector Mode Knob - Siktningvaljare", "WEAPON_SYSTEM(2),3305,WepINT-PTR,TUMB,265,0.1,0,1,Weapon Interval Selector Mode Knob - Siktningvaljare", "NAVIGATION(12),3021,Datapanel01-PTR,BTN,291,1,0,1,Datapanel Key 1", "FR22(31),3003,PNT_171,LEV,171,0,0,1,Radio Manual Frequency Setting Knob Inner Left", "ELECTRICSYSTEM(19),3002,Gen-PTR,TUMB,207,-1,0,1,Generator", "ELECTRICSYSTEM(19),3002,Gen-PTR,TUMB,207,1,0,1,Generator", "FR22(31),3008,PNT_170,BTN,-666,1,0,1,Radio Manual Frequency Setting Modulation", "LIGHTS(17),3003,Formljus-PTR,TUMB,252,-1,0,1,Formation Lights", "LIGHTS(17),3003,Formljus-PTR,TUMB,252,1,0,1,Formation Lights", "ENGINEPANEL(18),3912,PNT_286,LEV,286,0.001,,,Windscreen De-Ice", "FLIGHTDATAUNIT(22),3406,PNT_9,TUMB,9,-1,-1,1,Canopy Open/Close", "FLIGHTDATAUNIT(22),3406,PNT_9,TUMB,9,1,-1,1,Canopy Open/Close", "NAVIGATION(12),3015,NavselB5-PTR,BTN,275,1,0,1,Navigation Selector Button B5", "ERRORPANEL(26),3004,Kontroll-PTR,BTN,315,1,0,1,Indicator System Test", "FR22(31),3110,PNT_386,TUMB,-666,-1,-1,1,FR22 Mode Selector", "FR22(31),3110,PNT_386,TUMB,-666,1,-1,1,FR22 Mode Selector", "FR22(31),3204,PNT_366,BTN,366,1,0,1,Minus", "FR22(31),3217,PNT_379,BTN,379,1,0,1,Flight 7", "NAVIGATION(12),3028,Datapanel08-PTR,BTN,298,1,0,1,Datapanel Key 8", "FR22(31),3205,PNT_367,BTN,367,1,0,1,Channel A/G", "FLIGHTDATAUNIT(22),3402,PNT_464,BTN,-666,1,0,1,AFK Mode 3", "NAVIGATION(12),3026,Datapanel06-PTR,BTN,296,1,0,1,Datapanel Key 6", "FR22(31),3209,PNT_371,BTN,371,1,0,1,Channel D/E", "NAVIGATION(12),3016,NavselB6-PTR,BTN,276,1,0,1,Navigation Selector Button B6", "COUNTERMEASURE(28),3028,KBsel3-PTR,TUMB,322,0.1,0,0.2,Countermeasure Chaff/Flares Selector", "COUNTERMEASURE(28),3028,KBsel3-PTR,TUMB,322,-0.1,0,0.2,Countermeasure Chaff/Flares Selector", "ENGINEPANEL(18),3006,Abfuelvalve-PTR,TUMB,313,-1,0,1,Manual Afterburner Fuel Regulator", "ENGINEPANEL(18),3006,Abfuelvalve-PTR,TUMB,313,1,0,1,Manual Afterburner Fuel Regulator", "FR22(31),3219,PNT_381,BTN,381,1,0,1,Flight 9", "ENGINEPANEL(18),3003,TandS-PTR,TUMB,205,-1,0,1,Ignition System", "ENGINEPANEL(18),3003,TandS-PTR,TUMB,205,1,0,1,Ignition System", "WEAPON_SYSTEM(2),3302,WepEmRCvr-PTR,TUMB,260,0,0,1,Weapon Emergency Release Cover", "WEAPON_SYSTEM(2),3302,WepEmRCvr-PTR,TUMB,260,1,0,1,Weapon Emergency Release Cover", "FR22(31),3208,PNT_370,BTN,370,1,0,1,Channel C2", "ENGINEPANEL(18),3007,Manbreg-PTR,TUMB,316,-1,0,1,Manual Fuel Regulator", "ENGINEPANEL(18),3007,Manbreg-PTR,TUMB,316,1,0,1,Manual Fuel Regulator", "FR22(31),3218,PNT_380,BTN,380,1,0,1,Flight 8", "FR22(31),3206,PNT_368,BTN,368,1,0,1,Channel B", "NAVIGATION(12),3013,NavselB3-PTR,BTN,273,1,0,1,Navigation Selector Button B3", "FLIGHTDATAUNIT(22),3721,PNT_126,LEV,0,0.001,,,Backup Altimeter Setting", "ENGINEPANEL(18),3112,PNT_385,LEV,385,1e-05,,,Radio Volume", "ENGINEPANEL(18),3920,PNT_1203,TUMB,1203,-1,0,1,IFF/Transponder Power", "ENGINEPANEL(18),3920,PNT_1203,TUMB,1203,1,0,1,IFF/Transponder Power", "ENGINEPANEL(18),3907,PNT_304,TUMB,304,-1,0,1,CB Trim System", "ENGINEPANEL(18),3907,PNT_304,TUMB,304,1,0,1,CB Trim System", "ENGINEPANEL(18),3000,PNT_398,TUMB,398,0,0,1,Cabin Air Valve", "ENGINEPANEL(18),3000,PNT_398,TUMB,398,1,0,1,Cabin Air Valve", "REVERSAL(7),3001,Revhd-PTR,TUMB,20,0,0,1,Reverser Handle", "REVERSAL(7),3001,Revhd-PTR,TUMB,20,1,0,1,Reverser Handle", "WEAPON_SYSTEM(2),3307,Rb04tgt-PTR,TUMB,267,-1,0,1,RB-04/RB-15/BK Release Mode Switch - MALVAL/PREP", "WEAPON_SYSTEM(2),3307,Rb04tgt-PTR,TUMB,267,1,0,1,RB-04/RB-15/BK Release Mode Switch - MALVAL/PREP", "ENGINEPANEL(18),3913,PNT_675,LEV,675,0.001,,,Maintenance Testing Mode", "NAVIGATION(12),3029,Datapanel09-PTR,BTN,299,1,0,1,Datapanel Key 9", "FLIGHTDATAUNIT(22),3306,AltsetL-PTR,LEV,0,0.001,,,Altimeter Setting", "FLIGHTDATAUNIT(22),3511,TILSmodeswitch-PTR,TUMB,285,-1,0,1,TILS Channel Layer Selection", "FLIGHTDATAUNIT(22),3511,TILSmodeswitch-PTR,TUMB,285,1,0,1,TILS Channel Layer Selection", "ELECTRICSYSTEM(19),3001,HuvudS-PTR,TUMB,203,-1,0,1,Main Electric Power", "ELECTRICSYSTEM(19),3001,HuvudS-PTR,TUMB,203,1,0,1,Main Electric Power", "RADAR(5),3350,PNT_216,TUMB,216,-1,0,1,Passive Recce On/Off Switch", "RADAR(5),3350,PNT_216,TUMB,216,1,0,1,Passive Recce On/Off Switch", "FR22(31),3005,PNT_173,LEV,173,0,0,1,Radio Manual Frequency Setting Knob Inner Right", "LIGHTS(17),3007,PNT_393,LEV,393,0,1,,Flood Lights", "ENGINEPANEL(18),3304,PNT_13,TUMB,13,0,0,1,AFK Lever", "ENGINEPANEL(18),3304,PNT_13,TUMB,13,1,0,1,AFK Lever", "FLIGHTDATAUNIT(22),3716,PNT_390,TUMB,390,-1,-1,1,Emergency Roll Trim", "FLIGHTDATAUNIT(22),3716,PNT_390,TUMB,390,1,-1,1,Emergency Roll Trim", "NAVIGATION(12),3024,Datapanel04-PTR,BTN,294,1,0,1,Datapanel Key 4", "FLIGHTDATAUNIT(22),3407,PNT_210,BTN,210,1,0,1,Canopy Jettison", "FLIGHTDATAUNIT(22),3409,PNT_180,LEV,9999,1,1,,HUD Brightness Knob", "FR22(31),3213,PNT_375,BTN,375,1,0,1,Flight 3", "FR22(31),3202,PNT_364,BTN,364,1,0,1,Special 2", "FLIGHTDATAUNIT(22),3717,PNT_389,TUMB,389,-1,-1,1,Emergency Pitch Trim", "FLIGHTDATAUNIT(22),3717,PNT_389,TUMB,389,1,-1,1,Emergency Pitch Trim", "FLIGHTDATAUNIT(22),3210,Tippvax-PTR,TUMB,311,-1,0,1,Pitch Gear Automatic/Landing", "FLIGHTDATAUNIT(22),3210,Tippvax-PTR,TUMB,311,1,0,1,Pitch Gear Automatic/Landing", "RWR(24),3004,App27-PTR,TUMB,321,0.1,0,0.2,Radarwarning Indication Selector", "RWR(24),3004,App27-PTR,TUMB,321,-0.1,0,0.2,Radarwarning Indication Selector", "FLIGHTDATAUNIT(22),3720,PNT_123,BTN,-666,1,0,1,Backup ADI Cage", "LIGHTS(17),3005,PNT_254,TUMB,254,0.1,0,0.2,Position Lights Brightness", "LIGHTS(17),3005,PNT_254,TUMB,254,-0.1,0,0.2,Position Lights Brightness", "LIGHTS(17),3008,PNT_394,LEV,394,0,0,1,Instrument Lights", "FLIGHTDATAUNIT(22),3718,PNT_176,TUMB,176,-1,0,1,Oxygen Lever", "FLIGHTDATAUNIT(22),3718,PNT_176,TUMB,176,1,0,1,Oxygen Lever", "FR22(31),3207,PNT_369,BTN,369,1,0,1,Channel C/F", "FR22(31),3201,PNT_363,BTN,363,1,0,1,Special 1", "ENGINEPANEL(18),3008,Deice-PTR,TUMB,310,-1,0,1,Engine De-Ice", "ENGINEPANEL(18),3008,Deice-PTR,TUMB,310,1,0,1,Engine De-Ice", "ENGINEPANEL(18),3401,Aterstart-PTR,BTN,208,1,0,1,Restart", "LIGHTS(17),3006,PNT_392,LEV,392,0,0,1,Panel Lights", "FLIGHTDATAUNIT(22),3091,SnabbresM-PTR,BTN,0,1,0,1,Snabbresning", "NAVIGATION(12),3019,NavselB9-PTR,BTN,279,1,0,1,Navigation Selector Button B9", "COUNTERMEASURE(28),3027,KBsel2-PTR,TUMB,320,0.1,0,0.1,Countermeasure Streak Mode Selector", "COUNTERMEASURE(28),3027,KBsel2-PTR,TUMB,320,-0.1,0,0.1,Countermeasure Streak Mode Selector", "ERRORPANEL(26),3001,MasterC-PTR,TUMB,446,-1,0,1,Master Caution Reset", "ERRORPANEL(26),3001,MasterC-PTR,TUMB,446,1,0,1,Master Caution Reset", "RADAR(5),3923,PNT_391,LEV,391,0.001,,,Radar Brightness", "NAVIGATIONPANEL(23),3008,DatapanelINUT-PTR,TUMB,201,-1,0,1,IN/OUT Switch", "NAVIGATIONPANEL(23),3008,DatapanelINUT-PTR,TUMB,201,1,0,1,IN/OUT Switch", "FLIGHTDATAUNIT(22),3201,SlavSI-PTR,TUMB,323,-1,0,1,Slav SI", "FLIGHTDATAUNIT(22),3201,SlavSI-PTR,TUMB,323,1,0,1,Slav SI", "FLIGHTDATAUNIT(22),3741,PNT_493,TUMB,493,0,0,1,Autopilot Yaw Trim Cover", "FLIGHTDATAUNIT(22),3741,PNT_493,TUMB,493,1,0,1,Autopilot Yaw Trim Cover", "NAVIGATIONPANEL(23),3101,RENSACVR-PTR,TUMB,300,0,0,1,Rensa Button Cover", "NAVIGATIONPANEL(23),3101,RENSACVR-PTR,TUMB,300,1,0,1,Rensa Button Cover", "FLIGHTDATAUNIT(22),3107,Skede-PTR,TUMB,209,0.1666666667,0,1.0000000002,Master Mode Selector", "FLIGHTDATAUNIT(22),3107,Skede-PTR,TUMB,209,-0.1666666667,0,1.0000000002,Master Mode Selector", "LIGHTS(17),3009,PNT_3554,TUMB,3554,-1,0,1,Taxi/Landing Lights", "LIGHTS(17),3009,PNT_3554,TUMB,3554,1,0,1,Taxi/Landing Lights", "NAVIGATION(12),3018,NavselB8-PTR,BTN,278,1,0,1,Navigation Selector Button B8", "FLIGHTDATAUNIT(22),3408,PNT_22,TUMB,22,0,0,1,Parking Brake", "FLIGHTDATAUNIT(22),3408,PNT_22,TUMB,22,1,0,1,Parking Brake", "RADAR(5),3208,PNT_212,TUMB,217,0.1,0,0.7,Anti Jamming Mode (AS) Selector", "RADAR(5),3208,PNT_212,TUMB,217,-0.1,0,0.7,Anti Jamming Mode (AS) Selector", "FR22(31),3215,PNT_377,BTN,377,1,0,1,Flight 5", "LIGHTS(17),3001,Antikljus-PTR,TUMB,250,-1,0,1,Anti Collision Lights", "LIGHTS(17),3001,Antikljus-PTR,TUMB,250,1,0,1,Anti Collision Lights", "ENGINEPANEL(18),3906,PNT_303,TUMB,303,-1,0,1,CB High Alpha Warning", "ENGINEPANEL(18),3906,PNT_303,TUMB,303,1,0,1,CB High Alpha Warning", "ENGINEPANEL(18),3925,PNT_DATA,TUMB,4200,0,1,,Insert/Remove Data Cartridge", "ENGINEPANEL(18),3925,PNT_DATA,TUMB,4200,1,1,,Insert/Remove Data Cartridge", "WEAPON_SYSTEM(2),3402,XTCVR-PTR,TUMB,262,0,0,1,External Tank Release Cover", "WEAPON_SYSTEM(2),3402,XTCVR-PTR,TUMB,262,1,0,1,External Tank Release Cover", "FR22(31),3011,PNT_382,BTN,382,1,0,1,Ground Intercom", "FLIGHTDATAUNIT(22),3724,PNT_1201,LEV,-666,0.1,,,Magnetic Declination Correction", "COUNTERMEASURE(28),3024,U22sel1-PTR,TUMB,317,0.1,0,0.4,Jammer Operation Mode Selector", "COUNTERMEASURE(28),3024,U22sel1-PTR,TUMB,317,-0.1,0,0.4,Jammer Operation Mode Selector", "NAVIGATION(12),3022,Datapanel02-PTR,BTN,292,1,0,1,Datapanel Key 2", "WEAPON_SYSTEM(2),3320,XTREL-PTR,BTN,263,1,0,1,External Tank Release Button", "NAVIGATION(12),3011,NavselB1-PTR,BTN,271,1,0,1,Navigation Selector Button B1", "ENGINEPANEL(18),3909,PNT_306,TUMB,306,-1,0,1,CB Ejection System", "ENGINEPANEL(18),3909,PNT_306,TUMB,306,1,0,1,CB Ejection System", "COUNTERMEASURE(28),3805,PNT_CMEASURES,TUMB,-666,1,-1,1,Countermeasure Dispense", "COUNTERMEASURE(28),3805,PNT_CMEASURES,TUMB,-666,-1,-1,1,Countermeasure Dispense", "FR22(31),3211,PNT_373,BTN,373,1,0,1,Flight 1"],
-    "AV8BNA": ["MPCD_LEFT(26),3213,PTN_213,BTN,213,1,0,1,MPCD Left Button 14", "MPCD_RIGHT(27),3247,PTN_247,BTN,247,-1,-1,0,MPCD Right Display Contrast", "MPCD_RIGHT(27),3247,PTN_247,BTN,247,1,0,1,MPCD Right Display Contrast", "MPCD_RIGHT(27),3242,PTN_242,BTN,242,1,0,1,MPCD Right Button 19", "RSC(7),3620,PTN_620,BTN,620,1,0,1,V/UHF RSC LOAD/OFST Switch", "MPCD_RIGHT(27),3224,PTN_224,BTN,224,1,0,1,MPCD Right Button 1", "MPCD_RIGHT(27),3225,PTN_225,BTN,225,1,0,1,MPCD Right Button 2", "MPCD_RIGHT(27),3228,PTN_228,BTN,228,1,0,1,MPCD Right Button 5", "MPCD_RIGHT(27),3227,PTN_227,BTN,227,1,0,1,MPCD Right Button 4", "FLIGHTCONTROLS(28),3470,PTN_470,TUMB,470,0,0,1,Landing Gear Emergency Battery Lever", "FLIGHTCONTROLS(28),3470,PTN_470,TUMB,470,1,0,1,Landing Gear Emergency Battery Lever", "UFCCONTROL(23),3297,PTN_297,BTN,297,1,0,1,I/P Button", "FLIGHTCONTROLS(28),3801,PTN_801,TUMB,801,-1,0,1,Canopy Handle", "FLIGHTCONTROLS(28),3801,PTN_801,TUMB,801,1,0,1,Canopy Handle", "UFCCONTROL(23),3307,PTN_307,BTN,307,1,0,1,UFC Button 5", "DECS(9),3490,PTN_490,TUMB,490,0,0,1,Throttle Cutoff Lever", "DECS(9),3490,PTN_490,TUMB,490,1,0,1,Throttle Cutoff Lever", "UFCCONTROL(23),3316,PTN_316,BTN,316,1,0,1,UFC Button .", "MPCD_RIGHT(27),3236,PTN_236,BTN,236,1,0,1,MPCD Right Button 13", "SMC(29),3402,PTN_402,BTN,402,-1,-1,0,Release Interval Control (Tens)", "SMC(29),3402,PTN_402,BTN,402,1,0,1,Release Interval Control (Tens)", "ODUCONTROL(24),3250,PTN_250,BTN,250,1,0,1,ODU Option 1", "SMC(29),3397,PTN_397,BTN,397,-1,-1,0,Fuzing Control", "SMC(29),3397,PTN_397,BTN,397,1,0,1,Fuzing Control", "SMC(29),3403,PTN_403,BTN,403,-1,-1,0,Release Interval Control (Units)", "SMC(29),3403,PTN_403,BTN,403,1,0,1,Release Interval Control (Units)", "HUDCONTROL(22),3291,PTN_291,LEV,291,0,0,1,HUD Video Brightness Control", "DECS(9),3509,PTN_509,TUMB,509,-1,0,1,Fuel Dump R Switch", "DECS(9),3509,PTN_509,TUMB,509,1,0,1,Fuel Dump R Switch", "UFCCONTROL(23),3296,PTN_296,BTN,296,1,0,1,Target-Of-Opportunity Selector", "MPCD_LEFT(26),3217,PTN_217,BTN,217,1,0,1,MPCD Left Button 18", "FLIGHTCONTROLS(28),3480,PTN_480,TUMB,480,-1,0,1,SAS Pitch Switch", "FLIGHTCONTROLS(28),3480,PTN_480,TUMB,480,1,0,1,SAS Pitch Switch", "SMC(29),3399,PTN_399,BTN,399,-1,-1,0,Quantity Selector (Units)", "SMC(29),3399,PTN_399,BTN,399,1,0,1,Quantity Selector (Units)", "LTINT(34),3155,PTN_155,LEV,155,0,-1,1,Flood Lamp", "SMC(29),3417,PTN_417,BTN,417,1,0,1,Select Station 6 Toggle", "FLIGHTCONTROLS(28),3471,PTN_471,TUMB,471,0.5,0,1,RPS/YAW Trim Switch", "FLIGHTCONTROLS(28),3471,PTN_471,TUMB,471,-0.5,0,1,RPS/YAW Trim Switch", "UFCCONTROL(23),3306,PTN_306,BTN,306,1,0,1,UFC Button 4/W", "UFCCONTROL(23),3319,PTN_319,BTN,319,1,0,1,TACAN Function Selector", "EWS(30),3274,PTN_274,TUMB,274,0.25,0,1,Decoy Dispenser Control", "EWS(30),3274,PTN_274,TUMB,274,-0.25,0,1,Decoy Dispenser Control", "EWS(30),3275,PTN_275,TUMB,275,0.25,0,1,Jammer Control", "EWS(30),3275,PTN_275,TUMB,275,-0.25,0,1,Jammer Control", "EDP(20),3655,PTN_655,TUMB,655,-1,0,1,EDP BIT Button", "EDP(20),3655,PTN_655,TUMB,655,1,0,1,EDP BIT Button", "MPCD_RIGHT(27),3241,PTN_241,BTN,241,1,0,1,MPCD Right Button 18", "ODUCONTROL(24),3251,PTN_251,BTN,251,1,0,1,ODU Option 2", "VREST(13),3454,PTN_454,TUMB,454,0.5,0,1,Flaps Mode Switch", "VREST(13),3454,PTN_454,TUMB,454,-0.5,0,1,Flaps Mode Switch", "MPCD_RIGHT(27),3195,PTN_195,LEV,195,0,0,1,MPCD Right Off/Brightness Control", "VREST(13),3457,PTN_457,TUMB,457,0.5,0,1,Flaps Power Switch", "VREST(13),3457,PTN_457,TUMB,457,-0.5,0,1,Flaps Power Switch", "UFCCONTROL(23),3317,PTN_317,BTN,317,1,0,1,Radalt/TACAN/AWL/IFF ON/OFF Toggle", "RSC(7),3614,PTN_614,LEV,614,0,0,1,V/UHF RSC Volume Knob", "LTEXT(33),3512,PTN_512,TUMB,512,-1,0,1,Anti-Collision Lights Switch", "LTEXT(33),3512,PTN_512,TUMB,512,1,0,1,Anti-Collision Lights Switch", "DECS(9),3449,PTN_449,TUMB,449,0.5,0,1,H2O Mode Switch", "DECS(9),3449,PTN_449,TUMB,449,-0.5,0,1,H2O Mode Switch", "MPCD_LEFT(26),3200,PTN_200,BTN,200,1,0,1,MPCD Left Button 1", "UFCCONTROL(23),3325,PTN_325,BTN,325,1,0,1,EMCON ON/OFF Toggle", "ELECTRIC(1),3611,PTN_611,TUMB,611,-1,0,1,Engine Start Switch", "ELECTRIC(1),3611,PTN_611,TUMB,611,1,0,1,Engine Start Switch", "SMC(29),3398,PTN_398,BTN,398,-1,-1,0,Quantity Selector (Tens)", "SMC(29),3398,PTN_398,BTN,398,1,0,1,Quantity Selector (Tens)", "ODUCONTROL(24),3252,PTN_252,BTN,252,1,0,1,ODU Option 3", "MPCD_LEFT(26),3203,PTN_203,BTN,203,1,0,1,MPCD Left Button 4", "LTEXT(33),3503,PTN_503,TUMB,503,0.5,0,1,External Lights Mode Switch", "LTEXT(33),3503,PTN_503,TUMB,503,-0.5,0,1,External Lights Mode Switch", "MSC(12),3800,PTN_800,TUMB,800,-1,0,1,Seat Ground Safety Lever", "MSC(12),3800,PTN_800,TUMB,800,1,0,1,Seat Ground Safety Lever", "MSC(12),3284,PTN_284,BTN,284,1,0,1,VSTOL Master Mode Selector", "MPCD_RIGHT(27),3243,PTN_243,BTN,243,1,0,1,MPCD Right Button 20", "DECS(9),3508,PTN_508,TUMB,508,-1,0,1,Fuel Dump L Switch", "DECS(9),3508,PTN_508,TUMB,508,1,0,1,Fuel Dump L Switch", "HUDCONTROL(22),3290,PTN_290,TUMB,290,0.5,0,1,HUD Display Mode Switch", "HUDCONTROL(22),3290,PTN_290,TUMB,290,-0.5,0,1,HUD Display Mode Switch", "HUDCONTROL(22),3288,PTN_288,TUMB,288,-0.5,0,1,HUD Symbology Reject Switch", "HUDCONTROL(22),3288,PTN_288,TUMB,288,0.5,0,1,HUD Symbology Reject Switch", "UFCCONTROL(23),3302,PTN_302,BTN,302,1,0,1,UFC Button 1", "RSC(7),3617,PTN_617,BTN,617,1,0,1,V/UHF RSC Ancillary Mode Pointer", "DECS(9),3482,PTN_482,BTN,482,1,0,1,EMS Button", "NAVFLIR(14),3423,PTN_423,TUMB,423,-1,0,1,Video Recorder System Display Selector Switch", "NAVFLIR(14),3423,PTN_423,TUMB,423,1,0,1,Video Recorder System Display Selector Switch", "SMC(29),3420,PTN_420,TUMB,420,-1,0,1,Ground IR Cool Switch", "SMC(29),3420,PTN_420,TUMB,420,1,0,1,Ground IR Cool Switch", "UFCCONTROL(23),3315,PTN_315,BTN,315,1,0,1,UFC Button 0", "SMC(29),3458,PTN_458,BTN,458,1,0,1,Emergency Jettison Button", "LTEXT(33),3472,PTN_472,TUMB,472,0.5,0,1,Landing/Taxi Lights Switch", "LTEXT(33),3472,PTN_472,TUMB,472,-0.5,0,1,Landing/Taxi Lights Switch", "MPCD_LEFT(26),3216,PTN_216,BTN,216,1,0,1,MPCD Left Button 17", "UFCCONTROL(23),3295,PTN_295,LEV,295,0,0,1,Display Brightness Control", "UFCCONTROL(23),3301,PTN_301,LEV,301,0,0,1,Comm 2 Channel Selector", "UFCCONTROL(23),3179,PTN_301,BTN,179,1,0,1,Comm 2 Channel Selector", "MPCD_RIGHT(27),3229,PTN_229,BTN,229,1,0,1,MPCD Right Button 6", "FLIGHTCONTROLS(28),3475,PTN_475,TUMB,475,-1,0,1,Q Feel Switch", "FLIGHTCONTROLS(28),3475,PTN_475,TUMB,475,1,0,1,Q Feel Switch", "FLIGHTCONTROLS(28),3477,PTN_477,TUMB,477,0.5,0,1,AFC Switch", "FLIGHTCONTROLS(28),3477,PTN_477,TUMB,477,-0.5,0,1,AFC Switch", "MPCD_LEFT(26),3210,PTN_210,BTN,210,1,0,1,MPCD Left Button 11", "MPCD_RIGHT(27),3233,PTN_233,BTN,233,1,0,1,MPCD Right Button 10", "RWRCONTROL(18),3273,PTN_273,LEV,273,0,0,1,RWR Power/Volume Button", "LTINT(34),3636,PTN_636,LEV,636,0,0,1,Console Lights", "FLIGHTCONTROLS(28),3479,PTN_479,TUMB,479,-1,0,1,SAS Roll Switch", "FLIGHTCONTROLS(28),3479,PTN_479,TUMB,479,1,0,1,SAS Roll Switch", "LTINT(34),3637,PTN_637,LEV,637,0,0,1,Flood Lights", "DECS(9),3481,PTN_481,TUMB,481,-1,0,1,JPTL Switch", "DECS(9),3481,PTN_481,TUMB,481,1,0,1,JPTL Switch", "FLIGHTCONTROLS(28),3483,PTN_483,BTN,483,1,-1,0,Rudder Trim Switch", "FLIGHTCONTROLS(28),3483,PTN_483,BTN,483,-1,0,1,Rudder Trim Switch", "NAVFLIR(14),3422,PTN_422,TUMB,422,-1,0,1,Video Recorder System Mode Switch", "NAVFLIR(14),3422,PTN_422,TUMB,422,1,0,1,Video Recorder System Mode Switch", "NAVFLIR(14),3429,PTN_429,TUMB,429,-1,0,1,FLIR Power Switch", "NAVFLIR(14),3429,PTN_429,TUMB,429,1,0,1,FLIR Power Switch", "SMC(29),3395,PTN_395,TUMB,395,0.33,0,0.99,Manual Release Control Knob", "SMC(29),3395,PTN_395,TUMB,395,-0.33,0,0.99,Manual Release Control Knob", "MSC(12),3282,PTN_282,BTN,282,1,0,1,NAV Master Mode Selector", "SMC(29),3396,PTN_396,BTN,396,-1,-1,0,Armament Mode Control", "SMC(29),3396,PTN_396,BTN,396,1,0,1,Armament Mode Control", "ACNIP(8),3621,PTN_621,TUMB,621,-1,0,1,ACNIP Mode Switch", "ACNIP(8),3621,PTN_621,TUMB,621,1,0,1,ACNIP Mode Switch", "FLIGHTCONTROLS(28),,PTN_485,LEV,485,0,0,1,Throttle Lever Friction Knob", "UFCCONTROL(23),3294,PTN_294,BTN,294,1,0,1,Timer Function Selector", "UFCCONTROL(23),3303,PTN_303,BTN,303,1,0,1,UFC Button 2/N", "UFCCONTROL(23),3305,PTN_305,BTN,305,1,0,1,Clear Entry Button", "MPCD_LEFT(26),3194,PTN_194,LEV,194,0,0,1,MPCD Left Off/Brightness Control", "FLIGHTCONTROLS(28),,PTN_486,LEV,486,0,0,1,Nozzle Lever Friction Knob", "SMC(29),3409,PTN_409,BTN,409,1,0,1,Select Station 2 Toggle", "MPCD_RIGHT(27),3234,PTN_234,BTN,234,1,0,1,MPCD Right Button 11", "HUDCONTROL(22),3293,PTN_293,TUMB,293,-1,0,1,HUD Altitude Selector Switch", "HUDCONTROL(22),3293,PTN_293,TUMB,293,1,0,1,HUD Altitude Selector Switch", "MPCD_LEFT(26),3209,PTN_209,BTN,209,1,0,1,MPCD Left Button 10", "VREST(13),3460,PTN_460,BTN,460,1,0,1,Flaps BIT Button", "UFCCONTROL(23),3300,PTN_300,LEV,300,0,0,1,Comm 1 Channel Selector", "UFCCONTROL(23),3178,PTN_300,BTN,178,1,0,1,Comm 1 Channel Selector", "UFCCONTROL(23),3312,PTN_312,BTN,312,1,0,1,UFC Button 9", "FQIS(21),3380,PTN_380,LEV,380,0,0,1,Bingo Fuel Set Knob", "FLIGHTCONTROLS(28),3489,PTN_489,TUMB,489,0,0,1,Parking Brake Lever", "FLIGHTCONTROLS(28),3489,PTN_489,TUMB,489,1,0,1,Parking Brake Lever", "MPCD_RIGHT(27),3230,PTN_230,BTN,230,1,0,1,MPCD Right Button 7", "EDP(20),3272,PTN_272,LEV,272,0,0,1,EDP Brightness Control", "DECS(9),3504,PTN_504,TUMB,504,-1,0,1,Fuel Proportioner", "DECS(9),3504,PTN_504,TUMB,504,1,0,1,Fuel Proportioner", "FLIGHTINSTRUMENTS(19),3351,PTN_351,LEV,351,0,-1,1,Backup ADI Cage/Pitch Adjust Knob", "FLIGHTINSTRUMENTS(19),3350,PTN_351,BTN,350,1,0,1,Backup ADI Cage/Pitch Adjust Knob", "FQIS(21),3379,PTN_379,TUMB,379,0.33,-0.99,0.99,Fuel Totalizer Selector", "FQIS(21),3379,PTN_379,TUMB,379,-0.33,-0.99,0.99,Fuel Totalizer Selector", "DECS(9),3505,PTN_505,TUMB,505,0.5,0,1,Fuel Pump L Switch", "DECS(9),3505,PTN_505,TUMB,505,-0.5,0,1,Fuel Pump L Switch", "UFCCONTROL(23),3321,PTN_321,BTN,321,1,0,1,Weapons Function Selector", "DECS(9),3507,PTN_507,TUMB,507,0.5,0,1,Air Refueling Probe Switch", "DECS(9),3507,PTN_507,TUMB,507,-0.5,0,1,Air Refueling Probe Switch", "NAV_INS(11),3364,PTN_364,LEV,364,1,0,1,NAV Course Setting",
-        "SMC(29),3405,PTN_405,BTN,405,1,0,1,Jettison Stores", "MSC(12),4121,PTN_1121,BTN,1121,1,0,1,Stopwatch Start/Stop", "LTEXT(33),3510,PTN_510,LEV,510,0,0,1,Formation Lights Knob", "FLIGHTCONTROLS(28),3447,PTN_447,TUMB,447,0,0,1,Emergency Landing Gear Lever", "FLIGHTCONTROLS(28),3447,PTN_447,TUMB,447,1,0,1,Emergency Landing Gear Lever", "MSC(12),3425,PTN_425,TUMB,425,0.5,0,1,Display Computer Mode Selector Switch", "MSC(12),3425,PTN_425,TUMB,425,-0.5,0,1,Display Computer Mode Selector Switch", "MSC(12),3427,PTN_427,TUMB,427,0.5,0,1,Mission Computer Mode Switch", "MSC(12),3427,PTN_427,TUMB,427,-0.5,0,1,Mission Computer Mode Switch", "LTEXT(33),3511,PTN_511,TUMB,511,0.5,0,1,Position Lights Switch", "LTEXT(33),3511,PTN_511,TUMB,511,-0.5,0,1,Position Lights Switch", "HUDCONTROL(22),3289,PTN_289,LEV,289,0,0,1,HUD Off/Brightness Control", "LTEXT(33),3513,PTN_513,TUMB,513,-1,0,1,External Auxiliary Lights Switch", "LTEXT(33),3513,PTN_513,TUMB,513,1,0,1,External Auxiliary Lights Switch", "ECS(36),3514,PTN_514,TUMB,514,-1,0,1,Oxygen Switch", "ECS(36),3514,PTN_514,TUMB,514,1,0,1,Oxygen Switch", "ACNIP(8),3622,PTN_622,TUMB,622,-1,0,1,KY-1 Cipher Type Selector Switch", "ACNIP(8),3622,PTN_622,TUMB,622,1,0,1,KY-1 Cipher Type Selector Switch", "DECS(9),3517,PTN_517,TUMB,517,-1,0,1,ENG RPM Switch", "DECS(9),3517,PTN_517,TUMB,517,1,0,1,ENG RPM Switch", "DECS(9),3518,PTN_518,TUMB,518,-1,0,1,EFC Switch", "DECS(9),3518,PTN_518,TUMB,518,1,0,1,EFC Switch", "MPCD_LEFT(26),3212,PTN_212,BTN,212,1,0,1,MPCD Left Button 13", "MSC(12),3502,PTN_502,BTN,502,1,-1,0,Seat Adjustment Switch", "MSC(12),3502,PTN_502,BTN,502,-1,0,1,Seat Adjustment Switch", "DECS(9),3519,PTN_519,TUMB,519,-1,0,1,Fuel Shutoff Lever", "DECS(9),3519,PTN_519,TUMB,519,1,0,1,Fuel Shutoff Lever", "UFCCONTROL(23),3320,PTN_320,BTN,320,1,0,1,All Weather Landing Function Selector", "DECS(9),3520,PTN_520,TUMB,520,-1,0,1,DECS Switch", "DECS(9),3520,PTN_520,TUMB,520,1,0,1,DECS Switch", "MPCD_LEFT(26),3207,PTN_207,BTN,207,1,0,1,MPCD Left Button 8", "UFCCONTROL(23),3314,PTN_314,BTN,314,1,0,1,ENTER Data Button", "MPCD_LEFT(26),3219,PTN_219,BTN,219,1,0,1,MPCD Left Button 20", "ELECTRIC(1),3609,PTN_609,TUMB,609,0.5,0,1,DC Test Switch", "ELECTRIC(1),3609,PTN_609,TUMB,609,-0.5,0,1,DC Test Switch", "ELECTRIC(1),3610,PTN_610,TUMB,610,0.5,0,1,APU Generator Switch", "ELECTRIC(1),3610,PTN_610,TUMB,610,-0.5,0,1,APU Generator Switch", "DECS(9),3450,PTN_450,BTN,450,1,0,1,CMBT Thrust Button", "EWS(30),3286,PTN_286,BTN,286,1,0,1,Launch Flare Salvo", "ELECTRIC(1),3613,PTN_613,TUMB,613,0.5,0,1,Battery Switch", "ELECTRIC(1),3613,PTN_613,TUMB,613,-0.5,0,1,Battery Switch", "DECS(9),3506,PTN_506,TUMB,506,0.5,0,1,Fuel Pump R Switch", "DECS(9),3506,PTN_506,TUMB,506,-0.5,0,1,Fuel Pump R Switch", "VREST(13),3487,PTN_487,LEV,487,0,1,,Nozzle Control Lever", "INTERCOM(4),3631,PTN_631,TUMB,631,0.5,0,1,ICS Mic Operational Mode Switch", "INTERCOM(4),3631,PTN_631,TUMB,631,-0.5,0,1,ICS Mic Operational Mode Switch", "RSC(7),3615,PTN_615,LEV,615,0,0,1,V/UHF RSC Chan/Freq Knob", "RSC(7),3616,PTN_616,TUMB,616,0.2,-0.2,1,V/UHF RSC Operational Mode Switch", "RSC(7),3616,PTN_616,TUMB,616,-0.2,-0.2,1,V/UHF RSC Operational Mode Switch", "MPCD_RIGHT(27),3239,PTN_239,BTN,239,1,0,1,MPCD Right Button 16", "HUDCONTROL(22),3292,PTN_292,LEV,292,0,0,1,HUD Video Contrast Control", "MPCD_RIGHT(27),3244,PTN_244,BTN,244,-1,-1,0,MPCD Right Display DAY/NIGHT Mode", "MPCD_RIGHT(27),3244,PTN_244,BTN,244,1,0,1,MPCD Right Display DAY/NIGHT Mode", "NAV_INS(11),3421,PTN_421,TUMB,421,0.1,0,0.7,INS Mode Knob", "NAV_INS(11),3421,PTN_421,TUMB,421,-0.1,0,0.7,INS Mode Knob", "ADC(10),3653,PTN_653,LEV,653,1,0,1,Barometric Pressure Calibration", "FLIGHTCONTROLS(28),3461,PTN_461,TUMB,461,0,0,1,Landing Gear Lever", "FLIGHTCONTROLS(28),3461,PTN_461,TUMB,461,1,0,1,Landing Gear Lever", "RSC(7),3619,PTN_619,TUMB,619,0.15,0,1.05,V/UHF RSC Frequency Mode Switch", "RSC(7),3619,PTN_619,TUMB,619,-0.15,0,1.05,V/UHF RSC Frequency Mode Switch", "SMC(29),3413,PTN_413,BTN,413,1,0,1,Select Station 4 Toggle", "MPCD_LEFT(26),3222,PTN_222,BTN,222,-1,-1,0,MPCD Left Display Gain", "MPCD_LEFT(26),3222,PTN_222,BTN,222,1,0,1,MPCD Left Display Gain", "DECS(9),3484,PTN_484,TUMB,484,-1,0,1,Manual Fuel Switch", "DECS(9),3484,PTN_484,TUMB,484,1,0,1,Manual Fuel Switch", "MPCD_RIGHT(27),3232,PTN_232,BTN,232,1,0,1,MPCD Right Button 9", "ACNIP(8),3628,PTN_628,TUMB,628,1,-1,1,KY-58 Remote Codes Load Switch", "ACNIP(8),3628,PTN_628,TUMB,628,-1,-1,1,KY-58 Remote Codes Load Switch", "MPCD_RIGHT(27),3246,PTN_246,BTN,246,-1,-1,0,MPCD Right Display Gain", "MPCD_RIGHT(27),3246,PTN_246,BTN,246,1,0,1,MPCD Right Display Gain", "ODUCONTROL(24),3248,PTN_248,BTN,248,1,0,1,ODU Option 4", "UFCCONTROL(23),3298,PTN_298,LEV,298,0,0,1,Comm 1 Volume Control", "ACNIP(8),3624,PTN_624,TUMB,624,-1,0,1,KY-1 Code/Mode Switch", "ACNIP(8),3624,PTN_624,TUMB,624,1,0,1,KY-1 Code/Mode Switch", "ACNIP(8),3625,PTN_625,TUMB,625,-1,0,1,KY-2 Code/Mode Switch", "ACNIP(8),3625,PTN_625,TUMB,625,1,0,1,KY-2 Code/Mode Switch", "ACNIP(8),3627,PTN_627,TUMB,627,-1,0,1,KY-58 Codes Clear Switch", "ACNIP(8),3627,PTN_627,TUMB,627,1,0,1,KY-58 Codes Clear Switch", "VREST(13),3516,PTN_516,TUMB,516,-1,0,1,LIDS Switch", "VREST(13),3516,PTN_516,TUMB,516,1,0,1,LIDS Switch", "INTERCOM(4),3629,PTN_629,LEV,629,0,0,1,ICS Aux Volume Knob", "INTERCOM(4),3630,PTN_630,LEV,630,0,0,1,ICS Ground Volume Knob", "FLIGHTCONTROLS(28),3459,PTN_459,TUMB,459,0.5,0,1,Anti-Skid Switch", "FLIGHTCONTROLS(28),3459,PTN_459,TUMB,459,-0.5,0,1,Anti-Skid Switch", "MPCD_LEFT(26),3218,PTN_218,BTN,218,1,0,1,MPCD Left Button 19", "UFCCONTROL(23),3309,PTN_309,BTN,309,1,0,1,Save Data Button", "ACNIP(8),3632,PTN_632,TUMB,632,-1,0,1,IFF Operational Mode Switch", "ACNIP(8),3632,PTN_632,TUMB,632,1,0,1,IFF Operational Mode Switch", "VREST(13),3488,PTN_488,LEV,488,0,1,,STO Stop Lever", "LTINT(34),3634,PTN_634,BTN,634,1,0,1,Compass Light/Test Lights", "LTINT(34),3634,PTN_634,TUMB,634,-1,-1,0,Compass Light/Test Lights", "FLIGHTCONTROLS(28),3478,PTN_478,TUMB,478,-1,0,1,SAS Yaw Switch", "FLIGHTCONTROLS(28),3478,PTN_478,TUMB,478,1,0,1,SAS Yaw Switch", "MPCD_LEFT(26),3205,PTN_205,BTN,205,1,0,1,MPCD Left Button 6", "SMC(29),3411,PTN_411,BTN,411,1,0,1,Select Station 3 Toggle", "MSC(12),4122,PTN_1122,BTN,1122,1,0,1,Stopwatch Lap/Reset", "LTINT(34),3638,PTN_638,LEV,638,0,0,0.9,Annunciator Lights", "MPCD_RIGHT(27),3238,PTN_238,BTN,238,1,0,1,MPCD Right Button 15", "ECS(36),3639,PTN_639,LEV,639,0,0,1,Temperature Control Knob", "ECS(36),3641,PTN_641,TUMB,641,0.5,0,1,Cabin Defog Switch", "ECS(36),3641,PTN_641,TUMB,641,-0.5,0,1,Cabin Defog Switch", "FLIGHTCONTROLS(28),3476,PTN_476,TUMB,476,-1,0,1,Alt Hold Switch", "FLIGHTCONTROLS(28),3476,PTN_476,TUMB,476,1,0,1,Alt Hold Switch", "ECS(36),3642,PTN_642,TUMB,642,0.5,0,1,Aft Equipment Bay ECS Switch", "ECS(36),3642,PTN_642,TUMB,642,-0.5,0,1,Aft Equipment Bay ECS Switch", "UFCCONTROL(23),3311,PTN_311,BTN,311,1,0,1,UFC Button 8/S", "ECS(36),3643,PTN_643,TUMB,643,0.5,0,1,Cabin Pressure Switch", "ECS(36),3643,PTN_643,TUMB,643,-0.5,0,1,Cabin Pressure Switch", "UFCCONTROL(23),3324,PTN_324,BTN,324,1,0,1,Altitude Function Selector", "LTINT(34),3150,PTN_150,LEV,150,0,-1,1,Flood Lamp", "ACNIP(8),3633,PTN_633,TUMB,633,1,-1,1,IFF Crypto Mode Switch", "ACNIP(8),3633,PTN_633,TUMB,633,-1,-1,1,IFF Crypto Mode Switch", "MSC(12),3280,PTN_280,BTN,280,1,0,1,AG Master Mode Selector", "LTINT(34),3151,PTN_151,LEV,151,0,-1,1,Flood Lamp", "MPCD_LEFT(26),3215,PTN_215,BTN,215,1,0,1,MPCD Left Button 16", "MPCD_LEFT(26),3204,PTN_204,BTN,204,1,0,1,MPCD Left Button 5", "MPCD_RIGHT(27),3226,PTN_226,BTN,226,1,0,1,MPCD Right Button 3", "FLIGHTCONTROLS(28),,PTN_501,TUMB,501,0,0,1,MFS Emergency Lever", "FLIGHTCONTROLS(28),,PTN_501,TUMB,501,1,0,1,MFS Emergency Lever", "LTINT(34),3152,PTN_152,LEV,152,0,-1,1,Flood Lamp", "LTINT(34),3153,PTN_153,LEV,153,0,-1,1,Flood Lamp", "ACNIP(8),3623,PTN_623,TUMB,623,-1,0,1,KY-2 Cipher Type Selector Switch", "ACNIP(8),3623,PTN_623,TUMB,623,1,0,1,KY-2 Cipher Type Selector Switch", "SMC(29),3400,PTN_400,BTN,400,-1,-1,0,Multiple Release Control", "SMC(29),3400,PTN_400,BTN,400,1,0,1,Multiple Release Control", "LTINT(34),3154,PTN_154,LEV,154,0,-1,1,Flood Lamp", "SMC(29),3415,PTN_415,BTN,415,1,0,1,Select Station 5 Toggle", "MPCD_LEFT(26),3223,PTN_223,BTN,223,-1,-1,0,MPCD Left Display Contrast", "MPCD_LEFT(26),3223,PTN_223,BTN,223,1,0,1,MPCD Left Display Contrast", "LTINT(34),3156,PTN_156,LEV,156,0,-1,1,Flood Lamp", "LTINT(34),3157,PTN_157,LEV,157,0,-1,1,Flood Lamp", "ECS(36),3640,PTN_640,BTN,640,-1,-1,0,Fwd Equipment Bay ECS Switch", "ECS(36),3640,PTN_640,BTN,640,1,0,1,Fwd Equipment Bay ECS Switch", "LTINT(34),3158,PTN_158,LEV,158,0,-1,1,Flood Lamp", "LTINT(34),3159,PTN_159,LEV,159,0,-1,1,Flood Lamp", "MPCD_LEFT(26),3202,PTN_202,BTN,202,1,0,1,MPCD Left Button 3", "FLIGHTCONTROLS(28),3803,PTN_803,TUMB,803,-1,0,1,Canopy Locking Lever", "FLIGHTCONTROLS(28),3803,PTN_803,TUMB,803,1,0,1,Canopy Locking Lever", "ODUCONTROL(24),3249,PTN_249,BTN,249,1,0,1,ODU Option 5", "UFCCONTROL(23),3308,PTN_308,BTN,308,1,0,1,UFC Button 6/E", "MPCD_LEFT(26),3206,PTN_206,BTN,206,1,0,1,MPCD Left Button 7", "MPCD_RIGHT(27),3237,PTN_237,BTN,237,1,0,1,MPCD Right Button 14", "MPCD_RIGHT(27),3240,PTN_240,BTN,240,1,0,1,MPCD Right Button 17", "MPCD_LEFT(26),3211,PTN_211,BTN,211,1,0,1,MPCD Left Button 12", "MPCD_RIGHT(27),3231,PTN_231,BTN,231,1,0,1,MPCD Right Button 8", "ACNIP(8),3626,PTN_626,TUMB,626,-1,0,1,ACNIP Radio Selector Switch", "ACNIP(8),3626,PTN_626,TUMB,626,1,0,1,ACNIP Radio Selector Switch", "UFCCONTROL(23),3310,PTN_310,BTN,310,1,0,1,UFC Button 7", "MPCD_LEFT(26),3214,PTN_214,BTN,214,1,0,1,MPCD Left Button 15", "SMC(29),3404,PTN_404,TUMB,404,0.5,-1,1,Jettison Mode Selector", "SMC(29),3404,PTN_404,TUMB,404,-0.5,-1,1,Jettison Mode Selector", "SMC(29),3287,PTN_287,TUMB,287,-1,0,1,Master Arm Switch", "SMC(29),3287,PTN_287,TUMB,287,1,0,1,Master Arm Switch", "LTWCA(35),3198,PTN_198,BTN,198,1,0,1,Master Caution", "LTINT(34),3635,PTN_635,LEV,635,0,0,1,Instruments Lights", "FLIGHTCONTROLS(28),3448,PTN_448,BTN,448,1,0,1,Gear Down Lock Override Button", "DMT(16),3424,PTN_424,TUMB,424,-1,0,1,DMT Toggle On/Off",
-        "DMT(16),3424,PTN_424,TUMB,424,1,0,1,DMT Toggle On/Off", "DECS(9),3515,PTN_515,TUMB,515,-1,0,1,H2O Dump Switch", "DECS(9),3515,PTN_515,TUMB,515,1,0,1,H2O Dump Switch", "RSC(7),3618,PTN_618,BTN,618,1,0,1,V/UHF RSC Ancillary Mode Switch", "UFCCONTROL(23),3323,PTN_323,BTN,323,1,0,1,Radar Beacon Function Selector", "UFCCONTROL(23),3304,PTN_304,BTN,304,1,0,1,UFC Button 3", "UFCCONTROL(23),3318,PTN_318,BTN,318,1,0,1,IFF Function Selector", "MPCD_RIGHT(27),3245,PTN_245,BTN,245,-1,-1,0,MPCD Right Display Symbology", "MPCD_RIGHT(27),3245,PTN_245,BTN,245,1,0,1,MPCD Right Display Symbology", "FLIGHTINSTRUMENTS(19),3426,PTN_426,TUMB,426,-1,0,1,Probe Heat Mode Switch", "FLIGHTINSTRUMENTS(19),3426,PTN_426,TUMB,426,1,0,1,Probe Heat Mode Switch", "MPCD_LEFT(26),3220,PTN_220,BTN,220,-1,-1,0,MPCD Left Display DAY/NIGHT Mode", "MPCD_LEFT(26),3220,PTN_220,BTN,220,1,0,1,MPCD Left Display DAY/NIGHT Mode", "FLIGHTCONTROLS(28),3802,PTN_802,TUMB,802,-1,0,1,Canopy Handle", "FLIGHTCONTROLS(28),3802,PTN_802,TUMB,802,1,0,1,Canopy Handle", "SMC(29),3419,PTN_419,BTN,419,1,0,1,Select Station 7 Toggle", "MPCD_LEFT(26),3208,PTN_208,BTN,208,1,0,1,MPCD Left Button 9", "UFCCONTROL(23),3313,PTN_313,BTN,313,1,0,1,UFC Button -", "MPCD_LEFT(26),3201,PTN_201,BTN,201,1,0,1,MPCD Left Button 2", "SMC(29),3407,PTN_407,BTN,407,1,0,1,Select Station 1 Toggle", "UFCCONTROL(23),3322,PTN_322,BTN,322,1,0,1,Waypoint Overfly INS Update Selector", "SMC(29),3401,PTN_401,BTN,401,-1,-1,0,Release Interval Control (Hundreds)", "SMC(29),3401,PTN_401,BTN,401,1,0,1,Release Interval Control (Hundreds)", "MPCD_LEFT(26),3221,PTN_221,BTN,221,-1,-1,0,MPCD Left Display Symbology", "MPCD_LEFT(26),3221,PTN_221,BTN,221,1,0,1,MPCD Left Display Symbology", "MPCD_RIGHT(27),3235,PTN_235,BTN,235,1,0,1,MPCD Right Button 12", "UFCCONTROL(23),3299,PTN_299,LEV,299,0,0,1,Comm 2 Volume Control", "ELECTRIC(1),3612,PTN_612,TUMB,612,0.5,0,1,Generator Switch", "ELECTRIC(1),3612,PTN_612,TUMB,612,-0.5,0,1,Generator Switch", "LTWCA(35),3199,PTN_199,BTN,199,1,0,1,Master Warning"],
-    "Bf-109K-4": ["FUSEBOX(1),3032,P102,TUMB,37,-1,0,1,Cockpit.Bf109K4.cb_p102", "FUSEBOX(1),3032,P102,TUMB,37,1,0,1,Cockpit.Bf109K4.cb_p102", "FUSEBOX(1),3005,V100_1,TUMB,119,1,1,1,Cockpit.Bf109K4.cb_v100_1", "FUSEBOX(1),3089,F211_0,BTN,159,1,0,1,Cockpit.Bf109K4.cb_f211_0", "FUSEBOX(1),3051,BUTTON_A,BTN,108,1,0,1,Cockpit.Bf109K4.trigger_a", "FUSEBOX(1),3073,SAFETY,TUMB,107,0,0,1,Cockpit.Bf109K4.safety", "FUSEBOX(1),3073,SAFETY,TUMB,107,1,0,1,Cockpit.Bf109K4.safety", "FUSEBOX(1),3001,A104,BTN,49,1,0,1,Cockpit.Bf109K4.cb_a104", "FUSEBOX(1),3068,B102_M1,TUMB,59,0,0.1,0.1,Cockpit.Bf109K4.magnetos_1", "FUSEBOX(1),3081,V114,TUMB,62,-1,0,1,Cockpit.Bf109K4.cb_v114", "FUSEBOX(1),3081,V114,TUMB,62,1,0,1,Cockpit.Bf109K4.cb_v114", "VHF_RADIO(14),3002,FUG16_1,TUMB,128,0,0,0,Cockpit.Bf109K4.fug16zy_mode_1", "FUSEBOX(1),3084,C100_0,BTN,153,1,0,1,Cockpit.Bf109K4.cb_c100_0", "CLOCK(19),3008,CLK_SW,BTN,24,1,0,1,Cockpit.Bf109K4.clock_stopwatch", "VHF_RADIO(14),3002,FUG16_TR,TUMB,128,0,0.2,0.2,Cockpit.Bf109K4.fug16zy_mode_tr", "CONTROLS(4),3025,THTL_PUMPS_0,TUMB,87,0,0,0,Cockpit.Bf109K4.fuel_pumps_quad_0", "WEAPONS_CONTROLS(3),3015,SZK_LEVL_DLY,TUMB,64,0,0.75,0.75,Cockpit.Bf109K4.cb_r101_wmv", "FUSEBOX(1),3041,PITLITE_RH,LEV,82,0.5,0,1,Cockpit.Bf109K4.cb_c103", "WEAPONS_CONTROLS(3),3018,NOTWURF,BTN,92,1,0,1,Cockpit.Bf109K4.notwurf", "FUSEBOX(1),3080,A101_1,TUMB,120,1,1,1,Cockpit.Bf109K4.cb_a101_1", "CONTROLS(4),3012,FUEL_PUMPH,BTN,140,1,0,1,Cockpit.Bf109K4.primer", "FUSEBOX(1),3011,C101_1,TUMB,117,1,1,1,Cockpit.Bf109K4.cb_c101_1", "CONTROLS(4),3001,UC_UP,TUMB,54,1,1,1,Cockpit.Bf109K4.uc_0", "FUSEBOX(1),3063,STRTR_COVER,TUMB,51,-1,0,1,Cockpit.Bf109K4.starter_cover", "FUSEBOX(1),3063,STRTR_COVER,TUMB,51,1,0,1,Cockpit.Bf109K4.starter_cover", "CONTROLS(4),3037,WRAD_AUTO,TUMB,113,0,0.2,0.2,Cockpit.Bf109K4.radiators_auto", "FUSEBOX(1),3083,V100_0,BTN,156,1,0,1,Cockpit.Bf109K4.cb_v100_0", "FUSEBOX(1),3020,F135_1,TUMB,121,1,1,1,Cockpit.Bf109K4.cb_f135_1", "FUSEBOX(1),3068,B102_M1M2,TUMB,59,0,0.3,0.3,Cockpit.Bf109K4.magnetos_3", "FUSEBOX(1),3092,A100_0,BTN,151,1,0,1,Cockpit.Bf109K4.cb_a100_0", "VHF_RADIO(14),3003,FUG16_VOLUME,LEV,130,0,0,1,Cockpit.Bf109K4.fug16zy_volume", "FUSEBOX(1),3068,B102_M2,TUMB,59,0,0.2,0.2,Cockpit.Bf109K4.magnetos_2", "VHF_RADIO(14),3012,FUG25_1,TUMB,132,0,0,0,Cockpit.Bf109K4.fug25_mode_1", "CONTROLS(4),3041,FUEL_JETTISON,TUMB,112,0,0,1,Cockpit.Bf109K4.fuel_jettison", "CONTROLS(4),3041,FUEL_JETTISON,TUMB,112,1,0,1,Cockpit.Bf109K4.fuel_jettison", "CONTROLS(4),3025,THTL_PUMPS_2,TUMB,87,0,0.2,0.2,Cockpit.Bf109K4.fuel_pumps_quad_2", "CONTROLS(4),3025,THTL_PUMPS_1,TUMB,87,0,0.1,0.1,Cockpit.Bf109K4.fuel_pumps_quad_1", "CONTROLS(4),3037,WRAD_OPEN,TUMB,113,0,0.1,0.1,Cockpit.Bf109K4.radiators_zu", "WEAPONS_CONTROLS(3),3015,SZK_OFF,TUMB,64,0,0.5,0.5,Cockpit.Bf109K4.cb_r101_0", "FUSEBOX(1),3036,T100,TUMB,60,-1,0,1,Cockpit.Bf109K4.cb_t100", "FUSEBOX(1),3036,T100,TUMB,60,1,0,1,Cockpit.Bf109K4.cb_t100", "CONTROLS(4),3002,UC_DN,TUMB,55,1,1,1,Cockpit.Bf109K4.uc_1", "FUSEBOX(1),3086,D100_0,BTN,152,1,0,1,Cockpit.Bf109K4.cb_d100_0", "FUSEBOX(1),3024,V101,TUMB,118,-1,0,1,Cockpit.Bf109K4.cb_v101", "FUSEBOX(1),3024,V101,TUMB,118,1,0,1,Cockpit.Bf109K4.cb_v101", "CONTROLS(4),3037,WRAD_CLOSE,TUMB,113,0,0.3,0.3,Cockpit.Bf109K4.radiators_aus", "FUSEBOX(1),3068,B102_0,TUMB,59,0,0,0,Cockpit.Bf109K4.magnetos_0", "CONTROLS(4),3043,WRAD_CUT_LH,TUMB,90,0,0,1,Cockpit.Bf109K4.radiator_cutoff_lh", "CONTROLS(4),3043,WRAD_CUT_LH,TUMB,90,1,0,1,Cockpit.Bf109K4.radiator_cutoff_lh", "WEAPONS_CONTROLS(3),3007,REVI_MOUNT,TUMB,139,-1,0,1,Cockpit.Bf109K4.gun_sight_body", "WEAPONS_CONTROLS(3),3007,REVI_MOUNT,TUMB,139,1,0,1,Cockpit.Bf109K4.gun_sight_body", "ALTIMETER(8),3001,ALT_MBAR,LEV,11,1,0,1,Cockpit.Bf109K4.altimeter", "FUSEBOX(1),3017,E101_1,TUMB,123,1,1,1,Cockpit.Bf109K4.cb_e101_1", "ARTIFICIAL_HORIZON(9),3001,AH_LK,LEV,7,0,0,0.511,Cockpit.Bf109K4.ah_cage", "CLOCK(19),3001,CLK_SCALE,LEV,21,0,0,1,Cockpit.Bf109K4.clock_scale", "CLOCK(19),3006,CLK_SET,TUMB,23,-1,0,1,Cockpit.Bf109K4.clock_stop", "CLOCK(19),3006,CLK_SET,TUMB,23,1,0,1,Cockpit.Bf109K4.clock_stop", "FUSEBOX(1),3065,STRTR_HANDLE,BTN,52,1,0,1,Cockpit.Bf109K4.starter", "FUSEBOX(1),3006,C100,TUMB,116,-1,0,1,Cockpit.Bf109K4.cb_c100", "FUSEBOX(1),3006,C100,TUMB,116,1,0,1,Cockpit.Bf109K4.cb_c100", "FUSEBOX(1),3012,D100,TUMB,115,-1,0,1,Cockpit.Bf109K4.cb_d100", "FUSEBOX(1),3012,D100,TUMB,115,1,0,1,Cockpit.Bf109K4.cb_d100", "CONTROLS(4),3021,TAIL_LOCK,TUMB,97,0,0,1,Cockpit.Bf109K4.tail_wheel_lock", "CONTROLS(4),3021,TAIL_LOCK,TUMB,97,1,0,1,Cockpit.Bf109K4.tail_wheel_lock", "FUSEBOX(1),3053,BUTTON_B2,BTN,110,1,0,1,Cockpit.Bf109K4.trigger_b2", "VHF_RADIO(14),3001,FUG,TUMB,128,0.1,0,0.3,Cockpit.Bf109K4.fug16zy_mode", "VHF_RADIO(14),3001,FUG,TUMB,128,-0.1,0,0.3,Cockpit.Bf109K4.fug16zy_mode", "FUSEBOX(1),3075,A100,TUMB,114,-1,0,1,Cockpit.Bf109K4.cb_a100", "FUSEBOX(1),3075,A100,TUMB,114,1,0,1,Cockpit.Bf109K4.cb_a100", "FUSEBOX(1),3021,F211,TUMB,122,-1,0,1,Cockpit.Bf109K4.cb_f211", "FUSEBOX(1),3021,F211,TUMB,122,1,0,1,Cockpit.Bf109K4.cb_f211", "FUSEBOX(1),3088,F135_0,BTN,158,1,0,1,Cockpit.Bf109K4.cb_f135_0", "CONTROLS(4),3037,WRAD_OFF,TUMB,113,0,0,0,Cockpit.Bf109K4.radiators_0", "CONTROLS(4),3039,UC_COVER,TUMB,53,-1,0,1,Cockpit.Bf109K4.uc_cover", "CONTROLS(4),3039,UC_COVER,TUMB,53,1,0,1,Cockpit.Bf109K4.uc_cover", "FUSEBOX(1),3055,BUTTON_D,BTN,111,1,0,1,Cockpit.Bf109K4.trigger_d", "WEAPONS_CONTROLS(3),3015,SZK_DIVE_DLY,TUMB,64,0,0.25,0.25,Cockpit.Bf109K4.cb_r101_smv", "FUSEBOX(1),3066,B102,TUMB,59,0.1,0,0.3,Cockpit.Bf109K4.magnetos", "FUSEBOX(1),3066,B102,TUMB,59,-0.1,0,0.3,Cockpit.Bf109K4.magnetos", "FUSEBOX(1),3026,V101_1,TUMB,118,1,1,1,Cockpit.Bf109K4.cb_v101_1", "VHF_RADIO(14),3002,FUG16_2,TUMB,128,0,0.1,0.1,Cockpit.Bf109K4.fug16zy_mode_2", "FUSEBOX(1),3038,PITLITE_LH,LEV,80,0.5,0,1,Cockpit.Bf109K4.cb_c102", "FUSEBOX(1),3087,E101_0,BTN,160,1,0,1,Cockpit.Bf109K4.cb_e101_0", "CONTROLS(4),3062,VENT_RH,TUMB,99,0,0,1,Cockpit.Generic.cockpit_ventilation_knob", "CONTROLS(4),3062,VENT_RH,TUMB,99,1,0,1,Cockpit.Generic.cockpit_ventilation_knob", "FUSEBOX(1),3085,C101_0,BTN,154,1,0,1,Cockpit.Bf109K4.cb_c101_0", "CONTROLS(4),3023,THTL_PUMPS,TUMB,87,0.1,0,0.3,Cockpit.Bf109K4.fuel_pumps_quad", "CONTROLS(4),3023,THTL_PUMPS,TUMB,87,-0.1,0,0.3,Cockpit.Bf109K4.fuel_pumps_quad", "FUSEBOX(1),3093,A101_0,BTN,157,1,0,1,Cockpit.Bf109K4.cb_a101_0", "VHF_RADIO(14),3006,FUG16_MIC,TUMB,131,-1,0,1,Cockpit.Bf109K4.fug16zy_ftftyzf", "VHF_RADIO(14),3006,FUG16_MIC,TUMB,131,1,0,1,Cockpit.Bf109K4.fug16zy_ftftyzf", "FUSEBOX(1),3003,V100,TUMB,119,-1,0,1,Cockpit.Bf109K4.cb_v100", "FUSEBOX(1),3003,V100,TUMB,119,1,0,1,Cockpit.Bf109K4.cb_v100", "FUSEBOX(1),3052,BUTTON_B1,BTN,109,1,0,1,Cockpit.Bf109K4.trigger_b1", "VHF_RADIO(14),3012,FUG25_2,TUMB,132,0,1,1,Cockpit.Bf109K4.fug25_mode_2", "VHF_RADIO(14),3014,FUG25_TEST,BTN,133,1,0,1,Cockpit.Bf109K4.fug25_test", "FUSEBOX(1),3018,F135,TUMB,121,-1,0,1,Cockpit.Bf109K4.cb_f135", "FUSEBOX(1),3018,F135,TUMB,121,1,0,1,Cockpit.Bf109K4.cb_f135", "WEAPONS_CONTROLS(3),3013,SZK,TUMB,64,0.25,0,1,Cockpit.Bf109K4.cb_r101", "WEAPONS_CONTROLS(3),3013,SZK,TUMB,64,-0.25,0,1,Cockpit.Bf109K4.cb_r101", "WEAPONS_CONTROLS(3),3001,SZKK3_LHP,LEV,38,0,0,1,Cockpit.Bf109K4.szkk3_pinion_lh", "WEAPONS_CONTROLS(3),3010,REVI_SCREEN,TUMB,47,0,0,1,Cockpit.Bf109K4.gun_sight_tint", "WEAPONS_CONTROLS(3),3010,REVI_SCREEN,TUMB,47,1,0,1,Cockpit.Bf109K4.gun_sight_tint", "CONTROLS(4),3027,FUEL_MWVALVE,TUMB,96,0,0,1,Cockpit.Bf109K4.fuel_type", "CONTROLS(4),3027,FUEL_MWVALVE,TUMB,96,1,0,1,Cockpit.Bf109K4.fuel_type", "FUSEBOX(1),3008,C100_1,TUMB,116,1,1,1,Cockpit.Bf109K4.cb_c100_1", "FUSEBOX(1),3014,D100_1,TUMB,115,1,1,1,Cockpit.Bf109K4.cb_d100_1", "VHF_RADIO(14),3008,FUG16_FINE,LEV,129,0.5,,,Cockpit.Bf109K4.fug16zy_tune", "CONTROLS(4),3029,HATCH,TUMB,136,-1,0,1,Cockpit.Bf109K4.canopy_operate", "CONTROLS(4),3029,HATCH,TUMB,136,1,0,1,Cockpit.Bf109K4.canopy_operate", "OXYGEN(2),3003,OXY_SHOWER,BTN,126,1,0,1,Cockpit.Bf109K4.oxygen_shower", "FUSEBOX(1),3015,E101,TUMB,123,-1,0,1,Cockpit.Bf109K4.cb_e101", "FUSEBOX(1),3015,E101,TUMB,123,1,0,1,Cockpit.Bf109K4.cb_e101", "FUSEBOX(1),3077,A100_1,TUMB,114,1,1,1,Cockpit.Bf109K4.cb_a100_1", "FUSEBOX(1),3009,C101,TUMB,117,-1,0,1,Cockpit.Bf109K4.cb_c101", "FUSEBOX(1),3009,C101,TUMB,117,1,0,1,Cockpit.Bf109K4.cb_c101", "CONTROLS(4),3034,HATCH_S,TUMB,138,-1,0,1,Cockpit.Bf109K4.canopy_s", "CONTROLS(4),3034,HATCH_S,TUMB,138,1,0,1,Cockpit.Bf109K4.canopy_s", "FUSEBOX(1),3078,A101,TUMB,120,-1,0,1,Cockpit.Bf109K4.cb_a101", "FUSEBOX(1),3078,A101,TUMB,120,1,0,1,Cockpit.Bf109K4.cb_a101", "CONTROLS(4),3032,HATCH_JETTISON,BTN,83,1,0,1,Cockpit.Bf109K4.canopy_jettison", "REMOTE_COMPASS(10),3001,RCS_RING,LEV,12,0,0,1,Cockpit.Bf109K4.repeater_compass", "CONTROLS(4),3004,UC_EMER,BTN,63,1,0,1,Cockpit.Bf109K4.uc_emergency", "ENGINE_CONTROLS(5),3006,THTL_STOP,TUMB,88,0,0,1,Cockpit.Bf109K4.schnellstop", "ENGINE_CONTROLS(5),3006,THTL_STOP,TUMB,88,1,0,1,Cockpit.Bf109K4.schnellstop", "CONTROLS(4),3025,THTL_PUMPS_12,TUMB,87,0,0.3,0.3,Cockpit.Bf109K4.fuel_pumps_quad_3", "CONTROLS(4),3009,TRIM_ND,BTN,142,1,0,1,Cockpit.Bf109K4.trim_elevator_plus", "CONTROLS(4),3010,FLAPS_EXT,BTN,143,1,0,1,Cockpit.Bf109K4.flaps_plus", "CONTROLS(4),3011,FLAPS_RET,BTN,144,1,0,1,Cockpit.Bf109K4.flaps_minus", "OXYGEN(2),3001,OXY_VALVE,TUMB,127,0,0,1,Cockpit.Bf109K4.oxygen_valve", "OXYGEN(2),3001,OXY_VALVE,TUMB,127,1,0,1,Cockpit.Bf109K4.oxygen_valve", "CONTROLS(4),3060,VENT_LH,TUMB,98,0,0,1,Cockpit.Generic.cockpit_ventilation_knob", "CONTROLS(4),3060,VENT_LH,TUMB,98,1,0,1,Cockpit.Generic.cockpit_ventilation_knob", "VHF_RADIO(14),3002,FUG16_SQ,TUMB,128,0,0.3,0.3,Cockpit.Bf109K4.fug16zy_mode_sq", "FLARE_GUN(20),3001,PSTL_FIRE,BTN,72,1,0,1,Cockpit.Generic.flare_trigger", "WEAPONS_CONTROLS(3),3015,SZK_DIVE,TUMB,64,0,0,0,Cockpit.Bf109K4.cb_r101_sov", "WEAPONS_CONTROLS(3),3004,SZKK3_RHP,LEV,39,0,0,1,Cockpit.Bf109K4.szkk3_pinion_rh", "FUSEBOX(1),3060,PROP_PLUS,BTN,85,1,0,1,Cockpit.Bf109K4.pitch_plus", "FUSEBOX(1),3044,REVI_DIMMER,LEV,48,0.5,0,1,Cockpit.Bf109K4.cb_p112", "FLARE_GUN(20),3004,PSTL_RD,BTN,165,1,0,1,Cockpit.Generic.flare_select_red",
-        "CONTROLS(4),3035,WRAD,TUMB,113,0.1,0,0.3,Cockpit.Bf109K4.radiators", "CONTROLS(4),3035,WRAD,TUMB,113,-0.1,0,0.3,Cockpit.Bf109K4.radiators", "FLARE_GUN(20),3005,PSTL_WH,BTN,165,1,0,1,Cockpit.Generic.flare_select_white", "CONTROLS(4),3045,WRAD_CUT_RH,TUMB,91,0,0,1,Cockpit.Bf109K4.radiator_cutoff_rh", "CONTROLS(4),3045,WRAD_CUT_RH,TUMB,91,1,0,1,Cockpit.Bf109K4.radiator_cutoff_rh", "FLARE_GUN(20),3006,PSTL_YE,BTN,165,1,0,1,Cockpit.Generic.flare_select_yellow", "FUSEBOX(1),3090,V101_0,BTN,155,1,0,1,Cockpit.Bf109K4.cb_v101_0", "CONTROLS(4),3008,TRIM_NU,BTN,141,1,0,1,Cockpit.Bf109K4.trim_elevator_minus", "WEAPONS_CONTROLS(3),3015,SZK_LEVL,TUMB,64,0,1,1,Cockpit.Bf109K4.cb_r101_wov", "FUSEBOX(1),3034,P150,TUMB,61,-1,0,1,Cockpit.Bf109K4.cb_p150", "FUSEBOX(1),3034,P150,TUMB,61,1,0,1,Cockpit.Bf109K4.cb_p150", "FUSEBOX(1),3023,F211_1,TUMB,122,1,1,1,Cockpit.Bf109K4.cb_f211_1", "FUSEBOX(1),3060,PROP_MINUS,BTN,85,-1,0,1,Cockpit.Bf109K4.pitch_minus", "FLARE_GUN(20),3003,PSTL_GN,BTN,165,1,0,1,Cockpit.Generic.flare_select_green", "FUSEBOX(1),3056,FUG16_TX,BTN,150,1,0,1,Cockpit.Bf109K4.fug16zy_tx", "CONTROLS(4),3033,HATCH_H,TUMB,137,-1,0,1,Cockpit.Bf109K4.canopy_h", "CONTROLS(4),3033,HATCH_H,TUMB,137,1,0,1,Cockpit.Bf109K4.canopy_h", "FUSEBOX(1),3058,E103,TUMB,89,-1,0,1,Cockpit.Bf109K4.cb_e103", "FUSEBOX(1),3058,E103,TUMB,89,1,0,1,Cockpit.Bf109K4.cb_e103", "FUSEBOX(1),3054,BUTTON_T,BTN,149,1,0,1,Cockpit.Bf109K4.trigger_t", "ENGINE_CONTROLS(5),3008,THTL_CWVALVE,TUMB,86,0,0,1,Cockpit.Bf109K4.cold_weather_valve", "ENGINE_CONTROLS(5),3008,THTL_CWVALVE,TUMB,86,1,0,1,Cockpit.Bf109K4.cold_weather_valve", "CLOCK(19),3004,CLK_PINION,LEV,22,0,0,1,Cockpit.Bf109K4.clock_pinion"],
-    "C-101CC": ["SYSTEMS(2),3050,PNT-TRANSF01-LP,TUMB,130,0.5,0,1,Fuel Transfer Left", "SYSTEMS(2),3050,PNT-TRANSF01-LP,TUMB,130,-0.5,0,1,Fuel Transfer Left", "VTWU740(11),3001,PNT-UHF-TS-CP,BTN,234,1,0,1,TEST SELECTOR SWITCH", "VTWU740(11),3001,PNT-UHF-TS-CP,BTN,234,-1,-1,0,TEST SELECTOR SWITCH", "SYSTEMS(2),3208,PNT-TM3-CPD,TUMB,351,1,0,1,TEST M-3/A SWITCH", "SYSTEMS(2),3208,PNT-TM3-CPD,TUMB,351,-1,0,1,TEST M-3/A SWITCH", "SYSTEMS(2),3162,PNT-BTN-UHF-CP,BTN,334,1,0,1,UHF PRIORITY", "SYSTEMS(2),3040,PNT-HND-CNPY,TUMB,11,1,0,0,Canopy Safety Catch", "SYSTEMS(2),3040,PNT-HND-CNPY,TUMB,11,-1,0,0,Canopy Safety Catch", "SYSTEMS(2),3115,PNT-START-SW-LP,BTN,139,1,0,1,CONTINUOUS IGNITION/START", "SYSTEMS(2),3115,PNT-START-SW-LP,TUMB,139,-1,-1,0,CONTINUOUS IGNITION/START", "SYSTEMS(2),3426,PNT-ABRT-SW-LP-BACK,TUMB,826,1,0,1,ABORT", "SYSTEMS(2),3426,PNT-ABRT-SW-LP-BACK,TUMB,826,1,0,1,ABORT", "VTWU740(11),3029,PNT-UHF-SQL-CP-BACK,TUMB,872,1,0,1,Squelch Switch", "VTWU740(11),3029,PNT-UHF-SQL-CP-BACK,TUMB,872,-1,0,1,Squelch Switch", "SYSTEMS(2),3433,PNT-CLKC-BT-CP-BACK,BTN,811,1,0,1,CHRONOGRAPH", "SYSTEMS(2),3098,PNT-CB-30-LP,TUMB,456,1,0,1,CB Formation Lights", "SYSTEMS(2),3098,PNT-CB-30-LP,TUMB,456,-1,0,1,CB Formation Lights", "LIGHTS(3),3103,PNT-CAB-RP,TUMB,369,1,0,1,STORM LIGHTS", "LIGHTS(3),3103,PNT-CAB-RP,TUMB,369,-1,0,1,STORM LIGHTS", "SYSTEMS(2),3432,PNT-CLKT-KNB-CP-BACK,LEV,809,0.04,0,1,Set Clock Knob", "SYSTEMS(2),3431,PNT-CLKT-KNB-CP-BACK,TUMB,810,1,0,1,Set Clock Knob", "SYSTEMS(2),3531,PNT-BE-MBI-CP-BACK,LEV,1258,0.5,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3446,PNT-BE-MBI-CP-BACK,BTN,970,1,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3530,PNT-BE-MBO-CP,LEV,1255,0.5,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3167,PNT-BE-MBO-CP,BTN,528,1,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3244,PNT-HARN-SEAT,LEV,94,0,0,1,SHOULDER HARNESS CONTROL HANDLE", "SYSTEMS(2),3468,PNT-ETP-GUARD-LP-BACK,TUMB,833,1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3468,PNT-ETP-GUARD-LP-BACK,TUMB,833,-1,0,1,Emergency Elevator Trim Switch Cutout Guard", "INTERCOM(7),3019,PNT-INT-VUHF-RP,LEV,269,1,0,1,V/UHF Switch", "INTERCOM(7),3018,PNT-INT-VUHF-RP,TUMB,268,1,0,1,V/UHF Switch", "INTERCOM(7),3018,PNT-INT-VUHF-RP,TUMB,268,-1,0,1,V/UHF Switch", "LIGHTS(3),3105,PNT-INTR-KNB-RP,LEV,364,0,0,1,INSTRUMENT LIGHTING", "SYSTEMS(2),3160,PNT-EMETBREAK-LP,TUMB,195,1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3160,PNT-EMETBREAK-LP,TUMB,195,-1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3489,PNT-LG-RESET-LP-BACK,BTN,770,1,0,1,LANDING GEAR WARNING MUTE", "SYSTEMS(2),3017,PNT-FUEGO-CP,BTN,514,1,0,1,Fire Alert Test", "INTERCOM(7),3036,PNT-INT-MAINV-RP-BACK,LEV,946,0,0,1,Intercom volume", "SYSTEMS(2),3415,PNT-ACELKNB-CP-BACK,BTN,774,1,0,1,Reset Max/Min Needles", "SYSTEMS(2),3043,PNT-ANTISKID-CP,BTN,516,1,0,1,Antiskid ON/OFF", "SYSTEMS(2),3524,PNT-LDNG-H-CPL-BACK,TUMB,75,-1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3524,PNT-LDNG-H-CPL-BACK,TUMB,75,1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3553,PNT-YB-TRIM-LP-BACK,LEV,1276,0.5,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3470,PNT-YB-TRIM-LP-BACK,BTN,534,1,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3490,PNT-LG-OVR-CPR-BACK,BTN,939,1,0,1,LANDING GEAR OVERRIDE", "SYSTEMS(2),3202,PNT-LG-RESET-LP,BTN,17,1,0,1,LANDING GEAR WARNING MUTE", "SYSTEMS(2),3509,PNT-LOCK-CNPY-BACK,TUMB,749,1,0,0,Canopy Locking Handle", "SYSTEMS(2),3509,PNT-LOCK-CNPY-BACK,TUMB,749,-1,0,0,Canopy Locking Handle", "SYSTEMS(2),3062,PNT-CB-03-LP,TUMB,429,1,0,1,RPM N2", "SYSTEMS(2),3062,PNT-CB-03-LP,TUMB,429,-1,0,1,RPM N2", "SYSTEMS(2),3488,PNT-BTN-01-CPL-BACK,BTN,940,1,0,1,PITOT HEAT", "SYSTEMS(2),3056,PNT-CB-25-LP,TUMB,451,1,0,1,BACKUP INVERTER", "SYSTEMS(2),3056,PNT-CB-25-LP,TUMB,451,-1,0,1,BACKUP INVERTER", "INTERCOM(7),3012,PNT-INT-CALL-RP,BTN,402,1,0,1,Call button", "SYSTEMS(2),3480,PNT-TRANSF01-LP-BACK,TUMB,818,1,0,1,Fuel Transfer Left/Fwd Cockpit Priority", "SYSTEMS(2),3480,PNT-TRANSF01-LP-BACK,TUMB,818,-1,0,1,Fuel Transfer Left/Fwd Cockpit Priority", "SYSTEMS(2),3081,PNT-CB-15-LP,TUMB,441,1,0,1,OIL TEMP IND", "SYSTEMS(2),3081,PNT-CB-15-LP,TUMB,441,-1,0,1,OIL TEMP IND", "SYSTEMS(2),3246,PNT-SC-ES-ST,LEV,538,0,0,1,EJECTION HANDLE SAFETY", "SYSTEMS(2),3402,PTN-COV03-CPR-BACK,TUMB,937,-1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3402,PTN-COV03-CPR-BACK,TUMB,937,1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3492,PNT-PARKING-CPL-BACK,TUMB,65,0,0,1,Parking Brake", "SYSTEMS(2),3492,PNT-PARKING-CPL-BACK,TUMB,65,1,0,1,Parking Brake", "SYSTEMS(2),3224,PNT-FLAPSH-LP,TUMB,14,-0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3224,PNT-FLAPSH-LP,TUMB,14,0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3427,PNT-START-SW-LP-BACK,BTN,827,1,0,1,CONTINUOUS IGNITION/START", "SYSTEMS(2),3427,PNT-START-SW-LP-BACK,TUMB,827,-1,-1,0,CONTINUOUS IGNITION/START", "SYSTEMS(2),3469,PNT-EMERGTRP-LP-BACK,BTN,832,1,0.5,1,Emergency Elevator Trim Switch", "SYSTEMS(2),3469,PNT-EMERGTRP-LP-BACK,BTN,832,0,0.5,0,Emergency Elevator Trim Switch", "VTWU740(11),3002,PNT-UHF-1S-CP,TUMB,226,0.1,0,0.2,100 MHz Selector", "VTWU740(11),3002,PNT-UHF-1S-CP,TUMB,226,-0.1,0,0.2,100 MHz Selector", "SYSTEMS(2),3247,PNT-RT-ES-ST,TUMB,537,1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3247,PNT-RT-ES-ST,TUMB,537,-1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3250,PNT-LDNG-H-CPL,TUMB,8,-1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3250,PNT-LDNG-H-CPL,TUMB,8,1,0,1,LANDING GEAR HANDLE", "INTERCOM(7),3033,PNT-INT-MVOL-RP-BACK,LEV,901,1,0,1,MK Switch", "INTERCOM(7),3032,PNT-INT-MVOL-RP-BACK,TUMB,890,1,0,1,MK Switch", "INTERCOM(7),3032,PNT-INT-MVOL-RP-BACK,TUMB,890,-1,0,1,MK Switch", "VHF20B(10),3011,PNT-COMM-PWR-RP-BACK,LEV,0,1,0,1,OFF/PWR/TEST switch/Frequency control (1 MHz). Rotate mouse wheel to change frequency", "VHF20B(10),3014,PNT-COMM-PWR-RP-BACK,TUMB,917,0.5,0,1,OFF/PWR/TEST switch/Frequency control (1 MHz). Rotate mouse wheel to change frequency", "VHF20B(10),3014,PNT-COMM-PWR-RP-BACK,TUMB,917,-0.5,0,1,OFF/PWR/TEST switch/Frequency control (1 MHz). Rotate mouse wheel to change frequency", "SYSTEMS(2),3228,PNT-RL-LCP,LEV,259,0,0,1,ADJUST RED LIGHT - LEFT CENTER PANEL", "SYSTEMS(2),3549,PNT-BACK-ALT-GL,BTN,1190,1,0,1,Tap Glass", "VTWU740(11),3006,PNT-UHF-5S-CP,TUMB,230,0.25,0,1,0.025 MHz Selector", "VTWU740(11),3006,PNT-UHF-5S-CP,TUMB,230,-0.25,0,1,0.025 MHz Selector", "VIR31A_DME40(12),3011,PNT-NAV-MS-RP-BACK,LEV,0,1,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3014,PNT-NAV-MS-RP-BACK,TUMB,921,0.25,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3014,PNT-NAV-MS-RP-BACK,TUMB,921,-0.25,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "SYSTEMS(2),3101,PNT-CB-19-LP,TUMB,445,1,0,1,LH LAND/TAXI LIGHT", "SYSTEMS(2),3101,PNT-CB-19-LP,TUMB,445,-1,0,1,LH LAND/TAXI LIGHT", "SYSTEMS(2),3010,PNT-GENL-CPR,TUMB,317,1,0,1,Generator ON/OFF/RESET", "SYSTEMS(2),3010,PNT-GENL-CPR,BTN,317,-1,-1,0,Generator ON/OFF/RESET", "SYSTEMS(2),3242,PNT-AIRINLET-RP,LEV,101,1,0,1,AIR VENT", "SYSTEMS(2),3015,PNT-ALT-KNB-CP,LEV,66,1,0,1,Altimeter Baro Adjust", "LIGHTS(3),3421,PNT-LNDG-R-CPL-BACK,TUMB,942,-1,0,1,RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY", "LIGHTS(3),3421,PNT-LNDG-R-CPL-BACK,TUMB,942,1,0,1,RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY", "VTWU740(11),3022,PNT-UHF-1S-CP-BACK,TUMB,862,0.1,0,0.2,100 MHz Selector", "VTWU740(11),3022,PNT-UHF-1S-CP-BACK,TUMB,862,-0.1,0,0.2,100 MHz Selector", "SYSTEMS(2),3121,PNT-AC-SELFLU-RP,TUMB,420,1,0,1,AIR FLOW MODE", "SYSTEMS(2),3121,PNT-AC-SELFLU-RP,TUMB,420,-1,0,1,AIR FLOW MODE", "SYSTEMS(2),3111,PNT-COMP-BT-LP,BTN,136,1,0,1,COMPUTER", "SYSTEMS(2),3058,PNT-CB-09-LP,TUMB,435,1,0,1,LANDING GEAR", "SYSTEMS(2),3058,PNT-CB-09-LP,TUMB,435,-1,0,1,LANDING GEAR", "SYSTEMS(2),3120,PNT-AC-ACOND-RP,TUMB,419,0.5,0,1,AIR-CONDITIONING MASTER SWITCH", "SYSTEMS(2),3120,PNT-AC-ACOND-RP,TUMB,419,-0.5,0,1,AIR-CONDITIONING MASTER SWITCH", "SYSTEMS(2),3258,PNT-SCAR-MS-KB-CP,TUMB,694,0.142,0,0.994,MODE SELECTOR", "SYSTEMS(2),3258,PNT-SCAR-MS-KB-CP,TUMB,694,-0.142,0,0.994,MODE SELECTOR", "INTERCOM(7),3004,PNT-INT-VVOL-RP,LEV,396,1,0,1,VHF Switch", "INTERCOM(7),3003,PNT-INT-VVOL-RP,TUMB,282,1,0,1,VHF Switch", "INTERCOM(7),3003,PNT-INT-VVOL-RP,TUMB,282,-1,0,1,VHF Switch", "SYSTEMS(2),3529,PNT-BE-MBM-CP,LEV,1254,0.5,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3168,PNT-BE-MBM-CP,BTN,527,1,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3508,PNT-HND-CNPY-BACK,TUMB,750,1,0,0,Canopy Safety Catch", "SYSTEMS(2),3508,PNT-HND-CNPY-BACK,TUMB,750,-1,0,0,Canopy Safety Catch", "SYSTEMS(2),3259,PNT-SCAR-RT-KB-CP,TUMB,695,0.25,0,1,RIPPLE TIME", "SYSTEMS(2),3259,PNT-SCAR-RT-KB-CP,TUMB,695,-0.25,0,1,RIPPLE TIME", "SYSTEMS(2),3199,PNT-APL-TEST-CPL,BTN,331,1,0,1,STALL WARNING TEST", "SYSTEMS(2),3199,PNT-APL-TEST-CPL,BTN,331,-1,-1,0,STALL WARNING TEST", "SYSTEMS(2),3487,PNT-BTN-VHF-CP-BACK,BTN,838,1,0,1,VHF PRIORITY", "SYSTEMS(2),3091,PNT-CB-42-LP,TUMB,468,1,0,1,FIRE DETECTOR", "SYSTEMS(2),3091,PNT-CB-42-LP,TUMB,468,-1,0,1,FIRE DETECTOR", "SYSTEMS(2),3003,PNT-BTN-02-CPR,BTN,325,1,0,1,Left Battery Isolation Switch", "SYSTEMS(2),3205,PNT-IFFM4L-CPD,TUMB,348,0.5,0,1,AUDIO LIGHT SWITCH", "SYSTEMS(2),3205,PNT-IFFM4L-CPD,TUMB,348,-0.5,0,1,AUDIO LIGHT SWITCH", "SYSTEMS(2),3425,PNT-GA-SW-LP-BACK,TUMB,825,1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3425,PNT-GA-SW-LP-BACK,TUMB,825,-1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3467,PNT-AILBTN-LP-BACK,BTN,830,1,0,1,AILERON HYD OVERRIDE", "SYSTEMS(2),3292,PNT-CB-24B-LP,TUMB,594,1,0,1,IFF BREAKER", "SYSTEMS(2),3292,PNT-CB-24B-LP,TUMB,594,-1,0,1,IFF BREAKER", "SYSTEMS(2),3482,PNT-TRANSF03-LP-BACK,TUMB,820,1,0,1,Fuel Transfer Center 2/Fwd Cockpit Priority", "SYSTEMS(2),3482,PNT-TRANSF03-LP-BACK,TUMB,820,-1,0,1,Fuel Transfer Center 2/Fwd Cockpit Priority", "SYSTEMS(2),3519,PNT-HN-ES-ST-BACK,TUMB,520,1,0,1,EJECTION HANDLE", "SYSTEMS(2),3519,PNT-HN-ES-ST-BACK,TUMB,520,-1,0,1,EJECTION HANDLE", "SYSTEMS(2),3152,PNT-AILCOV-LP,TUMB,144,-1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3152,PNT-AILCOV-LP,TUMB,144,1,0,1,AILERON HYD OVERRIDE COVER",
-        "SYSTEMS(2),3069,PNT-CB-23-LP,TUMB,449,1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3069,PNT-CB-23-LP,TUMB,449,-1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3074,PNT-CB-41-LP,TUMB,467,1,0,1,FUSELAGE TANK PUMP", "SYSTEMS(2),3074,PNT-CB-41-LP,TUMB,467,-1,0,1,FUSELAGE TANK PUMP", "VTWU740(11),3028,PNT-UHF-MD-CP-BACK,TUMB,869,0.5,0,1,Frequency Mode Dial", "VTWU740(11),3028,PNT-UHF-MD-CP-BACK,TUMB,869,-0.5,0,1,Frequency Mode Dial", "SYSTEMS(2),3211,PNT-IFFCS-CPD,TUMB,354,1,0,1,IFF MODE 4", "SYSTEMS(2),3211,PNT-IFFCS-CPD,TUMB,354,-1,0,1,IFF MODE 4", "SYSTEMS(2),3084,PNT-CB-22-LP,TUMB,448,1,0,1,FLAPS INDICATOR\nAILERON INDICATOR", "SYSTEMS(2),3084,PNT-CB-22-LP,TUMB,448,-1,0,1,FLAPS INDICATOR\nAILERON INDICATOR", "SYSTEMS(2),3607,PNT-APR-CPL-BACK,TUMB,1209,1,0,1,STALL WARNING POWER", "SYSTEMS(2),3607,PNT-APR-CPL-BACK,TUMB,1209,-1,0,1,STALL WARNING POWER", "SYSTEMS(2),3207,PNT-TM2-CPD,TUMB,350,1,0,1,TEST M-2 SWITCH", "SYSTEMS(2),3207,PNT-TM2-CPD,TUMB,350,-1,0,1,TEST M-2 SWITCH", "SYSTEMS(2),3481,PNT-TRANSF02-LP-BACK,TUMB,819,1,0,1,Fuel Transfer Center 1/Fwd Cockpit Priority", "SYSTEMS(2),3481,PNT-TRANSF02-LP-BACK,TUMB,819,-1,0,1,Fuel Transfer Center 1/Fwd Cockpit Priority", "SYSTEMS(2),3215,PNT-M3A2-CPD,TUMB,358,0.1,0,0.9,MODE 3 - 0X00", "SYSTEMS(2),3215,PNT-M3A2-CPD,TUMB,358,-0.1,0,0.9,MODE 3 - 0X00", "SYSTEMS(2),3006,PNT-UNIONB-CPR,TUMB,316,1,0,1,DC Bus Tie", "SYSTEMS(2),3006,PNT-UNIONB-CPR,TUMB,316,-1,0,1,DC Bus Tie", "SYSTEMS(2),3094,PNT-CB-28-LP,TUMB,454,1,0,1,INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS", "SYSTEMS(2),3094,PNT-CB-28-LP,TUMB,454,-1,0,1,INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS", "SYSTEMS(2),3221,PNT-AUHF-CP,TUMB,338,0.5,0,1,UHF ANTENNA SELECTION", "SYSTEMS(2),3221,PNT-AUHF-CP,TUMB,338,-0.5,0,1,UHF ANTENNA SELECTION", "SYSTEMS(2),3083,PNT-CB-16-LP,TUMB,442,1,0,1,ANTI-ICE/RAIN REPELLENT", "SYSTEMS(2),3083,PNT-CB-16-LP,TUMB,442,-1,0,1,ANTI-ICE/RAIN REPELLENT", "SYSTEMS(2),3216,PNT-M3A3-CPD,TUMB,359,0.1,0,0.9,MODE 3 - 00X0", "SYSTEMS(2),3216,PNT-M3A3-CPD,TUMB,359,-0.1,0,0.9,MODE 3 - 00X0", "VTWU740(11),3027,PNT-UHF-FS-CP-BACK,TUMB,868,0.1,0,0.3,Function Dial", "VTWU740(11),3027,PNT-UHF-FS-CP-BACK,TUMB,868,-0.1,0,0.3,Function Dial", "SYSTEMS(2),3220,PNT-IDENT-CPD,TUMB,361,0.5,0,1,IDENT SWITCH", "SYSTEMS(2),3220,PNT-IDENT-CPD,TUMB,361,-0.5,0,1,IDENT SWITCH", "SYSTEMS(2),3041,PNT-LOCK-CNPY,TUMB,13,1,0,0,Canopy Locking Handle", "SYSTEMS(2),3041,PNT-LOCK-CNPY,TUMB,13,-1,0,0,Canopy Locking Handle", "SYSTEMS(2),3239,PNT-MIRROR,LEV,10,0,0,1,Show/Hide Mirror", "SYSTEMS(2),3153,PNT-AILBTN-LP,BTN,145,1,0,1,AILERON HYD OVERRIDE", "SYSTEMS(2),3557,PNT-BLACKOUT-CURTAIN,LEV,256,0,0,1,Blackout curtain", "SYSTEMS(2),3222,PNT-BTN-ANRA-CPL,BTN,314,1,0,1,ANTI-RAIN FLUID", "SYSTEMS(2),3527,PNT-OXYGEN-PRO-BACK,TUMB,1196,1,0,1,OXYGEN PRESSURE WARNING SWITCH", "SYSTEMS(2),3527,PNT-OXYGEN-PRO-BACK,TUMB,1196,-1,0,1,OXYGEN PRESSURE WARNING SWITCH", "SYSTEMS(2),3551,PNT-IFR-HOOD,TUMB,329,1,0,1,Close/open IFR hood", "SYSTEMS(2),3551,PNT-IFR-HOOD,TUMB,329,-1,0,1,Close/open IFR hood", "VTWU740(11),3031,PNT-UHF-CHS-CP-BACK,TUMB,867,0.05,0,1,Preset Channel Selector", "VTWU740(11),3031,PNT-UHF-CHS-CP-BACK,TUMB,867,-0.05,0,1,Preset Channel Selector", "VTWU740(11),3005,PNT-UHF-4S-CP,TUMB,229,0.1,0,1,0.1 MHz Selector", "VTWU740(11),3005,PNT-UHF-4S-CP,TUMB,229,-0.1,0,1,0.1 MHz Selector", "SYSTEMS(2),3172,PNT-FD-ALT,BTN,215,1,0,1,ALTITUDE MODE", "SYSTEMS(2),3174,PNT-FD-NAV,BTN,211,1,0,1,NAV MODE", "SYSTEMS(2),3414,PNT-AVISO-CP-BACK,BTN,637,1,0,1,Caution Alert Reset", "SYSTEMS(2),3545,PNT-CB-36-LP,TUMB,462,1,0,1,HOR GYRO", "SYSTEMS(2),3545,PNT-CB-36-LP,TUMB,462,-1,0,1,HOR GYRO", "SYSTEMS(2),3170,PNT-FD-SBY,BTN,219,1,0,1,STANDBY MODE", "SYSTEMS(2),3661,PNT-FD-KNB-RP-BACK,TUMB,916,1,0,1,FD Panel Brightness", "SYSTEMS(2),3661,PNT-FD-KNB-RP-BACK,TUMB,916,-1,0,1,FD Panel Brightness", "SYSTEMS(2),3053,PNT-TRANSF04-LP,TUMB,133,0.5,0,1,Fuel Transfer Right", "SYSTEMS(2),3053,PNT-TRANSF04-LP,TUMB,133,-0.5,0,1,Fuel Transfer Right", "SYSTEMS(2),3245,PNT-HN-ES-ST,TUMB,536,1,0,1,EJECTION HANDLE", "SYSTEMS(2),3245,PNT-HN-ES-ST,TUMB,536,-1,0,1,EJECTION HANDLE", "SYSTEMS(2),3314,PNT-HUD-1S-CP,TUMB,587,0.1,0,0.2,DEPRESSION 0XX", "SYSTEMS(2),3314,PNT-HUD-1S-CP,TUMB,587,-0.1,0,0.2,DEPRESSION 0XX", "SYSTEMS(2),3500,PNT-CB-15-LP-BACK,TUMB,951,1,0,1,OIL TEMP IND", "SYSTEMS(2),3500,PNT-CB-15-LP-BACK,TUMB,951,-1,0,1,OIL TEMP IND", "SYSTEMS(2),3046,PNT-BOMSUM-LP,BTN,120,1,0,1,Fuselage Tank Pump", "SYSTEMS(2),3076,PNT-CB-38-LP,TUMB,464,1,0,1,OUTER WING TANK PUMPS", "SYSTEMS(2),3076,PNT-CB-38-LP,TUMB,464,-1,0,1,OUTER WING TANK PUMPS", "VTWU740(11),3011,PNT-UHF-CHS-CP,TUMB,231,0.05,0,1,Preset Channel Selector", "VTWU740(11),3011,PNT-UHF-CHS-CP,TUMB,231,-0.05,0,1,Preset Channel Selector", "VIR31A_DME40(12),3012,PNT-NAV-VOL-RP-BACK,LEV,0,1,0,1,Volume control/Frequency control (50 kHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "VIR31A_DME40(12),3013,PNT-NAV-VOL-RP-BACK,TUMB,923,0.1,0,1,Volume control/Frequency control (50 kHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "VIR31A_DME40(12),3013,PNT-NAV-VOL-RP-BACK,TUMB,923,-0.1,0,1,Volume control/Frequency control (50 kHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "SYSTEMS(2),3114,PNT-ABRT-SW-LP,TUMB,138,1,0,1,ABORT", "SYSTEMS(2),3114,PNT-ABRT-SW-LP,TUMB,138,1,0,1,ABORT", "INTERCOM(7),3008,PNT-INT-VOVOL-RP,LEV,399,1,0,1,VOR Switch", "INTERCOM(7),3007,PNT-INT-VOVOL-RP,TUMB,285,1,0,1,VOR Switch", "INTERCOM(7),3007,PNT-INT-VOVOL-RP,TUMB,285,-1,0,1,VOR Switch", "VTWU740(11),3009,PNT-UHF-SQL-CP,TUMB,236,1,0,1,Squelch Switch", "VTWU740(11),3009,PNT-UHF-SQL-CP,TUMB,236,-1,0,1,Squelch Switch", "LIGHTS(3),3102,PNT-ALUM-RP,TUMB,370,0.5,0,1,RED FLOOD LIGHTING", "LIGHTS(3),3102,PNT-ALUM-RP,TUMB,370,-0.5,0,1,RED FLOOD LIGHTING", "SYSTEMS(2),3073,PNT-CB-04-LP,TUMB,430,1,0,1,OIL PRESSURE", "SYSTEMS(2),3073,PNT-CB-04-LP,TUMB,430,-1,0,1,OIL PRESSURE", "VTWU740(11),3023,PNT-UHF-2S-CP-BACK,TUMB,863,0.1,0,1,10 MHz Selector", "VTWU740(11),3023,PNT-UHF-2S-CP-BACK,TUMB,863,-0.1,0,1,10 MHz Selector", "VTWU740(11),3004,PNT-UHF-3S-CP,TUMB,228,0.1,0,1,1 MHz Selector", "VTWU740(11),3004,PNT-UHF-3S-CP,TUMB,228,-0.1,0,1,1 MHz Selector", "VTWU740(11),3025,PNT-UHF-4S-CP-BACK,TUMB,865,0.1,0,1,0.1 MHz Selector", "VTWU740(11),3025,PNT-UHF-4S-CP-BACK,TUMB,865,-0.1,0,1,0.1 MHz Selector", "SYSTEMS(2),3691,PNT-SEAT-1,TUMB,1182,-1,0,1,Ejection Seat Priority Lever", "SYSTEMS(2),3691,PNT-SEAT-1,TUMB,1182,1,0,1,Ejection Seat Priority Lever", "SYSTEMS(2),3241,PNT-BKADI-K02-CP,LEV,533,0.5,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3014,PNT-BKADI-K02-CP,BTN,41,1,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3234,PNT-FFLW-KNB-CP,BTN,32,-1,1,0,FUEL FLOW RESET", "INTERCOM(7),3017,PNT-INT-DME-RP,LEV,398,1,0,1,DME Switch", "INTERCOM(7),3016,PNT-INT-DME-RP,TUMB,284,1,0,1,DME Switch", "INTERCOM(7),3016,PNT-INT-DME-RP,TUMB,284,-1,0,1,DME Switch", "SYSTEMS(2),3209,PNT-TMC-CPD,TUMB,352,1,0,1,TEST M/C SWITCH", "SYSTEMS(2),3209,PNT-TMC-CPD,TUMB,352,-1,0,1,TEST M/C SWITCH", "SYSTEMS(2),3071,PNT-CB-06-LP,TUMB,432,1,0,1,AIR-CONDITIONING/PRESSURIZATION", "SYSTEMS(2),3071,PNT-CB-06-LP,TUMB,432,-1,0,1,AIR-CONDITIONING/PRESSURIZATION", "INTERCOM(7),3040,PNT-INT-DME-RP-BACK,LEV,898,1,0,1,DME Switch", "INTERCOM(7),3039,PNT-INT-DME-RP-BACK,TUMB,888,1,0,1,DME Switch", "INTERCOM(7),3039,PNT-INT-DME-RP-BACK,TUMB,888,-1,0,1,DME Switch", "SYSTEMS(2),3497,PNT-CB-14-LP-BACK,TUMB,952,1,0,1,ITT", "SYSTEMS(2),3497,PNT-CB-14-LP-BACK,TUMB,952,-1,0,1,ITT", "SYSTEMS(2),3540,PNT-CB-29-LP,TUMB,455,1,0,1,RADIO ALTIMETER", "SYSTEMS(2),3540,PNT-CB-29-LP,TUMB,455,-1,0,1,RADIO ALTIMETER", "VTWU740(11),3030,PNT-UHF-PW-CP-BACK,TUMB,876,1,0,1,POWER TRANSMIT SELECTOR", "VTWU740(11),3030,PNT-UHF-PW-CP-BACK,TUMB,876,-1,0,1,POWER TRANSMIT SELECTOR", "SYSTEMS(2),3476,PNT-BOMSUM-LP-BACK,BTN,813,1,0,1,Fuselage Tank Pump", "VHF20B(10),3001,PNT-COMM-PWR-RP,LEV,0,1,0,1,OFF/PWR/TEST switch/Frequency control (100 MHz).Rotate mouse wheel to make channel selection", "VHF20B(10),3004,PNT-COMM-PWR-RP,TUMB,653,0.5,0,1,OFF/PWR/TEST switch/Frequency control (100 MHz).Rotate mouse wheel to make channel selection", "VHF20B(10),3004,PNT-COMM-PWR-RP,TUMB,653,-0.5,0,1,OFF/PWR/TEST switch/Frequency control (100 MHz).Rotate mouse wheel to make channel selection", "SYSTEMS(2),3150,PNT-EMERGLG-LP,TUMB,197,0,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3150,PNT-EMERGLG-LP,TUMB,197,1,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3355,PNT-COMMN-TB-RP,TUMB,650,1,-1,1,NAV TEST SWITCH", "SYSTEMS(2),3355,PNT-COMMN-TB-RP,TUMB,650,-1,-1,1,NAV TEST SWITCH", "SYSTEMS(2),3522,PNT-BOX-FRONT-BACK,LEV,1310,0,0,1,STORAGE BOX COVER", "VIR31A_DME40(12),3002,PNT-NAV-VOL-RP,LEV,0,1,0,1,Volume control/Frequency control (50 kHz). Right mouse click to select FREQUENCY SELECTOR (50 kHz). Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3003,PNT-NAV-VOL-RP,TUMB,659,0.1,0,1,Volume control/Frequency control (50 kHz). Right mouse click to select FREQUENCY SELECTOR (50 kHz). Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3003,PNT-NAV-VOL-RP,TUMB,659,-0.1,0,1,Volume control/Frequency control (50 kHz). Right mouse click to select FREQUENCY SELECTOR (50 kHz). Rotate mouse wheel to make channel selection", "SYSTEMS(2),3518,PNT-HARN-SEAT-BACK,LEV,523,0,0,1,SHOULDER HARNESS CONTROL HANDLE", "SYSTEMS(2),3521,PNT-RT-ES-ST-BACK,TUMB,522,1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3521,PNT-RT-ES-ST-BACK,TUMB,522,-1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3409,PNT-BKADI-K02-CP-BACK,LEV,783,0.5,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3408,PNT-BKADI-K02-CP-BACK,BTN,782,1,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage",
-        "VHF20B(10),3012,PNT-COMM-VOL-RP-BACK,LEV,0,1,0,1,Volume control/Frequency control (0.025 MHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "VHF20B(10),3013,PNT-COMM-VOL-RP-BACK,TUMB,919,0.1,0,1,Volume control/Frequency control (0.025 MHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "VHF20B(10),3013,PNT-COMM-VOL-RP-BACK,TUMB,919,-0.1,0,1,Volume control/Frequency control (0.025 MHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency", "SYSTEMS(2),3011,PNT-GENR-CPR,BTN,318,1,0,1,Generator GROUND FAULT/OVERVOLTAGE Test", "SYSTEMS(2),3011,PNT-GENR-CPR,BTN,318,-1,-1,0,Generator GROUND FAULT/OVERVOLTAGE Test", "INTERCOM(7),3043,PNT-INT-MAINS-RP-BACK,TUMB,947,-0.1,0,0.6,MAIN MODE SELECTOR", "INTERCOM(7),3043,PNT-INT-MAINS-RP-BACK,TUMB,947,0.1,0,0.6,MAIN MODE SELECTOR", "SYSTEMS(2),3051,PNT-TRANSF02-LP,TUMB,131,0.5,0,1,Fuel Transfer Center 1", "SYSTEMS(2),3051,PNT-TRANSF02-LP,TUMB,131,-0.5,0,1,Fuel Transfer Center 1", "VTWU740(11),3008,PNT-UHF-MD-CP,TUMB,233,0.5,0,1,Frequency Mode Dial", "VTWU740(11),3008,PNT-UHF-MD-CP,TUMB,233,-0.5,0,1,Frequency Mode Dial", "SYSTEMS(2),3535,PNT-IFF-TEST-CP,LEV,1257,0.5,0,1,IFF TEST", "SYSTEMS(2),3219,PNT-IFF-TEST-CP,BTN,531,1,0,1,IFF TEST", "SYSTEMS(2),3048,PNT-CANTCOM-LP,BTN,123,1,0,1,Center Wing Tank Qty", "SYSTEMS(2),3119,PNT-BTN-NAV-CP,BTN,336,1,0,1,NAV PRIORITY", "SYSTEMS(2),3227,PNT-RL-LC,LEV,258,0,0,1,ADJUST RED LIGHT - LEFT CONSOLE", "SYSTEMS(2),3001,PNT-BATTERY-CPR,TUMB,315,1,0,1,Battery Master Switch", "SYSTEMS(2),3001,PNT-BATTERY-CPR,TUMB,315,-1,0,1,Battery Master Switch", "INTERCOM(7),3034,PNT-INT-P-HTBT-RP-BACK,TUMB,891,1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "INTERCOM(7),3034,PNT-INT-P-HTBT-RP-BACK,TUMB,891,-1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "VTWU740(11),3021,PNT-UHF-TS-CP-BACK,BTN,875,1,0,1,TEST SELECTOR SWITCH", "VTWU740(11),3021,PNT-UHF-TS-CP-BACK,BTN,875,-1,-1,0,TEST SELECTOR SWITCH", "SYSTEMS(2),3009,PNT-CONV-CPR,TUMB,319,0.5,0,1,AC Inverter Norm/Alt", "SYSTEMS(2),3009,PNT-CONV-CPR,TUMB,319,-0.5,0,1,AC Inverter Norm/Alt", "SYSTEMS(2),3038,PNT-GPU-LP,BTN,134,1,0,1,GPU", "INTERCOM(7),3025,PNT-INT-IVOL-RP-BACK,LEV,894,1,0,1,INT Switch", "INTERCOM(7),3024,PNT-INT-IVOL-RP-BACK,TUMB,884,1,0,1,INT Switch", "INTERCOM(7),3024,PNT-INT-IVOL-RP-BACK,TUMB,884,-1,0,1,INT Switch", "LIGHTS(3),3416,PNT-ALUM-RP-BACK,TUMB,248,0.5,0,1,RED FLOOD LIGHTING", "LIGHTS(3),3416,PNT-ALUM-RP-BACK,TUMB,248,-0.5,0,1,RED FLOOD LIGHTING", "INTERCOM(7),3042,PNT-INT-VUHF-RP-BACK,LEV,1110,1,0,1,V/UHF Switch", "INTERCOM(7),3041,PNT-INT-VUHF-RP-BACK,TUMB,1109,1,0,1,V/UHF Switch", "INTERCOM(7),3041,PNT-INT-VUHF-RP-BACK,TUMB,1109,-1,0,1,V/UHF Switch", "SYSTEMS(2),3475,PNT-CLLAVCOM-LP-BACK,TUMB,814,-1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3475,PNT-CLLAVCOM-LP-BACK,TUMB,814,1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3161,PNT-ADI-DH-DIM-RP,LEV,411,1,0,1,Decision Height setting / ADI/HSI digital displays brightness", "SYSTEMS(2),3347,PNT-ADI-DH-DIM-RP,LEV,412,0,0,1,Decision Height setting / ADI/HSI digital displays brightness", "SYSTEMS(2),3257,PNT-SCAR-BA-KB-CP,TUMB,693,0.33,0,0.99,BOMB ARMING SELECTOR", "SYSTEMS(2),3257,PNT-SCAR-BA-KB-CP,TUMB,693,-0.33,0,0.99,BOMB ARMING SELECTOR", "SYSTEMS(2),3344,PNT-RA-KB-CP,LEV,620,1,0,1,Standby Altimeter Baro Adjust", "ADF_60(13),3006,PNT-ADF-3-RP,LEV,0,1,0,1,Right frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "ADF_60(13),3005,PNT-ADF-3-RP,BTN,0,1,0,1,Right frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "ADF_60(13),3004,PNT-ADF-3-RP,BTN,0,1,0,1,Right frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "SYSTEMS(2),3605,PNT-RA-KB-CP-BACK,LEV,1021,1,0,1,Standby Altimeter Baro Adjust", "SYSTEMS(2),3550,PNT-BACK-ALT-GL-BACK,BTN,1191,1,0,1,Tap Glass", "SYSTEMS(2),3443,PNT-ADI-DH-DIM-RP-BACK,LEV,923,1,0,1,Decision Height setting / ADI/HSI digital displays brightness", "SYSTEMS(2),3601,PNT-ADI-DH-DIM-RP-BACK,LEV,924,0,0,1,Decision Height setting / ADI/HSI digital displays brightness", "VIR31A_DME40(12),3006,PNT-DME-CP,TUMB,340,1,0,1,DME selector", "VIR31A_DME40(12),3006,PNT-DME-CP,TUMB,340,-1,0,1,DME selector", "LIGHTS(3),3418,PNT-CNS-KNB-RP-BACK,LEV,251,0,0,1,CONSOLE INTEGRAL LIGHTING", "SYSTEMS(2),3434,PNT-RL-LC-BACK,LEV,263,0,0,1,ADJUST RED LIGHT - LEFT CONSOLE", "SYSTEMS(2),3226,PNT-CANOPY-EME,TUMB,12,1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3226,PNT-CANOPY-EME,TUMB,12,-1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3406,PNT-AFL-CPR-BACK,TUMB,931,-1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3406,PNT-AFL-CPR-BACK,TUMB,931,1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3516,PNT-STICK-CPD-BACK,TUMB,312,-1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3516,PNT-STICK-CPD-BACK,TUMB,312,1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3026,PNT-ELT-CP,BTN,339,1,0.5,,Emergency locator tranmsitter", "SYSTEMS(2),3026,PNT-ELT-CP,BTN,339,0,0,,Emergency locator tranmsitter", "SYSTEMS(2),3063,PNT-CB-14-LP,TUMB,440,1,0,1,ITT", "SYSTEMS(2),3063,PNT-CB-14-LP,TUMB,440,-1,0,1,ITT", "SYSTEMS(2),3177,PNT-FD-VOR,BTN,214,1,0,1,VOR APPROACH MODE", "VIR31A_DME40(12),3016,PNT-DME-CP-BACK,TUMB,965,1,0,1,DME selector", "VIR31A_DME40(12),3016,PNT-DME-CP-BACK,TUMB,965,-1,0,1,DME selector", "SYSTEMS(2),3354,PNT-FUEL-2-RE-CP,TUMB,726,0.1,0,0.8,EMERGENCY FUEL LEVER", "SYSTEMS(2),3354,PNT-FUEL-2-RE-CP,TUMB,726,-0.1,0,0.8,EMERGENCY FUEL LEVER", "SYSTEMS(2),3413,PNT-FUEGO-CP-BACK,BTN,636,1,0,1,Fire Alert Test", "SYSTEMS(2),3210,PNT-RAD-CPD,TUMB,353,0.5,0,1,RAD TEST SWITCH", "SYSTEMS(2),3210,PNT-RAD-CPD,TUMB,353,-0.5,0,1,RAD TEST SWITCH", "SYSTEMS(2),3271,PNT-SCARD-CB-BT-CP,BTN,573,1,0,1,MODE SELECTOR/CANCEL", "SYSTEMS(2),3340,PNT-CB-ARM-12-LP,TUMB,710,1,0,1,BREAKER MACHINE GUN 2", "SYSTEMS(2),3340,PNT-CB-ARM-12-LP,TUMB,710,-1,0,1,BREAKER MACHINE GUN 2", "INTERCOM(7),3010,PNT-INT-MVOL-RP,LEV,400,1,0,1,MK Switch", "INTERCOM(7),3009,PNT-INT-MVOL-RP,TUMB,286,1,0,1,MK Switch", "INTERCOM(7),3009,PNT-INT-MVOL-RP,TUMB,286,-1,0,1,MK Switch", "SYSTEMS(2),3364,PNT-AL-YLL-BT,BTN,607,1,0,1,Altimeter Test Adjust", "SYSTEMS(2),3310,PNT-HUD-1-RE-CP,LEV,722,0,0,1,Sight Brightness", "SYSTEMS(2),3044,PNT-CBOMSUM-LP,TUMB,119,-1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3044,PNT-CBOMSUM-LP,TUMB,119,1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3429,PNT-OXIGENE-RP-BACK,TUMB,253,1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3429,PNT-OXIGENE-RP-BACK,TUMB,253,-1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3705,PNT-MPR-LGT-BACK,LEV,1318,0.5,0,1,MPR Lamp Test", "SYSTEMS(2),3703,PNT-MPR-LGT-BACK,BTN,1317,1,0,1,MPR Lamp Test", "SYSTEMS(2),3316,PNT-HUD-3S-CP,TUMB,589,0.1,0,1,DEPRESSION XX0", "SYSTEMS(2),3316,PNT-HUD-3S-CP,TUMB,589,-0.1,0,1,DEPRESSION XX0", "SYSTEMS(2),3652,PNT-CANO-FRAC-BACK,LEV,277,0,0,1,CANOPY EMERGENCY FRACTURING", "SYSTEMS(2),3317,PNT-HUD-MS-SW-CP,TUMB,590,0.5,0,1,DEPRESSION AUTO/MAN/TEST", "SYSTEMS(2),3317,PNT-HUD-MS-SW-CP,TUMB,590,-0.5,0,1,DEPRESSION AUTO/MAN/TEST", "SYSTEMS(2),3321,PNT-IFF-1,TUMB,728,0.5,0,1,Function Selector", "SYSTEMS(2),3321,PNT-IFF-1,TUMB,728,-0.5,0,1,Function Selector", "SYSTEMS(2),3089,PNT-CB-05-LP,TUMB,431,1,0,1,POSITION LIGHTS\nRH LAND/TAXI LIGHTS", "SYSTEMS(2),3089,PNT-CB-05-LP,TUMB,431,-1,0,1,POSITION LIGHTS\nRH LAND/TAXI LIGHTS", "SYSTEMS(2),3651,PNT-HSI-BR-CP-BACK,BTN,698,1,0,1,BEARING SELECT PUSHBUTTON", "SYSTEMS(2),3201,PNT-BTN-01-CPL,BTN,328,1,0,1,PITOT HEAT", "SYSTEMS(2),3057,PNT-CB-24-LP,TUMB,450,1,0,1,CAUTION/WARNING PANEL", "SYSTEMS(2),3057,PNT-CB-24-LP,TUMB,450,-1,0,1,CAUTION/WARNING PANEL", "SYSTEMS(2),3403,PNT-BTN-03-CPR-BACK,BTN,938,1,0,1,Right Battery Isolation Switch", "SYSTEMS(2),3343,PNT-CANO-FRAC,LEV,294,0,0,1,CANOPY EMERGENCY FRACTURING", "INTERCOM(7),3015,PNT-INT-ADF-RP,LEV,853,1,0,1,ADF Switch", "INTERCOM(7),3014,PNT-INT-ADF-RP,TUMB,849,1,0,1,ADF Switch", "INTERCOM(7),3014,PNT-INT-ADF-RP,TUMB,849,-1,0,1,ADF Switch", "SYSTEMS(2),3990,PNT-CANO-FRAC-PIN,LEV,1354,0,0,1,CANOPY EMERGENCY FRACTURING SAFETY PIN", "INTERCOM(7),3035,PNT-INT-CALL-RP-BACK,BTN,945,1,0,1,Call button", "SYSTEMS(2),3148,PNT-CLKT-KNB-CP,LEV,517,0.04,0,1,Set Clock Knob", "SYSTEMS(2),3147,PNT-CLKT-KNB-CP,TUMB,518,1,0,1,Set Clock Knob", "SYSTEMS(2),3318,PNT-HUD-ON-SW-CP,TUMB,591,1,0,1,OPTICAL SIGHT ON/OFF", "SYSTEMS(2),3318,PNT-HUD-ON-SW-CP,TUMB,591,-1,0,1,OPTICAL SIGHT ON/OFF", "SYSTEMS(2),3604,PNT-CB-TRIM-LP-BACK,BTN,1105,1,0,1,Rudder Trim Switch", "SYSTEMS(2),3604,PNT-CB-TRIM-LP-BACK,BTN,1105,-1,-1,0,Rudder Trim Switch", "SYSTEMS(2),3254,PNT-SCAR-RC-CP,TUMB,690,1,0,1,MASTER MODE COVER", "SYSTEMS(2),3254,PNT-SCAR-RC-CP,TUMB,690,-1,0,1,MASTER MODE COVER", "SYSTEMS(2),3255,PNT-SCAR-RC-SW-CP,TUMB,691,0.5,0,1,MASTER MODE", "SYSTEMS(2),3255,PNT-SCAR-RC-SW-CP,TUMB,691,-0.5,0,1,MASTER MODE", "SYSTEMS(2),3546,PNT-CB-46-LP,TUMB,472,1,0,1,DME 26 VAC", "SYSTEMS(2),3546,PNT-CB-46-LP,TUMB,472,-1,0,1,DME 26 VAC", "SYSTEMS(2),3336,PNT-CB-ARM-8-LP,TUMB,706,1,0,1,BREAKER PYLON OUT LEFT", "SYSTEMS(2),3336,PNT-CB-ARM-8-LP,TUMB,706,-1,0,1,BREAKER PYLON OUT LEFT", "SYSTEMS(2),3422,PNT-GPU-LP-BACK,BTN,822,1,0,1,GPU", "SYSTEMS(2),3125,PNT-AC-MAN-RP,BTN,424,1,0,1,MANUAL TEMPERATURE CONTROL", "SYSTEMS(2),3125,PNT-AC-MAN-RP,BTN,424,-1,-1,0,MANUAL TEMPERATURE CONTROL", "SYSTEMS(2),3163,PNT-BTN-VHF-CP,BTN,335,1,0,1,VHF PRIORITY", "ADF_60(13),3011,PNT-ADF-TFR-RP,TUMB,680,-1,0,1,Transfer Switch", "ADF_60(13),3011,PNT-ADF-TFR-RP,TUMB,680,1,0,1,Transfer Switch", "SYSTEMS(2),3262,PNT-SCAR-1P-BT-CP,BTN,542,1,0,1,PYLON SELECT #1", "LIGHTS(3),3107,PNT-POSI-RP,TUMB,368,0.5,0,1,NAV LIGHTS", "LIGHTS(3),3107,PNT-POSI-RP,TUMB,368,-0.5,0,1,NAV LIGHTS", "SYSTEMS(2),3637,PNT-SCARD-IC-KB-CP-BACK,TUMB,1285,-0.11,0,0.99,INITIAL CANNON LOAD", "SYSTEMS(2),3637,PNT-SCARD-IC-KB-CP-BACK,TUMB,1285,0.11,0,0.99,INITIAL CANNON LOAD", "SYSTEMS(2),3263,PNT-SCAR-2P-BT-CP,BTN,543,1,0,1,PYLON SELECT #2", "SYSTEMS(2),3266,PNT-SCAR-5P-BT-CP,BTN,546,1,0,1,PYLON SELECT #5", "SYSTEMS(2),3267,PNT-SCAR-6P-BT-CP,BTN,547,1,0,1,PYLON SELECT #6",
-        "VHF20B(10),3002,PNT-COMM-VOL-RP,LEV,0,1,0,1,Volume control/Frequency control (10 kHz). Right mouse click to select FREQUENCY SELECTOR (0.025 MHz). Rotate mouse wheel to select channel", "VHF20B(10),3003,PNT-COMM-VOL-RP,TUMB,655,0.1,0,1,Volume control/Frequency control (10 kHz). Right mouse click to select FREQUENCY SELECTOR (0.025 MHz). Rotate mouse wheel to select channel", "VHF20B(10),3003,PNT-COMM-VOL-RP,TUMB,655,-0.1,0,1,Volume control/Frequency control (10 kHz). Right mouse click to select FREQUENCY SELECTOR (0.025 MHz). Rotate mouse wheel to select channel", "SYSTEMS(2),3345,PNT-AOA-IN-KB-CP,LEV,290,1,0,1,AOA INDICATOR KNOB", "SYSTEMS(2),3100,PNT-CB-48-LP,TUMB,474,1,0,1,FLIGHT DIRECTOR 26 VAC", "SYSTEMS(2),3100,PNT-CB-48-LP,TUMB,474,-1,0,1,FLIGHT DIRECTOR 26 VAC", "SYSTEMS(2),3240,PNT-RUDREG-CPD,LEV,311,0,0,1,Adjust Rudder Pedals", "SYSTEMS(2),3412,PNT-FALLO-CP-BACK,BTN,634,1,0,1,Fault Alert Reset", "ADF_60(13),3009,PNT-ADF-2-RP,LEV,678,1,0,1,Function Selector Switch/Gain control. Left/right mouse click to cycle selector. Rotate mouse wheel to change Gain value", "ADF_60(13),3007,PNT-ADF-2-RP,TUMB,677,0.1,0,0.3,Function Selector Switch/Gain control. Left/right mouse click to cycle selector. Rotate mouse wheel to change Gain value", "ADF_60(13),3007,PNT-ADF-2-RP,TUMB,677,-0.1,0,0.3,Function Selector Switch/Gain control. Left/right mouse click to cycle selector. Rotate mouse wheel to change Gain value", "SYSTEMS(2),3261,PNT-SCAR-SJ-BT-CP,BTN,697,1,0,1,SELECTIVE JETTISON", "SYSTEMS(2),3204,PNT-MST-KNB-CPD,TUMB,347,-0.25,0,1,MASTER SWITCH", "SYSTEMS(2),3204,PNT-MST-KNB-CPD,TUMB,347,0.25,0,1,MASTER SWITCH", "SYSTEMS(2),3533,PNT-BE-MBO-CP-BACK,LEV,1260,0.5,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3444,PNT-BE-MBO-CP-BACK,BTN,968,1,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3554,PNT-CB-TELEBRIEFING-LP,LEV,851,0.5,0,1,TELEBRIEFING", "SYSTEMS(2),3320,PNT-CB-TELEBRIEFING-LP,BTN,718,1,0,1,TELEBRIEFING", "SYSTEMS(2),3410,PNT-ALT-KNB-CP-BACK,LEV,792,1,0,1,Altimeter Baro Adjust", "VTWU740(11),3024,PNT-UHF-3S-CP-BACK,TUMB,864,0.1,0,1,1 MHz Selector", "VTWU740(11),3024,PNT-UHF-3S-CP-BACK,TUMB,864,-0.1,0,1,1 MHz Selector", "SYSTEMS(2),3436,PNT-EMERGAB-LP-BACK,BTN,831,1,0,1,EMERGENCY AIR BRAKE RETRACT", "SYSTEMS(2),3212,PNT-M1D1-CPD,TUMB,355,0.1,0,0.9,MODE 1 - X0", "SYSTEMS(2),3212,PNT-M1D1-CPD,TUMB,355,-0.1,0,0.9,MODE 1 - X0", "SYSTEMS(2),3654,PNT-HUD-1-RE-CP-BACK,LEV,713,0,0,1,Sight Brightness", "SYSTEMS(2),3280,PNT-SEATADJ-LP,BTN,193,1,0,1,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3280,PNT-SEATADJ-LP,BTN,193,-1,-1,0,SEAT HEIGHT ADJUSTMENT", "INTERCOM(7),3013,PNT-INT-MAINV-RP,LEV,403,0,0,1,Intercom volume", "LIGHTS(3),3106,PNT-ANCO-RP,TUMB,366,1,0,1,ANTI-COLLISION BEACON", "LIGHTS(3),3106,PNT-ANCO-RP,TUMB,366,-1,0,1,ANTI-COLLISION BEACON", "SYSTEMS(2),3323,PNT-IFF-3,LEV,730,0.5,0,1,Latitude Correction", "SYSTEMS(2),3217,PNT-M3A4-CPD,TUMB,360,0.1,0,0.9,MODE 3 - 000X", "SYSTEMS(2),3217,PNT-M3A4-CPD,TUMB,360,-0.1,0,0.9,MODE 3 - 000X", "SYSTEMS(2),3325,PNT-IFF-5,BTN,732,1,0,1,Fast Erect", "SYSTEMS(2),3230,PNT-RL-RCP,LEV,261,0,0,1,ADJUST RED LIGHT - RIGHT CENTER PANEL", "SYSTEMS(2),3329,PNT-CB-ARM-1-LP,TUMB,699,1,0,1,BREAKER PYLON OUT RIGHT", "SYSTEMS(2),3329,PNT-CB-ARM-1-LP,TUMB,699,-1,0,1,BREAKER PYLON OUT RIGHT", "SYSTEMS(2),3238,PNT-PARKING-CPL,TUMB,333,0,0,1,Parking Brake", "SYSTEMS(2),3238,PNT-PARKING-CPL,TUMB,333,1,0,1,Parking Brake", "SYSTEMS(2),3330,PNT-CB-ARM-2-LP,TUMB,700,1,0,1,BREAKER PYLON MID RIGHT", "SYSTEMS(2),3330,PNT-CB-ARM-2-LP,TUMB,700,-1,0,1,BREAKER PYLON MID RIGHT", "SYSTEMS(2),3332,PNT-CB-ARM-4-LP,TUMB,702,1,0,1,BREAKER EMERG", "SYSTEMS(2),3332,PNT-CB-ARM-4-LP,TUMB,702,-1,0,1,BREAKER EMERG", "SYSTEMS(2),3061,PNT-CB-13-LP,TUMB,439,1,0,1,RPM N1", "SYSTEMS(2),3061,PNT-CB-13-LP,TUMB,439,-1,0,1,RPM N1", "SYSTEMS(2),3333,PNT-CB-ARM-5-LP,TUMB,703,1,0,1,BREAKER NORMAL", "SYSTEMS(2),3333,PNT-CB-ARM-5-LP,TUMB,703,-1,0,1,BREAKER NORMAL", "SYSTEMS(2),3335,PNT-CB-ARM-7-LP,TUMB,705,1,0,1,BREAKER 115 VAC SIGHT", "SYSTEMS(2),3335,PNT-CB-ARM-7-LP,TUMB,705,-1,0,1,BREAKER 115 VAC SIGHT", "SYSTEMS(2),3438,PNT-RL-LCP-BACK,LEV,264,0,0,1,ADJUST RED LIGHT - LEFT CENTER PANEL", "SYSTEMS(2),3248,PNT-BOX-FRONT,LEV,296,0,0,1,STORAGE BOX COVER", "SYSTEMS(2),3315,PNT-HUD-2S-CP,TUMB,588,0.1,0,1,DEPRESSION X0X", "SYSTEMS(2),3315,PNT-HUD-2S-CP,TUMB,588,-0.1,0,1,DEPRESSION X0X", "VTWU740(11),3010,PNT-UHF-PW-CP,TUMB,235,1,0,1,POWER TRANSMIT SELECTOR", "VTWU740(11),3010,PNT-UHF-PW-CP,TUMB,235,-1,0,1,POWER TRANSMIT SELECTOR", "SYSTEMS(2),3520,PNT-SC-ES-ST-BACK,LEV,521,0,0,1,EJECTION HANDLE SAFETY", "SYSTEMS(2),3118,PNT-THRT-LP,TUMB,5,0.5,0,0.5,THROTTLE IDLE DETENT", "SYSTEMS(2),3337,PNT-CB-ARM-9-LP,TUMB,707,1,0,1,BREAKER PYLON MID LEFT", "SYSTEMS(2),3337,PNT-CB-ARM-9-LP,TUMB,707,-1,0,1,BREAKER PYLON MID LEFT", "SYSTEMS(2),3338,PNT-CB-ARM-10-LP,TUMB,708,1,0,1,BREAKER PYLON IN LEFT", "SYSTEMS(2),3338,PNT-CB-ARM-10-LP,TUMB,708,-1,0,1,BREAKER PYLON IN LEFT", "SYSTEMS(2),3639,PNT-SCAR-EJ-BT-CP-BACK,BTN,597,1,0,1,EMERGENCY JETTISON", "INTERCOM(7),3031,PNT-INT-VOVOL-RP-BACK,LEV,899,1,0,1,VOR Switch", "INTERCOM(7),3030,PNT-INT-VOVOL-RP-BACK,TUMB,889,1,0,1,VOR Switch", "INTERCOM(7),3030,PNT-INT-VOVOL-RP-BACK,TUMB,889,-1,0,1,VOR Switch", "SYSTEMS(2),3341,PNT-CB-ARM-13-LP,TUMB,711,1,0,1,BREAKER ARMING CONTROL", "SYSTEMS(2),3341,PNT-CB-ARM-13-LP,TUMB,711,-1,0,1,BREAKER ARMING CONTROL", "SYSTEMS(2),3342,PNT-CB-ARM-14-LP,TUMB,712,1,0,1,BREAKER SIGHT CAMERA", "SYSTEMS(2),3342,PNT-CB-ARM-14-LP,TUMB,712,-1,0,1,BREAKER SIGHT CAMERA", "SYSTEMS(2),3486,PNT-BTN-UHF-CP-BACK,BTN,837,1,0,1,UHF PRIORITY", "SYSTEMS(2),3068,PNT-CB-21-LP,TUMB,447,1,0,1,LANDING GEAR/AIRBRAKE/TRIM INDICATORS", "SYSTEMS(2),3068,PNT-CB-21-LP,TUMB,447,-1,0,1,LANDING GEAR/AIRBRAKE/TRIM INDICATORS", "SYSTEMS(2),3195,PNT-FD-KNB-RP,TUMB,343,1,0,1,FD Panel Brightness", "SYSTEMS(2),3195,PNT-FD-KNB-RP,TUMB,343,-1,0,1,FD Panel Brightness", "SYSTEMS(2),3294,PNT-CB-48B-LP,TUMB,596,1,0,1,ADC BREAKER", "SYSTEMS(2),3294,PNT-CB-48B-LP,TUMB,596,-1,0,1,ADC BREAKER", "ADF_60(13),3003,PNT-ADF-1-RP,LEV,0,1,0,1,Left frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "ADF_60(13),3002,PNT-ADF-1-RP,BTN,0,1,0,1,Left frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "ADF_60(13),3001,PNT-ADF-1-RP,BTN,0,1,0,1,Left frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob", "SYSTEMS(2),3351,PNT-CB-FUEL-EMER-TA,TUMB,716,-1,0,1,EMERGENCY FUEL Cover", "SYSTEMS(2),3351,PNT-CB-FUEL-EMER-TA,TUMB,716,1,0,1,EMERGENCY FUEL Cover", "SYSTEMS(2),3495,PNT-CB-03-LP-BACK,TUMB,953,1,0,1,RPM N1", "SYSTEMS(2),3495,PNT-CB-03-LP-BACK,TUMB,953,-1,0,1,RPM N1", "SYSTEMS(2),3352,PNT-CB-FUEL-EMER-LP,BTN,715,1,0,1,EMERGENCY FUEL Valve", "SYSTEMS(2),3270,PNT-SCARD-IC-KB-CP,TUMB,569,-0.11,0,0.99,INITIAL CANNON LOAD", "SYSTEMS(2),3270,PNT-SCARD-IC-KB-CP,TUMB,569,0.11,0,0.99,INITIAL CANNON LOAD", "SYSTEMS(2),3070,PNT-CB-12-LP,TUMB,438,1,0,1,VOR DC", "SYSTEMS(2),3070,PNT-CB-12-LP,TUMB,438,-1,0,1,VOR DC", "INTERCOM(7),3038,PNT-INT-ADF-RP-BACK,LEV,1141,1,0,1,ADF Switch", "INTERCOM(7),3037,PNT-INT-ADF-RP-BACK,TUMB,1140,1,0,1,ADF Switch", "INTERCOM(7),3037,PNT-INT-ADF-RP-BACK,TUMB,1140,-1,0,1,ADF Switch", "SYSTEMS(2),3526,PNT-HDG-KNB-CPD-BACK,LEV,944,1,0,1,Heading Knob", "SYSTEMS(2),3256,PNT-SCAR-MA-SW-CP,TUMB,692,1,0,1,MASTER ARM", "SYSTEMS(2),3256,PNT-SCAR-MA-SW-CP,TUMB,692,-1,0,1,MASTER ARM", "SYSTEMS(2),3539,PNT-CB-11-LP,TUMB,437,1,0,1,DME", "SYSTEMS(2),3539,PNT-CB-11-LP,TUMB,437,-1,0,1,DME", "SYSTEMS(2),3206,PNT-TM1-CPD,TUMB,349,1,0,1,TEST M-1 SWITCH", "SYSTEMS(2),3206,PNT-TM1-CPD,TUMB,349,-1,0,1,TEST M-1 SWITCH", "SYSTEMS(2),3269,PNT-SCAR-LT-BT-CP,BTN,568,1,0,1,SCAR LIGHT TEST", "VIR31A_DME40(12),3001,PNT-NAV-MS-RP,LEV,0,1,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3004,PNT-NAV-MS-RP,TUMB,657,0.25,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "VIR31A_DME40(12),3004,PNT-NAV-MS-RP,TUMB,657,-0.25,0,1,Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection", "SYSTEMS(2),3525,PNT-CRS-KNB-CPD-BACK,LEV,943,1,0,1,Course Knob", "SYSTEMS(2),3004,PTN-COV03-CPR,TUMB,326,-1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3004,PTN-COV03-CPR,TUMB,326,1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3095,PNT-CB-40-LP,TUMB,466,1,0,1,U/VHF", "SYSTEMS(2),3095,PNT-CB-40-LP,TUMB,466,-1,0,1,U/VHF", "SYSTEMS(2),3117,PNT-OXIGENE-RP,TUMB,425,1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3117,PNT-OXIGENE-RP,TUMB,425,-1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3093,PNT-CB-45-LP,TUMB,471,1,0,1,INTERPHONE", "SYSTEMS(2),3093,PNT-CB-45-LP,TUMB,471,-1,0,1,INTERPHONE", "SYSTEMS(2),3339,PNT-CB-ARM-11-LP,TUMB,709,1,0,1,BREAKER MACHINE GUN 1", "SYSTEMS(2),3339,PNT-CB-ARM-11-LP,TUMB,709,-1,0,1,BREAKER MACHINE GUN 1", "SYSTEMS(2),3542,PNT-CB-32-LP,TUMB,458,1,0,1,GYRO PLAT 115 VAC", "SYSTEMS(2),3542,PNT-CB-32-LP,TUMB,458,-1,0,1,GYRO PLAT 115 VAC", "SYSTEMS(2),3696,PNT-RUDREG-CPD-BACK,LEV,1202,0,0,1,Adjust Rudder Pedals", "SYSTEMS(2),3099,PNT-CB-33-LP,TUMB,459,1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3099,PNT-CB-33-LP,TUMB,459,-1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3178,PNT-FD-VS,BTN,217,1,0,1,VERTICAL SPEED MODE", "SYSTEMS(2),3078,PNT-CB-34-LP,TUMB,460,1,0,1,VOR AC", "SYSTEMS(2),3078,PNT-CB-34-LP,TUMB,460,-1,0,1,VOR AC", "SYSTEMS(2),3544,PNT-CB-35-LP,TUMB,461,1,0,1,VERT GYRO", "SYSTEMS(2),3544,PNT-CB-35-LP,TUMB,461,-1,0,1,VERT GYRO", "SYSTEMS(2),3018,PNT-AVISO-CP,BTN,515,1,0,1,Caution Alert Reset", "SYSTEMS(2),3016,PNT-FALLO-CP,BTN,513,1,0,1,Fault Alert Reset", "SYSTEMS(2),3175,PNT-FD-APR,BTN,212,1,0,1,APPROACH MODE", "SYSTEMS(2),3293,PNT-CB-36B-LP,TUMB,1189,1,0,1,ADF 26 VAC", "SYSTEMS(2),3293,PNT-CB-36B-LP,TUMB,1189,-1,0,1,ADF 26 VAC", "SYSTEMS(2),3600,PNT-ADI-DH-CP-BACK,BTN,1045,1,0,1,RADIO ALTITUDE SWITCH TEST ADI", "SYSTEMS(2),3547,PNT-CB-47-LP,TUMB,473,1,0,1,GYRO PLAT 26 VAC", "SYSTEMS(2),3547,PNT-CB-47-LP,TUMB,473,-1,0,1,GYRO PLAT 26 VAC",
-        "SYSTEMS(2),3265,PNT-SCAR-4P-BT-CP,BTN,545,1,0,1,PYLON SELECT #4", "SYSTEMS(2),3523,PNT-AIRINLET-RP-BACK,LEV,1230,1,0,1,AIR VENT", "SYSTEMS(2),3680,PNT-CB-UHF-RACAL,TUMB,704,1,0,1,UHF RACAL", "SYSTEMS(2),3680,PNT-CB-UHF-RACAL,TUMB,704,-1,0,1,UHF RACAL", "SYSTEMS(2),3499,PNT-CB-12-LP-BACK,TUMB,949,1,0,1,VOR DC", "SYSTEMS(2),3499,PNT-CB-12-LP-BACK,TUMB,949,-1,0,1,VOR DC", "SYSTEMS(2),3548,PNT-CB-18-LP-BACK,TUMB,903,1,0,1,STALL WARNING SYSTEM", "SYSTEMS(2),3548,PNT-CB-18-LP-BACK,TUMB,903,-1,0,1,STALL WARNING SYSTEM", "SYSTEMS(2),3606,PNT-APL-TEST-CPL-BACK,BTN,1208,1,0,1,STALL WARNING TEST", "SYSTEMS(2),3606,PNT-APL-TEST-CPL-BACK,BTN,1208,-1,-1,0,STALL WARNING TEST", "SYSTEMS(2),3430,PNT-THRT-LP-BACK,TUMB,15,0.5,0,0.5,THROTTLE IDLE DETENT", "SYSTEMS(2),3653,PNT-AOA-IN-KB-CP-BACK,LEV,279,1,0,1,AOA Adjust", "SYSTEMS(2),3473,PNT-EMETBREAK-LP-BACK,TUMB,842,1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3473,PNT-EMETBREAK-LP-BACK,TUMB,842,-1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3407,PNT-AFT-CPR-BACK,TUMB,932,1,0,1,Lamp Test", "SYSTEMS(2),3407,PNT-AFT-CPR-BACK,TUMB,932,1,0,1,Lamp Test", "SYSTEMS(2),3504,PNT-CB-17-LP-BACK,TUMB,950,1,0,1,ENGINE STARTER", "SYSTEMS(2),3504,PNT-CB-17-LP-BACK,TUMB,950,-1,0,1,ENGINE STARTER", "SYSTEMS(2),3326,PNT-IFF-6,TUMB,733,0.5,0,1,Mag Var Control", "SYSTEMS(2),3326,PNT-IFF-6,TUMB,733,-0.5,0,1,Mag Var Control", "SYSTEMS(2),3052,PNT-TRANSF03-LP,TUMB,132,0.5,0,1,Fuel Transfer Center 2", "SYSTEMS(2),3052,PNT-TRANSF03-LP,TUMB,132,-0.5,0,1,Fuel Transfer Center 2", "SYSTEMS(2),3440,PNT-RL-RC-BACK,LEV,267,0,0,1,ADJUST RED LIGHT - RIGHT CONSOLE", "VTWU740(11),3007,PNT-UHF-FS-CP,TUMB,232,0.1,0,0.3,Function Dial", "VTWU740(11),3007,PNT-UHF-FS-CP,TUMB,232,-0.1,0,0.3,Function Dial", "LIGHTS(3),3419,PNT-INTR-KNB-RP-BACK,LEV,250,0,0,1,INSTRUMENT LIGHTING", "SYSTEMS(2),3441,PNT-FFLW-KNB-CP-BACK,BTN,779,-1,1,0,FUEL FLOW RESET", "SYSTEMS(2),3532,PNT-BE-MBM-CP-BACK,LEV,1259,0.5,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3445,PNT-BE-MBM-CP-BACK,BTN,969,1,0,1,MIDDLE MARKER LAMP TEST", "INTERCOM(7),3029,PNT-INT-HVOL-RP-BACK,LEV,897,1,0,1,HM Switch", "INTERCOM(7),3028,PNT-INT-HVOL-RP-BACK,TUMB,887,1,0,1,HM Switch", "INTERCOM(7),3028,PNT-INT-HVOL-RP-BACK,TUMB,887,-1,0,1,HM Switch", "SYSTEMS(2),3291,PNT-CB-12B-LP,TUMB,593,1,0,1,FD BREAKER", "SYSTEMS(2),3291,PNT-CB-12B-LP,TUMB,593,-1,0,1,FD BREAKER", "SYSTEMS(2),3505,PNT-CB-44-LP-BACK,TUMB,961,1,0,1,INTERPHONE", "SYSTEMS(2),3505,PNT-CB-44-LP-BACK,TUMB,961,-1,0,1,INTERPHONE", "SYSTEMS(2),3231,PNT-RL-RC,LEV,262,0,0,1,ADJUST RED LIGHT - RIGHT CONSOLE", "SYSTEMS(2),3112,PNT-AH-BT-LP,BTN,135,1,0,1,ANTI-ICE", "SYSTEMS(2),3012,PNT-AFL-CPR,TUMB,320,-1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3012,PNT-AFL-CPR,TUMB,320,1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3214,PNT-M3A1-CPD,TUMB,357,0.1,0,0.9,MODE 3 - X000", "SYSTEMS(2),3214,PNT-M3A1-CPD,TUMB,357,-0.1,0,0.9,MODE 3 - X000", "SYSTEMS(2),3483,PNT-TRANSF04-LP-BACK,TUMB,821,1,0,1,Fuel Transfer Right/Fwd Cockpit Priority", "SYSTEMS(2),3483,PNT-TRANSF04-LP-BACK,TUMB,821,-1,0,1,Fuel Transfer Right/Fwd Cockpit Priority", "SYSTEMS(2),3534,PNT-IFF-REP-CP,LEV,1256,0.5,0,1,IFF REPLY LAMP TEST", "SYSTEMS(2),3218,PNT-IFF-REP-CP,BTN,530,1,0,1,IFF REPLY LAMP TEST", "INTERCOM(7),3020,PNT-INT-MAINS-RP,TUMB,404,-0.1,0,0.6,MAIN MODE SELECTOR", "INTERCOM(7),3020,PNT-INT-MAINS-RP,TUMB,404,0.1,0,0.6,MAIN MODE SELECTOR", "SYSTEMS(2),3123,PNT-AC-TEMP-RP,TUMB,422,1,0,1,TEMPERATURE MODE", "SYSTEMS(2),3123,PNT-AC-TEMP-RP,TUMB,422,-1,0,1,TEMPERATURE MODE", "SYSTEMS(2),3991,PNT-CANO-FRAC-PIN-BACK,LEV,1355,0,0,1,CANOPY EMERGENCY FRACTURING SAFETY PIN", "SYSTEMS(2),3028,PNT-RALT-CP,TUMB,341,1,0,1,Radio altimeter", "SYSTEMS(2),3028,PNT-RALT-CP,TUMB,341,-1,0,1,Radio altimeter", "SYSTEMS(2),3552,PNT-YB-TRIM-LP,LEV,1274,0.5,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3158,PNT-YB-TRIM-LP,BTN,526,1,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3171,PNT-FD-HDG,BTN,210,1,0,1,HEADING MODE", "VTWU740(11),3003,PNT-UHF-2S-CP,TUMB,227,0.1,0,1,10 MHz Selector", "VTWU740(11),3003,PNT-UHF-2S-CP,TUMB,227,-0.1,0,1,10 MHz Selector", "LIGHTS(3),3420,PNT-LNDG-L-CPL-BACK,TUMB,941,-1,0,1,LEFT LANDING LIGHT/FWD COCKPIT PRIORITY", "LIGHTS(3),3420,PNT-LNDG-L-CPL-BACK,TUMB,941,1,0,1,LEFT LANDING LIGHT/FWD COCKPIT PRIORITY", "SYSTEMS(2),3322,PNT-IFF-2,LEV,729,0.5,0,1,Synchnonizer and Heading Set", "SYSTEMS(2),3082,PNT-CB-18-LP,TUMB,444,1,0,1,PITOT HEAT\nSTALL WARNING SYSTEM", "SYSTEMS(2),3082,PNT-CB-18-LP,TUMB,444,-1,0,1,PITOT HEAT\nSTALL WARNING SYSTEM", "SYSTEMS(2),3638,PNT-SCARD-CB-BT-CP-BACK,BTN,1289,1,0,1,MODE SELECTOR/CANCEL", "SYSTEMS(2),3501,PNT-CB-40-LP-BACK,TUMB,960,1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3501,PNT-CB-40-LP-BACK,TUMB,960,-1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3096,PNT-CB-37-LP,TUMB,463,1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3096,PNT-CB-37-LP,TUMB,463,-1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3203,PNT-CODE-KNB-CPD,TUMB,346,-0.25,0,0.75,CODE SELECT", "SYSTEMS(2),3203,PNT-CODE-KNB-CPD,TUMB,346,0.25,0,0.75,CODE SELECT", "SYSTEMS(2),3515,PNT-CANOPY-EME-BACK,TUMB,302,1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3515,PNT-CANOPY-EME-BACK,TUMB,302,-1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3087,PNT-CB-02-LP,TUMB,428,1,0,1,ENGINE COMPUTER", "SYSTEMS(2),3087,PNT-CB-02-LP,TUMB,428,-1,0,1,ENGINE COMPUTER", "SYSTEMS(2),3423,PNT-COMP-BT-LP-BACK,BTN,824,1,0,1,COMPUTER", "SYSTEMS(2),3538,PNT-CB-10-LP,TUMB,436,1,0,1,GYRO PLATFORM", "SYSTEMS(2),3538,PNT-CB-10-LP,TUMB,436,-1,0,1,GYRO PLATFORM", "SYSTEMS(2),3541,PNT-CB-31-LP,TUMB,457,1,0,1,AIR DATA COMPUTER/FLIGHT DIRECTOR", "SYSTEMS(2),3541,PNT-CB-31-LP,TUMB,457,-1,0,1,AIR DATA COMPUTER/FLIGHT DIRECTOR", "INTERCOM(7),3006,PNT-INT-HVOL-RP,LEV,397,1,0,1,HM Switch", "INTERCOM(7),3005,PNT-INT-HVOL-RP,TUMB,283,1,0,1,HM Switch", "INTERCOM(7),3005,PNT-INT-HVOL-RP,TUMB,283,-1,0,1,HM Switch", "SYSTEMS(2),3176,PNT-FD-BC,BTN,213,1,0,1,BACK COURSE MODE", "SYSTEMS(2),3075,PNT-CB-26-LP,TUMB,452,1,0,1,CENTER WING TANK PUMPS", "SYSTEMS(2),3075,PNT-CB-26-LP,TUMB,452,-1,0,1,CENTER WING TANK PUMPS", "SYSTEMS(2),3688,PNT-ADI-ATTBT-CP-BACK,BTN,995,1,0,1,ATTITUDE TEST", "SYSTEMS(2),3506,PNT-CB-37-LP-BACK,TUMB,956,1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3506,PNT-CB-37-LP-BACK,TUMB,956,-1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3478,PNT-CANTCOM-LP-BACK,BTN,816,1,0,1,Center Wing Tank Qty", "SYSTEMS(2),3485,PNT-BTN-NAV-CP-BACK,BTN,839,1,0,1,NAV PRIORITY", "SYSTEMS(2),3346,PNT-ADI-DH-CP,BTN,683,1,0,1,RADIO ALTITUDE SWITCH TEST ADI", "SYSTEMS(2),3059,PNT-CB-44-LP,TUMB,470,1,0,1,BACKUP ADI", "SYSTEMS(2),3059,PNT-CB-44-LP,TUMB,470,-1,0,1,BACKUP ADI", "SYSTEMS(2),3424,PNT-AH-BT-LP-BACK,BTN,823,1,0,1,ANTI-ICE", "SYSTEMS(2),3157,PNT-EMERGTRP-LP,BTN,148,1,0.5,1,Emergency Elevator Trim Switch", "SYSTEMS(2),3157,PNT-EMERGTRP-LP,BTN,148,0,0.5,0,Emergency Elevator Trim Switch", "VTWU740(11),3026,PNT-UHF-5S-CP-BACK,TUMB,866,0.25,0,1,0.025 MHz Selector", "VTWU740(11),3026,PNT-UHF-5S-CP-BACK,TUMB,866,-0.25,0,1,0.025 MHz Selector", "SYSTEMS(2),3405,PNT-BTN-01-CPR-BACK,BTN,934,1,0,1,ESS BUS Transfer", "SYSTEMS(2),3658,PNT-AL-YLL-BT-BACK,BTN,798,1,0,1,Altimeter Test Adjust", "SYSTEMS(2),3400,PTN-COV02-CPR-BACK,TUMB,935,-1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3400,PTN-COV02-CPR-BACK,TUMB,935,1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3264,PNT-SCAR-3P-BT-CP,BTN,544,1,0,1,PYLON SELECT #3", "SYSTEMS(2),3030,PNT-HDG-KNB-CPD,LEV,345,1,0,1,Heading Knob", "LIGHTS(3),3110,PNT-LNDG-R-CPL,TUMB,330,-0.5,0,1,RIGHT TAXI/LANDING LIGHT", "LIGHTS(3),3110,PNT-LNDG-R-CPL,TUMB,330,0.5,0,1,RIGHT TAXI/LANDING LIGHT", "SYSTEMS(2),3640,PNT-SCAR-LT-BT-CP-BACK,BTN,598,1,0,1,SCAR LIGHT TEST", "SYSTEMS(2),3243,PNT-FRICT-TH,LEV,16,0.5,0,1,THROTTLE FRICTION", "SYSTEMS(2),3435,PNT-EMERGLG-LP-BACK,TUMB,843,0,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3435,PNT-EMERGLG-LP-BACK,TUMB,843,1,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3013,PNT-AFT-CPR,TUMB,321,1,0,1,Lamp Test", "SYSTEMS(2),3013,PNT-AFT-CPR,TUMB,321,1,0,1,Lamp Test", "SYSTEMS(2),3528,PNT-BE-MBI-CP,LEV,1253,0.5,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3169,PNT-BE-MBI-CP,BTN,529,1,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3232,PNT-LG-OVR-CPR,BTN,308,1,0,1,LANDING GEAR OVERRIDE", "LIGHTS(3),3670,PNT-SIGHTGLASS-KNB-RP,LEV,1112,0,0,1,Gunsight Sun Filter", "SYSTEMS(2),3268,PNT-SCAR-EJ-BT-CP,BTN,567,1,0,1,EMERGENCY JETTISON", "SYSTEMS(2),3477,PNT-LLAVCOM-LP-BACK,BTN,815,1,0,1,Engine Fuel Valve", "SYSTEMS(2),3005,PNT-BTN-03-CPR,BTN,327,1,0,1,Right Battery Isolation Switch", "SYSTEMS(2),3149,PNT-CLKC-BT-CP,BTN,519,1,0,1,CHRONOGRAPH", "SYSTEMS(2),3092,PNT-CB-27-LP,TUMB,532,1,0,1,VHF", "SYSTEMS(2),3092,PNT-CB-27-LP,TUMB,532,-1,0,1,VHF", "LIGHTS(3),3417,PNT-CAB-RP-BACK,TUMB,249,1,0,1,STORM LIGHTS", "LIGHTS(3),3417,PNT-CAB-RP-BACK,TUMB,249,-1,0,1,STORM LIGHTS", "SYSTEMS(2),3124,PNT-AC-TEMPKNB-RP,LEV,423,0,0,1,TEMPERATURE REGULATION CONTROL", "SYSTEMS(2),3349,PNT-HSI-BR-CP,BTN,689,1,0,1,BEARING SELECT PUSHBUTTON", "SYSTEMS(2),3260,PNT-SCAR-JS-KB-CP,TUMB,696,0.33,0,0.99,SELECTIVE JETTISON SELECTOR", "SYSTEMS(2),3260,PNT-SCAR-JS-KB-CP,TUMB,696,-0.33,0,0.99,SELECTIVE JETTISON SELECTOR", "SYSTEMS(2),3537,PNT-YB-EP-LP-BACK,LEV,1275,0.5,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3428,PNT-YB-EP-LP-BACK,BTN,828,1,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3049,PNT-TESTFUEL-LP,BTN,124,1,0,1,Test Fuel Qty Indicator", "LIGHTS(3),3104,PNT-CNS-KNB-RP,LEV,365,0,0,1,CONSOLE INTEGRAL LIGHTING", "SYSTEMS(2),3331,PNT-CB-ARM-3-LP,TUMB,701,1,0,1,BREAKER PYLON IN RIGHT", "SYSTEMS(2),3331,PNT-CB-ARM-3-LP,TUMB,701,-1,0,1,BREAKER PYLON IN RIGHT", "SYSTEMS(2),3312,PNT-VIDEO-1-SW-CP,TUMB,720,-0.5,0,1,Video ON/STB/OFF", "SYSTEMS(2),3312,PNT-VIDEO-1-SW-CP,TUMB,720,0.5,0,1,Video ON/STB/OFF", "SYSTEMS(2),3498,PNT-CB-23-LP-BACK,TUMB,955,1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3498,PNT-CB-23-LP-BACK,TUMB,955,-1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3151,PNT-EMERGAB-LP,BTN,147,1,0,1,EMERGENCY AIR BRAKE RETRACT", "SYSTEMS(2),3496,PNT-CB-13-LP-BACK,TUMB,954,1,0,1,RPM N2", "SYSTEMS(2),3496,PNT-CB-13-LP-BACK,TUMB,954,-1,0,1,RPM N2", "SYSTEMS(2),3503,PNT-CB-34-LP-BACK,TUMB,958,1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3503,PNT-CB-34-LP-BACK,TUMB,958,-1,0,1,CONSOLE LIGHTS",
-        "SYSTEMS(2),3236,PNT-CB-49-LP,TUMB,196,1,0,1,PITCH TRIM TONE MUTE", "SYSTEMS(2),3236,PNT-CB-49-LP,TUMB,196,-1,0,1,PITCH TRIM TONE MUTE", "SYSTEMS(2),3235,PNT-BTN-FLUX-CP,BTN,342,1,0,1,FUEL FLOW TEST", "SYSTEMS(2),3045,PNT-CLLAVCOM-LP,TUMB,121,-1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3045,PNT-CLLAVCOM-LP,TUMB,121,1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3122,PNT-AC-VEMERG-RP,TUMB,421,1,0,1,EMERGENCY VENTILATION", "SYSTEMS(2),3122,PNT-AC-VEMERG-RP,TUMB,421,-1,0,1,EMERGENCY VENTILATION", "SYSTEMS(2),3008,PNT-BTN-01-CPR,BTN,323,1,0,1,ESS BUS Transfer", "SYSTEMS(2),3404,PNT-COV01-CPR-BACK,TUMB,933,-1,0,1,ESS BUS Cover", "SYSTEMS(2),3404,PNT-COV01-CPR-BACK,TUMB,933,1,0,1,ESS BUS Cover", "SYSTEMS(2),3047,PNT-LLAVCOM-LP,BTN,122,1,0,1,Engine Fuel Valve", "SYSTEMS(2),3628,PNT-COMMN-TB-RP-BACK,TUMB,915,-1,0,1,NAV TEST SWITCH", "SYSTEMS(2),3628,PNT-COMMN-TB-RP-BACK,TUMB,915,1,0,1,NAV TEST SWITCH", "SYSTEMS(2),3029,PNT-CRS-KNB-CPD,LEV,344,1,0,1,Course Knob", "SYSTEMS(2),3166,PNT-ADI-ATTBT-CP,BTN,117,1,0,1,ATTITUDE TEST", "SYSTEMS(2),3113,PNT-GA-SW-LP,TUMB,137,1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3113,PNT-GA-SW-LP,TUMB,137,-1,0,1,STARTER MODE SELECTOR", "INTERCOM(7),3002,PNT-INT-IVOL-RP,LEV,394,1,0,1,INT Switch", "INTERCOM(7),3001,PNT-INT-IVOL-RP,TUMB,280,1,0,1,INT Switch", "INTERCOM(7),3001,PNT-INT-IVOL-RP,TUMB,280,-1,0,1,INT Switch", "SYSTEMS(2),3085,PNT-CB-17-LP,TUMB,443,1,0,1,ENGINE STARTER", "SYSTEMS(2),3085,PNT-CB-17-LP,TUMB,443,-1,0,1,ENGINE STARTER", "SYSTEMS(2),3054,PNT-CB-01-LP,TUMB,427,1,0,1,ENGINE GENERATOR", "SYSTEMS(2),3054,PNT-CB-01-LP,TUMB,427,-1,0,1,ENGINE GENERATOR", "SYSTEMS(2),3471,PNT-SEATADJ-LP-BACK,BTN,841,1,0,1,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3471,PNT-SEATADJ-LP-BACK,BTN,841,-1,-1,0,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3002,PTN-COV02-CPR,TUMB,324,-1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3002,PTN-COV02-CPR,TUMB,324,1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3042,PNT-ACELKNB-CP,BTN,25,1,0,1,Reset Max/Min Needles", "SYSTEMS(2),3543,PNT-CB-39-LP,TUMB,465,1,0,1,ADF DC", "SYSTEMS(2),3543,PNT-CB-39-LP,TUMB,465,-1,0,1,ADF DC", "LIGHTS(3),3108,PNT-FOR-RP,TUMB,367,0.5,0,1,FORMATION LIGHTS", "LIGHTS(3),3108,PNT-FOR-RP,TUMB,367,-0.5,0,1,FORMATION LIGHTS", "SYSTEMS(2),3704,PNT-MPR-LGT,LEV,1313,0.5,0,1,MPR Lamp Test", "SYSTEMS(2),3702,PNT-MPR-LGT,BTN,1312,1,0,1,MPR Lamp Test", "SYSTEMS(2),3200,PNT-APR-CPL,TUMB,332,1,0,1,STALL WARNING POWER", "SYSTEMS(2),3200,PNT-APR-CPL,TUMB,332,-1,0,1,STALL WARNING POWER", "SYSTEMS(2),3401,PNT-BTN-02-CPR-BACK,BTN,936,1,0,1,Left Battery Isolation Switch", "INTERCOM(7),3027,PNT-INT-VVOL-RP-BACK,LEV,896,1,0,1,VHF Switch", "INTERCOM(7),3026,PNT-INT-VVOL-RP-BACK,TUMB,886,1,0,1,VHF Switch", "INTERCOM(7),3026,PNT-INT-VVOL-RP-BACK,TUMB,886,-1,0,1,VHF Switch", "SYSTEMS(2),3439,PNT-RL-RCP-BACK,LEV,266,0,0,1,ADJUST RED LIGHT - RIGHT CENTER PANEL", "SYSTEMS(2),3213,PNT-M1D2-CPD,TUMB,356,0.1,0,0.9,MODE 1 - 0X", "SYSTEMS(2),3213,PNT-M1D2-CPD,TUMB,356,-0.1,0,0.9,MODE 1 - 0X", "ADF_60(13),3010,PNT-ADF-ONOFF-RP,TUMB,679,1,0,1,ADF Tone Switch", "ADF_60(13),3010,PNT-ADF-ONOFF-RP,TUMB,679,-1,0,1,ADF Tone Switch", "SYSTEMS(2),3156,PNT-ETP-GUARD-LP,TUMB,149,1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3156,PNT-ETP-GUARD-LP,TUMB,149,-1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3327,PNT-IFF-7,TUMB,734,1,0,1,Hemisphere Switch", "SYSTEMS(2),3327,PNT-IFF-7,TUMB,734,-1,0,1,Hemisphere Switch", "SYSTEMS(2),3179,PNT-FD-IAS,BTN,218,1,0,1,INDICATED AIR SPEED MODE", "SYSTEMS(2),3072,PNT-CB-08-LP,TUMB,434,1,0,1,AIR BRAKE\nANTI-SKID OPERATION", "SYSTEMS(2),3072,PNT-CB-08-LP,TUMB,434,-1,0,1,AIR BRAKE\nANTI-SKID OPERATION", "SYSTEMS(2),3088,PNT-CB-07-LP,TUMB,433,1,0,1,ELEVATOR TRIM POWER", "SYSTEMS(2),3088,PNT-CB-07-LP,TUMB,433,-1,0,1,ELEVATOR TRIM POWER", "SYSTEMS(2),3350,PNT-CB-TRIM-LP,BTN,717,1,0,1,Rudder Trim Switch", "SYSTEMS(2),3350,PNT-CB-TRIM-LP,BTN,717,-1,-1,0,Rudder Trim Switch", "SYSTEMS(2),3090,PNT-CB-43-LP,TUMB,469,1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3090,PNT-CB-43-LP,TUMB,469,-1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3466,PNT-AILCOV-LP-BACK,TUMB,829,-1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3466,PNT-AILCOV-LP-BACK,TUMB,829,1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3502,PNT-CB-28-LP-BACK,TUMB,957,1,0,1,INSTRUMENTS AND STORM LIGHTS", "SYSTEMS(2),3502,PNT-CB-28-LP-BACK,TUMB,957,-1,0,1,INSTRUMENTS AND STORM LIGHTS", "SYSTEMS(2),3007,PNT-COV01-CPR,TUMB,322,-1,0,1,ESS BUS Cover", "SYSTEMS(2),3007,PNT-COV01-CPR,TUMB,322,1,0,1,ESS BUS Cover", "SYSTEMS(2),3055,PNT-CB-20-LP,TUMB,446,1,0,1,NORMAL INVERTER", "SYSTEMS(2),3055,PNT-CB-20-LP,TUMB,446,-1,0,1,NORMAL INVERTER", "SYSTEMS(2),3536,PNT-YB-EP-LP,LEV,1273,0.5,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3116,PNT-YB-EP-LP,BTN,525,1,0,1,ENGINE START LIGHT TEST", "LIGHTS(3),3109,PNT-LNDG-L-CPL,TUMB,329,-0.5,0,1,LEFT TAXI/LANDING LIGHT", "LIGHTS(3),3109,PNT-LNDG-L-CPL,TUMB,329,0.5,0,1,LEFT TAXI/LANDING LIGHT", "LIGHTS(3),3252,PNT-MAG-COM-CP,TUMB,850,1,0,1,COMPASS LIGHT", "LIGHTS(3),3252,PNT-MAG-COM-CP,TUMB,850,-1,0,1,COMPASS LIGHT", "SYSTEMS(2),3484,PNT-ANTISKID-CP-BACK,BTN,638,1,0,1,Antiskid ON/OFF", "LIGHTS(3),3671,PNT-SIGHTGLASS-KNB-RP-BACK,LEV,1113,0,0,1,Gunsight Sun Filter", "SYSTEMS(2),3494,PNT-CB-45-LP-BACK,TUMB,959,1,0,1,BACKUP ADI", "SYSTEMS(2),3494,PNT-CB-45-LP-BACK,TUMB,959,-1,0,1,BACKUP ADI", "SYSTEMS(2),3474,PNT-CBOMSUM-LP-BACK,TUMB,812,-1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3474,PNT-CBOMSUM-LP-BACK,TUMB,812,1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3514,PNT-FLAPSH-LP-BACK,TUMB,38,-0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3514,PNT-FLAPSH-LP-BACK,TUMB,38,0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3233,PNT-STICK-CPD,TUMB,309,-1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3233,PNT-STICK-CPD,TUMB,309,1,0,1,SHOW/HIDE FLIGHT STICK", "INTERCOM(7),3011,PNT-INT-P-HTBT-RP,TUMB,287,1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "INTERCOM(7),3011,PNT-INT-P-HTBT-RP,TUMB,287,-1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "SYSTEMS(2),3512,PNT-ERCR-CP-BACK,TUMB,966,1,0,1,Fast Erect", "SYSTEMS(2),3512,PNT-ERCR-CP-BACK,TUMB,966,1,0,1,Fast Erect"],
-    "C-101EB": ["SYSTEMS(2),3050,PNT-TRANSF01-LP,TUMB,130,0.5,0,1,Fuel Transfer Left", "SYSTEMS(2),3050,PNT-TRANSF01-LP,TUMB,130,-0.5,0,1,Fuel Transfer Left", "SYSTEMS(2),3114,PNT-ABRT-SW-LP,TUMB,138,1,0,1,ABORT", "SYSTEMS(2),3114,PNT-ABRT-SW-LP,TUMB,138,1,0,1,ABORT", "SYSTEMS(2),3208,PNT-TM3-CPD,TUMB,351,1,0,1,TEST M-3/A SWITCH", "SYSTEMS(2),3208,PNT-TM3-CPD,TUMB,351,-1,0,1,TEST M-3/A SWITCH", "SYSTEMS(2),3162,PNT-BTN-UHF-CP,BTN,334,1,0,1,UHF PRIORITY", "SYSTEMS(2),3040,PNT-HND-CNPY,TUMB,11,1,0,0,Canopy Safety Catch", "SYSTEMS(2),3040,PNT-HND-CNPY,TUMB,11,-1,0,0,Canopy Safety Catch", "SYSTEMS(2),3115,PNT-START-SW-LP,BTN,139,1,0,1,CONTINUOUS IGNITION/START", "SYSTEMS(2),3115,PNT-START-SW-LP,TUMB,139,-1,-1,0,CONTINUOUS IGNITION/START", "SYSTEMS(2),3426,PNT-ABRT-SW-LP-BACK,TUMB,826,1,0,1,ABORT", "SYSTEMS(2),3426,PNT-ABRT-SW-LP-BACK,TUMB,826,1,0,1,ABORT", "ARC164(11),3035,PNT-UHF-SQL-CP-BACK,TUMB,872,1,0,1,Squelch Switch", "ARC164(11),3035,PNT-UHF-SQL-CP-BACK,TUMB,872,-1,0,1,Squelch Switch", "SYSTEMS(2),3433,PNT-CLKC-BT-CP-BACK,BTN,811,1,0,1,CHRONOGRAPH", "SYSTEMS(2),3098,PNT-CB-30-LP,TUMB,456,1,0,1,CB Formation Lights", "SYSTEMS(2),3098,PNT-CB-30-LP,TUMB,456,-1,0,1,CB Formation Lights", "LIGHTS(3),3103,PNT-CAB-RP,TUMB,369,1,0,1,STORM LIGHTS", "LIGHTS(3),3103,PNT-CAB-RP,TUMB,369,-1,0,1,STORM LIGHTS", "SYSTEMS(2),3027,PNT-ERCR-CP,TUMB,340,1,0,1,Vertical Gyro Fast Erect", "SYSTEMS(2),3027,PNT-ERCR-CP,TUMB,340,1,0,1,Vertical Gyro Fast Erect", "SYSTEMS(2),3531,PNT-BE-MBI-CP-BACK,LEV,1258,0.5,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3446,PNT-BE-MBI-CP-BACK,BTN,970,1,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3530,PNT-BE-MBO-CP,LEV,1255,0.5,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3167,PNT-BE-MBO-CP,BTN,528,1,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3244,PNT-HARN-SEAT,LEV,94,0,0,1,SHOULDER HARNESS CONTROL HANDLE", "SYSTEMS(2),3468,PNT-ETP-GUARD-LP-BACK,TUMB,833,1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3468,PNT-ETP-GUARD-LP-BACK,TUMB,833,-1,0,1,Emergency Elevator Trim Switch Cutout Guard", "INTERCOM(7),3034,PNT-INT-P-HTBT-RP-BACK,TUMB,891,1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "INTERCOM(7),3034,PNT-INT-P-HTBT-RP-BACK,TUMB,891,-1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "LIGHTS(3),3105,PNT-INTR-KNB-RP,LEV,364,0,0,1,INSTRUMENT LIGHTING", "SYSTEMS(2),3160,PNT-EMETBREAK-LP,TUMB,195,1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3160,PNT-EMETBREAK-LP,TUMB,195,-1,0,1,PITCH TRIM BREAKER", "SYSTEMS(2),3489,PNT-LG-RESET-LP-BACK,BTN,770,1,0,1,LANDING GEAR WARNING MUTE", "SYSTEMS(2),3017,PNT-FUEGO-CP,BTN,514,1,0,1,Fire Alert Test", "ARC164(11),3029,PNT_030-BACK,TUMB,864,0.1,0,0.9,1 MHz Selector", "ARC164(11),3029,PNT_030-BACK,TUMB,864,-0.1,0,0.9,1 MHz Selector", "SYSTEMS(2),3415,PNT-ACELKNB-CP-BACK,BTN,774,1,0,1,Reset Max/Min Needles", "SYSTEMS(2),3043,PNT-ANTISKID-CP,BTN,516,1,0,1,Antiskid ON/OFF", "SYSTEMS(2),3524,PNT-LDNG-H-CPL-BACK,TUMB,75,-1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3524,PNT-LDNG-H-CPL-BACK,TUMB,75,1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3553,PNT-YB-TRIM-LP-BACK,LEV,1276,0.5,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3470,PNT-YB-TRIM-LP-BACK,BTN,534,1,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3490,PNT-LG-OVR-CPR-BACK,BTN,939,1,0,1,LANDING GEAR OVERRIDE", "SYSTEMS(2),3202,PNT-LG-RESET-LP,BTN,17,1,0,1,LANDING GEAR WARNING MUTE", "SYSTEMS(2),3509,PNT-LOCK-CNPY-BACK,TUMB,749,1,0,0,Canopy Locking Handle", "SYSTEMS(2),3509,PNT-LOCK-CNPY-BACK,TUMB,749,-1,0,0,Canopy Locking Handle", "ARC164(11),3003,PNT_027,TUMB,227,0.1,0,0.9,10 MHz Selector", "ARC164(11),3003,PNT_027,TUMB,227,-0.1,0,0.9,10 MHz Selector", "SYSTEMS(2),3488,PNT-BTN-01-CPL-BACK,BTN,940,1,0,1,PITOT HEAT", "SYSTEMS(2),3056,PNT-CB-25-LP,TUMB,451,1,0,1,BACKUP INVERTER", "SYSTEMS(2),3056,PNT-CB-25-LP,TUMB,451,-1,0,1,BACKUP INVERTER", "INTERCOM(7),3012,PNT-INT-CALL-RP,BTN,402,1,0,1,Call button", "SYSTEMS(2),3480,PNT-TRANSF01-LP-BACK,TUMB,818,1,0,1,Fuel Transfer Left/Fwd Cockpit Priority", "SYSTEMS(2),3480,PNT-TRANSF01-LP-BACK,TUMB,818,-1,0,1,Fuel Transfer Left/Fwd Cockpit Priority", "SYSTEMS(2),3081,PNT-CB-15-LP,TUMB,441,1,0,1,OIL TEMP IND", "SYSTEMS(2),3081,PNT-CB-15-LP,TUMB,441,-1,0,1,OIL TEMP IND", "SYSTEMS(2),3246,PNT-SC-ES-ST,LEV,538,0,0,1,EJECTION HANDLE SAFETY", "SYSTEMS(2),3402,PTN-COV03-CPR-BACK,TUMB,937,-1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3402,PTN-COV03-CPR-BACK,TUMB,937,1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3492,PNT-PARKING-CPL-BACK,TUMB,65,0,0,1,Parking Brake", "SYSTEMS(2),3492,PNT-PARKING-CPL-BACK,TUMB,65,1,0,1,Parking Brake", "SYSTEMS(2),3224,PNT-FLAPSH-LP,TUMB,14,-0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3224,PNT-FLAPSH-LP,TUMB,14,0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3427,PNT-START-SW-LP-BACK,BTN,827,1,0,1,CONTINUOUS IGNITION/START", "SYSTEMS(2),3427,PNT-START-SW-LP-BACK,TUMB,827,-1,-1,0,CONTINUOUS IGNITION/START", "SYSTEMS(2),3469,PNT-EMERGTRP-LP-BACK,BTN,832,1,0.5,1,Emergency Elevator Trim Switch", "SYSTEMS(2),3469,PNT-EMERGTRP-LP-BACK,BTN,832,0,0.5,0,Emergency Elevator Trim Switch", "SYSTEMS(2),3245,PNT-HN-ES-ST,TUMB,536,1,0,1,EJECTION HANDLE", "SYSTEMS(2),3245,PNT-HN-ES-ST,TUMB,536,-1,0,1,EJECTION HANDLE", "SYSTEMS(2),3247,PNT-RT-ES-ST,TUMB,537,1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3247,PNT-RT-ES-ST,TUMB,537,-1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3250,PNT-LDNG-H-CPL,TUMB,8,-1,0,1,LANDING GEAR HANDLE", "SYSTEMS(2),3250,PNT-LDNG-H-CPL,TUMB,8,1,0,1,LANDING GEAR HANDLE", "ARC164(11),3006,PNT_031,TUMB,230,0.25,0,0.75,0.025 MHz Selector", "ARC164(11),3006,PNT_031,TUMB,230,-0.25,0,0.75,0.025 MHz Selector", "SYSTEMS(2),3518,PNT-HARN-SEAT-BACK,LEV,523,0,0,1,SHOULDER HARNESS CONTROL HANDLE", "SYSTEMS(2),3228,PNT-RL-LCP,LEV,259,0,0,1,ADJUST RED LIGHT - LEFT CENTER PANEL", "SYSTEMS(2),3523,PNT-AIRINLET-RP-BACK,LEV,1230,1,0,1,AIR VENT", "SYSTEMS(2),3500,PNT-CB-15-LP-BACK,TUMB,951,1,0,1,OIL TEMP IND", "SYSTEMS(2),3500,PNT-CB-15-LP-BACK,TUMB,951,-1,0,1,OIL TEMP IND", "SYSTEMS(2),3475,PNT-CLLAVCOM-LP-BACK,TUMB,814,-1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3475,PNT-CLLAVCOM-LP-BACK,TUMB,814,1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3101,PNT-CB-19-LP,TUMB,445,1,0,1,LH LAND/TAXI LIGHT", "SYSTEMS(2),3101,PNT-CB-19-LP,TUMB,445,-1,0,1,LH LAND/TAXI LIGHT", "SYSTEMS(2),3010,PNT-GENL-CPR,TUMB,317,1,0,1,Generator ON/OFF/RESET", "SYSTEMS(2),3010,PNT-GENL-CPR,BTN,317,-1,-1,0,Generator ON/OFF/RESET", "SYSTEMS(2),3242,PNT-AIRINLET-RP,LEV,101,1,0,1,AIR VENT", "SYSTEMS(2),3015,PNT-ALT-KNB-CP,LEV,66,1,0,1,Altimeter Baro Adjust", "LIGHTS(3),3421,PNT-LNDG-R-CPL-BACK,TUMB,942,-1,0,1,RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY", "LIGHTS(3),3421,PNT-LNDG-R-CPL-BACK,TUMB,942,1,0,1,RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY", "LIGHTS(3),3102,PNT-ALUM-RP,TUMB,370,0.5,0,1,RED FLOOD LIGHTING", "LIGHTS(3),3102,PNT-ALUM-RP,TUMB,370,-0.5,0,1,RED FLOOD LIGHTING", "SYSTEMS(2),3643,PNT-CB-12-LP-SMOKE-COLOUR,TUMB,851,1,0,1,Colour Smoke", "SYSTEMS(2),3643,PNT-CB-12-LP-SMOKE-COLOUR,TUMB,851,-1,0,1,Colour Smoke", "SYSTEMS(2),3111,PNT-COMP-BT-LP,BTN,136,1,0,1,COMPUTER", "SYSTEMS(2),3058,PNT-CB-09-LP,TUMB,435,1,0,1,LANDING GEAR", "SYSTEMS(2),3058,PNT-CB-09-LP,TUMB,435,-1,0,1,LANDING GEAR", "SYSTEMS(2),3120,PNT-AC-ACOND-RP,TUMB,419,0.5,0,1,AIR-CONDITIONING MASTER SWITCH", "SYSTEMS(2),3120,PNT-AC-ACOND-RP,TUMB,419,-0.5,0,1,AIR-CONDITIONING MASTER SWITCH", "SYSTEMS(2),3438,PNT-RL-LCP-BACK,LEV,264,0,0,1,ADJUST RED LIGHT - LEFT CENTER PANEL", "INTERCOM(7),3004,PNT-INT-VVOL-RP,LEV,396,1,0,1,VHF Switch", "INTERCOM(7),3003,PNT-INT-VVOL-RP,TUMB,282,1,0,1,VHF Switch", "INTERCOM(7),3003,PNT-INT-VVOL-RP,TUMB,282,-1,0,1,VHF Switch", "SYSTEMS(2),3529,PNT-BE-MBM-CP,LEV,1254,0.5,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3168,PNT-BE-MBM-CP,BTN,527,1,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3508,PNT-HND-CNPY-BACK,TUMB,750,1,0,0,Canopy Safety Catch", "SYSTEMS(2),3508,PNT-HND-CNPY-BACK,TUMB,750,-1,0,0,Canopy Safety Catch", "SYSTEMS(2),3125,PNT-AC-MAN-RP,BTN,424,1,0,1,MANUAL TEMPERATURE CONTROL", "SYSTEMS(2),3125,PNT-AC-MAN-RP,BTN,424,-1,-1,0,MANUAL TEMPERATURE CONTROL", "SYSTEMS(2),3199,PNT-APL-TEST-CPL,BTN,331,1,0,1,STALL WARNING TEST", "SYSTEMS(2),3199,PNT-APL-TEST-CPL,BTN,331,-1,-1,0,STALL WARNING TEST", "SYSTEMS(2),3487,PNT-BTN-VHF-CP-BACK,BTN,838,1,0,1,VHF PRIORITY", "ARC134(10),3015,PNT-VHF-DTEST-RP-BACK,BTN,926,1,0,1,DISPLAY TEST", "SYSTEMS(2),3003,PNT-BTN-02-CPR,BTN,325,1,0,1,Left Battery Isolation Switch", "SYSTEMS(2),3205,PNT-IFFM4L-CPD,TUMB,348,0.5,0,1,AUDIO LIGHT SWITCH", "SYSTEMS(2),3205,PNT-IFFM4L-CPD,TUMB,348,-0.5,0,1,AUDIO LIGHT SWITCH", "SYSTEMS(2),3425,PNT-GA-SW-LP-BACK,TUMB,825,1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3425,PNT-GA-SW-LP-BACK,TUMB,825,-1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3467,PNT-AILBTN-LP-BACK,BTN,830,1,0,1,AILERON HYD OVERRIDE", "SYSTEMS(2),3206,PNT-TM1-CPD,TUMB,349,1,0,1,TEST M-1 SWITCH", "SYSTEMS(2),3206,PNT-TM1-CPD,TUMB,349,-1,0,1,TEST M-1 SWITCH", "ARC134(10),3010,PNT-VHF-PWR-RP-BACK,TUMB,925,1,0,1,POWER SWITCH", "ARC134(10),3010,PNT-VHF-PWR-RP-BACK,TUMB,925,-1,0,1,POWER SWITCH", "SYSTEMS(2),3519,PNT-HN-ES-ST-BACK,TUMB,520,1,0,1,EJECTION HANDLE", "SYSTEMS(2),3519,PNT-HN-ES-ST-BACK,TUMB,520,-1,0,1,EJECTION HANDLE", "SYSTEMS(2),3152,PNT-AILCOV-LP,TUMB,144,-1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3152,PNT-AILCOV-LP,TUMB,144,1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3069,PNT-CB-23-LP,TUMB,449,1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3069,PNT-CB-23-LP,TUMB,449,-1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3074,PNT-CB-41-LP,TUMB,467,1,0,1,FUSELAGE TANK PUMP", "SYSTEMS(2),3074,PNT-CB-41-LP,TUMB,467,-1,0,1,FUSELAGE TANK PUMP", "SYSTEMS(2),3209,PNT-TMC-CPD,TUMB,352,1,0,1,TEST M/C SWITCH", "SYSTEMS(2),3209,PNT-TMC-CPD,TUMB,352,-1,0,1,TEST M/C SWITCH", "SYSTEMS(2),3211,PNT-IFFCS-CPD,TUMB,354,1,0,1,IFF MODE 4", "SYSTEMS(2),3211,PNT-IFFCS-CPD,TUMB,354,-1,0,1,IFF MODE 4", "SYSTEMS(2),3084,PNT-CB-22-LP,TUMB,448,1,0,1,FLAPS INDICATOR\nAILERON INDICATOR", "SYSTEMS(2),3084,PNT-CB-22-LP,TUMB,448,-1,0,1,FLAPS INDICATOR\nAILERON INDICATOR", "SYSTEMS(2),3430,PNT-THRT-LP-BACK,TUMB,15,0.5,0,0.5,THROTTLE IDLE DETENT", "SYSTEMS(2),3207,PNT-TM2-CPD,TUMB,350,1,0,1,TEST M-2 SWITCH", "SYSTEMS(2),3207,PNT-TM2-CPD,TUMB,350,-1,0,1,TEST M-2 SWITCH",
-        "SYSTEMS(2),3481,PNT-TRANSF02-LP-BACK,TUMB,819,1,0,1,Fuel Transfer Center 1/Fwd Cockpit Priority", "SYSTEMS(2),3481,PNT-TRANSF02-LP-BACK,TUMB,819,-1,0,1,Fuel Transfer Center 1/Fwd Cockpit Priority", "SYSTEMS(2),3215,PNT-M3A2-CPD,TUMB,358,0.1,0,0.9,MODE 3 - 0X00", "SYSTEMS(2),3215,PNT-M3A2-CPD,TUMB,358,-0.1,0,0.9,MODE 3 - 0X00", "SYSTEMS(2),3006,PNT-UNIONB-CPR,TUMB,316,1,0,1,DC Bus Tie", "SYSTEMS(2),3006,PNT-UNIONB-CPR,TUMB,316,-1,0,1,DC Bus Tie", "SYSTEMS(2),3094,PNT-CB-28-LP,TUMB,454,1,0,1,INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS", "SYSTEMS(2),3094,PNT-CB-28-LP,TUMB,454,-1,0,1,INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS", "SYSTEMS(2),3221,PNT-AUHF-CP,TUMB,338,0.5,0,1,UHF ANTENNA SELECTION", "SYSTEMS(2),3221,PNT-AUHF-CP,TUMB,338,-0.5,0,1,UHF ANTENNA SELECTION", "SYSTEMS(2),3083,PNT-CB-16-LP,TUMB,442,1,0,1,ANTI-ICE/RAIN REPELLENT", "SYSTEMS(2),3083,PNT-CB-16-LP,TUMB,442,-1,0,1,ANTI-ICE/RAIN REPELLENT", "SYSTEMS(2),3216,PNT-M3A3-CPD,TUMB,359,0.1,0,0.9,MODE 3 - 00X0", "SYSTEMS(2),3216,PNT-M3A3-CPD,TUMB,359,-0.1,0,0.9,MODE 3 - 00X0", "SYSTEMS(2),3535,PNT-IFF-TEST-CP,LEV,1257,0.5,0,1,IFF TEST", "SYSTEMS(2),3219,PNT-IFF-TEST-CP,BTN,531,1,0,1,IFF TEST", "SYSTEMS(2),3220,PNT-IDENT-CPD,TUMB,361,0.5,0,1,IDENT SWITCH", "SYSTEMS(2),3220,PNT-IDENT-CPD,TUMB,361,-0.5,0,1,IDENT SWITCH", "SYSTEMS(2),3041,PNT-LOCK-CNPY,TUMB,13,1,0,0,Canopy Locking Handle", "SYSTEMS(2),3041,PNT-LOCK-CNPY,TUMB,13,-1,0,0,Canopy Locking Handle", "SYSTEMS(2),3239,PNT-MIRROR,LEV,10,0,0,1,Show/Hide Mirror", "SYSTEMS(2),3153,PNT-AILBTN-LP,BTN,145,1,0,1,AILERON HYD OVERRIDE", "SYSTEMS(2),3557,PNT-BLACKOUT-CURTAIN,LEV,256,0,0,1,Blackout curtain", "SYSTEMS(2),3222,PNT-BTN-ANRA-CPL,BTN,314,1,0,1,ANTI-RAIN FLUID", "SYSTEMS(2),3527,PNT-OXYGEN-PRO-BACK,TUMB,1196,1,0,1,OXYGEN PRESSURE WARNING SWITCH", "SYSTEMS(2),3527,PNT-OXYGEN-PRO-BACK,TUMB,1196,-1,0,1,OXYGEN PRESSURE WARNING SWITCH", "SYSTEMS(2),3642,PNT-SLCT-CP-BACK,TUMB,967,1,0,1,Gyro Mode", "SYSTEMS(2),3642,PNT-SLCT-CP-BACK,TUMB,967,-1,0,1,Gyro Mode", "SYSTEMS(2),3691,PNT-SEAT-1,TUMB,1182,-1,0,1,Ejection Seat Priority Lever", "SYSTEMS(2),3691,PNT-SEAT-1,TUMB,1182,1,0,1,Ejection Seat Priority Lever", "SYSTEMS(2),3411,PNT-GLASS-ALT-BACK,BTN,802,1,0,1,Tap Glass", "ARN127(13),3004,PNT-VOR-1KNB-RP,TUMB,377,0.1,0,0.9,108-117", "ARN127(13),3004,PNT-VOR-1KNB-RP,TUMB,377,-0.1,0,0.9,108-117", "ARN127(13),3005,PNT-VOR-2KNB-RP,TUMB,378,0.1,0,0.9,Frequency selector (0-9)", "ARN127(13),3005,PNT-VOR-2KNB-RP,TUMB,378,-0.1,0,0.9,Frequency selector (0-9)", "SYSTEMS(2),3414,PNT-AVISO-CP-BACK,BTN,637,1,0,1,Caution Alert Reset", "ARC164(11),3030,PNT_028-BACK,TUMB,865,0.1,0,0.9,0.1 MHz Selector", "ARC164(11),3030,PNT_028-BACK,TUMB,865,-0.1,0,0.9,0.1 MHz Selector", "ARN127(13),3013,PNT-VOR-1KNB-RP-BACK,TUMB,910,0.1,0,0.9,Frequency selector (108-117)", "ARN127(13),3013,PNT-VOR-1KNB-RP-BACK,TUMB,910,-0.1,0,0.9,Frequency selector (108-117)", "ARN127(13),3014,PNT-VOR-2KNB-RP-BACK,TUMB,911,0.1,0,0.9,Frequency selector (0-9)", "ARN127(13),3014,PNT-VOR-2KNB-RP-BACK,TUMB,911,-0.1,0,0.9,Frequency selector (0-9)", "SYSTEMS(2),3053,PNT-TRANSF04-LP,TUMB,133,0.5,0,1,Fuel Transfer Right", "SYSTEMS(2),3053,PNT-TRANSF04-LP,TUMB,133,-0.5,0,1,Fuel Transfer Right", "ARC164(11),3033,PNT-UHF-MS-CP-BACK,TUMB,868,0.25,0,0.75,Function Dial", "ARC164(11),3033,PNT-UHF-MS-CP-BACK,TUMB,868,-0.25,0,0.75,Function Dial", "SYSTEMS(2),3028,PNT-SLCT-CP,TUMB,341,1,0,1,Gyro Mode", "SYSTEMS(2),3028,PNT-SLCT-CP,TUMB,341,-1,0,1,Gyro Mode", "ARC134(10),3006,PNT-VHF-DTEST-RP,BTN,414,1,0,1,DISPLAY TEST", "SYSTEMS(2),3046,PNT-BOMSUM-LP,BTN,120,1,0,1,Fuselage Tank Pump", "SYSTEMS(2),3076,PNT-CB-38-LP,TUMB,464,1,0,1,OUTER WING TANK PUMPS", "SYSTEMS(2),3076,PNT-CB-38-LP,TUMB,464,-1,0,1,OUTER WING TANK PUMPS", "ARC134(10),3004,PNT-VHF-3SEL-RP,TUMB,417,0.1,0,0.9,Frequency selector (XXX.0XX)", "ARC134(10),3004,PNT-VHF-3SEL-RP,TUMB,417,-0.1,0,0.9,Frequency selector (XXX.0XX)", "ARC134(10),3005,PNT-VHF-4SEL-RP,TUMB,418,0.25,0,0.75,Frequency selector (XXX.X00)", "ARC134(10),3005,PNT-VHF-4SEL-RP,TUMB,418,-0.25,0,0.75,Frequency selector (XXX.X00)", "ARC134(10),3016,PNT-VHF-DIM-RP-BACK,LEV,923,1,0,1,VHF Volume/Brightness", "ARC134(10),3017,PNT-VHF-DIM-RP-BACK,LEV,924,0,0,1,VHF Volume/Brightness", "INTERCOM(7),3008,PNT-INT-VOVOL-RP,LEV,399,1,0,1,VOR Switch", "INTERCOM(7),3007,PNT-INT-VOVOL-RP,TUMB,285,1,0,1,VOR Switch", "INTERCOM(7),3007,PNT-INT-VOVOL-RP,TUMB,285,-1,0,1,VOR Switch", "SYSTEMS(2),3482,PNT-TRANSF03-LP-BACK,TUMB,820,1,0,1,Fuel Transfer Center 2/Fwd Cockpit Priority", "SYSTEMS(2),3482,PNT-TRANSF03-LP-BACK,TUMB,820,-1,0,1,Fuel Transfer Center 2/Fwd Cockpit Priority", "SYSTEMS(2),3091,PNT-CB-42-LP,TUMB,468,1,0,1,FIRE DETECTOR", "SYSTEMS(2),3091,PNT-CB-42-LP,TUMB,468,-1,0,1,FIRE DETECTOR", "SYSTEMS(2),3073,PNT-CB-04-LP,TUMB,430,1,0,1,OIL PRESSURE", "SYSTEMS(2),3073,PNT-CB-04-LP,TUMB,430,-1,0,1,OIL PRESSURE", "ARC134(10),3011,PNT-VHF-1SEL-RP-BACK,TUMB,927,0.25,0,0.75,Frequency selector (X0X.XXX)", "ARC134(10),3011,PNT-VHF-1SEL-RP-BACK,TUMB,927,-0.25,0,0.75,Frequency selector (X0X.XXX)", "ARC134(10),3013,PNT-VHF-3SEL-RP-BACK,TUMB,929,0.1,0,0.9,Frequency selector (XXX.0XX)", "ARC134(10),3013,PNT-VHF-3SEL-RP-BACK,TUMB,929,-0.1,0,0.9,Frequency selector (XXX.0XX)", "ARC164(11),3001,PNT_032,TUMB,231,0.05,0,0.95,Preset Channel Selector", "ARC164(11),3001,PNT_032,TUMB,231,-0.05,0,0.95,Preset Channel Selector", "ARN127(13),3003,PNT-VDIM-KNB-RP,LEV,383,0,0,1,DIMMER", "SYSTEMS(2),3241,PNT-BKADI-K02-CP,LEV,533,0.5,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3014,PNT-BKADI-K02-CP,BTN,41,1,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3234,PNT-FFLW-KNB-CP,BTN,32,-1,1,0,FUEL FLOW RESET", "INTERCOM(7),3040,PNT-INT-TVOL-RP-BACK,LEV,898,1,0,1,TCN Switch", "INTERCOM(7),3039,PNT-INT-TVOL-RP-BACK,TUMB,888,1,0,1,TCN Switch", "INTERCOM(7),3039,PNT-INT-TVOL-RP-BACK,TUMB,888,-1,0,1,TCN Switch", "INTERCOM(7),3033,PNT-INT-MVOL-RP-BACK,LEV,901,1,0,1,MK Switch", "INTERCOM(7),3032,PNT-INT-MVOL-RP-BACK,TUMB,890,1,0,1,MK Switch", "INTERCOM(7),3032,PNT-INT-MVOL-RP-BACK,TUMB,890,-1,0,1,MK Switch", "SYSTEMS(2),3071,PNT-CB-06-LP,TUMB,432,1,0,1,AIR-CONDITIONING/PRESSURIZATION", "SYSTEMS(2),3071,PNT-CB-06-LP,TUMB,432,-1,0,1,AIR-CONDITIONING/PRESSURIZATION", "ARC164(11),3008,PNT-UHF-MS-CP,TUMB,232,0.25,0,0.75,Function Dial", "ARC164(11),3008,PNT-UHF-MS-CP,TUMB,232,-0.25,0,0.75,Function Dial", "SYSTEMS(2),3497,PNT-CB-14-LP-BACK,TUMB,952,1,0,1,ITT", "SYSTEMS(2),3497,PNT-CB-14-LP-BACK,TUMB,952,-1,0,1,ITT", "SYSTEMS(2),3095,PNT-CB-29-LP,TUMB,455,1,0,1,UHF", "SYSTEMS(2),3095,PNT-CB-29-LP,TUMB,455,-1,0,1,UHF", "ARC164(11),3010,PNT-UHF-SQL-CP,TUMB,236,1,0,1,Squelch Switch", "ARC164(11),3010,PNT-UHF-SQL-CP,TUMB,236,-1,0,1,Squelch Switch", "SYSTEMS(2),3476,PNT-BOMSUM-LP-BACK,BTN,813,1,0,1,Fuselage Tank Pump", "ARC164(11),3011,PNT-UHF-VOL-CP,LEV,234,0,0,1,Volume control", "SYSTEMS(2),3150,PNT-EMERGLG-LP,TUMB,197,0,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3150,PNT-EMERGLG-LP,TUMB,197,1,0,1,EMERGENCY LANDING GEAR EXTENSION", "ARC164(11),3016,PNT-UHF-PR-BTN,BTN,855,1,0,1,UHF Preset Button", "SYSTEMS(2),3522,PNT-BOX-FRONT-BACK,LEV,1310,0,0,1,STORAGE BOX COVER", "INTERCOM(7),3036,PNT-INT-MAINV-RP-BACK,LEV,946,0,0,1,Intercom volume", "ARN127(13),3006,PNT-VOR-3KNB-RP,TUMB,379,0.5,0,0.5,Frequency selector (00/50)", "ARN127(13),3006,PNT-VOR-3KNB-RP,TUMB,379,-0.5,0,0.5,Frequency selector (00/50)", "SYSTEMS(2),3521,PNT-RT-ES-ST-BACK,TUMB,522,1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3521,PNT-RT-ES-ST-BACK,TUMB,522,-1,0,1,MANUAL SEPERATION HANDLE", "SYSTEMS(2),3409,PNT-BKADI-K02-CP-BACK,LEV,783,0.5,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "SYSTEMS(2),3408,PNT-BKADI-K02-CP-BACK,BTN,782,1,0,1,Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage", "ARN127(13),3011,PNT-TSTDIM-BT-RP-BACK,BTN,915,1,0,1,TEST VHF NAV DIGITS", "SYSTEMS(2),3011,PNT-GENR-CPR,BTN,318,1,0,1,Generator GROUND FAULT/OVERVOLTAGE Test", "SYSTEMS(2),3011,PNT-GENR-CPR,BTN,318,-1,-1,0,Generator GROUND FAULT/OVERVOLTAGE Test", "INTERCOM(7),3041,PNT-INT-MAINS-RP-BACK,TUMB,947,-0.5,0,1,Selector switch", "INTERCOM(7),3041,PNT-INT-MAINS-RP-BACK,TUMB,947,0.5,0,1,Selector switch", "SYSTEMS(2),3051,PNT-TRANSF02-LP,TUMB,131,0.5,0,1,Fuel Transfer Center 1", "SYSTEMS(2),3051,PNT-TRANSF02-LP,TUMB,131,-0.5,0,1,Fuel Transfer Center 1", "ARC164(11),3032,PNT-UHF-MOD-CP-BACK,TUMB,869,0.5,0,1,Frequency Mode Dial", "ARC164(11),3032,PNT-UHF-MOD-CP-BACK,TUMB,869,-0.5,0,1,Frequency Mode Dial", "ARC134(10),3007,PNT-VHF-DIM-RP,LEV,411,1,0,1,VHF Volume/Brightness", "ARC134(10),3008,PNT-VHF-DIM-RP,LEV,412,0,0,1,VHF Volume/Brightness", "SYSTEMS(2),3048,PNT-CANTCOM-LP,BTN,123,1,0,1,Center Wing Tank Qty", "SYSTEMS(2),3119,PNT-BTN-NAV-CP,BTN,336,1,0,1,NAV PRIORITY", "SYSTEMS(2),3227,PNT-RL-LC,LEV,258,0,0,1,ADJUST RED LIGHT - LEFT CONSOLE", "SYSTEMS(2),3001,PNT-BATTERY-CPR,TUMB,315,1,0,1,Battery Master Switch", "SYSTEMS(2),3001,PNT-BATTERY-CPR,TUMB,315,-1,0,1,Battery Master Switch", "SYSTEMS(2),3004,PTN-COV03-CPR,TUMB,326,-1,0,1,Right Battery Isolation Cover", "SYSTEMS(2),3004,PTN-COV03-CPR,TUMB,326,1,0,1,Right Battery Isolation Cover", "ARC164(11),3040,PNT-UHF-COVER-BACK,LEV,1167,0,0,1,UHF Cover", "SYSTEMS(2),3009,PNT-CONV-CPR,TUMB,319,0.5,0,1,AC Inverter Norm/Alt", "SYSTEMS(2),3009,PNT-CONV-CPR,TUMB,319,-0.5,0,1,AC Inverter Norm/Alt", "SYSTEMS(2),3038,PNT-GPU-LP,BTN,134,1,0,1,GPU", "INTERCOM(7),3025,PNT-INT-IVOL-RP-BACK,LEV,894,1,0,1,INT Switch", "INTERCOM(7),3024,PNT-INT-IVOL-RP-BACK,TUMB,884,1,0,1,INT Switch", "INTERCOM(7),3024,PNT-INT-IVOL-RP-BACK,TUMB,884,-1,0,1,INT Switch", "LIGHTS(3),3416,PNT-ALUM-RP-BACK,TUMB,248,0.5,0,1,RED FLOOD LIGHTING", "LIGHTS(3),3416,PNT-ALUM-RP-BACK,TUMB,248,-0.5,0,1,RED FLOOD LIGHTING", "ARC164(11),3013,PNT-UHF-DI,BTN,207,1,0,1,UHF Digital Display Frequency mode/Test switch", "ARC164(11),3012,PNT-UHF-DI,TUMB,207,1,-1,0,UHF Digital Display Frequency mode/Test switch", "ARC164(11),3014,PNT-UHF-DIM,LEV,206,0,0,1,UHF Digital Display Dimmer",
-        "ARN127(13),3012,PNT-VDIM-KNB-RP-BACK,LEV,916,0,0,1,DIMMER", "ARC164(11),3038,PNT-UHF-DI-BACK,BTN,844,1,0,1,UHF Digital Display Frequency mode/Test switch", "ARC164(11),3037,PNT-UHF-DI-BACK,TUMB,844,1,-1,0,UHF Digital Display Frequency mode/Test switch", "ARC164(11),3039,PNT-UHF-DIM-BACK,LEV,845,0,0,1,UHF Digital Display Dimmer", "SYSTEMS(2),3165,PNT-ADI-PKNB-CP,LEV,112,1,0,1,ADI Pitch Adjust", "SYSTEMS(2),3171,PNT-FD-HDG-CP,BTN,211,1,0,1,HEADING MODE", "SYSTEMS(2),3172,PNT-FD-ALT-CP,BTN,212,1,0,1,ALTITUDE HOLD MODE", "SYSTEMS(2),3176,PNT-FD-GS-CP,BTN,216,1,0,1,GLIDESLOPE MODE", "ARC164(11),3034,PNT-UHF-TONE-CP-BACK,BTN,871,1,0,1,T-Tone", "LIGHTS(3),3418,PNT-CNS-KNB-RP-BACK,LEV,251,0,0,1,CONSOLE INTEGRAL LIGHTING", "SYSTEMS(2),3434,PNT-RL-LC-BACK,LEV,263,0,0,1,ADJUST RED LIGHT - LEFT CONSOLE", "SYSTEMS(2),3226,PNT-CANOPY-EME,TUMB,12,1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3226,PNT-CANOPY-EME,TUMB,12,-1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3406,PNT-AFL-CPR-BACK,TUMB,931,-1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3406,PNT-AFL-CPR-BACK,TUMB,931,1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3516,PNT-STICK-CPD-BACK,TUMB,312,-1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3516,PNT-STICK-CPD-BACK,TUMB,312,1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3178,PNT-FD-SBY-CP,BTN,218,1,0,1,STANDBY MODE", "SYSTEMS(2),3229,PNT-RL-LTP,LEV,260,0,0,1,ADJUST RED LIGHT - TOP CENTER PANEL", "SYSTEMS(2),3640,PNT-RL-LTP-BACK,LEV,265,0,0,1,ADJUST RED LIGHT - TOP CENTER PANEL", "INTERCOM(7),3015,PNT-INT-UVOL-RP,LEV,395,1,0,1,UHF Switch", "INTERCOM(7),3014,PNT-INT-UVOL-RP,TUMB,281,1,0,1,UHF Switch", "INTERCOM(7),3014,PNT-INT-UVOL-RP,TUMB,281,-1,0,1,UHF Switch", "INTERCOM(7),3017,PNT-INT-TVOL-RP,LEV,398,1,0,1,TCN Switch", "INTERCOM(7),3016,PNT-INT-TVOL-RP,TUMB,284,1,0,1,TCN Switch", "INTERCOM(7),3016,PNT-INT-TVOL-RP,TUMB,284,-1,0,1,TCN Switch", "SYSTEMS(2),3413,PNT-FUEGO-CP-BACK,BTN,636,1,0,1,Fire Alert Test", "SYSTEMS(2),3210,PNT-RAD-CPD,TUMB,353,0.5,0,1,RAD TEST SWITCH", "SYSTEMS(2),3210,PNT-RAD-CPD,TUMB,353,-0.5,0,1,RAD TEST SWITCH", "INTERCOM(7),3038,PNT-INT-UVOL-RP-BACK,LEV,895,1,0,1,UHF Switch", "INTERCOM(7),3037,PNT-INT-UVOL-RP-BACK,TUMB,885,1,0,1,UHF Switch", "INTERCOM(7),3037,PNT-INT-UVOL-RP-BACK,TUMB,885,-1,0,1,UHF Switch", "SYSTEMS(2),3062,PNT-CB-03-LP,TUMB,429,1,0,1,RPM N2", "SYSTEMS(2),3062,PNT-CB-03-LP,TUMB,429,-1,0,1,RPM N2", "INTERCOM(7),3010,PNT-INT-MVOL-RP,LEV,400,1,0,1,MK Switch", "INTERCOM(7),3009,PNT-INT-MVOL-RP,TUMB,286,1,0,1,MK Switch", "INTERCOM(7),3009,PNT-INT-MVOL-RP,TUMB,286,-1,0,1,MK Switch", "ARC164(11),3031,PNT_031-BACK,TUMB,866,0.25,0,0.75,0.025 MHz Selector", "ARC164(11),3031,PNT_031-BACK,TUMB,866,-0.25,0,0.75,0.025 MHz Selector", "SYSTEMS(2),3432,PNT-CLKT-KNB-CP-BACK,LEV,809,0.04,0,1,Set Clock Knob", "SYSTEMS(2),3431,PNT-CLKT-KNB-CP-BACK,TUMB,810,1,0,1,Set Clock Knob", "SYSTEMS(2),3044,PNT-CBOMSUM-LP,TUMB,119,-1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3044,PNT-CBOMSUM-LP,TUMB,119,1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3429,PNT-OXIGENE-RP-BACK,TUMB,253,1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3429,PNT-OXIGENE-RP-BACK,TUMB,253,-1,0,1,OXYGEN SUPPLY", "ARC134(10),3001,PNT-VHF-PWR-RP,TUMB,413,1,0,1,POWER SWITCH", "ARC134(10),3001,PNT-VHF-PWR-RP,TUMB,413,-1,0,1,POWER SWITCH", "SYSTEMS(2),3551,PNT-IFR-HOOD,TUMB,329,1,0,1,Close/open IFR hood", "SYSTEMS(2),3551,PNT-IFR-HOOD,TUMB,329,-1,0,1,Close/open IFR hood", "SYSTEMS(2),3037,PNT-BTN-VT-CP,BTN,337,1,0,1,VOR/TCN Nav Selector", "SYSTEMS(2),3026,PNT-SINCR-CP,BTN,339,1,0.5,1,Manual Gyro Correction", "SYSTEMS(2),3026,PNT-SINCR-CP,BTN,339,0,0.5,0,Manual Gyro Correction", "SYSTEMS(2),3237,PNT-AIRS-KNB-CP,LEV,102,1,0,1,Airspeed Indicator Bug", "SYSTEMS(2),3089,PNT-CB-05-LP,TUMB,431,1,0,1,POSITION LIGHTS\nRH LAND/TAXI LIGHTS", "SYSTEMS(2),3089,PNT-CB-05-LP,TUMB,431,-1,0,1,POSITION LIGHTS\nRH LAND/TAXI LIGHTS", "SYSTEMS(2),3443,PNT-BHSI-KB-CP-BACK,LEV,766,1,0,1,HSI Digit Brightness", "SYSTEMS(2),3201,PNT-BTN-01-CPL,BTN,328,1,0,1,PITOT HEAT", "SYSTEMS(2),3057,PNT-CB-24-LP,TUMB,450,1,0,1,CAUTION/WARNING PANEL", "SYSTEMS(2),3057,PNT-CB-24-LP,TUMB,450,-1,0,1,CAUTION/WARNING PANEL", "SYSTEMS(2),3403,PNT-BTN-03-CPR-BACK,BTN,938,1,0,1,Right Battery Isolation Switch", "SYSTEMS(2),3641,PNT-BTN-VT-CP-BACK,BTN,840,1,0,1,VOR/TCN Nav Selector", "SYSTEMS(2),3174,PNT-FD-VL-CP,BTN,214,1,0,1,VOR/LOC MODE", "SYSTEMS(2),3491,PNT-AIRS-KNB-CP-BACK,LEV,803,1,0,1,Airspeed Indicator Bug", "INTERCOM(7),3035,PNT-INT-CALL-RP-BACK,BTN,945,1,0,1,Call button", "SYSTEMS(2),3148,PNT-CLKT-KNB-CP,LEV,517,0.04,0,1,Set Clock Knob", "SYSTEMS(2),3147,PNT-CLKT-KNB-CP,TUMB,518,1,0,1,Set Clock Knob", "SYSTEMS(2),3063,PNT-CB-14-LP,TUMB,440,1,0,1,ITT", "SYSTEMS(2),3063,PNT-CB-14-LP,TUMB,440,-1,0,1,ITT", "ARN118(12),3001,PNT-TCN-KNB1D-RP,LEV,387,0.1,0,1,00x-12x. Rotate mouse wheel to select", "ARN118(12),3003,PTR-TACAN-CHANNEL-SELECTOR-2,TUMB,389,1,0,1,Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "ARN118(12),3002,PTR-TACAN-CHANNEL-SELECTOR-2,LEV,388,0.1,0,1,Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "ARN118(12),3004,PNT-TCN-TSTBT-RP,BTN,390,1,0,1,TACAN TEST", "SYSTEMS(2),3100,PNT-CB-46-LP,TUMB,472,1,0,1,FLIGHT DIRECTOR", "SYSTEMS(2),3100,PNT-CB-46-LP,TUMB,472,-1,0,1,FLIGHT DIRECTOR", "SYSTEMS(2),3086,PNT-CB-36-LP,TUMB,462,1,0,1,IFF PRIM DC", "SYSTEMS(2),3086,PNT-CB-36-LP,TUMB,462,-1,0,1,IFF PRIM DC", "SYSTEMS(2),3422,PNT-GPU-LP-BACK,BTN,822,1,0,1,GPU", "ARC164(11),3009,PNT-UHF-TONE-CP,BTN,235,1,0,1,T-Tone", "SYSTEMS(2),3163,PNT-BTN-VHF-CP,BTN,335,1,0,1,VHF PRIORITY", "SYSTEMS(2),3090,PNT-CB-40-LP,TUMB,466,1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3090,PNT-CB-40-LP,TUMB,466,-1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3093,PNT-CB-44-LP,TUMB,470,1,0,1,INTERPHONE", "SYSTEMS(2),3093,PNT-CB-44-LP,TUMB,470,-1,0,1,INTERPHONE", "LIGHTS(3),3107,PNT-POSI-RP,TUMB,368,0.5,0,1,NAV LIGHTS", "LIGHTS(3),3107,PNT-POSI-RP,TUMB,368,-0.5,0,1,NAV LIGHTS", "SYSTEMS(2),3059,PNT-CB-45-LP,TUMB,471,1,0,1,BACKUP ADI", "SYSTEMS(2),3059,PNT-CB-45-LP,TUMB,471,-1,0,1,BACKUP ADI", "SYSTEMS(2),3066,PNT-CB-32-LP,TUMB,458,1,0,1,VERTICAL GYRO AC", "SYSTEMS(2),3066,PNT-CB-32-LP,TUMB,458,-1,0,1,VERTICAL GYRO AC", "SYSTEMS(2),3079,PNT-TEST,TUMB,459,1,0,1,TACAN AC 115", "SYSTEMS(2),3079,PNT-TEST,TUMB,459,-1,0,1,TACAN AC 115", "SYSTEMS(2),3065,PNT-CB-11-LP,TUMB,437,1,0,1,DIRECTIONAL GYRO DC", "SYSTEMS(2),3065,PNT-CB-11-LP,TUMB,437,-1,0,1,DIRECTIONAL GYRO DC", "SYSTEMS(2),3650,PNT-SINCR-CP-BACK,BTN,965,1,0.5,1,Manual Gyro Correction", "SYSTEMS(2),3650,PNT-SINCR-CP-BACK,BTN,965,0,0.5,0,Manual Gyro Correction", "SYSTEMS(2),3600,PNT-ADI-PKNB-CP-BACK,LEV,990,1,0,1,ADI Pitch Adjust", "SYSTEMS(2),3078,PNT-CB-48-LP,TUMB,532,1,0,1,VOR AC 26", "SYSTEMS(2),3078,PNT-CB-48-LP,TUMB,532,-1,0,1,VOR AC 26", "SYSTEMS(2),3240,PNT-RUDREG-CPD,LEV,311,0,0,1,Adjust Rudder Pedals", "SYSTEMS(2),3412,PNT-FALLO-CP-BACK,BTN,634,1,0,1,Fault Alert Reset", "ARC164(11),3028,PNT_027-BACK,TUMB,863,0.1,0,0.9,10 MHz Selector", "ARC164(11),3028,PNT_027-BACK,TUMB,863,-0.1,0,0.9,10 MHz Selector", "SYSTEMS(2),3080,PNT-CB-47-LP,TUMB,473,1,0,1,TACAN AC 26", "SYSTEMS(2),3080,PNT-CB-47-LP,TUMB,473,-1,0,1,TACAN AC 26", "SYSTEMS(2),3204,PNT-MST-KNB-CPD,TUMB,347,-0.25,0,1,MASTER SWITCH", "SYSTEMS(2),3204,PNT-MST-KNB-CPD,TUMB,347,0.25,0,1,MASTER SWITCH", "SYSTEMS(2),3533,PNT-BE-MBO-CP-BACK,LEV,1260,0.5,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3444,PNT-BE-MBO-CP-BACK,BTN,968,1,0,1,OUTER MARKER LAMP TEST", "SYSTEMS(2),3121,PNT-AC-SELFLU-RP,TUMB,420,1,0,1,AIR FLOW MODE", "SYSTEMS(2),3121,PNT-AC-SELFLU-RP,TUMB,420,-1,0,1,AIR FLOW MODE", "SYSTEMS(2),3410,PNT-ALT-KNB-CP-BACK,LEV,792,1,0,1,Altimeter Baro Adjust", "SYSTEMS(2),3644,PNT-CB-12-SMOKE-WHITE,TUMB,852,1,0,1,White Smoke", "SYSTEMS(2),3644,PNT-CB-12-SMOKE-WHITE,TUMB,852,-1,0,1,White Smoke", "SYSTEMS(2),3436,PNT-EMERGAB-LP-BACK,BTN,831,1,0,1,EMERGENCY AIR BRAKE RETRACT", "SYSTEMS(2),3212,PNT-M1D1-CPD,TUMB,355,0.1,0,0.9,MODE 1 - X0", "SYSTEMS(2),3212,PNT-M1D1-CPD,TUMB,355,-0.1,0,0.9,MODE 1 - X0", "SYSTEMS(2),3280,PNT-SEATADJ-LP,BTN,193,1,0,1,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3280,PNT-SEATADJ-LP,BTN,193,-1,-1,0,SEAT HEIGHT ADJUSTMENT", "INTERCOM(7),3013,PNT-INT-MAINV-RP,LEV,403,0,0,1,Intercom volume", "LIGHTS(3),3106,PNT-ANCO-RP,TUMB,366,1,0,1,ANTI-COLLISION BEACON", "LIGHTS(3),3106,PNT-ANCO-RP,TUMB,366,-1,0,1,ANTI-COLLISION BEACON", "ARC164(11),3015,PNT-UHF-COVER,LEV,854,0,0,1,UHF Cover", "SYSTEMS(2),3217,PNT-M3A4-CPD,TUMB,360,0.1,0,0.9,MODE 3 - 000X", "SYSTEMS(2),3217,PNT-M3A4-CPD,TUMB,360,-0.1,0,0.9,MODE 3 - 000X", "SYSTEMS(2),3230,PNT-RL-RCP,LEV,261,0,0,1,ADJUST RED LIGHT - RIGHT CENTER PANEL", "SYSTEMS(2),3238,PNT-PARKING-CPL,TUMB,333,0,0,1,Parking Brake", "SYSTEMS(2),3238,PNT-PARKING-CPL,TUMB,333,1,0,1,Parking Brake", "ARN118(12),3005,PNT-TCN-VOL-RP,LEV,392,0,0,1,TACAN Volume", "SYSTEMS(2),3061,PNT-CB-13-LP,TUMB,439,1,0,1,RPM N1", "SYSTEMS(2),3061,PNT-CB-13-LP,TUMB,439,-1,0,1,RPM N1", "SYSTEMS(2),3248,PNT-BOX-FRONT,LEV,296,0,0,1,STORAGE BOX COVER", "SYSTEMS(2),3520,PNT-SC-ES-ST-BACK,LEV,521,0,0,1,EJECTION HANDLE SAFETY", "SYSTEMS(2),3118,PNT-THRT-LP,TUMB,5,0.5,0,0.5,THROTTLE IDLE DETENT", "ARN127(13),3002,PNT-TSTDIM-BT-RP,BTN,382,1,0,1,TEST VHF NAV DIGITS", "SYSTEMS(2),3630,PNT-DIM-FD-BACK,TUMB,846,1,0,1,FD Bright/Dim", "SYSTEMS(2),3630,PNT-DIM-FD-BACK,TUMB,846,-1,0,1,FD Bright/Dim", "INTERCOM(7),3031,PNT-INT-VOVOL-RP-BACK,LEV,899,1,0,1,VOR Switch", "INTERCOM(7),3030,PNT-INT-VOVOL-RP-BACK,TUMB,889,1,0,1,VOR Switch", "INTERCOM(7),3030,PNT-INT-VOVOL-RP-BACK,TUMB,889,-1,0,1,VOR Switch", "SYSTEMS(2),3486,PNT-BTN-UHF-CP-BACK,BTN,837,1,0,1,UHF PRIORITY", "SYSTEMS(2),3068,PNT-CB-21-LP,TUMB,447,1,0,1,LANDING GEAR/AIRBRAKE/TRIM INDICATORS", "SYSTEMS(2),3068,PNT-CB-21-LP,TUMB,447,-1,0,1,LANDING GEAR/AIRBRAKE/TRIM INDICATORS", "SYSTEMS(2),3179,PNT-FD-GSE-CP,BTN,219,1,0,1,GLIDESLOPE EXTENDED MODE", "SYSTEMS(2),3495,PNT-CB-03-LP-BACK,TUMB,953,1,0,1,RPM N1", "SYSTEMS(2),3495,PNT-CB-03-LP-BACK,TUMB,953,-1,0,1,RPM N1", "ARN127(13),3001,PNT-TSTVOR-BT-RP,BTN,381,1,0,1,TEST VOR/MKR", "SYSTEMS(2),3070,PNT-CB-12-LP,TUMB,438,1,0,1,VOR DC",
-        "SYSTEMS(2),3070,PNT-CB-12-LP,TUMB,438,-1,0,1,VOR DC", "ARN127(13),3016,PNT-VLM-KNB-RP-BACK,LEV,913,1,0,1,NAV VOL", "SYSTEMS(2),3526,PNT-HDG-KNB-CPD-BACK,LEV,944,1,0,1,Heading Knob", "SYSTEMS(2),3097,PNT-CB-35-LP,TUMB,461,1,0,1,IFF AC 115", "SYSTEMS(2),3097,PNT-CB-35-LP,TUMB,461,-1,0,1,IFF AC 115", "SYSTEMS(2),3525,PNT-CRS-KNB-CPD-BACK,LEV,943,1,0,1,Course Knob", "ARC164(11),3036,PNT-UHF-VOL-CP-BACK,LEV,870,0,0,1,Volume control", "SYSTEMS(2),3117,PNT-OXIGENE-RP,TUMB,425,1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3117,PNT-OXIGENE-RP,TUMB,425,-1,0,1,OXYGEN SUPPLY", "SYSTEMS(2),3170,PNT-FD-GOA-CP,BTN,210,1,0,1,GO-AROUND MODE", "SYSTEMS(2),3696,PNT-RUDREG-CPD-BACK,LEV,1202,0,0,1,Adjust Rudder Pedals", "ARC134(10),3014,PNT-VHF-4SEL-RP-BACK,TUMB,930,0.25,0,0.75,Frequency selector (XXX.X00)", "ARC134(10),3014,PNT-VHF-4SEL-RP-BACK,TUMB,930,-0.25,0,0.75,Frequency selector (XXX.X00)", "SYSTEMS(2),3018,PNT-AVISO-CP,BTN,515,1,0,1,Caution Alert Reset", "SYSTEMS(2),3016,PNT-FALLO-CP,BTN,513,1,0,1,Fault Alert Reset", "SYSTEMS(2),3499,PNT-CB-12-LP-BACK,TUMB,949,1,0,1,VOR DC", "SYSTEMS(2),3499,PNT-CB-12-LP-BACK,TUMB,949,-1,0,1,VOR DC", "ARC164(11),3004,PNT_030,TUMB,228,0.1,0,0.9,1 MHz Selector", "ARC164(11),3004,PNT_030,TUMB,228,-0.1,0,0.9,1 MHz Selector", "SYSTEMS(2),3407,PNT-AFT-CPR-BACK,TUMB,932,1,0,1,Lamp Test", "SYSTEMS(2),3407,PNT-AFT-CPR-BACK,TUMB,932,1,0,1,Lamp Test", "SYSTEMS(2),3504,PNT-CB-17-LP-BACK,TUMB,950,1,0,1,ENGINE STARTER", "SYSTEMS(2),3504,PNT-CB-17-LP-BACK,TUMB,950,-1,0,1,ENGINE STARTER", "SYSTEMS(2),3052,PNT-TRANSF03-LP,TUMB,132,0.5,0,1,Fuel Transfer Center 2", "SYSTEMS(2),3052,PNT-TRANSF03-LP,TUMB,132,-0.5,0,1,Fuel Transfer Center 2", "SYSTEMS(2),3440,PNT-RL-RC-BACK,LEV,267,0,0,1,ADJUST RED LIGHT - RIGHT CONSOLE", "LIGHTS(3),3419,PNT-INTR-KNB-RP-BACK,LEV,250,0,0,1,INSTRUMENT LIGHTING", "SYSTEMS(2),3441,PNT-FFLW-KNB-CP-BACK,BTN,779,-1,1,0,FUEL FLOW RESET", "SYSTEMS(2),3532,PNT-BE-MBM-CP-BACK,LEV,1259,0.5,0,1,MIDDLE MARKER LAMP TEST", "SYSTEMS(2),3445,PNT-BE-MBM-CP-BACK,BTN,969,1,0,1,MIDDLE MARKER LAMP TEST", "INTERCOM(7),3029,PNT-INT-HVOL-RP-BACK,LEV,897,1,0,1,HM Switch", "INTERCOM(7),3028,PNT-INT-HVOL-RP-BACK,TUMB,887,1,0,1,HM Switch", "INTERCOM(7),3028,PNT-INT-HVOL-RP-BACK,TUMB,887,-1,0,1,HM Switch", "SYSTEMS(2),3505,PNT-CB-44-LP-BACK,TUMB,961,1,0,1,INTERPHONE", "SYSTEMS(2),3505,PNT-CB-44-LP-BACK,TUMB,961,-1,0,1,INTERPHONE", "ARC134(10),3003,PNT-VHF-2SEL-RP,TUMB,416,0.1,0,0.9,Frequency selector (XX0.XXX)", "ARC134(10),3003,PNT-VHF-2SEL-RP,TUMB,416,-0.1,0,0.9,Frequency selector (XX0.XXX)", "SYSTEMS(2),3177,PNT-FD-REV-CP,BTN,217,1,0,1,ILS/LOC REVERSE MODE", "SYSTEMS(2),3231,PNT-RL-RC,LEV,262,0,0,1,ADJUST RED LIGHT - RIGHT CONSOLE", "SYSTEMS(2),3112,PNT-AH-BT-LP,BTN,135,1,0,1,ANTI-ICE", "SYSTEMS(2),3012,PNT-AFL-CPR,TUMB,320,-1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3012,PNT-AFL-CPR,TUMB,320,1,0,1,CAWS Panel Bright/Dim", "SYSTEMS(2),3214,PNT-M3A1-CPD,TUMB,357,0.1,0,0.9,MODE 3 - X000", "SYSTEMS(2),3214,PNT-M3A1-CPD,TUMB,357,-0.1,0,0.9,MODE 3 - X000", "SYSTEMS(2),3483,PNT-TRANSF04-LP-BACK,TUMB,821,1,0,1,Fuel Transfer Right/Fwd Cockpit Priority", "SYSTEMS(2),3483,PNT-TRANSF04-LP-BACK,TUMB,821,-1,0,1,Fuel Transfer Right/Fwd Cockpit Priority", "SYSTEMS(2),3534,PNT-IFF-REP-CP,LEV,1256,0.5,0,1,IFF REPLY LAMP TEST", "SYSTEMS(2),3218,PNT-IFF-REP-CP,BTN,530,1,0,1,IFF REPLY LAMP TEST", "INTERCOM(7),3018,PNT-INT-MAINS-RP,TUMB,404,-0.5,0,1,Selector switch", "INTERCOM(7),3018,PNT-INT-MAINS-RP,TUMB,404,0.5,0,1,Selector switch", "SYSTEMS(2),3123,PNT-AC-TEMP-RP,TUMB,422,1,0,1,TEMPERATURE MODE", "SYSTEMS(2),3123,PNT-AC-TEMP-RP,TUMB,422,-1,0,1,TEMPERATURE MODE", "ARC134(10),3002,PNT-VHF-1SEL-RP,TUMB,415,0.25,0,0.75,Frequency selector (X0X.XXX)", "ARC134(10),3002,PNT-VHF-1SEL-RP,TUMB,415,-0.25,0,0.75,Frequency selector (X0X.XXX)", "SYSTEMS(2),3552,PNT-YB-TRIM-LP,LEV,1274,0.5,0,1,PITCH TRIM DISC LAMP TEST", "SYSTEMS(2),3158,PNT-YB-TRIM-LP,BTN,526,1,0,1,PITCH TRIM DISC LAMP TEST", "ARN118(12),3006,PNT-TCN-MAIN-RP,TUMB,393,0.25,0,1,TACAN Mode", "ARN118(12),3006,PNT-TCN-MAIN-RP,TUMB,393,-0.25,0,1,TACAN Mode", "LIGHTS(3),3420,PNT-LNDG-L-CPL-BACK,TUMB,941,-1,0,1,LEFT LANDING LIGHT/FWD COCKPIT PRIORITY", "LIGHTS(3),3420,PNT-LNDG-L-CPL-BACK,TUMB,941,1,0,1,LEFT LANDING LIGHT/FWD COCKPIT PRIORITY", "SYSTEMS(2),3082,PNT-CB-18-LP,TUMB,444,1,0,1,PITOT HEAT\nSTALL WARNING SYSTEM", "SYSTEMS(2),3082,PNT-CB-18-LP,TUMB,444,-1,0,1,PITOT HEAT\nSTALL WARNING SYSTEM", "SYSTEMS(2),3501,PNT-CB-40-LP-BACK,TUMB,960,1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3501,PNT-CB-40-LP-BACK,TUMB,960,-1,0,1,RED COCKPIT LIGHTING", "SYSTEMS(2),3096,PNT-CB-37-LP,TUMB,463,1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3096,PNT-CB-37-LP,TUMB,463,-1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3203,PNT-CODE-KNB-CPD,TUMB,346,-0.25,0,0.75,CODE SELECT", "SYSTEMS(2),3203,PNT-CODE-KNB-CPD,TUMB,346,0.25,0,0.75,CODE SELECT", "SYSTEMS(2),3515,PNT-CANOPY-EME-BACK,TUMB,302,1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3515,PNT-CANOPY-EME-BACK,TUMB,302,-1,0,1,CANOPY EMERGENCY JETTISON", "SYSTEMS(2),3087,PNT-CB-02-LP,TUMB,428,1,0,1,ENGINE COMPUTER", "SYSTEMS(2),3087,PNT-CB-02-LP,TUMB,428,-1,0,1,ENGINE COMPUTER", "SYSTEMS(2),3423,PNT-COMP-BT-LP-BACK,BTN,824,1,0,1,COMPUTER", "SYSTEMS(2),3064,PNT-CB-10-LP,TUMB,436,1,0,1,VERTICAL GYRO DC", "SYSTEMS(2),3064,PNT-CB-10-LP,TUMB,436,-1,0,1,VERTICAL GYRO DC", "SYSTEMS(2),3067,PNT-CB-31-LP,TUMB,457,1,0,1,DIRECTIONAL GYRO AC", "SYSTEMS(2),3067,PNT-CB-31-LP,TUMB,457,-1,0,1,DIRECTIONAL GYRO AC", "INTERCOM(7),3006,PNT-INT-HVOL-RP,LEV,397,1,0,1,HM Switch", "INTERCOM(7),3005,PNT-INT-HVOL-RP,TUMB,283,1,0,1,HM Switch", "INTERCOM(7),3005,PNT-INT-HVOL-RP,TUMB,283,-1,0,1,HM Switch", "SYSTEMS(2),3173,PNT-FD-PAT-CP,BTN,213,1,0,1,PITCH MODE", "SYSTEMS(2),3075,PNT-CB-26-LP,TUMB,452,1,0,1,CENTER WING TANK PUMPS", "SYSTEMS(2),3075,PNT-CB-26-LP,TUMB,452,-1,0,1,CENTER WING TANK PUMPS", "SYSTEMS(2),3688,PNT-ADI-ATTBT-CP-BACK,BTN,995,1,0,1,ATTITUDE TEST", "SYSTEMS(2),3506,PNT-CB-37-LP-BACK,TUMB,956,1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3506,PNT-CB-37-LP-BACK,TUMB,956,-1,0,1,SEAT ADJUSTMENT", "SYSTEMS(2),3478,PNT-CANTCOM-LP-BACK,BTN,816,1,0,1,Center Wing Tank Qty", "SYSTEMS(2),3485,PNT-BTN-NAV-CP-BACK,BTN,839,1,0,1,NAV PRIORITY", "ARC164(11),3002,PNT_029,TUMB,226,0.1,0,0.1,100 MHz Selector", "ARC164(11),3002,PNT_029,TUMB,226,-0.1,0,0.1,100 MHz Selector", "SYSTEMS(2),3424,PNT-AH-BT-LP-BACK,BTN,823,1,0,1,ANTI-ICE", "SYSTEMS(2),3157,PNT-EMERGTRP-LP,BTN,148,1,0.5,1,Emergency Elevator Trim Switch", "SYSTEMS(2),3157,PNT-EMERGTRP-LP,BTN,148,0,0.5,0,Emergency Elevator Trim Switch", "ARN127(13),3015,PNT-VOR-3KNB-RP-BACK,TUMB,912,0.5,0,0.5,Frequency selector (00/50)", "ARN127(13),3015,PNT-VOR-3KNB-RP-BACK,TUMB,912,-0.5,0,0.5,Frequency selector (00/50)", "SYSTEMS(2),3405,PNT-BTN-01-CPR-BACK,BTN,934,1,0,1,ESS BUS Transfer", "SYSTEMS(2),3400,PTN-COV02-CPR-BACK,TUMB,935,-1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3400,PTN-COV02-CPR-BACK,TUMB,935,1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3030,PNT-HDG-KNB-CPD,LEV,345,1,0,1,Heading Knob", "LIGHTS(3),3110,PNT-LNDG-R-CPL,TUMB,330,-0.5,0,1,RIGHT TAXI/LANDING LIGHT", "LIGHTS(3),3110,PNT-LNDG-R-CPL,TUMB,330,0.5,0,1,RIGHT TAXI/LANDING LIGHT", "ARC164(11),3041,PNT-UHF-PR-BTN-BACK,BTN,1169,1,0,1,UHF Preset Button", "SYSTEMS(2),3243,PNT-FRICT-TH,LEV,16,0.5,0,1,THROTTLE FRICTION", "SYSTEMS(2),3435,PNT-EMERGLG-LP-BACK,TUMB,843,0,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3435,PNT-EMERGLG-LP-BACK,TUMB,843,1,0,1,EMERGENCY LANDING GEAR EXTENSION", "SYSTEMS(2),3013,PNT-AFT-CPR,TUMB,321,1,0,1,Lamp Test", "SYSTEMS(2),3013,PNT-AFT-CPR,TUMB,321,1,0,1,Lamp Test", "SYSTEMS(2),3528,PNT-BE-MBI-CP,LEV,1253,0.5,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3169,PNT-BE-MBI-CP,BTN,529,1,0,1,INNER MARKER LAMP TEST", "SYSTEMS(2),3232,PNT-LG-OVR-CPR,BTN,308,1,0,1,LANDING GEAR OVERRIDE", "ARC134(10),3012,PNT-VHF-2SEL-RP-BACK,TUMB,928,0.1,0,0.9,Frequency selector (XX0.XXX)", "ARC134(10),3012,PNT-VHF-2SEL-RP-BACK,TUMB,928,-0.1,0,0.9,Frequency selector (XX0.XXX)", "SYSTEMS(2),3477,PNT-LLAVCOM-LP-BACK,BTN,815,1,0,1,Engine Fuel Valve", "SYSTEMS(2),3005,PNT-BTN-03-CPR,BTN,327,1,0,1,Right Battery Isolation Switch", "SYSTEMS(2),3149,PNT-CLKC-BT-CP,BTN,519,1,0,1,CHRONOGRAPH", "SYSTEMS(2),3060,PNT-CB-27-LP,TUMB,453,1,0,1,FUEL MEASURING SYSTEM", "SYSTEMS(2),3060,PNT-CB-27-LP,TUMB,453,-1,0,1,FUEL MEASURING SYSTEM", "ARC164(11),3027,PNT_029-BACK,TUMB,862,0.1,0,0.1,100 MHz Selector", "ARC164(11),3027,PNT_029-BACK,TUMB,862,-0.1,0,0.1,100 MHz Selector", "ARN127(13),3007,PNT-VLM-KNB-RP,LEV,380,1,0,1,NAV VOL", "LIGHTS(3),3417,PNT-CAB-RP-BACK,TUMB,249,1,0,1,STORM LIGHTS", "LIGHTS(3),3417,PNT-CAB-RP-BACK,TUMB,249,-1,0,1,STORM LIGHTS", "SYSTEMS(2),3124,PNT-AC-TEMPKNB-RP,LEV,423,0,0,1,TEMPERATURE REGULATION CONTROL", "SYSTEMS(2),3161,PNT-BHSI-KB-CP,LEV,343,1,0,1,HSI Digit Brightness", "SYSTEMS(2),3537,PNT-YB-EP-LP-BACK,LEV,1275,0.5,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3428,PNT-YB-EP-LP-BACK,BTN,828,1,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3049,PNT-TESTFUEL-LP,BTN,124,1,0,1,Test Fuel Qty Indicator", "LIGHTS(3),3104,PNT-CNS-KNB-RP,LEV,365,0,0,1,CONSOLE INTEGRAL LIGHTING", "ARN127(13),3010,PNT-TSTVOR-BT-RP-BACK,BTN,914,1,0,1,TEST VOR/MKR", "SYSTEMS(2),3498,PNT-CB-23-LP-BACK,TUMB,955,1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3498,PNT-CB-23-LP-BACK,TUMB,955,-1,0,1,OXY SYS\nHYD SYS PRESS IND", "SYSTEMS(2),3151,PNT-EMERGAB-LP,BTN,147,1,0,1,EMERGENCY AIR BRAKE RETRACT", "SYSTEMS(2),3496,PNT-CB-13-LP-BACK,TUMB,954,1,0,1,RPM N2", "SYSTEMS(2),3496,PNT-CB-13-LP-BACK,TUMB,954,-1,0,1,RPM N2", "SYSTEMS(2),3503,PNT-CB-34-LP-BACK,TUMB,958,1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3503,PNT-CB-34-LP-BACK,TUMB,958,-1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3236,PNT-CB-49-LP,TUMB,196,1,0,1,PITCH TRIM TONE MUTE", "SYSTEMS(2),3236,PNT-CB-49-LP,TUMB,196,-1,0,1,PITCH TRIM TONE MUTE", "SYSTEMS(2),3235,PNT-BTN-FLUX-CP,BTN,342,1,0,1,FUEL FLOW TEST", "SYSTEMS(2),3045,PNT-CLLAVCOM-LP,TUMB,121,-1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3045,PNT-CLLAVCOM-LP,TUMB,121,1,0,1,Engine Fuel Valve Cover", "SYSTEMS(2),3122,PNT-AC-VEMERG-RP,TUMB,421,1,0,1,EMERGENCY VENTILATION", "SYSTEMS(2),3122,PNT-AC-VEMERG-RP,TUMB,421,-1,0,1,EMERGENCY VENTILATION",
-        "SYSTEMS(2),3008,PNT-BTN-01-CPR,BTN,323,1,0,1,ESS BUS Transfer", "SYSTEMS(2),3404,PNT-COV01-CPR-BACK,TUMB,933,-1,0,1,ESS BUS Cover", "SYSTEMS(2),3404,PNT-COV01-CPR-BACK,TUMB,933,1,0,1,ESS BUS Cover", "SYSTEMS(2),3047,PNT-LLAVCOM-LP,BTN,122,1,0,1,Engine Fuel Valve", "SYSTEMS(2),3175,PNT-FD-APP-CP,BTN,215,1,0,1,APPROACH ARM", "SYSTEMS(2),3099,PNT-CB-34-LP,TUMB,460,1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3099,PNT-CB-34-LP,TUMB,460,-1,0,1,CONSOLE LIGHTS", "SYSTEMS(2),3029,PNT-CRS-KNB-CPD,LEV,344,1,0,1,Course Knob", "SYSTEMS(2),3166,PNT-ADI-ATTBT-CP,BTN,117,1,0,1,ATTITUDE TEST", "SYSTEMS(2),3113,PNT-GA-SW-LP,TUMB,137,1,0,1,STARTER MODE SELECTOR", "SYSTEMS(2),3113,PNT-GA-SW-LP,TUMB,137,-1,0,1,STARTER MODE SELECTOR", "INTERCOM(7),3002,PNT-INT-IVOL-RP,LEV,394,1,0,1,INT Switch", "INTERCOM(7),3001,PNT-INT-IVOL-RP,TUMB,280,1,0,1,INT Switch", "INTERCOM(7),3001,PNT-INT-IVOL-RP,TUMB,280,-1,0,1,INT Switch", "ARC164(11),3007,PNT-UHF-MOD-CP,TUMB,233,0.5,0,1,Frequency Mode Dial", "ARC164(11),3007,PNT-UHF-MOD-CP,TUMB,233,-0.5,0,1,Frequency Mode Dial", "SYSTEMS(2),3085,PNT-CB-17-LP,TUMB,443,1,0,1,ENGINE STARTER", "SYSTEMS(2),3085,PNT-CB-17-LP,TUMB,443,-1,0,1,ENGINE STARTER", "SYSTEMS(2),3054,PNT-CB-01-LP,TUMB,427,1,0,1,ENGINE GENERATOR", "SYSTEMS(2),3054,PNT-CB-01-LP,TUMB,427,-1,0,1,ENGINE GENERATOR", "ARC164(11),3005,PNT_028,TUMB,229,0.1,0,0.9,0.1 MHz Selector", "ARC164(11),3005,PNT_028,TUMB,229,-0.1,0,0.9,0.1 MHz Selector", "SYSTEMS(2),3471,PNT-SEATADJ-LP-BACK,BTN,841,1,0,1,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3471,PNT-SEATADJ-LP-BACK,BTN,841,-1,-1,0,SEAT HEIGHT ADJUSTMENT", "SYSTEMS(2),3002,PTN-COV02-CPR,TUMB,324,-1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3002,PTN-COV02-CPR,TUMB,324,1,0,1,Left Battery Isolation Cover", "SYSTEMS(2),3042,PNT-ACELKNB-CP,BTN,25,1,0,1,Reset Max/Min Needles", "SYSTEMS(2),3077,PNT-CB-39-LP,TUMB,465,1,0,1,TACAN DC", "SYSTEMS(2),3077,PNT-CB-39-LP,TUMB,465,-1,0,1,TACAN DC", "LIGHTS(3),3108,PNT-FOR-RP,TUMB,367,0.5,0,1,FORMATION LIGHTS", "LIGHTS(3),3108,PNT-FOR-RP,TUMB,367,-0.5,0,1,FORMATION LIGHTS", "SYSTEMS(2),3200,PNT-APR-CPL,TUMB,332,1,0,1,STALL WARNING POWER", "SYSTEMS(2),3200,PNT-APR-CPL,TUMB,332,-1,0,1,STALL WARNING POWER", "SYSTEMS(2),3401,PNT-BTN-02-CPR-BACK,BTN,936,1,0,1,Left Battery Isolation Switch", "INTERCOM(7),3027,PNT-INT-VVOL-RP-BACK,LEV,896,1,0,1,VHF Switch", "INTERCOM(7),3026,PNT-INT-VVOL-RP-BACK,TUMB,886,1,0,1,VHF Switch", "INTERCOM(7),3026,PNT-INT-VVOL-RP-BACK,TUMB,886,-1,0,1,VHF Switch", "SYSTEMS(2),3439,PNT-RL-RCP-BACK,LEV,266,0,0,1,ADJUST RED LIGHT - RIGHT CENTER PANEL", "SYSTEMS(2),3213,PNT-M1D2-CPD,TUMB,356,0.1,0,0.9,MODE 1 - 0X", "SYSTEMS(2),3213,PNT-M1D2-CPD,TUMB,356,-0.1,0,0.9,MODE 1 - 0X", "SYSTEMS(2),3156,PNT-ETP-GUARD-LP,TUMB,149,1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3156,PNT-ETP-GUARD-LP,TUMB,149,-1,0,1,Emergency Elevator Trim Switch Cutout Guard", "SYSTEMS(2),3164,PNT-GLASS-ALT,BTN,68,1,0,1,Tap Glass", "ARC164(11),3026,PNT_032-BACK,TUMB,867,0.05,0,0.95,Preset Channel Selector", "ARC164(11),3026,PNT_032-BACK,TUMB,867,-0.05,0,0.95,Preset Channel Selector", "SYSTEMS(2),3072,PNT-CB-08-LP,TUMB,434,1,0,1,AIR BRAKE\nANTI-SKID OPERATION", "SYSTEMS(2),3072,PNT-CB-08-LP,TUMB,434,-1,0,1,AIR BRAKE\nANTI-SKID OPERATION", "SYSTEMS(2),3088,PNT-CB-07-LP,TUMB,433,1,0,1,ELEVATOR TRIM POWER", "SYSTEMS(2),3088,PNT-CB-07-LP,TUMB,433,-1,0,1,ELEVATOR TRIM POWER", "SYSTEMS(2),3092,PNT-CB-43-LP,TUMB,469,1,0,1,VHF DC ESS", "SYSTEMS(2),3092,PNT-CB-43-LP,TUMB,469,-1,0,1,VHF DC ESS", "SYSTEMS(2),3466,PNT-AILCOV-LP-BACK,TUMB,829,-1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3466,PNT-AILCOV-LP-BACK,TUMB,829,1,0,1,AILERON HYD OVERRIDE COVER", "SYSTEMS(2),3502,PNT-CB-28-LP-BACK,TUMB,957,1,0,1,INSTRUMENTS AND STORM LIGHTS", "SYSTEMS(2),3502,PNT-CB-28-LP-BACK,TUMB,957,-1,0,1,INSTRUMENTS AND STORM LIGHTS", "SYSTEMS(2),3007,PNT-COV01-CPR,TUMB,322,-1,0,1,ESS BUS Cover", "SYSTEMS(2),3007,PNT-COV01-CPR,TUMB,322,1,0,1,ESS BUS Cover", "SYSTEMS(2),3055,PNT-CB-20-LP,TUMB,446,1,0,1,NORMAL INVERTER", "SYSTEMS(2),3055,PNT-CB-20-LP,TUMB,446,-1,0,1,NORMAL INVERTER", "SYSTEMS(2),3536,PNT-YB-EP-LP,LEV,1273,0.5,0,1,ENGINE START LIGHT TEST", "SYSTEMS(2),3116,PNT-YB-EP-LP,BTN,525,1,0,1,ENGINE START LIGHT TEST", "LIGHTS(3),3109,PNT-LNDG-L-CPL,TUMB,329,-0.5,0,1,LEFT TAXI/LANDING LIGHT", "LIGHTS(3),3109,PNT-LNDG-L-CPL,TUMB,329,0.5,0,1,LEFT TAXI/LANDING LIGHT", "LIGHTS(3),3252,PNT-MAG-COM-CP,TUMB,850,1,0,1,COMPASS LIGHT", "LIGHTS(3),3252,PNT-MAG-COM-CP,TUMB,850,-1,0,1,COMPASS LIGHT", "SYSTEMS(2),3484,PNT-ANTISKID-CP-BACK,BTN,638,1,0,1,Antiskid ON/OFF", "SYSTEMS(2),3494,PNT-CB-45-LP-BACK,TUMB,959,1,0,1,BACKUP ADI", "SYSTEMS(2),3494,PNT-CB-45-LP-BACK,TUMB,959,-1,0,1,BACKUP ADI", "SYSTEMS(2),3474,PNT-CBOMSUM-LP-BACK,TUMB,812,-1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3474,PNT-CBOMSUM-LP-BACK,TUMB,812,1,0,1,Fuselage Tank Pump Cover", "SYSTEMS(2),3514,PNT-FLAPSH-LP-BACK,TUMB,38,-0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3514,PNT-FLAPSH-LP-BACK,TUMB,38,0.5,0,1,FLAP POSITION SELECTOR", "SYSTEMS(2),3233,PNT-STICK-CPD,TUMB,309,-1,0,1,SHOW/HIDE FLIGHT STICK", "SYSTEMS(2),3233,PNT-STICK-CPD,TUMB,309,1,0,1,SHOW/HIDE FLIGHT STICK", "INTERCOM(7),3011,PNT-INT-P-HTBT-RP,TUMB,287,1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "INTERCOM(7),3011,PNT-INT-P-HTBT-RP,TUMB,287,-1,0,1,(HOT MIC) TALK CIRCUIT BREAKER", "SYSTEMS(2),3510,PNT-ERCR-CP-BACK,TUMB,966,1,0,1,Vertical Gyro Fast Erect", "SYSTEMS(2),3510,PNT-ERCR-CP-BACK,TUMB,966,1,0,1,Vertical Gyro Fast Erect"],
-    "Christen Eagle II": ["ENGINE(6),3058,p_AFMixtureLever,LEV,357,0,0,1,Mixture", "RADIO(5),3066,p_RadioFreqKHz,TUMB,367,1,0,1,Radio Frequency 50KHz / 25KHz Fine Tune (Pull)", "RADIO(5),3065,p_RadioFreqKHz,LEV,366,1,0,1,Radio Frequency 50KHz / 25KHz Fine Tune (Pull)", "ELECTRIC(7),3073,p_AlternatorOutput,TUMB,355,-1,0,1,Fuse", "ELECTRIC(7),3073,p_AlternatorOutput,TUMB,355,1,0,1,Fuse", "LIGHTS(13),3051,p_NavLight,TUMB,359,-1,0,1,Nav Lights", "LIGHTS(13),3051,p_NavLight,TUMB,359,1,0,1,Nav Lights", "GENERAL(1),3031,p_AccelButton,BTN,307,1,0,1,Accelerometer Reset Button", "ENGINE(6),3038,p_FuelPumpLever,TUMB,356,0,0,1,Fuel Pump", "ENGINE(6),3038,p_FuelPumpLever,TUMB,356,1,0,1,Fuel Pump", "CANOPY(15),3081,p_Canopy_Lever_Max,TUMB,403,1,0,1,Canopy Lever Close (Rear)", "RADIO(5),3064,p_RadioFreqMHz,LEV,374,0,0,1,Radio Frequency MHz", "CANOPY(15),3088,p_Canopy_Lever_Min_Front,BTN,400,1,0,1,Canopy Lever Open (Front)", "FUELGAUGE(14),3072,p_FuelGaugeButtonR,BTN,384,1,0,1,Fuel Indicator Mode Rear cockpit(F / U)", "RADIO(5),3063,p_RadioSwitch,BTN,368,1,0,1,Radio Frequency Transfer", "CANOPY(15),3085,p_Canopy_LockLever_Rear_Max,BTN,401,1,0,1,Canopy Unlock (Rear)", "GENERAL(1),3017,p_TrimLever,LEV,370,0,-1,1,Trim Lever", "LIGHTS(13),3053,p_GaugeLight,LEV,361,0,0,1,Cockpit Light", "CANOPY(15),3087,p_Canopy_LockLever_Front_Max,BTN,401,1,0,1,Canopy Unlock (Front)", "RADIO(5),3021,p_SWITCH_RADIO,TUMB,353,-1,0,1,Radio ON-OFF", "RADIO(5),3021,p_SWITCH_RADIO,TUMB,353,1,0,1,Radio ON-OFF", "ENGINE(6),3001,p_FuelPumpSwitch,TUMB,349,-1,0,1,Fuel Valve", "ENGINE(6),3001,p_FuelPumpSwitch,TUMB,349,1,0,1,Fuel Valve", "RADIO(5),3062,p_RadioVol,TUMB,365,1,0,1,Radio ON-OFF / Volume / Test (Pull)", "RADIO(5),3061,p_RadioVol,LEV,364,1,0,1,Radio ON-OFF / Volume / Test (Pull)", "LIGHTS(13),3054,p_LandingLight,TUMB,360,-1,0,1,Landing Light", "LIGHTS(13),3054,p_LandingLight,TUMB,360,1,0,1,Landing Light", "ELECTRIC(7),3037,p_SWITCH_ALTERNATOR,TUMB,354,-1,0,1,Alternator", "ELECTRIC(7),3037,p_SWITCH_ALTERNATOR,TUMB,354,1,0,1,Alternator", "CANOPY(15),3090,p_CanopyJet,BTN,402,1,0,1,Canopy Jettison (Rear)", "ENGINE(6),3057,p_PropPitchLever,LEV,358,0,0,1,Propeller", "ELECTRIC(7),3033,p_SWITCH_BATTERY,TUMB,351,-1,0,1,Battery", "ELECTRIC(7),3033,p_SWITCH_BATTERY,TUMB,351,1,0,1,Battery", "LIGHTS(13),3056,p_LightSpotYellow,TUMB,399,-1,0,1,Cockpit Light Yellow", "LIGHTS(13),3056,p_LightSpotYellow,TUMB,399,1,0,1,Cockpit Light Yellow", "FUELGAUGE(14),3071,p_FuelGaugeButton,BTN,378,1,0,1,Fuel Indicator Mode (F / U)", "LIGHTS(13),3055,p_LightOmniRed,TUMB,397,-1,0,1,Cockpit Light Red", "LIGHTS(13),3055,p_LightOmniRed,TUMB,397,1,0,1,Cockpit Light Red", "CANOPY(15),3083,p_Canopy_Lever_Min,BTN,400,1,0,1,Canopy Lever Open (Rear)", "ENGINE(6),3100,p_MAGNETS_KEY,TUMB,350,-0.25,0,1,Magnetos", "ENGINE(6),3100,p_MAGNETS_KEY,TUMB,350,0.25,0,1,Magnetos", "CANOPY(15),3086,p_Canopy_LockLever_Front_Min,BTN,401,1,0,1,Canopy Lock (Front)", "CANOPY(15),3084,p_Canopy_LockLever_Rear_Min,BTN,401,1,0,1,Canopy Lock (Rear)", "ELECTRIC(7),3043,p_VAmeterButton,BTN,377,1,0,1,Volt/Ampere Meter mode (Voltage / Amperage)", "GENERAL(1),3034,p_SWITCH_SMOKE,TUMB,352,-1,0,1,Smoke", "GENERAL(1),3034,p_SWITCH_SMOKE,TUMB,352,1,0,1,Smoke", "GENERAL(1),3010,p_AirconLever,LEV,369,0,0,1,Air Conditioning", "RADIO(5),3067,p_RadioChannel,BTN,375,1,0,1,Radio Channel", "PITOT(8),3039,p_ALTIMETER_KNOB,LEV,371,0,-1,1,Barometric Pressure"],
-    "F-16C": ["CPT_MECH(10),3004,PTR-LARMS-CNPOPN-600,TUMB,600,-1,0,1,Canopy Handle, UP/DOWN", "CPT_MECH(10),3004,PTR-LARMS-CNPOPN-600,TUMB,600,1,0,1,Canopy Handle, UP/DOWN", "MFD_RIGHT(25),3025,PTR-RMFCD-RS-CON-UP-348,BTN,348,1,0,1,Left MFD CON Rocker Switch, Up/Increase", "UFC(17),3019,PTR-ICP-BTN-AG-170,BTN,170,1,0,1,ICP Master Mode Button, A-G", "CPTLIGHTS_SYSTEM(12),3010,PTR-AOA-LVL-794,LEV,794,0,0,1,AOA Indexer Dimming Lever", "MFD_RIGHT(25),3020,PTR-RMFCD-BTN-OSB20-345,BTN,345,1,0,1,Right MFD OSB 20", "UFC(17),3018,PTR-ICP-BTN-AA-169,BTN,169,1,0,1,ICP Master Mode Button, A-A", "UFC(17),3010,PTR-ICP-BTN-NMB8-180,BTN,180,1,0,1,ICP Priority Function Button, 8/S(FIX)", "MFD_RIGHT(25),3015,PTR-RMFCD-BTN-OSB15-340,BTN,340,1,0,1,Right MFD OSB 15", "UFC(17),3013,PTR-ICP-BTN-COM2-166,BTN,166,1,0,1,ICP COM Override Button, COM2(VHF)", "MFD_RIGHT(25),3013,PTR-RMFCD-BTN-OSB13-338,BTN,338,1,0,1,Right MFD OSB 13", "UFC(17),3033,PTR-ICP-TMB-SEQ-184,BTN,184,1,0,1,ICP Data Control Switch, SEQ", "UFC(17),3033,PTR-ICP-TMB-SEQ-184,BTN,184,1,0,1,ICP Data Control Switch, SEQ", "SMS(22),3002,PTR-SNSR-TMB-LEFT-670,TUMB,670,-1,0,1,LEFT HDPT Switch, ON/OFF", "SMS(22),3002,PTR-SNSR-TMB-LEFT-670,TUMB,670,1,0,1,LEFT HDPT Switch, ON/OFF", "KY58(42),3004,PTR-KY58-LVR-MODE3-707,TUMB,707,0.5,0,1,KY-58 Power Knob, OFF/ON/TD", "KY58(42),3004,PTR-KY58-LVR-MODE3-707,TUMB,707,-0.5,0,1,KY-58 Power Knob, OFF/ON/TD", "SMS(22),3004,PTR-CLCP-TMB-LASER-103,TUMB,103,-1,0,1,LASER ARM Switch, ARM/OFF", "SMS(22),3004,PTR-CLCP-TMB-LASER-103,TUMB,103,1,0,1,LASER ARM Switch, ARM/OFF", "ELEC_INTERFACE(3),3002,PTR-ELEC-BTN-CRES-511,BTN,511,1,0,1,ELEC CAUTION RESET Button - Push to reset", "CMDS(32),3005,PTR-LPAN-CMDS-BTN-OSB1-365,TUMB,365,-1,0,1,O1 Expendable Category Switch, ON/OFF", "CMDS(32),3005,PTR-LPAN-CMDS-BTN-OSB1-365,TUMB,365,1,0,1,O1 Expendable Category Switch, ON/OFF", "IFF_CONTROL_PANEL(35),3003,PTR-AUXCOM-TMB-M4-541,TUMB,541,1,-1,1,IFF M-4 CODE Switch, HOLD/ A/B /ZERO", "IFF_CONTROL_PANEL(35),3003,PTR-AUXCOM-TMB-M4-541,TUMB,541,-1,-1,1,IFF M-4 CODE Switch, HOLD/ A/B /ZERO", "CONTROL_INTERFACE(2),3003,PTR-FLTCP-TMB-BIT-574,BTN,574,1,0,1,BIT Switch, OFF/BIT", "CONTROL_INTERFACE(2),3003,PTR-FLTCP-TMB-BIT-574,BTN,574,1,0,1,BIT Switch, OFF/BIT", "MFD_LEFT(24),3007,PTR-LMFCD-BTN-OSB7-306,BTN,306,1,0,1,Left MFD OSB 7", "GPS(59),3001,PTR-AVIPWR-TMB-GPS-720,TUMB,720,-1,0,1,GPS Switch, GPS/OFF", "GPS(59),3001,PTR-AVIPWR-TMB-GPS-720,TUMB,720,1,0,1,GPS Switch, GPS/OFF", "CMDS(32),3010,PTR-LPAN-CMDS-LVR-MODE-378,TUMB,378,0.1,0,0.5,MODE Knob, OFF/STBY/MAN/SEMI/AUTO/BYP", "CMDS(32),3010,PTR-LPAN-CMDS-LVR-MODE-378,TUMB,378,-0.1,0,0.5,MODE Knob, OFF/STBY/MAN/SEMI/AUTO/BYP", "CPTLIGHTS_SYSTEM(12),3011,PTR-AR-LVL-795,LEV,795,0,0,1,AR Status Indicator Dimming Lever", "CPTLIGHTS_SYSTEM(12),3003,PTR-RLGT-LVR-PRICNS-685,LEV,685,0,0,1,PRIMARY CONSOLES BRT Knob", "FUEL_INTERFACE(4),3002,PTR-FUELCP-CVR-MASTER-558,TUMB,558,-1,0,1,FUEL MASTER Switch Cover, OPEN/CLOSE", "FUEL_INTERFACE(4),3002,PTR-FUELCP-CVR-MASTER-558,TUMB,558,1,0,1,FUEL MASTER Switch Cover, OPEN/CLOSE", "MFD_RIGHT(25),3005,PTR-RMFCD-BTN-OSB5-330,BTN,330,1,0,1,Right MFD OSB 5", "UFC(17),3032,PTR-ICP-TMB-RTN-184,BTN,184,-1,-1,0,ICP Data Control Switch, RTN", "UFC(17),3032,PTR-ICP-TMB-RTN-184,BTN,184,-1,-1,0,ICP Data Control Switch, RTN", "CONTROL_INTERFACE(2),3010,PTR-MPCP-TMB-MP-425,BTN,425,1,0,1,MANUAL PITCH Override Switch, OVRD/NORM", "CONTROL_INTERFACE(2),3010,PTR-MPCP-TMB-MP-425,BTN,425,1,0,1,MANUAL PITCH Override Switch, OVRD/NORM", "INTERCOM(39),3013,PTR-ANTICE-TMB-IFF-711,TUMB,711,1,-1,1,IFF ANT SEL Switch, LOWER/NORM/UPPER", "INTERCOM(39),3013,PTR-ANTICE-TMB-IFF-711,TUMB,711,-1,-1,1,IFF ANT SEL Switch, LOWER/NORM/UPPER", "CMDS(32),3008,PTR-LPAN-CMDS-BTN-OSB4-368,TUMB,368,-1,0,1,FL Expendable Category Switch, ON/OFF", "CMDS(32),3008,PTR-LPAN-CMDS-BTN-OSB4-368,TUMB,368,1,0,1,FL Expendable Category Switch, ON/OFF", "UFC(17),3015,PTR-ICP-BTN-LIST-168,BTN,168,1,0,1,ICP LIST Override Button, LIST", "MFD_LEFT(24),3001,PTR-LMFCD-BTN-OSB1-300,BTN,300,1,0,1,Left MFD OSB 1", "UFC(17),3031,PTR-ICP-RS-OFF-DN-183,BTN,183,-1,-1,0,ICP DED Increment/Decrement Switch, Down", "ENGINE_INTERFACE(6),3010,PTR-ENGSTART-TMB-ABENG-450,BTN,450,1,0,1,AB RESET Switch, AB RESET/NORM/ENG DATA", "ENGINE_INTERFACE(6),3011,PTR-ENGSTART-TMB-ABENG-450,BTN,450,-1,-1,0,AB RESET Switch, AB RESET/NORM/ENG DATA", "EXTLIGHTS_SYSTEM(11),3002,PTR-EXTLGT-TMB-FLSH-532,TUMB,532,-1,0,1,FLASH STEADY Switch, FLASH/STEADY", "EXTLIGHTS_SYSTEM(11),3002,PTR-EXTLGT-TMB-FLSH-532,TUMB,532,1,0,1,FLASH STEADY Switch, FLASH/STEADY", "MFD_LEFT(24),3009,PTR-LMFCD-BTN-OSB9-308,BTN,308,1,0,1,Left MFD OSB 9", "MFD_LEFT(24),3011,PTR-LMFCD-BTN-OSB11-310,BTN,310,1,0,1,Left MFD OSB 11", "MFD_LEFT(24),3014,PTR-LMFCD-BTN-OSB14-313,BTN,313,1,0,1,Left MFD OSB 14", "MFD_LEFT(24),3015,PTR-LMFCD-BTN-OSB15-314,BTN,314,1,0,1,Left MFD OSB 15", "MFD_LEFT(24),3016,PTR-LMFCD-BTN-OSB16-315,BTN,315,1,0,1,Left MFD OSB 16", "MFD_LEFT(24),3017,PTR-LMFCD-BTN-OSB17-316,BTN,316,1,0,1,Left MFD OSB 17", "FUEL_INTERFACE(4),3001,PTR-FUELCP-TMB-MASTER-559,TUMB,559,-1,0,1,FUEL MASTER Switch, MASTER/OFF", "FUEL_INTERFACE(4),3001,PTR-FUELCP-TMB-MASTER-559,TUMB,559,1,0,1,FUEL MASTER Switch, MASTER/OFF", "MFD_LEFT(24),3020,PTR-LMFCD-BTN-OSB20-319,BTN,319,1,0,1,Left MFD OSB 20", "MFD_LEFT(24),3005,PTR-LMFCD-BTN-OSB5-304,BTN,304,1,0,1,Left MFD OSB 5", "EXTLIGHTS_SYSTEM(11),3001,PTR-EXTLGT-TMB-ANTCOL-531,TUMB,531,0.1,0,0.7,ANTI-COLL Knob, OFF/1/2/3/4/A/B/C", "EXTLIGHTS_SYSTEM(11),3001,PTR-EXTLGT-TMB-ANTCOL-531,TUMB,531,-0.1,0,0.7,ANTI-COLL Knob, OFF/1/2/3/4/A/B/C", "CPT_MECH(10),3005,PTR-LARMS-CNPJETT-601,TUMB,601,-1,0,1,CANOPY JETTISON T-Handle, PULL/STOW", "CPT_MECH(10),3005,PTR-LARMS-CNPJETT-601,TUMB,601,1,0,1,CANOPY JETTISON T-Handle, PULL/STOW", "ECS_INTERFACE(13),3002,PTR-AIRCOND-TMB-TEMP-692,LEV,692,0,-0.3,0.3,TEMP Knob", "MFD_LEFT(24),3026,PTR-LMFCD-RS-CON-DN-322,BTN,322,-1,-1,0,Left MFD CON Rocker Switch, Down/Decrease", "IFF_CONTROL_PANEL(35),3011,PTR-AUXCOM-TMB-CHNL3-549,BTN,549,1,0,1,IFF MODE 3 Selector Lever, DIGIT 1", "IFF_CONTROL_PANEL(35),3012,PTR-AUXCOM-TMB-CHNL3-549,BTN,549,-1,-1,0,IFF MODE 3 Selector Lever, DIGIT 1", "UFC(17),3005,PTR-ICP-BTN-NMB3-173,BTN,173,1,0,1,ICP Priority Function Button, 3", "CMDS(32),3007,PTR-LPAN-CMDS-BTN-OSB3-367,TUMB,367,-1,0,1,CH Expendable Category Switch, ON/OFF", "CMDS(32),3007,PTR-LPAN-CMDS-BTN-OSB3-367,TUMB,367,1,0,1,CH Expendable Category Switch, ON/OFF", "MFD_LEFT(24),3027,PTR-LMFCD-RS-BRT-UP-323,BTN,323,1,0,1,Left MFD BRT Rocker Switch, Up/Increase", "MFD_LEFT(24),3028,PTR-LMFCD-RS-BRT-DN-323,BTN,323,-1,-1,0,Left MFD BRT Rocker Switch, Down/Decrease", "INTERCOM(39),3016,PTR-NUCLR-TMB-PLAIN-701,TUMB,701,1,-1,1,PLAIN Cipher Switch, CRAD 1/PLAIN/CRAD 2", "INTERCOM(39),3016,PTR-NUCLR-TMB-PLAIN-701,TUMB,701,-1,-1,1,PLAIN Cipher Switch, CRAD 1/PLAIN/CRAD 2", "FCR(31),3001,PTR-SNSR-TMB-FCR-672,TUMB,672,-1,0,1,FCR Switch, FCR/OFF", "FCR(31),3001,PTR-SNSR-TMB-FCR-672,TUMB,672,1,0,1,FCR Switch, FCR/OFF", "GEAR_INTERFACE(7),3006,PTR-LGCP-TMB-HOOK-354,TUMB,354,-1,0,1,HOOK Switch, UP/DN", "GEAR_INTERFACE(7),3006,PTR-LGCP-TMB-HOOK-354,TUMB,354,1,0,1,HOOK Switch, UP/DN", "UFC(17),3002,PTR-ICP-BTN-NMB0-182,BTN,182,1,0,1,ICP Priority Function Button, 0(M-SEL)", "RWR(33),3011,PTR-TWAP-BTN-PWR-401,TUMB,401,-1,0,1,RWR Indicator Control POWER Button", "RWR(33),3011,PTR-TWAP-BTN-PWR-401,TUMB,401,1,0,1,RWR Indicator Control POWER Button", "MFD_RIGHT(25),3002,PTR-RMFCD-BTN-OSB2-327,BTN,327,1,0,1,Right MFD OSB 2", "INTERCOM(39),3010,PTR-AUDIO2-LVR-TACAN-441,LEV,441,0,0,1,TACAN Knob", "SMS(22),3003,PTR-SNSR-TMB-RIGHT-671,TUMB,671,-1,0,1,RIGHT HDPT Switch, ON/OFF", "SMS(22),3003,PTR-SNSR-TMB-RIGHT-671,TUMB,671,1,0,1,RIGHT HDPT Switch, ON/OFF", "ELEC_INTERFACE(3),3005,PTR-TESTCP-TMB-EPU-579,BTN,579,1,0,1,EPU/GEN Test Switch, EPU/GEN /OFF", "ELEC_INTERFACE(3),3005,PTR-TESTCP-TMB-EPU-579,BTN,579,1,0,1,EPU/GEN Test Switch, EPU/GEN /OFF", "MFD_RIGHT(25),3004,PTR-RMFCD-BTN-OSB4-329,BTN,329,1,0,1,Right MFD OSB 4", "ELEC_INTERFACE(3),3004,PTR-TESTCP-TMB-TEST-585,BTN,585,1,0,1,FLCS PWR TEST Switch, MAINT/NORM/TEST(momentarily)", "ELEC_INTERFACE(3),3003,PTR-TESTCP-TMB-TEST-585,TUMB,585,1,-1,0,FLCS PWR TEST Switch, MAINT/NORM/TEST(momentarily)", "MFD_RIGHT(25),3008,PTR-RMFCD-BTN-OSB8-333,BTN,333,1,0,1,Right MFD OSB 8", "MFD_RIGHT(25),3009,PTR-RMFCD-BTN-OSB9-334,BTN,334,1,0,1,Right MFD OSB 9", "MMC(19),3002,PTR-CLCP-TMB-MASTER-105,TUMB,105,1,-1,1,MASTER ARM Switch, MASTER ARM/OFF/SIMULATE", "MMC(19),3002,PTR-CLCP-TMB-MASTER-105,TUMB,105,-1,-1,1,MASTER ARM Switch, MASTER ARM/OFF/SIMULATE", "GEAR_INTERFACE(7),3005,PTR-LGCP-TMB-BRK-356,TUMB,356,-1,0,1,BRAKES Channel Switch, CHAN 1/CHAN 2", "GEAR_INTERFACE(7),3005,PTR-LGCP-TMB-BRK-356,TUMB,356,1,0,1,BRAKES Channel Switch, CHAN 1/CHAN 2", "UFC(17),3014,PTR-ICP-BTN-IFF-167,BTN,167,1,0,1,ICP IFF Override Button, IFF", "CONTROL_INTERFACE(2),3014,PTR-CLCP-TMB-ROLL-108,TUMB,108,1,-1,1,Autopilot ROLL Switch, STRG SEL/ATT HOLD/HDG SEL", "CONTROL_INTERFACE(2),3014,PTR-CLCP-TMB-ROLL-108,TUMB,108,-1,-1,1,Autopilot ROLL Switch, STRG SEL/ATT HOLD/HDG SEL", "IFF_CONTROL_PANEL(35),3002,PTR-AUXCOM-LVR-MODE-540,TUMB,540,0.1,0,0.4,IFF MASTER Knob, OFF/STBY/LOW/NORM/EMER", "IFF_CONTROL_PANEL(35),3002,PTR-AUXCOM-LVR-MODE-540,TUMB,540,-0.1,0,0.4,IFF MASTER Knob, OFF/STBY/LOW/NORM/EMER", "CONTROL_INTERFACE(2),3001,PTR-FLTCP-TMB-DIGITAL-566,TUMB,566,-1,0,1,DIGITAL BACKUP Switch, OFF/BACKUP", "CONTROL_INTERFACE(2),3001,PTR-FLTCP-TMB-DIGITAL-566,TUMB,566,1,0,1,DIGITAL BACKUP Switch, OFF/BACKUP", "AMI(46),3001,PTR-SPD-LVR-SET-71,LEV,71,0,0,1,SET INDEX Knob", "ECS_INTERFACE(13),3001,PTR-AIRCOND-TMB-SRC-693,TUMB,693,0.1,0,0.3,AIR SOURCE Knob, OFF/NORM/DUMP/RAM", "ECS_INTERFACE(13),3001,PTR-AIRCOND-TMB-SRC-693,TUMB,693,-0.1,0,0.3,AIR SOURCE Knob, OFF/NORM/DUMP/RAM", "CONTROL_INTERFACE(2),3007,PTR-MANTRIM-LVR-ROLL-560,LEV,560,0,-1,1,ROLL TRIM Wheel", "MMC(19),3011,PTR-RHUD-TMB-ALT-680,TUMB,680,1,-1,1,HUD Altitude Switch, RADAR / BARO / AUTO", "MMC(19),3011,PTR-RHUD-TMB-ALT-680,TUMB,680,-1,-1,1,HUD Altitude Switch, RADAR / BARO / AUTO",
-        "UFC(17),3022,PTR-ICP-LVR-SYM-190,LEV,190,0,0,1,ICP HUD Symbology Intensity Knob", "CMDS(32),3009,PTR-LPAN-CMDS-LVR-PRGM-377,TUMB,377,0.1,0,0.4,PROGRAM Knob, BIT/1/2/3/4", "CMDS(32),3009,PTR-LPAN-CMDS-LVR-PRGM-377,TUMB,377,-0.1,0,0.4,PROGRAM Knob, BIT/1/2/3/4", "UHF_CONTROL_PANEL(37),3001,PTR-ANARC164-CHNL-SELECTOR-410,TUMB,410,0.05,0,0.95,UHF CHAN Knob", "UHF_CONTROL_PANEL(37),3001,PTR-ANARC164-CHNL-SELECTOR-410,TUMB,410,-0.05,0,0.95,UHF CHAN Knob", "IFF_CONTROL_PANEL(35),3007,PTR-AUXCOM-TMB-CHNL1-545,BTN,545,1,0,1,IFF MODE 1 Selector Lever, DIGIT 1", "IFF_CONTROL_PANEL(35),3008,PTR-AUXCOM-TMB-CHNL1-545,BTN,545,-1,-1,0,IFF MODE 1 Selector Lever, DIGIT 1", "INTERCOM(39),3002,PTR-AUDIO1-TMB-COMM1-434,TUMB,434,0.5,0,1,COMM 1 (UHF) Mode Knob", "INTERCOM(39),3002,PTR-AUDIO1-TMB-COMM1-434,TUMB,434,-0.5,0,1,COMM 1 (UHF) Mode Knob", "MFD_RIGHT(25),3024,PTR-RMFCD-RS-SYM-DN-347,BTN,347,-1,-1,0,Left MFD SYM Rocker Switch, Down/Decrease", "ENGINE_INTERFACE(6),3009,PTR-ENGSTART-TMB-MAXPWR-451,TUMB,451,-1,0,1,MAX POWER Switch (is inoperative), MAX POWER/OFF", "ENGINE_INTERFACE(6),3009,PTR-ENGSTART-TMB-MAXPWR-451,TUMB,451,1,0,1,MAX POWER Switch (is inoperative), MAX POWER/OFF", "EXTLIGHTS_SYSTEM(11),3008,PTR-LGCP-TMB-LIGHTS-360,TUMB,360,1,-1,1,LANDING TAXI LIGHTS Switch, LANDING/OFF/TAXI", "EXTLIGHTS_SYSTEM(11),3008,PTR-LGCP-TMB-LIGHTS-360,TUMB,360,-1,-1,1,LANDING TAXI LIGHTS Switch, LANDING/OFF/TAXI", "KY58(42),3001,PTR-KY58-LVR-MODE1-705,TUMB,705,0.1,0,0.3,KY-58 MODE Knob, P/C/LD/RV", "KY58(42),3001,PTR-KY58-LVR-MODE1-705,TUMB,705,-0.1,0,0.3,KY-58 MODE Knob, P/C/LD/RV", "MFD_RIGHT(25),3026,PTR-RMFCD-RS-CON-DN-348,BTN,348,-1,-1,0,Left MFD CON Rocker Switch, Down/Decrease", "UFC(17),3020,PTR-ICP-LVR-RET-192,LEV,192,0,0,1,ICP Reticle Depression Control Knob", "RWR(33),3005,PTR-CMSC-BTN-OBJ-147,BTN,147,1,0,1,RWR Indicator Control UNKNOWN SHIP Button", "MFD_LEFT(24),3012,PTR-LMFCD-BTN-OSB12-311,BTN,311,1,0,1,Left MFD OSB 12", "UFC(17),3026,PTR-ICP-RS-FLIR-DN-188,BTN,188,-1,-1,0,ICP FLIR Increment/Decrement Switch, Down", "AAU34(45),3001,PTR-ALT-TMB-MODE-60,BTN,60,1,0,1,Mode Lever, ELEC/OFF/PNEU", "AAU34(45),3002,PTR-ALT-TMB-MODE-60,BTN,60,-1,-1,0,Mode Lever, ELEC/OFF/PNEU", "EHSI(28),3002,PTR-EHSI-LVR-HDG-45,LEV,45,1,0,1,HDG Set Knob", "EHSI(28),3003,PTR-EHSI-LVR-HDG-45,BTN,42,1,0,1,HDG Set Knob", "AAU34(45),3003,PTR-ALT-LVR-SET-62,LEV,62,0,0,1,Barometric Setting Knob", "CLOCK(51),3003,PTR-RPAN-WATCH-BTN-CTRL-627,BTN,628,1,0,1,Clock Elapsed Time Knob", "UFC(17),3006,PTR-ICP-BTN-NMB4-175,BTN,175,1,0,1,ICP Priority Function Button, 4/W(STPT)", "CPT_MECH(10),3013,PTR-SEAT-TMB-ADJ-786,BTN,786,1,0,1,SEAT ADJ Switch, UP/OFF/DOWN", "CPT_MECH(10),3014,PTR-SEAT-TMB-ADJ-786,BTN,786,-1,-1,0,SEAT ADJ Switch, UP/OFF/DOWN", "EXTLIGHTS_SYSTEM(11),3004,PTR-EXTLGT-TMB-FUS-534,TUMB,534,1,-1,1,FUSELAGE Switch, BRT/OFF/DIM", "EXTLIGHTS_SYSTEM(11),3004,PTR-EXTLGT-TMB-FUS-534,TUMB,534,-1,-1,1,FUSELAGE Switch, BRT/OFF/DIM", "CPT_MECH(10),3002,PTR-LARMS-TMB-OPN-606,TUMB,606,-1,0,1,Canopy Switch, OPEN/HOLD/CLOSE(momentarily)", "CPT_MECH(10),3003,PTR-LARMS-TMB-OPN-606,BTN,606,-1,-1,0,Canopy Switch, OPEN/HOLD/CLOSE(momentarily)", "MMC(19),3010,PTR-RHUD-TMB-CAS-679,TUMB,679,1,-1,1,HUD Velocity Switch, CAS / TAS / GND SPD", "MMC(19),3010,PTR-RHUD-TMB-CAS-679,TUMB,679,-1,-1,1,HUD Velocity Switch, CAS / TAS / GND SPD", "CPTLIGHTS_SYSTEM(12),3001,PTR-CPBC-BTN-MCAUT-116,BTN,116,1,0,1,Master Caution Button - Push to reset", "UFC(17),3025,PTR-ICP-RS-FLIR-UP-188,BTN,188,1,0,1,ICP FLIR Increment/Decrement Switch, Up", "OXYGEN_INTERFACE(8),3001,PTR-OXYCP-LVR-SUPP-728,TUMB,728,0.5,0,1,Supply Lever, PBG/ON/OFF", "OXYGEN_INTERFACE(8),3001,PTR-OXYCP-LVR-SUPP-728,TUMB,728,-0.5,0,1,Supply Lever, PBG/ON/OFF", "UFC(17),3017,PTR-ICP-BTN-RCL-174,BTN,174,1,0,1,ICP Recall Button, RCL", "CPTLIGHTS_SYSTEM(12),3006,PTR-RLGT-LVR-FLDCNS-688,LEV,688,0,0,1,FLOOD CONSOLES BRT Knob", "IFF_CONTROL_PANEL(35),3004,PTR-AUXCOM-TMB-REPLY-543,TUMB,543,1,-1,1,IFF MODE 4 REPLY Switch, OUT/A/B", "IFF_CONTROL_PANEL(35),3004,PTR-AUXCOM-TMB-REPLY-543,TUMB,543,-1,-1,1,IFF MODE 4 REPLY Switch, OUT/A/B", "INTERCOM(39),3009,PTR-AUDIO2-LVR-ILS-442,LEV,442,0,0,1,ILS Power Knob", "EXTLIGHTS_SYSTEM(11),3007,PTR-EXTLGT-LVR-AREF-537,LEV,537,0,0,1,AERIAL REFUELING Knob", "SMS(22),3001,PTR-AVIPWR-TMB-STSTA-716,TUMB,716,-1,0,1,ST STA Switch, ST STA/OFF", "SMS(22),3001,PTR-AVIPWR-TMB-STSTA-716,TUMB,716,1,0,1,ST STA Switch, ST STA/OFF", "UHF_CONTROL_PANEL(37),3010,PTR-ANARC164-SQUELCH-419,TUMB,419,-1,0,1,UHF SQUELCH Switch", "UHF_CONTROL_PANEL(37),3010,PTR-ANARC164-SQUELCH-419,TUMB,419,1,0,1,UHF SQUELCH Switch", "ENGINE_INTERFACE(6),3005,PTR-ENGSTART-TMB-JETFUEL-447,BTN,447,1,0,1,JFS Switch, START 1/OFF/START 2", "ENGINE_INTERFACE(6),3006,PTR-ENGSTART-TMB-JETFUEL-447,BTN,447,-1,-1,0,JFS Switch, START 1/OFF/START 2", "CONTROL_INTERFACE(2),3016,PTR-FLTCP-TMB-MAN-568,TUMB,568,-1,0,1,MANUAL TF FLYUP Switch, ENABLE/DISABLE", "CONTROL_INTERFACE(2),3016,PTR-FLTCP-TMB-MAN-568,TUMB,568,1,0,1,MANUAL TF FLYUP Switch, ENABLE/DISABLE", "UHF_CONTROL_PANEL(37),3011,PTR-ANARC164-VOLUME-420,LEV,420,0,0,1,UHF VOL Knob", "EXTLIGHTS_SYSTEM(11),3006,PTR-EXTLGT-TMB-MASTER-536,TUMB,536,0.1,0,0.4,MASTER Switch, OFF/ALL/A-C/FORM/NORM", "EXTLIGHTS_SYSTEM(11),3006,PTR-EXTLGT-TMB-MASTER-536,TUMB,536,-0.1,0,0.4,MASTER Switch, OFF/ALL/A-C/FORM/NORM", "MFD_LEFT(24),3022,PTR-LMFCD-RS-GAIN-DN-320,BTN,320,-1,-1,0,Left MFD GAIN Rocker Switch, Down/Decrease", "RWR(33),3012,PTR-TWAP-BTN-ALT-399,BTN,399,1,0,1,RWR Indicator Control ALTITUDE Button", "INTERCOM(39),3003,PTR-AUDIO1-LVR-COMM2-431,LEV,431,0,0,1,COMM 2 Power Knob", "MFD_RIGHT(25),3028,PTR-RMFCD-RS-BRT-DN-349,BTN,349,-1,-1,0,Left MFD BRT Rocker Switch, Down/Decrease", "ENGINE_INTERFACE(6),3003,PTR-EPU-TMB-EPUTMB-528,TUMB,528,1,-1,1,EPU Switch, ON/NORM/OFF", "ENGINE_INTERFACE(6),3003,PTR-EPU-TMB-EPUTMB-528,TUMB,528,-1,-1,1,EPU Switch, ON/NORM/OFF", "ELEC_INTERFACE(3),3006,PTR-TESTCP-TMB-PROBE-578,TUMB,578,-1,0,1,PROBE HEAT Switch, PROBE HEAT/OFF/TEST(momentarily)", "ELEC_INTERFACE(3),3007,PTR-TESTCP-TMB-PROBE-578,BTN,578,-1,-1,0,PROBE HEAT Switch, PROBE HEAT/OFF/TEST(momentarily)", "ENGINE_INTERFACE(6),3002,PTR-EPU-CVR-EPUTMB-529,TUMB,529,-1,0,1,EPU Switch Cover for OFF, OPEN/CLOSE", "ENGINE_INTERFACE(6),3002,PTR-EPU-CVR-EPUTMB-529,TUMB,529,1,0,1,EPU Switch Cover for OFF, OPEN/CLOSE", "INTERCOM(39),3005,PTR-AUDIO1-LVR-SV-432,LEV,432,0,0,1,SECURE VOICE Knob", "MMC(19),3012,PTR-RHUD-TMB-DAYNGT-681,TUMB,681,1,-1,1,HUD Brightness Control Switch, DAY / AUTO BRT / NIGHT", "MMC(19),3012,PTR-RHUD-TMB-DAYNGT-681,TUMB,681,-1,-1,1,HUD Brightness Control Switch, DAY / AUTO BRT / NIGHT", "MFD_RIGHT(25),3019,PTR-RMFCD-BTN-OSB19-344,BTN,344,1,0,1,Right MFD OSB 19", "INTERCOM(39),3017,PTR-ZROIZE-CVR-ZERO-694,TUMB,694,-1,0,1,ZEROIZE Switch Cover, OPEN/CLOSE", "INTERCOM(39),3017,PTR-ZROIZE-CVR-ZERO-694,TUMB,694,1,0,1,ZEROIZE Switch Cover, OPEN/CLOSE", "UHF_CONTROL_PANEL(37),3012,PTR-ANARC164-TEST-DISPLAY-421,BTN,421,1,0,1,UHF TEST DISPLAY Button", "CMDS(32),3006,PTR-LPAN-CMDS-BTN-OSB2-366,TUMB,366,-1,0,1,O2 Expendable Category Switch, ON/OFF", "CMDS(32),3006,PTR-LPAN-CMDS-BTN-OSB2-366,TUMB,366,1,0,1,O2 Expendable Category Switch, ON/OFF", "MFD_LEFT(24),3010,PTR-LMFCD-BTN-OSB10-309,BTN,309,1,0,1,Left MFD OSB 10", "UFC(17),3037,PTR-CPBC-BTN-IFF-125,BTN,125,1,0,1,IFF IDENT Button", "MFD_RIGHT(25),3007,PTR-RMFCD-BTN-OSB7-332,BTN,332,1,0,1,Right MFD OSB 7", "INTERCOM(39),3006,PTR-AUDIO1-LVR-MSL-433,LEV,433,0,0,1,MSL Tone Knob", "MFD_LEFT(24),3008,PTR-LMFCD-BTN-OSB8-307,BTN,307,1,0,1,Left MFD OSB 8", "EXTLIGHTS_SYSTEM(11),3003,PTR-EXTLGT-TMB-WNGTAIL-533,TUMB,533,1,-1,1,WING/TAIL Switch, BRT/OFF/DIM", "EXTLIGHTS_SYSTEM(11),3003,PTR-EXTLGT-TMB-WNGTAIL-533,TUMB,533,-1,-1,1,WING/TAIL Switch, BRT/OFF/DIM", "UHF_CONTROL_PANEL(37),3002,PTR-ANARC164-100MHZ-SEL-411,TUMB,411,0.1,0.1,0.3,UHF Manual Frequency Knob 100 MHz", "UHF_CONTROL_PANEL(37),3002,PTR-ANARC164-100MHZ-SEL-411,TUMB,411,-0.1,0.1,0.3,UHF Manual Frequency Knob 100 MHz", "IFF_CONTROL_PANEL(35),3009,PTR-AUXCOM-TMB-CHNL2-547,BTN,547,1,0,1,IFF MODE 1 Selector Lever, DIGIT 2", "IFF_CONTROL_PANEL(35),3010,PTR-AUXCOM-TMB-CHNL2-547,BTN,547,-1,-1,0,IFF MODE 1 Selector Lever, DIGIT 2", "UFC(17),3038,PTR-CLCP-TMB-RF-100,TUMB,100,1,-1,1,RF Switch, SILENT/QUIET/NORM", "UFC(17),3038,PTR-CLCP-TMB-RF-100,TUMB,100,-1,-1,1,RF Switch, SILENT/QUIET/NORM", "MFD_RIGHT(25),3001,PTR-RMFCD-BTN-OSB1-326,BTN,326,1,0,1,Right MFD OSB 1", "UFC(17),3016,PTR-ICP-BTN-ENTR-178,BTN,178,1,0,1,ICP Enter Button, ENTR", "CMDS(32),3004,PTR-LPAN-CMDS-TMB-JTSN-371,TUMB,371,-1,0,1,Jettison Switch, JETT/OFF", "CMDS(32),3004,PTR-LPAN-CMDS-TMB-JTSN-371,TUMB,371,1,0,1,Jettison Switch, JETT/OFF", "MFD_RIGHT(25),3006,PTR-RMFCD-BTN-OSB6-331,BTN,331,1,0,1,Right MFD OSB 6", "UFC(17),3007,PTR-ICP-BTN-NMB5-176,BTN,176,1,0,1,ICP Priority Function Button, 5(CRUS)", "UHF_CONTROL_PANEL(37),3009,PTR-ANARC164-T-TONE-418,BTN,418,1,0,1,UHF Tone Button", "MFD_RIGHT(25),3017,PTR-RMFCD-BTN-OSB17-342,BTN,342,1,0,1,Right MFD OSB 17", "INTERCOM(39),3012,PTR-AUDIO2-TMB-MODE-443,TUMB,443,1,-1,1,HOT MIC CIPHER Switch, HOT MIC / OFF / CIPHER", "INTERCOM(39),3012,PTR-AUDIO2-TMB-MODE-443,TUMB,443,-1,-1,1,HOT MIC CIPHER Switch, HOT MIC / OFF / CIPHER", "RWR(33),3008,PTR-TWAP-LVR-DIM-404,LEV,404,0,0,1,RWR Indicator Control DIM Knob - Rotate to adjust brightness", "UFC(17),3030,PTR-ICP-RS-OFF-UP-183,BTN,183,1,0,1,ICP DED Increment/Decrement Switch, Up", "MFD_LEFT(24),3004,PTR-LMFCD-BTN-OSB4-303,BTN,303,1,0,1,Left MFD OSB 4", "RWR(33),3010,PTR-TWAP-BTN-ACTPWR-397,BTN,397,1,0,1,RWR Indicator Control ACT/PWR Button", "CPT_MECH(10),3015,PTR-STICK-HIDE-796,TUMB,796,-1,0,1,Hide Stick toggle", "CPT_MECH(10),3015,PTR-STICK-HIDE-796,TUMB,796,1,0,1,Hide Stick toggle", "MFD_RIGHT(25),3023,PTR-RMFCD-RS-SYM-UP-347,BTN,347,1,0,1,Left MFD SYM Rocker Switch, Up/Increase", "ECS_INTERFACE(13),3003,PTR-LARMS-DEFOG-602,TUMB,602,0.05,0,1,DEFOG Lever", "ECS_INTERFACE(13),3003,PTR-LARMS-DEFOG-602,TUMB,602,-0.05,0,1,DEFOG Lever", "MFD_LEFT(24),3018,PTR-LMFCD-BTN-OSB18-317,BTN,317,1,0,1,Left MFD OSB 18",
-        "MFD_LEFT(24),3021,PTR-LMFCD-RS-GAIN-UP-320,BTN,320,1,0,1,Left MFD GAIN Rocker Switch, Up/Increase", "UHF_CONTROL_PANEL(37),3008,PTR-ANARC164-FUNCTION-417,TUMB,417,0.1,0,0.3,UHF Function Knob", "UHF_CONTROL_PANEL(37),3008,PTR-ANARC164-FUNCTION-417,TUMB,417,-0.1,0,0.3,UHF Function Knob", "CONTROL_INTERFACE(2),3004,PTR-FLTCP-TMB-FLCS-573,BTN,573,1,0,1,FLCS RESET Switch, OFF/RESET", "CONTROL_INTERFACE(2),3004,PTR-FLTCP-TMB-FLCS-573,BTN,573,1,0,1,FLCS RESET Switch, OFF/RESET", "CONTROL_INTERFACE(2),3009,PTR-MANTRIM-LVR-YAW-565,LEV,565,0,-1,1,YAW TRIM Knob", "MFD_RIGHT(25),3012,PTR-RMFCD-BTN-OSB12-337,BTN,337,1,0,1,Right MFD OSB 12", "FUEL_INTERFACE(4),3007,PTR-FUELCP-TMB-TANK-557,TUMB,557,-1,0,1,TANK INERTING Switch, TANK INERTING /OFF", "FUEL_INTERFACE(4),3007,PTR-FUELCP-TMB-TANK-557,TUMB,557,1,0,1,TANK INERTING Switch, TANK INERTING /OFF", "UFC(17),3012,PTR-ICP-BTN-COM1-165,BTN,165,1,0,1,ICP COM Override Button, COM1(UHF)", "GEAR_INTERFACE(7),3003,PTR-LGCP-TMB-PRKNG-357,BTN,357,1,0,1,ANTI-SKID Switch, PARKING BRAKE/ANTI-SKID/OFF", "GEAR_INTERFACE(7),3004,PTR-LGCP-TMB-PRKNG-357,TUMB,357,1,-1,0,ANTI-SKID Switch, PARKING BRAKE/ANTI-SKID/OFF", "CONTROL_INTERFACE(2),3008,PTR-MANTRIM-LVR-PITCH-562,LEV,562,0,-1,1,PITCH TRIM Wheel", "CPTLIGHTS_SYSTEM(12),3004,PTR-RLGT-LVR-PRIPNL-686,LEV,686,0,0,1,PRIMARY INST PNL BRT Knob", "OXYGEN_INTERFACE(8),3003,PTR-OXYCP-LVR-EMRG-726,TUMB,726,-1,0,1,Emergency Lever, EMERGENCY/NORMAL/TEST MASK(momentarily)", "OXYGEN_INTERFACE(8),3004,PTR-OXYCP-LVR-EMRG-726,BTN,726,-1,-1,0,Emergency Lever, EMERGENCY/NORMAL/TEST MASK(momentarily)", "CMDS(32),3003,PTR-LPAN-CMDS-TMB-MWS-373,TUMB,373,-1,0,1,MWS Source Switch, ON/OFF (no function)", "CMDS(32),3003,PTR-LPAN-CMDS-TMB-MWS-373,TUMB,373,1,0,1,MWS Source Switch, ON/OFF (no function)", "INTERCOM(39),3015,PTR-ZROIZE-TMB-VOICE-696,TUMB,696,-1,0,1,Voice Message Inhibit Switch, VOICE MESSAGE/INHIBIT", "INTERCOM(39),3015,PTR-ZROIZE-TMB-VOICE-696,TUMB,696,1,0,1,Voice Message Inhibit Switch, VOICE MESSAGE/INHIBIT", "CPTLIGHTS_SYSTEM(12),3002,PTR-TESTCP-BTN-MAL-577,BTN,577,1,0,1,MAL & IND LTS Test Button - Push to test", "CPT_MECH(10),3009,PTR-SEAT-ARM-LOCK-785,TUMB,785,-1,0,1,Ejection Safety Lever, ARMED/LOCKED", "CPT_MECH(10),3009,PTR-SEAT-ARM-LOCK-785,TUMB,785,1,0,1,Ejection Safety Lever, ARMED/LOCKED", "ELEC_INTERFACE(3),3001,PTR-ELEC-TMB-MPWR-510,TUMB,510,1,-1,1,MAIN PWR Switch, MAIN PWR/BATT/OFF", "ELEC_INTERFACE(3),3001,PTR-ELEC-TMB-MPWR-510,TUMB,510,-1,-1,1,MAIN PWR Switch, MAIN PWR/BATT/OFF", "MFD_LEFT(24),3023,PTR-LMFCD-RS-SYM-UP-321,BTN,321,1,0,1,Left MFD SYM Rocker Switch, Up/Increase", "UHF_CONTROL_PANEL(37),3013,PTR-ANARC164-STATUS-422,BTN,422,1,0,1,UHF STATUS Button", "IFF_CONTROL_PANEL(35),3005,PTR-AUXCOM-TMB-MONITOR-544,TUMB,544,-1,0,1,IFF MODE 4 MONITOR Switch, OUT/AUDIO", "IFF_CONTROL_PANEL(35),3005,PTR-AUXCOM-TMB-MONITOR-544,TUMB,544,1,0,1,IFF MODE 4 MONITOR Switch, OUT/AUDIO", "MFD_RIGHT(25),3003,PTR-RMFCD-BTN-OSB3-328,BTN,328,1,0,1,Right MFD OSB 3", "KY58(42),3002,PTR-KY58-LVR-MODE2-706,TUMB,706,0.1,0,0.7,KY-58 FILL Knob, Z 1-5/1/2/3/4/5/6/Z ALL", "KY58(42),3002,PTR-KY58-LVR-MODE2-706,TUMB,706,-0.1,0,0.7,KY-58 FILL Knob, Z 1-5/1/2/3/4/5/6/Z ALL", "EHSI(28),3001,PTR-EHSI-BTN-M-46,BTN,46,1,0,1,Mode (M) Button", "UHF_CONTROL_PANEL(37),3014,PTR_ANARC164-CHNL-SELECTOR01-734,TUMB,734,-1,0,1,Access Door, OPEN/CLOSE", "UHF_CONTROL_PANEL(37),3014,PTR_ANARC164-CHNL-SELECTOR01-734,TUMB,734,1,0,1,Access Door, OPEN/CLOSE", "MMC(19),3008,PTR-RHUD-TMB-DED-677,TUMB,677,1,-1,1,HUD DED/PFLD Data Switch, DED / PFL / OFF", "MMC(19),3008,PTR-RHUD-TMB-DED-677,TUMB,677,-1,-1,1,HUD DED/PFLD Data Switch, DED / PFL / OFF", "MMC(19),3009,PTR-RHUD-TMB-DEPR-678,TUMB,678,1,-1,1,HUD Depressible Reticle Switch, STBY / PRI / OFF", "MMC(19),3009,PTR-RHUD-TMB-DEPR-678,TUMB,678,-1,-1,1,HUD Depressible Reticle Switch, STBY / PRI / OFF", "MMC(19),3004,PTR-LGCP-TMB-GNDJETT-355,TUMB,355,-1,0,1,GND JETT ENABLE Switch, ENABLE/OFF", "MMC(19),3004,PTR-LGCP-TMB-GNDJETT-355,TUMB,355,1,0,1,GND JETT ENABLE Switch, ENABLE/OFF", "ENGINE_INTERFACE(6),3008,PTR-ENGSTART-TMB-ENGCNT-449,TUMB,449,-1,0,1,ENG CONT Switch, PRI/SEC", "ENGINE_INTERFACE(6),3008,PTR-ENGSTART-TMB-ENGCNT-449,TUMB,449,1,0,1,ENG CONT Switch, PRI/SEC", "MFD_LEFT(24),3025,PTR-LMFCD-RS-CON-UP-322,BTN,322,1,0,1,Left MFD CON Rocker Switch, Up/Increase", "INTERCOM(39),3007,PTR-AUDIO1-LVR-TF-436,LEV,436,0,0,1,TF Tone Knob", "MFD_RIGHT(25),3027,PTR-RMFCD-RS-BRT-UP-349,BTN,349,1,0,1,Left MFD BRT Rocker Switch, Up/Increase", "MFD_LEFT(24),3013,PTR-LMFCD-BTN-OSB13-312,BTN,312,1,0,1,Left MFD OSB 13", "SAI(47),3003,PTR-SAI-LVR-CAGE-P-66,LEV,66,1,0.375,0.625,SAI Cage Knob, (LMB) Pull to cage /(MW) Adjust aircraft reference symbol", "SAI(47),3002,PTR-SAI-LVR-CAGE-P-66,BTN,67,1,0,1,SAI Cage Knob, (LMB) Pull to cage /(MW) Adjust aircraft reference symbol", "RWR(33),3001,PTR-CMSC-LVR-BRT-140,LEV,140,0,0,0.8,RWR Intensity Knob - Rotate to adjust brightness", "RALT(15),3001,PTR-SNSR-TMB-RDR-673,TUMB,673,1,-1,1,RDR ALT Switch, RDR ALT/STBY/OFF", "RALT(15),3001,PTR-SNSR-TMB-RDR-673,TUMB,673,-1,-1,1,RDR ALT Switch, RDR ALT/STBY/OFF", "MMC(19),3001,PTR-AVIPWR-TMB-MMC-715,TUMB,715,-1,0,1,MMC Switch, MMC/OFF", "MMC(19),3001,PTR-AVIPWR-TMB-MMC-715,TUMB,715,1,0,1,MMC Switch, MMC/OFF", "INTERCOM(39),3004,PTR-AUDIO1-TMB-COMM2-435,TUMB,435,0.5,0,1,COMM 2 (VHF) Mode Knob", "INTERCOM(39),3004,PTR-AUDIO1-TMB-COMM2-435,TUMB,435,-0.5,0,1,COMM 2 (VHF) Mode Knob", "MIDS(41),3001,PTR-AVIPWR-LVR-MIDS-723,TUMB,723,0.1,0,0.2,MIDS LVT Knob, ZERO/OFF/ON", "MIDS(41),3001,PTR-AVIPWR-LVR-MIDS-723,TUMB,723,-0.1,0,0.2,MIDS LVT Knob, ZERO/OFF/ON", "UHF_CONTROL_PANEL(37),3006,PTR-ANARC164-0.025MHZ-SEL-415,TUMB,415,0.25,0,0.75,UHF Manual Frequency Knob 0.025 MHz", "UHF_CONTROL_PANEL(37),3006,PTR-ANARC164-0.025MHZ-SEL-415,TUMB,415,-0.25,0,0.75,UHF Manual Frequency Knob 0.025 MHz", "IDM(60),3001,PTR-AVIPWR-TMB-DL-721,TUMB,721,-1,0,1,DL Switch, DL/OFF", "IDM(60),3001,PTR-AVIPWR-TMB-DL-721,TUMB,721,1,0,1,DL Switch, DL/OFF", "UHF_CONTROL_PANEL(37),3003,PTR-ANARC164-10MHZ-SEL-412,TUMB,412,0.1,0,0.9,UHF Manual Frequency Knob 10 MHz", "UHF_CONTROL_PANEL(37),3003,PTR-ANARC164-10MHZ-SEL-412,TUMB,412,-0.1,0,0.9,UHF Manual Frequency Knob 10 MHz", "UFC(17),3009,PTR-ICP-BTN-NMB7-179,BTN,179,1,0,1,ICP Priority Function Button, 7(MARK)", "INTERCOM(39),3008,PTR-AUDIO1-LVR-THREAT-437,LEV,437,0,0,1,THREAT Tone Knob", "UFC(17),3027,PTR-ICP-TMB-GAIN-189,TUMB,189,1,-1,1,ICP FLIR GAIN/LEVEL Switch, GAIN/LVL/AUTO", "UFC(17),3027,PTR-ICP-TMB-GAIN-189,TUMB,189,-1,-1,1,ICP FLIR GAIN/LEVEL Switch, GAIN/LVL/AUTO", "ENGINE_INTERFACE(6),3004,PTR-ANTICE-TMB-ENG-710,TUMB,710,1,-1,1,Engine ANTI ICE Switch, ON/AUTO/OFF", "ENGINE_INTERFACE(6),3004,PTR-ANTICE-TMB-ENG-710,TUMB,710,-1,-1,1,Engine ANTI ICE Switch, ON/AUTO/OFF", "CPTLIGHTS_SYSTEM(12),3005,PTR-RLGT-LVR-PRIDATA-687,LEV,687,0,0,1,PRIMARY DATA ENTRY DISPLAY BRT Knob", "MMC(19),3014,PTR-AVIPWR-TMB-MFD-717,TUMB,717,-1,0,1,MFD Switch, MFD/OFF", "MMC(19),3014,PTR-AVIPWR-TMB-MFD-717,TUMB,717,1,0,1,MFD Switch, MFD/OFF", "CONTROL_INTERFACE(2),3002,PTR-FLTCP-TMB-AFLP-567,TUMB,567,-1,0,1,ALT FLAPS Switch, NORM/EXTEND", "CONTROL_INTERFACE(2),3002,PTR-FLTCP-TMB-AFLP-567,TUMB,567,1,0,1,ALT FLAPS Switch, NORM/EXTEND", "UFC(17),3008,PTR-ICP-BTN-NMB6-177,BTN,177,1,0,1,ICP Priority Function Button, 6/E(TIME)", "UFC(17),3023,PTR-ICP-LVR-BRT-191,LEV,191,0,0,1,ICP Raster Intensity Knob", "CMDS(32),3011,PTR-LSIDE-BTN-CHAFF-604,BTN,604,1,0,1,CHAFF/FLARE Dispense Button - Push to dispense", "OXYGEN_INTERFACE(8),3002,PTR-OXYCP-LVR-DUL-727,TUMB,727,-1,0,1,Diluter Lever, 100 percent/NORM", "OXYGEN_INTERFACE(8),3002,PTR-OXYCP-LVR-DUL-727,TUMB,727,1,0,1,Diluter Lever, 100 percent/NORM", "INTERCOM(39),3018,PTR-ZROIZE-TMB-ZERO-695,TUMB,695,1,-1,1,ZEROIZE Switch, OFP/OFF/DATA", "INTERCOM(39),3018,PTR-ZROIZE-TMB-ZERO-695,TUMB,695,-1,-1,1,ZEROIZE Switch, OFP/OFF/DATA", "INTERCOM(39),3011,PTR-AUDIO2-LVR-INTERCOM-440,LEV,440,0,0,1,INTERCOM Knob", "MMC(19),3006,PTR-RHUD-TMB-WVAH-675,TUMB,675,1,-1,1,HUD Scales Switch, VV/VAH / VAH / OFF", "MMC(19),3006,PTR-RHUD-TMB-WVAH-675,TUMB,675,-1,-1,1,HUD Scales Switch, VV/VAH / VAH / OFF", "CLOCK(51),3002,PTR-SNSR-TMB-RDR-674,LEV,625,0.04,0,1,Clock Winding and Setting Knob", "CLOCK(51),3001,PTR-SNSR-TMB-RDR-674,BTN,626,1,0,1,Clock Winding and Setting Knob", "RWR(33),3003,PTR-CMSC-BTN-LNCH-143,BTN,143,1,0,1,RWR Indicator Control LAUNCH Button", "ENGINE_INTERFACE(6),3012,PTR-TESTCP-BTN-FIRE-575,BTN,575,1,0,1,FIRE & OHEAT DETECT Test Button - Push to test", "UFC(17),3028,PTR-ICP-TMB-DRIFT-186,TUMB,186,-1,0,1,ICP DRIFT CUTOUT/WARN RESET Switch, DRIFT C/O /NORM/WARN RESET", "UFC(17),3029,PTR-ICP-TMB-DRIFT-186,BTN,186,-1,-1,0,ICP DRIFT CUTOUT/WARN RESET Switch, DRIFT C/O /NORM/WARN RESET", "FUEL_INTERFACE(4),3003,PTR-CDCP-TMB-FTRANS-159,TUMB,159,-1,0,1,External Fuel Transfer Switch, NORM/ WING FIRST", "FUEL_INTERFACE(4),3003,PTR-CDCP-TMB-FTRANS-159,TUMB,159,1,0,1,External Fuel Transfer Switch, NORM/ WING FIRST", "INTERCOM(39),3001,PTR-AUDIO1-LVR-COMM1-430,LEV,430,0,0,1,COMM 1 Power Knob", "MMC(19),3003,PTR-LGCP-BTN-ESJETT-353,BTN,353,1,0,1,EMER STORES JETTISON Button - Push to jettison", "UHF_CONTROL_PANEL(37),3005,PTR-ANARC164-0.1MHZ-SEL-414,TUMB,414,0.1,0,0.9,UHF Manual Frequency Knob 0.1 MHz", "UHF_CONTROL_PANEL(37),3005,PTR-ANARC164-0.1MHZ-SEL-414,TUMB,414,-0.1,0,0.9,UHF Manual Frequency Knob 0.1 MHz", "MFD_RIGHT(25),3018,PTR-RMFCD-BTN-OSB18-343,BTN,343,1,0,1,Right MFD OSB 18", "MFD_LEFT(24),3006,PTR-LMFCD-BTN-OSB6-305,BTN,305,1,0,1,Left MFD OSB 6", "GEAR_INTERFACE(7),3002,PTR-LGCP-BTN-DNLOCK-361,BTN,361,1,0,1,DN LOCK REL Button - Push to reset", "CMDS(32),3002,PTR-LPAN-CMDS-TMB-JMR-374,TUMB,374,-1,0,1,JMR Source Switch, ON/OFF", "CMDS(32),3002,PTR-LPAN-CMDS-TMB-JMR-374,TUMB,374,1,0,1,JMR Source Switch, ON/OFF", "UFC(17),3003,PTR-ICP-BTN-NMB1-171,BTN,171,1,0,1,ICP Priority Function Button, 1(T-ILS)", "MFD_RIGHT(25),3022,PTR-RMFCD-RS-GAIN-DN-346,BTN,346,-1,-1,0,Left MFD GAIN Rocker Switch, Down/Decrease", "MFD_RIGHT(25),3016,PTR-RMFCD-BTN-OSB16-341,BTN,341,1,0,1,Right MFD OSB 16",
-        "MAP(61),3001,PTR-AVIPWR-TMB-MAP-722,TUMB,722,-1,0,1,MAP Switch, MAP/OFF", "MAP(61),3001,PTR-AVIPWR-TMB-MAP-722,TUMB,722,1,0,1,MAP Switch, MAP/OFF", "EHSI(28),3004,PTR-EHSI-LVR-CRS-44,LEV,44,1,0,1,CRS Set / Brightness Control Knob", "EHSI(28),3005,PTR-EHSI-LVR-CRS-44,BTN,43,1,0,1,CRS Set / Brightness Control Knob", "OXYGEN_INTERFACE(8),3005,PTR-TESTCP-TMB-OXY-576,BTN,576,1,0,1,OBOGS BIT Switch, BIT/OFF", "OXYGEN_INTERFACE(8),3005,PTR-TESTCP-TMB-OXY-576,BTN,576,1,0,1,OBOGS BIT Switch, BIT/OFF", "MMC(19),3013,PTR-RHUD-TMB-TEST-682,TUMB,682,1,-1,1,HUD TEST Switch, STEP / ON / OFF", "MMC(19),3013,PTR-RHUD-TMB-TEST-682,TUMB,682,-1,-1,1,HUD TEST Switch, STEP / ON / OFF", "MFD_LEFT(24),3024,PTR-LMFCD-RS-SYM-DN-321,BTN,321,-1,-1,0,Left MFD SYM Rocker Switch, Down/Decrease", "FUEL_INTERFACE(4),3005,PTR-CDCP-TMB-FMODE-158,TUMB,158,0.1,0,0.5,FUEL QTY SEL Knob, TEST(momentarily)/NORM/RSVR/INT WING/EXT WING/EXT CTR", "FUEL_INTERFACE(4),3006,PTR-CDCP-TMB-FMODE-158,BTN,158,-0.1,0,0.5,FUEL QTY SEL Knob, TEST(momentarily)/NORM/RSVR/INT WING/EXT WING/EXT CTR", "RWR(33),3006,PTR-CMSC-BTN-STEST-149,BTN,149,1,0,1,RWR Indicator Control SYS TEST Button", "ADI(50),3001,PTR-ADI-LVR-KNOB-22,LEV,22,0,0,1,Pitch Trim Knob", "UFC(17),3035,PTR-ICP-TMB-RTNSEQ-DN-185,BTN,185,-1,-1,0,ICP Data Control Switch, DN", "UFC(17),3035,PTR-ICP-TMB-RTNSEQ-DN-185,BTN,185,-1,-1,0,ICP Data Control Switch, DN", "MFD_LEFT(24),3002,PTR-LMFCD-BTN-OSB2-301,BTN,301,1,0,1,Left MFD OSB 2", "UFC(17),3024,PTR-ICP-BTN-WX-187,BTN,187,1,0,1,ICP FLIR Polarity Button, Wx", "MFD_LEFT(24),3019,PTR-LMFCD-BTN-OSB19-318,BTN,318,1,0,1,Left MFD OSB 19", "FUEL_INTERFACE(4),3004,PTR-FUELCP-TMB-ENGFEED-556,TUMB,556,0.1,0,0.3,ENGINE FEED Knob, OFF/NORM/AFT/FWD", "FUEL_INTERFACE(4),3004,PTR-FUELCP-TMB-ENGFEED-556,TUMB,556,-0.1,0,0.3,ENGINE FEED Knob, OFF/NORM/AFT/FWD", "INS(14),3001,PTR-AVIPWR-LVR-INS-719,TUMB,719,0.1,0,0.6,INS Knob, OFF/STOR HDG/NORM/NAV/CAL/INFLT ALIGN/ATT", "INS(14),3001,PTR-AVIPWR-LVR-INS-719,TUMB,719,-0.1,0,0.6,INS Knob, OFF/STOR HDG/NORM/NAV/CAL/INFLT ALIGN/ATT", "CONTROL_INTERFACE(2),3006,PTR-MANTRIM-TMB-MODE-564,TUMB,564,-1,0,1,TRIM/AP DISC Switch, DISC/NORM", "CONTROL_INTERFACE(2),3006,PTR-MANTRIM-TMB-MODE-564,TUMB,564,1,0,1,TRIM/AP DISC Switch, DISC/NORM", "RWR(33),3007,PTR-CMSC-BTN-T-151,BTN,151,1,0,1,RWR Indicator Control T Button", "IFF_CONTROL_PANEL(35),3013,PTR-AUXCOM-TMB-CHNL4-551,BTN,551,1,0,1,IFF MODE 3 Selector Lever, DIGIT 2", "IFF_CONTROL_PANEL(35),3014,PTR-AUXCOM-TMB-CHNL4-551,BTN,551,-1,-1,0,IFF MODE 3 Selector Lever, DIGIT 2", "CONTROL_INTERFACE(2),3005,PTR-FLTCP-TMB-LEFLP-572,TUMB,572,-1,0,1,LE FLAPS Switch, AUTO/LOCK", "CONTROL_INTERFACE(2),3005,PTR-FLTCP-TMB-LEFLP-572,TUMB,572,1,0,1,LE FLAPS Switch, AUTO/LOCK", "UFC(17),3004,PTR-ICP-BTN-NMB2-172,BTN,172,1,0,1,ICP Priority Function Button, 2/N(ALOW)", "KY58(42),3005,PTR-KY58-LVR-VOL-708,LEV,708,0,0,1,KY-58 VOLUME Knob", "MFD_RIGHT(25),3011,PTR-RMFCD-BTN-OSB11-336,BTN,336,1,0,1,Right MFD OSB 11", "UHF_CONTROL_PANEL(37),3004,PTR-ANARC164-1MHZ-SEL-413,TUMB,413,0.1,0,0.9,UHF Manual Frequency Knob 1 MHz", "UHF_CONTROL_PANEL(37),3004,PTR-ANARC164-1MHZ-SEL-413,TUMB,413,-0.1,0,0.9,UHF Manual Frequency Knob 1 MHz", "EXTLIGHTS_SYSTEM(11),3005,PTR-EXTLGT-LVR-FORM-535,LEV,535,0,0,1,FORM Knob", "FUEL_INTERFACE(4),3008,PTR-FUELCP-TMB-REFUEL-555,TUMB,555,-1,0,1,AIR REFUEL Switch, OPEN/CLOSE", "FUEL_INTERFACE(4),3008,PTR-FUELCP-TMB-REFUEL-555,TUMB,555,1,0,1,AIR REFUEL Switch, OPEN/CLOSE", "CONTROL_INTERFACE(2),3011,PTR-LGCP-TMB-STCONF-358,TUMB,358,-1,0,1,STORES CONFIG Switch, CAT III/CAT I", "CONTROL_INTERFACE(2),3011,PTR-LGCP-TMB-STCONF-358,TUMB,358,1,0,1,STORES CONFIG Switch, CAT III/CAT I", "INTERCOM(39),3014,PTR-ANTICE-TMB-UHF-712,TUMB,712,1,-1,1,UHF ANT SEL Switch, LOWER/NORM/UPPER", "INTERCOM(39),3014,PTR-ANTICE-TMB-UHF-712,TUMB,712,-1,-1,1,UHF ANT SEL Switch, LOWER/NORM/UPPER", "UFC(17),3001,PTR-AVIPWR-TMB-UFC-718,TUMB,718,-1,0,1,UFC Switch, UFC/OFF", "UFC(17),3001,PTR-AVIPWR-TMB-UFC-718,TUMB,718,1,0,1,UFC Switch, UFC/OFF", "ENGINE_INTERFACE(6),3007,PTR-ENGSTART-CVR-ENGCNT-448,TUMB,448,-1,0,1,ENG CONT Switch Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3007,PTR-ENGSTART-CVR-ENGCNT-448,TUMB,448,1,0,1,ENG CONT Switch Cover, OPEN/CLOSE", "MMC(19),3007,PTR-RHUD-TMB-ATT-676,TUMB,676,1,-1,1,HUD Flightpath Marker Switch, ATT/FPM / FPM / OFF", "MMC(19),3007,PTR-RHUD-TMB-ATT-676,TUMB,676,-1,-1,1,HUD Flightpath Marker Switch, ATT/FPM / FPM / OFF", "CONTROL_INTERFACE(2),3015,PTR-CLCP-BTN-ADV-97,TUMB,97,-1,0,1,ADV MODE Switch", "CONTROL_INTERFACE(2),3015,PTR-CLCP-BTN-ADV-97,TUMB,97,1,0,1,ADV MODE Switch", "IFF_CONTROL_PANEL(35),3006,PTR-AUXCOM-TMB-TACAN-553,TUMB,553,1,-1,1,IFF ENABLE Switch, M1/M3 /OFF/ M3/MS", "IFF_CONTROL_PANEL(35),3006,PTR-AUXCOM-TMB-TACAN-553,TUMB,553,-1,-1,1,IFF ENABLE Switch, M1/M3 /OFF/ M3/MS", "CONTROL_INTERFACE(2),3013,PTR-CLCP-TMB-PITCH-109,BTN,109,1,0,1,Autopilot PITCH Switch, ATT HOLD/ A/P OFF/ ALT HOLD", "CONTROL_INTERFACE(2),3012,PTR-CLCP-TMB-PITCH-109,BTN,109,-1,-1,0,Autopilot PITCH Switch, ATT HOLD/ A/P OFF/ ALT HOLD", "GEAR_INTERFACE(7),3001,PTR-LGCP-ARM-LG-362,TUMB,362,-1,0,1,LG Handle, UP/DN", "GEAR_INTERFACE(7),3001,PTR-LGCP-ARM-LG-362,TUMB,362,1,0,1,LG Handle, UP/DN", "UHF_CONTROL_PANEL(37),3007,PTR-ANARC164-FREQMODE-416,TUMB,416,0.1,0,0.2,UHF Mode Knob", "UHF_CONTROL_PANEL(37),3007,PTR-ANARC164-FREQMODE-416,TUMB,416,-0.1,0,0.2,UHF Mode Knob", "UFC(17),3011,PTR-ICP-BTN-NMB9-181,BTN,181,1,0,1,ICP Priority Function Button, 9(A-CAL)", "MMC(19),3005,PTR-CLCP-TMB-ALT-104,BTN,104,1,0,1,ALT REL Button - Push to release", "RWR(33),3009,PTR-TWAP-BTN-SRCH-395,BTN,395,1,0,1,RWR Indicator Control SEARCH Button", "CPTLIGHTS_SYSTEM(12),3008,PTR-RLGT-TMB-MALIND-691,BTN,691,1,0,1,MAL & IND LTS Switch, BRT/Center/DIM", "CPTLIGHTS_SYSTEM(12),3009,PTR-RLGT-TMB-MALIND-691,BTN,691,-1,-1,0,MAL & IND LTS Switch, BRT/Center/DIM", "UFC(17),3034,PTR-ICP-TMB-RTNSEQ-UP-185,BTN,185,1,0,1,ICP Data Control Switch, UP", "UFC(17),3034,PTR-ICP-TMB-RTNSEQ-UP-185,BTN,185,1,0,1,ICP Data Control Switch, UP", "HMCS(30),3001,PTR-HMDP-LVR-SMBINT-392,LEV,392,0,0,1,HMCS SYMBOLOGY INT Knob", "MFD_LEFT(24),3003,PTR-LMFCD-BTN-OSB3-302,BTN,302,1,0,1,Left MFD OSB 3", "ENGINE_INTERFACE(6),3001,PTR-EPU-CVR-EPUTMB-527,TUMB,527,-1,0,1,EPU Switch Cover for ON, OPEN/CLOSE", "ENGINE_INTERFACE(6),3001,PTR-EPU-CVR-EPUTMB-527,TUMB,527,1,0,1,EPU Switch Cover for ON, OPEN/CLOSE", "MFD_RIGHT(25),3014,PTR-RMFCD-BTN-OSB14-339,BTN,339,1,0,1,Right MFD OSB 14", "CPTLIGHTS_SYSTEM(12),3007,PTR-RLGT-LVR-FLDPNL-690,LEV,690,0,0,1,FLOOD INST PNL BRT Knob", "MFD_RIGHT(25),3021,PTR-RMFCD-RS-GAIN-UP-346,BTN,346,1,0,1,Left MFD GAIN Rocker Switch, Up/Increase", "IFF_CONTROL_PANEL(35),3001,PTR-AUXCOM-TMB-CNI-542,TUMB,542,1,0,1,C & I Knob, UFC/BACKUP", "IFF_CONTROL_PANEL(35),3001,PTR-AUXCOM-TMB-CNI-542,TUMB,542,-1,0,1,C & I Knob, UFC/BACKUP", "RWR(33),3002,PTR-CMSC-BTN-HNDOFF-141,BTN,141,1,0,1,RWR Indicator Control HANDOFF Button", "RWR(33),3004,PTR-CMSC-BTN-MODE-145,BTN,145,1,0,1,RWR Indicator Control MODE Button", "UFC(17),3036,PTR-CPBC-BTN-FACK-122,BTN,122,1,0,1,F-ACK Button", "GEAR_INTERFACE(7),3007,PTR-LGCP-BTN-HORN-359,BTN,359,1,0,1,HORN SILENCER Button - Push to reset", "MFD_RIGHT(25),3010,PTR-RMFCD-BTN-OSB10-335,BTN,335,1,0,1,Right MFD OSB 10", "UFC(17),3021,PTR-ICP-LVR-CONT-193,LEV,193,0,0,1,ICP Raster Contrast Knob", "CMDS(32),3001,PTR-LPAN-CMDS-TMB-RWR-375,TUMB,375,-1,0,1,RWR 555 Switch, ON/OFF", "CMDS(32),3001,PTR-LPAN-CMDS-TMB-RWR-375,TUMB,375,1,0,1,RWR 555 Switch, ON/OFF"],
-    "F-5E": ["ECS_INTERFACE(9),3001,PTR-TMB-RVP-CAB-PRESS-371,TUMB,371,0.5,0,1,Cabin Press Switch, DEFOG ONLY/NORMAL/RAM DUMP", "ECS_INTERFACE(9),3001,PTR-TMB-RVP-CAB-PRESS-371,TUMB,371,-0.5,0,1,Cabin Press Switch, DEFOG ONLY/NORMAL/RAM DUMP", "IFF(22),3022,PTR-IFFCP-CODE-199,LEV,197,1,0,1,IFF MODE 4 CODE Selector, ZERO(use MW to pull switch)/B/A/HOLD", "IFF(22),3007,PTR-IFFCP-CODE-199,BTN,199,1,0,1,IFF MODE 4 CODE Selector, ZERO(use MW to pull switch)/B/A/HOLD", "IFF(22),3007,PTR-IFFCP-CODE-199,BTN,199,-1,-1,0,IFF MODE 4 CODE Selector, ZERO(use MW to pull switch)/B/A/HOLD", "GEAR_INTERFACE(7),3006,PTR-TMB-NOSE-STRUT-250,TUMB,250,-1,0,1,Nose Strut Switch, EXTEND/RETRACT", "GEAR_INTERFACE(7),3006,PTR-TMB-NOSE-STRUT-250,TUMB,250,1,0,1,Nose Strut Switch, EXTEND/RETRACT", "WEAPONS_CONTROL(15),3002,PTR-TMB-LVP-ARMPOS2-347,TUMB,347,-1,0,1,Armament Position Selector Switch - LEFT OUTBD, ON/OFF", "WEAPONS_CONTROL(15),3002,PTR-TMB-LVP-ARMPOS2-347,TUMB,347,1,0,1,Armament Position Selector Switch - LEFT OUTBD, ON/OFF", "FUEL_INTERFACE(4),3005,PTR-TMB-VRP-CRSS-BOOST-381,TUMB,381,-1,0,1,Crossfeed Switch, OPEN/CLOSED", "FUEL_INTERFACE(4),3005,PTR-TMB-VRP-CRSS-BOOST-381,TUMB,381,1,0,1,Crossfeed Switch, OPEN/CLOSED", "CMDS(13),3005,PTR-BTN-CMD-CHF-RESET-403,BTN,403,1,0,1,Chaff Counter Reset Button - Push to reset", "GEAR_INTERFACE(7),3003,PTR-BTN-LG-DWNLOCK-88,BTN,88,1,0,1,Landing Gear Downlock Override Button - Push and hold to override locking solenoid", "CPT_MECH(10),3002,ARM-DRAG-CHUTE-91,BTN,91,-0.1,0,1,Drag Chute T-Handle, PULL/PUSH", "CPT_MECH(10),3002,ARM-DRAG-CHUTE-91,BTN,91,0.1,0,1,Drag Chute T-Handle, PULL/PUSH", "IFF(22),3002,PTR-IFFCP-MODE1-WHEEL2-210,TUMB,210,0.1,0,0.3,IFF MODE 1 Code Selector Wheel 2", "IFF(22),3002,PTR-IFFCP-MODE1-WHEEL2-210,TUMB,210,-0.1,0,0.3,IFF MODE 1 Code Selector Wheel 2", "IFF(22),3003,PTR-IFFCP-MODE3A-WHEEL1-211,TUMB,211,0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 1", "IFF(22),3003,PTR-IFFCP-MODE3A-WHEEL1-211,TUMB,211,-0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 1", "ELEC_INTERFACE(3),3058,PTR-CIRQ-L-UHF-COMM-476,TUMB,476,0,0,1,CB UHF COMMAND RADIO, ON/OFF", "ELEC_INTERFACE(3),3058,PTR-CIRQ-L-UHF-COMM-476,TUMB,476,1,0,1,CB UHF COMMAND RADIO, ON/OFF", "IFF(22),3005,PTR-IFFCP-MODE3A-WHEEL3-213,TUMB,213,0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 3", "IFF(22),3005,PTR-IFFCP-MODE3A-WHEEL3-213,TUMB,213,-0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 3", "CONTROL_INTERFACE(2),3004,PTR-STICK-BTN-PTCH-132,BTN,132,1,0,1,Pitch Damper Cutoff Switch - Push to cutoff", "CMDS(13),3004,PTR-TMB-CMD-JETT-409,TUMB,409,-1,0,1,Flare Jettison Switch, OFF/UP", "CMDS(13),3004,PTR-TMB-CMD-JETT-409,TUMB,409,1,0,1,Flare Jettison Switch, OFF/UP", "INTLIGHTS_SYSTEM(12),3004,PTRLVR-LCP-FLT-222,LEV,222,0,0,1,Flight Instruments Lights Knob", "RWR_IC(19),3004,PTR-RWR-BTN-ALT-561,BTN,561,1,0,1,RWR Indicator Control ALTITUDE Button", "JETTISON_SYSTEM(14),3003,PTR-TMB-LVP-SEL-JETT-367,TUMB,367,1,-1,1,Select Jettison Switch, SELECT POSITION/OFF/ALL PYLONS", "JETTISON_SYSTEM(14),3003,PTR-TMB-LVP-SEL-JETT-367,TUMB,367,-1,-1,1,Select Jettison Switch, SELECT POSITION/OFF/ALL PYLONS", "FUEL_INTERFACE(4),3010,PTR-CVR-LVP-SHOOTOFF-L-359,TUMB,359,-1,0,1,Left Fuel Shutoff Switch Cover, OPEN/CLOSED", "FUEL_INTERFACE(4),3010,PTR-CVR-LVP-SHOOTOFF-L-359,TUMB,359,1,0,1,Left Fuel Shutoff Switch Cover, OPEN/CLOSED", "WEAPONS_CONTROL(15),3007,PTR-TMB-LVP-ARMPOS7-352,TUMB,352,-1,0,1,Armament Position Selector Switch - RIGHT WINGTIP, ON/OFF", "WEAPONS_CONTROL(15),3007,PTR-TMB-LVP-ARMPOS7-352,TUMB,352,1,0,1,Armament Position Selector Switch - RIGHT WINGTIP, ON/OFF", "ELEC_INTERFACE(3),3037,PTR-CIRQ-L-AIM9-L-450,TUMB,450,0,0,1,CB LEFT AIM-9 POWER, ON/OFF", "ELEC_INTERFACE(3),3037,PTR-CIRQ-L-AIM9-L-450,TUMB,450,1,0,1,CB LEFT AIM-9 POWER, ON/OFF", "WEAPONS_CONTROL(15),3008,PTR-TMB-LVP-INTERVAL-340,TUMB,340,1,-1,1,Interval Switch [sec], .06/.10/.14", "WEAPONS_CONTROL(15),3008,PTR-TMB-LVP-INTERVAL-340,TUMB,340,-1,-1,1,Interval Switch [sec], .06/.10/.14", "IFF(22),3001,PTR-IFFCP-MODE1-WHEEL1-209,TUMB,209,0.1,0,0.7,IFF MODE 1 Code Selector Wheel 1", "IFF(22),3001,PTR-IFFCP-MODE1-WHEEL1-209,TUMB,209,-0.1,0,0.7,IFF MODE 1 Code Selector Wheel 1", "ELEC_INTERFACE(3),3028,PTR-CIRQ-R-PITOT-HEAT-231,TUMB,231,0,0,1,CB PITOT HEATER, ON/OFF", "ELEC_INTERFACE(3),3028,PTR-CIRQ-R-PITOT-HEAT-231,TUMB,231,1,0,1,CB PITOT HEATER, ON/OFF", "CONTROL_INTERFACE(2),3002,PTR-TMB-SACP-PITCH-322,TUMB,322,-1,0,1,Pitch Damper Switch, PITCH/OFF", "CONTROL_INTERFACE(2),3002,PTR-TMB-SACP-PITCH-322,TUMB,322,1,0,1,Pitch Damper Switch, PITCH/OFF", "UHF_RADIO(23),3016,PTR-TMB-ANT-SELECT-336,TUMB,336,0.5,0,1,AN/ARC-164, UHF Radio Antenna Selector Switch, UPPER/AUTO/LOWER", "UHF_RADIO(23),3016,PTR-TMB-ANT-SELECT-336,TUMB,336,-0.5,0,1,AN/ARC-164, UHF Radio Antenna Selector Switch, UPPER/AUTO/LOWER", "WEAPONS_CONTROL(15),3014,PTR-TRTL-MSSL-136,BTN,137,1,0,1,Missile Uncage Switch - Press and hold to uncage missile seeker head", "IFF(22),3004,PTR-IFFCP-MODE3A-WHEEL2-212,TUMB,212,0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 2", "IFF(22),3004,PTR-IFFCP-MODE3A-WHEEL2-212,TUMB,212,-0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 2", "IFF(22),3009,PTR-IFFCP-OUT-AUDIO-LGT-201,TUMB,201,1,-1,1,IFF MODE 4 Monitor Control Switch, AUDIO/OUT/LIGHT", "IFF(22),3009,PTR-IFFCP-OUT-AUDIO-LGT-201,TUMB,201,-1,-1,1,IFF MODE 4 Monitor Control Switch, AUDIO/OUT/LIGHT", "ELEC_INTERFACE(3),3001,PTR-TMB-VRP-BATT-387,TUMB,387,-1,0,1,Battery Switch, BATT/OFF", "ELEC_INTERFACE(3),3001,PTR-TMB-VRP-BATT-387,TUMB,387,1,0,1,Battery Switch, BATT/OFF", "AHRS(16),3002,PTR-TMB-COMPASS-MODE-220,TUMB,220,1,0,1,Compass Switch, DIR GYRO/MAG/FAST SLAVE", "AHRS(16),3003,PTR-TMB-COMPASS-MODE-220,BTN,220,-1,-1,0,Compass Switch, DIR GYRO/MAG/FAST SLAVE", "AN_APQ159(17),3010,PTR-LVR-RDR-DSP-VID-68,LEV,68,0.5,0,1,AN/APQ-159 Radar Video Knob - Rotate to adjust video intensity", "OXYGEN_INTERFACE(8),3001,PTR-OXYCP-LVR-SUPP-603,TUMB,603,-1,0,1,Oxygen Supply Lever, ON/OFF", "OXYGEN_INTERFACE(8),3001,PTR-OXYCP-LVR-SUPP-603,TUMB,603,1,0,1,Oxygen Supply Lever, ON/OFF", "AN_APQ159(17),3004,PTR-TMB-RCP-RANGE-315,TUMB,315,0.1,0,0.3,AN/APQ-159 Radar Range Selector Switch [nm], 5/10/20/40", "AN_APQ159(17),3004,PTR-TMB-RCP-RANGE-315,TUMB,315,-0.1,0,0.3,AN/APQ-159 Radar Range Selector Switch [nm], 5/10/20/40", "CONTROL_INTERFACE(2),3010,PTR-STICK-TRIM-DN-125,BTN,125,-1,-1,0,Trimmer Switch, PULL(CLIMB)", "CONTROL_INTERFACE(2),3011,PTR-STICK-TRIM-UP-125,BTN,125,1,0,1,Trimmer Switch, PUSH(DESCEND)", "UHF_RADIO(23),3008,PTR-ANARC164-FUNCTION-311,TUMB,311,0.1,0,0.3,AN/ARC-164, UHF Radio Function Selector Switch, OFF/MAIN/BOTH/ADF", "UHF_RADIO(23),3008,PTR-ANARC164-FUNCTION-311,TUMB,311,-0.1,0,0.3,AN/ARC-164, UHF Radio Function Selector Switch, OFF/MAIN/BOTH/ADF", "GEAR_INTERFACE(7),3009,PTR-BTN-LG-L-93,BTN,93,1,0,1,Nose Landing Gear Lamp - Press to test(LMB)", "AN_APQ159(17),3009,PTR-LVR-RDR-DSP-PER-69,LEV,69,0.5,0,1,AN/APQ-159 Radar Persistence Knob - Rotate to adjust persistence", "RWR_IC(19),3007,PTR-RWR-BTN-SHIP-570,BTN,570,1,0,1,RWR Indicator Control UNKNOWN SHIP Button", "AN_ASG31(18),3002,PTR-LVR-SGT-RET-DPR-42,LEV,42,0,0,1,AN/ASG-31 Sight Reticle Depression Knob - Rotate to adjust manual mode depression angle", "CONTROL_INTERFACE(2),3001,PTR-TMB-SACP-YAW-323,TUMB,323,-1,0,1,Yaw Damper Switch, YAW/OFF", "CONTROL_INTERFACE(2),3001,PTR-TMB-SACP-YAW-323,TUMB,323,1,0,1,Yaw Damper Switch, YAW/OFF", "CONTROL_INTERFACE(2),3005,PTR-ARM-FLAP-LEVER-116,TUMB,116,1,-1,1,Flaps Lever, EMER UP/THUMB SW/FULL", "CONTROL_INTERFACE(2),3005,PTR-ARM-FLAP-LEVER-116,TUMB,116,-1,-1,1,Flaps Lever, EMER UP/THUMB SW/FULL", "AN_ASG31(18),3003,PTR-LVR-SGT-RET-INT-41,LEV,41,0,0,1,AN/ASG-31 Sight Reticle Intensity Knob - Rotate to adjust brightness", "AN_ASG31(18),3004,PTR-BTN-SGT-PNLT-47,TUMB,47,1,-1,1,AN/ASG-31 Sight BIT Switch, BIT 1/OFF/BIT 2", "AN_ASG31(18),3004,PTR-BTN-SGT-PNLT-47,TUMB,47,-1,-1,1,AN/ASG-31 Sight BIT Switch, BIT 1/OFF/BIT 2", "INTLIGHTS_SYSTEM(12),3011,PTR-BTN-MASTER-CAUTION-172,BTN,172,1,0,1,Master Caution Button - Push to reset", "GEAR_INTERFACE(7),3002,PTR-ARM-LG-EMERG-95,BTN,95,1,0,1,Landing Gear Alternate Release Handle, Pull and Hold", "CPT_MECH(10),3005,PTR-ARM-CNP-JETT-384,TUMB,384,0,0,1,Canopy Jettison T-Handle, PULL/PUSH", "CPT_MECH(10),3005,PTR-ARM-CNP-JETT-384,TUMB,384,1,0,1,Canopy Jettison T-Handle, PULL/PUSH", "ECS_INTERFACE(9),3007,PTR-VRP-AIR-INLET-385,LEV,385,-1,-1,1,Cockpit Right Air Inlet", "ECS_INTERFACE(9),3006,PTR-VRP-AIR-INLET-385,LEV,386,1,-1,1,Cockpit Right Air Inlet", "GEAR_INTERFACE(7),3014,PTR-BTN-ARREST-HOOK-89,BTN,89,1,0,1,Arresting Hook Button", "RWR_IC(19),3002,PTR-RWR-BTN-SEARCH-554,BTN,554,1,0,1,RWR Indicator Control SEARCH Button", "RWR_IC(19),3009,PTR-RWR-BTN-LAUNCH-559,BTN,559,1,0,1,RWR Indicator Control LAUNCH Button", "CPT_MECH(10),3003,PTR-TMB-SEAT-ADJ-772,BTN,772,1,0,1,Seat Adjust Switch, DOWN/NEUTRAL/UP", "CPT_MECH(10),3004,PTR-TMB-SEAT-ADJ-772,BTN,772,-1,-1,0,Seat Adjust Switch, DOWN/NEUTRAL/UP", "CMDS(13),3007,PTR-TRTL-CHFF-117,BTN,117,1,0,1,Flare-Chaff Button - Push to dispense", "FUEL_INTERFACE(4),3011,PTR-CVR-LVP-SHOOTOFF-R-361,TUMB,361,-1,0,1,Right Fuel Shutoff Switch Cover, OPEN/CLOSED", "FUEL_INTERFACE(4),3011,PTR-CVR-LVP-SHOOTOFF-R-361,TUMB,361,1,0,1,Right Fuel Shutoff Switch Cover, OPEN/CLOSED", "RWR_IC(19),3005,PTR-RWR-BTN-T-564,BTN,564,1,0,1,RWR Indicator Control T Button", "CONTROL_INTERFACE(2),3012,PTR-STICK-TRIM-L-125,BTN,126,1,0,1,Trimmer Switch, LEFT WING DOWN", "ENGINE_INTERFACE(6),3003,PTR-TMB-RVP-ENG-ANTICE-376,TUMB,376,-1,0,1,Engine Anti-Ice Switch, ENGINE/OFF", "ENGINE_INTERFACE(6),3003,PTR-TMB-RVP-ENG-ANTICE-376,TUMB,376,1,0,1,Engine Anti-Ice Switch, ENGINE/OFF", "FUEL_INTERFACE(4),3008,PTR-TMB-VRP-LFT-BOOST-380,TUMB,380,-1,0,1,Left Boost Pump Switch, ON/OFF", "FUEL_INTERFACE(4),3008,PTR-TMB-VRP-LFT-BOOST-380,TUMB,380,1,0,1,Left Boost Pump Switch, ON/OFF", "ELEC_INTERFACE(3),3036,PTR-CIRQ-R-LDG-TAXI-246,TUMB,246,0,0,1,CB LDG-TAXI LAMP PWR, ON/OFF", "ELEC_INTERFACE(3),3036,PTR-CIRQ-R-LDG-TAXI-246,TUMB,246,1,0,1,CB LDG-TAXI LAMP PWR, ON/OFF",
-        "ELEC_INTERFACE(3),3052,PTR-CIRQ-L-TACAN-469,TUMB,469,0,0,1,CB TACAN, ON/OFF", "ELEC_INTERFACE(3),3052,PTR-CIRQ-L-TACAN-469,TUMB,469,1,0,1,CB TACAN, ON/OFF", "ELEC_INTERFACE(3),3039,PTR-CIRQ-L-GUN-L-451,TUMB,451,0,0,1,CB LEFT GUN FIRING, ON/OFF", "ELEC_INTERFACE(3),3039,PTR-CIRQ-L-GUN-L-451,TUMB,451,1,0,1,CB LEFT GUN FIRING, ON/OFF", "AN_ALR87(20),3001,PTR-CMSC-LVR-BRT-140,LEV,140,0.15,0.15,0.85,RWR Indicator INT Knob - Rotate to adjust brightness", "ACCELEROMETER(27),3001,PTR-LVR-ACC-RESET-904,BTN,904,1,0,1,Accelerometer - Push to set", "WEAPONS_CONTROL(15),3017,PTR-STICK-BTN-TRGG-127,BTN,127,1,0,1,Trigger Button, FIRST DETENT(LMB)/SECOND DETENT(RMB)", "WEAPONS_CONTROL(15),3016,PTR-STICK-BTN-TRGG-127,BTN,127,0.5,0,0.5,Trigger Button, FIRST DETENT(LMB)/SECOND DETENT(RMB)", "INTLIGHTS_SYSTEM(12),3009,PTR-TMB-LCP-BRT-225,BTN,225,1,0,1,Bright/Dim Switch, BRT/NEUT/DIM", "INTLIGHTS_SYSTEM(12),3010,PTR-TMB-LCP-BRT-225,BTN,225,-1,-1,0,Bright/Dim Switch, BRT/NEUT/DIM", "IAS_MACH_INDICATOR(28),3001,PTR-LVR-AIRSPD-SET-180,LEV,180,0,0,1,Index Setting Pointer Knob", "AAU34(31),3003,PTR-LVR-ALT-SET-62,LEV,62,0.04,0,1,Altimeter Zero Setting Knob", "INTLIGHTS_SYSTEM(12),3003,PTR-LVR-LCP-FLOOD-221,LEV,221,0,0,1,Flood Lights Knob", "CONTROL_INTERFACE(2),3007,PTR-TRTL-BRK-101,TUMB,101,1,-1,1,Speed Brake Switch, OUT/OFF/IN", "CONTROL_INTERFACE(2),3007,PTR-TRTL-BRK-101,TUMB,101,-1,-1,1,Speed Brake Switch, OUT/OFF/IN", "OXYGEN_INTERFACE(8),3003,PTR-OXYCP-LVR-EMRG-601,TUMB,601,1,0,1,Emergency Lever, EMERGENCY/NORMAL/TEST MASK", "OXYGEN_INTERFACE(8),3004,PTR-OXYCP-LVR-EMRG-601,BTN,601,-1,-1,0,Emergency Lever, EMERGENCY/NORMAL/TEST MASK", "SAI(34),3002,PNT-LVR-SAI-CAGE-441,LEV,442,0.5,0,1,Cage/Pitch Trim Knob", "SAI(34),3001,PNT-LVR-SAI-CAGE-441,BTN,441,1,0,1,Cage/Pitch Trim Knob", "CLOCK(35),3002,PTR-LVR-WATCH-SET-510,LEV,510,0.04,0,1,ABU-11 Clock Winding and Setting Knob", "CLOCK(35),3001,PTR-LVR-WATCH-SET-510,BTN,511,1,0,1,ABU-11 Clock Winding and Setting Knob", "IFF(22),3017,PTR-BTN-PANIFF-REPLY-215,BTN,217,1,0,1,MODE 4 REPLY Light - Press to test(LMB)", "INTLIGHTS_SYSTEM(12),3001,PTR-BTN-SGT-PNLT-46,TUMB,46,-1,0,1,AN/ASG-31 Sight Panel Light Button, ON/OFF", "INTLIGHTS_SYSTEM(12),3001,PTR-BTN-SGT-PNLT-46,TUMB,46,1,0,1,AN/ASG-31 Sight Panel Light Button, ON/OFF", "IFF(22),3016,PTR-IFFCP-ON-OUT-208,TUMB,208,-1,0,1,IFF MODE 4 Control Switch, ON/OUT", "IFF(22),3016,PTR-IFFCP-ON-OUT-208,TUMB,208,1,0,1,IFF MODE 4 Control Switch, ON/OUT", "GEAR_INTERFACE(7),3004,PTR-STICK-BTN-NOSE-131,BTN,131,1,0,1,Nosewheel Steering Button - Press and Hold to engage nosewheel control", "GEAR_INTERFACE(7),3001,PTR-ARM-LAND-GEAR-83,TUMB,83,0,0,1,Landing Gear Lever, LG UP/LG DOWN", "GEAR_INTERFACE(7),3001,PTR-ARM-LAND-GEAR-83,TUMB,83,1,0,1,Landing Gear Lever, LG UP/LG DOWN", "ELEC_INTERFACE(3),3017,PTR-CIRQUIT-C-01-280,TUMB,280,0,0,1,CB WPN PWR LEFT INBD, ON/OFF", "ELEC_INTERFACE(3),3017,PTR-CIRQUIT-C-01-280,TUMB,280,1,0,1,CB WPN PWR LEFT INBD, ON/OFF", "ELEC_INTERFACE(3),3018,PTR-CIRQUIT-C-02-281,TUMB,281,0,0,1,CB WPN PWR CENTER LINE, ON/OFF", "ELEC_INTERFACE(3),3018,PTR-CIRQUIT-C-02-281,TUMB,281,1,0,1,CB WPN PWR CENTER LINE, ON/OFF", "IFF(22),3015,PTR-IFFCP-MIC-IDENT-207,BTN,207,1,0,1,IFF Identification of Position (IP) Switch, IDENT/OUT/MIC", "IFF(22),3015,PTR-IFFCP-MIC-IDENT-207,TUMB,207,0,-1,0,IFF Identification of Position (IP) Switch, IDENT/OUT/MIC", "ELEC_INTERFACE(3),3019,PTR-CIRQUIT-C-03-282,TUMB,282,0,0,1,CB WPN PWR RIGHT INBD, ON/OFF", "ELEC_INTERFACE(3),3019,PTR-CIRQUIT-C-03-282,TUMB,282,1,0,1,CB WPN PWR RIGHT INBD, ON/OFF", "ELEC_INTERFACE(3),3016,PTR-CIRQUIT-C-04-283,TUMB,283,0,0,1,CB WPN PWR LEFT OUTBD, ON/OFF", "ELEC_INTERFACE(3),3016,PTR-CIRQUIT-C-04-283,TUMB,283,1,0,1,CB WPN PWR LEFT OUTBD, ON/OFF", "HSI(33),3001,PTR-LVR-HSI-HDG-271,LEV,271,0,0,1,HSI Heading Set Knob", "ELEC_INTERFACE(3),3021,PTR-CIRQUIT-C-05-284,TUMB,284,0,0,1,CB WPN ARMING, ON/OFF", "ELEC_INTERFACE(3),3021,PTR-CIRQUIT-C-05-284,TUMB,284,1,0,1,CB WPN ARMING, ON/OFF", "ELEC_INTERFACE(3),3020,PTR-CIRQUIT-C-06-285,TUMB,285,0,0,1,CB WPN PWR RIGHT OUTBD, ON/OFF", "ELEC_INTERFACE(3),3020,PTR-CIRQUIT-C-06-285,TUMB,285,1,0,1,CB WPN PWR RIGHT OUTBD, ON/OFF", "CONTROL_INTERFACE(2),3006,PTR-TRTL-FLPS-115,TUMB,115,1,-1,1,Auto Flap System Thumb Switch, UP/FIXED/AUTO", "CONTROL_INTERFACE(2),3006,PTR-TRTL-FLPS-115,TUMB,115,-1,-1,1,Auto Flap System Thumb Switch, UP/FIXED/AUTO", "ELEC_INTERFACE(3),3002,PTR-TMB-VRP-GEN-L-388,TUMB,388,1,0,1,Left Generator Switch, L GEN/OFF/RESET", "ELEC_INTERFACE(3),3003,PTR-TMB-VRP-GEN-L-388,BTN,388,-1,-1,0,Left Generator Switch, L GEN/OFF/RESET", "ECS_INTERFACE(9),3012,PTR-AIR-INLET-L-2,LEV,718,-1,-1,1,Cockpit Left Air Inlet 2", "ECS_INTERFACE(9),3011,PTR-AIR-INLET-L-2,LEV,717,1,-1,1,Cockpit Left Air Inlet 2", "ELEC_INTERFACE(3),3026,PTR-CIRQUIT-C-07-286,TUMB,286,0,0,1,CB JETTISON CONTROL, ON/OFF", "ELEC_INTERFACE(3),3026,PTR-CIRQUIT-C-07-286,TUMB,286,1,0,1,CB JETTISON CONTROL, ON/OFF", "CONTROL_INTERFACE(2),3013,PTR-STICK-TRIM-R-125,BTN,126,-1,-1,0,Trimmer Switch, RIGHT WING DOWN", "ELEC_INTERFACE(3),3022,PTR-CIRQUIT-C-08-287,TUMB,287,0,0,1,CB WPN RELEASE, ON/OFF", "ELEC_INTERFACE(3),3022,PTR-CIRQUIT-C-08-287,TUMB,287,1,0,1,CB WPN RELEASE, ON/OFF", "ELEC_INTERFACE(3),3023,PTR-CIRQUIT-C-09-288,TUMB,288,0,0,1,CB WPN MODE SEL & AIM-9-INTLK, ON/OFF", "ELEC_INTERFACE(3),3023,PTR-CIRQUIT-C-09-288,TUMB,288,1,0,1,CB WPN MODE SEL & AIM-9-INTLK, ON/OFF", "CONTROL_INTERFACE(2),3014,PTR-LVR-PEDAL-ADJ-278,TUMB,278,0,0,1,Rudder Pedal Adjust T-Handle, PULL/STOW", "CONTROL_INTERFACE(2),3014,PTR-LVR-PEDAL-ADJ-278,TUMB,278,1,0,1,Rudder Pedal Adjust T-Handle, PULL/STOW", "GEAR_INTERFACE(7),3005,PTR-ARM-LG-RESET-98,TUMB,98,0,0,1,Gear Alternate Release Reset Control, OFF/RESET", "GEAR_INTERFACE(7),3005,PTR-ARM-LG-RESET-98,TUMB,98,1,0,1,Gear Alternate Release Reset Control, OFF/RESET", "ELEC_INTERFACE(3),3024,PTR-CIRQUIT-C-11-290,TUMB,290,0,0,1,CB LEFT AIM-9 CONT, ON/OFF", "ELEC_INTERFACE(3),3024,PTR-CIRQUIT-C-11-290,TUMB,290,1,0,1,CB LEFT AIM-9 CONT, ON/OFF", "ECS_INTERFACE(9),3004,PTR-LVR-RVP-CPT-TEMP-373,LEV,373,0,-1,1,Cabin Temperature Knob", "AN_APQ159(17),3011,PRT-LVR-RDR-DSP-CUR-67,LEV,67,0.5,0,1,AN/APQ-159 Radar Cursor Knob - Rotate to adjust indication brightness", "(0),3002,PTR-CNPY-MIRROR-L-4,TUMB,0,-1,0,1,Toggle Mirrors", "(0),3002,PTR-CNPY-MIRROR-L-4,TUMB,0,1,0,1,Toggle Mirrors", "AHRS(16),3001,PTR-BTN-FSTERECT-166,BTN,166,1,0,1,Fast Erect Button - Push to erect", "ENGINE_INTERFACE(6),3002,PTR-BTN-LVP-ENG-START-R-358,BTN,358,1,0,1,Right Engine Start Button - Push to start", "ELEC_INTERFACE(3),3041,PTR-CIRQ-L-28V-AC-453,TUMB,453,0,0,1,CB 26 VOLT AC POWER, ON/OFF", "ELEC_INTERFACE(3),3041,PTR-CIRQ-L-28V-AC-453,TUMB,453,1,0,1,CB 26 VOLT AC POWER, ON/OFF", "WEAPONS_CONTROL(15),3015,PTR-LVR-LVP-MISSILE-VOL-345,LEV,345,0.5,0,1,Missile Volume Knob - Rotate to adjust volume", "RWR_IC(19),3011,PTR-RWR-LVR-DIM-578,LEV,578,0.9,0,1,RWR Indicator Control DIM Knob - Rotate to adjust brightness", "AN_APQ159(17),3007,PTR-LVR-RDR-DSP-SCL-65,LEV,65,0.5,0,1,AN/APQ-159 Radar Scale Knob - Rotate to adjust scale brightness", "IFF(22),3006,PTR-IFFCP-MODE3A-WHEEL4-214,TUMB,214,0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 4", "IFF(22),3006,PTR-IFFCP-MODE3A-WHEEL4-214,TUMB,214,-0.1,0,0.7,IFF MODE 3/A Code Selector Wheel 4", "RWR_IC(19),3001,PTR-RWR-BTN-MODE-551,BTN,551,1,0,1,RWR Indicator Control MODE Button", "AN_APQ159(17),3006,PTR-BTN-RCP-ASQ-317,BTN,317,1,0,1,AN/APQ-159 Radar Acquisition Button", "IFF(22),3011,PTR-IFFCP-TEST-M-2-203,BTN,203,1,0,1,IFF Mode Select/TEST Switch, M-2 /ON/OUT", "IFF(22),3011,PTR-IFFCP-TEST-M-2-203,TUMB,203,0,-1,0,IFF Mode Select/TEST Switch, M-2 /ON/OUT", "EXTLIGHTS_SYSTEM(11),3001,PTR-LVR-LCP-NAV-227,LEV,227,0,0,1,Exterior Lights Nav Knob", "IFF(22),3010,PTR-IFFCP-TEST-M-1-202,BTN,202,1,0,1,IFF Mode Select/TEST Switch, M-1 /ON/OUT", "IFF(22),3010,PTR-IFFCP-TEST-M-1-202,TUMB,202,0,-1,0,IFF Mode Select/TEST Switch, M-1 /ON/OUT", "GEAR_INTERFACE(7),3007,PTR-BTN-LG-WARN-87,BTN,87,1,0,1,Landing Gear And Flap Warning Silence Button", "ELEC_INTERFACE(3),3043,PTR-CIRQ-L-C-AD-COMP-455,TUMB,455,0,0,1,CB CENTRAL AIR DATA COMPUTER, ON/OFF", "ELEC_INTERFACE(3),3043,PTR-CIRQ-L-C-AD-COMP-455,TUMB,455,1,0,1,CB CENTRAL AIR DATA COMPUTER, ON/OFF", "CMDS(13),3002,PTR-LVR-CMD-FLR-MODE-404,TUMB,404,0.1,0,0.2,Flare Mode Selector, OFF/SINGLE/PRGM", "CMDS(13),3002,PTR-LVR-CMD-FLR-MODE-404,TUMB,404,-0.1,0,0.2,Flare Mode Selector, OFF/SINGLE/PRGM", "ELEC_INTERFACE(3),3038,PTR-CIRQ-L-AIM9-R-457,TUMB,457,0,0,1,CB RIGHT AIM-9 POWER, ON/OFF", "ELEC_INTERFACE(3),3038,PTR-CIRQ-L-AIM9-R-457,TUMB,457,1,0,1,CB RIGHT AIM-9 POWER, ON/OFF", "AAU34(31),3001,PTR-TMB-ALT-MODE-60,BTN,60,1,0,1,Altimeter Mode Control Lever, ELECT(rical)/PNEU(matic)", "AAU34(31),3002,PTR-TMB-ALT-MODE-60,BTN,60,-1,-1,0,Altimeter Mode Control Lever, ELECT(rical)/PNEU(matic)", "ELEC_INTERFACE(3),3060,PTR-CIRQ-L-LE-R-478,TUMB,478,0,0,1,CB RIGHT LE FLAP CONT, ON/OFF", "ELEC_INTERFACE(3),3060,PTR-CIRQ-L-LE-R-478,TUMB,478,1,0,1,CB RIGHT LE FLAP CONT, ON/OFF", "JETTISON_SYSTEM(14),3004,PTR-BTN-LVP-SEL-JETT-366,BTN,366,1,0,1,Select Jettison Button - Push to jettison", "ELEC_INTERFACE(3),3050,PTR-CIRQ-L-FUEL-QTY-467,TUMB,467,0,0,1,CB FUEL QTY PRIMARY, ON/OFF", "ELEC_INTERFACE(3),3050,PTR-CIRQ-L-FUEL-QTY-467,TUMB,467,1,0,1,CB FUEL QTY PRIMARY, ON/OFF", "IFF(22),3023,PTR-IFFCP-MASTER-200,LEV,198,1,0,1,IFF MASTER Control Selector, EMER(use MW to pull switch)/NORM/LOW/STBY/OFF", "IFF(22),3008,PTR-IFFCP-MASTER-200,TUMB,200,0.1,0,0.4,IFF MASTER Control Selector, EMER(use MW to pull switch)/NORM/LOW/STBY/OFF", "IFF(22),3008,PTR-IFFCP-MASTER-200,TUMB,200,-0.1,0,0.4,IFF MASTER Control Selector, EMER(use MW to pull switch)/NORM/LOW/STBY/OFF", "CMDS(13),3006,PTR-BTN-CMD-FLR-RESET-407,BTN,407,1,0,1,Flare Counter Reset Button - Push to reset", "FUEL_INTERFACE(4),3004,PTR-TMB-VRP-FUEL-TRANS-FUZ-377,TUMB,377,-1,0,1,Ext Fuel Cl Switch, ON/OFF", "FUEL_INTERFACE(4),3004,PTR-TMB-VRP-FUEL-TRANS-FUZ-377,TUMB,377,1,0,1,Ext Fuel Cl Switch, ON/OFF",
-        "ELEC_INTERFACE(3),3007,PTR-TMB-FOCP-FUELOXY-230,BTN,230,1,0,1,Fuel & Oxygen Switch, GAGE TEST/OFF/QTY CHECK", "ELEC_INTERFACE(3),3008,PTR-TMB-FOCP-FUELOXY-230,BTN,230,-1,-1,0,Fuel & Oxygen Switch, GAGE TEST/OFF/QTY CHECK", "AN_APQ159(17),3008,PTR-LVR-RDR-DSP-BRT-70,LEV,70,0.5,0,1,AN/APQ-159 Radar Bright Knob - Rotate to adjust brightness", "ELEC_INTERFACE(3),3051,PTR-CIRQ-L-ATTD-C-468,TUMB,468,0,0,1,CB ATTD & HDG REF SYS C, ON/OFF", "ELEC_INTERFACE(3),3051,PTR-CIRQ-L-ATTD-C-468,TUMB,468,1,0,1,CB ATTD & HDG REF SYS C, ON/OFF", "RWR_IC(19),3012,PTR-RWR-LVR-AUDIO-577,LEV,577,0.9,0,1,RWR Indicator Control AUDIO Knob - Rotate to adjust volume", "ELEC_INTERFACE(3),3054,PTR-CIRQ-L-BOOST-472,TUMB,472,0,0,1,CB L BOOST CL & TIP TANK FUEL CONT, ON/OFF", "ELEC_INTERFACE(3),3054,PTR-CIRQ-L-BOOST-472,TUMB,472,1,0,1,CB L BOOST CL & TIP TANK FUEL CONT, ON/OFF", "ELEC_INTERFACE(3),3027,PTR-CIRQUIT-C-10-289,TUMB,289,0,0,1,CB EMERGENCY ALL JETTISON, ON/OFF", "ELEC_INTERFACE(3),3027,PTR-CIRQUIT-C-10-289,TUMB,289,1,0,1,CB EMERGENCY ALL JETTISON, ON/OFF", "ELEC_INTERFACE(3),3055,PTR-CIRQ-L-IGN-INV-473,TUMB,473,0,0,1,CB IGNITION INVERTER POWER, ON/OFF", "ELEC_INTERFACE(3),3055,PTR-CIRQ-L-IGN-INV-473,TUMB,473,1,0,1,CB IGNITION INVERTER POWER, ON/OFF", "TACAN_CTRL_PANEL(41),3005,PTR-TACAN-VOL-261,LEV,261,0.8,0,1,TACAN Signal Volume Knob", "ELEC_INTERFACE(3),3057,PTR-CIRQ-L-ENG-R-475,TUMB,475,0,0,1,CB R ENG START & AB CONT, ON/OFF", "ELEC_INTERFACE(3),3057,PTR-CIRQ-L-ENG-R-475,TUMB,475,1,0,1,CB R ENG START & AB CONT, ON/OFF", "GEAR_INTERFACE(7),3010,PTR-BTN-LG-L-94,BTN,94,1,0,1,Right Landing Gear Lamp - Press to test(LMB)", "FUEL_INTERFACE(4),3007,PTR-TMB-VRP-AUTO-BAL-383,BTN,383,1,0,1,Autobalance Switch, LEFT/NEUT/RIGHT", "FUEL_INTERFACE(4),3006,PTR-TMB-VRP-AUTO-BAL-383,BTN,383,-1,-1,0,Autobalance Switch, LEFT/NEUT/RIGHT", "ELEC_INTERFACE(3),3059,PTR-CIRQ-L-LE-L-477,TUMB,477,0,0,1,CB LEFT LE FLAP CONT, ON/OFF", "ELEC_INTERFACE(3),3059,PTR-CIRQ-L-LE-L-477,TUMB,477,1,0,1,CB LEFT LE FLAP CONT, ON/OFF", "ELEC_INTERFACE(3),3048,PTR-CIRQ-L-LENG-AUX-463,TUMB,463,0,0,1,CB L ENG AUX DOOR, ON/OFF", "ELEC_INTERFACE(3),3048,PTR-CIRQ-L-LENG-AUX-463,TUMB,463,1,0,1,CB L ENG AUX DOOR, ON/OFF", "ELEC_INTERFACE(3),3061,PTR-CIRQ-L-TE-L-479,TUMB,479,0,0,1,CB LEFT TE FLAP CONT, ON/OFF", "ELEC_INTERFACE(3),3061,PTR-CIRQ-L-TE-L-479,TUMB,479,1,0,1,CB LEFT TE FLAP CONT, ON/OFF", "ELEC_INTERFACE(3),3062,PTR-CIRQ-L-TE-R-480,TUMB,480,0,0,1,CB RIGHT TE FLAP CONT & IND, ON/OFF", "ELEC_INTERFACE(3),3062,PTR-CIRQ-L-TE-R-480,TUMB,480,1,0,1,CB RIGHT TE FLAP CONT & IND, ON/OFF", "CPT_MECH(10),3001,PTR-ARM-CANOPY-712,TUMB,0,0,0,1,Canopy Handle, OPEN/CLOSE", "CPT_MECH(10),3001,PTR-ARM-CANOPY-712,TUMB,0,1,0,1,Canopy Handle, OPEN/CLOSE", "WEAPONS_CONTROL(15),3012,PTR-LVR-LVP-EXT-STORE-344,TUMB,344,0.1,0,0.3,External Stores Selector, RIPL/BOMB/SAFE/RKT DISP", "WEAPONS_CONTROL(15),3012,PTR-LVR-LVP-EXT-STORE-344,TUMB,344,-0.1,0,0.3,External Stores Selector, RIPL/BOMB/SAFE/RKT DISP", "ENGINE_INTERFACE(6),3001,PTR-BTN-LVP-ENG-START-L-357,BTN,357,1,0,1,Left Engine Start Button - Push to start", "EXTLIGHTS_SYSTEM(11),3003,PTR-TMB-LCP-BEAKON-229,TUMB,229,-1,0,1,Exterior Lights Beacon Switch, BEACON/OFF", "EXTLIGHTS_SYSTEM(11),3003,PTR-TMB-LCP-BEAKON-229,TUMB,229,1,0,1,Exterior Lights Beacon Switch, BEACON/OFF", "WEAPONS_CONTROL(15),3011,PTR-TMB-LVP-GUM-MSL-CAM-343,TUMB,343,1,-1,1,Guns, Missile and Camera Switch, GUNS MSL & CAMR/OFF/CAMR ONLY", "WEAPONS_CONTROL(15),3011,PTR-TMB-LVP-GUM-MSL-CAM-343,TUMB,343,-1,-1,1,Guns, Missile and Camera Switch, GUNS MSL & CAMR/OFF/CAMR ONLY", "AN_APQ159(17),3012,PTR-LVR-RDR-DSP-PITCH-66,LEV,66,0,-0.75,0.75,AN/APQ-159 Radar Pitch Knob - Rotate to adjust horizon bar", "ELEC_INTERFACE(3),3030,PTR-CIRQ-R-CAB-VALV-234,TUMB,234,0,0,1,CB CABIN AIR VALVES, ON/OFF", "ELEC_INTERFACE(3),3030,PTR-CIRQ-R-CAB-VALV-234,TUMB,234,1,0,1,CB CABIN AIR VALVES, ON/OFF", "ELEC_INTERFACE(3),3031,PTR-CIRQ-R-INS-LGT-238,TUMB,238,0,0,1,CB INST LIGHTS, ON/OFF", "ELEC_INTERFACE(3),3031,PTR-CIRQ-R-INS-LGT-238,TUMB,238,1,0,1,CB INST LIGHTS, ON/OFF", "ECS_INTERFACE(9),3010,PTR-AIR-VLV-L1-719,LEV,719,0,-1,1,Cockpit Left Air Inlet 1 Valve", "EXTLIGHTS_SYSTEM(11),3004,PTR-TMB-LVP-LIGHTS-LAND-353,TUMB,353,-1,0,1,Landing & Taxi Light Switch, ON/OFF", "EXTLIGHTS_SYSTEM(11),3004,PTR-TMB-LVP-LIGHTS-LAND-353,TUMB,353,1,0,1,Landing & Taxi Light Switch, ON/OFF", "FUEL_INTERFACE(4),3003,PTR-TMB-VRP-FUEL-TRANS-PYL-378,TUMB,378,-1,0,1,Ext Fuel Pylons Switch, ON/OFF", "FUEL_INTERFACE(4),3003,PTR-TMB-VRP-FUEL-TRANS-PYL-378,TUMB,378,1,0,1,Ext Fuel Pylons Switch, ON/OFF", "ELEC_INTERFACE(3),3006,PTR-TMB-RVP-PITOT-HEAT-375,TUMB,375,-1,0,1,Pitot Anti-Ice Switch, PITOT/OFF", "ELEC_INTERFACE(3),3006,PTR-TMB-RVP-PITOT-HEAT-375,TUMB,375,1,0,1,Pitot Anti-Ice Switch, PITOT/OFF", "ELEC_INTERFACE(3),3034,PTR-CIRQ-R-CAUT-LGT-244,TUMB,244,0,0,1,CB CAUTION & WARN LIGHTS-DIM, ON/OFF", "ELEC_INTERFACE(3),3034,PTR-CIRQ-R-CAUT-LGT-244,TUMB,244,1,0,1,CB CAUTION & WARN LIGHTS-DIM, ON/OFF", "AN_APQ159(17),3001,PTR-LVR-RCP-ANT-ELEV-321,LEV,321,0.5,-1,1,AN/APQ-159 Radar Elevation Antenna Tilt Control Knob - Rotate to adjust antenna elevation", "UHF_RADIO(23),3003,PTR-ANARC164-10MHZ-SELECTOR-303,TUMB,328,-0.1,0.1,1,AN/ARC-164, UHF Radio 10 MHz Frequency Selector Knob", "UHF_RADIO(23),3003,PTR-ANARC164-10MHZ-SELECTOR-303,TUMB,328,0.1,0.1,1,AN/ARC-164, UHF Radio 10 MHz Frequency Selector Knob", "UHF_RADIO(23),3004,PTR-ANARC164-1MHZ-SELECTOR-304,TUMB,329,-0.1,0.1,1,AN/ARC-164, UHF Radio 1 MHz Frequency Selector Knob", "UHF_RADIO(23),3004,PTR-ANARC164-1MHZ-SELECTOR-304,TUMB,329,0.1,0.1,1,AN/ARC-164, UHF Radio 1 MHz Frequency Selector Knob", "AN_ASG31(18),3001,PTR-LVR-SGT-MODE-40,TUMB,40,0.1,0,0.4,AN/ASG-31 Sight Mode Selector, OFF/MSL/A/A1 GUNS/A/A2 GUNS/MAN", "AN_ASG31(18),3001,PTR-LVR-SGT-MODE-40,TUMB,40,-0.1,0,0.4,AN/ASG-31 Sight Mode Selector, OFF/MSL/A/A1 GUNS/A/A2 GUNS/MAN", "UHF_RADIO(23),3005,PTR-ANARC164-0.1MHZ-SELECTOR-305,TUMB,330,-0.1,0.1,1,AN/ARC-164, UHF Radio 0.1 MHz Frequency Selector Knob", "UHF_RADIO(23),3005,PTR-ANARC164-0.1MHZ-SELECTOR-305,TUMB,330,0.1,0.1,1,AN/ARC-164, UHF Radio 0.1 MHz Frequency Selector Knob", "ELEC_INTERFACE(3),3049,PTR-CIRQ-L-CAB-COND-464,TUMB,464,0,0,1,CB CABIN COND, ON/OFF", "ELEC_INTERFACE(3),3049,PTR-CIRQ-L-CAB-COND-464,TUMB,464,1,0,1,CB CABIN COND, ON/OFF", "AN_ASG31(18),3007,PTR-TRTL-SGHT-137,BTN,136,1,0,1,AN/ASG-31 Sight Cage Switch - Press and hold to cage", "UHF_RADIO(23),3006,PTR-ANARC164-0.025MHZ-SELECTOR-306,TUMB,331,-0.25,0.25,1,AN/ARC-164, UHF Radio 0.025 MHz Frequency Selector Knob", "UHF_RADIO(23),3006,PTR-ANARC164-0.025MHZ-SELECTOR-306,TUMB,331,0.25,0.25,1,AN/ARC-164, UHF Radio 0.025 MHz Frequency Selector Knob", "KNEEBOARD(39),3007,PTR-MAP-CASE-252,BTN,252,1,0,1,Kneeboard, ON/OFF", "UHF_RADIO(23),3007,PTR-ANARC164-FREQMODE-307,TUMB,307,0.1,0,0.2,AN/ARC-164, UHF Radio Frequency Mode Selector Switch, MANUAL/PRESET/GUARD", "UHF_RADIO(23),3007,PTR-ANARC164-FREQMODE-307,TUMB,307,-0.1,0,0.2,AN/ARC-164, UHF Radio Frequency Mode Selector Switch, MANUAL/PRESET/GUARD", "ELEC_INTERFACE(3),3025,PTR-CIRQUIT-C-12-291,TUMB,291,0,0,1,CB RIGHT AIM-9 CONT, ON/OFF", "ELEC_INTERFACE(3),3025,PTR-CIRQUIT-C-12-291,TUMB,291,1,0,1,CB RIGHT AIM-9 CONT, ON/OFF", "FUEL_INTERFACE(4),3002,PTR-TMB-LVP-SHOOTOFF-R-362,TUMB,362,-1,0,1,Right Fuel Shutoff Switch, OPEN/CLOSED", "FUEL_INTERFACE(4),3002,PTR-TMB-LVP-SHOOTOFF-R-362,TUMB,362,1,0,1,Right Fuel Shutoff Switch, OPEN/CLOSED", "AN_APQ159(17),3005,PTR-LVR-RCP-MODE-316,TUMB,316,0.1,0,0.3,AN/APQ-159 Radar Mode Selector Switch, OFF/STBY/OPER/TEST", "AN_APQ159(17),3005,PTR-LVR-RCP-MODE-316,TUMB,316,-0.1,0,0.3,AN/APQ-159 Radar Mode Selector Switch, OFF/STBY/OPER/TEST", "INTLIGHTS_SYSTEM(12),3002,PTR-TMB-COMPASS-LGT-613,TUMB,613,-1,0,1,Magnetic Compass Light Switch, LIGHT/OFF", "INTLIGHTS_SYSTEM(12),3002,PTR-TMB-COMPASS-LGT-613,TUMB,613,1,0,1,Magnetic Compass Light Switch, LIGHT/OFF", "UHF_RADIO(23),3009,PTR-ANARC164-T-TONE-310,BTN,310,1,0,1,AN/ARC-164, UHF Radio Tone Button", "WEAPONS_CONTROL(15),3003,PTR-TMB-LVP-ARMPOS3-348,TUMB,348,-1,0,1,Armament Position Selector Switch - LEFT INBD, ON/OFF", "WEAPONS_CONTROL(15),3003,PTR-TMB-LVP-ARMPOS3-348,TUMB,348,1,0,1,Armament Position Selector Switch - LEFT INBD, ON/OFF", "UHF_RADIO(23),3010,PTR-ANARC164-SQUELCH-308,TUMB,308,-1,0,1,AN/ARC-164, UHF Radio Squelch Switch, ON/OFF", "UHF_RADIO(23),3010,PTR-ANARC164-SQUELCH-308,TUMB,308,1,0,1,AN/ARC-164, UHF Radio Squelch Switch, ON/OFF", "ECS_INTERFACE(9),3003,PTR-TMB-RVP-CPT-TEMP-372,TUMB,372,-0.1,0,0.6,Cabin Temp Switch, AUTO/CENTER/MAN COLD/MAN HOT", "ECS_INTERFACE(9),3003,PTR-TMB-RVP-CPT-TEMP-372,TUMB,372,0.1,0,0.6,Cabin Temp Switch, AUTO/CENTER/MAN COLD/MAN HOT", "CLOCK(35),3003,PTR-LVR-WATCH-ELPS-512,BTN,512,1,0,1,ABU-11 Clock Elapsed Time Knob", "JETTISON_SYSTEM(14),3002,PTR-BTN-LVP-EMER-JETT-365,BTN,365,1,0,1,Emergency All Jettison Button - Push to jettison", "INTERCOM(24),3001,PTR-TRTL-MIC-135,BTN,135,1,0,1,AN/ARC-164, UHF Radio Microphone Button", "ELEC_INTERFACE(3),3047,PTR-CIRQ-L-TOT-TEMP-462,TUMB,462,0,0,1,CB TOTAL TEMP PROBE HTR, ON/OFF", "ELEC_INTERFACE(3),3047,PTR-CIRQ-L-TOT-TEMP-462,TUMB,462,1,0,1,CB TOTAL TEMP PROBE HTR, ON/OFF", "WEAPONS_CONTROL(15),3006,PTR-TMB-LVP-ARMPOS6-351,TUMB,351,-1,0,1,Armament Position Selector Switch - RIGHT OUTBD, ON/OFF", "WEAPONS_CONTROL(15),3006,PTR-TMB-LVP-ARMPOS6-351,TUMB,351,1,0,1,Armament Position Selector Switch - RIGHT OUTBD, ON/OFF", "UHF_RADIO(23),3022,PTR-ANARC164-COVER-335,TUMB,335,-1,0,1,AN/ARC-164, Hinged Access Door, OPEN/CLOSE", "UHF_RADIO(23),3022,PTR-ANARC164-COVER-335,TUMB,335,1,0,1,AN/ARC-164, Hinged Access Door, OPEN/CLOSE", "ECS_INTERFACE(9),3009,PTR-AIR-INLET-L-1,LEV,716,-1,-1,1,Cockpit Left Air Inlet 1", "ECS_INTERFACE(9),3008,PTR-AIR-INLET-L-1,LEV,715,1,-1,1,Cockpit Left Air Inlet 1", "UHF_RADIO(23),3024,PTR-ANARC164-LOAD-314,BTN,314,1,0,1,AN/ARC-164, Preset Channel Set Button - Press to set channel frequency", "TACAN_CTRL_PANEL(41),3001,PTR-TACAN-CHANNEL-SELECTOR-1-256,LEV,256,0.1,0,1,TACAN Channel Selector (Tens) - Rotate mouse wheel to select",
-        "INTLIGHTS_SYSTEM(12),3007,PTR-LVR-LVP-ARM-LGT-363,LEV,363,0,0,1,Armament Panel Lights Knob", "TACAN_CTRL_PANEL(41),3002,PTR-TACAN-CHANNEL-SELECTOR-2-257,LEV,257,0.1,0,1,TACAN Channel Selector (Ones) / X/Y Mode - Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "TACAN_CTRL_PANEL(41),3003,PTR-TACAN-CHANNEL-SELECTOR-2-257,TUMB,258,1,0,1,TACAN Channel Selector (Ones) / X/Y Mode - Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "TACAN_CTRL_PANEL(41),3003,PTR-TACAN-CHANNEL-SELECTOR-2-257,TUMB,258,-1,0,1,TACAN Channel Selector (Ones) / X/Y Mode - Right mouse click to select X/Y. Rotate mouse wheel to make channel selection", "CMDS(13),3001,PTR-LVR-CMD-CHF-MODE-400,TUMB,400,0.1,0,0.3,Chaff Mode Selector, OFF/SINGLE/PRGM/MULT", "CMDS(13),3001,PTR-LVR-CMD-CHF-MODE-400,TUMB,400,-0.1,0,0.3,Chaff Mode Selector, OFF/SINGLE/PRGM/MULT", "TACAN_CTRL_PANEL(41),3004,PTR-TACAN-TEST-259,BTN,259,1,0,1,TACAN Signal on HSI Test Button", "ELEC_INTERFACE(3),3056,PTR-CIRQ-L-ENG-L-474,TUMB,474,0,0,1,CB L ENG START & AB CONT, ON/OFF", "ELEC_INTERFACE(3),3056,PTR-CIRQ-L-ENG-L-474,TUMB,474,1,0,1,CB L ENG START & AB CONT, ON/OFF", "CMDS(13),3003,PTR-CAP-CMD-JETT-408,TUMB,408,-1,0,1,Flare Jettison Switch Cover, OPEN/CLOSED", "CMDS(13),3003,PTR-CAP-CMD-JETT-408,TUMB,408,1,0,1,Flare Jettison Switch Cover, OPEN/CLOSED", "CONTROL_INTERFACE(2),3003,PTR-LVR-SACP-TRIM-324,LEV,324,0,-1,1,Rudder Trim Knob", "WEAPONS_CONTROL(15),3005,PTR-TMB-LVP-ARMPOS5-350,TUMB,350,-1,0,1,Armament Position Selector Switch - RIGHT INBD, ON/OFF", "WEAPONS_CONTROL(15),3005,PTR-TMB-LVP-ARMPOS5-350,TUMB,350,1,0,1,Armament Position Selector Switch - RIGHT INBD, ON/OFF", "ELEC_INTERFACE(3),3004,PTR-TMB-VRP-GEN-R-389,TUMB,389,1,0,1,Right Generator Switch, R GEN/OFF/RESET", "ELEC_INTERFACE(3),3005,PTR-TMB-VRP-GEN-R-389,BTN,389,-1,-1,0,Right Generator Switch, R GEN/OFF/RESET", "ELEC_INTERFACE(3),3029,PTR-CIRQ-R-OIL-HYD-233,TUMB,233,0,0,1,CB R OIL & HYD IND FUEL QTY SEL, ON/OFF", "ELEC_INTERFACE(3),3029,PTR-CIRQ-R-OIL-HYD-233,TUMB,233,1,0,1,CB R OIL & HYD IND FUEL QTY SEL, ON/OFF", "TACAN_CTRL_PANEL(41),3006,PTR-TACAN-MODE-262,TUMB,262,0.1,0,0.4,TACAN Mode Selector Switch", "TACAN_CTRL_PANEL(41),3006,PTR-TACAN-MODE-262,TUMB,262,-0.1,0,0.4,TACAN Mode Selector Switch", "WEAPONS_CONTROL(15),3001,PTR-TMB-LVP-ARMPOS1-346,TUMB,346,-1,0,1,Armament Position Selector Switch - LEFT WINGTIP, ON/OFF", "WEAPONS_CONTROL(15),3001,PTR-TMB-LVP-ARMPOS1-346,TUMB,346,1,0,1,Armament Position Selector Switch - LEFT WINGTIP, ON/OFF", "SIGHT_CAMERA(21),3002,PTR-LVR-CAMERA-MODE-82,LEV,82,0,0,0.3,Sight Camera Lens f-Stop Selector, 2.8(dull)..22(bright)", "ELEC_INTERFACE(3),3042,PTR-CIRQ-L-ATTD-A-454,TUMB,454,0,0,1,CB ATTD & HDG REF SYS A, ON/OFF", "ELEC_INTERFACE(3),3042,PTR-CIRQ-L-ATTD-A-454,TUMB,454,1,0,1,CB ATTD & HDG REF SYS A, ON/OFF", "UHF_RADIO(23),3011,PTR-ANARC164-VOLUME-309,LEV,309,1,0,1,AN/ARC-164, UHF Radio Volume Knob", "ELEC_INTERFACE(3),3035,PTR-CIRQ-R-OXY-QTY-245,TUMB,245,0,0,1,CB OXY QTY & CANOPY SEAL, ON/OFF", "ELEC_INTERFACE(3),3035,PTR-CIRQ-R-OXY-QTY-245,TUMB,245,1,0,1,CB OXY QTY & CANOPY SEAL, ON/OFF", "INTLIGHTS_SYSTEM(12),3006,PTR-LVR-LCP-CON-224,LEV,224,0,0,1,Console Lights Knob", "RWR_IC(19),3003,PTR-RWR-BTN-HNDOFF-556,BTN,556,1,0,1,RWR Indicator Control HANDOFF Button", "ECS_INTERFACE(9),3005,PTR-LVR-RVP-CPT-DEFOG-374,LEV,374,0,0,1,Canopy Defog Knob", "SIGHT_CAMERA(21),3001,PTR-TMB-SGT-FPS-80,TUMB,80,-1,0,1,Sight Camera FPS Select Switch, 24/48", "SIGHT_CAMERA(21),3001,PTR-TMB-SGT-FPS-80,TUMB,80,1,0,1,Sight Camera FPS Select Switch, 24/48", "ECS_INTERFACE(9),3002,PTR-CVR-RVP-CAB-PRESS-370,TUMB,370,-1,0,1,Cabin Press Switch Cover, OPEN/CLOSED", "ECS_INTERFACE(9),3002,PTR-CVR-RVP-CAB-PRESS-370,TUMB,370,1,0,1,Cabin Press Switch Cover, OPEN/CLOSED", "RWR_IC(19),3008,PTR-RWR-BTN-POWER-575,TUMB,575,-1,0,1,RWR Indicator Control POWER Button", "RWR_IC(19),3008,PTR-RWR-BTN-POWER-575,TUMB,575,1,0,1,RWR Indicator Control POWER Button", "ELEC_INTERFACE(3),3053,PTR-CIRQ-L-PYL-TANK-471,TUMB,471,0,0,1,CB PYLON TANK FUEL CONT, ON/OFF", "ELEC_INTERFACE(3),3053,PTR-CIRQ-L-PYL-TANK-471,TUMB,471,1,0,1,CB PYLON TANK FUEL CONT, ON/OFF", "SIGHT_CAMERA(21),3003,PTR-LVR-SGT-OVRRUN-84,TUMB,84,-0.1,0,0.3,Sight Camera Overrun Selector, 0/3/10/20", "SIGHT_CAMERA(21),3003,PTR-LVR-SGT-OVRRUN-84,TUMB,84,0.1,0,0.3,Sight Camera Overrun Selector, 0/3/10/20", "SIGHT_CAMERA(21),3004,PTR-BTN-SGT-RUN-79,BTN,79,1,0,1,Sight Camera Run (Test) Switch, ON/OFF", "IFF(22),3014,PTR-IFFCP-RADTEST-206,BTN,206,1,0,1,IFF RAD TEST/MON Switch, RAD TEST/OUT/MON", "IFF(22),3014,PTR-IFFCP-RADTEST-206,TUMB,206,0,-1,0,IFF RAD TEST/MON Switch, RAD TEST/OUT/MON", "FUEL_INTERFACE(4),3001,PTR-TMB-LVP-SHOOTOFF-L-360,TUMB,360,-1,0,1,Left Fuel Shutoff Switch, OPEN/CLOSED", "FUEL_INTERFACE(4),3001,PTR-TMB-LVP-SHOOTOFF-L-360,TUMB,360,1,0,1,Left Fuel Shutoff Switch, OPEN/CLOSED", "IFF(22),3018,PTR-BTN-PANIFF-TEST-217,BTN,215,1,0,1,Radiation TEST and Monitor Light - Press to test(LMB)", "GEAR_INTERFACE(7),3008,PTR-BTN-LG-L-92,BTN,92,1,0,1,Left Landing Gear Lamp - Press to test(LMB)", "ELEC_INTERFACE(3),3045,PTR-CIRQ-L-TRIM-460,TUMB,460,0,0,1,CB TRIM CONTROL, ON/OFF", "ELEC_INTERFACE(3),3045,PTR-CIRQ-L-TRIM-460,TUMB,460,1,0,1,CB TRIM CONTROL, ON/OFF", "WEAPONS_CONTROL(15),3009,PTR-TMB-LVP-BOMB-ARM-341,TUMB,341,0.2,0.2,0.8,Bombs Arm Switch, SAFE/TAIL/NOSE & TAIL/NOSE", "WEAPONS_CONTROL(15),3009,PTR-TMB-LVP-BOMB-ARM-341,TUMB,341,-0.2,0.2,0.8,Bombs Arm Switch, SAFE/TAIL/NOSE & TAIL/NOSE", "RWR_IC(19),3010,PTR-RWR-BTN-ACTPWR-573,BTN,573,1,0,1,RWR Indicator Control ACT/PWR Button", "EXTLIGHTS_SYSTEM(11),3002,PTR-LVR-LCP-FORM-228,LEV,228,0,0,1,Exterior Lights Formation Knob Knob", "UHF_RADIO(23),3001,PTR-ANARC164-CHANNEL-SELECTOR-300,TUMB,300,0.05,0,0.95,AN/ARC-164, UHF Radio Preset Channel Selector Knob", "UHF_RADIO(23),3001,PTR-ANARC164-CHANNEL-SELECTOR-300,TUMB,300,-0.05,0,0.95,AN/ARC-164, UHF Radio Preset Channel Selector Knob", "ECS_INTERFACE(9),3013,PTR-AIR-VLV-L2-720,LEV,720,0,-1,1,Cockpit Left Air Inlet 2 Valve", "HSI(33),3002,PTR-LVR-HSI-CRS-272,LEV,272,0,0,1,HSI Course Set Knob", "INTLIGHTS_SYSTEM(12),3008,PTR-TMB-LCP-TEST-226,BTN,226,1,0,1,Warning Test Switch, Press to test", "INTLIGHTS_SYSTEM(12),3008,PTR-TMB-LCP-TEST-226,BTN,226,1,0,1,Warning Test Switch, Press to test", "OXYGEN_INTERFACE(8),3002,PTR-OXYCP-LVR-DUL-602,TUMB,602,-1,0,1,Diluter Lever", "OXYGEN_INTERFACE(8),3002,PTR-OXYCP-LVR-DUL-602,TUMB,602,1,0,1,Diluter Lever", "ELEC_INTERFACE(3),3040,PTR-CIRQ-L-GUN-R-458,TUMB,458,0,0,1,CB RIGHT GUN FIRING, ON/OFF", "ELEC_INTERFACE(3),3040,PTR-CIRQ-L-GUN-R-458,TUMB,458,1,0,1,CB RIGHT GUN FIRING, ON/OFF", "ELEC_INTERFACE(3),3044,PTR-CIRQ-L-ENG-IGN-456,TUMB,456,0,0,1,CB ENG IGN L ENG INST & HYD IND, ON/OFF", "ELEC_INTERFACE(3),3044,PTR-CIRQ-L-ENG-IGN-456,TUMB,456,1,0,1,CB ENG IGN L ENG INST & HYD IND, ON/OFF", "WEAPONS_CONTROL(15),3010,PTR-CVR-LVP-GUM-MSL-CAM-342,TUMB,342,-1,0,1,Guns, Missile and Camera Switch Cover, OPEN/CLOSE", "WEAPONS_CONTROL(15),3010,PTR-CVR-LVP-GUM-MSL-CAM-342,TUMB,342,1,0,1,Guns, Missile and Camera Switch Cover, OPEN/CLOSE", "IFF(22),3012,PTR-IFFCP-TEST-M-3A-204,BTN,204,1,0,1,IFF Mode Select/TEST Switch, M-3/A /ON/OUT", "IFF(22),3012,PTR-IFFCP-TEST-M-3A-204,TUMB,204,0,-1,0,IFF Mode Select/TEST Switch, M-3/A /ON/OUT", "WEAPONS_CONTROL(15),3018,PTR-STICK-BTN-WPN-128,BTN,128,1,0,1,Weapon Release Button - Press to release", "JETTISON_SYSTEM(14),3001,PTR-CAP-LVP-EMER-JETT-364,TUMB,364,-1,0,1,Emergency All Jettison Button Cover, OPEN", "JETTISON_SYSTEM(14),3001,PTR-CAP-LVP-EMER-JETT-364,TUMB,364,1,0,1,Emergency All Jettison Button Cover, OPEN", "FUEL_INTERFACE(4),3009,PTR-TMB-VRP-RGT-BOOST-382,TUMB,382,-1,0,1,Right Boost Pump Switch, ON/OFF", "FUEL_INTERFACE(4),3009,PTR-TMB-VRP-RGT-BOOST-382,TUMB,382,1,0,1,Right Boost Pump Switch, ON/OFF", "IFF(22),3013,PTR-IFFCP-TEST-M-C-205,BTN,205,1,0,1,IFF Mode Select/TEST Switch, M-C /ON/OUT", "IFF(22),3013,PTR-IFFCP-TEST-M-C-205,TUMB,205,0,-1,0,IFF Mode Select/TEST Switch, M-C /ON/OUT", "ELEC_INTERFACE(3),3046,PTR-CIRQ-L-ATTD-B-461,TUMB,461,0,0,1,CB ATTD & HDG REF SYS B, ON/OFF", "ELEC_INTERFACE(3),3046,PTR-CIRQ-L-ATTD-B-461,TUMB,461,1,0,1,CB ATTD & HDG REF SYS B, ON/OFF", "UHF_RADIO(23),3002,PTR-ANARC164-100MHZ-SELECTOR-302,TUMB,327,-0.1,0,0.3,AN/ARC-164, UHF Radio 100 MHz Frequency Selector Knob", "UHF_RADIO(23),3002,PTR-ANARC164-100MHZ-SELECTOR-302,TUMB,327,0.1,0,0.3,AN/ARC-164, UHF Radio 100 MHz Frequency Selector Knob", "AI_ARU20(32),3001,PTR-LVR-ADI-TRIM-150,LEV,150,0.875,0,1,AI Pitch Trim Knob", "(0),3003,PTR-CNPY-MIRROR-R-4,TUMB,0,-1,0,1,Toggle Mirrors", "(0),3003,PTR-CNPY-MIRROR-R-4,TUMB,0,1,0,1,Toggle Mirrors", "INTLIGHTS_SYSTEM(12),3005,PTR-LVR-LCP-ENG-223,LEV,223,0,0,1,Engine Instruments Lights Knob", "WEAPONS_CONTROL(15),3004,PTR-TMB-LVP-ARMPOS4-349,TUMB,349,-1,0,1,Armament Position Selector Switch - CENTERLINE, ON/OFF", "WEAPONS_CONTROL(15),3004,PTR-TMB-LVP-ARMPOS4-349,TUMB,349,1,0,1,Armament Position Selector Switch - CENTERLINE, ON/OFF", "AHRS(16),3004,PTR-LVR-NAVMODE-273,TUMB,273,-0.1,0,0.1,Nav Mode Selector Switch, DF/TACAN", "AHRS(16),3004,PTR-LVR-NAVMODE-273,TUMB,273,0.1,0,0.1,Nav Mode Selector Switch, DF/TACAN", "RWR_IC(19),3006,PTR-RWR-BTN-SYSTST-567,BTN,567,1,0,1,RWR Indicator Control SYS TEST Button", "ELEC_INTERFACE(3),3032,PTR-CIRQ-R-ENG-R-AUX-239,TUMB,239,0,0,1,CB R ENG AUX DOORS, ON/OFF", "ELEC_INTERFACE(3),3032,PTR-CIRQ-R-ENG-R-AUX-239,TUMB,239,1,0,1,CB R ENG AUX DOORS, ON/OFF"],
-    "F-86": ["AIR_INTERFACE(16),3007,ANTI-ICE_Switch,TUMB,645,1,-1,1,Engine Anti-Ice & Screen Switch, EXTEND/RET./ANTI-ICE", "AIR_INTERFACE(16),3007,ANTI-ICE_Switch,TUMB,645,-1,-1,1,Engine Anti-Ice & Screen Switch, EXTEND/RET./ANTI-ICE", "ELEC_INTERFACE(1),3013,Circuit_Breaker_LP_003,TUMB,762,-1,0,1,Gyr'Syn Compass", "ELEC_INTERFACE(1),3013,Circuit_Breaker_LP_003,TUMB,762,1,0,1,Gyr'Syn Compass", "WEAPON_SYSTEM(5),3022,Bombing_Altimeter_Handler1,LEV,731,0.0215,0,1,A-4 Sight Bombing Altimeter Index Altitude Handle", "ELEC_INTERFACE(1),3031,Circuit_Breaker_LP_019,TUMB,778,-1,0,1,Alt Emerg. Hyd. Cont. & Hyd. Press Ind.", "ELEC_INTERFACE(1),3031,Circuit_Breaker_LP_019,TUMB,778,1,0,1,Alt Emerg. Hyd. Cont. & Hyd. Press Ind.", "CONTROL_INTERFACE(13),3011,Longitudinal_Alternate_Trim_Switch_Cover,TUMB,738,-1,0,1,Longitudinal Alternate Trim Switch Cover", "CONTROL_INTERFACE(13),3011,Longitudinal_Alternate_Trim_Switch_Cover,TUMB,738,1,0,1,Longitudinal Alternate Trim Switch Cover", "WEAPON_SYSTEM(5),3009,Rockets_switch,TUMB,751,1,-1,1,Rocket Release Selector Switch, SINGLE/OFF/AUTO", "WEAPON_SYSTEM(5),3009,Rockets_switch,TUMB,751,-1,-1,1,Rocket Release Selector Switch, SINGLE/OFF/AUTO", "AIR_INTERFACE(16),3008,Air_Outlet_Selector_Lever,TUMB,741,1,-1,1,Air Outlet Selector Lever, FLOOR/BOTH/DEFROST", "AIR_INTERFACE(16),3008,Air_Outlet_Selector_Lever,TUMB,741,-1,-1,1,Air Outlet Selector Lever, FLOOR/BOTH/DEFROST", "LIGHT_INTERFACE(17),3001,Console_Panel_Light_Control,LEV,812,0,0,1,Console and Panel Light Rheostat", "ELEC_INTERFACE(1),3026,Circuit_Breaker_LP_014,TUMB,773,-1,0,1,Free Air & Oil Temp & Air Sel.", "ELEC_INTERFACE(1),3026,Circuit_Breaker_LP_014,TUMB,773,1,0,1,Free Air & Oil Temp & Air Sel.", "AIR_INTERFACE(16),3001,Cockpit_Pressure_Control_Switch,TUMB,650,-2,-1,1,Cockpit Pressure Control Switch, PRESS/RAM", "AIR_INTERFACE(16),3001,Cockpit_Pressure_Control_Switch,TUMB,650,2,-1,1,Cockpit Pressure Control Switch, PRESS/RAM", "HYDRO_INTERFACE(2),3016,Nose_Wheel_Steering_Button,BTN,209,1,0,1,Nose Wheel Steering Button", "CONTROL_INTERFACE(13),3012,Take-off_Position_Indicator_Light,BTN,683,1,0,1,Take-off (Trim) Position Indicator Light (Push to test)", "CONTROL_INTERFACE(13),3008,Lateral_Alternate_Trim_Switch,LEV,649,0.1,0,0.1,Lateral Alternate Trim Switch - Left mouse button for LEFT/OFF, Right mouse button for RIGHT/OFF, Mouse wheel for NORMAL/OFF", "CONTROL_INTERFACE(13),3008,Lateral_Alternate_Trim_Switch,BTN,649,0.5,0,0.5,Lateral Alternate Trim Switch - Left mouse button for LEFT/OFF, Right mouse button for RIGHT/OFF, Mouse wheel for NORMAL/OFF", "CONTROL_INTERFACE(13),3008,Lateral_Alternate_Trim_Switch,BTN,649,0.3,0,0.3,Lateral Alternate Trim Switch - Left mouse button for LEFT/OFF, Right mouse button for RIGHT/OFF, Mouse wheel for NORMAL/OFF", "ELEC_INTERFACE(1),3004,Engine_Master_Switch,TUMB,652,-2,-1,1,Engine Master Switch, ON/OFF", "ELEC_INTERFACE(1),3004,Engine_Master_Switch,TUMB,652,2,-1,1,Engine Master Switch, ON/OFF", "ELEC_INTERFACE(1),3036,Circuit_Breaker_RP_001,TUMB,783,-1,0,1,Eng. Master Fuel Shut-Off", "ELEC_INTERFACE(1),3036,Circuit_Breaker_RP_001,TUMB,783,1,0,1,Eng. Master Fuel Shut-Off", "HYDRO_INTERFACE(2),3004,Hydraulic_Pressure_Gage_Selector_Switch,TUMB,631,1,-1,1,Hydraulic Pressure Gage and Selector Switch, UTILITY/NORMAL/ALTERNATE", "HYDRO_INTERFACE(2),3004,Hydraulic_Pressure_Gage_Selector_Switch,TUMB,631,-1,-1,1,Hydraulic Pressure Gage and Selector Switch, UTILITY/NORMAL/ALTERNATE", "CONTROL_INTERFACE(13),3004,Trim_Switch_Left,BTN,205,-1,-1,0,Normal Trim Switch, LEFT/OFF", "ENGINE_INTERFACE(4),3002,Emergency_Ingition_Switch_Cover,TUMB,732,-1,0,1,Emergency (In-air) Ignition Switch Cover", "ENGINE_INTERFACE(4),3002,Emergency_Ingition_Switch_Cover,TUMB,732,1,0,1,Emergency (In-air) Ignition Switch Cover", "CLOCK(10),3004,Clock_button_2,BTN,831,1,0,1,Elapsed Time Mechanism Button", "AIR_INTERFACE(16),3006,Cockpit_Air_Temperature_Control_Switch_Cover,TUMB,736,-1,0,1,Cockpit Air Temperature Control Switch Cover", "AIR_INTERFACE(16),3006,Cockpit_Air_Temperature_Control_Switch_Cover,TUMB,736,1,0,1,Cockpit Air Temperature Control Switch Cover", "AN_ARC_27_COMMAND_SET(26),3001,UHF_Preset_Channel_Selector,TUMB,807,0.01,0,0.18,AN/ARC-27 UHF Preset Channel Selector", "AN_ARC_27_COMMAND_SET(26),3001,UHF_Preset_Channel_Selector,TUMB,807,-0.01,0,0.18,AN/ARC-27 UHF Preset Channel Selector", "ELEC_INTERFACE(1),3007,Generator_Warning_Light,BTN,687,1,0,1,Generator Warning Light (Push To Test)", "AN_ARC_27_COMMAND_SET(26),3004,Microphone_Button,BTN,213,1,0,1,Microphone Button", "OXYGEN_INTERFACE(14),3002,Pressure_demand_oxygen_regulator,LEV,704,0,0,1,Oxygen Regulator Supply Lever", "AN_ARN_6_RADIO_COMPASS(27),3002,Bandswitch,TUMB,803,0.1,0,0.3,AN/ARN-6 Frequency Band Switch", "AN_ARN_6_RADIO_COMPASS(27),3002,Bandswitch,TUMB,803,-0.1,0,0.3,AN/ARN-6 Frequency Band Switch", "ELEC_INTERFACE(1),3032,Circuit_Breaker_LP_020,TUMB,779,-1,0,1,Sight Power", "ELEC_INTERFACE(1),3032,Circuit_Breaker_LP_020,TUMB,779,1,0,1,Sight Power", "LIGHT_INTERFACE(17),3004,Compass_Switch,TUMB,654,-2,-1,1,Compass Light Switch, ON/OFF", "LIGHT_INTERFACE(17),3004,Compass_Switch,TUMB,654,2,-1,1,Compass Light Switch, ON/OFF", "AN_ARN_6_RADIO_COMPASS(27),3005,LOOP L-R_Switch,BTN,666,1,0,1,AN/ARN-6 LOOP L-R Switch", "AN_ARN_6_RADIO_COMPASS(27),3005,LOOP L-R_Switch,BTN,666,-1,-1,0,AN/ARN-6 LOOP L-R Switch", "ELEC_INTERFACE(1),3038,Circuit_Breaker_RP_003,TUMB,785,-1,0,1,Fuel Level", "ELEC_INTERFACE(1),3038,Circuit_Breaker_RP_003,TUMB,785,1,0,1,Fuel Level", "ELEC_INTERFACE(1),3040,Circuit_Breaker_RP_005,TUMB,787,-1,0,1,Light Post IndCode", "ELEC_INTERFACE(1),3040,Circuit_Breaker_RP_005,TUMB,787,1,0,1,Light Post IndCode", "FUEL_INTERFACE(3),3001,Fuel_density_correction_Switch,TUMB,672,-2,-1,1,Fuel Densitometer Selection Switch, IN/OUT", "FUEL_INTERFACE(3),3001,Fuel_density_correction_Switch,TUMB,672,2,-1,1,Fuel Densitometer Selection Switch, IN/OUT", "AN_ARN_6_RADIO_COMPASS(27),3003,TUNING_CONTROL,LEV,801,0.3,0,1,AN/ARN-6 Tuning Crank", "ELEC_INTERFACE(1),3030,Circuit_Breaker_LP_018,TUMB,777,-1,0,1,Fuel Booster AFT", "ELEC_INTERFACE(1),3030,Circuit_Breaker_LP_018,TUMB,777,1,0,1,Fuel Booster AFT", "ELEC_INTERFACE(1),3028,Circuit_Breaker_LP_016,TUMB,775,-1,0,1,LDG Gear Control", "ELEC_INTERFACE(1),3028,Circuit_Breaker_LP_016,TUMB,775,1,0,1,LDG Gear Control", "ELEC_INTERFACE(1),3006,Generator_Switch_Cover,TUMB,671,-1,0,1,Generator Switch Cover", "ELEC_INTERFACE(1),3006,Generator_Switch_Cover,TUMB,671,1,0,1,Generator Switch Cover", "ELEC_INTERFACE(1),3047,Circuit_Breaker_RP_012,TUMB,794,-1,0,1,AN/APC 3 Radio", "ELEC_INTERFACE(1),3047,Circuit_Breaker_RP_012,TUMB,794,1,0,1,AN/APC 3 Radio", "FIRE_DETECTION_INTERFACE(15),3002,Fire-Warning_FWD_Light,BTN,685,1,0,1,Forward Engine Compartment Fire-warning Light (Push to test)", "AN_ARN_6_RADIO_COMPASS(27),3008,Rotating_compass_cart_Helper,LEV,826,0.0215,0,1,AN/ARN-6 East/West Variation Knob", "WEAPON_SYSTEM(5),3016,Templates_rotation_helper,TUMB,796,-0.3,0,0.9,Manual Pip Control Change Calibrated Dials (Presets)", "WEAPON_SYSTEM(5),3016,Templates_rotation_helper,TUMB,796,0.3,0,0.9,Manual Pip Control Change Calibrated Dials (Presets)", "HYDRO_INTERFACE(2),3010,Landing_gear_emergency_release_handle,TUMB,819,0,0,1,Landing Gear Emergency Release Handle", "HYDRO_INTERFACE(2),3010,Landing_gear_emergency_release_handle,TUMB,819,1,0,1,Landing Gear Emergency Release Handle", "AN_APX6_IFF(29),3001,IFF_Master_Mode_Selector_Knob,TUMB,810,0.1,0,0.4,AN/APX-6 IFF Master Switch, EMERGENCY/NORM/LOW/STDBY/OFF", "AN_APX6_IFF(29),3001,IFF_Master_Mode_Selector_Knob,TUMB,810,-0.1,0,0.4,AN/APX-6 IFF Master Switch, EMERGENCY/NORM/LOW/STDBY/OFF", "ELEC_INTERFACE(1),3044,Circuit_Breaker_RP_009,TUMB,791,-1,0,1,Wing Flap RH.", "ELEC_INTERFACE(1),3044,Circuit_Breaker_RP_009,TUMB,791,1,0,1,Wing Flap RH.", "ELEC_INTERFACE(1),3025,Circuit_Breaker_LP_013,TUMB,772,-1,0,1,Speed Brake", "ELEC_INTERFACE(1),3025,Circuit_Breaker_LP_013,TUMB,772,1,0,1,Speed Brake", "HYDRO_INTERFACE(2),3001,Landing_Gear_Handle,TUMB,599,0,0,1,Landing Gear Handle, UP/DOWN", "HYDRO_INTERFACE(2),3001,Landing_Gear_Handle,TUMB,599,1,0,1,Landing Gear Handle, UP/DOWN", "ELEC_INTERFACE(1),3012,Circuit_Breaker_LP_002,TUMB,761,-1,0,1,Bomb Sel.", "ELEC_INTERFACE(1),3012,Circuit_Breaker_LP_002,TUMB,761,1,0,1,Bomb Sel.", "AN_APX6_IFF(29),3003,IFF_PANEL_MODE3,TUMB,660,-2,-1,1,AN/APX-6 IFF Mode 3 Switch, MODE 3/OUT", "AN_APX6_IFF(29),3003,IFF_PANEL_MODE3,TUMB,660,2,-1,1,AN/APX-6 IFF Mode 3 Switch, MODE 3/OUT", "AN_APX6_IFF(29),3005,IFF_Destruct_Switch_Cover,TUMB,808,-1,0,1,AN/APX-6 IFF Destruct Switch Cover", "AN_APX6_IFF(29),3005,IFF_Destruct_Switch_Cover,TUMB,808,1,0,1,AN/APX-6 IFF Destruct Switch Cover", "AN_APX6_IFF(29),3010,IFF_Dial_Stop_Button,TUMB,203,-1,0,1,AN/APX-6 IFF Dial Stop Button", "AN_APX6_IFF(29),3010,IFF_Dial_Stop_Button,TUMB,203,1,0,1,AN/APX-6 IFF Dial Stop Button", "BARO_ALTIMETER(7),3001,Altimeter_Pressure,LEV,218,0,0,1,Altimeter reference pressure adjusting knob", "GYROMAG_COMPASS(20),3001,Directional_Indicator,LEV,0,0.0215,0,1,Compass Correction", "ELEC_INTERFACE(1),3005,Generator_Switch,TUMB,670,1,0,1,Generator Switch, ON/OFF/RESET", "ELEC_INTERFACE(1),3005,Generator_Switch,BTN,670,-1,-1,0,Generator Switch, ON/OFF/RESET", "HYDRO_INTERFACE(2),3014,Parking_Brake,BTN,217,1,0,1,Parking Brake Handle, ON/OFF", "AN_ARN_6_RADIO_COMPASS(27),3004,VOLUME_CONTROL,LEV,802,0.8,0.1,0.9,AN/ARN-6 Audio Volume Control", "ATTITUDE_INDICATOR(24),3002,PITCH_ TRIM_ KNOB,LEV,200,0.6,0,1,J-8 Attitude Indicator Pitch Trim Knob", "ELEC_INTERFACE(1),3020,Circuit_Breaker_LP_009,TUMB,768,-1,0,1,LDG Light Control", "ELEC_INTERFACE(1),3020,Circuit_Breaker_LP_009,TUMB,768,1,0,1,LDG Light Control", "ELEC_INTERFACE(1),3003,Stop Starter Button,BTN,664,1,0,1,Stop-Starter Button (Push to de-energize starter in case of malfunction)", "CONTROL_INTERFACE(13),3001,Wing_Flap_Lever,TUMB,735,1,-1,1,Wing Flaps Handle", "CONTROL_INTERFACE(13),3001,Wing_Flap_Lever,TUMB,735,-1,-1,1,Wing Flaps Handle", "ACCELEROMETER(12),3001,Accelerometer_button,BTN,1004,1,0,1,Accelerometer Reset Button - Push to reset",
-        "ELEC_INTERFACE(1),3011,Circuit_Breaker_LP_001,TUMB,760,-1,0,1,Bomb Rocket Tank Salvo", "ELEC_INTERFACE(1),3011,Circuit_Breaker_LP_001,TUMB,760,1,0,1,Bomb Rocket Tank Salvo", "CONTROL_INTERFACE(13),3006,Trim_Switch_Down,BTN,204,1,0,1,Normal Trim Switch, NOSE UP/OFF", "AIR_INTERFACE(16),3003,PITOT_Switch,TUMB,646,-2,-1,1,Pitot Heater Switch, ON/OFF", "AIR_INTERFACE(16),3003,PITOT_Switch,TUMB,646,2,-1,1,Pitot Heater Switch, ON/OFF", "OXYGEN_INTERFACE(14),3001,OXYGEN_SWITCH,TUMB,703,-1,0,1,Oxygen Regulator Diluter Lever, NORMAL OXYGEN/100% OXYGEN", "OXYGEN_INTERFACE(14),3001,OXYGEN_SWITCH,TUMB,703,1,0,1,Oxygen Regulator Diluter Lever, NORMAL OXYGEN/100% OXYGEN", "(0),3001,MIRRORS,TUMB,3,-1,0,1,Toggle Mirrors", "(0),3001,MIRRORS,TUMB,3,1,0,1,Toggle Mirrors", "AN_APG_30(21),3001,Radar_range_sweep,LEV,715,0.0215,0,1,A-4 Sight Radar Range Sweep Rheostat", "A4_GUNSIGHT(22),3025,Sight_Electrical_Caging_Button,BTN,212,1,0,1,A-4 Sight Electrical Caging Button", "A4_GUNSIGHT(22),3015,SIGHT_FILAMENT_SWITCH,TUMB,642,-2,-1,1,A-4 Sight Filament Selector Switch, SECONDARY/PRIMARY", "A4_GUNSIGHT(22),3015,SIGHT_FILAMENT_SWITCH,TUMB,642,2,-1,1,A-4 Sight Filament Selector Switch, SECONDARY/PRIMARY", "WEAPON_SYSTEM(5),3048,Gun_Trigger,BTN,206,0.5,0,0.5,Gun Trigger, SECOND DETENT(LMB)/FIRST DETENT(RMB)", "WEAPON_SYSTEM(5),3048,Gun_Trigger,BTN,206,1,0,1,Gun Trigger, SECOND DETENT(LMB)/FIRST DETENT(RMB)", "A4_GUNSIGHT(22),3012,Target_speed_switch,TUMB,720,-0.5,0,1,Variable Sight Selector Unit - Target Speed Switch, TR/HI/LO", "A4_GUNSIGHT(22),3012,Target_speed_switch,TUMB,720,0.5,0,1,Variable Sight Selector Unit - Target Speed Switch, TR/HI/LO", "WEAPON_SYSTEM(5),3007,ARM_SWITCH,TUMB,641,1,-1,1,Demolition Bomb Arming Switch (Fuze Selection), ARM NOSE&TAIL/OFF/TAIL ONLY", "WEAPON_SYSTEM(5),3007,ARM_SWITCH,TUMB,641,-1,-1,1,Demolition Bomb Arming Switch (Fuze Selection), ARM NOSE&TAIL/OFF/TAIL ONLY", "AIR_INTERFACE(16),3019,Windshield_Anti-icing_Lever,TUMB,202,0,0,1,Windshield Anti-Icing Lever, ON/OFF", "AIR_INTERFACE(16),3019,Windshield_Anti-icing_Lever,TUMB,202,1,0,1,Windshield Anti-Icing Lever, ON/OFF", "CLOCK(10),3003,Clock_button_1,LEV,228,0.04,0,1,Set Clock Knob", "CLOCK(10),3002,Clock_button_1,BTN,227,1,0,1,Set Clock Knob", "CLOCK(10),3002,Clock_button_1,BTN,227,1,0,1,Set Clock Knob", "WEAPON_SYSTEM(5),3020,MISSILE_PANEL_SAFE_LAUNCH,BTN,822,1,0,1,Safe Launch Button", "ELEC_INTERFACE(1),3024,Circuit_Breaker_LP_012,TUMB,771,-1,0,1,Bus Tie-In Control", "ELEC_INTERFACE(1),3024,Circuit_Breaker_LP_012,TUMB,771,1,0,1,Bus Tie-In Control", "WEAPON_SYSTEM(5),3011,Fuze_Delay_Switch,TUMB,638,1,-1,1,Rocket Fuze (Arming) Switch, DELAY/OFF/INSTANT", "WEAPON_SYSTEM(5),3011,Fuze_Delay_Switch,TUMB,638,-1,-1,1,Rocket Fuze (Arming) Switch, DELAY/OFF/INSTANT", "ELEC_INTERFACE(1),3033,Circuit_Breaker_LP_021,TUMB,780,-1,0,1,Sight Heater", "ELEC_INTERFACE(1),3033,Circuit_Breaker_LP_021,TUMB,780,1,0,1,Sight Heater", "WEAPON_SYSTEM(5),3001,Guns_Selector,TUMB,668,0.1,-0.2,0.2,Gun Selector Switch", "WEAPON_SYSTEM(5),3001,Guns_Selector,TUMB,668,-0.1,-0.2,0.2,Gun Selector Switch", "AN_ARN_6_RADIO_COMPASS(27),3006,RADIO_COMPASS_PANEL_CW / VOICE,TUMB,658,-1,0,1,AN/ARN-6 CW-VOICE Switch, CW/VOICE", "AN_ARN_6_RADIO_COMPASS(27),3006,RADIO_COMPASS_PANEL_CW / VOICE,TUMB,658,1,0,1,AN/ARN-6 CW-VOICE Switch, CW/VOICE", "ELEC_INTERFACE(1),3009,Both_Instrument_Failure_Warning_Light,BTN,681,1,0,1,Both Instrument (Main and alternate three-phase) Inverter Failure Warning Light (Push to test)", "A4_GUNSIGHT(22),3016,Sight_mechanical_caging_lever,LEV,755,1,0.001,0.999,A-4 Sight Mechanical Caging Lever, CAGE/UNCAGE", "A4_GUNSIGHT(22),3017,Sight_mechanical_caging_lever,TUMB,755,1,0,1,A-4 Sight Mechanical Caging Lever, CAGE/UNCAGE", "COCKPIT_MECHANICS(25),3016,Emergency_Jettison_Cover,TUMB,220,0.83,0,0.83,Emergency Jettison Handle Cover, OPEN/CLOSE", "COCKPIT_MECHANICS(25),3016,Emergency_Jettison_Cover,TUMB,220,-0.83,0,0.83,Emergency Jettison Handle Cover, OPEN/CLOSE", "LIGHT_INTERFACE(17),3003,Instrument_Panel_Auxiliary_Light_Control,LEV,811,0,0,1,Instrument Panel Auxiliary Light Rheostat", "WEAPON_SYSTEM(5),3013,LABS_Selector_Switch_1,TUMB,632,-2,-1,1,LABS Gyro Caging Switch, UNCAGE/CAGE", "WEAPON_SYSTEM(5),3013,LABS_Selector_Switch_1,TUMB,632,2,-1,1,LABS Gyro Caging Switch, UNCAGE/CAGE", "ELEC_INTERFACE(1),3008,Main_Instrument_Failure_Warning_Light,BTN,680,1,0,1,Main Instrument (Three-phase) Inverter Failure Warning Light (Push to test)", "WEAPON_SYSTEM(5),3019,MISSILE_PANEL_TONE_VOLUME,LEV,821,1,0,1,Tone Volume", "WEAPON_SYSTEM(5),3005,PIP_adjustment_knob,LEV,797,0.0215,0,1,Manual Pip Control Knob", "COCKPIT_MECHANICS(25),3018,Emergency_Jettison_Handle,TUMB,818,0,0,1,Emergency Jettison Handle, IN/RELEASE ALL(LMB)/RELEASE OUTBD ONLY(RMB)", "COCKPIT_MECHANICS(25),3008,Emergency_Jettison_Handle,TUMB,818,1,0,1,Emergency Jettison Handle, IN/RELEASE ALL(LMB)/RELEASE OUTBD ONLY(RMB)", "WEAPON_SYSTEM(5),3008,Station_selector_switch,TUMB,752,0.1,0,0.5,Demolition Bomb Sequence Selector Switch, ALL/OFF/LEFT/RIGHT", "WEAPON_SYSTEM(5),3008,Station_selector_switch,TUMB,752,-0.1,0,0.5,Demolition Bomb Sequence Selector Switch, ALL/OFF/LEFT/RIGHT", "CONTROL_INTERFACE(13),3007,Trim_Switch_Up,BTN,204,-1,-1,0,Normal Trim Switch, NOSE DOWN/OFF", "WEAPON_SYSTEM(5),3054,G_LIMIT,LEV,226,1,0,0.5,G-Limit Light - Push to test(LMB), Rotate to adjust brightness(MW)", "WEAPON_SYSTEM(5),3053,G_LIMIT,BTN,225,1,0,1,G-Limit Light - Push to test(LMB), Rotate to adjust brightness(MW)", "FUEL_INTERFACE(3),3004,TANKS_JETTISON,BTN,701,1,0,1,Drop Tank Jettison Button - Push to release drop tank(s)", "WEAPON_SYSTEM(5),3047,Bomb_Rocket_Release_Button,BTN,207,1,0,1,Bomb-Rocket Release Button - Push to release", "A4_GUNSIGHT(22),3011,Rocket-Gun-Bomb_selector,TUMB,721,-0.1,0,0.2,Variable Sight Selector Unit - Sight Function Selector Lever, ROCKET/GUN/BOMB", "A4_GUNSIGHT(22),3011,Rocket-Gun-Bomb_selector,TUMB,721,0.1,0,0.2,Variable Sight Selector Unit - Sight Function Selector Lever, ROCKET/GUN/BOMB", "ELEC_INTERFACE(1),3041,Circuit_Breaker_RP_006,TUMB,788,-1,0,1,Console & Ped LTS", "ELEC_INTERFACE(1),3041,Circuit_Breaker_RP_006,TUMB,788,1,0,1,Console & Ped LTS", "AIR_INTERFACE(16),3009,Windshield_anti-icing_overheat_Warning_Light,BTN,691,1,0,1,Windshield Anti-Ice Overheat Warning Light (Push to test)", "ELEC_INTERFACE(1),3048,Circuit_Breaker_RP_013,TUMB,795,-1,0,1,AN/APX-6 Radio IFF", "ELEC_INTERFACE(1),3048,Circuit_Breaker_RP_013,TUMB,795,1,0,1,AN/APX-6 Radio IFF", "ELEC_INTERFACE(1),3015,Circuit_Breaker_LP_004,TUMB,763,-1,0,1,3f Inverter", "ELEC_INTERFACE(1),3015,Circuit_Breaker_LP_004,TUMB,763,1,0,1,3f Inverter", "AIR_INTERFACE(16),3005,Cockpit_Air_Temperature_Control_Switch,TUMB,737,0.1,0,0.5,Cockpit Air Temperature Control Switch, AUTO/OFF/HOT/COLD", "AIR_INTERFACE(16),3005,Cockpit_Air_Temperature_Control_Switch,TUMB,737,-0.1,0,0.5,Cockpit Air Temperature Control Switch, AUTO/OFF/HOT/COLD", "ENGINE_INTERFACE(4),3003,Emergency_Fuel_Switch,TUMB,630,-2,-1,1,Emergency Fuel Switch, ON/OFF", "ENGINE_INTERFACE(4),3003,Emergency_Fuel_Switch,TUMB,630,2,-1,1,Emergency Fuel Switch, ON/OFF", "AN_APX6_IFF(29),3004,IFF_Destruct_Switch,BTN,809,1,0,-1,AN/APX-6 IFF Destruct Switch, OFF/ON", "AN_APX6_IFF(29),3004,IFF_Destruct_Switch,BTN,809,1,0,-1,AN/APX-6 IFF Destruct Switch, OFF/ON", "NAV_LIGHTS_INTERFACE(18),3003,Ext. Ltng. Bright Switch,TUMB,655,-2,-1,1,Exterior Lighting Dimmer Switch, BRIGHT/DIM", "NAV_LIGHTS_INTERFACE(18),3003,Ext. Ltng. Bright Switch,TUMB,655,2,-1,1,Exterior Lighting Dimmer Switch, BRIGHT/DIM", "ELEC_INTERFACE(1),3023,Circuit_Breaker_LP_011,TUMB,770,-1,0,1,Fire Warn.", "ELEC_INTERFACE(1),3023,Circuit_Breaker_LP_011,TUMB,770,1,0,1,Fire Warn.", "COCKPIT_MECHANICS(25),3009,Canopy_Alternate_Emergency_Jettison_Handle,TUMB,817,0,0,1,Canopy Alternate Emergency Jettison Handle, IN/OUT", "COCKPIT_MECHANICS(25),3009,Canopy_Alternate_Emergency_Jettison_Handle,TUMB,817,1,0,1,Canopy Alternate Emergency Jettison Handle, IN/OUT", "ELEC_INTERFACE(1),3010,Main_Radar_Failure_Warning_Light,BTN,682,1,0,1,Main Radar (Single-phase) Inverter Failure Warning Light (Push to test)", "FUEL_INTERFACE(3),3005,Tanks_Empty_Warning_Light,BTN,695,1,0,1,Outboard Drop Tank Empty Indicator Light (Push to test)", "AN_ARN_6_RADIO_COMPASS(27),3001,LOOP-ANT-COMP-OFF_Switch,TUMB,667,0.1,0,0.4,AN/ARN-6 Function Selector Switch, OFF/COMP/ANT./LOOP/CONT.", "AN_ARN_6_RADIO_COMPASS(27),3001,LOOP-ANT-COMP-OFF_Switch,TUMB,667,-0.1,0,0.4,AN/ARN-6 Function Selector Switch, OFF/COMP/ANT./LOOP/CONT.", "NAV_LIGHTS_INTERFACE(18),3002,Pos. Lt. Steady_Switch,TUMB,656,1,-1,1,Position and Fuselage Light Selector Switch, STEADY/OFF/FLASH", "NAV_LIGHTS_INTERFACE(18),3002,Pos. Lt. Steady_Switch,TUMB,656,-1,-1,1,Position and Fuselage Light Selector Switch, STEADY/OFF/FLASH", "ELEC_INTERFACE(1),3045,Circuit_Breaker_RP_010,TUMB,792,-1,0,1,Light Fluor", "ELEC_INTERFACE(1),3045,Circuit_Breaker_RP_010,TUMB,792,1,0,1,Light Fluor", "AIR_INTERFACE(16),3004,Cockpit_Air_Temperature_Control_Rheostat,LEV,740,0,0,1,Cockpit Air Temperature Control Rheostat", "A4_GUNSIGHT(22),3026,Grip_Rotation,TUMB,210,1,1,1,A-4 Sight Rotating Grip - Mouse Wheel for manual ranging, Right Click for return to CCW spring-loaded position", "A4_GUNSIGHT(22),3026,Grip_Rotation,LEV,210,1,-1,1,A-4 Sight Rotating Grip - Mouse Wheel for manual ranging, Right Click for return to CCW spring-loaded position", "AN_ARN_6_RADIO_COMPASS(27),3007,RADIO_COMPASS_PANEL_LIGHTS,TUMB,657,1,-1,1,AN/ARN-6 Scale Light Switch, HI/OFF/LO", "AN_ARN_6_RADIO_COMPASS(27),3007,RADIO_COMPASS_PANEL_LIGHTS,TUMB,657,-1,-1,1,AN/ARN-6 Scale Light Switch, HI/OFF/LO", "HYDRO_INTERFACE(2),3003,Flight_Control_Switch,TUMB,647,1,0,1,Flight Control Switch, ALTERNATE ON/NORMAL/RESET", "HYDRO_INTERFACE(2),3003,Flight_Control_Switch,BTN,647,-1,-1,0,Flight Control Switch, ALTERNATE ON/NORMAL/RESET", "WEAPON_SYSTEM(5),3015,LABS_Selector_Switch_3,TUMB,634,-2,-1,1,LABS Change-over Switch, LABS/A-4", "WEAPON_SYSTEM(5),3015,LABS_Selector_Switch_3,TUMB,634,2,-1,1,LABS Change-over Switch, LABS/A-4",
-        "CONTROL_INTERFACE(13),3010,Rudder_Trim_Switch,BTN,648,-1,-1,0,Rudder Trim Switch, LEFT/OFF/RIGHT", "CONTROL_INTERFACE(13),3010,Rudder_Trim_Switch,BTN,648,1,0,1,Rudder Trim Switch, LEFT/OFF/RIGHT", "ELEC_INTERFACE(1),3037,Circuit_Breaker_RP_002,TUMB,784,-1,0,1,Eng. Ign.", "ELEC_INTERFACE(1),3037,Circuit_Breaker_RP_002,TUMB,784,1,0,1,Eng. Ign.", "FIRE_DETECTION_INTERFACE(15),3001,Fire-Warning Light Test Button,TUMB,635,-1,0,1,Engine Fire Warning Light Test Switch", "FIRE_DETECTION_INTERFACE(15),3001,Fire-Warning Light Test Button,TUMB,635,1,0,1,Engine Fire Warning Light Test Switch", "AN_ARC_27_COMMAND_SET(26),3002,UHF_Volume_Knob,LEV,806,0.8,0.1,0.9,AN/ARC-27 UHF Audio Volume Knob", "HYDRO_INTERFACE(2),3007,Alternate-on_Warning_Light,BTN,684,1,0,1,Alternate-on Warning Light (Push to test)", "ELEC_INTERFACE(1),3017,Circuit_Breaker_LP_006,TUMB,765,-1,0,1,Rudder Trim & Take-Off Ind.", "ELEC_INTERFACE(1),3017,Circuit_Breaker_LP_006,TUMB,765,1,0,1,Rudder Trim & Take-Off Ind.", "WEAPON_SYSTEM(5),3017,Bomb_Rocket_Tank Jettison Button,BTN,702,1,0,1,Bomb-Rocket-Tank Jettison Button", "WEAPON_SYSTEM(5),3004,BOMB_NORMAL_Switch,TUMB,663,-2,-1,1,Manual Pip Control Switch, BOMB/NORMAL", "WEAPON_SYSTEM(5),3004,BOMB_NORMAL_Switch,TUMB,663,2,-1,1,Manual Pip Control Switch, BOMB/NORMAL", "WEAPON_SYSTEM(5),3021,Target_altitude_knob,LEV,729,0.0215,0,1,A-4 Sight Bombing Altimeter Target Altitude Knob", "A4_GUNSIGHT(22),3003,Sight_reticle_dimmer_control_knob,LEV,734,0.0215,0,0.74,A-4 Sight Reticle Dimmer Control", "FIRE_DETECTION_INTERFACE(15),3003,Fire-Warning_AFT_Light,BTN,686,1,0,1,Aft Engine Compartment Fire-warning Light (Push to test)", "ELEC_INTERFACE(1),3019,Circuit_Breaker_LP_008,TUMB,767,-1,0,1,Ail & Horiz. Trim & Alt Horiz. Trim", "ELEC_INTERFACE(1),3019,Circuit_Breaker_LP_008,TUMB,767,1,0,1,Ail & Horiz. Trim & Alt Horiz. Trim", "HYDRO_INTERFACE(2),3009,Horn_Cutout_Button,BTN,815,1,0,1,Landing Gear Warning Horn Cutout Button (Push to silence horn)", "ENGINE_INTERFACE(4),3001,Emergency_Ingition_Switch,TUMB,733,1,-1,0,Emergency (In-air) Ignition Switch, ON/OFF", "ENGINE_INTERFACE(4),3001,Emergency_Ingition_Switch,TUMB,733,-1,-1,0,Emergency (In-air) Ignition Switch, ON/OFF", "ELEC_INTERFACE(1),3046,Circuit_Breaker_RP_011,TUMB,793,-1,0,1,Sight Control", "ELEC_INTERFACE(1),3046,Circuit_Breaker_RP_011,TUMB,793,1,0,1,Sight Control", "COCKPIT_MECHANICS(25),3001,Cockpit_Switch_ON-OFF,BTN,718,1,0,1,Canopy Switch, OPEN/OFF/CLOSE", "COCKPIT_MECHANICS(25),3001,Cockpit_Switch_ON-OFF,TUMB,718,-1,-1,0,Canopy Switch, OPEN/OFF/CLOSE", "A4_GUNSIGHT(22),3001,Wing_span_adjustment_knob,LEV,716,0.0215,0,1,A-4 Sight Wing Span Adjustment Knob", "NAV_LIGHTS_INTERFACE(18),3001,TMB-TAXILGT_Switch,TUMB,661,1,-1,1,Landing & Taxi Lights Switch, EXTEND&ON/OFF/RETRACT", "NAV_LIGHTS_INTERFACE(18),3001,TMB-TAXILGT_Switch,TUMB,661,-1,-1,1,Landing & Taxi Lights Switch, EXTEND&ON/OFF/RETRACT", "A4_GUNSIGHT(22),3014,Bomb_wind_control,LEV,727,0.0215,-1,1,Bomb-Target Wind Control Knob", "CONTROL_INTERFACE(13),3009,Longitudinal_Alternate_Trim_Switch,LEV,739,0.1,0,0.1,Longitudinal Alternate Trim Switch - Mouse wheel for NORMAL GRIP CONT/OFF, Left mouse button for NOSE UP/OFF, Right mouse button for NOSE DOWN/OFF", "CONTROL_INTERFACE(13),3009,Longitudinal_Alternate_Trim_Switch,BTN,739,0.3,0,0.3,Longitudinal Alternate Trim Switch - Mouse wheel for NORMAL GRIP CONT/OFF, Left mouse button for NOSE UP/OFF, Right mouse button for NOSE DOWN/OFF", "CONTROL_INTERFACE(13),3009,Longitudinal_Alternate_Trim_Switch,BTN,739,0.5,0,0.5,Longitudinal Alternate Trim Switch - Mouse wheel for NORMAL GRIP CONT/OFF, Left mouse button for NOSE UP/OFF, Right mouse button for NOSE DOWN/OFF", "A4_GUNSIGHT(22),3027,Radar_Target_Selector_Button,BTN,208,1,0,1,A-4 Sight Radar Target Selector Button", "ELEC_INTERFACE(1),3001,BATTERY-STARTER_SWITCH,TUMB,653,1,0,1,Battery-Starter Switch, BATTERY/OFF/STARTER", "ELEC_INTERFACE(1),3001,BATTERY-STARTER_SWITCH,BTN,653,-1,-1,0,Battery-Starter Switch, BATTERY/OFF/STARTER", "OXYGEN_INTERFACE(14),3008,Emergency_Test,LEV,223,1,-1,1,Oxygen Regulator Emergency Lever", "OXYGEN_INTERFACE(14),3010,Emergency_Test,BTN,229,1,0,1,Oxygen Regulator Emergency Lever", "ELEC_INTERFACE(1),3042,Circuit_Breaker_RP_007,TUMB,789,-1,0,1,Fuel Boost FWD", "ELEC_INTERFACE(1),3042,Circuit_Breaker_RP_007,TUMB,789,1,0,1,Fuel Boost FWD", "ELEC_INTERFACE(1),3016,Circuit_Breaker_LP_005,TUMB,764,-1,0,1,Turn Bank Ind.", "ELEC_INTERFACE(1),3016,Circuit_Breaker_LP_005,TUMB,764,1,0,1,Turn Bank Ind.", "WEAPON_SYSTEM(5),3014,LABS_Selector_Switch_2,TUMB,633,-2,-1,1,LABS Start Switch, ON/OFF", "WEAPON_SYSTEM(5),3014,LABS_Selector_Switch_2,TUMB,633,2,-1,1,LABS Start Switch, ON/OFF", "ELEC_INTERFACE(1),3034,Circuit_Breaker_LP_022,TUMB,781,-1,0,1,Sight A.C. Power Unit", "ELEC_INTERFACE(1),3034,Circuit_Breaker_LP_022,TUMB,781,1,0,1,Sight A.C. Power Unit", "WEAPON_SYSTEM(5),3002,MISSILE_GUNS_RADAR-Selector,TUMB,665,-0.1,0,0.3,Gun-Missile Selector Switch, OFF/SIGHT CAMERA & RADAR/GUNS/MISSILE", "WEAPON_SYSTEM(5),3002,MISSILE_GUNS_RADAR-Selector,TUMB,665,0.1,0,0.3,Gun-Missile Selector Switch, OFF/SIGHT CAMERA & RADAR/GUNS/MISSILE", "HYDRO_INTERFACE(2),3002,EMERG_UP,BTN,710,1,0,1,Landing Gear Emergency-up Button (Ground-use only! Hold in until gear retracts completely)", "GYROMAG_COMPASS(20),3003,Directional_Indicator_Fast_Slaving_Switch,BTN,598,1,0,1,Directional Indicator Fast Slaving Button - Push for fast slaving", "WEAPON_SYSTEM(5),3006,Auto_Release_Switch,TUMB,639,-2,-1,1,Demolition Bomb Release Selector Switch, AUTO RELEASE/MANUAL RELEASE", "WEAPON_SYSTEM(5),3006,Auto_Release_Switch,TUMB,639,2,-1,1,Demolition Bomb Release Selector Switch, AUTO RELEASE/MANUAL RELEASE", "HYDRO_INTERFACE(2),3008,Alternate_Hydraulic_Override_Switch,TUMB,706,-1,0,1,Alternate Hydraulic Emergency Override Handle, IN/OUT", "HYDRO_INTERFACE(2),3008,Alternate_Hydraulic_Override_Switch,TUMB,706,1,0,1,Alternate Hydraulic Emergency Override Handle, IN/OUT", "A4_GUNSIGHT(22),3013,Rocket_depression_angle_pointer,LEV,722,0.0215,0,1,Variable Sight Selector Unit - Rocket Depression Angle Selector", "FUEL_INTERFACE(3),3003,JETT_SELECTOR,TUMB,662,0.1,0,0.6,Drop Tank Selector Switch", "FUEL_INTERFACE(3),3003,JETT_SELECTOR,TUMB,662,-0.1,0,0.6,Drop Tank Selector Switch", "CONTROL_INTERFACE(13),3005,Trim_Switch_Right,BTN,205,1,0,1,Normal Trim Switch, RIGHT/OFF", "LIGHT_INTERFACE(17),3002,Instrument_Panel_Primary_Light_Control,LEV,813,0,0,1,Instrument Panel Primary Light Rheostat", "ELEC_INTERFACE(1),3039,Circuit_Breaker_RP_004,TUMB,786,-1,0,1,Inv Gen. Failure Overvolt LTS Test", "ELEC_INTERFACE(1),3039,Circuit_Breaker_RP_004,TUMB,786,1,0,1,Inv Gen. Failure Overvolt LTS Test", "ELEC_INTERFACE(1),3002,INSTRUMENT_POWER_ALTERNATE,TUMB,643,-2,-1,1,Instrument Power Switch, ALTERNATE/NORMAL", "ELEC_INTERFACE(1),3002,INSTRUMENT_POWER_ALTERNATE,TUMB,643,2,-1,1,Instrument Power Switch, ALTERNATE/NORMAL", "ELEC_INTERFACE(1),3021,Circuit_Breaker_LP_010,TUMB,769,-1,0,1,LDG Lights", "ELEC_INTERFACE(1),3021,Circuit_Breaker_LP_010,TUMB,769,1,0,1,LDG Lights", "ELEC_INTERFACE(1),3018,Circuit_Breaker_LP_007,TUMB,766,-1,0,1,Alt Ail. Trim", "ELEC_INTERFACE(1),3018,Circuit_Breaker_LP_007,TUMB,766,1,0,1,Alt Ail. Trim", "COCKPIT_MECHANICS(25),3010,Canopy_declutch_handle,TUMB,816,0,0,1,Canopy Declutch Handle, IN/OUT", "COCKPIT_MECHANICS(25),3010,Canopy_declutch_handle,TUMB,816,1,0,1,Canopy Declutch Handle, IN/OUT", "WEAPON_SYSTEM(5),3012,Rockets_Jett_Switch,TUMB,637,-2,-1,1,Rocket Jettison Switch, READY/OFF", "WEAPON_SYSTEM(5),3012,Rockets_Jett_Switch,TUMB,637,2,-1,1,Rocket Jettison Switch, READY/OFF", "HYDRO_INTERFACE(2),3005,Speed_Brake_Switch,TUMB,211,1,-1,1,Speed Brake Switch, OUT/HOLD/IN", "HYDRO_INTERFACE(2),3005,Speed_Brake_Switch,TUMB,211,-1,-1,1,Speed Brake Switch, OUT/HOLD/IN", "WEAPON_SYSTEM(5),3018,MISSILE_Switch_LH-RH-SALVO,TUMB,820,1,-1,1,Missile Control Switch, LH & RH/RH/SALVO", "WEAPON_SYSTEM(5),3018,MISSILE_Switch_LH-RH-SALVO,TUMB,820,-1,-1,1,Missile Control Switch, LH & RH/RH/SALVO", "OXYGEN_INTERFACE(14),3006,Warning_System_Off,TUMB,230,-1,0,1,Oxygen Regulator Warning Light Switch, ON/OFF", "OXYGEN_INTERFACE(14),3006,Warning_System_Off,TUMB,230,1,0,1,Oxygen Regulator Warning Light Switch, ON/OFF", "AIR_INTERFACE(16),3002,Cockpit_Pressure_Schedule_Selector_Switch,TUMB,651,-2,-1,1,Cockpit Pressure Schedule Selector Switch, 5 PSI/2.75 PSI", "AIR_INTERFACE(16),3002,Cockpit_Pressure_Schedule_Selector_Switch,TUMB,651,2,-1,1,Cockpit Pressure Schedule Selector Switch, 5 PSI/2.75 PSI", "ELEC_INTERFACE(1),3043,Circuit_Breaker_RP_008,TUMB,790,-1,0,1,Wing Flap LH.", "ELEC_INTERFACE(1),3043,Circuit_Breaker_RP_008,TUMB,790,1,0,1,Wing Flap LH.", "WEAPON_SYSTEM(5),3010,Rockets_switch_cover,TUMB,750,-1,0,1,Rocket Release Selector Switch Cover", "WEAPON_SYSTEM(5),3010,Rockets_switch_cover,TUMB,750,1,0,1,Rocket Release Selector Switch Cover", "ELEC_INTERFACE(1),3035,Circuit_Breaker_LP_023,TUMB,782,-1,0,1,AN/ARN-6 Radio Compass", "ELEC_INTERFACE(1),3035,Circuit_Breaker_LP_023,TUMB,782,1,0,1,AN/ARN-6 Radio Compass", "ELEC_INTERFACE(1),3029,Circuit_Breaker_LP_017,TUMB,776,-1,0,1,LDG Gear Pos Ind.", "ELEC_INTERFACE(1),3029,Circuit_Breaker_LP_017,TUMB,776,1,0,1,LDG Gear Pos Ind.", "WEAPON_SYSTEM(5),3003,Gun_Heater_Switch,TUMB,636,1,0,1,Gun Heater Switch, HEATER/OFF/(N/F)", "WEAPON_SYSTEM(5),3003,Gun_Heater_Switch,BTN,636,-1,-1,0,Gun Heater Switch, HEATER/OFF/(N/F)", "FUEL_INTERFACE(3),3002,Fuel_density_correction_Switch_Cover,TUMB,673,-1,0,1,Fuel Densitometer Selection Switch Cover", "FUEL_INTERFACE(3),3002,Fuel_density_correction_Switch_Cover,TUMB,673,1,0,1,Fuel Densitometer Selection Switch Cover", "ATTITUDE_INDICATOR(24),3001,PULL_TO_CAGE,BTN,714,1,0,1,J-8 Attitude Indicator Cage Knob - Pull to cage", "AN_APX6_IFF(29),3002,IFF_PANEL_MODE2,TUMB,659,1,-1,1,AN/APX-6 IFF Mode 2 Switch, MODE 2/OUT/I/P", "AN_APX6_IFF(29),3002,IFF_PANEL_MODE2,TUMB,659,-1,-1,1,AN/APX-6 IFF Mode 2 Switch, MODE 2/OUT/I/P", "ELEC_INTERFACE(1),3027,Circuit_Breaker_LP_015,TUMB,774,-1,0,1,LDG Gear Warn.",
-        "ELEC_INTERFACE(1),3027,Circuit_Breaker_LP_015,TUMB,774,1,0,1,LDG Gear Warn.", "AN_ARC_27_COMMAND_SET(26),3003,UHF_Power_Switch,TUMB,805,0.1,0,0.3,AN/ARC-27 UHF Power Switch, OFF/T/R/T/R + G REC/ADF", "AN_ARC_27_COMMAND_SET(26),3003,UHF_Power_Switch,TUMB,805,-0.1,0,0.3,AN/ARC-27 UHF Power Switch, OFF/T/R/T/R + G REC/ADF", "WEAPON_SYSTEM(5),3024,Rocket_Intervalometer,TUMB,1001,0.0625,0,1,Rocket Intervalometer", "WEAPON_SYSTEM(5),3023,Rocket_Intervalometer,TUMB,1001,-0.0625,0,1,Rocket Intervalometer"],
-    "F14": ["ELECTRICS(14),3009,PNT_937,TUMB,937,1,-1,1,Left Generator Switch", "ELECTRICS(14),3009,PNT_937,TUMB,937,-1,-1,1,Left Generator Switch", "HUD(40),3213,PNT_1009,TUMB,1009,-1,0,1,HUD Power On/Off", "HUD(40),3213,PNT_1009,TUMB,1009,1,0,1,HUD Power On/Off", "ARC182(4),3413,PNT_358,TUMB,358,0.25,0,1,VHF/UHF ARC-182 MODE", "ARC182(4),3413,PNT_358,TUMB,358,-0.25,0,1,VHF/UHF ARC-182 MODE", "DECM(53),3252,PNT_151,TUMB,151,0.2,0,1,DECM ALQ-100 Power/Mode", "DECM(53),3252,PNT_151,TUMB,151,-0.2,0,1,DECM ALQ-100 Power/Mode", "DECM(53),3253,PNT_9950,LEV,9950,0,0,1,DECM ALQ-100 Volume", "TCS(37),3604,PNT_90,TUMB,90,1,-1,1,Record power (no function)", "TCS(37),3604,PNT_90,TUMB,90,-1,-1,1,Record power (no function)", "COUNTERMEASURES(5),3275,PNT_386,LEV,386,1,0,1,AN/ALE-37 Chaff Counter", "TCS(37),3495,PNT_87,TUMB,87,1,-1,1,TCS Acquisition", "TCS(37),3495,PNT_87,TUMB,87,-1,-1,1,TCS Acquisition", "ICS(2),3254,PNT_2138,LEV,2138,1,0,1,AN/ALR-67 Volume", "FUELSYSTEM(20),3064,PNT_1094,TUMB,1094,-1,0,1,Fuel Feed Cover", "FUELSYSTEM(20),3064,PNT_1094,TUMB,1094,1,0,1,Fuel Feed Cover", "ICS(2),3387,PNT_400,LEV,400,0,0,1,ICS Volume", "COUNTERMEASURES(5),3304,PNT_202,TUMB,202,0.25,0,1,AN/ALE-37 Chaff Salvo Interval", "COUNTERMEASURES(5),3304,PNT_202,TUMB,202,-0.25,0,1,AN/ALE-37 Chaff Salvo Interval", "CADC(22),3058,PNT_1071,BTN,1071,1,0,1,MASTER RESET", "AFCS(21),3038,PNT_2110,TUMB,2110,-1,0,1,Autopilot - Altitude Hold", "AFCS(21),3038,PNT_2110,TUMB,2110,1,0,1,Autopilot - Altitude Hold", "CAP(23),3531,PNT_148,BTN,148,1,0,1,CAP clear", "ECMD(44),3246,PNT_2024,BTN,2024,1,0,1,ECMD Test", "ARC159(3),3373,PNT_2032,TUMB,2032,0.0833333333,0,0.9166666663,UHF ARC-159 Preset Channel Selector", "ARC159(3),3373,PNT_2032,TUMB,2032,-0.0833333333,0,0.9166666663,UHF ARC-159 Preset Channel Selector", "TACAN(47),3336,PNT_2043,TUMB,2043,-2,-1,1,TACAN Channel X/Y", "TACAN(47),3336,PNT_2043,TUMB,2043,2,-1,1,TACAN Channel X/Y", "HSD(41),3243,PNT_1041,BTN,1041,1,0,1,HSD Test", "TID(43),3112,PNT_2005,TUMB,2005,0.33333,0,0.99999,TID Mode", "TID(43),3112,PNT_2005,TUMB,2005,-0.33333,0,0.99999,TID Mode", "WINGSWEEP(16),3030,PNT_384,TUMB,15096,-1,0,1,Emergency Wing Sweep Handle (Click to pop out)", "WINGSWEEP(16),3031,PNT_384,LEV,384,1,0,1,Emergency Wing Sweep Handle (Click to pop out)", "COUNTERMEASURES(5),3293,PNT_213,TUMB,213,0.11111111111111,0,1,AN/ALE-37 Jammer Interval Hundreds", "COUNTERMEASURES(5),3293,PNT_213,TUMB,213,-0.11111111111111,0,1,AN/ALE-37 Jammer Interval Hundreds", "ARC159(3),3359,PNT_2031,LEV,2031,0,0,1,UHF ARC-159 Volume Pilot", "INS(50),3106,PNT_50,TUMB,50,0.1666667,0,1.0000002,Navigation Mode", "INS(50),3106,PNT_50,TUMB,50,-0.1666667,0,1.0000002,Navigation Mode", "NAV_INTERFACE(46),3109,PNT_51,TUMB,51,0.142857,0,0.999999,Destination Mode", "NAV_INTERFACE(46),3109,PNT_51,TUMB,51,-0.142857,0,0.999999,Destination Mode", "FUELSYSTEM(20),3066,PNT_1001,TUMB,1001,1,-1,1,Wing/Ext Trans", "FUELSYSTEM(20),3066,PNT_1001,TUMB,1001,-1,-1,1,Wing/Ext Trans", "TACAN(47),3348,PNT_372,TUMB,372,-1,0,1,TACAN Channel X/Y", "TACAN(47),3348,PNT_372,TUMB,372,1,0,1,TACAN Channel X/Y", "ARC182(4),3405,PNT_360,LEV,360,0,0,1,VHF/UHF ARC-182 Display Brightness", "COCKPITMECHANICS(11),3635,PNT_950,TUMB,950,0.125,0,1,Temperature", "COCKPITMECHANICS(11),3635,PNT_950,TUMB,950,-0.125,0,1,Temperature", "STDBYAI(30),3548,PNT_RIO_STBY_ADI_PULL,LEV,6156,0.5,0,1,Standby ADI Knob", "STDBYAI(30),3547,PNT_RIO_STBY_ADI_PULL,TUMB,6155,1,0,1,Standby ADI Knob", "VDI(42),3224,PNT_1019,TUMB,1019,-1,0,1,VDI Display Mode", "VDI(42),3224,PNT_1019,TUMB,1019,1,0,1,VDI Display Mode", "AHRS(51),3436,PNT_906,TUMB,906,-1,0,1,Compass N-S Hemisphere", "AHRS(51),3436,PNT_906,TUMB,906,1,0,1,Compass N-S Hemisphere", "COCKPITMECHANICS(11),3603,PNT_192,TUMB,192,0.125,0,1,Console Light Intensity", "COCKPITMECHANICS(11),3603,PNT_192,TUMB,192,-0.125,0,1,Console Light Intensity", "ARC182(4),3417,PNT_RIO_UHF_OUTER,TUMB,353,0.2,0,1,VHF/UHF ARC-182 Freq Mode", "ARC182(4),3417,PNT_RIO_UHF_OUTER,TUMB,353,-0.2,0,1,VHF/UHF ARC-182 Freq Mode", "ARC182(4),3401,PNT_350,LEV,350,0,0,1,VHF/UHF ARC-182 Volume RIO", "CLOCK(26),3043,PNT_CLOCK_RESET,BTN,1099,1,0,1,Clock Timer Start/Stop/Reset", "VDI(42),3214,PNT_1010,TUMB,1010,-1,0,1,VDI Power On/Off", "VDI(42),3214,PNT_1010,TUMB,1010,1,0,1,VDI Power On/Off", "GEARHOOK(17),3659,PNT_497,BTN,497,1,0,1,Launch Bar Abort", "COCKPITMECHANICS(11),3194,PNT_933,TUMB,933,-1,0,1,Air Source Off", "COCKPITMECHANICS(11),3194,PNT_933,TUMB,933,1,0,1,Air Source Off", "COUNTERMEASURES(5),3270,PNT_388,TUMB,388,1,1,0,AN/ALE-37 Flare Dispense", "COUNTERMEASURES(5),3270,PNT_388,TUMB,388,-1,-1,0,AN/ALE-37 Flare Dispense", "TACAN(47),3338,PNT_374,TUMB,374,0.25,0,1,TACAN Mode", "TACAN(47),3338,PNT_374,TUMB,374,-0.25,0,1,TACAN Mode", "VDI(42),3234,PNT_VDI,BTN,-1,1,0,1,VDI filter", "VDI(42),3230,PNT_1035,LEV,1035,1,0,1,VSDI Screen Trim", "RADARALTIMETER(29),3484,PNT_308,LEV,308,0.5,0,1,Radar Altimeter Control Knob", "RADARALTIMETER(29),3485,PNT_308,BTN,16020,1,0,1,Radar Altimeter Control Knob", "COCKPITMECHANICS(11),3193,PNT_929,TUMB,929,-1,0,1,Air Source Ram", "COCKPITMECHANICS(11),3193,PNT_929,TUMB,929,1,0,1,Air Source Ram", "COCKPITMECHANICS(11),3196,PNT_931,TUMB,931,-1,0,1,Air Source Right Engine", "COCKPITMECHANICS(11),3196,PNT_931,TUMB,931,1,0,1,Air Source Right Engine", "TCS(37),3496,PNT_89,TUMB,89,1,-1,1,TCS Slave", "TCS(37),3496,PNT_89,TUMB,89,-1,-1,1,TCS Slave", "CAP(23),3530,PNT_98,TUMB,98,0.2,0,1,CAP category", "CAP(23),3530,PNT_98,TUMB,98,-0.2,0,1,CAP category", "AOASYSTEM(25),3211,PNT_915,TUMB,915,-1,0,1,Hook Bypass", "AOASYSTEM(25),3211,PNT_915,TUMB,915,1,0,1,Hook Bypass", "AFCS(21),3037,PNT_2109,TUMB,2109,1,-1,1,Autopilot - Vector / Automatic Carrier Landing", "AFCS(21),3037,PNT_2109,TUMB,2109,-1,-1,1,Autopilot - Vector / Automatic Carrier Landing", "ARC159(3),3365,PNT_2035,TUMB,2035,-1,0,1,UHF ARC-159 Squelch Switch", "ARC159(3),3365,PNT_2035,TUMB,2035,1,0,1,UHF ARC-159 Squelch Switch", "RADAR(39),3479,PNT_26,LEV,26,0.5,0,1,Pulse gain", "WEAPONS(55),3130,PNT_GUN_RATE,BTN,16000,1,0,1,Gun rate", "WEAPONS(55),3136,PNT_1047,TUMB,1047,-1,-1,1,Master Arm Switch", "WEAPONS(55),3136,PNT_1047,TUMB,1047,1,-1,1,Master Arm Switch", "WEAPONS(55),3158,PNT_61,TUMB,61,-1,0,1,Bomb step/ripple", "WEAPONS(55),3158,PNT_61,TUMB,61,1,0,1,Bomb step/ripple", "WEAPONS(55),3138,PNT_1048,BTN,1048,1,0,1,ACM Jettison", "COUNTERMEASURES(5),3283,PNT_207,TUMB,207,0.5,0,1,AN/ALE-37 L20 Load Type", "COUNTERMEASURES(5),3283,PNT_207,TUMB,207,-0.5,0,1,AN/ALE-37 L20 Load Type", "RADAR(39),3442,PNT_79,TUMB,79,0.33333,0,0.99999,Radar elevation scan", "RADAR(39),3442,PNT_79,TUMB,79,-0.33333,0,0.99999,Radar elevation scan", "WEAPONS(55),3135,PNT_1046,TUMB,1046,0,0,1,Master Arm Cover", "WEAPONS(55),3135,PNT_1046,TUMB,1046,1,0,1,Master Arm Cover", "RWR(54),3262,PNT_16011,LEV,16011,1,0,1,AN/ALR-67 Display Brightness", "ICS(2),3399,PNT_381,TUMB,381,1,-1,1,XMTR SEL Switch", "ICS(2),3399,PNT_381,TUMB,381,-1,-1,1,XMTR SEL Switch", "ARC159(3),3377,PNT_8115,BTN,8115,1,0,1,UHF ARC-159 Read", "CLOCK(26),3042,PNT_1051,LEV,1051,0.5,0,1,Clock Wind", "HSD(41),3239,PNT_1017,TUMB,1017,-1,0,1,HSD ECM Override", "HSD(41),3239,PNT_1017,TUMB,1017,1,0,1,HSD ECM Override", "COCKPITMECHANICS(11),3191,PNT_119,TUMB,119,-1,0,1,RIO Oxygen On", "COCKPITMECHANICS(11),3191,PNT_119,TUMB,119,1,0,1,RIO Oxygen On", "COCKPITMECHANICS(11),3179,PNT_920,TUMB,15007,0.125,0,1,Instrument Light Intensity", "COCKPITMECHANICS(11),3179,PNT_920,TUMB,15007,-0.125,0,1,Instrument Light Intensity", "MACHANDAIRSPEED(27),3491,PNT_310,LEV,310,0.5,0,1,Airspeed Indicator Bug Knob", "MACHANDAIRSPEED(27),3492,PNT_310,TUMB,2127,1,0,1,Airspeed Indicator Bug Knob", "COCKPITMECHANICS(11),3178,PNT_913,TUMB,15005,0.125,0,1,ACM Panel Light Intensity", "COCKPITMECHANICS(11),3178,PNT_913,TUMB,15005,-0.125,0,1,ACM Panel Light Intensity", "HSD(41),3241,PNT_1039,LEV,1039,0,0,1,HSD Selected Heading", "CLOCK(26),3697,PNT_1052,LEV,,0.5,0,1,Clock Wind", "CLOCK(26),3698,PNT_1053,BTN,4153,1,0,1,Clock Timer Start/Stop/Reset", "ENGINE(19),3053,PNT_16008,TUMB,16008,-1,0,1,Right Engine Mode", "ENGINE(19),3053,PNT_16008,TUMB,16008,1,0,1,Right Engine Mode", "WEAPONS(55),3131,PNT_1000,LEV,,1,0,1,Gun Elevation Lead Adjustment", "COCKPITMECHANICS(11),3184,PNT_2051,TUMB,224,0,0,1,Canopy Jettison", "COCKPITMECHANICS(11),3184,PNT_2051,TUMB,224,1,0,1,Canopy Jettison", "WEAPONS(55),3148,PNT_9960,TUMB,9960,0.11111111111111,0,1,Weapon Interval x10ms", "WEAPONS(55),3148,PNT_9960,TUMB,9960,-0.11111111111111,0,1,Weapon Interval x10ms", "COCKPITMECHANICS(11),3172,PNT_924,TUMB,924,1,-1,1,Red Flood Light", "COCKPITMECHANICS(11),3172,PNT_924,TUMB,924,-1,-1,1,Red Flood Light", "COUNTERMEASURES(5),3289,PNT_211,TUMB,211,0.11111111111111,0,1,AN/ALE-37 Jammer Interval Units", "COUNTERMEASURES(5),3289,PNT_211,TUMB,211,-0.11111111111111,0,1,AN/ALE-37 Jammer Interval Units", "TID(43),3115,PNT_1118,BTN,1118,1,0,1,TID Jam strobe", "ENGINE(19),3047,PNT_2103,TUMB,2103,1,-1,1,Throttle Temp", "ENGINE(19),3047,PNT_2103,TUMB,2103,-1,-1,1,Throttle Temp", "TID(43),3116,PNT_1117,BTN,1117,1,0,1,TID Data link", "HYDRAULICS(12),3005,PNT_631,TUMB,631,-1,0,1,Hydraulic Isolation Switch", "HYDRAULICS(12),3005,PNT_631,TUMB,631,1,0,1,Hydraulic Isolation Switch", "TID(43),3117,PNT_1116,BTN,1116,1,0,1,TID Sym Elem", "AICS(13),3008,PNT_2101,TUMB,2101,-1,0,1,Stow Inlet Ramps Right Switch", "AICS(13),3008,PNT_2101,TUMB,2101,1,0,1,Stow Inlet Ramps Right Switch", "HSD(41),3235,PNT_1016,TUMB,1016,-1,0,1,HSD Display Mode", "HSD(41),3235,PNT_1016,TUMB,1016,1,0,1,HSD Display Mode", "TID(43),3121,PNT_2114,BTN,2114,1,0,1,TID Velocity vector", "TID(43),3123,PNT_53,BTN,53,1,0,1,TID track hold", "HCU(58),3096,PNT_2007,TUMB,2007,-1,0,1,HCU TCS mode", "HCU(58),3096,PNT_2007,TUMB,2007,1,0,1,HCU TCS mode", "TCS(37),3100,PNT_2011,TUMB,2011,1,-1,1,TV/IR switch", "TCS(37),3100,PNT_2011,TUMB,2011,-1,-1,1,TV/IR switch", "BITPANEL(10),3077,PNT_934,TUMB,15098,1,0,1,Master Test Selector (LB to rotate, RB to pull/push)", "BITPANEL(10),3076,PNT_934,TUMB,934,0.090909090909091,0,0.90909090909091,Master Test Selector (LB to rotate, RB to pull/push)", "RADAR(39),3101,PNT_2012,TUMB,2012,1,-1,1,WCS switch",
-        "RADAR(39),3101,PNT_2012,TUMB,2012,-1,-1,1,WCS switch", "COUNTERMEASURES(5),3287,PNT_208,TUMB,208,0.5,0,1,AN/ALE-37 R20 Load Type", "COUNTERMEASURES(5),3287,PNT_208,TUMB,208,-0.5,0,1,AN/ALE-37 R20 Load Type", "RADAR(39),3631,PNT_2013,BTN,2013,1,0,1,Power reset", "RADAR(39),3451,PNT_41,BTN,41,1,0,1,RADAR 10 NM", "RADAR(39),3453,PNT_43,BTN,43,1,0,1,RADAR 50 NM", "HCU(58),3097,PNT_2008,TUMB,2008,-1,0,1,HCU radar mode", "HCU(58),3097,PNT_2008,TUMB,2008,1,0,1,HCU radar mode", "COCKPITMECHANICS(11),3176,PNT_919,TUMB,919,-1,0,1,Position Lights Flash", "COCKPITMECHANICS(11),3176,PNT_919,TUMB,919,1,0,1,Position Lights Flash", "DATALINK(52),3590,PNT_175,TUMB,175,-1,0,1,Datalink Antenna (no function)", "DATALINK(52),3590,PNT_175,TUMB,175,1,0,1,Datalink Antenna (no function)", "ICS(2),3382,PNT_2045,TUMB,2045,0.5,0,1,ICS Amplifier Selector", "ICS(2),3382,PNT_2045,TUMB,2045,-0.5,0,1,ICS Amplifier Selector", "RADAR(39),3458,PNT_11,BTN,11,1,0,1,RADAR track while scan manual", "CAP(23),3540,PNT_145,BTN,145,1,0,1,CAP RNG 5", "RADAR(39),3465,PNT_18,BTN,18,1,0,1,DDD Infrared (no function)", "RADAR(39),3673,PNT_1812,BTN,1812,1,0,1,CCM SPL (no function)", "FLAPS(18),3044,PNT_225,LEV,225,1,0,1,Flaps Lever", "COCKPITMECHANICS(11),3185,PNT_2049,TUMB,2049,0,0,1,Ejection CMD Lever", "COCKPITMECHANICS(11),3185,PNT_2049,TUMB,2049,1,0,1,Ejection CMD Lever", "RADAR(39),3674,PNT_1813,BTN,1813,1,0,1,CCM ALT DIFF (no function)", "RADAR(39),3675,PNT_1814,BTN,1814,1,0,1,CCM VGS (no function)", "RADAR(39),3474,PNT_21,LEV,21,0.5,0,1,IR volume (no function)", "RADAR(39),3475,PNT_22,LEV,22,0.5,0,1,IR threshold (no function)", "CAP(23),3535,PNT_144,BTN,144,1,0,1,CAP BRG 0", "RADAR(39),3478,PNT_25,LEV,25,0.5,0,1,Erase", "HUD(40),3229,PNT_1034,LEV,1034,1,0,1,HUD Trim", "COCKPITMECHANICS(11),3175,PNT_916,TUMB,916,1,-1,1,Position Lights Tail", "COCKPITMECHANICS(11),3175,PNT_916,TUMB,916,-1,-1,1,Position Lights Tail", "TACAN(47),3346,PNT_371,BTN,371,1,0,1,TACAN BIT", "WEAPONS(55),3141,PNT_MSL_MODE,BTN,16003,1,0,1,Missile mode", "ARC159(3),3350,PNT_1031,LEV,1031,1,0,1,UHF Radio Remote Display Brightness", "RADAR(39),3459,PNT_12,BTN,12,1,0,1,RADAR track while scan auto", "RADAR(39),3480,PNT_27,LEV,27,0.5,0,1,ACM threshold (no function)", "RADAR(39),3482,PNT_29,LEV,29,0.5,0,1,PD threshold clutter", "ELECTRICS(14),3010,PNT_936,TUMB,936,1,-1,1,Right Generator Switch", "ELECTRICS(14),3010,PNT_936,TUMB,936,-1,-1,1,Right Generator Switch", "NAV_INTERFACE(46),3315,PNT_1003,TUMB,1003,-1,0,1,Navigation Steer Commands: Destination", "NAV_INTERFACE(46),3315,PNT_1003,TUMB,1003,1,0,1,Navigation Steer Commands: Destination", "RADAR(39),3454,PNT_44,BTN,44,1,0,1,RADAR 100 NM", "WARNINGLIGHTS(34),3056,PNT_9199,BTN,9199,1,0,1,Master Caution Reset", "BAROALTIMETER(28),3490,PNT_20307,TUMB,20307,1,1,0,Altimeter Mode Switch", "BAROALTIMETER(28),3490,PNT_20307,TUMB,20307,-1,-1,0,Altimeter Mode Switch", "TID(43),3122,PNT_52,BTN,52,1,0,1,collision steering", "HYDRAULICS(12),3002,PNT_630,TUMB,630,-1,0,1,Hydraulic Transfer Pump Switch Cover", "HYDRAULICS(12),3002,PNT_630,TUMB,630,1,0,1,Hydraulic Transfer Pump Switch Cover", "GEARHOOK(17),3019,PNT_1075,TUMB,1075,1,1,0,Nose Strut Compression Switch", "GEARHOOK(17),3019,PNT_1075,TUMB,1075,-1,-1,0,Nose Strut Compression Switch", "ARC159(3),3355,PNT_405,BTN,405,1,0,1,UHF Radio Remote Display Test", "RADAR(39),3468,PNT_35,TUMB,35,-1,-1,1,Closing Velocity scale", "RADAR(39),3468,PNT_35,TUMB,35,1,-1,1,Closing Velocity scale", "RADAR(39),3469,PNT_36,TUMB,36,-1,-1,1,Target size (no function)", "RADAR(39),3469,PNT_36,TUMB,36,1,-1,1,Target size (no function)", "RADAR(39),3470,PNT_37,TUMB,37,-1,-1,1,Main Lobe Clutter filter", "RADAR(39),3470,PNT_37,TUMB,37,1,-1,1,Main Lobe Clutter filter", "ICS(2),3595,PNT_150,TUMB,150,-1,0,1,KY-28 ZEROIZE Cover", "ICS(2),3595,PNT_150,TUMB,150,1,0,1,KY-28 ZEROIZE Cover", "RADAR(39),3443,PNT_80,TUMB,80,0.33333,0,0.99999,Radar azimuth scan", "RADAR(39),3443,PNT_80,TUMB,80,-0.33333,0,0.99999,Radar azimuth scan", "ARC182(4),3410,PNT_355,TUMB,355,1,1,0,VHF/UHF ARC-182 1MHz", "ARC182(4),3410,PNT_355,TUMB,355,-1,-1,0,VHF/UHF ARC-182 1MHz", "CAP(23),3519,PNT_126,BTN,126,1,0,1,CAP btn 2", "COUNTERMEASURES(5),3277,PNT_385,LEV,385,1,0,1,AN/ALE-37 Flare Counter", "ARC159(3),3361,PNT_383,LEV,383,0,0,1,UHF ARC-159 Volume RIO", "ICS(2),3397,PNT_2039,LEV,2039,0,0,1,Sidewinder Volume", "AFCS(21),3040,PNT_2112,TUMB,2112,-2,-1,1,Autopilot - Engage", "AFCS(21),3040,PNT_2112,TUMB,2112,2,-1,1,Autopilot - Engage", "RADAR(39),3473,PNT_20,LEV,20,0.5,0,1,IR gain (no function)", "ARC159(3),3368,PNT_2029,TUMB,2029,1,1,0,UHF ARC-159 1MHz", "ARC159(3),3368,PNT_2029,TUMB,2029,-1,-1,0,UHF ARC-159 1MHz", "COCKPITMECHANICS(11),3173,PNT_921,TUMB,921,1,-1,1,White Flood Light", "COCKPITMECHANICS(11),3173,PNT_921,TUMB,921,-1,-1,1,White Flood Light", "RADAR(39),3449,PNT_83,TUMB,83,-1,0,1,Stabilize", "RADAR(39),3449,PNT_83,TUMB,83,1,0,1,Stabilize", "WEAPONS(55),3156,PNT_75,TUMB,75,-1,-1,1,Missile option", "WEAPONS(55),3156,PNT_75,TUMB,75,1,-1,1,Missile option", "ARC159(3),3371,PNT_2034,TUMB,2034,0.333333,0,0.999999,UHF ARC-159 Function", "ARC159(3),3371,PNT_2034,TUMB,2034,-0.333333,0,0.999999,UHF ARC-159 Function", "RWR(54),3263,PNT_376,LEV,376,1,0,1,AN/ALR-67 Display Brightness", "VDI(42),3225,PNT_1018,TUMB,1018,-1,0,1,VDI Landing Mode", "VDI(42),3225,PNT_1018,TUMB,1018,1,0,1,VDI Landing Mode", "TCS(37),3605,PNT_91,TUMB,91,0.25,0,1,Record mode (no function)", "TCS(37),3605,PNT_91,TUMB,91,-0.25,0,1,Record mode (no function)", "RADAR(39),3461,PNT_14,BTN,14,1,0,1,RADAR pulse doppler search", "ARC159(3),3369,PNT_2028,TUMB,2028,1,1,0,UHF ARC-159 0.1MHz", "ARC159(3),3369,PNT_2028,TUMB,2028,-1,-1,0,UHF ARC-159 0.1MHz", "TCS(37),3609,PNT_16016,LEV,16016,1,0,1,Record reset (no function)", "FUELSYSTEM(20),3062,PNT_15081,TUMB,15081,0,0,1,Fuel Shutoff - Left", "FUELSYSTEM(20),3062,PNT_15081,TUMB,15081,1,0,1,Fuel Shutoff - Left", "COCKPITMECHANICS(11),3599,PNT_122,TUMB,122,0,0,1,Storage", "COCKPITMECHANICS(11),3599,PNT_122,TUMB,122,1,0,1,Storage", "ARC182(4),3419,PNT_359,TUMB,359,-1,0,1,VHF/UHF ARC-182 FM/AM Switch", "ARC182(4),3419,PNT_359,TUMB,359,1,0,1,VHF/UHF ARC-182 FM/AM Switch", "WEAPONS(55),3147,PNT_9961,TUMB,9961,0.11111111111111,0,1,Weapon Interval x100ms", "WEAPONS(55),3147,PNT_9961,TUMB,9961,-0.11111111111111,0,1,Weapon Interval x100ms", "WEAPONS(55),3150,PNT_9963,TUMB,9963,0.11111111111111,0,1,Weapon Quantity 1s", "WEAPONS(55),3150,PNT_9963,TUMB,9963,-0.11111111111111,0,1,Weapon Quantity 1s", "ARC159(3),3367,PNT_2030,TUMB,2030,1,1,0,UHF ARC-159 100MHz & 10MHz", "ARC159(3),3367,PNT_2030,TUMB,2030,-1,-1,0,UHF ARC-159 100MHz & 10MHz", "COCKPITMECHANICS(11),3600,PNT_194,TUMB,194,1,-1,1,Red Flood Light", "COCKPITMECHANICS(11),3600,PNT_194,TUMB,194,-1,-1,1,Red Flood Light", "COUNTERMEASURES(5),3297,PNT_216,BTN,216,1,0,1,AN/ALE-37 Programmer Reset", "WEAPONS(55),3151,PNT_2022,TUMB,2022,0.25,0,1,Attack mode", "WEAPONS(55),3151,PNT_2022,TUMB,2022,-0.25,0,1,Attack mode", "WEAPONS(55),3153,PNT_72,TUMB,72,0.2,0,1,Missile speed gate", "WEAPONS(55),3153,PNT_72,TUMB,72,-0.2,0,1,Missile speed gate", "ILS(48),3322,PNT_912,TUMB,912,0.052631578947368,0,1,AN/ARA-63 Channel Knob", "ILS(48),3322,PNT_912,TUMB,912,-0.052631578947368,0,1,AN/ARA-63 Channel Knob", "WEAPONS(55),3154,PNT_78,TUMB,78,1,1,0,Selective jettison", "WEAPONS(55),3154,PNT_78,TUMB,78,-1,-1,0,Selective jettison", "CAP(23),3525,PNT_131,BTN,131,1,0,1,CAP btn 8", "COUNTERMEASURES(5),3285,PNT_209,TUMB,209,0.5,0,1,AN/ALE-37 R10 Load Type", "COUNTERMEASURES(5),3285,PNT_209,TUMB,209,-0.5,0,1,AN/ALE-37 R10 Load Type", "WEAPONS(55),3133,PNT_1049,TUMB,1049,0,0,1,ACM Cover", "WEAPONS(55),3133,PNT_1049,TUMB,1049,1,0,1,ACM Cover", "WEAPONS(55),3159,PNT_62,TUMB,62,-1,0,1,A/G gun mode", "WEAPONS(55),3159,PNT_62,TUMB,62,1,0,1,A/G gun mode", "ARC182(4),3403,PNT_2038,LEV,2038,0,0,1,VHF/UHF ARC-182 Volume Pilot", "NAV_INTERFACE(46),3317,PNT_1006,TUMB,1006,-1,0,1,Navigation Steer Commands: Manual", "NAV_INTERFACE(46),3317,PNT_1006,TUMB,1006,1,0,1,Navigation Steer Commands: Manual", "WEAPONS(55),3164,PNT_73,TUMB,73,-1,0,1,Jettison left tank", "WEAPONS(55),3164,PNT_73,TUMB,73,1,0,1,Jettison left tank", "WEAPONS(55),3161,PNT_74,BTN,74,1,0,1,A/A Launch", "CAP(23),3524,PNT_132,BTN,132,1,0,1,CAP btn 7", "HUD(40),3233,PNT_1037,LEV,1037,1,0,1,HUD Brightness", "CAP(23),3521,PNT_123,BTN,124,1,0,1,CAP btn 4", "CAP(23),3522,PNT_124,BTN,123,1,0,1,CAP btn 5", "COUNTERMEASURES(5),3269,PNT_389,TUMB,389,1,1,0,AN/ALE-37 Chaff Dispense", "COUNTERMEASURES(5),3269,PNT_389,TUMB,389,-1,-1,0,AN/ALE-37 Chaff Dispense", "RADAR(39),3464,PNT_17,BTN,17,1,0,1,DDD Interrogate Friend or Foe", "ENGINE(19),3050,PNT_2105,TUMB,2105,-1,0,1,Engine Airstart", "ENGINE(19),3050,PNT_2105,TUMB,2105,1,0,1,Engine Airstart", "COCKPITMECHANICS(11),3174,PNT_913_22,TUMB,913,1,-1,1,Position Lights Wing", "COCKPITMECHANICS(11),3174,PNT_913_22,TUMB,913,-1,-1,1,Position Lights Wing", "CAP(23),3520,PNT_125,BTN,125,1,0,1,CAP btn 3", "HSD(41),3215,PNT_1008,TUMB,1008,-1,0,1,HSD/ECMD Power On/Off", "HSD(41),3215,PNT_1008,TUMB,1008,1,0,1,HSD/ECMD Power On/Off", "HUD(40),3228,PNT_1033,TUMB,1033,0,0,1,HUD filter", "HUD(40),3228,PNT_1033,TUMB,1033,1,0,1,HUD filter", "CAP(23),3528,PNT_128,BTN,128,1,0,1,CAP TNG NBR", "WEAPONS(55),3146,PNT_59,TUMB,59,0.023255813953488,0,1,Weapon type wheel", "WEAPONS(55),3146,PNT_59,TUMB,59,-0.023255813953488,0,1,Weapon type wheel", "TID(43),3120,PNT_2113,BTN,2113,1,0,1,TID Launch zone", "ICS(2),3423,PNT_116,TUMB,116,0.5,0,1,KY-28 Power Mode", "ICS(2),3423,PNT_116,TUMB,116,-0.5,0,1,KY-28 Power Mode", "CAP(23),3518,PNT_127,BTN,127,1,0,1,CAP btn 1", "ENGINE(19),3128,PNT_THROT_L,TUMB,12300,-1,0,1,Left Engine Fuel Cutoff", "ENGINE(19),3128,PNT_THROT_L,TUMB,12300,1,0,1,Left Engine Fuel Cutoff", "RADAR(39),3446,PNT_81,LEV,81,0,-1,1,Radar elevation center", "CAP(23),3526,PNT_130,BTN,130,1,0,1,CAP btn 9", "WEAPONS(55),3166,PNT_69,TUMB,69,-1,0,1,Jettison station 4", "WEAPONS(55),3166,PNT_69,TUMB,69,1,0,1,Jettison station 4", "HYDRAULICS(12),3001,PNT_629,TUMB,629,-1,0,1,Hydraulic Transfer Pump Switch", "HYDRAULICS(12),3001,PNT_629,TUMB,629,1,0,1,Hydraulic Transfer Pump Switch",
-        "WEAPONS(55),3155,PNT_63,TUMB,63,-1,-1,1,Mech fuse", "WEAPONS(55),3155,PNT_63,TUMB,63,1,-1,1,Mech fuse", "TID(43),3125,PNT_49,LEV,49,1,0,1,TID Contrast", "TID(43),3162,PNT_9964,BTN,9964,1,0,1,Next Launch", "CAP(23),3523,PNT_133,BTN,133,1,0,1,CAP btn 6", "ARC182(4),3411,PNT_356,TUMB,356,1,1,0,VHF/UHF ARC-182 0.1MHz", "ARC182(4),3411,PNT_356,TUMB,356,-1,-1,0,VHF/UHF ARC-182 0.1MHz", "CAP(23),3529,PNT_134,BTN,134,1,0,1,CAP PGM RSTRT", "COCKPITMECHANICS(11),3177,PNT_923,TUMB,923,-1,0,1,Anti-Collision Lights", "COCKPITMECHANICS(11),3177,PNT_923,TUMB,923,1,0,1,Anti-Collision Lights", "HUD(40),3219,PNT_1012,TUMB,1012,-1,0,1,HUD Air-to-Ground Mode", "HUD(40),3219,PNT_1012,TUMB,1012,1,0,1,HUD Air-to-Ground Mode", "CAP(23),3541,PNT_136,BTN,136,1,0,1,CAP LONG 6", "GEARHOOK(17),3022,PNT_238,TUMB,15078,1,0,1,Hook Extension Handle (RB cycle emergency mode)", "GEARHOOK(17),3021,PNT_238,TUMB,238,1,0,1,Hook Extension Handle (RB cycle emergency mode)", "CAP(23),3543,PNT_140,BTN,140,1,0,1,CAP HDG 8", "COUNTERMEASURES(5),3295,PNT_204,TUMB,204,0.33333333333333,0,1,AN/ALE-37 Jammer Quantity", "COUNTERMEASURES(5),3295,PNT_204,TUMB,204,-0.33333333333333,0,1,AN/ALE-37 Jammer Quantity", "CAP(23),3538,PNT_141,BTN,141,1,0,1,CAP SPD 3", "AHRS(51),3433,PNT_904,LEV,904,1,-1,1,Compass HDG Slave Knob/nPush (Left Mouse Button) and rotate (Right Mouse Button)", "AHRS(51),3432,PNT_904,BTN,16014,1,0,1,Compass HDG Slave Knob/nPush (Left Mouse Button) and rotate (Right Mouse Button)", "RADAR(39),3477,PNT_24,LEV,24,0.5,0,1,Pulse video", "DATALINK(52),3593,PNT_222,TUMB,222,0.11111111111111,0,1,Datalink address high", "DATALINK(52),3593,PNT_222,TUMB,222,-0.11111111111111,0,1,Datalink address high", "AHRS(51),3434,PNT_905,TUMB,905,1,-1,1,Compass Mode", "AHRS(51),3434,PNT_905,TUMB,905,-1,-1,1,Compass Mode", "TACAN(47),3330,PNT_TACAN_OUTER_TWIST_PILOT,TUMB,8888,0.083333333333333,0,1,TACAN Channel Wheel (Tens)", "TACAN(47),3330,PNT_TACAN_OUTER_TWIST_PILOT,TUMB,8888,-0.083333333333333,0,1,TACAN Channel Wheel (Tens)", "CAP(23),3533,PNT_146,BTN,146,1,0,1,CAP N+E", "CAP(23),3532,PNT_147,BTN,147,1,0,1,CAP S-W", "COUNTERMEASURES(5),3306,PNT_205,TUMB,205,0.2,0,1,AN/ALE-37 Flare Quantity", "COUNTERMEASURES(5),3306,PNT_205,TUMB,205,-0.2,0,1,AN/ALE-37 Flare Quantity", "COUNTERMEASURES(5),3271,PNT_387,TUMB,387,1,1,0,AN/ALE-37 Jammer Dispense", "COUNTERMEASURES(5),3271,PNT_387,TUMB,387,-1,-1,0,AN/ALE-37 Jammer Dispense", "COUNTERMEASURES(5),3300,PNT_215,TUMB,215,0.2,0,1,AN/ALE-37 Chaff Burst Interval", "COUNTERMEASURES(5),3300,PNT_215,TUMB,215,-0.2,0,1,AN/ALE-37 Chaff Burst Interval", "WEAPONS(55),3165,PNT_65,TUMB,65,-1,0,1,Jettison station 3", "WEAPONS(55),3165,PNT_65,TUMB,65,1,0,1,Jettison station 3", "RADAR(39),3457,PNT_10,BTN,10,1,0,1,RADAR pulse search", "DATALINK(52),3592,PNT_177,TUMB,177,-1,0,1,Datalink CAINS/TAC", "DATALINK(52),3592,PNT_177,TUMB,177,1,0,1,Datalink CAINS/TAC", "AFCS(21),3035,PNT_2107,TUMB,2107,-1,0,1,AFCS Stability Augmentation - Roll", "AFCS(21),3035,PNT_2107,TUMB,2107,1,0,1,AFCS Stability Augmentation - Roll", "DATALINK(52),3680,PNT_118,TUMB,118,0.166667,0,1.000002,Beacon mode", "DATALINK(52),3680,PNT_118,TUMB,118,-0.166667,0,1.000002,Beacon mode", "DATALINK(52),3587,PNT_195,TUMB,195,0.11111111111111,0,1,Datalink freq 1MHz", "DATALINK(52),3587,PNT_195,TUMB,195,-0.11111111111111,0,1,Datalink freq 1MHz", "DATALINK(52),3588,PNT_197,TUMB,197,0.11111111111111,0,1,Datalink freq 100kHz", "DATALINK(52),3588,PNT_197,TUMB,197,-0.11111111111111,0,1,Datalink freq 100kHz", "RADAR(39),3462,PNT_15,BTN,15,1,0,1,RADAR pulse single target track", "AFCS(21),3039,PNT_2111,TUMB,2111,1,-1,1,Autopilot - Heading / Ground Track", "AFCS(21),3039,PNT_2111,TUMB,2111,-1,-1,1,Autopilot - Heading / Ground Track", "RADAR(39),3476,PNT_23,LEV,23,0.5,0,1,Brightness", "DATALINK(52),3594,PNT_223,TUMB,223,0.11111111111111,0,1,Datalink address low", "DATALINK(52),3594,PNT_223,TUMB,223,-0.11111111111111,0,1,Datalink address low", "GEARHOOK(17),3660,PNT_496,TUMB,496,-1,0,1,Launch Bar Abort Switch Cover", "GEARHOOK(17),3660,PNT_496,TUMB,496,1,0,1,Launch Bar Abort Switch Cover", "DATALINK(52),3585,PNT_191,TUMB,191,1,-1,1,Datalink Antijam (no function)", "DATALINK(52),3585,PNT_191,TUMB,191,-1,-1,1,Datalink Antijam (no function)", "RADAR(39),3471,PNT_38,TUMB,38,-2,-1,1,Automatic Gain Control (no function)", "RADAR(39),3471,PNT_38,TUMB,38,2,-1,1,Automatic Gain Control (no function)", "WEAPONS(55),3169,PNT_67,TUMB,67,-1,0,1,Jettison right tank", "WEAPONS(55),3169,PNT_67,TUMB,67,1,0,1,Jettison right tank", "HUD(40),3217,PNT_1014,TUMB,1014,-1,0,1,HUD Cruise Mode", "HUD(40),3217,PNT_1014,TUMB,1014,1,0,1,HUD Cruise Mode", "WEAPONS(55),3655,PNT_1069,TUMB,1069,0,0,1,Jettison aux guard", "WEAPONS(55),3655,PNT_1069,TUMB,1069,1,0,1,Jettison aux guard", "COCKPITMECHANICS(11),3190,PNT_8114,TUMB,8114,-1,0,1,Pilot Oxygen On", "COCKPITMECHANICS(11),3190,PNT_8114,TUMB,8114,1,0,1,Pilot Oxygen On", "CAP(23),3537,PNT_138,BTN,138,1,0,1,CAP NBR 2", "DATALINK(52),3679,PNT_117,BTN,117,1,0,1,ACLS test", "IFF(64),3613,PNT_161,TUMB,161,-1,-1,1,IFF audio/light (no function)", "IFF(64),3613,PNT_161,TUMB,161,1,-1,1,IFF audio/light (no function)", "IFF(64),3614,PNT_162,TUMB,162,-1,-1,1,IFF M1 (no function)", "IFF(64),3614,PNT_162,TUMB,162,1,-1,1,IFF M1 (no function)", "ELECTRICS(14),3011,PNT_927,TUMB,927,-1,0,1,Emergency Generator Switch Cover", "ELECTRICS(14),3011,PNT_927,TUMB,927,1,0,1,Emergency Generator Switch Cover", "IFF(64),3615,PNT_163,TUMB,163,-1,-1,1,IFF M2 (no function)", "IFF(64),3615,PNT_163,TUMB,163,1,-1,1,IFF M2 (no function)", "IFF(64),3616,PNT_164,TUMB,164,-1,-1,1,IFF M3/A (no function)", "IFF(64),3616,PNT_164,TUMB,164,1,-1,1,IFF M3/A (no function)", "IFF(64),3617,PNT_165,TUMB,165,-1,-1,1,IFF MC (no function)", "IFF(64),3617,PNT_165,TUMB,165,1,-1,1,IFF MC (no function)", "CAP(23),3544,PNT_142,BTN,142,1,0,1,CAP 9", "IFF(64),3619,PNT_167,TUMB,167,-1,-1,1,IFF Ident (no function)", "IFF(64),3619,PNT_167,TUMB,167,1,-1,1,IFF Ident (no function)", "HUD(40),3223,PNT_1007,LEV,1007,1,0,1,HUD Pitch Ladder Brightness", "STDBYAI(30),3546,PNT_1032,LEV,19101,0.5,0,1,Standby ADI Knob", "STDBYAI(30),3545,PNT_1032,TUMB,,1,0,1,Standby ADI Knob", "IFF(64),3621,PNT_183,TUMB,183,0.33333333333333,0,1,IFF code (no function)", "IFF(64),3621,PNT_183,TUMB,183,-0.33333333333333,0,1,IFF code (no function)", "IFF(64),3622,PNT_184,TUMB,184,0.25,0,1,IFF master (no function)", "IFF(64),3622,PNT_184,TUMB,184,-0.25,0,1,IFF master (no function)", "TACAN(47),3325,PNT_135,BTN,135,1,0,1,TACAN CMD Button", "IFF(64),3623,PNT_185,BTN,185,1,0,1,IFF test (no function)", "HUD(40),3226,PNT_1021,TUMB,1021,-1,0,1,HUD De-clutter On/Off", "HUD(40),3226,PNT_1021,TUMB,1021,1,0,1,HUD De-clutter On/Off", "RWR(54),3256,PNT_2137,TUMB,2137,1,1,0,AN/ALR-67 Mode", "RWR(54),3256,PNT_2137,TUMB,2137,-1,-1,0,AN/ALR-67 Mode", "RADAR(39),3456,PNT_DDD_CENTRw,BTN,-1,1,0,1,DDD filter", "IFF(64),3624,PNT_186,BTN,186,1,0,1,IFF reply (no function)", "ENGINE(19),3049,PNT_941,TUMB,941,1,-1,1,Engine/Probe Anti-Ice", "ENGINE(19),3049,PNT_941,TUMB,941,-1,-1,1,Engine/Probe Anti-Ice", "AICS(13),3007,PNT_2100,TUMB,2100,-1,0,1,Stow Inlet Ramps Left Switch", "AICS(13),3007,PNT_2100,TUMB,2100,1,0,1,Stow Inlet Ramps Left Switch", "IFF(64),3625,PNT_2262,TUMB,2262,0.11111,0,0.77777,IFF M3 code ---x (no function)", "IFF(64),3625,PNT_2262,TUMB,2262,-0.11111,0,0.77777,IFF M3 code ---x (no function)", "IFF(64),3626,PNT_2261,TUMB,2261,0.11111,0,0.77777,IFF M3 code --x- (no function)", "IFF(64),3626,PNT_2261,TUMB,2261,-0.11111,0,0.77777,IFF M3 code --x- (no function)", "IFF(64),3628,PNT_199,TUMB,199,0.11111,0,0.77777,IFF M3 code x--- (no function)", "IFF(64),3628,PNT_199,TUMB,199,-0.11111,0,0.77777,IFF M3 code x--- (no function)", "IFF(64),3629,PNT_200,TUMB,200,0.11111,0,0.33333,IFF M1 code -x (no function)", "IFF(64),3629,PNT_200,TUMB,200,-0.11111,0,0.33333,IFF M1 code -x (no function)", "TACAN(47),3344,PNT_8890,TUMB,8890,0.11111111111111,0,1,TACAN Channel Lever (Ones)", "TACAN(47),3344,PNT_8890,TUMB,8890,-0.11111111111111,0,1,TACAN Channel Lever (Ones)", "IFF(64),3630,PNT_201,TUMB,201,0.11111,0,0.77777,IFF M1 code x- (no function)", "IFF(64),3630,PNT_201,TUMB,201,-0.11111,0,0.77777,IFF M1 code x- (no function)", "RADAR(39),3466,PNT_19,BTN,19,1,0,1,DDD RADAR", "(),3060,PNT_15082,BTN,15082,1,0,1,Fire Ext Bottle - Right", "RADAR(39),3681,PNT_95,TUMB,95,1,-1,1,Liquid cooling", "RADAR(39),3681,PNT_95,TUMB,95,-1,-1,1,Liquid cooling", "LANTIRN(38),3676,PNT_667,TUMB,667,0.5,0,1,LANTIRN Power", "LANTIRN(38),3676,PNT_667,TUMB,667,-0.5,0,1,LANTIRN Power", "ACCELEROMETER(24),3488,PNT_228,BTN,228,1,0,1,Accelerometer Reset", "LANTIRN(38),3516,PNT_668,TUMB,668,-1,0,1,LANTIRN Laser Arm Switch", "LANTIRN(38),3516,PNT_668,TUMB,668,1,0,1,LANTIRN Laser Arm Switch", "TID(43),3498,PNT_670,BTN,670,1,0,1,Video Output Toggle (TCS/LANTIRN)", "ARC159(3),3375,PNT_2033,TUMB,2033,-0.5,0,1,UHF ARC-159 Freq Mode", "ARC159(3),3375,PNT_2033,TUMB,2033,0.5,0,1,UHF ARC-159 Freq Mode", "LANTIRN(38),3691,PNT_669,BTN,669,1,0,1,LANTIRN Operate Mode (Unstow)", "WEAPONS(55),3163,PNT_68,TUMB,68,-1,-1,1,Jettison station 1", "WEAPONS(55),3163,PNT_68,TUMB,68,1,-1,1,Jettison station 1", "TID(43),3114,PNT_226,BTN,226,1,0,1,TID Non attack", "COUNTERMEASURES(5),3302,PNT_203,TUMB,203,0.16666666666667,0,1,AN/ALE-37 Chaff Salvo Quantity", "COUNTERMEASURES(5),3302,PNT_203,TUMB,203,-0.16666666666667,0,1,AN/ALE-37 Chaff Salvo Quantity", "COCKPITMECHANICS(11),3186,PNT_Seat_Safety,TUMB,404,0,0,1,Ejection Seat Safety", "COCKPITMECHANICS(11),3186,PNT_Seat_Safety,TUMB,404,1,0,1,Ejection Seat Safety", "RADAR(39),3481,PNT_28,LEV,28,0.5,0,1,JAM/JET (no function)", "HYDRAULICS(12),3006,PNT_632,TUMB,632,0,0,1,Hydraulic Hand Pump", "HYDRAULICS(12),3006,PNT_632,TUMB,632,1,0,1,Hydraulic Hand Pump", "COCKPITMECHANICS(11),3197,PNT_932,TUMB,932,-1,0,1,Air Source Both Engines", "COCKPITMECHANICS(11),3197,PNT_932,TUMB,932,1,0,1,Air Source Both Engines", "BAROALTIMETER(28),3487,PNT_307,TUMB,307,1,1,0,Altimeter Mode Switch", "BAROALTIMETER(28),3487,PNT_307,TUMB,307,-1,-1,0,Altimeter Mode Switch", "HCU(58),3099,PNT_2010,TUMB,2010,-1,0,1,HCU TID mode",
-        "HCU(58),3099,PNT_2010,TUMB,2010,1,0,1,HCU TID mode", "COCKPITMECHANICS(11),3601,PNT_159,TUMB,159,1,-1,1,White Flood Light", "COCKPITMECHANICS(11),3601,PNT_159,TUMB,159,-1,-1,1,White Flood Light", "ENGINE(19),3045,PNT_2104,TUMB,2104,1,-1,1,Throttle Mode", "ENGINE(19),3045,PNT_2104,TUMB,2104,-1,-1,1,Throttle Mode", "NAV_INTERFACE(46),3316,PNT_1005,TUMB,1005,-1,0,1,Navigation Steer Commands: Vector", "NAV_INTERFACE(46),3316,PNT_1005,TUMB,1005,1,0,1,Navigation Steer Commands: Vector", "COUNTERMEASURES(5),3298,PNT_214,TUMB,214,0.2,0,1,AN/ALE-37 Chaff Burst Quantity", "COUNTERMEASURES(5),3298,PNT_214,TUMB,214,-0.2,0,1,AN/ALE-37 Chaff Burst Quantity", "COCKPITMECHANICS(11),3637,PNT_938,TUMB,938,-1,0,1,Ram Air", "COCKPITMECHANICS(11),3637,PNT_938,TUMB,938,1,0,1,Ram Air", "CAP(23),3527,PNT_129,BTN,129,1,0,1,CAP btn 10", "ARC182(4),3409,PNT_354,TUMB,354,1,1,0,VHF/UHF ARC-182 100MHz & 10MHz", "ARC182(4),3409,PNT_354,TUMB,354,-1,-1,0,VHF/UHF ARC-182 100MHz & 10MHz", "TACAN(47),3326,PNT_2041,TUMB,2041,0.25,0,1,TACAN Mode", "TACAN(47),3326,PNT_2041,TUMB,2041,-0.25,0,1,TACAN Mode", "ARC159(3),3378,PNT_16009,BTN,16009,1,0,1,UHF ARC-159 Load", "HYDRAULICS(12),3004,PNT_8100,TUMB,615,-1,0,1,Hydraulic Emergency Flight Control Switch Cover", "HYDRAULICS(12),3004,PNT_8100,TUMB,615,1,0,1,Hydraulic Emergency Flight Control Switch Cover", "FUELSYSTEM(20),3063,PNT_1076,TUMB,1076,1,1,0,Fuel Quantity Selector", "FUELSYSTEM(20),3063,PNT_1076,TUMB,1076,-1,-1,0,Fuel Quantity Selector", "COCKPITMECHANICS(11),3636,PNT_940,TUMB,940,-1,0,1,Temp Auto / Man", "COCKPITMECHANICS(11),3636,PNT_940,TUMB,940,1,0,1,Temp Auto / Man", "COCKPITMECHANICS(11),3184,PNT_224,TUMB,224,0,0,1,Canopy Jettison", "COCKPITMECHANICS(11),3184,PNT_224,TUMB,224,1,0,1,Canopy Jettison", "VDI(42),3232,PNT_1036,LEV,1036,1,0,1,VSDI Screen Brightness", "TACAN(47),3334,PNT_2115,BTN,2115,1,0,1,TACAN BIT", "ILS(48),3319,PNT_910,TUMB,910,-1,0,1,AN/ARA-63 Power Switch", "ILS(48),3319,PNT_910,TUMB,910,1,0,1,AN/ARA-63 Power Switch", "WINGSWEEP(16),3029,PNT_317,TUMB,317,0,0,1,Emergency Wing Sweep Handle Cover", "WINGSWEEP(16),3029,PNT_317,TUMB,317,1,0,1,Emergency Wing Sweep Handle Cover", "ARC159(3),3363,PNT_2027,LEV,2027,0,0,1,UHF ARC-159 Display Brightness", "COCKPITMECHANICS(11),3195,PNT_930,TUMB,930,-1,0,1,Air Source Left Engine", "COCKPITMECHANICS(11),3195,PNT_930,TUMB,930,1,0,1,Air Source Left Engine", "DATALINK(52),3586,PNT_196,TUMB,196,0.11111111111111,0,1,Datalink freq 10MHz", "DATALINK(52),3586,PNT_196,TUMB,196,-0.11111111111111,0,1,Datalink freq 10MHz", "WEAPONS(55),3142,PNT_239,BTN,239,1,0,1,Emergency stores jettison", "RWR(54),3257,PNT_2136,TUMB,2136,0.25,0,1,AN/ALR-67 Display Type", "RWR(54),3257,PNT_2136,TUMB,2136,-0.25,0,1,AN/ALR-67 Display Type", "WEAPONS(55),3149,PNT_9962,TUMB,9962,0.11111111111111,,,Weapon Quantity 10s", "WEAPONS(55),3149,PNT_9962,TUMB,9962,-0.11111111111111,0,0.3333,Weapon Quantity 10s", "GEARHOOK(17),3013,PNT_237,TUMB,237,0,0,1,Parking Brake Handle", "GEARHOOK(17),3013,PNT_237,TUMB,237,1,0,1,Parking Brake Handle", "COCKPITMECHANICS(11),3634,PNT_942,TUMB,942,1,-1,1,Wind Shield Air", "COCKPITMECHANICS(11),3634,PNT_942,TUMB,942,-1,-1,1,Wind Shield Air", "TACAN(47),3324,PNT_292,BTN,292,1,0,1,TACAN CMD Button", "ELECTRICS(14),3430,PNT_908,TUMB,908,-1,0,1,Inboard Spoiler Override", "ELECTRICS(14),3430,PNT_908,TUMB,908,1,0,1,Inboard Spoiler Override", "TACAN(47),3335,PNT_2042,TUMB,2042,-2,-1,1,TACAN Mode Normal/Inverse", "TACAN(47),3335,PNT_2042,TUMB,2042,2,-1,1,TACAN Mode Normal/Inverse", "CAP(23),3534,PNT_149,BTN,149,1,0,1,CAP enter", "BAROALTIMETER(28),3489,PNT_20306,LEV,20306,0,0,1,Altimeter Pressure Setting", "RADAR(39),3472,PNT_3900,TUMB,3900,-2,-1,1,Parametric amplifier (no function)", "RADAR(39),3472,PNT_3900,TUMB,3900,2,-1,1,Parametric amplifier (no function)", "FUELSYSTEM(20),3061,PNT_1044,TUMB,1044,0,0,1,Fuel Shutoff - Right", "FUELSYSTEM(20),3061,PNT_1044,TUMB,1044,1,0,1,Fuel Shutoff - Right", "DATALINK(52),3589,PNT_413,TUMB,413,1,-1,1,Datalink Power", "DATALINK(52),3589,PNT_413,TUMB,413,-1,-1,1,Datalink Power", "WEAPONS(55),3139,PNT_SW_COOL,BTN,16001,1,0,1,Sidewinder cool", "COCKPITMECHANICS(11),3181,PNT_925,TUMB,15009,0.125,0,1,Formation Light Intensity", "COCKPITMECHANICS(11),3181,PNT_925,TUMB,15009,-0.125,0,1,Formation Light Intensity", "ENGINE(19),3051,PNT_2102,TUMB,2102,-1,-1,1,Engine Crank", "ENGINE(19),3051,PNT_2102,TUMB,2102,1,-1,1,Engine Crank", "HCU(58),3098,PNT_2009,TUMB,2009,-1,0,1,HCU DDD mode", "HCU(58),3098,PNT_2009,TUMB,2009,1,0,1,HCU DDD mode", "WEAPONS(55),3132,PNT_1022,LEV,1022,1,0,1,Gun Ammunition Counter Adjustment", "RADAR(39),3463,PNT_9916,BTN,9916,1,0,1,RADAR pulse doppler single target track", "FUELSYSTEM(20),3068,PNT_1073,TUMB,1073,1,-1,1,Refuel Probe", "FUELSYSTEM(20),3068,PNT_1073,TUMB,1073,-1,-1,1,Refuel Probe", "WEAPONS(55),3152,PNT_58,TUMB,58,0.25,0,1,Elec fuse", "WEAPONS(55),3152,PNT_58,TUMB,58,-0.25,0,1,Elec fuse", "WEAPONS(55),3160,PNT_66,TUMB,66,-1,0,1,Jettison racks/weapons", "WEAPONS(55),3160,PNT_66,TUMB,66,1,0,1,Jettison racks/weapons", "FUELSYSTEM(20),3069,PNT_1050,LEV,1050,1,0,1,BINGO Fuel Level Knob", "FUELSYSTEM(20),3067,PNT_1074,TUMB,1074,-1,0,1,Fuel Dump", "FUELSYSTEM(20),3067,PNT_1074,TUMB,1074,1,0,1,Fuel Dump", "AFCS(21),3036,PNT_2108,TUMB,2108,-1,0,1,AFCS Stability Augmentation - Yaw", "AFCS(21),3036,PNT_2108,TUMB,2108,1,0,1,AFCS Stability Augmentation - Yaw", "HSD(41),3240,PNT_1043,LEV,1043,0,0,1,HSD Brightness", "RADAR(39),3455,PNT_45,BTN,45,1,0,1,RADAR 200 NM", "ICS(2),3383,PNT_2044,TUMB,2044,1,-1,1,ICS Function Selector", "ICS(2),3383,PNT_2044,TUMB,2044,-1,-1,1,ICS Function Selector", "TCS(37),3494,PNT_88,TUMB,88,-2,-1,1,TCS FOV", "TCS(37),3494,PNT_88,TUMB,88,2,-1,1,TCS FOV", "COCKPITMECHANICS(11),3171,PNT_918,TUMB,918,-1,0,1,Taxi Light", "COCKPITMECHANICS(11),3171,PNT_918,TUMB,918,1,0,1,Taxi Light", "RADAR(39),3452,PNT_42,BTN,42,1,0,1,RADAR 20 NM", "FUELSYSTEM(20),3065,PNT_1095,TUMB,1095,-1,-1,1,Fuel Feed", "FUELSYSTEM(20),3065,PNT_1095,TUMB,1095,1,-1,1,Fuel Feed", "COCKPITMECHANICS(11),3602,PNT_193,TUMB,193,0.125,0,1,Instrument Light Intensity", "COCKPITMECHANICS(11),3602,PNT_193,TUMB,193,-0.125,0,1,Instrument Light Intensity", "ICS(2),3425,PNT_115,TUMB,115,-0.5,0,1,KY-28 Radio Selector", "ICS(2),3425,PNT_115,TUMB,115,0.5,0,1,KY-28 Radio Selector", "LANTIRN(38),3677,PNT_671,BTN,671,1,0,1,LANTIRN IBIT", "NAV_INTERFACE(46),3314,PNT_1002,TUMB,1002,-1,0,1,Navigation Steer Commands: TACAN", "NAV_INTERFACE(46),3314,PNT_1002,TUMB,1002,1,0,1,Navigation Steer Commands: TACAN", "COCKPITMECHANICS(11),3192,PNT_939,TUMB,939,-1,0,1,Cabin Pressure Dump", "COCKPITMECHANICS(11),3192,PNT_939,TUMB,939,1,0,1,Cabin Pressure Dump", "RADAR(39),3447,PNT_82,LEV,82,0,-1,1,Radar azimuth center", "GEARHOOK(17),3014,PNT_1072,TUMB,1072,1,-1,1,Anti-Skid Spoiler BK Switch", "GEARHOOK(17),3014,PNT_1072,TUMB,1072,-1,-1,1,Anti-Skid Spoiler BK Switch", "RADAR(39),3467,PNT_34,TUMB,34,-1,-1,1,Aspect", "RADAR(39),3467,PNT_34,TUMB,34,1,-1,1,Aspect", "GEARHOOK(17),3633,PNT_326,TUMB,16015,1,0,1,Landing Gear Lever (RB emergency extend)", "GEARHOOK(17),3016,PNT_326,TUMB,326,1,0,1,Landing Gear Lever (RB emergency extend)", "CAP(23),3542,PNT_139,BTN,139,1,0,1,CAP 7", "ENGINE(19),3055,PNT_16005,TUMB,16005,-1,0,1,Asymmetric Thrust Limiter Cover", "ENGINE(19),3055,PNT_16005,TUMB,16005,1,0,1,Asymmetric Thrust Limiter Cover", "ICS(2),3598,PNT_380,TUMB,380,-1,0,1,V/UHF 2 ANT Switch", "ICS(2),3598,PNT_380,TUMB,380,1,0,1,V/UHF 2 ANT Switch", "ELECTRICS(14),3012,PNT_926,TUMB,926,-1,0,1,Emergency Generator Switch", "ELECTRICS(14),3012,PNT_926,TUMB,926,1,0,1,Emergency Generator Switch", "ARC159(3),3370,PNT_2026,TUMB,2026,1,1,0,UHF ARC-159 0.025MHz", "ARC159(3),3370,PNT_2026,TUMB,2026,-1,-1,0,UHF ARC-159 0.025MHz", "TACAN(47),3328,PNT_2036,LEV,2036,0,0,1,TACAN Volume", "ICS(2),3395,PNT_2040,LEV,2040,0,0,1,ALR-67 Volume", "(),3059,PNT_15083,BTN,15083,1,0,1,Fire Ext Bottle - Left", "HSD(41),3242,PNT_1040,LEV,1040,0,0,1,HSD Selected Course", "NAV_INTERFACE(46),3318,PNT_1004,TUMB,1004,-1,0,1,Navigation Steer Commands: AWL PCD", "NAV_INTERFACE(46),3318,PNT_1004,TUMB,1004,1,0,1,Navigation Steer Commands: AWL PCD", "ARC182(4),3407,PNT_351,TUMB,351,-1,0,1,VHF/UHF ARC-182 Squelch Switch", "ARC182(4),3407,PNT_351,TUMB,351,1,0,1,VHF/UHF ARC-182 Squelch Switch", "COUNTERMEASURES(5),3273,PNT_398,TUMB,398,1,-1,1,AN/ALE-37 Flare Mode", "COUNTERMEASURES(5),3273,PNT_398,TUMB,398,-1,-1,1,AN/ALE-37 Flare Mode", "AFCS(21),3034,PNT_2106,TUMB,2106,-1,0,1,AFCS Stability Augmentation - Pitch", "AFCS(21),3034,PNT_2106,TUMB,2106,1,0,1,AFCS Stability Augmentation - Pitch", "RADAR(39),3448,PNT_84,TUMB,84,1,1,0,VSL switch", "RADAR(39),3448,PNT_84,TUMB,84,-1,-1,0,VSL switch", "IFF(64),3627,PNT_198,TUMB,198,0.11111,0,0.77777,IFF M3 code -x-- (no function)", "IFF(64),3627,PNT_198,TUMB,198,-0.11111,0,0.77777,IFF M3 code -x-- (no function)", "RADAR(39),3450,PNT_40,BTN,40,1,0,1,RADAR 5 NM", "ARC159(3),3379,PNT_16010,BTN,16010,1,0,1,UHF ARC-159 Tone", "CAP(23),3539,PNT_143,BTN,143,1,0,1,CAP ALT 4", "COCKPITMECHANICS(11),3187,PNT_498,TUMB,498,0,0,1,Ejection Seat Safety", "COCKPITMECHANICS(11),3187,PNT_498,TUMB,498,1,0,1,Ejection Seat Safety", "AOASYSTEM(25),3212,PNT_917,TUMB,15006,0.125,0,1,AoA Indexer Light Intensity", "AOASYSTEM(25),3212,PNT_917,TUMB,15006,-0.125,0,1,AoA Indexer Light Intensity", "RWR(54),3259,PNT_2139,TUMB,2139,-1,0,1,AN/ALR-67 Power", "RWR(54),3259,PNT_2139,TUMB,2139,1,0,1,AN/ALR-67 Power", "ELECTRICS(14),3431,PNT_907,TUMB,907,-1,0,1,Outboard Spoiler Override", "ELECTRICS(14),3431,PNT_907,TUMB,907,1,0,1,Outboard Spoiler Override", "ICS(2),3380,PNT_2047,LEV,2048,0,0,1,ICS Volume", "WEAPONS(55),3168,PNT_64,TUMB,64,-1,0,1,Jettison station 6", "WEAPONS(55),3168,PNT_64,TUMB,64,1,0,1,Jettison station 6", "RADAR(39),3460,PNT_13,BTN,13,1,0,1,RADAR range while scan", "COUNTERMEASURES(5),3267,PNT_390,TUMB,390,1,-1,1,AN/ALE-37 Power/Mode", "COUNTERMEASURES(5),3267,PNT_390,TUMB,390,-1,-1,1,AN/ALE-37 Power/Mode", "TACAN(47),3332,PNT_TACAN_LEVER_PILOT,TUMB,8889,0.11111111111111,0,1,TACAN Channel Lever (Ones)", "TACAN(47),3332,PNT_TACAN_LEVER_PILOT,TUMB,8889,-0.11111111111111,0,1,TACAN Channel Lever (Ones)",
-        "COUNTERMEASURES(5),3308,PNT_210,TUMB,210,0.25,0,1,AN/ALE-37 Flare Interval", "COUNTERMEASURES(5),3308,PNT_210,TUMB,210,-0.25,0,1,AN/ALE-37 Flare Interval", "HUD(40),3218,PNT_1013,TUMB,1013,-1,0,1,HUD Air-to-Air Mode", "HUD(40),3218,PNT_1013,TUMB,1013,1,0,1,HUD Air-to-Air Mode", "TACAN(47),3340,PNT_375,LEV,375,0,0,1,TACAN Volume", "RADAR(39),3632,PNT_2014,BTN,2014,1,0,1,Light test", "ARC159(3),3353,PNT_406,LEV,406,1,0,1,UHF Radio Remote Display Brightness", "ICS(2),3389,PNT_401,TUMB,401,0.5,0,1,ICS Amplifier Selector", "ICS(2),3389,PNT_401,TUMB,401,-0.5,0,1,ICS Amplifier Selector", "ILS(48),3321,PNT_911,BTN,911,1,0,1,AN/ARA-63 BIT Button", "WEAPONS(55),3140,PNT_MSL_PREP,BTN,16002,1,0,1,Missile prepare", "CAP(23),3536,PNT_137,BTN,137,1,0,1,CAP LAT 1", "DATALINK(52),3591,PNT_176,TUMB,176,-1,0,1,Datalink Reply (no function)", "DATALINK(52),3591,PNT_176,TUMB,176,1,0,1,Datalink Reply (no function)", "HUD(40),3227,PNT_1020,TUMB,1020,-1,0,1,HUD AWL Mode", "HUD(40),3227,PNT_1020,TUMB,1020,1,0,1,HUD AWL Mode", "ELECTRICS(14),3429,PNT_903,TUMB,903,-1,0,1,Outboard Spoiler Override Cover", "ELECTRICS(14),3429,PNT_903,TUMB,903,1,0,1,Outboard Spoiler Override Cover", "ARC182(4),3412,PNT_357,TUMB,357,1,1,0,VHF/UHF ARC-182 0.025MHz", "ARC182(4),3412,PNT_357,TUMB,357,-1,-1,0,VHF/UHF ARC-182 0.025MHz", "ICS(2),3427,PNT_361,BTN,361,1,0,1,KY-28 ZEROIZE", "IFF(64),3618,PNT_166,TUMB,166,-1,-1,1,IFF RAD (no function)", "IFF(64),3618,PNT_166,TUMB,166,1,-1,1,IFF RAD (no function)", "ICS(2),3390,PNT_402,TUMB,402,1,-1,1,ICS Function Selector", "ICS(2),3390,PNT_402,TUMB,402,-1,-1,1,ICS Function Selector", "TACAN(47),3342,PNT_TACAN_OUTER_TWIST_RIO,TUMB,8891,0.083333333333333,0,1,TACAN Channel Wheel (Tens)", "TACAN(47),3342,PNT_TACAN_OUTER_TWIST_RIO,TUMB,8891,-0.083333333333333,0,1,TACAN Channel Wheel (Tens)", "WEAPONS(55),3157,PNT_60,TUMB,60,-1,0,1,Bomb single/pairs", "WEAPONS(55),3157,PNT_60,TUMB,60,1,0,1,Bomb single/pairs", "ECMD(44),3245,PNT_2023,LEV,2023,0,0,1,ECMD Brightness", "WEAPONS(55),3170,PNT_71,TUMB,71,-1,-1,1,Jettison station 8", "WEAPONS(55),3170,PNT_71,TUMB,71,1,-1,1,Jettison station 8", "AHRS(51),3438,PNT_909,LEV,909,0,0,1,Compass LAT Correction", "ARC182(4),3415,PNT_352,TUMB,352,0.0833333333,0,0.9166666663,VHF/UHF ARC-182 Preset Channel Selector", "ARC182(4),3415,PNT_352,TUMB,352,-0.0833333333,0,0.9166666663,VHF/UHF ARC-182 Preset Channel Selector", "ARC182(4),3358,VHF_BIT_TEST,BTN,15003,1,0,1,VHF/UHF Radio Remote Display Test", "TID(43),3118,PNT_1115,BTN,1115,1,0,1,TID Alt num", "COUNTERMEASURES(5),3279,PNT_399,LEV,399,1,0,1,AN/ALE-37 Jammer Counter", "ARC159(3),3352,UHF_BIT_TEST,BTN,15004,1,0,1,UHF Radio Remote Display Test", "COCKPITMECHANICS(11),3180,PNT_922,TUMB,15008,0.125,0,1,Console Light Intensity", "COCKPITMECHANICS(11),3180,PNT_922,TUMB,15008,-0.125,0,1,Console Light Intensity", "TID(43),3113,PNT_2006,TUMB,2006,0.5,-1,1,TID Range", "TID(43),3113,PNT_2006,TUMB,2006,-0.5,-1,1,TID Range", "COUNTERMEASURES(5),3272,PNT_391,BTN,391,1,0,1,AN/ALE-37 Flare Salvo", "VDI(42),3231,PNT_1038,LEV,1038,1,0,1,VDI Screen Contrast", "RADAR(39),3483,PNT_30,LEV,30,0.5,0,1,PD threshold clear (no function)", "ELECTRICS(14),3428,PNT_902,TUMB,902,-1,0,1,Inboard Spoiler Override Cover", "ELECTRICS(14),3428,PNT_902,TUMB,902,1,0,1,Inboard Spoiler Override Cover", "TID(43),3119,PNT_2004,BTN,2004,1,0,1,TID Reject Image Device disable (no function)", "ENGINE(19),3052,PNT_16007,TUMB,16007,-1,0,1,Left Engine Mode", "ENGINE(19),3052,PNT_16007,TUMB,16007,1,0,1,Left Engine Mode", "IFF(64),3620,PNT_181,TUMB,181,-1,0,1,IFF M4 (no function)", "IFF(64),3620,PNT_181,TUMB,181,1,0,1,IFF M4 (no function)", "COUNTERMEASURES(5),3291,PNT_212,TUMB,212,0.11111111111111,0,1,AN/ALE-37 Jammer Interval Tens", "COUNTERMEASURES(5),3291,PNT_212,TUMB,212,-0.11111111111111,0,1,AN/ALE-37 Jammer Interval Tens", "ARC182(4),3356,PNT_1030,LEV,1030,1,0,1,VHF/UHF Radio Remote Display Brightness", "DATALINK(52),3678,PNT_96,TUMB,96,1,-1,1,Beacon Power", "DATALINK(52),3678,PNT_96,TUMB,96,-1,-1,1,Beacon Power", "TID(43),3124,PNT_48,LEV,48,1,0,1,TID Brightness", "WEAPONS(55),3167,PNT_70,TUMB,70,-1,0,1,Jettison station 5", "WEAPONS(55),3167,PNT_70,TUMB,70,1,0,1,Jettison station 5", "HUD(40),3220,PNT_1011,TUMB,1011,-1,0,1,HUD Landing Mode", "HUD(40),3220,PNT_1011,TUMB,1011,1,0,1,HUD Landing Mode", "ICS(2),3597,PNT_382,TUMB,382,1,-1,1,KY MODE Switch", "ICS(2),3597,PNT_382,TUMB,382,-1,-1,1,KY MODE Switch", "HUD(40),3216,PNT_1015,TUMB,1015,-1,0,1,HUD Take-Off Mode", "HUD(40),3216,PNT_1015,TUMB,1015,1,0,1,HUD Take-Off Mode", "ENGINE(19),3129,PNT_THROT_R,TUMB,12301,-1,0,1,Right Engine Fuel Cutoff", "ENGINE(19),3129,PNT_THROT_R,TUMB,12301,1,0,1,Right Engine Fuel Cutoff", "RWR(54),3261,PNT_2140,TUMB,2140,1,1,0,AN/ALR-67 Test", "RWR(54),3261,PNT_2140,TUMB,2140,-1,-1,0,AN/ALR-67 Test", "COUNTERMEASURES(5),3281,PNT_206,TUMB,206,0.5,0,1,AN/ALE-37 L10 Load Type", "COUNTERMEASURES(5),3281,PNT_206,TUMB,206,-0.5,0,1,AN/ALE-37 L10 Load Type", "ENGINE(19),3054,PNT_16006,TUMB,16006,-1,0,1,Asymmetric Thrust Limiter", "ENGINE(19),3054,PNT_16006,TUMB,16006,1,0,1,Asymmetric Thrust Limiter", "BAROALTIMETER(28),3486,PNT_306,LEV,306,0,0,1,Altimeter Pressure Setting", "HYDRAULICS(12),3003,PNT_928,TUMB,928,-1,-1,1,Hydraulic Emergency Flight Control Switch", "HYDRAULICS(12),3003,PNT_928,TUMB,928,1,-1,1,Hydraulic Emergency Flight Control Switch", "TACAN(47),3347,PNT_373,TUMB,373,-1,0,1,TACAN Mode Normal/Inverse", "TACAN(47),3347,PNT_373,TUMB,373,1,0,1,TACAN Mode Normal/Inverse"],
-    "FA-18C": ["ELEC_INTERFACE(3),3018,pnt_382,TUMB,382,0,0,1,CB FCS CHAN 2, ON/OFF", "ELEC_INTERFACE(3),3018,pnt_382,TUMB,382,1,0,1,CB FCS CHAN 2, ON/OFF", "SMS(23),3005,pnt_153,TUMB,153,-1,0,1,Station Jettison Select Button, CENTER", "SMS(23),3005,pnt_153,TUMB,153,1,0,1,Station Jettison Select Button, CENTER", "CONTROL_INTERFACE(2),3002,pnt_346,BTN,346,1,0,1,T/O TRIM Button", "TGP_INTERFACE(62),3001,pnt_439,TUMB,439,1,-1,1,FLIR Switch, ON/STBY/OFF", "TGP_INTERFACE(62),3001,pnt_439,TUMB,439,-1,-1,1,FLIR Switch, ON/STBY/OFF", "ECS_INTERFACE(11),3001,pnt_411,TUMB,411,0.1,0,0.3,Bleed Air Knob, R OFF/NORM/L OFF/OFF", "ECS_INTERFACE(11),3001,pnt_411,TUMB,411,-0.1,0,0.3,Bleed Air Knob, R OFF/NORM/L OFF/OFF", "HUD(34),3006,pnt_145,LEV,145,0,0,1,Balance Control Knob", "ENGINES_INTERFACE(12),3009,pnt_30,TUMB,30,-1,0,1,APU Fire Warning/Extinguisher Light", "ENGINES_INTERFACE(12),3009,pnt_30,TUMB,30,1,0,1,APU Fire Warning/Extinguisher Light", "EXT_LIGHTS(8),3004,pnt_237,TUMB,237,-1,0,1,LDG/TAXI LIGHT Switch, ON/OFF", "EXT_LIGHTS(8),3004,pnt_237,TUMB,237,1,0,1,LDG/TAXI LIGHT Switch, ON/OFF", "MDI_LEFT(35),3016,pnt_59,BTN,59,1,0,1,Left MDI PB 6", "HYDRAULIC_INTERFACE(4),3001,pnt_369,TUMB,369,-1,0,1,Hydraulic Isolate Override Switch, NORM/ORIDE", "HYDRAULIC_INTERFACE(4),3001,pnt_369,TUMB,369,1,0,1,Hydraulic Isolate Override Switch, NORM/ORIDE", "UFC(25),3021,pnt_113,BTN,113,1,0,1,UFC Keyboard Pushbutton, 3", "AMPCD(37),3009,pnt_180_1,BTN,180,-1,-1,0,AMPCD Gain Control Switch, DOWN", "AMPCD(37),3020,pnt_192,BTN,192,1,0,1,AMPCD PB 10", "AMPCD(37),3003,pnt_177_1,BTN,177,-1,-1,0,AMPCD Night/Day Brightness Selector, NGT", "AMPCD(37),3006,pnt_182_2,BTN,182,1,0,1,AMPCD Contrast Control Switch, UP", "AMPCD(37),3021,pnt_193,BTN,193,1,0,1,AMPCD PB 11", "MDI_LEFT(35),3017,pnt_60,BTN,60,1,0,1,Left MDI PB 7", "MDI_LEFT(35),3006,pnt_313,BTN,313,1,0,1,Course Set Switch", "MDI_LEFT(35),3007,pnt_313,BTN,313,-1,-1,0,Course Set Switch", "MDI_LEFT(35),3026,pnt_69,BTN,69,1,0,1,Left MDI PB 16", "AMPCD(37),3025,pnt_197,BTN,197,1,0,1,AMPCD PB 15", "RWR(53),3006,pnt_263,LEV,263,0,0,1,ALR-67 DMR Control Knob", "IFEI(33),3002,pnt_169,BTN,169,1,0,1,IFEI QTY Button", "OXYGEN_INTERFACE(10),3002,pnt_366,LEV,366,1,0,1,OXY Flow Knob", "CPT_LIGTHS(9),3008,pnt_14,BTN,14,1,0,1,MASTER CAUTION Reset Button - Press to reset", "UFC(25),3003,pnt_130,BTN,130,1,0,1,UFC Function Selector Pushbutton, TCN", "SMS(23),3007,pnt_157,TUMB,157,-1,0,1,Station Jettison Select Button, LEFT OUT", "SMS(23),3007,pnt_157,TUMB,157,1,0,1,Station Jettison Select Button, LEFT OUT", "GEAR_INTERFACE(5),3008,pnt_233,BTN,233,1,0,1,Launch Bar Control Switch, EXTEND/RETRACT", "GEAR_INTERFACE(5),3008,pnt_233,BTN,233,1,0,1,Launch Bar Control Switch, EXTEND/RETRACT", "UFC(25),3004,pnt_131,BTN,131,1,0,1,UFC Function Selector Pushbutton, ILS", "UFC(25),3005,pnt_132,BTN,132,1,0,1,UFC Function Selector Pushbutton, D/L", "UFC(25),3010,pnt_100,BTN,100,1,0,1,UFC Option Select Pushbutton 1", "ELEC_INTERFACE(3),3002,pnt_402,TUMB,402,-1,0,1,Left Generator Control Switch, NORM/OFF", "ELEC_INTERFACE(3),3002,pnt_402,TUMB,402,1,0,1,Left Generator Control Switch, NORM/OFF", "UFC(25),3015,pnt_99,BTN,99,1,0,1,UFC I/P Pushbutton", "ID2163A(30),3002,pnt_291,LEV,291,1,0,1,Push to Test Switch, (LMB) activate BIT checks/(MW) rotate clockwise to apply power and set low altitude index pointer", "ID2163A(30),3001,pnt_291,BTN,292,1,0,1,Push to Test Switch, (LMB) activate BIT checks/(MW) rotate clockwise to apply power and set low altitude index pointer", "UFC(25),3024,pnt_116,BTN,116,1,0,1,UFC Keyboard Pushbutton, 6", "ECS_INTERFACE(11),3002,pnt_412,BTN,412,1,0,1,Bleed Air Knob, AUG PULL", "MDI_RIGHT(36),3024,pnt_92,BTN,92,1,0,1,Right MDI PB 14", "HUD(34),3009,pnt_148,TUMB,148,1,-1,1,Attitude Selector Switch, INS/AUTO/STBY", "HUD(34),3009,pnt_148,TUMB,148,-1,-1,1,Attitude Selector Switch, INS/AUTO/STBY", "KY58(41),3001,pnt_444,TUMB,444,0.1,0,0.3,KY-58 Mode Select Knob, P/C/LD/RV", "KY58(41),3001,pnt_444,TUMB,444,-0.1,0,0.3,KY-58 Mode Select Knob, P/C/LD/RV", "CPT_LIGTHS(9),3006,pnt_417,LEV,417,0,0,1,WARN/CAUTION Dimmer Control", "ENGINES_INTERFACE(12),3003,pnt_377,BTN,377,1,0,1,Engine Crank Switch, LEFT/OFF/RIGHT", "ENGINES_INTERFACE(12),3002,pnt_377,BTN,377,-1,-1,0,Engine Crank Switch, LEFT/OFF/RIGHT", "CONTROL_INTERFACE(2),3012,pnt_504,LEV,504,0,0,1,Throttles Friction Adjusting Lever", "RADAR(42),3002,pnt_440,LEV,0,1,0,1,RADAR Switch (MW to pull), OFF/STBY/OPR/EMERG(PULL)", "RADAR(42),3001,pnt_440,TUMB,440,0.1,0,0.3,RADAR Switch (MW to pull), OFF/STBY/OPR/EMERG(PULL)", "RADAR(42),3001,pnt_440,TUMB,440,-0.1,0,0.3,RADAR Switch (MW to pull), OFF/STBY/OPR/EMERG(PULL)", "CONTROL_INTERFACE(2),3006,pnt_347,TUMB,347,-1,0,1,GAIN Switch, NORM/ORIDE", "CONTROL_INTERFACE(2),3006,pnt_347,TUMB,347,1,0,1,GAIN Switch, NORM/ORIDE", "UFC(25),3032,pnt_109,LEV,109,0,0,1,UFC Brightness Control Knob", "HOTAS(13),3041,pnt_494,TUMB,494,-1,0,1,Exterior Lights Switch, ON/OFF", "HOTAS(13),3041,pnt_494,TUMB,494,1,0,1,Exterior Lights Switch, ON/OFF", "(0),3107,pnt_07,BTN,7,1,0,1,HUD Video BIT Initiate Pushbutton - Push to initiate BIT", "UFC(25),3027,pnt_119,BTN,119,1,0,1,UFC Keyboard Pushbutton, 9", "AMPCD(37),3017,pnt_189,BTN,189,1,0,1,AMPCD PB 7", "INTERCOM(40),3004,pnt_359,LEV,359,0,0,1,RWR Volume Control Knob", "INTERCOM(40),3005,pnt_360,LEV,360,0,0,1,WPN Volume Control Knob", "AMPCD(37),3002,pnt_177_2,BTN,177,1,0,1,AMPCD Night/Day Brightness Selector, DAY", "CPT_LIGTHS(9),3009,pnt_239,BTN,239,1,0,1,HOOK BYPASS Switch, FIELD/CARRIER", "CPT_LIGTHS(9),3009,pnt_239,BTN,239,1,0,1,HOOK BYPASS Switch, FIELD/CARRIER", "INTERCOM(40),3009,pnt_364,LEV,364,0,0,1,AUX Volume Control Knob", "MDI_LEFT(35),3002,pnt_52,LEV,52,0,0,1,Left MDI Brightness Control Knob", "OXYGEN_INTERFACE(10),3001,pnt_365,TUMB,365,-1,0,1,OBOGS Control Switch, ON/OFF", "OXYGEN_INTERFACE(10),3001,pnt_365,TUMB,365,1,0,1,OBOGS Control Switch, ON/OFF", "UFC(25),3012,pnt_102,BTN,102,1,0,1,UFC Option Select Pushbutton 3", "MDI_RIGHT(36),3021,pnt_89,BTN,89,1,0,1,Right MDI PB 11", "SMS(23),3008,pnt_159,TUMB,159,-1,0,1,Station Jettison Select Button, RIGHT IN", "SMS(23),3008,pnt_159,TUMB,159,1,0,1,Station Jettison Select Button, RIGHT IN", "AMPCD(37),3008,pnt_180_2,BTN,180,1,0,1,AMPCD Gain Control Switch, UP", "INTERCOM(40),3013,pnt_355,TUMB,355,1,-1,1,IFF Mode 4 Switch, DIS/AUD /DIS/OFF", "INTERCOM(40),3013,pnt_355,TUMB,355,-1,-1,1,IFF Mode 4 Switch, DIS/AUD /DIS/OFF", "INTERCOM(40),3015,pnt_354,BTN,354,1,0,1,CRYPTO Switch, HOLD/NORM/ZERO", "INTERCOM(40),3014,pnt_354,BTN,354,-1,-1,0,CRYPTO Switch, HOLD/NORM/ZERO", "EXT_LIGHTS(8),3003,pnt_339,TUMB,339,1,-1,1,STROBE Lights Switch, BRT/OFF/DIM", "EXT_LIGHTS(8),3003,pnt_339,TUMB,339,-1,-1,1,STROBE Lights Switch, BRT/OFF/DIM", "MDI_LEFT(35),3028,pnt_72,BTN,72,1,0,1,Left MDI PB 18", "UFC(25),3020,pnt_112,BTN,112,1,0,1,UFC Keyboard Pushbutton, 2", "UFC(25),3002,pnt_129,BTN,129,1,0,1,UFC Function Selector Pushbutton, IFF", "ECS_INTERFACE(11),3009,pnt_452,TUMB,452,1,-1,1,Windshield Anti-Ice/Rain Switch, ANTI ICE/OFF/RAIN", "ECS_INTERFACE(11),3009,pnt_452,TUMB,452,-1,-1,1,Windshield Anti-Ice/Rain Switch, ANTI ICE/OFF/RAIN", "KY58(41),3005,pnt_445,LEV,445,0,0,1,KY-58 Volume Control Knob", "ELEC_INTERFACE(3),3003,pnt_403,TUMB,403,-1,0,1,Right Generator Control Switch, NORM/OFF", "ELEC_INTERFACE(3),3003,pnt_403,TUMB,403,1,0,1,Right Generator Control Switch, NORM/OFF", "ENGINES_INTERFACE(12),3012,pnt_11,TUMB,12,1,0,1,Left Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control", "ENGINES_INTERFACE(12),3010,pnt_11,TUMB,11,1,0,1,Left Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control", "CPT_LIGTHS(9),3003,pnt_415,LEV,415,0,0,1,FLOOD Light Dimmer Control", "MDI_RIGHT(36),3029,pnt_97,BTN,97,1,0,1,Right MDI PB 19", "KY58(41),3002,pnt_446,TUMB,446,0.1,0,0.7,KY-58 Fill Select Knob, Z 1-5/1/2/3/4/5/6/Z ALL", "KY58(41),3002,pnt_446,TUMB,446,-0.1,0,0.7,KY-58 Fill Select Knob, Z 1-5/1/2/3/4/5/6/Z ALL", "KY58(41),3004,pnt_447,TUMB,447,0.1,0,0.2,KY-58 Power Select Knob, OFF/ON/TD", "KY58(41),3004,pnt_447,TUMB,447,-0.1,0,0.2,KY-58 Power Select Knob, OFF/ON/TD", "INTERCOM(40),3018,pnt_230,BTN,230,1,0,1,Warning Tone Silence Button - Push to silence", "ANTENNA_SELECTOR(50),3002,pnt_374,TUMB,374,1,-1,1,IFF Antenna Selector Switch, UPPER/BOTH/LOWER", "ANTENNA_SELECTOR(50),3002,pnt_374,TUMB,374,-1,-1,1,IFF Antenna Selector Switch, UPPER/BOTH/LOWER", "MDI_RIGHT(36),3003,pnt_78,LEV,78,0,0,1,Right MDI Contrast Control Knob", "RWR(53),3002,pnt_275,BTN,275,1,0,1,ALR-67 DISPLAY Pushbutton", "MDI_RIGHT(36),3026,pnt_94,BTN,94,1,0,1,Right MDI PB 16", "RWR(53),3003,pnt_272,BTN,272,1,0,1,ALR-67 SPECIAL Pushbutton", "AAU52(26),3001,pnt_224,LEV,224,0.04,0,1,AAU-52 Altimeter Pressure Setting Knob", "(0),3130,pnt_262,LEV,262,0,0,1,ALR-67 AUDIO Control Knob (no function)", "INTERCOM(40),3016,pnt_353,TUMB,353,-1,0,1,ILS UFC/MAN Switch, UFC/MAN", "INTERCOM(40),3016,pnt_353,TUMB,353,1,0,1,ILS UFC/MAN Switch, UFC/MAN", "TGP_INTERFACE(62),3004,pnt_442,TUMB,442,-1,0,1,LST/NFLR Switch, ON/OFF", "TGP_INTERFACE(62),3004,pnt_442,TUMB,442,1,0,1,LST/NFLR Switch, ON/OFF", "MDI_RIGHT(36),3013,pnt_81,BTN,81,1,0,1,Right MDI PB 3", "(0),3116,pnt_248,TUMB,248,0.1,0,0.4,ECM Mode Switch, XMIT/REC/BIT/STBY/OFF", "(0),3116,pnt_248,TUMB,248,-0.1,0,0.4,ECM Mode Switch, XMIT/REC/BIT/STBY/OFF", "(0),3100,pnt_507,TUMB,507,-1,0,1,NUC WPN Switch, ENABLE/DISABLE (no function)", "(0),3100,pnt_507,TUMB,507,1,0,1,NUC WPN Switch, ENABLE/DISABLE (no function)", "CPT_MECHANICS(7),3001,pnt_453,BTN,453,1,0,1,Canopy Control Switch, OPEN/HOLD/CLOSE", "CPT_MECHANICS(7),3002,pnt_453,BTN,453,-1,-1,0,Canopy Control Switch, OPEN/HOLD/CLOSE", "(0),3104,pnt_175,TUMB,175,1,-1,1,Selector Switch, HMD/LDDI/RDDI", "(0),3104,pnt_175,TUMB,175,-1,-1,1,Selector Switch, HMD/LDDI/RDDI", "UFC(25),3033,pnt_124,LEV,124,1,0,1,UFC COMM 1 Channel Selector Knob", "UFC(25),3008,pnt_124,BTN,125,1,0,1,UFC COMM 1 Channel Selector Knob", "EXT_LIGHTS(8),3001,pnt_338,LEV,338,0,0,1,POSITION Lights Dimmer Control",
-        "GEAR_INTERFACE(5),3005,pnt_240,LEV,240,1,0,1,Emergency/Parking Brake Handle, (LMB)Rotate Left/(RMB)Rotate Right/(MW)Pull-Stow", "GEAR_INTERFACE(5),3007,pnt_240,TUMB,241,-0.666,0,0.999,Emergency/Parking Brake Handle, (LMB)Rotate Left/(RMB)Rotate Right/(MW)Pull-Stow", "GEAR_INTERFACE(5),3006,pnt_240,BTN,241,0.333,0,0.999,Emergency/Parking Brake Handle, (LMB)Rotate Left/(RMB)Rotate Right/(MW)Pull-Stow", "(0),3002,pnt_497,TUMB,0,-1,0,1,Toggle Mirrors", "(0),3002,pnt_497,TUMB,0,1,0,1,Toggle Mirrors", "ELEC_INTERFACE(3),3017,pnt_381,TUMB,381,0,0,1,CB FCS CHAN 1, ON/OFF", "ELEC_INTERFACE(3),3017,pnt_381,TUMB,381,1,0,1,CB FCS CHAN 1, ON/OFF", "ELEC_INTERFACE(3),3010,pnt_333,BTN,333,1,0,1,Ground Power Switch 2, A ON/AUTO/B ON", "ELEC_INTERFACE(3),3011,pnt_333,BTN,333,-1,-1,0,Ground Power Switch 2, A ON/AUTO/B ON", "MDI_RIGHT(36),3022,pnt_90,BTN,90,1,0,1,Right MDI PB 12", "CPT_MECHANICS(7),3004,pnt_43,BTN,43,1,0,1,Canopy Jettison Handle Unlock Button - Press to unlock", "CONTROL_INTERFACE(2),3007,pnt_234,TUMB,234,1,-1,1,FLAP Switch, AUTO/HALF/FULL", "CONTROL_INTERFACE(2),3007,pnt_234,TUMB,234,-1,-1,1,FLAP Switch, AUTO/HALF/FULL", "ECS_INTERFACE(11),3005,pnt_451,LEV,451,0,-1,1,Defog Handle", "MDI_LEFT(35),3024,pnt_67,BTN,67,1,0,1,Left MDI PB 14", "MDI_LEFT(35),3013,pnt_56,BTN,56,1,0,1,Left MDI PB 3", "AMPCD(37),3030,pnt_202,BTN,202,1,0,1,AMPCD PB 20", "CPT_MECHANICS(7),3008,pnt_510,BTN,510,1,0,1,Ejection Control Handle (3 times)", "AMPCD(37),3018,pnt_190,BTN,190,1,0,1,AMPCD PB 8", "HUD(34),3005,pnt_144,TUMB,144,0.1,0,0.2,HUD Video Control Switch, W/B /VID/OFF", "HUD(34),3005,pnt_144,TUMB,144,-0.1,0,0.2,HUD Video Control Switch, W/B /VID/OFF", "CPT_LIGTHS(9),3007,pnt_416,BTN,416,1,0,1,Lights Test Switch, TEST/OFF", "CPT_LIGTHS(9),3007,pnt_416,BTN,416,1,0,1,Lights Test Switch, TEST/OFF", "CMDS(54),3002,pnt_380,BTN,380,1,0,1,Dispense Button - Push to dispense flares and chaff", "FUEL_INTERFACE(6),3002,pnt_341,TUMB,341,1,-1,1,Probe Control Switch, EXTEND/RETRACT/EMERG EXTD", "FUEL_INTERFACE(6),3002,pnt_341,TUMB,341,-1,-1,1,Probe Control Switch, EXTEND/RETRACT/EMERG EXTD", "CPT_LIGTHS(9),3004,pnt_419,TUMB,419,1,-1,1,MODE Switch, NVG/NITE/DAY", "CPT_LIGTHS(9),3004,pnt_419,TUMB,419,-1,-1,1,MODE Switch, NVG/NITE/DAY", "AMPCD(37),3014,pnt_186,BTN,186,1,0,1,AMPCD PB 4", "INTERCOM(40),3002,pnt_357,LEV,357,0,0,1,VOX Volume Control Knob", "MDI_RIGHT(36),3025,pnt_93,BTN,93,1,0,1,Right MDI PB 15", "UFC(25),3016,pnt_107,TUMB,107,1,-1,1,UFC ADF Function Select Switch, 1/OFF/2", "UFC(25),3016,pnt_107,TUMB,107,-1,-1,1,UFC ADF Function Select Switch, 1/OFF/2", "MDI_LEFT(35),3018,pnt_61,BTN,61,1,0,1,Left MDI PB 8", "AMPCD(37),3007,pnt_182_1,BTN,182,-1,-1,0,AMPCD Contrast Control Switch, DOWN", "MDI_RIGHT(36),3016,pnt_84,BTN,84,1,0,1,Right MDI PB 6", "UFC(25),3028,pnt_47_121,BTN,121,1,0,1,UFC Keyboard Pushbutton, CLR", "ECS_INTERFACE(11),3003,pnt_405,TUMB,405,1,-1,1,ECS Mode Switch, AUTO/MAN/ OFF/RAM", "ECS_INTERFACE(11),3003,pnt_405,TUMB,405,-1,-1,1,ECS Mode Switch, AUTO/MAN/ OFF/RAM", "AMPCD(37),3015,pnt_187,BTN,187,1,0,1,AMPCD PB 5", "UFC(25),3017,pnt_110,BTN,110,1,0,1,UFC Emission Control Pushbutton", "UFC(25),3014,pnt_106,BTN,106,1,0,1,UFC Option Select Pushbutton 5", "AMPCD(37),3023,pnt_195,BTN,195,1,0,1,AMPCD PB 13", "INTERCOM(40),3012,pnt_356,TUMB,356,-1,0,1,IFF Master Switch, EMER/NORM", "INTERCOM(40),3012,pnt_356,TUMB,356,1,0,1,IFF Master Switch, EMER/NORM", "HUD(34),3003,pnt_142,TUMB,142,-1,0,1,HUD Symbology Brightness Selector Knob, DAY/NIGHT", "HUD(34),3003,pnt_142,TUMB,142,1,0,1,HUD Symbology Brightness Selector Knob, DAY/NIGHT", "UFC(25),3022,pnt_114,BTN,114,1,0,1,UFC Keyboard Pushbutton, 4", "MDI_LEFT(35),3001,pnt_51,TUMB,51,0.1,0,0.2,Left MDI Brightness Selector Knob, OFF/NIGHT/DAY", "MDI_LEFT(35),3001,pnt_51,TUMB,51,-0.1,0,0.2,Left MDI Brightness Selector Knob, OFF/NIGHT/DAY", "ECS_INTERFACE(11),3008,pnt_297,BTN,297,1,0,1,AV COOL Switch, NORM/EMERG", "ECS_INTERFACE(11),3008,pnt_297,BTN,297,1,0,1,AV COOL Switch, NORM/EMERG", "ELEC_INTERFACE(3),3001,pnt_404,TUMB,404,1,-1,1,Battery Switch, ON/OFF/ORIDE", "ELEC_INTERFACE(3),3001,pnt_404,TUMB,404,-1,-1,1,Battery Switch, ON/OFF/ORIDE", "MDI_RIGHT(36),3019,pnt_87,BTN,87,1,0,1,Right MDI PB 9", "CPT_MECHANICS(7),3011,pnt_514,BTN,514,1,0,1,Seat Height Adjustment Switch, UP/HOLD/DOWN", "CPT_MECHANICS(7),3010,pnt_514,BTN,514,-1,-1,0,Seat Height Adjustment Switch, UP/HOLD/DOWN", "ELEC_INTERFACE(3),3023,pnt_456,TUMB,456,0,0,1,CB HOOK, ON/OFF", "ELEC_INTERFACE(3),3023,pnt_456,TUMB,456,1,0,1,CB HOOK, ON/OFF", "UFC(25),3018,pnt_120,BTN,120,1,0,1,UFC Keyboard Pushbutton, 0", "ELEC_INTERFACE(3),3025,pnt_368,BTN,368,1,0,1,MC Switch, 1 OFF/NORM/2 OFF", "ELEC_INTERFACE(3),3026,pnt_368,BTN,368,-1,-1,0,MC Switch, 1 OFF/NORM/2 OFF", "SMS(23),3002,pnt_459,BTN,459,1,0,1,Master Mode Button, A/G", "ELEC_INTERFACE(3),3022,pnt_455,TUMB,455,0,0,1,CB FCS CHAN 4, ON/OFF", "ELEC_INTERFACE(3),3022,pnt_455,TUMB,455,1,0,1,CB FCS CHAN 4, ON/OFF", "UFC(25),3034,pnt_126,LEV,126,1,0,1,UFC COMM 2 Channel Selector Knob", "UFC(25),3009,pnt_126,BTN,127,1,0,1,UFC COMM 2 Channel Selector Knob", "ENGINES_INTERFACE(12),3013,pnt_27,TUMB,28,1,0,1,Right Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control", "ENGINES_INTERFACE(12),3011,pnt_27,TUMB,27,1,0,1,Right Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control", "AMPCD(37),3005,pnt_179_1,BTN,179,-1,-1,0,AMPCD Symbology Control Switch, DOWN", "MDI_LEFT(35),3014,pnt_57,BTN,57,1,0,1,Left MDI PB 4", "MDI_RIGHT(36),3002,pnt_77,LEV,77,0,0,1,Right MDI Brightness Control Knob", "ECS_INTERFACE(11),3011,pnt_506,LEV,506,0,0,1,Right Louver", "HUD(34),3008,pnt_147,TUMB,147,-1,0,1,Altitude Switch, BARO/RDR", "HUD(34),3008,pnt_147,TUMB,147,1,0,1,Altitude Switch, BARO/RDR", "CONTROL_INTERFACE(2),3004,pnt_470,BTN,470,1,0,1,FCS BIT Switch", "CONTROL_INTERFACE(2),3004,pnt_470,BTN,470,1,0,1,FCS BIT Switch", "CONTROL_INTERFACE(2),3001,pnt_345,LEV,345,0,-1,1,RUD TRIM Control", "CMDS(54),3003,pnt_515,TUMB,515,-1,0,1,ECM JETT JETT SEL Button - Push to jettison", "CMDS(54),3003,pnt_515,TUMB,515,1,0,1,ECM JETT JETT SEL Button - Push to jettison", "ELEC_INTERFACE(3),3021,pnt_454,TUMB,454,0,0,1,CB FCS CHAN 3, ON/OFF", "ELEC_INTERFACE(3),3021,pnt_454,TUMB,454,1,0,1,CB FCS CHAN 3, ON/OFF", "UFC(25),3025,pnt_117,BTN,117,1,0,1,UFC Keyboard Pushbutton, 7", "CONTROL_INTERFACE(2),3003,pnt_349,BTN,349,1,0,1,FCS RESET Button", "ENGINES_INTERFACE(12),3001,pnt_375,BTN,375,1,0,1,APU Control Switch, ON/OFF", "ENGINES_INTERFACE(12),3001,pnt_375,BTN,375,1,0,1,APU Control Switch, ON/OFF", "CPT_MECHANICS(7),3007,pnt_512,TUMB,512,-1,0,1,Ejection Seat Manual Override Handle, PULL/PUSH", "CPT_MECHANICS(7),3007,pnt_512,TUMB,512,1,0,1,Ejection Seat Manual Override Handle, PULL/PUSH", "FUEL_INTERFACE(6),3005,pnt_342,TUMB,342,1,-1,1,External Wing Tanks Fuel Control Switch, STOP/NORM/ORIDE", "FUEL_INTERFACE(6),3005,pnt_342,TUMB,342,-1,-1,1,External Wing Tanks Fuel Control Switch, STOP/NORM/ORIDE", "UFC(25),3011,pnt_101,BTN,101,1,0,1,UFC Option Select Pushbutton 2", "AMPCD(37),3001,pnt_203,LEV,203,0,0,1,AMPCD Off/Brightness Control Knob", "SMS(23),3004,pnt_50,BTN,50,1,0,1,Emergency Jettison Button", "SMS(23),3003,pnt_49,TUMB,49,-1,0,1,Master Arm Switch, ARM/SAFE", "SMS(23),3003,pnt_49,TUMB,49,1,0,1,Master Arm Switch, ARM/SAFE", "ELEC_INTERFACE(3),3024,pnt_457,TUMB,457,0,0,1,CB LG, ON/OFF", "ELEC_INTERFACE(3),3024,pnt_457,TUMB,457,1,0,1,CB LG, ON/OFF", "UFC(25),3001,pnt_128,BTN,128,1,0,1,UFC Function Selector Pushbutton, A/P", "GEAR_INTERFACE(5),3004,pnt_238,TUMB,238,-1,0,1,Anti Skid Switch, ON/OFF", "GEAR_INTERFACE(5),3004,pnt_238,TUMB,238,1,0,1,Anti Skid Switch, ON/OFF", "MDI_LEFT(35),3030,pnt_75,BTN,75,1,0,1,Left MDI PB 20", "MDI_LEFT(35),3020,pnt_63,BTN,63,1,0,1,Left MDI PB 10", "INTERCOM(40),3008,pnt_363,LEV,363,0,0,1,TACAN Volume Control Knob", "AMPCD(37),3004,pnt_179_2,BTN,179,1,0,1,AMPCD Symbology Control Switch, UP", "MDI_LEFT(35),3003,pnt_53,LEV,53,0,0,1,Left MDI Contrast Control Knob", "AMPCD(37),3022,pnt_194,BTN,194,1,0,1,AMPCD PB 12", "FUEL_INTERFACE(6),3003,pnt_344,BTN,344,1,0,1,Fuel Dump Switch, ON/OFF", "FUEL_INTERFACE(6),3003,pnt_344,BTN,344,1,0,1,Fuel Dump Switch, ON/OFF", "SAI(32),3001,pnt_215,BTN,215,1,0,1,SAI Test Button - Push to test", "UFC(25),3029,pnt_47_122,BTN,122,1,0,1,UFC Keyboard Pushbutton, ENT", "UFC(25),3013,pnt_103,BTN,103,1,0,1,UFC Option Select Pushbutton 4", "MDI_RIGHT(36),3001,pnt_76,TUMB,76,0.1,0,0.2,Right MDI Brightness Selector Knob, OFF/NIGHT/DAY", "MDI_RIGHT(36),3001,pnt_76,TUMB,76,-0.1,0,0.2,Right MDI Brightness Selector Knob, OFF/NIGHT/DAY", "SMS(23),3011,pnt_236,TUMB,236,0.1,-0.1,0.3,Selective Jettison Knob, L FUS MSL/SAFE/R FUS MSL/ RACK/LCHR /STORES", "SMS(23),3011,pnt_236,TUMB,236,-0.1,-0.1,0.3,Selective Jettison Knob, L FUS MSL/SAFE/R FUS MSL/ RACK/LCHR /STORES", "ENGINES_INTERFACE(12),3006,pnt_331,BTN,331,1,0,1,Fire and Bleed Air Test Switch, (RMB) TEST A/(LMB) TEST B", "ENGINES_INTERFACE(12),3007,pnt_331,BTN,331,-1,-1,0,Fire and Bleed Air Test Switch, (RMB) TEST A/(LMB) TEST B", "GEAR_INTERFACE(5),3009,pnt_293,TUMB,293,-1,0,1,Arresting Hook Handle, UP/DOWN", "GEAR_INTERFACE(5),3009,pnt_293,TUMB,293,1,0,1,Arresting Hook Handle, UP/DOWN", "UFC(25),3023,pnt_115,BTN,115,1,0,1,UFC Keyboard Pushbutton, 5", "MDI_LEFT(35),3029,pnt_73,BTN,73,1,0,1,Left MDI PB 19", "UFC(25),3006,pnt_133,BTN,133,1,0,1,UFC Function Selector Pushbutton, BCN", "ELEC_INTERFACE(3),3007,pnt_379,TUMB,379,-1,0,1,Generator TIE Control Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(3),3007,pnt_379,TUMB,379,1,0,1,Generator TIE Control Switch Cover, OPEN/CLOSE", "CONTROL_INTERFACE(2),3005,pnt_348,TUMB,348,-1,0,1,GAIN Switch Cover, OPEN/CLOSE", "CONTROL_INTERFACE(2),3005,pnt_348,TUMB,348,1,0,1,GAIN Switch Cover, OPEN/CLOSE", "UFC(25),3030,pnt_108,LEV,108,0,0,1,UFC COMM 1 Volume Control Knob", "ENGINES_INTERFACE(12),3014,pnt_410,TUMB,410,1,-1,1,Engine Anti-Ice Switch, ON/OFF/TEST", "ENGINES_INTERFACE(12),3014,pnt_410,TUMB,410,-1,-1,1,Engine Anti-Ice Switch, ON/OFF/TEST", "ECS_INTERFACE(11),3010,pnt_505,LEV,505,0,0,1,Left Louver",
-        "SAI(32),3003,pnt_213,LEV,214,0.5,0,1,SAI Cage Knob, (LMB) Pull to cage (hold RMB and rotate MW to uncage)/(MW) Adjust miniature airplane", "SAI(32),3002,pnt_213,BTN,213,1,0,1,SAI Cage Knob, (LMB) Pull to cage (hold RMB and rotate MW to uncage)/(MW) Adjust miniature airplane", "SMS(23),3013,pnt_135,TUMB,135,0.1,0,0.2,IR Cooling Switch, ORIDE/NORM/OFF", "SMS(23),3013,pnt_135,TUMB,135,-0.1,0,0.2,IR Cooling Switch, ORIDE/NORM/OFF", "MDI_LEFT(35),3022,pnt_65,BTN,65,1,0,1,Left MDI PB 12", "ELEC_INTERFACE(3),3019,pnt_383,TUMB,383,0,0,1,CB SPD BRK, ON/OFF", "ELEC_INTERFACE(3),3019,pnt_383,TUMB,383,1,0,1,CB SPD BRK, ON/OFF", "AMPCD(37),3027,pnt_199,BTN,199,1,0,1,AMPCD PB 17", "CPT_MECHANICS(7),3009,pnt_513,TUMB,513,-1,0,1,Shoulder Harness Control Handle, LOCK/UNLOCK", "CPT_MECHANICS(7),3009,pnt_513,TUMB,513,1,0,1,Shoulder Harness Control Handle, LOCK/UNLOCK", "CPT_MECHANICS(7),3012,pnt_260,BTN,260,1,0,1,Rudder Pedal Adjust Lever", "UFC(25),3007,pnt_134,BTN,134,1,0,1,UFC Function Selector Pushbutton, ON/OFF", "(0),3004,pnt_499,TUMB,0,-1,0,1,Toggle Mirrors", "(0),3004,pnt_499,TUMB,0,1,0,1,Toggle Mirrors", "GEAR_INTERFACE(5),3002,pnt_226,LEV,228,1,0,1,Landing Gear Control Handle, (RMB)UP/(LMB)DOWN/(MW)EMERGENCY DOWN", "GEAR_INTERFACE(5),3001,pnt_226,TUMB,226,1,0,1,Landing Gear Control Handle, (RMB)UP/(LMB)DOWN/(MW)EMERGENCY DOWN", "GEAR_INTERFACE(5),3001,pnt_226,TUMB,226,-1,0,1,Landing Gear Control Handle, (RMB)UP/(LMB)DOWN/(MW)EMERGENCY DOWN", "ELEC_INTERFACE(3),3005,pnt_336,BTN,336,1,0,1,External Power Switch, RESET/NORM/OFF", "ELEC_INTERFACE(3),3004,pnt_336,TUMB,336,-1,-1,0,External Power Switch, RESET/NORM/OFF", "MDI_LEFT(35),3012,pnt_55,BTN,55,1,0,1,Left MDI PB 2", "MDI_RIGHT(36),3015,pnt_83,BTN,83,1,0,1,Right MDI PB 5", "ECS_INTERFACE(11),3006,pnt_407,LEV,407,0,0,1,Cabin Temperature Knob", "MDI_LEFT(35),3025,pnt_68,BTN,68,1,0,1,Left MDI PB 15", "ENGINES_INTERFACE(12),3008,pnt_46,BTN,46,1,0,1,Fire Extinguisher Pushbutton", "(0),3105,pnt_176,TUMB,176,1,-1,1,Selector Switch, HUD/LDIR/RDDI", "(0),3105,pnt_176,TUMB,176,-1,-1,1,Selector Switch, HUD/LDIR/RDDI", "INS(44),3001,pnt_443,TUMB,443,0.1,0,0.7,INS Switch, OFF/CV/GND/NAV/IFA/GYRO/GB/TEST", "INS(44),3001,pnt_443,TUMB,443,-0.1,0,0.7,INS Switch, OFF/CV/GND/NAV/IFA/GYRO/GB/TEST", "EXT_LIGHTS(8),3002,pnt_337,LEV,337,0,0,1,FORMATION Lights Dimmer Control", "ELEC_INTERFACE(3),3012,pnt_334,BTN,334,1,0,1,Ground Power Switch 3, A ON/AUTO/B ON", "ELEC_INTERFACE(3),3013,pnt_334,BTN,334,-1,-1,0,Ground Power Switch 3, A ON/AUTO/B ON", "MDI_RIGHT(36),3023,pnt_91,BTN,91,1,0,1,Right MDI PB 13", "INTERCOM(40),3010,pnt_350,TUMB,350,1,-1,1,Comm Relay Switch, CIPHER/OFF/PLAIN", "INTERCOM(40),3010,pnt_350,TUMB,350,-1,-1,1,Comm Relay Switch, CIPHER/OFF/PLAIN", "SMS(23),3012,pnt_258,TUMB,258,-1,0,1,Auxiliary Release Switch, ENABLE/NORM", "SMS(23),3012,pnt_258,TUMB,258,1,0,1,Auxiliary Release Switch, ENABLE/NORM", "INTERCOM(40),3007,pnt_361,LEV,361,0,0,1,MIDS B Volume Control Knob", "MDI_LEFT(35),3021,pnt_64,BTN,64,1,0,1,Left MDI PB 11", "(0),3003,pnt_498,TUMB,0,-1,0,1,Toggle Mirrors", "(0),3003,pnt_498,TUMB,0,1,0,1,Toggle Mirrors", "MDI_RIGHT(36),3012,pnt_80,BTN,80,1,0,1,Right MDI PB 2", "HUD(34),3001,pnt_140,TUMB,140,0.1,0,0.2,HUD Symbology Reject Switch, NORM/REJ 1/REJ 2", "HUD(34),3001,pnt_140,TUMB,140,-0.1,0,0.2,HUD Symbology Reject Switch, NORM/REJ 1/REJ 2", "FUEL_INTERFACE(6),3004,pnt_343,TUMB,343,1,-1,1,External Centerline Tank Fuel Control Switch, STOP/NORM/ORIDE", "FUEL_INTERFACE(6),3004,pnt_343,TUMB,343,-1,-1,1,External Centerline Tank Fuel Control Switch, STOP/NORM/ORIDE", "CONTROL_INTERFACE(2),3008,pnt_139,TUMB,139,-1,0,1,Spin Recovery Switch Cover, OPEN/CLOSE", "CONTROL_INTERFACE(2),3008,pnt_139,TUMB,139,1,0,1,Spin Recovery Switch Cover, OPEN/CLOSE", "CPT_MECHANICS(7),3013,pnt_575,TUMB,575,-1,0,1,Hide Stick toggle", "CPT_MECHANICS(7),3013,pnt_575,TUMB,575,1,0,1,Hide Stick toggle", "AMPCD(37),3029,pnt_201,BTN,201,1,0,1,AMPCD PB 19", "ELEC_INTERFACE(3),3020,pnt_384,TUMB,384,0,0,1,CB LAUNCH BAR, ON/OFF", "ELEC_INTERFACE(3),3020,pnt_384,TUMB,384,1,0,1,CB LAUNCH BAR, ON/OFF", "MDI_RIGHT(36),3027,pnt_95,BTN,95,1,0,1,Right MDI PB 17", "SMS(23),3010,pnt_235,BTN,235,1,0,1,Selective Jettison Pushbutton", "CMDS(54),3001,pnt_517,TUMB,517,0.1,0,0.2,DISPENSER Switch, BYPASS/ON/OFF", "CMDS(54),3001,pnt_517,TUMB,517,-0.1,0,0.2,DISPENSER Switch, BYPASS/ON/OFF", "CONTROL_INTERFACE(2),3009,pnt_138,TUMB,138,-1,0,1,Spin Recovery Switch, RCVY/NORM", "CONTROL_INTERFACE(2),3009,pnt_138,TUMB,138,1,0,1,Spin Recovery Switch, RCVY/NORM", "CPT_LIGTHS(9),3005,pnt_418,LEV,418,0,0,1,CHART Light Dimmer Control", "CPT_LIGTHS(9),3001,pnt_413,LEV,413,0,0,1,CONSOLES Lights Dimmer Control", "RWR(53),3005,pnt_266,BTN,266,1,0,1,ALR-67 BIT Pushbutton", "SMS(23),3006,pnt_155,TUMB,155,-1,0,1,Station Jettison Select Button, LEFT IN", "SMS(23),3006,pnt_155,TUMB,155,1,0,1,Station Jettison Select Button, LEFT IN", "CPT_MECHANICS(7),3003,pnt_42,TUMB,42,-1,0,1,Canopy Jettison Handle - Pull to jettison", "CPT_MECHANICS(7),3003,pnt_42,TUMB,42,1,0,1,Canopy Jettison Handle - Pull to jettison", "MDI_RIGHT(36),3020,pnt_88,BTN,88,1,0,1,Right MDI PB 10", "IFEI(33),3003,pnt_170,BTN,170,1,0,1,IFEI Up Arrow Button", "(0),3128,pnt_318,BTN,318,1,0,1,Right Video Sensor BIT Initiate Pushbutton - Push to initiate BIT", "INTERCOM(40),3006,pnt_362,LEV,362,0,0,1,MIDS A Volume Control Knob", "RWR(53),3001,pnt_277,TUMB,277,-1,0,1,ALR-67 POWER Pushbutton", "RWR(53),3001,pnt_277,TUMB,277,1,0,1,ALR-67 POWER Pushbutton", "UFC(25),3019,pnt_111,BTN,111,1,0,1,UFC Keyboard Pushbutton, 1", "MDI_RIGHT(36),3030,pnt_98,BTN,98,1,0,1,Right MDI PB 20", "CONTROL_INTERFACE(2),3010,pnt_295,LEV,296,1,0,1,Wing Fold Control Handle, (RMB)CW/(LMB)CCW/ (MW)PULL/STOW", "CONTROL_INTERFACE(2),3011,pnt_295,TUMB,295,1,-1,1,Wing Fold Control Handle, (RMB)CW/(LMB)CCW/ (MW)PULL/STOW", "CONTROL_INTERFACE(2),3011,pnt_295,TUMB,295,-1,-1,1,Wing Fold Control Handle, (RMB)CW/(LMB)CCW/ (MW)PULL/STOW", "ECS_INTERFACE(11),3004,pnt_408,TUMB,408,1,-1,1,Cabin Pressure Switch, NORM/DUMP/ RAM/DUMP", "ECS_INTERFACE(11),3004,pnt_408,TUMB,408,-1,-1,1,Cabin Pressure Switch, NORM/DUMP/ RAM/DUMP", "MDI_RIGHT(36),3028,pnt_96,BTN,96,1,0,1,Right MDI PB 18", "RWR(53),3007,pnt_261,TUMB,261,0.1,0,0.4,ALR-67 DIS TYPE Switch, N/I/A/U/F", "RWR(53),3007,pnt_261,TUMB,261,-0.1,0,0.4,ALR-67 DIS TYPE Switch, N/I/A/U/F", "ELEC_INTERFACE(3),3014,pnt_335,BTN,335,1,0,1,Ground Power Switch 4, A ON/AUTO/B ON", "ELEC_INTERFACE(3),3015,pnt_335,BTN,335,-1,-1,0,Ground Power Switch 4, A ON/AUTO/B ON", "MDI_LEFT(35),3015,pnt_58,BTN,58,1,0,1,Left MDI PB 5", "INTERCOM(40),3011,pnt_351,TUMB,351,1,-1,1,COMM G XMT Switch, COMM 1/OFF/COMM 2", "INTERCOM(40),3011,pnt_351,TUMB,351,-1,-1,1,COMM G XMT Switch, COMM 1/OFF/COMM 2", "ECS_INTERFACE(11),3007,pnt_406,LEV,406,0,0,1,Suit Temperature Knob", "MDI_LEFT(35),3011,pnt_54,BTN,54,1,0,1,Left MDI PB 1", "AMPCD(37),3019,pnt_191,BTN,191,1,0,1,AMPCD PB 9", "UFC(25),3026,pnt_118,BTN,118,1,0,1,UFC Keyboard Pushbutton, 8", "ELEC_INTERFACE(3),3006,pnt_378,TUMB,378,-1,0,1,Generator TIE Control Switch, NORM/RESET", "ELEC_INTERFACE(3),3006,pnt_378,TUMB,378,1,0,1,Generator TIE Control Switch, NORM/RESET", "GEAR_INTERFACE(5),3003,pnt_229,BTN,229,1,0,1,Down Lock Override Button - Push to unlock", "IFEI(33),3006,pnt_173,BTN,173,1,0,1,IFEI ET Button", "AMPCD(37),3012,pnt_184,BTN,184,1,0,1,AMPCD PB 2", "INTERCOM(40),3017,pnt_352,TUMB,352,0.05,0,0.95,ILS Channel Selector Switch", "INTERCOM(40),3017,pnt_352,TUMB,352,-0.05,0,0.95,ILS Channel Selector Switch", "AMPCD(37),3026,pnt_198,BTN,198,1,0,1,AMPCD PB 16", "IFEI(33),3001,pnt_168,BTN,168,1,0,1,IFEI Mode Button", "RWR(53),3004,pnt_269,BTN,269,1,0,1,ALR-67 OFFSET Pushbutton", "IFEI(33),3007,pnt_174,LEV,174,0.5,0,1,IFEI Brightness Control Knob", "MDI_RIGHT(36),3011,pnt_79,BTN,79,1,0,1,Right MDI PB 1", "INTERCOM(40),3003,pnt_358,LEV,358,0,0,1,ICS Volume Control Knob", "MDI_RIGHT(36),3018,pnt_86,BTN,86,1,0,1,Right MDI PB 8", "IFEI(33),3004,pnt_171,BTN,171,1,0,1,IFEI Down Arrow Button", "UFC(25),3031,pnt_123,LEV,123,0,0,1,UFC COMM 2 Volume Control Knob", "SMS(23),3001,pnt_458,BTN,458,1,0,1,Master Mode Button, A/A", "MDI_RIGHT(36),3014,pnt_82,BTN,82,1,0,1,Right MDI PB 4", "MDI_LEFT(35),3027,pnt_70,BTN,70,1,0,1,Left MDI PB 17", "SMS(23),3009,pnt_161,TUMB,161,-1,0,1,Station Jettison Select Button, RIGHT OUT", "SMS(23),3009,pnt_161,TUMB,161,1,0,1,Station Jettison Select Button, RIGHT OUT", "AMPCD(37),3024,pnt_196,BTN,196,1,0,1,AMPCD PB 14", "MDI_LEFT(35),3004,pnt_312,BTN,312,1,0,1,Heading Set Switch", "MDI_LEFT(35),3005,pnt_312,BTN,312,-1,-1,0,Heading Set Switch", "ELEC_INTERFACE(3),3008,pnt_332,BTN,332,1,0,1,Ground Power Switch 1, A ON/AUTO/B ON", "ELEC_INTERFACE(3),3009,pnt_332,BTN,332,-1,-1,0,Ground Power Switch 1, A ON/AUTO/B ON", "CPT_MECHANICS(7),3006,pnt_511,TUMB,511,-1,0,1,Ejection Seat SAFE/ARMED Handle, SAFE/ARMED", "CPT_MECHANICS(7),3006,pnt_511,TUMB,511,1,0,1,Ejection Seat SAFE/ARMED Handle, SAFE/ARMED", "TGP_INTERFACE(62),3003,pnt_441,BTN,441,1,0,1,LTD/R Switch, ARM/SAFE/AFT", "TGP_INTERFACE(62),3002,pnt_441,TUMB,441,-1,-1,0,LTD/R Switch, ARM/SAFE/AFT", "MDI_LEFT(35),3019,pnt_62,BTN,62,1,0,1,Left MDI PB 9", "(0),3127,pnt_315,BTN,315,1,0,1,Left Video Sensor BIT Initiate Pushbutton - Push to initiate BIT", "AMPCD(37),3028,pnt_200,BTN,200,1,0,1,AMPCD PB 18", "MDI_RIGHT(36),3017,pnt_85,BTN,85,1,0,1,Right MDI PB 7", "ANTENNA_SELECTOR(50),3001,pnt_373,TUMB,373,1,-1,1,COMM 1 Antenna Selector Switch, UPPER/AUTO/LOWER", "ANTENNA_SELECTOR(50),3001,pnt_373,TUMB,373,-1,-1,1,COMM 1 Antenna Selector Switch, UPPER/AUTO/LOWER", "CPT_LIGTHS(9),3002,pnt_414,LEV,414,0,0,1,INST PNL Dimmer Control", "FUEL_INTERFACE(6),3001,pnt_340,TUMB,340,-1,0,1,Internal Wing Tank Fuel Control Switch, INHIBIT/NORM", "FUEL_INTERFACE(6),3001,pnt_340,TUMB,340,1,0,1,Internal Wing Tank Fuel Control Switch, INHIBIT/NORM", "HUD(34),3007,pnt_146,LEV,146,0,0,1,AOA Indexer Control Knob", "AMPCD(37),3011,pnt_183,BTN,183,1,0,1,AMPCD PB 1", "AMPCD(37),3013,pnt_185,BTN,185,1,0,1,AMPCD PB 3", "AMPCD(37),3016,pnt_188,BTN,188,1,0,1,AMPCD PB 6", "(0),3106,pnt_314,TUMB,314,1,-1,1,Mode Selector Switch, MAN/OFF/AUTO",
-        "(0),3106,pnt_314,TUMB,314,-1,-1,1,Mode Selector Switch, MAN/OFF/AUTO", "HUD(34),3004,pnt_143,LEV,143,0,0,1,Black Level Control Knob", "IFEI(33),3005,pnt_172,BTN,172,1,0,1,IFEI ZONE Button", "MDI_LEFT(35),3023,pnt_66,BTN,66,1,0,1,Left MDI PB 13", "RWR(53),3008,pnt_216,LEV,216,0,0,1,RWR Intensity Knob", "ELEC_INTERFACE(3),3016,pnt_409,BTN,409,1,0,1,Pitot Heater Switch, ON/AUTO", "ELEC_INTERFACE(3),3016,pnt_409,BTN,409,1,0,1,Pitot Heater Switch, ON/AUTO", "HUD(34),3002,pnt_141,LEV,141,0,0,1,HUD Symbology Brightness Control Knob", "HMD_INTERFACE(58),3001,pnt_136,LEV,136,0,0,0.75,HMD OFF/BRT Knob"],
-    "FW-190A8": ["ELEC_INTERFACE(1),3053,pntr_124,BTN,124,1,0,,Aft Tank Fuel Pump cb_Off", "ELEC_INTERFACE(1),3005,pntr_141,BTN,141,1,0,,Drop Ordnance & Optional Armament cb_On", "WEAPON_SYSTEM(20),3014,pntr_011,BTN,11,1,0,1,Cockpit.FW190A8.trigger_b2", "WEAPON_SYSTEM(20),3012,BUTTON_A,BTN,13,1,0,1,Cockpit.FW190A8.trigger_a", "ELEC_INTERFACE(1),3022,pntr_176,BTN,176,1,0,,Undercarriage Drives cb_On", "ELEC_INTERFACE(1),3047,pntr_156,BTN,156,1,0,,Ignition cb_Off", "ELEC_INTERFACE(1),3011,pntr_153,BTN,153,1,0,,Pitot Heating cb_On", "PILOT_SIGHT(21),3001,pntr_133,LEV,133,0.5,0,1,Cockpit.Bf109K4.cb_p112", "ELEC_INTERFACE(1),3052,pntr_122,BTN,122,1,0,,Fore Tank Fuel Pump cb_Off", "ELEC_INTERFACE(1),3024,pntr_180,BTN,180,1,0,,Prop. Pitch Drive cb_On", "CLOCK(13),3008,CLK_SW,BTN,28,1,0,1,Cockpit.Bf109K4.clock_stopwatch", "ELEC_INTERFACE(1),3026,pntr_184,BTN,184,1,0,,Stabilizer Trim cb_On", "ELEC_INTERFACE(1),3040,pntr_142,BTN,142,1,0,,Drop Ordnance & Optional Armament cb_Off", "CONTROL_SYSTEM(8),3013,pntr_159,LEV,159,1,0.01,,Cooling Flaps Control", "CONTROL_SYSTEM(8),3007,pntr_067,TUMB,67,-1,0,1,Landing Gears Extending", "CONTROL_SYSTEM(8),3007,pntr_067,TUMB,67,1,0,1,Landing Gears Extending", "ELEC_INTERFACE(1),3027,pntr_186,BTN,186,1,0,,Artificial Horizon cb_On", "CONTROL_SYSTEM(8),3001,pntr_062,TUMB,62,-1,0,1,Flaps Up", "CONTROL_SYSTEM(8),3001,pntr_062,TUMB,62,1,0,1,Flaps Up", "ELEC_INTERFACE(1),3042,pntr_146,BTN,146,1,0,,Instruments cb_Off", "ELEC_INTERFACE(1),3046,pntr_154,BTN,154,1,0,,Pitot Heating cb_Off", "ENGINE_SYSTEM(2),3004,pntr_075,TUMB,75,0.3,0,0.9,Magneto Switch", "ENGINE_SYSTEM(2),3004,pntr_075,TUMB,75,-0.3,0,0.9,Magneto Switch", "ELEC_INTERFACE(1),3064,pntr_192,BTN,192,1,0,,Repeater Compass cb_Off", "ELEC_INTERFACE(1),3017,pntr_123,BTN,123,1,0,,Fore Tank Fuel Pump cb_On", "ELEC_INTERFACE(1),3025,pntr_182,BTN,182,1,0,,Prop. Pitch Controls cb_On", "PILOT_SIGHT(21),3004,pntr_134,TUMB,134,-1,0,1,Cockpit.Bf109K4.gun_sight_tint", "PILOT_SIGHT(21),3004,pntr_134,TUMB,134,1,0,1,Cockpit.Bf109K4.gun_sight_tint", "ELEC_INTERFACE(1),3065,pntr_197,BTN,197,1,0,,Undercarriage Controls cb_Off", "FUEL_SYSTEM(6),3009,pntr_162,BTN,162,1,0,1,Primer Pump", "ELEC_INTERFACE(1),3010,pntr_151,BTN,151,1,0,,Clothes Heating cb_On", "ELEC_INTERFACE(1),3043,pntr_148,BTN,148,1,0,,Navigation Lights cb_Off", "CPT_MECH(3),3006,pntr_115,TUMB,115,-1,0,1,Canopy Emergency Release Handle", "CPT_MECH(3),3006,pntr_115,TUMB,115,1,0,1,Canopy Emergency Release Handle", "ELEC_INTERFACE(1),3009,pntr_149,BTN,149,1,0,,Cabin Illumination cb_On", "ELEC_INTERFACE(1),3033,pntr_203,BTN,203,1,0,,Inner Wing Guns cb_On", "ELEC_INTERFACE(1),3075,pntr_079,BTN,79,1,0,1,Electric Kill-switch", "ELEC_INTERFACE(1),3018,pntr_125,BTN,125,1,0,,Aft Tank Fuel Pump cb_On", "CONTROL_SYSTEM(8),3003,pntr_064,TUMB,64,-1,0,1,Flaps Landing", "CONTROL_SYSTEM(8),3003,pntr_064,TUMB,64,1,0,1,Flaps Landing", "WEAPON_SYSTEM(20),3020,pntr_049,TUMB,49,-1,0,1,Outer Wing Guns Arm", "WEAPON_SYSTEM(20),3020,pntr_049,TUMB,49,1,0,1,Outer Wing Guns Arm", "ELEC_INTERFACE(1),3023,pntr_178,BTN,178,1,0,,Landing Flaps cb_On", "ELEC_INTERFACE(1),3031,pntr_201,BTN,201,1,0,,FuG 25a IFF Self-Destruct cb_On", "CPT_MECH(3),3001,pntr_114,LEV,114,0,0,1,Canopy Hand Crank", "ENGINE_SYSTEM(2),3009,pntr_105,BTN,105,1,0.5,1,Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch", "ENGINE_SYSTEM(2),3008,pntr_105,BTN,105,0,0,0.5,Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch", "ELEC_INTERFACE(1),3032,pntr_214,BTN,214,1,0,,Outer Wing Guns cb_On", "ELEC_INTERFACE(1),3029,pntr_191,BTN,191,1,0,,Repeater Compass cb_On", "ALTIMETER(10),3001,pntr_034,LEV,34,1,0,1,Altimeter Pressure Set", "ELEC_INTERFACE(1),3014,pntr_170,BTN,170,1,0,,Generator cb_On", "ELEC_INTERFACE(1),3066,pntr_202,BTN,202,1,0,,FuG 25a IFF Self-Destruct cb_Off", "ARTIFICIAL_HORIZON(12),3001,pntr_039,LEV,39,0,0.511,1,Horizon Cage", "WEAPON_SYSTEM(20),3013,pntr_009,BTN,9,1,0,1,Cockpit.FW190A8.trigger_b1", "ELEC_INTERFACE(1),3001,pntr_138,TUMB,138,-1,0,1,Circuit Breakers Cover", "ELEC_INTERFACE(1),3001,pntr_138,TUMB,138,1,0,1,Circuit Breakers Cover", "ELEC_INTERFACE(1),3061,pntr_185,BTN,185,1,0,,Stabilizer Trim cb_Off", "ELEC_INTERFACE(1),3013,pntr_157,BTN,157,1,0,,FuG 25a IFF cb_On", "VHF_RADIO(15),3111,pntr_080,TUMB,80,0.1,0,0.3,Radio WIP", "VHF_RADIO(15),3111,pntr_080,TUMB,80,-0.1,0,0.3,Radio WIP", "CONTROL_SYSTEM(8),3008,pntr_089,TUMB,89,-1,0,1,Landing Gear Emergency Release Handle", "CONTROL_SYSTEM(8),3008,pntr_089,TUMB,89,1,0,1,Landing Gear Emergency Release Handle", "LIGHT_SYSTEM(7),3001,pntr_078,LEV,78,0,0,1,Instrument Lights Brightness", "CONTROL_SYSTEM(8),3002,pntr_063,TUMB,63,-1,0,1,Flaps Take Off", "CONTROL_SYSTEM(8),3002,pntr_063,TUMB,63,1,0,1,Flaps Take Off", "ELEC_INTERFACE(1),3020,pntr_129,BTN,129,1,0,,Aux. Tank Fuel Pump cb_On", "IFF(16),3001,pntr_086,TUMB,86,1,-1,1,IFF Channel Selector", "IFF(16),3001,pntr_086,TUMB,86,-1,-1,1,IFF Channel Selector", "ELEC_INTERFACE(1),3069,pntr_213,BTN,213,1,0,,Cowling Guns cb_Off", "ELEC_INTERFACE(1),3049,pntr_171,BTN,171,1,0,,Generator cb_Off", "ELEC_INTERFACE(1),3008,pntr_147,BTN,147,1,0,,Navigation Lights cb_On", "WEAPON_SYSTEM(20),3001,pntr_048,TUMB,48,-1,0,1,Master Arm", "WEAPON_SYSTEM(20),3001,pntr_048,TUMB,48,1,0,1,Master Arm", "ELEC_INTERFACE(1),3077,pntr_139,TUMB,139,-1,0,1,Circuit Breakers Cover", "ELEC_INTERFACE(1),3077,pntr_139,TUMB,139,1,0,1,Circuit Breakers Cover", "ELEC_INTERFACE(1),3034,pntr_212,BTN,212,1,0,,Cowling Guns cb_On", "ELEC_INTERFACE(1),3048,pntr_158,BTN,158,1,0,,FuG 25a IFF cb_Off", "FUEL_SYSTEM(6),3010,pntr_091,BTN,91,1,0,1,Fuel cross-feed valve", "WEAPON_SYSTEM(20),3007,pntr_057,LEV,57,1,0,1,Set Gun 3 Ammunition Count", "ELEC_INTERFACE(1),3016,pntr_121,BTN,121,1,0,,External Power cb_On", "ELEC_INTERFACE(1),3063,pntr_189,BTN,189,1,0,,Motor-Generator cb_Off", "WEAPON_SYSTEM(20),3016,pntr_109,TUMB,109,0.1,0,0.4,Bomb Fusing Selector", "WEAPON_SYSTEM(20),3016,pntr_109,TUMB,109,-0.1,0,0.4,Bomb Fusing Selector", "CONTROL_SYSTEM(8),3006,pntr_066,TUMB,66,-1,0,1,Landing Gears Retraction Cover", "CONTROL_SYSTEM(8),3006,pntr_066,TUMB,66,1,0,1,Landing Gears Retraction Cover", "WEAPON_SYSTEM(20),3018,pntr_092,BTN,92,1,0,1,Jettison Fuselage Stores", "WEAPON_SYSTEM(20),3005,pntr_054,LEV,54,1,0,1,Set Gun 2 Ammunition Count", "WEAPON_SYSTEM(20),3003,pntr_051,LEV,51,1,0,1,Set Gun 1 Ammunition Count", "WEAPON_SYSTEM(20),3022,pntr_135,TUMB,135,-1,0,1,Main Rocket Switch", "WEAPON_SYSTEM(20),3022,pntr_135,TUMB,135,1,0,1,Main Rocket Switch", "WEAPON_SYSTEM(20),3024,pntr_136,TUMB,140,-1,0,1,Rocket Emergency Release", "WEAPON_SYSTEM(20),3024,pntr_136,TUMB,140,1,0,1,Rocket Emergency Release", "WEAPON_SYSTEM(20),3011,pntr_010,TUMB,10,-1,0,1,Cockpit.FW190A8.safety", "WEAPON_SYSTEM(20),3011,pntr_010,TUMB,10,1,0,1,Cockpit.FW190A8.safety", "ELEC_INTERFACE(1),3012,pntr_155,BTN,155,1,0,,Ignition cb_On", "ELEC_INTERFACE(1),3041,pntr_144,BTN,144,1,0,,Gun Sight and Gun Camera cb_Off", "ELEC_INTERFACE(1),3044,pntr_150,BTN,150,1,0,,Cabin Illumination cb_Off", "ELEC_INTERFACE(1),3058,pntr_179,BTN,179,1,0,,Landing Flaps cb_Off", "ENGINE_SYSTEM(2),3014,pntr_003_1,BTN,3,1,0,1,Cockpit.Bf109K4.pitch_plus", "ELEC_INTERFACE(1),3054,pntr_126,BTN,126,1,0,,Drop Tank Fuel Pump cb_Off", "ELEC_INTERFACE(1),3068,pntr_211,BTN,211,1,0,,Inner Wing Guns cb_Off", "ELEC_INTERFACE(1),3057,pntr_177,BTN,177,1,0,,Undercarriage Drives cb_Off", "ELEC_INTERFACE(1),3050,pntr_173,BTN,173,1,0,,Battery cb_Off", "ELEC_INTERFACE(1),3030,pntr_196,BTN,196,1,0,,Undercarriage Controls cb_On", "ELEC_INTERFACE(1),3067,pntr_215,BTN,215,1,0,,Outer Wing Guns cb_Off", "CLOCK(13),3001,CLK_SCALE,LEV,25,0,0,1,Cockpit.Bf109K4.clock_scale", "ENGINE_SYSTEM(2),3015,pntr_003_2,BTN,3,-1,0,1,Cockpit.Bf109K4.pitch_minus", "ELEC_INTERFACE(1),3045,pntr_152,BTN,152,1,0,,Clothes Heating cb_Off", "CONTROL_SYSTEM(8),3012,pntr_077,TUMB,77,1,0,1,Stabilizer Trimmer Up/Down", "CONTROL_SYSTEM(8),3012,pntr_077,TUMB,77,0,-1,0,Stabilizer Trimmer Up/Down", "ELEC_INTERFACE(1),3056,pntr_175,BTN,175,1,0,,FuG 16 ZY Radio cb_Off", "ELEC_INTERFACE(1),3051,pntr_120,BTN,120,1,0,,External Power cb_Off", "ELEC_INTERFACE(1),3006,pntr_143,BTN,143,1,0,,Gun Sight and Gun Camera cb_On", "VHF_RADIO(15),3001,pntr_081,TUMB,81,0.1,0,0.3,Radio Channel Selector", "VHF_RADIO(15),3001,pntr_081,TUMB,81,-0.1,0,0.3,Radio Channel Selector", "VHF_RADIO(15),3003,pntr_083,LEV,83,0,0,1,Radio Volume", "ELEC_INTERFACE(1),3007,pntr_145,BTN,145,1,0,,Instruments cb_On", "VHF_RADIO(15),3006,pntr_084,TUMB,84,-1,0,1,FT FT / Y ZF Mode Switch", "VHF_RADIO(15),3006,pntr_084,TUMB,84,1,0,1,FT FT / Y ZF Mode Switch", "ELEC_INTERFACE(1),3055,pntr_128,BTN,128,1,0,,Aux. Tank Fuel Pump cb_Off", "VHF_RADIO(15),3008,pntr_082,LEV,82,0,0,1,Radio Tuning (+/-30 kHz)", "ELEC_INTERFACE(1),3062,pntr_187,BTN,187,1,0,,Artificial Horizon cb_Off", "OXYGEN_SYSTEM(4),3003,pntr_110,LEV,110,0,0,0.5,Oxygen Flow Valve", "ELEC_INTERFACE(1),3021,pntr_174,BTN,174,1,0,,FuG 16 ZY Radio cb_On", "CLOCK(13),3006,CLK_SET,TUMB,27,-1,0,1,Cockpit.Bf109K4.clock_stop", "CLOCK(13),3006,CLK_SET,TUMB,27,1,0,1,Cockpit.Bf109K4.clock_stop", "IFF(16),3003,pntr_088,BTN,88,1,0,1,IFF Check", "ELEC_INTERFACE(1),3028,pntr_188,BTN,188,1,0,,Motor-Generator cb_On", "ENGINE_SYSTEM(2),3006,pntr_104,TUMB,104,-1,0,1,Starter Switch Cover", "ENGINE_SYSTEM(2),3006,pntr_104,TUMB,104,1,0,1,Starter Switch Cover", "ENGINE_SYSTEM(2),3013,pntr_111,TUMB,111,-1,0,1,Cockpit.Bf109K4.cb_e103", "ENGINE_SYSTEM(2),3013,pntr_111,TUMB,111,1,0,1,Cockpit.Bf109K4.cb_e103", "FUEL_SYSTEM(6),3002,pntr_099,TUMB,99,0.5,0,1,Fuel Gauge Selector (FORWARD/NONE/AFT)", "FUEL_SYSTEM(6),3002,pntr_099,TUMB,99,-0.5,0,1,Fuel Gauge Selector (FORWARD/NONE/AFT)", "OXYGEN_SYSTEM(4),3001,pntr_190,TUMB,190,-1,0,1,Oxygen Emergency Knob", "OXYGEN_SYSTEM(4),3001,pntr_190,TUMB,190,1,0,1,Oxygen Emergency Knob", "ELEC_INTERFACE(1),3060,pntr_183,BTN,183,1,0,,Prop. Pitch Controls cb_Off", "ENGINE_SYSTEM(2),3017,pntr_093,BTN,93,1,0,1,Retract starter brushes", "ENGINE_SYSTEM(2),3011,pntr_200,TUMB,200,-1,0,1,Throttle Lock", "ENGINE_SYSTEM(2),3011,pntr_200,TUMB,200,1,0,1,Throttle Lock",
-        "FUEL_SYSTEM(6),3001,pntr_090,TUMB,90,0.1,0,0.3,Fuel Tank Selector Valve (CLOSE/FORWARD/BOTH/AFT)", "FUEL_SYSTEM(6),3001,pntr_090,TUMB,90,-0.1,0,0.3,Fuel Tank Selector Valve (CLOSE/FORWARD/BOTH/AFT)", "CONTROL_SYSTEM(8),3005,pntr_065,TUMB,65,-1,0,1,Landing Gears Retraction", "CONTROL_SYSTEM(8),3005,pntr_065,TUMB,65,1,0,1,Landing Gears Retraction", "ELEC_INTERFACE(1),3059,pntr_181,BTN,181,1,0,,Prop. Pitch Drive cb_Off", "ELEC_INTERFACE(1),3015,pntr_172,BTN,172,1,0,,Battery cb_On", "ELEC_INTERFACE(1),3019,pntr_127,BTN,127,1,0,,Drop Tank Fuel Pump cb_On", "WEAPON_SYSTEM(20),3009,pntr_060,LEV,60,1,0,1,Set Gun 4 Ammunition Count", "WEAPON_SYSTEM(20),3015,BUTTON_T,BTN,12,1,0,1,Cockpit.FW190A8.trigger_t", "CLOCK(13),3004,CLK_PINION,LEV,26,0,0,1,Cockpit.Bf109K4.clock_pinion", "REMOTE_COMPASS(14),3001,pntr_043,LEV,43,0,0,1,Course Set"],
-    "FW-190D9": ["FUEL_SYSTEM(6),3002,pntr_099,TUMB,99,0.5,0,1,Fuel Gauge Selector (FORWARD/NONE/AFT)", "FUEL_SYSTEM(6),3002,pntr_099,TUMB,99,-0.5,0,1,Fuel Gauge Selector (FORWARD/NONE/AFT)", "ELEC_INTERFACE(1),3031,pntr_079,BTN,79,1,0,1,Electric Kill-switch", "ELEC_INTERFACE(1),3005,pntr_141,BTN,141,1,0,,Flaps, Trimmer, Artificial Horizon Power On", "ELEC_INTERFACE(1),3006,pntr_143,BTN,143,1,0,,Landing Gear Power On", "ENGINE_SYSTEM(2),3015,pntr_085,TUMB,85,-1,0,1,MW-50 Switch", "ENGINE_SYSTEM(2),3015,pntr_085,TUMB,85,1,0,1,MW-50 Switch", "ELEC_INTERFACE(1),3025,pntr_156,BTN,156,1,0,,Battery Off", "ELEC_INTERFACE(1),3011,pntr_153,BTN,153,1,0,,Generator On", "ELEC_INTERFACE(1),3019,pntr_144,BTN,144,1,0,,Landing Gear Power Off", "ELEC_INTERFACE(1),3027,pntr_122,BTN,122,1,0,,Forward Tank Pump Off", "ENGINE_SYSTEM(2),3006,pntr_104,TUMB,104,-1,0,1,Starter Switch Cover", "ENGINE_SYSTEM(2),3006,pntr_104,TUMB,104,1,0,1,Starter Switch Cover", "ELEC_INTERFACE(1),3018,pntr_142,BTN,142,1,0,,Flaps, Trimmer, Artificial Horizon Power Off", "CONTROL_SYSTEM(8),3005,pntr_065,TUMB,65,-1,0,1,Landing Gears Retraction", "CONTROL_SYSTEM(8),3005,pntr_065,TUMB,65,1,0,1,Landing Gears Retraction", "CONTROL_SYSTEM(8),3007,pntr_067,TUMB,67,-1,0,1,Landing Gears Extending", "CONTROL_SYSTEM(8),3007,pntr_067,TUMB,67,1,0,1,Landing Gears Extending", "CONTROL_SYSTEM(8),3002,pntr_063,TUMB,63,-1,0,1,Flaps Take Off", "CONTROL_SYSTEM(8),3002,pntr_063,TUMB,63,1,0,1,Flaps Take Off", "CLOCK(13),3004,pntr_025,LEV,25,0,0,1,Cockpit.Bf109K4.clock_pinion", "ELEC_INTERFACE(1),3017,pntr_129,BTN,129,1,0,,MW-50 On", "CONTROL_SYSTEM(8),3001,pntr_062,TUMB,62,-1,0,1,Flaps Up", "CONTROL_SYSTEM(8),3001,pntr_062,TUMB,62,1,0,1,Flaps Up", "WEAPON_SYSTEM(20),3004,pntr_051,LEV,51,1,0,1,Set Gun 1 Ammunition Count", "ELEC_INTERFACE(1),3024,pntr_154,BTN,154,1,0,,Generator Off", "ENGINE_SYSTEM(2),3004,pntr_075,TUMB,75,0.3,0,0.9,Magneto Switch", "ENGINE_SYSTEM(2),3004,pntr_075,TUMB,75,-0.3,0,0.9,Magneto Switch", "WEAPON_SYSTEM(20),3006,pntr_057,LEV,57,1,0,1,Set Gun 3 Ammunition Count", "ELEC_INTERFACE(1),3014,pntr_123,BTN,123,1,0,,Forward Tank Pump On", "ELEC_INTERFACE(1),3020,pntr_146,BTN,146,1,0,,Pitot and Heating Cover Off", "EZ42_GUNSIGHT(21),3011,pntr_134,TUMB,134,-1,0,1,EZ42 Gunsight Night Lens Filter, ON/OFF", "EZ42_GUNSIGHT(21),3011,pntr_134,TUMB,134,1,0,1,EZ42 Gunsight Night Lens Filter, ON/OFF", "ALTIMETER(10),3001,pntr_034,LEV,34,1,0,1,Altimeter Pressure Set", "FUEL_SYSTEM(6),3009,pntr_162,BTN,162,1,0,1,Primer Pump", "ELEC_INTERFACE(1),3010,pntr_151,BTN,151,1,0,,Instrument Lights, Gun-sight, Indicators, Compass, Starter On", "ELEC_INTERFACE(1),3021,pntr_148,BTN,148,1,0,,FuG25a Off", "CPT_MECH(3),3006,pntr_115,TUMB,115,-1,0,1,Canopy Emergency Release Handle", "CPT_MECH(3),3006,pntr_115,TUMB,115,1,0,1,Canopy Emergency Release Handle", "ELEC_INTERFACE(1),3009,pntr_149,BTN,149,1,0,,FuG16ZY On", "WEAPON_SYSTEM(20),3011,pntr_109,TUMB,109,0.1,0,0.4,Bomb Fusing Selector", "WEAPON_SYSTEM(20),3011,pntr_109,TUMB,109,-0.1,0,0.4,Bomb Fusing Selector", "WEAPON_SYSTEM(20),3012,pntr_092,BTN,92,1,0,1,Jettison Fuselage Stores", "ELEC_INTERFACE(1),3015,pntr_125,BTN,125,1,0,,Rear Tank Pump On", "CONTROL_SYSTEM(8),3003,pntr_064,TUMB,64,-1,0,1,Flaps Landing", "CONTROL_SYSTEM(8),3003,pntr_064,TUMB,64,1,0,1,Flaps Landing", "WEAPON_SYSTEM(20),3007,pntr_060,LEV,60,1,0,1,Set Gun 4 Ammunition Count", "VHF_RADIO(15),3008,pntr_082,LEV,82,0,0,1,Radio Tuning (+/-30 kHz)", "FUEL_SYSTEM(6),3007,pntr_160,TUMB,160,1,-1,1,Cold Start/Wind Screen Washer", "FUEL_SYSTEM(6),3007,pntr_160,TUMB,160,-1,-1,1,Cold Start/Wind Screen Washer", "VHF_RADIO(15),3001,pntr_081,TUMB,81,0.1,0,0.3,Radio Channel Selector", "VHF_RADIO(15),3001,pntr_081,TUMB,81,-0.1,0,0.3,Radio Channel Selector", "ENGINE_SYSTEM(2),3009,pntr_105,BTN,105,1,0.5,1,Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch", "ENGINE_SYSTEM(2),3008,pntr_105,BTN,105,0,0,0.5,Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch", "CLOCK(13),3006,pntr_026,TUMB,26,-1,0,1,Cockpit.Bf109K4.clock_stop", "CLOCK(13),3006,pntr_026,TUMB,26,1,0,1,Cockpit.Bf109K4.clock_stop", "EZ42_GUNSIGHT(21),3012,pntr_191,LEV,191,1,0,1,EZ42 Gunsight Altitude Aiming Correction Adjusting Knob I", "VHF_RADIO(15),3003,pntr_083,LEV,83,0,0,1,Radio Volume", "EZ42_GUNSIGHT(21),3001,pntr_132,TUMB,132,-1,0,1,EZ42 Gunsight Gyro Power Switch, ON/OFF", "EZ42_GUNSIGHT(21),3001,pntr_132,TUMB,132,1,0,1,EZ42 Gunsight Gyro Power Switch, ON/OFF", "VHF_RADIO(15),3006,pntr_084,TUMB,84,-1,0,1,FT FT / Y ZF Mode Switch", "VHF_RADIO(15),3006,pntr_084,TUMB,84,1,0,1,FT FT / Y ZF Mode Switch", "EZ42_GUNSIGHT(21),3004,pntr_135,LEV,135,1,0,1,EZ42 Gunsight Brightness Control", "OXYGEN_SYSTEM(4),3003,pntr_110,LEV,110,0,0,0.5,Oxygen Flow Valve", "IFF(16),3001,pntr_86,TUMB,86,1,-1,1,IFF Channel Selector", "IFF(16),3001,pntr_86,TUMB,86,-1,-1,1,IFF Channel Selector", "LIGHT_SYSTEM(7),3001,pntr_078,LEV,78,0,0,1,Instrument Lights Brightness", "WEAPON_SYSTEM(20),3003,pntr_048,TUMB,48,-1,0,1,Master Arm", "WEAPON_SYSTEM(20),3003,pntr_048,TUMB,48,1,0,1,Master Arm", "CONTROL_SYSTEM(8),3008,pntr_089,TUMB,89,-1,0,1,Landing Gear Emergency Release Handle", "CONTROL_SYSTEM(8),3008,pntr_089,TUMB,89,1,0,1,Landing Gear Emergency Release Handle", "EZ42_GUNSIGHT(21),3002,pntr_131,LEV,131,1,0,1,EZ42 Gunsight Target Wingspan Knob", "CLOCK(13),3008,pntr_028,BTN,28,1,0,1,Cockpit.Bf109K4.clock_stopwatch", "ENGINE_SYSTEM(2),3013,pntr_091,TUMB,91,-1,0,1,MBG Emergency Mode Handle", "ENGINE_SYSTEM(2),3013,pntr_091,TUMB,91,1,0,1,MBG Emergency Mode Handle", "WEAPON_SYSTEM(20),3010,pntr_108,TUMB,108,-1,0,1,Rocket Emergency Release", "WEAPON_SYSTEM(20),3010,pntr_108,TUMB,108,1,0,1,Rocket Emergency Release", "ELEC_INTERFACE(1),3013,pntr_121,BTN,121,1,0,,Navigation Lights On", "CONTROL_SYSTEM(8),3006,pntr_066,TUMB,66,-1,0,1,Landing Gears Retraction Cover", "CONTROL_SYSTEM(8),3006,pntr_066,TUMB,66,1,0,1,Landing Gears Retraction Cover", "REMOTE_COMPASS(14),3001,pntr_43,LEV,43,0,0,1,Course Set", "WEAPON_SYSTEM(20),3005,pntr_054,LEV,54,1,0,1,Set Gun 2 Ammunition Count", "ELEC_INTERFACE(1),3032,pntr_163,BTN,163,1,0,1,Emergency Equipment Destruction", "ELEC_INTERFACE(1),3012,pntr_155,BTN,155,1,0,,Battery On", "ELEC_INTERFACE(1),3022,pntr_150,BTN,150,1,0,,FuG16ZY Off", "ELEC_INTERFACE(1),3028,pntr_124,BTN,124,1,0,,Aft Tank Pump Off", "EZ42_GUNSIGHT(21),3003,pntr_004,LEV,4,1,0,1,EZ42 Gunsight Target Distance Control", "IFF(16),3003,pntr_88,BTN,88,1,0,1,IFF Check", "CPT_MECH(3),3001,pntr_114,LEV,114,0,0,1,Canopy Hand Crank", "ELEC_INTERFACE(1),3023,pntr_152,BTN,152,1,0,,Instrument Lights, Gun-sight, Indicators, Compass, Starter Off", "ELEC_INTERFACE(1),3026,pntr_120,BTN,120,1,0,,Navigation Lights Off", "ELEC_INTERFACE(1),3029,pntr_126,BTN,126,1,0,,Auxiliary Tank Pump Off", "ELEC_INTERFACE(1),3007,pntr_145,BTN,145,1,0,,Pitot and Heating Cover On", "WEAPON_SYSTEM(20),3008,pntr_107,TUMB,107,-1,0,1,Main Rocket Switch", "WEAPON_SYSTEM(20),3008,pntr_107,TUMB,107,1,0,1,Main Rocket Switch", "ELEC_INTERFACE(1),3030,pntr_128,BTN,128,1,0,,MW-50 Off", "ELEC_INTERFACE(1),3008,pntr_147,BTN,147,1,0,,FuG25a On", "ARTIFICIAL_HORIZON(12),3001,pntr_039,LEV,39,0,0.511,1,Horizon Cage", "ELEC_INTERFACE(1),3001,pntr_138,TUMB,138,-1,0,1,Circuit Breakers Cover", "ELEC_INTERFACE(1),3001,pntr_138,TUMB,138,1,0,1,Circuit Breakers Cover", "OXYGEN_SYSTEM(4),3001,pntr_190,TUMB,190,-1,0,1,Oxygen Emergency Knob", "OXYGEN_SYSTEM(4),3001,pntr_190,TUMB,190,1,0,1,Oxygen Emergency Knob", "CONTROL_SYSTEM(8),3013,pntr_159,LEV,159,1,0,1,Radiator Flaps Control", "ENGINE_SYSTEM(2),3011,pntr_200,TUMB,200,-1,0,1,Throttle Lock", "ENGINE_SYSTEM(2),3011,pntr_200,TUMB,200,1,0,1,Throttle Lock", "FUEL_SYSTEM(6),3001,pntr_090,TUMB,90,0.1,0,0.3,Fuel Tank Selector Valve (CLOSE/FORWARD/AFT/BOTH)", "FUEL_SYSTEM(6),3001,pntr_090,TUMB,90,-0.1,0,0.3,Fuel Tank Selector Valve (CLOSE/FORWARD/AFT/BOTH)", "CONTROL_SYSTEM(8),3012,pntr_077,TUMB,77,1,0,1,Stabilizer Trimmer Up/Down", "CONTROL_SYSTEM(8),3012,pntr_077,TUMB,77,0,-1,0,Stabilizer Trimmer Up/Down", "ELEC_INTERFACE(1),3016,pntr_127,BTN,127,1,0,,Auxiliary Tank Pump On", "CLOCK(13),3001,pntr_024,LEV,24,0,0,1,Cockpit.Bf109K4.clock_scale", "FUEL_SYSTEM(6),3003,pntr_161,TUMB,161,-1,0,1,MW-B4 Selector (Not Functional)", "FUEL_SYSTEM(6),3003,pntr_161,TUMB,161,1,0,1,MW-B4 Selector (Not Functional)"],
-    "I-16": ["GEAR_SYSTEM(3),3051,pnt_051,TUMB,51,0,0,1,Gear direction", "GEAR_SYSTEM(3),3051,pnt_051,TUMB,51,1,0,1,Gear direction", "GEAR_SYSTEM(3),3050,pnt_050,TUMB,50,0,0,1,Gear lock", "GEAR_SYSTEM(3),3050,pnt_050,TUMB,50,1,0,1,Gear lock", "GEAR_SYSTEM(3),3055,pnt_055,TUMB,55,0,0,1,Brake spring handle", "GEAR_SYSTEM(3),3055,pnt_055,TUMB,55,1,0,1,Brake spring handle", "MOTOR_SYSTEM(2),3022,pnt_022,TUMB,22,0.334,0,1.002,Magneto", "MOTOR_SYSTEM(2),3022,pnt_022,TUMB,22,-0.334,0,1.002,Magneto", "ELECTRIC_SYSTEM(5),3034,pnt_034,LEV,34,0,0,1,Sight dimmer rheostat", "ELECTRIC_SYSTEM(5),3035,pnt_035,LEV,35,0,0,1,Cockpit light rheostat", "ELECTRIC_SYSTEM(5),3089,pnt_089,BTN,89,1,1,,Torches jettison", "ELECTRIC_SYSTEM(5),3026,pnt_026,TUMB,26,-1,0,1,Accumulator", "ELECTRIC_SYSTEM(5),3026,pnt_026,TUMB,26,1,0,1,Accumulator", "MOTOR_SYSTEM(2),3062,pnt_062,TUMB,62,-1,0,1,Fuel valve", "MOTOR_SYSTEM(2),3062,pnt_062,TUMB,62,1,0,1,Fuel valve", "WEAPON_SYSTEM(7),3060,pnt_060,BTN,60,1,1,,Gun wing left recharge", "WEAPON_SYSTEM(7),3061,pnt_061,BTN,61,1,1,,Gun wing right recharge", "ELECTRIC_SYSTEM(5),3030,pnt_030,BTN,30,1,1,,Fire left torch", "WEAPON_SYSTEM(7),3087,pnt_087,TUMB,87,0.055,0,0.935,Rockets/bombs counter", "WEAPON_SYSTEM(7),3087,pnt_087,TUMB,87,-0.055,0,0.935,Rockets/bombs counter", "MOTOR_SYSTEM(2),3037,pnt_037,TUMB,37,-0.5,0,1,Primary fuel switch", "MOTOR_SYSTEM(2),3037,pnt_037,TUMB,37,0.5,0,1,Primary fuel switch", "COMMON_SYSTEM(1),3066,pnt_066,LEV,66,0,0,1,Set pressure", "MOTOR_SYSTEM(2),3036,pnt_036,BTN,36,1,0.5,1,Starter handle", "MOTOR_SYSTEM(2),3036,pnt_036,BTN,36,0,0.5,0,Starter handle", "ELECTRIC_SYSTEM(5),3025,pnt_025,TUMB,25,-1,0,1,Nav light", "ELECTRIC_SYSTEM(5),3025,pnt_025,TUMB,25,1,0,1,Nav light", "MOTOR_SYSTEM(2),3038,pnt_039,LEV,38,,0,1,Start pump", "WEAPON_SYSTEM(7),3088,pnt_088,TUMB,88,-1,0,1,Rockets/bombs master arm", "WEAPON_SYSTEM(7),3088,pnt_088,TUMB,88,1,0,1,Rockets/bombs master arm", "ELECTRIC_SYSTEM(5),3032,pnt_032,BTN,32,1,1,,Nav light test", "WEAPON_SYSTEM(7),3071,pnt_071,BTN,71,1,1,,Gun nose right recharge", "MOTOR_SYSTEM(2),3033,pnt_033,BTN,33,1,1,,Ratchet relay", "COMMON_SYSTEM(1),3067,pnt_067,TUMB,67,0,0,1,Left door", "COMMON_SYSTEM(1),3067,pnt_067,TUMB,67,1,0,1,Left door", "COMMON_SYSTEM(1),3068,pnt_068,TUMB,68,0,0,1,Right door", "COMMON_SYSTEM(1),3068,pnt_068,TUMB,68,1,0,1,Right door", "COMMON_SYSTEM(1),3069,pnt_069,TUMB,69,0,0,1,Mech sight", "COMMON_SYSTEM(1),3069,pnt_069,TUMB,69,1,0,1,Mech sight", "ELECTRIC_SYSTEM(5),3028,pnt_028,TUMB,28,-1,0,1,Radio", "ELECTRIC_SYSTEM(5),3028,pnt_028,TUMB,28,1,0,1,Radio", "MOTOR_SYSTEM(2),3029,pnt_029,BTN,29,1,1,,Motor shutdown", "COMMON_SYSTEM(1),3700,pnt_700,TUMB,700,0,0,1,Sight filter", "COMMON_SYSTEM(1),3700,pnt_700,TUMB,700,1,0,1,Sight filter", "MOTOR_SYSTEM(2),3064,pnt_064,BTN,64,1,1,,Manual ratchet relay", "COMMON_SYSTEM(1),3040,pnt_040,LEV,40,0,0,1,Course cage knob", "OXYGEN_SYSTEM(6),3074,pnt_074,LEV,74,0,0,1,Oxygen adjusting valve", "OXYGEN_SYSTEM(6),3075,pnt_075,LEV,75,0,0,1,Oxygen emergency valve", "ELECTRIC_SYSTEM(5),3024,pnt_024,TUMB,24,-1,0,1,Pitot heat", "ELECTRIC_SYSTEM(5),3024,pnt_024,TUMB,24,1,0,1,Pitot heat", "COMMON_SYSTEM(1),3065,pnt_065,TUMB,65,0.25,0,1,Seat level", "COMMON_SYSTEM(1),3065,pnt_065,TUMB,65,-0.25,0,1,Seat level", "ELECTRIC_SYSTEM(5),3027,pnt_027,TUMB,27,-1,0,1,Shunt", "ELECTRIC_SYSTEM(5),3027,pnt_027,TUMB,27,1,0,1,Shunt", "WEAPON_SYSTEM(7),3070,pnt_070,BTN,70,1,1,,Gun nose left recharge", "OXYGEN_SYSTEM(6),3076,pnt_076,LEV,76,0,0,1,Oxygen shutoff valve", "ELECTRIC_SYSTEM(5),3031,pnt_031,BTN,31,1,1,,Fire right torch", "MOTOR_SYSTEM(2),3046,pnt_046,TUMB,46,-0.5,0,1,Supercharge speed 1 - 0 - 2", "MOTOR_SYSTEM(2),3046,pnt_046,TUMB,46,0.5,0,1,Supercharge speed 1 - 0 - 2", "ELECTRIC_SYSTEM(5),3023,pnt_023,TUMB,23,-1,0,1,Clock heat", "ELECTRIC_SYSTEM(5),3023,pnt_023,TUMB,23,1,0,1,Clock heat"],
-    "JF-17": ["UFCP(46),3220,PNT_718,BTN,718,1,0,1,UFCP Button R3", "MFCD(47),3243,PNT_741,TUMB,741,-1,0,1,Left MFCD Power", "MFCD(47),3243,PNT_741,TUMB,741,1,0,1,Left MFCD Power", "ENGINE(34),3027,PNT_525,TUMB,525,-1,0,1,Anti-Surge Switch", "ENGINE(34),3027,PNT_525,TUMB,525,1,0,1,Anti-Surge Switch", "MFCD(47),3290,PNT_788,BTN,788,1,0,1,Center MFCD R6", "FUEL(33),3016,PNT_514,TUMB,514,-1,0,1,Feed Cut-off Valve Cover", "FUEL(33),3016,PNT_514,TUMB,514,1,0,1,Feed Cut-off Valve Cover", "MFCD(47),3287,PNT_785,BTN,785,1,0,1,Center MFCD R3", "MFCD(47),3292,PNT_790,BTN,790,1,0,1,Center MFCD R8", "MFCD(47),3302,PNT_800,BTN,800,1,0,1,Right MFCD Sym +", "MFCD(47),3303,PNT_801,BTN,801,1,0,1,Right MFCD Sym -", "MISC(38),3475,PNT_973,TUMB,973,-1,0,1,Eject Seat Firing Handle Safety Pin", "MISC(38),3475,PNT_973,TUMB,973,1,0,1,Eject Seat Firing Handle Safety Pin", "MFCD(47),3312,PNT_810,BTN,810,1,0,1,Right MFCD L3", "INTERCOM(24),3058,PNT_556,BTN,556,1,0,1,Radio Button 8/C", "MFCD(47),3297,PNT_795,BTN,795,1,0,1,Center MFCD D5", "MFCD(47),3314,PNT_812,BTN,812,1,0,1,Right MFCD L5", "MFCD(47),3321,PNT_819,BTN,819,1,0,1,Right MFCD R4", "INTERCOM(24),3057,PNT_555,BTN,555,1,0,1,Radio Button 7/P", "MFCD(47),3251,PNT_749,BTN,749,1,0,1,Left MFCD L8", "ENGINE(34),3063,PNT_561,TUMB,561,-1,0,1,Air Start Button Cover", "ENGINE(34),3063,PNT_561,TUMB,561,1,0,1,Air Start Button Cover", "OXYGEN(31),3478,PNT_976,LEV,976,0,0,1,Oxygen Supply Valve", "MFCD(47),3332,PNT_830,BTN,830,1,0,1,Right MFCD Cont -", "WARNING_SYSTEM(5),3344,PNT_842,BTN,842,1,0,1,Master Warning", "MFCD(47),3238,PNT_736,BTN,736,1,0,1,Left MFCD U1", "WCS(11),3011,PNT_509,TUMB,509,1,-1,1,Weapon Master Arm Switch", "WCS(11),3011,PNT_509,TUMB,509,-1,-1,1,Weapon Master Arm Switch", "CLOCK(49),3348,PNT_846,BTN,846,1,0,1,Digital Clock Brightness +", "ELECTRIC_SYSTEM(1),3407,PNT_905,TUMB,905,-1,0,1,Main AC Gen Switch", "ELECTRIC_SYSTEM(1),3407,PNT_905,TUMB,905,1,0,1,Main AC Gen Switch", "MFCD(47),3280,PNT_778,BTN,778,1,0,1,Center MFCD L4", "INTERCOM(24),3059,PNT_557,BTN,557,1,0,1,Radio Button 9/T", "UFCP(46),3212,PNT_710,BTN,710,1,0,1,UFCP Button L2", "FCS(35),3459,PNT_957,TUMB,957,-1,0,1,Canopy Seal Handle", "FCS(35),3459,PNT_957,TUMB,957,1,0,1,Canopy Seal Handle", "INTERCOM(24),3062,PNT_560,BTN,560,1,0,1,Radio Button ->/ENT", "AAP(7),3415,PNT_913,BTN,913,1,0,1,AAP N/A", "MFCD(47),3325,PNT_823,BTN,823,1,0,1,Right MFCD R8", "SMS(16),3008,PNT_506,TUMB,506,-1,0,1,Ground Jettison Switch", "SMS(16),3008,PNT_506,TUMB,506,1,0,1,Ground Jettison Switch", "LIGHTS(4),3451,PNT_949,TUMB,949,0.2,0,1,Anti-Collision Light Knob Selector", "LIGHTS(4),3451,PNT_949,TUMB,949,-0.2,0,1,Anti-Collision Light Knob Selector", "AAP(7),3419,PNT_917,BTN,917,1,0,1,AAP CLDP", "MFCD(47),3323,PNT_821,BTN,821,1,0,1,Right MFCD R6", "AAP(7),3421,PNT_919,BTN,919,1,0,1,AAP RDR", "UFCP(46),3222,PNT_720,BTN,720,1,0,1,UFCP Button FPM", "UFCP(46),3221,PNT_719,BTN,719,1,0,1,UFCP Button A/P", "UFCP(46),3202,PNT_700,BTN,700,1,0,1,UFCP Button PFL/1", "ENGINE(34),3028,PNT_526,TUMB,526,1,-1,1,Start Mode Selector - START/ENG COLD/STARTER COLD", "ENGINE(34),3028,PNT_526,TUMB,526,-1,-1,1,Start Mode Selector - START/ENG COLD/STARTER COLD",
-        "UFCP(46),3225,PNT_723,BTN,723,1,0,1,UFCP Button N/A", "INTERCOM(24),3053,PNT_551,BTN,551,1,0,1,Radio Button 3/+", "AAP(7),3426,PNT_924,BTN,924,1,0,1,AAP COM2", "AAP(7),3431,PNT_929,BTN,929,1,0,1,AAP WMMC2", "UFCP(46),3205,PNT_703,BTN,703,1,0,1,UFCP Button L1", "CLOCK(49),3351,PNT_849,BTN,849,1,0,1,Digital Clock CHR", "MISC(38),3041,PNT_539,TUMB,539,-1,0,1,Emergency Hydraulic Pump Switch", "MISC(38),3041,PNT_539,TUMB,539,1,0,1,Emergency Hydraulic Pump Switch", "AAP(7),3417,PNT_915,BTN,915,1,0,1,AAP HMD", "INTERCOM(24),3061,PNT_559,BTN,559,1,0,1,Radio Button 0/PRE", "MFCD(47),3275,PNT_773,BTN,773,1,0,1,Center MFCD U5", "AAP(7),3430,PNT_928,BTN,928,1,0,1,AAP WMMC1", "UFCP(46),3233,PNT_731,LEV,731,0,0,1,HUD Backup Reticle Knob", "FCS(35),3034,PNT_532,BTN,532,1,-1,0,Yaw Trim Switch", "FCS(35),3034,PNT_532,BTN,532,-1,0,1,Yaw Trim Switch", "LIGHTS(4),3014,PNT_512,TUMB,512,1,-1,1,Light Switch - Land/Off/Taxi", "LIGHTS(4),3014,PNT_512,TUMB,512,-1,-1,1,Light Switch - Land/Off/Taxi", "WARNING_SYSTEM(5),3346,PNT_844,BTN,844,1,0,1,FCS Warning", "MFCD(47),3326,PNT_824,BTN,824,1,0,1,Right MFCD D1", "AAP(7),3433,PNT_931,BTN,931,1,0,1,AAP CMBT", "UFCP(46),3215,PNT_713,BTN,713,1,0,1,UFCP Button HNS", "AAP(7),3434,PNT_932,BTN,932,1,0,1,AAP TRAIN", "AAP(7),3435,PNT_933,BTN,933,1,0,1,AAP OFF", "MFCD(47),3260,PNT_758,BTN,758,1,0,1,Left MFCD Cont +", "ACP(29),3436,PNT_934,LEV,934,0,0,1,COM1 Volume Knob", "INTERCOM(24),3049,PNT_547,TUMB,547,0.2,0,1,Radio Mode Selector", "INTERCOM(24),3049,PNT_547,TUMB,547,-0.2,0,1,Radio Mode Selector", "ACP(29),3437,PNT_935,TUMB,935,-1,0,1,Intercom Switch", "ACP(29),3437,PNT_935,TUMB,935,1,0,1,Intercom Switch", "MISC(38),3064,PNT_562,TUMB,562,-1,0,1,CSS Handle", "MISC(38),3064,PNT_562,TUMB,562,1,0,1,CSS Handle", "MFCD(47),3259,PNT_757,BTN,757,1,0,1,Left MFCD R8", "INTERCOM(24),3056,PNT_554,BTN,554,1,0,1,Radio Button 6/M", "MFCD(47),3267,PNT_765,BTN,765,1,0,1,Left MFCD Brt +", "MFCD(47),3330,PNT_828,BTN,828,1,0,1,Right MFCD D5", "MFCD(47),3269,PNT_767,BTN,767,1,0,1,Center MFCD Sym +", "MFCD(47),3293,PNT_791,BTN,791,1,0,1,Center MFCD D1", "ECS(30),3445,PNT_943,BTN,943,1,0,1,Defog Switch", "FCS(35),3029,PNT_527,TUMB,527,-1,0,1,Record Switch", "FCS(35),3029,PNT_527,TUMB,527,1,0,1,Record Switch", "LIGHTS(4),3448,PNT_946,LEV,946,0,0,1,Flood Light Knob", "FCS(35),3038,PNT_536,TUMB,536,-1,0,1,AA/AG Switch", "FCS(35),3038,PNT_536,TUMB,536,1,0,1,AA/AG Switch", "AAP(7),3418,PNT_916,BTN,916,1,0,1,AAP SPJ", "DTC(9),3455,PNT_953,BTN,953,1,0,1,DTC Card Insertion", "DTC(9),3476,PNT_974,BTN,974,1,0,1,DTC Card Ejection", "MFCD(47),3317,PNT_815,BTN,815,1,0,1,Right MFCD L8", "MISC(38),3472,PNT_970,TUMB,970,-1,0,1,Stick Show/Hide", "MISC(38),3472,PNT_970,TUMB,970,1,0,1,Stick Show/Hide", "MFCD(47),3244,PNT_742,BTN,742,1,0,1,Left MFCD L1", "FCS(35),3460,PNT_958,TUMB,958,-0.33333333333333,0,1,Canopy Open/Close Handle", "FCS(35),3460,PNT_958,TUMB,958,0.33333333333333,0,1,Canopy Open/Close Handle", "FCS(35),3461,PNT_959,LEV,959,0,0,1,Canopy Manual Open/Close Crank", "LIGHTS(4),3467,PNT_965,LEV,965,0,0,1,Flood Light Direction", "MFCD(47),3283,PNT_781,BTN,781,1,0,1,Center MFCD L7", "FCS(35),3015,PNT_513,TUMB,513,-2,-1,1,Flap Switch - Up/Down", "FCS(35),3015,PNT_513,TUMB,513,2,-1,1,Flap Switch - Up/Down", "LIGHTS(4),3469,PNT_967,LEV,967,0,0,1,Flood Light Direction", "MFCD(47),3301,PNT_799,BTN,799,1,0,1,Center MFCD Brt -", "LIGHTS(4),3470,PNT_968,LEV,968,0,0,1,Flood Light Direction", "(0),3256,PNT_969,TUMB,969,-1,0,1,Flash Light", "(0),3256,PNT_969,TUMB,969,1,0,1,Flash Light", "EMMC(6),10060,PNT_971,BTN,971,1,0,1,A/P Disengage", "MFCD(47),3304,PNT_802,BTN,802,1,0,1,Right MFCD U1", "GEAR(32),3457,PNT_955,TUMB,955,0.25,0,1,Emergency Landing Gear Handle", "GEAR(32),3457,PNT_955,TUMB,955,-0.25,0,1,Emergency Landing Gear Handle", "MFCD(47),3282,PNT_780,BTN,780,1,0,1,Center MFCD L6", "ENGINE(34),3022,PNT_520,TUMB,520,-1,0,1,Air Start Button", "ENGINE(34),3022,PNT_520,TUMB,520,1,0,1,Air Start Button", "MISC(38),3474,PNT_972,TUMB,972,-1,0,1,Eject Seat Safe/Arm Handle", "MISC(38),3474,PNT_972,TUMB,972,1,0,1,Eject Seat Safe/Arm Handle", "MFCD(47),3311,PNT_809,BTN,809,1,0,1,Right MFCD L2", "MFCD(47),3308,PNT_806,BTN,806,1,0,1,Right MFCD U5", "MFCD(47),3281,PNT_779,BTN,779,1,0,1,Center MFCD L5", "OXYGEN(31),3480,PNT_978,TUMB,978,-1,0,1,Eject Seat Emergency O2", "OXYGEN(31),3480,PNT_978,TUMB,978,1,0,1,Eject Seat Emergency O2", "ENGINE(34),3024,PNT_522,TUMB,522,1,-1,1,Engine Mode Switch", "ENGINE(34),3024,PNT_522,TUMB,522,-1,-1,1,Engine Mode Switch", "FCS(35),3033,PNT_531,TUMB,531,-1,0,1,BIT Button", "FCS(35),3033,PNT_531,TUMB,531,1,0,1,BIT Button", "LIGHTS(4),3450,PNT_948,TUMB,948,0.2,0,1,Formation Light Knob Selector", "LIGHTS(4),3450,PNT_948,TUMB,948,-0.2,0,1,Formation Light Knob Selector", "SMS(16),3010,PNT_508,BTN,508,1,0,1,Emergency Jettison Button", "GEAR(32),3012,PNT_510,TUMB,510,1,-1,1,Brake Test", "GEAR(32),3012,PNT_510,TUMB,510,-1,-1,1,Brake Test", "MFCD(47),3237,PNT_735,BTN,735,1,0,1,Left MFCD Sym -", "MFCD(47),3268,PNT_766,BTN,766,1,0,1,Left MFCD Brt -", "GEAR(32),3004,PNT_502,TUMB,502,-1,0,1,Landing Gear Override Button Cover", "GEAR(32),3004,PNT_502,TUMB,502,1,0,1,Landing Gear Override Button Cover", "ACP(29),3438,PNT_936,TUMB,936,-1,0,1,Radio Top/Bottom Antenna Switch", "ACP(29),3438,PNT_936,TUMB,936,1,0,1,Radio Top/Bottom Antenna Switch", "MFCD(47),3266,PNT_764,BTN,764,1,0,1,Left MFCD D5", "MFCD(47),3255,PNT_753,BTN,753,1,0,1,Left MFCD R4", "UFCP(46),3206,PNT_704,BTN,704,1,0,1,UFCP Button R1", "WARNING_SYSTEM(5),3345,PNT_843,BTN,843,1,0,1,Fire Warning", "MISC(38),3065,PNT_563,TUMB,563,-1,0,1,P.H. Test Switch", "MISC(38),3065,PNT_563,TUMB,563,1,0,1,P.H. Test Switch", "UFCP(46),3217,PNT_715,BTN,715,1,0,1,UFCP Button IFF/8", "FUEL(33),3020,PNT_518,TUMB,518,-1,0,1,Fuel Pump Switch", "FUEL(33),3020,PNT_518,TUMB,518,1,0,1,Fuel Pump Switch", "INTERCOM(24),3051,PNT_549,BTN,549,1,0,1,Radio Button 1/TONE", "UFCP(46),3207,PNT_705,BTN,705,1,0,1,UFCP Button OAP", "FCS(35),3046,PNT_544,BTN,544,1,0,1,FCS Reset Button", "AAP(7),3423,PNT_921,BTN,921,1,0,1,AAP OESP", "MFCD(47),3322,PNT_820,BTN,820,1,0,1,Right MFCD R5", "OXYGEN(31),3479,PNT_977,TUMB,977,-1,0,1,Oxygen 100% O2", "OXYGEN(31),3479,PNT_977,TUMB,977,1,0,1,Oxygen 100% O2", "WARNING_SYSTEM(5),3402,PNT_900,TUMB,900,-1,0,1,Warning Panel Day/Night Switch", "WARNING_SYSTEM(5),3402,PNT_900,TUMB,900,1,0,1,Warning Panel Day/Night Switch", "MFCD(47),3310,PNT_808,BTN,808,1,0,1,Right MFCD L1", "ENGINE(34),3073,PNT_571,BTN,571,1,0,1,Throttle Uncage: Stop To Idle", "FCS(35),3235,PNT_733,TUMB,733,1,-1,1,Deploy/Jettison Parachute", "FCS(35),3235,PNT_733,TUMB,733,-1,-1,1,Deploy/Jettison Parachute", "AAP(7),3414,PNT_912,BTN,912,1,0,1,AAP N/A", "MFCD(47),3272,PNT_770,BTN,770,1,0,1,Center MFCD U2", "LIGHTS(4),3452,PNT_950,TUMB,950,1,-1,1,Navigation Light Switch - Bright/Off/Dim", "LIGHTS(4),3452,PNT_950,TUMB,950,-1,-1,1,Navigation Light Switch - Bright/Off/Dim", "MFCD(47),3258,PNT_756,BTN,756,1,0,1,Left MFCD R7", "UFCP(46),3231,PNT_729,LEV,729,0.5,0,1,HUD Brightness Knob", "FUEL(33),3017,PNT_515,TUMB,515,-1,0,1,Feed Cut-off Valve", "FUEL(33),3017,PNT_515,TUMB,515,1,0,1,Feed Cut-off Valve", "UFCP(46),3223,PNT_721,BTN,721,1,0,1,UFCP Button RTN", "UFCP(46),3232,PNT_730,BTN,730,-1,-1,0,+/,/- Switch", "UFCP(46),3232,PNT_730,BTN,730,1,0,1,+/,/- Switch", "UFCP(46),3209,PNT_707,BTN,707,1,0,1,UFCP Button DST/4", "LIGHTS(4),3468,PNT_966,LEV,966,0,0,1,Flood Light Direction", "ZCP(37),3043,PNT_541,TUMB,541,-1,0,1,Ejection Seat Activate Destruct", "ZCP(37),3043,PNT_541,TUMB,541,1,0,1,Ejection Seat Activate Destruct", "GEAR(32),3005,PNT_503,TUMB,503,-1,0,1,Landing Gear Override Button", "GEAR(32),3005,PNT_503,TUMB,503,1,0,1,Landing Gear Override Button", "MFCD(47),3241,PNT_739,BTN,739,1,0,1,Left MFCD U4", "MFCD(47),3291,PNT_789,BTN,789,1,0,1,Center MFCD R7",
-        "AAP(7),3422,PNT_920,BTN,920,1,0,1,AAP SLNK", "ZCP(37),3045,PNT_543,BTN,543,1,0,1,Self Destruct Button", "AAP(7),3425,PNT_923,BTN,923,1,0,1,AAP COM1", "UFCP(46),3226,PNT_724,BTN,724,1,0,1,UFCP Button L4", "FCS(35),3037,PNT_535,TUMB,535,-1,0,1,AG1/AG2 Switch", "FCS(35),3037,PNT_535,TUMB,535,1,0,1,AG1/AG2 Switch", "MFCD(47),3277,PNT_775,BTN,775,1,0,1,Center MFCD L1", "ELECTRIC_SYSTEM(1),3406,PNT_904,TUMB,904,-1,0,1,Battery Switch", "ELECTRIC_SYSTEM(1),3406,PNT_904,TUMB,904,1,0,1,Battery Switch", "MFCD(47),3270,PNT_768,BTN,768,1,0,1,Center MFCD Sym -", "UFCP(46),3216,PNT_714,BTN,714,1,0,1,UFCP Button FUL/7", "MFCD(47),3256,PNT_754,BTN,754,1,0,1,Left MFCD R5", "MFCD(47),3334,PNT_832,BTN,832,1,0,1,Right MFCD Brt -", "UFCP(46),3214,PNT_712,BTN,712,1,0,1,UFCP Button P.U", "MFCD(47),3252,PNT_750,BTN,750,1,0,1,Left MFCD R1", "MFCD(47),3328,PNT_826,BTN,826,1,0,1,Right MFCD D3", "MFCD(47),3240,PNT_738,BTN,738,1,0,1,Left MFCD U3", "MISC(38),3042,PNT_540,TUMB,540,-1,0,1,SHARS Switch", "MISC(38),3042,PNT_540,TUMB,540,1,0,1,SHARS Switch", "CLOCK(49),3349,PNT_847,BTN,847,1,0,1,Digital Clock Brightness -", "MISC(38),3040,PNT_538,BTN,538,1,0,1,Flare Dispense Button", "MFCD(47),3300,PNT_798,BTN,798,1,0,1,Center MFCD Brt +", "MFCD(47),3250,PNT_748,BTN,748,1,0,1,Left MFCD L7", "FUEL(33),3066,PNT_564,TUMB,564,1,-1,1,AAR Switch", "FUEL(33),3066,PNT_564,TUMB,564,-1,-1,1,AAR Switch", "LIGHTS(4),3453,PNT_951,TUMB,951,-2,-1,1,Navigation Light Switch - Flash/Steady", "LIGHTS(4),3453,PNT_951,TUMB,951,2,-1,1,Navigation Light Switch - Flash/Steady", "INTERCOM(24),3054,PNT_552,BTN,552,1,0,1,Radio Button 4/H", "MFCD(47),3278,PNT_776,BTN,776,1,0,1,Center MFCD L2", "FCS(35),3031,PNT_529,TUMB,529,-1,0,1,Yaw/Roll CAS Switch", "FCS(35),3031,PNT_529,TUMB,529,1,0,1,Yaw/Roll CAS Switch", "AAP(7),3429,PNT_927,BTN,927,1,0,1,AAP INS", "INTERCOM(24),3047,PNT_545,LEV,545,0,,,Radio Volume Knob", "UFCP(46),3218,PNT_716,BTN,716,1,0,1,UFCP Button 9", "ENGINE(34),3021,PNT_519,TUMB,519,-1,0,1,Engine Control Switch", "ENGINE(34),3021,PNT_519,TUMB,519,1,0,1,Engine Control Switch", "MFCD(47),3274,PNT_772,BTN,772,1,0,1,Center MFCD U4", "LIGHTS(4),3449,PNT_947,TUMB,947,1,-1,1,Exterior Light Master Switch", "LIGHTS(4),3449,PNT_947,TUMB,947,-1,-1,1,Exterior Light Master Switch", "LIGHTS(4),3466,PNT_964,LEV,964,0,0,1,AAR Light Brightness Knob", "MFCD(47),3316,PNT_814,BTN,814,1,0,1,Right MFCD L7", "ECS(30),3443,PNT_941,TUMB,941,0.083333333333333,0,0.91666666666667,Air Temp Knob Selector", "ECS(30),3443,PNT_941,TUMB,941,-0.083333333333333,0,0.91666666666667,Air Temp Knob Selector", "MFCD(47),3313,PNT_811,BTN,811,1,0,1,Right MFCD L4", "MFCD(47),3285,PNT_783,BTN,783,1,0,1,Center MFCD R1", "MFCD(47),3333,PNT_831,BTN,831,1,0,1,Right MFCD Brt +", "INTERCOM(24),3050,PNT_548,BTN,548,1,0,1,Radio Control Handover", "UFCP(46),3224,PNT_722,BTN,722,1,0,1,UFCP Button 0", "MFCD(47),3246,PNT_744,BTN,744,1,0,1,Left MFCD L3", "MFCD(47),3288,PNT_786,BTN,786,1,0,1,Center MFCD R4", "MFCD(47),3254,PNT_752,BTN,752,1,0,1,Left MFCD R3", "MFCD(47),3294,PNT_792,BTN,792,1,0,1,Center MFCD D2", "WCS(11),3002,PNT_500,TUMB,500,0.33333333333333,0,1,Backup SAIU Knob Selector", "WCS(11),3002,PNT_500,TUMB,500,-0.33333333333333,0,1,Backup SAIU Knob Selector", "UFCP(46),3228,PNT_726,BTN,726,1,0,1,UFCP Button N/A", "UFCP(46),3227,PNT_725,BTN,725,1,0,1,UFCP Button R4", "ENGINE(34),3072,PNT_570,LEV,570,0,,,Throttle Friction Handle", "MFCD(47),3273,PNT_771,BTN,771,1,0,1,Center MFCD U3", "MFCD(47),3318,PNT_816,BTN,816,1,0,1,Right MFCD R1", "MFCD(47),3261,PNT_759,BTN,759,1,0,1,Left MFCD Cont -", "MFCD(47),3306,PNT_804,BTN,804,1,0,1,Right MFCD U3", "ACP(29),3440,PNT_938,LEV,938,0,0,1,COM2 Volume Knob", "MFCD(47),3305,PNT_803,BTN,803,1,0,1,Right MFCD U2", "GEAR(32),3006,PNT_504,LEV,504,0,0,1,Landing Gear Indicator Light Knob", "ENGINE(34),3025,PNT_523,TUMB,523,-1,0,1,SEC EEC Switch", "ENGINE(34),3025,PNT_523,TUMB,523,1,0,1,SEC EEC Switch", "ACP(29),3439,PNT_937,TUMB,937,-1,0,1,Speaker Control Box Channel Antenna Switch", "ACP(29),3439,PNT_937,TUMB,937,1,0,1,Speaker Control Box Channel Antenna Switch", "ACP(29),3442,PNT_940,LEV,940,0,0,1,MSL Volume Knob", "FCS(35),3035,PNT_533,TUMB,533,-1,0,1,Flight Test Switch 1", "FCS(35),3035,PNT_533,TUMB,533,1,0,1,Flight Test Switch 1", "AAP(7),3412,PNT_910,TUMB,910,-1,0,1,HUD Symbology Reject Switch", "AAP(7),3412,PNT_910,TUMB,910,1,0,1,HUD Symbology Reject Switch", "UFCP(46),3203,PNT_701,BTN,701,1,0,1,UFCP Button VRC/2", "AAP(7),3432,PNT_930,BTN,930,1,0,1,AAP SAIU", "MFCD(47),3331,PNT_829,BTN,829,1,0,1,Right MFCD Cont +", "MFCD(47),3295,PNT_793,BTN,793,1,0,1,Center MFCD D3", "ECS(30),3444,PNT_942,TUMB,942,0.33333333333333,0,1,ECS Mode Knob Selector", "ECS(30),3444,PNT_942,TUMB,942,-0.33333333333333,0,1,ECS Mode Knob Selector", "CLOCK(49),3347,PNT_845,TUMB,845,-1,0,1,Digital Clock Switch", "CLOCK(49),3347,PNT_845,TUMB,845,1,0,1,Digital Clock Switch", "INS(18),3410,PNT_908,TUMB,908,0.33333333333333,0,1,INS Mode Knob Selector", "INS(18),3410,PNT_908,TUMB,908,-0.33333333333333,0,1,INS Mode Knob Selector", "AAP(7),3427,PNT_925,BTN,925,1,0,1,AAP NAV", "GEAR(32),3003,PNT_501,BTN,501,1,0,1,Landing Gear Indicator Light Test Button", "MFCD(47),3249,PNT_747,BTN,747,1,0,1,Left MFCD L6", "ENGINE(34),3026,PNT_524,TUMB,524,-1,0,1,Afterburner Switch", "ENGINE(34),3026,PNT_524,TUMB,524,1,0,1,Afterburner Switch", "FCS(35),3030,PNT_528,TUMB,528,-1,0,1,EFCS Switch", "FCS(35),3030,PNT_528,TUMB,528,1,0,1,EFCS Switch", "UFCP(46),3208,PNT_706,BTN,706,1,0,1,UFCP Button MRK", "MFCD(47),3264,PNT_762,BTN,762,1,0,1,Left MFCD D3", "MFCD(47),3262,PNT_760,BTN,760,1,0,1,Left MFCD D1", "UFCP(46),3210,PNT_708,BTN,708,1,0,1,UFCP Button TOT/5", "LIGHTS(4),3465,PNT_963,TUMB,963,-2,-1,1,AAR Light Switch", "LIGHTS(4),3465,PNT_963,TUMB,963,2,-1,1,AAR Light Switch", "AAP(7),3420,PNT_918,BTN,918,1,0,1,AAP IRST", "AAP(7),3416,PNT_914,BTN,914,1,0,1,AAP N/A", "FUEL(33),3019,PNT_517,TUMB,517,-1,0,1,Active Fuel Cut-off Valve", "FUEL(33),3019,PNT_517,TUMB,517,1,0,1,Active Fuel Cut-off Valve", "MFCD(47),3320,PNT_818,BTN,818,1,0,1,Right MFCD R3", "ENGINE(34),3075,PNT_573,BTN,573,1,0,1,Throttle Emergency Button", "MFCD(47),3298,PNT_796,BTN,796,1,0,1,Center MFCD Cont +", "MFCD(47),3299,PNT_797,BTN,797,1,0,1,Center MFCD Cont -", "ACP(29),3441,PNT_939,LEV,939,0,0,1,TCN/ILS Volume Knob", "FCS(35),3036,PNT_534,TUMB,534,-1,0,1,Flight Test Switch 2", "FCS(35),3036,PNT_534,TUMB,534,1,0,1,Flight Test Switch 2", "ZCP(37),3044,PNT_542,TUMB,542,-1,0,1,Self Destruct Button Cover", "ZCP(37),3044,PNT_542,TUMB,542,1,0,1,Self Destruct Button Cover", "LIGHTS(4),3454,PNT_952,TUMB,952,1,-1,1,Light Switch - Tow/Off/Anti-Collision", "LIGHTS(4),3454,PNT_952,TUMB,952,-1,-1,1,Light Switch - Tow/Off/Anti-Collision",
-        "GEAR(32),3007,PNT_505,TUMB,505,-1,0,1,Landing Gear Lever", "GEAR(32),3007,PNT_505,TUMB,505,1,0,1,Landing Gear Lever", "MFCD(47),3263,PNT_761,BTN,761,1,0,1,Left MFCD D2", "MISC(38),3039,PNT_537,TUMB,537,-1,0,1,Flare Dispense Button Cover", "MISC(38),3039,PNT_537,TUMB,537,1,0,1,Flare Dispense Button Cover", "FCS(35),3032,PNT_530,TUMB,530,-1,0,1,Direct Mode Switch", "FCS(35),3032,PNT_530,TUMB,530,1,0,1,Direct Mode Switch", "AAP(7),3428,PNT_926,BTN,926,1,0,1,AAP IFF", "MFCD(47),3329,PNT_827,BTN,827,1,0,1,Right MFCD D4", "FUEL(33),3018,PNT_516,TUMB,516,-1,0,1,Active Fuel Cut-off Valve Cover", "FUEL(33),3018,PNT_516,TUMB,516,1,0,1,Active Fuel Cut-off Valve Cover", "MFCD(47),3265,PNT_763,BTN,763,1,0,1,Left MFCD D4", "MFCD(47),3242,PNT_740,BTN,740,1,0,1,Left MFCD U5", "MFCD(47),3276,PNT_774,TUMB,774,-1,0,1,Center MFCD Power", "MFCD(47),3276,PNT_774,TUMB,774,1,0,1,Center MFCD Power", "ENGINE(34),3023,PNT_521,BTN,521,1,0,1,Ground Start Button", "UFCP(46),3234,PNT_732,LEV,732,0,0,1,UFCP Brightness Knob", "UFCP(46),3213,PNT_711,BTN,711,1,0,1,UFCP Button R2", "MFCD(47),3257,PNT_755,BTN,755,1,0,1,Left MFCD R6", "MFCD(47),3236,PNT_734,BTN,734,1,0,1,Left MFCD Sym +", "AAP(7),3409,PNT_907,TUMB,907,-1,0,1,HUD/MFCD Day/Night Switch", "AAP(7),3409,PNT_907,TUMB,907,1,0,1,HUD/MFCD Day/Night Switch", "ENGINE(34),3074,PNT_572,BTN,572,1,0,1,Throttle Cage: Idle To Stop", "OXYGEN(31),3477,PNT_975,TUMB,975,-1,0,1,Oxygen Tube Connector", "OXYGEN(31),3477,PNT_975,TUMB,975,1,0,1,Oxygen Tube Connector", "INTERCOM(24),3048,PNT_546,TUMB,546,-1,0,1,Squelch OFF/SQL/ACKN", "INTERCOM(24),3048,PNT_546,TUMB,546,1,0,1,Squelch OFF/SQL/ACKN", "INTERCOM(24),3055,PNT_553,BTN,553,1,0,1,Radio Button 5/A", "MFCD(47),3309,PNT_807,TUMB,807,-1,0,1,Right MFCD Power", "MFCD(47),3309,PNT_807,TUMB,807,1,0,1,Right MFCD Power", "MFCD(47),3307,PNT_805,BTN,805,1,0,1,Right MFCD U4", "MFCD(47),3319,PNT_817,BTN,817,1,0,1,Right MFCD R2", "MFCD(47),3253,PNT_751,BTN,751,1,0,1,Left MFCD R2", "UFCP(46),3229,PNT_727,BTN,727,1,0,1,UFCP Button N/A", "MFCD(47),3284,PNT_782,BTN,782,1,0,1,Center MFCD L8", "AAP(7),3413,PNT_911,BTN,911,1,0,1,AAP ACMI", "UFCP(46),3204,PNT_702,BTN,702,1,0,1,UFCP Button 3", "SMS(16),3009,PNT_507,TUMB,507,-1,0,1,Emergency Jettison Button Cover", "SMS(16),3009,PNT_507,TUMB,507,1,0,1,Emergency Jettison Button Cover", "ELECTRIC_SYSTEM(1),3408,PNT_906,TUMB,906,-1,0,1,DC Gen Switch", "ELECTRIC_SYSTEM(1),3408,PNT_906,TUMB,906,1,0,1,DC Gen Switch", "WARNING_SYSTEM(5),3405,PNT_903,LEV,903,0,0,1,Oxygen Indicator Brightness Knob", "INTERCOM(24),3060,PNT_558,BTN,558,1,0,1,Radio Button <-/MAN", "ADC(8),3342,PNT_840,LEV,840,0.5,0,1,BARO Altitude Setting Knob", "MFCD(47),3286,PNT_784,BTN,784,1,0,1,Center MFCD R2", "MFCD(47),3248,PNT_746,BTN,746,1,0,1,Left MFCD L5", "MFCD(47),3327,PNT_825,BTN,825,1,0,1,Right MFCD D2", "INTERCOM(24),3052,PNT_550,BTN,550,1,0,1,Radio Button 2/-", "AAP(7),3411,PNT_909,LEV,909,0,0,1,Brightness Knob", "LIGHTS(4),3447,PNT_945,LEV,945,0,0,1,Console Light Knob", "MFCD(47),3296,PNT_794,BTN,794,1,0,1,Center MFCD D4", "AAP(7),3424,PNT_922,BTN,922,1,0,1,AAP RWR", "MFCD(47),3315,PNT_813,BTN,813,1,0,1,Right MFCD L6", "MFCD(47),3289,PNT_787,BTN,787,1,0,1,Center MFCD R5", "UFCP(46),3219,PNT_717,BTN,717,1,0,1,UFCP Button L3", "LIGHTS(4),3446,PNT_944,LEV,944,0,0,1,Inst. Light Knob", "WARNING_SYSTEM(5),3404,PNT_902,BTN,902,1,0,1,Warning Panel Test Button", "GEAR(32),3013,PNT_511,TUMB,511,-2,-1,1,Brake Park/Norm", "GEAR(32),3013,PNT_511,TUMB,511,2,-1,1,Brake Park/Norm", "MFCD(47),3271,PNT_769,BTN,769,1,0,1,Center MFCD U1", "CLOCK(49),3350,PNT_848,BTN,848,1,0,1,Digital Clock UTC", "GEAR(32),3343,PNT_841,LEV,841,0,0,1,Emergency Brake Handle", "MFCD(47),3245,PNT_743,BTN,743,1,0,1,Left MFCD L2", "UFCP(46),3230,PNT_728,LEV,728,0.5,0,1,HUD Contrast Knob", "WARNING_SYSTEM(5),3403,PNT_901,LEV,901,0,0,1,Warning Panel Brightness Knob", "MFCD(47),3279,PNT_777,BTN,777,1,0,1,Center MFCD L3", "MFCD(47),3247,PNT_745,BTN,745,1,0,1,Left MFCD L4", "UFCP(46),3211,PNT_709,BTN,709,1,0,1,UFCP Button TOD/6", "GEAR(32),3456,PNT_954,TUMB,954,-1,0,1,Emergency Landing Gear Cover", "GEAR(32),3456,PNT_954,TUMB,954,1,0,1,Emergency Landing Gear Cover", "MFCD(47),3324,PNT_822,BTN,822,1,0,1,Right MFCD R7", "MFCD(47),3239,PNT_737,BTN,737,1,0,1,Left MFCD U2"],
-    "Ka-50": ["NAV_INTERFACE(28),3002,GYRO-MAG-MAN-HEADING-PTR,TUMB,229,-0.1,0,0.2,Gyro/Mag/Manual heading", "NAV_INTERFACE(28),3001,GYRO-MAG-MAN-HEADING-PTR,TUMB,229,0.1,0,0.2,Gyro/Mag/Manual heading", "UV_26(22),3013,UV26-TEST-COVER-PTR,TUMB,499,-1,0,1,CMD BIT", "UV_26(22),3013,UV26-TEST-COVER-PTR,TUMB,499,1,0,1,CMD BIT", "AUTOPILOT(33),3005,PPR-DIRUPR-PTR05,BTN,334,1,0,1,Autopilot Director control", "PShK_7(57),3002,N-S-PTR,TUMB,341,1,0,1,North/South latitude selection", "PShK_7(57),3002,N-S-PTR,TUMB,341,-1,0,1,North/South latitude selection", "FUELSYS_INTERFACE(3),3013,PAV-CRANE-COVER-CYKLIZATION-PTR,TUMB,283,1,0,1,Fuel crossfeed valve", "FUELSYS_INTERFACE(3),3013,PAV-CRANE-COVER-CYKLIZATION-PTR,TUMB,283,-1,0,1,Fuel crossfeed valve", "HYDRO_SYS_INTERFACE(5),3001,HYDRO-PTR,TUMB,220,-1,0,1,Main hydraulics", "HYDRO_SYS_INTERFACE(5),3001,HYDRO-PTR,TUMB,220,1,0,1,Main hydraulics", "SPOTLIGHT_SYSTEM(44),3001,LANDING LIGHTS-DIR-LIGHT-PTR,TUMB,382,0.5,0,1,Light landing-search. On/Retraction/Off", "SPOTLIGHT_SYSTEM(44),3001,LANDING LIGHTS-DIR-LIGHT-PTR,TUMB,382,-0.5,0,1,Light landing-search. On/Retraction/Off", "DATALINK(25),3007,PRC-WINGMAN-2-PTR,BTN,18,0.2,0,0.2,DLNK to Wingman 2", "ABRIS(9),3001,PTR_BTN-ABRIS-01,BTN,512,1,0,1,ABRIS Pushbutton 1", "PVI(20),3013,PVI-OP-PTR,BTN,316,0.2,0,0.2,NAV Fixpoints", "ABRIS(9),3004,PTR_BTN-ABRIS-04,BTN,515,1,0,1,ABRIS Pushbutton 4", "EJECT_SYS_INTERFACE(6),3003,RIGHT-EMERG-SW3-PTR,TUMB,216,-1,0,1,Ejecting system power 3", "EJECT_SYS_INTERFACE(6),3003,RIGHT-EMERG-SW3-PTR,TUMB,216,1,0,1,Ejecting system power 3", "UV_26(22),3012,UV26-POWER-COVER-PTR,TUMB,497,-1,0,1,CMD Power", "UV_26(22),3012,UV26-POWER-COVER-PTR,TUMB,497,1,0,1,CMD Power", "SHKVAL(8),3003,PUR-CONTRAST-PTR,LEV,407,0.05,0,1,IT-23 display contrast", "DATALINK(25),3015,DTLK-MASTER-MODES-PTR,TUMB,329,0.1,0,0.3,Datalink Master mode", "DATALINK(25),3015,DTLK-MASTER-MODES-PTR,TUMB,329,-0.1,0,0.3,Datalink Master mode", "ENGINE_INTERFACE(4),3004,ERD-RIGHT-COVER-PTR,TUMB,293,-1,0,1,EEG Right engine Electronic Engine Governor", "ENGINE_INTERFACE(4),3004,ERD-RIGHT-COVER-PTR,TUMB,293,1,0,1,EEG Right engine Electronic Engine Governor", "FUELSYS_INTERFACE(3),3012,PAV-CRANE-CYKLIZATION-PTR,TUMB,282,1,0,1,Fuel crossfeed valve", "FUELSYS_INTERFACE(3),3012,PAV-CRANE-CYKLIZATION-PTR,TUMB,282,-1,0,1,Fuel crossfeed valve", "ENGINE_INTERFACE(4),3013,POS-ROTORS-PTR,TUMB,153,1,0,1,Rotor de-icing system switch", "ENGINE_INTERFACE(4),3013,POS-ROTORS-PTR,TUMB,153,-1,0,1,Rotor de-icing system switch", "ENGINE_INTERFACE(4),3020,RT-12-6-RIGHT-PTR,BTN,458,1,0,1,Right EGT control threshold governor button", "ELEC_INTERFACE(2),3005,ENERG-AKK1-PTR,TUMB,264,1,0,1,Battery 1", "ELEC_INTERFACE(2),3005,ENERG-AKK1-PTR,TUMB,264,-1,0,1,Battery 1", "WEAP_INTERFACE(12),3010,PVR-ADV-PTR,BTN,437,1,0,1,Automatic turn on target mode", "PVI(20),3002,PVI-1-PTR,BTN,303,0.2,0,0.2,NAV '1' Btn", "UV_26(22),3005,UV26-BURST-PTR,BTN,39,1,0,1,CMD Num in sequence", "ELEC_INTERFACE(2),3011,CONVERTER-PTR,TUMB,270,0.1,0,0.2,DC/AC inverter", "ELEC_INTERFACE(2),3010,CONVERTER-PTR,TUMB,270,-0.1,0,0.2,DC/AC inverter", "FUELSYS_INTERFACE(3),3011,PAV-CRANE-COVER-VSU-PTR,TUMB,281,1,0,1,APU fuel shutoff valve", "FUELSYS_INTERFACE(3),3011,PAV-CRANE-COVER-VSU-PTR,TUMB,281,-1,0,1,APU fuel shutoff valve", "PVI(20),3028,PVI_I251V_PTR,TUMB,325,1,0,1,NAV INU fixtaking method", "PVI(20),3028,PVI_I251V_PTR,TUMB,325,-1,0,1,NAV INU fixtaking method", "PVI(20),3012,PVI-PZ-PTR,BTN,519,0.2,0,0.2,NAV Inflight INU Realignment", "ENGINE_INTERFACE(4),3007,START-PANEL-STOP-START-PTR01,BTN,414,1,0,1,Stop APU button", "DATALINK(25),3013,PRC-TARGET-POINT-PTR,BTN,50,0.2,0,0.2,DLNK Ingress point", "PVI(20),3006,PVI-5-PTR,BTN,307,0.2,0,0.2,NAV '5' Btn", "LASERRANGER(11),3002,LD-LDP-COVER-PTR,TUMB,57,-1,0,1,Laser rangefinder / designator - mode switch", "LASERRANGER(11),3002,LD-LDP-COVER-PTR,TUMB,57,1,0,1,Laser rangefinder / designator - mode switch", "K041(59),3002,K-041-PTR,TUMB,433,1,0,1,K-041 Targeting-navigation system power switch", "K041(59),3002,K-041-PTR,TUMB,433,-1,0,1,K-041 Targeting-navigation system power switch", "UV_26(22),3007,UV26-START-PTR,BTN,43,1,0,1,CMD Start dispense", "FUELSYS_INTERFACE(3),3001,FUEL-PUMP-FRONT-PTR,TUMB,271,1,0,1,Forward fuel tank pumps", "FUELSYS_INTERFACE(3),3001,FUEL-PUMP-FRONT-PTR,TUMB,271,-1,0,1,Forward fuel tank pumps", "ELEC_INTERFACE(2),3006,ENERG-COVER-AKK1-PTR,TUMB,265,1,0,1,Battery 1", "ELEC_INTERFACE(2),3006,ENERG-COVER-AKK1-PTR,TUMB,265,-1,0,1,Battery 1", "UV_26(22),3010,UV26-POWER-PTR,TUMB,496,1,0,1,CMD Power", "UV_26(22),3010,UV26-POWER-PTR,TUMB,496,-1,0,1,CMD Power", "SHKVAL(8),3007,WIPER-PTR,BTN,224,1,0,1,SHKVAL windscreen wiper", "LASER_WARNING_SYSTEM(36),3003,L140-CNOB,BTN,584,1,0,1,LWS self-test button", "EJECT_SYS_INTERFACE(6),3002,RIGHT-EMERG-SW2-PTR,TUMB,215,-1,0,1,Ejecting system power 2", "EJECT_SYS_INTERFACE(6),3002,RIGHT-EMERG-SW2-PTR,TUMB,215,1,0,1,Ejecting system power 2", "(0),3009,BRIGHTNESS-PTR,LEV,126,0.04,0,1,Brightness", "AUTOPILOT(33),3002,PPR-N-PTR03,BTN,332,1,0,1,Autopilot Heading hold", "ENGINE_INTERFACE(4),3008,START-ENGINE-SELECTOR-PTR,TUMB,416,-0.1,0,0.3,Engine selector", "ENGINE_INTERFACE(4),3008,START-ENGINE-SELECTOR-PTR,TUMB,416,0.1,0,0.3,Engine selector", "ENGINE_INTERFACE(4),3022,CONTROL-TEMP-WORK-PTR,BTN,131,1,0,1,Running engines exhaust gas temperature indicator test button", "WEAP_INTERFACE(12),3020,MT-PTR,TUMB,398,1,0,1,Cannon rate of fire setting", "WEAP_INTERFACE(12),3020,MT-PTR,TUMB,398,-1,0,1,Cannon rate of fire setting", "ENGINE_INTERFACE(4),3012,START-PANEL-ROLLING-PTR,TUMB,415,-0.1,0,0.2,Engine Startup/Crank/False Start selector", "ENGINE_INTERFACE(4),3012,START-PANEL-ROLLING-PTR,TUMB,415,0.1,0,0.2,Engine Startup/Crank/False Start selector", "PPK(32),3004,KCVM-PTR,TUMB,486,-1,0,1,Control computers BIT switch", "PPK(32),3004,KCVM-PTR,TUMB,486,1,0,1,Control computers BIT switch", "PPK(32),3010,FKP-PTR,TUMB,492,1,0,1,Video Tape Recorder switch", "PPK(32),3010,FKP-PTR,TUMB,492,-1,0,1,Video Tape Recorder switch", "UV_26(22),3009,UV26-STOP-PTR,BTN,40,1,0,1,CMD Stop dispense", "ELEC_INTERFACE(2),3001,ENERG-AER-RIT-PTR,TUMB,262,1,0,1,DC ground power", "ELEC_INTERFACE(2),3001,ENERG-AER-RIT-PTR,TUMB,262,-1,0,1,DC ground power", "MISC_SYSTEMS_INTERFACE(41),3005,ALTIMETER-BARO-PTR,LEV,90,0.001,0,1,Baro pressure QFE knob", "AUTOPILOT(33),3004,PPR-V-PTR04,BTN,333,1,0,1,Autopilot Altitude hold", "FIRE_EXTING_INTERFACE(40),3001,PUI800-AVARCHOP-PTR01,BTN,236,1,0,1,Left engine extinguisher", "ENGINE_INTERFACE(4),3010,EMERGENCY-BRAKE ENGINE-RIGHT-PTR,TUMB,55,-1,0,1,Right engine cut-off valve", "ENGINE_INTERFACE(4),3010,EMERGENCY-BRAKE ENGINE-RIGHT-PTR,TUMB,555,1,0,1,Right engine cut-off valve", "WEAP_INTERFACE(12),3021,MASTER-UNLOAD-PTR,BTN,397,1,0,1,Expedite emergency ATGM launch", "ABRIS(9),3005,PTR_BTN-ABRIS-05,BTN,516,1,0,1,ABRIS Pushbutton 5", "DATALINK(25),3008,PRC-WINGMAN-3-PTR,BTN,19,0.2,0,0.2,DLNK to Wingman 3", "PVI(20),3029,PVI-BRIGHTNESS-PTR,LEV,327,0.001,0,1,NAV Brightness", "DATALINK(25),3018,COMM-PWR-UKV-TLK-PTR,TUMB,288,1,0,1,Radio equipment datalink UHF TLK power switch", "DATALINK(25),3018,COMM-PWR-UKV-TLK-PTR,TUMB,288,-1,0,1,Radio equipment datalink UHF TLK power switch", "UV_26(22),3004,UV26-SERIES-PTR,BTN,38,1,0,1,CMD Num of sequences", "ENGINE_INTERFACE(4),3018,PAV-CRANE-COVER-VSU-PTR02,TUMB,570,-1,0,1,EEG power turbine channel 1 test â Operate â EEG power turbine channel 2 test, three-switch contactor", "ENGINE_INTERFACE(4),3018,PAV-CRANE-COVER-VSU-PTR02,TUMB,570,1,0,1,EEG power turbine channel 1 test â Operate â EEG power turbine channel 2 test, three-switch contactor", "PVI(20),3003,PVI-2-PTR,BTN,304,0.2,0,0.2,NAV '2' Btn", "DATALINK(25),3004,PRC-CLEAN-PTR,BTN,15,0.2,0,0.2,N/A", "NAVLIGHT_SYSTEM(45),3003,FLASHER-PTR,TUMB,228,1,0,1,Anticollision Light", "NAVLIGHT_SYSTEM(45),3003,FLASHER-PTR,TUMB,228,-1,0,1,Anticollision Light", "WEAP_INTERFACE(12),3018,SUO-PTR,TUMB,547,1,0,1,Weapons Ñontrol system", "WEAP_INTERFACE(12),3018,SUO-PTR,TUMB,547,-1,0,1,Weapons Ñontrol system", "(0),3007,COMM-PWR-SA-TLF-PTR,TUMB,289,1,0,1,Radio equipment datalink SA-TLF power switch", "(0),3007,COMM-PWR-SA-TLF-PTR,TUMB,289,-1,0,1,Radio equipment datalink SA-TLF power switch", "IFF(42),3001,SRO-PTR,TUMB,218,1,0,1,IFF power", "IFF(42),3001,SRO-PTR,TUMB,218,-1,0,1,IFF power", "PVI(20),3010,PVI-9-PTR,BTN,311,0.2,0,0.2,NAV '9' Btn", "FUELSYS_INTERFACE(3),3007,PAV-CRANE-COVER-ENGINE-LEFT-PTR,TUMB,277,1,0,1,Left engine fuel shutoff valve", "FUELSYS_INTERFACE(3),3007,PAV-CRANE-COVER-ENGINE-LEFT-PTR,TUMB,277,-1,0,1,Left engine fuel shutoff valve", "WEAP_INTERFACE(12),3002,PUI800-AVARSTART-PTR,BTN,401,1,0,1,Not implemented", "ENGINE_INTERFACE(4),3009,EMERGENCY-BRAKE ENGINE-LEFT-PTR,TUMB,554,-1,0,1,Left engine cut-off valve", "ENGINE_INTERFACE(4),3009,EMERGENCY-BRAKE ENGINE-LEFT-PTR,TUMB,554,1,0,1,Left engine cut-off valve", "FIRE_EXTING_INTERFACE(40),3013,EXTING-GROUPS-CTRL-03,BTN,251,0.3,0,0.3,3rd fire warning sensors group BIT", "SPOTLIGHT_SYSTEM(44),3002,LANDING LIGHTS-BASE-RESERV-PTR,TUMB,383,-1,0,1,Lights landing-search change. Main/Reserved", "SPOTLIGHT_SYSTEM(44),3002,LANDING LIGHTS-BASE-RESERV-PTR,TUMB,383,1,0,1,Lights landing-search change. Main/Reserved", "WEAP_INTERFACE(12),3012,PVR-PPS-PTR,BTN,439,1,0,1,Forward hemisphere (head-on) air target aspect", "(0),3008,FEEDING-OZH-PTR,TUMB,148,1,0,1,Windshield washer fluid switch", "(0),3008,FEEDING-OZH-PTR,TUMB,148,-1,0,1,Windshield washer fluid switch", "R_800(48),3011,COMM-PWR-UKV-2-PTR,TUMB,286,1,0,1,VHF-2 (R-800) power switch", "R_800(48),3011,COMM-PWR-UKV-2-PTR,TUMB,286,-1,0,1,VHF-2 (R-800) power switch", "CPT_MECH(34),3002,P-CONTR-VMG-HYDRO-PTR,TUMB,452,1,0,1,Power plant, hydraulics, EKRAN self-test systems switch", "CPT_MECH(34),3002,P-CONTR-VMG-HYDRO-PTR,TUMB,452,-1,0,1,Power plant, hydraulics, EKRAN self-test systems switch", "WEAP_INTERFACE(12),3006,PUI800-OFBR-PTR,TUMB,399,1,0,1,Cannon round selector switch HE/AP",
-        "WEAP_INTERFACE(12),3006,PUI800-OFBR-PTR,TUMB,399,-1,0,1,Cannon round selector switch HE/AP", "PVI(20),3015,PVI-AER-PTR,BTN,317,0.2,0,0.2,NAV Airfields", "ACCELEROMETER(61),3001,G--PTR,BTN,572,1,0,1,Accelerometer reset", "ARK_22(46),3004,TLF-TLG-PTR01,TUMB,356,-1,0,1,COMPASS-ANTENNA modes", "ARK_22(46),3004,TLF-TLG-PTR01,TUMB,356,1,0,1,COMPASS-ANTENNA modes", "ABRIS(9),3007,ABRIS_SHUNT_PTR,BTN,523,1,0,1,ABRIS Cursor Ñontrol (rot/push)", "ABRIS(9),3006,ABRIS_SHUNT_PTR,LEV,518,0.04,0,1,ABRIS Cursor Ñontrol (rot/push)", "DATALINK(25),3017,COMM-PWR-TLK-PTR,TUMB,287,1,0,1,Radio equipment datalink TLK power switch", "DATALINK(25),3017,COMM-PWR-TLK-PTR,TUMB,287,-1,0,1,Radio equipment datalink TLK power switch", "ARK_22(46),3005,TLF-TLG-PTR,TUMB,354,-1,0,1,TLF-TLG modes", "ARK_22(46),3005,TLF-TLG-PTR,TUMB,354,1,0,1,TLF-TLG modes", "SYST_CONTROLLER(14),3004,BKO-PTR,TUMB,49,1,0,1,MWS operation mode (not functional)", "SYST_CONTROLLER(14),3004,BKO-PTR,TUMB,49,-1,0,1,MWS operation mode (not functional)", "UV_26(22),3003,UV26-PROGR-PTR,TUMB,37,0.1,0,0.1,CMD Amount flares counter/Programming", "UV_26(22),3003,UV26-PROGR-PTR,TUMB,37,-0.1,0,0.1,CMD Amount flares counter/Programming", "ARK_22(46),3007,ARK-CONTROL-PTR,BTN,355,1,0,1,ADF Test", "R_800(48),3004,CONTR-RADIO-ARK-PTR,TUMB,422,1,0,1,R-800 (VHF-2) ADF switch", "R_800(48),3004,CONTR-RADIO-ARK-PTR,TUMB,422,-1,0,1,R-800 (VHF-2) ADF switch", "R_800(48),3006,CONTR-RADIO-PSH-PTR,TUMB,423,1,0,1,R-800 (VHF-2) Squelch", "R_800(48),3006,CONTR-RADIO-PSH-PTR,TUMB,423,-1,0,1,R-800 (VHF-2) Squelch", "VMS(13),3004,SPEECH-BIT-PTR,BTN,442,1,0,1,Voice message system check", "R_800(48),3007,CONTROLLER-FREQ-1-PTR,TUMB,-1,1,-1,1,R-800 (VHF-2) 1st rotary", "R_800(48),3007,CONTROLLER-FREQ-1-PTR,TUMB,-1,-1,-1,1,R-800 (VHF-2) 1st rotary", "ARK_22(46),3002,VARK-VOLUME-PTR01,TUMB,357,0.1,0,0.9,ADF channel switch", "ARK_22(46),3001,VARK-VOLUME-PTR01,TUMB,357,-0.1,0,0.9,ADF channel switch", "LASERRANGER(11),3001,PVR-IZL-PTR,TUMB,435,1,0,1,Laser standby ON/OFF switch", "LASERRANGER(11),3001,PVR-IZL-PTR,TUMB,435,-1,0,1,Laser standby ON/OFF switch", "ILLUMINATION_INTERFACE(51),3008,BRIGHT-DEV-PTR,LEV,507,0.1,0,1,Lighting night vision cockpit brightness knob", "AUTOPILOT(33),3003,PPR-T-PTR02,BTN,331,1,0,1,Autopilot Pitch hold", "R_800(48),3008,CONTROLLER-FREQ-2-PTR,TUMB,-1,1,-1,1,R-800 (VHF-2) 2nd rotary", "R_800(48),3008,CONTROLLER-FREQ-2-PTR,TUMB,-1,-1,-1,1,R-800 (VHF-2) 2nd rotary", "R_828(49),3003,ASU-PTR,BTN,373,1,0,1,R-828 (VHF-1) Tuner button", "SIGNAL_FLARE_DISPENSER(52),3001,SIGNAL-FLARE-2-PTR,TUMB,377,-1,0,1,Signal flare green", "SIGNAL_FLARE_DISPENSER(52),3001,SIGNAL-FLARE-2-PTR,TUMB,377,1,0,1,Signal flare green", "SIGNAL_FLARE_DISPENSER(52),3004,SIGNAL-FLARE-4-PTR,TUMB,379,-1,0,1,Signal flare yellow", "SIGNAL_FLARE_DISPENSER(52),3004,SIGNAL-FLARE-4-PTR,TUMB,379,1,0,1,Signal flare yellow", "WEAP_INTERFACE(12),3003,PUI800-AVARCHOP-PTR,BTN,402,1,0,1,External stores jettison", "SIGNAL_FLARE_DISPENSER(52),3005,SIGNAL-FLARE-SWITCH-PTR,TUMB,380,1,0,1,Signal flare system power", "SIGNAL_FLARE_DISPENSER(52),3005,SIGNAL-FLARE-SWITCH-PTR,TUMB,380,-1,0,1,Signal flare system power", "UV_26(22),3006,UV26-INTERVAL-PTR,BTN,41,1,0,1,CMD Dispense interval", "PVI(20),3016,PVI-HB-PTR,BTN,521,0.2,0,0.2,NAV Normal INU Alignment", "DATALINK(25),3011,PRC-TARGET-2-PTR,BTN,22,0.2,0,0.2,DLNK Target #2/SAM", "DATALINK(25),3006,PRC-WINGMAN-1-PTR,BTN,17,0.2,0,0.2,DLNK to Wingman 1", "ENGINE_INTERFACE(4),3002,ERD-LEFT-COVER-PTR,TUMB,291,-1,0,1,EEG Left engine Electronic Engine Governor", "ENGINE_INTERFACE(4),3002,ERD-LEFT-COVER-PTR,TUMB,291,1,0,1,EEG Left engine Electronic Engine Governor", "WEAP_INTERFACE(12),3011,PVR-VC-PTR,BTN,438,1,0,1,Airborne Target", "IFF(42),3002,COVER-SRO-PTR,TUMB,219,-1,0,1,IFF power", "IFF(42),3002,COVER-SRO-PTR,TUMB,219,1,0,1,IFF power", "SPU_9(50),3001,COMM-PWR-AVSK-PTR,TUMB,284,1,0,1,Intercom", "SPU_9(50),3001,COMM-PWR-AVSK-PTR,TUMB,284,-1,0,1,Intercom", "NAVLIGHT_SYSTEM(45),3001,CONTUR-LIGHT-PTR,TUMB,296,1,0,1,Tip Lights", "NAVLIGHT_SYSTEM(45),3001,CONTUR-LIGHT-PTR,TUMB,296,-1,0,1,Tip Lights", "FUELSYS_INTERFACE(3),3005,FUEL-METER-PTR,TUMB,275,1,0,1,Fuelmeter power", "FUELSYS_INTERFACE(3),3005,FUEL-METER-PTR,TUMB,275,-1,0,1,Fuelmeter power", "WEAP_INTERFACE(12),3017,PVR-AS-PM-PTR,TUMB,436,1,0,1,Automatic Tracking / gun sight", "WEAP_INTERFACE(12),3017,PVR-AS-PM-PTR,TUMB,436,-1,0,1,Automatic Tracking / gun sight", "ELEC_INTERFACE(2),3002,ENERG-COVER-AER-RIT-PTR,TUMB,263,1,0,1,DC ground power", "ELEC_INTERFACE(2),3002,ENERG-COVER-AER-RIT-PTR,TUMB,263,-1,0,1,DC ground power", "STBY_ADI(55),3003,RES-AGD-PTR,LEV,597,1,0,1,Standby Attitude Indicator Cage/control test handle", "STBY_ADI(55),3002,RES-AGD-PTR,BTN,141,-1,-1,0,Standby Attitude Indicator Cage/control test handle", "STBY_ADI(55),3001,RES-AGD-PTR,BTN,141,1,0,1,Standby Attitude Indicator Cage/control test handle", "WEAP_INTERFACE(12),3009,PVR-DRILL-PTR,TUMB,432,1,0,1,Training mode", "WEAP_INTERFACE(12),3009,PVR-DRILL-PTR,TUMB,432,-1,0,1,Training mode", "ENGINE_INTERFACE(4),3001,ERD-LEFT-PTR,TUMB,290,1,0,1,EEG Left engine Electronic Engine Governor", "ENGINE_INTERFACE(4),3001,ERD-LEFT-PTR,TUMB,290,-1,0,1,EEG Left engine Electronic Engine Governor", "LASERRANGER(11),3003,LDP-LD-PTR,TUMB,56,-1,0,1,Laser rangefinder / designator - mode switch", "LASERRANGER(11),3003,LDP-LD-PTR,TUMB,56,1,0,1,Laser rangefinder / designator - mode switch", "SPU_9(50),3002,RADIO-RATE-PTR,TUMB,428,0.11,0,0.33,SPU-9 Radio communicator selector", "SPU_9(50),3002,RADIO-RATE-PTR,TUMB,428,-0.11,0,0.33,SPU-9 Radio communicator selector", "PPK(32),3009,ROPE-PTR,TUMB,491,1,0,1,Stabilisation and indication of hanger cable switch", "PPK(32),3009,ROPE-PTR,TUMB,491,-1,0,1,Stabilisation and indication of hanger cable switch", "SIGNAL_FLARE_DISPENSER(52),3003,SIGNAL-FLARE-3-PTR,TUMB,378,-1,0,1,Signal flare white", "SIGNAL_FLARE_DISPENSER(52),3003,SIGNAL-FLARE-3-PTR,TUMB,378,1,0,1,Signal flare white", "PVI(20),3020,PVI-KC-PTR,BTN,522,0.2,0,0.2,NAV Initial Nav Pos", "HELMET(23),3001,PUR-LIGHTNVU-PTR,LEV,405,0.05,0,1,Helmet device brightness", "HELMET(23),3002,PVR-OBZ-PTR,TUMB,434,1,0,1,Helmet-mounted sight system power switch", "HELMET(23),3002,PVR-OBZ-PTR,TUMB,434,-1,0,1,Helmet-mounted sight system power switch", "VMS(13),3001,SPEECH-INFO-OFF-PTR01,BTN,384,1,0,1,Voice message system messages off", "DATALINK(25),3001,PRC-SEND-PTR,BTN,159,0.2,0,0.2,DLNK Send/Memory", "ILLUMINATION_INTERFACE(51),3005,P-CONTR-ILLUM-PTR,TUMB,450,-1,0,1,Lighting auxiliary panel switch", "ILLUMINATION_INTERFACE(51),3005,P-CONTR-ILLUM-PTR,TUMB,450,1,0,1,Lighting auxiliary panel switch", "FIRE_EXTING_INTERFACE(40),3011,EXTING-GROUPS-CTRL-01,BTN,251,0.1,0,0.1,1st fire warning sensors group BIT", "ELEC_INTERFACE(2),3009,GEN-RIGHT-PTR,TUMB,269,1,0,1,AC right generator", "ELEC_INTERFACE(2),3009,GEN-RIGHT-PTR,TUMB,269,-1,0,1,AC right generator", "ENGINE_INTERFACE(4),3014,POS-ENGINE-PZU-PTR,TUMB,154,0.5,0,1,Engines de-icing / dust-protection systems switch", "ENGINE_INTERFACE(4),3014,POS-ENGINE-PZU-PTR,TUMB,154,-0.5,0,1,Engines de-icing / dust-protection systems switch", "PVI(20),3005,PVI-4-PTR,BTN,306,0.2,0,0.2,NAV '4' Btn", "PShK_7(57),3001,LATITUDE-PTR,LEV,340,0.12,0,1,Latitude selection rotaty", "ENGINE_INTERFACE(4),3019,RT-12-6-LEFT-PTR,BTN,457,1,0,1,Left EGT control threshold governor button", "PVI(20),3022,PVI-FIZ-PTR,BTN,320,0.2,0,0.2,NAV Course:Course Deviation/Time/Range to WPT", "PVI(20),3025,PVI-ACDC-PTR,BTN,323,0.2,0,0.2,NAV Bearing/Range to target", "HUD(7),3001,PTR_HUD-BRIGHTNESS,LEV,8,0.05,0,1,HUD Brightness", "PVI(20),3014,PVI-TB-PTR,BTN,520,0.2,0,0.2,NAV Precise INU Alignment", "RADAR_ALTIMETER(38),3002,TEST-RADIO-HIGHT-PTR,BTN,96,1,0,1,Radar altimeter test", "C061K(15),3002,HEAT_IKV-PTR,TUMB,488,1,0,1,INU Heater switch", "C061K(15),3002,HEAT_IKV-PTR,TUMB,488,-1,0,1,INU Heater switch", "RADAR_ALTIMETER(38),3001,ROTARY-DANGEROUS-HIGHT-PTR,LEV,91,0.1,0,1,Dangerous RALT set rotary", "PVI(20),3007,PVI-6-PTR,BTN,308,0.2,0,0.2,NAV '6' Btn", "R_800(48),3001,START-PANEL-CONTROL-PTR,BTN,418,1,0,1,R-800 (VHF-2) BIT button", "ILLUMINATION_INTERFACE(51),3003,AGR-PKP-PTR,TUMB,298,1,0,1,Lighting ADI and SAI switch", "ILLUMINATION_INTERFACE(51),3003,AGR-PKP-PTR,TUMB,298,-1,0,1,Lighting ADI and SAI switch", "DATALINK(25),3010,PRC-TARGET-1-PTR,BTN,21,0.2,0,0.2,DLNK Target #1/Vehicle", "HUD(7),3003,PTR-HUD-TEST,BTN,7,1,0,1,HUD Test", "UV_26(22),3008,UV26-CANCELPRG-PTR,BTN,42,1,0,1,CMD Reset to default program", "R_800(48),3003,CONTR-RADIO-AP-PTR,TUMB,421,1,0,1,R-800 (VHF-2) Emergency receiver", "R_800(48),3003,CONTR-RADIO-AP-PTR,TUMB,421,-1,0,1,R-800 (VHF-2) Emergency receiver", "WEAP_INTERFACE(12),3015,PVR-MODE-PTR,TUMB,431,0.1,0,0.4,Weapon system mode selector", "WEAP_INTERFACE(12),3014,PVR-MODE-PTR,TUMB,431,-0.1,0,0.4,Weapon system mode selector", "MISC_SYSTEMS_INTERFACE(41),3001,PUR-OGR-INF-PTR,TUMB,409,1,0,1,HUD/TV declutter switch", "MISC_SYSTEMS_INTERFACE(41),3001,PUR-OGR-INF-PTR,TUMB,409,-1,0,1,HUD/TV declutter switch", "MISC_SYSTEMS_INTERFACE(41),3004,HANGER-PTR,TUMB,259,-1,0,1,Sling load Auto/Manual", "MISC_SYSTEMS_INTERFACE(41),3004,HANGER-PTR,TUMB,259,1,0,1,Sling load Auto/Manual", "STBY_ADI(55),3004,RES-AG-PTR,TUMB,230,1,0,1,Standby Attitude Indicator power switch", "STBY_ADI(55),3004,RES-AG-PTR,TUMB,230,-1,0,1,Standby Attitude Indicator power switch", "ILLUMINATION_INTERFACE(51),3006,P-CONTR-BRIGHT-PTR,LEV,451,0.1,0,1,Lighting auxiliary panel brightness knob", "DATALINK(25),3014,DTLK-SELF-ID-PTR,TUMB,328,0.1,0,0.3,Datalink self ID", "DATALINK(25),3014,DTLK-SELF-ID-PTR,TUMB,328,-0.1,0,0.3,Datalink self ID", "ARK_22(46),3003,IANDING LIGHTS-DIR-LIGHT-PTR01,TUMB,381,0.5,0,1,ADF Inner-Auto-Outer NDB switch", "ARK_22(46),3003,IANDING LIGHTS-DIR-LIGHT-PTR01,TUMB,381,-0.5,0,1,ADF Inner-Auto-Outer NDB switch", "LASERRANGER(11),3004,CHOP-LDP-PTR,BTN,55,1,0,1,Laser designator reset", "ENGINE_INTERFACE(4),3023,CONTROL-TEMP-NOTWORK-PTR,BTN,132,1,0,1,Stopped engines exhaust gas temperature indicator test button", "DATALINK(25),3003,PRC-ERASE-PTR,BTN,161,0.2,0,0.2,DLNK Erase",
-        "FUELSYS_INTERFACE(3),3003,FUEL-PUMP-INNER-PTR,TUMB,273,1,0,1,Inner external fuel tanks pumps", "FUELSYS_INTERFACE(3),3003,FUEL-PUMP-INNER-PTR,TUMB,273,-1,0,1,Inner external fuel tanks pumps", "FIRE_EXTING_INTERFACE(40),3003,PUI800-AVARCHOP-PTR03,BTN,240,1,0,1,Right engine extinguisher", "C061K(15),3001,IKV-PTR,TUMB,487,1,0,1,INU Power switch", "C061K(15),3001,IKV-PTR,TUMB,487,-1,0,1,INU Power switch", "CLOCK(29),3003,CLOCK-LEFT-LEVER-PTR,LEV,511,0.04,0,1,Mech clock left lever", "CLOCK(29),3002,CLOCK-LEFT-LEVER-PTR,BTN,76,-1,-1,0,Mech clock left lever", "CLOCK(29),3001,CLOCK-LEFT-LEVER-PTR,BTN,76,1,0,1,Mech clock left lever", "WEAP_INTERFACE(12),3005,PUI800-AUTO-PTR,TUMB,403,1,0,1,Manual/Auto weapon system control switch", "WEAP_INTERFACE(12),3005,PUI800-AUTO-PTR,TUMB,403,-1,0,1,Manual/Auto weapon system control switch", "DATALINK(25),3016,PVI_VCU_PTR,TUMB,326,1,0,1,NAV Datalink power", "DATALINK(25),3016,PVI_VCU_PTR,TUMB,326,-1,0,1,NAV Datalink power", "WEAP_INTERFACE(12),3013,PVR-NPC-PTR,BTN,440,1,0,1,Ground moving target", "PVI(20),3017,PVI-OT-PTR,BTN,318,0.2,0,0.2,NAV Targets", "ELEC_INTERFACE(2),3007,RAMP-POWER-PTR,TUMB,267,1,0,1,AC ground power", "ELEC_INTERFACE(2),3007,RAMP-POWER-PTR,TUMB,267,-1,0,1,AC ground power", "WEAP_INTERFACE(12),3007,PUR-LIT-PTR,TUMB,408,0.1,0,0.2,Laser code selector", "WEAP_INTERFACE(12),3007,PUR-LIT-PTR,TUMB,408,-0.1,0,0.2,Laser code selector", "EJECT_SYS_INTERFACE(6),3006,CONTR-SAP-PTR,BTN,460,1,0,1,Ejecting system circuit test", "ABRIS(9),3002,PTR_BTN-ABRIS-02,BTN,513,1,0,1,ABRIS Pushbutton 2", "FUELSYS_INTERFACE(3),3014,CONTROL-OIL-PTR,BTN,616,1,0,1,Fuel quantity indicator self test button", "HUD(7),3004,PTR_HUD-FILTER,TUMB,510,-1,0,1,HUD Filter", "HUD(7),3004,PTR_HUD-FILTER,TUMB,510,1,0,1,HUD Filter", "PVI(20),3023,PVI-DU-PTR,BTN,321,0.2,0,0.2,NAV Wind Heading/Speed", "R_800(48),3002,CONTR-RADIO-CHM-AM-PTR,TUMB,417,1,0,1,R-800 (VHF-2) AM-FM toggle switch", "R_800(48),3002,CONTR-RADIO-CHM-AM-PTR,TUMB,417,-1,0,1,R-800 (VHF-2) AM-FM toggle switch", "R_828(49),3005,COMM-PWR-UKV-1-PTR,TUMB,285,1,0,1,VHF-1 (R828) power switch", "R_828(49),3005,COMM-PWR-UKV-1-PTR,TUMB,285,-1,0,1,VHF-1 (R828) power switch", "PPK(32),3008,VnK-PTR,TUMB,490,1,0,1,Emergency INU alignment switch", "PPK(32),3008,VnK-PTR,TUMB,490,-1,0,1,Emergency INU alignment switch", "EJECT_SYS_INTERFACE(6),3005,CONTR-SAPROTATE-PTR,TUMB,462,0.1,0,0.6,Ejecting system circuit selector", "EJECT_SYS_INTERFACE(6),3005,CONTR-SAPROTATE-PTR,TUMB,462,-0.1,0,0.6,Ejecting system circuit selector", "PVI(20),3021,PVI-FILAMBDA-PTR,BTN,319,0.2,0,0.2,NAV Self coordinates", "PPK(32),3003,PPK-RNP-PTR,TUMB,485,0.1,0,0.8,Systems BIT selector", "PPK(32),3003,PPK-RNP-PTR,TUMB,485,-0.1,0,0.8,Systems BIT selector", "HSI(30),3003,TEST-PNP-PTR03,BTN,113,1,0,1,HSI test", "FIRE_EXTING_INTERFACE(40),3007,FIREEXT-COVER-PTR,TUMB,249,-1,0,1,Fire extinguisher Work â Off â Test switch", "FIRE_EXTING_INTERFACE(40),3007,FIREEXT-COVER-PTR,TUMB,249,1,0,1,Fire extinguisher Work â Off â Test switch", "PPK(32),3007,AKS-PTR,BTN,489,1,0,1,Self test system push-button", "FIRE_EXTING_INTERFACE(40),3008,FIREEXT-INDICATION-PTR,TUMB,250,-1,0,1,Fire signaling", "FIRE_EXTING_INTERFACE(40),3008,FIREEXT-INDICATION-PTR,TUMB,250,1,0,1,Fire signaling", "HSI(30),3001,ROTARY-ZPU-PTR,LEV,126,0.001,0,1,HSI Commanded course rotary", "SIGNAL_FLARE_DISPENSER(52),3002,SIGNAL-FLARE-1-PTR,TUMB,376,-1,0,1,Signal flare red", "SIGNAL_FLARE_DISPENSER(52),3002,SIGNAL-FLARE-1-PTR,TUMB,376,1,0,1,Signal flare red", "SHKVAL(8),3002,PUR-LIGHTIT-PTR,LEV,406,0.05,0,1,IT-23 display brightness", "WEAP_INTERFACE(12),3023,PPK-NRAKS-PTR,TUMB,484,0.1,0,1,Unguided rocket and gun pods ballistics data settings selector", "WEAP_INTERFACE(12),3023,PPK-NRAKS-PTR,TUMB,484,-0.1,0,1,Unguided rocket and gun pods ballistics data settings selector", "PVI(20),3024,PVI-FII-PTR,BTN,322,0.2,0,0.2,NAV True Heading/Time/Range to final WPT", "DATALINK(25),3005,PRC-WINGMAN-ALL-PTR,BTN,16,0.2,0,0.2,DLNK to ALL", "ADI(31),3003,TEST-IKP-PTR,BTN,110,1,0,1,ADI Test", "ABRIS(9),3008,ABRIS_BRIGHTNESS_PTR,LEV,517,0.05,0,1,ABRIS Brightness", "K041(59),3001,PNK-PTR,TUMB,222,1,0,1,Navigation system power", "K041(59),3001,PNK-PTR,TUMB,222,-1,0,1,Navigation system power", "UV_26(22),3011,UV26-TEST-PTR,TUMB,498,1,0,1,CMD BIT", "UV_26(22),3011,UV26-TEST-PTR,TUMB,498,-1,0,1,CMD BIT", "ENGINE_INTERFACE(4),3003,ERD-RIGHT-PTR,TUMB,292,1,0,1,EEG Right engine Electronic Engine Governor", "ENGINE_INTERFACE(4),3003,ERD-RIGHT-PTR,TUMB,292,-1,0,1,EEG Right engine Electronic Engine Governor", "CPT_MECH(34),3001,GEAR-PTR,TUMB,65,-1,0,1,Gear lever", "CPT_MECH(34),3001,GEAR-PTR,TUMB,65,1,0,1,Gear lever", "ELEC_INTERFACE(2),3003,ENERG-AKK2-PTR,TUMB,543,1,0,1,Battery 2", "ELEC_INTERFACE(2),3003,ENERG-AKK2-PTR,TUMB,543,-1,0,1,Battery 2", "ZMS_3(58),3001,DCLIN-PTR,LEV,338,0.12,0,1,Magnetic variation selection rotaty", "AUTOPILOT(33),3006,BAR-RV-PTR,TUMB,335,-0.5,0,1,Autopilot BARO/RALT altitude hold mode", "AUTOPILOT(33),3006,BAR-RV-PTR,TUMB,335,0.5,0,1,Autopilot BARO/RALT altitude hold mode", "CPT_MECH(34),3008,PPD-DUAS-PTR,TUMB,539,1,0,1,Pitot static port and AoA sensors heat switch", "CPT_MECH(34),3008,PPD-DUAS-PTR,TUMB,539,-1,0,1,Pitot static port and AoA sensors heat switch", "SYST_CONTROLLER(14),3002,CONTROL-ALARM-PTR,BTN,45,1,0,1,Lamps test", "FIRE_EXTING_INTERFACE(40),3010,BALOONS-COVER-PTR,TUMB,247,-1,0,1,Fire extinguisher First (Auto) / Second (Manual) selector", "FIRE_EXTING_INTERFACE(40),3010,BALOONS-COVER-PTR,TUMB,247,1,0,1,Fire extinguisher First (Auto) / Second (Manual) selector", "LASER_WARNING_SYSTEM(36),3002,L140-SWITCH,TUMB,583,-1,0,1,LWS Power switch", "LASER_WARNING_SYSTEM(36),3002,L140-SWITCH,TUMB,583,1,0,1,LWS Power switch", "R_828(49),3002,RADIO-VOLUME-PTR,LEV,372,0.05,0,1,R-828 (VHF-1) Radio Volume", "ILLUMINATION_INTERFACE(51),3001,DESK-PTR,TUMB,300,1,0,1,Lighting cockpit panel switch", "ILLUMINATION_INTERFACE(51),3001,DESK-PTR,TUMB,300,-1,0,1,Lighting cockpit panel switch", "FUELSYS_INTERFACE(3),3008,PAV-CRANE-ENGINE-RIGHT-PTR,TUMB,278,1,0,1,Right engine fuel shutoff valve", "FUELSYS_INTERFACE(3),3008,PAV-CRANE-ENGINE-RIGHT-PTR,TUMB,278,-1,0,1,Right engine fuel shutoff valve", "R_800(48),3005,CONTR-RADIO-50-100-PTR01,TUMB,420,1,0,1,R-800 (VHF-2) Data transfer rate switch", "R_800(48),3005,CONTR-RADIO-50-100-PTR01,TUMB,420,-1,0,1,R-800 (VHF-2) Data transfer rate switch", "FUELSYS_INTERFACE(3),3002,FUEL-PUMP-BACK-PTR,TUMB,272,1,0,1,Rear fuel tank pumps", "FUELSYS_INTERFACE(3),3002,FUEL-PUMP-BACK-PTR,TUMB,272,-1,0,1,Rear fuel tank pumps", "EJECT_SYS_INTERFACE(6),3004,RIGHT-COVER-EMERG-VACATION-PTR,TUMB,217,-1,0,1,Ejecting system power", "EJECT_SYS_INTERFACE(6),3004,RIGHT-COVER-EMERG-VACATION-PTR,TUMB,217,1,0,1,Ejecting system power", "FIRE_EXTING_INTERFACE(40),3004,PUI800-AVARCHOP-PTR04,BTN,242,1,0,1,Ventilator extinguisher", "ENGINE_INTERFACE(4),3017,PAV-CRANE-VSU-PTR02,TUMB,295,-0.1,0,0.2,EEG power turbine channel 1 test â Operate â EEG power turbine channel 2 test, three-switch contactor", "ENGINE_INTERFACE(4),3017,PAV-CRANE-VSU-PTR02,TUMB,295,0.1,0,0.2,EEG power turbine channel 1 test â Operate â EEG power turbine channel 2 test, three-switch contactor", "PVI(20),3027,PVI-SWITCH-PTR,TUMB,324,0.1,0,0.6,NAV Master modes", "PVI(20),3026,PVI-SWITCH-PTR,TUMB,324,-0.1,0,0.6,NAV Master modes", "CLOCK(29),3005,CLOCK-RIGHT-LEVER-PTR,LEV,525,0.05,-0.15,0.15,Mech clock right lever", "CLOCK(29),3004,CLOCK-RIGHT-LEVER-PTR,BTN,77,1,0,1,Mech clock right lever", "FUELSYS_INTERFACE(3),3010,PAV-CRANE-VSU-PTR,TUMB,280,1,0,1,APU fuel shutoff valve", "FUELSYS_INTERFACE(3),3010,PAV-CRANE-VSU-PTR,TUMB,280,-1,0,1,APU fuel shutoff valve", "FUELSYS_INTERFACE(3),3006,PAV-CRANE-ENGINE-LEFT-PTR,TUMB,276,1,0,1,Left engine fuel shutoff valve", "FUELSYS_INTERFACE(3),3006,PAV-CRANE-ENGINE-LEFT-PTR,TUMB,276,-1,0,1,Left engine fuel shutoff valve", "DATALINK(25),3009,PRC-WINGMAN-4-PTR,BTN,20,0.2,0,0.2,DLNK to Wingman 4", "FIRE_EXTING_INTERFACE(40),3009,BALOONS-PTR,TUMB,246,-1,0,1,Fire extinguisher First (Auto) / Second (Manual) selector", "FIRE_EXTING_INTERFACE(40),3009,BALOONS-PTR,TUMB,246,1,0,1,Fire extinguisher First (Auto) / Second (Manual) selector", "SYST_CONTROLLER(14),3001,CSO-PTR,BTN,44,0.2,0,0.2,Master caution push-light", "CPT_MECH(34),3009,PVD-CLOCK-PTR,TUMB,151,1,0,1,Pitot ram air and clock heat switch", "CPT_MECH(34),3009,PVD-CLOCK-PTR,TUMB,151,-1,0,1,Pitot ram air and clock heat switch", "R_800(48),3009,CONTROLLER-FREQ-3-PTR,TUMB,-1,1,-1,1,R-800 (VHF-2) 3rd rotary", "R_800(48),3009,CONTROLLER-FREQ-3-PTR,TUMB,-1,-1,-1,1,R-800 (VHF-2) 3rd rotary", "ABRIS(9),3003,PTR_BTN-ABRIS-03,BTN,514,1,0,1,ABRIS Pushbutton 3", "PPK(32),3001,PPK-BBTZ-PTR,TUMB,483,0.1,0,1,ATGM Temperature selector", "PPK(32),3001,PPK-BBTZ-PTR,TUMB,483,-0.1,0,1,ATGM Temperature selector", "NAVLIGHT_SYSTEM(45),3005,ANO-PTR,BTN,146,0.4,0,0.4,Navigation Lights 10% / 30% / 100% / Off", "NAVLIGHT_SYSTEM(45),3004,ANO-PTR,TUMB,146,0.1,0,0.3,Navigation Lights 10% / 30% / 100% / Off", "HSI(30),3004,ZPU-ZK-PTR,TUMB,54,1,0,1,HSI Desired track angle - Desired heading, Auto - Manual", "HSI(30),3004,ZPU-ZK-PTR,TUMB,54,-1,0,1,HSI Desired track angle - Desired heading, Auto - Manual", "VMS(13),3003,SPEECH-INFO-RETRY-PTR,BTN,385,1,0,1,Voice message system messages repeat", "ELEC_INTERFACE(2),3008,GEN-LEFT-PTR,TUMB,268,1,0,1,AC left generator", "ELEC_INTERFACE(2),3008,GEN-LEFT-PTR,TUMB,268,-1,0,1,AC left generator", "ENGINE_INTERFACE(4),3024,REDUCTOR-PTR,TUMB,258,0.1,0,0.2,Reducing gear box oil pressure indication selector", "ENGINE_INTERFACE(4),3024,REDUCTOR-PTR,TUMB,258,-0.1,0,0.2,Reducing gear box oil pressure indication selector", "ILLUMINATION_INTERFACE(51),3004,BRIGHT-AGR-PKP-PTR,LEV,508,0.1,0,1,Lighting HSI and ADI brightness knob", "FUELSYS_INTERFACE(3),3004,FUEL-PUMP-OUTER-PTR,TUMB,274,1,0,1,Outer external fuel tanks pumps", "FUELSYS_INTERFACE(3),3004,FUEL-PUMP-OUTER-PTR,TUMB,274,-1,0,1,Outer external fuel tanks pumps", "PVI(20),3008,PVI-7-PTR,BTN,309,0.2,0,0.2,NAV '7' Btn", "ADI(31),3001,IKP-TANGAGE-PTR,LEV,105,0.001,0,1,ADI Zero pitch trim",
-        "ADI(31),3002,TEST-COVER-IKP-PTR,TUMB,550,-1,0,1,ADI Test", "ADI(31),3002,TEST-COVER-IKP-PTR,TUMB,550,1,0,1,ADI Test", "CPT_MECH(34),3010,KONTR-PVD-PTR,BTN,156,1,0,1,Pitot heat system test", "UV_26(22),3002,UV26-BOARD-PTR,TUMB,36,0.1,0,0.2,CMD Select Left/Both/Right board flares dispensers", "UV_26(22),3001,UV26-BOARD-PTR,TUMB,36,-0.1,0,0.2,CMD Select Left/Both/Right board flares dispensers", "FUELSYS_INTERFACE(3),3009,PAV-CRANE-COVER-ENGINE-RIGHT-PTR,TUMB,279,1,0,1,Right engine fuel shutoff valve", "FUELSYS_INTERFACE(3),3009,PAV-CRANE-COVER-ENGINE-RIGHT-PTR,TUMB,279,-1,0,1,Right engine fuel shutoff valve", "SHKVAL(8),3004,PUR-TR-PTR,TUMB,410,1,0,1,N/A", "SHKVAL(8),3004,PUR-TR-PTR,TUMB,410,-1,0,1,N/A", "ABRIS(9),3009,ABRIS-POWER_PTR,TUMB,130,-1,0,1,ABRIS Power", "ABRIS(9),3009,ABRIS-POWER_PTR,TUMB,130,1,0,1,ABRIS Power", "VMS(13),3002,SPEECH-INFO-AVAR-PTR,TUMB,386,1,0,1,Voice message system emergency on", "VMS(13),3002,SPEECH-INFO-AVAR-PTR,TUMB,386,-1,0,1,Voice message system emergency on", "SHKVAL(8),3001,PUR-BACKGROUND-PTR,TUMB,404,1,0,1,IT-23 Black-White indication switch", "SHKVAL(8),3001,PUR-BACKGROUND-PTR,TUMB,404,-1,0,1,IT-23 Black-White indication switch", "PVI(20),3009,PVI-8-PTR,BTN,310,0.2,0,0.2,NAV '8' Btn", "ENGINE_INTERFACE(4),3021,RT-12-6-IV-PTR,BTN,459,1,0,1,Engines vibrations monitoring system control button", "PVI(20),3019,PVI-CANCEL-PTR,BTN,314,0.2,0,0.2,NAV Cancel", "NAVLIGHT_SYSTEM(45),3002,FORMATION-PTR,TUMB,297,0.1,0,0.3,Formation Lights", "NAVLIGHT_SYSTEM(45),3002,FORMATION-PTR,TUMB,297,-0.1,0,0.3,Formation Lights", "ENGINE_INTERFACE(4),3016,PAV-CRANE-COVER-VSU-PTR01,TUMB,569,-1,0,1,EEG gas generator test â Operate switch", "ENGINE_INTERFACE(4),3016,PAV-CRANE-COVER-VSU-PTR01,TUMB,569,1,0,1,EEG gas generator test â Operate switch", "R_828(49),3004,RADIO-PSH-SWITCH-PTR,TUMB,374,1,0,1,R-828 (VHF-1) Squelch", "R_828(49),3004,RADIO-PSH-SWITCH-PTR,TUMB,374,-1,0,1,R-828 (VHF-1) Squelch", "ILLUMINATION_INTERFACE(51),3009,LAMP-PTR,TUMB,1001,1,0,1,Lighting cockpit interior lamp switch", "ILLUMINATION_INTERFACE(51),3009,LAMP-PTR,TUMB,1001,-1,0,1,Lighting cockpit interior lamp switch", "SHKVAL(8),3006,V-SCAN-PTR,TUMB,301,0.1,0,0.7,Shkval scan rate", "SHKVAL(8),3006,V-SCAN-PTR,TUMB,301,-0.1,0,0.7,Shkval scan rate", "FIRE_EXTING_INTERFACE(40),3006,FIREEXT-PTR,TUMB,248,0.1,0,0.2,Fire extinguisher Work â Off â Test switch", "FIRE_EXTING_INTERFACE(40),3005,FIREEXT-PTR,TUMB,248,-0.1,0,0.2,Fire extinguisher Work â Off â Test switch", "SYST_CONTROLLER(14),3003,MAIN-ROTOR-PTR,BTN,46,0.2,0,0.2,Rotor RPM warning push-light", "ENGINE_INTERFACE(4),3015,PAV-CRANE-VSU-PTR01,TUMB,294,-1,0,1,EEG gas generator test â Operate switch", "ENGINE_INTERFACE(4),3015,PAV-CRANE-VSU-PTR01,TUMB,294,1,0,1,EEG gas generator test â Operate switch", "PVI(20),3004,PVI-3-PTR,BTN,305,0.2,0,0.2,NAV '3' Btn", "SHKVAL(8),3005,PUR-SF-PTR,TUMB,411,0.1,0,0.7,SHKVAL Optics adjustment", "SHKVAL(8),3005,PUR-SF-PTR,TUMB,411,-0.1,0,0.7,SHKVAL Optics adjustment", "WEAP_INTERFACE(12),3016,PVR-RESET-PTR,BTN,441,1,0,1,Targeting mode reset", "ELEC_INTERFACE(2),3004,ENERG-COVER-AKK2-PTR,TUMB,544,1,0,1,Battery 2", "ELEC_INTERFACE(2),3004,ENERG-COVER-AKK2-PTR,TUMB,544,-1,0,1,Battery 2", "PVI(20),3011,PVI-PPM-PTR,BTN,315,0.2,0,0.2,NAV Waypoints", "EJECT_SYS_INTERFACE(6),3001,RIGHT-EMERG-SW1-PTR,TUMB,214,-1,0,1,Ejecting system power 1", "EJECT_SYS_INTERFACE(6),3001,RIGHT-EMERG-SW1-PTR,TUMB,214,1,0,1,Ejecting system power 1", "ILLUMINATION_INTERFACE(51),3007,DEVICES-PTR,TUMB,299,1,0,1,Lighting night vision cockpit switch", "ILLUMINATION_INTERFACE(51),3007,DEVICES-PTR,TUMB,299,-1,0,1,Lighting night vision cockpit switch", "FIRE_EXTING_INTERFACE(40),3012,EXTING-GROUPS-CTRL-02,BTN,251,0.2,0,0.2,2nd fire warning sensors group BIT", "ARK_22(46),3006,VARK-VOLUME-PTR,LEV,353,0.05,0,1,ADF Volume", "AUTOPILOT(33),3001,PPR-K-PTR01,BTN,330,1,0,1,Autopilot Bank hold", "WEAP_INTERFACE(12),3001,MASTER-ARM-PTR,TUMB,387,1,0,1,Master Arm", "WEAP_INTERFACE(12),3001,MASTER-ARM-PTR,TUMB,387,-1,0,1,Master Arm", "HYDRO_SYS_INTERFACE(5),3002,HYDRO-COVER-PTR02,TUMB,221,-1,0,1,Main hydraulics", "HYDRO_SYS_INTERFACE(5),3002,HYDRO-COVER-PTR02,TUMB,221,1,0,1,Main hydraulics", "CPT_MECH(34),3005,AVAR-GEAR-COVER-PTR,TUMB,67,-1,0,1,Main/Common hydraulics for emergency gear", "CPT_MECH(34),3005,AVAR-GEAR-COVER-PTR,TUMB,67,1,0,1,Main/Common hydraulics for emergency gear", "LASER_WARNING_SYSTEM(36),3001,L-140-RESET-PTR,BTN,35,1,0,1,LWS Reset button", "PVI(20),3001,PVI-0-PTR,BTN,312,0.2,0,0.2,NAV '0' Btn", "NAV_INTERFACE(28),3003,ZK-LZP-PTR,TUMB,336,-0.5,0,1,Autopilot Desired heading - Desired track", "NAV_INTERFACE(28),3003,ZK-LZP-PTR,TUMB,336,0.5,0,1,Autopilot Desired heading - Desired track", "WEAP_INTERFACE(12),3022,MASTER-EXPLODE-PTR,TUMB,396,1,0,1,Jettison arm mode - arm fuse/disarm fuse", "WEAP_INTERFACE(12),3022,MASTER-EXPLODE-PTR,TUMB,396,-1,0,1,Jettison arm mode - arm fuse/disarm fuse", "WEAP_INTERFACE(12),3019,SUO-COVER-PTR,TUMB,548,-1,0,1,Weapons Ñontrol system", "WEAP_INTERFACE(12),3019,SUO-COVER-PTR,TUMB,548,1,0,1,Weapons Ñontrol system", "PVI(20),3018,PVI-ENTER-PTR,BTN,313,0.2,0,0.2,NAV Enter", "CPT_MECH(34),3003,P-CONTR-VMG-HYDRO-COVER-PTR,TUMB,453,-1,0,1,Power plant, hydraulics, EKRAN self-test systems switch", "CPT_MECH(34),3003,P-CONTR-VMG-HYDRO-COVER-PTR,TUMB,453,1,0,1,Power plant, hydraulics, EKRAN self-test systems switch", "ENGINE_INTERFACE(4),3011,BRAKE-ROTOR-LOW-PTR01,TUMB,556,-1,0,1,Rotor brake", "ENGINE_INTERFACE(4),3011,BRAKE-ROTOR-LOW-PTR01,TUMB,556,1,0,1,Rotor brake", "CPT_MECH(34),3004,AVAR-GEAR-PTR,TUMB,66,-1,0,1,Main/Common hydraulics for emergency gear", "CPT_MECH(34),3004,AVAR-GEAR-PTR,TUMB,66,1,0,1,Main/Common hydraulics for emergency gear", "WEAP_INTERFACE(12),3004,SR-PTR,TUMB,400,0.1,0,0.2,Weapon mode switch - Burst Length", "WEAP_INTERFACE(12),3004,SR-PTR,TUMB,400,-0.1,0,0.2,Weapon mode switch - Burst Length", "HUD(7),3002,PTR_HUD-TMB-SETKA02,TUMB,9,1,-1,1,HUD Modes Reticle/Night/Day", "HUD(7),3002,PTR_HUD-TMB-SETKA02,TUMB,9,-1,-1,1,HUD Modes Reticle/Night/Day", "R_800(48),3010,CONTROLLER-FREQ-4-PTR,TUMB,-1,1,-1,1,R-800 (VHF-2) 4th rotary", "R_800(48),3010,CONTROLLER-FREQ-4-PTR,TUMB,-1,-1,-1,1,R-800 (VHF-2) 4th rotary", "ENGINE_INTERFACE(4),3006,START-PANEL-STOP-START-PTR,BTN,413,1,0,1,Interrupt start-up button", "R_828(49),3001,CHANNEL-PTR,TUMB,371,0.1,0,0.9,R-828 (VHF-1) Radio channel selector", "R_828(49),3001,CHANNEL-PTR,TUMB,371,-0.1,0,0.9,R-828 (VHF-1) Radio channel selector", "DATALINK(25),3012,PRC-TARGET-3-PTR,BTN,23,0.2,0,0.2,DLNK Target #3/Other Type", "ENGINE_INTERFACE(4),3005,START-PANEL-START-PTR,BTN,412,1,0,1,Start-up selected engine button", "CPT_MECH(34),3007,WINDSCREEN-WIPER-PTR,BTN,147,0.4,0,0.4,Windshield wiper switch", "CPT_MECH(34),3006,WINDSCREEN-WIPER-PTR,TUMB,147,0.1,0,0.3,Windshield wiper switch", "ILLUMINATION_INTERFACE(51),3002,BRIGHT-LEFT-RIGHT-PTR,LEV,593,0.1,0,1,Lighting cockpit panel brightness knob", "HSI(30),3002,ROTARY-ZK-PTR,LEV,129,0.001,0,1,HSI Commanded heading rotary", "DATALINK(25),3002,PRC-ESCAPE-PTR,BTN,150,0.2,0,0.2,DLNK Ingress to target", "FIRE_EXTING_INTERFACE(40),3002,PUI800-AVARCHOP-PTR02,BTN,238,1,0,1,APU extinguisher"],
-    "L-39C": ["GMK1AE(17),3014,MAGNETIC_VAR_KNOB,LEV,532,0,0,1,Magnetic Declination set knob", "HYDRO_INTERFACE(35),3008,EMERGENCY_VALVE_GENERATOR_CPT2,TUMB,535,-1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3008,EMERGENCY_VALVE_GENERATOR_CPT2,TUMB,535,1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "GMK1AE(17),3005,GMK_ZK,BTN,208,-1,-1,0,GMK-1AE GMC Course Selector Switch, CCW/OFF/CW", "GMK1AE(17),3005,GMK_ZK,BTN,208,1,0,1,GMK-1AE GMC Course Selector Switch, CCW/OFF/CW", "ELEC_INTERFACE(4),3024,COVER_EMERCENCY_FUEL_CPT2,TUMB,491,-1,0,1,Emergency Fuel Switch Cover, Open/Close", "ELEC_INTERFACE(4),3024,COVER_EMERCENCY_FUEL_CPT2,TUMB,491,1,0,1,Emergency Fuel Switch Cover, Open/Close", "ASP_3NM(1),3011,SIGHT_MECH,TUMB,105,0,0,1,ASP-3NMU Gunsight Fixed Reticle Mask Lever", "ASP_3NM(1),3011,SIGHT_MECH,TUMB,105,1,0,1,ASP-3NMU Gunsight Fixed Reticle Mask Lever", "ELEC_INTERFACE(4),3048,SWITCH_009,TUMB,219,-1,0,1,CB Gears, ON/OFF", "ELEC_INTERFACE(4),3048,SWITCH_009,TUMB,219,1,0,1,CB Gears, ON/OFF", "ELEC_INTERFACE(4),3004,NETW,TUMB,502,-1,0,1,Net Switch, ON/OFF", "ELEC_INTERFACE(4),3004,NETW,TUMB,502,1,0,1,Net Switch, ON/OFF", "ELEC_INTERFACE(4),3060,SWITCH_021,TUMB,231,-1,0,1,CB Engine Instruments, ON/OFF", "ELEC_INTERFACE(4),3060,SWITCH_021,TUMB,231,1,0,1,CB Engine Instruments, ON/OFF", "ELEC_INTERFACE(4),3067,INTERCOM_GRND,TUMB,512,-1,0,1,CB Ground Intercom, ON/OFF", "ELEC_INTERFACE(4),3067,INTERCOM_GRND,TUMB,512,1,0,1,CB Ground Intercom, ON/OFF", "ELEC_INTERFACE(4),3068,STAND-BY-ON,BTN,294,1,0,1,Standby (Left) Pitot Tube Heating Button - Push to turn heating on", "LIGHTS(20),3006,LANDING_LIGHTS,TUMB,311,1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "LIGHTS(20),3006,LANDING_LIGHTS,TUMB,311,-1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "RSBN_5(31),3010,SETTING_0_AZ,BTN,193,1,0,1,Set 0 Azimuth", "LIGHTS(20),3007,LANDING_LIGHTS_CPT2,TUMB,486,1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "LIGHTS(20),3007,LANDING_LIGHTS_CPT2,TUMB,486,-1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "CLOCK_INSTRUCTOR(13),3003,CLOCK_LEFT_BTN_CPT2,LEV,413,0.04,0,1,Mech clock left lever", "CLOCK_INSTRUCTOR(13),3002,CLOCK_LEFT_BTN_CPT2,BTN,412,-1,-1,0,Mech clock left lever", "CLOCK_INSTRUCTOR(13),3001,CLOCK_LEFT_BTN_CPT2,BTN,412,1,0,1,Mech clock left lever", "WEAPON_SYSTEM(3),3014,FLARE_GREEN,TUMB,275,-1,0,1,EKSR-46 Green Signal Flare Launch Button", "WEAPON_SYSTEM(3),3014,FLARE_GREEN,TUMB,275,1,0,1,EKSR-46 Green Signal Flare Launch Button", "ELEC_INTERFACE(4),3007,TURBO_CPT2,BTN,488,1,0,1,Turbo Button", "RSBN_5(31),3007,SETTING_RANGE,BTN,188,1,0,1,Initial Range", "RSBN_5(31),3007,SETTING_RANGE,BTN,188,-1,-1,0,Initial Range", "LIGHTS(20),3011,INSTRUMENT_LIGHTING_CONTROL_CPT2,LEV,498,0.5,0.1,0.9,Instrument Lights Intensity Knob", "CTRL_INTERFACE(37),3004,FLAPS_00_CPT2,BTN,465,1,0,1,Flaps Flight Position (0 degrees) Button", "ELEC_INTERFACE(4),3059,SWITCH_020,TUMB,230,-1,0,1,CB Ignition 2, ON/OFF", "ELEC_INTERFACE(4),3059,SWITCH_020,TUMB,230,1,0,1,CB Ignition 2, ON/OFF", "OXYGEN(30),3007,SWITSH_OXYGEN_CPT2,TUMB,480,-1,0,1,Diluter Demand Switch, 100% / MIX", "OXYGEN(30),3007,SWITSH_OXYGEN_CPT2,TUMB,480,1,0,1,Diluter Demand Switch, 100% / MIX", "OXYGEN(30),3002,VALVE_OXYGEN_CPT2,LEV,482,0,0,1,Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)", "AIR_INTERFACE(7),3012,HEATING_HELMET_MODE,TUMB,308,0.5,0,1,Helmet Heating Mode Switch, AUTO/OFF/ON", "AIR_INTERFACE(7),3012,HEATING_HELMET_MODE,TUMB,308,-0.5,0,1,Helmet Heating Mode Switch, AUTO/OFF/ON", "SARPP(36),3001,FLIGHT_REC_SWITCH,TUMB,298,-1,0,1,SARPP Flight Recorder, ON/OFF", "SARPP(36),3001,FLIGHT_REC_SWITCH,TUMB,298,1,0,1,SARPP Flight Recorder, ON/OFF", "SPU_9(34),3002,RADIO_VOLUME,LEV,289,0.5,0,0.8,Radio Volume Knob", "ELEC_INTERFACE(4),3001,BATTERY,TUMB,141,-1,0,1,Battery Switch, ON/OFF", "ELEC_INTERFACE(4),3001,BATTERY,TUMB,141,1,0,1,Battery Switch, ON/OFF", "AIR_INTERFACE(7),3002,PRESSUR_CPT2,LEV,245,0,0,1,ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON", "AIR_INTERFACE(7),3003,CABIN_TEMP,LEV,173,0.5,0,1,Cabin Air Temperature Controller Rheostat", "RSBN_5(31),3004,RSBN LIGHTING,LEV,181,0,0,1,RSBN Control Box Lighting Intensity Knob", "ELEC_INTERFACE(4),3035,RIO,TUMB,154,-1,0,1,CB RIO-3 De-Icing Signal Switch, ON/OFF", "ELEC_INTERFACE(4),3035,RIO,TUMB,154,1,0,1,CB RIO-3 De-Icing Signal Switch, ON/OFF", "VARIOMETER(15),3001,VV_SET_0,LEV,569,1,0,1,Variometer adjustment knob", "KPP_1273K(22),3009,SWITCH_AGD_ROLL,TUMB,461,-1,0,1,AGD Bank Failure", "KPP_1273K(22),3009,SWITCH_AGD_ROLL,TUMB,461,1,0,1,AGD Bank Failure", "NPP_INSTRUCTOR(25),3002,WARNING_LIGHT_CHECK003,BTN,526,1,0,1,Course Accordance", "ASP_3NM(1),3001,SIGHT_BASE,LEV,103,0,0,1,ASP-3NMU Gunsight Target Wingspan Adjustment Dial (meters)", "ELEC_INTERFACE(4),3070,MAIN-ON,BTN,295,1,0,1,Main (Right) Pitot Tube Heating Button - Push to turn heating on", "SPU_9(34),3004,SPU_REZ,TUMB,290,-1,0,1,Reserve Intercom Switch, ON/OFF", "SPU_9(34),3004,SPU_REZ,TUMB,290,1,0,1,Reserve Intercom Switch, ON/OFF", "CTRL_INTERFACE(37),3003,FLAPS_44,BTN,283,1,0,1,Flaps Landing Position (44 degrees) Button", "VD_20_INSTRUCTOR(10),3001,VD_PRESSUR_CPT2,LEV,394,1,0,1,Baro pressure QFE knob", "CLOCK(12),3005,CLOCK_RIGHT_BTN,LEV,338,0,0,0.3,Mech clock right lever", "CLOCK(12),3004,CLOCK_RIGHT_BTN,BTN,337,1,0,1,Mech clock right lever", "RSBN_5(31),3009,CHANNEL_RANGE,TUMB,192,0.025,0,0.975,RSBN Landing Channel Selector Knob", "RSBN_5(31),3009,CHANNEL_RANGE,TUMB,192,-0.025,0,0.975,RSBN Landing Channel Selector Knob", "RKL_41(21),3023,RKL_L_R_CPT2,BTN,519,1,0,1,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "RKL_41(21),3023,RKL_L_R_CPT2,BTN,519,-1,-1,0,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "SPU_9(34),3006,SPU_BTN,BTN,133,1,0,1,Intercom Button", "WEAPON_SYSTEM(3),3005,GLOWING_SS,TUMB,258,-1,0,1,CB Missile Seeker Glowing Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3005,GLOWING_SS,TUMB,258,1,0,1,CB Missile Seeker Glowing Circuit Power Switch, ON/OFF", "ELEC_INTERFACE(4),3009,TURBO_STOP,TUMB,313,-1,0,1,Stop Turbo Switch, ON/OFF", "ELEC_INTERFACE(4),3009,TURBO_STOP,TUMB,313,1,0,1,Stop Turbo Switch, ON/OFF", "SPU_9(34),3010,SPU_REZ_CPT2,TUMB,473,-1,0,1,Reserve Intercom Switch, ON/OFF", "SPU_9(34),3010,SPU_REZ_CPT2,TUMB,473,1,0,1,Reserve Intercom Switch, ON/OFF", "OXYGEN(30),3001,VALVE_OXYGEN,LEV,306,0,0,1,Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)", "WEAPON_SYSTEM(3),3017,FLARE_YELLOW,TUMB,274,-1,0,1,EKSR-46 Yellow Signal Flare Launch Button", "WEAPON_SYSTEM(3),3017,FLARE_YELLOW,TUMB,274,1,0,1,EKSR-46 Yellow Signal Flare Launch Button", "KPP_1273K_INSTRUCTOR(23),3002,KPP_ARRETIR_CPT2,BTN,367,1,0,1,KPP-1273K Attitude Director Indicator (ADI) Cage Button", "ELEC_INTERFACE(4),3045,SWITCH_006,TUMB,216,-1,0,1,CB ARC, ON/OFF", "ELEC_INTERFACE(4),3045,SWITCH_006,TUMB,216,1,0,1,CB ARC, ON/OFF", "ELEC_INTERFACE(4),3015,ENGINE_STOP,TUMB,318,-1,0,1,Stop Engine Switch", "ELEC_INTERFACE(4),3015,ENGINE_STOP,TUMB,318,1,0,1,Stop Engine Switch", "HYDRO_INTERFACE(35),3005,EMERGENCY_VALVE_FLAPS,TUMB,195,-1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3005,EMERGENCY_VALVE_FLAPS,TUMB,195,1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "KPP_1273K(22),3003,KPP_SET_0,LEV,39,0,-1,1,KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob", "ELEC_INTERFACE(4),3051,SWITCH_012,TUMB,222,-1,0,1,CB Nav. Lights, ON/OFF", "ELEC_INTERFACE(4),3051,SWITCH_012,TUMB,222,1,0,1,CB Nav. Lights, ON/OFF", "GMK1AE(17),3006,GMK_LATITUDE,LEV,209,0,0,0.728,GMK-1AE GMC Latitude Selector Knob", "RKL_41(21),3002,RKL_TLF_TLG,TUMB,159,-1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "RKL_41(21),3002,RKL_TLF_TLG,TUMB,159,1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "RSBN_5(31),3008,CHANNEL_NAVIGATION,TUMB,191,0.025,0,0.975,RSBN Navigation Channel Selector Knob", "RSBN_5(31),3008,CHANNEL_NAVIGATION,TUMB,191,-0.025,0,0.975,RSBN Navigation Channel Selector Knob", "ELEC_INTERFACE(4),3063,SWITCH_024,TUMB,234,-1,0,1,CB SARPP, ON/OFF", "ELEC_INTERFACE(4),3063,SWITCH_024,TUMB,234,1,0,1,CB SARPP, ON/OFF", "WEAPON_SYSTEM(3),3020,COVER_EMER_JETTISON_CPT2,TUMB,506,-1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3020,COVER_EMER_JETTISON_CPT2,TUMB,506,1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3005,FIRE_CPT2,BTN,496,1,0,1,Fire Extinguish Button - Push to extinguish", "ENGINE_INTERFACE(6),3006,TEST_SSP,BTN,272,1,0,1,Fire Warning Signal Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3006,TEST_SSP,BTN,272,-1,-1,0,Fire Warning Signal Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3009,RT12,TUMB,243,-1,0,1,RT-12 JPT Regulator Power Switch, ON/OFF", "ENGINE_INTERFACE(6),3009,RT12,TUMB,243,1,0,1,RT-12 JPT Regulator Power Switch, ON/OFF", "RKL_41(21),3021,RKL_FREQ_2_XX_CPT2,TUMB,523,0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "RKL_41(21),3021,RKL_FREQ_2_XX_CPT2,TUMB,523,-0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "ENGINE_INTERFACE(6),3010,TEST_RT12,TUMB,242,1,-1,1,RT-12 JPT Regulator Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3010,TEST_RT12,TUMB,242,-1,-1,1,RT-12 JPT Regulator Test Switch, I/OFF/II", "OXYGEN(30),3004,EMERG_OXYGEN,TUMB,303,-1,0,1,Emergency Oxygen Switch, ON/OFF", "OXYGEN(30),3004,EMERG_OXYGEN,TUMB,303,1,0,1,Emergency Oxygen Switch, ON/OFF", "ELEC_INTERFACE(4),3071,MAIN-OFF,BTN,293,1,0,1,Main (Right) Pitot Tube Heating Off Button - Push to turn heating off", "RKL_41(21),3020,RKL_FREQ_2_TUNING_CPT2,LEV,525,0,0,1,RKL-41 ADF Near NDB Frequency Tune", "WEAPON_SYSTEM(3),3010,COVER_EMER_JETTISON,TUMB,269,-1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3010,COVER_EMER_JETTISON,TUMB,269,1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "SPU_9(34),3008,RADIO_VOLUME_CPT2,LEV,472,0.5,0,0.8,Radio Volume Knob", "HYDRO_INTERFACE(35),3007,EMERGENCY_VALVE_GENERATOR,TUMB,196,-1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)",
-        "HYDRO_INTERFACE(35),3007,EMERGENCY_VALVE_GENERATOR,TUMB,196,1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "CTRL_INTERFACE(37),3005,FLAPS_25_CPT2,BTN,466,1,0,1,Flaps Takeoff Position (25 degrees) Button", "GMK1AE(17),3004,GMK_MODE,TUMB,207,-2,-1,1,GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)", "GMK1AE(17),3004,GMK_MODE,TUMB,207,2,-1,1,GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)", "CTRL_INTERFACE(37),3021,THROTTLE_LIMIT,TUMB,549,-1,0,1,Throttle Limiter", "CTRL_INTERFACE(37),3021,THROTTLE_LIMIT,TUMB,549,1,0,1,Throttle Limiter", "NPP_INSTRUCTOR(25),3001,NPP_COURSE_CPT2,LEV,385,0,0,1,HSI Course set knob", "RSBN_5(31),3002,IDENTIF,BTN,179,1,0,1,RSBN Identification Button", "ELEC_INTERFACE(4),3043,SWITCH_004,TUMB,214,-1,0,1,CB Pitot Right, ON/OFF", "ELEC_INTERFACE(4),3043,SWITCH_004,TUMB,214,1,0,1,CB Pitot Right, ON/OFF", "ENGINE_INTERFACE(6),3004,COVER_FIRE_CPT2,TUMB,495,-1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3004,COVER_FIRE_CPT2,TUMB,495,1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "MECHANICS(2),3009,EJECT_CANOPY,BTN,244,1,0,1,Forward Canopy Emergency Jettison Handle", "SPU_9(34),3001,SPU_VOLUME,LEV,288,0.5,0,0.8,Intercom Volume Knob", "WEAPON_SYSTEM(3),3015,FLARE_RED,TUMB,276,-1,0,1,EKSR-46 Red Signal Flare Launch Button", "WEAPON_SYSTEM(3),3015,FLARE_RED,TUMB,276,1,0,1,EKSR-46 Red Signal Flare Launch Button", "AIR_INTERFACE(7),3005,SUIT_TEMPR,LEV,120,0.5,0,1,Diffuser and Flight Suit Temperature Rheostat", "R_832M(19),3002,RADIO_NOISE_SUPPR,TUMB,286,-1,0,1,Squelch Switch, ON/OFF", "R_832M(19),3002,RADIO_NOISE_SUPPR,TUMB,286,1,0,1,Squelch Switch, ON/OFF", "HYDRO_INTERFACE(35),3001,EMERGENCY_VALVE_HYDRAULIC,TUMB,197,-1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3001,EMERGENCY_VALVE_HYDRAULIC,TUMB,197,1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "RKL_41(21),3013,RKL_BRIGHTNESS,LEV,161,1,,,RKL-41 ADF Brightness Knob", "ELEC_INTERFACE(4),3027,CONVERTER_1,TUMB,146,-1,0,1,CB Inverter 1 (AC 115V) Switch, ON/OFF", "ELEC_INTERFACE(4),3027,CONVERTER_1,TUMB,146,1,0,1,CB Inverter 1 (AC 115V) Switch, ON/OFF", "ELEC_INTERFACE(4),3008,COVER_TURBO_CPT2,TUMB,487,-1,0,1,Turbo Button Cover, Open/Close", "ELEC_INTERFACE(4),3008,COVER_TURBO_CPT2,TUMB,487,1,0,1,Turbo Button Cover, Open/Close", "RSBN_5(31),3006,SETTING_AZ,BTN,187,1,0,1,Initial Azimuth", "RSBN_5(31),3006,SETTING_AZ,BTN,187,-1,-1,0,Initial Azimuth", "RKL_41(21),3005,RKL_FREQ_1_XX00,TUMB,163,0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3005,RKL_FREQ_1_XX00,TUMB,163,-0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "HYDRO_INTERFACE(35),3006,EMERGENCY_VALVE_FLAPS_CPT2,TUMB,534,-1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3006,EMERGENCY_VALVE_FLAPS_CPT2,TUMB,534,1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "RKL_41(21),3015,RKL_TLF_TLG_CPT2,TUMB,516,-1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "RKL_41(21),3015,RKL_TLF_TLG_CPT2,TUMB,516,1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "CLOCK(12),3003,CLOCK_LEFT_BTN,LEV,336,0.04,0,1,Mech clock left lever", "CLOCK(12),3002,CLOCK_LEFT_BTN,BTN,335,-1,-1,0,Mech clock left lever", "CLOCK(12),3001,CLOCK_LEFT_BTN,BTN,335,1,0,1,Mech clock left lever", "VD_20(9),3001,VD_PRESSUR,LEV,57,1,0,1,Baro pressure QFE knob", "CTRL_INTERFACE(37),3017,BRAKE_CONTROL_CPT2,LEV,501,0,0,1,Emergency Wheel Brake Lever", "ELEC_INTERFACE(4),3053,SWITCH_014,TUMB,224,-1,0,1,CB Spotlight Right, ON/OFF", "ELEC_INTERFACE(4),3053,SWITCH_014,TUMB,224,1,0,1,CB Spotlight Right, ON/OFF", "ELEC_INTERFACE(4),3003,RESERVE_GENERATOR,TUMB,143,-1,0,1,Emergency Generator Switch, ON/OFF", "ELEC_INTERFACE(4),3003,RESERVE_GENERATOR,TUMB,143,1,0,1,Emergency Generator Switch, ON/OFF", "RKL_41(21),3010,RKL_L_R,BTN,162,1,0,1,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "RKL_41(21),3010,RKL_L_R,BTN,162,-1,-1,0,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "AIR_INTERFACE(7),3006,SUIT_COND_MODE,TUMB,121,0.05,0,0.25,Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL", "AIR_INTERFACE(7),3006,SUIT_COND_MODE,TUMB,121,-0.05,0,0.25,Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL", "WEAPON_SYSTEM(3),3007,PORT_STARB_BOTH,TUMB,260,-1,0,1,Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)", "WEAPON_SYSTEM(3),3007,PORT_STARB_BOTH,TUMB,260,1,0,1,Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)", "MECHANICS(2),3006,HOOD,TUMB,1000,-1,0,1,Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT", "MECHANICS(2),3006,HOOD,TUMB,1000,1,0,1,Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT", "MECHANICS(2),3001,CANOPY_CPT1,TUMB,998,-1,0,1,Canopy Handle", "MECHANICS(2),3001,CANOPY_CPT1,TUMB,998,1,0,1,Canopy Handle", "MECHANICS(2),3007,CANOPY_LOCK,TUMB,285,0,0,1,Forward Canopy Lock Handle", "MECHANICS(2),3007,CANOPY_LOCK,TUMB,285,1,0,1,Forward Canopy Lock Handle", "MECHANICS(2),3008,CANOPY_LOCK_CPT2,TUMB,485,0,0,1,Rearward Canopy Lock Handle", "MECHANICS(2),3008,CANOPY_LOCK_CPT2,TUMB,485,1,0,1,Rearward Canopy Lock Handle", "ELEC_INTERFACE(4),3028,CONVERTER_2,TUMB,147,-1,0,1,CB Inverter 2 (AC 115V) Switch, ON/OFF", "ELEC_INTERFACE(4),3028,CONVERTER_2,TUMB,147,1,0,1,CB Inverter 2 (AC 115V) Switch, ON/OFF", "ACCELEROMETER(33),3001,G_RESET,BTN,89,1,0,1,Reset Limits", "ELEC_INTERFACE(4),3044,SWITCH_005,TUMB,215,-1,0,1,CB PT-500C, ON/OFF", "ELEC_INTERFACE(4),3044,SWITCH_005,TUMB,215,1,0,1,CB PT-500C, ON/OFF", "WEAPON_SYSTEM(3),3004,HEATING_SS,TUMB,257,-1,0,1,CB Missile Seeker Heating Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3004,HEATING_SS,TUMB,257,1,0,1,CB Missile Seeker Heating Circuit Power Switch, ON/OFF", "CTRL_INTERFACE(37),3022,PITOT_CONTROL,TUMB,333,-1,0,1,Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)", "CTRL_INTERFACE(37),3022,PITOT_CONTROL,TUMB,333,1,0,1,Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)", "CTRL_INTERFACE(37),3012,L_G_CONTRIOL_LEVEL_CPT2,TUMB,437,-0.5,-0.5,1,Landing Gear Control Lever", "CTRL_INTERFACE(37),3012,L_G_CONTRIOL_LEVEL_CPT2,TUMB,437,0.5,-0.5,1,Landing Gear Control Lever", "(0),3003,PANEL_HOOD,TUMB,627,-1,0,1,Panel Visor Extend", "(0),3003,PANEL_HOOD,TUMB,627,1,0,1,Panel Visor Extend", "AIR_INTERFACE(7),3013,TEMP_CONTROL_HELMET,LEV,310,0.5,0,1,Helmet Heating Temperature Rheostat", "WEAPON_SYSTEM(3),3013,FLARES_DISPENSER,TUMB,273,-1,0,1,EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3013,FLARES_DISPENSER,TUMB,273,1,0,1,EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF", "LIGHTS(20),3014,WARNING_LIGHT_INTENSITY_CPT2,LEV,537,1,0,1,Warning-Light Intensity Knob", "NPP(24),3001,NPP_COURSE,LEV,48,0,0,1,HSI Course set knob", "CTRL_INTERFACE(37),3006,FLAPS_44_CPT2,BTN,467,1,0,1,Flaps Landing Position (44 degrees) Button", "LIGHTS(20),3005,EMERGENCY_LIGHT,TUMB,249,-1,0,1,Emergency Instrument Light Switch, ON/OFF", "LIGHTS(20),3005,EMERGENCY_LIGHT,TUMB,249,1,0,1,Emergency Instrument Light Switch, ON/OFF", "RKL_41(21),3004,RKL_FREQ_1_TUNING,LEV,165,0,0,1,RKL-41 ADF Far NDB Frequency Tune", "ASP_3NM(1),3002,pnt_107,LEV,107,0,0,1,ASP-3NMU Gunsight Target Distance", "WEAPON_SYSTEM(3),3008,COVER_LIVE,TUMB,267,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3008,COVER_LIVE,TUMB,267,1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "RKL_41(21),3022,RKL_FREQ_2_00XX_CPT2,TUMB,524,0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "RKL_41(21),3022,RKL_FREQ_2_00XX_CPT2,TUMB,524,-0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "SPU_9(34),3009,SPU_RK_CPT2,TUMB,474,-1,0,1,ADF Audio Switch, ADF/OFF", "SPU_9(34),3009,SPU_RK_CPT2,TUMB,474,1,0,1,ADF Audio Switch, ADF/OFF", "WEAPON_SYSTEM(3),3009,LIVE,TUMB,268,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK", "WEAPON_SYSTEM(3),3009,LIVE,TUMB,268,1,0,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK", "KPP_1273K_INSTRUCTOR(23),3003,KPP_SET_0_CPT2,LEV,376,0,-1,1,KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob", "ELEC_INTERFACE(4),3025,ENGINE,TUMB,144,-1,0,1,CB Engine Switch, ON/OFF", "ELEC_INTERFACE(4),3025,ENGINE,TUMB,144,1,0,1,CB Engine Switch, ON/OFF", "RKL_41(21),3017,RKL_FREQ_1_TUNING_CPT2,LEV,522,0,0,1,RKL-41 ADF Far NDB Frequency Tune", "ASP_3NM(1),3012,SIGHT_SUN_FILTER,TUMB,104,0,0,1,ASP-3NMU Gunsight Color Filter, ON/OFF", "ASP_3NM(1),3012,SIGHT_SUN_FILTER,TUMB,104,1,0,1,ASP-3NMU Gunsight Color Filter, ON/OFF", "ELEC_INTERFACE(4),3058,SWITCH_019,TUMB,229,-1,0,1,CB Ignition 1, ON/OFF", "ELEC_INTERFACE(4),3058,SWITCH_019,TUMB,229,1,0,1,CB Ignition 1, ON/OFF", "WEAPON_SYSTEM(3),3001,MASTER_ARM,TUMB,254,-1,0,1,CB Armament System Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3001,MASTER_ARM,TUMB,254,1,0,1,CB Armament System Power Switch, ON/OFF", "LIGHTS(20),3009,INSTRUMENT_LIGHTING_CONTROL,LEV,331,0.5,0.1,0.9,Instrument Lights Intensity Knob", "ELEC_INTERFACE(4),3011,BTN_ENGINE,BTN,326,1,0,1,Engine Button", "ELEC_INTERFACE(4),3061,SWITCH_022,TUMB,232,-1,0,1,CB Fire, ON/OFF", "ELEC_INTERFACE(4),3061,SWITCH_022,TUMB,232,1,0,1,CB Fire, ON/OFF", "ELEC_INTERFACE(4),3065,SIGNAL,TUMB,504,-1,0,1,CB Signal, ON/OFF", "ELEC_INTERFACE(4),3065,SIGNAL,TUMB,504,1,0,1,CB Signal, ON/OFF", "AIR_INTERFACE(7),3009,ANTI_ICING,TUMB,174,0.1,0,0.2,De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF", "AIR_INTERFACE(7),3009,ANTI_ICING,TUMB,174,-0.1,0,0.2,De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF", "AIR_INTERFACE(7),3004,CABIN_HEATING_MODE,TUMB,172,0.05,0,0.25,Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC", "AIR_INTERFACE(7),3004,CABIN_HEATING_MODE,TUMB,172,-0.05,0,0.25,Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC", "ELEC_INTERFACE(4),3046,SWITCH_007,TUMB,217,-1,0,1,CB SRO, ON/OFF", "ELEC_INTERFACE(4),3046,SWITCH_007,TUMB,217,1,0,1,CB SRO, ON/OFF", "HYDRO_INTERFACE(35),3004,EMERGENCY_VALVE_GEAR_CPT2,TUMB,533,-1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)",
-        "HYDRO_INTERFACE(35),3004,EMERGENCY_VALVE_GEAR_CPT2,TUMB,533,1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "LIGHTS(20),3015,WARNING_LIGHT_CHECK_CPT2,BTN,538,1,0,1,Warning-Light Check Button - Push to check", "FUEL_INTERFACE(5),3003,FUEL_SHUT_OFF_CPT2,TUMB,475,0,0,1,Fuel Shut-Off Lever", "FUEL_INTERFACE(5),3003,FUEL_SHUT_OFF_CPT2,TUMB,475,1,0,1,Fuel Shut-Off Lever", "ELEC_INTERFACE(4),3012,COVER_ENGINE,TUMB,325,-1,0,1,Engine Button Cover, Open/Close", "ELEC_INTERFACE(4),3012,COVER_ENGINE,TUMB,325,1,0,1,Engine Button Cover, Open/Close", "ELEC_INTERFACE(4),3017,ENGINE_STOP_CPT2,TUMB,490,-1,0,1,Stop Engine Switch", "ELEC_INTERFACE(4),3017,ENGINE_STOP_CPT2,TUMB,490,1,0,1,Stop Engine Switch", "CTRL_INTERFACE(37),3007,AIR_BRAKE_BTN,TUMB,136,1,0,1,Air Brake Switch", "CTRL_INTERFACE(37),3008,AIR_BRAKE_BTN,BTN,135,1,0,1,Air Brake Switch", "RKL_41(21),3007,RKL_FREQ_2_TUNING,LEV,168,0,0,1,RKL-41 ADF Near NDB Frequency Tune", "OXYGEN(30),3005,EMERG_OXYGEN_CPT2,TUMB,479,-1,0,1,Emergency Oxygen Switch, ON/OFF", "OXYGEN(30),3005,EMERG_OXYGEN_CPT2,TUMB,479,1,0,1,Emergency Oxygen Switch, ON/OFF", "ELEC_INTERFACE(4),3021,EMERCENCY_FUEL,TUMB,320,-1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3021,EMERCENCY_FUEL,TUMB,320,1,0,1,Emergency Fuel Switch", "WEAPON_SYSTEM(3),3011,EMER_JETTISON,TUMB,270,-1,0,1,Emergency Jettison Switch, ON/OFF", "WEAPON_SYSTEM(3),3011,EMER_JETTISON,TUMB,270,1,0,1,Emergency Jettison Switch, ON/OFF", "RKL_41(21),3012,RKL_REMOTE,TUMB,158,-1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "RKL_41(21),3012,RKL_REMOTE,TUMB,158,1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "CTRL_INTERFACE(37),3001,FLAPS_00,BTN,281,1,0,1,Flaps Flight Position (0 degrees) Button", "LIGHTS(20),3008,INSTRUMENT_LIGHTING,TUMB,330,1,-1,1,Instrument Lighting Switch, Red/OFF/White", "LIGHTS(20),3008,INSTRUMENT_LIGHTING,TUMB,330,-1,-1,1,Instrument Lighting Switch, Red/OFF/White", "RKL_41(21),3027,SWITCH_ARK,TUMB,459,-1,0,1,ARK Failure", "RKL_41(21),3027,SWITCH_ARK,TUMB,459,1,0,1,ARK Failure", "SPU_9(34),3007,SPU_VOLUME_CPT2,LEV,471,0.5,0,0.8,Intercom Volume Knob", "ELEC_INTERFACE(4),3047,SWITCH_008,TUMB,218,-1,0,1,CB Seat-Helmet, ON/OFF", "ELEC_INTERFACE(4),3047,SWITCH_008,TUMB,218,1,0,1,CB Seat-Helmet, ON/OFF", "ENGINE_INTERFACE(6),3001,CONTROL_IV300,BTN,329,1,0,1,IV-300 Engine Vibration Test Button - Push to test", "WEAPON_SYSTEM(3),3016,FLARE_WHITE,TUMB,277,-1,0,1,EKSR-46 White Signal Flare Launch Button", "WEAPON_SYSTEM(3),3016,FLARE_WHITE,TUMB,277,1,0,1,EKSR-46 White Signal Flare Launch Button", "SPU_9(34),3012,SPU_BTN_CPT2,BTN,546,1,0,1,Intercom Button", "FAILURES_PANEL(39),3002,SWITCH_TOTAL_PRESSURE,TUMB,456,0.5,0,1,Full Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3002,SWITCH_TOTAL_PRESSURE,TUMB,456,-0.5,0,1,Full Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3001,SWITCH_STATIC_PRESSURE,TUMB,457,0.5,0,1,Static Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3001,SWITCH_STATIC_PRESSURE,TUMB,457,-0.5,0,1,Static Pressure Failure Lever, ON/STBY/FAILURE", "LIGHTS(20),3010,INSTRUMENT_LIGHTING_CPT2,TUMB,497,1,-1,1,Instrument Lighting Switch, Red/OFF/White", "LIGHTS(20),3010,INSTRUMENT_LIGHTING_CPT2,TUMB,497,-1,-1,1,Instrument Lighting Switch, Red/OFF/White", "CTRL_INTERFACE(37),3002,FLAPS_25,BTN,282,1,0,1,Flaps Takeoff Position (25 degrees) Button", "RADAR_ALTIMETER(14),3001,RV_SELECT_ALT,LEV,61,0.1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RADAR_ALTIMETER(14),3002,RV_SELECT_ALT,BTN,60,1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RKL_41(21),3003,RKL_MODE,TUMB,160,0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "RKL_41(21),3003,RKL_MODE,TUMB,160,-0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "ELEC_INTERFACE(4),3020,COVER_START_MODE,TUMB,321,-1,0,1,Engine Start Mode Switch Cover, Open/Close", "ELEC_INTERFACE(4),3020,COVER_START_MODE,TUMB,321,1,0,1,Engine Start Mode Switch Cover, Open/Close", "OXYGEN(30),3008,VENT_HELMET,TUMB,307,-1,0,1,Helmet Ventilation Switch, ON/OFF", "OXYGEN(30),3008,VENT_HELMET,TUMB,307,1,0,1,Helmet Ventilation Switch, ON/OFF", "KPP_1273K(22),3002,KPP_ARRETIR,BTN,30,1,0,1,KPP-1273K Attitude Director Indicator (ADI) Cage Button", "ELEC_INTERFACE(4),3029,RTL,TUMB,148,-1,0,1,CB RDO (ICS and Radio) Switch, ON/OFF", "ELEC_INTERFACE(4),3029,RTL,TUMB,148,1,0,1,CB RDO (ICS and Radio) Switch, ON/OFF", "GMK1AE(17),3012,SET_GIRO,BTN,124,1,0,1,MC Synchronization Button - Push to synchronize (level flight only)", "RKL_41(21),3014,RKL_VOLUME_CPT2,LEV,514,1,,,RKL-41 ADF Volume Knob", "ELEC_INTERFACE(4),3022,COVER_EMERCENCY_FUEL,TUMB,319,-1,0,1,Emergency Fuel Switch Cover, Open/Close", "ELEC_INTERFACE(4),3022,COVER_EMERCENCY_FUEL,TUMB,319,1,0,1,Emergency Fuel Switch Cover, Open/Close", "SDU(41),3001,RSBN_SDU,TUMB,177,-1,0,1,SDU Switch, ON/OFF", "SDU(41),3001,RSBN_SDU,TUMB,177,1,0,1,SDU Switch, ON/OFF", "RSBN_5(31),3011,RSBN_ALT_SELECTOR,LEV,201,0,0,1,RSBN Field Elevation Knob", "ENGINE_INTERFACE(6),3008,OFF_RT12,TUMB,324,-1,0,1,RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED", "ENGINE_INTERFACE(6),3008,OFF_RT12,TUMB,324,1,0,1,RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED", "ASP_3NM(1),3016,SIGHT_ANGLE_REFLECTOR,LEV,106,0,0,1,ASP-3NMU Gunsight Mirror Depression", "HYDRO_INTERFACE(35),3003,EMERGENCY_VALVE_GEAR,TUMB,194,-1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3003,EMERGENCY_VALVE_GEAR,TUMB,194,1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "ELEC_INTERFACE(4),3032,EMERGENCY_ON_SRO,TUMB,151,-1,0,1,CB IFF (SRO) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3032,EMERGENCY_ON_SRO,TUMB,151,1,0,1,CB IFF (SRO) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3050,SWITCH_011,TUMB,221,-1,0,1,CB Signaling, ON/OFF", "ELEC_INTERFACE(4),3050,SWITCH_011,TUMB,221,1,0,1,CB Signaling, ON/OFF", "ELEC_INTERFACE(4),3052,SWITCH_013,TUMB,223,-1,0,1,CB Spotlight Left, ON/OFF", "ELEC_INTERFACE(4),3052,SWITCH_013,TUMB,223,1,0,1,CB Spotlight Left, ON/OFF", "WEAPON_SYSTEM(3),3018,COVER_LIVE_CPT2,TUMB,508,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3018,COVER_LIVE_CPT2,TUMB,508,1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "RKL_41(21),3016,RKL_MODE_CPT2,TUMB,517,0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "RKL_41(21),3016,RKL_MODE_CPT2,TUMB,517,-0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "ELEC_INTERFACE(4),3041,SWITCH_002,TUMB,212,-1,0,1,CB Anti-Ice, ON/OFF", "ELEC_INTERFACE(4),3041,SWITCH_002,TUMB,212,1,0,1,CB Anti-Ice, ON/OFF", "ELEC_INTERFACE(4),3030,MRP_RV,TUMB,149,-1,0,1,CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF", "ELEC_INTERFACE(4),3030,MRP_RV,TUMB,149,1,0,1,CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF", "NPP(24),3002,SWITCH_GMK,TUMB,458,-1,0,1,GMK Failure", "NPP(24),3002,SWITCH_GMK,TUMB,458,1,0,1,GMK Failure", "RKL_41(21),3026,RKL_BRIGHTNESS_CPT2,LEV,518,1,,,RKL-41 ADF Brightness Knob", "ELEC_INTERFACE(4),3019,START_MODE,TUMB,322,0.1,0,0.2,Engine Start Mode Switch, START/FALSE START/COLD CRANKING", "ELEC_INTERFACE(4),3019,START_MODE,TUMB,322,-0.1,0,0.2,Engine Start Mode Switch, START/FALSE START/COLD CRANKING", "MECHANICS(2),3010,EJECT_CANOPY_CPT2,BTN,539,1,0,1,Rearward Canopy Emergency Jettison Handle", "RSBN_5(31),3005,RSBN_VOLUME,LEV,184,0,0,0.8,RSBN Volume Knob", "ELEC_INTERFACE(4),3069,STAND-BY-OFF,BTN,292,1,0,1,Standby (Left) Pitot Tube Heating Off Button - Push to turn heating off", "GMK1AE(17),3002,GMK_SELECT,TUMB,204,-2,-1,1,GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)", "GMK1AE(17),3002,GMK_SELECT,TUMB,204,2,-1,1,GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)", "ELEC_INTERFACE(4),3064,SEAT,TUMB,503,-1,0,1,CB Seat, ON/OFF", "ELEC_INTERFACE(4),3064,SEAT,TUMB,503,1,0,1,CB Seat, ON/OFF", "ELEC_INTERFACE(4),3031,ISKRA,TUMB,150,-1,0,1,CB RSBN (ISKRA) Switch, ON/OFF", "ELEC_INTERFACE(4),3031,ISKRA,TUMB,150,1,0,1,CB RSBN (ISKRA) Switch, ON/OFF", "ENGINE_INTERFACE(6),3003,FIRE,BTN,328,1,0,1,Fire Extinguish Button - Push to extinguish", "RKL_41(21),3006,RKL_FREQ_1_00XX,TUMB,164,0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "RKL_41(21),3006,RKL_FREQ_1_00XX,TUMB,164,-0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "ELEC_INTERFACE(4),3033,EMERGENCY_ON_ISKRA,TUMB,152,-1,0,1,CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3033,EMERGENCY_ON_ISKRA,TUMB,152,1,0,1,CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3056,SWITCH_017,TUMB,227,-1,0,1,CB Start Panel, ON/OFF", "ELEC_INTERFACE(4),3056,SWITCH_017,TUMB,227,1,0,1,CB Start Panel, ON/OFF", "R_832M(19),3003,RADIO_REMOTE,TUMB,287,-1,0,1,Radio Control Switch - Flip switch to take control", "R_832M(19),3003,RADIO_REMOTE,TUMB,287,1,0,1,Radio Control Switch - Flip switch to take control", "GMK1AE(17),3003,GMK_TEST,BTN,205,-1,-1,0,GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy", "GMK1AE(17),3003,GMK_TEST,BTN,205,1,0,1,GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy", "AIR_INTERFACE(7),3007,AIR_COND,TUMB,511,-1,-1,1,Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE", "AIR_INTERFACE(7),3007,AIR_COND,TUMB,511,1,-1,1,Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE", "RSBN_5(31),3003,TESTING,BTN,180,1,0,1,RSBN Test Button - Push to test", "LIGHTS(20),3013,WARNING_LIGHT_CHECK,BTN,203,1,0,1,Warning-Light Check Button - Push to check", "RKL_41(21),3024,BEACON_SWITCH_CPT2,TUMB,440,-1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "RKL_41(21),3024,BEACON_SWITCH_CPT2,TUMB,440,1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "ELEC_INTERFACE(4),3066,ARMS,TUMB,505,-1,0,1,CB Weapon Switch, ON/OFF", "ELEC_INTERFACE(4),3066,ARMS,TUMB,505,1,0,1,CB Weapon Switch, ON/OFF",
-        "ELEC_INTERFACE(4),3057,SWITCH_018,TUMB,228,-1,0,1,CB Booster Pump, ON/OFF", "ELEC_INTERFACE(4),3057,SWITCH_018,TUMB,228,1,0,1,CB Booster Pump, ON/OFF", "VARIOMETER_INSTRUCTOR(16),3001,VV_SET_0_CPT2,LEV,419,1,0,1,Variometer adjustment knob", "ELEC_INTERFACE(4),3002,MAIN_GENERATOR,TUMB,142,-1,0,1,Main Generator Switch, ON/OFF", "ELEC_INTERFACE(4),3002,MAIN_GENERATOR,TUMB,142,1,0,1,Main Generator Switch, ON/OFF", "WEAPON_SYSTEM(3),3002,UB_16,TUMB,255,-1,0,1,CB UB-16 Rocket Firing Control Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3002,UB_16,TUMB,255,1,0,1,CB UB-16 Rocket Firing Control Circuit Power Switch, ON/OFF", "ELEC_INTERFACE(4),3062,SWITCH_023,TUMB,233,-1,0,1,CB Emergency Jettison, ON/OFF", "ELEC_INTERFACE(4),3062,SWITCH_023,TUMB,233,1,0,1,CB Emergency Jettison, ON/OFF", "ELEC_INTERFACE(4),3023,EMERCENCY_FUEL_CPT2,TUMB,492,-1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3023,EMERCENCY_FUEL_CPT2,TUMB,492,1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3014,COVER_ENGINE_CPT2,TUMB,493,-1,0,1,Engine Button Cover, Open/Close", "ELEC_INTERFACE(4),3014,COVER_ENGINE_CPT2,TUMB,493,1,0,1,Engine Button Cover, Open/Close", "LIGHTS(20),3012,WARNING_LIGHT_INTENSITY,LEV,202,1,0,1,Warning-Light Intensity Knob", "ELEC_INTERFACE(4),3072,ENGINE_INDICAT_EMERG,TUMB,169,-1,0,1,Emergency Engine Instruments Power Switch, ON/OFF", "ELEC_INTERFACE(4),3072,ENGINE_INDICAT_EMERG,TUMB,169,1,0,1,Emergency Engine Instruments Power Switch, ON/OFF", "ELEC_INTERFACE(4),3036,SDU,TUMB,155,-1,0,1,CB SDU Switch, ON/OFF", "ELEC_INTERFACE(4),3036,SDU,TUMB,155,1,0,1,CB SDU Switch, ON/OFF", "ELEC_INTERFACE(4),3010,COVER_TURBO_STOP,TUMB,312,-1,0,1,Stop Turbo Switch Cover, Open/Close", "ELEC_INTERFACE(4),3010,COVER_TURBO_STOP,TUMB,312,1,0,1,Stop Turbo Switch Cover, Open/Close", "MECHANICS(2),3002,CANOPY_CPT2,TUMB,999,-1,0,1,Canopy Handle", "MECHANICS(2),3002,CANOPY_CPT2,TUMB,999,1,0,1,Canopy Handle", "WEAPON_SYSTEM(3),3021,EMER_JETTISON_CPT2,TUMB,507,-1,0,1,Emergency Jettison Switch, ON/OFF", "WEAPON_SYSTEM(3),3021,EMER_JETTISON_CPT2,TUMB,507,1,0,1,Emergency Jettison Switch, ON/OFF", "R_832M(19),3005,RADIO_NOISE_SUPPR_CPT2,TUMB,469,-1,0,1,Squelch Switch, ON/OFF", "R_832M(19),3005,RADIO_NOISE_SUPPR_CPT2,TUMB,469,1,0,1,Squelch Switch, ON/OFF", "LIGHTS(20),3003,NAVIG_LIGHTS_FLICKER,TUMB,176,-0.5,0,1,Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED", "LIGHTS(20),3003,NAVIG_LIGHTS_FLICKER,TUMB,176,0.5,0,1,Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED", "RSBN_5(31),3013,EMER_LANDING_ON,TUMB,527,-1,0,1,RSBN Emergency Landing Switch, ON/OFF", "RSBN_5(31),3013,EMER_LANDING_ON,TUMB,527,1,0,1,RSBN Emergency Landing Switch, ON/OFF", "ELEC_INTERFACE(4),3018,COVER_ENGINE_STOP_CPT2,TUMB,489,-1,0,1,Stop Engine Switch Cover, Open/Close", "ELEC_INTERFACE(4),3018,COVER_ENGINE_STOP_CPT2,TUMB,489,1,0,1,Stop Engine Switch Cover, Open/Close", "GMK1AE(17),3013,SET_GIRO_CPT2,BTN,444,1,0,1,MC Synchronization Button - Push to synchronize (level flight only)", "CTRL_INTERFACE(37),3009,AIR_BRAKE_BTN_CPT2,BTN,548,1,0,1,Air Brake Switch", "CTRL_INTERFACE(37),3009,AIR_BRAKE_BTN_CPT2,BTN,548,-1,-1,0,Air Brake Switch", "HYDRO_INTERFACE(35),3002,EMERGENCY_VALVE_HYDRAULIC_CPT2,TUMB,536,-1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3002,EMERGENCY_VALVE_HYDRAULIC_CPT2,TUMB,536,1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "ELEC_INTERFACE(4),3016,COVER_ENGINE_STOP,TUMB,317,-1,0,1,Stop Engine Switch Cover, Open/Close", "ELEC_INTERFACE(4),3016,COVER_ENGINE_STOP,TUMB,317,1,0,1,Stop Engine Switch Cover, Open/Close", "ASP_3NM(1),3004,SIGHT_BRIGHTNESS,LEV,102,0,0,1,ASP-3NMU Gunsight Brightness Knob", "WEAPON_SYSTEM(3),3012,ROCKETS_MODE_SELECTOR,TUMB,271,-0.1,0.1,0.3,Rockets Firing Mode Selector Switch, AUT./2RS/4RS", "WEAPON_SYSTEM(3),3012,ROCKETS_MODE_SELECTOR,TUMB,271,0.1,0.1,0.3,Rockets Firing Mode Selector Switch, AUT./2RS/4RS", "AIR_INTERFACE(7),3010,DE_ICE,BTN,183,1,0,1,RIO-3 De-Icing Sensor Heating Circuit Check Button - Push to test", "RKL_41(21),3008,RKL_FREQ_2_XX00,TUMB,166,0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "RKL_41(21),3008,RKL_FREQ_2_XX00,TUMB,166,-0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "LIGHTS(20),3004,NAVIG_LIGHTS_BRIGHTNESS,TUMB,175,0.5,0,1,Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)", "LIGHTS(20),3004,NAVIG_LIGHTS_BRIGHTNESS,TUMB,175,-0.5,0,1,Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)", "OXYGEN(30),3006,SWITSH_OXYGEN,TUMB,304,-1,0,1,Diluter Demand Switch, 100% / MIX", "OXYGEN(30),3006,SWITSH_OXYGEN,TUMB,304,1,0,1,Diluter Demand Switch, 100% / MIX", "RKL_41(21),3001,RKL_VOLUME,LEV,157,1,,,RKL-41 ADF Volume Knob", "CTRL_INTERFACE(37),3016,BRAKE_CONTROL,LEV,334,0,-1,1,Emergency/Parking Wheel Brake Lever", "ELEC_INTERFACE(4),3055,SWITCH_016,TUMB,226,-1,0,1,CB White Lights, ON/OFF", "ELEC_INTERFACE(4),3055,SWITCH_016,TUMB,226,1,0,1,CB White Lights, ON/OFF", "SPU_9(34),3011,RADIO_BTN_CPT2,BTN,547,1,0,1,Radio Button", "CTRL_INTERFACE(37),3024,BRAKE_CONTROL_LOCK,TUMB,334,0,0,1,Parking Brake Lever Flag - Push to remove parking brake", "WEAPON_SYSTEM(3),3006,VOLUME_SS,LEV,259,1,0,1,Missile Seeker Tone Volume Knob", "KPP_1273K(22),3008,SWITCH_AGD_PITCH,TUMB,460,-1,0,1,AGD Pitch Failure", "KPP_1273K(22),3008,SWITCH_AGD_PITCH,TUMB,460,1,0,1,AGD Pitch Failure", "ELEC_INTERFACE(4),3040,SWITCH_001,TUMB,211,-1,0,1,CB Air Conditioning, ON/OFF", "ELEC_INTERFACE(4),3040,SWITCH_001,TUMB,211,1,0,1,CB Air Conditioning, ON/OFF", "AIR_INTERFACE(7),3011,HEATING_QUICK,BTN,309,1,0,1,Helmet Visor Quick Heating Button - Push to heat", "WEAPON_SYSTEM(3),3019,LIVE_CPT2,TUMB,509,-1,-1,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK", "WEAPON_SYSTEM(3),3019,LIVE_CPT2,TUMB,509,1,-1,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK", "R_832M(19),3001,RADIO_CHANNEL,TUMB,284,0.05,0,0.95,R-832M Preset Channel Selector Knob", "R_832M(19),3001,RADIO_CHANNEL,TUMB,284,-0.05,0,0.95,R-832M Preset Channel Selector Knob", "FUEL_INTERFACE(5),3002,FUEL_SHUT_OFF,TUMB,296,0,0,1,Fuel Shut-Off Lever", "FUEL_INTERFACE(5),3002,FUEL_SHUT_OFF,TUMB,296,1,0,1,Fuel Shut-Off Lever", "SPU_9(34),3005,RADIO_BTN,BTN,134,1,0,1,Radio Button", "ELEC_INTERFACE(4),3054,SWITCH_015,TUMB,225,-1,0,1,CB Red Lights, ON/OFF", "ELEC_INTERFACE(4),3054,SWITCH_015,TUMB,225,1,0,1,CB Red Lights, ON/OFF", "RKL_41(21),3025,RKL_REMOTE_CPT2,TUMB,515,-1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "RKL_41(21),3025,RKL_REMOTE_CPT2,TUMB,515,1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "ELEC_INTERFACE(4),3034,WING_TANK,TUMB,153,-1,0,1,CB Wing Tanks Switch, ON/OFF", "ELEC_INTERFACE(4),3034,WING_TANK,TUMB,153,1,0,1,CB Wing Tanks Switch, ON/OFF", "RSBN_5(31),3012,RSBN_BEACON_AUDIO,BTN,297,1,0,1,RSBN Listen Callsign Button - Push to listen", "CTRL_INTERFACE(37),3011,L_G_CONTRIOL_LEVEL,TUMB,118,-1,-1,1,Landing Gear Control Lever", "CTRL_INTERFACE(37),3011,L_G_CONTRIOL_LEVEL,TUMB,118,1,-1,1,Landing Gear Control Lever", "OXYGEN(30),3003,BOTTLES_ INTERCON,LEV,484,0,0,1,Oxygen Interconnaction Valve (CLOSE - CW, OPEN - CCW)", "ENGINE_INTERFACE(6),3002,COVER_FIRE,TUMB,327,-1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3002,COVER_FIRE,TUMB,327,1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "RKL_41(21),3011,BEACON_SWITCH,TUMB,119,-1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "RKL_41(21),3011,BEACON_SWITCH,TUMB,119,1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "RSBN_5(31),3001,RSBN_MODE,TUMB,178,0.1,0,0.2,RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH", "RSBN_5(31),3001,RSBN_MODE,TUMB,178,-0.1,0,0.2,RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH", "ELEC_INTERFACE(4),3013,ENGINE_CPT2,BTN,494,1,0,1,Engine Button", "ENGINE_INTERFACE(6),3011,CONTROL_EGT_IND,TUMB,499,-1,0,1,EGT Indicator Switch, FRONT/REAR", "ENGINE_INTERFACE(6),3011,CONTROL_EGT_IND,TUMB,499,1,0,1,EGT Indicator Switch, FRONT/REAR", "ELEC_INTERFACE(4),3049,SWITCH_010,TUMB,220,-1,0,1,CB Control, ON/OFF", "ELEC_INTERFACE(4),3049,SWITCH_010,TUMB,220,1,0,1,CB Control, ON/OFF", "ELEC_INTERFACE(4),3006,COVER_TURBO,TUMB,314,-1,0,1,Turbo Button Cover, Open/Close", "ELEC_INTERFACE(4),3006,COVER_TURBO,TUMB,314,1,0,1,Turbo Button Cover, Open/Close", "CLOCK_INSTRUCTOR(13),3005,CLOCK_RIGHT_BTN_CPT2,LEV,415,0,0,0.3,Mech clock right lever", "CLOCK_INSTRUCTOR(13),3004,CLOCK_RIGHT_BTN_CPT2,BTN,414,1,0,1,Mech clock right lever", "ENGINE_INTERFACE(6),3007,COVER_OFF_RT12,TUMB,323,-1,0,1,RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3007,COVER_OFF_RT12,TUMB,323,1,0,1,RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE", "R_832M(19),3004,RADIO_CHANNEL_CPT2,TUMB,468,0.05,0,0.95,R-832M Preset Channel Selector Knob", "R_832M(19),3004,RADIO_CHANNEL_CPT2,TUMB,468,-0.05,0,0.95,R-832M Preset Channel Selector Knob", "ELEC_INTERFACE(4),3026,AGD_GMK,TUMB,145,-1,0,1,CB AGD-GMK Switch, ON/OFF", "ELEC_INTERFACE(4),3026,AGD_GMK,TUMB,145,1,0,1,CB AGD-GMK Switch, ON/OFF", "RADAR_ALTIMETER(14),3004,RV_SELECT_ALT_CPT2,LEV,399,0.1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RADAR_ALTIMETER(14),3005,RV_SELECT_ALT_CPT2,BTN,398,1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RKL_41(21),3019,RKL_FREQ_1_00XX_CPT2,TUMB,521,0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "RKL_41(21),3019,RKL_FREQ_1_00XX_CPT2,TUMB,521,-0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "AIR_INTERFACE(7),3001,PRESSUR,LEV,245,0,0,1,ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON", "ASP_3NM(1),3003,SIGHT_MODE,TUMB,101,-1,0,1,ASP-3NMU Gunsight Mode, GYRO/FIXED", "ASP_3NM(1),3003,SIGHT_MODE,TUMB,101,1,0,1,ASP-3NMU Gunsight Mode, GYRO/FIXED", "ELEC_INTERFACE(4),3005,TURBO,BTN,315,1,0,1,Turbo Button", "AIR_INTERFACE(7),3008,COVER_AIR_COND,TUMB,510,-1,0,1,Conditioning Shutoff Switch Cover, OPEN/CLOSE", "AIR_INTERFACE(7),3008,COVER_AIR_COND,TUMB,510,1,0,1,Conditioning Shutoff Switch Cover, OPEN/CLOSE",
-        "R_832M(19),3006,RADIO_REMOTE_CPT2,TUMB,470,-1,0,1,Radio Control Switch - Flip switch to take control", "R_832M(19),3006,RADIO_REMOTE_CPT2,TUMB,470,1,0,1,Radio Control Switch - Flip switch to take control", "WEAPON_SYSTEM(3),3003,ASP_FKP,TUMB,256,-1,0,1,CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3003,ASP_FKP,TUMB,256,1,0,1,CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF", "SPU_9(34),3003,SPU_RK,TUMB,291,-1,0,1,ADF Audio Switch, ADF/OFF", "SPU_9(34),3003,SPU_RK,TUMB,291,1,0,1,ADF Audio Switch, ADF/OFF", "RKL_41(21),3018,RKL_FREQ_1_XX_CPT2,TUMB,520,0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3018,RKL_FREQ_1_XX_CPT2,TUMB,520,-0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3009,RKL_FREQ_2_00XX,TUMB,167,0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "RKL_41(21),3009,RKL_FREQ_2_00XX,TUMB,167,-0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "ELEC_INTERFACE(4),3042,SWITCH_003,TUMB,213,-1,0,1,CB Pitot Left, ON/OFF", "ELEC_INTERFACE(4),3042,SWITCH_003,TUMB,213,1,0,1,CB Pitot Left, ON/OFF"],
-    "L-39ZA": ["GMK1AE(17),3014,MAGNETIC_VAR_KNOB,LEV,532,0,0,1,Magnetic Declination set knob", "HYDRO_INTERFACE(35),3008,EMERGENCY_VALVE_GENERATOR_CPT2,TUMB,535,-1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3008,EMERGENCY_VALVE_GENERATOR_CPT2,TUMB,535,1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "GMK1AE(17),3005,GMK_ZK,BTN,208,-1,-1,0,GMK-1AE GMC Course Selector Switch, CCW/OFF/CW", "GMK1AE(17),3005,GMK_ZK,BTN,208,1,0,1,GMK-1AE GMC Course Selector Switch, CCW/OFF/CW", "ELEC_INTERFACE(4),3047,SWITCH_008,TUMB,218,-1,0,1,CB Seat-Helmet, ON/OFF", "ELEC_INTERFACE(4),3047,SWITCH_008,TUMB,218,1,0,1,CB Seat-Helmet, ON/OFF", "ASP_3NM(1),3011,SIGHT_MECH,TUMB,105,0,0,1,ASP-3NMU Gunsight Fixed Reticle Mask Lever", "ASP_3NM(1),3011,SIGHT_MECH,TUMB,105,1,0,1,ASP-3NMU Gunsight Fixed Reticle Mask Lever", "ELEC_INTERFACE(4),3024,COVER_EMERCENCY_FUEL_CPT2,TUMB,491,-1,0,1,Emergency Fuel Switch Cover, Open/Close", "ELEC_INTERFACE(4),3024,COVER_EMERCENCY_FUEL_CPT2,TUMB,491,1,0,1,Emergency Fuel Switch Cover, Open/Close", "ELEC_INTERFACE(4),3004,NETW,TUMB,502,-1,0,1,Net Switch, ON/OFF", "ELEC_INTERFACE(4),3004,NETW,TUMB,502,1,0,1,Net Switch, ON/OFF", "ELEC_INTERFACE(4),3059,SWITCH_020,TUMB,230,-1,0,1,CB Ignition 2, ON/OFF", "ELEC_INTERFACE(4),3059,SWITCH_020,TUMB,230,1,0,1,CB Ignition 2, ON/OFF", "ELEC_INTERFACE(4),3060,SWITCH_021,TUMB,231,-1,0,1,CB Engine Instruments, ON/OFF", "ELEC_INTERFACE(4),3060,SWITCH_021,TUMB,231,1,0,1,CB Engine Instruments, ON/OFF", "ELEC_INTERFACE(4),3067,INTERCOM_GRND,TUMB,512,-1,0,1,CB Ground Intercom, ON/OFF", "ELEC_INTERFACE(4),3067,INTERCOM_GRND,TUMB,512,1,0,1,CB Ground Intercom, ON/OFF", "ELEC_INTERFACE(4),3045,SWITCH_006,TUMB,216,-1,0,1,CB ARC, ON/OFF", "ELEC_INTERFACE(4),3045,SWITCH_006,TUMB,216,1,0,1,CB ARC, ON/OFF", "RSBN_5(31),3010,SETTING_0_AZ,BTN,193,1,0,1,Set 0 Azimuth", "LIGHTS(20),3006,LANDING_LIGHTS,TUMB,311,1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "LIGHTS(20),3006,LANDING_LIGHTS,TUMB,311,-1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "WEAPON_SYSTEM(3),3053,CHARGE_GUNS_INNER,TUMB,578,-1,0,1,Charge Inner Guns", "WEAPON_SYSTEM(3),3053,CHARGE_GUNS_INNER,TUMB,578,1,0,1,Charge Inner Guns", "CLOCK_INSTRUCTOR(13),3003,CLOCK_LEFT_BTN_CPT2,LEV,413,0.04,0,1,Mech clock left lever", "CLOCK_INSTRUCTOR(13),3002,CLOCK_LEFT_BTN_CPT2,BTN,412,-1,-1,0,Mech clock left lever", "CLOCK_INSTRUCTOR(13),3001,CLOCK_LEFT_BTN_CPT2,BTN,412,1,0,1,Mech clock left lever", "ELEC_INTERFACE(4),3007,TURBO_CPT2,BTN,488,1,0,1,Turbo Button", "RSBN_5(31),3007,SETTING_RANGE,BTN,188,1,0,1,Initial Range", "RSBN_5(31),3007,SETTING_RANGE,BTN,188,-1,-1,0,Initial Range", "WEAPON_SYSTEM(3),3014,FLARE_GREEN,TUMB,275,-1,0,1,EKSR-46 Green Signal Flare Launch Button", "WEAPON_SYSTEM(3),3014,FLARE_GREEN,TUMB,275,1,0,1,EKSR-46 Green Signal Flare Launch Button", "CTRL_INTERFACE(37),3004,FLAPS_00_CPT2,BTN,465,1,0,1,Flaps Flight Position (0 degrees) Button", "WEAPON_SYSTEM(3),3046,CHARGE_GS,BTN,579,1,0,1,Pyro Charge Apply", "ELEC_INTERFACE(4),3001,BATTERY,TUMB,141,-1,0,1,Battery Switch, ON/OFF", "ELEC_INTERFACE(4),3001,BATTERY,TUMB,141,1,0,1,Battery Switch, ON/OFF", "VARIOMETER(15),3001,VV_SET_0,LEV,569,1,0,1,Variometer adjustment knob", "AIR_INTERFACE(7),3012,HEATING_HELMET_MODE,TUMB,308,0.5,0,1,Helmet Heating Mode Switch, AUTO/OFF/ON", "AIR_INTERFACE(7),3012,HEATING_HELMET_MODE,TUMB,308,-0.5,0,1,Helmet Heating Mode Switch, AUTO/OFF/ON", "WEAPON_SYSTEM(3),3044,EMER_JETTISON2,TUMB,590,-1,0,1,Emergency Jettison Inboard Stations Switch, ON/OFF", "WEAPON_SYSTEM(3),3044,EMER_JETTISON2,TUMB,590,1,0,1,Emergency Jettison Inboard Stations Switch, ON/OFF", "SPU_9(34),3002,RADIO_VOLUME,LEV,289,0.5,0,0.8,Radio Volume Knob", "RSBN_5(31),3004,RSBN LIGHTING,LEV,181,0,0,1,RSBN Control Box Lighting Intensity Knob", "AIR_INTERFACE(7),3002,PRESSUR_CPT2,LEV,245,0,0,1,ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON", "AIR_INTERFACE(7),3003,CABIN_TEMP,LEV,173,0.5,0,1,Cabin Air Temperature Controller Rheostat", "LIGHTS(20),3007,LANDING_LIGHTS_CPT2,TUMB,486,1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "LIGHTS(20),3007,LANDING_LIGHTS_CPT2,TUMB,486,-1,-1,1,Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING", "WEAPON_SYSTEM(3),3057,GUNS_WING_INNER,TUMB,598,-1,0,1,Arm Inner Guns", "WEAPON_SYSTEM(3),3057,GUNS_WING_INNER,TUMB,598,1,0,1,Arm Inner Guns", "KPP_1273K(22),3009,SWITCH_AGD_ROLL,TUMB,461,-1,0,1,AGD Bank Failure", "KPP_1273K(22),3009,SWITCH_AGD_ROLL,TUMB,461,1,0,1,AGD Bank Failure", "WEAPON_SYSTEM(3),3058,BOMBS,TUMB,596,-1,0,1,Arm Bombs", "WEAPON_SYSTEM(3),3058,BOMBS,TUMB,596,1,0,1,Arm Bombs", "ASP_3NM(1),3001,SIGHT_BASE,LEV,103,0,0,1,ASP-3NMU Gunsight Target Wingspan Adjustment Dial (meters)", "RKL_41(21),3020,RKL_FREQ_2_TUNING_CPT2,LEV,525,0,0,1,RKL-41 ADF Near NDB Frequency Tune", "ELEC_INTERFACE(4),3070,MAIN-ON,BTN,295,1,0,1,Main (Right) Pitot Tube Heating Button - Push to turn heating on", "ELEC_INTERFACE(4),3048,SWITCH_009,TUMB,219,-1,0,1,CB Gears, ON/OFF", "ELEC_INTERFACE(4),3048,SWITCH_009,TUMB,219,1,0,1,CB Gears, ON/OFF", "CTRL_INTERFACE(37),3003,FLAPS_44,BTN,283,1,0,1,Flaps Landing Position (44 degrees) Button", "VD_20_INSTRUCTOR(10),3001,VD_PRESSUR_CPT2,LEV,394,1,0,1,Baro pressure QFE knob", "CLOCK(12),3005,CLOCK_RIGHT_BTN,LEV,338,0,0,0.3,Mech clock right lever", "CLOCK(12),3004,CLOCK_RIGHT_BTN,BTN,337,1,0,1,Mech clock right lever", "OXYGEN(30),3002,VALVE_OXYGEN_CPT2,LEV,482,0,0,1,Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)", "RKL_41(21),3023,RKL_L_R_CPT2,BTN,519,1,0,1,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "RKL_41(21),3023,RKL_L_R_CPT2,BTN,519,-1,-1,0,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "SARPP(36),3001,FLIGHT_REC_SWITCH,TUMB,298,-1,0,1,SARPP Flight Recorder, ON/OFF", "SARPP(36),3001,FLIGHT_REC_SWITCH,TUMB,298,1,0,1,SARPP Flight Recorder, ON/OFF", "WEAPON_SYSTEM(3),3005,GLOWING_SS,TUMB,258,-1,0,1,CB Missile Seeker Glowing Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3005,GLOWING_SS,TUMB,258,1,0,1,CB Missile Seeker Glowing Circuit Power Switch, ON/OFF", "ELEC_INTERFACE(4),3009,TURBO_STOP,TUMB,313,-1,0,1,Stop Turbo Switch, ON/OFF", "ELEC_INTERFACE(4),3009,TURBO_STOP,TUMB,313,1,0,1,Stop Turbo Switch, ON/OFF", "ELEC_INTERFACE(4),3035,RIO,TUMB,154,-1,0,1,CB RIO-3 De-Icing Signal Switch, ON/OFF", "ELEC_INTERFACE(4),3035,RIO,TUMB,154,1,0,1,CB RIO-3 De-Icing Signal Switch, ON/OFF", "OXYGEN(30),3001,VALVE_OXYGEN,LEV,306,0,0,1,Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)", "WEAPON_SYSTEM(3),3017,FLARE_YELLOW,TUMB,274,-1,0,1,EKSR-46 Yellow Signal Flare Launch Button", "WEAPON_SYSTEM(3),3017,FLARE_YELLOW,TUMB,274,1,0,1,EKSR-46 Yellow Signal Flare Launch Button", "KPP_1273K_INSTRUCTOR(23),3002,KPP_ARRETIR_CPT2,BTN,367,1,0,1,KPP-1273K Attitude Director Indicator (ADI) Cage Button", "WEAPON_SYSTEM(3),3047,CANNON_GS,TUMB,576,-1,0,1,Gsh-23 Arm/Safe", "WEAPON_SYSTEM(3),3047,CANNON_GS,TUMB,576,1,0,1,Gsh-23 Arm/Safe", "AIR_INTERFACE(7),3006,SUIT_COND_MODE,TUMB,121,0.05,0,0.25,Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL", "AIR_INTERFACE(7),3006,SUIT_COND_MODE,TUMB,121,-0.05,0,0.25,Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL", "HYDRO_INTERFACE(35),3005,EMERGENCY_VALVE_FLAPS,TUMB,195,-1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3005,EMERGENCY_VALVE_FLAPS,TUMB,195,1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "ELEC_INTERFACE(4),3008,COVER_TURBO_CPT2,TUMB,487,-1,0,1,Turbo Button Cover, Open/Close", "ELEC_INTERFACE(4),3008,COVER_TURBO_CPT2,TUMB,487,1,0,1,Turbo Button Cover, Open/Close", "KPP_1273K(22),3003,KPP_SET_0,LEV,39,0,-1,1,KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob", "ELEC_INTERFACE(4),3051,SWITCH_012,TUMB,222,-1,0,1,CB Nav. Lights, ON/OFF", "ELEC_INTERFACE(4),3051,SWITCH_012,TUMB,222,1,0,1,CB Nav. Lights, ON/OFF", "RKL_41(21),3002,RKL_TLF_TLG,TUMB,159,-1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "RKL_41(21),3002,RKL_TLF_TLG,TUMB,159,1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "GMK1AE(17),3006,GMK_LATITUDE,LEV,209,0,0,0.728,GMK-1AE GMC Latitude Selector Knob", "ELEC_INTERFACE(4),3063,SWITCH_024,TUMB,234,-1,0,1,CB SARPP, ON/OFF", "ELEC_INTERFACE(4),3063,SWITCH_024,TUMB,234,1,0,1,CB SARPP, ON/OFF", "WEAPON_SYSTEM(3),3020,COVER_EMER_JETTISON_CPT2,TUMB,506,-1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3020,COVER_EMER_JETTISON_CPT2,TUMB,506,1,0,1,Emergency Jettison Switch Cover, OPEN/CLOSE", "NPP_INSTRUCTOR(25),3002,WARNING_LIGHT_CHECK003,BTN,526,1,0,1,Course Accordance", "RSBN_5(31),3009,CHANNEL_RANGE,TUMB,192,0.025,0,0.975,RSBN Landing Channel Selector Knob", "RSBN_5(31),3009,CHANNEL_RANGE,TUMB,192,-0.025,0,0.975,RSBN Landing Channel Selector Knob", "RSBN_5(31),3001,RSBN_MODE,TUMB,178,0.1,0,0.2,RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH", "RSBN_5(31),3001,RSBN_MODE,TUMB,178,-0.1,0,0.2,RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH", "RKL_41(21),3021,RKL_FREQ_2_XX_CPT2,TUMB,523,0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "RKL_41(21),3021,RKL_FREQ_2_XX_CPT2,TUMB,523,-0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "SPU_9(34),3005,RADIO_BTN,BTN,134,1,0,1,Radio Button", "OXYGEN(30),3004,EMERG_OXYGEN,TUMB,303,-1,0,1,Emergency Oxygen Switch, ON/OFF", "OXYGEN(30),3004,EMERG_OXYGEN,TUMB,303,1,0,1,Emergency Oxygen Switch, ON/OFF", "ELEC_INTERFACE(4),3071,MAIN-OFF,BTN,293,1,0,1,Main (Right) Pitot Tube Heating Off Button - Push to turn heating off", "ELEC_INTERFACE(4),3013,ENGINE_CPT2,BTN,494,1,0,1,Engine Button", "SPU_9(34),3006,SPU_BTN,BTN,133,1,0,1,Intercom Button", "SPU_9(34),3008,RADIO_VOLUME_CPT2,LEV,472,0.5,0,0.8,Radio Volume Knob", "HYDRO_INTERFACE(35),3007,EMERGENCY_VALVE_GENERATOR,TUMB,196,-1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)",
-        "HYDRO_INTERFACE(35),3007,EMERGENCY_VALVE_GENERATOR,TUMB,196,1,0,1,RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)", "GMK1AE(17),3004,GMK_MODE,TUMB,207,-2,-1,1,GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)", "GMK1AE(17),3004,GMK_MODE,TUMB,207,2,-1,1,GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)", "SPU_9(34),3011,RADIO_BTN_CPT2,BTN,547,1,0,1,Radio Button", "ELEC_INTERFACE(4),3043,SWITCH_004,TUMB,214,-1,0,1,CB Pitot Right, ON/OFF", "ELEC_INTERFACE(4),3043,SWITCH_004,TUMB,214,1,0,1,CB Pitot Right, ON/OFF", "NPP_INSTRUCTOR(25),3001,NPP_COURSE_CPT2,LEV,385,0,0,1,HSI Course set knob", "RSBN_5(31),3002,IDENTIF,BTN,179,1,0,1,RSBN Identification Button", "R_832M(19),3002,RADIO_NOISE_SUPPR,TUMB,286,-1,0,1,Squelch Switch, ON/OFF", "R_832M(19),3002,RADIO_NOISE_SUPPR,TUMB,286,1,0,1,Squelch Switch, ON/OFF", "ELEC_INTERFACE(4),3068,STAND-BY-ON,BTN,294,1,0,1,Standby (Left) Pitot Tube Heating Button - Push to turn heating on", "MECHANICS(2),3009,EJECT_CANOPY,BTN,244,1,0,1,Forward Canopy Emergency Jettison Handle", "SPU_9(34),3004,SPU_REZ,TUMB,290,-1,0,1,Reserve Intercom Switch, ON/OFF", "SPU_9(34),3004,SPU_REZ,TUMB,290,1,0,1,Reserve Intercom Switch, ON/OFF", "WEAPON_SYSTEM(3),3015,FLARE_RED,TUMB,276,-1,0,1,EKSR-46 Red Signal Flare Launch Button", "WEAPON_SYSTEM(3),3015,FLARE_RED,TUMB,276,1,0,1,EKSR-46 Red Signal Flare Launch Button", "AIR_INTERFACE(7),3005,SUIT_TEMPR,LEV,120,0.5,0,1,Diffuser and Flight Suit Temperature Rheostat", "ENGINE_INTERFACE(6),3004,COVER_FIRE_CPT2,TUMB,495,-1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3004,COVER_FIRE_CPT2,TUMB,495,1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3005,FIRE_CPT2,BTN,496,1,0,1,Fire Extinguish Button - Push to extinguish", "RKL_41(21),3013,RKL_BRIGHTNESS,LEV,161,1,,,RKL-41 ADF Brightness Knob", "ENGINE_INTERFACE(6),3006,TEST_SSP,BTN,272,1,0,1,Fire Warning Signal Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3006,TEST_SSP,BTN,272,-1,-1,0,Fire Warning Signal Test Switch, I/OFF/II", "R_832M(19),3006,RADIO_REMOTE_CPT2,TUMB,470,-1,0,1,Radio Control Switch - Flip switch to take control", "R_832M(19),3006,RADIO_REMOTE_CPT2,TUMB,470,1,0,1,Radio Control Switch - Flip switch to take control", "ENGINE_INTERFACE(6),3009,RT12,TUMB,243,-1,0,1,RT-12 JPT Regulator Power Switch, ON/OFF", "ENGINE_INTERFACE(6),3009,RT12,TUMB,243,1,0,1,RT-12 JPT Regulator Power Switch, ON/OFF", "RKL_41(21),3005,RKL_FREQ_1_XX00,TUMB,163,0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3005,RKL_FREQ_1_XX00,TUMB,163,-0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RSBN_5(31),3006,SETTING_AZ,BTN,187,1,0,1,Initial Azimuth", "RSBN_5(31),3006,SETTING_AZ,BTN,187,-1,-1,0,Initial Azimuth", "RKL_41(21),3015,RKL_TLF_TLG_CPT2,TUMB,516,-1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "RKL_41(21),3015,RKL_TLF_TLG_CPT2,TUMB,516,1,0,1,RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)", "CLOCK(12),3003,CLOCK_LEFT_BTN,LEV,336,0.04,0,1,Mech clock left lever", "CLOCK(12),3002,CLOCK_LEFT_BTN,BTN,335,-1,-1,0,Mech clock left lever", "CLOCK(12),3001,CLOCK_LEFT_BTN,BTN,335,1,0,1,Mech clock left lever", "ENGINE_INTERFACE(6),3010,TEST_RT12,TUMB,242,1,-1,1,RT-12 JPT Regulator Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3010,TEST_RT12,TUMB,242,-1,-1,1,RT-12 JPT Regulator Test Switch, I/OFF/II", "ENGINE_INTERFACE(6),3011,CONTROL_EGT_IND,TUMB,499,-1,0,1,EGT Indicator Switch, FRONT/REAR", "ENGINE_INTERFACE(6),3011,CONTROL_EGT_IND,TUMB,499,1,0,1,EGT Indicator Switch, FRONT/REAR", "ELEC_INTERFACE(4),3053,SWITCH_014,TUMB,224,-1,0,1,CB Spotlight Right, ON/OFF", "ELEC_INTERFACE(4),3053,SWITCH_014,TUMB,224,1,0,1,CB Spotlight Right, ON/OFF", "ELEC_INTERFACE(4),3003,RESERVE_GENERATOR,TUMB,143,-1,0,1,Emergency Generator Switch, ON/OFF", "ELEC_INTERFACE(4),3003,RESERVE_GENERATOR,TUMB,143,1,0,1,Emergency Generator Switch, ON/OFF", "ELEC_INTERFACE(4),3037,AOA_HTR,TUMB,628,-1,0,1,CB Heating AOA Sensor Switch, ON/OFF", "ELEC_INTERFACE(4),3037,AOA_HTR,TUMB,628,1,0,1,CB Heating AOA Sensor Switch, ON/OFF", "CTRL_INTERFACE(37),3001,FLAPS_00,BTN,281,1,0,1,Flaps Flight Position (0 degrees) Button", "WEAPON_SYSTEM(3),3007,PORT_STARB_BOTH,TUMB,260,-2,-1,1,Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)", "WEAPON_SYSTEM(3),3007,PORT_STARB_BOTH,TUMB,260,2,-1,1,Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)", "MECHANICS(2),3006,HOOD,TUMB,1000,-1,0,1,Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT", "MECHANICS(2),3006,HOOD,TUMB,1000,1,0,1,Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT", "OXYGEN(30),3007,SWITSH_OXYGEN_CPT2,TUMB,480,-1,0,1,Diluter Demand Switch, 100% / MIX", "OXYGEN(30),3007,SWITSH_OXYGEN_CPT2,TUMB,480,1,0,1,Diluter Demand Switch, 100% / MIX", "WEAPON_SYSTEM(3),3045,PYRO,TUMB,607,0.5,0,1,Pyro Charge Select", "WEAPON_SYSTEM(3),3045,PYRO,TUMB,607,-0.5,0,1,Pyro Charge Select", "CTRL_INTERFACE(37),3005,FLAPS_25_CPT2,BTN,466,1,0,1,Flaps Takeoff Position (25 degrees) Button", "CTRL_INTERFACE(37),3021,THROTTLE_LIMIT,TUMB,549,-1,0,1,Throttle Limiter", "CTRL_INTERFACE(37),3021,THROTTLE_LIMIT,TUMB,549,1,0,1,Throttle Limiter", "CTRL_INTERFACE(37),3017,BRAKE_CONTROL_CPT2,LEV,501,0,0,1,Emergency Wheel Brake Lever", "ELEC_INTERFACE(4),3044,SWITCH_005,TUMB,215,-1,0,1,CB PT-500C, ON/OFF", "ELEC_INTERFACE(4),3044,SWITCH_005,TUMB,215,1,0,1,CB PT-500C, ON/OFF", "WEAPON_SYSTEM(3),3004,HEATING_SS,TUMB,257,-1,0,1,CB Missile Seeker Heating Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3004,HEATING_SS,TUMB,257,1,0,1,CB Missile Seeker Heating Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3043,EMER_JETTISON2_COVER,TUMB,589,-1,0,1,Emergency Jettison Inboard Stations Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3043,EMER_JETTISON2_COVER,TUMB,589,1,0,1,Emergency Jettison Inboard Stations Switch Cover, OPEN/CLOSE", "CTRL_INTERFACE(37),3012,L_G_CONTRIOL_LEVEL_CPT2,TUMB,437,-0.5,-0.5,1,Landing Gear Control Lever", "CTRL_INTERFACE(37),3012,L_G_CONTRIOL_LEVEL_CPT2,TUMB,437,0.5,-0.5,1,Landing Gear Control Lever", "HYDRO_INTERFACE(35),3001,EMERGENCY_VALVE_HYDRAULIC,TUMB,197,-1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3001,EMERGENCY_VALVE_HYDRAULIC,TUMB,197,1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "LIGHTS(20),3011,INSTRUMENT_LIGHTING_CONTROL_CPT2,LEV,498,0.5,0.1,0.9,Instrument Lights Intensity Knob", "HYDRO_INTERFACE(35),3006,EMERGENCY_VALVE_FLAPS_CPT2,TUMB,534,-1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3006,EMERGENCY_VALVE_FLAPS_CPT2,TUMB,534,1,0,1,Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "SPU_9(34),3010,SPU_REZ_CPT2,TUMB,473,-1,0,1,Reserve Intercom Switch, ON/OFF", "SPU_9(34),3010,SPU_REZ_CPT2,TUMB,473,1,0,1,Reserve Intercom Switch, ON/OFF", "VD_20(9),3001,VD_PRESSUR,LEV,57,1,0,1,Baro pressure QFE knob", "WEAPON_SYSTEM(3),3048,PYLON_OUT_ON,TUMB,585,-1,0,1,Outboard Stations Select", "WEAPON_SYSTEM(3),3048,PYLON_OUT_ON,TUMB,585,1,0,1,Outboard Stations Select", "ACCELEROMETER(33),3001,G_RESET,BTN,89,1,0,1,Reset Limits", "MECHANICS(2),3001,CANOPY_CPT1,TUMB,998,-1,0,1,Canopy Handle", "MECHANICS(2),3001,CANOPY_CPT1,TUMB,998,1,0,1,Canopy Handle", "MECHANICS(2),3007,CANOPY_LOCK,TUMB,285,0,0,1,Forward Canopy Lock Handle", "MECHANICS(2),3007,CANOPY_LOCK,TUMB,285,1,0,1,Forward Canopy Lock Handle", "MECHANICS(2),3008,CANOPY_LOCK_CPT2,TUMB,485,0,0,1,Rearward Canopy Lock Handle", "MECHANICS(2),3008,CANOPY_LOCK_CPT2,TUMB,485,1,0,1,Rearward Canopy Lock Handle", "AIR_INTERFACE(7),3013,TEMP_CONTROL_HELMET,LEV,310,0.5,0,1,Helmet Heating Temperature Rheostat", "WEAPON_SYSTEM(3),3013,FLARES_DISPENSER,TUMB,273,-1,0,1,EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3013,FLARES_DISPENSER,TUMB,273,1,0,1,EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF", "LIGHTS(20),3014,WARNING_LIGHT_INTENSITY_CPT2,LEV,537,1,0,1,Warning-Light Intensity Knob", "ELEC_INTERFACE(4),3028,CONVERTER_2,TUMB,147,-1,0,1,CB Inverter 2 (AC 115V) Switch, ON/OFF", "ELEC_INTERFACE(4),3028,CONVERTER_2,TUMB,147,1,0,1,CB Inverter 2 (AC 115V) Switch, ON/OFF", "WEAPON_SYSTEM(3),3008,LIVE_COVER,TUMB,267,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3008,LIVE_COVER,TUMB,267,1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "RKL_41(21),3010,RKL_L_R,BTN,162,1,0,1,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "RKL_41(21),3010,RKL_L_R,BTN,162,-1,-1,0,RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT", "CTRL_INTERFACE(37),3022,PITOT_CONTROL,TUMB,333,-1,0,1,Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)", "CTRL_INTERFACE(37),3022,PITOT_CONTROL,TUMB,333,1,0,1,Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)", "(0),3003,PANEL_HOOD,TUMB,627,-1,0,1,Panel Visor Extend", "(0),3003,PANEL_HOOD,TUMB,627,1,0,1,Panel Visor Extend", "NPP(24),3001,NPP_COURSE,LEV,48,0,0,1,HSI Course set knob", "CTRL_INTERFACE(37),3006,FLAPS_44_CPT2,BTN,467,1,0,1,Flaps Landing Position (44 degrees) Button", "LIGHTS(20),3005,EMERGENCY_LIGHT,TUMB,249,-1,0,1,Emergency Instrument Light Switch, ON/OFF", "LIGHTS(20),3005,EMERGENCY_LIGHT,TUMB,249,1,0,1,Emergency Instrument Light Switch, ON/OFF", "RKL_41(21),3004,RKL_FREQ_1_TUNING,LEV,165,0,0,1,RKL-41 ADF Far NDB Frequency Tune", "ASP_3NM(1),3002,pnt_107,LEV,107,0,0,1,ASP-3NMU Gunsight Target Distance", "RKL_41(21),3022,RKL_FREQ_2_00XX_CPT2,TUMB,524,0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "RKL_41(21),3022,RKL_FREQ_2_00XX_CPT2,TUMB,524,-0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "SPU_9(34),3009,SPU_RK_CPT2,TUMB,474,-1,0,1,ADF Audio Switch, ADF/OFF", "SPU_9(34),3009,SPU_RK_CPT2,TUMB,474,1,0,1,ADF Audio Switch, ADF/OFF", "WEAPON_SYSTEM(3),3009,LIVE,TUMB,268,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK", "WEAPON_SYSTEM(3),3009,LIVE,TUMB,268,1,0,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK", "KPP_1273K_INSTRUCTOR(23),3003,KPP_SET_0_CPT2,LEV,376,0,-1,1,KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob",
-        "ELEC_INTERFACE(4),3025,ENGINE,TUMB,144,-1,0,1,CB Engine Switch, ON/OFF", "ELEC_INTERFACE(4),3025,ENGINE,TUMB,144,1,0,1,CB Engine Switch, ON/OFF", "RKL_41(21),3017,RKL_FREQ_1_TUNING_CPT2,LEV,522,0,0,1,RKL-41 ADF Far NDB Frequency Tune", "ASP_3NM(1),3012,SIGHT_SUN_FILTER,TUMB,104,0,0,1,ASP-3NMU Gunsight Color Filter, ON/OFF", "ASP_3NM(1),3012,SIGHT_SUN_FILTER,TUMB,104,1,0,1,ASP-3NMU Gunsight Color Filter, ON/OFF", "ELEC_INTERFACE(4),3058,SWITCH_019,TUMB,229,-1,0,1,CB Ignition 1, ON/OFF", "ELEC_INTERFACE(4),3058,SWITCH_019,TUMB,229,1,0,1,CB Ignition 1, ON/OFF", "WEAPON_SYSTEM(3),3049,PYLON_OUT_OFF,BTN,586,1,0,1,Outboard Stations Deselect", "WEAPON_SYSTEM(3),3001,MASTER_ARM,TUMB,254,-1,0,1,CB Armament System Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3001,MASTER_ARM,TUMB,254,1,0,1,CB Armament System Power Switch, ON/OFF", "LIGHTS(20),3009,INSTRUMENT_LIGHTING_CONTROL,LEV,331,0.5,0.1,0.9,Instrument Lights Intensity Knob", "ELEC_INTERFACE(4),3011,BTN_ENGINE,BTN,326,1,0,1,Engine Button", "ELEC_INTERFACE(4),3061,SWITCH_022,TUMB,232,-1,0,1,CB Fire, ON/OFF", "ELEC_INTERFACE(4),3061,SWITCH_022,TUMB,232,1,0,1,CB Fire, ON/OFF", "ELEC_INTERFACE(4),3065,SIGNAL,TUMB,504,-1,0,1,CB Signal, ON/OFF", "ELEC_INTERFACE(4),3065,SIGNAL,TUMB,504,1,0,1,CB Signal, ON/OFF", "AIR_INTERFACE(7),3009,ANTI_ICING,TUMB,174,0.1,0,0.2,De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF", "AIR_INTERFACE(7),3009,ANTI_ICING,TUMB,174,-0.1,0,0.2,De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF", "WEAPON_SYSTEM(3),3054,SS_COVER,TUMB,591,-1,0,1,Emergency Launch Missiles Cover", "WEAPON_SYSTEM(3),3054,SS_COVER,TUMB,591,1,0,1,Emergency Launch Missiles Cover", "AIR_INTERFACE(7),3004,CABIN_HEATING_MODE,TUMB,172,0.05,0,0.25,Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC", "AIR_INTERFACE(7),3004,CABIN_HEATING_MODE,TUMB,172,-0.05,0,0.25,Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC", "ELEC_INTERFACE(4),3046,SWITCH_007,TUMB,217,-1,0,1,CB SRO, ON/OFF", "ELEC_INTERFACE(4),3046,SWITCH_007,TUMB,217,1,0,1,CB SRO, ON/OFF", "WEAPON_SYSTEM(3),3077,DEBLOCK_GUNS,BTN,599,1,0,1,Deblock Guns", "HYDRO_INTERFACE(35),3004,EMERGENCY_VALVE_GEAR_CPT2,TUMB,533,-1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3004,EMERGENCY_VALVE_GEAR_CPT2,TUMB,533,1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "LIGHTS(20),3015,WARNING_LIGHT_CHECK_CPT2,BTN,538,1,0,1,Warning-Light Check Button - Push to check", "FUEL_INTERFACE(5),3003,FUEL_SHUT_OFF_CPT2,TUMB,475,0,0,1,Fuel Shut-Off Lever", "FUEL_INTERFACE(5),3003,FUEL_SHUT_OFF_CPT2,TUMB,475,1,0,1,Fuel Shut-Off Lever", "ELEC_INTERFACE(4),3012,COVER_ENGINE,TUMB,325,-1,0,1,Engine Button Cover, Open/Close", "ELEC_INTERFACE(4),3012,COVER_ENGINE,TUMB,325,1,0,1,Engine Button Cover, Open/Close", "WEAPON_SYSTEM(3),3056,GUNS_WING_OUTER,TUMB,597,-1,0,1,Arm Outer Guns", "WEAPON_SYSTEM(3),3056,GUNS_WING_OUTER,TUMB,597,1,0,1,Arm Outer Guns", "ELEC_INTERFACE(4),3017,ENGINE_STOP_CPT2,TUMB,490,-1,0,1,Stop Engine Switch", "ELEC_INTERFACE(4),3017,ENGINE_STOP_CPT2,TUMB,490,1,0,1,Stop Engine Switch", "CTRL_INTERFACE(37),3007,AIR_BRAKE_BTN,TUMB,136,1,0,1,Air Brake Switch", "CTRL_INTERFACE(37),3008,AIR_BRAKE_BTN,BTN,135,1,0,1,Air Brake Switch", "RKL_41(21),3007,RKL_FREQ_2_TUNING,LEV,168,0,0,1,RKL-41 ADF Near NDB Frequency Tune", "OXYGEN(30),3005,EMERG_OXYGEN_CPT2,TUMB,479,-1,0,1,Emergency Oxygen Switch, ON/OFF", "OXYGEN(30),3005,EMERG_OXYGEN_CPT2,TUMB,479,1,0,1,Emergency Oxygen Switch, ON/OFF", "ELEC_INTERFACE(4),3021,EMERCENCY_FUEL,TUMB,320,-1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3021,EMERCENCY_FUEL,TUMB,320,1,0,1,Emergency Fuel Switch", "WEAPON_SYSTEM(3),3011,EMER_JETTISON,TUMB,270,-1,0,1,Emergency Jettison Outboard Stations Switch, ON/OFF", "WEAPON_SYSTEM(3),3011,EMER_JETTISON,TUMB,270,1,0,1,Emergency Jettison Outboard Stations Switch, ON/OFF", "RKL_41(21),3012,RKL_REMOTE,TUMB,158,-1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "RKL_41(21),3012,RKL_REMOTE,TUMB,158,1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "ELEC_INTERFACE(4),3038,ARMS_CPT1,TUMB,629,-1,0,1,CB Weapon Switch, ON/OFF", "ELEC_INTERFACE(4),3038,ARMS_CPT1,TUMB,629,1,0,1,CB Weapon Switch, ON/OFF", "LIGHTS(20),3008,INSTRUMENT_LIGHTING,TUMB,330,1,-1,1,Instrument Lighting Switch, Red/OFF/White", "LIGHTS(20),3008,INSTRUMENT_LIGHTING,TUMB,330,-1,-1,1,Instrument Lighting Switch, Red/OFF/White", "RKL_41(21),3027,SWITCH_ARK,TUMB,459,-1,0,1,ARK Failure", "RKL_41(21),3027,SWITCH_ARK,TUMB,459,1,0,1,ARK Failure", "SPU_9(34),3007,SPU_VOLUME_CPT2,LEV,471,0.5,0,0.8,Intercom Volume Knob", "ELEC_INTERFACE(4),3027,CONVERTER_1,TUMB,146,-1,0,1,CB Inverter 1 (AC 115V) Switch, ON/OFF", "ELEC_INTERFACE(4),3027,CONVERTER_1,TUMB,146,1,0,1,CB Inverter 1 (AC 115V) Switch, ON/OFF", "ENGINE_INTERFACE(6),3001,CONTROL_IV300,BTN,329,1,0,1,IV-300 Engine Vibration Test Button - Push to test", "WEAPON_SYSTEM(3),3016,FLARE_WHITE,TUMB,277,-1,0,1,EKSR-46 White Signal Flare Launch Button", "WEAPON_SYSTEM(3),3016,FLARE_WHITE,TUMB,277,1,0,1,EKSR-46 White Signal Flare Launch Button", "SPU_9(34),3012,SPU_BTN_CPT2,BTN,546,1,0,1,Intercom Button", "FAILURES_PANEL(39),3002,SWITCH_TOTAL_PRESSURE,TUMB,456,0.5,0,1,Full Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3002,SWITCH_TOTAL_PRESSURE,TUMB,456,-0.5,0,1,Full Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3001,SWITCH_STATIC_PRESSURE,TUMB,457,0.5,0,1,Static Pressure Failure Lever, ON/STBY/FAILURE", "FAILURES_PANEL(39),3001,SWITCH_STATIC_PRESSURE,TUMB,457,-0.5,0,1,Static Pressure Failure Lever, ON/STBY/FAILURE", "LIGHTS(20),3010,INSTRUMENT_LIGHTING_CPT2,TUMB,497,1,-1,1,Instrument Lighting Switch, Red/OFF/White", "LIGHTS(20),3010,INSTRUMENT_LIGHTING_CPT2,TUMB,497,-1,-1,1,Instrument Lighting Switch, Red/OFF/White", "CTRL_INTERFACE(37),3002,FLAPS_25,BTN,282,1,0,1,Flaps Takeoff Position (25 degrees) Button", "RADAR_ALTIMETER(14),3001,RV_SELECT_ALT,LEV,61,0.1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RADAR_ALTIMETER(14),3002,RV_SELECT_ALT,BTN,60,1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RKL_41(21),3003,RKL_MODE,TUMB,160,0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "RKL_41(21),3003,RKL_MODE,TUMB,160,-0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "ELEC_INTERFACE(4),3020,COVER_START_MODE,TUMB,321,-1,0,1,Engine Start Mode Switch Cover, Open/Close", "ELEC_INTERFACE(4),3020,COVER_START_MODE,TUMB,321,1,0,1,Engine Start Mode Switch Cover, Open/Close", "OXYGEN(30),3008,VENT_HELMET,TUMB,307,-1,0,1,Helmet Ventilation Switch, ON/OFF", "OXYGEN(30),3008,VENT_HELMET,TUMB,307,1,0,1,Helmet Ventilation Switch, ON/OFF", "KPP_1273K(22),3002,KPP_ARRETIR,BTN,30,1,0,1,KPP-1273K Attitude Director Indicator (ADI) Cage Button", "ELEC_INTERFACE(4),3029,RTL,TUMB,148,-1,0,1,CB RDO (ICS and Radio) Switch, ON/OFF", "ELEC_INTERFACE(4),3029,RTL,TUMB,148,1,0,1,CB RDO (ICS and Radio) Switch, ON/OFF", "GMK1AE(17),3012,SET_GIRO,BTN,124,1,0,1,MC Synchronization Button - Push to synchronize (level flight only)", "RKL_41(21),3014,RKL_VOLUME_CPT2,LEV,514,1,,,RKL-41 ADF Volume Knob", "ELEC_INTERFACE(4),3022,COVER_EMERCENCY_FUEL,TUMB,319,-1,0,1,Emergency Fuel Switch Cover, Open/Close", "ELEC_INTERFACE(4),3022,COVER_EMERCENCY_FUEL,TUMB,319,1,0,1,Emergency Fuel Switch Cover, Open/Close", "SDU(41),3001,RSBN_SDU,TUMB,177,-1,0,1,SDU Switch, ON/OFF", "SDU(41),3001,RSBN_SDU,TUMB,177,1,0,1,SDU Switch, ON/OFF", "RSBN_5(31),3011,RSBN_ALT_SELECTOR,LEV,201,0,0,1,RSBN Field Elevation Knob", "WEAPON_SYSTEM(3),3050,PYLON_INN_ON,TUMB,587,-1,0,1,Inboard Stations Select", "WEAPON_SYSTEM(3),3050,PYLON_INN_ON,TUMB,587,1,0,1,Inboard Stations Select", "ENGINE_INTERFACE(6),3008,OFF_RT12,TUMB,324,-1,0,1,RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED", "ENGINE_INTERFACE(6),3008,OFF_RT12,TUMB,324,1,0,1,RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED", "ASP_3NM(1),3016,SIGHT_ANGLE_REFLECTOR,LEV,106,0,0,1,ASP-3NMU Gunsight Mirror Depression", "HYDRO_INTERFACE(35),3003,EMERGENCY_VALVE_GEAR,TUMB,194,-1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3003,EMERGENCY_VALVE_GEAR,TUMB,194,1,0,1,Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)", "ELEC_INTERFACE(4),3032,EMERGENCY_ON_SRO,TUMB,151,-1,0,1,CB IFF (SRO) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3032,EMERGENCY_ON_SRO,TUMB,151,1,0,1,CB IFF (SRO) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3050,SWITCH_011,TUMB,221,-1,0,1,CB Signaling, ON/OFF", "ELEC_INTERFACE(4),3050,SWITCH_011,TUMB,221,1,0,1,CB Signaling, ON/OFF", "ELEC_INTERFACE(4),3052,SWITCH_013,TUMB,223,-1,0,1,CB Spotlight Left, ON/OFF", "ELEC_INTERFACE(4),3052,SWITCH_013,TUMB,223,1,0,1,CB Spotlight Left, ON/OFF", "WEAPON_SYSTEM(3),3018,COVER_LIVE_CPT2,TUMB,508,-1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3018,COVER_LIVE_CPT2,TUMB,508,1,0,1,Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE", "RKL_41(21),3016,RKL_MODE_CPT2,TUMB,517,0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "RKL_41(21),3016,RKL_MODE_CPT2,TUMB,517,-0.1,0,0.4,RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP", "ELEC_INTERFACE(4),3041,SWITCH_002,TUMB,212,-1,0,1,CB Anti-Ice, ON/OFF", "ELEC_INTERFACE(4),3041,SWITCH_002,TUMB,212,1,0,1,CB Anti-Ice, ON/OFF", "ELEC_INTERFACE(4),3030,MRP_RV,TUMB,149,-1,0,1,CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF", "ELEC_INTERFACE(4),3030,MRP_RV,TUMB,149,1,0,1,CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF", "NPP(24),3002,SWITCH_GMK,TUMB,458,-1,0,1,GMK Failure", "NPP(24),3002,SWITCH_GMK,TUMB,458,1,0,1,GMK Failure", "RKL_41(21),3026,RKL_BRIGHTNESS_CPT2,LEV,518,1,,,RKL-41 ADF Brightness Knob", "ELEC_INTERFACE(4),3019,START_MODE,TUMB,322,1,-1,1,Engine Start Mode Switch, FALSE START/START/COLD CRANKING", "ELEC_INTERFACE(4),3019,START_MODE,TUMB,322,-1,-1,1,Engine Start Mode Switch, FALSE START/START/COLD CRANKING",
-        "WEAPON_SYSTEM(3),3041,PK3_GS_COVER,TUMB,582,-1,0,1,Gun+PK3 Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3041,PK3_GS_COVER,TUMB,582,1,0,1,Gun+PK3 Switch Cover, OPEN/CLOSE", "MECHANICS(2),3010,EJECT_CANOPY_CPT2,BTN,539,1,0,1,Rearward Canopy Emergency Jettison Handle", "RSBN_5(31),3005,RSBN_VOLUME,LEV,184,0,0,0.8,RSBN Volume Knob", "ELEC_INTERFACE(4),3069,STAND-BY-OFF,BTN,292,1,0,1,Standby (Left) Pitot Tube Heating Off Button - Push to turn heating off", "GMK1AE(17),3002,GMK_SELECT,TUMB,204,-2,-1,1,GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)", "GMK1AE(17),3002,GMK_SELECT,TUMB,204,2,-1,1,GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)", "ELEC_INTERFACE(4),3064,SEAT,TUMB,503,-1,0,1,CB Seat, ON/OFF", "ELEC_INTERFACE(4),3064,SEAT,TUMB,503,1,0,1,CB Seat, ON/OFF", "WEAPON_SYSTEM(3),3042,PK3_GS,TUMB,583,-1,0,1,Gun+PK3 Switch", "WEAPON_SYSTEM(3),3042,PK3_GS,TUMB,583,1,0,1,Gun+PK3 Switch", "ELEC_INTERFACE(4),3031,ISKRA,TUMB,150,-1,0,1,CB RSBN (ISKRA) Switch, ON/OFF", "ELEC_INTERFACE(4),3031,ISKRA,TUMB,150,1,0,1,CB RSBN (ISKRA) Switch, ON/OFF", "ENGINE_INTERFACE(6),3003,FIRE,BTN,328,1,0,1,Fire Extinguish Button - Push to extinguish", "RKL_41(21),3006,RKL_FREQ_1_00XX,TUMB,164,0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "RKL_41(21),3006,RKL_FREQ_1_00XX,TUMB,164,-0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "ELEC_INTERFACE(4),3033,EMERGENCY_ON_ISKRA,TUMB,152,-1,0,1,CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3033,EMERGENCY_ON_ISKRA,TUMB,152,1,0,1,CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF", "ELEC_INTERFACE(4),3056,SWITCH_017,TUMB,227,-1,0,1,CB Start Panel, ON/OFF", "ELEC_INTERFACE(4),3056,SWITCH_017,TUMB,227,1,0,1,CB Start Panel, ON/OFF", "R_832M(19),3003,RADIO_REMOTE,TUMB,287,-1,0,1,Radio Control Switch - Flip switch to take control", "R_832M(19),3003,RADIO_REMOTE,TUMB,287,1,0,1,Radio Control Switch - Flip switch to take control", "GMK1AE(17),3003,GMK_TEST,BTN,205,-1,-1,0,GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy", "GMK1AE(17),3003,GMK_TEST,BTN,205,1,0,1,GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy", "AIR_INTERFACE(7),3007,AIR_COND,TUMB,511,-1,-1,1,Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE", "AIR_INTERFACE(7),3007,AIR_COND,TUMB,511,1,-1,1,Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE", "RSBN_5(31),3003,TESTING,BTN,180,1,0,1,RSBN Test Button - Push to test", "LIGHTS(20),3013,WARNING_LIGHT_CHECK,BTN,203,1,0,1,Warning-Light Check Button - Push to check", "RKL_41(21),3024,BEACON_SWITCH_CPT2,TUMB,440,-1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "RKL_41(21),3024,BEACON_SWITCH_CPT2,TUMB,440,1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "ELEC_INTERFACE(4),3066,ARMS,TUMB,505,-1,0,1,CB Weapon Switch, ON/OFF", "ELEC_INTERFACE(4),3066,ARMS,TUMB,505,1,0,1,CB Weapon Switch, ON/OFF", "ELEC_INTERFACE(4),3057,SWITCH_018,TUMB,228,-1,0,1,CB Booster Pump, ON/OFF", "ELEC_INTERFACE(4),3057,SWITCH_018,TUMB,228,1,0,1,CB Booster Pump, ON/OFF", "VARIOMETER_INSTRUCTOR(16),3001,VV_SET_0_CPT2,LEV,419,1,0,1,Variometer adjustment knob", "ELEC_INTERFACE(4),3002,MAIN_GENERATOR,TUMB,142,-1,0,1,Main Generator Switch, ON/OFF", "ELEC_INTERFACE(4),3002,MAIN_GENERATOR,TUMB,142,1,0,1,Main Generator Switch, ON/OFF", "WEAPON_SYSTEM(3),3002,UB_16,TUMB,255,-1,0,1,CB Missile Firing Control Circuit Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3002,UB_16,TUMB,255,1,0,1,CB Missile Firing Control Circuit Power Switch, ON/OFF", "ELEC_INTERFACE(4),3062,SWITCH_023,TUMB,233,-1,0,1,CB Emergency Jettison, ON/OFF", "ELEC_INTERFACE(4),3062,SWITCH_023,TUMB,233,1,0,1,CB Emergency Jettison, ON/OFF", "ELEC_INTERFACE(4),3023,EMERCENCY_FUEL_CPT2,TUMB,492,-1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3023,EMERCENCY_FUEL_CPT2,TUMB,492,1,0,1,Emergency Fuel Switch", "ELEC_INTERFACE(4),3014,COVER_ENGINE_CPT2,TUMB,493,-1,0,1,Engine Button Cover, Open/Close", "ELEC_INTERFACE(4),3014,COVER_ENGINE_CPT2,TUMB,493,1,0,1,Engine Button Cover, Open/Close", "LIGHTS(20),3012,WARNING_LIGHT_INTENSITY,LEV,202,1,0,1,Warning-Light Intensity Knob", "ELEC_INTERFACE(4),3072,ENGINE_INDICAT_EMERG,TUMB,169,-1,0,1,Emergency Engine Instruments Power Switch, ON/OFF", "ELEC_INTERFACE(4),3072,ENGINE_INDICAT_EMERG,TUMB,169,1,0,1,Emergency Engine Instruments Power Switch, ON/OFF", "ELEC_INTERFACE(4),3036,SDU,TUMB,155,-1,0,1,CB SDU Switch, ON/OFF", "ELEC_INTERFACE(4),3036,SDU,TUMB,155,1,0,1,CB SDU Switch, ON/OFF", "ELEC_INTERFACE(4),3010,COVER_TURBO_STOP,TUMB,312,-1,0,1,Stop Turbo Switch Cover, Open/Close", "ELEC_INTERFACE(4),3010,COVER_TURBO_STOP,TUMB,312,1,0,1,Stop Turbo Switch Cover, Open/Close", "MECHANICS(2),3002,CANOPY_CPT2,TUMB,999,-1,0,1,Canopy Handle", "MECHANICS(2),3002,CANOPY_CPT2,TUMB,999,1,0,1,Canopy Handle", "WEAPON_SYSTEM(3),3021,EMER_JETTISON_CPT2,TUMB,507,-1,0,1,Emergency Jettison Switch, ON/OFF", "WEAPON_SYSTEM(3),3021,EMER_JETTISON_CPT2,TUMB,507,1,0,1,Emergency Jettison Switch, ON/OFF", "WEAPON_SYSTEM(3),3052,CHARGE_GUNS_OUTER,TUMB,577,-1,0,1,Charge Outer Guns", "WEAPON_SYSTEM(3),3052,CHARGE_GUNS_OUTER,TUMB,577,1,0,1,Charge Outer Guns", "R_832M(19),3005,RADIO_NOISE_SUPPR_CPT2,TUMB,469,-1,0,1,Squelch Switch, ON/OFF", "R_832M(19),3005,RADIO_NOISE_SUPPR_CPT2,TUMB,469,1,0,1,Squelch Switch, ON/OFF", "LIGHTS(20),3003,NAVIG_LIGHTS_FLICKER,TUMB,176,-0.5,0,1,Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED", "LIGHTS(20),3003,NAVIG_LIGHTS_FLICKER,TUMB,176,0.5,0,1,Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED", "RSBN_5(31),3013,EMER_LANDING_ON,TUMB,527,-1,0,1,RSBN Emergency Landing Switch, ON/OFF", "RSBN_5(31),3013,EMER_LANDING_ON,TUMB,527,1,0,1,RSBN Emergency Landing Switch, ON/OFF", "ELEC_INTERFACE(4),3018,COVER_ENGINE_STOP_CPT2,TUMB,489,-1,0,1,Stop Engine Switch Cover, Open/Close", "ELEC_INTERFACE(4),3018,COVER_ENGINE_STOP_CPT2,TUMB,489,1,0,1,Stop Engine Switch Cover, Open/Close", "GMK1AE(17),3013,SET_GIRO_CPT2,BTN,444,1,0,1,MC Synchronization Button - Push to synchronize (level flight only)", "CTRL_INTERFACE(37),3009,AIR_BRAKE_BTN_CPT2,BTN,548,1,0,1,Air Brake Switch", "CTRL_INTERFACE(37),3009,AIR_BRAKE_BTN_CPT2,BTN,548,-1,-1,0,Air Brake Switch", "HYDRO_INTERFACE(35),3002,EMERGENCY_VALVE_HYDRAULIC_CPT2,TUMB,536,-1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "HYDRO_INTERFACE(35),3002,EMERGENCY_VALVE_HYDRAULIC_CPT2,TUMB,536,1,0,1,Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)", "ELEC_INTERFACE(4),3016,COVER_ENGINE_STOP,TUMB,317,-1,0,1,Stop Engine Switch Cover, Open/Close", "ELEC_INTERFACE(4),3016,COVER_ENGINE_STOP,TUMB,317,1,0,1,Stop Engine Switch Cover, Open/Close", "ASP_3NM(1),3004,SIGHT_BRIGHTNESS,LEV,102,0,0,1,ASP-3NMU Gunsight Brightness Knob", "WEAPON_SYSTEM(3),3012,ROCKETS_MODE_SELECTOR,TUMB,271,-0.1,0.1,0.3,Rockets Firing Mode Selector Switch, AUT./2RS/4RS", "WEAPON_SYSTEM(3),3012,ROCKETS_MODE_SELECTOR,TUMB,271,0.1,0.1,0.3,Rockets Firing Mode Selector Switch, AUT./2RS/4RS", "AIR_INTERFACE(7),3010,DE_ICE,BTN,183,1,0,1,RIO-3 De-Icing Sensor Heating Circuit Check Button - Push to test", "RKL_41(21),3008,RKL_FREQ_2_XX00,TUMB,166,0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "RKL_41(21),3008,RKL_FREQ_2_XX00,TUMB,166,-0.0588,0,0.938,RKL-41 ADF Near NDB 100kHz rotary", "LIGHTS(20),3004,NAVIG_LIGHTS_BRIGHTNESS,TUMB,175,0.5,0,1,Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)", "LIGHTS(20),3004,NAVIG_LIGHTS_BRIGHTNESS,TUMB,175,-0.5,0,1,Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)", "OXYGEN(30),3006,SWITSH_OXYGEN,TUMB,304,-1,0,1,Diluter Demand Switch, 100% / MIX", "OXYGEN(30),3006,SWITSH_OXYGEN,TUMB,304,1,0,1,Diluter Demand Switch, 100% / MIX", "RKL_41(21),3001,RKL_VOLUME,LEV,157,1,,,RKL-41 ADF Volume Knob", "CTRL_INTERFACE(37),3016,BRAKE_CONTROL,LEV,334,0,-1,1,Emergency/Parking Wheel Brake Lever", "ELEC_INTERFACE(4),3055,SWITCH_016,TUMB,226,-1,0,1,CB White Lights, ON/OFF", "ELEC_INTERFACE(4),3055,SWITCH_016,TUMB,226,1,0,1,CB White Lights, ON/OFF", "ELEC_INTERFACE(4),3015,ENGINE_STOP,TUMB,318,-1,0,1,Stop Engine Switch", "ELEC_INTERFACE(4),3015,ENGINE_STOP,TUMB,318,1,0,1,Stop Engine Switch", "CTRL_INTERFACE(37),3024,BRAKE_CONTROL_LOCK,TUMB,334,0,0,1,Parking Brake Lever Flag - Push to remove parking brake", "WEAPON_SYSTEM(3),3006,VOLUME_SS,LEV,259,1,0,1,Missile Seeker Tone Volume Knob", "KPP_1273K(22),3008,SWITCH_AGD_PITCH,TUMB,460,-1,0,1,AGD Pitch Failure", "KPP_1273K(22),3008,SWITCH_AGD_PITCH,TUMB,460,1,0,1,AGD Pitch Failure", "ELEC_INTERFACE(4),3040,SWITCH_001,TUMB,211,-1,0,1,CB Air Conditioning, ON/OFF", "ELEC_INTERFACE(4),3040,SWITCH_001,TUMB,211,1,0,1,CB Air Conditioning, ON/OFF", "AIR_INTERFACE(7),3011,HEATING_QUICK,BTN,309,1,0,1,Helmet Visor Quick Heating Button - Push to heat", "WEAPON_SYSTEM(3),3019,LIVE_CPT2,TUMB,509,-1,-1,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK", "WEAPON_SYSTEM(3),3019,LIVE_CPT2,TUMB,509,1,-1,1,Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK", "R_832M(19),3001,RADIO_CHANNEL,TUMB,284,0.05,0,0.95,R-832M Preset Channel Selector Knob", "R_832M(19),3001,RADIO_CHANNEL,TUMB,284,-0.05,0,0.95,R-832M Preset Channel Selector Knob", "FUEL_INTERFACE(5),3002,FUEL_SHUT_OFF,TUMB,296,0,0,1,Fuel Shut-Off Lever", "FUEL_INTERFACE(5),3002,FUEL_SHUT_OFF,TUMB,296,1,0,1,Fuel Shut-Off Lever", "WEAPON_SYSTEM(3),3059,BOMBS_SERIES,TUMB,584,1,-1,1,Bombs Series", "WEAPON_SYSTEM(3),3059,BOMBS_SERIES,TUMB,584,-1,-1,1,Bombs Series", "ELEC_INTERFACE(4),3054,SWITCH_015,TUMB,225,-1,0,1,CB Red Lights, ON/OFF", "ELEC_INTERFACE(4),3054,SWITCH_015,TUMB,225,1,0,1,CB Red Lights, ON/OFF", "RKL_41(21),3025,RKL_REMOTE_CPT2,TUMB,515,-1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "RKL_41(21),3025,RKL_REMOTE_CPT2,TUMB,515,1,0,1,RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL", "ELEC_INTERFACE(4),3034,WING_TANK,TUMB,153,-1,0,1,CB Wing Tanks Switch, ON/OFF", "ELEC_INTERFACE(4),3034,WING_TANK,TUMB,153,1,0,1,CB Wing Tanks Switch, ON/OFF",
-        "RSBN_5(31),3012,RSBN_BEACON_AUDIO,BTN,297,1,0,1,RSBN Listen Callsign Button - Push to listen", "CTRL_INTERFACE(37),3011,L_G_CONTRIOL_LEVEL,TUMB,118,-1,-1,1,Landing Gear Control Lever", "CTRL_INTERFACE(37),3011,L_G_CONTRIOL_LEVEL,TUMB,118,1,-1,1,Landing Gear Control Lever", "OXYGEN(30),3003,BOTTLES_ INTERCON,LEV,484,0,0,1,Oxygen Interconnaction Valve (CLOSE - CW, OPEN - CCW)", "ENGINE_INTERFACE(6),3002,COVER_FIRE,TUMB,327,-1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3002,COVER_FIRE,TUMB,327,1,0,1,Fire Extinguish Button Cover, OPEN/CLOSE", "RKL_41(21),3011,BEACON_SWITCH,TUMB,119,-1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "RKL_41(21),3011,BEACON_SWITCH,TUMB,119,1,0,1,RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch", "SPU_9(34),3001,SPU_VOLUME,LEV,288,0.5,0,0.8,Intercom Volume Knob", "WEAPON_SYSTEM(3),3051,PYLON_INN_OFF,BTN,588,1,0,1,Inboard Stations Deselect", "WEAPON_SYSTEM(3),3010,EMER_JETTISON_COVER,TUMB,269,-1,0,1,Emergency Jettison Outboard Stations Switch Cover, OPEN/CLOSE", "WEAPON_SYSTEM(3),3010,EMER_JETTISON_COVER,TUMB,269,1,0,1,Emergency Jettison Outboard Stations Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(4),3049,SWITCH_010,TUMB,220,-1,0,1,CB Control, ON/OFF", "ELEC_INTERFACE(4),3049,SWITCH_010,TUMB,220,1,0,1,CB Control, ON/OFF", "ELEC_INTERFACE(4),3006,COVER_TURBO,TUMB,314,-1,0,1,Turbo Button Cover, Open/Close", "ELEC_INTERFACE(4),3006,COVER_TURBO,TUMB,314,1,0,1,Turbo Button Cover, Open/Close", "CLOCK_INSTRUCTOR(13),3005,CLOCK_RIGHT_BTN_CPT2,LEV,415,0,0,0.3,Mech clock right lever", "CLOCK_INSTRUCTOR(13),3004,CLOCK_RIGHT_BTN_CPT2,BTN,414,1,0,1,Mech clock right lever", "ENGINE_INTERFACE(6),3007,COVER_OFF_RT12,TUMB,323,-1,0,1,RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE", "ENGINE_INTERFACE(6),3007,COVER_OFF_RT12,TUMB,323,1,0,1,RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE", "R_832M(19),3004,RADIO_CHANNEL_CPT2,TUMB,468,0.05,0,0.95,R-832M Preset Channel Selector Knob", "R_832M(19),3004,RADIO_CHANNEL_CPT2,TUMB,468,-0.05,0,0.95,R-832M Preset Channel Selector Knob", "ELEC_INTERFACE(4),3026,AGD_GMK,TUMB,145,-1,0,1,CB AGD-GMK Switch, ON/OFF", "ELEC_INTERFACE(4),3026,AGD_GMK,TUMB,145,1,0,1,CB AGD-GMK Switch, ON/OFF", "RADAR_ALTIMETER(14),3004,RV_SELECT_ALT_CPT2,LEV,399,0.1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RADAR_ALTIMETER(14),3005,RV_SELECT_ALT_CPT2,BTN,398,1,0,1,RV-5M Radio Altimeter Test Button/Decision Height Knob", "RKL_41(21),3019,RKL_FREQ_1_00XX_CPT2,TUMB,521,0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "RKL_41(21),3019,RKL_FREQ_1_00XX_CPT2,TUMB,521,-0.1,0,0.9,RKL-41 ADF Far NDB 10kHz rotary", "AIR_INTERFACE(7),3001,PRESSUR,LEV,245,0,0,1,ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON", "ASP_3NM(1),3003,SIGHT_MODE,TUMB,101,-1,0,1,ASP-3NMU Gunsight Mode, GYRO/FIXED", "ASP_3NM(1),3003,SIGHT_MODE,TUMB,101,1,0,1,ASP-3NMU Gunsight Mode, GYRO/FIXED", "ELEC_INTERFACE(4),3005,TURBO,BTN,315,1,0,1,Turbo Button", "AIR_INTERFACE(7),3008,COVER_AIR_COND,TUMB,510,-1,0,1,Conditioning Shutoff Switch Cover, OPEN/CLOSE", "AIR_INTERFACE(7),3008,COVER_AIR_COND,TUMB,510,1,0,1,Conditioning Shutoff Switch Cover, OPEN/CLOSE", "RSBN_5(31),3008,CHANNEL_NAVIGATION,TUMB,191,0.025,0,0.975,RSBN Navigation Channel Selector Knob", "RSBN_5(31),3008,CHANNEL_NAVIGATION,TUMB,191,-0.025,0,0.975,RSBN Navigation Channel Selector Knob", "WEAPON_SYSTEM(3),3003,ASP_FKP,TUMB,256,-1,0,1,CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF", "WEAPON_SYSTEM(3),3003,ASP_FKP,TUMB,256,1,0,1,CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF", "SPU_9(34),3003,SPU_RK,TUMB,291,-1,0,1,ADF Audio Switch, ADF/OFF", "SPU_9(34),3003,SPU_RK,TUMB,291,1,0,1,ADF Audio Switch, ADF/OFF", "WEAPON_SYSTEM(3),3055,SS,BTN,592,1,0,1,Emergency Launch Missiles", "RKL_41(21),3018,RKL_FREQ_1_XX_CPT2,TUMB,520,0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3018,RKL_FREQ_1_XX_CPT2,TUMB,520,-0.0588,0,0.938,RKL-41 ADF Far NDB 100kHz rotary", "RKL_41(21),3009,RKL_FREQ_2_00XX,TUMB,167,0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "RKL_41(21),3009,RKL_FREQ_2_00XX,TUMB,167,-0.1,0,0.9,RKL-41 ADF Near NDB 10kHz rotary", "ELEC_INTERFACE(4),3042,SWITCH_003,TUMB,213,-1,0,1,CB Pitot Left, ON/OFF", "ELEC_INTERFACE(4),3042,SWITCH_003,TUMB,213,1,0,1,CB Pitot Left, ON/OFF"],
-    "M-2000C": ["VHF(19),3955,PTN_955,BTN,955,1,0,1,VHF 2/SQL", "RADAR(11),3485,PTN_485,TUMB,485,0.5,-1,0.5,Radar Contrast Switch", "RADAR(11),3485,PTN_485,TUMB,485,-0.5,-1,0.5,Radar Contrast Switch", "PCN_NAV(9),3570,PTN_570,BTN,570,0,1,,INS PREP Switch", "ENGPANEL(7),3474,PTN_474,TUMB,474,-1,0,1,Secondary Oil Control Switch", "ENGPANEL(7),3474,PTN_474,TUMB,474,1,0,1,Secondary Oil Control Switch", "RADAR(11),3600,PTN_600,TUMB,600,0.5,0,1,Radar IFF Power Switch", "RADAR(11),3600,PTN_600,TUMB,600,-0.5,0,1,Radar IFF Power Switch", "SYSLIGHTS(16),3450,PTN_450,TUMB,450,0.5,0,1,Landing Lights Switch", "SYSLIGHTS(16),3450,PTN_450,TUMB,450,-0.5,0,1,Landing Lights Switch", "SYSLIGHTS(16),3639,PTN_639,LEV,639,10,,,Dashboard U.V. Lights Knob", "NAVINST(2),3340,PTN_340,LEV,340,1,0,1,HSI VAD Selector", "ENGPANEL(7),3651,PTN_651,TUMB,651,-1,0,1,Fuel Cutoff Switch Cover", "ENGPANEL(7),3651,PTN_651,TUMB,651,1,0,1,Fuel Cutoff Switch Cover", "RWR(13),3605,PTN_605,TUMB,605,1,-1,1,EW Mode Selector Switch", "RWR(13),3605,PTN_605,TUMB,605,-1,-1,1,EW Mode Selector Switch", "INSTPANEL(4),3471,PTN_471,TUMB,471,-1,0,1,A/B Emergency Cutoff Switch Cover", "INSTPANEL(4),3471,PTN_471,TUMB,471,1,0,1,A/B Emergency Cutoff Switch Cover", "ENGPANEL(7),3650,PTN_650,TUMB,650,0.5,0,1,Ventilation Selector Switch", "ENGPANEL(7),3650,PTN_650,TUMB,650,-0.5,0,1,Ventilation Selector Switch", "RADAR(11),3504,PTN_504,BTN,504,0,1,,A/A Radar STT Selector Button", "MISCPANELS(22),3660,PTN_660,TUMB,660,-1,0,1,Pitot Heat Switch", "MISCPANELS(22),3660,PTN_660,TUMB,660,1,0,1,Pitot Heat Switch", "SYSLIGHTS(16),3449,PTN_449,TUMB,449,-1,0,1,Police Lights Switch", "SYSLIGHTS(16),3449,PTN_449,TUMB,449,1,0,1,Police Lights Switch", "AFCS(17),3480,PTN_480,TUMB,480,-1,0,1,FBW Channel 5 Switch", "AFCS(17),3480,PTN_480,TUMB,480,1,0,1,FBW Channel 5 Switch", "PCA_PPA(6),3250,PTN_250,BTN,250,0,1,,Weapons Selector Button 1", "INSTPANEL(4),3408,PTN_408,TUMB,408,0,0,1,Landing Gear Emergency Release Lever", "INSTPANEL(4),3408,PTN_408,TUMB,408,1,0,1,Landing Gear Emergency Release Lever", "VHF(19),3950,PTN_950,TUMB,950,0.1,0,0.6,VHF MODE", "VHF(19),3950,PTN_950,TUMB,950,-0.1,0,0.6,VHF MODE", "ENGPANEL(7),3646,PTN_646,TUMB,646,-1,0,1,Starter Fuel Pump Switch", "ENGPANEL(7),3646,PTN_646,TUMB,646,1,0,1,Starter Fuel Pump Switch", "VHF(19),3953,PTN_953,BTN,953,1,0,1,VHF VLD/XFR", "VHF(19),3956,PTN_956,BTN,956,1,0,1,VHF 3/GR", "VTH_VTB(5),3224,PTN_224,TUMB,224,0.1,0,0.7,Icons and Rulers Brightness", "VTH_VTB(5),3224,PTN_224,TUMB,224,-0.1,0,0.7,Icons and Rulers Brightness", "RADAR(11),3484,PTN_484,TUMB,484,-1,0,1,Radar Doppler Reject Switch", "RADAR(11),3484,PTN_484,TUMB,484,1,0,1,Radar Doppler Reject Switch", "INSTPANEL(4),3477,PTN_477,TUMB,477,-1,0,1,Fuel Dump Switch Cover", "INSTPANEL(4),3477,PTN_477,TUMB,477,1,0,1,Fuel Dump Switch Cover", "RADAR(11),,PTN_495,TUMB,495,-1,0,1,A/G Radar VISU Mode Switch", "RADAR(11),,PTN_495,TUMB,495,1,0,1,A/G Radar VISU Mode Switch", "VTH_VTB(5),3213,PTN_213,BTN,213,1,-1,0,Target Data Manual Entry Begin/End", "VTH_VTB(5),3213,PTN_213,BTN,213,-1,0,1,Target Data Manual Entry Begin/End", "PCN_NAV(9),3627,PTN_627,TUMB,627,0.1,0,0.7,INS Mode Selector", "PCN_NAV(9),3627,PTN_627,TUMB,627,-0.1,0,0.7,INS Mode Selector", "PWRPNL(8),3521,PTN_521,TUMB,521,-1,0,1,Electric Power Transfer Switch", "PWRPNL(8),3521,PTN_521,TUMB,521,1,0,1,Electric Power Transfer Switch", "SYSLIGHTS(16),3452,PTN_452,TUMB,452,0.5,0,1,SERPAM Recorder Switch", "SYSLIGHTS(16),3452,PTN_452,TUMB,452,-0.5,0,1,SERPAM Recorder Switch", "RADAR(11),3499,PTN_499,TUMB,499,-1,0,1,Radar Grid Selector Switch", "RADAR(11),3499,PTN_499,TUMB,499,1,0,1,Radar Grid Selector Switch", "VHF(19),3951,PTN_951,TUMB,951,0.05,0,0.95,VHF CH Sel", "VHF(19),3951,PTN_951,TUMB,951,-0.05,0,0.95,VHF CH Sel", "RADAR(11),3481,PTN_481,TUMB,481,0.5,-1,0.5,Radar Illumination Switch", "RADAR(11),3481,PTN_481,TUMB,481,-0.5,-1,0.5,Radar Illumination Switch", "UHF(20),3431,PTN_431,BTN,431,1,-1,0,UHF E+A2 Switch", "UHF(20),3431,PTN_431,BTN,431,-1,0,1,UHF E+A2 Switch", "AFCS(17),3517,PTN_517,TUMB,517,0.5,0,1,FBW Test Switch", "AFCS(17),3517,PTN_517,TUMB,517,-0.5,0,1,FBW Test Switch", "INSTPANEL(4),3647,PTN_647,TUMB,647,-1,0,1,Engine Fuel Left Boost Pump Switch", "INSTPANEL(4),3647,PTN_647,TUMB,647,1,0,1,Engine Fuel Left Boost Pump Switch", "PCN_NAV(9),3596,PTN_596,BTN,596,0,1,,INS ENTER Button", "MISCPANELS(22),3900,PTN_900,BTN,900,1,-1,0,Seat Adjustment Switch", "MISCPANELS(22),3900,PTN_900,BTN,900,-1,0,1,Seat Adjustment Switch", "ENGINE(3),3422,PTN_422,TUMB,422,-1,0,1,FBW G-Limiter Switch", "ENGINE(3),3422,PTN_422,TUMB,422,1,0,1,FBW G-Limiter Switch", "RADAR(11),3598,PTN_598,TUMB,598,0.2,0,1,Radar IFF Mode Switch", "RADAR(11),3598,PTN_598,TUMB,598,-0.2,0,1,Radar IFF Mode Switch", "VHF(19),3959,PTN_959,BTN,959,1,0,1,VHF 6/TONE", "VORILS(24),3616,PTN_616,TUMB,616,0.090909090909091,0.1,1.0090909090909,VOR/ILS Frequency Change Whole", "VORILS(24),3616,PTN_616,TUMB,616,-0.090909090909091,0.1,1.0090909090909,VOR/ILS Frequency Change Whole", "INSTPANEL(4),3478,PTN_478,TUMB,478,-1,0,1,Fuel Dump Switch", "INSTPANEL(4),3478,PTN_478,TUMB,478,1,0,1,Fuel Dump Switch", "FLIGHTINST(1),3328,PTN_325,LEV,328,0,-1,1,Backup ADI Cage/Pitch Adjust Knob", "FLIGHTINST(1),3325,PTN_325,BTN,325,1,0,1,Backup ADI Cage/Pitch Adjust Knob", "PCN_NAV(9),3111,PTN_111,BTN,111,0,1,,INS Previous Waypoint Button", "TACAN(23),3625,PTN_625,TUMB,625,0.1,0,0.9,TACAN Channel 1 Selector", "TACAN(23),3625,PTN_625,TUMB,625,-0.1,0,0.9,TACAN Channel 1 Selector", "SYSLIGHTS(16),3707,PTN_707,LEV,707,0.8,0,1,V/UHF Radio Volume Knob", "SUBSYSTEMS(14),3907,PTN_907,TUMB,907,-1,0,1,Canopy Handle", "SUBSYSTEMS(14),3907,PTN_907,TUMB,907,1,0,1,Canopy Handle", "RADAR(11),3503,PTN_503,BTN,503,1,-1,0,Radar Range Selector Switch", "RADAR(11),3503,PTN_503,BTN,503,-1,0,1,Radar Range Selector Switch", "MISCPANELS(22),3666,PTN_666,TUMB,666,0,0,1,Parking Brake Lever", "MISCPANELS(22),3666,PTN_666,TUMB,666,1,0,1,Parking Brake Lever", "PCN_NAV(9),3574,PTN_574,TUMB,574,0.1,0,1,INS Parameter Selector", "PCN_NAV(9),3574,PTN_574,TUMB,574,-0.1,0,1,INS Parameter Selector", "PCN_NAV(9),3592,PTN_592,BTN,592,0,1,,INS Button 9", "SUBSYSTEMS(14),3656,PTN_656,TUMB,656,0.5,0,1,Canopy Lock/Neutral/Lower Lever", "SUBSYSTEMS(14),3656,PTN_656,TUMB,656,-0.5,0,1,Canopy Lock/Neutral/Lower Lever", "VTH_VTB(5),3204,PTN_204,TUMB,204,-0.5,0,1,HUD Altimeter Selector Switch", "VTH_VTB(5),3204,PTN_204,TUMB,204,0.5,0,1,HUD Altimeter Selector Switch", "RADAR(11),3500,PTN_500,TUMB,500,-1,0,1,Target Memory Time Selector Switch", "RADAR(11),3500,PTN_500,TUMB,500,1,0,1,Target Memory Time Selector Switch", "AFCS(17),3302,PTN_302,BTN,302,0,1,,Autopilot Lights Test Button", "MISCPANELS(22),3458,PTN_458,TUMB,458,-1,0,1,Anti-Skid Switch Cover", "MISCPANELS(22),3458,PTN_458,TUMB,458,1,0,1,Anti-Skid Switch Cover", "RADAR(11),3482,PTN_482,BTN,482,0,1,,Radar Test Button", "PCN_NAV(9),3591,PTN_591,BTN,591,0,1,,INS Button 8", "ENGPANEL(7),3465,PTN_465,LEV,465,0.8,0,1,Emergency Throttle Handle", "FLIGHTINST(1),3315,PTN_315,TUMB,315,-1,0,1,ADI Backlight Switch", "FLIGHTINST(1),3315,PTN_315,TUMB,315,1,0,1,ADI Backlight Switch", "VTH_VTB(5),3206,PTN_206,TUMB,206,-1,0,1,Auxiliary Gunsight", "VTH_VTB(5),3206,PTN_206,TUMB,206,1,0,1,Auxiliary Gunsight", "RADAR(11),3710,PTN_710,TUMB,710,-1,0,1,TDC Mode Switch", "RADAR(11),3710,PTN_710,TUMB,710,1,0,1,TDC Mode Switch", "MISCPANELS(22),3909,PTN_909,TUMB,909,-1,0,1,Mirror Rendering Toggle", "MISCPANELS(22),3909,PTN_909,TUMB,909,1,0,1,Mirror Rendering Toggle", "MISCPANELS(22),3459,PTN_459,TUMB,459,-1,0,1,Anti-Skid Switch", "MISCPANELS(22),3459,PTN_459,TUMB,459,1,0,1,Anti-Skid Switch", "AFCS(17),3301,PTN_301,TUMB,301,0.1,0,0.9,Altitude 100 ft Selector", "AFCS(17),3301,PTN_301,TUMB,301,-0.1,0,0.9,Altitude 100 ft Selector", "PWRPNL(8),3523,PTN_523,TUMB,523,-1,0,1,Alternator 2 Switch", "PWRPNL(8),3523,PTN_523,TUMB,523,1,0,1,Alternator 2 Switch", "VTH_VTB(5),3207,PTN_207,LEV,207,0,0,1,Auxiliary Gunsight Deflection", "DDM_IND(28),3608,PTN_608,TUMB,608,0.5,0,1,D2M Power Switch", "DDM_IND(28),3608,PTN_608,TUMB,608,-0.5,0,1,D2M Power Switch", "VTH_VTB(5),3210,PTN_210,BTN,210,0,1,,HUD Clear Button", "PCN_NAV(9),3584,PTN_584,BTN,584,0,1,,INS Button 1", "TACAN(23),3626,PTN_626,TUMB,626,0.33,0,0.99,TACAN Mode Select", "TACAN(23),3626,PTN_626,TUMB,626,-0.33,0,0.99,TACAN Mode Select", "ECS(25),3636,PTN_636,TUMB,636,-1,0,1,ECS Air Exchange Switch", "ECS(25),3636,PTN_636,TUMB,636,1,0,1,ECS Air Exchange Switch", "ECS(25),3910,PTN_910,TUMB,910,-1,0,1,LOX Dilution Lever", "ECS(25),3910,PTN_910,TUMB,910,1,0,1,LOX Dilution Lever", "NAVINST(2),3341,PTN_341,TUMB,341,0.1,0,0.6,HSI Mode Selector Switch", "NAVINST(2),3341,PTN_341,TUMB,341,-0.1,0,0.6,HSI Mode Selector Switch", "PWRPNL(8),3654,PTN_654,TUMB,654,-1,0,1,Alert Network (QRA) Switch", "PWRPNL(8),3654,PTN_654,TUMB,654,1,0,1,Alert Network (QRA) Switch", "RWR(13),3610,PTN_610,TUMB,610,0.1,0,1,Decoy Release Program Knob", "RWR(13),3610,PTN_610,TUMB,610,-0.1,0,1,Decoy Release Program Knob", "SYSLIGHTS(16),3701,PTN_701,LEV,701,0.8,0,1,VOR/ILS Volume Knob", "SYSLIGHTS(16),3704,PTN_704,LEV,704,0.8,0,1,TB APP Volume Knob", "SUBSYSTEMS(14),3395,PTN_395,TUMB,395,-1,0,1,Hydraulic System Selector", "SUBSYSTEMS(14),3395,PTN_395,TUMB,395,1,0,1,Hydraulic System Selector", "AFCS(17),3282,PTN_282,BTN,282,0,1,,Autopilot Master Button", "SUBSYSTEMS(14),3396,PTN_396,LEV,396,0.5,,,Pedal Adjustment Lever", "PCA_PPA(6),3279,PTN_279,BTN,279,0,1,,530D/Rockets/Guns Firing Mode Selector", "SYSLIGHTS(16),3705,PTN_705,LEV,705,0.8,0,1,Marker Signal Volume Knob", "AFCS(17),3516,PTN_516,TUMB,516,-1,0,1,FBW Test Switch Cover", "AFCS(17),3516,PTN_516,TUMB,516,1,0,1,FBW Test Switch Cover", "SYSLIGHTS(16),3706,PTN_706,LEV,706,0.8,0,1,UHF Radio Volume Knob", "SYSLIGHTS(16),3658,PTN_658,TUMB,658,-1,0,1,Audio Warning Switch", "SYSLIGHTS(16),3658,PTN_658,TUMB,658,1,0,1,Audio Warning Switch", "VORILS(24),3619,PTN_619,TUMB,619,-1,0,1,VOR/ILS Test Dial", "VORILS(24),3619,PTN_619,TUMB,619,1,0,1,VOR/ILS Test Dial", "VTH_VTB(5),3201,PTN_201,TUMB,201,0.5,0,1,HUD Power Switch", "VTH_VTB(5),3201,PTN_201,TUMB,201,-0.5,0,1,HUD Power Switch",
-        "PCA_PPA(6),3409,PTN_409,BTN,409,0,1,,Emergency Jettison", "ECS(25),3630,PTN_630,TUMB,630,-1,0,1,ECS Main Mode Switch", "ECS(25),3630,PTN_630,TUMB,630,1,0,1,ECS Main Mode Switch", "ECS(25),3631,PTN_631,BTN,631,1,1,,ECS C Button", "VTH_VTB(5),3209,PTN_209,LEV,209,0,0,0.99,Target Wingspan Knob", "ECS(25),3633,PTN_633,BTN,633,1,1,,ECS F Button", "AFCS(17),3300,PTN_300,TUMB,300,0.1,0,0.9,Altitude 1,000 ft Selector", "AFCS(17),3300,PTN_300,TUMB,300,-0.1,0,0.9,Altitude 1,000 ft Selector", "ECS(25),3912,PTN_912,TUMB,912,-1,0,1,LOX Emergency Supply", "ECS(25),3912,PTN_912,TUMB,912,1,0,1,LOX Emergency Supply", "INSTPANEL(4),3377,PTN_377,TUMB,377,0.1,0,0.9,Mode-1 Tens Selector", "INSTPANEL(4),3377,PTN_377,TUMB,377,-0.1,0,0.9,Mode-1 Tens Selector", "PCA_PPA(6),3277,PTN_277,BTN,277,1,-1,0,Bomb Release Quantity Selector Switch", "PCA_PPA(6),3277,PTN_277,BTN,277,-1,0,1,Bomb Release Quantity Selector Switch", "PCA_PPA(6),3256,PTN_256,BTN,256,0,1,,Weapons Selector Button 3", "PCA_PPA(6),3272,PTN_272,BTN,272,0,1,,MAGIC Standby", "VTH_VTB(5),3225,PTN_225,TUMB,225,0.1,0,0.7,Video Brightness", "VTH_VTB(5),3225,PTN_225,TUMB,225,-0.1,0,0.7,Video Brightness", "INSTPANEL(4),3380,PTN_380,TUMB,380,0.1,0,0.9,Mode-3A Hundreds Selector", "INSTPANEL(4),3380,PTN_380,TUMB,380,-0.1,0,0.9,Mode-3A Hundreds Selector", "INSTPANEL(4),3379,PTN_379,TUMB,379,0.1,0,0.9,Mode-3A Thousands Selector", "INSTPANEL(4),3379,PTN_379,TUMB,379,-0.1,0,0.9,Mode-3A Thousands Selector", "VHF(19),3964,PTN_964,BTN,964,1,0,1,VHF CONF", "INSTPANEL(4),3381,PTN_381,TUMB,381,0.1,0,0.9,Mode-3A Tens Selector", "INSTPANEL(4),3381,PTN_381,TUMB,381,-0.1,0,0.9,Mode-3A Tens Selector", "ENGINE(3),3657,PTN_657,BTN,657,1,0.5,1,Emergency Hydraulic Pump Switch", "ENGINE(3),3657,PTN_657,TUMB,657,0,0,0.5,Emergency Hydraulic Pump Switch", "INSTPANEL(4),3382,PTN_382,TUMB,382,0.1,0,0.9,Mode-3A Ones Selector", "INSTPANEL(4),3382,PTN_382,TUMB,382,-0.1,0,0.9,Mode-3A Ones Selector", "INSTPANEL(4),3386,PTN_386,TUMB,386,-1,0,1,Mode-3A Switch", "INSTPANEL(4),3386,PTN_386,TUMB,386,1,0,1,Mode-3A Switch", "INSTPANEL(4),3387,PTN_387,TUMB,387,-1,0,1,Mode-C Switch", "INSTPANEL(4),3387,PTN_387,TUMB,387,1,0,1,Mode-C Switch", "Helmet_NVG(31),3001,PTN_1002,TUMB,2,-1,0,1,STOW/UNSTOW NVG", "Helmet_NVG(31),3001,PTN_1002,TUMB,2,1,0,1,STOW/UNSTOW NVG", "PCN_NAV(9),3110,PTN_110,BTN,110,0,1,,INS Next Waypoint Button", "ENGPANEL(7),3468,PTN_468,TUMB,468,-1,0,1,Engine In-Flight Start Switch", "ENGPANEL(7),3468,PTN_468,TUMB,468,1,0,1,Engine In-Flight Start Switch", "SYSLIGHTS(16),3672,PTN_672,TUMB,672,-1,0,1,NVG Lights Filter Switch", "SYSLIGHTS(16),3672,PTN_672,TUMB,672,1,0,1,NVG Lights Filter Switch", "PCN_NAV(9),3582,PTN_582,BTN,582,0,1,,Mark Position", "UHF(20),3432,PTN_432,BTN,432,1,0,1,UHF CDE Switch", "RADAR(11),3109,PTN_109,TUMB,109,1,-1,1,Radar PRF Switch", "RADAR(11),3109,PTN_109,TUMB,109,-1,-1,1,Radar PRF Switch", "SYSLIGHTS(16),3703,PTN_703,LEV,703,0.8,0,1,MAGIC Tone Volume Knob", "Helmet_NVG(31),3002,PTN_1001,TUMB,1,-1,0,1,Mount/Unmount NVG on Helmet", "Helmet_NVG(31),3002,PTN_1001,TUMB,1,1,0,1,Mount/Unmount NVG on Helmet", "RADAR(11),3506,PTN_506,TUMB,506,0.5,0,1,Radar Azimuth Selector", "RADAR(11),3506,PTN_506,TUMB,506,-0.5,0,1,Radar Azimuth Selector", "SYSLIGHTS(16),3702,PTN_702,LEV,702,0.8,0,1,TACAN Volume Knob", "PCA_PPA(6),3239,PTN_239,BTN,239,0,1,,PCA Button 3", "SYSLIGHTS(16),3644,PTN_644,LEV,644,10,,,White Flood Lights Knob", "RADAR(11),3599,PTN_599,TUMB,599,-1,0,1,Radar IFF L/R Selector", "RADAR(11),3599,PTN_599,TUMB,599,1,0,1,Radar IFF L/R Selector", "PWRPNL(8),3522,PTN_522,TUMB,522,-1,0,1,Alternator 1 Switch", "PWRPNL(8),3522,PTN_522,TUMB,522,1,0,1,Alternator 1 Switch", "PCN_NAV(9),3587,PTN_587,BTN,587,0,1,,INS Button 4", "PCA_PPA(6),3275,PTN_275,BTN,275,-1,-1,0,PPA Test Switch", "PCA_PPA(6),3275,PTN_275,BTN,275,1,0,1,PPA Test Switch", "SUBSYSTEMS(14),3462,PTN_462,TUMB,462,1,-1,1,Slats Operation Switch", "SUBSYSTEMS(14),3462,PTN_462,TUMB,462,-1,-1,1,Slats Operation Switch", "VTH_VTB(5),3218,PTN_218,BTN,218,1,-1,0,Target Altitude", "VTH_VTB(5),3218,PTN_218,BTN,218,-1,0,1,Target Altitude", "FLIGHTINST(1),3309,PTN_309,LEV,309,1,0,1,Barometric Pressure Calibration", "INSTPANEL(4),3360,PTN_360,TUMB,360,0.1,0,0.9,Bingo Fuel 1,000 kg Selector", "INSTPANEL(4),3360,PTN_360,TUMB,360,-0.1,0,0.9,Bingo Fuel 1,000 kg Selector", "RADAR(11),3493,PTN_493,TUMB,493,-1,0,1,A/G Radar DEC Mode Switch", "RADAR(11),3493,PTN_493,TUMB,493,1,0,1,A/G Radar DEC Mode Switch", "RADAR(11),3491,PTN_491,TUMB,491,-1,0,1,A/G Radar A Mode Switch", "RADAR(11),3491,PTN_491,TUMB,491,1,0,1,A/G Radar A Mode Switch", "ENGPANEL(7),3476,PTN_476,TUMB,476,-0.5,0,1,Engine Emergency Control Switch", "ENGPANEL(7),3476,PTN_476,TUMB,476,0.5,0,1,Engine Emergency Control Switch", "ENGPANEL(7),3467,PTN_467,BTN,467,1,0,1,Engine Shutdown Button", "INSTPANEL(4),3384,PTN_384,TUMB,384,-1,0,1,Mode-1 Switch", "INSTPANEL(4),3384,PTN_384,TUMB,384,1,0,1,Mode-1 Switch", "VTH_VTB(5),3215,PTN_215,BTN,215,1,-1,0,Target Range from Bullseye", "VTH_VTB(5),3215,PTN_215,BTN,215,-1,0,1,Target Range from Bullseye", "SYSLIGHTS(16),3228,PTN_228,LEV,228,10,,,RWR Light Brightnes Control", "VTH_VTB(5),3226,PTN_226,TUMB,226,0.1,0,0.7,Display Contrast", "VTH_VTB(5),3226,PTN_226,TUMB,226,-0.1,0,0.7,Display Contrast", "MISCPANELS(22),3400,PTN_400,TUMB,400,-1,0,1,Cockpit Clock", "MISCPANELS(22),3400,PTN_400,TUMB,400,1,0,1,Cockpit Clock", "VHF(19),3960,PTN_960,BTN,960,1,0,1,VHF 7", "PCA_PPA(6),3249,PTN_249,TUMB,249,-1,0,1,Selective Jettison Switch", "PCA_PPA(6),3249,PTN_249,TUMB,249,1,0,1,Selective Jettison Switch", "PCN_NAV(9),3905,PTN_905,TUMB,905,-1,0,1,Emergency Compass", "PCN_NAV(9),3905,PTN_905,TUMB,905,1,0,1,Emergency Compass", "SYSLIGHTS(16),144,PTN_191,BTN,191,0,1,,Audio Warning Reset", "VHF(19),3958,PTN_958,BTN,958,1,0,1,VHF 5/20/LOW", "UHF(20),3435,PTN_435,TUMB,435,0.05,0.05,1,UHF Knob", "UHF(20),3435,PTN_435,TUMB,435,-0.05,0.05,1,UHF Knob", "PCN_NAV(9),3586,PTN_586,BTN,586,0,1,,INS Button 3", "MISCPANELS(22),3807,PTN_807,BTN,807,-1,-1,0,Nose Wheel Steering / IFF Interrogation Button", "MISCPANELS(22),3807,PTN_807,BTN,807,1,0,1,Nose Wheel Steering / IFF Interrogation Button", "ENGINE(3),3420,PTN_420,TUMB,420,-1,0,1,FBW Gain Mode Switch Cover", "ENGINE(3),3420,PTN_420,TUMB,420,1,0,1,FBW Gain Mode Switch Cover", "PCN_NAV(9),3593,PTN_593,BTN,593,0,1,,INS Button 0", "ECS(25),3635,PTN_635,TUMB,635,-1,0,1,ECS Cond Switch", "ECS(25),3635,PTN_635,TUMB,635,1,0,1,ECS Cond Switch", "ENGPANEL(7),3652,PTN_652,TUMB,652,-1,0,1,Fuel Cutoff Switch", "ENGPANEL(7),3652,PTN_652,TUMB,652,1,0,1,Fuel Cutoff Switch", "AFCS(17),3515,PTN_515,TUMB,515,-1,0,1,Autopilot Test Switch", "AFCS(17),3515,PTN_515,TUMB,515,1,0,1,Autopilot Test Switch", "PCN_NAV(9),3588,PTN_588,BTN,588,0,1,,INS Button 5", "INSTPANEL(4),3378,PTN_378,TUMB,378,0.1,0,0.9,Mode-1 Ones Selector", "INSTPANEL(4),3378,PTN_378,TUMB,378,-0.1,0,0.9,Mode-1 Ones Selector", "ENGPANEL(7),3464,PTN_464,TUMB,464,-1,0,1,Emergency Throttle Cover", "ENGPANEL(7),3464,PTN_464,TUMB,464,1,0,1,Emergency Throttle Cover", "VTH_VTB(5),3220,PTN_220,BTN,220,1,-1,0,Target Age", "VTH_VTB(5),3220,PTN_220,BTN,220,-1,0,1,Target Age", "SUBSYSTEMS(14),3908,PTN_908,TUMB,908,-1,0,1,Canopy Handle", "SUBSYSTEMS(14),3908,PTN_908,TUMB,908,1,0,1,Canopy Handle", "PCN_NAV(9),3578,PTN_578,BTN,578,0,1,,INS Update", "SYSLIGHTS(16),3455,PTN_455,TUMB,455,0.5,0,1,Formation Lights Switch", "SYSLIGHTS(16),3455,PTN_455,TUMB,455,-0.5,0,1,Formation Lights Switch", "VHF(19),3954,PTN_954,BTN,954,1,0,1,VHF 1/READ", "SYSLIGHTS(16),3454,PTN_454,TUMB,454,0.5,0,1,Navigation Lights Switch", "SYSLIGHTS(16),3454,PTN_454,TUMB,454,-0.5,0,1,Navigation Lights Switch", "PCA_PPA(6),3235,PTN_235,BTN,235,0,1,,PCA Button 1", "ENGPANEL(7),3475,PTN_475,TUMB,475,-1,0,1,Engine Emergency Control Cover", "ENGPANEL(7),3475,PTN_475,TUMB,475,1,0,1,Engine Emergency Control Cover", "PCN_NAV(9),3572,PTN_572,BTN,572,0,1,,INS DEST Switch", "VTH_VTB(5),3227,PTN_227,TUMB,227,0.1,0,0.7,Display Brightness", "VTH_VTB(5),3227,PTN_227,TUMB,227,-0.1,0,0.7,Display Brightness", "VTH_VTB(5),3470,PTN_470,TUMB,470,-1,0,1,Radar WOW Emitter Authorize Switch", "VTH_VTB(5),3470,PTN_470,TUMB,470,1,0,1,Radar WOW Emitter Authorize Switch", "RADAR(11),3604,PTN_604,TUMB,604,0.1,0,0.9,Radar IFF Code-1 Selector", "RADAR(11),3604,PTN_604,TUMB,604,-0.1,0,0.9,Radar IFF Code-1 Selector", "VHF(19),3962,PTN_962,BTN,962,1,0,1,VHF 9/ZERO", "AFCS(17),3423,PTN_423,BTN,423,1,0,1,FBW Reset Button", "AFCS(17),3509,PTN_509,BTN,509,1,-1,0,Rudder Trim Paddle", "AFCS(17),3509,PTN_509,BTN,509,-1,0,1,Rudder Trim Paddle", "VTH_VTB(5),3217,PTN_217,BTN,217,1,-1,0,Target Heading", "VTH_VTB(5),3217,PTN_217,BTN,217,-1,0,1,Target Heading", "SUBSYSTEMS(14),3655,PTN_655,TUMB,655,-1,0,1,Canopy Lock", "SUBSYSTEMS(14),3655,PTN_655,TUMB,655,1,0,1,Canopy Lock", "PCA_PPA(6),3241,PTN_241,BTN,241,0,1,,PCA Button 4", "INSTPANEL(4),3383,PTN_383,TUMB,383,-1,-1,1,Ident Power Switch", "INSTPANEL(4),3383,PTN_383,TUMB,383,1,-1,1,Ident Power Switch", "AFCS(17),3479,PTN_479,TUMB,479,-1,0,1,FBW Channel 5 Switch Cover", "AFCS(17),3479,PTN_479,TUMB,479,1,0,1,FBW Channel 5 Switch Cover", "RWR(13),3609,PTN_609,TUMB,609,0.5,0,1,Decoy Release Mode Switch", "RWR(13),3609,PTN_609,TUMB,609,-0.5,0,1,Decoy Release Mode Switch", "VTH_VTB(5),3203,PTN_203,BTN,203,1,-1,0,HUD Declutter Switch", "VTH_VTB(5),3203,PTN_203,BTN,203,-1,0,1,HUD Declutter Switch", "PCA_PPA(6),3262,PTN_262,BTN,262,0,1,,Weapons Selector Button 5", "UHF(20),3434,PTN_434,BTN,434,1,0,1,UHF TEST Switch", "PCA_PPA(6),3243,PTN_243,BTN,243,0,1,,PCA Button 5", "AFCS(17),3508,PTN_508,TUMB,508,0,0,1,Trim Control Mode Dial", "AFCS(17),3508,PTN_508,TUMB,508,1,0,1,Trim Control Mode Dial", "AFCS(17),3288,PTN_288,BTN,288,0,1,,Selected Altitude Hold Button", "VORILS(24),3617,PTN_617,TUMB,617,-1,0,1,VOR/ILS Power Dial", "VORILS(24),3617,PTN_617,TUMB,617,1,0,1,VOR/ILS Power Dial", "RWR(13),3607,PTN_607,TUMB,607,0.5,0,1,RWR Power Switch", "RWR(13),3607,PTN_607,TUMB,607,-0.5,0,1,RWR Power Switch", "VTH_VTB(5),3192,PTN_192,LEV,192,0,0,1,Minimum Altitude Selector", "ENGPANEL(7),3645,PTN_645,TUMB,645,-1,0,1,Engine Start Switch Cover",
-        "ENGPANEL(7),3645,PTN_645,TUMB,645,1,0,1,Engine Start Switch Cover", "VTH_VTB(5),3216,PTN_216,BTN,216,1,-1,0,Target Bearing from Bullseye", "VTH_VTB(5),3216,PTN_216,BTN,216,-1,0,1,Target Bearing from Bullseye", "RWR(13),3606,PTN_606,TUMB,606,0.5,0,1,BR Power Switch", "RWR(13),3606,PTN_606,TUMB,606,-0.5,0,1,BR Power Switch", "SYSLIGHTS(16),3643,PTN_643,LEV,643,10,,,Casution/Advisory Lights Rheostat", "PWRPNL(8),3520,PTN_520,TUMB,520,-1,0,1,Main Battery Switch", "PWRPNL(8),3520,PTN_520,TUMB,520,1,0,1,Main Battery Switch", "PCN_NAV(9),3629,PTN_629,TUMB,629,-0.1,0,0.4,INS Operational Mode", "PCN_NAV(9),3629,PTN_629,TUMB,629,0.1,0,0.4,INS Operational Mode", "ENGPANEL(7),3473,PTN_473,TUMB,473,-1,0,1,Secondary Oil Control Cover", "ENGPANEL(7),3473,PTN_473,TUMB,473,1,0,1,Secondary Oil Control Cover", "ECS(25),3637,PTN_637,LEV,637,0.8,-1,1,ECS Temperature Select Knob", "UHF(20),3429,PTN_429,TUMB,429,-1,0,1,UHF Power 5W/25W Switch", "UHF(20),3429,PTN_429,TUMB,429,1,0,1,UHF Power 5W/25W Switch", "RWR(13),3990,PTN_990,BTN,990,0,1,,ECM Box Clear Button", "SYSLIGHTS(16),,PTN_920,LEV,920,10,,,Refuel Lights Brightness Knob", "AFCS(17),3294,PTN_294,BTN,294,0,1,,Approach Hold Button", "RADAR(11),3502,PTN_502,TUMB,502,-0.5,0,1,Radar Scan Lines Selector", "RADAR(11),3502,PTN_502,TUMB,502,0.5,0,1,Radar Scan Lines Selector", "UHF(20),3433,PTN_433,TUMB,433,0.25,0,0.75,UHF Mode Switch", "UHF(20),3433,PTN_433,TUMB,433,-0.25,0,0.75,UHF Mode Switch", "PCA_PPA(6),3234,PTN_234,TUMB,234,-1,0,1,Master Arm Switch", "PCA_PPA(6),3234,PTN_234,TUMB,234,1,0,1,Master Arm Switch", "VHF(19),3952,PTN_952,BTN,952,1,0,1,VHF MEM/CLR", "MISCPANELS(22),3659,PTN_659,TUMB,659,-1,0,1,Pitot Heat Cover", "MISCPANELS(22),3659,PTN_659,TUMB,659,1,0,1,Pitot Heat Cover", "ENGINE(3),3460,PTN_460,TUMB,460,-1,0,1,Intake Slats Operation Switch", "ENGINE(3),3460,PTN_460,TUMB,460,1,0,1,Intake Slats Operation Switch", "PCA_PPA(6),3276,PTN_276,TUMB,276,-0.5,0,1,Bomb Fuze Selector Switch", "PCA_PPA(6),3276,PTN_276,TUMB,276,0.5,0,1,Bomb Fuze Selector Switch", "ENGPANEL(7),3193,PTN_193,TUMB,193,0.5,0,1,Refuel Transfer Switch", "ENGPANEL(7),3193,PTN_193,TUMB,193,-0.5,0,1,Refuel Transfer Switch", "MISCPANELS(22),3457,PTN_457,TUMB,457,0,0,1,Drag Chute Lever", "MISCPANELS(22),3457,PTN_457,TUMB,457,1,0,1,Drag Chute Lever", "PCA_PPA(6),3266,PTN_266,BTN,266,0,1,,S530 Standby", "INSTPANEL(4),3648,PTN_648,TUMB,648,-1,0,1,Engine Fuel Right Boost Pump Switch", "INSTPANEL(4),3648,PTN_648,TUMB,648,1,0,1,Engine Fuel Right Boost Pump Switch", "RADAR(11),3483,PTN_483,BTN,483,0,1,,Radar Rearm Button", "PCN_NAV(9),3580,PTN_580,BTN,580,0,1,,Validate Data Entry", "INSTPANEL(4),3385,PTN_385,TUMB,385,-1,0,1,Mode-2 Switch", "INSTPANEL(4),3385,PTN_385,TUMB,385,1,0,1,Mode-2 Switch", "INSTPANEL(4),3361,PTN_361,TUMB,361,0.1,0,0.9,Bingo Fuel 100 kg Selector", "INSTPANEL(4),3361,PTN_361,TUMB,361,-0.1,0,0.9,Bingo Fuel 100 kg Selector", "UHF(20),3430,PTN_430,TUMB,430,-1,0,1,UHF SIL Switch", "UHF(20),3430,PTN_430,TUMB,430,1,0,1,UHF SIL Switch", "SYSLIGHTS(16),3700,PTN_700,TUMB,700,-1,0,1,AMPLIS Selector Knob", "SYSLIGHTS(16),3700,PTN_700,TUMB,700,1,0,1,AMPLIS Selector Knob", "PCA_PPA(6),3269,PTN_269,BTN,269,0,1,,AUTO/MAN Button", "FLIGHTINST(1),3314,PTN_314,TUMB,314,-1,0,1,ADI Cage Lever", "FLIGHTINST(1),3314,PTN_314,TUMB,314,1,0,1,ADI Cage Lever", "VTH_VTB(5),3219,PTN_219,BTN,219,1,-1,0,Target Mach Number", "VTH_VTB(5),3219,PTN_219,BTN,219,-1,0,1,Target Mach Number", "VHF(19),3961,PTN_961,BTN,961,1,0,1,VHF 8/TOD", "SUBSYSTEMS(14),3456,PTN_456,TUMB,456,0,0,1,Canopy Jettison", "SUBSYSTEMS(14),3456,PTN_456,TUMB,456,1,0,1,Canopy Jettison", "PCN_NAV(9),3594,PTN_594,BTN,594,0,1,,INS Clear Button", "INSTPANEL(4),3357,PTN_357,TUMB,357,-1,0,1,Fuel Crossfeeed Switch", "INSTPANEL(4),3357,PTN_357,TUMB,357,1,0,1,Fuel Crossfeeed Switch", "PCN_NAV(9),3665,PTN_665,TUMB,665,0.5,0,1,INS Auxiliary Heading/Horizon", "PCN_NAV(9),3665,PTN_665,TUMB,665,-0.5,0,1,INS Auxiliary Heading/Horizon", "VTH_VTB(5),3222,PTN_222,BTN,222,1,-1,0,VTB Declutter", "VTH_VTB(5),3222,PTN_222,BTN,222,-1,0,1,VTB Declutter", "ENGINE(3),3421,PTN_421,TUMB,421,-1,0,1,FBW Gain Mode Switch", "ENGINE(3),3421,PTN_421,TUMB,421,1,0,1,FBW Gain Mode Switch", "ENGINE(3),3461,PTN_461,TUMB,461,-1,0,1,Intake Cones Operation Switch", "ENGINE(3),3461,PTN_461,TUMB,461,1,0,1,Intake Cones Operation Switch", "SYSLIGHTS(16),3575,PTN_575,LEV,575,10,,,Light Brightnes Control/Test", "PCN_NAV(9),3590,PTN_590,BTN,590,0,1,,INS Button 7", "RADAR(11),3602,PTN_602,TUMB,602,0.1,0,0.9,Radar IFF Code-3 Selector", "RADAR(11),3602,PTN_602,TUMB,602,-0.1,0,0.9,Radar IFF Code-3 Selector", "PCA_PPA(6),3248,PTN_248,TUMB,248,-1,0,1,Selective Jettison Switch Cover", "PCA_PPA(6),3248,PTN_248,TUMB,248,1,0,1,Selective Jettison Switch Cover", "RADAR(11),3603,PTN_603,TUMB,603,0.1,0,0.9,Radar IFF Code-2 Selector", "RADAR(11),3603,PTN_603,TUMB,603,-0.1,0,0.9,Radar IFF Code-2 Selector", "RADAR(11),3488,PTN_488,LEV,488,10,,,Radar Gain Dial", "VTH_VTB(5),3205,PTN_205,TUMB,205,0.5,0,1,Radar Altimeter Power Switch", "VTH_VTB(5),3205,PTN_205,TUMB,205,-0.5,0,1,Radar Altimeter Power Switch", "PCA_PPA(6),3259,PTN_259,BTN,259,0,1,,Weapons Selector Button 4", "RADAR(11),3601,PTN_601,TUMB,601,0.1,0,0.9,Radar IFF Code-4 Selector", "RADAR(11),3601,PTN_601,TUMB,601,-0.1,0,0.9,Radar IFF Code-4 Selector", "PCA_PPA(6),3278,PTN_278,BTN,278,1,-1,0,Bomb Release Interval Selector Switch", "PCA_PPA(6),3278,PTN_278,BTN,278,-1,0,1,Bomb Release Interval Selector Switch", "SYSLIGHTS(16),3642,PTN_642,LEV,642,10,,,Console Panel Lights Knob", "VTH_VTB(5),3202,PTN_202,LEV,202,0,0,1,HUD Brightness Knob", "PCN_NAV(9),3585,PTN_585,BTN,585,0,1,,INS Button 2", "ENGPANEL(7),3649,PTN_649,BTN,649,0,1,,Engine Start Switch", "TACAN(23),3623,PTN_623,TUMB,623,0.076923,0,0.923076,TACAN Channel 10 Selector", "TACAN(23),3623,PTN_623,TUMB,623,-0.076923,0,0.923076,TACAN Channel 10 Selector", "VTH_VTB(5),3223,PTN_223,TUMB,223,-1,0,1,VTB Orientation Selector (Inop)", "VTH_VTB(5),3223,PTN_223,TUMB,223,1,0,1,VTB Orientation Selector (Inop)", "VHF(19),3957,PTN_957,BTN,957,1,0,1,VHF 4", "SYSLIGHTS(16),3640,PTN_640,LEV,640,10,,,Dashboard Panel Lights Knob", "PWRPNL(8),3524,PTN_524,BTN,524,1,-1,0,Lights Test Switch", "PWRPNL(8),3524,PTN_524,BTN,524,-1,0,1,Lights Test Switch", "ECS(25),3911,PTN_911,BTN,911,1,0.5,1,LOX Test Switch", "ECS(25),3911,PTN_911,TUMB,911,0,0,0.5,LOX Test Switch", "PCN_NAV(9),3576,PTN_576,BTN,576,0,1,,Offset Waypoint/Target", "PCA_PPA(6),3237,PTN_237,BTN,237,0,1,,PCA Button 2", "INSTPANEL(4),3472,PTN_472,TUMB,472,-1,0,1,A/B Emergency Cutoff Switch", "INSTPANEL(4),3472,PTN_472,TUMB,472,1,0,1,A/B Emergency Cutoff Switch", "AFCS(17),3285,PTN_285,BTN,285,0,1,,Altitude Hold Button", "SYSLIGHTS(16),3453,PTN_453,TUMB,453,0.5,0,1,Anti-Collision Lights Switch", "SYSLIGHTS(16),3453,PTN_453,TUMB,453,-0.5,0,1,Anti-Collision Lights Switch", "PCN_NAV(9),3589,PTN_589,BTN,589,0,1,,INS Button 6", "VTH_VTB(5),3214,PTN_214,BTN,214,1,-1,0,Bullseye Waypoint Selector", "VTH_VTB(5),3214,PTN_214,BTN,214,-1,0,1,Bullseye Waypoint Selector", "INSTPANEL(4),3404,PTN_404,TUMB,404,0,0,1,Landing Gear Lever", "INSTPANEL(4),3404,PTN_404,TUMB,404,1,0,1,Landing Gear Lever", "PCA_PPA(6),3253,PTN_253,BTN,253,0,1,,Weapons Selector Button 2", "RADAR(11),3486,PTN_486,TUMB,486,0.33,0,0.99,Radar Power Selector", "RADAR(11),3486,PTN_486,TUMB,486,-0.33,0,0.99,Radar Power Selector", "SYSLIGHTS(16),3641,PTN_641,LEV,641,10,,,Red Flood Lights Knob", "ENGINE(3),3330,PTN_330,TUMB,330,-1,0,1,FBW Spin Mode Switch", "ENGINE(3),3330,PTN_330,TUMB,330,1,0,1,FBW Spin Mode Switch", "VORILS(24),3618,PTN_618,TUMB,618,0.05,0,0.95,VOR/ILS Frequency Change Decimal", "VORILS(24),3618,PTN_618,TUMB,618,-0.05,0,0.95,VOR/ILS Frequency Change Decimal", "ECS(25),3638,PTN_638,TUMB,638,-1,0,1,ECS Defog Switch", "ECS(25),3638,PTN_638,TUMB,638,1,0,1,ECS Defog Switch", "PCA_PPA(6),3245,PTN_245,BTN,245,0,1,,Gun Mode Button", "PCA_PPA(6),3463,PTN_463,TUMB,463,-1,0,1,Gun Arm/Safe Switch", "PCA_PPA(6),3463,PTN_463,TUMB,463,1,0,1,Gun Arm/Safe Switch", "VTH_VTB(5),3208,PTN_208,TUMB,208,-1,0,1,A/G Gun Reticle Switch", "VTH_VTB(5),3208,PTN_208,TUMB,208,1,0,1,A/G Gun Reticle Switch", "TACAN(23),3624,PTN_624,TUMB,624,-1,0,1,TACAN X/Y Select", "TACAN(23),3624,PTN_624,TUMB,624,1,0,1,TACAN X/Y Select", "AFCS(17),3514,PTN_514,TUMB,514,-1,0,1,Autopilot Test Switch Cover", "AFCS(17),3514,PTN_514,TUMB,514,1,0,1,Autopilot Test Switch Cover", "PCA_PPA(6),3265,PTN_265,TUMB,265,-1,-1,1,Missile Selector Switch", "PCA_PPA(6),3265,PTN_265,TUMB,265,1,-1,1,Missile Selector Switch", "VTH_VTB(5),3221,PTN_221,TUMB,221,-1,0,1,VTB Power Switch", "VTH_VTB(5),3221,PTN_221,TUMB,221,1,0,1,VTB Power Switch", "VHF(19),3963,PTN_963,BTN,963,1,0,1,VHF 0", "AFCS(17),3299,PTN_299,TUMB,299,0.1,0,0.5,Altitude 10,000 ft Selector", "AFCS(17),3299,PTN_299,TUMB,299,-0.1,0,0.5,Altitude 10,000 ft Selector"],
-    "MIG-21bis": ["SAU(8),3069,PNT_344,TUMB,344,-1,0,1,SAU Preset - Limit Altitude", "SAU(8),3069,PNT_344,TUMB,344,1,0,1,SAU Preset - Limit Altitude", "SPRD(48),3107,PNT_168,TUMB,168,-1,0,1,SPRD (RATO) Drop System On/Off", "SPRD(48),3107,PNT_168,TUMB,168,1,0,1,SPRD (RATO) Drop System On/Off", "ARK(24),3050,PNT_218,TUMB,213,0,0.6,0.6,ARK 6", "LIGHTS(46),3333,PNT_323,TUMB,323,-0.5,0,1,Landing Lights Off/Taxi/Land", "LIGHTS(46),3333,PNT_323,TUMB,323,0.5,0,1,Landing Lights Off/Taxi/Land", "ENGINE(6),3022,PNT_308,TUMB,308,-1,0,1,Anti surge doors - Auto/Manual", "ENGINE(6),3022,PNT_308,TUMB,308,1,0,1,Anti surge doors - Auto/Manual", "RADAR(40),3101,PNT_333,BTN,333,1,0,1,Radar Interferes - Weather", "LIGHTS(46),3233,PNT_157,LEV,157,0,-1,0,Main Red Lights", "PITOT_TUBES(27),3021,PNT_280,TUMB,280,-1,0,1,Secondary Pitot Tube Heat", "PITOT_TUBES(27),3021,PNT_280,TUMB,280,1,0,1,Secondary Pitot Tube Heat", "SPO(37),3083,PNT_202,TUMB,202,-1,0,1,SPO-10 RWR On/Off", "SPO(37),3083,PNT_202,TUMB,202,1,0,1,SPO-10 RWR On/Off", "SPRD(48),3106,PNT_167,TUMB,167,-1,0,1,SPRD (RATO) System On/Off", "SPRD(48),3106,PNT_167,TUMB,167,1,0,1,SPRD (RATO) System On/Off", "SPS_CONTROL(57),3221,PNT_400,TUMB,400,-1,0,1,Manual Activation button - Cover", "SPS_CONTROL(57),3221,PNT_400,TUMB,400,1,0,1,Manual Activation button - Cover", "CANOPY(43),3154,PNT_224,TUMB,224,-1,0,1,Canopy Emergency Release Handle", "CANOPY(43),3154,PNT_224,TUMB,224,1,0,1,Canopy Emergency Release Handle", "RADAR(40),3239,PNT_432,LEV,623,0,0,1,Radar Polar Filter", "ENGINE_START_DEVICE(3),3015,PNT_288,TUMB,288,-1,0,1,Engine Cold / Normal Start", "ENGINE_START_DEVICE(3),3015,PNT_288,TUMB,288,1,0,1,Engine Cold / Normal Start", "ASP(41),3664,PNT_247,LEV,247,0,0,1,Scale Backlights control", "WEAPON_CONTROL(42),3176,PNT_276,BTN,276,1,0,1,Emergency Missile/Rocket Launcher", "RADAR(40),3094,PNT_205,TUMB,205,-0.5,0,1,Radar Off/Prep/On", "RADAR(40),3094,PNT_205,TUMB,205,0.5,0,1,Radar Off/Prep/On", "RADAR(40),3104,PNT_336,BTN,336,1,0,1,Radar Interferes - Self-test", "ARK(24),3052,PNT_197,TUMB,197,-1,0,1,ARK Mode - Antenna / Compass", "ARK(24),3052,PNT_197,TUMB,197,1,0,1,ARK Mode - Antenna / Compass", "WEAPON_CONTROL(42),3184,PNT_231,TUMB,231,-0.5,0,1,Weapon Mode - IR Missile/Neutral/SAR Missile", "WEAPON_CONTROL(42),3184,PNT_231,TUMB,231,0.5,0,1,Weapon Mode - IR Missile/Neutral/SAR Missile", "WEAPON_CONTROL(42),3185,PNT_232,BTN,232,1,0,1,Activate Gun Loading Pyro - 1", "WEAPON_CONTROL(42),3186,PNT_233,BTN,233,1,0,1,Activate Gun Loading Pyro - 2", "SAU(8),3067,PNT_376,BTN,376,1,0,1,SAU cancel current mode", "SAU(8),3066,PNT_343,BTN,343,1,0,1,SAU - Stabilize", "CONTROL_SYSTEM(7),3247,PNT_STICK_LEFT,BTN,630,1,0,1,Stick Left", "UNCLASSIFIED(51),3256,PNT_435,LEV,634,0,0,1,G-Suit Max/Min valve", "LIGHTS(46),3032,PNT_194,TUMB,194,-0.33,0,0.99,Navigation Lights Off/Min/Med/Max", "LIGHTS(46),3032,PNT_194,TUMB,194,0.33,0,0.99,Navigation Lights Off/Min/Med/Max", "CONTROL_SYSTEM(7),3244,PNT_RUD_RIGHT,BTN,627,1,0,1,Rudder Right", "WEAPON_CONTROL(42),3173,PNT_277,TUMB,277,-1,0,1,Tactical Drop Cover", "WEAPON_CONTROL(42),3173,PNT_277,TUMB,277,1,0,1,Tactical Drop Cover", "RADAR(40),3255,PNT_434,TUMB,633,-1,0,1,Radar emission - Combat/Training", "RADAR(40),3255,PNT_434,TUMB,633,1,0,1,Radar emission - Combat/Training", "SAU(8),3065,PNT_180,TUMB,180,-1,0,1,SAU Pitch On/Off", "SAU(8),3065,PNT_180,TUMB,180,1,0,1,SAU Pitch On/Off", "LIGHTS(46),3232,PNT_156,LEV,156,0,0,1,Instruments Back-light", "TRIMER(9),3240,PNT_379,TUMB,379,1,1,0,Trimmer Pitch Up/Down", "TRIMER(9),3132,PNT_379,TUMB,379,-1,-1,0,Trimmer Pitch Up/Down", "LIGHTS_WARNING(47),3277,PNT_255,LEV,657,0.5,0,1,SORC", "LIGHTS_WARNING(47),3040,PNT_255,BTN,255,1,0,1,SORC", "RSBN(25),3058,PNT_345,LEV,345,0,0,1,RSBN Sound", "ASP(41),3713,PNT_384,LEV,384,0,0,1,TDC Range / Pipper Span control", "SOD(39),3090,PNT_200,TUMB,200,-1,0,1,SOD IFF On/Off", "SOD(39),3090,PNT_200,TUMB,200,1,0,1,SOD IFF On/Off", "ASP(41),3155,PNT_186,TUMB,186,-1,0,1,ASP Optical sight On/Off", "ASP(41),3155,PNT_186,TUMB,186,1,0,1,ASP Optical sight On/Off", "ASP(41),3156,PNT_241,TUMB,241,-1,0,1,ASP Main Mode - Manual/Auto", "ASP(41),3156,PNT_241,TUMB,241,1,0,1,ASP Main Mode - Manual/Auto", "RSBN(25),3054,PNT_176,TUMB,176,-1,0,1,RSBN On/Off", "RSBN(25),3054,PNT_176,TUMB,176,1,0,1,RSBN On/Off", "UNCLASSIFIED(51),3265,PNT_442,BTN,643,1,0,1,Eject", "WEAPON_CONTROL(42),3175,PNT_275,TUMB,275,-1,0,1,Emergency Missile/Rocket Launcher Cover", "WEAPON_CONTROL(42),3175,PNT_275,TUMB,275,1,0,1,Emergency Missile/Rocket Launcher Cover", "UNCLASSIFIED(51),3257,PNT_436,TUMB,635,-1,0,1,Electric Bus Nr.1 - Cover", "UNCLASSIFIED(51),3257,PNT_436,TUMB,635,1,0,1,Electric Bus Nr.1 - Cover", "RADIO(22),3043,PNT_209,TUMB,209,-1,0,1,Squelch On/Off", "RADIO(22),3043,PNT_209,TUMB,209,1,0,1,Squelch On/Off", "SPO(37),3085,PNT_227,TUMB,227,-1,0,1,SPO-10 Night / Day", "SPO(37),3085,PNT_227,TUMB,227,1,0,1,SPO-10 Night / Day", "UNCLASSIFIED(51),3267,PNT_444,TUMB,645,-1,0,1,UK-2M Mic Amplifier M/L", "UNCLASSIFIED(51),3267,PNT_444,TUMB,645,1,0,1,UK-2M Mic Amplifier M/L", "ENGINE_START_DEVICE(3),3238,PNT_430,BTN,616,1,0,1,Engine Stop/Lock", "UNCLASSIFIED(51),3269,PNT_446,LEV,647,0,0,1,Suit Ventilation", "RADIO_ALTIMETER(33),3146,PNT_284,TUMB,284,-0.14,0,0.98,Dangerous Altitude Warning Set", "RADIO_ALTIMETER(33),3146,PNT_284,TUMB,284,0.14,0,0.98,Dangerous Altitude Warning Set", "ASP(41),3157,PNT_242,TUMB,242,-1,0,1,ASP Mode - Bombardment/Shooting", "ASP(41),3157,PNT_242,TUMB,242,1,0,1,ASP Mode - Bombardment/Shooting", "UNCLASSIFIED(51),3274,PNT_449,LEV,651,0.2,,,Throttle Fixation", "NUKE_CONTROL(56),3198,PNT_388,TUMB,388,-1,0,1,Emergency Jettison Armed / Not Armed", "NUKE_CONTROL(56),3198,PNT_388,TUMB,388,1,0,1,Emergency Jettison Armed / Not Armed", "NUKE_CONTROL(56),3199,PNT_389,TUMB,389,-1,0,1,Tactical Jettison", "NUKE_CONTROL(56),3199,PNT_389,TUMB,389,1,0,1,Tactical Jettison", "CANOPY(43),3151,PNT_329,TUMB,329,-1,0,1,Secure Canopy", "CANOPY(43),3151,PNT_329,TUMB,329,1,0,1,Secure Canopy", "CANOPY(43),3272,PNT_431,TUMB,649,0,0,1,Canopy Ventilation System", "CANOPY(43),3272,PNT_431,TUMB,649,1,0,1,Canopy Ventilation System", "ENGINE_START_DEVICE(3),3017,PNT_301,TUMB,301,-1,0,1,Engine Emergency Air Start", "ENGINE_START_DEVICE(3),3017,PNT_301,TUMB,301,1,0,1,Engine Emergency Air Start", "SPRD(48),3108,PNT_252,TUMB,252,-1,0,1,SPRD (RATO) Start Cover", "SPRD(48),3108,PNT_252,TUMB,252,1,0,1,SPRD (RATO) Start Cover", "NUKE_CONTROL(56),3200,PNT_390,TUMB,390,-1,0,1,Special AB / Missile-Rocket-Bombs-Cannon", "NUKE_CONTROL(56),3200,PNT_390,TUMB,390,1,0,1,Special AB / Missile-Rocket-Bombs-Cannon", "NUKE_CONTROL(56),3201,PNT_391,TUMB,391,-1,0,1,Brake Chute", "NUKE_CONTROL(56),3201,PNT_391,TUMB,391,1,0,1,Brake Chute", "GEARS(14),3121,PNT_327,TUMB,327,1,-1,1,Gear Up/Neutral/Down", "GEARS(14),3121,PNT_327,TUMB,327,-1,-1,1,Gear Up/Neutral/Down", "UNCLASSIFIED(51),3268,PNT_445,TUMB,646,-1,0,1,UK-2M Mic Amplifier GS/KM", "UNCLASSIFIED(51),3268,PNT_445,TUMB,646,1,0,1,UK-2M Mic Amplifier GS/KM", "CONTROL_SYSTEM(7),3241,PNT_ENG_INC,BTN,624,1,0,1,Throttle Increase", "SPS_CONTROL(57),3215,PNT_394,TUMB,394,-1,0,1,Transmit / Receive", "SPS_CONTROL(57),3215,PNT_394,TUMB,394,1,0,1,Transmit / Receive", "ARK(24),3049,PNT_212,BTN,212,1,0,1,ARK Change", "RSBN(25),3080,PNT_347,BTN,347,1,0,1,RSBN self-test", "SPS_CONTROL(57),3216,PNT_395,TUMB,395,-1,0,1,Program I / II", "SPS_CONTROL(57),3216,PNT_395,TUMB,395,1,0,1,Program I / II", "HELMET_VISOR(45),3206,PNT_310,BTN,310,1,0,1,Helmet Quick Heat", "WEAPON_CONTROL(42),3180,PNT_270,BTN,270,1,0,1,Drop Payload - Outer Pylons", "SPS_CONTROL(57),3214,PNT_393,TUMB,393,-1,0,1,On / Off", "SPS_CONTROL(57),3214,PNT_393,TUMB,393,1,0,1,On / Off", "GYRO_DEVICES(21),3009,PNT_163,TUMB,163,-1,0,1,DA-200 Signal, Giro, NPP, RLS, SAU Power On/Off", "GYRO_DEVICES(21),3009,PNT_163,TUMB,163,1,0,1,DA-200 Signal, Giro, NPP, RLS, SAU Power On/Off", "RADAR(40),3099,PNT_331,BTN,331,1,0,1,Radar Interferes - Temporary", "FLAPS(15),3126,PNT_313,TUMB,313,-1,0,1,Flaps Landing", "FLAPS(15),3126,PNT_313,TUMB,313,1,0,1,Flaps Landing", "SPS_CONTROL(57),3219,PNT_398,TUMB,398,-1,0,1,Dispenser Auto / Manual", "SPS_CONTROL(57),3219,PNT_398,TUMB,398,1,0,1,Dispenser Auto / Manual", "SPS_CONTROL(57),3222,PNT_401,BTN,401,1,0,1,Manual Activation button", "ENGINE_START_DEVICE(3),3014,PNT_302,TUMB,302,-1,0,1,APU On/Off", "ENGINE_START_DEVICE(3),3014,PNT_302,TUMB,302,1,0,1,APU On/Off", "KPP(28),3141,PNT_260,LEV,260,0.0001,,,KPP Set", "RADIO(22),3045,PNT_211,TUMB,211,-0.05,0,0.95,Radio Channel", "RADIO(22),3045,PNT_211,TUMB,211,0.05,0,0.95,Radio Channel", "OXYGENE_SYSTEM(19),3147,PNT_285,TUMB,285,-1,0,1,Helmet Air Condition Off/On", "OXYGENE_SYSTEM(19),3147,PNT_285,TUMB,285,1,0,1,Helmet Air Condition Off/On", "DA_200(34),3203,PNT_261,LEV,261,0.0001,,,Variometer Set", "WEAPON_CONTROL(42),3177,PNT_256,TUMB,256,-1,0,1,Drop Wing Fuel Tanks Cover", "WEAPON_CONTROL(42),3177,PNT_256,TUMB,256,1,0,1,Drop Wing Fuel Tanks Cover", "WEAPON_CONTROL(42),3227,PNT_424,BTN,424,1,0,1,LOAD 3", "RADAR(40),3097,PNT_266,BTN,266,1,0,1,Radar Screen Magnetic Reset", "MAIN_HYDRO(44),3137,PNT_171,TUMB,171,-1,0,1,Emergency Hydraulic Pump On/Off", "MAIN_HYDRO(44),3137,PNT_171,TUMB,171,1,0,1,Emergency Hydraulic Pump On/Off", "PITOT_TUBES(27),3019,PNT_229,TUMB,229,-1,0,1,Pitot tube Selector Main/Emergency", "PITOT_TUBES(27),3019,PNT_229,TUMB,229,1,0,1,Pitot tube Selector Main/Emergency", "RADIO(22),3042,PNT_208,TUMB,208,-1,0,1,Radio / Compass", "RADIO(22),3042,PNT_208,TUMB,208,1,0,1,Radio / Compass", "KONUS(17),3261,PNT_440,BTN,639,1,0,1,1.5 Mach Test Button", "WEAPON_CONTROL(42),3182,PNT_272,BTN,272,1,0,1,Drop Payload - Inner Pylons", "RADIO_ALTIMETER(33),3145,PNT_175,TUMB,175,-1,0,1,Radio Altimeter/Marker On/Off", "RADIO_ALTIMETER(33),3145,PNT_175,TUMB,175,1,0,1,Radio Altimeter/Marker On/Off", "CONTROL_SYSTEM(7),3242,PNT_ENG_DEC,BTN,625,1,0,1,Throttle Decrease", "SPO(37),3086,PNT_225,LEV,225,0,0,1,SPO-10 Volume", "RSBN(25),3061,PNT_366,BTN,366,1,0,1,RSBN Reset", "RADAR(40),3103,PNT_335,BTN,335,1,0,1,Radar Interferes - Low Speed", "SRZO(38),3089,PNT_346,TUMB,346,-1,0,1,IFF System 'Type 81' On/Off",
-        "SRZO(38),3089,PNT_346,TUMB,346,1,0,1,IFF System 'Type 81' On/Off", "SPRD(48),3110,PNT_253,BTN,253,1,0,1,SPRD (RATO) Start", "WEAPON_CONTROL(42),3181,PNT_271,TUMB,271,-1,0,1,Drop Payload - Inner Pylons Cover", "WEAPON_CONTROL(42),3181,PNT_271,TUMB,271,1,0,1,Drop Payload - Inner Pylons Cover", "WEAPON_CONTROL(42),3191,PNT_381,BTN,381,1,0,1,Fire Gun", "GEARS(14),3123,PNT_281,TUMB,281,-1,0,1,Nose Gear Emergency Release Handle", "GEARS(14),3123,PNT_281,TUMB,281,1,0,1,Nose Gear Emergency Release Handle", "ENGINE_START_DEVICE(3),3016,PNT_289,BTN,289,1,0,1,Start Engine", "RSBN(25),3063,PNT_368,TUMB,368,-1,0,1,RSBN Distance", "RSBN(25),3063,PNT_368,TUMB,368,1,0,1,RSBN Distance", "CANOPY(43),3194,PNT_385,BTN,385,1,0,1,Canopy Close", "WEAPON_CONTROL(42),3192,PNT_383,TUMB,383,-1,0,1,Release Weapon Cover", "WEAPON_CONTROL(42),3192,PNT_383,TUMB,383,1,0,1,Release Weapon Cover", "FIRE_EXTINGUISHER(53),3027,PNT_325,BTN,325,1,0,1,Fire Extinguisher", "RADAR(40),3098,PNT_330,BTN,330,1,0,1,Radar Interferes - Continues", "UNCLASSIFIED(51),3263,PNT_151,BTN,642,1,0,1,SOD Control PBU-1", "LIGHTS_WARNING(47),3074,PNT_195,LEV,195,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night", "LIGHTS_WARNING(47),3034,PNT_195,BTN,369,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "RSBN(25),3057,PNT_294,BTN,294,1,0,1,RSBN Identify", "OXYGENE_SYSTEM(19),3149,PNT_287,TUMB,287,-1,0,1,Mixture/Oxygen", "OXYGENE_SYSTEM(19),3149,PNT_287,TUMB,287,1,0,1,Mixture/Oxygen", "avAChS(26),3253,PNT_268,LEV,267,0.05,-0.15,0.15,Mech clock right lever", "avAChS(26),3252,PNT_268,BTN,268,1,0,1,Mech clock right lever", "FUEL_PUMPS(4),3011,PNT_160,TUMB,160,-1,0,1,Fuel Tanks 1st Group, Fuel Pump", "FUEL_PUMPS(4),3011,PNT_160,TUMB,160,1,0,1,Fuel Tanks 1st Group, Fuel Pump", "SAU(8),3070,PNT_341,BTN,341,1,0,1,SAU - Landing - Command", "KONUS(17),3134,PNT_309,TUMB,309,-1,0,1,Nosecone Control - Manual/Auto", "KONUS(17),3134,PNT_309,TUMB,309,1,0,1,Nosecone Control - Manual/Auto", "ARK(24),3050,PNT_216,TUMB,213,0,0.4,0.4,ARK 4", "CONTROL_SYSTEM(7),3243,PNT_RUD_LEFT,BTN,626,1,0,1,Rudder Left", "LIGHTS_WARNING(47),3079,PNT_322,LEV,322,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night", "LIGHTS_WARNING(47),3039,PNT_322,BTN,374,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "WEAPON_CONTROL(42),3178,PNT_257,BTN,257,1,0,1,Drop Wing Fuel Tanks", "WEAPON_CONTROL(42),3225,PNT_422,BTN,422,3,0.5,,LOAD 1", "KPP(28),3140,PNT_259,BTN,259,1,0,1,KPP Cage", "RSBN(25),3055,PNT_240,TUMB,240,-0.5,0,1,RSBN Mode Land/Navigation/Descend", "RSBN(25),3055,PNT_240,TUMB,240,0.5,0,1,RSBN Mode Land/Navigation/Descend", "ASP(41),3663,PNT_246,LEV,246,0,0,1,Intercept Angle", "KONUS(17),3260,PNT_439,TUMB,638,-1,0,1,1.5 Mach Test Button - Cover", "KONUS(17),3260,PNT_439,TUMB,638,1,0,1,1.5 Mach Test Button - Cover", "ARU(11),3113,PNT_295,TUMB,295,-1,0,1,ARU System - Manual/Auto", "ARU(11),3113,PNT_295,TUMB,295,1,0,1,ARU System - Manual/Auto", "SPS(10),3112,PNT_293,TUMB,293,-1,0,1,SPS System Off/On", "SPS(10),3112,PNT_293,TUMB,293,1,0,1,SPS System Off/On", "HELMET_VISOR(45),3207,PNT_369,TUMB,369,-1,0,1,Helmet visor - off/on.", "HELMET_VISOR(45),3207,PNT_369,TUMB,369,1,0,1,Helmet visor - off/on.", "CHUTE(16),3130,PNT_305,BTN,305,1,0,1,Drop Drag Chute", "SRZO(38),3088,PNT_192,TUMB,192,-0.08,0,0.88,SRZO Codes", "SRZO(38),3088,PNT_192,TUMB,192,0.08,0,0.88,SRZO Codes", "SRZO(38),3230,PNT_428,BTN,428,1,0,1,SRZO Self Destruct", "SARPP(49),3209,PNT_433,TUMB,193,-1,0,1,SARPP-12 Flight Data Recorder On/Off", "SARPP(49),3209,PNT_433,TUMB,193,1,0,1,SARPP-12 Flight Data Recorder On/Off", "NUKE_CONTROL(56),3202,PNT_392,TUMB,392,-1,0,1,Detonation Air / Ground", "NUKE_CONTROL(56),3202,PNT_392,TUMB,392,1,0,1,Detonation Air / Ground", "GEAR_BRAKES(13),3118,PNT_238,TUMB,238,-1,0,1,Nosegear Brake Off/On", "GEAR_BRAKES(13),3118,PNT_238,TUMB,238,1,0,1,Nosegear Brake Off/On", "SOD(39),3093,PNT_204,TUMB,204,-0.25,0,1,SOD Modes", "SOD(39),3093,PNT_204,TUMB,204,0.25,0,1,SOD Modes", "LIGHTS(46),3234,PNT_222,LEV,222,0,0,1,Main White Lights", "FUEL_SYSTEM(5),3013,PNT_274,LEV,274,0,0,1,Fuel Quantity Set", "NUKE_CONTROL(56),3197,PNT_387,TUMB,387,-1,0,1,Emergency Jettison", "NUKE_CONTROL(56),3197,PNT_387,TUMB,387,1,0,1,Emergency Jettison", "ARK(24),3050,PNT_215,TUMB,213,0,0.3,0.3,ARK 3", "MAIN_HYDRO(44),3138,PNT_319,TUMB,319,-1,0,1,Aileron Booster - Off/On", "MAIN_HYDRO(44),3138,PNT_319,TUMB,319,1,0,1,Aileron Booster - Off/On", "SPS_CONTROL(57),3218,PNT_397,BTN,397,1,0,1,Test", "WEAPON_CONTROL(42),3170,PNT_184,TUMB,184,-1,0,1,Pylon 3-4 Power On/Off", "WEAPON_CONTROL(42),3170,PNT_184,TUMB,184,1,0,1,Pylon 3-4 Power On/Off", "ASP(41),3665,PNT_248,LEV,248,0,0,1,Pipper light control", "UNCLASSIFIED(51),3266,PNT_443,TUMB,644,-1,0,1,Ejection Seat Emergency Oxygen", "UNCLASSIFIED(51),3266,PNT_443,TUMB,644,1,0,1,Ejection Seat Emergency Oxygen", "ASP(41),3662,PNT_245,LEV,245,0,0,1,Target Size", "WEAPON_CONTROL(42),3224,PNT_421,TUMB,421,-1,0,1,MAIN GUN / UPK Guns", "WEAPON_CONTROL(42),3224,PNT_421,TUMB,421,1,0,1,MAIN GUN / UPK Guns", "avAChS(26),3251,PNT_264,LEV,264,0.04,0,1,Mech clock left lever", "avAChS(26),3250,PNT_264,BTN,265,-1,-1,0,Mech clock left lever", "avAChS(26),3249,PNT_264,BTN,265,1,0,1,Mech clock left lever", "ASP(41),3161,PNT_250,TUMB,250,-1,0,1,Fix net On/Off", "ASP(41),3161,PNT_250,TUMB,250,1,0,1,Fix net On/Off", "RSBN(25),3059,PNT_349,TUMB,351,-0.01,0,0.99,RSBN Navigation", "RSBN(25),3059,PNT_349,TUMB,351,0.01,0,0.99,RSBN Navigation", "SRZO(38),3229,PNT_427,TUMB,427,-1,0,1,SRZO Self Destruct Cover", "SRZO(38),3229,PNT_427,TUMB,427,1,0,1,SRZO Self Destruct Cover", "UNCLASSIFIED(51),3270,PNT_447,TUMB,648,-1,0,1,Harness Separation", "UNCLASSIFIED(51),3270,PNT_447,TUMB,648,1,0,1,Harness Separation", "CONTROL_SYSTEM(7),3245,PNT_STICK_UP,BTN,628,1,0,1,Stick Up", "CONTROL_SYSTEM(7),3248,PNT_STICK_RIGHT,BTN,631,1,0,1,Stick Right", "KSI(23),3142,PNT_178,TUMB,178,-1,0,1,NPP On/Off", "KSI(23),3142,PNT_178,TUMB,178,1,0,1,NPP On/Off", "WEAPON_CONTROL(42),3189,PNT_297,LEV,297,0,0,1,Missile Seeker Sound", "ACCELEROMETER(35),3018,PNT_228,BTN,228,1,0,1,Accelerometer Reset", "WEAPON_CONTROL(42),3179,PNT_269,TUMB,269,-1,0,1,Drop Payload - Outer Pylons Cover", "WEAPON_CONTROL(42),3179,PNT_269,TUMB,269,1,0,1,Drop Payload - Outer Pylons Cover", "UNCLASSIFIED(51),3259,PNT_438,TUMB,637,-1,0,1,Electric Bus Nr.2", "UNCLASSIFIED(51),3259,PNT_438,TUMB,637,1,0,1,Electric Bus Nr.2", "SPO(37),3084,PNT_226,BTN,226,1,0,1,SPO-10 Test", "KONUS(17),3135,PNT_236,LEV,236,0.05,0,1,Nosecone manual position controller", "KPP(28),3139,PNT_177,TUMB,177,-1,0,1,KPP Main/Emergency", "KPP(28),3139,PNT_177,TUMB,177,1,0,1,KPP Main/Emergency", "SAU(8),3064,PNT_179,TUMB,179,-1,0,1,SAU On/Off", "SAU(8),3064,PNT_179,TUMB,179,1,0,1,SAU On/Off", "FUEL_PUMPS(4),3010,PNT_159,TUMB,159,-1,0,1,Fuel Tanks 3rd Group, Fuel Pump", "FUEL_PUMPS(4),3010,PNT_159,TUMB,159,1,0,1,Fuel Tanks 3rd Group, Fuel Pump", "KSI(23),3144,PNT_263,LEV,263,1,0,1,NPP Course set", "ARK(24),3050,PNT_214,TUMB,213,0,0.2,0.2,ARK 2", "ARK(24),3050,PNT_220,TUMB,213,0,0.8,0.8,ARK 8", "INTERCOM(55),3046,PNT_315,BTN,315,1,0,1,Radio PTT", "UNCLASSIFIED(51),3258,PNT_437,TUMB,636,-1,0,1,Electric Bus Nr.1", "UNCLASSIFIED(51),3258,PNT_437,TUMB,636,1,0,1,Electric Bus Nr.1", "SAU(8),3071,PNT_342,BTN,342,1,0,1,SAU - Landing - Auto", "ARK(24),3050,PNT_221,TUMB,213,0,0.9,0.9,ARK 9", "AC_BUS(2),3007,PNT_164,TUMB,164,-1,0,1,Emergency Inverter", "AC_BUS(2),3007,PNT_164,TUMB,164,1,0,1,Emergency Inverter", "SPRD(48),3109,PNT_317,TUMB,317,-1,0,1,SPRD (RATO)t Drop Cover", "SPRD(48),3109,PNT_317,TUMB,317,1,0,1,SPRD (RATO)t Drop Cover", "ARU(11),3114,PNT_296,TUMB,296,-1,-1,0,ARU System - Low Speed/Neutral/High Speed", "ARU(11),3115,PNT_296,TUMB,296,1,1,0,ARU System - Low Speed/Neutral/High Speed", "AC_BUS(2),3004,PNT_169,TUMB,169,-1,0,1,AC Generator On/Off", "AC_BUS(2),3004,PNT_169,TUMB,169,1,0,1,AC Generator On/Off", "LIGHTS_WARNING(47),3075,PNT_196,LEV,196,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night", "LIGHTS_WARNING(47),3035,PNT_196,BTN,370,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "CANOPY(43),3153,PNT_239,BTN,239,1,0,1,Canopy Anti Ice", "WEAPON_CONTROL(42),3223,PNT_420,TUMB,420,-1,0,1,On / Off", "WEAPON_CONTROL(42),3223,PNT_420,TUMB,420,1,0,1,On / Off", "FLAPS(15),3125,PNT_312,TUMB,312,-1,0,1,Flaps Take-Off", "FLAPS(15),3125,PNT_312,TUMB,312,1,0,1,Flaps Take-Off", "GEAR_BRAKES(13),3119,PNT_237,TUMB,237,-1,0,1,Emergency Brake", "GEAR_BRAKES(13),3119,PNT_237,TUMB,237,1,0,1,Emergency Brake", "WEAPON_CONTROL(42),3226,PNT_425,BTN,425,1,0,1,LOAD 2", "ARK(24),3050,PNT_213,TUMB,213,0,0.1,0.1,ARK 1", "AIR_CONDITIONING(50),3208,PNT_292,TUMB,292,-0.33,0,0.99,Cockpit Air Condition Off/Cold/Auto/Warm", "AIR_CONDITIONING(50),3208,PNT_292,TUMB,292,0.33,0,0.99,Cockpit Air Condition Off/Cold/Auto/Warm", "GEAR_BRAKES(13),3117,PNT_299,TUMB,299,-1,0,1,ABS Off/On", "GEAR_BRAKES(13),3117,PNT_299,TUMB,299,1,0,1,ABS Off/On", "DC_BUS(1),3002,PNT_155,TUMB,155,-1,0,1,Battery Heat On/Off", "DC_BUS(1),3002,PNT_155,TUMB,155,1,0,1,Battery Heat On/Off", "ARK(24),3051,PNT_189,TUMB,189,-0.14,0,0.98,ARK Zone", "ARK(24),3051,PNT_189,TUMB,189,0.14,0,0.98,ARK Zone", "ARK(24),3047,PNT_174,TUMB,174,-1,0,1,ARK On/Off", "ARK(24),3047,PNT_174,TUMB,174,1,0,1,ARK On/Off", "RADAR(40),3102,PNT_334,BTN,334,1,0,1,Radar Interferes - IFF", "RADAR(40),3190,PNT_378,BTN,378,1,0,1,Lock Target", "KSI(23),3143,PNT_258,BTN,258,1,0,1,NPP Adjust", "SPRD(48),3111,PNT_318,BTN,318,1,0,1,SPRD (RATO) Drop", "DC_BUS(1),3001,PNT_165,TUMB,165,-1,0,1,Battery On/Off", "DC_BUS(1),3001,PNT_165,TUMB,165,1,0,1,Battery On/Off", "RSBN(25),3060,PNT_350,TUMB,352,-0.01,0,0.99,PRMG Landing", "RSBN(25),3060,PNT_350,TUMB,352,0.01,0,0.99,PRMG Landing", "KONUS(17),3133,PNT_170,TUMB,170,-1,0,1,Nosecone On/Off", "KONUS(17),3133,PNT_170,TUMB,170,1,0,1,Nosecone On/Off", "OXYGENE_SYSTEM(19),3148,PNT_286,TUMB,286,-1,0,1,Emergency Oxygen Off/On", "OXYGENE_SYSTEM(19),3148,PNT_286,TUMB,286,1,0,1,Emergency Oxygen Off/On", "LIGHTS_WARNING(47),3077,PNT_282,LEV,282,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night",
-        "LIGHTS_WARNING(47),3037,PNT_282,BTN,372,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "CONTROL_SYSTEM(7),3276,PNT_FF,BTN,654,1,0,1,Force Feedback On/Off", "WEAPON_CONTROL(42),3169,PNT_183,TUMB,183,-1,0,1,Pylon 1-2 Power On/Off", "WEAPON_CONTROL(42),3169,PNT_183,TUMB,183,1,0,1,Pylon 1-2 Power On/Off", "WEAPON_CONTROL(42),3196,PNT_386,BTN,386,1,0,1,Drop Center Fuel Tank", "SOD(39),3091,PNT_199,BTN,199,1,0,1,SOD Identify", "RSBN(25),3062,PNT_367,TUMB,367,-1,0,1,RSBN Bearing", "RSBN(25),3062,PNT_367,TUMB,367,1,0,1,RSBN Bearing", "LIGHTS(46),3231,PNT_152,LEV,612,0,0,1,Cockpit Texts Back-light", "SPS_CONTROL(57),3217,PNT_396,TUMB,396,-1,0,1,Continuous / Impulse", "SPS_CONTROL(57),3217,PNT_396,TUMB,396,1,0,1,Continuous / Impulse", "AIRBRAKE(12),3116,PNT_316,TUMB,316,-1,0,1,Airbrake - Out/In", "AIRBRAKE(12),3116,PNT_316,TUMB,316,1,0,1,Airbrake - Out/In", "FIRE_EXTINGUISHER(53),3026,PNT_324,TUMB,324,-1,0,1,Fire Extinguisher Cover", "FIRE_EXTINGUISHER(53),3026,PNT_324,TUMB,324,1,0,1,Fire Extinguisher Cover", "RADAR(40),3100,PNT_332,BTN,332,1,0,1,Radar Interferes - Passive", "LIGHTS_WARNING(47),3076,PNT_273,LEV,273,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night", "LIGHTS_WARNING(47),3036,PNT_273,BTN,371,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "GEARS(14),3120,PNT_326,TUMB,326,-1,0,1,Gear Handle Fixator", "GEARS(14),3120,PNT_326,TUMB,326,1,0,1,Gear Handle Fixator", "ARK(24),3050,PNT_219,TUMB,213,0,0.7,0.7,ARK 7", "ENGINE(6),3023,PNT_300,TUMB,300,-1,0,1,Afterburner/Maximum Off/On", "ENGINE(6),3023,PNT_300,TUMB,300,1,0,1,Afterburner/Maximum Off/On", "FLAPS(15),3127,PNT_314,BTN,314,1,0,1,Flaps Reset buttons", "UNCLASSIFIED(51),3273,PNT_448,LEV,650,0.2,,,Harness Loose/Tight", "WEAPON_CONTROL(42),3183,PNT_230,TUMB,230,-1,0,1,Weapon Mode - Air/Ground", "WEAPON_CONTROL(42),3183,PNT_230,TUMB,230,1,0,1,Weapon Mode - Air/Ground", "CHUTE(16),3129,PNT_304,TUMB,304,-1,0,1,Drop Drag Chute Cover", "CHUTE(16),3129,PNT_304,TUMB,304,1,0,1,Drop Drag Chute Cover", "ASP(41),3666,PNT_251,LEV,251,0,0,1,Fix Net light control", "RSBN(25),3056,PNT_340,TUMB,340,-1,0,1,RSBN / ARK", "RSBN(25),3056,PNT_340,TUMB,340,1,0,1,RSBN / ARK", "AC_BUS(2),3005,PNT_153,TUMB,153,-1,0,1,PO-750 Inverter #1 On/Off", "AC_BUS(2),3005,PNT_153,TUMB,153,1,0,1,PO-750 Inverter #1 On/Off", "ARK(24),3048,PNT_198,LEV,198,0,0,1,ARK Sound", "SRZO(38),3087,PNT_188,TUMB,188,-1,0,1,SRZO IFF Coder/Decoder On/Off", "SRZO(38),3087,PNT_188,TUMB,188,1,0,1,SRZO IFF Coder/Decoder On/Off", "LIGHTS_WARNING(47),3078,PNT_283,LEV,283,0.5,0,1,Check Warning Lights - Set Warning Light Day/Night", "LIGHTS_WARNING(47),3038,PNT_283,BTN,373,1,0,1,Check Warning Lights - Set Warning Light Day/Night", "WEAPON_CONTROL(42),3187,PNT_234,BTN,234,1,0,1,Activate Gun Loading Pyro - 3", "RADIO(22),3041,PNT_173,TUMB,173,-1,0,1,Radio System On/Off", "RADIO(22),3041,PNT_173,TUMB,173,1,0,1,Radio System On/Off", "RADAR(40),3254,PNT_450,TUMB,632,-1,0,1,Radar emission - Cover", "RADAR(40),3254,PNT_450,TUMB,632,1,0,1,Radar emission - Cover", "SRZO(38),3210,PNT_190,TUMB,190,-1,0,1,Emergency Transmitter Cover", "SRZO(38),3210,PNT_190,TUMB,190,1,0,1,Emergency Transmitter Cover", "ASP(41),3159,PNT_244,TUMB,244,-1,0,1,ASP Mode - Giro/Missile", "ASP(41),3159,PNT_244,TUMB,244,1,0,1,ASP Mode - Giro/Missile", "RADIO(22),3044,PNT_210,LEV,210,0,0,1,Radio Volume", "AC_BUS(2),3006,PNT_154,TUMB,154,-1,0,1,PO-750 Inverter #2 On/Off", "AC_BUS(2),3006,PNT_154,TUMB,154,1,0,1,PO-750 Inverter #2 On/Off", "ASP(41),3160,PNT_249,TUMB,249,-1,0,1,Pipper On/Off", "ASP(41),3160,PNT_249,TUMB,249,1,0,1,Pipper On/Off", "CANOPY(43),3152,PNT_375,BTN,375,1,0,1,Canopy Open", "PITOT_TUBES(27),3020,PNT_279,TUMB,279,-1,0,1,Pitot tube/Periscope/Clock Heat", "PITOT_TUBES(27),3020,PNT_279,TUMB,279,1,0,1,Pitot tube/Periscope/Clock Heat", "ENGINE(6),3024,PNT_320,TUMB,320,-1,0,1,Emergency Afterburner Off/On", "ENGINE(6),3024,PNT_320,TUMB,320,1,0,1,Emergency Afterburner Off/On", "SOD(39),3092,PNT_201,TUMB,201,-0.5,0,1,SOD Wave Selector 3/1/2", "SOD(39),3092,PNT_201,TUMB,201,0.5,0,1,SOD Wave Selector 3/1/2", "GEARS(14),3122,PNT_223,LEV,223,0.2,0,1,Main Gears Emergency Release Handle", "ARK(24),3053,PNT_254,TUMB,254,-1,0,1,Marker Far/Near", "ARK(24),3053,PNT_254,TUMB,254,1,0,1,Marker Far/Near", "ASP(41),3158,PNT_243,TUMB,243,-1,0,1,ASP Mode - Missiles-Rockets/Gun", "ASP(41),3158,PNT_243,TUMB,243,1,0,1,ASP Mode - Missiles-Rockets/Gun", "FUEL_PUMPS(4),3012,PNT_161,TUMB,161,-1,0,1,Drain Fuel Tank, Fuel Pump", "FUEL_PUMPS(4),3012,PNT_161,TUMB,161,1,0,1,Drain Fuel Tank, Fuel Pump", "RADAR(40),3096,PNT_207,TUMB,207,-1,0,1,Locked Beam On/Off", "RADAR(40),3096,PNT_207,TUMB,207,1,0,1,Locked Beam On/Off", "DC_BUS(1),3003,PNT_166,TUMB,166,-1,0,1,DC Generator On/Off", "DC_BUS(1),3003,PNT_166,TUMB,166,1,0,1,DC Generator On/Off", "CONTROL_SYSTEM(7),3246,PNT_STICK_DOWN,BTN,629,1,0,1,Stick Down", "UNCLASSIFIED(51),3262,PNT_441,BTN,640,1,0,1,BU-45 Buster System Separation", "SOPLO(18),3136,PNT_291,TUMB,291,-1,0,1,Engine Nozzle 2 Position Emergency Control", "SOPLO(18),3136,PNT_291,TUMB,291,1,0,1,Engine Nozzle 2 Position Emergency Control", "WEAPON_CONTROL(42),3172,PNT_187,TUMB,187,-1,0,1,Guncam On/Off", "WEAPON_CONTROL(42),3172,PNT_187,TUMB,187,1,0,1,Guncam On/Off", "SPS_CONTROL(57),3220,PNT_399,TUMB,399,-0.5,0,1,Off / Parallel / Full", "SPS_CONTROL(57),3220,PNT_399,TUMB,399,0.5,0,1,Off / Parallel / Full", "CHUTE(16),3128,PNT_298,BTN,298,1,0,1,Release Drag Chute", "ARK(24),3050,PNT_217,TUMB,213,0,0.5,0.5,ARK 5", "WEAPON_CONTROL(42),3174,PNT_278,TUMB,278,-1,0,1,Tactical Drop", "WEAPON_CONTROL(42),3174,PNT_278,TUMB,278,1,0,1,Tactical Drop", "ALTIMETER(32),3073,PNT_262,LEV,262,0,-1,,Altimeter pressure knob", "SAU(8),3072,PNT_348,BTN,348,1,0,1,SAU Reset/Off", "WEAPON_CONTROL(42),3167,PNT_181,TUMB,181,-1,0,1,Missiles - Rockets Heat On/Off", "WEAPON_CONTROL(42),3167,PNT_181,TUMB,181,1,0,1,Missiles - Rockets Heat On/Off", "UNCLASSIFIED(51),3264,PNT_150,BTN,641,1,0,1,SOD Control PBU-2", "CANOPY(43),3150,PNT_328,TUMB,328,-1,0,1,Hermetize Canopy", "CANOPY(43),3150,PNT_328,TUMB,328,1,0,1,Hermetize Canopy", "SAU(8),3068,PNT_377,BTN,377,1,0,1,SAU - Recovery", "FIRE_EXTINGUISHER(53),3025,PNT_303,TUMB,303,-1,0,1,Fire Extinguisher Off/On", "FIRE_EXTINGUISHER(53),3025,PNT_303,TUMB,303,1,0,1,Fire Extinguisher Off/On", "GYRO_DEVICES(21),3008,PNT_162,TUMB,162,-1,0,1,Giro, NPP, SAU, RLS Signal, KPP Power On/Off", "GYRO_DEVICES(21),3008,PNT_162,TUMB,162,1,0,1,Giro, NPP, SAU, RLS Signal, KPP Power On/Off", "RADAR(40),3105,PNT_337,BTN,337,1,0,1,Radar Interferes - Reset", "WEAPON_CONTROL(42),3193,PNT_382,BTN,382,1,0,1,Release Weapon", "WEAPON_CONTROL(42),3188,PNT_235,TUMB,235,-0.1,0,1,Weapon Selector", "WEAPON_CONTROL(42),3188,PNT_235,TUMB,235,0.1,0,1,Weapon Selector", "SRZO(38),3211,PNT_191,TUMB,191,-1,0,1,Emergency Transmitter On/Off", "SRZO(38),3211,PNT_191,TUMB,191,1,0,1,Emergency Transmitter On/Off", "RADAR(40),3095,PNT_206,TUMB,206,-0.5,0,1,Low Altitude Off/Comp/On", "RADAR(40),3095,PNT_206,TUMB,206,0.5,0,1,Low Altitude Off/Comp/On", "FLAPS(15),3124,PNT_311,TUMB,311,-1,0,1,Flaps Neutral", "FLAPS(15),3124,PNT_311,TUMB,311,1,0,1,Flaps Neutral", "HELMET_VISOR(45),3205,PNT_306,TUMB,306,-1,0,1,Helmet Heat - Manual/Auto", "HELMET_VISOR(45),3205,PNT_306,TUMB,306,1,0,1,Helmet Heat - Manual/Auto", "WEAPON_CONTROL(42),3171,PNT_185,TUMB,185,-1,0,1,GS-23 Gun On/Off", "WEAPON_CONTROL(42),3171,PNT_185,TUMB,185,1,0,1,GS-23 Gun On/Off", "WEAPON_CONTROL(42),3168,PNT_182,TUMB,182,-1,0,1,Missiles - Rockets Launch On/Off", "WEAPON_CONTROL(42),3168,PNT_182,TUMB,182,1,0,1,Missiles - Rockets Launch On/Off", "TRIMER(9),3131,PNT_172,TUMB,172,-1,0,1,Trimmer On/Off", "TRIMER(9),3131,PNT_172,TUMB,172,1,0,1,Trimmer On/Off"],
-    "Mi-8MTV2": ["ELEC_INTERFACE(1),3102,PTR-RAZS-TMB-WIPER-L,TUMB,661,-1,0,1,CB Wiper Left, ON/OFF", "ELEC_INTERFACE(1),3102,PTR-RAZS-TMB-WIPER-L,TUMB,661,1,0,1,CB Wiper Left, ON/OFF", "SPU_7(36),3002,PTR-LAZS-LVR-AUDIT,LEV,548,0,0,1,Listening Volume Knob", "SPUU_52(8),3004,PTR-APP-TMB-RT,TUMB,129,1,0,1,SPUU-52 Test Switch, P/OFF/t)", "SPUU_52(8),3003,PTR-APP-TMB-RT,BTN,129,-1,-1,0,SPUU-52 Test Switch, P/OFF/t)", "ELEC_INTERFACE(1),3041,PTR-LAZS-TMB-GUOUTL-622L,TUMB,600,-1,0,1,CB GUV: Inner Left 622 Left, ON/OFF", "ELEC_INTERFACE(1),3041,PTR-LAZS-TMB-GUOUTL-622L,TUMB,600,1,0,1,CB GUV: Inner Left 622 Left, ON/OFF", "ELEC_INTERFACE(1),3009,PTR-RSPE-TMB-TESTEQU,TUMB,503,-1,0,1,Equipment Test Switch, ON/OFF", "ELEC_INTERFACE(1),3009,PTR-RSPE-TMB-TESTEQU,TUMB,503,1,0,1,Equipment Test Switch, ON/OFF", "CORRECTION_INTERRUPT(32),3001,PTR-LES-TMB-VK53,TUMB,336,-1,0,1,VK-53 Power Switch, ON/OFF", "CORRECTION_INTERRUPT(32),3001,PTR-LES-TMB-VK53,TUMB,336,1,0,1,VK-53 Power Switch, ON/OFF", "WEAPON_SYS(12),3044,PTR-LPE-TMB-PYRO-L,TUMB,350,0.1,0,0.3,Left PYROCARTRIDGE Switch, I/II/III", "WEAPON_SYS(12),3044,PTR-LPE-TMB-PYRO-L,TUMB,350,-0.1,0,0.3,Left PYROCARTRIDGE Switch, I/II/III", "ELEC_INTERFACE(1),3094,PTR-RAZS-TMB-LAMPTEST,TUMB,653,-1,0,1,CB Check Lamps/Flasher, ON/OFF", "ELEC_INTERFACE(1),3094,PTR-RAZS-TMB-LAMPTEST,TUMB,653,1,0,1,CB Check Lamps/Flasher, ON/OFF", "ENGINE_INTERFACE(3),3051,PTR-APP-TMB-ST-R,BTN,171,1,0,1,Right Engine FT Check Switch, ST1/WORK/ST2", "ENGINE_INTERFACE(3),3051,PTR-APP-TMB-ST-R,BTN,171,-1,-1,0,Right Engine FT Check Switch, ST1/WORK/ST2", "AGB_3K_RIGHT(7),3004,PTR-RES-TMB-AG,TUMB,487,-1,0,1,Right Attitude Indicator Power Switch, ON/OFF", "AGB_3K_RIGHT(7),3004,PTR-RES-TMB-AG,TUMB,487,1,0,1,Right Attitude Indicator Power Switch, ON/OFF", "JADRO_1A(37),3013,PTR-RES-TMB-RS,TUMB,484,-1,0,1,Jadro 1A, Power Switch, ON/OFF", "JADRO_1A(37),3013,PTR-RES-TMB-RS,TUMB,484,1,0,1,Jadro 1A, Power Switch, ON/OFF", "ENGINE_INTERFACE(3),3072,PTR-STKSEC-ARM-R,LEV,0,0,-1,1,Right Engine Throttle", "SYS_CONTROLLER(21),3005,PTR-RSPE-TMB-WINK,TUMB,523,-1,0,1,Flasher Switch, ON/OFF", "SYS_CONTROLLER(21),3005,PTR-RSPE-TMB-WINK,TUMB,523,1,0,1,Flasher Switch, ON/OFF", "AUTOPILOT(16),3030,PTR-AUTOPILOT-OFF-R,BTN,226,1,0,1,Autopilot Off Right Button", "ELEC_INTERFACE(1),3101,PTR-RAZS-TMB-POSGLS,TUMB,660,-1,0,1,CB Defrost System: Glass, ON/OFF", "ELEC_INTERFACE(1),3101,PTR-RAZS-TMB-POSGLS,TUMB,660,1,0,1,CB Defrost System: Glass, ON/OFF", "ELEC_INTERFACE(1),3080,PTR-RAZS-TMB-PPSQUE1-L,TUMB,639,-1,0,1,CB Fire Protection System: 1 Queue Left, ON/OFF", "ELEC_INTERFACE(1),3080,PTR-RAZS-TMB-PPSQUE1-L,TUMB,639,1,0,1,CB Fire Protection System: 1 Queue Left, ON/OFF", "ENGINE_INTERFACE(3),3034,PTR-LPE-TMB-GLASS,TUMB,357,-1,0,1,Glass Heater Switch, MANUAL/AUTO", "ENGINE_INTERFACE(3),3034,PTR-LPE-TMB-GLASS,TUMB,357,1,0,1,Glass Heater Switch, MANUAL/AUTO", "CPT_MECH(17),3026,PTR-RES-TMB-GLSCLN-RESET,TUMB,478,0.1,0.1,0.1,Right Windscreen Wiper Control Switch, START", "WEAPON_SYS(12),3050,PTR-ADDPBV-CVR-EMRGJET,TUMB,708,-1,0,1,Emergency Bomb Release Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3050,PTR-ADDPBV-CVR-EMRGJET,TUMB,708,1,0,1,Emergency Bomb Release Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3005,PTR-LAZS-TMB-EMRGJET,BTN,572,1,0,1,Emergency Release Switch", "ELEC_INTERFACE(1),3040,PTR-LAZS-TMB-GUOUT-800R,TUMB,599,-1,0,1,CB GUV: Outer 800 Right, ON/OFF", "ELEC_INTERFACE(1),3040,PTR-LAZS-TMB-GUOUT-800R,TUMB,599,1,0,1,CB GUV: Outer 800 Right, ON/OFF", "WEAPON_SYS(12),3006,PTR-LPE-TMB-GUV,TUMB,345,1,-1,1,CUTOFF Switch, ON/OFF", "WEAPON_SYS(12),3006,PTR-LPE-TMB-GUV,TUMB,345,-1,-1,1,CUTOFF Switch, ON/OFF", "ELEC_INTERFACE(1),3088,PTR-RAZS-TMB-HLGT-DIR-L,TUMB,647,-1,0,1,CB Headlights: Left: Control, ON/OFF", "ELEC_INTERFACE(1),3088,PTR-RAZS-TMB-HLGT-DIR-L,TUMB,647,1,0,1,CB Headlights: Left: Control, ON/OFF", "ELEC_INTERFACE(1),3004,PTR-RSPE-TMB-AERF,TUMB,502,-1,0,1,DC Ground Power Switch, ON/OFF", "ELEC_INTERFACE(1),3004,PTR-RSPE-TMB-AERF,TUMB,502,1,0,1,DC Ground Power Switch, ON/OFF", "WEAPON_SYS(12),3082,PTR-RS-L,BTN,186,1,0,1,Left Fire RS Button", "ELEC_INTERFACE(1),3075,PTR-RAZS-TMB-TSPMP-L,TUMB,634,-1,0,1,CB Fuel System: Left Tank Pump, ON/OFF", "ELEC_INTERFACE(1),3075,PTR-RAZS-TMB-TSPMP-L,TUMB,634,1,0,1,CB Fuel System: Left Tank Pump, ON/OFF", "AUTOPILOT(16),3019,PTR-APP-BTN-DIRON,LEV,868,0,0,0.2,Autopilot Heading ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "AUTOPILOT(16),3003,PTR-APP-BTN-DIRON,BTN,134,1,0,1,Autopilot Heading ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "ENGINE_INTERFACE(3),3064,PTR-STKSGR-TMB-RPM-RIGHT,BTN,867,1,0,1,Readjust Free Turbine RPM Switch, MORE/OFF/LESS", "ENGINE_INTERFACE(3),3064,PTR-STKSGR-TMB-RPM-RIGHT,BTN,867,-1,-1,0,Readjust Free Turbine RPM Switch, MORE/OFF/LESS", "HEATER_KO50(53),3004,PTR-RPE-TMB-KO50FILL,TUMB,466,1,-1,1,KO-50 Heater Regime Switch, FILLING/FULL/MEDIUM", "HEATER_KO50(53),3004,PTR-RPE-TMB-KO50FILL,TUMB,466,-1,-1,1,KO-50 Heater Regime Switch, FILLING/FULL/MEDIUM", "WEAPON_SYS(12),3002,PTR-ADDPBV-TMB-MAINOFF,TUMB,717,-1,0,1,Main Bombs Switch, ON/OFF", "WEAPON_SYS(12),3002,PTR-ADDPBV-TMB-MAINOFF,TUMB,717,1,0,1,Main Bombs Switch, ON/OFF", "WEAPON_SYS(12),3012,PTR-ADDPBV-TMB-WARM,TUMB,720,-1,0,1,ESBR Heating Switch, ON/OFF", "WEAPON_SYS(12),3012,PTR-ADDPBV-TMB-WARM,TUMB,720,1,0,1,ESBR Heating Switch, ON/OFF", "JADRO_1A(37),3007,PTR-ADDSECPLT-LVR-VOLUM,LEV,743,0,0,1,Jadro 1A, Volume Knob", "ELEC_INTERFACE(1),3071,PTR-RAZS-TMB-TSCOCK-L,TUMB,630,-1,0,1,CB Fuel System: Left Valve, ON/OFF", "ELEC_INTERFACE(1),3071,PTR-RAZS-TMB-TSCOCK-L,TUMB,630,1,0,1,CB Fuel System: Left Valve, ON/OFF", "WEAPON_SYS(12),3021,PTR-LPE-TMB-SHOOT2,TUMB,343,1,-1,1,1-2-5-6/AUTO/3-4 Switch", "WEAPON_SYS(12),3021,PTR-LPE-TMB-SHOOT2,TUMB,343,-1,-1,1,1-2-5-6/AUTO/3-4 Switch", "ELEC_INTERFACE(1),3070,PTR-RAZS-TMB-TSCOCK-ON,TUMB,629,-1,0,1,CB Fuel System: Bypass Valve, ON/OFF", "ELEC_INTERFACE(1),3070,PTR-RAZS-TMB-TSCOCK-ON,TUMB,629,1,0,1,CB Fuel System: Bypass Valve, ON/OFF", "WEAPON_SYS(12),3027,PTR-SAFE-WEAPON,TUMB,921,-1,0,1,Weapon Safe/Armed Switch, ON/OFF", "WEAPON_SYS(12),3027,PTR-SAFE-WEAPON,TUMB,921,1,0,1,Weapon Safe/Armed Switch, ON/OFF", "ELEC_INTERFACE(1),3058,PTR-SW-LOCKER-BASE,TUMB,617,-1,0,1,CB Lock Opening Control Main, ON/OFF", "ELEC_INTERFACE(1),3058,PTR-SW-LOCKER-BASE,TUMB,617,1,0,1,CB Lock Opening Control Main, ON/OFF", "ENGINE_INTERFACE(3),3063,PTR-STKSGR-TMB-RPM-LEFT,BTN,202,1,0,1,Readjust Free Turbine RPM Switch, MORE/OFF/LESS", "ENGINE_INTERFACE(3),3063,PTR-STKSGR-TMB-RPM-LEFT,BTN,202,-1,-1,0,Readjust Free Turbine RPM Switch, MORE/OFF/LESS", "DISS_15(15),3006,PTR-DISS-BTN-N,BTN,809,1,0,1,Decrease Path KM Button", "R_828(39),3003,PTR-ADDSECPLT-BTN-ASU,BTN,738,1,0,1,R-828, Radio Tuner Button", "FUELSYS_INTERFACE(2),3011,PTR-CPE-CVR-PUMP-RING,TUMB,430,-1,0,1,Crossfeed Switch Cover, OPEN/CLOSE", "FUELSYS_INTERFACE(2),3011,PTR-CPE-CVR-PUMP-RING,TUMB,430,1,0,1,Crossfeed Switch Cover, OPEN/CLOSE", "FIRE_EXTING_INTERFACE(19),3010,PTR-CPE-TMB-CONTR-FIRE,TUMB,399,-1,0,1,Fire Detector Test Switch", "FIRE_EXTING_INTERFACE(19),3010,PTR-CPE-TMB-CONTR-FIRE,TUMB,399,1,0,1,Fire Detector Test Switch", "ELEC_INTERFACE(1),3073,PTR-RAZS-TMB-TSCOUNT,TUMB,632,-1,0,1,CB Fuel System: Fuelmeter, ON/OFF", "ELEC_INTERFACE(1),3073,PTR-RAZS-TMB-TSCOUNT,TUMB,632,1,0,1,CB Fuel System: Fuelmeter, ON/OFF", "DISS_15(15),3007,PTR-DISS-BTN-V,BTN,810,1,0,1,Increase Path KM Button", "ELEC_INTERFACE(1),3078,PTR-RAZS-TMB-SPPU52,TUMB,637,-1,0,1,CB SPUU-52, ON/OFF", "ELEC_INTERFACE(1),3078,PTR-RAZS-TMB-SPPU52,TUMB,637,1,0,1,CB SPUU-52, ON/OFF", "ENGINE_INTERFACE(3),3030,PTR-LPE-TMB-MANAUT,TUMB,353,-1,0,1,Defrost Mode Switch, AUTO/MANUAL", "ENGINE_INTERFACE(3),3030,PTR-LPE-TMB-MANAUT,TUMB,353,1,0,1,Defrost Mode Switch, AUTO/MANUAL", "RADAR_ALTIMETER(18),3002,PTR-ALTR-LVR-TEST,BTN,32,1,0,1,Radio Altimeter Test Button - Push to test", "ELEC_INTERFACE(1),3038,PTR-LAZS-TMB-311,TUMB,597,-1,0,1,CB 311, ON/OFF", "ELEC_INTERFACE(1),3038,PTR-LAZS-TMB-311,TUMB,597,1,0,1,CB 311, ON/OFF", "ENGINE_INTERFACE(3),3032,PTR-LPE-TMB-PZU-L,TUMB,355,-1,0,1,Left Engine Heater Switch, ON/OFF", "ENGINE_INTERFACE(3),3032,PTR-LPE-TMB-PZU-L,TUMB,355,1,0,1,Left Engine Heater Switch, ON/OFF", "FUELSYS_INTERFACE(2),3014,PTR-CPE-TMB-PUMP-CONTR,TUMB,437,0.5,0,1,Refueling Control Switch, REFUEL/OFF/CHECK", "FUELSYS_INTERFACE(2),3014,PTR-CPE-TMB-PUMP-CONTR,TUMB,437,-0.5,0,1,Refueling Control Switch, REFUEL/OFF/CHECK", "ELEC_INTERFACE(1),3077,PTR-RAZS-TMB-T819,TUMB,636,-1,0,1,CB T-819, ON/OFF", "ELEC_INTERFACE(1),3077,PTR-RAZS-TMB-T819,TUMB,636,1,0,1,CB T-819, ON/OFF", "ENGINE_INTERFACE(3),3067,PKT-TROTTLE_L,LEV,0,0,-1,1,Collective (LMB press, hold and move) / Throttle (RMB press, hold and move)", "ENGINE_INTERFACE(3),3069,PKT-TROTTLE_L,LEV,0,0,-1,1,Collective (LMB press, hold and move) / Throttle (RMB press, hold and move)", "FIRE_EXTING_INTERFACE(19),3001,PTR-CPE-BTN-QUE1-1,BTN,389,1,0,1,Main Discharge Left Engine Button", "FUELSYS_INTERFACE(2),3002,PTR-CPE-TMB-PUMP-R,TUMB,429,-1,0,1,Right Shutoff Valve Switch, ON/OFF", "FUELSYS_INTERFACE(2),3002,PTR-CPE-TMB-PUMP-R,TUMB,429,1,0,1,Right Shutoff Valve Switch, ON/OFF", "ENGINE_INTERFACE(3),3036,PTR-LPE-BTN-RIOCONTR,BTN,359,1,0,1,Ice Detector Heater Test Button - Push to test", "ELEC_INTERFACE(1),3061,PTR-RAZS-TMB-APMAIN,TUMB,620,-1,0,1,CB Autopilot: Main, ON/OFF", "ELEC_INTERFACE(1),3061,PTR-RAZS-TMB-APMAIN,TUMB,620,1,0,1,CB Autopilot: Main, ON/OFF", "FIRE_EXTING_INTERFACE(19),3009,PTR-CPE-BTN-FIRE-OFF,BTN,397,1,0,1,Turn Off Fire Signal Button", "JADRO_1A(37),3003,PTR-ADDSECPLT-LVR-DIG3,TUMB,746,0.1,0,1,Jadro 1A, Frequency Selector, 100kHz", "JADRO_1A(37),3003,PTR-ADDSECPLT-LVR-DIG3,TUMB,746,-0.1,0,1,Jadro 1A, Frequency Selector, 100kHz", "SPUU_52(8),3001,PTR-APP-BTN-OFF,TUMB,127,-1,0,1,SPUU-52 Control Engage Button", "SPUU_52(8),3001,PTR-APP-BTN-OFF,TUMB,127,1,0,1,SPUU-52 Control Engage Button", "DISS_15(15),3003,PTR-DISS-BTN-ON,BTN,819,1,0,1,Turn On Coordinates Calculator Button",
-        "ELEC_INTERFACE(1),3083,PTR-RAZS-TMB-PPSQUE2-R,TUMB,642,-1,0,1,CB Fire Protection System: 2 Queue Right, ON/OFF", "ELEC_INTERFACE(1),3083,PTR-RAZS-TMB-PPSQUE2-R,TUMB,642,1,0,1,CB Fire Protection System: 2 Queue Right, ON/OFF", "ELEC_INTERFACE(1),3013,PTR-EEP-TMB-PT,TUMB,542,1,-1,1,36V Inverter Switch, MANUAL/OFF/AUTO", "ELEC_INTERFACE(1),3013,PTR-EEP-TMB-PT,TUMB,542,-1,-1,1,36V Inverter Switch, MANUAL/OFF/AUTO", "BAR_ALTIMETER_L(26),3001,PTR-ALTB-LVR-SET,LEV,18,1,0,1,Baro Pressure QFE Knob", "ENGINE_INTERFACE(3),3006,PTR-CPE-BTN-ENGSTART-OFF,BTN,421,1,0,1,Abort Start Engine Button - Push to abort start", "ELEC_INTERFACE(1),3087,PTR-RAZS-TMB-RADRNTG,TUMB,646,-1,0,1,CB Radio: Radio Meter, ON/OFF", "ELEC_INTERFACE(1),3087,PTR-RAZS-TMB-RADRNTG,TUMB,646,1,0,1,CB Radio: Radio Meter, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3002,PTR-STKSG-CVR-TACTJET,TUMB,199,-1,0,1,Tactical Cargo Release Button Cover, OPEN/CLOSE", "EXT_CARGO_EQUIPMENT(51),3002,PTR-STKSG-CVR-TACTJET,TUMB,199,1,0,1,Tactical Cargo Release Button Cover, OPEN/CLOSE", "ENGINE_INTERFACE(3),3037,PTR-LPE-LVR-FEEDMODE,TUMB,372,0.1,0,0.9,Defrost System Amperemeter Selector Switch", "ENGINE_INTERFACE(3),3037,PTR-LPE-LVR-FEEDMODE,TUMB,372,-0.1,0,0.9,Defrost System Amperemeter Selector Switch", "ELEC_INTERFACE(1),3105,PTR-RAZS-TMB-KO50,TUMB,664,-1,0,1,CB Heater KO-50, ON/OFF", "ELEC_INTERFACE(1),3105,PTR-RAZS-TMB-KO50,TUMB,664,1,0,1,CB Heater KO-50, ON/OFF", "ELEC_INTERFACE(1),3074,PTR-RAZS-TMB-TSPMP-C,TUMB,633,-1,0,1,CB Fuel System: Center Tank Pump, ON/OFF", "ELEC_INTERFACE(1),3074,PTR-RAZS-TMB-TSPMP-C,TUMB,633,1,0,1,CB Fuel System: Center Tank Pump, ON/OFF", "DISS_15(15),3008,PTR-DISS-BTN-TOLE,BTN,803,1,0,1,Decrease Deviation KM Button", "DISS_15(15),3009,PTR-DISS-BTN-TORI,BTN,804,1,0,1,Increase Deviation KM Button", "SPU_7(36),3006,PTR-RES-TMB-LARING,TUMB,480,-1,0,1,Laryngophone Switch, ON/OFF", "SPU_7(36),3006,PTR-RES-TMB-LARING,TUMB,480,1,0,1,Laryngophone Switch, ON/OFF", "ELEC_INTERFACE(1),3103,PTR-RAZS-TMB-WIPER-R,TUMB,662,-1,0,1,CB Wiper Right, ON/OFF", "ELEC_INTERFACE(1),3103,PTR-RAZS-TMB-WIPER-R,TUMB,662,1,0,1,CB Wiper Right, ON/OFF", "DISS_15(15),3004,PTR-DISS-BTN-MINUS,BTN,815,1,0,1,Decrease Map Angle Button", "ELEC_INTERFACE(1),3090,PTR-RAZS-TMB-HLGT-DIR-R,TUMB,649,-1,0,1,CB Headlights: Right: Control, ON/OFF", "ELEC_INTERFACE(1),3090,PTR-RAZS-TMB-HLGT-DIR-R,TUMB,649,1,0,1,CB Headlights: Right: Control, ON/OFF", "ENGINE_INTERFACE(3),3007,PTR-CPE-BTN-TURBOSTART-OFF,BTN,415,1,0,1,APU Stop Button - Push to stop APU", "FUELSYS_INTERFACE(2),3004,PTR-CPE-TMB-PUMP-RING,TUMB,431,-1,0,1,Crossfeed Switch, ON/OFF", "FUELSYS_INTERFACE(2),3004,PTR-CPE-TMB-PUMP-RING,TUMB,431,1,0,1,Crossfeed Switch, ON/OFF", "WEAPON_SYS(12),3028,PTR-ADDESBR-LVR-ONOFF,TUMB,731,-1,0,1,ESBR Switch, ON/OFF", "WEAPON_SYS(12),3028,PTR-ADDESBR-LVR-ONOFF,TUMB,731,1,0,1,ESBR Switch, ON/OFF", "ENGINE_INTERFACE(3),3053,PTR-APP-TMB-CHR-R,TUMB,172,-1,0,1,Right Engine ER Switch, ON/OFF", "ENGINE_INTERFACE(3),3053,PTR-APP-TMB-CHR-R,TUMB,172,1,0,1,Right Engine ER Switch, ON/OFF", "VARIOMETER_R(31),3001,PTR-VARIO-LVR-SET-R,LEV,96,1,0,1,Variometer Adjustment Knob", "ELEC_INTERFACE(1),3091,PTR-RAZS-TMB-HLGT-ON-R,TUMB,650,-1,0,1,CB Headlights: Right: Light, ON/OFF", "ELEC_INTERFACE(1),3091,PTR-RAZS-TMB-HLGT-ON-R,TUMB,650,1,0,1,CB Headlights: Right: Light, ON/OFF", "WEAPON_SYS(12),3031,PTR-LAZS-BTN-ENTER,BTN,574,1,0,1,PUS Arming Button - Push to arm", "ELEC_INTERFACE(1),3042,PTR-LAZS-TMB-GUOUTL-622R,TUMB,601,-1,0,1,CB GUV: Inner Left 622 Right, ON/OFF", "ELEC_INTERFACE(1),3042,PTR-LAZS-TMB-GUOUTL-622R,TUMB,601,1,0,1,CB GUV: Inner Left 622 Right, ON/OFF", "AGB_3K_LEFT(6),3003,PTR-AGB-LVR-SET,LEV,10,0,0,1,Left Attitude Indicator Zero Pitch Knob", "ELEC_INTERFACE(1),3063,PTR-RAZS-TMB-APELCT,TUMB,622,-1,0,1,CB Autopilot: Electric Clutches, ON/OFF", "ELEC_INTERFACE(1),3063,PTR-RAZS-TMB-APELCT,TUMB,622,1,0,1,CB Autopilot: Electric Clutches, ON/OFF", "ARC_UD(41),3003,PTR-RPE-TMB-ARKUKV,TUMB,454,-1,0,1,ARC-UD, Wave Switch, MW/DW", "ARC_UD(41),3003,PTR-RPE-TMB-ARKUKV,TUMB,454,1,0,1,ARC-UD, Wave Switch, MW/DW", "AGB_3K_LEFT(6),3004,PTR-LES-TMB-AG,TUMB,335,-1,0,1,Left Attitude Indicator Power Switch, ON/OFF", "AGB_3K_LEFT(6),3004,PTR-LES-TMB-AG,TUMB,335,1,0,1,Left Attitude Indicator Power Switch, ON/OFF", "AUTOPILOT(16),3023,PTR-APP-BTN-ALTOFF,LEV,872,0,0,0.2,Autopilot Altitude OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "AUTOPILOT(16),3004,PTR-APP-BTN-ALTOFF,BTN,145,1,0,1,Autopilot Altitude OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "FUELSYS_INTERFACE(2),3012,PTR-CPE-CVR-PUMP-PASS,TUMB,432,-1,0,1,Bypass Switch Cover, OPEN/CLOSE", "FUELSYS_INTERFACE(2),3012,PTR-CPE-CVR-PUMP-PASS,TUMB,432,1,0,1,Bypass Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3010,PTR-RSPE-LVR-V,LEV,498,0.5,0,1,Standby Generator Voltage Adjustment Rheostat", "WEAPON_SYS(12),3051,PTR-LAZS-CVR-EMRGEXP,TUMB,569,-1,0,1,Emergency Explode Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3051,PTR-LAZS-CVR-EMRGEXP,TUMB,569,1,0,1,Emergency Explode Switch Cover, OPEN/CLOSE", "GMK1A(14),3001,PTR-RES-TMB-GMK,TUMB,485,-1,0,1,GMC Power Switch, ON/OFF", "GMK1A(14),3001,PTR-RES-TMB-GMK,TUMB,485,1,0,1,GMC Power Switch, ON/OFF", "WEAPON_SYS(12),3007,PTR-ADDPBV-TMB-EMRGEXP,TUMB,707,-1,0,1,Emergency Explode Switch, ON/OFF", "WEAPON_SYS(12),3007,PTR-ADDPBV-TMB-EMRGEXP,TUMB,707,1,0,1,Emergency Explode Switch, ON/OFF", "IFF(57),3002,PTR-LSPE-TMB-RADIO-WRK,TUMB,301,-1,0,1,IFF Transponder Device Selector Switch, WORK/RESERVE", "IFF(57),3002,PTR-LSPE-TMB-RADIO-WRK,TUMB,301,1,0,1,IFF Transponder Device Selector Switch, WORK/RESERVE", "ELEC_INTERFACE(1),3066,PTR-RAZS-TMB-RADSPU,TUMB,625,-1,0,1,CB Radio: SPU (Intercom), ON/OFF", "ELEC_INTERFACE(1),3066,PTR-RAZS-TMB-RADSPU,TUMB,625,1,0,1,CB Radio: SPU (Intercom), ON/OFF", "GMK1A(14),3006,PTR-RPE-LVR-CRDLAT,LEV,474,0,0,0.728,GMC Latitude Selection Knob", "ENGINE_INTERFACE(3),3028,PTR-RSPE-TMB-PZUENG-L,TUMB,517,-1,0,1,Left Engine Dust Protection Switch, ON/OFF", "ENGINE_INTERFACE(3),3028,PTR-RSPE-TMB-PZUENG-L,TUMB,517,1,0,1,Left Engine Dust Protection Switch, ON/OFF", "GMK1A(14),3002,PTR-RPE-LVR-CRDNS,TUMB,470,-1,0,1,GMC Hemisphere Selection Switch, NORTH/SOUTH", "GMK1A(14),3002,PTR-RPE-LVR-CRDNS,TUMB,470,1,0,1,GMC Hemisphere Selection Switch, NORTH/SOUTH", "WEAPON_SYS(12),3043,PTR-LPE-LVR-SHELL,LEV,346,0,0,1,Burst Length Knob", "ENGINE_INTERFACE(3),3029,PTR-RSPE-TMB-PZUENG-R,TUMB,518,-1,0,1,Right Engine Dust Protection Switch, ON/OFF", "ENGINE_INTERFACE(3),3029,PTR-RSPE-TMB-PZUENG-R,TUMB,518,1,0,1,Right Engine Dust Protection Switch, ON/OFF", "DISS_15(15),3011,PTR-DISS-SELECTOR-KR,TUMB,797,-1,0,1,Test/Work Switch", "DISS_15(15),3011,PTR-DISS-SELECTOR-KR,TUMB,797,1,0,1,Test/Work Switch", "IFF(57),3004,PTR-LSPE-CVR-EMRG-ERASE,TUMB,296,-1,0,1,IFF Transponder Erase Button Cover, OPEN/CLOSE", "IFF(57),3004,PTR-LSPE-CVR-EMRG-ERASE,TUMB,296,1,0,1,IFF Transponder Erase Button Cover, OPEN/CLOSE", "NAVLIGHT_SYSTEM(9),3015,PTR-RSPE-TMB-BEAC,TUMB,516,-1,0,1,Strobe Light Switch, ON/OFF", "NAVLIGHT_SYSTEM(9),3015,PTR-RSPE-TMB-BEAC,TUMB,516,1,0,1,Strobe Light Switch, ON/OFF", "NAVLIGHT_SYSTEM(9),3017,PTR-LEFT-TAXI-L-SW,TUMB,836,-1,0,1,Taxi Light Switch, ON/OFF", "NAVLIGHT_SYSTEM(9),3017,PTR-LEFT-TAXI-L-SW,TUMB,836,1,0,1,Taxi Light Switch, ON/OFF", "SARPP12DM(55),3001,PTR-LSPE-TMB-CONTR-AUTMAN,TUMB,315,-1,0,1,SARPP-12 Mode Switch, MANUAL/AUTO", "SARPP12DM(55),3001,PTR-LSPE-TMB-CONTR-AUTMAN,TUMB,315,1,0,1,SARPP-12 Mode Switch, MANUAL/AUTO", "LIGHT_SYSTEM(46),3002,PTR-LES-TMB-PLF,TUMB,333,1,-1,1,Left Ceiling Light Switch, RED/OFF/WHITE", "LIGHT_SYSTEM(46),3002,PTR-LES-TMB-PLF,TUMB,333,-1,-1,1,Left Ceiling Light Switch, RED/OFF/WHITE", "LIGHT_SYSTEM(46),3003,PTR-RES-TMB-PLF,TUMB,489,1,-1,1,Right Ceiling Light Switch, RED/OFF/WHITE", "LIGHT_SYSTEM(46),3003,PTR-RES-TMB-PLF,TUMB,489,-1,-1,1,Right Ceiling Light Switch, RED/OFF/WHITE", "FIRE_EXTING_INTERFACE(19),3007,PTR-CPE-BTN-QUE2-3,BTN,395,1,0,1,Alternate Discharge KO-50 Button", "ELEC_INTERFACE(1),3008,PTR-RSPE-LVR-FEEDMODE,TUMB,494,0.1,0,0.7,DC Voltmeter Selector", "ELEC_INTERFACE(1),3008,PTR-RSPE-LVR-FEEDMODE,TUMB,494,-0.1,0,0.7,DC Voltmeter Selector", "LIGHT_SYSTEM(46),3004,PTR-RES-TMB-LGT,TUMB,479,-1,0,1,5.5V Lights Switch, ON/OFF", "LIGHT_SYSTEM(46),3004,PTR-RES-TMB-LGT,TUMB,479,1,0,1,5.5V Lights Switch, ON/OFF", "PKV(47),3005,PTR-PKV-DOUBLE,TUMB,856,-1,0,0.5,Sight Double", "PKV(47),3005,PTR-PKV-DOUBLE,TUMB,856,1,0,0.5,Sight Double", "CPT_MECH(17),3020,PTR-LES-TMB-VENT,TUMB,334,-1,0,1,Left Fan Switch, ON/OFF", "CPT_MECH(17),3020,PTR-LES-TMB-VENT,TUMB,334,1,0,1,Left Fan Switch, ON/OFF", "ELEC_INTERFACE(1),3067,PTR-RAZS-TMB-RADALT,TUMB,626,-1,0,1,CB Radio: Altimeter, ON/OFF", "ELEC_INTERFACE(1),3067,PTR-RAZS-TMB-RADALT,TUMB,626,1,0,1,CB Radio: Altimeter, ON/OFF", "R_828(39),3004,PTR-ADDSECPLT-TMB-PSH,TUMB,739,-1,0,1,R-828, Squelch Switch, ON/OFF", "R_828(39),3004,PTR-ADDSECPLT-TMB-PSH,TUMB,739,1,0,1,R-828, Squelch Switch, ON/OFF", "LIGHT_SYSTEM(46),3010,PTR-RSPE-LVR-REDGRP004,LEV,895,0,0,1,Central Red Lights Brightness Group 2 Rheostat", "ELEC_INTERFACE(1),3069,PTR-RAZS-TMB-RADRS,TUMB,628,-1,0,1,CB Radio: 6201, ON/OFF", "ELEC_INTERFACE(1),3069,PTR-RAZS-TMB-RADRS,TUMB,628,1,0,1,CB Radio: 6201, ON/OFF", "LIGHT_SYSTEM(46),3022,PTR-RSPE-TMB-DUTY,TUMB,511,-1,0,1,Cargo Cabin Duty Lights Switch, ON/OFF", "LIGHT_SYSTEM(46),3022,PTR-RSPE-TMB-DUTY,TUMB,511,1,0,1,Cargo Cabin Duty Lights Switch, ON/OFF", "ELEC_INTERFACE(1),3012,PTR-EEP-TMB-PO,TUMB,541,1,-1,1,115V Inverter Switch, MANUAL/OFF/AUTO", "ELEC_INTERFACE(1),3012,PTR-EEP-TMB-PO,TUMB,541,-1,-1,1,115V Inverter Switch, MANUAL/OFF/AUTO", "SPUU_52(8),3005,PTR-LES-TMB-SPPU52,TUMB,332,-1,0,1,SPUU-52 Power Switch, ON/OFF", "SPUU_52(8),3005,PTR-LES-TMB-SPPU52,TUMB,332,1,0,1,SPUU-52 Power Switch, ON/OFF", "LIGHT_SYSTEM(46),3023,PTR-RSPE-TMB-ALL,TUMB,512,-1,0,1,Cargo Cabin Common Lights Switch, ON/OFF", "LIGHT_SYSTEM(46),3023,PTR-RSPE-TMB-ALL,TUMB,512,1,0,1,Cargo Cabin Common Lights Switch, ON/OFF",
-        "ENGINE_INTERFACE(3),3021,PTR-LSPE-BTN-CONTR-IV500,BTN,310,1,0,1,Vibration Sensor Test Button - Push to test", "ELEC_INTERFACE(1),3096,PTR-SW-LIGHT-PRF4-RIGHT,TUMB,919,-1,0,1,CB PRF-4 Light Right, ON/OFF", "ELEC_INTERFACE(1),3096,PTR-SW-LIGHT-PRF4-RIGHT,TUMB,919,1,0,1,CB PRF-4 Light Right, ON/OFF", "ENGINE_INTERFACE(3),3023,PTR-LSPE-BTN-CONTR-GRND,BTN,311,1,0,1,Cold Temperature Sensor Test Button - Push to test", "SPU_7(36),3004,PTR-LAZS-TMB-RADSPU,TUMB,553,-1,0,1,Radio/ICS Switch", "SPU_7(36),3004,PTR-LAZS-TMB-RADSPU,TUMB,553,1,0,1,Radio/ICS Switch", "SPU_7(36),3007,PTR-LAZS-TMB-CIRC,TUMB,551,-1,0,1,Network 1/2 Switch (N/F)", "SPU_7(36),3007,PTR-LAZS-TMB-CIRC,TUMB,551,1,0,1,Network 1/2 Switch (N/F)", "SPU_7(36),3014,PTR-RAZS-BTN-CB002,BTN,846,1,0,1,Circular Call Button (N/F)", "SPU_7(36),3011,PTR-RAZS-LVR-MODES002,TUMB,842,0.1,0,0.5,Radio Source Selector Switch, R-863/JADRO-1A/R-828/NF/ARC-9/ARC-UD", "SPU_7(36),3011,PTR-RAZS-LVR-MODES002,TUMB,842,-0.1,0,0.5,Radio Source Selector Switch, R-863/JADRO-1A/R-828/NF/ARC-9/ARC-UD", "LIGHT_SYSTEM(46),3006,PTR-LSPE-LVR-REDGRP2,LEV,281,0,0,1,Left Red Lights Brightness Group 2 Rheostat", "ARC_UD(41),3007,PTR-RPE-BTN-ANTL,BTN,673,1,0,1,ARC-UD, Left Antenna Button", "R_863(38),3001,PTR-LPE-TMB-COMAND,TUMB,369,-1,0,1,R-863, Modulation Switch, FM/AM", "R_863(38),3001,PTR-LPE-TMB-COMAND,TUMB,369,1,0,1,R-863, Modulation Switch, FM/AM", "R_863(38),3003,PTR-LPE-LVR-CHANNEL,TUMB,370,-0.05,0,0.949768,R-863, Radio Channel Selector Knob", "R_863(38),3003,PTR-LPE-LVR-CHANNEL,TUMB,370,0.05,0,0.949768,R-863, Radio Channel Selector Knob", "ELEC_INTERFACE(1),3018,PTR-EEP-LVR-ADJV2,LEV,537,0.5,0,1,Generator 2 Voltage Adjustment Rheostat", "ENGINE_INTERFACE(3),3008,PTR-CPE-TMB-ENGSTART-LFTRGT,TUMB,422,1,-1,1,Engine Selector Switch, LEFT/OFF/RIGHT", "ENGINE_INTERFACE(3),3008,PTR-CPE-TMB-ENGSTART-LFTRGT,TUMB,422,-1,-1,1,Engine Selector Switch, LEFT/OFF/RIGHT", "R_863(38),3004,PTR-APP-TMB-PS,TUMB,155,-1,0,1,R-863, Squelch Switch, ON/OFF", "R_863(38),3004,PTR-APP-TMB-PS,TUMB,155,1,0,1,R-863, Squelch Switch, ON/OFF", "R_863(38),3005,PTR-APP-LVR-LEVEL,LEV,156,0,0,1,R-863, Volume Knob", "ENGINE_INTERFACE(3),3040,PTR-LES-BTN-CONTRPVD,BTN,339,1,0,1,Left Pitot Heater Test Button - Push to test", "ELEC_INTERFACE(1),3057,PTR-NONAME,TUMB,616,-1,0,1,CB NONAME, ON/OFF", "ELEC_INTERFACE(1),3057,PTR-NONAME,TUMB,616,1,0,1,CB NONAME, ON/OFF", "ENGINE_INTERFACE(3),3031,PTR-LPE-BTN-OVR,BTN,354,1,0,1,Defrost OFF Button - Push to turn off", "R_863(38),3006,PTR-APP-LVR-SEL1,TUMB,163,0.1,0,1,R-863, 10MHz Rotary Knob", "R_863(38),3006,PTR-APP-LVR-SEL1,TUMB,163,-0.1,0,1,R-863, 10MHz Rotary Knob", "R_863(38),3007,PTR-APP-LVR-SEL2,TUMB,164,0.1,0,1,R-863, 1MHz Rotary Knob", "R_863(38),3007,PTR-APP-LVR-SEL2,TUMB,164,-0.1,0,1,R-863, 1MHz Rotary Knob", "ELEC_INTERFACE(1),3081,PTR-RAZS-TMB-PPSQUE1-R,TUMB,640,-1,0,1,CB Fire Protection System: 1 Queue Right, ON/OFF", "ELEC_INTERFACE(1),3081,PTR-RAZS-TMB-PPSQUE1-R,TUMB,640,1,0,1,CB Fire Protection System: 1 Queue Right, ON/OFF", "R_863(38),3008,PTR-APP-LVR-SEL3,TUMB,165,0.1,0,1,R-863, 100kHz Rotary Knob", "R_863(38),3008,PTR-APP-LVR-SEL3,TUMB,165,-0.1,0,1,R-863, 100kHz Rotary Knob", "R_863(38),3009,PTR-APP-LVR-SEL4,TUMB,166,0.1,0,1,R-863, 1kHz Rotary Knob", "R_863(38),3009,PTR-APP-LVR-SEL4,TUMB,166,-0.1,0,1,R-863, 1kHz Rotary Knob", "ENGINE_INTERFACE(3),3068,PKT-TROTTLE_R,LEV,0,0,-1,1,Collective (LMB press, hold and move) / Throttle (RMB press, hold and move)", "ENGINE_INTERFACE(3),3070,PKT-TROTTLE_R,LEV,0,0,-1,1,Collective (LMB press, hold and move) / Throttle (RMB press, hold and move)", "ARC_UD(41),3006,PTR-RPE-BTN-CONTR,BTN,672,1,0,1,ARC-UD, Control Button", "WEAPON_SYS(12),3053,PTR-LAZS-CVR-EMRGEXP01,TUMB,348,-1,0,1,800 or 624_622_800 Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3053,PTR-LAZS-CVR-EMRGEXP01,TUMB,348,1,0,1,800 or 624_622_800 Switch Cover, OPEN/CLOSE", "R_863(38),3010,PTR-APP-TMB-AP,TUMB,153,-1,0,1,R-863, Emergency Receiver Switch, ON/OFF (N/F)", "R_863(38),3010,PTR-APP-TMB-AP,TUMB,153,1,0,1,R-863, Emergency Receiver Switch, ON/OFF (N/F)", "FIRE_EXTING_INTERFACE(19),3008,PTR-CPE-BTN-QUE2-4,BTN,396,1,0,1,Alternate Discharge APU GEAR Button", "LIGHT_SYSTEM(46),3009,PTR-RSPE-LVR-REDGRP003,LEV,894,0,0,1,Central Red Lights Brightness Group 1 Rheostat", "AUTOPILOT(16),3022,PTR-APP-BTN-ALTON,LEV,871,0,0,0.2,Autopilot Altitude ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "AUTOPILOT(16),3001,PTR-APP-BTN-ALTON,BTN,144,1,0,1,Autopilot Altitude ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "ENGINE_INTERFACE(3),3012,PTR-CPE-TMB-TURBOSTART-ST,TUMB,412,1,-1,1,APU Start Mode Switch, START/COLD CRANKING/FALSE START", "ENGINE_INTERFACE(3),3012,PTR-CPE-TMB-TURBOSTART-ST,TUMB,412,-1,-1,1,APU Start Mode Switch, START/COLD CRANKING/FALSE START", "ENGINE_INTERFACE(3),3010,PTR-ENGSTOP-ARM-R,TUMB,206,-1,0,1,Right Engine Stop Lever", "ENGINE_INTERFACE(3),3010,PTR-ENGSTOP-ARM-R,TUMB,206,1,0,1,Right Engine Stop Lever", "JADRO_1A(37),3002,PTR-ADDSECPLT-LVR-DIG12,TUMB,745,0.1,0,1,Jadro 1A, Frequency Selector, 1MHz", "JADRO_1A(37),3002,PTR-ADDSECPLT-LVR-DIG12,TUMB,745,-0.1,0,1,Jadro 1A, Frequency Selector, 1MHz", "ELEC_INTERFACE(1),3036,PTR-LAZS-TMB-RSGUV-SIGN,TUMB,595,-1,0,1,CB RS/GUV Warning, ON/OFF", "ELEC_INTERFACE(1),3036,PTR-LAZS-TMB-RSGUV-SIGN,TUMB,595,1,0,1,CB RS/GUV Warning, ON/OFF", "RADAR_ALTIMETER(18),3001,PTR-ALTR-LVR-SET,LEV,29,0.1,0,1,Dangerous RALT Knob", "JADRO_1A(37),3006,PTR-ADDSECPLT-LVR-DIG6,LEV,749,0.1,0,1,Jadro 1A, Frequency Selector, Left mouse - 1kHz/ Right mouse - 100Hz ", "JADRO_1A(37),3005,PTR-ADDSECPLT-LVR-DIG6,TUMB,748,0.1,0,1,Jadro 1A, Frequency Selector, Left mouse - 1kHz/ Right mouse - 100Hz ", "JADRO_1A(37),3005,PTR-ADDSECPLT-LVR-DIG6,TUMB,748,-0.1,0,1,Jadro 1A, Frequency Selector, Left mouse - 1kHz/ Right mouse - 100Hz ", "AGB_3K_RIGHT(7),3003,PTR-AGB-LVR-SET-R,LEV,89,0,0,1,Right Attitude Indicator Zero Pitch Knob", "ELEC_INTERFACE(1),3046,PTR-LAZS-TMB-ES-622R,TUMB,605,-1,0,1,CB Electric Launch 800 Right, ON/OFF", "ELEC_INTERFACE(1),3046,PTR-LAZS-TMB-ES-622R,TUMB,605,1,0,1,CB Electric Launch 800 Right, ON/OFF", "ARC_9(40),3009,PTR-RPE-LVR-FRQMAIN,TUMB,452,0.1,0,0.9,ARC-9, Main 10kHz Rotary Knob", "ARC_9(40),3009,PTR-RPE-LVR-FRQMAIN,TUMB,452,-0.1,0,0.9,ARC-9, Main 10kHz Rotary Knob", "VMS(11),3005,PTR-LSPE-BTN-RI65-OFF,BTN,292,1,0,1,RI-65 OFF Button", "FUELSYS_INTERFACE(2),3003,PTR-CPE-TMB-PUMPTNK-L,TUMB,439,-1,0,1,Left Tank Pump Switch, ON/OFF", "FUELSYS_INTERFACE(2),3003,PTR-CPE-TMB-PUMPTNK-L,TUMB,439,1,0,1,Left Tank Pump Switch, ON/OFF", "WEAPON_SYS(12),3029,PTR-ADDESBR-LVR-MODE,TUMB,730,0.0555,0,0.8325,ESBR Position Selector Switch", "WEAPON_SYS(12),3029,PTR-ADDESBR-LVR-MODE,TUMB,730,-0.0555,0,0.8325,ESBR Position Selector Switch", "VMS(11),3003,PTR-LSPE-BTN-RI65-RETRY,BTN,293,1,0,1,RI-65 Repeat Button", "CLOCK(45),3003,PTR-WATCH-LVR-L,LEV,58,1,0,1,Mech clock left lever", "CLOCK(45),3002,PTR-WATCH-LVR-L,BTN,57,-1,-1,0,Mech clock left lever", "CLOCK(45),3001,PTR-WATCH-LVR-L,BTN,57,1,0,1,Mech clock left lever", "ENGINE_INTERFACE(3),3052,PTR-APP-TMB-CHR-L,TUMB,168,-1,0,1,Left Engine ER Switch, ON/OFF", "ENGINE_INTERFACE(3),3052,PTR-APP-TMB-CHR-L,TUMB,168,1,0,1,Left Engine ER Switch, ON/OFF", "FUELSYS_INTERFACE(2),3007,PTR-CPE-TMB-PUMP-PASS,TUMB,433,-1,0,1,Bypass Switch, ON/OFF", "FUELSYS_INTERFACE(2),3007,PTR-CPE-TMB-PUMP-PASS,TUMB,433,1,0,1,Bypass Switch, ON/OFF", "ARC_UD(41),3001,PTR-RPE-LVR-ARKMODE1,TUMB,456,0.1,0,0.4,ARC-UD, Mode Switch, OFF/NARROW/WIDE/PULSE/RC", "ARC_UD(41),3001,PTR-RPE-LVR-ARKMODE1,TUMB,456,-0.1,0,0.4,ARC-UD, Mode Switch, OFF/NARROW/WIDE/PULSE/RC", "ELEC_INTERFACE(1),3089,PTR-RAZS-TMB-HLGT-ON-L,TUMB,648,-1,0,1,CB Headlights: Left: Light, ON/OFF", "ELEC_INTERFACE(1),3089,PTR-RAZS-TMB-HLGT-ON-L,TUMB,648,1,0,1,CB Headlights: Left: Light, ON/OFF", "FIRE_EXTING_INTERFACE(19),3011,PTR-CPE-TMB-CONTR-PYRO,TUMB,400,-1,0,1,Squib Test Switch", "FIRE_EXTING_INTERFACE(19),3011,PTR-CPE-TMB-CONTR-PYRO,TUMB,400,1,0,1,Squib Test Switch", "ELEC_INTERFACE(1),3002,PTR-RSPE-TMB-AKK2,TUMB,496,-1,0,1,Battery 2 Switch, ON/OFF", "ELEC_INTERFACE(1),3002,PTR-RSPE-TMB-AKK2,TUMB,496,1,0,1,Battery 2 Switch, ON/OFF", "ARC_9(40),3007,PTR-RPE-LVR-FRQADJMAIN,LEV,451,0,-0.2,0.4,ARC-9, Main Frequency Tune Knob", "AUTOPILOT(16),3009,PTR-APP-LVR-DIR,LEV,136,1,0,1,Autopilot Heading Adjustment Knob", "ARC_UD(41),3002,PTR-RPE-TMB-ARKSENS,TUMB,453,-1,0,1,ARC-UD, Sensitivity Switch, MORE/LESS", "ARC_UD(41),3002,PTR-RPE-TMB-ARKSENS,TUMB,453,1,0,1,ARC-UD, Sensitivity Switch, MORE/LESS", "ELEC_INTERFACE(1),3062,PTR-RAZS-TMB-APFRICT,TUMB,621,-1,0,1,CB Autopilot: Friction, ON/OFF", "ELEC_INTERFACE(1),3062,PTR-RAZS-TMB-APFRICT,TUMB,621,1,0,1,CB Autopilot: Friction, ON/OFF", "ELEC_INTERFACE(1),3068,PTR-RAZS-TMB-RADCOMM,TUMB,627,-1,0,1,CB Radio: Command Radio Station (R-863), ON/OFF", "ELEC_INTERFACE(1),3068,PTR-RAZS-TMB-RADCOMM,TUMB,627,1,0,1,CB Radio: Command Radio Station (R-863), ON/OFF", "ELEC_INTERFACE(1),3098,PTR-RAZS-TMB-POSPZUENG-L,TUMB,657,-1,0,1,CB Defrost System: Left Engine, ON/OFF", "ELEC_INTERFACE(1),3098,PTR-RAZS-TMB-POSPZUENG-L,TUMB,657,1,0,1,CB Defrost System: Left Engine, ON/OFF", "AGB_3K_RIGHT(7),3002,PTR-AGB-LVR-KNOB-R,BTN,90,1,0,1,Right Attitude Indicator Cage Knob - Push to cage", "R_828(39),3002,PTR-ADDSECPLT-LVR-VOL,LEV,737,0,0,1,R-828, Volume Knob", "ARC_9(40),3011,PTR-RPE-TMB-NEARFAR,TUMB,469,-1,0,1,ARC-9, Dialer Switch, MAIN/BACKUP", "ARC_9(40),3011,PTR-RPE-TMB-NEARFAR,TUMB,469,1,0,1,ARC-9, Dialer Switch, MAIN/BACKUP", "RADAR_ALTIMETER(18),3003,PTR-ALTR-TMB-ONOFF,TUMB,35,-1,0,1,Radar Altimeter Power Switch, ON/OFF", "RADAR_ALTIMETER(18),3003,PTR-ALTR-TMB-ONOFF,TUMB,35,1,0,1,Radar Altimeter Power Switch, ON/OFF", "ELEC_INTERFACE(1),3033,PTR-LAZS-TMB-BV-DIR,TUMB,592,-1,0,1,CB Control, ON/OFF_mi8", "ELEC_INTERFACE(1),3033,PTR-LAZS-TMB-BV-DIR,TUMB,592,1,0,1,CB Control, ON/OFF_mi8", "ARC_UD(41),3012,PTR-RES-TMB-BLOCK,TUMB,481,-1,0,1,ARC-UD, Lock Switch, LOCK/UNLOCK", "ARC_UD(41),3012,PTR-RES-TMB-BLOCK,TUMB,481,1,0,1,ARC-UD, Lock Switch, LOCK/UNLOCK",
-        "LIGHT_SYSTEM(46),3005,PTR-LSPE-LVR-REDGRP1,LEV,280,0,0,1,Left Red Lights Brightness Group 1 Rheostat", "SPU_7(36),3013,PTR-RAZS-TMB-CIRC002,TUMB,843,-1,0,1,Network 1/2 Switch (N/F)", "SPU_7(36),3013,PTR-RAZS-TMB-CIRC002,TUMB,843,1,0,1,Network 1/2 Switch (N/F)", "SPU_7(36),3021,PTR-LSPE-TMB-RI65-AMP,TUMB,295,-1,0,1,RI-65 Amplifier Switch, ON/OFF", "SPU_7(36),3021,PTR-LSPE-TMB-RI65-AMP,TUMB,295,1,0,1,RI-65 Amplifier Switch, ON/OFF", "R_828(39),3005,PTR-ADDSECPLT-TMB-P828,TUMB,756,-1,0,1,R-828, Power Switch, ON/OFF", "R_828(39),3005,PTR-ADDSECPLT-TMB-P828,TUMB,756,1,0,1,R-828, Power Switch, ON/OFF", "ELEC_INTERFACE(1),3085,PTR-RAZS-TMB-RADCMP-UKV,TUMB,644,-1,0,1,CB Radio: Radio Compass VHF(ARC-UD), ON/OFF", "ELEC_INTERFACE(1),3085,PTR-RAZS-TMB-RADCMP-UKV,TUMB,644,1,0,1,CB Radio: Radio Compass VHF(ARC-UD), ON/OFF", "ELEC_INTERFACE(1),3001,PTR-RSPE-TMB-RESGEN,TUMB,497,-1,0,1,Standby Generator Switch, ON/OFF", "ELEC_INTERFACE(1),3001,PTR-RSPE-TMB-RESGEN,TUMB,497,1,0,1,Standby Generator Switch, ON/OFF", "CLOCK(45),3005,PTR-WATCH-LVR-R,LEV,60,0.05,-0.15,0.15,Mech clock right lever", "CLOCK(45),3004,PTR-WATCH-LVR-R,BTN,59,1,0,1,Mech clock right lever", "R_863(38),3011,PTR-APP-TMB-RK,TUMB,154,-1,0,1,R-863, ARC Switch, ON/OFF (N/F)", "R_863(38),3011,PTR-APP-TMB-RK,TUMB,154,1,0,1,R-863, ARC Switch, ON/OFF (N/F)", "CLOCK(45),3006,PTR-RSPE-TMB-WRMWTCH,TUMB,521,-1,0,1,Clock Heating Switch, ON/OFF", "CLOCK(45),3006,PTR-RSPE-TMB-WRMWTCH,TUMB,521,1,0,1,Clock Heating Switch, ON/OFF", "R_863(38),3002,PTR-APP-TMB-NU,TUMB,132,-1,0,1,R-863, Unit Switch, DIAL/MEMORY", "R_863(38),3002,PTR-APP-TMB-NU,TUMB,132,1,0,1,R-863, Unit Switch, DIAL/MEMORY", "UV_26(48),3002,PTR-UV26-BOARD,TUMB,859,0.5,0,1,CMD Board Flares Dispensers Switch, LEFT/BOTH/RIGHT", "UV_26(48),3002,PTR-UV26-BOARD,TUMB,859,-0.5,0,1,CMD Board Flares Dispensers Switch, LEFT/BOTH/RIGHT", "ELEC_INTERFACE(1),3044,PTR-LAZS-TMB-GUOUTR-622R,TUMB,603,-1,0,1,CB GUV: Inner Right 622 Right, ON/OFF", "ELEC_INTERFACE(1),3044,PTR-LAZS-TMB-GUOUTR-622R,TUMB,603,1,0,1,CB GUV: Inner Right 622 Right, ON/OFF", "SYS_CONTROLLER(21),3007,PTR-APP-TMB-TEST,TUMB,150,1,-1,1,Check Switch, LAMPS/OFF/FLASHER", "SYS_CONTROLLER(21),3007,PTR-APP-TMB-TEST,TUMB,150,-1,-1,1,Check Switch, LAMPS/OFF/FLASHER", "ELEC_INTERFACE(1),3099,PTR-RAZS-TMB-POSPZUENG-R,TUMB,658,-1,0,1,CB Defrost System: Right Engine, ON/OFF", "ELEC_INTERFACE(1),3099,PTR-RAZS-TMB-POSPZUENG-R,TUMB,658,1,0,1,CB Defrost System: Right Engine, ON/OFF", "UV_26(48),3003,PTR-UV26-PROG,TUMB,913,-1,0,1,CMD Flares Amount Switch, COUNTER/PROGRAMMING", "UV_26(48),3003,PTR-UV26-PROG,TUMB,913,1,0,1,CMD Flares Amount Switch, COUNTER/PROGRAMMING", "UV_26(48),3013,PTR-LSPE-BTN-UV26-START,BTN,911,1,0,1,Start/Stop Dispense Button", "UV_26(48),3008,PTR-RESET-PROG-BTN,BTN,864,1,0,1,CMD Reset to Default Program Button", "WEAPON_SYS(12),3020,PTR-LPE-TMB-SHOOT1,TUMB,342,1,-1,1,8/16/4 Switch", "WEAPON_SYS(12),3020,PTR-LPE-TMB-SHOOT1,TUMB,342,-1,-1,1,8/16/4 Switch", "ELEC_INTERFACE(1),3023,PTR-GRAZS-4,BTN,885,1,0,1,CB Group 2 ON", "ELEC_INTERFACE(1),3054,PTR-RAZS-TMB-START-ENGON,TUMB,613,-1,0,1,CB Engine Start, ON/OFF", "ELEC_INTERFACE(1),3054,PTR-RAZS-TMB-START-ENGON,TUMB,613,1,0,1,CB Engine Start, ON/OFF", "UV_26(48),3009,PTR-STOP-BTN,BTN,865,1,0,1,CMD Stop Dispense Button", "CPT_MECH(17),3015,PTR-BLISTER-LOCK-L,TUMB,215,-0.64,0,0.64,Left Blister, OPEN/CLOSE", "CPT_MECH(17),3015,PTR-BLISTER-LOCK-L,TUMB,215,0.64,0,0.64,Left Blister, OPEN/CLOSE", "CPT_MECH(17),3016,PTR-BLISTER-LOCK-R,TUMB,216,-0.64,0,0.64,Right Blister, OPEN/CLOSE", "CPT_MECH(17),3016,PTR-BLISTER-LOCK-R,TUMB,216,0.64,0,0.64,Right Blister, OPEN/CLOSE", "CPT_MECH(17),3024,PTR-WHEELBRKFIX-ARM,TUMB,930,-1,0,1,Parking Brake Handle", "CPT_MECH(17),3024,PTR-WHEELBRKFIX-ARM,TUMB,930,1,0,1,Parking Brake Handle", "LIGHT_SYSTEM(46),3007,PTR-RSPE-LVR-REDGRP1,LEV,491,0,0,1,Right Red Lights Brightness Group 1 Rheostat", "CPT_MECH(17),3021,PTR-RES-TMB-VENT,TUMB,488,-1,0,1,Right Fan Switch, ON/OFF", "CPT_MECH(17),3021,PTR-RES-TMB-VENT,TUMB,488,1,0,1,Right Fan Switch, ON/OFF", "ENGINE_INTERFACE(3),3033,PTR-LPE-TMB-PZU-R,TUMB,356,-1,0,1,Right Engine Heater Switch, MANUAL/AUTO", "ENGINE_INTERFACE(3),3033,PTR-LPE-TMB-PZU-R,TUMB,356,1,0,1,Right Engine Heater Switch, MANUAL/AUTO", "CPT_MECH(17),3025,PTR-LES-TMB-GLSCLN-OFF,TUMB,331,0,0,0,Left Windscreen Wiper Control Switch, OFF", "CPT_MECH(17),3025,PTR-LES-TMB-GLSCLN-START,TUMB,331,0.1,0.1,0.1,Left Windscreen Wiper Control Switch, START", "WEAPON_SYS(12),3032,PTR-ADDPBV-TMB-EMRGJET,BTN,709,1,0,1,Emergency Bomb Release Switch, ON/OFF", "CPT_MECH(17),3025,PTR-LES-TMB-GLSCLN-RESET,BTN,331,0.2,0,0.2,Left Windscreen Wiper Control Switch, RESET", "DISS_15(15),3010,PTR-IND-DISS-SELECTOR,TUMB,826,0.1,0,0.4,Doppler Navigator Mode Switch", "DISS_15(15),3010,PTR-IND-DISS-SELECTOR,TUMB,826,-0.1,0,0.4,Doppler Navigator Mode Switch", "WEAPON_SYS(12),3085,PTR-COVER-RS-R,TUMB,228,-1,0,1,Right Fire RS Button Cover, OPEN/CLOSE", "WEAPON_SYS(12),3085,PTR-COVER-RS-R,TUMB,228,1,0,1,Right Fire RS Button Cover, OPEN/CLOSE", "FUELSYS_INTERFACE(2),3001,PTR-CPE-TMB-PUMP-L,TUMB,427,-1,0,1,Left Shutoff Valve Switch, ON/OFF", "FUELSYS_INTERFACE(2),3001,PTR-CPE-TMB-PUMP-L,TUMB,427,1,0,1,Left Shutoff Valve Switch, ON/OFF", "CPT_MECH(17),3025,PTR-LES-TMB-GLSCLN-HISPEED,TUMB,331,0.3,0.3,0.3,Left Windscreen Wiper Control Switch, SPEED 1", "ELEC_INTERFACE(1),3051,PTR-LAZS-TMB-JETRCKT,TUMB,610,-1,0,1,CB Signal Flare, ON/OFF", "ELEC_INTERFACE(1),3051,PTR-LAZS-TMB-JETRCKT,TUMB,610,1,0,1,CB Signal Flare, ON/OFF", "PKV(47),3003,PTR-PKV-ROTARY,LEV,855,0,0,0.807,Sight Limb Knob", "CPT_MECH(17),3026,PTR-RES-TMB-GLSCLN-OFF,TUMB,478,0,0,0,Right Windscreen Wiper Control Switch, OFF", "SPU_7(36),3023,PTR-ARMS-L,BTN,182,0.5,0,0.5,Left Trigger Button, RADIO(LMB)/ICS(RMB)", "SPU_7(36),3023,PTR-ARMS-L,BTN,182,1,0,1,Left Trigger Button, RADIO(LMB)/ICS(RMB)", "ENGINE_INTERFACE(3),3022,PTR-LSPE-BTN-CONTR-AIR,BTN,312,1,0,1,Hot Temperature Sensor Test Button - Push to test", "CPT_MECH(17),3026,PTR-RES-TMB-GLSCLN-START,BTN,478,0.2,0,0.2,Right Windscreen Wiper Control Switch, RESET", "CPT_MECH(17),3026,PTR-RES-TMB-GLSCLN-LOWSPEED,TUMB,478,0.3,0.3,0.3,Right Windscreen Wiper Control Switch, SPEED 1", "CPT_MECH(17),3026,PTR-RES-TMB-GLSCLN-HISPEED,TUMB,478,0.4,0.4,0.4,Right Windscreen Wiper Control Switch, SPEED 2", "ENGINE_INTERFACE(3),3035,PTR-LPE-TMB-RIO,TUMB,358,-1,0,1,Ice Detector Heater Switch, MANUAL/AUTO", "ENGINE_INTERFACE(3),3035,PTR-LPE-TMB-RIO,TUMB,358,1,0,1,Ice Detector Heater Switch, MANUAL/AUTO", "ELEC_INTERFACE(1),3039,PTR-LAZS-TMB-GUOUT-800L,TUMB,598,-1,0,1,CB GUV: Outer 800 Left, ON/OFF", "ELEC_INTERFACE(1),3039,PTR-LAZS-TMB-GUOUT-800L,TUMB,598,1,0,1,CB GUV: Outer 800 Left, ON/OFF", "ENGINE_INTERFACE(3),3041,PTR-LES-BTN-CONTRPVD01,BTN,482,1,0,1,Right Pitot Heater Test Button - Push to test", "AUTOPILOT(16),3020,PTR-APP-BTN-DIROFF,LEV,869,0,0,0.2,Autopilot Heading OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "AUTOPILOT(16),3005,PTR-APP-BTN-DIROFF,BTN,135,1,0,1,Autopilot Heading OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "ELEC_INTERFACE(1),3043,PTR-LAZS-TMB-GUOUTR-622L,TUMB,602,-1,0,1,CB GUV: Inner Right 622 Left, ON/OFF", "ELEC_INTERFACE(1),3043,PTR-LAZS-TMB-GUOUTR-622L,TUMB,602,1,0,1,CB GUV: Inner Right 622 Left, ON/OFF", "ELEC_INTERFACE(1),3029,PTR-GRAZS-6,BTN,887,1,0,1,CB Group 8 ON", "WEAPON_SYS(12),3004,PTR-LAZS-TMB-EMRGEXP,TUMB,570,-1,0,1,Emergency Explode Switch, ON/OFF", "WEAPON_SYS(12),3004,PTR-LAZS-TMB-EMRGEXP,TUMB,570,1,0,1,Emergency Explode Switch, ON/OFF", "ARC_9(40),3001,PTR-RPE-LVR-FRQVOLUME,LEV,448,1,0,1,ARC-9, Volume Knob", "ARC_9(40),3003,PTR-RPE-LVR-FRQMODE,TUMB,446,0.1,0,0.3,ARC-9, Mode Selector Switch, OFF/COMP/ANT/LOOP", "ARC_9(40),3003,PTR-RPE-LVR-FRQMODE,TUMB,446,-0.1,0,0.3,ARC-9, Mode Selector Switch, OFF/COMP/ANT/LOOP", "ARC_9(40),3010,PTR-RPE-TMB-FRQFRAME,BTN,447,1,0,1,ARC-9, Loop Control Switch, LEFT/OFF/RIGHT", "ARC_9(40),3010,PTR-RPE-TMB-FRQFRAME,BTN,447,-1,-1,0,ARC-9, Loop Control Switch, LEFT/OFF/RIGHT", "ARC_9(40),3005,PTR-RPE-LVR-FRQRES-SEC,TUMB,675,0.05,0,0.55,ARC-9, Backup 100kHz Rotary Knob", "ARC_9(40),3005,PTR-RPE-LVR-FRQRES-SEC,TUMB,675,-0.05,0,0.55,ARC-9, Backup 100kHz Rotary Knob", "ARC_9(40),3006,PTR-RPE-LVR-FRQRES,TUMB,450,0.1,0,0.9,ARC-9, Backup 10kHz Rotary Knob", "ARC_9(40),3006,PTR-RPE-LVR-FRQRES,TUMB,450,-0.1,0,0.9,ARC-9, Backup 10kHz Rotary Knob", "WEAPON_SYS(12),3084,PTR-COVER-RS-L,TUMB,185,-1,0,1,Left Fire RS Button Cover, OPEN/CLOSE", "WEAPON_SYS(12),3084,PTR-COVER-RS-L,TUMB,185,1,0,1,Left Fire RS Button Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3034,PTR-LAZS-TMB-BV-EQU,TUMB,593,-1,0,1,CB Equipment, ON/OFF", "ELEC_INTERFACE(1),3034,PTR-LAZS-TMB-BV-EQU,TUMB,593,1,0,1,CB Equipment, ON/OFF", "ARC_UD(41),3004,PTR-RPE-LVR-ARKMODE2,TUMB,457,0.1,0,0.5,ARC-UD, Channel Selector Switch, 1/2/3/4/5/6", "ARC_UD(41),3004,PTR-RPE-LVR-ARKMODE2,TUMB,457,-0.1,0,0.5,ARC-UD, Channel Selector Switch, 1/2/3/4/5/6", "AUTOPILOT(16),3010,PTR-APP-LVR-T,LEV,142,1,0,1,Autopilot Pitch Adjustment Knob", "ARC_9(40),3008,PTR-RPE-LVR-FRQMAIN-SEC,TUMB,678,0.05,0,0.55,ARC-9, Main 100kHz Rotary Knob", "ARC_9(40),3008,PTR-RPE-LVR-FRQMAIN-SEC,TUMB,678,-0.05,0,0.55,ARC-9, Main 100kHz Rotary Knob", "JADRO_1A(37),3008,PTR-ADDSECPLT-LVR-PSH,TUMB,741,0.7,0,0.7,Jadro 1A, Squelch Switch", "JADRO_1A(37),3008,PTR-ADDSECPLT-LVR-PSH,TUMB,741,-0.7,0,0.7,Jadro 1A, Squelch Switch", "DISS_15(15),3005,PTR-DISS-BTN-PLUS,BTN,816,1,0,1,Increase Map Angle Button", "ENGINE_INTERFACE(3),3020,PTR-LSPE-BTN-CONTR-RTR,BTN,314,1,0,1,Right Engine Temperature Regulator Test Button - Push to test", "SIGNAL_FLARES(52),3001,PTR-LSPE-TMB-ALRMRKT1,TUMB,282,-1,0,1,Signal Flares Cassette 1 Power Switch, ON/OFF", "SIGNAL_FLARES(52),3001,PTR-LSPE-TMB-ALRMRKT1,TUMB,282,1,0,1,Signal Flares Cassette 1 Power Switch, ON/OFF", "SIGNAL_FLARES(52),3006,PTR-LSPE-TMB-ALRMRKT2,TUMB,283,-1,0,1,Signal Flares Cassette 2 Power Switch, ON/OFF", "SIGNAL_FLARES(52),3006,PTR-LSPE-TMB-ALRMRKT2,TUMB,283,1,0,1,Signal Flares Cassette 2 Power Switch, ON/OFF",
-        "SIGNAL_FLARES(52),3002,PTR-LSPE-BTN-RCKT12,TUMB,285,-1,0,1,Signal Flares Cassette 1 Launch Green Button", "SIGNAL_FLARES(52),3002,PTR-LSPE-BTN-RCKT12,TUMB,285,1,0,1,Signal Flares Cassette 1 Launch Green Button", "HSI_L(34),3001,PTR-PNP-LVR-SET,LEV,26,0,0,1,HSI Course Set Knob", "SIGNAL_FLARES(52),3005,PTR-LSPE-BTN-RCKT13,TUMB,286,-1,0,1,Signal Flares Cassette 1 Launch Yellow Button", "SIGNAL_FLARES(52),3005,PTR-LSPE-BTN-RCKT13,TUMB,286,1,0,1,Signal Flares Cassette 1 Launch Yellow Button", "SIGNAL_FLARES(52),3004,PTR-LSPE-BTN-RCKT14,TUMB,287,-1,0,1,Signal Flares Cassette 1 Launch White Button", "SIGNAL_FLARES(52),3004,PTR-LSPE-BTN-RCKT14,TUMB,287,1,0,1,Signal Flares Cassette 1 Launch White Button", "WEAPON_SYS(12),3014,PTR-ADDPBV-BTN-LAMPTEST,BTN,718,1,0,1,Lamps Check Button - Push to check", "NAVLIGHT_SYSTEM(9),3012,PTR-RSPE-TMB-ANO,TUMB,513,1,-1,1,ANO Switch, BRIGHT/OFF/DIM", "NAVLIGHT_SYSTEM(9),3012,PTR-RSPE-TMB-ANO,TUMB,513,-1,-1,1,ANO Switch, BRIGHT/OFF/DIM", "SIGNAL_FLARES(52),3008,PTR-LSPE-BTN-RCKT21,TUMB,288,-1,0,1,Signal Flares Cassette 2 Launch Red Button", "SIGNAL_FLARES(52),3008,PTR-LSPE-BTN-RCKT21,TUMB,288,1,0,1,Signal Flares Cassette 2 Launch Red Button", "HYDRO_SYS_INTERFACE(4),3001,PTR-CPE-TMB-HYDRO-MAIN,TUMB,406,-1,0,1,Main Hydraulic Switch, ON/OFF", "HYDRO_SYS_INTERFACE(4),3001,PTR-CPE-TMB-HYDRO-MAIN,TUMB,406,1,0,1,Main Hydraulic Switch, ON/OFF", "AUTOPILOT(16),3032,PTR-TRIMMER-ON-R,BTN,227,1,0,1,Trimmer Right Button", "ELEC_INTERFACE(1),3095,PTR-SW-LIGHT-PRF4-LEFT,TUMB,918,-1,0,1,CB PRF-4 Light Left, ON/OFF", "ELEC_INTERFACE(1),3095,PTR-SW-LIGHT-PRF4-LEFT,TUMB,918,1,0,1,CB PRF-4 Light Left, ON/OFF", "WEAPON_SYS(12),3042,PTR-LPE-TMB-VAR,TUMB,347,0.1,0,0.3,In800Out/800inOr624/622 Switch", "WEAPON_SYS(12),3042,PTR-LPE-TMB-VAR,TUMB,347,-0.1,0,0.3,In800Out/800inOr624/622 Switch", "SIGNAL_FLARES(52),3007,PTR-LSPE-BTN-RCKT22,TUMB,289,-1,0,1,Signal Flares Cassette 2 Launch Green Button", "SIGNAL_FLARES(52),3007,PTR-LSPE-BTN-RCKT22,TUMB,289,1,0,1,Signal Flares Cassette 2 Launch Green Button", "UV_26(48),3006,PTR-L68-BTN,BTN,862,1,0,1,CMD Dispense Interval Button", "HEATER_KO50(53),3002,PTR-RPE-TMB-KO50VENT,TUMB,467,-1,0,1,KO-50 Fan Switch, ON/OFF", "HEATER_KO50(53),3002,PTR-RPE-TMB-KO50VENT,TUMB,467,1,0,1,KO-50 Fan Switch, ON/OFF", "ELEC_INTERFACE(1),3021,PTR-APP-CVR-CIRC,TUMB,147,-1,0,1,Net on Rectifier Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3021,PTR-APP-CVR-CIRC,TUMB,147,1,0,1,Net on Rectifier Switch Cover, OPEN/CLOSE", "HEATER_KO50(53),3005,PTR-RPE-LVR-KO50TMP,LEV,468,0.25,0,1,KO-50 Target Temperature Knob", "SPU_7(36),3024,PTR-ARMS-R,BTN,225,0.5,0,0.5,Right Trigger Button, RADIO(LMB)/ICS(RMB)", "SPU_7(36),3024,PTR-ARMS-R,BTN,225,1,0,1,Right Trigger Button, RADIO(LMB)/ICS(RMB)", "NAVLIGHT_SYSTEM(9),3018,PTR-LEFT-TAXI-L-POS-SW,TUMB,837,1,-1,1,Left Landing Light Switch, LIGHT/OFF/RETRACT", "NAVLIGHT_SYSTEM(9),3018,PTR-LEFT-TAXI-L-POS-SW,TUMB,837,-1,-1,1,Left Landing Light Switch, LIGHT/OFF/RETRACT", "RECORDER_P503B(56),3001,PTR-LSPE-TMB-REC,TUMB,305,-1,0,1,Recorder P-503B Power Switch, ON/OFF", "RECORDER_P503B(56),3001,PTR-LSPE-TMB-REC,TUMB,305,1,0,1,Recorder P-503B Power Switch, ON/OFF", "RECORDER_P503B(56),3002,PTR-LSPE-LVR-LGTSEL,LEV,308,0,0,0.8,Recorder P-503B Backlight Brightness Knob", "IFF(57),3001,PTR-LSPE-LVR-MODE,TUMB,304,0.1,0,0.3,IFF Transponder Mode Selector Switch, AUTO/KD/+-15/KP", "IFF(57),3001,PTR-LSPE-LVR-MODE,TUMB,304,-0.1,0,0.3,IFF Transponder Mode Selector Switch, AUTO/KD/+-15/KP", "HSI_L(34),3003,PTR-ARKSV-ARKUKV,TUMB,858,-1,0,1,HSI Radio Compass Selector Switch, ARC-9/ARC-UD", "HSI_L(34),3003,PTR-ARKSV-ARKUKV,TUMB,858,1,0,1,HSI Radio Compass Selector Switch, ARC-9/ARC-UD", "DISS_15(15),3002,PTR-DISS-BTN-OFF,BTN,818,1,0,1,Turn Off Coordinates Calculator Button", "R_828(39),3001,PTR-ADDSECPLT-LVR-CHNL,TUMB,735,-0.1,0,0.9,R-828, Radio Channel Selector Knob", "R_828(39),3001,PTR-ADDSECPLT-LVR-CHNL,TUMB,735,0.1,0,0.9,R-828, Radio Channel Selector Knob", "SYS_CONTROLLER(21),3006,PTR-RSPE-TMB-TAB,TUMB,525,-1,0,1,Transparent Switch, DAY/NIGHT", "SYS_CONTROLLER(21),3006,PTR-RSPE-TMB-TAB,TUMB,525,1,0,1,Transparent Switch, DAY/NIGHT", "ARC_9(40),3004,PTR-RPE-LVR-FRQADJRES,LEV,449,0,-0.2,0.4,ARC-9, Backup Frequency Tune Knob", "BAR_ALTIMETER_R(27),3001,PTR-ALTB-LVR-SET-R,LEV,97,1,0,1,Baro Pressure QFE Knob", "GMK1A(14),3004,PTR-RPE-LVR-CRDMK,TUMB,472,1,-1,1,GMC Mode Switch, MC/DG/AC(N/F)", "GMK1A(14),3004,PTR-RPE-LVR-CRDMK,TUMB,472,-1,-1,1,GMC Mode Switch, MC/DG/AC(N/F)", "ELEC_INTERFACE(1),3011,PTR-EEP-LVR-ADJV1,LEV,536,0.5,0,1,Generator 1 Voltage Adjustment Rheostat", "ELEC_INTERFACE(1),3016,PTR-EEP-TMB-GEN2,TUMB,539,-1,0,1,Generator 2 Switch, ON/OFF", "ELEC_INTERFACE(1),3016,PTR-EEP-TMB-GEN2,TUMB,539,1,0,1,Generator 2 Switch, ON/OFF", "NAVLIGHT_SYSTEM(9),3014,PTR-RSPE-TMB-LGTCONT,TUMB,515,-1,0,1,Tip Lights Switch, ON/OFF", "NAVLIGHT_SYSTEM(9),3014,PTR-RSPE-TMB-LGTCONT,TUMB,515,1,0,1,Tip Lights Switch, ON/OFF", "IFF(57),3003,PTR-LSPE-TMB-RADIO-MODE12,TUMB,300,-1,0,1,IFF Transponder Device Mode Switch, 1/2", "IFF(57),3003,PTR-LSPE-TMB-RADIO-MODE12,TUMB,300,1,0,1,IFF Transponder Device Mode Switch, 1/2", "ELEC_INTERFACE(1),3053,PTR-RAZS-TMB-START-TRBIGN,TUMB,612,-1,0,1,CB APU Ignition, ON/OFF", "ELEC_INTERFACE(1),3053,PTR-RAZS-TMB-START-TRBIGN,TUMB,612,1,0,1,CB APU Ignition, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3003,PTR-STKSG-BTN-EMRGJET,BTN,198,1,0,1,Emergency Cargo Release Button - Push to release", "ENGINE_INTERFACE(3),3074,PTR-CPE-TMB-ENGSTART-TEST,BTN,425,1,0,1,Engine Ignition Check Switch, LEFT/OFF/RIGHT", "ENGINE_INTERFACE(3),3074,PTR-CPE-TMB-ENGSTART-TEST,BTN,425,-1,-1,0,Engine Ignition Check Switch, LEFT/OFF/RIGHT", "NAVLIGHT_SYSTEM(9),3013,PTR-RSPE-TMB-LGTWING,TUMB,514,1,-1,1,Formation Lights Switch, BRIGHT/OFF/DIM", "NAVLIGHT_SYSTEM(9),3013,PTR-RSPE-TMB-LGTWING,TUMB,514,-1,-1,1,Formation Lights Switch, BRIGHT/OFF/DIM", "IFF(57),3005,PTR-LSPE-BTN-EMRG-ERASE,BTN,297,1,0,1,IFF Transponder Erase Button - Push to erase", "IFF(57),3006,PTR-LSPE-CVR-EMRG-MAYDAY,TUMB,298,-1,0,1,IFF Transponder Disaster Switch Cover, OPEN/CLOSE", "IFF(57),3006,PTR-LSPE-CVR-EMRG-MAYDAY,TUMB,298,1,0,1,IFF Transponder Disaster Switch Cover, OPEN/CLOSE", "IFF(57),3007,PTR-LSPE-TMB-EMRG-MAYDAY,TUMB,299,-1,0,1,IFF Transponder Disaster Switch, ON/OFF", "IFF(57),3007,PTR-LSPE-TMB-EMRG-MAYDAY,TUMB,299,1,0,1,IFF Transponder Disaster Switch, ON/OFF", "ELEC_INTERFACE(1),3019,PTR-APP-TMB-CIRC,TUMB,148,-1,0,1,Net on Rectifier Switch, ON/OFF", "ELEC_INTERFACE(1),3019,PTR-APP-TMB-CIRC,TUMB,148,1,0,1,Net on Rectifier Switch, ON/OFF", "ELEC_INTERFACE(1),3024,PTR-GRAZS-7,BTN,888,1,0,1,CB Group 3 ON", "MISC_SYSTEMS_INTERFACE(20),3001,PTR-LSPE-TMB-AIR-SIREN,BTN,323,1,0,1,Alarm Bell Button - Push to turn on", "WEAPON_SYS(12),3049,PTR-ADDPBV-CVR-EMRGEXP,TUMB,706,-1,0,1,Emergency Explode Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3049,PTR-ADDPBV-CVR-EMRGEXP,TUMB,706,1,0,1,Emergency Explode Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3026,PTR-GRAZS-5,BTN,886,1,0,1,CB Group 5 ON", "ELEC_INTERFACE(1),3060,PTR-RAZS-TMB-TURN,TUMB,619,-1,0,1,CB TURN INDICATOR, ON/OFF", "ELEC_INTERFACE(1),3060,PTR-RAZS-TMB-TURN,TUMB,619,1,0,1,CB TURN INDICATOR, ON/OFF", "FIRE_EXTING_INTERFACE(19),3006,PTR-CPE-BTN-QUE2-2,BTN,394,1,0,1,Alternate Discharge Right Engine Button", "SPU_7(36),3003,PTR-LAZS-LVR-MODES,TUMB,550,0.1,0,0.5,Radio Source Selector Switch, R-863/JADRO-1A/R-828/NF/ARC-9/ARC-UD", "SPU_7(36),3003,PTR-LAZS-LVR-MODES,TUMB,550,-0.1,0,0.5,Radio Source Selector Switch, R-863/JADRO-1A/R-828/NF/ARC-9/ARC-UD", "ELEC_INTERFACE(1),3030,PTR-GRAZS-9,BTN,890,1,0,1,CB Group 9 ON", "PKV(47),3001,PTR-LAZS-LVR-AIMLGT,LEV,589,0,0,1,Sight Brightness Knob", "ELEC_INTERFACE(1),3055,PTR-RAZS-TMB-START-ENGIGN,TUMB,614,-1,0,1,CB Engine Ignition, ON/OFF", "ELEC_INTERFACE(1),3055,PTR-RAZS-TMB-START-ENGIGN,TUMB,614,1,0,1,CB Engine Ignition, ON/OFF", "AUTOPILOT(16),3031,PTR-TRIMMER-ON-L,BTN,184,1,0,1,Trimmer Left Button", "ELEC_INTERFACE(1),3049,PTR-LAZS-TMB-JETPWR,TUMB,608,-1,0,1,CB Emergency Jettison: Power, ON/OFF", "ELEC_INTERFACE(1),3049,PTR-LAZS-TMB-JETPWR,TUMB,608,1,0,1,CB Emergency Jettison: Power, ON/OFF", "AUTOPILOT(16),3029,PTR-AUTOPILOT-OFF-L,BTN,183,1,0,1,Autopilot Off Left Button", "SIGNAL_FLARES(52),3010,PTR-LSPE-BTN-RCKT23,TUMB,290,-1,0,1,Signal Flares Cassette 2 Launch Yellow Button", "SIGNAL_FLARES(52),3010,PTR-LSPE-BTN-RCKT23,TUMB,290,1,0,1,Signal Flares Cassette 2 Launch Yellow Button", "JADRO_1A(37),3004,PTR-ADDSECPLT-LVR-DIG4,TUMB,747,0.1,0,1,Jadro 1A, Frequency Selector, 10kHz", "JADRO_1A(37),3004,PTR-ADDSECPLT-LVR-DIG4,TUMB,747,-0.1,0,1,Jadro 1A, Frequency Selector, 10kHz", "AUTOPILOT(16),3008,PTR-APP-LVR-K,LEV,140,1,0,1,Autopilot Roll Adjustment Knob", "VMS(11),3006,PTR-LES-TMB-RK85,TUMB,338,-1,0,1,RI-65 Power Switch, ON/OFF", "VMS(11),3006,PTR-LES-TMB-RK85,TUMB,338,1,0,1,RI-65 Power Switch, ON/OFF", "ELEC_INTERFACE(1),3048,PTR-LAZS-TMB-JETBOMB,TUMB,607,-1,0,1,CB Emergency Jettison: Bombs and GUV, ON/OFF", "ELEC_INTERFACE(1),3048,PTR-LAZS-TMB-JETBOMB,TUMB,607,1,0,1,CB Emergency Jettison: Bombs and GUV, ON/OFF", "JADRO_1A(37),3009,PTR-ADDSECPLT-TMB-CONTR,BTN,742,1,0,1,Jadro 1A, Control Button", "VARIOMETER_L(30),3001,PTR-VARIO-LVR-SET-L,LEV,17,1,0,1,Variometer Adjustment Knob", "ELEC_INTERFACE(1),3014,PTR-EEP-TMB-AER,TUMB,540,-1,0,1,AC Ground Power Switch, ON/OFF", "ELEC_INTERFACE(1),3014,PTR-EEP-TMB-AER,TUMB,540,1,0,1,AC Ground Power Switch, ON/OFF", "HSI_R(35),3001,PTR-PNP-LVR-SET-R,LEV,102,0,0,1,HSI Course Set Knob", "ELEC_INTERFACE(1),3106,PTR-RSPE-TMB-WRMAKK,TUMB,522,-1,0,1,Battery Heating Switch, ON/OFF", "ELEC_INTERFACE(1),3106,PTR-RSPE-TMB-WRMAKK,TUMB,522,1,0,1,Battery Heating Switch, ON/OFF", "ELEC_INTERFACE(1),3015,PTR-EEP-TMB-GEN1,TUMB,538,-1,0,1,Generator 1 Switch, ON/OFF", "ELEC_INTERFACE(1),3015,PTR-EEP-TMB-GEN1,TUMB,538,1,0,1,Generator 1 Switch, ON/OFF", "ARC_9(40),3002,PTR-RPE-TMB-FRQTLG,TUMB,444,-1,0,1,ARC-9, TLF/TLG Switch", "ARC_9(40),3002,PTR-RPE-TMB-FRQTLG,TUMB,444,1,0,1,ARC-9, TLF/TLG Switch", "ENGINE_INTERFACE(3),3009,PTR-ENGSTOP-ARM-L,TUMB,204,-1,0,1,Left Engine Stop Lever",
-        "ENGINE_INTERFACE(3),3009,PTR-ENGSTOP-ARM-L,TUMB,204,1,0,1,Left Engine Stop Lever", "GMK1A(14),3003,PTR-RPE-LVR-CRDCONTR,BTN,476,1,0,1,GMC Control Switch, 0/CONTROL/300", "GMK1A(14),3003,PTR-RPE-LVR-CRDCONTR,BTN,476,-1,-1,0,GMC Control Switch, 0/CONTROL/300", "UV_26(48),3010,PTR-UV26-ONOFF,TUMB,910,-1,0,1,CMD Power Switch, ON/OFF", "UV_26(48),3010,PTR-UV26-ONOFF,TUMB,910,1,0,1,CMD Power Switch, ON/OFF", "FIRE_EXTING_INTERFACE(19),3003,PTR-CPE-BTN-QUE1-3,BTN,391,1,0,1,Main Discharge KO-50 Button", "ELEC_INTERFACE(1),3072,PTR-RAZS-TMB-TSCOCK-R,TUMB,631,-1,0,1,CB Fuel System: Right Valve, ON/OFF", "ELEC_INTERFACE(1),3072,PTR-RAZS-TMB-TSCOCK-R,TUMB,631,1,0,1,CB Fuel System: Right Valve, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3004,PTR-STKSG-CVR-EMRGJET,TUMB,197,-1,0,1,Emergency Cargo Release Button Cover, OPEN/CLOSE", "EXT_CARGO_EQUIPMENT(51),3004,PTR-STKSG-CVR-EMRGJET,TUMB,197,1,0,1,Emergency Cargo Release Button Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3076,PTR-RAZS-TMB-TSPMP-R,TUMB,635,-1,0,1,CB Fuel System: Right Tank Pump, ON/OFF", "ELEC_INTERFACE(1),3076,PTR-RAZS-TMB-TSPMP-R,TUMB,635,1,0,1,CB Fuel System: Right Tank Pump, ON/OFF", "ELEC_INTERFACE(1),3050,PTR-LAZS-TMB-JETEXPL,TUMB,609,-1,0,1,CB Emergency Jettison: Armed, ON/OFF", "ELEC_INTERFACE(1),3050,PTR-LAZS-TMB-JETEXPL,TUMB,609,1,0,1,CB Emergency Jettison: Armed, ON/OFF", "ELEC_INTERFACE(1),3064,PTR-RAZS-TMB-GSMAIN,TUMB,623,-1,0,1,CB Hydraulics: Main, ON/OFF", "ELEC_INTERFACE(1),3064,PTR-RAZS-TMB-GSMAIN,TUMB,623,1,0,1,CB Hydraulics: Main, ON/OFF", "DISS_15(15),3012,PTR-DISS-SELECTOR-SM,TUMB,798,-1,0,1,Land/Sea Switch", "DISS_15(15),3012,PTR-DISS-SELECTOR-SM,TUMB,798,1,0,1,Land/Sea Switch", "ENGINE_INTERFACE(3),3054,PTR-APP-TMB-TKLR,BTN,170,1,0,1,CT Check Switch, RIGHT/WORK/LEFT", "ENGINE_INTERFACE(3),3054,PTR-APP-TMB-TKLR,BTN,170,-1,-1,0,CT Check Switch, RIGHT/WORK/LEFT", "AUTOPILOT(16),3006,PTR-APP-BTN-CONTR,TUMB,146,1,0,1,Autopilot Altitude Channel Control (Right Button - UP; Left Button - Down)", "AUTOPILOT(16),3007,PTR-APP-BTN-CONTR,BTN,146,-1,-1,0,Autopilot Altitude Channel Control (Right Button - UP; Left Button - Down)", "ELEC_INTERFACE(1),3022,PTR-GRAZS-1,BTN,882,1,0,1,CB Group 1 ON", "ELEC_INTERFACE(1),3100,PTR-RAZS-TMB-POSRIO3,TUMB,659,-1,0,1,CB Defrost System: RIO-3, ON/OFF", "ELEC_INTERFACE(1),3100,PTR-RAZS-TMB-POSRIO3,TUMB,659,1,0,1,CB Defrost System: RIO-3, ON/OFF", "CPT_MECH(17),3006,PTR-RSPE-TMB-WINK002,BTN,925,1,0,1,Accelerometer Reset Button - Push to reset", "WEAPON_SYS(12),3098,PTR-LPE-TMB-FKP,TUMB,352,-1,0,1,Gun Camera Switch, ON/OFF", "WEAPON_SYS(12),3098,PTR-LPE-TMB-FKP,TUMB,352,1,0,1,Gun Camera Switch, ON/OFF", "ELEC_INTERFACE(1),3017,PTR-EEP-LVR-MODE,TUMB,535,0.1,0,1,AC Voltmeter Selector", "ELEC_INTERFACE(1),3017,PTR-EEP-LVR-MODE,TUMB,535,-0.1,0,1,AC Voltmeter Selector", "ELEC_INTERFACE(1),3092,PTR-RAZS-TMB-ANO,TUMB,651,-1,0,1,CB ANO, ON/OFF", "ELEC_INTERFACE(1),3092,PTR-RAZS-TMB-ANO,TUMB,651,1,0,1,CB ANO, ON/OFF", "ELEC_INTERFACE(1),3047,PTR-LAZS-TMB-PKT,TUMB,606,-1,0,1,CB PKT, ON/OFF", "ELEC_INTERFACE(1),3047,PTR-LAZS-TMB-PKT,TUMB,606,1,0,1,CB PKT, ON/OFF", "GMK1A(14),3005,PTR-RPE-LVR-CRDZK,BTN,477,1,0,1,GMC Course Setting Switch, CCW/OFF/CW)", "GMK1A(14),3005,PTR-RPE-LVR-CRDZK,BTN,477,-1,-1,0,GMC Course Setting Switch, CCW/OFF/CW)", "JADRO_1A(37),3001,PTR-ADDSECPLT-LVR-ONOFF,TUMB,744,0.5,0,1,Jadro 1A, Mode Switch, OFF/OM/AM", "JADRO_1A(37),3001,PTR-ADDSECPLT-LVR-ONOFF,TUMB,744,-0.5,0,1,Jadro 1A, Mode Switch, OFF/OM/AM", "SPU_7(36),3009,PTR-RAZS-LVR-ALL002,LEV,841,0,0,1,Common Volume Knob", "UV_26(48),3005,PTR-L8-BTN,BTN,863,1,0,1,CMD Num in Sequence Button", "WEAPON_SYS(12),3052,PTR-LAZS-CVR-EMRGJET,TUMB,571,-1,0,1,Emergency Release Switch Cover, OPEN/CLOSE", "WEAPON_SYS(12),3052,PTR-LAZS-CVR-EMRGJET,TUMB,571,1,0,1,Emergency Release Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3097,PTR-RAZS-TMB-POSDIR,TUMB,656,-1,0,1,CB Defrost System: Control, ON/OFF", "ELEC_INTERFACE(1),3097,PTR-RAZS-TMB-POSDIR,TUMB,656,1,0,1,CB Defrost System: Control, ON/OFF", "LIGHT_SYSTEM(46),3011,PTR-RSPE-LVR-REDGRP005,LEV,924,0,0,1,5.5V Lights Brightness Rheostat", "FIRE_EXTING_INTERFACE(19),3012,PTR-CPE-LVR-CONTR-MODE,TUMB,401,0.1,0,0.7,Check Fire Circuits Switch, OFF/CONTROL/1/2/3/4/5/6", "FIRE_EXTING_INTERFACE(19),3012,PTR-CPE-LVR-CONTR-MODE,TUMB,401,-0.1,0,0.7,Check Fire Circuits Switch, OFF/CONTROL/1/2/3/4/5/6", "FIRE_EXTING_INTERFACE(19),3002,PTR-CPE-BTN-QUE1-2,BTN,390,1,0,1,Main Discharge Right Engine Button", "ELEC_INTERFACE(1),3006,PTR-RSPE-TMB-RECT3,TUMB,501,-1,0,1,Rectifier 3 Switch, ON/OFF", "ELEC_INTERFACE(1),3006,PTR-RSPE-TMB-RECT3,TUMB,501,1,0,1,Rectifier 3 Switch, ON/OFF", "FUELSYS_INTERFACE(2),3006,PTR-CPE-TMB-PUMP-RATE,TUMB,438,-1,0,1,Feed Tank Pump Switch, ON/OFF", "FUELSYS_INTERFACE(2),3006,PTR-CPE-TMB-PUMP-RATE,TUMB,438,1,0,1,Feed Tank Pump Switch, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3001,PTR-STKSG-BTN-TACTJET,BTN,200,1,0,1,Tactical Cargo Release Button - Push to release", "PKV(47),3006,PTR-PKV-GLASS-FILTER,TUMB,903,-1,0,1,PKV Filter", "PKV(47),3006,PTR-PKV-GLASS-FILTER,TUMB,903,1,0,1,PKV Filter", "ELEC_INTERFACE(1),3104,PTR-RAZS-TMB-L1800,TUMB,663,-1,0,1,CB RIO-3, ON/OFF", "ELEC_INTERFACE(1),3104,PTR-RAZS-TMB-L1800,TUMB,663,1,0,1,CB RIO-3, ON/OFF", "ELEC_INTERFACE(1),3037,PTR-LAZS-TMB-RSGUV-WARM,TUMB,596,-1,0,1,CB ESBR Heating, ON/OFF", "ELEC_INTERFACE(1),3037,PTR-LAZS-TMB-RSGUV-WARM,TUMB,596,1,0,1,CB ESBR Heating, ON/OFF", "ELEC_INTERFACE(1),3059,PTR-SW-LOCKER-RES,TUMB,618,-1,0,1,CB Lock Opening Control Reserve, ON/OFF", "ELEC_INTERFACE(1),3059,PTR-SW-LOCKER-RES,TUMB,618,1,0,1,CB Lock Opening Control Reserve, ON/OFF", "ELEC_INTERFACE(1),3079,PTR-RAZS-TMB-PPSSIGN,TUMB,638,-1,0,1,CB Fire Protection System: Signalization, ON/OFF", "ELEC_INTERFACE(1),3079,PTR-RAZS-TMB-PPSSIGN,TUMB,638,1,0,1,CB Fire Protection System: Signalization, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3005,PTR-LSPE-TMB-BRK-OUT,TUMB,324,-1,0,1,External Cargo Automatic Dropping, ON/OFF", "EXT_CARGO_EQUIPMENT(51),3005,PTR-LSPE-TMB-BRK-OUT,TUMB,324,1,0,1,External Cargo Automatic Dropping, ON/OFF", "NAVLIGHT_SYSTEM(9),3016,PTR-LSPE-TMB-AIR-CODE,BTN,322,1,0,1,ANO Code Button", "ELEC_INTERFACE(1),3052,PTR-RAZS-TMB-START-TRBON,TUMB,611,-1,0,1,CB APU Start, ON/OFF", "ELEC_INTERFACE(1),3052,PTR-RAZS-TMB-START-TRBON,TUMB,611,1,0,1,CB APU Start, ON/OFF", "ELEC_INTERFACE(1),3031,PTR-LAZS-TMB-BV-ZSBR,TUMB,590,-1,0,1,CB BW ESBR, ON/OFF", "ELEC_INTERFACE(1),3031,PTR-LAZS-TMB-BV-ZSBR,TUMB,590,1,0,1,CB BW ESBR, ON/OFF", "ENGINE_INTERFACE(3),3027,PTR-CPE-TMB-ENGSTART-ROLL,TUMB,423,1,-1,1,Engine Start Mode Switch, START/OFF/COLD CRANKING", "ENGINE_INTERFACE(3),3027,PTR-CPE-TMB-ENGSTART-ROLL,TUMB,423,-1,-1,1,Engine Start Mode Switch, START/OFF/COLD CRANKING", "ELEC_INTERFACE(1),3020,PTR-APP-TMB-TRNS,TUMB,149,1,-1,1,36V Transformer Switch, MAIN/OFF/AUXILIARY", "ELEC_INTERFACE(1),3020,PTR-APP-TMB-TRNS,TUMB,149,-1,-1,1,36V Transformer Switch, MAIN/OFF/AUXILIARY", "ELEC_INTERFACE(1),3007,PTR-RSPE-TMB-RECT1,TUMB,499,-1,0,1,Rectifier 1 Switch, ON/OFF", "ELEC_INTERFACE(1),3007,PTR-RSPE-TMB-RECT1,TUMB,499,1,0,1,Rectifier 1 Switch, ON/OFF", "ELEC_INTERFACE(1),3056,PTR-RAZS-TMB-RPM,TUMB,615,-1,0,1,CB RPM CONTROL, ON/OFF", "ELEC_INTERFACE(1),3056,PTR-RAZS-TMB-RPM,TUMB,615,1,0,1,CB RPM CONTROL, ON/OFF", "ENGINE_INTERFACE(3),3039,PTR-RSPE-TMB-WRMPVD-R,TUMB,520,-1,0,1,Right Pitot Heater Switch, ON/OFF", "ENGINE_INTERFACE(3),3039,PTR-RSPE-TMB-WRMPVD-R,TUMB,520,1,0,1,Right Pitot Heater Switch, ON/OFF", "FUELSYS_INTERFACE(2),3005,PTR-CPE-TMB-PUMPTNK-R,TUMB,440,-1,0,1,Right Tank Pump Switch, ON/OFF", "FUELSYS_INTERFACE(2),3005,PTR-CPE-TMB-PUMPTNK-R,TUMB,440,1,0,1,Right Tank Pump Switch, ON/OFF", "ENGINE_INTERFACE(3),3001,PTR-APP-TMB-ERD-L,TUMB,167,-1,0,1,Left Engine EEC Switch, ON/OFF", "ENGINE_INTERFACE(3),3001,PTR-APP-TMB-ERD-L,TUMB,167,1,0,1,Left Engine EEC Switch, ON/OFF", "FUELSYS_INTERFACE(2),3008,PTR-FUEL-LVR-MODE,TUMB,61,0.1,0,0.5,Fuel Meter Switch, OFF/SUM/LEFT/RIGHT/FEED/ADDITIONAL", "FUELSYS_INTERFACE(2),3008,PTR-FUEL-LVR-MODE,TUMB,61,-0.1,0,0.5,Fuel Meter Switch, OFF/SUM/LEFT/RIGHT/FEED/ADDITIONAL", "ELEC_INTERFACE(1),3086,PTR-RAZS-TMB-RADDISS,TUMB,645,-1,0,1,CB Radio: Doppler Navigator, ON/OFF", "ELEC_INTERFACE(1),3086,PTR-RAZS-TMB-RADDISS,TUMB,645,1,0,1,CB Radio: Doppler Navigator, ON/OFF", "ELEC_INTERFACE(1),3003,PTR-RSPE-TMB-AKK1,TUMB,495,-1,0,1,Battery 1 Switch, ON/OFF", "ELEC_INTERFACE(1),3003,PTR-RSPE-TMB-AKK1,TUMB,495,1,0,1,Battery 1 Switch, ON/OFF", "WEAPON_SYS(12),3030,PTR-LAZS-TMB-RSGUV,TUMB,575,-1,0,1,RS/GUV Selector Switch, ON/OFF", "WEAPON_SYS(12),3030,PTR-LAZS-TMB-RSGUV,TUMB,575,1,0,1,RS/GUV Selector Switch, ON/OFF", "LIGHT_SYSTEM(46),3008,PTR-RSPE-LVR-REDGRP2,LEV,492,0,0,1,Right Red Lights Brightness Group 2 Rheostat", "HEATER_KO50(53),3003,PTR-RPE-TMB-KO50MODE,TUMB,465,1,-1,1,KO-50 Heater Mode Switch, MANUAL/OFF/AUTO", "HEATER_KO50(53),3003,PTR-RPE-TMB-KO50MODE,TUMB,465,-1,-1,1,KO-50 Heater Mode Switch, MANUAL/OFF/AUTO", "SIGNAL_FLARES(52),3003,PTR-LSPE-BTN-RCKT11,TUMB,284,-1,0,1,Signal Flares Cassette 1 Launch Red Button", "SIGNAL_FLARES(52),3003,PTR-LSPE-BTN-RCKT11,TUMB,284,1,0,1,Signal Flares Cassette 1 Launch Red Button", "ENGINE_INTERFACE(3),3005,PTR-CPE-BTN-ENGSTART-ON,BTN,419,1,0,1,Engine Start Button - Push to start engine", "WEAPON_SYS(12),3077,PTR-RSPE-TMB-PKT,TUMB,905,-1,0,1,PKT Selector Switch, FLIGHT ENGINEER/PILOT", "WEAPON_SYS(12),3077,PTR-RSPE-TMB-PKT,TUMB,905,1,0,1,PKT Selector Switch, FLIGHT ENGINEER/PILOT", "ENGINE_INTERFACE(3),3026,PTR-CPE-BTN-TURBOSTART-ON,BTN,413,1,0,1,APU Start Button - Push to start APU", "ELEC_INTERFACE(1),3065,PTR-RAZS-TMB-GSDBL,TUMB,624,-1,0,1,CB Hydraulics: Auxiliary, ON/OFF", "ELEC_INTERFACE(1),3065,PTR-RAZS-TMB-GSDBL,TUMB,624,1,0,1,CB Hydraulics: Auxiliary, ON/OFF", "DISS_15(15),3001,PTR-RES-TMB-DISS,TUMB,483,-1,0,1,Doppler Navigator Power Switch, ON/OFF", "DISS_15(15),3001,PTR-RES-TMB-DISS,TUMB,483,1,0,1,Doppler Navigator Power Switch, ON/OFF", "ELEC_INTERFACE(1),3045,PTR-LAZS-TMB-ES-800L,TUMB,604,-1,0,1,CB Electric Launch 800 Left, ON/OFF", "ELEC_INTERFACE(1),3045,PTR-LAZS-TMB-ES-800L,TUMB,604,1,0,1,CB Electric Launch 800 Left, ON/OFF",
-        "SPU_7(36),3010,PTR-RAZS-LVR-AUDIT002,LEV,840,0,0,1,Listening Volume Knob", "WEAPON_SYS(12),3045,PTR-LPE-TMB-PYRO-R,TUMB,351,0.1,0,0.3,Right PYROCARTRIDGE Switch, I/II/III", "WEAPON_SYS(12),3045,PTR-LPE-TMB-PYRO-R,TUMB,351,-0.1,0,0.3,Right PYROCARTRIDGE Switch, I/II/III", "CPT_MECH(17),3017,PTR-WHEELBRK-ARM,BTN,881,1,0,1,Wheel Brakes Handle", "ELEC_INTERFACE(1),3082,PTR-RAZS-TMB-PPSQUE2-L,TUMB,641,-1,0,1,CB Fire Protection System: 2 Queue Left, ON/OFF", "ELEC_INTERFACE(1),3082,PTR-RAZS-TMB-PPSQUE2-L,TUMB,641,1,0,1,CB Fire Protection System: 2 Queue Left, ON/OFF", "ARC_UD(41),3005,PTR-RPE-LVR-ARKVOL,LEV,455,0,0,1,ARC-UD, Volume Knob", "FUELSYS_INTERFACE(2),3010,PTR-CPE-CVR-PUMP-R,TUMB,428,-1,0,1,Right Shutoff Valve Switch Cover, OPEN/CLOSE", "FUELSYS_INTERFACE(2),3010,PTR-CPE-CVR-PUMP-R,TUMB,428,1,0,1,Right Shutoff Valve Switch Cover, OPEN/CLOSE", "UV_26(48),3007,PTR-START-BTN,BTN,866,1,0,1,CMD Start Dispense Button", "ENGINE_INTERFACE(3),3071,PTR-STKSEC-ARM-L,LEV,0,0,-1,1,Left Engine Throttle", "AGB_3K_LEFT(6),3002,PTR-AGB-LVR-KNOB,BTN,11,1,0,1,Left Attitude Indicator Cage Knob - Push to cage", "FUELSYS_INTERFACE(2),3009,PTR-CPE-CVR-PUMP-L,TUMB,426,-1,0,1,Left Shutoff Valve Switch Cover, OPEN/CLOSE", "FUELSYS_INTERFACE(2),3009,PTR-CPE-CVR-PUMP-L,TUMB,426,1,0,1,Left Shutoff Valve Switch Cover, OPEN/CLOSE", "HYDRO_SYS_INTERFACE(4),3006,PTR-CPE-CVR-HYDRO-DBL,TUMB,409,-1,0,1,Auxiliary Hydraulic Switch Cover, OPEN/CLOSE", "HYDRO_SYS_INTERFACE(4),3006,PTR-CPE-CVR-HYDRO-DBL,TUMB,409,1,0,1,Auxiliary Hydraulic Switch Cover, OPEN/CLOSE", "HEATER_KO50(53),3001,PTR-RPE-BTN-KO50START,BTN,464,1,0,1,KO-50 Heater Start Button - Push to start", "HYDRO_SYS_INTERFACE(4),3003,PTR-CPE-BTN-DBLOFF,BTN,411,1,0,1,Auxiliary Hydraulic Shut Off Button - Push to shut off", "SPU_7(36),3008,PTR-LAZS-BTN-CB,BTN,552,1,0,1,Circular Call Button (N/F)", "CPT_MECH(17),3025,PTR-LES-TMB-GLSCLN-LOWSPEED,TUMB,331,0.4,0.4,0.4,Left Windscreen Wiper Control Switch, SPEED 2", "R_828(39),3006,PTR-ADDSECPLT-TMB-MODSEL,TUMB,757,-1,0,1,R-828, Compass Switch, COMM/NAV", "R_828(39),3006,PTR-ADDSECPLT-TMB-MODSEL,TUMB,757,1,0,1,R-828, Compass Switch, COMM/NAV", "ELEC_INTERFACE(1),3093,PTR-RAZS-TMB-WNGLGT,TUMB,652,-1,0,1,CB Wing Lights, ON/OFF", "ELEC_INTERFACE(1),3093,PTR-RAZS-TMB-WNGLGT,TUMB,652,1,0,1,CB Wing Lights, ON/OFF", "NAVLIGHT_SYSTEM(9),3019,PTR-LEFT-TAXI-R-POS-SW,TUMB,838,1,-1,1,Right Landing Light Switch, LIGHT/OFF/RETRACT", "NAVLIGHT_SYSTEM(9),3019,PTR-LEFT-TAXI-R-POS-SW,TUMB,838,-1,-1,1,Right Landing Light Switch, LIGHT/OFF/RETRACT", "ARC_UD(41),3008,PTR-RPE-BTN-ANTR,BTN,674,1,0,1,ARC-UD, Right Antenna Button", "ELEC_INTERFACE(1),3032,PTR-LAZS-TMB-BV-EXP,TUMB,591,-1,0,1,CB Explode, ON/OFF", "ELEC_INTERFACE(1),3032,PTR-LAZS-TMB-BV-EXP,TUMB,591,1,0,1,CB Explode, ON/OFF", "SIGNAL_FLARES(52),3009,PTR-LSPE-BTN-RCKT24,TUMB,291,-1,0,1,Signal Flares Cassette 2 Launch White Button", "SIGNAL_FLARES(52),3009,PTR-LSPE-BTN-RCKT24,TUMB,291,1,0,1,Signal Flares Cassette 2 Launch White Button", "ELEC_INTERFACE(1),3027,PTR-GRAZS-8,BTN,889,1,0,1,CB Group 6 ON", "WEAPON_SYS(12),3076,PTR-LAZS-TMB-MAINOFF,TUMB,573,-1,0,1,Mine Arms Main Switch, ON/OFF", "WEAPON_SYS(12),3076,PTR-LAZS-TMB-MAINOFF,TUMB,573,1,0,1,Mine Arms Main Switch, ON/OFF", "ENGINE_INTERFACE(3),3038,PTR-RSPE-TMB-WRMPVD-L,TUMB,519,-1,0,1,Left Pitot Heater Switch, ON/OFF", "ENGINE_INTERFACE(3),3038,PTR-RSPE-TMB-WRMPVD-L,TUMB,519,1,0,1,Left Pitot Heater Switch, ON/OFF", "ENGINE_INTERFACE(3),3003,PTR-APP-TMB-ERD-R,TUMB,173,-1,0,1,Right Engine EEC Switch, ON/OFF", "ENGINE_INTERFACE(3),3003,PTR-APP-TMB-ERD-R,TUMB,173,1,0,1,Right Engine EEC Switch, ON/OFF", "VMS(11),3004,PTR-LSPE-BTN-RI65-TEST,BTN,294,1,0,1,RI-65 Check Button", "ENGINE_INTERFACE(3),3050,PTR-APP-TMB-ST-L,BTN,169,1,0,1,Left Engine FT Check Switch, ST1/WORK/ST2", "ENGINE_INTERFACE(3),3050,PTR-APP-TMB-ST-L,BTN,169,-1,-1,0,Left Engine FT Check Switch, ST1/WORK/ST2", "ELEC_INTERFACE(1),3025,PTR-GRAZS-2,BTN,883,1,0,1,CB Group 4 ON", "AUTOPILOT(16),3021,PTR-APP-BTN-KTON,LEV,870,0,0,0.2,Autopilot Pitch/Roll ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "AUTOPILOT(16),3002,PTR-APP-BTN-KTON,BTN,138,1,0,1,Autopilot Pitch/Roll ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity", "WEAPON_SYS(12),3026,PTR-LAZS-BTN-LAMPTEST,BTN,576,1,0,1,Lamps Check Button - Push to check", "WEAPON_SYS(12),3013,PTR-ADDPBV-LVR-MODE,TUMB,719,0.1,0,0.5,Pod Variants Selector Switch", "WEAPON_SYS(12),3013,PTR-ADDPBV-LVR-MODE,TUMB,719,-0.1,0,0.5,Pod Variants Selector Switch", "SPUU_52(8),3002,PTR-APP-LVR-ADJ,LEV,128,1,0,1,SPUU-52 Adjustment Knob", "FM_PROXY(25),3001,PTR-STAT-PRESS,TUMB,839,-0.1,0,0.2,Static Pressure System Mode Selector, LEFT/COMMON/RIGHT", "FM_PROXY(25),3001,PTR-STAT-PRESS,TUMB,839,0.1,0,0.2,Static Pressure System Mode Selector, LEFT/COMMON/RIGHT", "WEAPON_SYS(12),3022,PTR-LPE-TMB-RS,TUMB,344,1,-1,1,UPK/PKT/RS Switch", "WEAPON_SYS(12),3022,PTR-LPE-TMB-RS,TUMB,344,-1,-1,1,UPK/PKT/RS Switch", "FIRE_EXTING_INTERFACE(19),3004,PTR-CPE-BTN-QUE1-4,BTN,392,1,0,1,Main Discharge APU GEAR Button", "HYDRO_SYS_INTERFACE(4),3002,PTR-CPE-TMB-HYDRO-DBL,TUMB,410,-1,0,1,Auxiliary Hydraulic Switch, ON/OFF", "HYDRO_SYS_INTERFACE(4),3002,PTR-CPE-TMB-HYDRO-DBL,TUMB,410,1,0,1,Auxiliary Hydraulic Switch, ON/OFF", "WEAPON_SYS(12),3083,PTR-RS-R,BTN,229,1,0,1,Right Fire RS Button", "WEAPON_SYS(12),3041,PTR-LAZS-TMB-MAINOFF05,TUMB,349,-1,0,1,800_or_624_622_800 Switch", "WEAPON_SYS(12),3041,PTR-LAZS-TMB-MAINOFF05,TUMB,349,1,0,1,800_or_624_622_800 Switch", "UV_26(48),3004,PTR-L45-BTN,BTN,914,1,0,1,CMD Num of Sequences Button", "ENGINE_INTERFACE(3),3019,PTR-LSPE-BTN-CONTR-RTL,BTN,313,1,0,1,Left Engine Temperature Regulator Test Button - Push to test",
-        "ELEC_INTERFACE(1),3035,PTR-LAZS-TMB-RSGUV-FIRE,TUMB,594,-1,0,1,CB RS/GUV Fire, ON/OFF", "ELEC_INTERFACE(1),3035,PTR-LAZS-TMB-RSGUV-FIRE,TUMB,594,1,0,1,CB RS/GUV Fire, ON/OFF", "SPU_7(36),3012,PTR-RAZS-TMB-RADSPU002,TUMB,845,-1,0,1,Radio/ICS Switch", "SPU_7(36),3012,PTR-RAZS-TMB-RADSPU002,TUMB,845,1,0,1,Radio/ICS Switch", "FIRE_EXTING_INTERFACE(19),3005,PTR-CPE-BTN-QUE2-1,BTN,393,1,0,1,Alternate Discharge Left Engine Button", "ELEC_INTERFACE(1),3084,PTR-RAZS-TMB-RADCMP-SV,TUMB,643,-1,0,1,CB Radio: Radio Compass MW(ARC-9), ON/OFF", "ELEC_INTERFACE(1),3084,PTR-RAZS-TMB-RADCMP-SV,TUMB,643,1,0,1,CB Radio: Radio Compass MW(ARC-9), ON/OFF", "SPU_7(36),3001,PTR-LAZS-LVR-ALL,LEV,549,0,0,1,Common Volume Knob", "ENGINE_INTERFACE(3),3011,PTR-VINTBRAKE-ARM,TUMB,208,-1,0,1,Rotor Brake Handle, UP/DOWN", "ENGINE_INTERFACE(3),3011,PTR-VINTBRAKE-ARM,TUMB,208,1,0,1,Rotor Brake Handle, UP/DOWN", "ELEC_INTERFACE(1),3005,PTR-RSPE-TMB-RECT2,TUMB,500,-1,0,1,Rectifier 2 Switch, ON/OFF", "ELEC_INTERFACE(1),3005,PTR-RSPE-TMB-RECT2,TUMB,500,1,0,1,Rectifier 2 Switch, ON/OFF", "ELEC_INTERFACE(1),3028,PTR-GRAZS-3,BTN,884,1,0,1,CB Group 7 ON"],
-    "MiG-15bis": ["ARC_5(29),3004,pnt_177,TUMB,177,0.1,0,0.2,ARK-5 Frequency Band Switch", "ARC_5(29),3004,pnt_177,TUMB,177,-0.1,0,0.2,ARK-5 Frequency Band Switch", "GEAR_INTERFACE(13),3001,pnt_071,TUMB,71,0.5,0,1,Landing Gear Handle, UP/DOWN", "GEAR_INTERFACE(13),3001,pnt_071,TUMB,71,-0.5,0,1,Landing Gear Handle, UP/DOWN", "ELEC_INTERFACE(2),3022,pnt_116,TUMB,116,-1,0,1,Instruments and Lights Switch, ON/OFF", "ELEC_INTERFACE(2),3022,pnt_116,TUMB,116,1,0,1,Instruments and Lights Switch, ON/OFF", "ELEC_INTERFACE(2),3016,pnt_160,TUMB,160,-1,0,1,RV-2 Radio Altimeter Switch, ON/OFF", "ELEC_INTERFACE(2),3016,pnt_160,TUMB,160,1,0,1,RV-2 Radio Altimeter Switch, ON/OFF", "GEAR_INTERFACE(13),3005,pnt_210,BTN,210,1,0,1,Right Emergency Gear Release Handle - Pull to release", "WEAPON_SYSTEM(4),3004,pnt_097,BTN,97,1,0,1,Emergency Release Button - Push to release", "ELEC_INTERFACE(2),3007,pnt_084,BTN,84,1,0,1,Ampere- & Voltmeter - Push to view Volts", "ELEC_INTERFACE(2),3018,pnt_115,TUMB,115,-1,0,1,Booster Pump Switch, ON/OFF", "ELEC_INTERFACE(2),3018,pnt_115,TUMB,115,1,0,1,Booster Pump Switch, ON/OFF", "SIGNAL_FLARE_DISPENSER(28),3002,pnt_131,TUMB,131,-1,0,1,Signal Flare Green Button - Push to launch", "SIGNAL_FLARE_DISPENSER(28),3002,pnt_131,TUMB,131,1,0,1,Signal Flare Green Button - Push to launch", "AIR_INTERFACE(8),3001,pnt_187,LEV,187,0,0,1,Cockpit Air Valve", "CPT_MECH(15),3005,pnt_224,TUMB,,-2,-1,1,Aft Canopy Lever, CLOSE", "ELEC_INTERFACE(2),3001,pnt_152,TUMB,152,-1,0,1,Accumulator Switch, ON/OFF", "ELEC_INTERFACE(2),3001,pnt_152,TUMB,152,1,0,1,Accumulator Switch, ON/OFF", "AIR_INTERFACE(8),3002,pnt_086,LEV,86,0,0,1,Ventilation Valve", "ENGINE_INTERFACE(11),3002,pnt_118,TUMB,118,-1,0,1,Isolating Valve Switch, ON/OFF", "ENGINE_INTERFACE(11),3002,pnt_118,TUMB,118,1,0,1,Isolating Valve Switch, ON/OFF", "SIGNAL_FLARE_DISPENSER(28),3004,pnt_133,TUMB,133,-1,0,1,Signal Flare White Button - Push to launch", "SIGNAL_FLARE_DISPENSER(28),3004,pnt_133,TUMB,133,1,0,1,Signal Flare White Button - Push to launch", "FIRE_EXTING_INTERFACE(17),3003,pnt_137,BTN,137,1,0,1,Engine Fire Extinguisher Button - Push to extinguish", "WEAPON_SYSTEM(4),3005,pnt_092,BTN,92,1,0,1,N-37D Cannon Reload Button - Press and hold to reload", "CONTROL_INTERFACE(3),3003,pnt_207,TUMB,207,0.5,-1,0.5,Wing Flaps Handle, RETRACT/NEUTRAL/20 degrees/55 degrees", "CONTROL_INTERFACE(3),3003,pnt_207,TUMB,207,-0.5,-1,0.5,Wing Flaps Handle, RETRACT/NEUTRAL/20 degrees/55 degrees", "RADAR_ALTIMETER(16),3004,pnt_036,TUMB,36,-1,0,1,PRV-46 Radar Altimeter Indicator Range Switch, 120m/1200m AGL", "RADAR_ALTIMETER(16),3004,pnt_036,TUMB,36,1,0,1,PRV-46 Radar Altimeter Indicator Range Switch, 120m/1200m AGL", "CLOCK(7),3005,pnt_025,LEV,26,0.05,-0.15,0.15,AChS-1 Cockpit Chronograph Right Knob", "CLOCK(7),3004,pnt_025,BTN,25,1,0,1,AChS-1 Cockpit Chronograph Right Knob", "ELEC_INTERFACE(2),3012,pnt_154,TUMB,154,-1,0,1,Trim Master Switch, ON/OFF", "ELEC_INTERFACE(2),3012,pnt_154,TUMB,154,1,0,1,Trim Master Switch, ON/OFF", "ELEC_INTERFACE(2),3021,pnt_156,TUMB,156,-1,0,1,Emergency Drop Switch, ON/OFF", "ELEC_INTERFACE(2),3021,pnt_156,TUMB,156,1,0,1,Emergency Drop Switch, ON/OFF", "REMOTE_COMPASS(21),3003,pnt_061,BTN,61,1,0,1,Fast Slave Button", "OXYGEN_INTERFACE(9),3002,pnt_243,LEV,243,0,0,1,Oxygen Emergency Valve", "WEAPON_SYSTEM(4),3003,pnt_195,BTN,195,1,0,1,Weapon Release Button - Push to release", "ELEC_INTERFACE(2),3010,pnt_157,TUMB,157,-1,0,1,Bombs Switch, ON/OFF", "ELEC_INTERFACE(2),3010,pnt_157,TUMB,157,1,0,1,Bombs Switch, ON/OFF", "CONTROL_INTERFACE(3),3001,pnt_142,BTN,142,1,0,1,Aileron Trimmer Switch, LEFT/OFF/RIGHT", "CONTROL_INTERFACE(3),3001,pnt_142,BTN,142,-1,-1,0,Aileron Trimmer Switch, LEFT/OFF/RIGHT", "FIRE_EXTING_INTERFACE(17),3002,pnt_136,TUMB,136,-1,0,1,Engine Fire Extinguisher Button Cover, OPEN/CLOSE", "FIRE_EXTING_INTERFACE(17),3002,pnt_136,TUMB,136,1,0,1,Engine Fire Extinguisher Button Cover, OPEN/CLOSE", "ELEC_INTERFACE(2),3005,pnt_149,TUMB,149,-1,0,1,Air Start Switch, ON/OFF", "ELEC_INTERFACE(2),3005,pnt_149,TUMB,149,1,0,1,Air Start Switch, ON/OFF", "RSI_6K(30),3006,pnt_230,LEV,230,0.8,0,1,RSI-6K Antenna Control Handle", "SIGNAL_FLARE_DISPENSER(28),3001,pnt_129,TUMB,129,-1,0,1,Signal Flare Switch, ON/OFF", "SIGNAL_FLARE_DISPENSER(28),3001,pnt_129,TUMB,129,1,0,1,Signal Flare Switch, ON/OFF", "GEAR_INTERFACE(13),3003,pnt_072,BTN,72,1,0,1,Gear Lamps Test Button - Push to test", "NAVLIGHT_SYSTEM(14),3002,pnt_080,TUMB,80,-1,0,1,Nose Light Switch, ON/OFF", "NAVLIGHT_SYSTEM(14),3002,pnt_080,TUMB,80,1,0,1,Nose Light Switch, ON/OFF", "HYDROSYS_INTERFACE(12),3006,pnt_242,LEV,242,1,0,1,Air Net Valve", "ELEC_INTERFACE(2),3014,pnt_158,TUMB,158,-1,0,1,Radio Switch, ON/OFF", "ELEC_INTERFACE(2),3014,pnt_158,TUMB,158,1,0,1,Radio Switch, ON/OFF", "CONTROL_INTERFACE(3),3002,pnt_114,BTN,114,-1,-1,0,Elevator Trimmer Switch, PULL(CLIMB)/OFF/PUSH(DESCEND)", "CONTROL_INTERFACE(3),3002,pnt_114,BTN,114,1,0,1,Elevator Trimmer Switch, PULL(CLIMB)/OFF/PUSH(DESCEND)", "ELEC_INTERFACE(2),3023,pnt_164,TUMB,164,-1,0,1,S-13 Gun Camera Switch, ON/OFF", "ELEC_INTERFACE(2),3023,pnt_164,TUMB,164,1,0,1,S-13 Gun Camera Switch, ON/OFF", "LIGHT_SYSTEM(22),3001,pnt_184,LEV,184,0,0.23,0.82,Left UV Light Rheostat", "SIGNAL_FLARE_DISPENSER(28),3005,pnt_130,TUMB,130,-1,0,1,Signal Flare Yellow Button - Push to launch", "SIGNAL_FLARE_DISPENSER(28),3005,pnt_130,TUMB,130,1,0,1,Signal Flare Yellow Button - Push to launch", "ELEC_INTERFACE(2),3019,pnt_120,TUMB,120,-1,0,1,Ignition Switch, ON/OFF", "ELEC_INTERFACE(2),3019,pnt_120,TUMB,120,1,0,1,Ignition Switch, ON/OFF", "NAVLIGHT_SYSTEM(14),3001,pnt_111,TUMB,111,-1,0,1,External Lights Switch, ON/OFF", "NAVLIGHT_SYSTEM(14),3001,pnt_111,TUMB,111,1,0,1,External Lights Switch, ON/OFF", "GEAR_INTERFACE(13),3004,pnt_209,BTN,209,1,0,1,Left Emergency Gear Release Handle - Pull to release", "HYDROSYS_INTERFACE(12),3002,pnt_167,LEV,167,1,0,1,Emergency Gears Valve", "WEAPON_SYSTEM(4),3008,pnt_096,TUMB,96,-1,0,1,Tactical Release Switch, ON/OFF", "WEAPON_SYSTEM(4),3008,pnt_096,TUMB,96,1,0,1,Tactical Release Switch, ON/OFF", "WEAPON_SYSTEM(4),3001,pnt_193,BTN,193,1,0,1,N-37D Cannon Fire Button - Push to fire", "CONTROL_INTERFACE(3),3004,pnt_198,BTN,198,1,0,1,Airbrake Button, Hold to extend", "SIGNAL_FLARE_DISPENSER(28),3003,pnt_132,TUMB,132,-1,0,1,Signal Flare Red Button - Push to launch", "SIGNAL_FLARE_DISPENSER(28),3003,pnt_132,TUMB,132,1,0,1,Signal Flare Red Button - Push to launch", "CONTROL_INTERFACE(3),3005,pnt_125,TUMB,125,-1,0,1,Airbrake Switch, CLOSE/OPEN", "CONTROL_INTERFACE(3),3005,pnt_125,TUMB,125,1,0,1,Airbrake Switch, CLOSE/OPEN", "ENGINE_INTERFACE(11),3001,pnt_208,LEV,208,-1,0,1,Engine Stop Lever, CLOSE/OPEN", "WEAPON_SYSTEM(4),3010,pnt_196,TUMB,196,-1,0,1,Guns Safety Cover, OPEN/CLOSE", "WEAPON_SYSTEM(4),3010,pnt_196,TUMB,196,1,0,1,Guns Safety Cover, OPEN/CLOSE", "ELEC_INTERFACE(2),3002,pnt_153,TUMB,153,-1,0,1,Generator Switch, ON/OFF", "ELEC_INTERFACE(2),3002,pnt_153,TUMB,153,1,0,1,Generator Switch, ON/OFF", "ASP_3N(26),3011,pnt_106,TUMB,106,0,0,0.95,ASP-3N Gunsight Fixed Reticle Mask Lever, SET UP/REMOVE", "ASP_3N(26),3011,pnt_106,TUMB,106,0.95,0,0.95,ASP-3N Gunsight Fixed Reticle Mask Lever, SET UP/REMOVE", "ASP_3N(26),3001,pnt_103,LEV,103,0,0,1,ASP-3N Gunsight Target Wingspan Adjustment Dial (meters)", "ELEC_INTERFACE(2),3004,pnt_214,TUMB,214,-1,0,1,Engine Start Button Cover, Cover/Uncover", "ELEC_INTERFACE(2),3004,pnt_214,TUMB,214,1,0,1,Engine Start Button Cover, Cover/Uncover", "ARC_5(29),3003,pnt_174,TUMB,174,0.1,0,0.3,ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP", "ARC_5(29),3003,pnt_174,TUMB,174,-0.1,0,0.3,ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP", "REMOTE_COMPASS(21),3001,pnt_034,LEV,34,1,0,1,Heading Knob", "ASP_3N(26),3012,pnt_105,TUMB,105,0,0,1,ASP-3N Gunsight Color Filter, ON/OFF", "ASP_3N(26),3012,pnt_105,TUMB,105,1,0,1,ASP-3N Gunsight Color Filter, ON/OFF", "ARC_5(29),3001,pnt_180,LEV,180,0.8,0.1,0.9,ARK-5 Audio Volume Knob", "ARC_5(29),3005,pnt_175,LEV,,0.3,0,1,ARK-5 Tuning Crank", "ASP_3N(26),3004,pnt_102,LEV,102,0,0,1,ASP-3N Gunsight Brightness Knob", "ARC_5(29),3006,pnt_178,BTN,178,1,0,1,ARK-5 LOOP L-R Switch", "ARC_5(29),3006,pnt_178,BTN,178,-1,-1,0,ARK-5 LOOP L-R Switch", "ELEC_INTERFACE(2),3013,pnt_151,TUMB,151,-1,0,1,Nose Light Master Switch, ON/OFF", "ELEC_INTERFACE(2),3013,pnt_151,TUMB,151,1,0,1,Nose Light Master Switch, ON/OFF", "ARC_5(29),3007,pnt_181,LEV,181,0.8,0.1,0.9,ARK-5 Scale Light Knob", "HYDROSYS_INTERFACE(12),3001,pnt_171,LEV,171,1,0,1,Emergency Flaps Valve", "FUELSYS_INTERFACE(10),3001,pnt_082,TUMB,82,-1,0,1,Drop Tank Signal Switch, ON/OFF", "FUELSYS_INTERFACE(10),3001,pnt_082,TUMB,82,1,0,1,Drop Tank Signal Switch, ON/OFF", "CPT_MECH(15),3006,pnt_221,TUMB,221,0,0,1,Emergency Canopy Jettison - Pull to jettison", "CPT_MECH(15),3006,pnt_221,TUMB,221,1,0,1,Emergency Canopy Jettison - Pull to jettison", "ELEC_INTERFACE(2),3017,pnt_117,TUMB,117,-1,0,1,Transfer Pump Switch, ON/OFF", "ELEC_INTERFACE(2),3017,pnt_117,TUMB,117,1,0,1,Transfer Pump Switch, ON/OFF", "ARC_5(29),3002,pnt_173,TUMB,173,-1,0,1,ARK-5 TLG-TLF Switch, TLG/TLF", "ARC_5(29),3002,pnt_173,TUMB,173,1,0,1,ARK-5 TLG-TLF Switch, TLG/TLF", "AGK47B(25),3003,pnt_013,LEV,13,0,0,1,AGK-47B Artificial Horizon Zero Pitch Trim Knob", "RSI_6K(30),3004,pnt_232,LEV,232,0.8,0,1,RSI-6K Wave Control Handle", "ARC_5(29),3009,pnt_123,TUMB,123,-1,0,1,ARK-5 Near/Far NDB Switch, NEAR/FAR", "ARC_5(29),3009,pnt_123,TUMB,123,1,0,1,ARK-5 Near/Far NDB Switch, NEAR/FAR", "ARC_5(29),3010,pnt_146,TUMB,146,-1,0,1,ARK-5 NDB 1 Switch, ON/OFF", "ARC_5(29),3010,pnt_146,TUMB,146,1,0,1,ARK-5 NDB 1 Switch, ON/OFF", "ELEC_INTERFACE(2),3008,pnt_161,TUMB,161,-1,0,1,NR-23 Cannon Switch, ON/OFF", "ELEC_INTERFACE(2),3008,pnt_161,TUMB,161,1,0,1,NR-23 Cannon Switch, ON/OFF", "ARC_5(29),3011,pnt_147,TUMB,147,-1,0,1,ARK-5 NDB 2 Switch, ON/OFF", "ARC_5(29),3011,pnt_147,TUMB,147,1,0,1,ARK-5 NDB 2 Switch, ON/OFF", "ASP_3N(26),3003,pnt_101,TUMB,101,-1,0,1,ASP-3N Gunsight Mode, GYRO/FIXED", "ASP_3N(26),3003,pnt_101,TUMB,101,1,0,1,ASP-3N Gunsight Mode, GYRO/FIXED",
-        "ARC_5(29),3012,pnt_148,TUMB,148,-1,0,1,ARK-5 NDB 3 Switch, ON/OFF", "ARC_5(29),3012,pnt_148,TUMB,148,1,0,1,ARK-5 NDB 3 Switch, ON/OFF", "CONTROL_INTERFACE(3),3006,pnt_203,TUMB,203,0,0,1,Hydro Booster Lever, ON/OFF", "CONTROL_INTERFACE(3),3006,pnt_203,TUMB,203,1,0,1,Hydro Booster Lever, ON/OFF", "BAR_ALTIMETER(19),3001,pnt_030,LEV,30,1,0,1,Barometric Pressure QFE Knob", "LIGHT_SYSTEM(22),3003,pnt_220,LEV,220,0,0.1,0.9,Panels Light Rheostat", "RSI_6K(30),3008,pnt_140,TUMB,140,-1,0,1,RSI-6K Receive/ARC Switch, RECEIVE/ARC", "RSI_6K(30),3008,pnt_140,TUMB,140,1,0,1,RSI-6K Receive/ARC Switch, RECEIVE/ARC", "RADAR_ALTIMETER(16),3003,pnt_037,TUMB,37,0,0,0.25,PRV-46 Radar Altimeter Indicator Power Switch, ON/OFF", "RADAR_ALTIMETER(16),3003,pnt_037,TUMB,37,0.25,0,0.25,PRV-46 Radar Altimeter Indicator Power Switch, ON/OFF", "ARC_5(29),3008,pnt_182,BTN,182,1,0,1,ARK-5 Take Control Button - Push to take control", "AGK47B(25),3002,pnt_012,TUMB,12,-1,0,1,AGK-47B Artificial Horizon Cage - Pull to cage", "AGK47B(25),3002,pnt_012,TUMB,12,1,0,1,AGK-47B Artificial Horizon Cage - Pull to cage", "RSI_6K(30),3005,pnt_233,TUMB,233,0,0,0.75,RSI-6K Wave Control Handle Lock/Unlock", "RSI_6K(30),3005,pnt_233,TUMB,233,0.75,0,0.75,RSI-6K Wave Control Handle Lock/Unlock", "WEAPON_SYSTEM(4),3006,pnt_090,BTN,90,1,0,1,NR-23 (Top) Cannon Reload Button - Press and hold to reload", "RSI_6K(30),3007,pnt_231,TUMB,231,0,0,0.75,RSI-6K Antenna Control Handle Lock/Unlock", "RSI_6K(30),3007,pnt_231,TUMB,231,0.75,0,0.75,RSI-6K Antenna Control Handle Lock/Unlock", "ELEC_INTERFACE(2),3009,pnt_162,TUMB,162,-1,0,1,N-37D Cannon Switch, ON/OFF", "ELEC_INTERFACE(2),3009,pnt_162,TUMB,162,1,0,1,N-37D Cannon Switch, ON/OFF", "RSI_6K(30),3001,pnt_126,LEV,126,0.8,0.1,0.9,RSI-6K Audio Volume Knob", "WEAPON_SYSTEM(4),3007,pnt_091,BTN,91,1,0,1,NR-23 (Bottom) Cannon Reload Button - Press and hold to reload", "RSI_6K(30),3009,pnt_240,TUMB,240,-1,0,1,RSI-6K Forced Mode Switch, ON/OFF", "RSI_6K(30),3009,pnt_240,TUMB,240,1,0,1,RSI-6K Forced Mode Switch, ON/OFF", "ASP_3N(26),3002,pnt_201,LEV,201,0,0,1,ASP-3N Gunsight Target Distance Knob", "ELEC_INTERFACE(2),3003,pnt_200,BTN,200,1,0,1,Engine Start Button - Push to start", "RSI_6K(30),3003,pnt_128,LEV,,0.3,0,1,RSI-6K Receiver Tuning Knob", "ELEC_INTERFACE(2),3015,pnt_159,TUMB,159,-1,0,1,ARC Switch, ON/OFF", "ELEC_INTERFACE(2),3015,pnt_159,TUMB,159,1,0,1,ARC Switch, ON/OFF", "CPT_MECH(15),3004,pnt_222,TUMB,,-2,-1,1,Right Canopy Lever, OPEN", "WEAPON_SYSTEM(4),3009,pnt_104,TUMB,104,-1,0,1,Emergency Release Button Cover, OPEN/CLOSE", "WEAPON_SYSTEM(4),3009,pnt_104,TUMB,104,1,0,1,Emergency Release Button Cover, OPEN/CLOSE", "FIRE_EXTING_INTERFACE(17),3001,pnt_138,BTN,138,1,0,1,Engine Fire Warning Light Test Button - Push to test", "GEAR_INTERFACE(13),3002,pnt_085,TUMB,85,-1,0,1,Landing Gear Handle Lock, Lock/Unlock", "GEAR_INTERFACE(13),3002,pnt_085,TUMB,85,1,0,1,Landing Gear Handle Lock, Lock/Unlock", "CPT_MECH(15),3003,pnt_223,TUMB,,-2,-1,1,Left Canopy Lever, OPEN", "HYDROSYS_INTERFACE(12),3004,pnt_166,TUMB,166,-1,0,1,Emergency Gears Valve Cover, OPEN/CLOSE", "HYDROSYS_INTERFACE(12),3004,pnt_166,TUMB,166,1,0,1,Emergency Gears Valve Cover, OPEN/CLOSE", "LIGHT_SYSTEM(22),3002,pnt_185,LEV,185,0,0.23,0.82,Right UV Light Rheostat", "ELEC_INTERFACE(2),3006,pnt_155,TUMB,155,-1,0,1,AGK-47B Artificial Horizon + DGMK-3 Switch, ON/OFF", "ELEC_INTERFACE(2),3006,pnt_155,TUMB,155,1,0,1,AGK-47B Artificial Horizon + DGMK-3 Switch, ON/OFF", "RSI_6K(30),3002,pnt_202,BTN,202,1,0,1,Microphone Button - Push to talk", "OXYGEN_INTERFACE(9),3003,pnt_143,LEV,143,0,0,1,Air Diluter Valve", "HYDROSYS_INTERFACE(12),3003,pnt_170,TUMB,170,-1,0,1,Emergency Flaps Valve Cover, OPEN/CLOSE", "HYDROSYS_INTERFACE(12),3003,pnt_170,TUMB,170,1,0,1,Emergency Flaps Valve Cover, OPEN/CLOSE", "ELEC_INTERFACE(2),3020,pnt_163,TUMB,163,-1,0,1,ASP-3N Gunsight Switch, ON/OFF", "ELEC_INTERFACE(2),3020,pnt_163,TUMB,163,1,0,1,ASP-3N Gunsight Switch, ON/OFF", "CLOCK(7),3003,pnt_023,LEV,24,1,0,1,AChS-1 Cockpit Chronograph Left Knob", "CLOCK(7),3002,pnt_023,BTN,23,-1,-1,0,AChS-1 Cockpit Chronograph Left Knob", "CLOCK(7),3001,pnt_023,BTN,23,1,0,1,AChS-1 Cockpit Chronograph Left Knob", "ELEC_INTERFACE(2),3011,pnt_081,TUMB,81,-1,0,1,Pitot and Clock Heater Switch, ON/OFF", "ELEC_INTERFACE(2),3011,pnt_081,TUMB,81,1,0,1,Pitot and Clock Heater Switch, ON/OFF", "HYDROSYS_INTERFACE(12),3007,pnt_241,LEV,241,1,0,1,Cockpit Filling Valve", "OXYGEN_INTERFACE(9),3001,pnt_141,LEV,141,0,0,1,Oxygen Supply Valve", "HYDROSYS_INTERFACE(12),3005,pnt_186,LEV,186,1,0,1,Emergency System Filling Valve"],
-    "MiG-19P": ["FLIGHT_CONTROLS(4),3331,PTN_331,TUMB,331,-1,0,1,Landing Gear Lever Lock", "FLIGHT_CONTROLS(4),3331,PTN_331,TUMB,331,1,0,1,Landing Gear Lever Lock", "FLIGHT_CONTROLS(4),3247,PTN_247,TUMB,247,-1,0,1,Anti-Skid Brake", "FLIGHT_CONTROLS(4),3247,PTN_247,TUMB,247,1,0,1,Anti-Skid Brake", "ENGDEV_CONTROLS(2),3242,PTN_242,TUMB,242,-1,0,1,Tank 1 Fuel Pump", "ENGDEV_CONTROLS(2),3242,PTN_242,TUMB,242,1,0,1,Tank 1 Fuel Pump", "ENVMNT_CONTROL(8),3246,PTN_246,TUMB,246,-1,0,1,Cockpit Heating", "ENVMNT_CONTROL(8),3246,PTN_246,TUMB,246,1,0,1,Cockpit Heating", "ENGDEV_CONTROLS(2),3317,PTN_317,BTN,317,1,0,1,Mil-power Limit/Afterburner Disable", "GUNSIGHTS(11),3358,PTN_358,LEV,358,0,0,1,ASP-5 Brightness", "GUNSIGHTS(11),3355,PTN_355,TUMB,355,-1,0,1,ASP-5 Sight Cage/Uncage", "GUNSIGHTS(11),3355,PTN_355,TUMB,355,1,0,1,ASP-5 Sight Cage/Uncage", "INTLTS_CONTROLS(6),3227,PTN_227,LEV,227,0,0,1,RUFO-45 Right Side ARUFOSH UV Lamp Intensity Control Knob", "FLIGHT_CONTROLS(4),3255,PTN_255,TUMB,255,1,0,1,Elevator Control Manual Mode Selector (Long/Short)", "FLIGHT_CONTROLS(4),3255,PTN_255,TUMB,255,0,-1,0,Elevator Control Manual Mode Selector (Long/Short)", "FLIGHT_CONTROLS(4),3308,PTN_306,TUMB,306,1,0,1,Flaps Landing", "WACLTS_INST(10),3333,PTN_333,BTN,333,1,0,1,PPS-2 Landing Gear Lights Test Button - Push to test", "ENGDEV_CONTROLS(2),3281,PTN_281,TUMB,281,0,0,1,Left Engine Fuel Cutoff Cover", "ENGDEV_CONTROLS(2),3281,PTN_281,TUMB,281,1,0,1,Left Engine Fuel Cutoff Cover", "ENGDEV_CONTROLS(2),3280,PTN_280,BTN,280,1,0,1,Engine Fire Lamp Test Button", "ARMNT_CONTROL(7),3290,PTN_290,BTN,290,1,0,1,EKSR-46 White Signal Flare Release Button", "PWRGEN_CONTROLS(3),3236,PTN_236,TUMB,236,-1,0,1,ARK-5 Radio Navigation System Circuit Breaker", "PWRGEN_CONTROLS(3),3236,PTN_236,TUMB,236,1,0,1,ARK-5 Radio Navigation System Circuit Breaker", "FLIGHT_INST(9),3334,PTN_334,TUMB,334,0.1,0,0.9,RV-5 Radio Altimeter Minimum Altitude Selector", "FLIGHT_INST(9),3334,PTN_334,TUMB,334,-0.1,0,0.9,RV-5 Radio Altimeter Minimum Altitude Selector", "ENGDEV_CONTROLS(2),3250,PTN_250,TUMB,250,-1,0,1,Right Engine Oil Cutoff", "ENGDEV_CONTROLS(2),3250,PTN_250,TUMB,250,1,0,1,Right Engine Oil Cutoff", "RADIO_RSIU4V(17),3315,PTN_315,BTN,315,1,0,1,RSIU-4V Transmit Button - Push to Transmit", "FLIGHT_CONTROLS(4),3301,PTN_301,TUMB,301,0,0,1,Emergency Brake", "FLIGHT_CONTROLS(4),3301,PTN_301,TUMB,301,1,0,1,Emergency Brake", "ARMNT_CONTROL(7),3298,PTN_298,TUMB,298,0,0,1,Rocket pods Jettison Button Cover", "ARMNT_CONTROL(7),3298,PTN_298,TUMB,298,1,0,1,Rocket pods Jettison Button Cover", "ARMNT_CONTROL(7),3264,PTN_264,TUMB,264,-1,0,1,Bombs Arm Switch", "ARMNT_CONTROL(7),3264,PTN_264,TUMB,264,1,0,1,Bombs Arm Switch", "ARMNT_CONTROL(7),3296,PTN_296,BTN,296,1,0,1,Left Gun Arm", "FLIGHT_INST(9),3224,PTN_224,BTN,224,1,0,1,GIK-1 Needle Alignment", "EXTLTS_CONTROLS(5),3261,PTN_261,TUMB,261,0.2,0,1,Navigation Lights", "EXTLTS_CONTROLS(5),3261,PTN_261,TUMB,261,-0.2,0,1,Navigation Lights", "ENGDEV_CONTROLS(2),3279,PTN_279,BTN,279,1,0,1,Fuel Tanks 2,3,4 Warning Lamps Test Button", "SENSORS_CONTROL(16),3495,PTN_495,TUMB,495,-1,0,1,SPO-2 SIRENA RWR Power Switch", "SENSORS_CONTROL(16),3495,PTN_495,TUMB,495,1,0,1,SPO-2 SIRENA RWR Power Switch", "SENSORS_CONTROL(16),3268,PTN_268,TUMB,268,-1,0,1,SRO-2 IFF Power Switch, ON/OFF", "SENSORS_CONTROL(16),3268,PTN_268,TUMB,268,1,0,1,SRO-2 IFF Power Switch, ON/OFF", "GUNSIGHTS(11),3345,PTN_345,TUMB,345,-1,0,1,ASP-5 Sight Operational Mode (Radar/Optic)", "GUNSIGHTS(11),3345,PTN_345,TUMB,345,1,0,1,ASP-5 Sight Operational Mode (Radar/Optic)", "FLIGHT_CONTROLS(4),3300,PTN_300,BTN,300,1,0,1,ARU-2V Lamp Test Button", "FLIGHT_CONTROLS(4),3258,PTN_258,TUMB,258,-1,0,1,BU-13M Aileron Hydraulic Booster Switch, ON/OFF", "FLIGHT_CONTROLS(4),3258,PTN_258,TUMB,258,1,0,1,BU-13M Aileron Hydraulic Booster Switch, ON/OFF", "FLIGHT_CONTROLS(4),3254,PTN_254,TUMB,254,-1,0,1,Elevator Control (ARU-2V) Mode (Automatic/Manual) ", "FLIGHT_CONTROLS(4),3254,PTN_254,TUMB,254,1,0,1,Elevator Control (ARU-2V) Mode (Automatic/Manual) ", "RADIO_RSIU4V(17),3319,PTN_319,TUMB,319,1,0,1,RSIU-4V Preset Radio Channel 1", "PWRGEN_CONTROLS(3),3203,PTN_203,TUMB,203,-1,0,1,Beacon and Radio Altimeter Electric Power", "PWRGEN_CONTROLS(3),3203,PTN_203,TUMB,203,1,0,1,Beacon and Radio Altimeter Electric Power", "ENVMNT_CONTROL(8),3241,PTN_241,TUMB,241,-1,-1,1,Cockpit Temperature Select", "ENVMNT_CONTROL(8),3241,PTN_241,TUMB,241,1,-1,1,Cockpit Temperature Select", "PWRGEN_CONTROLS(3),3210,PTN_210,TUMB,210,-1,0,1,Emergency Pitot Heater Electric Power", "PWRGEN_CONTROLS(3),3210,PTN_210,TUMB,210,1,0,1,Emergency Pitot Heater Electric Power", "FLIGHT_CONTROLS(4),3257,PTN_257,TUMB,257,1,0,1,Aileron Trimmer Switch, LEFT/RIGHT", "FLIGHT_CONTROLS(4),3257,PTN_257,TUMB,257,0,-1,0,Aileron Trimmer Switch, LEFT/RIGHT", "PWRGEN_CONTROLS(3),3211,PTN_211,TUMB,211,-1,0,1,Battery Connect/Disconnect", "PWRGEN_CONTROLS(3),3211,PTN_211,TUMB,211,1,0,1,Battery Connect/Disconnect", "FLIGHT_INST(9),3362,PTN_362,LEV,362,0,0,1,Barometric Altimeter Setting (bars)", "FLIGHT_INST(9),3359,PTN_359,LEV,359,0,0,1,GIK-1 Course Selector", "RADIO_RSIU4V(17),3326,PTN_326,TUMB,326,-1,0,1,RSIU-4V Interference Suppression Switch, ON/OFF", "RADIO_RSIU4V(17),3326,PTN_326,TUMB,326,1,0,1,RSIU-4V Interference Suppression Switch, ON/OFF", "RADAR_RP5(14),3342,PTN_342,LEV,342,0,-1,1,RP-5 Radar Electronic Horizon Elevation Adjustment Knob", "PWRGEN_CONTROLS(3),3213,PTN_213,TUMB,213,-1,0,1,Right Generator Connect/Disconnect", "PWRGEN_CONTROLS(3),3213,PTN_213,TUMB,213,1,0,1,Right Generator Connect/Disconnect", "PWRGEN_CONTROLS(3),3200,PTN_200,TUMB,200,-1,0,1,Radios Emergency Power", "PWRGEN_CONTROLS(3),3200,PTN_200,TUMB,200,1,0,1,Radios Emergency Power", "RADIO_RSIU4V(17),3325,PTN_325,TUMB,325,-1,0,1,RSIU-4V Audio Output: ADF/Radio", "RADIO_RSIU4V(17),3325,PTN_325,TUMB,325,1,0,1,RSIU-4V Audio Output: ADF/Radio", "ENGDEV_CONTROLS(2),3251,PTN_251,TUMB,251,-1,0,1,Left Engine Oil Cutoff", "ENGDEV_CONTROLS(2),3251,PTN_251,TUMB,251,1,0,1,Left Engine Oil Cutoff", "ARMNT_CONTROL(7),3297,PTN_297,BTN,297,1,0,1,Right Gun Arm", "ENGDEV_CONTROLS(2),3252,PTN_252,TUMB,252,-1,0,1,Right Engine Afterburner Cut", "ENGDEV_CONTROLS(2),3252,PTN_252,TUMB,252,1,0,1,Right Engine Afterburner Cut", "ENGDEV_CONTROLS(2),3283,PTN_283,TUMB,283,0,0,1,Fire Extinguisher Cover", "ENGDEV_CONTROLS(2),3283,PTN_283,TUMB,283,1,0,1,Fire Extinguisher Cover", "EXTLTS_CONTROLS(5),3262,PTN_262,TUMB,262,1,-1,1,Nose Lights Switch, LANDING/OFF/TAXI", "EXTLTS_CONTROLS(5),3262,PTN_262,TUMB,262,-1,-1,1,Nose Lights Switch, LANDING/OFF/TAXI", "RADAR_RP5(14),3434,PTN_434,TUMB,434,-1,0,1,RP-5 Radar Target Lock Switch (AR-18-16 Tracking Antenna), ON/OFF", "RADAR_RP5(14),3434,PTN_434,TUMB,434,1,0,1,RP-5 Radar Target Lock Switch (AR-18-16 Tracking Antenna), ON/OFF", "ENGDEV_CONTROLS(2),3284,PTN_284,BTN,284,1,0,1,Fire Extinguisher", "ENGDEV_CONTROLS(2),3243,PTN_243,TUMB,243,-1,0,1,Tank 2 Fuel Pump", "ENGDEV_CONTROLS(2),3243,PTN_243,TUMB,243,1,0,1,Tank 2 Fuel Pump", "FLIGHT_INST(9),3269,PTN_269,TUMB,269,-1,0,1,Pitot Tube Selector, MAIN(PVD-4)/EMERGENCY(TP-156)", "FLIGHT_INST(9),3269,PTN_269,TUMB,269,1,0,1,Pitot Tube Selector, MAIN(PVD-4)/EMERGENCY(TP-156)", "ARMNT_CONTROL(7),3289,PTN_289,BTN,289,1,0,1,EKSR-46 Red Signal Flare Release Button", "ARMNT_CONTROL(7),3288,PTN_288,BTN,288,1,0,1,EKSR-46 Green Signal Flare Release Button", "FLIGHT_CONTROLS(4),3302,PTN_302,TUMB,302,0,0,1,Nose Gear Brake System On/Off", "FLIGHT_CONTROLS(4),3302,PTN_302,TUMB,302,1,0,1,Nose Gear Brake System On/Off", "ARK5_CONTROL(20),3349,PTN_349,TUMB,349,0.1,0,0.3,ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP", "ARK5_CONTROL(20),3349,PTN_349,TUMB,349,-0.1,0,0.3,ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP", "ENGDEV_CONTROLS(2),3270,PTN_270,TUMB,270,0,0,1,Left Engine Start Button Cover", "ENGDEV_CONTROLS(2),3270,PTN_270,TUMB,270,1,0,1,Left Engine Start Button Cover", "SENSORS_CONTROL(16),3266,PTN_266,TUMB,266,-1,0,1,SRO-2 IFF Self-destruct Button - Press to activate self-destruction", "SENSORS_CONTROL(16),3266,PTN_266,TUMB,266,1,0,1,SRO-2 IFF Self-destruct Button - Press to activate self-destruction", "RADAR_RP5(14),3340,PTN_340,TUMB,340,-1,0,1,RP-5 Radar Gauge Display Mode Switch, VOLTAGE[V]/AIR PRESSURE[kg/cmÂ²]", "RADAR_RP5(14),3340,PTN_340,TUMB,340,1,0,1,RP-5 Radar Gauge Display Mode Switch, VOLTAGE[V]/AIR PRESSURE[kg/cmÂ²]", "FLIGHT_CONTROLS(4),3307,PTN_307,TUMB,307,1,0,1,Flaps Take Off", "ARK5_CONTROL(20),3335,PTN_335,TUMB,335,0.5,0,1,ARK-5 NEAR Frequency Band Selector Switch", "ARK5_CONTROL(20),3335,PTN_335,TUMB,335,-0.5,0,1,ARK-5 NEAR Frequency Band Selector Switch", "ARK5_CONTROL(20),3348,PTN_348,TUMB,348,0.5,0,1,ARK-5 FAR/NDB Frequency Band Selector Switch ", "ARK5_CONTROL(20),3348,PTN_348,TUMB,348,-0.5,0,1,ARK-5 FAR/NDB Frequency Band Selector Switch ", "PWRGEN_CONTROLS(3),3216,PTN_216,TUMB,216,-1,0,1,RP-5 Radar Electric Power", "PWRGEN_CONTROLS(3),3216,PTN_216,TUMB,216,1,0,1,RP-5 Radar Electric Power", "ARMNT_CONTROL(7),3295,PTN_295,BTN,295,1,0,1,Fuel Tanks/Bombs Jettison", "RADAR_RP5(14),3339,PTN_339,BTN,339,1,0,1,RP-5 Radar Built-In Test (BIT) Button - Press 2 seconds to start test", "FLIGHT_CONTROLS(4),3229,PTN_229,TUMB,229,-1,0,1,Emergency Canopy Release Lever", "FLIGHT_CONTROLS(4),3229,PTN_229,TUMB,229,1,0,1,Emergency Canopy Release Lever", "PWRGEN_CONTROLS(3),3230,PTN_230,TUMB,230,-1,0,1,Circuit Breakers Panel Lock", "PWRGEN_CONTROLS(3),3230,PTN_230,TUMB,230,1,0,1,Circuit Breakers Panel Lock", "PWRGEN_CONTROLS(3),3233,PTN_233,TUMB,233,-1,0,1,Bomb Fuzing System Circuit Breaker", "PWRGEN_CONTROLS(3),3233,PTN_233,TUMB,233,1,0,1,Bomb Fuzing System Circuit Breaker", "ARMNT_CONTROL(7),3337,PTN_337,TUMB,337,-1,0,1,Rockets Counter Mode (day/night)", "ARMNT_CONTROL(7),3337,PTN_337,TUMB,337,1,0,1,Rockets Counter Mode (day/night)", "FLIGHT_INST(9),3508,PTN_364,BTN,508,1,1,,AChS-1 Chronograph Right Knob", "FLIGHT_INST(9),3364,PTN_364,TUMB,364,1,0,1,AChS-1 Chronograph Right Knob", "ENGDEV_CONTROLS(2),3273,PTN_273,BTN,273,1,0,1,Right Engine Start", "ARK5_CONTROL(20),3260,PTN_260,TUMB,260,1,0,1,Near/Far Beacon",
-        "PWRGEN_CONTROLS(3),3240,PTN_240,TUMB,240,-1,0,1,Rocket Pods Circuit Breaker", "PWRGEN_CONTROLS(3),3240,PTN_240,TUMB,240,1,0,1,Rocket Pods Circuit Breaker", "RADAR_RP5(14),3341,PTN_341,TUMB,341,0.5,0,1,RP-5 Radar Mode Control Switch, ON/STANDBY/OFF", "RADAR_RP5(14),3341,PTN_341,TUMB,341,-0.5,0,1,RP-5 Radar Mode Control Switch, ON/STANDBY/OFF", "ENGDEV_CONTROLS(2),3329,PTN_329,TUMB,329,-1,0,1,Right Engine Air Start", "ENGDEV_CONTROLS(2),3329,PTN_329,TUMB,329,1,0,1,Right Engine Air Start", "RADAR_RP5(14),3263,PTN_263,TUMB,263,-1,0,1,RP-5 Radar/Telemetry Selector", "RADAR_RP5(14),3263,PTN_263,TUMB,263,1,0,1,RP-5 Radar/Telemetry Selector", "RADIO_RSIU4V(17),3327,PTN_327,LEV,327,0,0,1,RSIU-4V Volume Control Knob", "FLIGHT_CONTROLS(4),3429,PTN_429,TUMB,429,-1,0,1,Canopy Lock Lever L", "FLIGHT_CONTROLS(4),3429,PTN_429,TUMB,429,1,0,1,Canopy Lock Lever L", "ENVMNT_CONTROL(8),3228,PTN_228,TUMB,228,1,0,2,Cockpit Pressurization Lever", "ENVMNT_CONTROL(8),3228,PTN_228,TUMB,228,-1,0,2,Cockpit Pressurization Lever", "ENGDEV_CONTROLS(2),3282,PTN_282,TUMB,282,0,0,1,Right Engine Fuel Cutoff Cover", "ENGDEV_CONTROLS(2),3282,PTN_282,TUMB,282,1,0,1,Right Engine Fuel Cutoff Cover", "PWRGEN_CONTROLS(3),3209,PTN_209,TUMB,209,-1,0,1,Pitot Heater Electric Power", "PWRGEN_CONTROLS(3),3209,PTN_209,TUMB,209,1,0,1,Pitot Heater Electric Power", "FLIGHT_CONTROLS(4),3256,PTN_256,TUMB,256,-1,0,1,Elevator Actuator Switch, HYDRAULIC(BU-14M BOOSTER)/ELECTRIC(MUS-2 SYSTEM)", "FLIGHT_CONTROLS(4),3256,PTN_256,TUMB,256,1,0,1,Elevator Actuator Switch, HYDRAULIC(BU-14M BOOSTER)/ELECTRIC(MUS-2 SYSTEM)", "ENVMNT_CONTROL(8),3225,PTN_225,TUMB,225,-1,0,1,Cockpit Ventilation Switch, OPEN/CLOSE", "ENVMNT_CONTROL(8),3225,PTN_225,TUMB,225,1,0,1,Cockpit Ventilation Switch, OPEN/CLOSE", "ARMNT_CONTROL(7),3294,PTN_294,TUMB,294,0,0,1,Fuel Tanks/Bombs Jettison Button Cover", "ARMNT_CONTROL(7),3294,PTN_294,TUMB,294,1,0,1,Fuel Tanks/Bombs Jettison Button Cover", "ENVMNT_CONTROL(8),3303,PTN_303,LEV,303,0,0,1,Oxygen shut-off valve", "ENVMNT_CONTROL(8),3305,PTN_305,TUMB,305,-1,0,1,Oxygen-Air Diluter Lever, MIXTURE/100% O2", "ENVMNT_CONTROL(8),3305,PTN_305,TUMB,305,1,0,1,Oxygen-Air Diluter Lever, MIXTURE/100% O2", "FLIGHT_CONTROLS(4),3222,PTN_222,TUMB,222,0,0,1,Landing Gear Emergency Deployment", "FLIGHT_CONTROLS(4),3222,PTN_222,TUMB,222,1,0,1,Landing Gear Emergency Deployment", "FLIGHT_CONTROLS(4),3431,PTN_431,TUMB,431,-1,0,1,Canopy Pressurization Switch", "FLIGHT_CONTROLS(4),3431,PTN_431,TUMB,431,1,0,1,Canopy Pressurization Switch", "PWRGEN_CONTROLS(3),3217,PTN_217,TUMB,217,-1,0,1,ORO-57K Rocket Pods Electric Power", "PWRGEN_CONTROLS(3),3217,PTN_217,TUMB,217,1,0,1,ORO-57K Rocket Pods Electric Power", "PWRGEN_CONTROLS(3),3234,PTN_234,TUMB,234,-1,0,1,Bomb Release System Circuit Breaker", "PWRGEN_CONTROLS(3),3234,PTN_234,TUMB,234,1,0,1,Bomb Release System Circuit Breaker", "FLIGHT_CONTROLS(4),3293,PTN_293,BTN,293,1,0,1,TP-19 Braking Parachute Deploy Button - Press to deploy drag chute", "ENVMNT_CONTROL(8),3291,PTN_291,TUMB,291,-1,0,1,Canopy Front Anti Freeze", "ENVMNT_CONTROL(8),3291,PTN_291,TUMB,291,1,0,1,Canopy Front Anti Freeze", "FLIGHT_INST(9),3276,PTN_276,BTN,276,1,0,1,Warning Button", "ENGDEV_CONTROLS(2),3277,PTN_277,TUMB,277,0,0,1,Left Engine Air Start Button Cover", "ENGDEV_CONTROLS(2),3277,PTN_277,TUMB,277,1,0,1,Left Engine Air Start Button Cover", "RADAR_RP5(14),3338,PTN_338,TUMB,338,-1,0,1,RP-5 Radar ECCM Mode Switch, ON/OFF", "RADAR_RP5(14),3338,PTN_338,TUMB,338,1,0,1,RP-5 Radar ECCM Mode Switch, ON/OFF", "ENGDEV_CONTROLS(2),3272,PTN_272,BTN,272,1,0,1,Left Engine Start", "ARK5_CONTROL(20),3351,PTN_351,LEV,351,0,0,1,ARK-5 Frequency Scale Backlight Knob", "ARMNT_CONTROL(7),3346,PTN_346,TUMB,346,-1,0,1,Bomb Release Mode (Single/Auto)", "ARMNT_CONTROL(7),3346,PTN_346,TUMB,346,1,0,1,Bomb Release Mode (Single/Auto)", "RADIO_RSIU4V(17),3321,PTN_321,TUMB,321,1,0,1,RSIU-4V Preset Radio Channel 3", "RADAR_RP5(14),3343,PTN_343,TUMB,343,-1,0,1,RP-5 Radar Screen Mode Switch, DAY/NIGHT", "RADAR_RP5(14),3343,PTN_343,TUMB,343,1,0,1,RP-5 Radar Screen Mode Switch, DAY/NIGHT", "ARK5_CONTROL(20),3350,PTN_350,BTN,350,1,-1,0,ARK-5 Loop Antenna Rotation Switch, L(EFT)/R(IGHT)", "ARK5_CONTROL(20),3350,PTN_350,BTN,350,-1,0,1,ARK-5 Loop Antenna Rotation Switch, L(EFT)/R(IGHT)", "FLIGHT_INST(9),3361,PTN_361,TUMB,361,-1,0,1,AGI-1 Artificial Horizon Cage Button - Push to cage", "FLIGHT_INST(9),3361,PTN_361,TUMB,361,1,0,1,AGI-1 Artificial Horizon Cage Button - Push to cage", "FLIGHT_CONTROLS(4),3430,PTN_430,TUMB,430,-1,0,1,Canopy Lock Lever R", "FLIGHT_CONTROLS(4),3430,PTN_430,TUMB,430,1,0,1,Canopy Lock Lever R", "PWRGEN_CONTROLS(3),3212,PTN_212,TUMB,212,-1,0,1,Left Generator Connect/Disconnect", "PWRGEN_CONTROLS(3),3212,PTN_212,TUMB,212,1,0,1,Left Generator Connect/Disconnect", "RADIO_RSIU4V(17),3320,PTN_320,TUMB,320,1,0,1,RSIU-4V Preset Radio Channel 2", "PWRGEN_CONTROLS(3),3207,PTN_207,TUMB,207,-1,0,1,Trim System Electric Power", "PWRGEN_CONTROLS(3),3207,PTN_207,TUMB,207,1,0,1,Trim System Electric Power", "GUNSIGHTS(11),3314,PTN_314,LEV,314,0,0,1,ASP-5 Target Distance Selector", "PWRGEN_CONTROLS(3),3219,PTN_219,TUMB,219,-1,0,1,Right Gun Electric Power", "PWRGEN_CONTROLS(3),3219,PTN_219,TUMB,219,1,0,1,Right Gun Electric Power", "ENGDEV_CONTROLS(2),3286,PTN_286,BTN,286,1,0,1,Right Engine Fuel Cutoff", "GUNSIGHTS(11),3357,PTN_357,LEV,357,0,0,1,ASP-5 Mil Depression Setting", "PWRGEN_CONTROLS(3),3239,PTN_239,TUMB,239,-1,0,1,BU-13M Aileron and BU-14M Stabilizer Hydraulic Booster Circuit Breaker", "PWRGEN_CONTROLS(3),3239,PTN_239,TUMB,239,1,0,1,BU-13M Aileron and BU-14M Stabilizer Hydraulic Booster Circuit Breaker", "FLIGHT_CONTROLS(4),3292,PTN_292,TUMB,292,0,0,1,TP-19 Braking Parachute Deploy Button Cover", "FLIGHT_CONTROLS(4),3292,PTN_292,TUMB,292,1,0,1,TP-19 Braking Parachute Deploy Button Cover", "ENGDEV_CONTROLS(2),3244,PTN_244,TUMB,244,-1,0,1,Tank 3 Fuel Pump", "ENGDEV_CONTROLS(2),3244,PTN_244,TUMB,244,1,0,1,Tank 3 Fuel Pump", "ARK5_CONTROL(20),3352,PTN_352,LEV,352,0,0,1,ARK-5 Audio Volume Knob", "INTLTS_CONTROLS(6),3522,PTN_522,TUMB,522,-1,0,1,Right Side Flood Lamp Switch, ON/OFF", "INTLTS_CONTROLS(6),3522,PTN_522,TUMB,522,1,0,1,Right Side Flood Lamp Switch, ON/OFF", "PWRGEN_CONTROLS(3),3232,PTN_232,TUMB,232,-1,0,1,ARU-2V Flight Control System Circuit Breaker", "PWRGEN_CONTROLS(3),3232,PTN_232,TUMB,232,1,0,1,ARU-2V Flight Control System Circuit Breaker", "GUNSIGHTS(11),3356,PTN_356,LEV,356,0,0,1,ASP-5 Target Wingspan Selector", "ENGDEV_CONTROLS(2),3248,PTN_248,TUMB,248,-1,0,1,Engine Start Power Switch", "ENGDEV_CONTROLS(2),3248,PTN_248,TUMB,248,1,0,1,Engine Start Power Switch", "FLIGHT_CONTROLS(4),3275,PTN_275,BTN,275,1,0,1,TP-19 Braking Parachute Jettison Button - Press to jettison drag chute", "ARMNT_CONTROL(7),3344,PTN_344,TUMB,344,0.1,0,0.3,ASP-5 Sight Aiming Mode", "ARMNT_CONTROL(7),3344,PTN_344,TUMB,344,-0.1,0,0.3,ASP-5 Sight Aiming Mode", "ARK5_CONTROL(20),3347,PTN_347,TUMB,347,-1,0,1,ARK-5 Receiver Mode Switch, TLG(Telegraph)/TLF(Telephony)", "ARK5_CONTROL(20),3347,PTN_347,TUMB,347,1,0,1,ARK-5 Receiver Mode Switch, TLG(Telegraph)/TLF(Telephony)", "PWRGEN_CONTROLS(3),3218,PTN_218,TUMB,218,-1,0,1,Left Gun Electric Power", "PWRGEN_CONTROLS(3),3218,PTN_218,TUMB,218,1,0,1,Left Gun Electric Power", "FLIGHT_CONTROLS(4),3309,PTN_309,BTN,309,1,0,1,Flaps buttons reset", "FLIGHT_INST(9),3360,PTN_360,LEV,360,0,-1,1,AGI-1 Artificial Horizon Pitch Trim Knob", "PWRGEN_CONTROLS(3),3238,PTN_238,TUMB,238,-1,0,1,Landing Gear, Airbrake and Flaps Systems Circuit Breaker", "PWRGEN_CONTROLS(3),3238,PTN_238,TUMB,238,1,0,1,Landing Gear, Airbrake and Flaps Systems Circuit Breaker", "ARMNT_CONTROL(7),3259,PTN_259,TUMB,259,-1,0,1,EKSR-46 Signal Flare Dispenser Switch, OFF/ARMED", "ARMNT_CONTROL(7),3259,PTN_259,TUMB,259,1,0,1,EKSR-46 Signal Flare Dispenser Switch, OFF/ARMED", "ARK5_CONTROL(20),3353,PTN_353,LEV,353,0,0,1,ARK-5 Frequency Fine Tuning Handle", "RADIO_RSIU4V(17),3324,PTN_324,TUMB,324,1,0,1,RSIU-4V Preset Radio Channel 6", "ENGDEV_CONTROLS(2),3278,PTN_278,TUMB,278,0,0,1,Right Engine Air Start Button Cover", "ENGDEV_CONTROLS(2),3278,PTN_278,TUMB,278,1,0,1,Right Engine Air Start Button Cover", "PWRGEN_CONTROLS(3),3215,PTN_215,TUMB,215,-1,0,1,ASP-5 Sight On/Off", "PWRGEN_CONTROLS(3),3215,PTN_215,TUMB,215,1,0,1,ASP-5 Sight On/Off", "PWRGEN_CONTROLS(3),3202,PTN_202,TUMB,202,-1,0,1,Radios Electric Power", "PWRGEN_CONTROLS(3),3202,PTN_202,TUMB,202,1,0,1,Radios Electric Power", "INTLTS_CONTROLS(6),3226,PTN_226,LEV,226,0,0,1,RUFO-45 Left Side ARUFOSH UV Lamp Intensity Control Knob", "ARMNT_CONTROL(7),3336,PTN_336,TUMB,336,1,-1,1,Rockets Salvo Mode Selector", "ARMNT_CONTROL(7),3336,PTN_336,TUMB,336,-1,-1,1,Rockets Salvo Mode Selector", "SENSORS_CONTROL(16),3267,PTN_267,TUMB,267,0,0,1,SRO-2 IFF Power Switch Cover", "SENSORS_CONTROL(16),3267,PTN_267,TUMB,267,1,0,1,SRO-2 IFF Power Switch Cover", "FLIGHT_CONTROLS(4),3223,PTN_223,TUMB,223,0,0,1,Flaps Emergency Deployment", "FLIGHT_CONTROLS(4),3223,PTN_223,TUMB,223,1,0,1,Flaps Emergency Deployment", "FLIGHT_INST(9),3365,PTN_365,LEV,365,0,0,1,AChS-1 Chronograph Left Knob", "FLIGHT_INST(9),3366,PTN_365,BTN,366,-1,-1,0,AChS-1 Chronograph Left Knob", "FLIGHT_INST(9),3366,PTN_365,TUMB,366,1,0,1,AChS-1 Chronograph Left Knob", "ARMNT_CONTROL(7),3369,PTN_369,LEV,369,0,0,1,Right Gun Ammo Counter Reset", "ENGDEV_CONTROLS(2),3249,PTN_249,TUMB,249,-1,0,1,Fire Extinguisher Power Switch", "ENGDEV_CONTROLS(2),3249,PTN_249,TUMB,249,1,0,1,Fire Extinguisher Power Switch", "FLIGHT_CONTROLS(4),3306,PTN_308,TUMB,308,1,0,1,Flaps Off", "PWRGEN_CONTROLS(3),3206,PTN_206,TUMB,206,-1,0,1,Elevator Control Electric Power", "PWRGEN_CONTROLS(3),3206,PTN_206,TUMB,206,1,0,1,Elevator Control Electric Power", "PWRGEN_CONTROLS(3),3237,PTN_237,TUMB,237,-1,0,1,Landing Gear, Airbrake and Flaps Annunciator Lights Circuit Breaker", "PWRGEN_CONTROLS(3),3237,PTN_237,TUMB,237,1,0,1,Landing Gear, Airbrake and Flaps Annunciator Lights Circuit Breaker", "FLIGHT_CONTROLS(4),3274,PTN_274,TUMB,274,-1,0,1,TP-19 Braking Parachute Jettison Button Cover",
-        "FLIGHT_CONTROLS(4),3274,PTN_274,TUMB,274,1,0,1,TP-19 Braking Parachute Jettison Button Cover", "FLIGHT_CONTROLS(4),3316,PTN_316,TUMB,316,-1,0,1,Airbrake Switch", "FLIGHT_CONTROLS(4),3316,PTN_316,TUMB,316,1,0,1,Airbrake Switch", "ENGDEV_CONTROLS(2),3285,PTN_285,BTN,285,1,0,1,Left Engine Fuel Cutoff", "PWRGEN_CONTROLS(3),3231,PTN_231,TUMB,231,-1,0,1,Aircraft External Lights Circuit Breaker", "PWRGEN_CONTROLS(3),3231,PTN_231,TUMB,231,1,0,1,Aircraft External Lights Circuit Breaker", "PWRGEN_CONTROLS(3),3214,PTN_214,TUMB,214,-1,0,1,ASP-5 Sight Heater", "PWRGEN_CONTROLS(3),3214,PTN_214,TUMB,214,1,0,1,ASP-5 Sight Heater", "ARMNT_CONTROL(7),3287,PTN_287,BTN,287,1,0,1,EKSR-46 Yellow Signal Flare Release Button", "ENGDEV_CONTROLS(2),3253,PTN_253,TUMB,253,-1,0,1,Left Engine Afterburner Cut", "ENGDEV_CONTROLS(2),3253,PTN_253,TUMB,253,1,0,1,Left Engine Afterburner Cut", "ENGDEV_CONTROLS(2),3328,PTN_328,TUMB,328,-1,0,1,Left Engine Air Start", "ENGDEV_CONTROLS(2),3328,PTN_328,TUMB,328,1,0,1,Left Engine Air Start", "RADAR_RP5(14),3486,PTN_486,LEV,486,0,0,1,RP-5 Radar Screen Brightness Adjustment Knob", "FLIGHT_CONTROLS(4),3330,PTN_330,TUMB,330,1,-1,1,Landing Gear Lever", "FLIGHT_CONTROLS(4),3330,PTN_330,TUMB,330,-1,-1,1,Landing Gear Lever", "FLIGHT_INST(9),3515,PTN_515,BTN,515,1,0,1,AM-10 Accelerometer Min/Max G Reset Button", "ARMNT_CONTROL(7),3368,PTN_368,LEV,368,0,0,1,Left Gun Ammo Counter Reset", "RADIO_RSIU4V(17),3323,PTN_323,TUMB,323,1,0,1,RSIU-4V Preset Radio Channel 5", "ENVMNT_CONTROL(8),3304,PTN_304,TUMB,304,1,-1,1,Suit Oxygen Supply Lever, AUTOMATIC TURN-OFF/N(EUTRAL)/SUIT TURN-ON", "ENVMNT_CONTROL(8),3304,PTN_304,TUMB,304,-1,-1,1,Suit Oxygen Supply Lever, AUTOMATIC TURN-OFF/N(EUTRAL)/SUIT TURN-ON", "ENGDEV_CONTROLS(2),3318,PTN_318,BTN,318,1,0,1,Afterburner Enable", "ENGDEV_CONTROLS(2),3245,PTN_245,TUMB,245,-1,0,1,Tank 4 Fuel Pump", "ENGDEV_CONTROLS(2),3245,PTN_245,TUMB,245,1,0,1,Tank 4 Fuel Pump", "PWRGEN_CONTROLS(3),3220,PTN_220,TUMB,220,-1,0,1,Cockpit Gun Camera Power", "PWRGEN_CONTROLS(3),3220,PTN_220,TUMB,220,1,0,1,Cockpit Gun Camera Power", "ENGDEV_CONTROLS(2),3271,PTN_271,TUMB,271,0,0,1,Right Engine Start Button Cover", "ENGDEV_CONTROLS(2),3271,PTN_271,TUMB,271,1,0,1,Right Engine Start Button Cover", "PWRGEN_CONTROLS(3),3208,PTN_208,TUMB,208,-1,0,1,Radio Navigation Electric Power", "PWRGEN_CONTROLS(3),3208,PTN_208,TUMB,208,1,0,1,Radio Navigation Electric Power", "PWRGEN_CONTROLS(3),3201,PTN_201,TUMB,201,-1,0,1,AGI-1 Emergency Power", "PWRGEN_CONTROLS(3),3201,PTN_201,TUMB,201,1,0,1,AGI-1 Emergency Power", "RADIO_RSIU4V(17),3322,PTN_322,TUMB,322,1,0,1,RSIU-4V Preset Radio Channel 4", "SENSORS_CONTROL(16),3265,PTN_265,TUMB,265,0,0,1,SRO-2 IFF Self-destruct Button Cover", "SENSORS_CONTROL(16),3265,PTN_265,TUMB,265,1,0,1,SRO-2 IFF Self-destruct Button Cover", "PWRGEN_CONTROLS(3),3221,PTN_221,TUMB,221,-1,0,1,Nose Gun Camera Power", "PWRGEN_CONTROLS(3),3221,PTN_221,TUMB,221,1,0,1,Nose Gun Camera Power", "PWRGEN_CONTROLS(3),3235,PTN_235,TUMB,235,-1,0,1,Bomb, Drop Tank and Rocket Emergency Jettison System Circuit Breaker", "PWRGEN_CONTROLS(3),3235,PTN_235,TUMB,235,1,0,1,Bomb, Drop Tank and Rocket Emergency Jettison System Circuit Breaker", "ARMNT_CONTROL(7),3299,PTN_299,BTN,299,1,0,1,Rocket pods Jettison"],
-    "P-51D": ["HOMING_ADAPTER(28),3005,pnt_152_0,TUMB,152,0,0,0,Homing Adapter TRANSMIT", "FRONT_SWITCH_BOX(13),3011,CLK_VAR2_pnt_68,TUMB,68,0.1,0,0.3,Release Mode", "FRONT_SWITCH_BOX(13),3011,CLK_VAR2_pnt_68,TUMB,68,-0.1,0,0.3,Release Mode", "VHF_RADIO(24),3015,pnt_116,LEV,116,1,0,1,Radio Audio Volume ", "WEAPON_CONTROL(4),3007,pnt_73_1,TUMB,73,0.1,0.1,0.1,Rockets Release Single", "WEAPON_CONTROL(4),3014,pnt_74_1,TUMB,74,0,0,0,Rockets Int", "RIGHT_SWITCH_PANEL(14),3029,pnt_110_0,TUMB,110,1,0,1,Amber Recognition Light Steady/Off", "K14_GUNSIGHT(1),3015,pnt_41_1,TUMB,41,1,1,1,Sight On", "TAIL_WARNING_RADAR(25),3003,pnt_115,BTN,115,1,0,1,Tail Warning Radar Test", "ENGINE_CONTROL_PANEL(15),3002,pnt_58,TUMB,58,-1,0,1,Supercharger Switch Cover", "ENGINE_CONTROL_PANEL(15),3002,pnt_58,TUMB,58,1,0,1,Supercharger Switch Cover", "TAIL_WARNING_RADAR(25),3004,pnt_113,LEV,113,1,0,1,Tail Warning Radar Light Control", "HOMING_ADAPTER(28),3001,pnt_152,TUMB,152,0.1,0,0.2,Homing Adapter Mode", "HOMING_ADAPTER(28),3001,pnt_152,TUMB,152,-0.1,0,0.2,Homing Adapter Mode", "FRONT_SWITCH_BOX(13),3009,CLK_VAR2_pnt_69,TUMB,69,1,-1,1,Left Bomb Arm/Chemical", "FRONT_SWITCH_BOX(13),3009,CLK_VAR2_pnt_69,TUMB,69,-1,-1,1,Left Bomb Arm/Chemical", "REMOTE_COMPASS(23),3001,pnt_3,LEV,3,1,0,1,Course Set", "WEAPON_CONTROL(4),3004,pnt_133,TUMB,133,-1,0,1,Right Payload Salvo", "WEAPON_CONTROL(4),3004,pnt_133,TUMB,133,1,0,1,Right Payload Salvo", "K14_GUNSIGHT(1),3004,pnt_41,TUMB,41,-1,0,1,Sight On/Off", "K14_GUNSIGHT(1),3004,pnt_41,TUMB,41,1,0,1,Sight On/Off", "RIGHT_SWITCH_PANEL(14),3023,pnt_110,TUMB,110,-1,-1,1,Amber Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3023,pnt_110,TUMB,110,1,-1,1,Amber Recognition Light Key/Off/Steady", "ENGINE_CONTROL_PANEL(15),3007,pnt_62_1,BTN,62,1,0,1,Oil Dilute Activate", "RIGHT_SWITCH_PANEL(14),3005,pnt_105,TUMB,105,-1,0,1,Pitot Heating", "RIGHT_SWITCH_PANEL(14),3005,pnt_105,TUMB,105,1,0,1,Pitot Heating", "RIGHT_SWITCH_PANEL(14),3021,pnt_108,TUMB,108,-1,-1,1,Red Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3021,pnt_108,TUMB,108,1,-1,1,Red Recognition Light Key/Off/Steady", "ENGINE_CONTROL_PANEL(15),3014,pnt_65_1,BTN,65,1,0,1,Primer Activate", "RIGHT_SWITCH_PANEL(14),3012,pnt_103_0,TUMB,103,0,0,0,Battery Disconnect", "RIGHT_SWITCH_PANEL(14),3015,pnt_106_1,TUMB,106,1,0,1,Wing Position Lights Bright/Off", "RIGHT_SWITCH_PANEL(14),3027,pnt_108_1,TUMB,108,-1,-1,0,Red Recognition Light Key/Off", "K14_GUNSIGHT(1),3016,pnt_40_1,TUMB,40,0.1,0.1,0.1,Fixed-Gyro Sight", "RIGHT_SWITCH_PANEL(14),3003,pnt_102,TUMB,102,-1,0,1,Generator Disconnect", "RIGHT_SWITCH_PANEL(14),3003,pnt_102,TUMB,102,1,0,1,Generator Disconnect", "FUEL_SYSTEM(9),3004,pnt_85_0,TUMB,85,0.4,0.4,0.4,Select Left Combat Tank", "FUEL_SYSTEM(9),3002,pnt_86,TUMB,86,-1,0,1,Fuel Shut-Off Valve", "FUEL_SYSTEM(9),3002,pnt_86,TUMB,86,1,0,1,Fuel Shut-Off Valve", "CPT_MECH(6),3003,pnt_149,TUMB,149,-1,0,1,Canopy Emergency Release Handle", "CPT_MECH(6),3003,pnt_149,TUMB,149,1,0,1,Canopy Emergency Release Handle", "FRONT_SWITCH_BOX(13),3013,pnt_69_0,TUMB,69,0,0,0,Left Bomb Arm Off", "FUEL_SYSTEM(9),3005,pnt_86_0,TUMB,86,0,0,0,Fuel Shut-Off Valve Off", "ENGINE_SYSTEM(5),3002,pnt_88_0,BTN,88,0.1,0,0.1,Close Oil Control", "ENGINE_CONTROL_PANEL(15),3011,pnt_65,BTN,65,1,0,1,Primer Activate", "TAIL_WARNING_RADAR(25),3007,pnt_114_0,TUMB,114,0,0,0,Tail Warning Radar Power Off", "ENVIRONMENT_SYSTEM(11),3002,pnt_158,LEV,158,0,0,1,Cold Air", "RIGHT_SWITCH_PANEL(14),3015,pnt_106_0,TUMB,106,-1,-1,0,Wing Position Lights Dim/Off", "RIGHT_SWITCH_PANEL(14),3014,pnt_105_1,TUMB,105,1,1,1,Pitot Heating On", "FUEL_SYSTEM(9),3004,pnt_85_3,TUMB,85,0.3,0.3,0.3,Select Right Main Tank", "TAIL_WARNING_RADAR(25),3008,pnt_115_1,BTN,115,1,0,1,Tail Warning Radar Test", "RIGHT_SWITCH_PANEL(14),3013,pnt_102_1,TUMB,102,1,1,1,Generator Connect", "FUEL_SYSTEM(9),3004,pnt_85_1,TUMB,85,0.1,0.1,0.1,Select Left Main Tank", "FRONT_SWITCH_BOX(13),3002,CLK_VAR2_pnt_66,TUMB,66,-0.1,0,0.3,Ignition", "FRONT_SWITCH_BOX(13),3002,CLK_VAR2_pnt_66,TUMB,66,0.1,0,0.3,Ignition", "FRONT_SWITCH_BOX(13),3013,pnt_69_1,TUMB,69,1,1,1,Left Chemical Release", "VHF_RADIO(24),3017,pnt_129,TUMB,129,-1,0,1,Switch Locking Lever", "VHF_RADIO(24),3017,pnt_129,TUMB,129,1,0,1,Switch Locking Lever", "ENGINE_CONTROL_PANEL(15),3008,pnt_63,BTN,63,1,0,1,Starter Activate", "FRONT_SWITCH_BOX(13),3015,pnt_68_2,TUMB,68,0.2,0.2,0.2,Bombs Both Release", "IFF(27),3016,pnt_139_3,TUMB,139,0,0.2,0.2,IFF CODE 3", "FRONT_SWITCH_BOX(13),3014,pnt_70_0,TUMB,70,0,0,0,Right Bomb Arm Off", "CONTROL_SYSTEM(12),3005,pnt_84,BTN,84,1,0,1,Parking Brake Handle", "RIGHT_SWITCH_PANEL(14),3027,pnt_108_0,TUMB,108,1,0,1,Red Recognition Light Steady/Off", "ENGINE_CONTROL_PANEL(15),3012,pnt_61_1,TUMB,61,1,1,1,Fuel Booster On", "CONTROL_SYSTEM(12),3018,pnt_81,BTN,81,1,0,1,Safe Landing Gear Light Test", "K14_GUNSIGHT(1),3016,pnt_40_2,TUMB,40,0.2,0.2,0.2,Gyro Sight", "FRONT_SWITCH_BOX(13),3013,pnt_69_-1,TUMB,69,-1,-1,-1,Left Bomb Arm On", "CONTROL_SYSTEM(12),3007,pnt_83,BTN,83,1,0,1,Unsafe Landing Gear Light Test", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_2,BTN,57,0.2,0.1,0.2,Supercharger HIGH", "DETROLA(26),3002,pnt_138,LEV,138,0,0,1,Detrola Volume", "ARTIFICIAL_HORIZON(19),3003,pnt_18,LEV,18,0.5,0,0.14,Cage", "ARTIFICIAL_HORIZON(19),3001,pnt_18,BTN,19,1,0,1,Cage", "FRONT_SWITCH_BOX(13),3007,CLK_VAR2_pnt_67,TUMB,67,1,-1,1,Gun control", "FRONT_SWITCH_BOX(13),3007,CLK_VAR2_pnt_67,TUMB,67,-1,-1,1,Gun control", "ACCELEROMETER(30),3001,pnt_176,BTN,176,0.6,0,0.6,G-meter reset", "ARTIFICIAL_HORIZON(19),3002,pnt_17,LEV,17,1,0,1,Pitch Adjustment", "FRONT_SWITCH_BOX(13),3008,pnt_72,BTN,72,1,0,1,Silence Landing Gear Warning Horn Cut Off", "ENGINE_SYSTEM(5),3001,pnt_87_0,BTN,87,0.1,0,0.1,Close Coolant Control", "HOMING_ADAPTER(28),3003,pnt_154,BTN,154,1,0,1,Homing Adapter's Circuit Breaker", "HOMING_ADAPTER(28),3002,pnt_153,TUMB,153,-1,0,1,Homing Adapter On/Off", "HOMING_ADAPTER(28),3002,pnt_153,TUMB,153,1,0,1,Homing Adapter On/Off", "HOMING_ADAPTER(28),3006,pnt_153_1,TUMB,153,1,1,1,Homing Adapter Power On", "HOMING_ADAPTER(28),3006,pnt_153_0,TUMB,153,0,0,0,Homing Adapter Power Off", "CONTROL_SYSTEM(12),3008,pnt_91,LEV,91,0,-1,1,Aileron Trim", "HOMING_ADAPTER(28),3005,pnt_152_1,TUMB,152,0.1,0.1,0.1,Homing Adapter COMM.", "IFF(27),3007,pnt_145,BTN,145,1,0,1,IFF Detonator Left", "IFF(27),3008,pnt_146,BTN,146,1,0,1,IFF Detonator Right", "RIGHT_SWITCH_PANEL(14),3013,pnt_102_0,TUMB,102,0,0,0,Generator Disconnect", "IFF(27),3017,pnt_141_0,TUMB,141,0,0,0,IFF OFF", "IFF(27),3016,pnt_139_1,TUMB,139,0,0,0,IFF CODE 1", "ENGINE_CONTROL_PANEL(15),3009,pnt_64,TUMB,64,-1,0,1,Starter Switch Cover", "ENGINE_CONTROL_PANEL(15),3009,pnt_64,TUMB,64,1,0,1,Starter Switch Cover", "IFF(27),3016,pnt_139_2,TUMB,139,0,0.1,0.1,IFF CODE 2", "IFF(27),3015,pnt_143_1,TUMB,143,1,1,1,IFF Distress Signal On", "IFF(27),3001,pnt_140,TUMB,140,-1,0,1,IFF Power On/Off", "IFF(27),3001,pnt_140,TUMB,140,1,0,1,IFF Power On/Off", "RIGHT_SWITCH_PANEL(14),3028,pnt_109_0,TUMB,109,1,0,1,Green Recognition Light Steady/Off", "RIGHT_SWITCH_PANEL(14),3012,pnt_103_1,TUMB,103,1,1,1,Battery Connect", "IFF(27),3016,pnt_139_5,TUMB,139,0,0.4,0.4,IFF CODE 5", "FRONT_SWITCH_BOX(13),3005,pnt_66_0,TUMB,66,0,0,0,Ignition Off", "ENGINE_SYSTEM(5),3001,pnt_87_2,BTN,87,0.3,0,0.3,Open Coolant Control", "IFF(27),3014,pnt_140_1,TUMB,140,1,1,1,IFF Power On", "IFF(27),3002,pnt_139,TUMB,139,0.1,0,0.5,IFF Code Selector", "IFF(27),3002,pnt_139,TUMB,139,-0.1,0,0.5,IFF Code Selector", "CONTROL_SYSTEM(12),3009,pnt_92,LEV,92,0,-1,1,Elevator Trim", "TAIL_WARNING_RADAR(25),3007,pnt_114_1,TUMB,114,1,1,1,Tail Warning Radar Power On", "WEAPON_CONTROL(4),3003,pnt_132,TUMB,132,-1,0,1,Left Payload Salvo", "WEAPON_CONTROL(4),3003,pnt_132,TUMB,132,1,0,1,Left Payload Salvo", "FRONT_SWITCH_BOX(13),3015,pnt_68_0,TUMB,68,0,0,0,Bombs and Rockets Safe", "ENVIRONMENT_SYSTEM(11),3001,pnt_157,LEV,157,0,0,1,Defroster", "RIGHT_SWITCH_PANEL(14),3028,pnt_109_1,TUMB,109,-1,-1,0,Green Recognition Light Key/Off", "DETROLA(26),3001,pnt_137,LEV,137,0,0,1,Detrola Frequency Selector", "K14_GUNSIGHT(1),3015,pnt_41_0,TUMB,41,0,0,0,Sight Off", "ENVIRONMENT_SYSTEM(11),3003,pnt_159,LEV,159,0,0,1,Hot Air", "LIGHT_SYSTEM(10),3003,pnt_89,TUMB,89,-1,0,1,Landing Light On/Off", "LIGHT_SYSTEM(10),3003,pnt_89,TUMB,89,1,0,1,Landing Light On/Off", "LIGHT_SYSTEM(10),3007,pnt_89_1,TUMB,89,1,1,1,Landing Light On", "K14_GUNSIGHT(1),3003,pnt_40,TUMB,40,0.1,0,0.2,Sight Mode", "K14_GUNSIGHT(1),3003,pnt_40,TUMB,40,-0.1,0,0.2,Sight Mode", "LIGHT_SYSTEM(10),3002,pnt_90,LEV,90,0,0,1,Left Fluorescent Light", "ENGINE_SYSTEM(5),3003,pnt_168,TUMB,168,-1,0,1,Coolant Control Cover", "ENGINE_SYSTEM(5),3003,pnt_168,TUMB,168,1,0,1,Coolant Control Cover", "FUEL_SYSTEM(9),3004,pnt_85_4,TUMB,85,0,0,0,Select Right Combat Tank", "IFF(27),3017,pnt_141_1,TUMB,141,1,1,1,IFF ON", "RIGHT_SWITCH_PANEL(14),3026,pnt_104_0,TUMB,104,0,0,0,Gun Heating Off", "K14_GUNSIGHT(1),3016,pnt_40_0,TUMB,40,0,0,0,Fixed Sight", "VHF_RADIO(24),3005,pnt_121,BTN,121,1,0,1,D Channel Activate", "ENGINE_SYSTEM(5),3001,pnt_87_1,TUMB,87,0.2,0,0.2,Automatic Coolant Control", "IFF(27),3016,pnt_139_6,TUMB,139,0,0.5,0.5,IFF CODE 6", "ENGINE_SYSTEM(5),3004,pnt_169,TUMB,169,-1,0,1,Oil Control Cover", "ENGINE_SYSTEM(5),3004,pnt_169,TUMB,169,1,0,1,Oil Control Cover", "FRONT_SWITCH_BOX(13),3014,pnt_70_-1,TUMB,70,-1,-1,-1,Right Bomb Arm On", "ENGINE_SYSTEM(5),3002,pnt_88_2,BTN,88,0.3,0,0.3,Open Oil Control", "CPT_MECH(6),3001,pnt_44,BTN,44,1,0,1,Microphone On", "K14_GUNSIGHT(1),3005,pnt_42,LEV,42,1,0,1,Gun Sight Brightness", "ENGINE_SYSTEM(5),3019,pnt_47_0,TUMB,47,0,0,0,Mixture IDLE", "ENGINE_SYSTEM(5),3019,pnt_47_1,TUMB,47,0,0.1,0.1,Mixture RUN", "LIGHT_SYSTEM(10),3007,pnt_89_0,TUMB,89,0,0,0,Landing Light Off", "VHF_RADIO(24),3003,pnt_119,BTN,119,1,0,1,B Channel Activate", "ENGINE_SYSTEM(5),3012,pnt_48,LEV,48,0,0,1,Lock Throttle", "RIGHT_SWITCH_PANEL(14),3025,pnt_112,BTN,112,1,0,1,Circuit Protectors Reset", "ENGINE_CONTROL_PANEL(15),3012,pnt_61_0,TUMB,61,0,0,0,Fuel Booster Off", "(0),3001,pnt_183,TUMB,183,0,0,1,Mirror", "(0),3001,pnt_183,TUMB,183,1,0,1,Mirror",
-        "FRONT_SWITCH_BOX(13),3005,pnt_66_2,TUMB,66,0,0.2,0.2,Ignition Left", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_1,TUMB,57,0.1,0.1,0.1,Supercharger LOW", "RIGHT_SWITCH_PANEL(14),3029,pnt_110_1,TUMB,110,-1,-1,0,Amber Recognition Light Key/Off", "CONTROL_SYSTEM(12),3010,pnt_93,LEV,93,0,-1,1,Rudder Trim", "CONTROL_SYSTEM(12),3003,pnt_151,TUMB,150,-1,0,1,Landing Gear Control Handle", "CONTROL_SYSTEM(12),3003,pnt_151,TUMB,150,1,0,1,Landing Gear Control Handle", "RIGHT_SWITCH_PANEL(14),3009,pnt_107,TUMB,107,1,-1,1,Tail Position Lights Bright/Off/Dim", "RIGHT_SWITCH_PANEL(14),3009,pnt_107,TUMB,107,-1,-1,1,Tail Position Lights Bright/Off/Dim", "ENGINE_CONTROL_PANEL(15),3005,pnt_61,TUMB,61,-1,0,1,Fuel Booster On/Off", "ENGINE_CONTROL_PANEL(15),3005,pnt_61,TUMB,61,1,0,1,Fuel Booster On/Off", "WEAPON_CONTROL(4),3014,pnt_74_0,TUMB,74,1,1,1,Rockets Delay", "RIGHT_SWITCH_PANEL(14),3024,pnt_111,BTN,111,1,0,1,Recognition Lights Key", "OXYGEN_SYSTEM(7),3003,pnt_131,TUMB,131,-1,0,1,Auto-Mix On-Off", "OXYGEN_SYSTEM(7),3003,pnt_131,TUMB,131,1,0,1,Auto-Mix On-Off", "DIRECTIONAL_GYRO(20),3001,pnt_13,LEV,13,0.5,0,1,Heading Set/Cage", "DIRECTIONAL_GYRO(20),3003,pnt_13,BTN,179,1,0,1,Heading Set/Cage", "RIGHT_SWITCH_PANEL(14),3007,pnt_100,LEV,100,0,0,1,Right Fluorescent Light", "FUEL_SYSTEM(9),3004,pnt_85_2,TUMB,85,0.2,0.2,0.2,Select Fuselage Tank", "RIGHT_SWITCH_PANEL(14),3016,pnt_107_0,TUMB,107,-1,-1,0,Tail Position Lights Dim/Off", "RIGHT_SWITCH_PANEL(14),3022,pnt_109,TUMB,109,-1,-1,1,Green Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3022,pnt_109,TUMB,109,1,-1,1,Green Recognition Light Key/Off/Steady", "VHF_RADIO(24),3020,pnt_128_-1,BTN,128,-1,-1,0,Radio Mode Transmit", "RIGHT_SWITCH_PANEL(14),3008,pnt_106,TUMB,106,1,-1,1,Wing Position Lights Bright/Off/Dim", "RIGHT_SWITCH_PANEL(14),3008,pnt_106,TUMB,106,-1,-1,1,Wing Position Lights Bright/Off/Dim", "VHF_RADIO(24),3006,pnt_127,LEV,127,1,0,1,Radio Lights Dimmer", "WEAPON_CONTROL(4),3008,pnt_74,TUMB,74,-1,0,1,Rockets Delay Switch", "WEAPON_CONTROL(4),3008,pnt_74,TUMB,74,1,0,1,Rockets Delay Switch", "IFF(27),3004,pnt_142,TUMB,142,-1,0,1,IFF Detonator Circuit On/Off", "IFF(27),3004,pnt_142,TUMB,142,1,0,1,IFF Detonator Circuit On/Off", "FRONT_SWITCH_BOX(13),3015,pnt_68_3,TUMB,68,0.3,0.3,0.3,Rockets Arm", "TAIL_WARNING_RADAR(25),3001,pnt_114,TUMB,114,-1,0,1,Tail Warning Radar Power", "TAIL_WARNING_RADAR(25),3001,pnt_114,TUMB,114,1,0,1,Tail Warning Radar Power", "FRONT_SWITCH_BOX(13),3012,pnt_67_-1,TUMB,67,-1,-1,-1,Camera On", "ENGINE_CONTROL_PANEL(15),3004,pnt_60,BTN,60,1,0,1,High Blower Lamp Test ", "VHF_RADIO(24),3002,pnt_118,BTN,118,1,0,1,A Channel Activate", "FRONT_SWITCH_BOX(13),3001,pnt_71,LEV,71,1,0,1,Cockpit Lights", "CONTROL_SYSTEM(12),3016,pnt_173,BTN,173,1,0,1,Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position", "CONTROL_SYSTEM(12),3015,pnt_173,BTN,173,1,0,1,Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position", "VHF_RADIO(24),3021,pnt_128_1,TUMB,128,1,1,1,Radio Mode Remote", "VHF_RADIO(24),3004,pnt_120,BTN,120,1,0,1,C Channel Activate", "CPT_MECH(6),3008,pnt_147_1,LEV,147,0,0,1,Canopy Hand Crank", "ENGINE_SYSTEM(5),3011,pnt_47,TUMB,47,0.1,0,0.2,Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH", "ENGINE_SYSTEM(5),3011,pnt_47,TUMB,47,-0.1,0,0.2,Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH", "IFF(27),3016,pnt_139_4,TUMB,139,0,0.3,0.3,IFF CODE 4", "WEAPON_CONTROL(4),3013,CLK_VAR2_pnt_73,TUMB,73,0.1,0,0.2,Rockets Release Mode", "WEAPON_CONTROL(4),3013,CLK_VAR2_pnt_73,TUMB,73,-0.1,0,0.2,Rockets Release Mode", "ENGINE_SYSTEM(5),3002,pnt_88_1,TUMB,88,0.2,0,0.2,Automatic Oil Control", "RIGHT_SWITCH_PANEL(14),3014,pnt_105_0,TUMB,105,0,0,0,Pitot Heating Off", "CONTROL_SYSTEM(12),3003,pnt_150,TUMB,150,-1,0,1,Landing Gear Control Handle", "CONTROL_SYSTEM(12),3003,pnt_150,TUMB,150,1,0,1,Landing Gear Control Handle", "HYDRAULIC_SYSTEM(3),3001,pnt_79,TUMB,79,-1,0,1,Hydraulic Release Knob", "HYDRAULIC_SYSTEM(3),3001,pnt_79,TUMB,79,1,0,1,Hydraulic Release Knob", "IFF(27),3014,pnt_140_0,TUMB,140,0,0,0,IFF Power Off", "VHF_RADIO(24),3021,pnt_128_0,TUMB,128,0,0,0,Radio Mode Receive", "IFF(27),3017,pnt_141_-1,TUMB,141,-1,-1,-1,IFF TIME", "VHF_RADIO(24),3001,pnt_117,BTN,117,1,0,1,Radio ON/OFF", "FRONT_SWITCH_BOX(13),3014,pnt_70_1,TUMB,70,1,1,1,Right Chemical Release", "K14_GUNSIGHT(1),3006,pnt_39,TUMB,39,-1,0,1,Fixed Reticle Mask Lever", "K14_GUNSIGHT(1),3006,pnt_39,TUMB,39,1,0,1,Fixed Reticle Mask Lever", "IFF(27),3015,pnt_143_0,TUMB,143,0,0,0,IFF Distress Signal Off", "FRONT_SWITCH_BOX(13),3010,CLK_VAR2_pnt_70,TUMB,70,1,-1,1,Right Bomb Arm/Chemical", "FRONT_SWITCH_BOX(13),3010,CLK_VAR2_pnt_70,TUMB,70,-1,-1,1,Right Bomb Arm/Chemical", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_0,TUMB,57,0,0,0,Supercharger AUTO", "WEAPON_CONTROL(4),3007,pnt_73_0,TUMB,73,0,0,0,Rockets Release Off", "ENGINE_CONTROL_PANEL(15),3013,pnt_62,BTN,62,1,0,1,Oil Dilute Activate", "CLOCK(22),3002,pnt_7,LEV,7,0.04,0,1,Winding/Adjustment Clock", "CLOCK(22),3001,pnt_7,BTN,8,1,0,1,Winding/Adjustment Clock", "ENGINE_SYSTEM(5),3014,pnt_49,LEV,49,0,0,1,Lock Propeller & Mixture", "FRONT_SWITCH_BOX(13),3005,pnt_66_3,TUMB,66,0,0.3,0.3,Ignition Both", "RIGHT_SWITCH_PANEL(14),3026,pnt_104_1,TUMB,104,1,1,1,Gun Heating On", "ALTIMETER(17),3001,pnt_26,LEV,26,1,0,1,Set Pressure", "CPT_MECH(6),3009,pnt_200,TUMB,200,-1,0,1,Arm rest", "CPT_MECH(6),3009,pnt_200,TUMB,200,1,0,1,Arm rest", "VHF_RADIO(24),3007,pnt_128,TUMB,128,1,0,1,Radio Mode", "VHF_RADIO(24),3008,pnt_128,BTN,128,-1,-1,0,Radio Mode", "HOMING_ADAPTER(28),3005,pnt_152_2,TUMB,152,0.2,0.2,0.2,Homing Adapter HOMING", "OXYGEN_SYSTEM(7),3001,pnt_130,TUMB,130,-0.5,0,0.5,Oxygen Emergency By-pass", "OXYGEN_SYSTEM(7),3001,pnt_130,TUMB,130,0.5,0,0.5,Oxygen Emergency By-pass", "RIGHT_SWITCH_PANEL(14),3016,pnt_107_1,TUMB,107,1,0,1,Tail Position Lights Bright/Off", "RIGHT_SWITCH_PANEL(14),3019,pnt_104,TUMB,104,-1,0,1,Gun Heating", "RIGHT_SWITCH_PANEL(14),3019,pnt_104,TUMB,104,1,0,1,Gun Heating", "FUEL_SYSTEM(9),3005,pnt_86_1,TUMB,86,1,1,1,Fuel Shut-Off Valve On", "FRONT_SWITCH_BOX(13),3015,pnt_68_1,TUMB,68,0.1,0.1,0.1,Bombs Train Release", "ENGINE_SYSTEM(5),3019,pnt_47_2,TUMB,47,0,0.2,0.2,Mixture EMERGENCY FULL RICH", "IFF(27),3005,pnt_143,TUMB,143,-1,0,1,IFF Distress Signal", "IFF(27),3005,pnt_143,TUMB,143,1,0,1,IFF Distress Signal", "FUEL_SYSTEM(9),3001,CLK_VAR2_pnt_85,TUMB,85,-0.1,0,0.4,Fuel Selector Valve", "FUEL_SYSTEM(9),3001,CLK_VAR2_pnt_85,TUMB,85,0.1,0,0.4,Fuel Selector Valve", "WEAPON_CONTROL(4),3007,pnt_73_2,TUMB,73,0.2,0.2,0.2,Rockets Release Auto", "RIGHT_SWITCH_PANEL(14),3001,pnt_103,TUMB,103,-1,0,1,Battery Disconnect", "RIGHT_SWITCH_PANEL(14),3001,pnt_103,TUMB,103,1,0,1,Battery Disconnect", "FRONT_SWITCH_BOX(13),3012,pnt_67_1,TUMB,67,1,1,1,Gun And Camera On", "WEAPON_CONTROL(4),3010,pnt_76,TUMB,75,0.090909090909091,0,1,Rockets Counter Control", "WEAPON_CONTROL(4),3009,pnt_76,TUMB,75,-0.090909090909091,0,1,Rockets Counter Control", "FRONT_SWITCH_BOX(13),3012,pnt_67_0,TUMB,67,0,0,0,Gun And Camera Off", "IFF(27),3003,pnt_141,TUMB,141,1,-1,1,IFF TIME/OFF/ON", "IFF(27),3003,pnt_141,TUMB,141,-1,-1,1,IFF TIME/OFF/ON", "FRONT_SWITCH_BOX(13),3005,pnt_66_1,TUMB,66,0,0.1,0.1,Ignition Right"],
-    "SA342": ["PE(16),3022,WS_TELEMETRE_PTR,BTN,256,1,0,1,SA342 Lasing Button", "AM_RADIO(5),3004,VHF-FREQ-HAUT-PTR,LEV,131,0,0,1,SA342 Freq dial", "UHF_RADIO(31),3012,UHF_7,BTN,394,1,0,1,SA342 UHF 7", "NADIR(23),3002,NADIR_DOPPLER,TUMB,331,0.2,0,1,SA342 NADIR Mode", "NADIR(23),3002,NADIR_DOPPLER,TUMB,331,-0.2,0,1,SA342 NADIR Mode", "CLOCK(20),3001,CLOCK-WINDER-PTR,LEV,45,0.5,0,1,SA342 Winder", "CLOCK(20),3004,CLOCK-WINDER-PTR,BTN,270,1,0,1,SA342 Winder", "NADIR(23),3008,NADIR_DOWN,BTN,337,1,0,1,SA342 NADIR DOWN", "ELECTRIC(2),3008,INTER-MA-PTR,TUMB,56,1,-1,1,SA342 Starter Start/Stop/Air", "ELECTRIC(2),3008,INTER-MA-PTR,TUMB,56,-1,-1,1,SA342 Starter Start/Stop/Air", "ELECTRIC(2),3009,TEST-TA-PTR,BTN,57,1,0,1,SA342 Test", "INTERCOM(4),3033,IC2-UHF-PTR,LEV,80,0.5,0,1,SA342 UHF Radio Volume 2", "INTERCOM(4),3053,IC2-UHF-PTR,BTN,457,1,0,1,SA342 UHF Radio Volume 2", "AUTOPILOT(7),3028,PILOT-STICK-PA-PTR,BTN,209,1,0,1,SA342 Autopilot Button", "ELECTRIC(2),3017,FILTAS-PTR,TUMB,64,1,0,1,SA342 Sand Filter On/Off", "ELECTRIC(2),3017,FILTAS-PTR,TUMB,64,-1,0,1,SA342 Sand Filter On/Off", "NAVLIGHTS(15),3001,ANO-PTR,TUMB,146,1,-1,1,SA342 Navigation Lights CLI / OFF / FIX", "NAVLIGHTS(15),3001,ANO-PTR,TUMB,146,-1,-1,1,SA342 Navigation Lights CLI / OFF / FIX", "NADIR(23),3007,NADIR_IC,BTN,336,1,0,1,SA342 NADIR IC", "NAVLIGHTS(15),3003,LANDING-LIGHT-PTR,TUMB,105,1,-1,1,SA342 Landing Light Off/Vario/On", "NAVLIGHTS(15),3003,LANDING-LIGHT-PTR,TUMB,105,-1,-1,1,SA342 Landing Light Off/Vario/On", "NADIR(23),3004,NADIR_ENT,BTN,333,1,0,1,SA342 NADIR ENT", "NAVLIGHTS(15),3008,PUPITRE-PLANCHEBORD-PTR,TUMB,382,1,0,1,SA342 Panels Lighting On/Off", "NAVLIGHTS(15),3008,PUPITRE-PLANCHEBORD-PTR,TUMB,382,-1,0,1,SA342 Panels Lighting On/Off", "CLOCK(20),3003,CLOCK-RESET-PTR,BTN,47,1,0,1,SA342 Reset", "ELECTRIC(2),3004,VATEST-PTR,BTN,62,1,0,1,SA342 Voltmeter Test", "ELECTRIC(2),3011,EG-PILOTE-PTR,TUMB,49,1,-1,1,SA342 Pilot Wiper", "ELECTRIC(2),3011,EG-PILOTE-PTR,TUMB,49,-1,-1,1,SA342 Pilot Wiper", "ADF(21),3002,ADF_TONESWITCH_PTR,TUMB,167,1,0,1,SA342 ADF Tone", "ADF(21),3002,ADF_TONESWITCH_PTR,TUMB,167,-1,0,1,SA342 ADF Tone", "FD(25),3003,FD-VE-PTR,TUMB,222,1,-1,1,SA342 Flare Dispenser Off/Speed", "FD(25),3003,FD-VE-PTR,TUMB,222,-1,-1,1,SA342 Flare Dispenser Off/Speed", "PE(16),3021,WS_CACHE_TELEMETRE_PTR,TUMB,255,1,0,1,SA342 Lasing Button Cover", "PE(16),3021,WS_CACHE_TELEMETRE_PTR,TUMB,255,-1,0,1,SA342 Lasing Button Cover", "FD(25),3004,FD-FIRE-BUTTON-CAP-PTR,TUMB,194,1,0,1,SA342 Flare Dispenser Fire Button Cap", "FD(25),3004,FD-FIRE-BUTTON-CAP-PTR,TUMB,194,-1,0,1,SA342 Flare Dispenser Fire Button Cap", "PE(16),3032,WS_LUM_PTR,TUMB,263,1,0,1,SA342 Image Brightness", "PE(16),3031,WS_LUM_PTR,BTN,263,-1,-1,0,SA342 Image Brightness", "ADF(21),3005,ADF_LLOWKNOB_PTR,LEV,168,0,0,1,SA342 ADF Nav1 Hundred", "NADIR(23),3009,NADIR_0,BTN,351,1,0,1,SA342 NADIR 0", "PE(16),3006,PE_ALI,TUMB,367,1,0,1,SA342 Power", "PE(16),3006,PE_ALI,TUMB,367,-1,0,1,SA342 Power", "AUTOPILOT(7),3001,PA_MASTER_PTR,TUMB,31,1,0,1,SA342 Autopilot On/Off", "AUTOPILOT(7),3001,PA_MASTER_PTR,TUMB,31,-1,0,1,SA342 Autopilot On/Off", "AUTOPILOT(7),3005,PA_MODE_PTR,TUMB,35,1,-1,1,SA342 Mode Speed / OFF / Altitude", "AUTOPILOT(7),3005,PA_MODE_PTR,TUMB,35,-1,-1,1,SA342 Mode Speed / OFF / Altitude", "AUTOPILOT(7),3004,PA_LACET_PTR,TUMB,34,1,0,1,SA342 Yaw On/Off", "AUTOPILOT(7),3004,PA_LACET_PTR,TUMB,34,-1,0,1,SA342 Yaw On/Off", "AUTOPILOT(7),3002,PA_TANGAGE_PTR,TUMB,32,1,0,1,SA342 Pitch On/Off", "AUTOPILOT(7),3002,PA_TANGAGE_PTR,TUMB,32,-1,0,1,SA342 Pitch On/Off", "PE(16),3025,WS_INV_INCRUST_PTR,BTN,259,1,0,1,SA342 Inversed Symbology Toggle", "ELECTRIC(2),3006,FUEL-PUMP-FRONT-PTR,TUMB,271,1,0,1,SA342 Fuel Pump", "ELECTRIC(2),3006,FUEL-PUMP-FRONT-PTR,TUMB,271,-1,0,1,SA342 Fuel Pump", "RWR(24),3004,RWR-AUDIO-PTR,LEV,121,0,0,1,SA342 RWR Audio", "WEAPONS(26),3012,WP2_MA_RIGHT,TUMB,374,1,0,1,SA342 WP2 Ma Right", "WEAPONS(26),3012,WP2_MA_RIGHT,TUMB,374,-1,0,1,SA342 WP2 Ma Right", "FLIGHT_CONTROLS(9),3003,StdbyHA-PTR,LEV,215,0.5,0,1,SA342 STDBYHA Unlock", "FLIGHT_CONTROLS(9),3004,StdbyHA-PTR,BTN,216,1,0,1,SA342 STDBYHA Unlock", "PE(16),3030,WS_GAIN_PTR,TUMB,262,1,0,1,SA342 Gain", "PE(16),3029,WS_GAIN_PTR,BTN,262,-1,-1,0,SA342 Gain", "NADIR(23),3016,NADIR_7,BTN,346,1,0,1,SA342 NADIR 7", "NADIR(23),3018,NADIR_9,BTN,348,1,0,1,SA342 NADIR 9", "RWR(24),3005,RWR-BRT-PTR,LEV,122,0,0,1,SA342 RWR Brt", "TV(13),3002,TV-LUM-PTR,LEV,125,0,0,1,SA342 TV Contrast", "NADIR(23),3011,NADIR_2,BTN,339,1,0,1,SA342 NADIR 2", "WEAPONS(26),3004,WP1_ONOFF,TUMB,354,-1,-1,1,SA342 WP1 OnOff", "WEAPONS(26),3004,WP1_ONOFF,TUMB,354,1,-1,1,SA342 WP1 OnOff", "AUTOPILOT(7),3006,TRIM-PTR,TUMB,60,1,0,1,SA342 Trim On/Off", "AUTOPILOT(7),3006,TRIM-PTR,TUMB,60,-1,0,1,SA342 Trim On/Off", "ELECTRIC(2),3012,SPACE-PTR,TUMB,61,1,0,1,", "ELECTRIC(2),3012,SPACE-PTR,TUMB,61,-1,0,1,", "PE(16),3023,WS_CACHE_TIR_PTR,TUMB,257,1,0,1,SA342 Missile Launch Cover", "PE(16),3023,WS_CACHE_TIR_PTR,TUMB,257,-1,0,1,SA342 Missile Launch Cover", "RADAR_ALTIMETER(18),3002,RALT-ONOFF-PTR,LEV,91,0.5,0,1,SA342 On/Off - Test", "RADAR_ALTIMETER(18),3003,RALT-ONOFF-PTR,BTN,100,1,0,1,SA342 On/Off - Test", "NADIR(23),3003,NADIR_VENT,TUMB,332,0.2,0,1,SA342 NADIR Parameter", "NADIR(23),3003,NADIR_VENT,TUMB,332,-0.2,0,1,SA342 NADIR Parameter", "FM_RADIO(28),3002,FM-CHNL-PTR,TUMB,273,0.143,0,1.001,SA342 FM Chnl Selector", "FM_RADIO(28),3002,FM-CHNL-PTR,TUMB,273,-0.143,0,1.001,SA342 FM Chnl Selector", "ADF(21),3003,ADF_MODE_PTR,TUMB,178,0.33,0,0.99,SA342 ADF Mode", "ADF(21),3003,ADF_MODE_PTR,TUMB,178,-0.33,0,0.99,SA342 ADF Mode", "AUTOPILOT(7),3015,GYRO-TEST-SWITCH-PTR,TUMB,198,1,0,1,SA342 Gyro Test Switch On/Off", "AUTOPILOT(7),3015,GYRO-TEST-SWITCH-PTR,TUMB,198,-1,0,1,SA342 Gyro Test Switch On/Off", "ELECTRIC(2),3003,GENE-PTR,TUMB,268,1,0,1,SA342 Generator", "ELECTRIC(2),3003,GENE-PTR,TUMB,268,-1,0,1,SA342 Generator", "FD(25),3005,FD-FIRE-BUTTON-PTR,BTN,195,1,0,1,SA342 Flare Dispenser Fire Button", "ADF(21),3006,ADF_LMIDKNOB_PTR,LEV,169,0,0,1,SA342 ADF Nav1 Ten", "NADIR(23),3001,NADIR_BRT,LEV,330,0,0,1,SA342 NADIR Off/Brightness", "AUTOPILOT(7),3017,GYRO-KNOB-GD-PTR,TUMB,153,0.25,0,1,SA342 CM/A/GM/D/GD", "AUTOPILOT(7),3017,GYRO-KNOB-GD-PTR,TUMB,153,-0.25,0,1,SA342 CM/A/GM/D/GD", "UHF_RADIO(31),3001,UHF_KNOB,TUMB,383,0.167,0,1.002,SA342 UHF MODE", "UHF_RADIO(31),3001,UHF_KNOB,TUMB,383,-0.167,0,1.002,SA342 UHF MODE", "UHF_RADIO(31),3003,UHF_VLD,BTN,385,1,0,1,SA342 UHF VLD", "ELECTRIC(2),3002,ALTER-PTR,TUMB,265,1,0,1,SA342 Alternator", "ELECTRIC(2),3002,ALTER-PTR,TUMB,265,-1,0,1,SA342 Alternator", "INTERCOM(4),3031,IC2-VHF-PTR,LEV,79,0.5,0,1,SA342 VHF AM Radio Volume 2", "INTERCOM(4),3051,IC2-VHF-PTR,BTN,455,1,0,1,SA342 VHF AM Radio Volume 2", "NAVLIGHTS(15),3002,FLASHER-PTR,TUMB,228,1,-1,1,SA342 Anticollision Light NOR / OFF / ATT", "NAVLIGHTS(15),3002,FLASHER-PTR,TUMB,228,-1,-1,1,SA342 Anticollision Light NOR / OFF / ATT", "UHF_RADIO(31),3007,UHF_2,BTN,389,1,0,1,SA342 UHF 2", "UHF_RADIO(31),3008,UHF_3,BTN,390,1,0,1,SA342 UHF 3", "UHF_RADIO(31),3010,UHF_5,BTN,392,1,0,1,SA342 UHF 5", "ADF(21),3007,ADF_LHIGHKNOB_PTR,LEV,173,0,0,1,SA342 ADF Nav1 Unit", "ELECTRIC(2),3015,REARM-GENE-PTR,BTN,67,1,0,1,SA342 Gene Rearm", "ELECTRIC(2),3010,EG-COPILOTE-PTR,TUMB,48,1,-1,1,SA342 Copilot Wiper", "ELECTRIC(2),3010,EG-COPILOTE-PTR,TUMB,48,-1,-1,1,SA342 Copilot Wiper", "NAVLIGHTS(15),3012,FEUX-FORMATION-INTENSITY-PTR,LEV,230,0,0,1,SA342 Formation Lights Intensity", "PE(16),3034,WS_INCRUST_PTR,TUMB,219,1,0,1,SA342 Symbology Brightness", "PE(16),3033,WS_INCRUST_PTR,BTN,219,-1,-1,0,SA342 Symbology Brightness", "LIGHTS(14),3003,LABELS-PTR,LEV,145,0,0,1,SA342 UV Lighting", "UHF_RADIO(31),3014,UHF_9,BTN,396,1,0,1,SA342 UHF 9", "ELECTRIC(2),3018,EG-STICK-PTR,BTN,53,1,0,1,SA342 Wiper once", "RWR(24),3003,RWR-PAGE-PTR,BTN,150,1,0,1,SA342 RWR Page", "UHF_RADIO(31),3015,UHF_0,BTN,397,1,0,1,SA342 UHF 0", "UHF_RADIO(31),3011,UHF_6,BTN,393,1,0,1,SA342 UHF 6", "PE(16),3002,PE_VDOVTH,BTN,364,1,0,1,SA342 VDO/VTH", "NADIR(23),3013,NADIR_4,BTN,342,1,0,1,SA342 NADIR 4", "ADF(21),3009,ADF_RMIDKNOB_PTR,LEV,175,0,0,1,SA342 ADF Nav2 Ten", "ELECTRIC(2),3001,BATTERIE-PTR,TUMB,264,1,0,1,SA342 Battery", "ELECTRIC(2),3001,BATTERIE-PTR,TUMB,264,-1,0,1,SA342 Battery", "INTERCOM(4),3032,IC2-FM1-PTR,LEV,81,0.5,0,1,SA342 FM Radio Volume 2", "INTERCOM(4),3052,IC2-FM1-PTR,BTN,456,1,0,1,SA342 FM Radio Volume 2", "NADIR(23),3015,NADIR_6,BTN,344,1,0,1,SA342 NADIR 6", "FLIGHT_CONTROLS(9),3007,ArtVisVhfDop-PTR,TUMB,218,0.33,0,0.99,SA342 Source", "FLIGHT_CONTROLS(9),3007,ArtVisVhfDop-PTR,TUMB,218,-0.33,0,0.99,SA342 Source", "NADIR(23),3019,NADIR_POL,BTN,341,1,0,1,SA342 NADIR POL", "PE(16),3005,PE_TLM,TUMB,366,0.5,0,1,SA342 CTH", "PE(16),3005,PE_TLM,TUMB,366,-0.5,0,1,SA342 CTH", "NADIR(23),3014,NADIR_5,BTN,343,1,0,1,SA342 NADIR 5", "PE(16),3007,PE_MODE,TUMB,370,0.25,0,1,SA342 Mode", "PE(16),3007,PE_MODE,TUMB,370,-0.25,0,1,SA342 Mode", "ELECTRIC(2),3013,HYD-PTR,BTN,59,1,0,1,SA342 HYD Test", "WEAPONS(26),3011,WP2_MA_LEFT_COVER,TUMB,373,1,0,1,SA342 WP2 Ma Left Cover", "WEAPONS(26),3011,WP2_MA_LEFT_COVER,TUMB,373,-1,0,1,SA342 WP2 Ma Left Cover", "PE(16),3003,PE_ZOOM,TUMB,365,1,0,1,SA342 Zoom", "PE(16),3004,PE_ZOOM,BTN,365,-1,-1,0,SA342 Zoom", "FLIGHT_CONTROLS(9),3001,HA-PTR,LEV,115,0.5,0,1,SA342 HA Unlock", "FLIGHT_CONTROLS(9),3002,HA-PTR,BTN,116,1,0,1,SA342 HA Unlock", "NADIR(23),3022,NADIR_GEL,BTN,350,1,0,1,SA342 NADIR GEL", "UHF_RADIO(31),3009,UHF_4,BTN,391,1,0,1,SA342 UHF 4", "NADIR(23),3012,NADIR_3,BTN,340,1,0,1,SA342 NADIR 3", "ELECTRIC(2),3014,REARM-ALTER-PTR,BTN,66,1,0,1,SA342 Alter Rearm", "ADF(21),3001,ADF_SELECT_PTR,TUMB,166,1,0,1,SA342 ADF Select", "ADF(21),3001,ADF_SELECT_PTR,TUMB,166,-1,0,1,SA342 ADF Select", "FD(25),3001,FD-OPE-PTR,TUMB,220,-1,-1,1,SA342 Flare Dispenser G/G+D/D", "FD(25),3001,FD-OPE-PTR,TUMB,220,1,-1,1,SA342 Flare Dispenser G/G+D/D", "ELECTRIC(2),3005,PITOT-PTR,TUMB,170,1,0,1,SA342 Pitot", "ELECTRIC(2),3005,PITOT-PTR,TUMB,170,-1,0,1,SA342 Pitot", "LIGHTS(14),3002,PUP-PTR,LEV,21,0,0,1,SA342 Console Lighting", "RWR(24),3001,RWR-ON-OFF-PTR,TUMB,148,1,-1,1,SA342 RWR On/Off Croc", "RWR(24),3001,RWR-ON-OFF-PTR,TUMB,148,-1,-1,1,SA342 RWR On/Off Croc",
-        "FD(25),3002,FD-CC-SEQ-PTR,TUMB,221,1,0,1,SA342 Flare Dispenser Mode", "FD(25),3002,FD-CC-SEQ-PTR,TUMB,221,-1,0,1,SA342 Flare Dispenser Mode", "TORQUE(17),3002,TORQUE-PTR,LEV,54,0.5,0,1,SA342 Bug/Test", "TORQUE(17),3001,TORQUE-PTR,BTN,58,1,0,1,SA342 Bug/Test", "INTERCOM(4),3002,IC1-FM1-PTR,LEV,70,0.5,0,1,SA342 FM Radio Volume", "INTERCOM(4),3022,IC1-FM1-PTR,BTN,453,1,0,1,SA342 FM Radio Volume", "PE(16),3028,WS_NET_PTR,TUMB,261,1,0,1,SA342 Image Focus", "PE(16),3027,WS_NET_PTR,BTN,261,-1,-1,0,SA342 Image Focus", "INTERCOM(4),3001,IC1-VHF-PTR,LEV,68,0.5,0,1,SA342 VHF AM Radio Volume", "INTERCOM(4),3021,IC1-VHF-PTR,BTN,452,1,0,1,SA342 VHF AM Radio Volume", "AM_RADIO(5),3001,VHF-SQ-BAS-PTR,TUMB,128,0.33,0,0.99,SA342 Selector", "AM_RADIO(5),3001,VHF-SQ-BAS-PTR,TUMB,128,-0.33,0,0.99,SA342 Selector", "AUTOPILOT(7),3003,PA_ROULIS_PTR,TUMB,33,1,0,1,SA342 Roll On/Off", "AUTOPILOT(7),3003,PA_ROULIS_PTR,TUMB,33,-1,0,1,SA342 Roll On/Off", "RWR(24),3002,RWR-MARQUEUR-PTR,BTN,149,1,0,1,SA342 RWR Marker", "AM_RADIO(5),3002,VHF-SQ-HAUT-PTR,LEV,129,0,0,1,SA342 Freq decimals", "WEAPONS(26),3001,MASTER_ARM_PTR,TUMB,269,1,0,1,SA342 Master arm On/Off", "WEAPONS(26),3001,MASTER_ARM_PTR,TUMB,269,-1,0,1,SA342 Master arm On/Off", "PE(16),3001,PE_CENTERING,BTN,362,1,0,1,SA342 Centering", "UHF_RADIO(31),3013,UHF_8,BTN,395,1,0,1,SA342 UHF 8", "LIGHTS(14),3006,LENTILLE_PTR,TUMB,154,1,0,1,SA342 Red Lens On/Off", "LIGHTS(14),3006,LENTILLE_PTR,TUMB,154,-1,0,1,SA342 Red Lens On/Off", "PH(27),3001,PV_CLE_PTR,TUMB,180,0.25,0,1,Test/On/Off", "PH(27),3001,PV_CLE_PTR,TUMB,180,-0.25,0,1,Test/On/Off", "AUTOPILOT(7),3014,GYRO-TEST-COVER-PTR,TUMB,197,1,0,1,SA342 Gyro Test Cover On/Off", "AUTOPILOT(7),3014,GYRO-TEST-COVER-PTR,TUMB,197,-1,0,1,SA342 Gyro Test Cover On/Off", "WEAPONS(26),3010,WP2_MA_LEFT,TUMB,372,1,0,1,SA342 WP2 Ma Left", "WEAPONS(26),3010,WP2_MA_LEFT,TUMB,372,-1,0,1,SA342 WP2 Ma Left", "CONTROLS(8),3001,DEB-EFF-PTR,BTN,50,1,0,1,SA342 Magnetic Brake", "UHF_RADIO(31),3006,UHF_1,BTN,388,1,0,1,SA342 UHF 1", "LIGHTS(14),3005,KNOB-PLAFOND-PTR,LEV,147,0,0,1,SA342 Roof Lamp Knob", "PE(16),3024,WS_TIR_PTR,BTN,258,1,0,1,SA342 Missile Launch Button", "LIGHTS(14),3004,INTER-BNL-PTR,TUMB,23,1,0,1,SA342 NORM/BNL", "LIGHTS(14),3004,INTER-BNL-PTR,TUMB,23,-1,0,1,SA342 NORM/BNL", "TV(13),3003,TV-BRT-PTR,LEV,123,0,0,1,SA342 TV Brightness", "ADF(21),3010,ADF_RHIGHKNOB_PTR,LEV,176,0,0,1,SA342 ADF Nav2 Unit", "AUTOPILOT(7),3016,GYRO-SWITCH-GD-PTR,TUMB,199,-1,-1,1,SA342 Left/Center/Right", "AUTOPILOT(7),3016,GYRO-SWITCH-GD-PTR,TUMB,199,1,-1,1,SA342 Left/Center/Right", "RADAR_ALTIMETER(18),3001,RALT-DANGERALT-PTR,LEV,96,0,0,1,SA342 Radar Alt Bug", "CLOCK(20),3002,CLOCK-STARTSTOP-PTR,BTN,46,1,0,1,SA342 Start/Stop", "WEAPONS(26),3009,WP1_BRT,LEV,357,0,0,1,SA342 WP1 Brt", "INTERCOM(4),3003,IC1-UHF-PTR,LEV,69,0.5,0,1,SA342 UHF Radio Volume", "INTERCOM(4),3023,IC1-UHF-PTR,BTN,454,1,0,1,SA342 UHF Radio Volume", "ELECTRIC(2),3007,RSUPP-PTR,TUMB,267,1,0,1,SA342 Additionnal Fuel Tank", "ELECTRIC(2),3007,RSUPP-PTR,TUMB,267,-1,0,1,SA342 Additionnal Fuel Tank", "NADIR(23),3006,NADIR_AUX,BTN,335,1,0,1,SA342 NADIR AUX", "WEAPONS(26),3002,PILOTSIGHT-PTR,TUMB,172,1,0,1,SA342 Pilot Sight", "WEAPONS(26),3002,PILOTSIGHT-PTR,TUMB,172,-1,0,1,SA342 Pilot Sight", "NADIR(23),3021,NADIR_POS,BTN,349,1,0,1,SA342 NADIR POS", "NAVLIGHTS(15),3006,LANDING-LIGHT-EXTEND-PTR,TUMB,106,1,0,1,SA342 Landing Light Extend/Retract", "NAVLIGHTS(15),3004,LANDING-LIGHT-EXTEND-PTR,BTN,106,-1,-1,0,SA342 Landing Light Extend/Retract", "WEAPONS(26),3014,WP2_SEQ,TUMB,376,1,0,1,SA342 WP2 Seq", "WEAPONS(26),3014,WP2_SEQ,TUMB,376,-1,0,1,SA342 WP2 Seq", "ADF(21),3004,ADF_GAIN_PTR,LEV,179,0,0,1,SA342 ADF Gain", "NADIR(23),3023,NADIR_EFF,BTN,352,1,0,1,SA342 NADIR EFF", "ELECTRIC(2),3016,RCONV-PTR,TUMB,63,1,0,1,SA342 Convoy Tank On/Off", "ELECTRIC(2),3016,RCONV-PTR,TUMB,63,-1,0,1,SA342 Convoy Tank On/Off", "AUTOPILOT(7),3007,FMAG-PTR,TUMB,65,1,0,1,SA342 Magnetic Brake On/Off", "AUTOPILOT(7),3007,FMAG-PTR,TUMB,65,-1,0,1,SA342 Magnetic Brake On/Off", "PH(27),3002,PV-GISEMENT-PTR,TUMB,181,0.125,0,1,SA342 Station Select", "PH(27),3002,PV-GISEMENT-PTR,TUMB,181,-0.125,0,1,SA342 Station Select", "NADIR(23),3017,NADIR_8,BTN,347,1,0,1,SA342 NADIR 8", "NADIR(23),3020,NADIR_GEO,BTN,345,1,0,1,SA342 NADIR GEO", "ADF(21),3008,ADF_RLOWKNOB_PTR,LEV,174,0,0,1,SA342 ADF Nav2 Hundred", "BARO_ALTIMETER(19),3001,BALT-PTR,LEV,89,0,0,1,SA342 Baro pressure QFE knob", "AUTOPILOT(7),3008,HOVER-PTR,BTN,294,1,0,1,SA342 Auto-Hover", "LIGHTS(14),3001,PBO-PTR,LEV,22,0,0,1,SA342 Main Dashboard Lighting", "PE(16),3026,WS_INV_FOND_PTR,BTN,260,1,0,1,SA342 Inversed Image Toggle", "AUTOPILOT(7),3012,SLAVE-PTR,BTN,293,1,0,1,SA342 Slave", "FM_RADIO(28),3001,FM-MAIN-PTR,TUMB,272,0.25,0,1,SA342 FM Main Selector", "FM_RADIO(28),3001,FM-MAIN-PTR,TUMB,272,-0.25,0,1,SA342 FM Main Selector", "WEAPONS(26),3013,WP2_MA_RIGHT_COVER,TUMB,375,1,0,1,SA342 WP2 Ma Right Cover", "WEAPONS(26),3013,WP2_MA_RIGHT_COVER,TUMB,375,-1,0,1,SA342 WP2 Ma Right Cover", "AM_RADIO(5),3003,VHF-FREQ-BAS-PTR,TUMB,130,1,0,1,SA342 25/50kHz Selector", "AM_RADIO(5),3003,VHF-FREQ-BAS-PTR,TUMB,130,-1,0,1,SA342 25/50kHz Selector", "NAVLIGHTS(15),3010,ANTICOLL-INTENSITY-PTR,LEV,30,0,0,1,SA342 AntiCollision Light Intensity", "NAVLIGHTS(15),3011,FEUX-FORMATION-INTER-PTR,TUMB,229,1,0,1,SA342 Formation Lights On/Off", "NAVLIGHTS(15),3011,FEUX-FORMATION-INTER-PTR,TUMB,229,-1,0,1,SA342 Formation Lights On/Off", "NADIR(23),3005,NADIR_DES,BTN,334,1,0,1,SA342 NADIR DES", "NADIR(23),3010,NADIR_1,BTN,338,1,0,1,SA342 NADIR 1", "PH(27),3003,PV_LUM_PTR,LEV,182,0,0,1,SA342 Brightness", "TV(13),3001,TV-INTER-PTR,TUMB,124,1,0,1,SA342 TV On/Off", "TV(13),3001,TV-INTER-PTR,TUMB,124,-1,0,1,SA342 TV On/Off"],
-    "SpitfireLFMkIX": ["VHF_RADIO(15),3007,RCTRL_T,TUMB,156,1,0,1,Cockpit.SpitfireLFMkIX.radio_mode", "VHF_RADIO(15),3008,RCTRL_T,BTN,156,-1,-1,0,Cockpit.SpitfireLFMkIX.radio_mode", "ENGINE_CONTROLS(2),3027,BOOSTER,BTN,67,1,0,1,Cockpit.SpitfireLFMkIX.booster", "VHF_RADIO(15),3017,RCTRL_TLOCK,TUMB,155,-1,0,1,Cockpit.SpitfireLFMkIX.radio_lock", "VHF_RADIO(15),3017,RCTRL_TLOCK,TUMB,155,1,0,1,Cockpit.SpitfireLFMkIX.radio_lock", "ENGINE_CONTROLS(2),3015,MAGNETO0,TUMB,56,-1,0,1,Cockpit.SpitfireLFMkIX.magneto0", "ENGINE_CONTROLS(2),3015,MAGNETO0,TUMB,56,1,0,1,Cockpit.SpitfireLFMkIX.magneto0", "WEAPONS(5),3001,SAFETY,TUMB,3,-1,0,1,Cockpit.SpitfireLFMkIX.safety", "WEAPONS(5),3001,SAFETY,TUMB,3,1,0,1,Cockpit.SpitfireLFMkIX.safety", "TERTIARY_CONTROLS(4),3001,PITLITE_LH,LEV,60,0.5,0,1,Cockpit.SpitfireLFMkIX.illumination_lh", "VHF_RADIO(15),3001,RCTRL_OFF,BTN,115,1,0,1,Cockpit.SpitfireLFMkIX.radio_0", "ENGINE_CONTROLS(2),3053,DILUTER,BTN,158,1,0,1,Cockpit.SpitfireLFMkIX.dilution", "WEAPONS(5),3004,BUTTON_CAN,BTN,5,1,0,1,Cockpit.SpitfireLFMkIX.trigger_1", "WEAPONS(5),3003,BUTTON_MG,BTN,4,1,0,1,Cockpit.SpitfireLFMkIX.trigger_0", "ENGINE_CONTROLS(2),3057,MS_TEST,BTN,160,1,0,1,Cockpit.SpitfireLFMkIX.supercharger_test", "CONTROLS(1),3009,FLAPS,TUMB,47,0,0,1,Cockpit.SpitfireLFMkIX.flaps", "CONTROLS(1),3009,FLAPS,TUMB,47,1,0,1,Cockpit.SpitfireLFMkIX.flaps", "CONTROLS(1),3021,DEICER,TUMB,87,0,0,1,Cockpit.SpitfireLFMkIX.deicer", "CONTROLS(1),3021,DEICER,TUMB,87,1,0,1,Cockpit.SpitfireLFMkIX.deicer", "ENGINE_CONTROLS(2),3037,FUEL_COCK,TUMB,100,0,0,1,Cockpit.SpitfireLFMkIX.fuel_cock_primary", "ENGINE_CONTROLS(2),3037,FUEL_COCK,TUMB,100,1,0,1,Cockpit.SpitfireLFMkIX.fuel_cock_primary", "CONTROLS(1),3017,COMPASS_RING,LEV,74,0,0,1,Cockpit.SpitfireLFMkIX.compass", "ENGINE_CONTROLS(2),3017,MAGNETO1,TUMB,57,-1,0,1,Cockpit.SpitfireLFMkIX.magneto1", "ENGINE_CONTROLS(2),3017,MAGNETO1,TUMB,57,1,0,1,Cockpit.SpitfireLFMkIX.magneto1", "WEAPONS(5),3020,GUNSIGHT_DIMMER,LEV,81,0,0,1,Cockpit.SpitfireLFMkIX.gun_sight_illumination", "VHF_RADIO(15),3004,RCTRL_C,BTN,118,1,0,1,Cockpit.SpitfireLFMkIX.radio_c", "ENGINE_CONTROLS(2),3029,PRIMER,LEV,68,0.04,0,1,Cockpit.SpitfireLFMkIX.primer", "ENGINE_CONTROLS(2),3030,PRIMER,BTN,69,1,0,1,Cockpit.SpitfireLFMkIX.primer", "ENGINE_CONTROLS(2),3061,RAD_TEST,BTN,162,1,0,1,Cockpit.SpitfireLFMkIX.radiator_test", "TERTIARY_CONTROLS(4),3019,IFF_D,TUMB,107,-1,0,1,Cockpit.SpitfireLFMkIX.iff_d", "TERTIARY_CONTROLS(4),3019,IFF_D,TUMB,107,1,0,1,Cockpit.SpitfireLFMkIX.iff_d", "WEAPONS(5),3013,DROPTANK_JETT,BTN,99,1,0,1,Cockpit.SpitfireLFMkIX.droptank_release", "TERTIARY_CONTROLS(4),3021,IFF_COVER,TUMB,108,-1,0,1,Cockpit.SpitfireLFMkIX.iff_cover", "TERTIARY_CONTROLS(4),3021,IFF_COVER,TUMB,108,1,0,1,Cockpit.SpitfireLFMkIX.iff_cover", "TERTIARY_CONTROLS(4),3023,IFF_0,BTN,109,1,0,1,Cockpit.SpitfireLFMkIX.iff_0", "ENGINE_CONTROLS(2),3023,STARTER,BTN,65,1,0,1,Cockpit.SpitfireLFMkIX.starter", "ENGINE_CONTROLS(2),3041,DROPTANK_COCK,TUMB,98,0,0,1,Cockpit.SpitfireLFMkIX.fuel_cock_droptank", "ENGINE_CONTROLS(2),3041,DROPTANK_COCK,TUMB,98,1,0,1,Cockpit.SpitfireLFMkIX.fuel_cock_droptank", "WEAPONS(5),3005,BUTTON_LINKED,BTN,6,1,0,1,Cockpit.SpitfireLFMkIX.trigger_2", "CLOCK(17),3004,CLK_PINION,LEV,55,0.04,0,1,Cockpit.SpitfireLFMkIX.clock", "CLOCK(17),3006,CLK_PINION,TUMB,54,1,0,1,Cockpit.SpitfireLFMkIX.clock", "CONTROLS(1),3051,HATCH,TUMB,149,-1,0,1,Cockpit.SpitfireLFMkIX.canopy_operate", "CONTROLS(1),3051,HATCH,TUMB,149,1,0,1,Cockpit.SpitfireLFMkIX.canopy_operate", "CONTROLS(1),3057,HATCH_JETTISON,BTN,140,1,0,1,Cockpit.SpitfireLFMkIX.canopy_jettison", "WEAPONS(5),3007,GUNSIGHT_RANGE,LEV,77,0,0,1,Cockpit.SpitfireLFMkIX.gun_sight_range", "CONTROLS(1),3059,SIDE_DOOR,TUMB,147,-1,0,1,Cockpit.SpitfireLFMkIX.sidedoor_operate", "CONTROLS(1),3059,SIDE_DOOR,TUMB,147,1,0,1,Cockpit.SpitfireLFMkIX.sidedoor_operate", "TERTIARY_CONTROLS(4),3017,IFF_B,TUMB,106,-1,0,1,Cockpit.SpitfireLFMkIX.iff_b", "TERTIARY_CONTROLS(4),3017,IFF_B,TUMB,106,1,0,1,Cockpit.SpitfireLFMkIX.iff_b", "TERTIARY_CONTROLS(4),3011,MORSE_DN,TUMB,93,-0.5,0,1,Cockpit.SpitfireLFMkIX.id_lamp_down_mode", "TERTIARY_CONTROLS(4),3011,MORSE_DN,TUMB,93,0.5,0,1,Cockpit.SpitfireLFMkIX.id_lamp_down_mode", "CONTROLS(1),3037,ALT_MBAR,LEV,30,1,0,1,Cockpit.SpitfireLFMkIX.altimeter", "ENGINE_CONTROLS(2),3045,CARB_AIR,TUMB,137,0,0,1,Cockpit.SpitfireLFMkIX.carburettor_flap", "ENGINE_CONTROLS(2),3045,CARB_AIR,TUMB,137,1,0,1,Cockpit.SpitfireLFMkIX.carburettor_flap", "WEAPONS(5),3010,GUNSIGHT_BASE,LEV,78,0,0,1,Cockpit.SpitfireLFMkIX.gun_sight_span", "VHF_RADIO(15),3006,RCTRL_DIM,TUMB,125,-1,0,1,Cockpit.SpitfireLFMkIX.radio_dimmer", "VHF_RADIO(15),3006,RCTRL_DIM,TUMB,125,1,0,1,Cockpit.SpitfireLFMkIX.radio_dimmer", "ENGINE_CONTROLS(2),3021,STARTER_COVER,TUMB,64,-1,0,1,Cockpit.SpitfireLFMkIX.starter_cover", "ENGINE_CONTROLS(2),3021,STARTER_COVER,TUMB,64,1,0,1,Cockpit.SpitfireLFMkIX.starter_cover", "CONTROLS(1),3029,TRIM_WHEEL,LEV,145,0,-1,1,Cockpit.SpitfireLFMkIX.trim_elevator", "VHF_RADIO(15),3002,RCTRL_A,BTN,116,1,0,1,Cockpit.SpitfireLFMkIX.radio_a", "CONTROLS(1),3041,DI,LEV,32,1,0,1,Cockpit.SpitfireLFMkIX.di", "ENGINE_CONTROLS(2),3059,RAD_TEST_COVER,TUMB,161,-1,0,1,Cockpit.SpitfireLFMkIX.radiator_cover", "ENGINE_CONTROLS(2),3059,RAD_TEST_COVER,TUMB,161,1,0,1,Cockpit.SpitfireLFMkIX.radiator_cover", "CONTROLS(1),3002,BRAKES,LEV,9,0,0,1,Cockpit.SpitfireLFMkIX.wheel_brakes", "ENGINE_CONTROLS(2),3009,MIX,TUMB,130,0,0,1,Cockpit.SpitfireLFMkIX.mix", "ENGINE_CONTROLS(2),3009,MIX,TUMB,130,1,0,1,Cockpit.SpitfireLFMkIX.mix", "WEAPONS(5),3016,GUNSIGHT_TINT,TUMB,79,0,0,1,Cockpit.SpitfireLFMkIX.gun_sight_tint", "WEAPONS(5),3016,GUNSIGHT_TINT,TUMB,79,1,0,1,Cockpit.SpitfireLFMkIX.gun_sight_tint", "TERTIARY_CONTROLS(4),3015,MORSE_KEY,BTN,94,1,0,1,Cockpit.SpitfireLFMkIX.morse_key", "VHF_RADIO(15),3005,RCTRL_D,BTN,119,1,0,1,Cockpit.SpitfireLFMkIX.radio_d", "TERTIARY_CONTROLS(4),3004,PITLITE_RH,LEV,61,0.5,0,1,Cockpit.SpitfireLFMkIX.illumination_rh", "CONTROLS(1),3035,PITOT,TUMB,134,-1,0,1,Cockpit.SpitfireLFMkIX.pitot", "CONTROLS(1),3035,PITOT,TUMB,134,1,0,1,Cockpit.SpitfireLFMkIX.pitot", "ENGINE_CONTROLS(2),3035,WOBBLE_PUMP,BTN,90,1,0,1,Cockpit.SpitfireLFMkIX.wobble", "OXYGEN(3),3003,OXY_VALVE,TUMB,13,0,0,1,Cockpit.SpitfireLFMkIX.oxygen_valve", "OXYGEN(3),3003,OXY_VALVE,TUMB,13,1,0,1,Cockpit.SpitfireLFMkIX.oxygen_valve", "CONTROLS(1),3044,RTRIM_WHEEL,LEV,146,0,-1,1,Cockpit.SpitfireLFMkIX.trim_rudder", "WEAPONS(5),3018,GUNSIGHT_SWITCH,TUMB,80,-1,0,1,Cockpit.SpitfireLFMkIX.gun_sight_master", "WEAPONS(5),3018,GUNSIGHT_SWITCH,TUMB,80,1,0,1,Cockpit.SpitfireLFMkIX.gun_sight_master", "ENGINE_CONTROLS(2),3019,BLOWER,TUMB,58,-1,0,1,Cockpit.SpitfireLFMkIX.supercharger_mode", "ENGINE_CONTROLS(2),3019,BLOWER,TUMB,58,1,0,1,Cockpit.SpitfireLFMkIX.supercharger_mode", "CONTROLS(1),3023,UC_EMER,BTN,88,1,0,1,Cockpit.SpitfireLFMkIX.uc_emergency", "TERTIARY_CONTROLS(4),3007,MORSE_UP,TUMB,92,0.5,0,1,Cockpit.SpitfireLFMkIX.id_lamp_up_mode", "TERTIARY_CONTROLS(4),3007,MORSE_UP,TUMB,92,-0.5,0,1,Cockpit.SpitfireLFMkIX.id_lamp_up_mode", "TERTIARY_CONTROLS(4),3025,IFF_1,BTN,110,1,0,1,Cockpit.SpitfireLFMkIX.iff_1", "ENGINE_CONTROLS(2),3051,DILUTER_COVER,TUMB,157,-1,0,1,Cockpit.SpitfireLFMkIX.dilution_cover", "ENGINE_CONTROLS(2),3051,DILUTER_COVER,TUMB,157,1,0,1,Cockpit.SpitfireLFMkIX.dilution_cover", "ENGINE_CONTROLS(2),3043,FUEL_PUMP,TUMB,135,-1,0,1,Cockpit.SpitfireLFMkIX.fuel_pump", "ENGINE_CONTROLS(2),3043,FUEL_PUMP,TUMB,135,1,0,1,Cockpit.SpitfireLFMkIX.fuel_pump", "CONTROLS(1),3025,UC,TUMB,148,-1,0,1,Cockpit.SpitfireLFMkIX.uc", "CONTROLS(1),3025,UC,TUMB,148,1,0,1,Cockpit.SpitfireLFMkIX.uc", "ENGINE_CONTROLS(2),3025,BOOSTER_COVER,TUMB,66,-1,0,1,Cockpit.SpitfireLFMkIX.booster_cover", "ENGINE_CONTROLS(2),3025,BOOSTER_COVER,TUMB,66,1,0,1,Cockpit.SpitfireLFMkIX.booster_cover", "CONTROLS(1),3033,RADIATOR,TUMB,133,-1,0,1,Cockpit.SpitfireLFMkIX.radiator_mode", "CONTROLS(1),3033,RADIATOR,TUMB,133,1,0,1,Cockpit.SpitfireLFMkIX.radiator_mode", "CONTROLS(1),3007,NAV_LIGHTS,TUMB,46,-1,0,1,Cockpit.SpitfireLFMkIX.nav_lights", "CONTROLS(1),3007,NAV_LIGHTS,TUMB,46,1,0,1,Cockpit.SpitfireLFMkIX.nav_lights", "ENGINE_CONTROLS(2),3099,UC_DOWN_C,TUMB,131,-1,0,1,Cockpit.SpitfireLFMkIX.uc_down_indication", "ENGINE_CONTROLS(2),3099,UC_DOWN_C,TUMB,131,1,0,1,Cockpit.SpitfireLFMkIX.uc_down_indication", "WEAPONS(5),3015,BUTTON_BOMB,BTN,128,1,0,1,Cockpit.SpitfireLFMkIX.trigger_bomb", "ENGINE_CONTROLS(2),3055,MS_TEST_COVER,TUMB,159,-1,0,1,Cockpit.SpitfireLFMkIX.supercharger_cover", "ENGINE_CONTROLS(2),3055,MS_TEST_COVER,TUMB,159,1,0,1,Cockpit.SpitfireLFMkIX.supercharger_cover", "ENGINE_CONTROLS(2),3033,TANK_PRS,TUMB,70,0,0,1,Cockpit.SpitfireLFMkIX.tank_pressurizer", "ENGINE_CONTROLS(2),3033,TANK_PRS,TUMB,70,1,0,1,Cockpit.SpitfireLFMkIX.tank_pressurizer", "VHF_RADIO(15),3003,RCTRL_B,BTN,117,1,0,1,Cockpit.SpitfireLFMkIX.radio_b", "CONTROLS(1),3005,FUEL_GAUGE,BTN,44,1,0,1,Cockpit.SpitfireLFMkIX.fuel_gauge", "CONTROLS(1),3011,UC_BLIND,TUMB,50,0,0,1,Cockpit.SpitfireLFMkIX.uc_blind", "CONTROLS(1),3011,UC_BLIND,TUMB,50,1,0,1,Cockpit.SpitfireLFMkIX.uc_blind"],
-    "TF-51D": ["HOMING_ADAPTER(28),3005,pnt_152_0,TUMB,152,0,0,0,Homing Adapter TRANSMIT", "ARTIFICIAL_HORIZON(19),3002,pnt_17,LEV,17,1,0,1,Pitch Adjustment", "VHF_RADIO(24),3015,pnt_116,LEV,116,1,0,1,Radio Audio Volume ", "FRONT_SWITCH_BOX(13),3011,CLK_VAR2_pnt_68,TUMB,68,-0.1,0,0.3,Release Mode", "FRONT_SWITCH_BOX(13),3011,CLK_VAR2_pnt_68,TUMB,68,0.1,0,0.3,Release Mode", "FRONT_SWITCH_BOX(13),3015,pnt_68_0,TUMB,68,0,0,0,Bombs and Rockets Safe", "RIGHT_SWITCH_PANEL(14),3029,pnt_110_0,TUMB,110,1,0,1,Amber Recognition Light Steady/Off", "FUEL_SYSTEM(9),3004,pnt_85_1,TUMB,85,0.1,0.1,0.1,Select Left Main Tank", "TAIL_WARNING_RADAR(25),3003,pnt_115,BTN,115,1,0,1,Tail Warning Radar Test", "FUEL_SYSTEM(9),3002,pnt_86,TUMB,86,-1,0,1,Fuel Shut-Off Valve", "FUEL_SYSTEM(9),3002,pnt_86,TUMB,86,1,0,1,Fuel Shut-Off Valve", "FUEL_SYSTEM(9),3005,pnt_86_0,TUMB,86,0,0,0,Fuel Shut-Off Valve Off", "TAIL_WARNING_RADAR(25),3004,pnt_113,LEV,113,1,0,1,Tail Warning Radar Light Control", "HOMING_ADAPTER(28),3001,pnt_152,TUMB,152,0.1,0,0.2,Homing Adapter Mode", "HOMING_ADAPTER(28),3001,pnt_152,TUMB,152,-0.1,0,0.2,Homing Adapter Mode", "FRONT_SWITCH_BOX(13),3009,CLK_VAR2_pnt_69,TUMB,69,-1,-1,1,Left Bomb Arm/Chemical", "FRONT_SWITCH_BOX(13),3009,CLK_VAR2_pnt_69,TUMB,69,1,-1,1,Left Bomb Arm/Chemical", "REMOTE_COMPASS(23),3001,pnt_3,LEV,3,1,0,1,Course Set", "FRONT_SWITCH_BOX(13),3014,pnt_70_-1,TUMB,70,-1,-1,-1,Right Bomb Arm On", "TAIL_WARNING_RADAR(25),3007,pnt_114_0,TUMB,114,0,0,0,Tail Warning Radar Power Off", "TAIL_WARNING_RADAR(25),3008,pnt_115_1,BTN,115,1,0,1,Tail Warning Radar Test", "RIGHT_SWITCH_PANEL(14),3012,pnt_103_0,TUMB,103,0,0,0,Battery Disconnect", "RIGHT_SWITCH_PANEL(14),3005,pnt_105,TUMB,105,-1,0,1,Pitot Heating", "RIGHT_SWITCH_PANEL(14),3005,pnt_105,TUMB,105,1,0,1,Pitot Heating", "RIGHT_SWITCH_PANEL(14),3021,pnt_108,TUMB,108,1,-1,1,Red Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3021,pnt_108,TUMB,108,-1,-1,1,Red Recognition Light Key/Off/Steady", "FUEL_SYSTEM(9),3004,pnt_85_0,TUMB,85,0.4,0.4,0.4,Select Left Combat Tank", "RIGHT_SWITCH_PANEL(14),3027,pnt_108_1,TUMB,108,-1,-1,0,Red Recognition Light Key/Off", "CONTROL_SYSTEM(12),3005,pnt_84,BTN,84,1,0,1,Parking Brake Handle", "CONTROL_SYSTEM(12),3007,pnt_83,BTN,83,1,0,1,Unsafe Landing Gear Light Test", "CONTROL_SYSTEM(12),3018,pnt_81,BTN,81,1,0,1,Safe Landing Gear Light Test", "RIGHT_SWITCH_PANEL(14),3003,pnt_102,TUMB,102,-1,0,1,Generator Disconnect", "RIGHT_SWITCH_PANEL(14),3003,pnt_102,TUMB,102,1,0,1,Generator Disconnect", "RIGHT_SWITCH_PANEL(14),3025,pnt_112,BTN,112,1,0,1,Circuit Protectors Reset", "RIGHT_SWITCH_PANEL(14),3019,pnt_104,TUMB,104,-1,0,1,Gun Heating", "RIGHT_SWITCH_PANEL(14),3019,pnt_104,TUMB,104,1,0,1,Gun Heating", "CPT_MECH(6),3003,pnt_149,TUMB,149,-1,0,1,Canopy Emergency Release Handle", "CPT_MECH(6),3003,pnt_149,TUMB,149,1,0,1,Canopy Emergency Release Handle", "RIGHT_SWITCH_PANEL(14),3022,pnt_109,TUMB,109,1,-1,1,Green Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3022,pnt_109,TUMB,109,-1,-1,1,Green Recognition Light Key/Off/Steady", "FUEL_SYSTEM(9),3005,pnt_86_1,TUMB,86,1,1,1,Fuel Shut-Off Valve On", "ENGINE_SYSTEM(5),3002,pnt_88_0,BTN,88,0.1,0,0.1,Close Oil Control", "ENGINE_CONTROL_PANEL(15),3011,pnt_65,BTN,65,1,0,1,Primer Activate", "RIGHT_SWITCH_PANEL(14),3013,pnt_102_1,TUMB,102,1,1,1,Generator Connect", "ENVIRONMENT_SYSTEM(11),3002,pnt_158,LEV,158,0,0,1,Cold Air", "RIGHT_SWITCH_PANEL(14),3015,pnt_106_0,TUMB,106,-1,-1,0,Wing Position Lights Dim/Off", "RIGHT_SWITCH_PANEL(14),3014,pnt_105_1,TUMB,105,1,1,1,Pitot Heating On", "FUEL_SYSTEM(9),3004,pnt_85_3,TUMB,85,0.3,0.3,0.3,Select Right Main Tank", "HOMING_ADAPTER(28),3002,pnt_153,TUMB,153,-1,0,1,Homing Adapter On/Off", "HOMING_ADAPTER(28),3002,pnt_153,TUMB,153,1,0,1,Homing Adapter On/Off", "HOMING_ADAPTER(28),3006,pnt_153_1,TUMB,153,1,1,1,Homing Adapter Power On", "HOMING_ADAPTER(28),3006,pnt_153_0,TUMB,153,0,0,0,Homing Adapter Power Off", "FRONT_SWITCH_BOX(13),3002,CLK_VAR2_pnt_66,TUMB,66,-0.1,0,0.3,Ignition", "FRONT_SWITCH_BOX(13),3002,CLK_VAR2_pnt_66,TUMB,66,0.1,0,0.3,Ignition", "FRONT_SWITCH_BOX(13),3013,pnt_69_1,TUMB,69,1,1,1,Left Chemical Release", "VHF_RADIO(24),3017,pnt_129,TUMB,129,-1,0,1,Switch Locking Lever", "VHF_RADIO(24),3017,pnt_129,TUMB,129,1,0,1,Switch Locking Lever", "RIGHT_SWITCH_PANEL(14),3015,pnt_106_1,TUMB,106,1,0,1,Wing Position Lights Bright/Off", "IFF(27),3014,pnt_140_1,TUMB,140,1,1,1,IFF Power On", "IFF(27),3016,pnt_139_3,TUMB,139,0,0.2,0.2,IFF CODE 3", "FRONT_SWITCH_BOX(13),3014,pnt_70_0,TUMB,70,0,0,0,Right Bomb Arm Off", "RIGHT_SWITCH_PANEL(14),3028,pnt_109_0,TUMB,109,1,0,1,Green Recognition Light Steady/Off", "RIGHT_SWITCH_PANEL(14),3027,pnt_108_0,TUMB,108,1,0,1,Red Recognition Light Steady/Off", "ENGINE_CONTROL_PANEL(15),3012,pnt_61_1,TUMB,61,1,1,1,Fuel Booster On", "IFF(27),3007,pnt_145,BTN,145,1,0,1,IFF Detonator Left", "ENGINE_CONTROL_PANEL(15),3007,pnt_62_1,BTN,62,1,0,1,Oil Dilute Activate", "FRONT_SWITCH_BOX(13),3013,pnt_69_-1,TUMB,69,-1,-1,-1,Left Bomb Arm On", "IFF(27),3008,pnt_146,BTN,146,1,0,1,IFF Detonator Right", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_2,BTN,57,0.2,0.1,0.2,Supercharger HIGH", "IFF(27),3017,pnt_141_0,TUMB,141,0,0,0,IFF OFF", "ARTIFICIAL_HORIZON(19),3003,pnt_18,LEV,18,0.5,0,0.14,Cage", "ARTIFICIAL_HORIZON(19),3001,pnt_18,BTN,19,1,0,1,Cage", "FRONT_SWITCH_BOX(13),3007,CLK_VAR2_pnt_67,TUMB,67,-1,-1,1,Gun control", "FRONT_SWITCH_BOX(13),3007,CLK_VAR2_pnt_67,TUMB,67,1,-1,1,Gun control", "ACCELEROMETER(30),3001,pnt_176,BTN,176,0.6,0,0.6,G-meter reset", "IFF(27),3016,pnt_139_2,TUMB,139,0,0.1,0.1,IFF CODE 2", "FRONT_SWITCH_BOX(13),3008,pnt_72,BTN,72,1,0,1,Silence Landing Gear Warning Horn Cut Off", "ENGINE_SYSTEM(5),3001,pnt_87_0,BTN,87,0.1,0,0.1,Close Coolant Control", "IFF(27),3016,pnt_139_5,TUMB,139,0,0.4,0.4,IFF CODE 5", "IFF(27),3016,pnt_139_6,TUMB,139,0,0.5,0.5,IFF CODE 6", "CONTROL_SYSTEM(12),3009,pnt_92,LEV,92,0,-1,1,Elevator Trim", "ENVIRONMENT_SYSTEM(11),3001,pnt_157,LEV,157,0,0,1,Defroster", "CONTROL_SYSTEM(12),3008,pnt_91,LEV,91,0,-1,1,Aileron Trim", "HOMING_ADAPTER(28),3005,pnt_152_1,TUMB,152,0.1,0.1,0.1,Homing Adapter COMM.", "HOMING_ADAPTER(28),3003,pnt_154,BTN,154,1,0,1,Homing Adapter's Circuit Breaker", "ENVIRONMENT_SYSTEM(11),3003,pnt_159,LEV,159,0,0,1,Hot Air", "RIGHT_SWITCH_PANEL(14),3013,pnt_102_0,TUMB,102,0,0,0,Generator Disconnect", "LIGHT_SYSTEM(10),3003,pnt_89,TUMB,89,-1,0,1,Landing Light On/Off", "LIGHT_SYSTEM(10),3003,pnt_89,TUMB,89,1,0,1,Landing Light On/Off", "LIGHT_SYSTEM(10),3007,pnt_89_1,TUMB,89,1,1,1,Landing Light On", "ENGINE_CONTROL_PANEL(15),3009,pnt_64,TUMB,64,-1,0,1,Starter Switch Cover", "ENGINE_CONTROL_PANEL(15),3009,pnt_64,TUMB,64,1,0,1,Starter Switch Cover", "LIGHT_SYSTEM(10),3007,pnt_89_0,TUMB,89,0,0,0,Landing Light Off", "IFF(27),3015,pnt_143_1,TUMB,143,1,1,1,IFF Distress Signal On", "IFF(27),3001,pnt_140,TUMB,140,-1,0,1,IFF Power On/Off", "IFF(27),3001,pnt_140,TUMB,140,1,0,1,IFF Power On/Off", "FRONT_SWITCH_BOX(13),3015,pnt_68_2,TUMB,68,0.2,0.2,0.2,Bombs Both Release", "RIGHT_SWITCH_PANEL(14),3012,pnt_103_1,TUMB,103,1,1,1,Battery Connect", "ENGINE_SYSTEM(5),3001,pnt_87_1,TUMB,87,0.2,0,0.2,Automatic Coolant Control", "FRONT_SWITCH_BOX(13),3005,pnt_66_0,TUMB,66,0,0,0,Ignition Off", "ENGINE_SYSTEM(5),3001,pnt_87_2,BTN,87,0.3,0,0.3,Open Coolant Control", "DETROLA(26),3002,pnt_138,LEV,138,0,0,1,Detrola Volume", "IFF(27),3002,pnt_139,TUMB,139,0.1,0,0.5,IFF Code Selector", "IFF(27),3002,pnt_139,TUMB,139,-0.1,0,0.5,IFF Code Selector", "CPT_MECH(6),3001,pnt_44,BTN,44,1,0,1,Microphone On", "TAIL_WARNING_RADAR(25),3007,pnt_114_1,TUMB,114,1,1,1,Tail Warning Radar Power On", "ENGINE_SYSTEM(5),3019,pnt_47_0,TUMB,47,0,0,0,Mixture IDLE", "ENGINE_SYSTEM(5),3019,pnt_47_1,TUMB,47,0,0.1,0.1,Mixture RUN", "RIGHT_SWITCH_PANEL(14),3028,pnt_109_1,TUMB,109,-1,-1,0,Green Recognition Light Key/Off", "DETROLA(26),3001,pnt_137,LEV,137,0,0,1,Detrola Frequency Selector", "ENGINE_SYSTEM(5),3012,pnt_48,LEV,48,0,0,1,Lock Throttle", "IFF(27),3016,pnt_139_1,TUMB,139,0,0,0,IFF CODE 1", "(0),3001,pnt_183,TUMB,183,0,0,1,Mirror", "(0),3001,pnt_183,TUMB,183,1,0,1,Mirror", "ENGINE_SYSTEM(5),3004,pnt_169,TUMB,169,-1,0,1,Oil Control Cover", "ENGINE_SYSTEM(5),3004,pnt_169,TUMB,169,1,0,1,Oil Control Cover", "LIGHT_SYSTEM(10),3002,pnt_90,LEV,90,0,0,1,Left Fluorescent Light", "FUEL_SYSTEM(9),3004,pnt_85_4,TUMB,85,0,0,0,Select Right Combat Tank", "IFF(27),3017,pnt_141_1,TUMB,141,1,1,1,IFF ON", "RIGHT_SWITCH_PANEL(14),3026,pnt_104_0,TUMB,104,0,0,0,Gun Heating Off", "VHF_RADIO(24),3005,pnt_121,BTN,121,1,0,1,D Channel Activate", "VHF_RADIO(24),3003,pnt_119,BTN,119,1,0,1,B Channel Activate", "ENGINE_CONTROL_PANEL(15),3012,pnt_61_0,TUMB,61,0,0,0,Fuel Booster Off", "FRONT_SWITCH_BOX(13),3005,pnt_66_2,TUMB,66,0,0.2,0.2,Ignition Left", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_1,TUMB,57,0.1,0.1,0.1,Supercharger LOW", "RIGHT_SWITCH_PANEL(14),3029,pnt_110_1,TUMB,110,-1,-1,0,Amber Recognition Light Key/Off", "CONTROL_SYSTEM(12),3010,pnt_93,LEV,93,0,-1,1,Rudder Trim", "CONTROL_SYSTEM(12),3003,pnt_151,TUMB,150,-1,0,1,Landing Gear Control Handle", "CONTROL_SYSTEM(12),3003,pnt_151,TUMB,150,1,0,1,Landing Gear Control Handle", "RIGHT_SWITCH_PANEL(14),3009,pnt_107,TUMB,107,-1,-1,1,Tail Position Lights Bright/Off/Dim", "RIGHT_SWITCH_PANEL(14),3009,pnt_107,TUMB,107,1,-1,1,Tail Position Lights Bright/Off/Dim", "ENGINE_CONTROL_PANEL(15),3005,pnt_61,TUMB,61,-1,0,1,Fuel Booster On/Off", "ENGINE_CONTROL_PANEL(15),3005,pnt_61,TUMB,61,1,0,1,Fuel Booster On/Off", "ENGINE_CONTROL_PANEL(15),3014,pnt_65_1,BTN,65,1,0,1,Primer Activate", "RIGHT_SWITCH_PANEL(14),3024,pnt_111,BTN,111,1,0,1,Recognition Lights Key", "OXYGEN_SYSTEM(7),3003,pnt_131,TUMB,131,-1,0,1,Auto-Mix On-Off", "OXYGEN_SYSTEM(7),3003,pnt_131,TUMB,131,1,0,1,Auto-Mix On-Off", "DIRECTIONAL_GYRO(20),3001,pnt_13,LEV,13,0.5,0,1,Heading Set/Cage", "DIRECTIONAL_GYRO(20),3003,pnt_13,BTN,179,1,0,1,Heading Set/Cage", "RIGHT_SWITCH_PANEL(14),3007,pnt_100,LEV,100,0,0,1,Right Fluorescent Light", "FUEL_SYSTEM(9),3004,pnt_85_2,TUMB,85,0.2,0.2,0.2,Select Fuselage Tank", "RIGHT_SWITCH_PANEL(14),3016,pnt_107_0,TUMB,107,-1,-1,0,Tail Position Lights Dim/Off",
-        "RIGHT_SWITCH_PANEL(14),3023,pnt_110,TUMB,110,1,-1,1,Amber Recognition Light Key/Off/Steady", "RIGHT_SWITCH_PANEL(14),3023,pnt_110,TUMB,110,-1,-1,1,Amber Recognition Light Key/Off/Steady", "VHF_RADIO(24),3020,pnt_128_-1,BTN,128,-1,-1,0,Radio Mode Transmit", "RIGHT_SWITCH_PANEL(14),3008,pnt_106,TUMB,106,-1,-1,1,Wing Position Lights Bright/Off/Dim", "RIGHT_SWITCH_PANEL(14),3008,pnt_106,TUMB,106,1,-1,1,Wing Position Lights Bright/Off/Dim", "VHF_RADIO(24),3006,pnt_127,LEV,127,1,0,1,Radio Lights Dimmer", "ENGINE_CONTROL_PANEL(15),3002,pnt_58,TUMB,58,-1,0,1,Supercharger Switch Cover", "ENGINE_CONTROL_PANEL(15),3002,pnt_58,TUMB,58,1,0,1,Supercharger Switch Cover", "IFF(27),3004,pnt_142,TUMB,142,-1,0,1,IFF Detonator Circuit On/Off", "IFF(27),3004,pnt_142,TUMB,142,1,0,1,IFF Detonator Circuit On/Off", "FRONT_SWITCH_BOX(13),3015,pnt_68_3,TUMB,68,0.3,0.3,0.3,Rockets Arm", "TAIL_WARNING_RADAR(25),3001,pnt_114,TUMB,114,-1,0,1,Tail Warning Radar Power", "TAIL_WARNING_RADAR(25),3001,pnt_114,TUMB,114,1,0,1,Tail Warning Radar Power", "FRONT_SWITCH_BOX(13),3012,pnt_67_-1,TUMB,67,-1,-1,-1,Camera On", "ENGINE_CONTROL_PANEL(15),3004,pnt_60,BTN,60,1,0,1,High Blower Lamp Test ", "VHF_RADIO(24),3002,pnt_118,BTN,118,1,0,1,A Channel Activate", "FRONT_SWITCH_BOX(13),3001,pnt_71,LEV,71,1,0,1,Cockpit Lights", "CONTROL_SYSTEM(12),3016,pnt_173,BTN,173,1,0,1,Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position", "CONTROL_SYSTEM(12),3015,pnt_173,BTN,173,1,0,1,Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position", "VHF_RADIO(24),3021,pnt_128_1,TUMB,128,1,1,1,Radio Mode Remote", "VHF_RADIO(24),3004,pnt_120,BTN,120,1,0,1,C Channel Activate", "CPT_MECH(6),3008,pnt_147_1,LEV,147,0,0,1,Canopy Hand Crank", "ENGINE_SYSTEM(5),3011,pnt_47,TUMB,47,0.1,0,0.2,Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH", "ENGINE_SYSTEM(5),3011,pnt_47,TUMB,47,-0.1,0,0.2,Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH", "IFF(27),3016,pnt_139_4,TUMB,139,0,0.3,0.3,IFF CODE 4", "ENGINE_SYSTEM(5),3003,pnt_168,TUMB,168,-1,0,1,Coolant Control Cover", "ENGINE_SYSTEM(5),3003,pnt_168,TUMB,168,1,0,1,Coolant Control Cover", "ENGINE_SYSTEM(5),3002,pnt_88_1,TUMB,88,0.2,0,0.2,Automatic Oil Control", "RIGHT_SWITCH_PANEL(14),3014,pnt_105_0,TUMB,105,0,0,0,Pitot Heating Off", "CONTROL_SYSTEM(12),3003,pnt_150,TUMB,150,-1,0,1,Landing Gear Control Handle", "CONTROL_SYSTEM(12),3003,pnt_150,TUMB,150,1,0,1,Landing Gear Control Handle", "HYDRAULIC_SYSTEM(3),3001,pnt_79,TUMB,79,-1,0,1,Hydraulic Release Knob", "HYDRAULIC_SYSTEM(3),3001,pnt_79,TUMB,79,1,0,1,Hydraulic Release Knob", "IFF(27),3014,pnt_140_0,TUMB,140,0,0,0,IFF Power Off", "VHF_RADIO(24),3021,pnt_128_0,TUMB,128,0,0,0,Radio Mode Receive", "IFF(27),3017,pnt_141_-1,TUMB,141,-1,-1,-1,IFF TIME", "VHF_RADIO(24),3001,pnt_117,BTN,117,1,0,1,Radio ON/OFF", "FRONT_SWITCH_BOX(13),3014,pnt_70_1,TUMB,70,1,1,1,Right Chemical Release", "IFF(27),3015,pnt_143_0,TUMB,143,0,0,0,IFF Distress Signal Off", "FRONT_SWITCH_BOX(13),3010,CLK_VAR2_pnt_70,TUMB,70,-1,-1,1,Right Bomb Arm/Chemical", "FRONT_SWITCH_BOX(13),3010,CLK_VAR2_pnt_70,TUMB,70,1,-1,1,Right Bomb Arm/Chemical", "ENGINE_CONTROL_PANEL(15),3001,pnt_57_0,TUMB,57,0,0,0,Supercharger AUTO", "ENGINE_CONTROL_PANEL(15),3013,pnt_62,BTN,62,1,0,1,Oil Dilute Activate", "CLOCK(22),3002,pnt_7,LEV,7,0.04,0,1,Winding/Adjustment Clock", "CLOCK(22),3001,pnt_7,BTN,8,1,0,1,Winding/Adjustment Clock", "ENGINE_SYSTEM(5),3014,pnt_49,LEV,49,0,0,1,Lock Propeller & Mixture", "FRONT_SWITCH_BOX(13),3005,pnt_66_3,TUMB,66,0,0.3,0.3,Ignition Both", "RIGHT_SWITCH_PANEL(14),3026,pnt_104_1,TUMB,104,1,1,1,Gun Heating On", "ALTIMETER(17),3001,pnt_26,LEV,26,0.04,0,1,Set Pressure", "ENGINE_SYSTEM(5),3002,pnt_88_2,BTN,88,0.3,0,0.3,Open Oil Control", "VHF_RADIO(24),3007,pnt_128,TUMB,128,1,0,1,Radio Mode", "VHF_RADIO(24),3008,pnt_128,BTN,128,-1,-1,0,Radio Mode", "HOMING_ADAPTER(28),3005,pnt_152_2,TUMB,152,0.2,0.2,0.2,Homing Adapter HOMING", "OXYGEN_SYSTEM(7),3001,pnt_130,TUMB,130,-0.5,0,0.5,Oxygen Emergency By-pass", "OXYGEN_SYSTEM(7),3001,pnt_130,TUMB,130,0.5,0,0.5,Oxygen Emergency By-pass", "RIGHT_SWITCH_PANEL(14),3016,pnt_107_1,TUMB,107,1,0,1,Tail Position Lights Bright/Off", "ENGINE_CONTROL_PANEL(15),3008,pnt_63,BTN,63,1,0,1,Starter Activate", "FRONT_SWITCH_BOX(13),3013,pnt_69_0,TUMB,69,0,0,0,Left Bomb Arm Off", "FRONT_SWITCH_BOX(13),3015,pnt_68_1,TUMB,68,0.1,0.1,0.1,Bombs Train Release", "ENGINE_SYSTEM(5),3019,pnt_47_2,TUMB,47,0,0.2,0.2,Mixture EMERGENCY FULL RICH", "IFF(27),3005,pnt_143,TUMB,143,-1,0,1,IFF Distress Signal", "IFF(27),3005,pnt_143,TUMB,143,1,0,1,IFF Distress Signal", "FUEL_SYSTEM(9),3001,CLK_VAR2_pnt_85,TUMB,85,-0.1,0,0.4,Fuel Selector Valve", "FUEL_SYSTEM(9),3001,CLK_VAR2_pnt_85,TUMB,85,0.1,0,0.4,Fuel Selector Valve", "RIGHT_SWITCH_PANEL(14),3001,pnt_103,TUMB,103,-1,0,1,Battery Disconnect", "RIGHT_SWITCH_PANEL(14),3001,pnt_103,TUMB,103,1,0,1,Battery Disconnect", "FRONT_SWITCH_BOX(13),3012,pnt_67_1,TUMB,67,1,1,1,Gun And Camera On", "FRONT_SWITCH_BOX(13),3012,pnt_67_0,TUMB,67,0,0,0,Gun And Camera Off", "IFF(27),3003,pnt_141,TUMB,141,-1,-1,1,IFF TIME/OFF/ON", "IFF(27),3003,pnt_141,TUMB,141,1,-1,1,IFF TIME/OFF/ON", "FRONT_SWITCH_BOX(13),3005,pnt_66_1,TUMB,66,0,0.1,0.1,Ignition Right"],
-    "Uh-1H": ["NAVLIGHT_SYSTEM(7),3003,DIM-BRIGHT-PTR,TUMB,224,-1,0,1,Position Lights Switch, DIM/BRIGHT", "NAVLIGHT_SYSTEM(7),3003,DIM-BRIGHT-PTR,TUMB,224,1,0,1,Position Lights Switch, DIM/BRIGHT", "ELEC_INTERFACE(1),3081,HEATED-BLANKET-PTR,TUMB,315,-1,0,1,CB Heated blanket 1(N/F), ON/OFF", "ELEC_INTERFACE(1),3081,HEATED-BLANKET-PTR,TUMB,315,1,0,1,CB Heated blanket 1(N/F), ON/OFF", "IFF(17),3013,TEST-M-3C-PTR,BTN,64,1,0,1,Test M-C Switch", "IFF(17),3013,TEST-M-3C-PTR,TUMB,64,0,-1,0,Test M-C Switch", "ENGINE_INTERFACE(3),3013,CHIP-DET-PTR,TUMB,86,1,0,1,Chip Detector Switch, LMB - Tail Rotor / RMB - XMSN", "ENGINE_INTERFACE(3),3013,CHIP-DET-PTR,TUMB,86,0,-1,0,Chip Detector Switch, LMB - Tail Rotor / RMB - XMSN", "ELEC_INTERFACE(1),3037,PITOT-TUBE-PTR,TUMB,321,-1,0,1,CB Pitot tube(N/F), ON/OFF", "ELEC_INTERFACE(1),3037,PITOT-TUBE-PTR,TUMB,321,1,0,1,CB Pitot tube(N/F), ON/OFF", "IFF(17),3014,RAD-TEST-MON-SWITCH-PTR,BTN,65,1,0,1,RAD Switch, TEST/MON", "IFF(17),3014,RAD-TEST-MON-SWITCH-PTR,TUMB,65,0,-1,0,RAD Switch, TEST/MON", "ELEC_INTERFACE(1),3031,HF-ARC-102-PTR,TUMB,353,-1,0,1,CB HF ARC-102(N/F), ON/OFF", "ELEC_INTERFACE(1),3031,HF-ARC-102-PTR,TUMB,353,1,0,1,CB HF ARC-102(N/F), ON/OFF", "VHF_ARC_131(23),3002,FREQUENCY-SELECTOR-2-PTR,TUMB,32,0.1,0,0.9,Frequency Ones MHz Selector", "VHF_ARC_131(23),3002,FREQUENCY-SELECTOR-2-PTR,TUMB,32,-0.1,0,0.9,Frequency Ones MHz Selector", "VHF_ARC_131(23),3001,FREQUENCY-SELECTOR-1-PTR,TUMB,31,0.1,0.3,0.7,Frequency Tens MHz Selector", "VHF_ARC_131(23),3001,FREQUENCY-SELECTOR-1-PTR,TUMB,31,-0.1,0.3,0.7,Frequency Tens MHz Selector", "ELEC_INTERFACE(1),3098,COURSE-IND-PTR,TUMB,435,-1,0,1,CB Course Ind(N/F), ON/OFF", "ELEC_INTERFACE(1),3098,COURSE-IND-PTR,TUMB,435,1,0,1,CB Course Ind(N/F), ON/OFF", "ELEC_INTERFACE(1),3097,PRESS-ENG-PTR,TUMB,434,-1,0,1,CB Pressure Eng(N/F), ON/OFF", "ELEC_INTERFACE(1),3097,PRESS-ENG-PTR,TUMB,434,1,0,1,CB Pressure Eng(N/F), ON/OFF", "ENGINE_INTERFACE(3),3014,GOV-PTR,TUMB,85,-1,0,1,Governor Switch, EMER/AUTO", "ENGINE_INTERFACE(3),3014,GOV-PTR,TUMB,85,1,0,1,Governor Switch, EMER/AUTO", "ELEC_INTERFACE(1),3070,EXT-STORES-PTR,TUMB,381,-1,0,1,CB EXT Stores jettison(N/F), ON/OFF", "ELEC_INTERFACE(1),3070,EXT-STORES-PTR,TUMB,381,1,0,1,CB EXT Stores jettison(N/F), ON/OFF", "ENGINE_INTERFACE(3),3015,GOV-RPM-1-PTR,TUMB,203,1,0,1,Governor RPM Switch, Decrease/Increase", "ENGINE_INTERFACE(3),3015,GOV-RPM-1-PTR,TUMB,203,0,-1,0,Governor RPM Switch, Decrease/Increase", "IFF(17),3008,MASTER-CONTROL-PTR,TUMB,59,0.1,0,0.4,Master Knob, OFF/STBY/LOW/NORM/EMER", "IFF(17),3008,MASTER-CONTROL-PTR,TUMB,59,-0.1,0,0.4,Master Knob, OFF/STBY/LOW/NORM/EMER", "NAVLIGHT_SYSTEM(7),3004,ANTI-COLL-PTR,TUMB,225,-1,0,1,Anti-Collision Lights Switch, ON/OFF", "NAVLIGHT_SYSTEM(7),3004,ANTI-COLL-PTR,TUMB,225,1,0,1,Anti-Collision Lights Switch, ON/OFF", "ELEC_INTERFACE(1),3024,MARKER-BEACON-PTR,TUMB,291,-1,0,1,CB Marker beacon, ON/OFF", "ELEC_INTERFACE(1),3024,MARKER-BEACON-PTR,TUMB,291,1,0,1,CB Marker beacon, ON/OFF", "ENGINE_INTERFACE(3),3023,FIRE-DETECTOR-PTR,BTN,278,1,0,1,Fire Detector Test Button - Push to test", "ADI_OPERATOR(6),3002,PITCH-ADJUSTMENT-PTR,LEV,146,0,0,1,Attitude Indicator Pitch Trim Knob", "ENGINE_INTERFACE(3),3002,DE-ICE-PTR,TUMB,84,-1,0,1,De-Ice Switch, ON/OFF", "ENGINE_INTERFACE(3),3002,DE-ICE-PTR,TUMB,84,1,0,1,De-Ice Switch, ON/OFF", "IFF(17),3010,TEST-M-1-PTR,BTN,61,1,0,1,Test M-1 Switch", "IFF(17),3010,TEST-M-1-PTR,TUMB,61,0,-1,0,Test M-1 Switch", "WEAPON_SYS(9),3009,LRGUN-SWITCH-PTR,TUMB,253,1,-1,1,Gun Selector Switch, LEFT/ALL/RIGHT", "WEAPON_SYS(9),3009,LRGUN-SWITCH-PTR,TUMB,253,-1,-1,1,Gun Selector Switch, LEFT/ALL/RIGHT", "ELEC_INTERFACE(1),3063,LH-FUEL-PTR,TUMB,333,-1,0,1,CB LH fuel boost pump(N/F), ON/OFF", "ELEC_INTERFACE(1),3063,LH-FUEL-PTR,TUMB,333,1,0,1,CB LH fuel boost pump(N/F), ON/OFF", "ELEC_INTERFACE(1),3047,LDG-SEARCH-PTR,TUMB,311,-1,0,1,CB Landing & Search light control(N/F), ON/OFF", "ELEC_INTERFACE(1),3047,LDG-SEARCH-PTR,TUMB,311,1,0,1,CB Landing & Search light control(N/F), ON/OFF", "ELEC_INTERFACE(1),3021,IFF-API-PTR,TUMB,285,-1,0,1,CB IFF APX 1 (N/F), ON/OFF", "ELEC_INTERFACE(1),3021,IFF-API-PTR,TUMB,285,1,0,1,CB IFF APX 1 (N/F), ON/OFF", "ELEC_INTERFACE(1),3083,VOLT-METER-PTR,TUMB,319,-1,0,1,CB Voltmeter Non Ess Bus(N/F), ON/OFF", "ELEC_INTERFACE(1),3083,VOLT-METER-PTR,TUMB,319,1,0,1,CB Voltmeter Non Ess Bus(N/F), ON/OFF", "CPT_MECH(12),3001,WIPERS-PTR,BTN,229,1,0,1,Wipers Speed Switch, PARK/OFF/LOW/MED/HIGH", "CPT_MECH(12),3001,WIPERS-PTR,BTN,229,-1,-1,0,Wipers Speed Switch, PARK/OFF/LOW/MED/HIGH", "ELEC_INTERFACE(1),3096,PRESS-XMSN-PTR,TUMB,433,-1,0,1,CB Pressure XMSN(N/F), ON/OFF", "ELEC_INTERFACE(1),3096,PRESS-XMSN-PTR,TUMB,433,1,0,1,CB Pressure XMSN(N/F), ON/OFF", "ADI_PILOT(5),3001,PILOT-ATT-ROLL-ADJ-KNOB-PTR,LEV,145,0,0,1,Attitude Indicator Pitch Trim Knob", "SYS_CONTROLLER(15),3001,RESET-TEST-SWITCH-PTR,TUMB,111,1,0,1,Reset/Test switch", "SYS_CONTROLLER(15),3001,RESET-TEST-SWITCH-PTR,TUMB,111,0,-1,0,Reset/Test switch", "ELEC_INTERFACE(1),3035,VXFXCVR-COMM-PTR,TUMB,361,-1,0,1,CB VHF AM Radio, ON/OFF", "ELEC_INTERFACE(1),3035,VXFXCVR-COMM-PTR,TUMB,361,1,0,1,CB VHF AM Radio, ON/OFF", "ELEC_INTERFACE(1),3046,LDG-LIGHT-PTR,TUMB,309,-1,0,1,CB Landing light power(N/F), ON/OFF", "ELEC_INTERFACE(1),3046,LDG-LIGHT-PTR,TUMB,309,1,0,1,CB Landing light power(N/F), ON/OFF", "VHF_ARC_134(20),3004,MHZ-SELECTOR-PTR,LEV,7,0.1,0,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "VHF_ARC_134(20),3001,MHZ-SELECTOR-PTR,TUMB,5,0.1,0.8,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "VHF_ARC_134(20),3001,MHZ-SELECTOR-PTR,TUMB,5,-0.1,0.8,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "INTERCOM(21),3007,SDP-VOLUME-CONTROL-PTR,LEV,29,1,0.3,1,Intercom Volume Knob", "ELEC_INTERFACE(1),3077,IDLE-STOP-PTR,TUMB,395,-1,0,1,CB IDLE Stop release(N/F), ON/OFF", "ELEC_INTERFACE(1),3077,IDLE-STOP-PTR,TUMB,395,1,0,1,CB IDLE Stop release(N/F), ON/OFF", "INTERCOM(21),3002,RECEIVER-2-PTR,TUMB,24,-1,0,1,UHF Radio Receiver Switch, ON/OFF", "INTERCOM(21),3002,RECEIVER-2-PTR,TUMB,24,1,0,1,UHF Radio Receiver Switch, ON/OFF", "ELEC_INTERFACE(1),3039,RESCUE-CONT-PTR,TUMB,345,-1,0,1,CB Rescue hoist CTL(N/F), ON/OFF", "ELEC_INTERFACE(1),3039,RESCUE-CONT-PTR,TUMB,345,1,0,1,CB Rescue hoist CTL(N/F), ON/OFF", "IFF(17),3012,TEST-M-3A-PTR,BTN,63,1,0,1,Test M-3A Switch", "IFF(17),3012,TEST-M-3A-PTR,TUMB,63,0,-1,0,Test M-3A Switch", "INTERCOM(21),3004,RECEIVER-4-PTR,TUMB,26,-1,0,1,Receiver 4 N/F Switch, ON/OFF", "INTERCOM(21),3004,RECEIVER-4-PTR,TUMB,26,1,0,1,Receiver 4 N/F Switch, ON/OFF", "ELEC_INTERFACE(1),3082,HEATED-BLANKET2-PTR,TUMB,317,-1,0,1,CB Heated blanket 2(N/F), ON/OFF", "ELEC_INTERFACE(1),3082,HEATED-BLANKET2-PTR,TUMB,317,1,0,1,CB Heated blanket 2(N/F), ON/OFF", "INTERCOM(21),3008,TRANSMIT-INTERPHONE-SWITCH-PTR,TUMB,30,-0.1,0,0.5,Intercom Mode (PVT - hot line; INT - interphone; 1 - VHF FM transmitter; 2 - UHF transmitter; 3 - VHF AM transmitter; 4 - Not used)", "INTERCOM(21),3008,TRANSMIT-INTERPHONE-SWITCH-PTR,TUMB,30,0.1,0,0.5,Intercom Mode (PVT - hot line; INT - interphone; 1 - VHF FM transmitter; 2 - UHF transmitter; 3 - VHF AM transmitter; 4 - Not used)", "ELEC_INTERFACE(1),3058,AIR-VALVE-PTR,TUMB,325,-1,0,1,CB Cabin heater (Air valve)(N/F), ON/OFF", "ELEC_INTERFACE(1),3058,AIR-VALVE-PTR,TUMB,325,1,0,1,CB Cabin heater (Air valve)(N/F), ON/OFF", "ELEC_INTERFACE(1),3061,ANTI-ICE-PTR,TUMB,329,-1,0,1,CB Engine anti-ice(N/F), ON/OFF", "ELEC_INTERFACE(1),3061,ANTI-ICE-PTR,TUMB,329,1,0,1,CB Engine anti-ice(N/F), ON/OFF", "IFF(17),3007,CODE-PTR,BTN,58,1,0,1,Code Knob", "IFF(17),3007,CODE-PTR,BTN,58,-1,-1,0,Code Knob", "SYS_CONTROLLER(15),3002,BRIGHT-DIM-SWITCH-PTR,TUMB,112,1,0,1,Bright/Dim switch", "SYS_CONTROLLER(15),3002,BRIGHT-DIM-SWITCH-PTR,TUMB,112,0,-1,0,Bright/Dim switch", "ELEC_INTERFACE(1),3028,INTER-COM-PLT-PTR,TUMB,299,-1,0,1,CB Intercom PLT, ON/OFF", "ELEC_INTERFACE(1),3028,INTER-COM-PLT-PTR,TUMB,299,1,0,1,CB Intercom PLT, ON/OFF", "ELEC_INTERFACE(1),3045,SEARCH-LIGHT-PTR,TUMB,307,-1,0,1,CB Search light power(N/F), ON/OFF", "ELEC_INTERFACE(1),3045,SEARCH-LIGHT-PTR,TUMB,307,1,0,1,CB Search light power(N/F), ON/OFF", "ENGINE_INTERFACE(3),3021,LOW-RPM-PTR,TUMB,80,-1,0,1,Low RPM Warning Switch, AUDIO/OFF", "ENGINE_INTERFACE(3),3021,LOW-RPM-PTR,TUMB,80,1,0,1,Low RPM Warning Switch, AUDIO/OFF", "ELEC_INTERFACE(1),3059,RESCUE-POWER-PTR,TUMB,343,-1,0,1,CB Rescue hoist PWR(N/F), ON/OFF", "ELEC_INTERFACE(1),3059,RESCUE-POWER-PTR,TUMB,343,1,0,1,CB Rescue hoist PWR(N/F), ON/OFF", "INTERCOM(21),3009,RADIO/ICS-1-PTR,TUMB,194,0.5,0,1,Radio/ICS Switch", "INTERCOM(21),3009,RADIO/ICS-1-PTR,TUMB,194,-0.5,0,1,Radio/ICS Switch", "UHF_ARC_51(22),3006,FUNCTION-SELECT-SWITCH-PTR,TUMB,17,0.1,0,0.3,Function Dial", "UHF_ARC_51(22),3006,FUNCTION-SELECT-SWITCH-PTR,TUMB,17,-0.1,0,0.3,Function Dial", "UHF_ARC_51(22),3007,SQ-DISABLE-SWITCH-PTR,TUMB,22,-1,0,1,Squelch Disable Switch, ON/OFF", "UHF_ARC_51(22),3007,SQ-DISABLE-SWITCH-PTR,TUMB,22,1,0,1,Squelch Disable Switch, ON/OFF", "UHF_ARC_51(22),3008,UHF-VOLUME-CONTROL-PTR,LEV,21,1,0,1,Volume Knob", "ELEC_INTERFACE(1),3029,ARC-102-PTR,TUMB,349,-1,0,1,CB ARC-102 HF Static INVTR(N/F), ON/OFF", "ELEC_INTERFACE(1),3029,ARC-102-PTR,TUMB,349,1,0,1,CB ARC-102 HF Static INVTR(N/F), ON/OFF", "ELEC_INTERFACE(1),3001,BAT-SWITCHER-PTR,TUMB,219,-1,0,1,Battery Switch, ON/OFF", "ELEC_INTERFACE(1),3001,BAT-SWITCHER-PTR,TUMB,219,1,0,1,Battery Switch, ON/OFF", "ELEC_INTERFACE(1),3003,STARTER-GEN-SWITCHERr-PTR,TUMB,220,-1,0,1,Starter/Stdby GEN Switch", "ELEC_INTERFACE(1),3003,STARTER-GEN-SWITCHERr-PTR,TUMB,220,1,0,1,Starter/Stdby GEN Switch", "VHF_ARC_131(23),3004,FREQUENCY-SELECTOR-4-PTR,TUMB,34,0.1,0,0.1,Frequency Hundredths MHz Selector", "VHF_ARC_131(23),3004,FREQUENCY-SELECTOR-4-PTR,TUMB,34,-0.1,0,0.1,Frequency Hundredths MHz Selector", "VHF_ARC_131(23),3005,SQUELCH-SWITCH-PTR,TUMB,36,0.1,0,0.2,Squelch Mode Switch, DIS/CARR/TONE",
-        "VHF_ARC_131(23),3005,SQUELCH-SWITCH-PTR,TUMB,36,-0.1,0,0.2,Squelch Mode Switch, DIS/CARR/TONE", "ARN_82(25),3001,WHOLE-MHZ-SELECTOR-KNOB-PTR,LEV,52,0.1,0,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "ARN_82(25),3003,WHOLE-MHZ-SELECTOR-KNOB-PTR,TUMB,51,0.1,0.8,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "ARN_82(25),3003,WHOLE-MHZ-SELECTOR-KNOB-PTR,TUMB,51,-0.1,0.8,1,Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value", "XM_130(50),3001,RIPPLE-FIRE-COVER-PTR,TUMB,450,-1,0,1,Ripple Fire Cover, OPEN/CLOSE", "XM_130(50),3001,RIPPLE-FIRE-COVER-PTR,TUMB,450,1,0,1,Ripple Fire Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3019,MAIN-GEN-SWITCHER-COVER-PTR,TUMB,217,-1,0,1,Main generator switch cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3019,MAIN-GEN-SWITCHER-COVER-PTR,TUMB,217,1,0,1,Main generator switch cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3040,RESCUE-CABLE-PTR,TUMB,347,-1,0,1,CB Rescue hoist cable cutter N/F), ON/OFF", "ELEC_INTERFACE(1),3040,RESCUE-CABLE-PTR,TUMB,347,1,0,1,CB Rescue hoist cable cutter N/F), ON/OFF", "VHF_ARC_134(20),3005,KHZ-SELECTOR-PTR,LEV,8,0.1,0,1,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "VHF_ARC_134(20),3003,KHZ-SELECTOR-PTR,TUMB,9,0.1,0,0.65,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "VHF_ARC_134(20),3003,KHZ-SELECTOR-PTR,TUMB,9,-0.1,0,0.65,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "CPT_MECH(12),3006,DOOR_R-PTR,BTN,421,1,0,1,Open Doors", "ADF_ARN_83(27),3005,LOOP-L-PTR,TUMB,42,0,0,0,Loop Left Hight Speed", "VHF_ARC_131(23),3007,MODE-SWITCH-PTR,TUMB,35,0.1,0,0.3,Mode Switch, OFF/TR/RETRAN(N/F)/HOME(N/F)", "VHF_ARC_131(23),3007,MODE-SWITCH-PTR,TUMB,35,-0.1,0,0.3,Mode Switch, OFF/TR/RETRAN(N/F)/HOME(N/F)", "ELEC_INTERFACE(1),3048,ANTI-COLL-CB-PTR,TUMB,313,-1,0,1,CB Anticollision light(N/F), ON/OFF", "ELEC_INTERFACE(1),3048,ANTI-COLL-CB-PTR,TUMB,313,1,0,1,CB Anticollision light(N/F), ON/OFF", "ADF_ARN_83(27),3005,LOOP-O-PTR,TUMB,42,0.2,0.2,0.2,Loop Off", "ADF_ARN_83(27),3005,LOOP-R-PTR,TUMB,42,0.4,0.4,0.4,Loop Right Hight Speed", "ELEC_INTERFACE(1),3090,GYRO-CMPS-PTR,TUMB,427,-1,0,1,CB Gyro Cmps(N/F), ON/OFF", "ELEC_INTERFACE(1),3090,GYRO-CMPS-PTR,TUMB,427,1,0,1,CB Gyro Cmps(N/F), ON/OFF", "ADF_ARN_83(27),3006,BFO-SWITCH-PTR,TUMB,41,-1,0,1,BFO Switch (N/F), BFO/OFF", "ADF_ARN_83(27),3006,BFO-SWITCH-PTR,TUMB,41,1,0,1,BFO Switch (N/F), BFO/OFF", "ADF_ARN_83(27),3003,TUNE-CONTROL-PTR,LEV,39,-0.1,0,1,Tune control / Band selection. Right mouse click to select a band. Rotate mouse wheel to adjust tune", "ADF_ARN_83(27),3002,TUNE-CONTROL-PTR,TUMB,38,1,-1,1,Tune control / Band selection. Right mouse click to select a band. Rotate mouse wheel to adjust tune", "ADF_ARN_83(27),3002,TUNE-CONTROL-PTR,TUMB,38,-1,-1,1,Tune control / Band selection. Right mouse click to select a band. Rotate mouse wheel to adjust tune", "IFF(17),3003,MODE-3A-WHEEL-1-WINDOW-PTR,TUMB,70,0.11,0,0.77,MODE3A-WHEEL1", "IFF(17),3003,MODE-3A-WHEEL-1-WINDOW-PTR,TUMB,70,-0.11,0,0.77,MODE3A-WHEEL1", "IFF(17),3009,OUT-(AUDIO-LIGHT)-PTR,TUMB,60,1,-1,1,Audio/light Switch", "IFF(17),3009,OUT-(AUDIO-LIGHT)-PTR,TUMB,60,-1,-1,1,Audio/light Switch", "ELEC_INTERFACE(1),3091,FUEL-QTY-PTR,TUMB,428,-1,0,1,CB Fuel Quantity(N/F), ON/OFF", "ELEC_INTERFACE(1),3091,FUEL-QTY-PTR,TUMB,428,1,0,1,CB Fuel Quantity(N/F), ON/OFF", "ELEC_INTERFACE(1),3069,CARGO-HOOK-PTR,TUMB,379,-1,0,1,CB Cargo hook release(N/F), ON/OFF", "ELEC_INTERFACE(1),3069,CARGO-HOOK-PTR,TUMB,379,1,0,1,CB Cargo hook release(N/F), ON/OFF", "ELEC_INTERFACE(1),3051,DOME-LIGHTS-PTR,TUMB,367,-1,0,1,CB Dome lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3051,DOME-LIGHTS-PTR,TUMB,367,1,0,1,CB Dome lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3030,HF-ANT-PTR,TUMB,351,-1,0,1,CB HF ANT COUPLR(N/F), ON/OFF", "ELEC_INTERFACE(1),3030,HF-ANT-PTR,TUMB,351,1,0,1,CB HF ANT COUPLR(N/F), ON/OFF", "NAVLIGHT_SYSTEM(7),3002,STEADY-OFF-FLASH-PTR,TUMB,223,1,-1,1,Position Lights Switch, STEADY/OFF/FLASH", "NAVLIGHT_SYSTEM(7),3002,STEADY-OFF-FLASH-PTR,TUMB,223,-1,-1,1,Position Lights Switch, STEADY/OFF/FLASH", "ELEC_INTERFACE(1),3075,STBY-GEN-PTR,TUMB,391,-1,0,1,CB STBY Generator Field(N/F), ON/OFF", "ELEC_INTERFACE(1),3075,STBY-GEN-PTR,TUMB,391,1,0,1,CB STBY Generator Field(N/F), ON/OFF", "CLOCK(30),3002,WINDING/ADJUSTMENT-KNOB-PULL/PUSH-PTR,LEV,130,0.04,0,1,Winding/Adjustment Clock", "CLOCK(30),3001,WINDING/ADJUSTMENT-KNOB-PULL/PUSH-PTR,BTN,131,1,0,1,Winding/Adjustment Clock", "ELEC_INTERFACE(1),3025,VHF-NAV-PTR,TUMB,293,-1,0,1,CB VHF Nav. (ARN-82), ON/OFF", "ELEC_INTERFACE(1),3025,VHF-NAV-PTR,TUMB,293,1,0,1,CB VHF Nav. (ARN-82), ON/OFF", "IFF(17),3006,MODE-3A-WHEEL-4-WINDOW-PTR,TUMB,73,0.11,0,0.77,MODE3A-WHEEL4", "IFF(17),3006,MODE-3A-WHEEL-4-WINDOW-PTR,TUMB,73,-0.11,0,0.77,MODE3A-WHEEL4", "ADF_ARN_83(27),3005,LOOP-R1-PTR,BTN,42,0.3,0.2,0.3,Loop Right Low Speed", "NAVLIGHT_SYSTEM(7),3005,LDG-LT-1-PTR,TUMB,202,-1,0,1,Landing Light Switch, ON/OFF", "NAVLIGHT_SYSTEM(7),3005,LDG-LT-1-PTR,TUMB,202,1,0,1,Landing Light Switch, ON/OFF", "IFF(17),3004,MODE-3A-WHEEL-2-WINDOW-PTR,TUMB,71,0.11,0,0.77,MODE3A-WHEEL2", "IFF(17),3004,MODE-3A-WHEEL-2-WINDOW-PTR,TUMB,71,-0.11,0,0.77,MODE3A-WHEEL2", "NAVLIGHT_SYSTEM(7),3007,LDG-LT-2-1-PTR,TUMB,205,1,-1,1,Landing Light Control Switch, EXT/OFF/RETR", "NAVLIGHT_SYSTEM(7),3007,LDG-LT-2-1-PTR,TUMB,205,-1,-1,1,Landing Light Control Switch, EXT/OFF/RETR", "NAVLIGHT_SYSTEM(7),3036,LDG-LT-2-2-PTR,TUMB,212,1,-1,1,Landing Light Control Switch Copilot, EXT/OFF/RETR", "NAVLIGHT_SYSTEM(7),3036,LDG-LT-2-2-PTR,TUMB,212,-1,-1,1,Landing Light Control Switch Copilot, EXT/OFF/RETR", "NAVLIGHT_SYSTEM(7),3016,PED-PTR,LEV,231,1,0,1,Pedestal Lights Brightness Rheostat", "ELEC_INTERFACE(1),3087,PILOT-ATTD2-PTR,TUMB,424,-1,0,1,CB Pilot ATTD2(N/F), ON/OFF", "ELEC_INTERFACE(1),3087,PILOT-ATTD2-PTR,TUMB,424,1,0,1,CB Pilot ATTD2(N/F), ON/OFF", "ELEC_INTERFACE(1),3074,GEN-BUS-PTR,TUMB,389,-1,0,1,CB Generator & Bus Reset(N/F), ON/OFF", "ELEC_INTERFACE(1),3074,GEN-BUS-PTR,TUMB,389,1,0,1,CB Generator & Bus Reset(N/F), ON/OFF", "NAVLIGHT_SYSTEM(7),3017,SEC-PTR,LEV,232,1,0,1,Secondary Instrument Lights Brightness Rheostat", "NAVLIGHT_SYSTEM(7),3018,ENGINE-PTR,LEV,233,1,0,1,Engine Instrument Lights Brightness Rheostat", "ELEC_INTERFACE(1),3007,PHASE-SWITCHER-PTR,TUMB,214,-0.1,0,0.2,AC Voltmeter Selector", "ELEC_INTERFACE(1),3007,PHASE-SWITCHER-PTR,TUMB,214,0.1,0,0.2,AC Voltmeter Selector", "ELEC_INTERFACE(1),3085,IGNITER-SOL-PTR,TUMB,405,-1,0,1,CB Ignition system(N/F), ON/OFF", "ELEC_INTERFACE(1),3085,IGNITER-SOL-PTR,TUMB,405,1,0,1,CB Ignition system(N/F), ON/OFF", "IFF(17),3005,MODE-3A-WHEEL-3-WINDOW-PTR,TUMB,72,0.11,0,0.77,MODE3A-WHEEL3", "IFF(17),3005,MODE-3A-WHEEL-3-WINDOW-PTR,TUMB,72,-0.11,0,0.77,MODE3A-WHEEL3", "ELEC_INTERFACE(1),3042,WIND-SHIELD2-CB-PTR,TUMB,303,-1,0,1,CB Wind wiper PLT, ON/OFF", "ELEC_INTERFACE(1),3042,WIND-SHIELD2-CB-PTR,TUMB,303,1,0,1,CB Wind wiper PLT, ON/OFF", "ELEC_INTERFACE(1),3002,MAIN-GEN-SWITCHER-PTR,BTN,216,1,0,1,Main generator Switch (Left button - ON/OFF. Right button RESET)", "ELEC_INTERFACE(1),3002,MAIN-GEN-SWITCHER-PTR,TUMB,216,0,-1,0,Main generator Switch (Left button - ON/OFF. Right button RESET)", "NAVLIGHT_SYSTEM(7),3020,PILOT-PTR,LEV,235,1,0,1,Pilot Instrument Lights Brightness Rheostat", "HEATING_SYSTEM(47),3001,BLEND-AIR-PTR,TUMB,236,0.1,0,0.4,Bleed Air Switch, OFF/1/2/3/4", "HEATING_SYSTEM(47),3001,BLEND-AIR-PTR,TUMB,236,-0.1,0,0.4,Bleed Air Switch, OFF/1/2/3/4", "UHF_ARC_51(22),3002,10-MHZ-CONTROL-PTR,LEV,18,1,0,1,10 MHz Selector", "ELEC_INTERFACE(1),3094,PRESS-FUEL-PTR,TUMB,431,-1,0,1,CB Pressure Fuel(N/F), ON/OFF", "ELEC_INTERFACE(1),3094,PRESS-FUEL-PTR,TUMB,431,1,0,1,CB Pressure Fuel(N/F), ON/OFF", "GMCS(10),3005,HDG-SYNC-PTR,LEV,161,1,0,1,Compass Synchronizing Knob", "ELEC_INTERFACE(1),3076,GOV-CONT-PTR,TUMB,393,-1,0,1,CB Governor Control(N/F), ON/OFF", "ELEC_INTERFACE(1),3076,GOV-CONT-PTR,TUMB,393,1,0,1,CB Governor Control(N/F), ON/OFF", "ELEC_INTERFACE(1),3064,TURN-SLIP-PTR,TUMB,335,-1,0,1,CB Turn & Slip indicator, ON/OFF", "ELEC_INTERFACE(1),3064,TURN-SLIP-PTR,TUMB,335,1,0,1,CB Turn & Slip indicator, ON/OFF", "IFF(17),3001,MODE-1-WHEEL-1-WINDOW-PTR,TUMB,68,0.33,0,0.99,MODE1-WHEEL1", "IFF(17),3001,MODE-1-WHEEL-1-WINDOW-PTR,TUMB,68,-0.33,0,0.99,MODE1-WHEEL1", "ELEC_INTERFACE(1),3080,FUEL-VALVES-PTR,TUMB,401,-1,0,1,CB Fuel valves(N/F), ON/OFF", "ELEC_INTERFACE(1),3080,FUEL-VALVES-PTR,TUMB,401,1,0,1,CB Fuel valves(N/F), ON/OFF", "ELEC_INTERFACE(1),3026,LF-NAV-PTR,TUMB,295,-1,0,1,CB LF Nav. (ARN-83), ON/OFF", "ELEC_INTERFACE(1),3026,LF-NAV-PTR,TUMB,295,1,0,1,CB LF Nav. (ARN-83), ON/OFF", "ELEC_INTERFACE(1),3041,WIND-SHIELD-CB-PTR,TUMB,301,-1,0,1,CB Wind wiper CPLT, ON/OFF", "ELEC_INTERFACE(1),3041,WIND-SHIELD-CB-PTR,TUMB,301,1,0,1,CB Wind wiper CPLT, ON/OFF", "GMCS(10),3004,ADF-VOR-PTR,TUMB,164,-1,0,1,ADF/VOR Control Switch", "GMCS(10),3004,ADF-VOR-PTR,TUMB,164,1,0,1,ADF/VOR Control Switch", "MARKER_BEACON(26),3002,SENSING-SWITCH-PTR,TUMB,55,-1,0,1,Marker Beacon Sensing Switch, HIGH/LOW", "MARKER_BEACON(26),3002,SENSING-SWITCH-PTR,TUMB,55,1,0,1,Marker Beacon Sensing Switch, HIGH/LOW", "ELEC_INTERFACE(1),3034,FM2-ARC-114-PTR,TUMB,359,-1,0,1,CB FM 2 Radio(N/F), ON/OFF", "ELEC_INTERFACE(1),3034,FM2-ARC-114-PTR,TUMB,359,1,0,1,CB FM 2 Radio(N/F), ON/OFF", "PILOT_SIGHT(49),3005,PILOT-SIGHT-POS-PTR,TUMB,0,-1,0,1,Pilot Sight, Armed/Safe", "PILOT_SIGHT(49),3005,PILOT-SIGHT-POS-PTR,TUMB,0,1,0,1,Pilot Sight, Armed/Safe", "IFF(17),3016,MODE-4-SWITCH-PTR,TUMB,67,-1,0,1,IFF On/Out Switch", "IFF(17),3016,MODE-4-SWITCH-PTR,TUMB,67,1,0,1,IFF On/Out Switch", "ELEC_INTERFACE(1),3057,OUTLET-VALVE-PTR,TUMB,323,-1,0,1,CB Cabin heater (Outlet valve)(N/F), ON/OFF", "ELEC_INTERFACE(1),3057,OUTLET-VALVE-PTR,TUMB,323,1,0,1,CB Cabin heater (Outlet valve)(N/F), ON/OFF",
-        "ADI_PILOT(5),3002,PILOT-ATT-PITCH-ADJ-KNOB-PTR,LEV,144,0,0,1,Attitude Indicator Roll Trim Knob", "FUELSYS_INTERFACE(2),3002,FUEL-GAUGE-PTR,BTN,240,1,0,1,Test Fuel Gauge Button - Push to Test", "ELEC_INTERFACE(1),3088,COPILOT-ATTD1-PTR,TUMB,425,-1,0,1,CB Copilot ATTD1(N/F), ON/OFF", "ELEC_INTERFACE(1),3088,COPILOT-ATTD1-PTR,TUMB,425,1,0,1,CB Copilot ATTD1(N/F), ON/OFF", "WEAPON_SYS(9),3010,762-SWITCH-PTR,TUMB,256,1,-1,1,Armament Selector Switch, 7.62/2.75/40", "WEAPON_SYS(9),3010,762-SWITCH-PTR,TUMB,256,-1,-1,1,Armament Selector Switch, 7.62/2.75/40", "NAVLIGHT_SYSTEM(7),3015,CONSOLE-PTR,LEV,230,1,0,1,Overhead Console Panel Lights Brightness Rheostat", "COURSE_IND(29),3001,CDI-OBS-PTR,LEV,155,1,0,1,Course Select Knob", "ELEC_INTERFACE(1),3023,PROX-WARN-PTR,TUMB,289,-1,0,1,CB Prox. warn.(N/F), ON/OFF", "ELEC_INTERFACE(1),3023,PROX-WARN-PTR,TUMB,289,1,0,1,CB Prox. warn.(N/F), ON/OFF", "WEAPON_SYS(9),3013,JETT-COVER-PTR,TUMB,259,-1,-1,1,Jettison Switch Cover, OPEN/CLOSE", "WEAPON_SYS(9),3013,JETT-COVER-PTR,TUMB,259,1,-1,1,Jettison Switch Cover, OPEN/CLOSE", "ELEC_INTERFACE(1),3071,SPARE-INVTR-PTR,TUMB,383,-1,0,1,CB Spare inverter PWR(N/F), ON/OFF", "ELEC_INTERFACE(1),3071,SPARE-INVTR-PTR,TUMB,383,1,0,1,CB Spare inverter PWR(N/F), ON/OFF", "WEAPON_SYS(9),3014,JETT-SWITCH-PTR,BTN,260,1,0,1,Jettison Switch", "ENGINE_INTERFACE(3),3030,THROTTLE-2-PTR,LEV,250,1,-1,0.4,Throttle Copilot", "ELEC_INTERFACE(1),3027,INTER-COM-CPLT-PTR,TUMB,297,-1,0,1,CB Intercom CPLT(N/F), ON/OFF", "ELEC_INTERFACE(1),3027,INTER-COM-CPLT-PTR,TUMB,297,1,0,1,CB Intercom CPLT(N/F), ON/OFF", "FLEX_SIGHT(32),3003,SIGHT-TUMB-PTR,TUMB,408,1,-1,1,Sighting Station Lamp Switch, BACKUP/OFF/MAIN", "FLEX_SIGHT(32),3003,SIGHT-TUMB-PTR,TUMB,408,-1,-1,1,Sighting Station Lamp Switch, BACKUP/OFF/MAIN", "UHF_ARC_51(22),3004,0.05-MHZ-CONTROL-PTR,LEV,20,1,0,1,50 kHz Selector", "WEAPON_SYS(9),3008,ARMED-SWITCH-PTR,TUMB,252,1,-1,1,Armament Switch, ARMED/SAFE/OFF", "WEAPON_SYS(9),3008,ARMED-SWITCH-PTR,TUMB,252,-1,-1,1,Armament Switch, ARMED/SAFE/OFF", "PILOT_SIGHT(49),3006,PILOT-SIGHT-SWITCH-PTR,TUMB,439,-1,0,1,Pilot Sight Switch, ON/OFF", "PILOT_SIGHT(49),3006,PILOT-SIGHT-SWITCH-PTR,TUMB,439,1,0,1,Pilot Sight Switch, ON/OFF", "ELEC_INTERFACE(1),3079,FUEL-TRANS-PTR,TUMB,399,-1,0,1,CB Fuel TRANS(N/F), ON/OFF", "ELEC_INTERFACE(1),3079,FUEL-TRANS-PTR,TUMB,399,1,0,1,CB Fuel TRANS(N/F), ON/OFF", "PILOT_SIGHT(49),3001,PILOT-SIGHT-BRIGHT-PTR,LEV,440,0,0,1,Pilot Sighting Station Intensity Knob", "PILOT_SIGHT(49),3003,PILOT-SIGHT-SCALE-PTR,LEV,441,1,-1,1,Sight Elevation Knob", "CPT_MECH(12),3002,WIPER PILOT-BOTH-COPILOT-PTR,TUMB,227,1,-1,1,Wiper Selector Switch, PILOT/BOTH/COPILOT", "CPT_MECH(12),3002,WIPER PILOT-BOTH-COPILOT-PTR,TUMB,227,-1,-1,1,Wiper Selector Switch, PILOT/BOTH/COPILOT", "NAVLIGHT_SYSTEM(7),3034,LDG-LT-2-PTR,TUMB,209,-1,0,1,Landing Light Switch Copilot, ON/OFF", "NAVLIGHT_SYSTEM(7),3034,LDG-LT-2-PTR,TUMB,209,1,0,1,Landing Light Switch Copilot, ON/OFF", "ELEC_INTERFACE(1),3052,COCKPIT-LIGHTS-PTR,TUMB,369,-1,0,1,CB Cockpit lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3052,COCKPIT-LIGHTS-PTR,TUMB,369,1,0,1,CB Cockpit lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3078,RH-FUEL-PTR,TUMB,397,-1,0,1,CB RH fuel boost pump(N/F), ON/OFF", "ELEC_INTERFACE(1),3078,RH-FUEL-PTR,TUMB,397,1,0,1,CB RH fuel boost pump(N/F), ON/OFF", "CONTROL_SYSTEM(41),3001,FORCE-TRIM-1-PTR,BTN,189,1,0,1,Force Trim Button", "CONTROL_SYSTEM(41),3002,FORCE-TRIM-2-PTR,BTN,193,1,0,1,Force Trim Button", "ELEC_INTERFACE(1),3049,FUS-LIGHTS-PTR,TUMB,363,-1,0,1,CB Fuselage lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3049,FUS-LIGHTS-PTR,TUMB,363,1,0,1,CB Fuselage lights(N/F), ON/OFF", "INTERCOM(21),3001,RECEIVER-1-PTR,TUMB,23,-1,0,1,VHF FM Radio Receiver Switch, ON/OFF", "INTERCOM(21),3001,RECEIVER-1-PTR,TUMB,23,1,0,1,VHF FM Radio Receiver Switch, ON/OFF", "ELEC_INTERFACE(1),3043,K-Y20-PTR,TUMB,305,-1,0,1,CB KY-28 voice security(N/F), ON/OFF", "ELEC_INTERFACE(1),3043,K-Y20-PTR,TUMB,305,1,0,1,CB KY-28 voice security(N/F), ON/OFF", "EXT_CARGO_EQUIPMENT(52),3001,CARGO-RELEASE-1-PTR,BTN,195,1,0,1,Cargo Release Pilot", "ELEC_INTERFACE(1),3050,NAV-LIGHTS-PTR,TUMB,365,-1,0,1,CB Navigation lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3050,NAV-LIGHTS-PTR,TUMB,365,1,0,1,CB Navigation lights(N/F), ON/OFF", "EXT_CARGO_EQUIPMENT(52),3002,CARGO-RELEASE-2-PTR,BTN,198,1,0,1,Cargo Release CoPilot", "EXT_CARGO_EQUIPMENT(52),3003,CARGO-REL-PTR,TUMB,228,-1,0,1,Cargo Safety", "EXT_CARGO_EQUIPMENT(52),3003,CARGO-REL-PTR,TUMB,228,1,0,1,Cargo Safety", "FUELSYS_INTERFACE(2),3001,FUEL-PTR,TUMB,81,-1,0,1,Main Fuel Switch, ON/OFF", "FUELSYS_INTERFACE(2),3001,FUEL-PTR,TUMB,81,1,0,1,Main Fuel Switch, ON/OFF", "MARKER_BEACON(26),3001,VOLUME-OFF-INCR-CONTROL-PTR,LEV,57,1,0,1,Marker Beacon Knob, ON/OFF/Volume", "XM_130(50),3002,RIPPLE-FIRE-PTR,TUMB,451,-1,0,1,Ripple Fire Switch, ON/OFF", "XM_130(50),3002,RIPPLE-FIRE-PTR,TUMB,451,1,0,1,Ripple Fire Switch, ON/OFF", "ELEC_INTERFACE(1),3065,TEMP-IND-PTR,TUMB,337,-1,0,1,CB TEMP indicator(N/F), ON/OFF", "ELEC_INTERFACE(1),3065,TEMP-IND-PTR,TUMB,337,1,0,1,CB TEMP indicator(N/F), ON/OFF", "INTERCOM(21),3005,RECEIVER-INT-PTR,TUMB,27,-1,0,1,INT Receiver Switch, ON/OFF", "INTERCOM(21),3005,RECEIVER-INT-PTR,TUMB,27,1,0,1,INT Receiver Switch, ON/OFF", "XM_130(50),3005,CHAFF-ARM-SWITCH-PTR,TUMB,456,-1,0,1,ARM Switch, SAFE/ARM", "XM_130(50),3005,CHAFF-ARM-SWITCH-PTR,TUMB,456,1,0,1,ARM Switch, SAFE/ARM", "XM_130(50),3009,PGRM-SWITCH-PTR,TUMB,459,-1,0,1,Chaff Mode Switch, MAN/PGRM", "XM_130(50),3009,PGRM-SWITCH-PTR,TUMB,459,1,0,1,Chaff Mode Switch, MAN/PGRM", "XM_130(50),3006,FLARE-DISP-PTR,BTN,464,1,0,1,Flare Dispense Button - Push to dispense", "XM_130(50),3008,CHAFF-PTR,LEV,454,0,0,1,Chaff counter Reset. Rotate mouse wheel to set Number", "XM_130(50),3007,CHAFF-PTR,BTN,455,1,0,1,Chaff counter Reset. Rotate mouse wheel to set Number", "CPT_MECH(12),3005,DOOR_L-PTR,BTN,419,1,0,1,Open Doors", "RADAR_ALTIMETER(13),3002,PITCH-LO-ALT-PTR,LEV,445,1,0,1,Low Altitude Setting Knob", "ENGINE_INTERFACE(3),3027,ENGINE-BTN-1-PTR,TUMB,206,-1,0,1,Throttle Stop Switch, ON/OFF", "ENGINE_INTERFACE(3),3027,ENGINE-BTN-1-PTR,TUMB,206,1,0,1,Throttle Stop Switch, ON/OFF", "RADAR_ALTIMETER(13),3003,PITCH-HI-ALT-PTR,LEV,448,0,0,1,Test / Hight Set. Left mouse click to Test. Rotate mouse wheel to set Hight", "RADAR_ALTIMETER(13),3001,PITCH-HI-ALT-PTR,BTN,446,1,0,1,Test / Hight Set. Left mouse click to Test. Rotate mouse wheel to set Hight", "RADAR_ALTIMETER(13),3007,RADAR-ALT-PTR,TUMB,449,-1,0,1,Radar Altimeter Power Switch, ON/OFF", "RADAR_ALTIMETER(13),3007,RADAR-ALT-PTR,TUMB,449,1,0,1,Radar Altimeter Power Switch, ON/OFF", "ADF_ARN_83(27),3005,LOOP-L-R-SWITCH-PTR,BTN,42,0.3,0.2,0.3,ADF Loop Antenna Speed Switch, L/R", "ADF_ARN_83(27),3005,LOOP-L-R-SWITCH-PTR,BTN,42,0.1,0.2,0.1,ADF Loop Antenna Speed Switch, L/R", "VHF_ARC_131(23),3006,VOLUME-CONTROL-PTR,LEV,37,1,0.3,1,Volume Knob", "ENGINE_INTERFACE(3),3029,GOV-RPM-2-PTR,TUMB,210,1,0,1,Governor RPM Switch Copilot, Decrease/Increase", "ENGINE_INTERFACE(3),3029,GOV-RPM-2-PTR,TUMB,210,0,-1,0,Governor RPM Switch Copilot, Decrease/Increase", "IFF(17),3002,MODE-1-WHEEL-2-WINDOW-PTR,TUMB,69,0.11,0,0.77,MODE1-WHEEL2", "IFF(17),3002,MODE-1-WHEEL-2-WINDOW-PTR,TUMB,69,-0.11,0,0.77,MODE1-WHEEL2", "NAVLIGHT_SYSTEM(7),3021,FWD-PTR,TUMB,226,1,-1,1,Dome Light Switch, WHITE/OFF/GREEN", "NAVLIGHT_SYSTEM(7),3021,FWD-PTR,TUMB,226,-1,-1,1,Dome Light Switch, WHITE/OFF/GREEN", "ADF_ARN_83(27),3004,GAIN-CONTROL-PTR,LEV,44,-0.1,0,1,Gain control / Mode. Right mouse click to cycle mode. Rotate mouse wheel to adjust gain", "ADF_ARN_83(27),3001,GAIN-CONTROL-PTR,TUMB,43,0.1,0,0.3,Gain control / Mode. Right mouse click to cycle mode. Rotate mouse wheel to adjust gain", "ADF_ARN_83(27),3001,GAIN-CONTROL-PTR,TUMB,43,-0.1,0,0.3,Gain control / Mode. Right mouse click to cycle mode. Rotate mouse wheel to adjust gain", "FLEX_SIGHT(32),3001,SIGHT-BRIGHT-SWITCHER-PTR,LEV,281,1,0,1,Sighting Station Intensity Knob", "ELEC_INTERFACE(1),3054,CONSOLE-LIGHTS-PTR,TUMB,373,-1,0,1,CB Console lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3054,CONSOLE-LIGHTS-PTR,TUMB,373,1,0,1,CB Console lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3073,MAIN-INVTR-PTR,TUMB,387,-1,0,1,CB Main inverter PWR(N/F), ON/OFF", "ELEC_INTERFACE(1),3073,MAIN-INVTR-PTR,TUMB,387,1,0,1,CB Main inverter PWR(N/F), ON/OFF", "XM_130(50),3010,CHAFF-ARM-TEST-PTR,BTN,457,1,0,1,Armed Lamp Test Button - Push to test", "IFF(17),3011,TEST-M-2-PTR,BTN,62,1,0,1,Test M-2 Switch", "IFF(17),3011,TEST-M-2-PTR,TUMB,62,0,-1,0,Test M-2 Switch", "ELEC_INTERFACE(1),3032,FM-ARC-54-PTR,TUMB,355,-1,0,1,CB FM Radio, ON/OFF", "ELEC_INTERFACE(1),3032,FM-ARC-54-PTR,TUMB,355,1,0,1,CB FM Radio, ON/OFF", "ADF_ARN_83(27),3005,LOOP-L1-PTR,BTN,42,0.1,0.2,0.1,Loop Left Low Speed", "ADI_OPERATOR(6),3001,CAGING-KNOB-ROTATION-PTR,BTN,140,1,0,1,Cage Copilot's Attitude Indicator - Pull to cage", "VHF_ARC_134(20),3002,COMMUNICATION-TEST-SWITCH-PTR,BTN,6,1,0,1,Comm Test Button - Push to test", "ELEC_INTERFACE(1),3060,RPM-WARN-PTR,TUMB,327,-1,0,1,CB RPM Warning system(N/F), ON/OFF", "ELEC_INTERFACE(1),3060,RPM-WARN-PTR,TUMB,327,1,0,1,CB RPM Warning system(N/F), ON/OFF", "ELEC_INTERFACE(1),3005,NON-ESS-BUS-SWITCHERr-PTR,TUMB,221,-1,0,1,Non-Essential Bus Switch, NORMAL/MANUAL", "ELEC_INTERFACE(1),3005,NON-ESS-BUS-SWITCHERr-PTR,TUMB,221,1,0,1,Non-Essential Bus Switch, NORMAL/MANUAL", "NAVLIGHT_SYSTEM(7),3019,COPILOT-PTR,LEV,234,1,0,1,Copilot Instrument Lights Brightness Rheostat", "GMCS(10),3003,HDG-SET-PTR,LEV,163,1,0,1,Heading Set Knob", "IFF(17),3021,TEST-LIGHT-PTR,LEV,79,0.5,0,1,Test Button", "IFF(17),3018,TEST-LIGHT-PTR,BTN,75,1,0,1,Test Button", "XM_130(50),3004,FLARE-PTR,LEV,452,0,0,1,Flare counter Reset. Rotate mouse wheel to set Number", "XM_130(50),3003,FLARE-PTR,BTN,453,1,0,1,Flare counter Reset. Rotate mouse wheel to set Number", "HYDRO_SYS_INTERFACE(4),3004,FORCE-TRIM-PTR,TUMB,89,-1,0,1,Force Trim Switch, ON/OFF", "HYDRO_SYS_INTERFACE(4),3004,FORCE-TRIM-PTR,TUMB,89,1,0,1,Force Trim Switch, ON/OFF", "ELEC_INTERFACE(1),3092,TRANS-28V-PTR,TUMB,429,-1,0,1,CB 28V Trans(N/F), ON/OFF",
-        "ELEC_INTERFACE(1),3092,TRANS-28V-PTR,TUMB,429,1,0,1,CB 28V Trans(N/F), ON/OFF", "IFF(17),3020,REPLY-LIGHT-PTR,LEV,78,0.5,0,1,Reply Button", "IFF(17),3017,REPLY-LIGHT-PTR,BTN,74,1,0,1,Reply Button", "NAVLIGHT_SYSTEM(7),3001,NVG-POSITION-LTS-PTR,TUMB,222,0.1,0,0.5,Navigation Lights Switch, OFF/1/2/3/4/BRT", "NAVLIGHT_SYSTEM(7),3001,NVG-POSITION-LTS-PTR,TUMB,222,-0.1,0,0.5,Navigation Lights Switch, OFF/1/2/3/4/BRT", "ELEC_INTERFACE(1),3066,HYD-CONT-CB-PTR,TUMB,339,-1,0,1,CB HYD Control(N/F), ON/OFF", "ELEC_INTERFACE(1),3066,HYD-CONT-CB-PTR,TUMB,339,1,0,1,CB HYD Control(N/F), ON/OFF", "NAVLIGHT_SYSTEM(7),3006,SL-ON-OFF-STOW-1-PTR,TUMB,201,1,-1,1,Search Light Switch, ON/OFF/STOW", "NAVLIGHT_SYSTEM(7),3006,SL-ON-OFF-STOW-1-PTR,TUMB,201,-1,-1,1,Search Light Switch, ON/OFF/STOW", "AAU7(18),3001,PILOT-ALT-SET-KNOB-PTR,LEV,181,0,0,1,Pressure Adjustment Knob", "ELEC_INTERFACE(1),3095,PRESS-TORQ-PTR,TUMB,432,-1,0,1,CB Pressure Torque(N/F), ON/OFF", "ELEC_INTERFACE(1),3095,PRESS-TORQ-PTR,TUMB,432,1,0,1,CB Pressure Torque(N/F), ON/OFF", "ELEC_INTERFACE(1),3044,STARTER-RELAY-PTR,TUMB,403,-1,0,1,CB Starter Relay(N/F), ON/OFF", "ELEC_INTERFACE(1),3044,STARTER-RELAY-PTR,TUMB,403,1,0,1,CB Starter Relay(N/F), ON/OFF", "UHF_ARC_51(22),3005,MODE-SELECT-SWITCH-PTR,TUMB,15,0.1,0,0.2,Frequency Mode Dial", "UHF_ARC_51(22),3005,MODE-SELECT-SWITCH-PTR,TUMB,15,-0.1,0,0.2,Frequency Mode Dial", "ELEC_INTERFACE(1),3008,INVTR-SWITCHER-PTR,TUMB,215,1,-1,1,Inverter Switch, MAIN/OFF/SPARE", "ELEC_INTERFACE(1),3008,INVTR-SWITCHER-PTR,TUMB,215,-1,-1,1,Inverter Switch, MAIN/OFF/SPARE", "ENGINE_INTERFACE(3),3024,THROTTLE-1-PTR,LEV,250,1,-1,0.4,Throttle", "VHF_ARC_131(23),3003,FREQUENCY-SELECTOR-3-PTR,TUMB,33,0.1,0,0.9,Frequency Decimals MHz Selector", "VHF_ARC_131(23),3003,FREQUENCY-SELECTOR-3-PTR,TUMB,33,-0.1,0,0.9,Frequency Decimals MHz Selector", "INTERCOM(21),3003,RECEIVER-3-PTR,TUMB,25,-1,0,1,VHF AM Radio Receiver Switch, ON/OFF", "INTERCOM(21),3003,RECEIVER-3-PTR,TUMB,25,1,0,1,VHF AM Radio Receiver Switch, ON/OFF", "WEAPON_SYS(9),3011,RKT-PAIR-PTR,TUMB,257,0.1,0,0.7,Rocket Pair Selector Switch", "WEAPON_SYS(9),3011,RKT-PAIR-PTR,TUMB,257,-0.1,0,0.7,Rocket Pair Selector Switch", "ELEC_INTERFACE(1),3033,UHF-ARC-51-PTR,TUMB,357,-1,0,1,CB UHF Radio, ON/OFF", "ELEC_INTERFACE(1),3033,UHF-ARC-51-PTR,TUMB,357,1,0,1,CB UHF Radio, ON/OFF", "ELEC_INTERFACE(1),3004,VM-SWITCHER-PTR,TUMB,218,-0.1,0,0.4,DC Voltmeter Selector", "ELEC_INTERFACE(1),3004,VM-SWITCHER-PTR,TUMB,218,0.1,0,0.4,DC Voltmeter Selector", "ELEC_INTERFACE(1),3093,FAIL-RELAY-PTR,TUMB,430,-1,0,1,CB Fail Relay(N/F), ON/OFF", "ELEC_INTERFACE(1),3093,FAIL-RELAY-PTR,TUMB,430,1,0,1,CB Fail Relay(N/F), ON/OFF", "INTERCOM(21),3006,RECEIVER-NAV-PTR,TUMB,28,-1,0,1,Receiver NAV Switch, ON/OFF", "INTERCOM(21),3006,RECEIVER-NAV-PTR,TUMB,28,1,0,1,Receiver NAV Switch, ON/OFF", "GMCS(10),3002,DG-SLAVE-PTR,TUMB,241,-1,0,1,Gyro Mode Switch, DG/Slave", "GMCS(10),3002,DG-SLAVE-PTR,TUMB,241,1,0,1,Gyro Mode Switch, DG/Slave", "ELEC_INTERFACE(1),3086,PILOT-ATTD1-PTR,TUMB,423,-1,0,1,CB Pilot ATTD1(N/F), ON/OFF", "ELEC_INTERFACE(1),3086,PILOT-ATTD1-PTR,TUMB,423,1,0,1,CB Pilot ATTD1(N/F), ON/OFF", "ELEC_INTERFACE(1),3022,IFF-APX-PTR,TUMB,287,-1,0,1,CB IFF APX 2 (N/F), ON/OFF", "ELEC_INTERFACE(1),3022,IFF-APX-PTR,TUMB,287,1,0,1,CB IFF APX 2 (N/F), ON/OFF", "ELEC_INTERFACE(1),3055,INST-PANEL-LIGHTS-PTR,TUMB,375,-1,0,1,CB INST Panel lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3055,INST-PANEL-LIGHTS-PTR,TUMB,375,1,0,1,CB INST Panel lights(N/F), ON/OFF", "AAU32(19),3001,SET-PRESSURE-KNOB-PTR,LEV,172,0,0,1,Pressure Adjustment Knob", "ARN_82(25),3002,FRACTIONAL-MHZ-SELECTOR-KNOB-KNOB-PTR,LEV,53,0.1,0,1,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "ARN_82(25),3004,FRACTIONAL-MHZ-SELECTOR-KNOB-KNOB-PTR,TUMB,54,0.1,0,0.65,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "ARN_82(25),3004,FRACTIONAL-MHZ-SELECTOR-KNOB-KNOB-PTR,TUMB,54,-0.1,0,0.65,Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume", "ELEC_INTERFACE(1),3053,CAUTION-LIGHTS-PTR,TUMB,371,-1,0,1,CB Caution lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3053,CAUTION-LIGHTS-PTR,TUMB,371,1,0,1,CB Caution lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3016,MTR-PTR,TUMB,238,-1,0,1,Pitot Heater Switch, ON/OFF", "ELEC_INTERFACE(1),3016,MTR-PTR,TUMB,238,1,0,1,Pitot Heater Switch, ON/OFF", "HYDRO_SYS_INTERFACE(4),3003,HYD-CONT-PTR,TUMB,90,-1,0,1,Hydraulic Control Switch, ON/OFF", "HYDRO_SYS_INTERFACE(4),3003,HYD-CONT-PTR,TUMB,90,1,0,1,Hydraulic Control Switch, ON/OFF", "ELEC_INTERFACE(1),3056,INST-SEC-LIGHTS-PTR,TUMB,377,-1,0,1,CB INST SEC lights(N/F), ON/OFF", "ELEC_INTERFACE(1),3056,INST-SEC-LIGHTS-PTR,TUMB,377,1,0,1,CB INST SEC lights(N/F), ON/OFF", "UHF_ARC_51(22),3003,1-MHZ-CONTROL-PTR,LEV,19,1,0,1,1 MHz Selector", "ELEC_INTERFACE(1),3072,INVTR-PTR,TUMB,385,-1,0,1,CB Inverter CTRL (N/F), ON/OFF", "ELEC_INTERFACE(1),3072,INVTR-PTR,TUMB,385,1,0,1,CB Inverter CTRL (N/F), ON/OFF", "UHF_ARC_51(22),3001,PRESET-CHANNEL-PTR,TUMB,16,0.05,0,0.95,Preset Channel Selector", "UHF_ARC_51(22),3001,PRESET-CHANNEL-PTR,TUMB,16,-0.05,0,0.95,Preset Channel Selector", "WEAPON_SYS(9),3012,RKT-RESET-PTR,BTN,258,1,0,1,Rocket Reset Button - Push to reset", "ELEC_INTERFACE(1),3068,FORCE-TRIM-CB-PTR,TUMB,341,-1,0,1,CB FORCE Trim(N/F), ON/OFF", "ELEC_INTERFACE(1),3068,FORCE-TRIM-CB-PTR,TUMB,341,1,0,1,CB FORCE Trim(N/F), ON/OFF", "ELEC_INTERFACE(1),3062,FIRE-PTR,TUMB,331,-1,0,1,CB Fire detector(N/F), ON/OFF", "ELEC_INTERFACE(1),3062,FIRE-PTR,TUMB,331,1,0,1,CB Fire detector(N/F), ON/OFF", "IFF(17),3015,IDENT-MIC SWITCH-PTR,BTN,66,1,0,1,Ident/Mic Switch", "IFF(17),3015,IDENT-MIC SWITCH-PTR,TUMB,66,0,-1,0,Ident/Mic Switch", "ELEC_INTERFACE(1),3089,COPILOT-ATTD2--PTR,TUMB,426,-1,0,1,CB Copilot ATTD2(N/F), ON/OFF", "ELEC_INTERFACE(1),3089,COPILOT-ATTD2--PTR,TUMB,426,1,0,1,CB Copilot ATTD2(N/F), ON/OFF"],
-    "Yak-52": ["TERTIARY_CONTROLS(6),3007,ALT_MMHG_P1,LEV,118,1,0,1,Cockpit.Yak52.altimeter", "ENGINE_CONTROLS(3),3040,STARTER_P1,BTN,16,1,0,1,Cockpit.Yak52.starter", "ENGINE_CONTROLS(3),3040,STARTER_P1,BTN,16,1,0,1,Cockpit.Yak52.starter", "ENGINE_CONTROLS(3),3005,MAGNETO_P0_1,TUMB,10,0,0,0,Cockpit.Yak52.magnetos_1", "ARK15M(21),3057,RDF_LISTEN_P1,TUMB,252,1,0,1,Cockpit.Yak52.rdf_listen_mode", "ARK15M(21),3057,RDF_LISTEN_P1,TUMB,252,-1,0,1,Cockpit.Yak52.rdf_listen_mode", "TERTIARY_CONTROLS(6),3024,CLK_PINION1_P0,LEV,120,0.04,0,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3023,CLK_PINION1_P0,TUMB,119,0.5,0,0.5,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3023,CLK_PINION1_P0,BTN,119,1,0.5,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3030,CLK_PINION2_P1,LEV,134,1,0,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3029,CLK_PINION2_P1,BTN,133,1,0,1,Cockpit.Yak52.clock", "CONTROLS(2),3010,FLAPS_P0,TUMB,215,-0.5,0,1,Cockpit.Yak52.flaps", "CONTROLS(2),3010,FLAPS_P0,TUMB,215,0.5,0,1,Cockpit.Yak52.flaps", "ELECTRICAL_CONTROLS(4),3016,CB_OILDIL_P0,BTN,232,1,0,1,Cockpit.Yak52.cb_oil_dilution", "ELECTRICAL_CONTROLS(4),3016,CB_OILDIL_P0,BTN,232,1,0,1,Cockpit.Yak52.cb_oil_dilution", "ENGINE_CONTROLS(3),3005,MAGNETO_P0_3,TUMB,10,0,0,0,Cockpit.Yak52.magnetos_3", "FORE_UGR4UK(22),3001,HSI_KNOB_P0,LEV,155,0,0,1,Cockpit.Yak52.hsi", "ENGINE_CONTROLS(3),3003,MAGNETO_P0,TUMB,10,-0.1,0,0.3,Cockpit.Yak52.magnetos", "ENGINE_CONTROLS(3),3003,MAGNETO_P0,TUMB,10,0.1,0,0.3,Cockpit.Yak52.magnetos", "ELECTRICAL_CONTROLS(4),3030,CB_UMFORMER2_P0,TUMB,224,1,0,1,Cockpit.Yak52.cb_pag1", "ELECTRICAL_CONTROLS(4),3030,CB_UMFORMER2_P0,TUMB,224,-1,0,1,Cockpit.Yak52.cb_pag1", "ELECTRICAL_CONTROLS(4),3013,CB_E_INSTR_P0,TUMB,221,1,0,1,Cockpit.Yak52.cb_engine_instrumentation", "ELECTRICAL_CONTROLS(4),3013,CB_E_INSTR_P0,TUMB,221,-1,0,1,Cockpit.Yak52.cb_engine_instrumentation", "ELECTRICAL_CONTROLS(4),3007,CB_IGNITION_P0,TUMB,98,1,0,1,Cockpit.Yak52.cb_ignition", "ELECTRICAL_CONTROLS(4),3007,CB_IGNITION_P0,TUMB,98,-1,0,1,Cockpit.Yak52.cb_ignition", "ELECTRICAL_CONTROLS(4),3039,CB_RDF_P0,TUMB,220,1,0,1,Cockpit.Yak52.cb_rdf", "ELECTRICAL_CONTROLS(4),3039,CB_RDF_P0,TUMB,220,-1,0,1,Cockpit.Yak52.cb_rdf", "IUT3(16),3001,FUEL_CONTROL_P0,BTN,177,1,0,1,Cockpit.Yak52.fuel_gauge_test", "IUT3(16),3001,FUEL_CONTROL_P0,BTN,177,1,0,1,Cockpit.Yak52.fuel_gauge_test", "ARK15M(21),3007,RDF_LISTEN_P0,TUMB,245,1,0,1,Cockpit.Yak52.rdf_listen_mode", "ARK15M(21),3007,RDF_LISTEN_P0,TUMB,245,-1,0,1,Cockpit.Yak52.rdf_listen_mode", "VHF_RADIO(27),3020,RADIO_P0_SQ,TUMB,91,1,0,1,Cockpit.Yak52.radio_squelch", "VHF_RADIO(27),3020,RADIO_P0_SQ,TUMB,91,-1,0,1,Cockpit.Yak52.radio_squelch", "TERTIARY_CONTROLS(6),3021,AH_ARRETIR_P1,BTN,151,1,0,1,Cockpit.Yak52.ah_arretir", "TERTIARY_CONTROLS(6),3021,AH_ARRETIR_P1,BTN,151,1,0,1,Cockpit.Yak52.ah_arretir", "TERTIARY_CONTROLS(6),3012,AH_PINION_P0,LEV,143,0,0,1,Cockpit.Yak52.ah_zeroing", "GMK1A(20),3005,SDG_CONTROL_P0,BTN,260,1,0,1,Cockpit.Yak52.sdg_checkup", "GMK1A(20),3005,SDG_CONTROL_P0,BTN,260,-1,-1,0,Cockpit.Yak52.sdg_checkup", "VHF_RADIO(27),3001,RADIO_TX_P0,BTN,192,1,0,1,Radio Button", "VHF_RADIO(27),3001,RADIO_TX_P0,BTN,192,1,0,1,Radio Button", "TERTIARY_CONTROLS(6),3020,AH_ARRETIR_P0,BTN,145,1,0,1,Cockpit.Yak52.ah_arretir", "TERTIARY_CONTROLS(6),3020,AH_ARRETIR_P0,BTN,145,1,0,1,Cockpit.Yak52.ah_arretir", "GMK1A(20),3007,SDG_COURSE_P0,BTN,261,1,0,1,Cockpit.Yak52.sdg_course", "GMK1A(20),3007,SDG_COURSE_P0,BTN,261,-1,-1,0,Cockpit.Yak52.sdg_course", "GMK1A(20),3009,SDG_LAT_P0,LEV,262,0,0,1,Cockpit.Yak52.sdg_latitude", "ARK15M(21),3022,RDF_CHANNEL_P0,TUMB,244,0.1,0,0.4,Cockpit.Yak52.rdf_channel", "ARK15M(21),3022,RDF_CHANNEL_P0,TUMB,244,-0.1,0,0.4,Cockpit.Yak52.rdf_channel", "CONTROLS(2),3040,CB_BRAKES_CUT_P1,TUMB,293,1,0,1,Cockpit.Yak52.cb_wheel_brakes_purge", "CONTROLS(2),3040,CB_BRAKES_CUT_P1,TUMB,293,-1,0,1,Cockpit.Yak52.cb_wheel_brakes_purge", "ARK15M(21),3019,RDF_MODE_12_P0,TUMB,246,1,0,1,Cockpit.Yak52.rdf_mode", "ARK15M(21),3019,RDF_MODE_12_P0,TUMB,246,-1,0,1,Cockpit.Yak52.rdf_mode", "TERTIARY_CONTROLS(6),3015,AH_PINION_P1,LEV,149,0,0,1,Cockpit.Yak52.ah_zeroing", "ENGINE_CONTROLS(3),3044,PRIMER_P0_0,TUMB,76,0,0,0,Cockpit.Yak52.primer_off", "TERTIARY_CONTROLS(6),3039,SMOKER_SWITCH_P0,TUMB,190,1,0,1,Cockpit.Yak52.smoke_apparatus", "TERTIARY_CONTROLS(6),3039,SMOKER_SWITCH_P0,TUMB,190,-1,0,1,Cockpit.Yak52.smoke_apparatus", "CONTROLS(2),3001,UC_P0,TUMB,277,-1,-1,1,Cockpit.Yak52.uc", "CONTROLS(2),3001,UC_P0,TUMB,277,1,-1,1,Cockpit.Yak52.uc", "ELECTRICAL_CONTROLS(4),3018,CB_E_HEAT_P0,TUMB,233,1,0,1,Cockpit.Yak52.cb_stall_warning_heater", "ELECTRICAL_CONTROLS(4),3018,CB_E_HEAT_P0,TUMB,233,-1,0,1,Cockpit.Yak52.cb_stall_warning_heater", "INTERCOM(28),3007,INTERCOM_P0_S1,TUMB,82,1,0,1,Cockpit.Generic.intercom_stby_distributive_switch", "INTERCOM(28),3007,INTERCOM_P0_S1,TUMB,82,-1,0,1,Cockpit.Generic.intercom_stby_distributive_switch", "ARK15M(21),3025,CB_ADF_P0,TUMB,104,1,0,1,Cockpit.Yak52.adf_marker", "ARK15M(21),3025,CB_ADF_P0,TUMB,104,-1,0,1,Cockpit.Yak52.adf_marker", "VHF_RADIO(27),3002,RADIO_P0_VOL,LEV,90,0,0,1,Cockpit.Yak52.radio_volume", "CONTROLS(2),3051,HATCH_L_P0,TUMB,267,1,0,1,Cockpit.Yak52.canopy_operate", "CONTROLS(2),3051,HATCH_L_P0,TUMB,267,-1,0,1,Cockpit.Yak52.canopy_operate", "ENGINE_CONTROLS(3),3035,STARTER_COVER_P0,TUMB,13,1,0,1,Cockpit.Yak52.starter_cover", "ENGINE_CONTROLS(3),3035,STARTER_COVER_P0,TUMB,13,-1,0,1,Cockpit.Yak52.starter_cover", "CONTROLS(2),3022,BRAKES_P1,LEV,284,0,0,1,Cockpit.Yak52.wheel_brakes", "INTERCOM(28),3001,INTERCOM_P0_RH1,LEV,80,0,0,1,Cockpit.Generic.intercom_volume_knob", "CONTROLS(2),3029,BRAKES_L_P1,BTN,6,1,0,1,Cockpit.Yak52.wheel_brakes_lock", "CONTROLS(2),3029,BRAKES_L_P1,BTN,6,1,0,1,Cockpit.Yak52.wheel_brakes_lock", "VA2(15),3001,VA_KNOB_P0,BTN,176,1,0,1,Cockpit.Yak52.voltamperemeter", "VA2(15),3001,VA_KNOB_P0,BTN,176,1,0,1,Cockpit.Yak52.voltamperemeter", "CONTROLS(2),3031,BRAKES_CUT_P1,BTN,212,1,0,1,Cockpit.Yak52.wheel_brakes_purge", "CONTROLS(2),3031,BRAKES_CUT_P1,BTN,212,1,0,1,Cockpit.Yak52.wheel_brakes_purge", "ELECTRICAL_CONTROLS(4),3001,CB_BATTERY_P0,TUMB,96,0.5,0,1,Cockpit.Yak52.cb_battery", "ELECTRICAL_CONTROLS(4),3001,CB_BATTERY_P0,TUMB,96,-0.5,0,1,Cockpit.Yak52.cb_battery", "ENGINE_CONTROLS(3),3006,MAGNETO_P1,TUMB,11,-0.1,0,0.3,Cockpit.Yak52.magnetos", "ENGINE_CONTROLS(3),3006,MAGNETO_P1,TUMB,11,0.1,0,0.3,Cockpit.Yak52.magnetos", "INTERCOM(28),3004,INTERCOM_P0_RH2,LEV,81,0,0,1,Cockpit.Generic.radio_volume_knob", "CONTROLS(2),3004,UC_P1,TUMB,278,-1,-1,1,Cockpit.Yak52.uc", "CONTROLS(2),3004,UC_P1,TUMB,278,1,-1,1,Cockpit.Yak52.uc", "TERTIARY_CONTROLS(6),3041,PNEM_VALVE_P0,LEV,230,0,0,1,Cockpit.Yak52.pneumatics_valve", "ENGINE_CONTROLS(3),3005,MAGNETO_P0_2,TUMB,10,0,0,0,Cockpit.Yak52.magnetos_2", "INTERCOM(28),3019,INTERCOM_P1_S2,TUMB,87,1,0,1,Cockpit.Generic.intercom_rdf_switch", "INTERCOM(28),3019,INTERCOM_P1_S2,TUMB,87,-1,0,1,Cockpit.Generic.intercom_rdf_switch", "TERTIARY_CONTROLS(6),3001,ACCMETER_P0,BTN,45,1,0,1,Cockpit.Yak52.accelerometer", "TERTIARY_CONTROLS(6),3001,ACCMETER_P0,BTN,45,1,0,1,Cockpit.Yak52.accelerometer", "ENGINE_CONTROLS(3),3008,MAGNETO_P1_1,TUMB,11,0,0,0,Cockpit.Yak52.magnetos_1", "INTERCOM(28),3009,INTERCOM_P0_S2,TUMB,83,1,0,1,Cockpit.Generic.intercom_rdf_switch", "INTERCOM(28),3009,INTERCOM_P0_S2,TUMB,83,-1,0,1,Cockpit.Generic.intercom_rdf_switch", "ELECTRICAL_CONTROLS(4),3099,L_CTRL_P1,BTN,9,1,0,1,Cockpit.Yak52.lamps_test", "ELECTRICAL_CONTROLS(4),3099,L_CTRL_P1,BTN,9,1,0,1,Cockpit.Yak52.lamps_test", "TERTIARY_CONTROLS(6),3002,ACCMETER_P1,BTN,49,1,0,1,Cockpit.Yak52.accelerometer", "TERTIARY_CONTROLS(6),3002,ACCMETER_P1,BTN,49,1,0,1,Cockpit.Yak52.accelerometer", "IUT3(16),3002,FUEL_DIMMER_P0,TUMB,178,1,0,1,Cockpit.Yak52.fuel_gauge_dimmer", "IUT3(16),3002,FUEL_DIMMER_P0,TUMB,178,-1,0,1,Cockpit.Yak52.fuel_gauge_dimmer", "ENGINE_CONTROLS(3),3001,IGNITION_S_P1,TUMB,12,1,0,1,Cockpit.Yak52.ignitionsource", "ENGINE_CONTROLS(3),3001,IGNITION_S_P1,TUMB,12,-1,0,1,Cockpit.Yak52.ignitionsource", "VHF_RADIO(27),3011,RADIO_P0_HRKNOB,TUMB,88,0.1,0,1,Cockpit.Yak52.radio_tune_mhz", "VHF_RADIO(27),3011,RADIO_P0_HRKNOB,TUMB,88,-0.1,0,1,Cockpit.Yak52.radio_tune_mhz", "ELECTRICAL_CONTROLS(4),3042,CB_SDG_P0,TUMB,219,1,0,1,Cockpit.Yak52.cb_sdg", "ELECTRICAL_CONTROLS(4),3042,CB_SDG_P0,TUMB,219,-1,0,1,Cockpit.Yak52.cb_sdg", "GMK1A(20),3003,SDG_MODE_P0,TUMB,259,1,-1,0,Cockpit.Yak52.sdg_mode", "GMK1A(20),3003,SDG_MODE_P0,TUMB,259,-1,-1,0,Cockpit.Yak52.sdg_mode", "ARK15M(21),3001,RDF_VOLUME_P0,LEV,247,0,0,1,Cockpit.Yak52.rdf_volume", "AFT_UGR4UK(23),3001,HSI_KNOB_P1,LEV,279,0,0,1,Cockpit.Yak52.hsi", "ELECTRICAL_CONTROLS(4),3036,CB_UMFORMER1_P0,TUMB,222,1,0,1,Cockpit.Yak52.cb_pt200", "ELECTRICAL_CONTROLS(4),3036,CB_UMFORMER1_P0,TUMB,222,-1,0,1,Cockpit.Yak52.cb_pt200", "ENGINE_CONTROLS(3),3005,MAGNETO_P0_0,TUMB,10,0,0,0,Cockpit.Yak52.magnetos_0", "TERTIARY_CONTROLS(6),3028,CLK_PINION1_P1,LEV,132,0.04,0,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3027,CLK_PINION1_P1,BTN,131,1,0.5,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3027,CLK_PINION1_P1,TUMB,131,0.5,0,0.5,Cockpit.Yak52.clock", "ENGINE_CONTROLS(3),3044,PRIMER_P0_P,TUMB,76,0,0,0,Cockpit.Yak52.primer_cylinders", "INTERCOM(28),3017,INTERCOM_P1_S1,TUMB,86,1,0,1,Cockpit.Generic.intercom_stby_distributive_switch", "INTERCOM(28),3017,INTERCOM_P1_S1,TUMB,86,-1,0,1,Cockpit.Generic.intercom_stby_distributive_switch", "GMK1A(20),3001,SDG_HEMI_P0,TUMB,258,1,0,1,Cockpit.Yak52.sdg_hemisphere", "GMK1A(20),3001,SDG_HEMI_P0,TUMB,258,-1,0,1,Cockpit.Yak52.sdg_hemisphere", "ENGINE_CONTROLS(3),3008,MAGNETO_P1_2,TUMB,11,0,0,0,Cockpit.Yak52.magnetos_2", "ELECTRICAL_CONTROLS(4),3057,CB_TPANEL_P1_1,TUMB,101,1,0,1,Cockpit.Yak52.cb_trainer_speedo", "ELECTRICAL_CONTROLS(4),3057,CB_TPANEL_P1_1,TUMB,101,-1,0,1,Cockpit.Yak52.cb_trainer_speedo", "ELECTRICAL_CONTROLS(4),3054,CB_TPANEL_P1_2,TUMB,102,1,0,1,Cockpit.Yak52.cb_trainer_ah", "ELECTRICAL_CONTROLS(4),3054,CB_TPANEL_P1_2,TUMB,102,-1,0,1,Cockpit.Yak52.cb_trainer_ah", "CONTROLS(2),3064,HATCH_B_P0,BTN,291,1,0,1,Cockpit.Yak52.canopy_operate", "CONTROLS(2),3064,HATCH_B_P0,BTN,291,1,0,1,Cockpit.Yak52.canopy_operate",
-        "ELECTRICAL_CONTROLS(4),3027,CB_INTERCOM_P0,TUMB,225,1,0,1,Cockpit.Yak52.cb_intercom", "ELECTRICAL_CONTROLS(4),3027,CB_INTERCOM_P0,TUMB,225,-1,0,1,Cockpit.Yak52.cb_intercom", "ENGINE_CONTROLS(3),3044,PRIMER_P0_S,TUMB,76,0,0,0,Cockpit.Yak52.primer_trunk", "TERTIARY_CONTROLS(6),3004,ALT_MMHG_P0,LEV,114,1,0,1,Cockpit.Yak52.altimeter", "ELECTRICAL_CONTROLS(4),3060,CB_TPANEL_P1_3,TUMB,103,1,0,1,Cockpit.Yak52.cb_trainer_statics", "ELECTRICAL_CONTROLS(4),3060,CB_TPANEL_P1_3,TUMB,103,-1,0,1,Cockpit.Yak52.cb_trainer_statics", "SSKUA1(17),3001,pnt041,BTN,41,1,0,1,Cockpit.Yak52.stall_warning_test", "SSKUA1(17),3001,pnt041,BTN,41,1,0,1,Cockpit.Yak52.stall_warning_test", "ARK15M(21),3004,RDF_MODE_3_P0,BTN,248,1,0,1,Cockpit.Yak52.rdf_loop", "ARK15M(21),3004,RDF_MODE_3_P0,BTN,248,1,0,1,Cockpit.Yak52.rdf_loop", "ELECTRICAL_CONTROLS(4),3051,CB_TPANEL_P1_0,TUMB,100,1,0,1,Cockpit.Yak52.cb_trainer_master", "ELECTRICAL_CONTROLS(4),3051,CB_TPANEL_P1_0,TUMB,100,-1,0,1,Cockpit.Yak52.cb_trainer_master", "VHF_RADIO(27),3051,RADIO_TX_P1,BTN,196,1,0,1,Radio Button", "VHF_RADIO(27),3051,RADIO_TX_P1,BTN,196,1,0,1,Radio Button", "ENGINE_CONTROLS(3),3039,STARTER_P0,BTN,14,1,0,1,Cockpit.Yak52.starter", "ENGINE_CONTROLS(3),3039,STARTER_P0,BTN,14,1,0,1,Cockpit.Yak52.starter", "TERTIARY_CONTROLS(6),3044,EMER_VALVE_P0,LEV,239,0,0,1,Cockpit.Yak52.emergency_valve", "VHF_RADIO(27),3052,INTERCOM_TX_P1,BTN,197,1,0,1,INT Button", "VHF_RADIO(27),3052,INTERCOM_TX_P1,BTN,197,1,0,1,INT Button", "ELECTRICAL_CONTROLS(4),3049,L_CTRL_P0,BTN,8,1,0,1,Cockpit.Yak52.lamps_test", "ELECTRICAL_CONTROLS(4),3049,L_CTRL_P0,BTN,8,1,0,1,Cockpit.Yak52.lamps_test", "ENGINE_CONTROLS(3),3060,MIXHEAT_P0,TUMB,238,1,0,1,Cockpit.Yak52.mix_heat", "ENGINE_CONTROLS(3),3060,MIXHEAT_P0,TUMB,238,-1,0,1,Cockpit.Yak52.mix_heat", "ENGINE_CONTROLS(3),3045,PRIMER_P0,LEV,79,1,-1,1,Cockpit.Yak52.primer", "ENGINE_CONTROLS(3),3046,PRIMER_P0,BTN,78,1,0,1,Cockpit.Yak52.primer", "ELECTRICAL_CONTROLS(4),3004,CB_GENERATOR_P0,TUMB,97,1,0,1,Cockpit.Yak52.cb_generator", "ELECTRICAL_CONTROLS(4),3004,CB_GENERATOR_P0,TUMB,97,-1,0,1,Cockpit.Yak52.cb_generator", "ENGINE_CONTROLS(3),3008,MAGNETO_P1_0,TUMB,11,0,0,0,Cockpit.Yak52.magnetos_0", "ARK15M(21),3069,RDF_MODE_12_P1,TUMB,253,1,0,1,Cockpit.Yak52.rdf_mode", "ARK15M(21),3069,RDF_MODE_12_P1,TUMB,253,-1,0,1,Cockpit.Yak52.rdf_mode", "CONTROLS(2),3002,UC_LOCK_P0,TUMB,33,1,0,1,Cockpit.Yak52.uc_lock", "CONTROLS(2),3002,UC_LOCK_P0,TUMB,33,-1,0,1,Cockpit.Yak52.uc_lock", "CONTROLS(2),3032,TRIM_WHEEL_P0,LEV,228,0,-1,1,Cockpit.Yak52.trim_elevator", "CONTROLS(2),3005,UC_LOCK_P1,TUMB,35,1,0,1,Cockpit.Yak52.uc_lock", "CONTROLS(2),3005,UC_LOCK_P1,TUMB,35,-1,0,1,Cockpit.Yak52.uc_lock", "INTERCOM(28),3011,INTERCOM_P1_RH1,LEV,84,0,0,1,Cockpit.Generic.intercom_volume_knob", "ENGINE_CONTROLS(3),3048,FUEL_COCK_P1,BTN,287,1,0,1,Cockpit.Yak52.fuel_cock", "ENGINE_CONTROLS(3),3048,FUEL_COCK_P1,BTN,287,1,0,1,Cockpit.Yak52.fuel_cock", "CONTROLS(2),3019,BRAKES_P0,LEV,283,0,0,1,Cockpit.Yak52.wheel_brakes", "CONTROLS(2),3035,TRIM_WHEEL_P1,LEV,229,0,-1,1,Cockpit.Yak52.trim_elevator", "TERTIARY_CONTROLS(6),3047,EMER_VALVE_P1,LEV,241,0,0,1,Cockpit.Yak52.emergency_valve", "ARK15M(21),3072,RDF_CHANNEL_P1,TUMB,251,0.1,0,0.4,Cockpit.Yak52.rdf_channel", "ARK15M(21),3072,RDF_CHANNEL_P1,TUMB,251,-0.1,0,0.4,Cockpit.Yak52.rdf_channel", "TERTIARY_CONTROLS(6),3026,CLK_PINION2_P0,LEV,122,1,0,1,Cockpit.Yak52.clock", "TERTIARY_CONTROLS(6),3025,CLK_PINION2_P0,BTN,121,1,0,1,Cockpit.Yak52.clock", "INTERCOM(28),3014,INTERCOM_P1_RH2,LEV,85,0,0,1,Cockpit.Generic.radio_volume_knob", "ELECTRICAL_CONTROLS(4),3021,CB_STALL_P0,TUMB,234,1,0,1,Cockpit.Yak52.cb_stall_warning", "ELECTRICAL_CONTROLS(4),3021,CB_STALL_P0,TUMB,234,-1,0,1,Cockpit.Yak52.cb_stall_warning", "ELECTRICAL_CONTROLS(4),3024,CB_RADIO_P0,TUMB,226,1,0,1,Cockpit.Yak52.cb_radio", "ELECTRICAL_CONTROLS(4),3024,CB_RADIO_P0,TUMB,226,-1,0,1,Cockpit.Yak52.cb_radio", "ENGINE_CONTROLS(3),3047,FUEL_COCK_P0,BTN,286,1,0,1,Cockpit.Yak52.fuel_cock", "ENGINE_CONTROLS(3),3047,FUEL_COCK_P0,BTN,286,1,0,1,Cockpit.Yak52.fuel_cock", "CONTROLS(2),3065,HATCH_B_P1,BTN,292,1,0,1,Cockpit.Yak52.canopy_operate", "CONTROLS(2),3065,HATCH_B_P1,BTN,292,1,0,1,Cockpit.Yak52.canopy_operate", "ELECTRICAL_CONTROLS(4),3010,CB_PITOT_P0,TUMB,99,1,0,1,Cockpit.Yak52.cb_pitot", "ELECTRICAL_CONTROLS(4),3010,CB_PITOT_P0,TUMB,99,-1,0,1,Cockpit.Yak52.cb_pitot", "CONTROLS(2),3013,FLAPS_P1,TUMB,218,-0.5,0,1,Cockpit.Yak52.flaps", "CONTROLS(2),3013,FLAPS_P1,TUMB,218,0.5,0,1,Cockpit.Yak52.flaps", "VHF_RADIO(27),3008,RADIO_P0_LRKNOB,TUMB,89,0.1,0,1,Cockpit.Yak52.radio_tune_khz", "VHF_RADIO(27),3008,RADIO_P0_LRKNOB,TUMB,89,-0.1,0,1,Cockpit.Yak52.radio_tune_khz", "ARK15M(21),3051,RDF_VOLUME_P1,LEV,254,0,0,1,Cockpit.Yak52.rdf_volume", "ARK15M(21),3010,RDF_CSWITCH_P0,BTN,249,1,0,1,Cockpit.Yak52.rdf_control", "ARK15M(21),3010,RDF_CSWITCH_P0,BTN,249,1,0,1,Cockpit.Yak52.rdf_control", "ARK15M(21),3054,RDF_MODE_3_P1,BTN,255,1,0,1,Cockpit.Yak52.rdf_loop", "ARK15M(21),3054,RDF_MODE_3_P1,BTN,255,1,0,1,Cockpit.Yak52.rdf_loop", "ARK15M(21),3060,RDF_CSWITCH_P1,BTN,256,1,0,1,Cockpit.Yak52.rdf_control", "ARK15M(21),3060,RDF_CSWITCH_P1,BTN,256,1,0,1,Cockpit.Yak52.rdf_control", "ENGINE_CONTROLS(3),3008,MAGNETO_P1_3,TUMB,11,0,0,0,Cockpit.Yak52.magnetos_3", "ARK15M(21),3075,CB_ADF_P1,TUMB,105,1,0,1,Cockpit.Yak52.adf_marker", "ARK15M(21),3075,CB_ADF_P1,TUMB,105,-1,0,1,Cockpit.Yak52.adf_marker", "CONTROLS(2),3028,BRAKES_L_P0,BTN,4,1,0,1,Cockpit.Yak52.wheel_brakes_lock", "CONTROLS(2),3028,BRAKES_L_P0,BTN,4,1,0,1,Cockpit.Yak52.wheel_brakes_lock", "CONTROLS(2),3054,HATCH_L_P1,TUMB,271,1,0,1,Cockpit.Yak52.canopy_operate", "CONTROLS(2),3054,HATCH_L_P1,TUMB,271,-1,0,1,Cockpit.Yak52.canopy_operate", "VHF_RADIO(27),3023,INTERCOM_TX_P0,BTN,194,1,0,1,INT Button", "VHF_RADIO(27),3023,INTERCOM_TX_P0,BTN,194,1,0,1,INT Button", "ENGINE_CONTROLS(3),3036,STARTER_COVER_P1,TUMB,15,1,0,1,Cockpit.Yak52.starter_cover", "ENGINE_CONTROLS(3),3036,STARTER_COVER_P1,TUMB,15,-1,0,1,Cockpit.Yak52.starter_cover", "ELECTRICAL_CONTROLS(4),3033,CB_UC_P0,TUMB,223,1,0,1,Cockpit.Yak52.cb_uc_indication", "ELECTRICAL_CONTROLS(4),3033,CB_UC_P0,TUMB,223,-1,0,1,Cockpit.Yak52.cb_uc_indication"]
-}
\ No newline at end of file
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"A-10C","rows":[10,1,9,593,2,100,4,1,0,105,10,1,9,593,2,100,0,1,0,105,10,1,9,594,2,100,4,1,0,105,10,1,9,594,2,100,0,1,0,105,10,1,9,595,2,100,4,1,0,105,10,1,9,595,2,100,0,1,0,105,74,70,9,592,2,322,12,1,11,831,74,70,9,592,2,322,6,1,11,831,74,70,13,610,3,323,0,1,0,826,74,70,15,610,3,323,4,4,1,826,74,70,16,587,2,324,12,1,61,452,74,70,16,587,2,324,6,1,61,452,74,70,19,782,2,325,4,1,0,453,74,70,19,782,2,325,0,1,0,453,74,70,20,783,2,326,4,1,0,477,74,70,20,783,2,326,0,1,0,477,410,141,9,585,3,329,0,1,0,478,410,141,13,585,3,329,4,4,1,478,1089,1080,9,1090,3,1088,0,1,0,1425,1091,1053,9,1326,14,70,0,112,67,1092,51,50,9,602,2,303,12,1,11,549,51,50,9,602,2,303,6,1,11,549,51,50,13,598,2,304,12,1,11,509,51,50,13,598,2,304,6,1,11,509,51,50,15,601,2,305,12,1,11,534,51,50,15,601,2,305,6,1,11,534,51,50,16,604,2,306,4,1,0,819,51,50,16,604,2,306,0,1,0,819,51,50,19,596,2,307,12,1,11,431,51,50,19,596,2,307,6,1,11,431,51,50,20,605,2,308,4,1,0,469,51,50,20,605,2,308,0,1,0,469,51,50,25,603,2,309,4,1,0,557,51,50,25,603,2,309,0,1,0,557,51,50,34,597,2,310,4,1,0,827,51,50,34,597,2,310,0,1,0,827,51,50,37,600,2,311,4,1,0,530,51,50,37,600,2,311,0,1,0,530,51,50,42,599,2,312,12,1,11,828,51,50,42,599,2,312,6,1,11,828,1095,893,9,1329,14,854,0,130,131,144,416,142,9,756,2,198,4,1,0,792,416,142,9,756,2,198,0,1,0,792,23,21,10,697,2,10,4,1,0,787,23,21,9,755,2,199,4,4,0,437,23,21,9,755,2,199,0,4,0,437,23,21,13,1389,3,849,0,1,0,1102,23,21,15,1409,3,859,0,1,0,1456,23,21,19,1410,3,860,0,1,0,1457,23,21,25,1406,3,861,0,1,0,1423,23,21,37,1407,3,862,0,1,0,1424,23,21,47,769,3,232,4,4,1,554,23,21,47,769,3,232,0,1,0,554,23,21,53,1408,3,863,0,1,0,1435,23,21,43,770,14,233,1,4,0,835,23,21,44,770,3,233,1,1,1,835,23,21,48,698,2,227,4,1,0,809,23,21,48,698,2,227,0,1,0,809,23,21,56,697,2,858,0,1,0,787,23,21,62,1368,3,113,6,1,6,1452,23,21,66,1370,3,113,11,1,11,1454,23,21,73,1369,3,113,61,1,61,1453,23,21,76,1367,3,113,64,1,64,1451,23,21,77,693,2,228,4,4,0,429,23,21,77,693,2,228,0,4,0,429,23,21,80,694,2,229,4,4,0,492,23,21,80,694,2,229,0,4,0,492,23,21,93,695,2,230,4,1,0,502,23,21,93,695,2,230,0,1,0,502,23,21,81,696,2,231,4,1,0,547,23,21,81,696,2,231,0,1,0,547,23,21,109,1390,3,848,0,1,0,1124,23,21,89,1365,3,1074,0,1,0,1099,23,21,82,699,2,395,1,1,0,493,23,21,82,699,2,395,0,1,0,493,23,21,83,611,2,235,4,1,0,514,23,21,83,611,2,235,0,1,0,514,8,7,9,1180,3,996,0,1,0,1154,8,7,13,1181,3,997,0,1,0,1156,8,7,15,1182,3,998,0,1,0,1158,8,7,16,1183,3,999,0,1,0,1160,8,7,19,1184,3,1000,0,1,0,1155,8,7,20,1185,3,1001,0,1,0,1157,8,7,25,1186,3,1002,0,1,0,1159,8,7,34,1187,3,1003,0,1,0,1161,8,7,37,1225,3,1004,0,1,0,1119,8,7,42,1211,3,1005,0,1,0,1117,8,7,47,1232,3,1006,0,1,0,1121,8,7,53,1213,3,1007,0,1,0,1118,8,7,43,1200,3,1008,0,1,0,1115,8,7,44,1219,3,1009,0,1,0,1145,8,7,48,1170,3,1010,0,1,0,10,8,7,56,1171,3,1011,0,1,0,10,8,7,62,1172,3,1012,0,1,0,10,8,7,66,1173,3,1013,0,1,0,10,8,7,73,1174,3,1014,0,1,0,10,8,7,76,1175,3,1015,0,1,0,10,8,7,77,1176,3,1016,0,1,0,10,8,7,80,1177,3,1017,0,1,0,10,8,7,93,1178,3,1018,0,1,0,10,8,7,81,1169,3,1019,0,1,0,10,8,7,94,1218,3,1020,0,1,0,10,8,7,109,1223,3,1021,0,1,0,10,8,7,95,1179,3,1022,0,1,0,10,8,7,89,1188,3,1023,0,1,0,10,8,7,116,1192,3,1024,0,1,0,10,8,7,82,1194,3,1025,0,1,0,10,8,7,83,1197,3,1026,0,1,0,10,8,7,117,1198,3,1027,0,1,0,10,8,7,96,1201,3,1028,0,1,0,10,8,7,97,1202,3,1029,0,1,0,10,8,7,118,1203,3,1030,0,1,0,10,8,7,90,1204,3,1031,0,1,0,10,8,7,132,1205,3,1032,0,1,0,10,8,7,133,1206,3,1033,0,1,0,10,8,7,134,1207,3,1034,0,1,0,10,8,7,135,1210,3,1035,0,1,0,10,8,7,136,1212,3,1036,0,1,0,10,8,7,137,1214,3,1037,0,1,0,10,8,7,138,1220,3,1038,0,1,0,10,8,7,139,1221,3,1039,0,1,0,10,8,7,904,1222,3,1040,0,1,0,10,8,7,905,1226,3,1041,0,1,0,10,8,7,906,1227,3,1042,0,1,0,10,8,7,907,1228,3,1043,0,1,0,10,8,7,908,1231,3,1044,0,1,0,10,8,7,910,1233,3,1045,0,1,0,10,8,7,911,1234,3,1046,0,1,0,10,8,7,912,1235,3,1047,0,1,0,10,8,7,913,1229,3,1048,0,1,0,559,8,7,914,1230,3,1049,0,1,0,559,8,7,915,1209,3,1050,0,1,0,462,8,7,916,1189,3,1051,0,1,0,1131,8,7,917,1224,3,1052,0,1,0,1151,8,7,918,1193,3,1054,0,1,0,1130,8,7,919,1199,3,1055,0,1,0,1134,8,7,921,1195,3,318,4,4,1,475,8,7,922,1196,3,318,0,1,0,475,8,7,923,1216,3,319,0,1,0,1421,8,7,924,1215,3,319,4,4,1,1420,8,7,925,1190,3,320,4,4,1,802,8,7,926,1191,3,320,0,1,0,802,8,7,927,1217,3,321,0,1,0,527,8,7,928,1208,3,321,4,4,1,527,92,91,9,1283,3,970,0,1,0,1431,92,91,13,1284,3,971,0,1,0,1112,92,91,15,1285,3,974,0,1,0,1450,92,91,16,1286,3,975,0,1,0,1433,92,91,19,1287,3,976,0,1,0,1120,92,91,20,1325,14,972,0,130,131,144,92,91,25,1324,14,973,0,1,0,1096,55,54,9,1236,3,963,0,1,0,122,55,54,13,1237,3,964,0,1,0,122,55,54,15,1238,3,965,0,1,0,122,55,54,16,1239,3,966,0,1,0,122,55,54,19,1241,3,297,0,1,0,1114,55,54,20,1240,3,297,4,4,1,1113,55,54,25,1242,3,967,0,1,0,1429,55,54,34,1352,2,968,0,1,0,1153,55,54,37,1323,14,969,0,130,131,144,55,54,42,608,2,298,6,1,6,551,55,54,47,608,3,298,11,6,11,551,55,54,53,607,2,299,6,1,6,491,55,54,43,607,3,299,11,6,11,491,55,54,44,609,2,300,6,1,6,793,55,54,48,609,3,300,11,6,11,793,55,54,56,606,2,301,6,1,6,460,55,54,62,606,3,301,11,6,11,460,55,54,66,586,2,302,12,1,64,550,55,54,66,586,2,302,6,1,64,550,40,38,9,588,2,389,4,1,0,533,40,38,9,588,2,389,0,1,0,533,40,38,13,719,2,396,112,1,0,501,40,38,13,719,2,396,67,1,0,501,40,38,15,1366,3,1072,0,1,0,1123,40,38,16,771,3,394,4,4,1,804,40,38,19,771,3,394,0,1,0,804,40,38,20,651,2,388,0,67,0,457,40,38,25,651,3,388,1,1,67,457,40,38,34,644,2,390,4,1,0,438,40,38,34,644,2,390,0,1,0,438,40,38,37,648,2,391,4,1,0,439,40,38,37,648,2,391,0,1,0,439,40,38,42,645,2,392,4,1,0,803,40,38,42,645,2,392,0,1,0,803,40,38,47,443,2,407,4,1,0,497,40,38,47,443,2,407,0,1,0,497,40,38,53,1105,3,1083,0,1,0,1132,40,38,43,451,2,397,4,1,0,528,40,38,43,451,2,397,0,1,0,528,40,38,44,691,2,405,4,1,0,458,40,38,44,691,2,405,0,1,0,458,40,38,48,690,2,406,4,1,0,456,40,38,48,690,2,406,0,1,0,456,466,210,9,1331,3,1076,0,1,0,1449,466,210,13,1330,3,63,0,1,0,1439,121,119,9,467,2,408,12,1,11,506,121,119,9,467,2,408,6,1,11,506,121,119,13,468,2,409,12,1,11,832,121,119,13,468,2,409,6,1,11,832,5,0,9,711,2,262,4,1,0,419,5,0,9,711,2,262,0,1,0,419,5,0,13,714,3,263,4,4,1,529,5,0,13,714,2,263,0,1,0,529,5,0,16,709,2,265,4,1,0,535,5,0,16,709,2,265,0,1,0,535,5,0,19,710,2,266,4,1,0,795,5,0,19,710,2,266,0,1,0,795,5,0,20,712,2,267,4,1,0,444,5,0,20,712,2,267,0,1,0,444,5,0,25,652,2,345,4,1,0,412,5,0,25,652,2,345,0,1,0,412,5,0,34,653,2,346,4,1,0,413,5,0,34,653,2,346,0,1,0,413,5,0,37,687,2,347,4,1,0,799,5,0,37,687,2,347,0,1,0,799,5,0,42,668,2,348,4,1,0,479,5,0,42,668,2,348,0,1,0,479,5,0,47,669,2,349,4,1,0,480,5,0,47,669,2,349,0,1,0,480,5,0,53,654,2,350,4,1,0,414,5,0,53,654,2,350,0,1,0,414,5,0,43,655,2,351,4,1,0,415,5,0,43,655,2,351,0,1,0,415,5,0,44,670,2,352,4,1,0,481,5,0,44,670,2,352,0,1,0,481,5,0,48,673,2,353,4,1,0,484,5,0,48,673,2,353,0,1,0,484,5,0,56,684,2,354,4,1,0,531,5,0,56,684,2,354,0,1,0,531,5,0,62,674,2,355,4,1,0,487,5,0,62,674,2,355,0,1,0,487,5,0,66,675,2,356,4,1,0,488,5,0,66,675,2,356,0,1,0,488,5,0,73,658,2,357,4,1,0,417,5,0,73,658,2,357,0,1,0,417,5,0,76,656,2,358,4,1,0,485,5,0,76,656,2,358,0,1,0,485,5,0,77,657,2,359,4,1,0,486,5,0,77,657,2,359,0,1,0,486,5,0,80,671,2,360,4,1,0,482,5,0,80,671,2,360,0,1,0,482,5,0,93,672,2,361,4,1,0,483,5,0,93,672,2,361,0,1,0,483,5,0,81,667,2,362,4,1,0,465,5,0,81,667,2,362,0,1,0,465,5,0,94,664,2,363,4,1,0,441,5,0,94,664,2,363,0,1,0,441,5,0,109,665,2,364,4,1,0,442,5,0,109,665,2,364,0,1,0,442,5,0,95,676,2,365,4,1,0,489,5,0,95,676,2,365,0,1,0,489,5,0,89,677,2,366,4,1,0,490,5,0,89,677,2,366,0,1,0,490,5,0,116,688,2,367,4,1,0,801,5,0,116,688,2,367,0,1,0,801,5,0,82,685,2,368,4,1,0,539,5,0,82,685,2,368,0,1,0,539,5,0,83,686,2,369,4,1,0,584,5,0,83,686,2,369,0,1,0,584,5,0,117,680,2,370,4,1,0,17,5,0,117,680,2,370,0,1,0,17,5,0,96,689,2,371,4,1,0,829,5,0,96,689,2,371,0,1,0,829,5,0,97,681,2,372,4,1,0,519,5,0,97,681,2,372,0,1,0,519,5,0,118,678,2,373,4,1,0,507,5,0,118,678,2,373,0,1,0,507,5,0,90,679,2,374,4,1,0,508,5,0,90,679,2,374,0,1,0,508,5,0,132,666,2,375,4,1,0,454,5,0,132,666,2,375,0,1,0,454,5,0,133,659,2,376,4,1,0,421,5,0,133,659,2,376,0,1,0,421,5,0,134,660,2,377,4,1,0,422,5,0,134,660,2,377,0,1,0,422,5,0,135,661,2,378,4,1,0,423,5,0,135,661,2,378,0,1,0,423,5,0,136,663,2,379,4,1,0,440,5,0,136,663,2,379,0,1,0,440,5,0,137,683,2,380,4,1,0,521,5,0,137,683,2,380,0,1,0,521,5,0,138,682,2,381,4,1,0,520,5,0,138,682,2,381,0,1,0,520,5,0,139,662,2,382,4,1,0,424,5,0,139,662,2,382,0,1,0,424,69,68,9,731,2,193,4,1,0,537,69,68,9,731,2,193,0,1,0,537,69,68,13,732,2,194,4,1,0,797,69,68,13,732,2,194,0,1,0,797,69,68,15,700,2,195,4,4,1,495,69,68,16,701,2,196,4,4,1,496,69,68,19,643,2,197,4,1,0,420,69,68,19,643,2,197,0,1,0,420,69,68,20,1417,14,847,0,1,0,1448,69,68,25,700,3,195,0,1,0,495,69,68,34,701,3,196,0,1,0,496,69,68,37,1416,3,1073,0,1,0,1442,46,45,9,1375,3,887,0,1,0,1167,46,45,13,707,2,275,4,1,0,833,46,45,13,707,2,275,0,1,0,833,46,45,15,1373,14,888,1,1,0,1107,46,45,16,708,2,276,4,4,0,834,46,45,16,708,2,276,0,4,0,834,46,45,19,705,2,277,4,1,0,788,46,45,19,705,2,277,0,1,0,788,46,45,20,702,2,278,4,1,0,445,46,45,20,702,2,278,0,1,0,445,46,45,25,706,2,279,4,4,0,820,46,45,25,706,2,279,0,4,0,820,46,45,34,704,2,280,4,1,0,546,46,45,34,704,2,280,0,1,0,546,46,45,37,1374,14,889,1,1,0,1142,46,45,42,703,2,115,12,1,6,430,46,45,42,703,2,115,6,1,6,430,46,45,47,1371,3,115,11,1,11,1097,46,45,53,1372,3,115,61,1,61,1098,46,45,43,1376,14,890,1,1,0,1444,46,45,44,1094,3,1082,0,1,0,1100,86,84,9,717,2,179,4,1,0,536,86,84,9,717,2,179,0,1,0,536,86,84,13,715,2,180,4,1,0,418,86,84,13,715,2,180,0,1,0,418,86,84,15,718,2,181,4,1,0,796,86,84,15,718,2,181,0,1,0,796,86,84,16,716,2,182,4,4,0,500,86,84,16,716,2,182,0,4,0,500,1133,962,9,1168,14,141,838,1,0,1434,36,35,9,727,2,183,4,1,0,499,36,35,9,727,2,183,0,1,0,499,36,35,13,726,2,184,4,1,0,498,36,35,13,726,2,184,0,1,0,498,36,35,15,730,2,185,4,1,0,818,36,35,15,730,2,185,0,1,0,818,36,35,16,725,2,186,4,1,0,463,36,35,16,725,2,186,0,1,0,463,36,35,19,723,2,187,4,1,0,446,36,35,19,723,2,187,0,1,0,446,36,35,20,724,2,188,4,1,0,449,36,35,20,724,2,188,0,1,0,449,36,35,25,721,2,189,4,1,0,447,36,35,25,721,2,189,0,1,0,447,36,35,34,722,2,190,4,1,0,448,36,35,34,722,2,190,0,1,0,448,36,35,37,729,2,191,4,1,0,806,36,35,37,729,2,191,0,1,0,806,36,35,42,1383,3,840,0,1,0,1163,36,35,53,1381,2,842,0,1,0,1137,36,35,43,1382,2,843,0,1,0,1138,36,35,44,1379,2,844,0,1,0,1135,36,35,48,1380,2,845,0,1,0,1136,36,35,56,728,2,192,4,1,0,428,36,35,56,728,2,192,0,1,0,428,36,35,62,720,2,343,12,1,64,503,36,35,62,720,2,343,6,1,64,503,36,35,66,1378,3,1071,0,1,0,1144,75,71,9,1386,3,1079,0,1,0,1147,75,71,13,736,2,272,4,1,0,513,75,71,13,736,2,272,0,1,0,513,75,71,15,734,2,274,4,1,0,511,75,71,15,734,2,274,0,1,0,511,75,71,16,733,2,273,4,4,0,510,75,71,16,733,2,273,0,4,0,510,75,71,19,1385,14,886,1,1,0,1148,75,71,20,735,3,884,0,1,0,512,75,71,25,735,14,885,67,1,0,512,516,140,9,1328,14,140,0,1,0,1149,516,140,13,1327,14,71,0,1,0,1111,17,18,9,740,2,246,12,1,72,540,17,18,9,740,2,246,6,1,72,540,17,18,13,741,2,247,12,1,61,541,17,18,13,741,2,247,6,1,61,541,17,18,15,742,2,248,12,1,72,542,17,18,15,742,2,248,6,1,72,542,17,18,16,743,2,249,12,1,72,543,17,18,16,743,2,249,6,1,72,543,17,18,19,744,2,250,12,1,72,544,17,18,19,744,2,250,6,1,72,544,17,18,20,745,2,251,12,1,72,545,17,18,20,745,2,251,6,1,72,545,17,18,25,737,3,236,4,4,1,459,17,18,25,737,3,236,0,1,0,459,17,18,34,738,2,237,12,1,64,548,17,18,34,738,2,237,6,1,64,548,17,18,37,747,2,238,4,4,0,436,17,18,37,747,2,238,0,4,0,436,17,18,42,749,3,239,0,1,0,821,17,18,42,749,2,239,1,4,1,821,17,18,47,750,3,240,0,1,0,822,17,18,47,750,2,240,1,4,1,822,17,18,53,751,3,241,0,1,0,823,17,18,53,751,2,241,1,4,1,823,17,18,43,752,3,242,0,1,0,824,17,18,43,752,2,242,1,4,1,824,17,18,44,748,3,243,0,1,0,791,17,18,44,748,2,243,1,4,1,791,17,18,48,739,3,244,0,1,0,522,17,18,48,739,2,244,1,4,1,522,17,18,56,746,2,245,4,1,0,517,17,18,56,746,2,245,0,1,0,517,17,18,62,649,3,1084,0,1,0,794,17,18,66,650,3,1085,0,1,0,825,17,18,73,641,2,383,112,1,0,518,17,18,73,641,2,383,67,1,0,518,17,18,76,649,14,1086,67,1,0,794,17,18,77,650,14,1087,67,1,0,825,110,108,9,1377,3,839,0,1,0,1127,110,108,13,646,2,386,4,1,0,434,110,108,13,646,2,386,0,1,0,434,110,108,15,647,2,387,4,1,0,435,110,108,15,647,2,387,0,1,0,435,102,99,9,152,2,268,4,1,0,148,102,99,9,152,2,268,0,1,0,148,102,99,13,152,14,878,6,1,61,148,102,99,15,153,14,879,6,1,88,149,102,99,16,153,2,269,6,1,0,149,102,99,19,153,2,269,12,1,0,149,32,31,9,158,2,252,4,1,0,151,32,31,9,158,2,252,0,1,0,151,32,31,13,158,14,868,0,1,0,151,32,31,15,155,2,253,4,1,0,146,32,31,15,155,2,253,0,1,0,146,32,31,16,155,14,869,0,1,0,146,32,31,19,161,2,254,4,1,0,165,32,31,19,161,2,254,0,1,0,165,32,31,20,161,14,870,0,1,0,165,32,31,25,160,2,255,4,1,0,164,32,31,25,160,2,255,0,1,0,164,32,31,34,160,14,871,0,1,0,164,32,31,37,154,2,256,4,1,0,143,32,31,37,154,2,256,0,1,0,143,32,31,42,154,14,872,0,1,0,143,32,31,47,156,2,257,4,1,0,147,32,31,47,156,2,257,0,1,0,147,32,31,53,156,14,873,0,1,0,147,32,31,43,157,2,258,4,1,0,150,32,31,43,157,2,258,0,1,0,150,32,31,44,157,14,874,0,1,0,150,32,31,48,159,2,259,4,1,0,163,32,31,48,159,2,259,0,1,0,163,32,31,56,159,14,875,0,1,0,163,32,31,62,753,2,260,4,1,0,515,32,31,62,753,2,260,0,1,0,515,32,31,66,1388,14,876,0,1,0,1152,32,31,73,754,2,261,12,1,64,805,32,31,73,754,2,261,6,1,64,805,32,31,76,1387,3,877,0,1,0,1106,65,63,9,785,2,398,4,1,0,836,65,63,9,785,2,398,0,1,0,836,65,63,13,786,2,399,4,1,0,837,65,63,13,786,2,399,0,1,0,837,65,63,15,692,2,400,4,1,0,474,65,63,15,692,2,400,0,1,0,474,65,63,16,764,2,401,12,1,11,450,65,63,16,764,2,401,6,1,11,450,65,63,19,762,2,402,12,1,67,504,65,63,19,762,2,402,6,1,67,504,65,63,20,763,2,403,12,1,11,553,65,63,20,763,2,403,6,1,11,553,65,63,25,784,2,404,4,1,0,790,65,63,25,784,2,404,0,1,0,790,41,39,9,1395,14,894,0,1,0,1128,41,39,13,1396,14,895,0,1,0,1140,41,39,15,1393,14,896,0,1,0,1103,41,39,16,757,2,284,4,1,0,425,41,39,16,757,2,284,0,1,0,425,41,39,19,1397,14,897,0,1,0,1141,41,39,20,1394,14,898,0,1,0,1110,41,39,25,713,2,264,4,1,0,494,41,39,25,713,2,264,0,1,0,494,41,39,34,759,2,281,4,4,0,789,41,39,34,759,2,281,0,4,0,789,41,39,37,1398,14,891,0,1,0,1143,41,39,42,1392,3,892,0,1,0,1101,41,39,53,758,2,282,4,1,0,560,41,39,53,758,2,282,0,1,0,560,41,39,43,760,2,283,4,1,0,807,41,39,43,760,2,283,0,1,0,807,41,39,44,761,2,344,12,1,11,532,41,39,44,761,2,344,6,1,11,532,41,39,48,1354,14,864,1,1,0,1426,41,39,56,1356,14,865,1,1,0,1455,41,39,62,612,2,234,12,1,11,558,41,39,62,612,2,234,6,1,11,558,41,39,66,1384,14,841,1,1,0,1427,28,26,9,1243,3,899,0,1,0,561,28,26,13,1244,3,900,0,1,0,572,28,26,15,1245,3,901,0,1,0,574,28,26,16,1246,3,902,0,1,0,575,28,26,19,1247,3,903,0,1,0,576,28,26,20,1248,3,909,0,1,0,577,28,26,25,1249,3,920,0,1,0,578,28,26,34,1250,3,929,0,1,0,579,28,26,37,1251,3,930,0,1,0,580,28,26,42,1252,3,931,0,1,0,562,28,26,47,1253,3,932,0,1,0,563,28,26,53,1254,3,933,0,1,0,564,28,26,43,1255,3,934,0,1,0,565,28,26,44,1256,3,935,0,1,0,566,28,26,48,1257,3,936,0,1,0,567,28,26,56,1258,3,937,0,1,0,568,28,26,62,1259,3,938,0,1,0,569,28,26,66,1260,3,939,0,1,0,570,28,26,73,1261,3,940,0,1,0,571,28,26,76,1262,3,941,0,1,0,573,28,26,77,1333,3,285,0,1,0,556,28,26,80,1332,3,285,4,4,1,555,28,26,81,1335,3,286,0,1,0,523,28,26,94,1334,3,286,4,4,1,470,28,26,95,1341,3,287,0,1,0,524,28,26,89,1340,3,287,4,4,1,471,28,26,82,1343,3,288,0,1,0,525,28,26,83,1342,3,288,4,4,1,472,28,26,96,1345,3,289,0,1,0,526,28,26,97,1344,3,289,4,4,1,473,28,26,90,589,2,290,12,1,11,120,28,26,90,589,2,290,6,1,11,120,29,27,9,1263,3,942,0,1,0,561,29,27,13,1264,3,943,0,1,0,572,29,27,15,1265,3,944,0,1,0,574,29,27,16,1266,3,945,0,1,0,575,29,27,19,1267,3,946,0,1,0,576,29,27,20,1268,3,947,0,1,0,577,29,27,25,1269,3,948,0,1,0,578,29,27,34,1270,3,949,0,1,0,579,29,27,37,1271,3,950,0,1,0,580,29,27,42,1272,3,951,0,1,0,562,29,27,47,1273,3,952,0,1,0,563,29,27,53,1274,3,953,0,1,0,564,29,27,43,1275,3,954,0,1,0,565,29,27,44,1276,3,955,0,1,0,566,29,27,48,1277,3,956,0,1,0,567,29,27,56,1278,3,957,0,1,0,568,29,27,62,1279,3,958,0,1,0,569,29,27,66,1280,3,959,0,1,0,570,29,27,73,1281,3,960,0,1,0,571,29,27,76,1282,3,961,0,1,0,573,29,27,77,1337,3,291,0,1,0,556,29,27,80,1336,3,291,4,4,1,555,29,27,81,1339,3,292,0,1,0,523,29,27,94,1338,3,292,4,4,1,470,29,27,95,1347,3,293,0,1,0,524,29,27,89,1346,3,293,4,4,1,471,29,27,82,1349,3,294,0,1,0,525,29,27,83,1348,3,294,4,4,1,472,29,27,96,1351,3,295,0,1,0,526,29,27,97,1350,3,295,4,4,1,473,29,27,90,590,2,296,12,1,11,120,29,27,90,590,2,296,6,1,11,120,79,78,9,1401,3,1062,0,1,0,1146,79,78,13,1400,3,1063,0,1,0,1125,79,78,15,1405,3,1064,0,1,0,1443,79,78,16,1403,3,1065,0,1,0,1428,79,78,19,1399,3,1066,0,1,0,1093,79,78,20,1404,3,1067,0,1,0,1441,79,78,25,1402,3,1068,0,1,0,1150,79,78,34,765,2,333,4,1,0,411,79,78,34,765,2,333,0,1,0,411,103,98,9,768,2,332,4,1,0,583,103,98,9,768,2,332,0,1,0,583,103,98,13,767,2,331,4,1,0,582,103,98,13,767,2,331,0,1,0,582,103,98,15,766,3,330,4,4,1,581,103,98,15,766,2,330,0,1,0,581,798,327,13,591,3,142,0,1,0,455,798,327,15,591,14,1075,67,1,0,455,800,328,9,1412,14,1077,0,1,0,1438,800,328,13,1411,14,1078,0,1,0,1422,128,114,9,1315,3,995,0,1,0,1165,128,114,13,1355,3,866,0,1,0,1445,128,114,15,1391,3,846,0,1,0,1162,128,114,16,1353,3,867,0,1,0,1139,87,85,9,1413,14,880,6,1,0,1108,87,85,13,162,14,881,6,1,0,145,87,85,15,162,2,270,4,1,0,145,87,85,15,162,2,270,0,1,0,145,87,85,16,1414,3,882,0,1,0,1447,87,85,19,1415,14,883,0,1,0,1436,87,85,20,772,2,271,12,1,64,552,87,85,20,772,2,271,6,1,64,552,52,49,9,779,2,334,12,1,64,817,52,49,9,779,2,334,6,1,64,817,52,49,13,780,2,335,4,4,0,808,52,49,13,780,2,335,0,4,0,808,52,49,15,773,2,336,12,1,0,432,52,49,15,773,2,336,6,1,0,432,52,49,16,774,2,337,12,1,0,433,52,49,16,774,2,337,6,1,0,433,52,49,19,775,2,338,106,1,0,813,52,49,19,775,2,338,107,1,0,813,52,49,20,776,2,339,106,1,0,814,52,49,20,776,2,339,107,1,0,814,52,49,25,777,2,340,106,1,0,815,52,49,25,777,2,340,107,1,0,815,52,49,34,778,2,341,106,1,0,816,52,49,34,778,2,341,107,1,0,816,52,49,37,781,2,342,4,4,0,812,52,49,37,781,2,342,0,4,0,812,52,49,42,1419,3,1069,0,1,0,1126,52,49,47,1418,3,1070,0,1,0,1104,24,22,9,1289,3,977,0,1,0,10,24,22,13,1290,3,978,0,1,0,10,24,22,15,1291,3,979,0,1,0,10,24,22,16,1292,3,980,0,1,0,10,24,22,19,1293,3,981,0,1,0,10,24,22,20,1294,3,982,0,1,0,10,24,22,25,1295,3,983,0,1,0,10,24,22,34,1296,3,984,0,1,0,10,24,22,37,1297,3,985,0,1,0,10,24,22,42,1288,3,987,0,1,0,10,24,22,47,1320,3,988,0,1,0,1437,24,22,53,1311,3,986,0,1,0,1116,24,22,43,1309,3,989,0,1,0,1430,24,22,44,1314,3,990,0,1,0,1432,24,22,48,1303,3,991,0,1,0,1109,24,22,56,1308,3,992,0,1,0,1129,24,22,62,1317,3,993,0,1,0,462,24,22,66,1302,3,994,0,1,0,1122,24,22,76,1322,3,313,0,1,0,464,24,22,77,1321,3,313,4,4,1,464,24,22,80,1305,3,314,0,1,0,175,24,22,93,1304,3,314,4,4,1,175,24,22,81,1319,3,315,0,1,0,176,24,22,94,1318,3,315,4,4,1,176,24,22,109,1307,3,316,0,1,0,426,24,22,95,1306,3,316,4,4,1,426,24,22,89,1313,3,317,0,1,0,427,24,22,116,1312,3,317,4,4,1,427,24,22,82,1310,3,1056,0,1,0,111,24,22,83,1316,3,1057,0,1,0,1166,24,22,117,1301,3,1058,0,1,0,111,24,22,96,1298,3,1059,0,1,0,111,24,22,97,1299,3,1060,0,1,0,111,24,22,118,1300,3,1061,0,1,0,111,33,30,9,618,2,217,106,1,173,104,33,30,9,618,2,217,107,1,173,104,33,30,13,615,2,218,12,1,11,178,33,30,13,615,2,218,6,1,11,178,33,30,15,616,2,219,12,1,88,177,33,30,15,616,2,219,6,1,88,177,33,30,16,617,2,220,12,1,88,174,33,30,16,617,2,220,6,1,88,174,33,30,19,614,2,221,12,1,88,171,33,30,19,614,2,221,6,1,88,171,33,30,20,613,2,222,12,1,61,170,33,30,20,613,2,222,6,1,61,170,33,30,25,620,2,223,12,1,11,101,33,30,25,620,2,223,6,1,11,101,33,30,34,621,2,224,12,1,61,505,33,30,34,621,2,224,6,1,61,505,33,30,37,623,3,225,4,4,1,811,33,30,37,623,3,225,0,1,0,811,33,30,42,622,2,226,4,1,0,810,33,30,42,622,2,226,0,1,0,810,33,30,47,1360,14,855,0,1,0,166,33,30,53,1359,3,856,0,1,0,1446,33,30,43,1358,3,857,0,1,0,1440,33,30,44,619,2,393,4,1,0,461,33,30,44,619,2,393,0,1,0,461,33,30,48,1357,3,1081,0,1,0,1164,33,30,56,642,2,384,112,1,0,830,33,30,56,642,2,384,67,1,0,830,33,30,62,640,2,385,4,1,0,476,33,30,62,640,2,385,0,1,0,476,59,57,9,630,2,202,167,1,11,104,59,57,9,630,2,202,169,1,11,104,59,57,15,629,2,203,12,1,11,101,59,57,15,629,2,203,6,1,11,101,59,57,16,628,2,201,12,1,61,123,59,57,16,628,2,201,6,1,61,123,59,57,19,1362,14,850,0,1,0,166,59,57,20,1361,3,851,0,1,0,538,59,57,25,631,2,200,0,4,1,129,59,57,34,631,3,200,0,1,0,129,59,57,37,624,2,204,12,1,0,124,59,57,42,624,2,204,6,1,0,124,59,57,47,625,2,205,12,1,0,125,59,57,53,625,2,205,6,1,0,125,59,57,43,626,2,206,12,1,0,126,59,57,44,626,2,206,6,1,0,126,59,57,48,627,2,207,168,1,0,127,59,57,56,627,2,207,172,1,0,127,60,58,9,638,2,211,167,1,11,104,60,58,9,638,2,211,169,1,11,104,60,58,15,637,2,212,12,1,11,101,60,58,15,637,2,212,6,1,11,101,60,58,16,636,2,209,12,1,61,123,60,58,16,636,2,209,6,1,61,123,60,58,19,1364,14,852,0,1,0,166,60,58,20,1363,3,853,0,1,0,538,60,58,25,639,2,208,0,4,1,129,60,58,34,639,3,208,0,1,0,129,60,58,37,632,2,213,12,1,0,124,60,58,42,632,2,213,6,1,0,124,60,58,47,633,2,214,12,1,0,125,60,58,53,633,2,214,6,1,0,125,60,58,43,634,2,215,12,1,0,126,60,58,44,634,2,215,6,1,0,126,60,58,48,635,2,216,168,1,0,127,60,58,56,635,2,216,172,1,0,127],"strings":["1","0","TUMB","BTN","-1","ELEC_INTERFACE","0.1","9","CDU","3001","","0.2","-0.1","3002","LEV","3003","3004","IFF","43","3005","3006","38","8","AUTOPILOT","UFC","3007","2","3","MFCD_LEFT","MFCD_RIGHT","54","58","INTERCOM","UHF_RADIO","3008","36","FUEL_SYSTEM","3009","39","49","CPT_MECH","LIGHT_SYSTEM","3010","3013","3014","41","ENVIRONMENT_SYSTEM","3011","3015","57","7","AHCP","TISL","3012","4","CMSP","3016","55","56","VHF_AM_RADIO","VHF_FM_RADIO","0.3","3017","69","0.4","KY_58","3018","0.5","37","ENGINE_SYSTEM","22","44","0.7","3019","AAP","HARS","3020","3021","46","NMSP","3022","3024","3030","3031","50","74","FIRE_SYSTEM","TACAN_CTRL_PANEL","0.9","3028","3036","5","CMSC","3023","3025","3027","3033","3034","40","53","719","Frequency Mode Dial","ILS","OXYGEN_SYSTEM","Preset Channel Selector","Toggle Mirrors","-0.05","0.05","12","3026","IFFCC","No Function","-0.5","176","24","285","3029","3032","3035","73","DAY/NIGHT/OFF","DVADR","Edit Program Value","Frequency Selection Dial","Frequency Selector the 1nd","Frequency Selector the 2nd","Frequency Selector the 3rd","Frequency Selector the 4th","SYS_CONTROLLER","Squelch / TONE","0.15","0.85","3037","3038","3039","3040","3041","3042","3043","3044","45","62","67","AIM Switch","Adjust Display Brightness","Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection","FM Switch","IFF Switch","ILS Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value","ILS Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click and hold while moving mouse to adjust volume ","ILS Switch","INT Switch","PTR-ILSCP-PWR","PTR-ILSCP-VOL","PTR-INTERCOM-AIM","PTR-INTERCOM-FM","PTR-INTERCOM-IFF","PTR-INTERCOM-ILS","PTR-INTERCOM-INT","PTR-INTERCOM-TCN","PTR-INTERCOM-UHF","PTR-INTERCOM-VHF","PTR-TACAN-CHANNEL-SELECTOR-2","TCN Switch","UHF Switch","VHF Switch","Volume","-0.01","-0.25","0.01","0.025 MHz Selector","0.1 MHz Selector","0.25","0.95","1 MHz Selector","1. Change Menu/Display Data 2. Cycle between DTS and Hot Elevation (N/A) 3. Change HACK Time Interval 4. FUNC Mode: Alternate CDU PG rocker","1. HUD TEST: Navigate Menus 2. GUNS: Change Gun Reticle 3. CCIP/CCRP: Change Weapon Profile 4. AIR-to-AIR: Change Air Threat 5. FUNC Mode: Alternate CDU + Rocker","10 MHz Selector","100 MHz Selector","102","103","104","105","106","107","108","109","110","111","112","113","114","121","122","123","124","125","126","130","132","134","135","137","138","139","140","141","142","148","149","15","151","152","153","154","155","156","161","162","163","164","165","166","167","168","169","170","174","177","180","183","184","189","192","194","196","199","200","201","202","203","204","205","206","207","208","209","210","211","212","213","214","222","224","226","228","230","232","234","236","237","239","241","242","243","244","245","246","247","250","258","262","270","272","273","276","278","279","280","282","283","287","291","294","295","320","321","322","323","324","325","346","347","348","349","350","351","356","360","361","362","363","364","375","376","377","378","379","380","381","382","383","384","405","406","407","408","409","424","463","469","472","473","474","475","476","477","48","52","60","601","602","603","621","622","623","624","626","636","638","640","642","644","645","655","666","667","668","669","670","671","672","673","674","675","676","677","678","679","680","681","682","683","684","685","686","687","688","689","690","691","692","693","694","695","696","697","698","699","700","701","702","703","706","707","708","709","710","712","716","718","722","733","734","770","772","773","777","778","779","780","781","782","783","784","785","786","787","789","790","AAU34","ABLE-STOW ADI Localizer Bar","AILERON DISC L","AILERON DISC R","AILERON TAB L","AILERON TAB R","AN_APN_194","APU CONT","APU Fire T-Handle","APU Generator On/Off","APU On/Off","AUX ESS BUS 0A","AUX ESS BUS 0B","AUX ESS BUS 0C","AUX ESS BUS TIE","Accelerometer & Compass Lights","Adjust Depressible Pipper","Adjust HUD Brightness (Hold rocker)","Aerial Refueling Slipway Control Lever","Aileron Emergency Disengage","Air Conditioner MAN/AUTO","Altimeter Source","Altitude above target tens of thousands of feet","Altitude above target units of thousands of feet","Arm Ground Safety Override Cover","Arm Ground Safety Override Switch","Audio/light","Autopilot Mode Select Switch","Auxiliary Landing Gear Handle","Auxiliary Landing Gear Handle Lock button","BATTERY BUS TRANS","BLEED AIR CONT L","BLEED AIR CONT R","BOARD-LADDER-COVER-PTR","Battery Power","Bleed Air","Boost Pumps Left Wing","Boost Pumps Main Fuselage Left","Boost Pumps Main Fuselage Right","Boost Pumps Right Wing","C/RAD switch","CANOPY-DISENGAGE-LEVER-PTR","CDU Page Select","CDU Power On/Off","CONVERTER L","Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage","Canopy Jettison Lever Unlock Button","Canopy Open/Hold/Close","Canopy jettison lever","Code","Countermeasure Dispenser (DISP). Left mouse - ON/OFF, Right mouse - MENU","Cover","Create Overhead Mark Point","Cross Feed","Cycle Steerpoint/Waypoint","DC FUEL PUMP","DIGITAL_CLOCK","DVADR-RC-FUNC-CONTROL-SW-PTR","DVADR-VIDEO-SW-PTR","Day/Night HUD Mode","Decrease Backlight Brightness","Decrease Brightness","Decrease Contrast","Decrease Symbol Levels","Delay Switch","Display Brightness Adjustment (Not Functional)","EGI HQ TOD","EGI Power On/Off","ELECT/PNEU","ELEVATION DISC L","ELEVATION DISC R","EMER FLAP","EMER FUEL SHUTOFF ENG L","EMER FUEL SHUTOFF ENG R","EMER TRIM","ENG IGNITOR L/R-1","ENG IGNITOR L/R-2","ENGINE START L","ENGINE START R","EXT STORES JETT 1","EXT STORES JETT 2","Electronic Countermeasure Jammer (JMR). Left mouse - ON/OFF, Right mouse - MENU (No Function)","Elevator Emergency Disengage","Emergency Brake","Emergency Flood Light","Engine Operate Left","Engine Operate Right","Extend boarding ladder cover","External Fuselage Tank Boost Pump","External Wing Tanks Boost Pumps","Fire Extinguishing Agent Discharge","Flap Setting","Flaps Emergency Retract","Fuel display selector","Full switch","Function Dial","Function control toggle switch","GENERATOR CONT L","GENERATOR CONT R","Gun Arm Mode","HARS MAG VAR","HARS N/S toggle switch","HARS Push-To-Sync","HARS SLAVE-DG mode","HARS-SAS Override/NORM","HM Switch","HSI","IFF On/Out","IFF antenna switch","INTER COMM","INVERTER CONT","INVERTER PWR","Ident/Mic","Increase Backlight Brightness","Increase Brightness","Increase Contrast","Increase Symbol Levels","Increment/Decrement Data Indicated With +/- Symbol","Internal canopy actuator disengage lever","Inverter Switch","JTRS Datalink On/Off)","LAND GEAR","Land Taxi Lights","Landing Gear Lever","Laser Arm","Left AC Generator Power","Left Engine Fire T-Handle","Left Engine Fuel Flow Control","Load","MASTER CAUT","MODE1-WHEEL1","MODE1-WHEEL2","MODE3A-WHEEL1","MODE3A-WHEEL2","MODE3A-WHEEL3","MODE3A-WHEEL4","Main Air Supply","Manual Reversion Flight Control System (MRFCS)","Master","Master Arm","Master CMS Mode Select","Missile Warning System (MWS). Left mouse - ON/OFF, Right mouse - MENU (No Function)","Mode Dial","Mode switch","Monitor Test Left/Right","Moving Map Scale Adjust Decrease","Moving Map Scale Adjust Increase","NORM/Standby HUD Mode","Nightvision Lights","No function","Nose Illumination","OSB 1","OSB 10","OSB 11","OSB 12","OSB 13","OSB 14","OSB 15","OSB 16","OSB 17","OSB 18","OSB 19","OSB 2","OSB 20","OSB 3","OSB 4","OSB 5","OSB 6","OSB 7","OSB 8","OSB 9","Oxygen Flow Emergency/Normal/Test Mask","Oxygen Normal/100%","Oxygen Supply On/Off","PITOT HEAT AC","PNT-ALT-LEVR-R","PNT-LEV-CMSP-MODE","PNT-LEV-PAGE-SEL-SWITCH","PNT-LNDGEAR","PNT-LVR-MFD-L","PNT-LVR-MFD-R","PNT-LVR-SAI-CAGE","PNT-LVR-STEER-PT-SEL-SWITCH","PNT-MIRROR-FRONT","PNT-MIRROR-LEFT","PNT-MIRROR-RIGHT","PNT-TMB-AHCP-ALT","PNT-TMB-AHCP-CICU","PNT-TMB-AHCP-GUNPAC","PNT-TMB-AHCP-IFFCC","PNT-TMB-AHCP-JTRS","PNT-TMB-AHCP-LARM","PNT-TMB-AHCP-MARM","PNT-TMB-AHCP-NORM","PNT-TMB-AHCP-TGP","PNT-TMB-AHCP-TIME","PNT-TMB-CMSP-DISP","PNT-TMB-CMSP-JMR","PNT-TMB-CMSP-MWS","PNT-TMB-CMSP-RWR","PNT-TMB-STEER-SPRING-LD-SWITCH","PTR-ALCP-HARSSAS","PTR-ALCP-NVIS-LTS","PTR-ANARC164-0.025MHZ-SELECTOR","PTR-ANARC164-0.1MHZ-SELECTOR","PTR-ANARC164-100MHZ-SELECTOR","PTR-ANARC164-10MHZ-SELECTOR","PTR-ANARC164-1MHZ-SELECTOR","PTR-ANARC164-CHANNEL-SELECTOR","PTR-ANARC164-COVER","PTR-ANARC164-FREQMODE","PTR-ANARC164-FUNCTION","PTR-ANARC164-SQUELCH","PTR-ANARC164-T-TONE","PTR-ANARC186-VHFAM-FREQ-1","PTR-ANARC186-VHFAM-FREQ-2","PTR-ANARC186-VHFAM-FREQ-3","PTR-ANARC186-VHFAM-FREQ-4","PTR-ANARC186-VHFAM-FREQEMER-CONTROL","PTR-ANARC186-VHFAM-MODE","PTR-ANARC186-VHFAM-PRESET","PTR-ANARC186-VHFAM-SQUELCH","PTR-ANARC186-VHFFM-FREQ-1","PTR-ANARC186-VHFFM-FREQ-2","PTR-ANARC186-VHFFM-FREQ-3","PTR-ANARC186-VHFFM-FREQ-4","PTR-ANARC186-VHFFM-FREQEMER-CONTROL","PTR-ANARC186-VHFFM-MODE","PTR-ANARC186-VHFFM-PRESET","PTR-ANARC186-VHFFM-SQUELCH","PTR-ANTSP-EGI-HQ-TOD","PTR-ANTSP-IFF","PTR-ANTSP-UHF","PTR-APU-START","PTR-ARM-DWNC-L","PTR-ARM-SEAT-HANDLE","PTR-ARMGS-COVER","PTR-ARMGS-OVERRIDE-SWITCH","PTR-BTN-ARM-DWNC-L","PTR-BTN-PANIFF-REPLY","PTR-BTN-PANIFF-TEST","PTR-CANOPY-OPEN","PTR-CBP-AILERON-DISC-L","PTR-CBP-AILERON-DISC-R","PTR-CBP-AILERON-TAB-L","PTR-CBP-AILERON-TAB-R","PTR-CBP-ANG-IGNITOR-1","PTR-CBP-ANG-IGNITOR-2","PTR-CBP-APU-CONT","PTR-CBP-AUX-ESS-BUS-0A","PTR-CBP-AUX-ESS-BUS-0B","PTR-CBP-AUX-ESS-BUS-0C","PTR-CBP-AUX-ESS-BUS-TIE","PTR-CBP-BATTERY-BUS-TRANS","PTR-CBP-BLEED-AIR-CONT-L","PTR-CBP-BLEED-AIR-CONT-R","PTR-CBP-CONVERTER-L","PTR-CBP-DC-FUEL-PUMP","PTR-CBP-ELEVATION-DISC-L","PTR-CBP-ELEVATION-DISC-R","PTR-CBP-EMER-FLAP","PTR-CBP-EMER-FUEL-SHUTOFF-ENG-L","PTR-CBP-EMER-FUEL-SHUTOFF-ENG-R","PTR-CBP-EMER-TRIM","PTR-CBP-ENGINE-START-L","PTR-CBP-ENGINE-START-R","PTR-CBP-EXT-STORES-JETT-1","PTR-CBP-EXT-STORES-JETT-2","PTR-CBP-GENERATOR-CONT-L","PTR-CBP-GENERATOR-CONT-R","PTR-CBP-IFF","PTR-CBP-INTER-COMM","PTR-CBP-INVERTER-CONT","PTR-CBP-INVERTER-PWR","PTR-CBP-LAND-GEAR","PTR-CBP-MASTER-CAUT","PTR-CBP-PITOT-HEAT-AC","PTR-CBP-SPS-RUDDER-AUTH-LIM","PTR-CBP-STBY-ATT-IND","PTR-CBP-UHF-COMM","PTR-CNP-JETT-BTN","PTR-CNP-JETTARM","PTR-DELAY-SWITCH","PTR-EFCP-AILERON-EMER-DISENGAGE","PTR-EFCP-ELEVATOR-EMER-DISENGAGE","PTR-EFCP-FLAP-EMER-RETR","PTR-EFCP-MRFCS","PTR-EFCP-PTCHROLL-TRIM","PTR-EFCP-SPDBK-EMER-RETR","PTR-EMER-BRKARM","PTR-ENGINE-OPER-L","PTR-ENGINE-OPER-R","PTR-ENVCP-BLEED-AIR","PTR-ENVCP-CABIN-AIR-COND-OPER","PTR-ENVCP-MAIN-AIR-SUPPLY","PTR-ENVCP-PITOT-HEAT","PTR-ENVCP-TEMP-PRESS","PTR-ENVCP-WINDSHIELD-DEFOG","PTR-ENVCP-WINDSHIELD-RREMOVE-WASH","PTR-EPP-AC-GEN-PWR-L","PTR-EPP-AC-GEN-PWR-R","PTR-EPP-APU-GEN-PWR","PTR-EPP-BATTERY-PWR","PTR-EPP-EMER-FLOOD","PTR-EPP-INVERTER","PTR-FIRE-APU-PULL","PTR-FIRE-EXTING-DISCH","PTR-FIRE-LENG-PULL","PTR-FIRE-RENG-PULL","PTR-FLAPS","PTR-FQIS-SELECT","PTR-FSCP-BOOST-PUMPS-MAIN-L","PTR-FSCP-BOOST-PUMPS-MAIN-R","PTR-FSCP-BOOST-PUMPS-WING-L","PTR-FSCP-BOOST-PUMPS-WING-R","PTR-FSCP-CROSS-FEED","PTR-FSCP-EXT-TANKS-FUS","PTR-FSCP-EXT-TANKS-WING","PTR-FSCP-RCVR-LEVER","PTR-FSCP-SIG-AMPL","PTR-FSCP-TK-GATE","PTR-FUEL-FLOW-L","PTR-FUEL-FLOW-R","PTR-HARS-CP-MAG-VAR","PTR-HARS-CP-N-S","PTR-HARS-CP-PUSH-TO-SYNC","PTR-HARS-CP-SLAVE","PTR-IFFCP-CODE","PTR-IFFCP-MASTER","PTR-IFFCP-MIC-IDENT","PTR-IFFCP-MODE1-WHEEL1","PTR-IFFCP-MODE1-WHEEL2","PTR-IFFCP-MODE3A-WHEEL1","PTR-IFFCP-MODE3A-WHEEL2","PTR-IFFCP-MODE3A-WHEEL3","PTR-IFFCP-MODE3A-WHEEL4","PTR-IFFCP-ON-OUT","PTR-IFFCP-OUT-AUDIO-LIGHT","PTR-IFFCP-RADTEST","PTR-IFFCP-TEST-M-1","PTR-IFFCP-TEST-M-2","PTR-IFFCP-TEST-M-3A","PTR-IFFCP-TEST-M-C","PTR-INTERCOM-HM","PTR-INTERCOM-MODE","PTR-LCP-AUTOPILOT-PATH-ALT","PTR-LCP-RDRALTM","PTR-LGHTCP-ACCEL-COMP","PTR-LGHTCP-NOSE-ILLUM","PTR-LGHTCP-POSITION","PTR-LGHTCP-SIGNAL-LTS","PTR-LIGHTS-LAND","PTR-LVR-PANKY58-1TO5","PTR-LVR-PANKY58-MODE","PTR-LVR-PANKY58-PLAIN","PTR-NMSP-ABLE-STOW","PTR-OXYGENCP-EMERGENCY","PTR-OXYGENCP-OXYGEN-DILUTER","PTR-OXYGENCP-SUPPLY","PTR-SASP-MONITOR-TEST","PTR-SASP-YAW-TRIM","PTR-SEAT-ADJBUTTON","PTR-TACAN-MODE","PTR-TISLCP-ALT-ABV-TGT-WH1","PTR-TISLCP-ALT-ABV-TGT-WH2","PTR-TISLCP-CODE-WH1","PTR-TISLCP-CODE-WH2","PTR-TISLCP-CODE-WH3","PTR-TISLCP-CODE-WH4","PTR-TISLCP-MODE","PTR-TISLCP-SLANT-RNG","PTR-TISLCP-TISL-AUX","PTR-TMB-CDU-SWITCH","PTR-TMB-EGI-SWITCH","PTR-TMB-PANKY58-POWER","PTR-ZEROIZE-COVER","PTR-ZEROIZE-SWITCH","Pitch/Roll Trim Norm/Emergency Override","Pitot Heater","Position Lights, FLASH/OFF/STEADY","Power switch","RAD Test/Mon","Radar Altimeter Normal/Disabled","Radar Warning Receiver (RWR). Left mouse - ON/OFF, Right mouse - MENU","Reply test","Right AC generator Power","Right Engine Fire T-Handle","Right Engine Fuel Flow Control","SAI","SPS & RUDDER AUTH LIMIT","STALL","STBY ATT IND","Scroll Waypoint Names During Search","Seat Arm Handle","Seat Height Adjustment","Selector switch","Signal Amplifier Norm/Override","Signal Lights","Slant range","Speed Brake Emergency Retract","Squelch","T-Tone","TISL AUX","TISL Code wheel 1","TISL Code wheel 2","TISL Code wheel 3","TISL Code wheel 4","TISL Mode","Tank Gate","Targeting Pod Power On/Off","Temperature/Pressure Control","Test M-1","Test M-2","Test M-3A","Test M-C","Test test","Toggle Steerpoint","Turn On/Off CICU","Turn On/Off/Test IFFCC","UHF COMM","UHF antenna switch","Use Steerpoint From Active Flight Plan","Video selector toggle switch (N/A)","Windshield Defog/Deice","Windshield Rain Removal/Wash","Yaw Trim","Zeroise Cover","Zeroise Switch","0.04","101","115","116","117","118","119","120","127","128","129","131","133","136","147","150","16","171","172","173","175","185","186","187","188","190","193","195","197","198","221","223","225","227","229","231","233","235","238","240","248","249","256","257","259","261","267","268","271","275","277","284","286","288","289","29","290","292","293","296","297","300","301","302","303","304","3045","3046","3047","3048","3049","305","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","306","3060","3061","3062","3063","3064","3065","3066","3067","307","308","309","310","311","312","313","314","315","316","317","318","319","326","327","328","329","330","331","332","333","334","335","336","337","338","339","340","341","342","343","344","345","35","352","353","354","355","357","358","359","365","366","367","368","369","370","371","385","386","387","388","389","390","391","392","393","394","395","396","397","398","399","400","401","402","403","410","411","412","413","414","415","416","417","418","419","420","421","422","423","425","426","427","428","429","430","431","432","433","434","435","436","437","438","439","440","441","442","443","444","445","446","447","448","449","450","451","452","453","454","455","456","457","458","459","460","461","462","464","465","466","467","468","47","470","471","531","532","533","534","535","536","605","607","609","611","613","615","617","628","632","646","651","652","654","66","68","704","705","711","72","735","776","788","795","796","900","901","904","ACCELEROMETER","ACCEL_KNOB_PTR","ADI","ADI Pitch Trim Knob","ANCHR Mode","ANTI-G-VALVE-PTR","AN_ALR69V","Adjust RWR Volume","Air Conditioner to COLD","Air Conditioner to HOT","Anti Skid","Anti-G suit valve test button","Anticollision Lights","Autopilot Engage/Disengage","Auxiliary Instruments Lights","BITE","BOARD-LADDER-BUTTON-PTR","Call button","Canopy Defog","Channel Selector (Tens). Rotate mouse wheel to select","Clear","Console Light","Course Set Knob","Cycle Missile Warning System Programs. No function","Cycle Program or Value Down","Cycle Program or Value Up","Display Flight Plan Menu (FPMENU) Page","Display Hack Time","Display Navigation (NAV) Page","Display Offset (OFFSET) Page","Display System (SYS) Page","Display Unknown Threats","Display Waypoint Menu (WP MENU) Page","Display and Adjust Altitude Alert Values","Downlock Override","EAC On/Off","EGI Navigation Mode","ENTER","Emergency Jettison External Stores","Engine Instruments Lights","Enter","Erase Entire Scratchpad","Erase Single Character. Hold for repeated erase","Extend boarding ladder button","FM_PROXY","Fault Acknowledge/Clear Fault Display","Fill Disable Main Left","Fill Disable Main Right","Fill Disable Wing Left","Fill Disable Wing Right","Fire Detect Bleed Air Test","Flight Instruments Lights","Flood Light","Flow Level Control","Formation Lights","Fuel Gauge Test","Go to previous page","HARS Backup Navigation Mode","HARS Fast Erect","HARS Latitude Dial","Heading Set Knob","ILS Mode","Insert Space Into Scratchpad","Intercom volume","Jettison Countermeasures","LSK 3L","LSK 3R","LSK 5L","LSK 5R","LSK 7L","LSK 7R","LSK 9L","LSK 9R","Landing Gear Horn Silence Button","Line Check","Load button","Master Caution Light","No Function ","Oxygen Indicator Test","PNT-ALT-LEVR-L","PNT-BTN-CDU-0","PNT-BTN-CDU-1","PNT-BTN-CDU-2","PNT-BTN-CDU-3","PNT-BTN-CDU-4","PNT-BTN-CDU-5","PNT-BTN-CDU-6","PNT-BTN-CDU-7","PNT-BTN-CDU-8","PNT-BTN-CDU-9","PNT-BTN-CDU-A","PNT-BTN-CDU-ARW-L1","PNT-BTN-CDU-ARW-L2","PNT-BTN-CDU-ARW-L3","PNT-BTN-CDU-ARW-L4","PNT-BTN-CDU-ARW-R1","PNT-BTN-CDU-ARW-R2","PNT-BTN-CDU-ARW-R3","PNT-BTN-CDU-ARW-R4","PNT-BTN-CDU-B","PNT-BTN-CDU-BCK","PNT-BTN-CDU-BLANC-L","PNT-BTN-CDU-BLANC-R","PNT-BTN-CDU-C","PNT-BTN-CDU-CLR","PNT-BTN-CDU-D","PNT-BTN-CDU-DIMBRT-L","PNT-BTN-CDU-DIMBRT-R","PNT-BTN-CDU-E","PNT-BTN-CDU-F","PNT-BTN-CDU-FA","PNT-BTN-CDU-FPM","PNT-BTN-CDU-G","PNT-BTN-CDU-H","PNT-BTN-CDU-I","PNT-BTN-CDU-J","PNT-BTN-CDU-K","PNT-BTN-CDU-L","PNT-BTN-CDU-M","PNT-BTN-CDU-MINUS","PNT-BTN-CDU-MK","PNT-BTN-CDU-N","PNT-BTN-CDU-NAV","PNT-BTN-CDU-O","PNT-BTN-CDU-OSET","PNT-BTN-CDU-P","PNT-BTN-CDU-PG-DN","PNT-BTN-CDU-PG-UP","PNT-BTN-CDU-PLUS","PNT-BTN-CDU-PNT","PNT-BTN-CDU-PREV","PNT-BTN-CDU-Q","PNT-BTN-CDU-R","PNT-BTN-CDU-S","PNT-BTN-CDU-SLASH","PNT-BTN-CDU-SPC","PNT-BTN-CDU-SYS","PNT-BTN-CDU-T","PNT-BTN-CDU-U","PNT-BTN-CDU-V","PNT-BTN-CDU-V1","PNT-BTN-CDU-V2","PNT-BTN-CDU-W","PNT-BTN-CDU-WP","PNT-BTN-CDU-X","PNT-BTN-CDU-Y","PNT-BTN-CDU-Z","PNT-BTN-CMSP-ARW1","PNT-BTN-CMSP-ARW2","PNT-BTN-CMSP-ARW3","PNT-BTN-CMSP-ARW4","PNT-BTN-CMSP-BRT-DN","PNT-BTN-CMSP-BRT-UP","PNT-BTN-CMSP-RTN","PNT-BTN-MFD-L-01","PNT-BTN-MFD-L-02","PNT-BTN-MFD-L-03","PNT-BTN-MFD-L-04","PNT-BTN-MFD-L-05","PNT-BTN-MFD-L-06","PNT-BTN-MFD-L-07","PNT-BTN-MFD-L-08","PNT-BTN-MFD-L-09","PNT-BTN-MFD-L-10","PNT-BTN-MFD-L-11","PNT-BTN-MFD-L-12","PNT-BTN-MFD-L-13","PNT-BTN-MFD-L-14","PNT-BTN-MFD-L-15","PNT-BTN-MFD-L-16","PNT-BTN-MFD-L-17","PNT-BTN-MFD-L-18","PNT-BTN-MFD-L-19","PNT-BTN-MFD-L-20","PNT-BTN-MFD-R-01","PNT-BTN-MFD-R-02","PNT-BTN-MFD-R-03","PNT-BTN-MFD-R-04","PNT-BTN-MFD-R-05","PNT-BTN-MFD-R-06","PNT-BTN-MFD-R-07","PNT-BTN-MFD-R-08","PNT-BTN-MFD-R-09","PNT-BTN-MFD-R-10","PNT-BTN-MFD-R-11","PNT-BTN-MFD-R-12","PNT-BTN-MFD-R-13","PNT-BTN-MFD-R-14","PNT-BTN-MFD-R-15","PNT-BTN-MFD-R-16","PNT-BTN-MFD-R-17","PNT-BTN-MFD-R-18","PNT-BTN-MFD-R-19","PNT-BTN-MFD-R-20","PNT-BTN-RWR-JMR","PNT-BTN-RWR-MWS","PNT-BTN-RWR-PRI","PNT-BTN-RWR-SEP","PNT-BTN-RWR-UNK","PNT-BTN-UFC-0","PNT-BTN-UFC-1","PNT-BTN-UFC-2","PNT-BTN-UFC-3","PNT-BTN-UFC-4","PNT-BTN-UFC-5","PNT-BTN-UFC-6","PNT-BTN-UFC-7","PNT-BTN-UFC-8","PNT-BTN-UFC-9","PNT-BTN-UFC-ADD-4","PNT-BTN-UFC-ADD-5","PNT-BTN-UFC-ADD-6","PNT-BTN-UFC-AFT","PNT-BTN-UFC-ALT","PNT-BTN-UFC-CLR","PNT-BTN-UFC-DATA-DN","PNT-BTN-UFC-DATA-UP","PNT-BTN-UFC-DEPR-DN","PNT-BTN-UFC-DEPR-UP","PNT-BTN-UFC-ENT","PNT-BTN-UFC-FUNC","PNT-BTN-UFC-FWD","PNT-BTN-UFC-HACK","PNT-BTN-UFC-INTEN-LFT","PNT-BTN-UFC-INTEN-RGT","PNT-BTN-UFC-LTR","PNT-BTN-UFC-MASTWARN","PNT-BTN-UFC-MID","PNT-BTN-UFC-MK","PNT-BTN-UFC-SEL-DN","PNT-BTN-UFC-SEL-UP","PNT-BTN-UFC-SPC","PNT-BTN-UFC-STEER-DN","PNT-BTN-UFC-STEER-UP","PNT-LEV-CMSP-BRT","PNT-LEV-RWR-AUD","PNT-LEV-RWR-BRT","PNT-LVR-ADI-KNOB","PNT-LVR-HSI-CRS","PNT-LVR-HSI-HDG","PNT-LVR-RWR","PNT-LVR-WATCH-CTRL","PNT-LVR-WATCH-SET","PNT-MFCD-L-ADJ-DN","PNT-MFCD-L-ADJ-UP","PNT-MFCD-L-DSP-DN","PNT-MFCD-L-DSP-UP","PNT-MFCD-R-ADJ-DN","PNT-MFCD-R-ADJ-UP","PNT-MFCD-R-DSP-DN","PNT-MFCD-R-DSP-UP","PNT-MFD-L-BRT-DN","PNT-MFD-L-BRT-UP","PNT-MFD-L-CON-DN","PNT-MFD-L-CON-UP","PNT-MFD-L-SYM-DN","PNT-MFD-L-SYM-UP","PNT-MFD-R-BRT-DN","PNT-MFD-R-BRT-UP","PNT-MFD-R-CON-DN","PNT-MFD-R-CON-UP","PNT-MFD-R-SYM-DN","PNT-MFD-R-SYM-UP","PNT-TMB-CMSP-JTSN","PTR-ALCP-FDBAL-TEST","PTR-ALCP-RSIL","PTR-ALCP-SIGLIGHTS-LAMP-TEST","PTR-ALCP-WPNSTA","PTR-ANARC164-LOAD","PTR-ANARC164-STATUS","PTR-ANARC164-TEST-DISPLAY","PTR-ANARC164-VOLUME","PTR-ANARC186-VHFAM-LOAD","PTR-ANARC186-VHFAM-VOLUME","PTR-ANARC186-VHFFM-LOAD","PTR-ANARC186-VHFFM-VOLUME","PTR-ANTI-SKID","PTR-DOWNLOCK-OVERRIDE","PTR-EFCP-TRIM-LWINGDN","PTR-EFCP-TRIM-NOSEDN","PTR-EFCP-TRIM-NOSEUP","PTR-EFCP-TRIM-RWINGDN","PTR-ENVCP-CABIN-AIR-COND-OPER-COLD","PTR-ENVCP-CABIN-AIR-COND-OPER-HOT","PTR-ENVCP-CANOPY-DEFOG","PTR-ENVCP-FLOW-LEVEL","PTR-ENVCP-OXY-TEST","PTR-ENVCP-TEM-LEVEL","PTR-EXT-STORES-JETT","PTR-FQIS-TEST","PTR-FSCP-FILLDISABLE-MAIN-L","PTR-FSCP-FILLDISABLE-MAIN-R","PTR-FSCP-FILLDISABLE-WING-L","PTR-FSCP-FILLDISABLE-WING-R","PTR-FSCP-LINE-CHECK","PTR-FSCP-RCVR-LT","PTR-HARS-CP-LATITUDE","PTR-HARS-FAST-ERECT","PTR-INTERCOM-CALL","PTR-INTERCOM-VOL","PTR-LCP-AUTOPILOT-ENGAGE","PTR-LCP-EAC","PTR-LG-WRN-SILENCE","PTR-LGHTCP-ANTICOLLISION","PTR-LGHTCP-AUX-INST","PTR-LGHTCP-CONSOLE","PTR-LGHTCP-ENG-INST","PTR-LGHTCP-FLIGHT-INST","PTR-LGHTCP-FLOOD","PTR-LGHTCP-FORMATION","PTR-NMSP-ANCHR","PTR-NMSP-EGI","PTR-NMSP-HARS","PTR-NMSP-ILS","PTR-NMSP-STARTPT","PTR-NMSP-TCN","PTR-NMSP-TISL","PTR-SASP-PITCH-SASENGAGE-L","PTR-SASP-PITCH-SASENGAGE-R","PTR-SASP-TO-TRIM","PTR-SASP-YAW-SASENGAGE-L","PTR-SASP-YAW-SASENGAGE-R","PTR-STALLWCP-PEAK","PTR-STALLWCP-STALL","PTR-TACAN-CHANNEL-SELECTOR-1","PTR-TACAN-TEST","PTR-TACAN-VOL","PTR-TEMS-DATA","PTR-THROTTLE-FRICTION","PTR-TISLCP-BITE","PTR-TISLCP-ENTER","Page Down To Additional Pages When Available","Page Up To Additional Pages When Available","Peak Volume","Pitch SAS Engage left","Pitch SAS Engage right","Push to set","Refuel Status Indexer Lights","Refueling Lighting Dial","STEERPT Mode","Save and Return Program","Select Function Mode","Select Jammer Program","Select Letter Mode","Separate RWR Symbols","Set Pressure","Set Takeoff Trim","Signal Volume","Space","Stall Volume","Start, Stop and Reset Elapsed Timer","Status","TCN Mode","TEMS DATA","TISL No Function","Temp Level Control","Test Cockpit Indication Lights","Test Display","Test TACAN Signal on HSI","Throttle Friction Control","Toggle Clock and Elapsed Time Modes","Toggle between 5 and 16 Priority Threats Displayed","Trim Emergency Left Wing Down","Trim Emergency Nose Down","Trim Emergency Nose Up","Trim Emergency Right Wing Down","Weapon Station Lights. No function","Yaw SAS Engage left","Yaw SAS Engage right"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"AJS37","rows":[26,25,53,331,2,121,21,1,34,240,26,25,53,331,2,121,20,1,34,240,26,25,54,332,2,122,21,1,34,239,26,25,54,332,2,122,20,1,34,239,26,25,55,241,2,123,21,1,34,202,26,25,55,241,2,123,20,1,34,202,26,25,56,242,2,124,21,1,20,203,26,25,56,242,2,124,20,1,20,203,26,25,57,243,2,126,21,1,33,200,26,25,57,243,2,126,20,1,33,200,26,25,150,294,2,15,3,3,0,201,26,25,150,294,2,15,0,3,0,201,205,42,22,269,2,15,3,1,0,210,205,42,22,269,2,15,0,1,0,210,37,35,22,230,2,80,3,1,0,250,37,35,22,230,2,80,0,1,0,250,37,35,27,223,2,84,3,1,0,224,37,35,27,223,2,84,0,1,0,224,37,35,29,190,2,118,3,1,0,189,37,35,29,190,2,118,0,1,0,189,8,7,44,281,2,112,21,1,0,233,8,7,44,281,2,112,20,1,0,233,8,7,44,291,2,168,1,1,0,198,8,7,44,291,2,168,0,1,0,198,8,7,22,322,2,83,3,1,0,321,8,7,22,322,2,83,0,1,0,321,8,7,27,244,2,81,3,1,0,248,8,7,27,244,2,81,0,1,0,248,8,7,29,327,2,82,3,1,0,237,8,7,29,327,2,82,0,1,0,237,8,7,38,227,2,79,3,1,0,228,8,7,38,227,2,79,0,1,0,228,8,7,39,181,2,119,3,1,0,252,8,7,39,181,2,119,0,1,0,252,8,7,51,251,2,120,3,1,0,253,8,7,51,251,2,120,0,1,0,253,8,7,30,209,2,113,3,1,0,216,8,7,30,209,2,113,0,1,0,216,8,7,395,580,14,444,352,11,11,602,8,7,46,265,2,75,1,1,0,179,8,7,46,265,2,75,0,1,0,179,8,7,135,461,4,353,0,1,0,603,8,7,155,275,2,106,3,1,0,192,8,7,155,275,2,106,0,1,0,192,8,7,156,276,2,107,3,1,0,196,8,7,156,276,2,107,0,1,0,196,8,7,157,277,2,108,3,1,0,197,8,7,157,277,2,108,0,1,0,197,8,7,158,278,2,109,3,1,0,194,8,7,158,278,2,109,0,1,0,194,8,7,159,279,2,110,3,1,0,195,8,7,159,279,2,110,0,1,0,195,8,7,160,280,2,111,3,1,0,193,8,7,160,280,2,111,0,1,0,193,8,7,446,558,14,369,32,11,11,613,8,7,447,589,14,456,32,11,11,515,8,7,448,585,14,454,32,11,11,494,8,7,48,290,2,167,3,1,0,236,8,7,48,290,2,167,0,1,0,236,8,7,162,296,2,74,3,1,0,204,8,7,162,296,2,74,0,1,0,204,8,7,163,263,2,72,3,1,0,234,8,7,163,263,2,72,0,1,0,234,8,7,164,264,2,73,3,1,0,232,8,7,164,264,2,73,0,1,0,232,8,7,165,285,2,151,3,3,0,219,8,7,165,285,2,151,0,3,0,219,8,7,166,295,2,172,1,0,11,238,8,7,166,295,2,172,0,0,11,238,49,43,22,256,2,173,3,1,0,254,49,43,22,256,2,173,0,1,0,254,49,43,27,615,4,415,0,1,0,610,49,43,36,513,4,396,0,1,0,511,6,5,394,604,4,1,0,1,0,605,6,5,115,318,2,85,342,1,70,255,6,5,115,318,2,85,344,1,70,255,6,5,58,229,2,129,3,1,0,231,6,5,58,229,2,129,0,1,0,231,6,5,59,320,2,127,3,1,0,319,6,5,59,320,2,127,0,1,0,319,6,5,62,329,2,116,3,1,0,299,6,5,62,329,2,116,0,1,0,299,6,5,131,316,2,169,3,1,0,315,6,5,131,316,2,169,0,1,0,315,6,5,45,180,2,170,3,1,0,187,6,5,45,180,2,170,0,1,0,187,6,5,63,226,2,171,3,1,0,182,6,5,63,226,2,171,0,1,0,182,6,5,64,460,14,1,32,11,11,459,6,5,135,544,4,345,0,1,0,509,6,5,65,588,4,15,0,1,0,458,6,5,136,317,2,42,1,0,11,211,6,5,136,317,2,42,0,0,11,211,6,5,137,293,2,178,3,3,0,199,6,5,137,293,2,178,0,3,0,199,6,5,413,556,4,354,0,1,0,466,6,5,138,273,2,5,1,1,0,297,6,5,138,273,2,5,0,1,0,297,6,5,414,555,14,457,0,0,11,508,6,5,139,326,2,103,3,1,0,323,6,5,139,326,2,103,0,1,0,323,6,5,140,325,2,101,21,1,0,324,6,5,140,325,2,101,20,1,0,324,6,5,143,289,2,154,3,3,0,214,6,5,143,289,2,154,0,3,0,214,6,5,144,288,2,153,3,3,0,213,6,5,144,288,2,153,0,3,0,213,6,5,145,266,2,76,3,1,0,259,6,5,145,266,2,76,0,1,0,259,6,5,146,261,2,12,1,1,0,222,6,5,146,261,2,12,0,1,0,222,6,5,427,547,4,15,0,1,0,463,6,5,428,548,14,1,32,11,11,464,6,5,429,554,4,15,0,1,0,517,6,5,430,545,14,15,20,11,11,514,6,5,432,557,14,15,343,11,11,462,6,5,147,292,2,174,1,1,0,188,6,5,147,292,2,174,0,1,0,188,6,5,148,262,2,175,3,1,0,249,6,5,148,262,2,175,0,1,0,249,6,5,440,591,14,347,0,11,11,473,6,5,441,590,4,1,0,1,0,609,6,5,48,287,2,152,3,3,0,215,6,5,48,287,2,152,0,3,0,215,10,9,29,550,14,348,1,1,0,597,10,9,36,551,14,349,1,1,0,599,10,9,38,552,14,350,1,1,0,598,10,9,39,553,14,351,1,1,0,600,10,9,30,549,4,15,0,1,0,601,10,9,105,579,4,443,0,1,0,507,10,9,117,286,2,15,3,3,0,218,10,9,117,286,2,15,0,3,0,218,10,9,58,559,4,416,0,1,0,472,10,9,59,560,4,417,0,1,0,606,10,9,397,561,4,418,0,1,0,607,10,9,398,562,4,419,0,1,0,608,10,9,399,563,4,420,0,1,0,518,10,9,400,564,4,421,0,1,0,467,10,9,401,565,4,422,0,1,0,468,10,9,402,566,4,423,0,1,0,469,10,9,60,567,4,424,0,1,0,470,10,9,61,568,4,425,0,1,0,471,10,9,62,569,4,426,0,1,0,496,10,9,403,570,4,431,0,1,0,497,10,9,404,571,4,433,0,1,0,498,10,9,405,572,4,434,0,1,0,499,10,9,406,573,4,435,0,1,0,500,10,9,407,574,4,436,0,1,0,501,10,9,408,575,4,437,0,1,0,502,10,9,409,576,4,438,0,1,0,503,10,9,410,577,4,439,0,1,0,504,10,9,411,578,4,442,0,1,0,505,10,9,128,267,2,15,3,3,0,191,10,9,128,267,2,15,0,3,0,191,10,9,47,284,2,15,3,3,0,225,10,9,47,284,2,15,0,3,0,225,18,16,22,185,2,90,3,1,0,183,18,16,22,185,2,90,0,1,0,183,18,16,27,245,2,91,3,3,0,258,18,16,27,245,2,91,0,3,0,258,18,16,29,221,2,92,3,1,0,220,18,16,29,221,2,92,0,1,0,220,18,16,36,246,2,93,3,1,0,300,18,16,36,246,2,93,0,1,0,300,18,16,38,274,2,94,21,1,33,301,18,16,38,274,2,94,20,1,33,301,18,16,39,582,14,449,1,1,0,593,18,16,51,583,14,452,1,0,11,506,18,16,30,584,14,453,1,1,0,512,18,16,40,282,2,141,3,1,0,328,18,16,40,282,2,141,0,1,0,328,18,16,52,283,2,142,3,1,0,212,18,16,52,283,2,142,0,1,0,212,13,12,30,542,4,368,0,1,0,530,13,12,40,543,4,357,0,1,0,531,13,12,52,541,4,367,0,1,0,529,13,12,105,532,4,358,0,1,0,520,13,12,381,533,4,359,0,1,0,521,13,12,382,534,4,360,0,1,0,522,13,12,383,535,4,361,0,1,0,523,13,12,384,536,4,362,0,1,0,524,13,12,385,537,4,363,0,1,0,525,13,12,386,538,4,364,0,1,0,526,13,12,387,539,4,365,0,1,0,527,13,12,388,540,4,366,0,1,0,528,13,12,389,484,4,370,0,1,0,474,13,12,390,485,4,371,0,1,0,475,13,12,391,486,4,372,0,1,0,476,13,12,392,487,4,373,0,1,0,477,13,12,53,488,4,374,0,1,0,478,13,12,54,489,4,375,0,1,0,479,13,12,55,490,4,376,0,1,0,480,13,12,56,491,4,377,0,1,0,481,13,12,57,492,4,378,0,1,0,482,13,12,393,493,4,379,0,1,0,483,31,28,22,594,4,380,0,1,0,465,31,28,30,207,2,78,3,1,0,235,31,28,30,207,2,78,0,1,0,235,31,28,40,208,2,77,21,1,68,206,31,28,40,208,2,77,20,1,68,206,31,28,114,305,2,104,1,1,0,312,31,28,114,305,2,104,0,1,0,312,24,23,60,268,2,88,21,1,69,184,24,23,60,268,2,88,20,1,69,184,24,23,61,270,2,86,3,1,0,247,24,23,61,270,2,86,0,1,0,247,24,23,133,272,2,89,3,1,0,302,24,23,133,272,2,89,0,1,0,302,24,23,134,271,2,87,3,1,0,298,24,23,134,271,2,87,0,1,0,298,24,23,149,592,14,15,0,11,11,596,24,23,161,260,2,71,3,1,0,309,24,23,161,260,2,71,0,1,0,309,24,23,450,546,4,346,0,1,0,510,24,23,451,581,14,445,32,11,11,595,303,41,27,307,2,102,3,1,0,308,303,41,27,307,2,102,0,1,0,308,306,176,22,314,2,41,1,1,0,313,306,176,22,314,2,41,0,1,0,313,66,50,36,186,2,125,21,1,33,310,66,50,36,186,2,125,20,1,33,310,66,50,39,586,14,455,0,1,0,516,19,17,130,257,2,177,3,1,0,330,19,17,130,257,2,177,0,1,0,330,19,17,45,337,2,95,1,1,0,333,19,17,45,337,2,95,0,1,0,333,19,17,63,612,4,355,0,1,0,611,19,17,46,340,2,97,21,1,67,336,19,17,46,340,2,97,20,1,67,336,19,17,132,338,2,98,21,1,0,334,19,17,132,338,2,98,20,1,0,334,19,17,64,339,2,99,3,1,0,335,19,17,64,339,2,99,0,1,0,335,19,17,47,311,2,100,3,1,0,304,19,17,47,311,2,100,0,1,0,304,19,17,412,614,4,356,0,1,0,495,19,17,65,341,2,96,1,1,0,217,19,17,65,341,2,96,0,1,0,217,19,17,149,587,2,15,0,1,0,519],"strings":["1","0","TUMB","-1","BTN","22","FLIGHTDATAUNIT","18","ENGINEPANEL","31","FR22","","12","NAVIGATION","LEV","-666","17","2","LIGHTS","WEAPON_SYSTEM","0.1","-0.1","3001","5","RADAR","28","COUNTERMEASURE","3002","23","3003","3008","NAVIGATIONPANEL","0.001","0.2","0.4","19","3004","ELECTRICSYSTEM","3005","3006","3009","20","21","26","3000","3302","3304","3307","3918","ERRORPANEL","24","3007","3010","3024","3025","3026","3027","3028","3200","3201","3208","3209","3210","3303","3306","3402","RWR","0.5","0.6","0.7","1.0000000002","1006","1203","1204","1206","13","176","200","201","202","203","204","205","206","207","209","214","216","217","218","250","251","252","253","254","260","262","264","265","266","267","282","283","285","300","3011","302","303","304","305","306","307","309","310","3101","3107","311","3110","312","313","316","317","318","319","320","321","322","323","3230","324","3300","3301","3305","3328","3350","3401","3405","3406","3408","3511","3512","3554","3555","3716","3717","3718","3719","3741","3742","3800","3805","384","388","389","390","3905","3906","3907","3908","3909","3910","3914","3919","3920","3921","3924","3925","395","398","401","402","403","4200","446","493","666","7","8","9","AFK Lever","ATT-PTR","Abfuelvalve-PTR","Altitude Hold","Anti Collision Lights","Anti Jamming Mode (AS) Selector","Antikljus-PTR","App27-PTR","Attitude Hold","Autopilot Yaw Trim Cover","Backup Generator","Backupgen-PTR","Base Selector","CB Autopilot SA","CB CB Engine","CB CI/SI","CB Ejection System","CB High Alpha Warning","CB Trim System","Cabin Air Valve","Canopy Open/Close","Countermeasure Chaff/Flares Selector","Countermeasure Dispense","Countermeasure Operation Mode Selector","Countermeasure Streak Mode Selector","DME Selector","DOPPLER","Datapanel Selector","DatapanelINUT-PTR","Datarot-PTR","Deice-PTR","Doppler Land/Sea Mode","Ejection Seat Arm","Emergency Lights","Emergency Pitch Trim","Emergency Roll Trim","Emergency Yaw Trim","Engine De-Ice","External Tank Release Cover","FR22 Mode Selector","Flight Recorder","Formation Lights","Formljus-PTR","Gear Handle","Gen-PTR","Generator","Group Selector","HOJD-PTR","HTK-PTR","High-pressure Fuel Valve","HojdSI-PTR","HuvudS-PTR","HÃJD CISI","IFF Channel Selector","IFF Code","IFF/Transponder Power","IN/OUT Switch","Ignition Coils","Ignition System","Insert/Remove Data Cartridge","Jammer Band Selector","Jammer Operation Mode Selector","KBsel1-PTR","KBsel2-PTR","KBsel3-PTR","LTKran-PTR","Lanternljus-PTR","Ledljus-PTR","Lin/Log Radar Gain Switch","Low-pressure Fuel Valve","Magnetic Declination Cover","Main Electric Power","Manbreg-PTR","Manual Afterburner Fuel Regulator","Manual Fuel Regulator","Master Caution Reset","Master Mode Selector","MasterC-PTR","Mastersafe-PTR","Navigation Lights","Oxygen Lever","PNT_1006","PNT_12","PNT_1200","PNT_1203","PNT_1204","PNT_13","PNT_176","PNT_2002","PNT_212","PNT_213","PNT_214","PNT_216","PNT_218","PNT_22","PNT_254","PNT_302","PNT_303","PNT_304","PNT_305","PNT_306","PNT_307","PNT_308","PNT_3554","PNT_3555","PNT_360","PNT_384","PNT_386","PNT_388","PNT_389","PNT_390","PNT_395","PNT_398","PNT_493","PNT_9","PNT_CMEASURES","PNT_DATA","PNT_DME_TILL_FRAN","Parking Brake","Passive Recce On/Off Switch","Pitch Gear Automatic/Landing","Position Lights","Position Lights Brightness","Pulse Normal/Short Switch","RADARALT","RB-04/RB-15/BK Release Mode Switch - MALVAL/PREP","RENSACVR-PTR","REVERSAL","RHMtill-PTR","Radar Altimeter Power","Radar/EL Maintenance Test","Radarwarning Indication Selector","Rb04tgt-PTR","Rensa Button Cover","Reverser Handle","Revhd-PTR","SPAK","SPAK-PTR","Seatsafe-PTR","Skede-PTR","Slav SI","SlavSI-PTR","Start System","StartS-PTR","TILS Channel Layer Selection","TILS Channel Selection","TILSSLCT-PTR","TILSmodeswitch-PTR","TandS-PTR","Taxi/Landing Lights","Tippvax-PTR","Trigger Safety Bracket","U22sel1-PTR","U22sel2-PTR","Weapon Emergency Release Cover","Weapon Interval Selector Mode Knob - Siktningvaljare","Weapon Release Mode Switch - Fallsattomkopplare","Weapon Selector Knob - J/A Valjare","WepEmRCvr-PTR","WepINT-PTR","WepRelmode-PTR","WepSEL-PTR","XTCVR-PTR","-0.1666666667","0.01","0.1666666667","11","1205","135","171","172","173","174","1e-05","208","210","261","263","270","271","272","273","274","275","276","277","278","279","280","281","286","290","291","292","293","294","295","296","297","298","299","301","3012","3013","3014","3015","3016","3017","3018","3019","3020","3021","3022","3023","3029","3091","3112","315","3202","3203","3204","3205","3206","3207","3211","3212","3213","3214","3215","3216","3217","3218","3219","3320","3407","3409","344","362","363","364","365","366","367","368","369","370","371","372","3720","3721","3722","3724","373","3732","374","375","376","377","378","379","380","3801","3802","381","382","385","391","3912","3913","3917","392","3922","3923","393","394","396","399","675","9999","AFK Mode 3","Altimeter Setting","AltsetL-PTR","Aterstart-PTR","Autopilot Yaw Trim","Backup ADI Cage","Backup Altimeter Setting","CK37 Rensa (Clear)","Canopy Jettison","Channel A/G","Channel B","Channel C/F","Channel C2","Channel D/E","Channel H","Clock Setting","Datapanel Key 0","Datapanel Key 1","Datapanel Key 2","Datapanel Key 3","Datapanel Key 4","Datapanel Key 5","Datapanel Key 6","Datapanel Key 7","Datapanel Key 8","Datapanel Key 9","Datapanel00-PTR","Datapanel01-PTR","Datapanel02-PTR","Datapanel03-PTR","Datapanel04-PTR","Datapanel05-PTR","Datapanel06-PTR","Datapanel07-PTR","Datapanel08-PTR","Datapanel09-PTR","Drysuit Ventilation Adjustment","External Tank Release Button","Flight 0","Flight 1","Flight 2","Flight 3","Flight 4","Flight 5","Flight 6","Flight 7","Flight 8","Flight 9","Flood Lights","Ground Intercom","HUD Brightness Knob","HUD Reflector Glass Position","IFF Identification","Indicator System Test","Instrument Lights","Kontroll-PTR","Magnetic Declination Correction","Maintenance Testing Mode","Master Volume / Sidewinder Tone","Max G Reset","Minus","Missile Select Button (IR-RB FRAMSTEGN)","Navigation Selector Button B1","Navigation Selector Button B2","Navigation Selector Button B3","Navigation Selector Button B4","Navigation Selector Button B5","Navigation Selector Button B6","Navigation Selector Button B7","Navigation Selector Button B8","Navigation Selector Button B9","Navigation Selector Button BX","Navigation Selector Button L MÃL","Navigation Selector Button LS","NavselB1-PTR","NavselB2-PTR","NavselB3-PTR","NavselB4-PTR","NavselB5-PTR","NavselB6-PTR","NavselB7-PTR","NavselB8-PTR","NavselB9-PTR","NavselBX-PTR","NavselLMAL-PTR","NavselLS-PTR","PNT_11","PNT_1201","PNT_1205","PNT_123","PNT_126","PNT_170","PNT_171","PNT_172","PNT_173","PNT_174","PNT_175","PNT_180","PNT_210","PNT_211","PNT_286","PNT_362","PNT_363","PNT_364","PNT_365","PNT_366","PNT_367","PNT_368","PNT_369","PNT_370","PNT_371","PNT_372","PNT_373","PNT_374","PNT_375","PNT_376","PNT_377","PNT_378","PNT_379","PNT_380","PNT_381","PNT_382","PNT_385","PNT_391","PNT_392","PNT_393","PNT_394","PNT_396","PNT_399","PNT_400","PNT_464","PNT_675","PNT_CLOCK_RIGHT","PNT_CLOCK_RIGHT001","PNT_POOP","Panel Lights","RENSA-PTR","Radar Brightness","Radar Night Filter","Radio Manual Frequency Setting Knob Inner Left","Radio Manual Frequency Setting Knob Inner Right","Radio Manual Frequency Setting Knob Outer Left","Radio Manual Frequency Setting Knob Outer Right","Radio Manual Frequency Setting Modulation","Radio Volume","Restart","SnabbresM-PTR","Snabbresning","Special 1","Special 2","Special 3","Stopwatch Start/Stop/Reset","Warning Panel Light Test","Weapon Emergency Release Button","WepEmR-PTR","Windscreen De-Ice","XTREL-PTR","warnpanelcheck-PTR"]});
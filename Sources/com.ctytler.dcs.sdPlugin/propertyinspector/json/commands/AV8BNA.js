@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"AV8BNA","rows":[21,20,160,434,2,247,4,1,0,268,21,20,160,434,2,247,0,1,0,268,21,20,161,435,2,248,4,1,0,325,21,20,161,435,2,248,0,1,0,325,21,20,162,436,2,249,4,1,0,327,21,20,162,436,2,249,0,1,0,327,21,20,163,437,2,250,4,1,0,326,21,20,163,437,2,250,0,1,0,326,21,20,164,438,2,251,4,1,0,328,21,20,164,438,2,251,0,1,0,328,21,20,165,439,2,252,4,1,0,269,21,20,165,439,2,252,0,1,0,269,21,20,166,440,2,253,4,1,0,329,21,20,166,440,2,253,0,1,0,329,21,20,167,441,2,254,4,4,0,330,21,20,167,441,2,254,0,4,0,330,21,20,169,443,2,256,4,1,0,320,21,20,169,443,2,256,0,1,0,320,21,20,170,444,2,257,4,4,0,319,21,20,170,444,2,257,0,4,0,319,760,482,725,977,5,759,0,1,0,765,13,12,115,389,2,202,18,1,0,314,13,12,115,389,2,202,19,1,0,314,13,12,703,956,3,738,0,1,0,767,13,12,129,403,2,216,4,1,0,322,13,12,129,403,2,216,0,1,0,322,13,12,706,959,3,741,0,1,0,775,13,12,131,405,2,218,4,1,0,345,13,12,131,405,2,218,0,1,0,345,13,12,133,407,2,220,1,1,0,471,13,12,133,407,2,220,0,1,0,471,13,12,137,411,2,224,4,1,0,304,13,12,137,411,2,224,0,1,0,304,13,12,138,412,2,225,18,1,0,305,13,12,138,412,2,225,19,1,0,305,13,12,139,413,2,226,18,1,0,306,13,12,139,413,2,226,19,1,0,306,13,12,140,414,2,227,18,1,0,273,13,12,140,414,2,227,19,1,0,273,13,12,141,415,2,228,4,1,0,302,13,12,141,415,2,228,0,1,0,302,13,12,142,416,2,229,4,1,0,303,13,12,142,416,2,229,0,1,0,303,13,12,147,421,2,234,4,1,0,313,13,12,147,421,2,234,0,1,0,313,13,12,149,423,2,236,4,1,0,294,13,12,149,423,2,236,0,1,0,294,13,12,150,424,2,237,4,1,0,293,13,12,150,424,2,237,0,1,0,293,13,12,151,425,2,238,4,1,0,307,13,12,151,425,2,238,0,1,0,307,13,12,152,426,2,239,4,1,0,287,13,12,152,426,2,239,0,1,0,287,288,65,109,383,2,196,4,1,0,289,288,65,109,383,2,196,0,1,0,289,28,27,146,420,2,233,4,1,0,350,28,27,146,420,2,233,0,1,0,350,28,27,723,976,5,758,1,1,0,995,28,27,172,446,3,259,4,4,1,310,28,27,172,446,3,259,0,1,0,310,28,27,173,447,2,260,18,1,0,280,28,27,173,447,2,260,19,1,0,280,28,27,174,448,2,261,18,1,0,272,28,27,174,448,2,261,19,1,0,272,28,27,175,449,2,262,18,1,0,281,28,27,175,449,2,262,19,1,0,281,55,53,649,906,5,547,1,1,0,773,55,53,176,450,2,263,4,1,0,292,55,53,176,450,2,263,0,1,0,292,30,0,153,427,2,240,18,1,0,286,30,0,153,427,2,240,19,1,0,286,30,0,154,428,2,241,18,1,0,271,30,0,154,428,2,241,19,1,0,271,30,0,155,429,2,242,4,1,0,296,30,0,155,429,2,242,0,1,0,296,30,0,156,430,2,243,18,1,0,311,30,0,156,430,2,243,19,1,0,311,30,0,157,431,2,244,18,1,0,279,30,0,157,431,2,244,19,1,0,279,43,42,88,359,2,74,58,1,0,290,43,42,88,359,2,74,61,1,0,290,43,42,89,360,2,75,58,1,0,323,43,42,89,360,2,75,61,1,0,323,43,42,654,911,3,552,0,1,0,791,7,6,38,960,5,742,1,1,0,996,7,6,38,961,5,743,1,1,0,839,7,6,38,408,2,221,1,1,0,336,7,6,38,408,2,221,0,1,0,336,7,6,114,388,2,201,1,1,0,295,7,6,114,388,2,201,0,1,0,295,7,6,702,955,3,737,0,1,0,781,7,6,118,392,2,205,18,1,0,276,7,6,118,392,2,205,19,1,0,276,7,6,119,393,2,206,1,1,0,334,7,6,119,393,2,206,0,1,0,334,7,6,120,394,2,207,1,1,0,333,7,6,120,394,2,207,0,1,0,333,7,6,121,395,2,208,18,1,0,461,7,6,121,395,2,208,19,1,0,461,7,6,123,397,2,210,4,1,0,458,7,6,123,397,2,210,0,1,0,458,7,6,124,398,2,211,4,1,0,274,7,6,124,398,2,211,0,1,0,274,7,6,125,399,2,212,18,1,0,270,7,6,125,399,2,212,19,1,0,270,7,6,126,400,2,213,4,1,0,468,7,6,126,400,2,213,0,1,0,468,7,6,127,401,2,214,4,1,0,467,7,6,127,401,2,214,0,1,0,467,7,6,128,402,2,215,4,1,0,466,7,6,128,402,2,215,0,1,0,466,7,6,130,404,3,217,4,1,0,465,7,6,130,404,3,217,0,4,1,465,7,6,132,406,2,219,1,1,0,455,7,6,132,406,2,219,0,1,0,455,7,6,179,452,2,265,4,1,0,48,7,6,179,452,2,265,0,1,0,48,7,6,180,453,2,266,4,1,0,48,7,6,180,453,2,266,0,1,0,48,7,6,181,454,2,267,4,1,0,282,7,6,181,454,2,267,0,1,0,282,49,46,690,367,3,709,0,1,0,278,49,46,691,367,5,710,1,4,0,278,49,46,111,385,2,198,4,1,0,457,49,46,111,385,2,198,0,1,0,457,56,54,94,368,2,177,59,60,45,308,56,54,94,368,2,177,62,60,45,308,56,54,693,946,5,726,1,1,0,766,35,33,91,362,2,77,18,1,0,317,35,33,91,362,2,77,19,1,0,317,35,33,655,912,5,553,1,1,0,782,35,33,92,363,2,78,18,1,0,316,35,33,92,363,2,78,19,1,0,316,35,33,656,913,5,554,1,1,0,783,35,33,657,914,5,555,1,1,0,784,35,33,93,364,2,79,4,1,0,315,35,33,93,364,2,79,0,1,0,315,50,47,717,970,5,752,1,1,0,786,50,47,718,971,5,753,1,1,0,787,50,47,168,442,2,255,18,1,0,318,50,47,168,442,2,255,19,1,0,318,29,26,122,396,2,209,18,1,0,335,29,26,122,396,2,209,19,1,0,335,29,26,136,410,2,223,18,1,0,298,29,26,136,410,2,223,19,1,0,298,29,26,711,964,5,746,1,1,0,780,29,26,143,417,2,230,18,1,0,456,29,26,143,417,2,230,19,1,0,456,29,26,144,418,2,231,4,1,0,275,29,26,144,418,2,231,0,1,0,275,29,26,145,419,2,232,4,1,0,297,29,26,145,419,2,232,0,1,0,297,23,22,578,847,5,485,1,4,0,31,23,22,579,848,5,486,1,4,0,31,23,22,580,849,5,487,1,4,0,31,23,22,581,850,5,488,1,4,0,31,23,22,582,851,5,489,1,4,0,31,23,22,583,852,5,490,1,4,0,31,23,22,584,853,5,491,1,4,0,31,23,22,585,854,5,492,1,4,0,31,23,22,586,855,5,493,1,4,0,31,23,22,587,856,5,494,1,4,0,31,23,22,171,445,3,258,0,1,0,285,23,22,171,445,2,258,4,4,1,285,23,22,719,972,5,754,1,1,0,789,23,22,720,973,5,755,1,1,0,771,23,22,721,974,5,756,1,1,0,779,23,22,722,975,5,757,1,1,481,764,332,134,596,859,3,500,0,1,0,834,332,134,597,860,3,501,0,1,0,835,16,14,594,857,5,498,1,1,0,812,16,14,599,861,3,502,0,1,0,792,16,14,600,862,3,503,0,1,0,803,16,14,601,863,3,504,0,1,0,805,16,14,602,864,3,505,0,1,0,806,16,14,603,865,3,506,0,1,0,807,16,14,604,866,3,507,0,1,0,808,16,14,605,867,3,508,0,1,0,809,16,14,606,868,3,509,0,1,0,810,16,14,607,869,3,510,0,1,0,811,16,14,608,870,3,511,0,1,0,793,16,14,610,871,3,512,0,1,0,794,16,14,611,872,3,513,0,1,0,795,16,14,612,873,3,514,0,1,0,796,16,14,613,874,3,515,0,1,0,797,16,14,614,875,3,516,0,1,0,798,16,14,615,876,3,517,0,1,0,799,16,14,616,877,3,518,0,1,0,800,16,14,617,878,3,519,0,1,0,801,16,14,618,879,3,520,0,1,0,802,16,14,619,880,3,521,0,1,0,804,16,14,80,351,3,66,4,4,1,338,16,14,80,351,3,66,0,1,0,338,16,14,81,352,3,67,4,4,1,340,16,14,81,352,3,67,0,1,0,340,16,14,82,353,3,68,4,4,1,339,16,14,82,353,3,68,0,1,0,339,16,14,83,354,3,69,4,4,1,337,16,14,83,354,3,69,0,1,0,337,17,15,595,858,5,499,1,1,0,833,17,15,621,881,3,522,0,1,0,813,17,15,622,882,3,523,0,1,0,824,17,15,623,883,3,524,0,1,0,826,17,15,624,884,3,525,0,1,0,827,17,15,625,885,3,526,0,1,0,828,17,15,626,886,3,527,0,1,0,829,17,15,628,887,3,528,0,1,0,830,17,15,629,888,3,529,0,1,0,831,17,15,630,889,3,530,0,1,0,832,17,15,631,890,3,531,0,1,0,814,17,15,632,891,3,532,0,1,0,815,17,15,633,892,3,533,0,1,0,816,17,15,634,893,3,534,0,1,0,817,17,15,635,894,3,535,0,1,0,818,17,15,636,895,3,536,0,1,0,819,17,15,637,896,3,537,0,1,0,820,17,15,639,897,3,538,0,1,0,821,17,15,640,898,3,539,0,1,0,822,17,15,641,899,3,540,0,1,0,823,17,15,642,900,3,541,0,1,0,825,17,15,84,355,3,70,4,4,1,342,17,15,84,355,3,70,0,1,0,342,17,15,85,356,3,71,4,4,1,344,17,15,85,356,3,71,0,1,0,344,17,15,86,357,3,72,4,4,1,343,17,15,86,357,3,72,0,1,0,343,17,15,87,358,3,73,4,4,1,341,17,15,87,358,3,73,0,1,0,341,25,24,651,908,3,549,0,1,0,761,25,24,652,909,3,550,0,1,0,837,25,24,653,910,3,551,0,1,0,1015,25,24,110,384,2,197,18,1,0,291,25,24,110,384,2,197,19,1,0,291,25,24,112,386,2,199,18,1,0,348,25,24,112,386,2,199,19,1,0,348,25,24,135,409,3,222,4,1,0,469,25,24,135,409,3,222,0,4,1,469,25,24,178,451,2,264,4,1,0,470,25,24,178,451,2,264,0,1,0,470,25,24,731,845,3,483,0,1,0,992,25,24,732,846,3,484,0,1,0,991,40,39,107,381,2,194,4,1,0,475,40,39,107,381,2,194,0,1,0,475,40,39,108,382,2,195,4,1,0,474,40,39,108,382,2,195,0,1,0,474,40,39,113,387,2,200,4,1,0,299,40,39,113,387,2,200,0,1,0,299,57,52,692,945,5,724,0,1,0,836,57,52,106,380,2,193,476,1,63,321,57,52,106,380,2,193,478,1,63,321,44,41,643,901,3,542,0,1,0,843,44,41,644,902,3,543,0,1,0,844,44,41,646,903,3,544,0,1,0,840,44,41,647,904,3,545,0,1,0,841,44,41,648,905,3,546,0,1,0,842,36,34,712,965,5,747,1,1,0,1014,36,34,713,966,5,748,1,1,0,1012,36,34,158,432,2,245,51,51,0,473,36,34,158,432,2,245,480,51,0,473,36,34,714,967,3,749,0,1,0,1010,36,34,715,968,3,750,0,1,0,1011,36,34,159,433,2,246,477,1,64,472,36,34,159,433,2,246,479,1,64,472,36,34,716,969,3,751,0,1,0,1013,979,497,650,907,5,548,1,1,0,978,11,10,90,361,2,76,4,1,0,347,11,10,90,361,2,76,0,1,0,347,11,10,95,369,2,182,59,1,45,346,11,10,95,369,2,182,62,1,45,346,11,10,96,370,3,183,4,4,1,277,11,10,96,370,3,183,0,1,0,277,11,10,97,371,3,184,4,4,1,309,11,10,97,371,3,184,0,1,0,309,11,10,98,372,3,185,4,4,1,459,11,10,98,372,3,185,0,1,0,459,11,10,99,373,3,186,4,4,1,460,11,10,99,373,3,186,0,1,0,460,11,10,100,374,3,187,4,4,1,349,11,10,100,374,3,187,0,1,0,349,11,10,101,375,3,188,4,4,1,462,11,10,101,375,3,188,0,1,0,462,11,10,102,376,3,189,4,4,1,463,11,10,102,376,3,189,0,1,0,463,11,10,103,377,3,190,4,4,1,464,11,10,103,377,3,190,0,1,0,464,11,10,104,378,2,191,18,4,0,324,11,10,104,378,2,191,19,4,0,324,11,10,694,947,3,727,0,1,0,790,11,10,695,948,3,728,0,1,0,984,11,10,696,949,3,729,0,1,0,985,11,10,697,950,3,730,0,1,0,986,11,10,698,951,3,733,0,1,0,987,11,10,699,952,3,734,0,1,0,988,11,10,700,953,3,735,0,1,0,989,11,10,701,954,3,736,0,1,0,990,11,10,105,379,2,192,4,1,0,312,11,10,105,379,2,192,0,1,0,312,11,10,704,957,3,739,0,1,0,777,9,8,590,365,3,495,0,1,0,283,9,8,591,366,3,496,0,1,0,284,9,8,658,915,3,556,0,1,0,997,9,8,659,916,5,557,1,1,0,772,9,8,660,917,3,558,0,1,0,994,9,8,661,918,3,559,0,1,0,785,9,8,662,919,5,560,1,1,0,769,9,8,663,920,5,561,1,1,0,770,9,8,664,365,5,562,1,1,0,283,9,8,665,366,5,563,1,1,0,284,9,8,666,921,3,564,0,1,0,1001,9,8,667,922,3,565,0,1,0,1002,9,8,668,923,3,566,0,1,0,1003,9,8,669,924,3,567,0,1,0,768,9,8,670,925,3,568,0,1,0,1004,9,8,671,926,3,569,0,1,0,1005,9,8,672,927,3,570,0,1,0,1006,9,8,673,928,3,571,0,1,0,983,9,8,674,929,3,572,0,1,0,1007,9,8,675,930,3,573,0,1,0,1008,9,8,676,931,3,574,0,1,0,1009,9,8,677,932,3,575,0,1,0,998,9,8,678,933,3,576,0,1,0,776,9,8,679,934,3,577,0,1,0,1000,9,8,680,935,3,588,0,1,0,999,9,8,681,936,3,589,0,1,0,980,9,8,682,937,3,592,0,1,0,788,9,8,683,938,3,593,0,1,0,993,9,8,684,939,3,598,0,1,0,762,9,8,685,940,3,609,0,1,0,1017,9,8,686,941,3,620,0,1,0,1016,9,8,687,942,3,627,0,1,0,981,9,8,688,943,3,638,0,1,0,763,9,8,689,944,3,645,0,1,0,774,37,32,116,390,2,203,18,1,0,300,37,32,116,390,2,203,19,1,0,300,37,32,117,391,2,204,18,1,0,301,37,32,117,391,2,204,19,1,0,301,37,32,705,958,3,740,0,1,0,778,37,32,707,962,5,744,1,0,38,838,37,32,708,963,5,745,1,0,38,982,37,32,148,422,2,235,4,1,0,331,37,32,148,422,2,235,0,1,0,331],"strings":["1","0","TUMB","BTN","-1","LEV","28","FLIGHTCONTROLS","23","UFCCONTROL","29","SMC","9","DECS","26","27","MPCD_LEFT","MPCD_RIGHT","-0.5","0.5","8","ACNIP","34","LTINT","12","MSC","33","36","ECS","LTEXT","ELECTRIC","Flood Lamp","13","22","7","HUDCONTROL","RSC","VREST","","14","NAVFLIR","24","30","EWS","ODUCONTROL","0.99","19","4","Canopy Handle","FLIGHTINSTRUMENTS","INTERCOM","-0.2","11","20","21","EDP","FQIS","NAV_INS","-0.25","-0.33","-0.99","0.25","0.33","0.7","1.05","16","220","221","222","223","244","245","246","247","274","275","287","288","290","293","3220","3221","3222","3223","3244","3245","3246","3247","3274","3275","3287","3288","3290","3293","3379","3395","3396","3397","3398","3399","3400","3401","3402","3403","3404","3420","3421","3422","3423","3424","3425","3426","3427","3429","3447","3449","3454","3457","3459","3461","3470","3471","3472","3475","3476","3477","3478","3479","3480","3481","3483","3484","3489","3490","35","3502","3503","3504","3505","3506","3507","3508","3509","3511","3512","3513","3514","3515","3516","3517","3518","3519","3520","3609","3610","3611","3612","3613","3616","3619","3621","3622","3623","3624","3625","3626","3627","3628","3631","3632","3633","3634","3640","3641","3642","3643","3655","379","3800","3801","3802","3803","395","396","397","398","399","400","401","402","403","404","420","421","422","423","424","425","426","427","429","447","449","454","457","459","461","470","471","472","475","476","477","478","479","480","481","483","484","489","490","501","502","503","504","505","506","507","508","509","511","512","513","514","515","516","517","518","519","520","609","610","611","612","613","616","619","621","622","623","624","625","626","627","628","631","632","633","634","640","641","642","643","655","800","801","802","803","ACNIP Mode Switch","ACNIP Radio Selector Switch","AFC Switch","APU Generator Switch","Aft Equipment Bay ECS Switch","Air Refueling Probe Switch","Alt Hold Switch","Anti-Collision Lights Switch","Anti-Skid Switch","Armament Mode Control","Backup ADI Cage/Pitch Adjust Knob","Battery Switch","Cabin Defog Switch","Cabin Pressure Switch","Canopy Locking Lever","Comm 1 Channel Selector","Comm 2 Channel Selector","Compass Light/Test Lights","DC Test Switch","DECS Switch","DMT","DMT Toggle On/Off","Decoy Dispenser Control","Display Computer Mode Selector Switch","EDP BIT Button","EFC Switch","ENG RPM Switch","Emergency Landing Gear Lever","Engine Start Switch","External Auxiliary Lights Switch","External Lights Mode Switch","FLIR Power Switch","Flaps Mode Switch","Flaps Power Switch","Fuel Dump L Switch","Fuel Dump R Switch","Fuel Proportioner","Fuel Pump L Switch","Fuel Pump R Switch","Fuel Shutoff Lever","Fuel Totalizer Selector","Fuzing Control","Fwd Equipment Bay ECS Switch","Generator Switch","Ground IR Cool Switch","H2O Dump Switch","H2O Mode Switch","HUD Altitude Selector Switch","HUD Display Mode Switch","HUD Symbology Reject Switch","ICS Mic Operational Mode Switch","IFF Crypto Mode Switch","IFF Operational Mode Switch","INS Mode Knob","JPTL Switch","Jammer Control","Jettison Mode Selector","KY-1 Cipher Type Selector Switch","KY-1 Code/Mode Switch","KY-2 Cipher Type Selector Switch","KY-2 Code/Mode Switch","KY-58 Codes Clear Switch","KY-58 Remote Codes Load Switch","LIDS Switch","LTWCA","Landing Gear Emergency Battery Lever","Landing Gear Lever","Landing/Taxi Lights Switch","MFS Emergency Lever","MPCD Left Display Contrast","MPCD Left Display DAY/NIGHT Mode","MPCD Left Display Gain","MPCD Left Display Symbology","MPCD Right Display Contrast","MPCD Right Display DAY/NIGHT Mode","MPCD Right Display Gain","MPCD Right Display Symbology","Manual Fuel Switch","Manual Release Control Knob","Master Arm Switch","Mission Computer Mode Switch","Multiple Release Control","Oxygen Switch","PTN_220","PTN_221","PTN_222","PTN_223","PTN_244","PTN_245","PTN_246","PTN_247","PTN_274","PTN_275","PTN_287","PTN_288","PTN_290","PTN_293","PTN_300","PTN_301","PTN_351","PTN_379","PTN_395","PTN_396","PTN_397","PTN_398","PTN_399","PTN_400","PTN_401","PTN_402","PTN_403","PTN_404","PTN_420","PTN_421","PTN_422","PTN_423","PTN_424","PTN_425","PTN_426","PTN_427","PTN_429","PTN_447","PTN_449","PTN_454","PTN_457","PTN_459","PTN_461","PTN_470","PTN_471","PTN_472","PTN_475","PTN_476","PTN_477","PTN_478","PTN_479","PTN_480","PTN_481","PTN_483","PTN_484","PTN_489","PTN_490","PTN_501","PTN_502","PTN_503","PTN_504","PTN_505","PTN_506","PTN_507","PTN_508","PTN_509","PTN_511","PTN_512","PTN_513","PTN_514","PTN_515","PTN_516","PTN_517","PTN_518","PTN_519","PTN_520","PTN_609","PTN_610","PTN_611","PTN_612","PTN_613","PTN_616","PTN_619","PTN_621","PTN_622","PTN_623","PTN_624","PTN_625","PTN_626","PTN_627","PTN_628","PTN_631","PTN_632","PTN_633","PTN_634","PTN_640","PTN_641","PTN_642","PTN_643","PTN_655","PTN_800","PTN_801","PTN_802","PTN_803","Parking Brake Lever","Position Lights Switch","Probe Heat Mode Switch","Q Feel Switch","Quantity Selector (Tens)","Quantity Selector (Units)","RPS/YAW Trim Switch","Release Interval Control (Hundreds)","Release Interval Control (Tens)","Release Interval Control (Units)","Rudder Trim Switch","SAS Pitch Switch","SAS Roll Switch","SAS Yaw Switch","Seat Adjustment Switch","Seat Ground Safety Lever","Throttle Cutoff Lever","V/UHF RSC Frequency Mode Switch","V/UHF RSC Operational Mode Switch","Video Recorder System Display Selector Switch","Video Recorder System Mode Switch","-0.1","-0.15","0.1","0.15","0.2","0.9","10","1121","1122","150","151","152","153","154","155","156","157","158","159","178","179","18","194","195","198","199","200","201","202","203","204","205","206","207","208","209","210","211","212","213","214","215","216","217","218","219","224","225","226","227","228","229","230","231","232","233","234","235","236","237","238","239","240","241","242","243","248","249","250","251","252","272","273","280","282","284","286","289","291","292","294","295","296","297","298","299","300","301","302","303","304","305","306","307","308","309","310","311","312","313","314","315","3150","3151","3152","3153","3154","3155","3156","3157","3158","3159","316","317","3178","3179","318","319","3194","3195","3198","3199","320","3200","3201","3202","3203","3204","3205","3206","3207","3208","3209","321","3210","3211","3212","3213","3214","3215","3216","3217","3218","3219","322","3224","3225","3226","3227","3228","3229","323","3230","3231","3232","3233","3234","3235","3236","3237","3238","3239","324","3240","3241","3242","3243","3248","3249","325","3250","3251","3252","3272","3273","3280","3282","3284","3286","3289","3291","3292","3294","3295","3296","3297","3298","3299","3300","3301","3302","3303","3304","3305","3306","3307","3308","3309","3310","3311","3312","3313","3314","3315","3316","3317","3318","3319","3320","3321","3322","3323","3324","3325","3350","3351","3364","3380","3405","3407","3409","3411","3413","3415","3417","3419","3448","3450","3458","3460","3482","3487","3488","350","351","3510","3614","3615","3617","3618","3620","3629","3630","3635","3636","3637","3638","3639","364","3653","380","405","407","409","411","4121","4122","413","415","417","419","448","450","458","460","482","485","486","487","488","510","614","615","617","618","620","629","630","635","636","637","638","639","653","ADC","AG Master Mode Selector","All Weather Landing Function Selector","Altitude Function Selector","Annunciator Lights","Barometric Pressure Calibration","Bingo Fuel Set Knob","CMBT Thrust Button","Clear Entry Button","Comm 1 Volume Control","Comm 2 Volume Control","Console Lights","Display Brightness Control","EDP Brightness Control","EMCON ON/OFF Toggle","EMS Button","ENTER Data Button","Emergency Jettison Button","Flaps BIT Button","Flood Lights","Formation Lights Knob","Gear Down Lock Override Button","HUD Off/Brightness Control","HUD Video Brightness Control","HUD Video Contrast Control","I/P Button","ICS Aux Volume Knob","ICS Ground Volume Knob","IFF Function Selector","Instruments Lights","Jettison Stores","Launch Flare Salvo","MPCD Left Button 1","MPCD Left Button 10","MPCD Left Button 11","MPCD Left Button 12","MPCD Left Button 13","MPCD Left Button 14","MPCD Left Button 15","MPCD Left Button 16","MPCD Left Button 17","MPCD Left Button 18","MPCD Left Button 19","MPCD Left Button 2","MPCD Left Button 20","MPCD Left Button 3","MPCD Left Button 4","MPCD Left Button 5","MPCD Left Button 6","MPCD Left Button 7","MPCD Left Button 8","MPCD Left Button 9","MPCD Left Off/Brightness Control","MPCD Right Button 1","MPCD Right Button 10","MPCD Right Button 11","MPCD Right Button 12","MPCD Right Button 13","MPCD Right Button 14","MPCD Right Button 15","MPCD Right Button 16","MPCD Right Button 17","MPCD Right Button 18","MPCD Right Button 19","MPCD Right Button 2","MPCD Right Button 20","MPCD Right Button 3","MPCD Right Button 4","MPCD Right Button 5","MPCD Right Button 6","MPCD Right Button 7","MPCD Right Button 8","MPCD Right Button 9","MPCD Right Off/Brightness Control","Master Caution","Master Warning","NAV Course Setting","NAV Master Mode Selector","Nozzle Control Lever","Nozzle Lever Friction Knob","ODU Option 1","ODU Option 2","ODU Option 3","ODU Option 4","ODU Option 5","PTN_1121","PTN_1122","PTN_150","PTN_151","PTN_152","PTN_153","PTN_154","PTN_155","PTN_156","PTN_157","PTN_158","PTN_159","PTN_194","PTN_195","PTN_198","PTN_199","PTN_200","PTN_201","PTN_202","PTN_203","PTN_204","PTN_205","PTN_206","PTN_207","PTN_208","PTN_209","PTN_210","PTN_211","PTN_212","PTN_213","PTN_214","PTN_215","PTN_216","PTN_217","PTN_218","PTN_219","PTN_224","PTN_225","PTN_226","PTN_227","PTN_228","PTN_229","PTN_230","PTN_231","PTN_232","PTN_233","PTN_234","PTN_235","PTN_236","PTN_237","PTN_238","PTN_239","PTN_240","PTN_241","PTN_242","PTN_243","PTN_248","PTN_249","PTN_250","PTN_251","PTN_252","PTN_272","PTN_273","PTN_280","PTN_282","PTN_284","PTN_286","PTN_289","PTN_291","PTN_292","PTN_294","PTN_295","PTN_296","PTN_297","PTN_298","PTN_299","PTN_302","PTN_303","PTN_304","PTN_305","PTN_306","PTN_307","PTN_308","PTN_309","PTN_310","PTN_311","PTN_312","PTN_313","PTN_314","PTN_315","PTN_316","PTN_317","PTN_318","PTN_319","PTN_320","PTN_321","PTN_322","PTN_323","PTN_324","PTN_325","PTN_364","PTN_380","PTN_405","PTN_407","PTN_409","PTN_411","PTN_413","PTN_415","PTN_417","PTN_419","PTN_448","PTN_450","PTN_458","PTN_460","PTN_482","PTN_485","PTN_486","PTN_487","PTN_488","PTN_510","PTN_614","PTN_615","PTN_617","PTN_618","PTN_620","PTN_629","PTN_630","PTN_635","PTN_636","PTN_637","PTN_638","PTN_639","PTN_653","RWR Power/Volume Button","RWRCONTROL","Radalt/TACAN/AWL/IFF ON/OFF Toggle","Radar Beacon Function Selector","STO Stop Lever","Save Data Button","Select Station 1 Toggle","Select Station 2 Toggle","Select Station 3 Toggle","Select Station 4 Toggle","Select Station 5 Toggle","Select Station 6 Toggle","Select Station 7 Toggle","Stopwatch Lap/Reset","Stopwatch Start/Stop","TACAN Function Selector","Target-Of-Opportunity Selector","Temperature Control Knob","Throttle Lever Friction Knob","Timer Function Selector","UFC Button -","UFC Button .","UFC Button 0","UFC Button 1","UFC Button 2/N","UFC Button 3","UFC Button 4/W","UFC Button 5","UFC Button 6/E","UFC Button 7","UFC Button 8/S","UFC Button 9","V/UHF RSC Ancillary Mode Pointer","V/UHF RSC Ancillary Mode Switch","V/UHF RSC Chan/Freq Knob","V/UHF RSC LOAD/OFST Switch","V/UHF RSC Volume Knob","VSTOL Master Mode Selector","Waypoint Overfly INS Update Selector","Weapons Function Selector"]});
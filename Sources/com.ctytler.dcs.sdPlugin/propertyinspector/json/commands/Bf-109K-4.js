@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Bf-109K-4","rows":[272,260,14,273,15,198,0,1,0,292,274,264,14,271,15,258,1,1,194,291,31,26,14,289,15,223,1,1,0,324,31,26,35,288,15,224,1,1,0,323,31,26,16,120,2,75,7,1,0,140,31,26,16,120,2,75,0,1,0,140,31,26,23,290,6,225,0,1,0,325,5,4,14,426,2,255,0,0,0,366,5,4,28,424,2,256,0,0,0,367,5,4,35,425,6,257,0,1,0,368,5,4,23,423,6,207,0,1,0,364,5,4,57,422,6,208,0,1,0,365,5,4,58,382,6,209,0,1,0,327,5,4,78,383,6,210,0,1,0,326,5,4,30,384,6,206,0,1,0,350,5,4,36,180,2,112,1,1,0,157,5,4,36,180,2,112,0,1,0,157,5,4,60,182,2,25,33,1,8,143,5,4,60,182,2,25,13,1,8,143,5,4,37,418,2,25,1,1,1,328,5,4,37,419,2,25,1,13,13,329,5,4,37,420,2,25,1,8,8,331,5,4,37,421,2,25,1,17,17,330,5,4,82,165,2,111,1,1,0,144,5,4,82,165,2,111,0,1,0,144,5,4,83,168,2,71,7,1,0,122,5,4,83,168,2,71,0,1,0,122,5,4,61,395,6,263,0,1,0,293,5,4,84,169,2,72,7,1,0,121,5,4,84,169,2,72,0,1,0,121,5,4,38,170,2,73,7,1,0,123,5,4,38,170,2,73,0,1,0,123,5,4,85,190,2,21,33,1,8,153,5,4,85,190,2,21,13,1,8,153,5,4,39,431,2,21,1,17,17,353,5,4,39,432,2,21,1,8,8,352,5,4,39,433,2,21,1,1,1,351,5,4,39,434,2,21,1,13,13,354,5,4,87,184,2,101,7,1,0,158,5,4,87,184,2,101,0,1,0,158,5,4,62,164,2,67,1,1,0,142,5,4,62,164,2,67,0,1,0,142,5,4,88,191,2,109,1,1,0,151,5,4,88,191,2,109,0,1,0,151,5,4,89,192,2,110,1,1,0,152,5,4,89,192,2,110,0,1,0,152,5,4,40,188,2,113,1,1,0,43,5,4,40,188,2,113,0,1,0,43,5,4,91,189,2,114,1,1,0,43,5,4,91,189,2,114,0,1,0,43,44,42,16,183,2,107,1,1,0,155,44,42,16,183,2,107,0,1,0,155,44,42,23,181,2,106,1,1,0,141,44,42,23,181,2,106,0,1,0,141,32,27,14,402,6,259,0,1,0,373,32,27,29,403,6,34,0,1,0,369,32,27,35,404,6,34,0,1,0,370,32,27,76,405,6,34,0,1,0,371,32,27,16,406,6,34,0,1,0,372,3,0,14,270,6,253,0,1,0,298,3,0,29,185,2,51,7,1,0,137,3,0,29,185,2,51,0,1,0,137,3,0,76,428,2,51,0,0,0,320,3,0,16,118,2,48,7,1,0,126,3,0,16,118,2,48,0,1,0,126,3,0,23,285,2,48,0,0,0,300,3,0,57,119,2,49,7,1,0,127,3,0,57,119,2,49,0,1,0,127,3,0,78,287,2,49,0,0,0,302,3,0,30,159,2,47,7,1,0,128,3,0,30,159,2,47,0,1,0,128,3,0,80,375,2,47,0,0,0,306,3,0,18,160,2,55,7,1,0,129,3,0,18,160,2,55,0,1,0,129,3,0,226,377,2,55,0,0,0,308,3,0,59,162,2,53,7,1,0,131,3,0,59,162,2,53,0,1,0,131,3,0,227,379,2,53,0,0,0,310,3,0,36,163,2,54,7,1,0,132,3,0,36,163,2,54,0,1,0,132,3,0,60,381,2,54,0,0,0,312,3,0,81,186,2,50,7,1,0,138,3,0,81,186,2,50,0,1,0,138,3,0,228,430,2,50,0,0,0,322,3,0,61,172,2,98,7,1,0,133,3,0,61,172,2,98,0,1,0,133,3,0,38,173,2,103,7,1,0,134,3,0,38,173,2,103,0,1,0,134,3,0,86,179,2,102,7,1,0,136,3,0,86,179,2,102,0,1,0,136,3,0,229,398,15,261,20,1,0,303,3,0,62,399,15,262,20,1,0,304,3,0,230,409,15,252,20,1,0,313,3,0,231,279,6,196,0,1,0,359,3,0,232,280,6,197,0,1,0,360,3,0,233,281,6,199,0,1,0,361,3,0,234,283,6,211,0,1,0,363,3,0,235,282,6,200,0,1,0,362,3,0,236,390,6,212,0,1,0,337,3,0,90,161,2,108,7,1,0,130,3,0,90,161,2,108,0,1,0,130,3,0,40,400,6,105,7,1,0,348,3,0,40,401,6,105,0,1,0,349,3,0,92,177,2,100,7,1,0,156,3,0,92,177,2,100,0,1,0,156,3,0,237,410,6,254,0,1,0,356,3,0,93,117,2,24,33,1,8,149,3,0,93,117,2,24,13,1,8,149,3,0,41,275,2,24,1,1,1,342,3,0,41,276,2,24,1,13,13,343,3,0,41,277,2,24,1,8,8,345,3,0,41,278,2,24,1,17,17,344,3,0,94,176,2,66,1,1,0,154,3,0,94,176,2,66,0,1,0,154,3,0,95,115,2,46,7,1,0,124,3,0,95,115,2,46,0,1,0,124,3,0,238,267,2,46,0,0,0,295,3,0,96,116,2,52,7,1,0,125,3,0,96,116,2,52,0,1,0,125,3,0,239,269,2,52,0,0,0,297,3,0,97,187,2,104,7,1,0,139,3,0,97,187,2,104,0,1,0,139,3,0,240,427,6,218,0,1,0,319,3,0,241,284,6,215,0,1,0,299,3,0,242,286,6,216,0,1,0,301,3,0,243,374,6,214,0,1,0,305,3,0,244,376,6,222,0,1,0,307,3,0,245,378,6,220,0,1,0,309,3,0,246,380,6,221,0,1,0,311,3,0,247,429,6,217,0,1,0,321,3,0,248,266,6,213,0,1,0,294,3,0,249,268,6,219,0,1,0,296,63,56,14,171,2,68,1,1,0,150,63,56,14,171,2,68,0,1,0,150,63,56,29,397,6,202,0,1,0,347,408,195,14,407,15,201,1,1,0,355,12,11,14,166,2,22,33,1,8,146,12,11,14,166,2,22,13,1,8,146,12,11,28,385,2,22,1,1,1,332,12,11,28,386,2,22,1,13,13,333,12,11,28,388,2,22,1,8,8,334,12,11,28,389,2,22,1,17,17,335,12,11,29,391,15,204,1,1,0,338,12,11,16,167,2,69,7,1,0,145,12,11,16,167,2,69,0,1,0,145,12,11,23,387,15,203,20,64,64,336,12,11,30,392,2,70,1,1,1,339,12,11,30,393,2,70,1,0,0,340,12,11,80,394,6,205,0,1,0,341,10,9,14,411,15,250,1,1,0,357,10,9,35,412,15,251,1,1,0,358,10,9,77,174,2,74,7,1,0,147,10,9,77,174,2,74,0,1,0,147,10,9,58,175,2,99,1,1,0,148,10,9,58,175,2,99,0,1,0,148,10,9,79,178,2,19,193,1,0,135,10,9,79,178,2,19,45,1,0,135,10,9,18,413,2,19,1,1,1,316,10,9,18,414,2,19,1,45,45,315,10,9,18,415,2,19,1,0,0,318,10,9,18,416,2,19,1,65,65,317,10,9,18,417,2,19,1,20,20,314,10,9,59,396,6,265,0,1,0,346],"strings":["1","0","TUMB","FUSEBOX","4","CONTROLS","BTN","-1","0.3","3","WEAPONS_CONTROLS","14","VHF_RADIO","0.1","3001","LEV","3006","0.2","3015","64","0.5","113","128","3008","59","87","19","20","3002","3003","3012","CLOCK","FLARE_GUN","-0.1","165","3004","3021","3025","3034","3037","3060","3068","5","Cockpit.Generic.cockpit_ventilation_knob","ENGINE_CONTROLS","0.25","114","115","116","117","118","119","120","121","122","123","2","3009","3010","3018","3023","3032","3041","OXYGEN","","0.75","107","112","127","131","132","136","137","138","139","23","3005","3007","3011","3013","3014","3024","3027","3029","3033","3035","3036","3039","3043","3045","3058","3062","3063","3066","3073","3075","3078","3081","37","47","51","53","60","61","62","85","86","88","89","90","91","96","97","98","99","A100","A101","B102","C100","C101","CLK_SET","Cockpit.Bf109K4.canopy_h","Cockpit.Bf109K4.canopy_operate","Cockpit.Bf109K4.canopy_s","Cockpit.Bf109K4.cb_a100","Cockpit.Bf109K4.cb_a101","Cockpit.Bf109K4.cb_c100","Cockpit.Bf109K4.cb_c101","Cockpit.Bf109K4.cb_d100","Cockpit.Bf109K4.cb_e101","Cockpit.Bf109K4.cb_e103","Cockpit.Bf109K4.cb_f135","Cockpit.Bf109K4.cb_f211","Cockpit.Bf109K4.cb_p102","Cockpit.Bf109K4.cb_p150","Cockpit.Bf109K4.cb_r101","Cockpit.Bf109K4.cb_t100","Cockpit.Bf109K4.cb_v100","Cockpit.Bf109K4.cb_v101","Cockpit.Bf109K4.cb_v114","Cockpit.Bf109K4.clock_stop","Cockpit.Bf109K4.cold_weather_valve","Cockpit.Bf109K4.fuel_jettison","Cockpit.Bf109K4.fuel_pumps_quad","Cockpit.Bf109K4.fuel_type","Cockpit.Bf109K4.fug16zy_ftftyzf","Cockpit.Bf109K4.fug16zy_mode","Cockpit.Bf109K4.gun_sight_body","Cockpit.Bf109K4.gun_sight_tint","Cockpit.Bf109K4.magnetos","Cockpit.Bf109K4.oxygen_valve","Cockpit.Bf109K4.radiator_cutoff_lh","Cockpit.Bf109K4.radiator_cutoff_rh","Cockpit.Bf109K4.radiators","Cockpit.Bf109K4.safety","Cockpit.Bf109K4.schnellstop","Cockpit.Bf109K4.starter_cover","Cockpit.Bf109K4.tail_wheel_lock","Cockpit.Bf109K4.uc_cover","D100","E101","E103","F135","F211","FUEL_JETTISON","FUEL_MWVALVE","FUG","FUG16_MIC","HATCH","HATCH_H","HATCH_S","OXY_VALVE","P102","P150","REVI_MOUNT","REVI_SCREEN","SAFETY","STRTR_COVER","SZK","T100","TAIL_LOCK","THTL_CWVALVE","THTL_PUMPS","THTL_STOP","UC_COVER","V100","V101","V114","VENT_LH","VENT_RH","WRAD","WRAD_CUT_LH","WRAD_CUT_RH","-0.25","0.511","10","108","109","11","110","111","12","126","129","130","133","140","141","142","143","144","149","150","151","152","153","154","155","156","157","158","159","160","21","22","24","3017","3020","3026","3038","3044","3051","3052","3053","3054","3055","3056","3065","3077","3080","3083","3084","3085","3086","3087","3088","3089","3090","3092","3093","38","39","48","49","52","54","55","63","7","72","8","80","82","83","9","92","A100_0","A100_1","A101_0","A101_1","A104","AH_LK","ALTIMETER","ALT_MBAR","ARTIFICIAL_HORIZON","B102_0","B102_M1","B102_M1M2","B102_M2","BUTTON_A","BUTTON_B1","BUTTON_B2","BUTTON_D","BUTTON_T","C100_0","C100_1","C101_0","C101_1","CLK_PINION","CLK_SCALE","CLK_SW","Cockpit.Bf109K4.ah_cage","Cockpit.Bf109K4.altimeter","Cockpit.Bf109K4.canopy_jettison","Cockpit.Bf109K4.cb_a100_0","Cockpit.Bf109K4.cb_a100_1","Cockpit.Bf109K4.cb_a101_0","Cockpit.Bf109K4.cb_a101_1","Cockpit.Bf109K4.cb_a104","Cockpit.Bf109K4.cb_c100_0","Cockpit.Bf109K4.cb_c100_1","Cockpit.Bf109K4.cb_c101_0","Cockpit.Bf109K4.cb_c101_1","Cockpit.Bf109K4.cb_c102","Cockpit.Bf109K4.cb_c103","Cockpit.Bf109K4.cb_d100_0","Cockpit.Bf109K4.cb_d100_1","Cockpit.Bf109K4.cb_e101_0","Cockpit.Bf109K4.cb_e101_1","Cockpit.Bf109K4.cb_f135_0","Cockpit.Bf109K4.cb_f135_1","Cockpit.Bf109K4.cb_f211_0","Cockpit.Bf109K4.cb_f211_1","Cockpit.Bf109K4.cb_p112","Cockpit.Bf109K4.cb_r101_0","Cockpit.Bf109K4.cb_r101_smv","Cockpit.Bf109K4.cb_r101_sov","Cockpit.Bf109K4.cb_r101_wmv","Cockpit.Bf109K4.cb_r101_wov","Cockpit.Bf109K4.cb_v100_0","Cockpit.Bf109K4.cb_v100_1","Cockpit.Bf109K4.cb_v101_0","Cockpit.Bf109K4.cb_v101_1","Cockpit.Bf109K4.clock_pinion","Cockpit.Bf109K4.clock_scale","Cockpit.Bf109K4.clock_stopwatch","Cockpit.Bf109K4.flaps_minus","Cockpit.Bf109K4.flaps_plus","Cockpit.Bf109K4.fuel_pumps_quad_0","Cockpit.Bf109K4.fuel_pumps_quad_1","Cockpit.Bf109K4.fuel_pumps_quad_2","Cockpit.Bf109K4.fuel_pumps_quad_3","Cockpit.Bf109K4.fug16zy_mode_1","Cockpit.Bf109K4.fug16zy_mode_2","Cockpit.Bf109K4.fug16zy_mode_sq","Cockpit.Bf109K4.fug16zy_mode_tr","Cockpit.Bf109K4.fug16zy_tune","Cockpit.Bf109K4.fug16zy_tx","Cockpit.Bf109K4.fug16zy_volume","Cockpit.Bf109K4.fug25_mode_1","Cockpit.Bf109K4.fug25_mode_2","Cockpit.Bf109K4.fug25_test","Cockpit.Bf109K4.magnetos_0","Cockpit.Bf109K4.magnetos_1","Cockpit.Bf109K4.magnetos_2","Cockpit.Bf109K4.magnetos_3","Cockpit.Bf109K4.notwurf","Cockpit.Bf109K4.oxygen_shower","Cockpit.Bf109K4.pitch_minus","Cockpit.Bf109K4.pitch_plus","Cockpit.Bf109K4.primer","Cockpit.Bf109K4.radiators_0","Cockpit.Bf109K4.radiators_aus","Cockpit.Bf109K4.radiators_auto","Cockpit.Bf109K4.radiators_zu","Cockpit.Bf109K4.repeater_compass","Cockpit.Bf109K4.starter","Cockpit.Bf109K4.szkk3_pinion_lh","Cockpit.Bf109K4.szkk3_pinion_rh","Cockpit.Bf109K4.trigger_a","Cockpit.Bf109K4.trigger_b1","Cockpit.Bf109K4.trigger_b2","Cockpit.Bf109K4.trigger_d","Cockpit.Bf109K4.trigger_t","Cockpit.Bf109K4.trim_elevator_minus","Cockpit.Bf109K4.trim_elevator_plus","Cockpit.Bf109K4.uc_0","Cockpit.Bf109K4.uc_1","Cockpit.Bf109K4.uc_emergency","Cockpit.Generic.flare_select_green","Cockpit.Generic.flare_select_red","Cockpit.Generic.flare_select_white","Cockpit.Generic.flare_select_yellow","Cockpit.Generic.flare_trigger","D100_0","D100_1","E101_0","E101_1","F135_0","F135_1","F211_0","F211_1","FLAPS_EXT","FLAPS_RET","FUEL_PUMPH","FUG16_1","FUG16_2","FUG16_FINE","FUG16_SQ","FUG16_TR","FUG16_TX","FUG16_VOLUME","FUG25_1","FUG25_2","FUG25_TEST","HATCH_JETTISON","NOTWURF","OXY_SHOWER","PITLITE_LH","PITLITE_RH","PROP_MINUS","PROP_PLUS","PSTL_FIRE","PSTL_GN","PSTL_RD","PSTL_WH","PSTL_YE","RCS_RING","REMOTE_COMPASS","REVI_DIMMER","STRTR_HANDLE","SZKK3_LHP","SZKK3_RHP","SZK_DIVE","SZK_DIVE_DLY","SZK_LEVL","SZK_LEVL_DLY","SZK_OFF","THTL_PUMPS_0","THTL_PUMPS_1","THTL_PUMPS_12","THTL_PUMPS_2","TRIM_ND","TRIM_NU","UC_DN","UC_EMER","UC_UP","V100_0","V100_1","V101_0","V101_1","WRAD_AUTO","WRAD_CLOSE","WRAD_OFF","WRAD_OPEN"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"C-101CC","rows":[22,20,28,143,6,1,0,1,0,140,22,20,30,143,6,1,0,1,0,140,22,20,25,143,7,1,0,1,0,140,22,20,26,145,6,1,0,1,0,170,22,20,41,145,6,1,0,1,0,170,22,20,31,145,7,1,0,1,0,170,22,20,32,144,4,566,15,1,40,139,22,20,32,144,4,566,17,1,40,139,22,20,35,144,7,1419,0,1,0,139,22,20,36,819,4,567,5,1,0,669,22,20,36,819,4,567,0,1,0,669,22,20,27,820,4,568,5,1,0,1104,22,20,27,820,4,568,0,1,0,1104,9,8,28,156,4,227,5,1,0,48,9,8,28,156,4,227,0,1,0,48,9,8,30,156,7,1367,0,1,0,48,9,8,25,164,4,228,5,1,0,51,9,8,25,164,4,228,0,1,0,51,9,8,26,164,7,1368,0,1,0,51,9,8,41,154,4,229,5,1,0,47,9,8,41,154,4,229,0,1,0,47,9,8,31,154,7,1369,0,1,0,47,9,8,32,160,4,231,5,1,0,52,9,8,32,160,4,231,0,1,0,52,9,8,63,160,7,1371,0,1,0,52,9,8,35,158,4,232,5,1,0,49,9,8,35,158,4,232,0,1,0,49,9,8,36,158,7,1374,0,1,0,49,9,8,27,989,4,233,5,1,0,56,9,8,27,989,4,233,0,1,0,56,9,8,53,1581,6,1375,0,1,0,717,9,8,37,1583,7,1376,1,1,0,779,9,8,38,150,4,616,5,1,0,44,9,8,38,150,4,616,0,1,0,44,9,8,234,150,7,1454,0,1,0,44,9,8,54,152,4,230,5,1,0,46,9,8,54,152,4,230,0,1,0,46,9,8,235,152,7,1370,0,1,0,46,9,8,131,162,4,226,5,1,0,50,9,8,131,162,4,226,0,1,0,50,9,8,1187,162,7,1181,0,1,0,50,9,8,237,987,4,492,15,1,59,100,9,8,237,987,4,492,17,1,59,100,9,8,64,157,4,629,5,1,0,48,9,8,64,157,4,629,0,1,0,48,9,8,132,157,7,1455,0,1,0,48,9,8,42,165,4,630,5,1,0,51,9,8,42,165,4,630,0,1,0,51,9,8,133,165,7,1456,0,1,0,51,9,8,43,155,4,631,5,1,0,47,9,8,43,155,4,631,0,1,0,47,9,8,65,155,7,1457,0,1,0,47,9,8,55,161,4,633,5,1,0,52,9,8,55,161,4,633,0,1,0,52,9,8,134,161,7,1459,0,1,0,52,9,8,241,159,4,634,5,1,0,49,9,8,241,159,4,634,0,1,0,49,9,8,1188,159,7,1460,0,1,0,49,9,8,242,990,4,635,5,1,0,56,9,8,242,990,4,635,0,1,0,56,9,8,1189,1582,6,1470,0,1,0,717,9,8,1190,1584,7,1471,1,1,0,779,9,8,243,151,4,188,5,1,0,44,9,8,243,151,4,188,0,1,0,44,9,8,244,151,7,1122,0,1,0,44,9,8,245,153,4,632,5,1,0,46,9,8,245,153,4,632,0,1,0,46,9,8,135,153,7,1458,0,1,0,46,9,8,66,163,4,187,5,1,0,50,9,8,66,163,4,187,0,1,0,50,9,8,246,163,7,1119,0,1,0,50,9,8,136,988,4,649,15,1,59,100,9,8,136,988,4,649,17,1,59,100,14,13,292,829,4,490,16,1,0,115,14,13,292,829,4,490,10,1,0,115,14,13,293,846,4,488,5,1,0,126,14,13,293,846,4,488,0,1,0,126,14,13,1196,1544,7,1353,1,1,0,716,14,13,1197,1585,7,1351,1,1,0,776,14,13,294,831,4,483,5,1,0,681,14,13,294,831,4,483,0,1,0,681,14,13,295,1014,4,486,16,1,0,802,14,13,295,1014,4,486,10,1,0,802,14,13,296,963,4,485,16,1,0,746,14,13,296,963,4,485,10,1,0,746,14,13,297,993,4,67,16,1,0,785,14,13,297,993,4,67,10,1,0,785,14,13,298,995,4,366,16,1,0,1084,14,13,298,995,4,366,10,1,0,1084,14,13,351,1005,4,617,5,1,0,714,14,13,351,1005,4,617,0,1,0,714,14,13,405,830,4,223,16,1,0,115,14,13,405,830,4,223,10,1,0,115,14,13,406,847,4,224,5,1,0,126,14,13,406,847,4,224,0,1,0,126,14,13,1289,1545,7,1171,1,1,0,716,14,13,1290,1586,7,1170,1,1,0,776,14,13,407,994,4,647,5,1,0,784,14,13,407,994,4,647,0,1,0,784,14,13,408,996,4,648,5,1,0,1083,14,13,408,996,4,648,0,1,0,1083,14,13,1359,1621,7,1120,1,1,0,767,14,13,1360,1622,7,1121,1,1,0,767,3,2,28,837,4,309,5,1,0,706,3,2,28,837,4,309,0,1,0,706,3,2,30,1076,4,347,5,1,0,99,3,2,30,1076,4,347,0,1,0,99,3,2,25,1523,6,1250,0,1,0,787,3,2,26,1078,4,358,5,1,0,118,3,2,26,1078,4,358,0,1,0,118,3,2,41,1525,6,1260,0,1,0,1088,3,2,31,1069,4,314,5,1,0,722,3,2,31,1069,4,314,0,1,0,722,3,2,32,945,4,339,5,1,0,84,3,2,32,945,4,339,0,1,0,84,3,2,63,1521,6,1236,0,1,0,738,3,2,35,944,4,318,16,1,0,665,3,2,35,944,4,318,10,1,0,665,3,2,36,967,6,316,5,5,1,766,3,2,36,967,4,316,0,1,0,766,3,2,27,968,6,317,5,5,1,765,3,2,27,968,6,317,0,1,0,765,3,2,53,823,4,321,5,1,0,72,3,2,53,823,4,321,0,1,0,72,3,2,37,825,4,330,0,1,0,98,3,2,37,825,4,330,0,1,0,98,3,2,38,844,6,1377,0,1,0,75,3,2,234,1504,7,1418,0,1,0,687,3,2,54,1552,6,1382,0,1,0,749,3,2,235,1566,6,1383,0,1,0,750,3,2,131,1510,6,1384,0,1,0,718,3,2,42,949,6,397,1,1,175,740,3,2,42,949,6,397,0,10,175,740,3,2,43,1016,4,404,5,1,0,1086,3,2,43,1016,4,404,0,1,0,1086,3,2,65,1548,7,1304,0,1,0,721,3,2,55,1572,7,1311,0,1,0,769,3,2,244,1568,6,1150,0,1,0,761,3,2,135,971,4,11,5,1,1,77,3,2,135,971,4,11,0,1,1,77,3,2,66,997,4,20,5,1,1,76,3,2,66,997,4,20,0,1,1,76,3,2,246,1490,6,1169,0,1,0,1087,3,2,136,1506,6,1385,0,1,0,689,3,2,247,935,4,191,5,1,0,92,3,2,247,935,4,191,0,1,0,92,3,2,248,939,4,195,5,1,0,87,3,2,248,939,4,195,0,1,0,87,3,2,1191,1515,6,1126,0,1,0,760,3,2,1192,1591,6,1128,0,1,0,741,3,2,1193,1539,6,1129,0,1,0,719,3,2,1194,1623,6,1131,0,1,0,1638,3,2,249,1039,4,197,16,1,0,755,3,2,249,1039,4,197,10,1,0,755,3,2,250,1041,4,198,16,1,0,751,3,2,250,1041,4,198,10,1,0,751,3,2,251,1043,4,199,16,1,0,753,3,2,251,1043,4,199,10,1,0,753,3,2,252,1045,4,200,16,1,0,757,3,2,252,1045,4,200,10,1,0,757,3,2,253,850,4,499,5,1,0,737,3,2,253,850,4,499,0,1,0,737,3,2,254,877,4,518,5,1,0,804,3,2,254,877,4,518,0,1,0,804,3,2,255,884,4,523,5,1,0,690,3,2,255,884,4,523,0,1,0,690,3,2,256,882,4,522,5,1,0,709,3,2,256,882,4,522,0,1,0,709,3,2,257,859,4,507,5,1,0,780,3,2,257,859,4,507,0,1,0,780,3,2,258,908,4,541,5,1,0,70,3,2,258,908,4,541,0,1,0,70,3,2,259,865,4,511,5,1,0,116,3,2,259,865,4,511,0,1,0,116,3,2,260,852,4,501,5,1,0,117,3,2,260,852,4,501,0,1,0,117,3,2,261,867,4,512,5,1,0,96,3,2,261,867,4,512,0,1,0,96,3,2,262,878,4,519,5,1,0,783,3,2,262,878,4,519,0,1,0,783,3,2,263,880,4,521,5,1,0,107,3,2,263,880,4,521,0,1,0,107,3,2,264,862,4,510,5,1,0,130,3,2,264,862,4,510,0,1,0,130,3,2,265,856,4,504,5,1,0,680,3,2,265,856,4,504,0,1,0,680,3,2,266,858,4,506,5,1,0,675,3,2,266,858,4,506,0,1,0,675,3,2,267,854,4,502,5,1,0,805,3,2,267,854,4,502,0,1,0,805,3,2,268,905,4,538,5,1,0,748,3,2,268,905,4,538,0,1,0,748,3,2,269,885,4,524,5,1,0,711,3,2,269,885,4,524,0,1,0,711,3,2,270,901,4,535,5,1,0,807,3,2,270,901,4,535,0,1,0,807,3,2,271,894,4,531,5,1,0,1112,3,2,271,894,4,531,0,1,0,1112,3,2,272,869,4,513,5,1,0,105,3,2,272,869,4,513,0,1,0,105,3,2,273,874,4,516,5,1,0,811,3,2,273,874,4,516,0,1,0,811,3,2,274,871,4,514,5,1,0,683,3,2,274,871,4,514,0,1,0,683,3,2,275,879,4,520,5,1,0,744,3,2,275,879,4,520,0,1,0,744,3,2,276,872,4,515,5,1,0,83,3,2,276,872,4,515,0,1,0,83,3,2,277,851,4,500,5,1,0,736,3,2,277,851,4,500,0,1,0,736,3,2,278,857,4,505,5,1,0,730,3,2,278,857,4,505,0,1,0,730,3,2,279,855,4,503,5,1,0,1075,3,2,279,855,4,503,0,1,0,1075,3,2,281,907,4,540,5,1,0,114,3,2,281,907,4,540,0,1,0,114,3,2,282,906,4,539,5,1,0,743,3,2,282,906,4,539,0,1,0,743,3,2,283,886,4,548,5,1,0,1110,3,2,283,886,4,548,0,1,0,1110,3,2,284,910,4,542,5,1,0,95,3,2,284,910,4,542,0,1,0,95,3,2,285,887,4,525,5,1,0,778,3,2,285,887,4,525,0,1,0,778,3,2,286,903,4,537,5,1,0,1105,3,2,286,903,4,537,0,1,0,1105,3,2,287,899,4,534,5,1,0,120,3,2,287,899,4,534,0,1,0,120,3,2,288,890,4,527,5,1,0,710,3,2,288,890,4,527,0,1,0,710,3,2,289,893,4,530,5,1,0,73,3,2,289,893,4,530,0,1,0,73,3,2,290,914,4,545,5,1,0,745,3,2,290,914,4,545,0,1,0,745,3,2,291,876,4,517,5,1,0,786,3,2,291,876,4,517,0,1,0,786,3,2,1199,1546,6,1154,0,1,0,715,3,2,1200,1496,6,1151,0,1,0,682,3,2,299,965,4,201,5,1,0,125,3,2,299,965,4,201,0,1,0,125,3,2,300,812,4,202,0,1,0,68,3,2,300,812,4,202,0,1,0,68,3,2,301,1031,6,203,0,1,0,74,3,2,301,1031,4,203,5,5,1,74,3,2,1201,1071,6,1391,0,1,0,82,3,2,302,1009,4,498,5,1,0,108,3,2,302,1009,4,498,0,1,0,108,3,2,1202,1624,4,1381,10,1,10,1102,3,2,1203,1529,6,1277,0,1,0,803,3,2,304,814,4,493,16,1,0,679,3,2,304,814,4,493,10,1,0,679,3,2,305,816,4,494,5,1,0,677,3,2,305,816,4,494,0,1,0,677,3,2,306,818,4,495,5,1,0,735,3,2,306,818,4,495,0,1,0,735,3,2,307,817,4,496,5,1,0,1097,3,2,307,817,4,496,0,1,0,1097,3,2,1204,1489,7,1380,1,1,0,1636,3,2,308,815,6,497,5,5,1,788,3,2,308,815,6,497,0,1,0,788,3,2,1206,937,4,1387,0,1,0,127,3,2,1207,937,7,1386,179,1,0,127,3,2,1208,1542,6,1388,0,1,0,712,3,2,310,950,4,211,1,1,0,81,3,2,310,950,4,211,0,1,0,81,3,2,1209,1550,6,1156,0,1,0,731,3,2,311,827,4,205,5,1,0,69,3,2,311,827,4,205,0,1,0,69,3,2,1210,1498,6,1155,0,1,0,674,3,2,312,957,4,207,5,1,0,86,3,2,312,957,4,207,0,1,0,86,3,2,313,952,6,206,1,10,1,85,3,2,313,952,6,206,0,10,0,85,3,2,1211,1073,6,1392,0,1,0,110,3,2,315,954,4,209,5,1,0,109,3,2,315,954,4,209,0,1,0,109,3,2,1212,821,7,1378,0,1,0,79,3,2,1213,1531,6,1268,0,1,0,1107,3,2,1214,1533,6,1275,0,1,0,1111,3,2,1215,1492,6,1123,0,1,0,684,3,2,1216,842,6,1394,0,1,0,106,3,2,1217,840,6,1393,0,1,0,102,3,2,1218,838,6,1395,0,1,0,94,3,2,1219,1560,6,1168,0,1,0,1633,3,2,1220,1557,6,1160,0,1,0,1485,3,2,1221,1554,6,1165,0,1,0,1476,3,2,1222,1559,6,1161,0,1,0,1488,3,2,1223,1555,6,1162,0,1,0,1480,3,2,1224,1556,6,1163,0,1,0,1481,3,2,1225,1561,6,1164,0,1,0,1640,3,2,1226,1562,6,1166,0,1,0,1639,3,2,1227,1558,6,1167,0,1,0,1486,3,2,319,959,4,413,5,1,0,88,3,2,319,959,4,413,0,1,0,88,3,2,320,832,6,367,5,5,1,124,3,2,320,832,6,367,0,1,0,124,3,2,322,834,4,374,5,1,0,123,3,2,322,834,4,374,0,1,0,123,3,2,1229,1519,6,1262,0,1,0,810,3,2,1230,1589,6,1159,0,1,0,782,3,2,323,941,4,415,33,1,183,713,3,2,323,941,4,415,34,1,183,713,3,2,324,1008,4,419,33,1,0,792,3,2,324,1008,4,419,34,1,0,792,3,2,325,985,4,424,16,1,0,685,3,2,325,985,4,424,10,1,0,685,3,2,326,1035,4,429,5,1,0,1098,3,2,326,1035,4,429,0,1,0,1098,3,2,327,1036,4,437,5,1,0,1099,3,2,327,1036,4,437,0,1,0,1099,3,2,328,1037,4,447,5,1,0,1100,3,2,328,1037,4,447,0,1,0,1100,3,2,329,1038,4,453,5,1,0,1101,3,2,329,1038,4,453,0,1,0,1101,3,2,331,1015,4,457,16,1,0,1080,3,2,331,1015,4,457,10,1,0,1080,3,2,332,984,4,460,5,1,0,773,3,2,332,984,4,460,0,1,0,773,3,2,333,999,4,470,15,1,23,794,3,2,333,999,4,470,17,1,23,794,3,2,334,1000,4,472,15,1,23,793,3,2,334,1000,4,472,17,1,23,793,3,2,335,1001,4,473,15,1,23,798,3,2,335,1001,4,473,17,1,23,798,3,2,336,1002,4,474,15,1,23,797,3,2,336,1002,4,474,17,1,23,797,3,2,337,1003,4,475,15,1,23,796,3,2,337,1003,4,475,17,1,23,796,3,2,338,1004,4,476,15,1,23,795,3,2,338,1004,4,476,17,1,23,795,3,2,1231,982,6,1396,0,1,0,774,3,2,1232,983,6,1397,0,1,0,775,3,2,340,978,4,480,16,1,0,771,3,2,340,978,4,480,10,1,0,771,3,2,341,836,4,396,16,1,0,1106,3,2,341,836,4,396,10,1,0,1106,3,2,1233,1527,6,1205,0,1,0,1477,3,2,342,961,4,204,16,1,0,89,3,2,342,961,4,204,10,1,0,89,3,2,343,848,4,18,5,1,0,71,3,2,343,848,4,18,0,1,0,71,3,2,1234,1596,7,1173,1,1,0,671,3,2,1235,1598,7,1174,1,1,0,670,3,2,1237,1602,7,1175,1,1,0,672,3,2,1238,1600,7,1176,1,1,0,673,3,2,1239,1587,6,1195,0,1,0,781,3,2,344,1033,4,280,5,1,0,122,3,2,344,1033,4,280,0,1,0,122,3,2,1240,1563,6,1228,5,0,1,747,3,2,1241,1528,6,1291,0,1,0,1484,3,2,345,916,4,210,5,1,0,809,3,2,345,916,4,210,0,1,0,809,3,2,346,1012,4,379,1,1,0,112,3,2,346,1012,4,379,0,1,0,112,3,2,1242,1593,7,21,1,1,0,1634,3,2,1243,1604,7,1198,1,1,0,686,3,2,1244,844,7,1398,10,1,0,75,3,2,1245,1500,7,1116,0,1,0,678,3,2,1246,1565,7,1158,10,1,0,1637,3,2,1247,1570,7,1466,1,1,0,1091,3,2,348,969,4,549,5,1,0,80,3,2,348,969,4,549,0,1,0,80,3,2,1248,1606,7,1400,1,1,0,729,3,2,349,1017,4,550,5,1,0,101,3,2,349,1017,4,550,0,1,0,101,3,2,1249,1517,7,1186,1,1,0,1093,3,2,350,991,4,600,5,1,0,97,3,2,350,991,4,600,0,1,0,97,3,2,352,1023,4,569,5,1,0,791,3,2,352,1023,4,569,0,1,0,791,3,2,353,1024,4,570,16,1,0,790,3,2,353,1024,4,570,10,1,0,790,3,2,354,1021,4,571,5,1,0,789,3,2,354,1021,4,571,0,1,0,789,3,2,355,1019,4,572,178,1,29,692,3,2,355,1019,4,572,182,1,29,692,3,2,356,1022,4,573,1114,1,185,799,3,2,356,1022,4,573,1115,1,185,799,3,2,357,1025,4,574,33,1,0,1085,3,2,357,1025,4,574,34,1,0,1085,3,2,359,1020,4,575,178,1,29,1090,3,2,359,1020,4,575,182,1,29,1090,3,2,1251,1618,6,1422,0,1,0,1632,3,2,1252,1608,6,1401,0,1,0,1626,3,2,1253,1609,6,1402,0,1,0,1627,3,2,1254,1610,6,1403,0,1,0,1628,3,2,1255,1611,6,1404,0,1,0,1629,3,2,1256,1612,6,1405,0,1,0,1630,3,2,1257,1613,6,1406,0,1,0,1631,3,2,1258,1614,6,1407,0,1,0,734,3,2,1259,1616,6,1408,0,1,0,1089,3,2,360,1026,4,551,177,1,29,93,3,2,360,1026,4,551,181,1,29,93,3,2,1261,1619,6,1409,0,1,0,800,3,2,361,1029,6,208,5,5,1,121,3,2,361,1029,6,208,0,1,0,121,3,2,362,864,4,557,5,1,0,742,3,2,362,864,4,557,0,1,0,742,3,2,363,883,4,558,5,1,0,772,3,2,363,883,4,558,0,1,0,772,3,2,364,898,4,190,5,1,0,667,3,2,364,898,4,190,0,1,0,667,3,2,365,915,4,559,5,1,0,666,3,2,365,915,4,559,0,1,0,666,3,2,1263,1576,7,1427,1,1,0,1094,3,2,368,1070,4,592,16,1,0,1113,3,2,368,1070,4,592,10,1,0,1113,3,2,369,973,4,552,15,1,39,723,3,2,369,973,4,552,17,1,39,723,3,2,370,974,4,553,15,1,0,725,3,2,370,974,4,553,17,1,0,725,3,2,371,975,4,554,15,1,0,726,3,2,371,975,4,554,17,1,0,726,3,2,372,976,4,555,16,1,0,724,3,2,372,976,4,555,10,1,0,724,3,2,373,977,4,556,5,1,0,806,3,2,373,977,4,556,0,1,0,806,3,2,1264,931,6,1426,0,1,0,1096,3,2,375,979,4,594,16,1,0,759,3,2,375,979,4,594,10,1,0,759,3,2,1265,1578,7,1428,10,1,0,1635,3,2,1266,1579,7,1429,10,1,0,1487,3,2,1267,1580,6,1430,0,1,0,138,3,2,376,980,4,595,16,1,0,801,3,2,376,980,4,595,10,1,0,801,3,2,377,981,4,596,5,1,0,770,3,2,377,981,4,596,0,1,0,770,3,2,378,917,4,576,5,1,0,704,3,2,378,917,4,576,0,1,0,704,3,2,380,923,4,577,5,1,0,702,3,2,380,923,4,577,0,1,0,702,3,2,381,924,4,578,5,1,0,700,3,2,381,924,4,578,0,1,0,700,3,2,382,925,4,579,5,1,0,695,3,2,382,925,4,579,0,1,0,695,3,2,383,926,4,580,5,1,0,698,3,2,383,926,4,580,0,1,0,698,3,2,384,927,4,582,5,1,0,693,3,2,384,927,4,582,0,1,0,693,3,2,385,928,4,583,5,1,0,703,3,2,385,928,4,583,0,1,0,703,3,2,386,929,4,584,5,1,0,701,3,2,386,929,4,584,0,1,0,701,3,2,387,918,4,585,5,1,0,699,3,2,387,918,4,585,0,1,0,699,3,2,388,919,4,586,5,1,0,696,3,2,388,919,4,586,0,1,0,696,3,2,389,920,4,587,5,1,0,697,3,2,389,920,4,587,0,1,0,697,3,2,390,921,4,588,5,1,0,694,3,2,390,921,4,588,0,1,0,694,3,2,391,922,4,589,5,1,0,705,3,2,391,922,4,589,0,1,0,705,3,2,1269,1535,7,1185,1,1,0,707,3,2,1270,1594,7,1413,0,1,0,1095,3,2,1271,1508,7,1184,0,1,0,1479,3,2,1272,1494,6,1420,0,1,0,1082,3,2,1273,821,7,1379,1,1,0,79,3,2,1274,1574,6,1421,0,1,0,691,3,2,392,932,6,591,5,5,1,119,3,2,392,932,6,591,0,1,0,119,3,2,393,930,4,590,5,1,0,732,3,2,393,930,4,590,0,1,0,732,3,2,1276,1541,6,1425,0,1,0,1483,3,2,394,964,4,593,15,1,184,733,3,2,394,964,4,593,17,1,184,733,3,2,395,942,4,561,5,5,0,104,3,2,395,942,4,561,0,5,0,104,3,2,1278,1502,6,1412,0,1,0,688,3,2,399,1077,4,645,5,1,0,99,3,2,399,1077,4,645,0,1,0,99,3,2,1279,1524,6,1463,0,1,0,787,3,2,400,1079,4,646,5,1,0,118,3,2,400,1079,4,646,0,1,0,118,3,2,1280,1526,6,1464,0,1,0,1088,3,2,401,946,4,644,5,1,0,84,3,2,401,946,4,644,0,1,0,84,3,2,1281,1522,6,1462,0,1,0,738,3,2,402,824,4,642,5,1,0,72,3,2,402,824,4,642,0,1,0,72,3,2,403,826,4,643,0,1,0,98,3,2,403,826,4,643,0,1,0,98,3,2,1282,845,6,1434,0,1,0,75,3,2,1283,845,7,1435,10,1,0,75,3,2,1284,1505,7,1436,0,1,0,687,3,2,1285,1553,6,1414,0,1,0,749,3,2,1286,1567,6,1415,0,1,0,750,3,2,1287,1511,6,1416,0,1,0,718,3,2,1288,1491,6,1432,0,1,0,1087,3,2,1292,1569,6,1444,0,1,0,761,3,2,1293,1547,6,1446,0,1,0,715,3,2,1294,1497,6,1445,0,1,0,682,3,2,409,966,4,607,5,1,0,125,3,2,409,966,4,607,0,1,0,125,3,2,410,813,4,608,0,1,0,68,3,2,410,813,4,608,0,1,0,68,3,2,411,1032,6,609,0,1,0,74,3,2,411,1032,4,609,5,5,1,74,3,2,1295,1072,6,1447,0,1,0,82,3,2,412,1010,4,225,5,1,0,108,3,2,412,1010,4,225,0,1,0,108,3,2,1296,1625,4,1157,10,1,10,1102,3,2,1297,938,4,1439,0,1,0,127,3,2,1298,938,7,1438,179,1,0,127,3,2,1299,1543,6,1440,0,1,0,712,3,2,1300,1597,7,1177,1,1,0,671,3,2,414,951,4,615,1,1,0,81,3,2,414,951,4,615,0,1,0,81,3,2,1301,1551,6,1449,0,1,0,731,3,2,1302,1599,7,1178,1,1,0,670,3,2,1303,1603,7,1179,1,1,0,672,3,2,1305,1601,7,1180,1,1,0,673,3,2,1306,1564,6,1433,5,0,1,747,3,2,1307,822,7,137,0,1,0,79,3,2,1308,843,6,1472,0,1,0,106,3,2,1309,841,6,1473,0,1,0,102,3,2,1310,839,6,1474,0,1,0,94,3,2,416,828,4,610,5,1,0,69,3,2,416,828,4,610,0,1,0,69,3,2,1312,1499,6,1448,0,1,0,674,3,2,417,958,4,612,5,1,0,86,3,2,417,958,4,612,0,1,0,86,3,2,418,953,6,611,1,10,1,85,3,2,418,953,6,611,0,10,0,85,3,2,1313,1074,6,1399,0,1,0,110,3,2,420,1030,6,613,5,5,1,121,3,2,420,1030,6,613,0,1,0,121,3,2,421,955,4,614,5,1,0,109,3,2,421,955,4,614,0,1,0,109,3,2,422,936,4,601,5,1,0,92,3,2,422,936,4,601,0,1,0,92,3,2,423,940,4,602,5,1,0,87,3,2,423,940,4,602,0,1,0,87,3,2,1314,1516,6,1441,0,1,0,760,3,2,1315,1592,6,1442,0,1,0,741,3,2,1316,1540,6,1443,0,1,0,719,3,2,425,1040,4,603,5,1,0,756,3,2,425,1040,4,603,0,1,0,756,3,2,426,1042,4,604,5,1,0,752,3,2,426,1042,4,604,0,1,0,752,3,2,427,1044,4,605,5,1,0,754,3,2,427,1044,4,605,0,1,0,754,3,2,428,1046,4,606,5,1,0,758,3,2,428,1046,4,606,0,1,0,758,3,2,1317,1507,6,1417,0,1,0,689,3,2,1318,1530,6,1452,0,1,0,803,3,2,1319,1532,6,1450,0,1,0,1107,3,2,1320,1534,6,1451,0,1,0,1111,3,2,1321,1520,6,1467,0,1,0,810,3,2,1322,1590,6,1431,0,1,0,782,3,2,1323,1588,6,1465,0,1,0,781,3,2,430,1013,4,560,1,1,0,112,3,2,430,1013,4,560,0,1,0,112,3,2,431,911,4,660,5,1,0,70,3,2,431,911,4,660,0,1,0,70,3,2,432,853,4,654,5,1,0,116,3,2,432,853,4,654,0,1,0,116,3,2,433,866,4,655,5,1,0,117,3,2,433,866,4,655,0,1,0,117,3,2,434,868,4,653,5,1,0,96,3,2,434,868,4,653,0,1,0,96,3,2,435,881,4,656,5,1,0,107,3,2,435,881,4,656,0,1,0,107,3,2,436,863,4,650,5,1,0,130,3,2,436,863,4,650,0,1,0,130,3,2,438,870,4,652,5,1,0,105,3,2,438,870,4,652,0,1,0,105,3,2,439,904,4,661,5,1,0,114,3,2,439,904,4,661,0,1,0,114,3,2,440,888,4,658,5,1,0,777,3,2,440,888,4,658,0,1,0,777,3,2,441,895,4,659,5,1,0,73,3,2,441,895,4,659,0,1,0,73,3,2,442,873,4,651,5,1,0,83,3,2,442,873,4,651,0,1,0,83,3,2,443,909,4,662,5,1,0,95,3,2,443,909,4,662,0,1,0,95,3,2,444,900,4,657,5,1,0,120,3,2,444,900,4,657,0,1,0,120,3,2,445,972,4,599,5,1,1,77,3,2,445,972,4,599,0,1,1,77,3,2,446,998,4,597,5,1,1,76,3,2,446,998,4,597,0,1,1,76,3,2,448,956,4,664,0,1,0,138,3,2,448,956,4,664,0,1,0,138,3,2,449,962,4,491,16,1,0,89,3,2,449,962,4,491,10,1,0,89,3,2,450,849,4,236,5,1,0,71,3,2,450,849,4,236,0,1,0,71,3,2,451,1034,4,303,5,1,0,122,3,2,451,1034,4,303,0,1,0,122,3,2,1324,1571,7,1390,1,1,0,1091,3,2,452,970,4,546,5,1,0,80,3,2,452,970,4,546,0,1,0,80,3,2,1325,1607,7,1389,1,1,0,729,3,2,454,1018,4,547,5,1,0,101,3,2,454,1018,4,547,0,1,0,101,3,2,1326,1518,7,1145,1,1,0,1093,3,2,1327,1501,7,1130,0,1,0,678,3,2,455,992,4,598,5,1,0,97,3,2,455,992,4,598,0,1,0,97,3,2,1328,1549,7,1468,0,1,0,721,3,2,1329,1573,7,1469,0,1,0,769,3,2,456,1011,4,192,5,1,0,808,3,2,456,1011,4,192,0,1,0,808,3,2,1330,838,7,1132,10,1,0,94,3,2,1331,840,7,1133,10,1,0,102,3,2,1332,842,7,1134,10,1,0,106,3,2,1333,839,7,1137,10,1,0,94,3,2,1334,841,7,1138,10,1,0,102,3,2,1335,843,7,1139,10,1,0,106,3,2,1336,982,7,1135,10,1,0,774,3,2,1337,983,7,1136,10,1,0,775,3,2,1338,1071,7,1140,10,1,0,82,3,2,1339,1072,7,1142,10,1,0,82,3,2,458,860,4,508,5,1,0,764,3,2,458,860,4,508,0,1,0,764,3,2,459,861,4,509,5,1,0,727,3,2,459,861,4,509,0,1,0,727,3,2,461,889,4,526,5,1,0,1081,3,2,461,889,4,526,0,1,0,1081,3,2,462,891,4,528,5,1,0,676,3,2,462,891,4,528,0,1,0,676,3,2,463,892,4,529,5,1,0,762,3,2,463,892,4,529,0,1,0,762,3,2,464,902,4,536,5,1,0,668,3,2,464,902,4,536,0,1,0,668,3,2,465,896,4,532,5,1,0,1109,3,2,465,896,4,532,0,1,0,1109,3,2,466,897,4,533,5,1,0,768,3,2,466,897,4,533,0,1,0,768,3,2,467,912,4,543,5,1,0,728,3,2,467,912,4,543,0,1,0,728,3,2,468,913,4,544,5,1,0,763,3,2,468,913,4,544,0,1,0,763,3,2,469,875,4,636,5,1,0,1092,3,2,469,875,4,636,0,1,0,1092,3,2,1340,1512,6,1124,0,1,0,1103,3,2,1341,1513,6,1125,0,1,0,1103,3,2,471,986,4,67,5,1,0,720,3,2,471,986,4,67,0,1,0,720,3,2,1342,1073,7,1141,10,1,0,110,3,2,1343,1074,7,1143,10,1,0,110,3,2,1344,931,7,1453,10,1,0,1096,3,2,1345,1514,7,1172,1,1,0,1482,3,2,1346,1495,6,1118,0,1,0,1082,3,2,1347,822,7,1461,1,1,0,79,3,2,477,933,6,186,5,5,1,119,3,2,477,933,6,186,0,1,0,119,3,2,1348,1595,7,1117,0,1,0,1095,3,2,478,833,6,193,5,5,1,124,3,2,478,833,6,193,0,1,0,124,3,2,479,835,4,194,5,1,0,123,3,2,479,835,4,194,0,1,0,123,3,2,481,943,4,637,5,1,0,104,3,2,481,943,4,637,0,1,0,104,3,2,482,1027,4,196,177,1,29,93,3,2,482,1027,4,196,181,1,29,93,3,2,1349,1620,6,1144,0,1,0,800,3,2,1350,1615,6,1410,0,1,0,734,3,2,1352,1617,6,1411,0,1,0,1089,3,2,1354,1575,6,1423,0,1,0,691,3,2,1355,1536,7,1182,1,1,0,707,3,2,1356,1509,7,1183,0,1,0,1478,3,2,1357,1577,7,1424,1,1,0,1094,3,2,1358,1503,6,1437,0,1,0,688,3,2,484,960,4,638,5,1,0,88,3,2,484,960,4,638,0,1,0,88,3,2,487,934,4,581,5,1,0,1108,3,2,487,934,4,581,0,1,0,1108,3,2,1361,1493,6,1475,0,1,0,684,3,2,489,1028,4,189,5,1,0,739,3,2,489,1028,4,189,0,1,0,739,3,2,1362,1605,7,1127,1,1,0,686,3,2,1363,1006,6,1146,0,1,0,103,3,2,1364,1007,6,1148,0,1,0,103,3,2,1365,1006,7,1147,10,1,0,103,3,2,1366,1007,7,1149,10,1,0,103,3,2,1372,1537,7,1152,1,1,0,708,3,2,1373,1538,7,1153,1,1,0,708,24,21,28,146,7,1,0,1,0,142,24,21,30,148,7,1,0,1,0,172,24,21,25,148,4,563,15,1,0,172,24,21,25,148,4,563,17,1,0,172,24,21,26,146,4,562,16,1,0,142,24,21,26,146,4,562,10,1,0,142,24,21,27,147,7,1,0,1,0,141,24,21,53,149,7,1,0,1,0,171,24,21,37,149,4,640,15,1,0,171,24,21,37,149,4,640,17,1,0,171,24,21,38,147,4,639,16,1,0,141,24,21,38,147,4,639,10,1,0,141,19,18,28,166,7,1,0,1,0,45,19,18,30,168,7,1,0,1,0,174,19,18,25,168,4,565,15,1,0,174,19,18,25,168,4,565,17,1,0,174,19,18,26,166,4,564,33,1,0,45,19,18,26,166,4,564,34,1,0,45,19,18,31,947,4,398,5,1,0,78,19,18,31,947,4,398,0,1,0,78,19,18,27,167,7,1,0,1,0,45,19,18,53,169,7,1,0,1,0,173,19,18,37,169,4,137,15,1,0,173,19,18,37,169,4,137,17,1,0,173,19,18,38,167,4,641,33,1,0,45,19,18,38,167,4,641,34,1,0,45,19,18,54,948,4,663,5,1,0,78,19,18,54,948,4,663,0,1,0,78,12,11,28,1067,6,220,5,5,1,129,12,11,28,1067,6,220,0,1,0,129,12,11,30,1047,4,212,15,1,39,62,12,11,30,1047,4,212,17,1,39,62,12,11,25,1049,4,213,15,1,0,61,12,11,25,1049,4,213,17,1,0,61,12,11,26,1051,4,214,15,1,0,60,12,11,26,1051,4,214,17,1,0,60,12,11,41,1053,4,215,15,1,0,58,12,11,41,1053,4,215,17,1,0,58,12,11,31,1055,4,216,33,1,0,57,12,11,31,1055,4,216,34,1,0,57,12,11,32,1059,4,218,15,1,40,91,12,11,32,1059,4,218,17,1,40,91,12,11,63,1061,4,219,16,1,0,90,12,11,63,1061,4,219,10,1,0,90,12,11,35,1065,4,222,5,1,0,128,12,11,35,1065,4,222,0,1,0,128,12,11,36,1063,4,221,5,1,0,111,12,11,36,1063,4,221,0,1,0,111,12,11,27,1057,4,217,176,1,0,113,12,11,27,1057,4,217,180,1,0,113,12,11,238,1068,6,627,5,5,1,129,12,11,238,1068,6,627,0,1,0,129,12,11,239,1048,4,618,15,1,39,62,12,11,239,1048,4,618,17,1,39,62,12,11,240,1050,4,619,15,1,0,61,12,11,240,1050,4,619,17,1,0,61,12,11,64,1052,4,620,15,1,0,60,12,11,64,1052,4,620,17,1,0,60,12,11,132,1054,4,621,15,1,0,58,12,11,132,1054,4,621,17,1,0,58,12,11,42,1056,4,622,33,1,0,57,12,11,42,1056,4,622,34,1,0,57,12,11,133,1060,4,624,15,1,40,91,12,11,133,1060,4,624,17,1,40,91,12,11,43,1062,4,625,16,1,0,90,12,11,43,1062,4,625,10,1,0,90,12,11,65,1066,4,626,5,1,0,128,12,11,65,1066,4,626,0,1,0,128,12,11,55,1064,4,628,5,1,0,111,12,11,55,1064,4,628,0,1,0,111,12,11,134,1058,4,623,176,1,0,113,12,11,134,1058,4,623,180,1,0,113],"strings":["1","0","2","SYSTEMS","TUMB","-1","BTN","LEV","7","INTERCOM","0.5","11","VTWU740","3","LIGHTS","-0.1","-0.5","0.1","12","VIR31A_DME40","13","10","ADF_60","0.9","VHF20B","3003","3004","3011","3001","0.99","3002","3006","3007","-0.25","0.25","3009","3010","3013","3014","0.2","0.3","3005","3026","3028","ADF Switch","Control switch/Frequency control (1 MHz).Rotate mouse wheel to make channel selection","DME Switch","HM Switch","INT Switch","MK Switch","V/UHF Switch","VHF Switch","VOR Switch","3012","3016","3030","(HOT MIC) TALK CIRCUIT BREAKER","0.025 MHz Selector","0.1 MHz Selector","0.6","1 MHz Selector","10 MHz Selector","100 MHz Selector","3008","3024","3029","3041","329","ABORT","AILERON HYD OVERRIDE COVER","BACKUP ADI","CANOPY EMERGENCY JETTISON","CAWS Panel Bright/Dim","CONSOLE LIGHTS","CONTINUOUS IGNITION/START","Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage","Canopy Locking Handle","Canopy Safety Catch","DME selector","Decision Height setting / ADI/HSI digital displays brightness","EJECTION HANDLE","EMERGENCY LANDING GEAR EXTENSION","ENGINE START LIGHT TEST","ENGINE STARTER","ESS BUS Cover","Emergency Elevator Trim Switch","Emergency Elevator Trim Switch Cutout Guard","Engine Fuel Valve Cover","FD Panel Brightness","FLAP POSITION SELECTOR","Frequency Mode Dial","Function Dial","Fuselage Tank Pump Cover","INITIAL CANNON LOAD","INNER MARKER LAMP TEST","INTERPHONE","ITT","LANDING GEAR HANDLE","Lamp Test","Left Battery Isolation Cover","MAIN MODE SELECTOR","MANUAL SEPERATION HANDLE","MIDDLE MARKER LAMP TEST","MPR Lamp Test","NAV TEST SWITCH","OIL TEMP IND","OUTER MARKER LAMP TEST","OXY SYS\nHYD SYS PRESS IND","OXYGEN SUPPLY","PITCH TRIM BREAKER","PITCH TRIM DISC LAMP TEST","POWER TRANSMIT SELECTOR","Parking Brake","Preset Channel Selector","RED COCKPIT LIGHTING","RED FLOOD LIGHTING","RPM N1","RPM N2","Right Battery Isolation Cover","Rudder Trim Switch","SEAT ADJUSTMENT","SEAT HEIGHT ADJUSTMENT","SHOW/HIDE FLIGHT STICK","STALL WARNING POWER","STALL WARNING TEST","STARTER MODE SELECTOR","STORM LIGHTS","Set Clock Knob","Squelch Switch","TEST SELECTOR SWITCH","VOR DC","3018","3025","3027","3031","3040","3043","923","Fast Erect","Function Selector Switch/Gain control. Left/right mouse click to cycle selector. Rotate mouse wheel to change Gain value","Left frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob","OFF/PWR/TEST switch/Frequency control (1 MHz). Rotate mouse wheel to change frequency","OFF/PWR/TEST switch/Frequency control (100 MHz).Rotate mouse wheel to make channel selection","PNT-ADF-1-RP","PNT-ADF-2-RP","PNT-ADF-3-RP","PNT-COMM-PWR-RP","PNT-COMM-PWR-RP-BACK","PNT-COMM-VOL-RP","PNT-COMM-VOL-RP-BACK","PNT-INT-ADF-RP","PNT-INT-ADF-RP-BACK","PNT-INT-DME-RP","PNT-INT-DME-RP-BACK","PNT-INT-HVOL-RP","PNT-INT-HVOL-RP-BACK","PNT-INT-IVOL-RP","PNT-INT-IVOL-RP-BACK","PNT-INT-MVOL-RP","PNT-INT-MVOL-RP-BACK","PNT-INT-VOVOL-RP","PNT-INT-VOVOL-RP-BACK","PNT-INT-VUHF-RP","PNT-INT-VUHF-RP-BACK","PNT-INT-VVOL-RP","PNT-INT-VVOL-RP-BACK","PNT-NAV-MS-RP","PNT-NAV-MS-RP-BACK","PNT-NAV-VOL-RP","PNT-NAV-VOL-RP-BACK","Right frequency selector: mousewheel - middle knob, left+mousewheel - lower knob, right+mousewheel - upper knob","Volume control/Frequency control (0.025 MHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency","Volume control/Frequency control (10 kHz). Right mouse click to select FREQUENCY SELECTOR (0.025 MHz). Rotate mouse wheel to select channel","Volume control/Frequency control (50 kHz). Left/right mouse click to adjust volume. Rotate mouse wheel to change frequency","Volume control/Frequency control (50 kHz). Right mouse click to select FREQUENCY SELECTOR (50 kHz). Rotate mouse wheel to make channel selection","","-0.05","-0.11","-0.33","0.04","0.05","0.11","0.33","0.75","0.8","0.994","1105","1109","1140","1182","1189","119","1196","1208","1209","121","1285","130","131","132","133","137","138","139","14","144","148","149","193","195","196","197","226","227","228","229","230","231","232","233","234","235","236","248","249","253","268","280","282","283","284","285","286","287","3015","3017","302","3020","3021","3022","3023","3032","3034","3037","3038","3039","3042","3044","3045","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3061","3062","3063","3068","3069","3070","3071","3072","3073","3074","3075","3076","3078","3081","3082","3083","3084","3085","3087","3088","3089","309","3090","3091","3092","3093","3094","3095","3096","3098","3099","3100","3101","3102","3103","3106","3107","3108","3109","3110","3113","3114","3115","3117","312","3120","3121","3122","3123","3125","315","3150","3152","3156","3157","316","3160","317","318","319","3195","3199","320","3200","3203","3204","3205","3206","3207","3208","3209","321","3210","3211","3212","3213","3214","3215","3216","3217","322","3220","3221","3224","3226","3233","3236","3238","324","3245","3247","3250","3252","3254","3255","3256","3257","3258","3259","326","3260","3270","3280","3291","3292","3293","3294","330","331","3312","3314","3315","3316","3317","3318","332","3321","3326","3327","3329","333","3330","3331","3332","3333","3335","3336","3337","3338","3339","3340","3341","3342","3350","3351","3354","3355","338","339","340","3400","3402","3404","3406","3407","341","3416","3417","3420","3421","3425","3426","3427","3429","343","3435","346","3466","3468","3469","347","3471","3473","3474","3475","348","3480","3481","3482","3483","349","3492","3494","3495","3496","3497","3498","3499","350","3500","3501","3502","3503","3504","3505","3506","3508","3509","351","3512","3514","3515","3516","3519","352","3521","3524","3527","353","3538","3539","354","3540","3541","3542","3543","3544","3545","3546","3547","3548","355","3551","356","357","358","359","360","3604","3606","3607","361","3628","3637","366","3661","367","368","3680","369","3691","370","38","404","419","420","421","422","424","425","427","428","429","430","431","432","433","434","435","436","437","438","439","440","441","442","443","444","445","446","447","448","449","450","451","452","454","455","456","457","458","459","460","461","462","463","464","465","466","467","468","469","470","471","472","473","474","520","522","532","536","537","569","587","588","589","590","591","593","594","596","65","650","653","655","657","659","677","679","680","690","691","692","693","694","695","696","699","700","701","702","703","704","705","706","707","708","709","710","711","712","716","717","720","726","728","733","734","749","75","750","8","812","814","818","819","820","821","825","826","827","829","832","833","841","842","843","849","850","862","863","864","865","866","867","868","869","872","875","876","884","886","887","888","889","890","891","903","915","916","917","919","921","931","932","933","935","937","941","942","947","949","950","951","952","953","954","955","956","957","958","959","960","961","965","966","AC Inverter Norm/Alt","ADC BREAKER","ADF 26 VAC","ADF DC","ADF Tone Switch","ADJUST RED LIGHT - LEFT CENTER PANEL","ADJUST RED LIGHT - LEFT CONSOLE","ADJUST RED LIGHT - RIGHT CENTER PANEL","ADJUST RED LIGHT - RIGHT CONSOLE","AILERON HYD OVERRIDE","AIR BRAKE\nANTI-SKID OPERATION","AIR DATA COMPUTER/FLIGHT DIRECTOR","AIR FLOW MODE","AIR VENT","AIR-CONDITIONING MASTER SWITCH","AIR-CONDITIONING/PRESSURIZATION","ANTI-COLLISION BEACON","ANTI-ICE","ANTI-ICE/RAIN REPELLENT","ATTITUDE TEST","AUDIO LIGHT SWITCH","Adjust Rudder Pedals","Altimeter Baro Adjust","Altimeter Test Adjust","Antiskid ON/OFF","BACKUP INVERTER","BEARING SELECT PUSHBUTTON","BOMB ARMING SELECTOR","BREAKER 115 VAC SIGHT","BREAKER ARMING CONTROL","BREAKER EMERG","BREAKER MACHINE GUN 1","BREAKER MACHINE GUN 2","BREAKER NORMAL","BREAKER PYLON IN LEFT","BREAKER PYLON IN RIGHT","BREAKER PYLON MID LEFT","BREAKER PYLON MID RIGHT","BREAKER PYLON OUT LEFT","BREAKER PYLON OUT RIGHT","BREAKER SIGHT CAMERA","Battery Master Switch","CANOPY EMERGENCY FRACTURING","CANOPY EMERGENCY FRACTURING SAFETY PIN","CAUTION/WARNING PANEL","CB Formation Lights","CENTER WING TANK PUMPS","CHRONOGRAPH","CODE SELECT","COMPASS LIGHT","COMPUTER","CONSOLE INTEGRAL LIGHTING","Call button","Caution Alert Reset","Center Wing Tank Qty","Close/open IFR hood","Course Knob","DC Bus Tie","DEPRESSION 0XX","DEPRESSION AUTO/MAN/TEST","DEPRESSION X0X","DEPRESSION XX0","DME","DME 26 VAC","EJECTION HANDLE SAFETY","ELEVATOR TRIM POWER","EMERGENCY AIR BRAKE RETRACT","EMERGENCY FUEL Cover","EMERGENCY FUEL LEVER","EMERGENCY JETTISON","EMERGENCY VENTILATION","ENGINE COMPUTER","ENGINE GENERATOR","ESS BUS Transfer","Ejection Seat Priority Lever","Emergency locator tranmsitter","Engine Fuel Valve","FD BREAKER","FIRE DETECTOR","FLAPS INDICATOR\nAILERON INDICATOR","FLIGHT DIRECTOR 26 VAC","FORMATION LIGHTS","FUEL FLOW RESET","FUSELAGE TANK PUMP","Fault Alert Reset","Fire Alert Test","Fuel Transfer Center 1","Fuel Transfer Center 1/Fwd Cockpit Priority","Fuel Transfer Center 2","Fuel Transfer Center 2/Fwd Cockpit Priority","Fuel Transfer Left","Fuel Transfer Left/Fwd Cockpit Priority","Fuel Transfer Right","Fuel Transfer Right/Fwd Cockpit Priority","Function Selector","Fuselage Tank Pump","GPU","GYRO PLAT 115 VAC","GYRO PLAT 26 VAC","GYRO PLATFORM","Generator GROUND FAULT/OVERVOLTAGE Test","Generator ON/OFF/RESET","Gunsight Sun Filter","HOR GYRO","Heading Knob","Hemisphere Switch","IDENT SWITCH","IFF BREAKER","IFF MODE 4","IFF REPLY LAMP TEST","IFF TEST","INSTRUMENT LIGHTING","INSTRUMENTS AND STORM LIGHTS","INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS","Intercom volume","LANDING GEAR","LANDING GEAR OVERRIDE","LANDING GEAR WARNING MUTE","LANDING GEAR/AIRBRAKE/TRIM INDICATORS","LEFT LANDING LIGHT/FWD COCKPIT PRIORITY","LEFT TAXI/LANDING LIGHT","LH LAND/TAXI LIGHT","Left Battery Isolation Switch","MANUAL TEMPERATURE CONTROL","MASTER ARM","MASTER MODE","MASTER MODE COVER","MASTER SWITCH","MODE 1 - 0X","MODE 1 - X0","MODE 3 - 000X","MODE 3 - 00X0","MODE 3 - 0X00","MODE 3 - X000","MODE SELECTOR","MODE SELECTOR/CANCEL","Mag Var Control","NAV LIGHTS","NAV PRIORITY","NORMAL INVERTER","OIL PRESSURE","OPTICAL SIGHT ON/OFF","OUTER WING TANK PUMPS","OXYGEN PRESSURE WARNING SWITCH","PITCH TRIM TONE MUTE","PITOT HEAT","PITOT HEAT\nSTALL WARNING SYSTEM","PNT-ABRT-SW-LP","PNT-ABRT-SW-LP-BACK","PNT-AC-ACOND-RP","PNT-AC-MAN-RP","PNT-AC-SELFLU-RP","PNT-AC-TEMP-RP","PNT-AC-VEMERG-RP","PNT-ADF-ONOFF-RP","PNT-ADF-TFR-RP","PNT-ADI-DH-DIM-RP","PNT-ADI-DH-DIM-RP-BACK","PNT-AFL-CPR","PNT-AFL-CPR-BACK","PNT-AFT-CPR","PNT-AFT-CPR-BACK","PNT-AILCOV-LP","PNT-AILCOV-LP-BACK","PNT-ALUM-RP","PNT-ALUM-RP-BACK","PNT-ANCO-RP","PNT-APL-TEST-CPL","PNT-APL-TEST-CPL-BACK","PNT-APR-CPL","PNT-APR-CPL-BACK","PNT-AUHF-CP","PNT-BATTERY-CPR","PNT-BE-MBI-CP","PNT-BE-MBI-CP-BACK","PNT-BE-MBM-CP","PNT-BE-MBM-CP-BACK","PNT-BE-MBO-CP","PNT-BE-MBO-CP-BACK","PNT-BKADI-K02-CP","PNT-BKADI-K02-CP-BACK","PNT-CAB-RP","PNT-CAB-RP-BACK","PNT-CANOPY-EME","PNT-CANOPY-EME-BACK","PNT-CB-01-LP","PNT-CB-02-LP","PNT-CB-03-LP","PNT-CB-03-LP-BACK","PNT-CB-04-LP","PNT-CB-05-LP","PNT-CB-06-LP","PNT-CB-07-LP","PNT-CB-08-LP","PNT-CB-09-LP","PNT-CB-10-LP","PNT-CB-11-LP","PNT-CB-12-LP","PNT-CB-12-LP-BACK","PNT-CB-12B-LP","PNT-CB-13-LP","PNT-CB-13-LP-BACK","PNT-CB-14-LP","PNT-CB-14-LP-BACK","PNT-CB-15-LP","PNT-CB-15-LP-BACK","PNT-CB-16-LP","PNT-CB-17-LP","PNT-CB-17-LP-BACK","PNT-CB-18-LP","PNT-CB-18-LP-BACK","PNT-CB-19-LP","PNT-CB-20-LP","PNT-CB-21-LP","PNT-CB-22-LP","PNT-CB-23-LP","PNT-CB-23-LP-BACK","PNT-CB-24-LP","PNT-CB-24B-LP","PNT-CB-25-LP","PNT-CB-26-LP","PNT-CB-27-LP","PNT-CB-28-LP","PNT-CB-28-LP-BACK","PNT-CB-29-LP","PNT-CB-30-LP","PNT-CB-31-LP","PNT-CB-32-LP","PNT-CB-33-LP","PNT-CB-34-LP","PNT-CB-34-LP-BACK","PNT-CB-35-LP","PNT-CB-36-LP","PNT-CB-36B-LP","PNT-CB-37-LP","PNT-CB-37-LP-BACK","PNT-CB-38-LP","PNT-CB-39-LP","PNT-CB-40-LP","PNT-CB-40-LP-BACK","PNT-CB-41-LP","PNT-CB-42-LP","PNT-CB-43-LP","PNT-CB-44-LP","PNT-CB-44-LP-BACK","PNT-CB-45-LP","PNT-CB-45-LP-BACK","PNT-CB-46-LP","PNT-CB-47-LP","PNT-CB-48-LP","PNT-CB-48B-LP","PNT-CB-49-LP","PNT-CB-ARM-1-LP","PNT-CB-ARM-10-LP","PNT-CB-ARM-11-LP","PNT-CB-ARM-12-LP","PNT-CB-ARM-13-LP","PNT-CB-ARM-14-LP","PNT-CB-ARM-2-LP","PNT-CB-ARM-3-LP","PNT-CB-ARM-4-LP","PNT-CB-ARM-5-LP","PNT-CB-ARM-7-LP","PNT-CB-ARM-8-LP","PNT-CB-ARM-9-LP","PNT-CB-FUEL-EMER-TA","PNT-CB-TELEBRIEFING-LP","PNT-CB-TRIM-LP","PNT-CB-TRIM-LP-BACK","PNT-CB-UHF-RACAL","PNT-CBOMSUM-LP","PNT-CBOMSUM-LP-BACK","PNT-CLKT-KNB-CP","PNT-CLKT-KNB-CP-BACK","PNT-CLLAVCOM-LP","PNT-CLLAVCOM-LP-BACK","PNT-CODE-KNB-CPD","PNT-COMMN-TB-RP","PNT-COMMN-TB-RP-BACK","PNT-CONV-CPR","PNT-COV01-CPR","PNT-COV01-CPR-BACK","PNT-DME-CP","PNT-DME-CP-BACK","PNT-ELT-CP","PNT-EMERGLG-LP","PNT-EMERGLG-LP-BACK","PNT-EMERGTRP-LP","PNT-EMERGTRP-LP-BACK","PNT-EMETBREAK-LP","PNT-EMETBREAK-LP-BACK","PNT-ERCR-CP-BACK","PNT-ETP-GUARD-LP","PNT-ETP-GUARD-LP-BACK","PNT-FD-KNB-RP","PNT-FD-KNB-RP-BACK","PNT-FLAPSH-LP","PNT-FLAPSH-LP-BACK","PNT-FOR-RP","PNT-FUEL-2-RE-CP","PNT-GA-SW-LP","PNT-GA-SW-LP-BACK","PNT-GENL-CPR","PNT-GENR-CPR","PNT-HN-ES-ST","PNT-HN-ES-ST-BACK","PNT-HND-CNPY","PNT-HND-CNPY-BACK","PNT-HUD-1S-CP","PNT-HUD-2S-CP","PNT-HUD-3S-CP","PNT-HUD-MS-SW-CP","PNT-HUD-ON-SW-CP","PNT-IDENT-CPD","PNT-IFF-1","PNT-IFF-6","PNT-IFF-7","PNT-IFF-REP-CP","PNT-IFF-TEST-CP","PNT-IFFCS-CPD","PNT-IFFM4L-CPD","PNT-IFR-HOOD","PNT-INT-MAINS-RP","PNT-INT-MAINS-RP-BACK","PNT-INT-P-HTBT-RP","PNT-INT-P-HTBT-RP-BACK","PNT-LDNG-H-CPL","PNT-LDNG-H-CPL-BACK","PNT-LNDG-L-CPL","PNT-LNDG-L-CPL-BACK","PNT-LNDG-R-CPL","PNT-LNDG-R-CPL-BACK","PNT-LOCK-CNPY","PNT-LOCK-CNPY-BACK","PNT-M1D1-CPD","PNT-M1D2-CPD","PNT-M3A1-CPD","PNT-M3A2-CPD","PNT-M3A3-CPD","PNT-M3A4-CPD","PNT-MAG-COM-CP","PNT-MPR-LGT","PNT-MPR-LGT-BACK","PNT-MST-KNB-CPD","PNT-OXIGENE-RP","PNT-OXIGENE-RP-BACK","PNT-OXYGEN-PRO-BACK","PNT-PARKING-CPL","PNT-PARKING-CPL-BACK","PNT-POSI-RP","PNT-RAD-CPD","PNT-RALT-CP","PNT-RT-ES-ST","PNT-RT-ES-ST-BACK","PNT-SCAR-BA-KB-CP","PNT-SCAR-JS-KB-CP","PNT-SCAR-MA-SW-CP","PNT-SCAR-MS-KB-CP","PNT-SCAR-RC-CP","PNT-SCAR-RC-SW-CP","PNT-SCAR-RT-KB-CP","PNT-SCARD-IC-KB-CP","PNT-SCARD-IC-KB-CP-BACK","PNT-SEAT-1","PNT-SEATADJ-LP","PNT-SEATADJ-LP-BACK","PNT-START-SW-LP","PNT-START-SW-LP-BACK","PNT-STICK-CPD","PNT-STICK-CPD-BACK","PNT-TM1-CPD","PNT-TM2-CPD","PNT-TM3-CPD","PNT-TMC-CPD","PNT-TRANSF01-LP","PNT-TRANSF01-LP-BACK","PNT-TRANSF02-LP","PNT-TRANSF02-LP-BACK","PNT-TRANSF03-LP","PNT-TRANSF03-LP-BACK","PNT-TRANSF04-LP","PNT-TRANSF04-LP-BACK","PNT-UHF-1S-CP","PNT-UHF-1S-CP-BACK","PNT-UHF-2S-CP","PNT-UHF-2S-CP-BACK","PNT-UHF-3S-CP","PNT-UHF-3S-CP-BACK","PNT-UHF-4S-CP","PNT-UHF-4S-CP-BACK","PNT-UHF-5S-CP","PNT-UHF-5S-CP-BACK","PNT-UHF-CHS-CP","PNT-UHF-CHS-CP-BACK","PNT-UHF-FS-CP","PNT-UHF-FS-CP-BACK","PNT-UHF-MD-CP","PNT-UHF-MD-CP-BACK","PNT-UHF-PW-CP","PNT-UHF-PW-CP-BACK","PNT-UHF-SQL-CP","PNT-UHF-SQL-CP-BACK","PNT-UHF-TS-CP","PNT-UHF-TS-CP-BACK","PNT-UNIONB-CPR","PNT-VIDEO-1-SW-CP","PNT-YB-EP-LP","PNT-YB-EP-LP-BACK","PNT-YB-TRIM-LP","PNT-YB-TRIM-LP-BACK","POSITION LIGHTS\nRH LAND/TAXI LIGHTS","PTN-COV02-CPR","PTN-COV02-CPR-BACK","PTN-COV03-CPR","PTN-COV03-CPR-BACK","RAD TEST SWITCH","RADIO ALTIMETER","RADIO ALTITUDE SWITCH TEST ADI","RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY","RIGHT TAXI/LANDING LIGHT","RIPPLE TIME","Radio altimeter","Reset Max/Min Needles","Right Battery Isolation Switch","SCAR LIGHT TEST","SELECTIVE JETTISON SELECTOR","SHOULDER HARNESS CONTROL HANDLE","STALL WARNING SYSTEM","STORAGE BOX COVER","Sight Brightness","Standby Altimeter Baro Adjust","TELEBRIEFING","TEMPERATURE MODE","TEST M-1 SWITCH","TEST M-2 SWITCH","TEST M-3/A SWITCH","TEST M/C SWITCH","THROTTLE IDLE DETENT","Tap Glass","Transfer Switch","U/VHF","UHF ANTENNA SELECTION","UHF PRIORITY","UHF RACAL","VERT GYRO","VHF","VHF PRIORITY","VOR AC","Video ON/STB/OFF","-0.142","0.142","101","1021","1045","1110","1112","1113","1141","117","1190","1191","120","1202","122","123","1230","124","1253","1254","1255","1256","1257","1258","1259","1260","1273","1274","1275","1276","1289","1310","1312","1313","1317","1318","134","135","1354","1355","136","145","147","15","16","17","210","211","212","213","214","215","217","218","219","25","250","251","256","258","259","261","262","263","264","266","267","269","277","279","290","294","296","3019","3033","3035","3036","3046","3047","3048","3049","308","3104","3105","311","3111","3112","3116","3118","3119","3124","314","3147","3148","3149","3151","3153","3158","3161","3162","3163","3166","3167","3168","3169","3170","3171","3172","3174","3175","3176","3177","3178","3179","32","3201","3202","3218","3219","3222","3227","3228","323","3230","3231","3232","3234","3235","3239","3240","3241","3242","3243","3244","3246","3248","325","3261","3262","3263","3264","3265","3266","3267","3268","3269","327","3271","328","3310","3320","3322","3323","3325","334","3343","3344","3345","3346","3347","3349","335","3352","336","3364","3401","3403","3405","3408","3409","3410","3412","3413","3414","3415","3418","3419","342","3422","3423","3424","3428","3430","3431","3432","3433","3434","3436","3438","3439","344","3440","3441","3443","3444","3445","3446","345","3467","3470","3476","3477","3478","3484","3485","3486","3487","3488","3489","3490","3518","3520","3522","3523","3525","3526","3528","3529","3530","3531","3532","3533","3534","3535","3536","3537","3549","3550","3552","3553","3554","3557","3600","3601","3605","3638","3639","364","3640","365","3651","3652","3653","3654","3658","3670","3671","3688","3696","3702","3703","3704","3705","394","396","397","398","399","3990","3991","400","402","403","41","411","412","423","5","513","514","515","516","517","518","519","521","523","525","526","527","528","529","530","531","533","534","538","542","543","544","545","546","547","567","568","573","597","598","607","620","634","636","637","638","66","678","683","689","697","698","713","715","718","722","729","730","732","770","774","779","782","783","792","798","809","810","811","813","815","816","822","823","824","828","830","831","837","838","839","851","853","894","896","897","898","899","901","924","934","936","938","939","94","940","943","944","945","946","968","969","970","995","ALTITUDE MODE","ANTI-RAIN FLUID","AOA Adjust","AOA INDICATOR KNOB","APPROACH MODE","BACK COURSE MODE","Blackout curtain","EMERGENCY FUEL Valve","FUEL FLOW TEST","HEADING MODE","INDICATED AIR SPEED MODE","Latitude Correction","NAV MODE","PNT-AC-TEMPKNB-RP","PNT-ACELKNB-CP","PNT-ACELKNB-CP-BACK","PNT-ADI-ATTBT-CP","PNT-ADI-ATTBT-CP-BACK","PNT-ADI-DH-CP","PNT-ADI-DH-CP-BACK","PNT-AH-BT-LP","PNT-AH-BT-LP-BACK","PNT-AILBTN-LP","PNT-AILBTN-LP-BACK","PNT-AIRINLET-RP","PNT-AIRINLET-RP-BACK","PNT-AL-YLL-BT","PNT-AL-YLL-BT-BACK","PNT-ALT-KNB-CP","PNT-ALT-KNB-CP-BACK","PNT-ANTISKID-CP","PNT-ANTISKID-CP-BACK","PNT-AOA-IN-KB-CP","PNT-AOA-IN-KB-CP-BACK","PNT-AVISO-CP","PNT-AVISO-CP-BACK","PNT-BACK-ALT-GL","PNT-BACK-ALT-GL-BACK","PNT-BLACKOUT-CURTAIN","PNT-BOMSUM-LP","PNT-BOMSUM-LP-BACK","PNT-BOX-FRONT","PNT-BOX-FRONT-BACK","PNT-BTN-01-CPL","PNT-BTN-01-CPL-BACK","PNT-BTN-01-CPR","PNT-BTN-01-CPR-BACK","PNT-BTN-02-CPR","PNT-BTN-02-CPR-BACK","PNT-BTN-03-CPR","PNT-BTN-03-CPR-BACK","PNT-BTN-ANRA-CPL","PNT-BTN-FLUX-CP","PNT-BTN-NAV-CP","PNT-BTN-NAV-CP-BACK","PNT-BTN-UHF-CP","PNT-BTN-UHF-CP-BACK","PNT-BTN-VHF-CP","PNT-BTN-VHF-CP-BACK","PNT-CANO-FRAC","PNT-CANO-FRAC-BACK","PNT-CANO-FRAC-PIN","PNT-CANO-FRAC-PIN-BACK","PNT-CANTCOM-LP","PNT-CANTCOM-LP-BACK","PNT-CB-FUEL-EMER-LP","PNT-CLKC-BT-CP","PNT-CLKC-BT-CP-BACK","PNT-CNS-KNB-RP","PNT-CNS-KNB-RP-BACK","PNT-COMP-BT-LP","PNT-COMP-BT-LP-BACK","PNT-CRS-KNB-CPD","PNT-CRS-KNB-CPD-BACK","PNT-EMERGAB-LP","PNT-EMERGAB-LP-BACK","PNT-FALLO-CP","PNT-FALLO-CP-BACK","PNT-FD-ALT","PNT-FD-APR","PNT-FD-BC","PNT-FD-HDG","PNT-FD-IAS","PNT-FD-NAV","PNT-FD-SBY","PNT-FD-VOR","PNT-FD-VS","PNT-FFLW-KNB-CP","PNT-FFLW-KNB-CP-BACK","PNT-FRICT-TH","PNT-FUEGO-CP","PNT-FUEGO-CP-BACK","PNT-GPU-LP","PNT-GPU-LP-BACK","PNT-HARN-SEAT","PNT-HARN-SEAT-BACK","PNT-HDG-KNB-CPD","PNT-HDG-KNB-CPD-BACK","PNT-HSI-BR-CP","PNT-HSI-BR-CP-BACK","PNT-HUD-1-RE-CP","PNT-HUD-1-RE-CP-BACK","PNT-IFF-2","PNT-IFF-3","PNT-IFF-5","PNT-INT-CALL-RP","PNT-INT-CALL-RP-BACK","PNT-INT-MAINV-RP","PNT-INT-MAINV-RP-BACK","PNT-INTR-KNB-RP","PNT-INTR-KNB-RP-BACK","PNT-LG-OVR-CPR","PNT-LG-OVR-CPR-BACK","PNT-LG-RESET-LP","PNT-LG-RESET-LP-BACK","PNT-LLAVCOM-LP","PNT-LLAVCOM-LP-BACK","PNT-MIRROR","PNT-RA-KB-CP","PNT-RA-KB-CP-BACK","PNT-RL-LC","PNT-RL-LC-BACK","PNT-RL-LCP","PNT-RL-LCP-BACK","PNT-RL-RC","PNT-RL-RC-BACK","PNT-RL-RCP","PNT-RL-RCP-BACK","PNT-RUDREG-CPD","PNT-RUDREG-CPD-BACK","PNT-SC-ES-ST","PNT-SC-ES-ST-BACK","PNT-SCAR-1P-BT-CP","PNT-SCAR-2P-BT-CP","PNT-SCAR-3P-BT-CP","PNT-SCAR-4P-BT-CP","PNT-SCAR-5P-BT-CP","PNT-SCAR-6P-BT-CP","PNT-SCAR-EJ-BT-CP","PNT-SCAR-EJ-BT-CP-BACK","PNT-SCAR-LT-BT-CP","PNT-SCAR-LT-BT-CP-BACK","PNT-SCAR-SJ-BT-CP","PNT-SCARD-CB-BT-CP","PNT-SCARD-CB-BT-CP-BACK","PNT-SIGHTGLASS-KNB-RP","PNT-SIGHTGLASS-KNB-RP-BACK","PNT-TESTFUEL-LP","PNT-THRT-LP","PNT-THRT-LP-BACK","PYLON SELECT #1","PYLON SELECT #2","PYLON SELECT #3","PYLON SELECT #4","PYLON SELECT #5","PYLON SELECT #6","SELECTIVE JETTISON","STANDBY MODE","Show/Hide Mirror","Synchnonizer and Heading Set","TEMPERATURE REGULATION CONTROL","THROTTLE FRICTION","Test Fuel Qty Indicator","VERTICAL SPEED MODE","VOR APPROACH MODE"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"C-101EB","rows":[18,17,26,862,4,406,5,1,0,111,18,17,26,862,4,406,0,1,0,111,18,17,31,852,4,407,24,1,23,90,18,17,31,852,4,407,25,1,23,90,18,17,32,854,4,408,20,1,13,91,18,17,32,854,4,408,14,1,13,91,18,17,27,856,4,409,20,1,13,92,18,17,27,856,4,409,14,1,13,92,18,17,28,858,4,410,24,1,23,93,18,17,28,858,4,410,25,1,23,93,18,17,29,1390,6,1160,0,1,0,585,18,17,33,860,7,1158,0,1,0,128,18,17,51,860,7,1159,1,1,0,128,18,17,34,863,4,513,5,1,0,111,18,17,34,863,4,513,0,1,0,111,18,17,35,853,4,514,24,1,23,90,18,17,35,853,4,514,25,1,23,90,18,17,38,855,4,515,20,1,13,91,18,17,38,855,4,515,14,1,13,91,18,17,36,857,4,516,20,1,13,92,18,17,36,857,4,516,14,1,13,92,18,17,37,859,4,517,24,1,23,93,18,17,37,859,4,517,25,1,23,93,18,17,40,1391,6,1231,0,1,0,585,18,17,41,861,7,1229,0,1,0,128,18,17,131,861,7,1230,1,1,0,128,12,11,26,884,4,182,153,1,59,113,12,11,26,884,4,182,155,1,59,113,12,11,31,878,4,177,20,1,14,62,12,11,31,878,4,177,14,1,14,62,12,11,32,874,4,178,20,1,13,61,12,11,32,874,4,178,14,1,13,61,12,11,27,880,4,179,20,1,13,60,12,11,27,880,4,179,14,1,13,60,12,11,28,876,4,180,20,1,13,58,12,11,28,876,4,180,14,1,13,58,12,11,29,882,4,181,24,1,23,57,12,11,29,882,4,181,25,1,23,57,12,11,33,845,4,184,19,1,0,87,12,11,33,845,4,184,8,1,0,87,12,11,51,847,4,183,24,1,23,94,12,11,51,847,4,183,25,1,23,94,12,11,52,1384,6,975,0,1,0,901,12,11,34,849,4,185,5,1,0,126,12,11,34,849,4,185,0,1,0,126,12,11,35,1386,7,974,1,1,0,927,12,11,38,843,4,176,0,5,1,127,12,11,36,843,6,176,0,1,0,127,12,11,37,1380,7,963,1,1,0,918,12,11,40,1378,7,1214,1,1,0,917,12,11,41,1382,6,1215,0,1,0,920,12,11,42,885,4,498,153,1,59,113,12,11,42,885,4,498,155,1,59,113,12,11,53,879,4,493,20,1,14,62,12,11,53,879,4,493,14,1,14,62,12,11,43,875,4,494,20,1,13,61,12,11,43,875,4,494,14,1,13,61,12,11,63,881,4,495,20,1,13,60,12,11,63,881,4,495,14,1,13,60,12,11,54,877,4,496,20,1,13,58,12,11,54,877,4,496,14,1,13,58,12,11,133,883,4,497,24,1,23,57,12,11,133,883,4,497,25,1,23,57,12,11,64,846,4,500,19,1,0,87,12,11,64,846,4,500,8,1,0,87,12,11,134,848,4,499,24,1,23,94,12,11,134,848,4,499,25,1,23,94,12,11,135,1385,6,1217,0,1,0,901,12,11,136,850,4,501,5,1,0,126,12,11,136,850,4,501,0,1,0,126,12,11,199,1387,7,1216,1,1,0,927,12,11,65,844,4,488,0,5,1,127,12,11,137,844,6,488,0,1,0,127,12,11,138,1381,7,1213,1,1,0,918,12,11,66,1379,7,933,1,1,0,917,12,11,55,1383,6,934,0,1,0,920,39,30,26,1368,7,1143,14,1,0,929,39,30,31,891,7,1144,14,1,0,577,39,30,32,891,4,1145,0,1,0,577,39,30,27,1369,6,1146,0,1,0,1396,39,30,28,1370,7,1147,1,1,0,1397,39,30,29,829,4,404,24,1,0,905,39,30,29,829,4,404,25,1,0,905,22,21,26,1376,6,1140,0,1,0,912,22,21,31,1374,6,1141,0,1,0,911,22,21,32,1388,7,1142,1,1,0,582,22,21,27,864,4,400,20,1,13,156,22,21,27,864,4,400,14,1,13,156,22,21,28,866,4,401,20,1,13,88,22,21,28,866,4,401,14,1,13,88,22,21,29,868,4,402,19,1,8,89,22,21,29,868,4,402,8,1,8,89,22,21,33,1392,7,1139,0,1,0,648,22,21,34,1377,6,1226,0,1,0,912,22,21,35,1375,6,1227,0,1,0,911,22,21,38,1389,7,1228,1,1,0,582,22,21,36,865,4,510,20,1,13,605,22,21,36,865,4,510,14,1,13,605,22,21,37,867,4,511,20,1,13,88,22,21,37,867,4,511,14,1,13,88,22,21,40,869,4,512,19,1,8,89,22,21,40,869,4,512,8,1,8,89,22,21,41,1393,7,1225,0,1,0,648,10,9,26,141,4,189,5,1,0,45,10,9,26,141,4,189,0,1,0,45,10,9,31,141,7,1148,0,1,0,45,10,9,32,151,4,191,5,1,0,49,10,9,32,151,4,191,0,1,0,49,10,9,27,151,7,1150,0,1,0,49,10,9,28,139,4,192,5,1,0,44,10,9,28,139,4,192,0,1,0,44,10,9,29,139,7,1151,0,1,0,44,10,9,33,149,4,194,5,1,0,50,10,9,33,149,4,194,0,1,0,50,10,9,51,149,7,1153,0,1,0,50,10,9,52,143,4,195,5,1,0,46,10,9,52,143,4,195,0,1,0,46,10,9,34,143,7,1154,0,1,0,46,10,9,35,791,4,196,5,1,0,56,10,9,35,791,4,196,0,1,0,56,10,9,38,1341,6,1155,0,1,0,574,10,9,36,1343,7,1156,1,1,0,629,10,9,37,147,4,190,5,1,0,48,10,9,37,147,4,190,0,1,0,48,10,9,40,147,7,1149,0,1,0,48,10,9,41,145,4,193,5,1,0,47,10,9,41,145,4,193,0,1,0,47,10,9,131,145,7,1152,0,1,0,47,10,9,132,789,4,405,19,1,0,124,10,9,132,789,4,405,8,1,0,124,10,9,198,142,4,502,5,1,0,45,10,9,198,142,4,502,0,1,0,45,10,9,991,142,7,1218,0,1,0,45,10,9,42,152,4,504,5,1,0,49,10,9,42,152,4,504,0,1,0,49,10,9,53,152,7,1220,0,1,0,49,10,9,43,140,4,505,5,1,0,44,10,9,43,140,4,505,0,1,0,44,10,9,63,140,7,1221,0,1,0,44,10,9,54,150,4,507,5,1,0,50,10,9,54,150,4,507,0,1,0,50,10,9,133,150,7,1223,0,1,0,50,10,9,64,144,4,508,5,1,0,46,10,9,64,144,4,508,0,1,0,46,10,9,134,144,7,1224,0,1,0,46,10,9,135,792,4,509,5,1,0,56,10,9,135,792,4,509,0,1,0,56,10,9,136,1342,6,1240,0,1,0,574,10,9,199,1344,7,1241,1,1,0,629,10,9,65,148,4,503,5,1,0,48,10,9,65,148,4,503,0,1,0,48,10,9,137,148,7,1219,0,1,0,48,10,9,138,146,4,506,5,1,0,47,10,9,138,146,4,506,0,1,0,47,10,9,66,146,7,1222,0,1,0,47,10,9,55,790,4,525,19,1,0,124,10,9,55,790,4,525,8,1,0,124,16,15,255,670,4,399,19,1,0,115,16,15,255,670,4,399,8,1,0,115,16,15,256,685,4,397,5,1,0,123,16,15,256,685,4,397,0,1,0,123,16,15,999,1308,7,1136,1,1,0,573,16,15,1000,1345,7,1133,1,1,0,626,16,15,257,672,4,394,5,1,0,555,16,15,257,672,4,394,0,1,0,555,16,15,258,814,4,396,19,1,0,646,16,15,258,814,4,396,8,1,0,646,16,15,259,774,4,395,19,1,0,599,16,15,259,774,4,395,8,1,0,599,16,15,260,795,4,67,19,1,0,635,16,15,260,795,4,67,8,1,0,635,16,15,261,797,4,316,19,1,0,894,16,15,261,797,4,316,8,1,0,894,16,15,313,807,4,490,5,1,0,571,16,15,313,807,4,490,0,1,0,571,16,15,329,671,4,186,19,1,0,115,16,15,329,671,4,186,8,1,0,115,16,15,330,686,4,187,5,1,0,123,16,15,330,686,4,187,0,1,0,123,16,15,1076,1309,7,978,1,1,0,573,16,15,1077,1346,7,977,1,1,0,626,16,15,331,796,4,523,5,1,0,634,16,15,331,796,4,523,0,1,0,634,16,15,332,798,4,524,5,1,0,893,16,15,332,798,4,524,0,1,0,893,3,2,26,676,4,272,5,1,0,565,3,2,26,676,4,272,0,1,0,565,3,2,31,887,4,309,5,1,0,102,3,2,31,887,4,309,0,1,0,102,3,2,32,1290,6,1058,0,1,0,637,3,2,27,889,4,314,5,1,0,118,3,2,27,889,4,314,0,1,0,118,3,2,28,1292,6,1059,0,1,0,896,3,2,29,851,4,277,5,1,0,581,3,2,29,851,4,277,0,1,0,581,3,2,33,760,4,301,5,1,0,82,3,2,33,760,4,301,0,1,0,82,3,2,51,1288,6,1043,0,1,0,592,3,2,52,759,4,281,19,1,0,542,3,2,52,759,4,281,8,1,0,542,3,2,34,777,6,279,5,5,1,617,3,2,34,777,4,279,0,1,0,617,3,2,35,778,6,280,5,5,1,616,3,2,35,778,6,280,0,1,0,616,3,2,38,664,4,283,5,1,0,72,3,2,38,664,4,283,0,1,0,72,3,2,36,666,4,292,0,1,0,101,3,2,36,666,4,292,0,1,0,101,3,2,37,683,6,1157,0,1,0,75,3,2,40,1273,7,1186,0,1,0,562,3,2,41,1316,6,1163,0,1,0,603,3,2,131,1331,6,1164,0,1,0,604,3,2,132,1277,6,1165,0,1,0,575,3,2,42,821,6,321,1,8,1,105,3,2,42,821,6,321,0,8,0,105,3,2,53,768,4,322,0,1,0,130,3,2,53,768,4,322,0,1,0,130,3,2,43,823,4,328,5,1,0,96,3,2,43,823,4,328,0,1,0,96,3,2,63,1312,7,1092,0,1,0,580,3,2,54,1339,7,1099,0,1,0,619,3,2,65,1302,6,1064,0,1,0,926,3,2,137,1335,6,955,0,1,0,615,3,2,66,781,4,11,5,1,1,77,3,2,66,781,4,11,0,1,1,77,3,2,55,799,4,21,5,1,1,76,3,2,55,799,4,21,0,1,1,76,3,2,992,1259,6,976,0,1,0,895,3,2,993,1275,6,1166,0,1,0,563,3,2,200,752,4,158,5,1,0,95,3,2,200,752,4,158,0,1,0,95,3,2,201,756,4,160,5,1,0,85,3,2,201,756,4,160,0,1,0,85,3,2,994,1282,6,936,0,1,0,614,3,2,995,1351,6,938,0,1,0,594,3,2,996,1304,6,939,0,1,0,576,3,2,997,1371,6,941,0,1,0,1400,3,2,202,835,4,161,19,1,0,610,3,2,202,835,4,161,8,1,0,610,3,2,203,837,4,162,19,1,0,606,3,2,203,837,4,162,8,1,0,606,3,2,204,839,4,163,19,1,0,608,3,2,204,839,4,163,8,1,0,608,3,2,205,841,4,164,19,1,0,612,3,2,205,841,4,164,8,1,0,612,3,2,206,689,4,417,5,1,0,591,3,2,206,689,4,417,0,1,0,591,3,2,207,716,4,436,5,1,0,649,3,2,207,716,4,436,0,1,0,649,3,2,208,722,4,441,5,1,0,564,3,2,208,722,4,441,0,1,0,564,3,2,209,721,4,440,5,1,0,566,3,2,209,721,4,440,0,1,0,566,3,2,210,698,4,425,5,1,0,630,3,2,210,698,4,425,0,1,0,630,3,2,211,746,4,461,5,1,0,70,3,2,211,746,4,461,0,1,0,70,3,2,212,724,4,443,5,1,0,601,3,2,212,724,4,443,0,1,0,601,3,2,213,705,4,429,5,1,0,116,3,2,213,705,4,429,0,1,0,116,3,2,214,691,4,419,5,1,0,117,3,2,214,691,4,419,0,1,0,117,3,2,215,707,4,430,5,1,0,99,3,2,215,707,4,430,0,1,0,99,3,2,216,699,4,426,5,1,0,922,3,2,216,699,4,426,0,1,0,922,3,2,217,700,4,427,5,1,0,584,3,2,217,700,4,427,0,1,0,584,3,2,218,730,4,448,5,1,0,921,3,2,218,730,4,448,0,1,0,921,3,2,219,729,4,447,5,1,0,583,3,2,219,729,4,447,0,1,0,583,3,2,220,717,4,437,5,1,0,633,3,2,220,717,4,437,0,1,0,633,3,2,221,719,4,439,5,1,0,108,3,2,221,719,4,439,0,1,0,108,3,2,222,701,4,428,5,1,0,129,3,2,222,701,4,428,0,1,0,129,3,2,223,695,4,422,5,1,0,554,3,2,223,695,4,422,0,1,0,554,3,2,224,697,4,424,5,1,0,550,3,2,224,697,4,424,0,1,0,550,3,2,225,693,4,420,5,1,0,650,3,2,225,693,4,420,0,1,0,650,3,2,226,741,4,457,5,1,0,602,3,2,226,741,4,457,0,1,0,602,3,2,227,723,4,442,5,1,0,568,3,2,227,723,4,442,0,1,0,568,3,2,228,737,4,454,5,1,0,651,3,2,228,737,4,454,0,1,0,651,3,2,229,738,4,455,5,1,0,904,3,2,229,738,4,455,0,1,0,904,3,2,230,750,4,466,5,1,0,925,3,2,230,750,4,466,0,1,0,925,3,2,231,830,4,449,5,1,0,902,3,2,231,830,4,449,0,1,0,902,3,2,232,749,4,463,5,1,0,903,3,2,232,749,4,463,0,1,0,903,3,2,233,709,4,431,5,1,0,106,3,2,233,709,4,431,0,1,0,106,3,2,234,714,4,434,5,1,0,656,3,2,234,714,4,434,0,1,0,656,3,2,235,711,4,432,5,1,0,557,3,2,235,711,4,432,0,1,0,557,3,2,236,718,4,438,5,1,0,597,3,2,236,718,4,438,0,1,0,597,3,2,237,712,4,433,5,1,0,81,3,2,237,712,4,433,0,1,0,81,3,2,238,734,4,452,5,1,0,623,3,2,238,734,4,452,0,1,0,623,3,2,239,690,4,418,5,1,0,590,3,2,239,690,4,418,0,1,0,590,3,2,240,696,4,423,5,1,0,587,3,2,240,696,4,423,0,1,0,587,3,2,241,694,4,421,5,1,0,886,3,2,241,694,4,421,0,1,0,886,3,2,243,739,4,456,5,1,0,114,3,2,243,739,4,456,0,1,0,114,3,2,244,742,4,458,5,1,0,596,3,2,244,742,4,458,0,1,0,596,3,2,245,743,4,459,5,1,0,923,3,2,245,743,4,459,0,1,0,923,3,2,246,744,4,460,5,1,0,98,3,2,246,744,4,460,0,1,0,98,3,2,247,725,4,444,5,1,0,628,3,2,247,725,4,444,0,1,0,628,3,2,248,727,4,445,5,1,0,915,3,2,248,727,4,445,0,1,0,915,3,2,249,735,4,453,5,1,0,119,3,2,249,735,4,453,0,1,0,119,3,2,250,733,4,451,5,1,0,621,3,2,250,733,4,451,0,1,0,621,3,2,251,728,4,446,5,1,0,567,3,2,251,728,4,446,0,1,0,567,3,2,252,731,4,450,5,1,0,73,3,2,252,731,4,450,0,1,0,73,3,2,253,748,4,462,5,1,0,598,3,2,253,748,4,462,0,1,0,598,3,2,254,715,4,435,5,1,0,636,3,2,254,715,4,435,0,1,0,636,3,2,1002,1310,6,957,0,1,0,572,3,2,1003,1265,6,956,0,1,0,556,3,2,262,775,4,165,5,1,0,122,3,2,262,775,4,165,0,1,0,122,3,2,263,657,4,166,0,1,0,68,3,2,263,657,4,166,0,1,0,68,3,2,264,825,6,167,0,1,0,74,3,2,264,825,4,167,5,5,1,74,3,2,1004,870,6,1172,0,1,0,80,3,2,265,809,4,416,5,1,0,109,3,2,265,809,4,416,0,1,0,109,3,2,1005,1372,4,1162,8,1,8,913,3,2,1006,1296,6,1063,0,1,0,647,3,2,267,659,4,411,19,1,0,553,3,2,267,659,4,411,8,1,0,553,3,2,268,661,4,412,5,1,0,551,3,2,268,661,4,412,0,1,0,551,3,2,269,663,4,413,5,1,0,589,3,2,269,663,4,413,0,1,0,589,3,2,270,662,4,414,5,1,0,906,3,2,270,662,4,414,0,1,0,906,3,2,1007,1258,7,1161,1,1,0,1398,3,2,271,660,6,415,5,5,1,638,3,2,271,660,6,415,0,1,0,638,3,2,1009,754,4,1168,0,1,0,125,3,2,1010,754,7,1167,154,1,0,125,3,2,1011,1306,6,1169,0,1,0,569,3,2,273,763,4,175,1,1,0,79,3,2,273,763,4,175,0,1,0,79,3,2,1012,1314,6,959,0,1,0,588,3,2,274,668,4,169,5,1,0,69,3,2,274,668,4,169,0,1,0,69,3,2,1013,1267,6,958,0,1,0,549,3,2,275,770,4,171,5,1,0,84,3,2,275,770,4,171,0,1,0,84,3,2,276,765,6,170,1,8,1,83,3,2,276,765,6,170,0,8,0,83,3,2,1014,872,6,1173,0,1,0,110,3,2,278,767,4,173,5,1,0,653,3,2,278,767,4,173,0,1,0,653,3,2,1015,1279,7,1083,0,1,0,618,3,2,1016,1298,6,1061,0,1,0,919,3,2,1017,1300,6,1062,0,1,0,924,3,2,1018,1333,6,1187,0,1,0,914,3,2,1019,1263,7,932,0,1,0,543,3,2,1020,1261,6,935,0,1,0,558,3,2,1021,681,6,1175,0,1,0,107,3,2,1022,679,6,1174,0,1,0,104,3,2,1023,677,6,1176,0,1,0,97,3,2,1024,1320,6,964,0,1,0,1254,3,2,1025,1323,6,965,0,1,0,1255,3,2,1026,1318,6,966,0,1,0,1247,3,2,1027,1324,6,967,0,1,0,1257,3,2,1028,1327,6,968,0,1,0,1401,3,2,1029,1319,6,969,0,1,0,1249,3,2,1030,1321,6,970,0,1,0,1253,3,2,1031,1325,6,971,0,1,0,1256,3,2,1032,1326,6,972,0,1,0,1394,3,2,1033,1322,6,973,0,1,0,1252,3,2,282,673,6,317,5,5,1,899,3,2,282,673,6,317,0,1,0,899,3,2,284,674,4,318,5,1,0,898,3,2,284,674,4,318,0,1,0,898,3,2,1035,1286,6,1060,0,1,0,655,3,2,1036,1349,6,962,0,1,0,632,3,2,285,758,4,338,24,1,23,570,3,2,285,758,4,338,25,1,23,570,3,2,286,808,4,342,24,1,0,639,3,2,286,808,4,342,25,1,0,639,3,2,287,787,4,346,19,1,0,559,3,2,287,787,4,346,8,1,0,559,3,2,288,831,4,351,5,1,0,907,3,2,288,831,4,351,0,1,0,907,3,2,289,832,4,359,5,1,0,908,3,2,289,832,4,359,0,1,0,908,3,2,290,833,4,369,5,1,0,909,3,2,290,833,4,369,0,1,0,909,3,2,291,834,4,375,5,1,0,910,3,2,291,834,4,375,0,1,0,910,3,2,293,815,4,379,19,1,0,892,3,2,293,815,4,379,8,1,0,892,3,2,294,786,4,380,5,1,0,622,3,2,294,786,4,380,0,1,0,622,3,2,295,801,4,381,20,1,13,641,3,2,295,801,4,381,14,1,13,641,3,2,296,802,4,383,20,1,13,640,3,2,296,802,4,383,14,1,13,640,3,2,297,803,4,384,20,1,13,645,3,2,297,803,4,384,14,1,13,645,3,2,298,804,4,385,20,1,13,644,3,2,298,804,4,385,14,1,13,644,3,2,299,805,4,386,20,1,13,643,3,2,299,805,4,386,14,1,13,643,3,2,300,806,4,387,20,1,13,642,3,2,300,806,4,387,14,1,13,642,3,2,1037,784,6,1177,0,1,0,624,3,2,1038,785,6,1178,0,1,0,625,3,2,302,783,4,388,19,1,0,620,3,2,302,783,4,388,8,1,0,620,3,2,303,675,4,320,19,1,0,916,3,2,303,675,4,320,8,1,0,916,3,2,1039,1294,6,1008,0,1,0,1248,3,2,304,772,4,168,19,1,0,86,3,2,304,772,4,168,8,1,0,86,3,2,305,687,4,30,5,1,0,71,3,2,305,687,4,30,0,1,0,71,3,2,1040,1354,7,980,1,1,0,545,3,2,1041,1356,7,981,1,1,0,544,3,2,1042,1358,7,982,1,1,0,548,3,2,1044,1362,7,983,1,1,0,546,3,2,1045,1360,7,984,1,1,0,547,3,2,1046,1347,6,998,0,1,0,631,3,2,306,827,4,242,5,1,0,121,3,2,306,827,4,242,0,1,0,121,3,2,1047,1328,6,1034,5,0,1,600,3,2,1048,1295,6,1078,0,1,0,1251,3,2,307,751,4,174,5,1,0,654,3,2,307,751,4,174,0,1,0,654,3,2,1049,1271,7,931,0,1,0,561,3,2,308,812,4,319,1,1,0,112,3,2,308,812,4,319,0,1,0,112,3,2,1050,1353,7,17,1,1,0,1395,3,2,1051,1364,7,1001,1,1,0,560,3,2,1052,683,7,1179,8,1,0,75,3,2,1053,1269,7,930,0,1,0,552,3,2,1054,1330,7,961,8,1,0,1399,3,2,1055,1337,7,1236,1,1,0,897,3,2,310,779,4,467,5,1,0,78,3,2,310,779,4,467,0,1,0,78,3,2,1056,1366,7,1181,1,1,0,586,3,2,311,816,4,468,5,1,0,103,3,2,311,816,4,468,0,1,0,103,3,2,1057,1284,7,990,1,1,0,900,3,2,312,793,4,473,5,1,0,100,3,2,312,793,4,473,0,1,0,100,3,2,315,819,6,172,5,5,1,120,3,2,315,819,6,172,0,1,0,120,3,2,323,888,4,521,5,1,0,102,3,2,323,888,4,521,0,1,0,102,3,2,1065,1291,6,1233,0,1,0,637,3,2,324,890,4,522,5,1,0,118,3,2,324,890,4,522,0,1,0,118,3,2,1066,1293,6,1234,0,1,0,896,3,2,325,761,4,520,5,1,0,82,3,2,325,761,4,520,0,1,0,82,3,2,1067,1289,6,1232,0,1,0,592,3,2,326,665,4,518,5,1,0,72,3,2,326,665,4,518,0,1,0,72,3,2,327,667,4,519,0,1,0,101,3,2,327,667,4,519,0,1,0,101,3,2,1068,684,6,1192,0,1,0,75,3,2,1069,684,7,1193,8,1,0,75,3,2,1070,1274,7,1194,0,1,0,562,3,2,1071,1334,6,1195,0,1,0,914,3,2,1072,1317,6,1182,0,1,0,603,3,2,1073,1332,6,1183,0,1,0,604,3,2,1074,1278,6,1184,0,1,0,575,3,2,1075,1260,6,1190,0,1,0,895,3,2,1079,1336,6,1203,0,1,0,615,3,2,1080,1311,6,1205,0,1,0,572,3,2,1081,1266,6,1204,0,1,0,556,3,2,333,776,4,480,5,1,0,122,3,2,333,776,4,480,0,1,0,122,3,2,334,658,4,481,0,1,0,68,3,2,334,658,4,481,0,1,0,68,3,2,335,826,6,482,0,1,0,74,3,2,335,826,4,482,5,5,1,74,3,2,1082,871,6,1206,0,1,0,80,3,2,336,810,4,188,5,1,0,109,3,2,336,810,4,188,0,1,0,109,3,2,1084,1373,4,960,8,1,8,913,3,2,1085,755,4,1198,0,1,0,125,3,2,1086,755,7,1197,154,1,0,125,3,2,1087,1307,6,1199,0,1,0,569,3,2,1088,1355,7,985,1,1,0,545,3,2,337,764,4,487,1,1,0,79,3,2,337,764,4,487,0,1,0,79,3,2,1089,1315,6,1208,0,1,0,588,3,2,1090,1357,7,986,1,1,0,544,3,2,1091,1363,7,988,1,1,0,546,3,2,1093,1361,7,989,1,1,0,547,3,2,1094,1329,6,1191,5,0,1,600,3,2,1095,1280,7,1188,0,1,0,618,3,2,1096,682,6,1242,0,1,0,107,3,2,1097,680,6,1243,0,1,0,104,3,2,1098,678,6,1244,0,1,0,97,3,2,339,669,4,483,5,1,0,69,3,2,339,669,4,483,0,1,0,69,3,2,1100,1268,6,1207,0,1,0,549,3,2,340,771,4,485,5,1,0,84,3,2,340,771,4,485,0,1,0,84,3,2,341,766,6,484,1,8,1,83,3,2,341,766,6,484,0,8,0,83,3,2,1101,873,6,1180,0,1,0,110,3,2,343,820,6,486,5,5,1,120,3,2,343,820,6,486,0,1,0,120,3,2,344,753,4,474,5,1,0,95,3,2,344,753,4,474,0,1,0,95,3,2,345,757,4,475,5,1,0,85,3,2,345,757,4,475,0,1,0,85,3,2,1102,1283,6,1200,0,1,0,614,3,2,1103,1352,6,1201,0,1,0,594,3,2,1104,1305,6,1202,0,1,0,576,3,2,347,836,4,476,5,1,0,611,3,2,347,836,4,476,0,1,0,611,3,2,348,838,4,477,5,1,0,607,3,2,348,838,4,477,0,1,0,607,3,2,349,840,4,478,5,1,0,609,3,2,349,840,4,478,0,1,0,609,3,2,350,842,4,479,5,1,0,613,3,2,350,842,4,479,0,1,0,613,3,2,1105,1276,6,1185,0,1,0,563,3,2,1106,1297,6,1211,0,1,0,647,3,2,1107,1299,6,1209,0,1,0,919,3,2,1108,1301,6,1210,0,1,0,924,3,2,1109,1287,6,1237,0,1,0,655,3,2,1110,1350,6,1189,0,1,0,632,3,2,1111,1348,6,1235,0,1,0,631,3,2,1112,1272,7,1196,0,1,0,561,3,2,352,813,4,469,1,1,0,112,3,2,352,813,4,469,0,1,0,112,3,2,353,747,4,536,5,1,0,70,3,2,353,747,4,536,0,1,0,70,3,2,354,692,4,530,5,1,0,116,3,2,354,692,4,530,0,1,0,116,3,2,355,706,4,531,5,1,0,117,3,2,355,706,4,531,0,1,0,117,3,2,356,708,4,529,5,1,0,99,3,2,356,708,4,529,0,1,0,99,3,2,357,720,4,532,5,1,0,108,3,2,357,720,4,532,0,1,0,108,3,2,358,702,4,526,5,1,0,129,3,2,358,702,4,526,0,1,0,129,3,2,360,710,4,528,5,1,0,106,3,2,360,710,4,528,0,1,0,106,3,2,361,740,4,537,5,1,0,114,3,2,361,740,4,537,0,1,0,114,3,2,362,726,4,534,5,1,0,627,3,2,362,726,4,534,0,1,0,627,3,2,363,732,4,535,5,1,0,73,3,2,363,732,4,535,0,1,0,73,3,2,364,713,4,527,5,1,0,81,3,2,364,713,4,527,0,1,0,81,3,2,365,745,4,538,5,1,0,98,3,2,365,745,4,538,0,1,0,98,3,2,366,736,4,533,5,1,0,119,3,2,366,736,4,533,0,1,0,119,3,2,367,782,4,472,5,1,1,77,3,2,367,782,4,472,0,1,1,77,3,2,368,800,4,470,5,1,1,76,3,2,368,800,4,470,0,1,1,76,3,2,370,769,4,540,0,1,0,130,3,2,370,769,4,540,0,1,0,130,3,2,371,773,4,403,19,1,0,86,3,2,371,773,4,403,8,1,0,86,3,2,372,688,4,197,5,1,0,71,3,2,372,688,4,197,0,1,0,71,3,2,373,828,4,266,5,1,0,121,3,2,373,828,4,266,0,1,0,121,3,2,1113,1338,7,1171,1,1,0,897,3,2,374,780,4,464,5,1,0,78,3,2,374,780,4,464,0,1,0,78,3,2,1114,1367,7,1170,1,1,0,586,3,2,376,817,4,465,5,1,0,103,3,2,376,817,4,465,0,1,0,103,3,2,1115,1285,7,954,1,1,0,900,3,2,1116,1270,7,940,0,1,0,552,3,2,377,794,4,471,5,1,0,100,3,2,377,794,4,471,0,1,0,100,3,2,1117,1313,7,1238,0,1,0,580,3,2,1118,1340,7,1239,0,1,0,619,3,2,378,811,4,159,5,1,0,652,3,2,378,811,4,159,0,1,0,652,3,2,1119,677,7,942,8,1,0,97,3,2,1120,679,7,943,8,1,0,104,3,2,1121,681,7,944,8,1,0,107,3,2,1122,678,7,947,8,1,0,97,3,2,1123,680,7,948,8,1,0,104,3,2,1124,682,7,949,8,1,0,107,3,2,1125,784,7,945,8,1,0,624,3,2,1126,785,7,946,8,1,0,625,3,2,1127,870,7,950,8,1,0,80,3,2,1128,871,7,952,8,1,0,80,3,2,382,788,4,67,5,1,0,578,3,2,382,788,4,67,0,1,0,578,3,2,1129,872,7,951,8,1,0,110,3,2,1130,873,7,953,8,1,0,110,3,2,1131,1281,7,979,1,1,0,1250,3,2,1132,1264,7,1245,0,1,0,543,3,2,389,762,4,489,5,1,0,595,3,2,389,762,4,489,0,1,0,595,3,2,1134,1359,7,987,1,1,0,548,3,2,1135,1303,6,1212,0,1,0,926,3,2,390,824,4,541,5,1,0,96,3,2,390,824,4,541,0,1,0,96,3,2,391,703,4,491,5,1,0,579,3,2,391,703,4,491,0,1,0,579,3,2,392,704,4,492,5,1,0,928,3,2,392,704,4,492,0,1,0,928,3,2,393,822,6,539,1,8,1,105,3,2,393,822,6,539,0,8,0,105,3,2,1137,1262,6,1246,0,1,0,558,3,2,398,818,4,157,5,1,0,593,3,2,398,818,4,157,0,1,0,593,3,2,1138,1365,7,937,1,1,0,560],"strings":["1","0","2","SYSTEMS","TUMB","-1","BTN","LEV","0.5","7","INTERCOM","11","ARC164","0.9","0.1","3","LIGHTS","10","ARC134","-0.5","-0.1","13","ARN127","0.75","-0.25","0.25","3001","3004","3005","3006","12","3002","3003","3007","3010","3011","3013","3014","3012","ARN118","3015","3016","3026","3028","HM Switch","INT Switch","MK Switch","TCN Switch","UHF Switch","VHF Switch","VOR Switch","3008","3009","3027","3030","3041","(HOT MIC) TALK CIRCUIT BREAKER","0.025 MHz Selector","0.1 MHz Selector","0.95","1 MHz Selector","10 MHz Selector","100 MHz Selector","3029","3032","3037","3040","329","ABORT","AILERON HYD OVERRIDE COVER","BACKUP ADI","CANOPY EMERGENCY JETTISON","CAWS Panel Bright/Dim","CONSOLE LIGHTS","CONTINUOUS IGNITION/START","Cage Standby Attitude Indicator. Hold Right Mouse Button and rotate Scroll Wheel to uncage","Canopy Locking Handle","Canopy Safety Catch","EJECTION HANDLE","EMERGENCY LANDING GEAR EXTENSION","ENGINE START LIGHT TEST","ENGINE STARTER","ESS BUS Cover","Emergency Elevator Trim Switch","Emergency Elevator Trim Switch Cutout Guard","Engine Fuel Valve Cover","FLAP POSITION SELECTOR","Frequency Mode Dial","Frequency selector (0-9)","Frequency selector (00/50)","Frequency selector (X0X.XXX)","Frequency selector (XX0.XXX)","Frequency selector (XXX.0XX)","Frequency selector (XXX.X00)","Function Dial","Fuselage Tank Pump Cover","Gyro Mode","INNER MARKER LAMP TEST","INTERPHONE","ITT","LANDING GEAR HANDLE","Lamp Test","Left Battery Isolation Cover","MANUAL SEPERATION HANDLE","MIDDLE MARKER LAMP TEST","Manual Gyro Correction","OIL TEMP IND","OUTER MARKER LAMP TEST","OXY SYS\nHYD SYS PRESS IND","OXYGEN SUPPLY","PITCH TRIM DISC LAMP TEST","POWER SWITCH","Parking Brake","Preset Channel Selector","RED COCKPIT LIGHTING","RED FLOOD LIGHTING","RPM N1","RPM N2","Right Battery Isolation Cover","SEAT ADJUSTMENT","SEAT HEIGHT ADJUSTMENT","SHOW/HIDE FLIGHT STICK","STARTER MODE SELECTOR","STORM LIGHTS","Selector switch","Set Clock Knob","Squelch Switch","UHF Digital Display Frequency mode/Test switch","VHF Volume/Brightness","VOR DC","Vertical Gyro Fast Erect","3017","3018","3031","3033","3034","3035","3038","3039","PNT-INT-HVOL-RP","PNT-INT-HVOL-RP-BACK","PNT-INT-IVOL-RP","PNT-INT-IVOL-RP-BACK","PNT-INT-MVOL-RP","PNT-INT-MVOL-RP-BACK","PNT-INT-TVOL-RP","PNT-INT-TVOL-RP-BACK","PNT-INT-UVOL-RP","PNT-INT-UVOL-RP-BACK","PNT-INT-VOVOL-RP","PNT-INT-VOVOL-RP-BACK","PNT-INT-VVOL-RP","PNT-INT-VVOL-RP-BACK","-0.05","0.04","0.05","108-117","1182","119","1196","121","130","131","132","133","137","138","139","14","144","148","149","193","195","196","197","207","226","227","228","229","230","231","232","233","236","248","249","253","280","281","282","283","284","285","286","287","302","3024","3036","3044","3045","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","3063","3064","3065","3066","3067","3068","3069","3070","3071","3072","3073","3074","3075","3076","3077","3078","3079","3080","3081","3082","3083","3084","3085","3086","3087","3088","3089","309","3090","3091","3092","3093","3094","3095","3096","3097","3098","3099","3100","3101","3102","3103","3106","3107","3108","3109","3110","3113","3114","3115","3117","312","3120","3121","3122","3123","3125","315","3150","3152","3156","3157","316","3160","317","318","319","3199","320","3200","3203","3204","3205","3206","3207","3208","3209","321","3210","3211","3212","3213","3214","3215","3216","3217","322","3220","3221","3224","3226","3233","3236","3238","324","3245","3247","3250","3252","326","3280","330","331","332","333","338","339","340","3400","3402","3404","3406","3407","341","3416","3417","3420","3421","3425","3426","3427","3429","3435","346","3466","3468","3469","347","3471","3474","3475","348","3480","3481","3482","3483","349","3492","3494","3495","3496","3497","3498","3499","350","3500","3501","3502","3503","3504","3505","3506","3508","3509","351","3510","3514","3515","3516","3519","352","3521","3524","3527","353","354","355","3551","356","357","358","359","360","361","3630","3642","3643","3644","3650","366","367","368","369","3691","370","377","378","379","38","393","404","413","415","416","417","418","419","420","421","422","424","425","427","428","429","430","431","432","433","434","435","436","437","438","439","440","441","442","443","444","445","446","447","448","449","450","451","452","453","454","455","456","457","458","459","460","461","462","463","464","465","466","467","468","469","470","471","472","473","520","522","532","536","537","65","749","75","750","8","812","814","818","819","820","821","825","826","827","829","832","833","841","843","844","846","850","851","852","862","863","864","865","866","867","868","869","872","884","885","886","887","888","889","890","891","910","911","912","925","927","928","929","930","931","932","933","935","937","941","942","947","949","950","951","952","953","954","955","956","957","958","959","960","961","965","966","967","AC Inverter Norm/Alt","ADI Pitch Adjust","ADJUST RED LIGHT - LEFT CENTER PANEL","ADJUST RED LIGHT - LEFT CONSOLE","ADJUST RED LIGHT - RIGHT CENTER PANEL","ADJUST RED LIGHT - RIGHT CONSOLE","ADJUST RED LIGHT - TOP CENTER PANEL","AILERON HYD OVERRIDE","AIR BRAKE\nANTI-SKID OPERATION","AIR FLOW MODE","AIR VENT","AIR-CONDITIONING MASTER SWITCH","AIR-CONDITIONING/PRESSURIZATION","ANTI-COLLISION BEACON","ANTI-ICE","ANTI-ICE/RAIN REPELLENT","ATTITUDE TEST","AUDIO LIGHT SWITCH","Adjust Rudder Pedals","Airspeed Indicator Bug","Altimeter Baro Adjust","Antiskid ON/OFF","BACKUP INVERTER","Battery Master Switch","CAUTION/WARNING PANEL","CB Formation Lights","CENTER WING TANK PUMPS","CHRONOGRAPH","CODE SELECT","COMPASS LIGHT","COMPUTER","CONSOLE INTEGRAL LIGHTING","Call button","Caution Alert Reset","Center Wing Tank Qty","Channel Selector (Ones) / X/Y Mode. Right mouse click to select X/Y. Rotate mouse wheel to make channel selection","Close/open IFR hood","Colour Smoke","Course Knob","DC Bus Tie","DIMMER","DIRECTIONAL GYRO AC","DIRECTIONAL GYRO DC","DISPLAY TEST","EJECTION HANDLE SAFETY","ELEVATOR TRIM POWER","EMERGENCY AIR BRAKE RETRACT","EMERGENCY VENTILATION","ENGINE COMPUTER","ENGINE GENERATOR","ESS BUS Transfer","Ejection Seat Priority Lever","Engine Fuel Valve","FD Bright/Dim","FIRE DETECTOR","FLAPS INDICATOR\nAILERON INDICATOR","FLIGHT DIRECTOR","FORMATION LIGHTS","FUEL FLOW RESET","FUEL MEASURING SYSTEM","FUSELAGE TANK PUMP","Fault Alert Reset","Fire Alert Test","Frequency selector (108-117)","Fuel Transfer Center 1","Fuel Transfer Center 1/Fwd Cockpit Priority","Fuel Transfer Center 2","Fuel Transfer Center 2/Fwd Cockpit Priority","Fuel Transfer Left","Fuel Transfer Left/Fwd Cockpit Priority","Fuel Transfer Right","Fuel Transfer Right/Fwd Cockpit Priority","Fuselage Tank Pump","GPU","Generator GROUND FAULT/OVERVOLTAGE Test","Generator ON/OFF/RESET","HSI Digit Brightness","Heading Knob","IDENT SWITCH","IFF AC 115","IFF MODE 4","IFF PRIM DC","IFF REPLY LAMP TEST","IFF TEST","INSTRUMENT LIGHTING","INSTRUMENTS AND STORM LIGHTS","INSTRUMENTS, STORM AND ANTI-COLLISION LIGHTS","Intercom volume","LANDING GEAR","LANDING GEAR OVERRIDE","LANDING GEAR WARNING MUTE","LANDING GEAR/AIRBRAKE/TRIM INDICATORS","LEFT LANDING LIGHT/FWD COCKPIT PRIORITY","LEFT TAXI/LANDING LIGHT","LH LAND/TAXI LIGHT","Left Battery Isolation Switch","MANUAL TEMPERATURE CONTROL","MASTER SWITCH","MODE 1 - 0X","MODE 1 - X0","MODE 3 - 000X","MODE 3 - 00X0","MODE 3 - 0X00","MODE 3 - X000","NAV LIGHTS","NAV PRIORITY","NAV VOL","NORMAL INVERTER","OIL PRESSURE","OUTER WING TANK PUMPS","OXYGEN PRESSURE WARNING SWITCH","PITCH TRIM BREAKER","PITCH TRIM TONE MUTE","PITOT HEAT","PITOT HEAT\nSTALL WARNING SYSTEM","PNT-ABRT-SW-LP","PNT-ABRT-SW-LP-BACK","PNT-AC-ACOND-RP","PNT-AC-MAN-RP","PNT-AC-SELFLU-RP","PNT-AC-TEMP-RP","PNT-AC-VEMERG-RP","PNT-AFL-CPR","PNT-AFL-CPR-BACK","PNT-AFT-CPR","PNT-AFT-CPR-BACK","PNT-AILCOV-LP","PNT-AILCOV-LP-BACK","PNT-ALUM-RP","PNT-ALUM-RP-BACK","PNT-ANCO-RP","PNT-APL-TEST-CPL","PNT-APR-CPL","PNT-AUHF-CP","PNT-BATTERY-CPR","PNT-BE-MBI-CP","PNT-BE-MBI-CP-BACK","PNT-BE-MBM-CP","PNT-BE-MBM-CP-BACK","PNT-BE-MBO-CP","PNT-BE-MBO-CP-BACK","PNT-BKADI-K02-CP","PNT-BKADI-K02-CP-BACK","PNT-CAB-RP","PNT-CAB-RP-BACK","PNT-CANOPY-EME","PNT-CANOPY-EME-BACK","PNT-CB-01-LP","PNT-CB-02-LP","PNT-CB-03-LP","PNT-CB-03-LP-BACK","PNT-CB-04-LP","PNT-CB-05-LP","PNT-CB-06-LP","PNT-CB-07-LP","PNT-CB-08-LP","PNT-CB-09-LP","PNT-CB-10-LP","PNT-CB-11-LP","PNT-CB-12-LP","PNT-CB-12-LP-BACK","PNT-CB-12-LP-SMOKE-COLOUR","PNT-CB-12-SMOKE-WHITE","PNT-CB-13-LP","PNT-CB-13-LP-BACK","PNT-CB-14-LP","PNT-CB-14-LP-BACK","PNT-CB-15-LP","PNT-CB-15-LP-BACK","PNT-CB-16-LP","PNT-CB-17-LP","PNT-CB-17-LP-BACK","PNT-CB-18-LP","PNT-CB-19-LP","PNT-CB-20-LP","PNT-CB-21-LP","PNT-CB-22-LP","PNT-CB-23-LP","PNT-CB-23-LP-BACK","PNT-CB-24-LP","PNT-CB-25-LP","PNT-CB-26-LP","PNT-CB-27-LP","PNT-CB-28-LP","PNT-CB-28-LP-BACK","PNT-CB-29-LP","PNT-CB-30-LP","PNT-CB-31-LP","PNT-CB-32-LP","PNT-CB-34-LP","PNT-CB-34-LP-BACK","PNT-CB-35-LP","PNT-CB-36-LP","PNT-CB-37-LP","PNT-CB-37-LP-BACK","PNT-CB-38-LP","PNT-CB-39-LP","PNT-CB-40-LP","PNT-CB-40-LP-BACK","PNT-CB-41-LP","PNT-CB-42-LP","PNT-CB-43-LP","PNT-CB-44-LP","PNT-CB-44-LP-BACK","PNT-CB-45-LP","PNT-CB-45-LP-BACK","PNT-CB-46-LP","PNT-CB-47-LP","PNT-CB-48-LP","PNT-CB-49-LP","PNT-CBOMSUM-LP","PNT-CBOMSUM-LP-BACK","PNT-CLKT-KNB-CP","PNT-CLKT-KNB-CP-BACK","PNT-CLLAVCOM-LP","PNT-CLLAVCOM-LP-BACK","PNT-CODE-KNB-CPD","PNT-CONV-CPR","PNT-COV01-CPR","PNT-COV01-CPR-BACK","PNT-DIM-FD-BACK","PNT-EMERGLG-LP","PNT-EMERGLG-LP-BACK","PNT-EMERGTRP-LP","PNT-EMERGTRP-LP-BACK","PNT-EMETBREAK-LP","PNT-ERCR-CP","PNT-ERCR-CP-BACK","PNT-ETP-GUARD-LP","PNT-ETP-GUARD-LP-BACK","PNT-FLAPSH-LP","PNT-FLAPSH-LP-BACK","PNT-FOR-RP","PNT-GA-SW-LP","PNT-GA-SW-LP-BACK","PNT-GENL-CPR","PNT-GENR-CPR","PNT-HN-ES-ST","PNT-HN-ES-ST-BACK","PNT-HND-CNPY","PNT-HND-CNPY-BACK","PNT-IDENT-CPD","PNT-IFF-REP-CP","PNT-IFF-TEST-CP","PNT-IFFCS-CPD","PNT-IFFM4L-CPD","PNT-IFR-HOOD","PNT-INT-MAINS-RP","PNT-INT-MAINS-RP-BACK","PNT-INT-P-HTBT-RP","PNT-INT-P-HTBT-RP-BACK","PNT-LDNG-H-CPL","PNT-LDNG-H-CPL-BACK","PNT-LNDG-L-CPL","PNT-LNDG-L-CPL-BACK","PNT-LNDG-R-CPL","PNT-LNDG-R-CPL-BACK","PNT-LOCK-CNPY","PNT-LOCK-CNPY-BACK","PNT-M1D1-CPD","PNT-M1D2-CPD","PNT-M3A1-CPD","PNT-M3A2-CPD","PNT-M3A3-CPD","PNT-M3A4-CPD","PNT-MAG-COM-CP","PNT-MST-KNB-CPD","PNT-OXIGENE-RP","PNT-OXIGENE-RP-BACK","PNT-OXYGEN-PRO-BACK","PNT-PARKING-CPL","PNT-PARKING-CPL-BACK","PNT-POSI-RP","PNT-RAD-CPD","PNT-RT-ES-ST","PNT-RT-ES-ST-BACK","PNT-SEAT-1","PNT-SEATADJ-LP","PNT-SEATADJ-LP-BACK","PNT-SINCR-CP","PNT-SINCR-CP-BACK","PNT-SLCT-CP","PNT-SLCT-CP-BACK","PNT-START-SW-LP","PNT-START-SW-LP-BACK","PNT-STICK-CPD","PNT-STICK-CPD-BACK","PNT-TCN-MAIN-RP","PNT-TEST","PNT-TM1-CPD","PNT-TM2-CPD","PNT-TM3-CPD","PNT-TMC-CPD","PNT-TRANSF01-LP","PNT-TRANSF01-LP-BACK","PNT-TRANSF02-LP","PNT-TRANSF02-LP-BACK","PNT-TRANSF03-LP","PNT-TRANSF03-LP-BACK","PNT-TRANSF04-LP","PNT-TRANSF04-LP-BACK","PNT-UHF-DI","PNT-UHF-DI-BACK","PNT-UHF-MOD-CP","PNT-UHF-MOD-CP-BACK","PNT-UHF-MS-CP","PNT-UHF-MS-CP-BACK","PNT-UHF-SQL-CP","PNT-UHF-SQL-CP-BACK","PNT-UNIONB-CPR","PNT-VHF-1SEL-RP","PNT-VHF-1SEL-RP-BACK","PNT-VHF-2SEL-RP","PNT-VHF-2SEL-RP-BACK","PNT-VHF-3SEL-RP","PNT-VHF-3SEL-RP-BACK","PNT-VHF-4SEL-RP","PNT-VHF-4SEL-RP-BACK","PNT-VHF-DIM-RP","PNT-VHF-DIM-RP-BACK","PNT-VHF-PWR-RP","PNT-VHF-PWR-RP-BACK","PNT-VOR-1KNB-RP","PNT-VOR-1KNB-RP-BACK","PNT-VOR-2KNB-RP","PNT-VOR-2KNB-RP-BACK","PNT-VOR-3KNB-RP","PNT-VOR-3KNB-RP-BACK","PNT-YB-EP-LP","PNT-YB-EP-LP-BACK","PNT-YB-TRIM-LP","PNT-YB-TRIM-LP-BACK","PNT_027","PNT_027-BACK","PNT_028","PNT_028-BACK","PNT_029","PNT_029-BACK","PNT_030","PNT_030-BACK","PNT_031","PNT_031-BACK","PNT_032","PNT_032-BACK","POSITION LIGHTS\nRH LAND/TAXI LIGHTS","PTN-COV02-CPR","PTN-COV02-CPR-BACK","PTN-COV03-CPR","PTN-COV03-CPR-BACK","PTR-TACAN-CHANNEL-SELECTOR-2","RAD TEST SWITCH","RIGHT LANDING LIGHT/FWD COCKPIT PRIORITY","RIGHT TAXI/LANDING LIGHT","Reset Max/Min Needles","Right Battery Isolation Switch","SHOULDER HARNESS CONTROL HANDLE","STALL WARNING POWER","STALL WARNING TEST","STORAGE BOX COVER","T-Tone","TACAN AC 115","TACAN AC 26","TACAN DC","TACAN Mode","TEMPERATURE MODE","TEST M-1 SWITCH","TEST M-2 SWITCH","TEST M-3/A SWITCH","TEST M/C SWITCH","TEST VHF NAV DIGITS","TEST VOR/MKR","THROTTLE IDLE DETENT","Tap Glass","UHF","UHF ANTENNA SELECTION","UHF Cover","UHF Digital Display Dimmer","UHF PRIORITY","UHF Preset Button","VERTICAL GYRO AC","VERTICAL GYRO DC","VHF DC ESS","VHF PRIORITY","VOR AC 26","VOR/TCN Nav Selector","Volume control","White Smoke","00x-12x. Rotate mouse wheel to select","101","102","112","1167","1169","117","120","1202","122","123","1230","124","1253","1254","1255","1256","1257","1258","1259","1260","1273","1274","1275","1276","1310","134","135","136","145","147","15","16","17","206","210","211","212","213","214","215","216","217","218","219","234","235","25","250","251","256","258","259","260","261","262","263","264","265","266","267","296","3025","3042","3043","3046","3047","3048","3049","308","3104","3105","311","3111","3112","3116","3118","3119","3124","314","3147","3148","3149","3151","3153","3158","3161","3162","3163","3164","3165","3166","3167","3168","3169","3170","3171","3172","3173","3174","3175","3176","3177","3178","3179","32","3201","3202","3218","3219","3222","3227","3228","3229","323","3230","3231","3232","3234","3235","3237","3239","3240","3241","3242","3243","3244","3246","3248","325","327","328","334","335","336","337","3401","3403","3405","3408","3409","3410","3411","3412","3413","3414","3415","3418","3419","342","3422","3423","3424","3428","343","3430","3431","3432","3433","3434","3436","3438","3439","344","3440","3441","3443","3444","3445","3446","345","3467","3470","3476","3477","3478","3484","3485","3486","3487","3488","3489","3490","3491","3518","3520","3522","3523","3525","3526","3528","3529","3530","3531","3532","3533","3534","3535","3536","3537","3552","3553","3557","3600","364","3640","3641","365","3688","3696","380","381","382","383","387","388","389","390","392","394","395","396","397","398","399","400","402","403","41","411","412","414","423","5","513","514","515","516","517","518","519","521","523","525","526","527","528","529","530","531","533","534","538","634","636","637","638","66","68","766","770","774","779","782","783","792","802","803","809","810","811","813","815","816","822","823","824","828","830","831","837","838","839","840","845","854","855","870","871","894","895","896","897","898","899","901","913","914","915","916","923","924","926","934","936","938","939","94","940","943","944","945","946","968","969","970","990","995","ALTITUDE HOLD MODE","ANTI-RAIN FLUID","APPROACH ARM","Blackout curtain","FUEL FLOW TEST","GLIDESLOPE EXTENDED MODE","GLIDESLOPE MODE","GO-AROUND MODE","HEADING MODE","ILS/LOC REVERSE MODE","PITCH MODE","PNT-AC-TEMPKNB-RP","PNT-ACELKNB-CP","PNT-ACELKNB-CP-BACK","PNT-ADI-ATTBT-CP","PNT-ADI-ATTBT-CP-BACK","PNT-ADI-PKNB-CP","PNT-ADI-PKNB-CP-BACK","PNT-AH-BT-LP","PNT-AH-BT-LP-BACK","PNT-AILBTN-LP","PNT-AILBTN-LP-BACK","PNT-AIRINLET-RP","PNT-AIRINLET-RP-BACK","PNT-AIRS-KNB-CP","PNT-AIRS-KNB-CP-BACK","PNT-ALT-KNB-CP","PNT-ALT-KNB-CP-BACK","PNT-ANTISKID-CP","PNT-ANTISKID-CP-BACK","PNT-AVISO-CP","PNT-AVISO-CP-BACK","PNT-BHSI-KB-CP","PNT-BHSI-KB-CP-BACK","PNT-BLACKOUT-CURTAIN","PNT-BOMSUM-LP","PNT-BOMSUM-LP-BACK","PNT-BOX-FRONT","PNT-BOX-FRONT-BACK","PNT-BTN-01-CPL","PNT-BTN-01-CPL-BACK","PNT-BTN-01-CPR","PNT-BTN-01-CPR-BACK","PNT-BTN-02-CPR","PNT-BTN-02-CPR-BACK","PNT-BTN-03-CPR","PNT-BTN-03-CPR-BACK","PNT-BTN-ANRA-CPL","PNT-BTN-FLUX-CP","PNT-BTN-NAV-CP","PNT-BTN-NAV-CP-BACK","PNT-BTN-UHF-CP","PNT-BTN-UHF-CP-BACK","PNT-BTN-VHF-CP","PNT-BTN-VHF-CP-BACK","PNT-BTN-VT-CP","PNT-BTN-VT-CP-BACK","PNT-CANTCOM-LP","PNT-CANTCOM-LP-BACK","PNT-CLKC-BT-CP","PNT-CLKC-BT-CP-BACK","PNT-CNS-KNB-RP","PNT-CNS-KNB-RP-BACK","PNT-COMP-BT-LP","PNT-COMP-BT-LP-BACK","PNT-CRS-KNB-CPD","PNT-CRS-KNB-CPD-BACK","PNT-EMERGAB-LP","PNT-EMERGAB-LP-BACK","PNT-FALLO-CP","PNT-FALLO-CP-BACK","PNT-FD-ALT-CP","PNT-FD-APP-CP","PNT-FD-GOA-CP","PNT-FD-GS-CP","PNT-FD-GSE-CP","PNT-FD-HDG-CP","PNT-FD-PAT-CP","PNT-FD-REV-CP","PNT-FD-SBY-CP","PNT-FD-VL-CP","PNT-FFLW-KNB-CP","PNT-FFLW-KNB-CP-BACK","PNT-FRICT-TH","PNT-FUEGO-CP","PNT-FUEGO-CP-BACK","PNT-GLASS-ALT","PNT-GLASS-ALT-BACK","PNT-GPU-LP","PNT-GPU-LP-BACK","PNT-HARN-SEAT","PNT-HARN-SEAT-BACK","PNT-HDG-KNB-CPD","PNT-HDG-KNB-CPD-BACK","PNT-INT-CALL-RP","PNT-INT-CALL-RP-BACK","PNT-INT-MAINV-RP","PNT-INT-MAINV-RP-BACK","PNT-INTR-KNB-RP","PNT-INTR-KNB-RP-BACK","PNT-LG-OVR-CPR","PNT-LG-OVR-CPR-BACK","PNT-LG-RESET-LP","PNT-LG-RESET-LP-BACK","PNT-LLAVCOM-LP","PNT-LLAVCOM-LP-BACK","PNT-MIRROR","PNT-RL-LC","PNT-RL-LC-BACK","PNT-RL-LCP","PNT-RL-LCP-BACK","PNT-RL-LTP","PNT-RL-LTP-BACK","PNT-RL-RC","PNT-RL-RC-BACK","PNT-RL-RCP","PNT-RL-RCP-BACK","PNT-RUDREG-CPD","PNT-RUDREG-CPD-BACK","PNT-SC-ES-ST","PNT-SC-ES-ST-BACK","PNT-TCN-KNB1D-RP","PNT-TCN-TSTBT-RP","PNT-TCN-VOL-RP","PNT-TESTFUEL-LP","PNT-THRT-LP","PNT-THRT-LP-BACK","PNT-TSTDIM-BT-RP","PNT-TSTDIM-BT-RP-BACK","PNT-TSTVOR-BT-RP","PNT-TSTVOR-BT-RP-BACK","PNT-UHF-COVER","PNT-UHF-COVER-BACK","PNT-UHF-DIM","PNT-UHF-DIM-BACK","PNT-UHF-PR-BTN","PNT-UHF-PR-BTN-BACK","PNT-UHF-TONE-CP","PNT-UHF-TONE-CP-BACK","PNT-UHF-VOL-CP","PNT-UHF-VOL-CP-BACK","PNT-VDIM-KNB-RP","PNT-VDIM-KNB-RP-BACK","PNT-VHF-DTEST-RP","PNT-VHF-DTEST-RP-BACK","PNT-VLM-KNB-RP","PNT-VLM-KNB-RP-BACK","STANDBY MODE","Show/Hide Mirror","TACAN TEST","TACAN Volume","TEMPERATURE REGULATION CONTROL","THROTTLE FRICTION","Test Fuel Qty Indicator","VOR/LOC MODE"]});
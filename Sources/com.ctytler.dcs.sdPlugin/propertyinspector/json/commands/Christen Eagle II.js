@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Christen Eagle II","rows":[12,10,93,147,2,118,0,1,0,124,12,10,94,148,3,43,0,1,0,126,12,10,95,153,3,17,0,1,0,128,12,10,96,152,3,17,0,1,0,130,12,10,97,151,3,17,0,1,0,127,12,10,98,150,3,17,0,1,0,129,12,10,99,149,3,43,0,1,0,125,12,10,100,146,3,117,0,1,0,123,15,14,21,70,2,33,4,1,0,45,15,14,21,70,2,33,0,1,0,45,15,14,23,69,2,36,4,1,0,44,15,14,23,69,2,36,0,1,0,44,15,14,79,162,3,114,0,1,0,141,15,14,29,59,2,37,4,1,0,51,15,14,29,59,2,37,0,1,0,51,13,11,19,61,2,31,4,1,0,50,13,11,19,61,2,31,0,1,0,50,13,11,24,60,2,38,1,1,0,49,13,11,24,60,2,38,0,1,0,49,13,11,81,157,7,102,1,1,0,136,13,11,82,142,7,101,1,1,0,134,13,11,30,65,2,32,73,1,0,53,13,11,30,65,2,32,74,1,0,53,48,18,91,154,3,115,0,1,0,132,48,18,92,155,3,116,0,1,0,133,16,0,75,145,7,109,1,1,0,121,16,0,76,161,7,110,1,4,0,140,16,0,77,144,3,90,0,1,0,120,16,0,22,72,2,34,4,1,0,58,16,0,22,72,2,34,0,1,0,58,8,5,25,66,2,39,4,1,0,54,8,5,25,66,2,39,0,1,0,54,8,5,80,156,7,103,1,1,0,131,8,5,26,62,2,40,4,1,0,52,8,5,26,62,2,40,0,1,0,52,8,5,27,63,2,41,4,1,0,46,8,5,27,63,2,41,0,1,0,46,8,5,28,64,2,42,4,1,0,47,8,5,28,64,2,42,0,1,0,47,135,119,78,143,7,111,1,4,0,122,9,6,20,71,2,35,4,1,0,56,9,6,20,71,2,35,0,1,0,56,9,6,83,68,7,104,0,1,0,57,9,6,84,68,2,105,0,1,0,57,9,6,85,160,3,108,0,1,0,139,9,6,86,159,7,112,1,1,0,138,9,6,87,67,7,106,0,1,0,55,9,6,88,67,2,107,0,1,0,55,9,6,89,158,3,113,0,1,0,137],"strings":["1","0","TUMB","BTN","-1","13","5","LEV","LIGHTS","RADIO","15","6","CANOPY","ENGINE","7","ELECTRIC","GENERAL","401","14","3001","3021","3033","3034","3037","3038","3051","3054","3055","3056","3073","3100","349","350","351","352","353","354","355","356","359","360","397","399","400","Alternator","Battery","Cockpit Light Red","Cockpit Light Yellow","FUELGAUGE","Fuel Pump","Fuel Valve","Fuse","Landing Light","Magnetos","Nav Lights","Radio Frequency 50KHz / 25KHz Fine Tune (Pull)","Radio ON-OFF","Radio ON-OFF / Volume / Test (Pull)","Smoke","p_AlternatorOutput","p_FuelPumpLever","p_FuelPumpSwitch","p_LandingLight","p_LightOmniRed","p_LightSpotYellow","p_MAGNETS_KEY","p_NavLight","p_RadioFreqKHz","p_RadioVol","p_SWITCH_ALTERNATOR","p_SWITCH_BATTERY","p_SWITCH_RADIO","p_SWITCH_SMOKE","-0.25","0.25","3010","3017","3031","3039","3043","3053","3057","3058","3061","3062","3063","3064","3065","3066","3067","307","3071","3072","3081","3083","3084","3085","3086","3087","3088","3090","357","358","361","364","365","366","367","368","369","370","371","374","375","377","378","384","402","403","8","Accelerometer Reset Button","Air Conditioning","Barometric Pressure","Canopy Jettison (Rear)","Canopy Lever Close (Rear)","Canopy Lever Open (Front)","Canopy Lever Open (Rear)","Canopy Lock (Front)","Canopy Lock (Rear)","Canopy Unlock (Front)","Canopy Unlock (Rear)","Cockpit Light","Fuel Indicator Mode (F / U)","Fuel Indicator Mode Rear cockpit(F / U)","Mixture","PITOT","Propeller","Radio Channel","Radio Frequency MHz","Radio Frequency Transfer","Trim Lever","Volt/Ampere Meter mode (Voltage / Amperage)","p_AFMixtureLever","p_ALTIMETER_KNOB","p_AccelButton","p_AirconLever","p_CanopyJet","p_Canopy_Lever_Max","p_Canopy_Lever_Min","p_Canopy_Lever_Min_Front","p_Canopy_LockLever_Front_Max","p_Canopy_LockLever_Front_Min","p_Canopy_LockLever_Rear_Max","p_Canopy_LockLever_Rear_Min","p_FuelGaugeButton","p_FuelGaugeButtonR","p_GaugeLight","p_PropPitchLever","p_RadioChannel","p_RadioFreqMHz","p_RadioSwitch","p_TrimLever","p_VAmeterButton"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"F-16C","rows":[92,80,5,369,4,81,0,1,0,361,92,80,9,369,4,81,3,3,1,361,92,80,10,750,8,651,1,1,0,673,667,641,5,748,8,55,1,1,0,886,670,163,5,879,8,664,1,1,0,920,93,91,5,490,4,653,0,1,0,267,93,91,9,490,8,652,533,1,0,267,93,91,10,878,4,654,0,1,0,677,28,27,5,468,2,140,3,1,0,506,28,27,5,468,2,140,0,1,0,506,28,27,9,465,2,139,3,1,0,328,28,27,9,465,2,139,0,1,0,328,28,27,10,467,2,138,3,1,0,360,28,27,10,467,2,138,0,1,0,360,28,27,11,466,2,137,3,1,0,329,28,27,11,466,2,137,0,1,0,329,28,27,14,459,2,133,3,1,0,362,28,27,14,459,2,133,0,1,0,362,28,27,25,460,2,134,3,1,0,363,28,27,25,460,2,134,0,1,0,363,28,27,26,461,2,135,3,1,0,261,28,27,26,461,2,135,0,1,0,261,28,27,30,462,2,136,3,1,0,285,28,27,30,462,2,136,0,1,0,285,28,27,36,464,2,141,35,1,66,367,28,27,36,464,2,141,29,1,66,367,28,27,37,463,2,142,35,1,59,359,28,27,37,463,2,142,29,1,59,359,28,27,38,841,4,650,0,1,0,674,19,17,5,430,2,190,3,1,0,269,19,17,5,430,2,190,0,1,0,269,19,17,9,428,2,191,3,1,0,251,19,17,9,428,2,191,0,1,0,251,19,17,10,429,4,195,0,1,0,257,19,17,10,429,4,195,0,1,0,257,19,17,11,431,4,194,0,1,0,288,19,17,11,431,4,194,0,1,0,288,19,17,14,432,2,193,3,1,0,335,19,17,14,432,2,193,0,1,0,335,19,17,25,469,2,189,3,1,0,515,19,17,25,469,2,189,0,1,0,515,19,17,26,843,8,645,1,3,0,887,19,17,30,842,8,646,1,3,0,744,19,17,36,844,8,647,1,3,0,929,19,17,37,470,4,154,0,1,0,348,19,17,37,470,4,154,0,1,0,348,19,17,38,458,2,130,3,1,0,512,19,17,38,458,2,130,0,1,0,512,19,17,47,409,4,103,3,3,1,255,19,17,51,409,4,103,0,1,0,255,19,17,43,411,2,102,3,3,0,256,19,17,43,411,2,102,0,3,0,256,19,17,57,406,2,246,3,1,0,248,19,17,57,406,2,246,0,1,0,248,19,17,64,433,2,192,3,1,0,349,19,17,64,433,2,192,0,1,0,349,52,50,5,776,4,539,0,1,0,742,52,50,9,881,4,649,0,1,0,740,52,50,10,847,8,657,1,1,0,745,52,50,11,849,8,658,1,1,0,747,52,50,14,848,8,659,1,1,0,746,52,50,25,845,8,660,1,1,0,683,52,50,26,846,8,661,1,1,0,684,52,50,30,483,4,218,0,1,0,347,52,50,36,483,4,218,3,3,1,347,52,50,37,755,8,665,1,1,0,671,52,50,38,756,8,666,1,1,0,672,48,46,9,451,2,204,3,1,0,266,48,46,10,451,4,204,3,3,1,266,48,46,11,449,2,201,3,1,0,265,48,46,11,449,2,201,0,1,0,265,48,46,14,448,2,202,3,1,0,260,48,46,14,448,2,202,0,1,0,260,48,46,36,485,2,243,3,1,0,279,48,46,36,485,2,243,0,1,0,279,48,46,51,486,4,244,0,1,0,510,48,46,43,486,4,244,3,3,1,510,48,46,57,492,2,245,3,1,0,307,48,46,57,492,2,245,0,1,0,307,72,68,5,368,2,219,35,1,49,250,72,68,5,368,2,219,29,1,49,250,72,68,9,749,8,662,1,532,49,922,72,68,10,450,2,203,94,1,0,268,72,68,10,450,2,203,95,1,0,268,73,69,5,777,4,163,0,1,0,743,73,69,9,413,8,80,0,1,0,296,73,69,10,413,4,60,0,1,0,296,73,69,11,412,8,637,0,1,0,264,73,69,14,412,4,630,0,1,0,264,58,56,5,414,2,165,3,3,0,346,58,56,5,414,2,165,0,3,0,346,58,56,9,778,4,642,0,1,0,679,58,56,10,496,2,199,0,3,1,287,58,56,11,496,4,199,0,1,0,287,58,56,14,493,4,198,0,1,0,278,58,56,14,493,4,198,0,1,0,278,58,56,25,495,2,197,3,1,0,366,58,56,26,495,4,197,3,3,1,366,34,33,5,420,2,166,3,1,0,276,34,33,5,420,2,166,0,1,0,276,34,33,9,421,2,168,3,1,0,275,34,33,9,421,2,168,0,1,0,275,34,33,10,422,2,167,3,3,0,277,34,33,10,422,2,167,0,3,0,277,34,33,11,379,2,227,3,3,0,281,34,33,11,379,2,227,0,3,0,281,34,33,14,418,4,158,0,1,0,327,34,33,25,418,4,158,3,3,1,327,34,33,26,415,2,159,3,1,0,272,34,33,26,415,2,159,0,1,0,272,34,33,30,417,2,160,3,1,0,273,34,33,30,417,2,160,0,1,0,273,34,33,36,419,2,162,3,1,0,354,34,33,36,419,2,162,0,1,0,354,34,33,37,416,4,161,0,1,0,247,34,33,38,416,4,161,3,3,1,247,34,33,47,880,4,648,0,1,0,682,41,39,5,423,2,169,35,1,76,252,41,39,5,423,2,169,29,1,76,252,41,39,9,424,2,170,3,1,0,286,41,39,9,424,2,170,0,1,0,286,41,39,10,427,2,171,3,3,0,528,41,39,10,427,2,171,0,3,0,528,41,39,11,425,2,172,3,3,0,292,41,39,11,425,2,172,0,3,0,292,41,39,14,780,8,643,1,1,0,685,41,39,25,426,2,173,35,1,66,353,41,39,25,426,2,173,29,1,66,353,41,39,26,779,8,644,1,1,0,668,41,39,30,456,2,131,3,3,0,333,41,39,30,456,2,131,0,3,0,333,283,117,5,487,2,208,3,1,0,284,283,117,5,487,2,208,0,1,0,284,42,40,5,436,2,188,3,1,0,290,42,40,5,436,2,188,0,1,0,290,42,40,9,434,2,187,3,1,0,289,42,40,9,434,2,187,0,1,0,289,42,40,10,405,2,107,3,1,0,282,42,40,10,405,2,107,0,1,0,282,42,40,11,435,2,185,35,1,49,274,42,40,11,435,2,185,29,1,49,274,42,40,14,404,2,106,29,1,59,291,42,40,25,404,4,106,35,1,59,291,42,40,26,438,2,186,3,1,0,514,42,40,26,438,2,186,0,1,0,514,42,40,30,437,2,184,3,1,0,249,42,40,30,437,2,184,0,1,0,249,54,53,5,452,2,132,3,1,0,337,54,53,5,452,2,132,0,1,0,337,54,53,9,810,4,620,0,1,0,678,54,53,10,457,4,129,0,1,0,253,54,53,11,457,2,129,0,3,1,253,54,53,14,453,2,128,3,1,0,258,54,53,14,453,2,128,0,1,0,258,54,53,25,455,2,126,3,1,0,297,54,53,25,455,2,126,0,1,0,297,54,53,26,812,4,619,0,1,0,688,294,200,5,398,2,235,3,1,0,295,294,200,5,398,2,235,0,1,0,295,686,572,5,781,8,621,1,1,0,687,314,81,5,397,2,236,3,1,0,270,314,81,5,397,2,236,0,1,0,270,32,31,5,390,2,176,3,1,0,259,32,31,5,390,2,176,0,1,0,259,32,31,9,385,2,174,35,1,66,318,32,31,9,385,2,174,29,1,66,318,32,31,10,391,2,175,3,3,0,317,32,31,10,391,2,175,0,3,0,317,32,31,11,393,2,177,3,3,0,324,32,31,11,393,2,177,0,3,0,324,32,31,14,392,2,178,3,1,0,323,32,31,14,392,2,178,0,1,0,323,32,31,25,394,2,183,3,3,0,316,32,31,25,394,2,183,0,3,0,316,32,31,26,386,4,179,0,1,0,319,32,31,30,386,4,179,3,3,1,319,32,31,36,387,4,180,0,1,0,320,32,31,37,387,4,180,3,3,1,320,32,31,38,388,4,181,0,1,0,321,32,31,47,388,4,181,3,3,1,321,32,31,51,389,4,182,0,1,0,322,32,31,43,389,4,182,3,3,1,322,325,104,5,395,2,234,35,1,96,326,325,104,5,395,2,234,29,1,96,326,20,18,5,757,8,631,1,1,0,675,20,18,9,382,2,155,74,1,0,262,20,18,9,382,2,155,59,1,0,262,20,18,10,758,8,632,1,1,0,676,20,18,11,383,2,156,74,1,0,263,20,18,11,383,2,156,59,1,0,263,20,18,14,760,8,633,1,1,0,919,20,18,25,759,8,634,1,1,0,741,20,18,26,761,8,635,1,1,0,923,20,18,30,762,8,636,1,1,0,924,20,18,36,763,8,640,1,1,0,717,20,18,37,765,8,639,1,1,0,921,20,18,38,764,8,638,1,1,0,718,20,18,47,384,2,157,3,3,0,298,20,18,47,384,2,157,0,3,0,298,20,18,51,380,2,228,3,3,0,315,20,18,51,380,2,228,0,3,0,315,20,18,43,381,2,229,3,3,0,517,20,18,43,381,2,229,0,3,0,517,20,18,57,499,2,222,3,1,0,527,20,18,57,499,2,222,0,1,0,527,20,18,64,471,2,223,3,3,0,365,20,18,64,471,2,223,0,3,0,365,20,18,70,498,2,220,3,1,0,529,20,18,70,498,2,220,0,1,0,529,20,18,71,500,2,221,3,3,0,530,20,18,71,500,2,221,0,3,0,530,65,60,5,445,2,224,35,1,49,331,65,60,5,445,2,224,29,1,49,331,65,60,9,446,2,225,35,1,76,330,65,60,9,446,2,225,29,1,76,330,65,60,11,447,2,226,74,1,0,332,65,60,11,447,2,226,59,1,0,332,65,60,14,809,8,663,1,1,0,719,350,205,5,399,2,237,3,1,0,351,350,205,5,399,2,237,0,1,0,351,15,12,5,813,4,573,0,1,0,720,15,12,9,824,4,574,0,1,0,731,15,12,10,826,4,575,0,1,0,733,15,12,11,827,4,577,0,1,0,734,15,12,14,828,4,582,0,1,0,735,15,12,25,829,4,583,0,1,0,736,15,12,26,830,4,584,0,1,0,737,15,12,30,831,4,585,0,1,0,738,15,12,36,832,4,586,0,1,0,739,15,12,37,814,4,587,0,1,0,721,15,12,38,815,4,588,0,1,0,722,15,12,47,816,4,589,0,1,0,723,15,12,51,817,4,590,0,1,0,724,15,12,43,818,4,591,0,1,0,725,15,12,57,819,4,592,0,1,0,726,15,12,64,820,4,593,0,1,0,727,15,12,70,821,4,594,0,1,0,728,15,12,71,822,4,595,0,1,0,729,15,12,82,823,4,596,0,1,0,730,15,12,83,825,4,597,0,1,0,732,15,12,84,838,4,118,0,1,0,343,15,12,85,837,4,118,3,3,1,342,15,12,86,840,4,119,0,1,0,345,15,12,87,839,4,119,3,3,1,344,15,12,88,836,4,120,0,1,0,341,15,12,89,835,4,120,3,3,1,340,15,12,79,834,4,121,0,1,0,339,15,12,90,833,4,121,3,3,1,338,16,13,5,850,4,598,0,1,0,899,16,13,9,861,4,599,0,1,0,910,16,13,10,863,4,600,0,1,0,912,16,13,11,864,4,601,0,1,0,913,16,13,14,865,4,602,0,1,0,914,16,13,25,866,4,603,0,1,0,915,16,13,26,867,4,604,0,1,0,916,16,13,30,868,4,605,0,1,0,917,16,13,36,869,4,606,0,1,0,918,16,13,37,851,4,607,0,1,0,900,16,13,38,852,4,608,0,1,0,901,16,13,47,853,4,609,0,1,0,902,16,13,51,854,4,610,0,1,0,903,16,13,43,855,4,611,0,1,0,904,16,13,57,856,4,612,0,1,0,905,16,13,64,857,4,613,0,1,0,906,16,13,70,858,4,614,0,1,0,907,16,13,71,859,4,615,0,1,0,908,16,13,82,860,4,616,0,1,0,909,16,13,83,862,4,617,0,1,0,911,16,13,84,875,4,122,0,1,0,343,16,13,85,874,4,122,3,3,1,342,16,13,86,877,4,123,0,1,0,345,16,13,87,876,4,123,3,3,1,344,16,13,88,873,4,124,0,1,0,341,16,13,89,872,4,124,3,3,1,340,16,13,79,871,4,125,0,1,0,339,16,13,90,870,4,125,3,3,1,338,356,144,5,396,2,238,35,1,75,357,356,144,5,396,2,238,29,1,75,357,22,21,5,401,2,230,3,1,0,358,22,21,5,401,2,230,0,1,0,358,22,21,9,408,2,101,3,3,0,352,22,21,9,408,2,101,0,3,0,352,22,21,10,811,4,618,0,1,0,680,22,21,11,454,2,127,3,1,0,293,22,21,11,454,2,127,0,1,0,293,22,21,14,766,4,538,0,1,0,669,22,21,25,482,2,210,3,3,0,304,22,21,25,482,2,210,0,3,0,304,22,21,26,476,2,211,3,3,0,303,22,21,26,476,2,211,0,3,0,303,22,21,30,479,2,212,3,3,0,301,22,21,30,479,2,212,0,3,0,301,22,21,36,480,2,213,3,3,0,302,22,21,36,480,2,213,0,3,0,302,22,21,37,477,2,214,3,3,0,306,22,21,37,477,2,214,0,3,0,306,22,21,38,475,2,215,3,3,0,299,22,21,38,475,2,215,0,3,0,299,22,21,47,478,2,216,3,3,0,300,22,21,47,478,2,216,0,3,0,300,22,21,51,481,2,217,3,3,0,305,22,21,51,481,2,217,0,3,0,305,22,21,43,400,2,232,3,1,0,355,22,21,43,400,2,232,0,1,0,355,62,61,5,474,2,241,74,1,0,513,62,61,5,474,2,241,59,1,0,513,62,61,9,472,2,240,3,1,0,271,62,61,9,472,2,240,0,1,0,271,62,61,10,473,2,239,3,1,0,280,62,61,11,473,4,239,3,3,1,280,62,61,14,494,4,196,0,1,0,364,62,61,14,494,4,196,0,1,0,364,502,105,5,489,2,209,3,3,0,503,502,105,5,489,2,209,0,3,0,503,45,44,5,773,8,542,1,1,537,898,45,44,9,767,4,543,0,1,0,891,45,44,10,768,4,544,0,1,0,892,45,44,11,769,4,545,0,1,0,893,45,44,14,770,4,546,0,1,0,897,45,44,25,771,4,547,0,1,0,895,45,44,26,772,4,548,0,1,0,896,45,44,30,885,8,625,1,1,0,890,45,44,36,884,4,622,0,1,0,894,45,44,37,882,4,623,0,1,0,888,45,44,38,497,2,143,3,1,0,507,45,44,38,497,2,143,0,1,0,507,45,44,47,883,4,624,0,1,0,889,508,164,9,484,4,656,0,1,0,509,508,164,10,484,8,655,0,535,536,509,63,55,5,402,2,231,3,1,0,511,63,55,5,402,2,231,0,1,0,511,63,55,9,488,2,206,3,1,0,336,63,55,9,488,2,206,0,1,0,336,63,55,10,491,2,207,3,1,0,505,63,55,10,491,2,207,0,1,0,505,63,55,11,407,2,100,3,1,0,334,63,55,11,407,2,100,0,1,0,334,7,6,5,403,2,233,3,1,0,516,7,6,5,403,2,233,0,1,0,516,7,6,9,789,4,566,0,1,0,702,7,6,10,790,4,555,0,1,0,703,7,6,11,791,4,556,0,1,0,704,7,6,14,792,4,557,0,1,0,705,7,6,25,793,4,559,0,1,0,706,7,6,26,794,4,560,0,1,0,707,7,6,30,795,4,561,0,1,0,708,7,6,36,796,4,563,0,1,0,709,7,6,37,797,4,564,0,1,0,710,7,6,38,798,4,565,0,1,0,711,7,6,47,784,4,549,0,1,0,689,7,6,51,785,4,550,0,1,0,690,7,6,43,787,4,551,0,1,0,698,7,6,57,788,4,552,0,1,0,699,7,6,64,786,4,562,0,1,0,693,7,6,70,799,4,558,0,1,0,714,7,6,71,782,4,553,0,1,0,700,7,6,82,783,4,554,0,1,0,701,7,6,83,803,8,570,1,1,0,715,7,6,84,802,8,571,1,1,0,712,7,6,85,804,8,568,1,1,0,697,7,6,86,801,8,569,1,1,0,713,7,6,87,800,4,567,0,1,0,696,7,6,88,806,4,110,0,1,0,695,7,6,89,805,4,110,3,3,1,694,7,6,79,440,2,111,3,3,0,313,7,6,79,440,2,111,0,3,0,313,7,6,90,439,2,109,3,1,0,308,7,6,576,439,4,109,3,3,1,308,7,6,578,808,4,108,0,1,0,692,7,6,579,807,4,108,3,3,1,691,7,6,112,441,4,77,3,3,1,310,7,6,112,441,4,77,3,3,1,310,7,6,113,444,4,77,0,1,0,311,7,6,113,444,4,77,0,1,0,311,7,6,114,443,4,78,0,1,0,312,7,6,114,443,4,78,0,1,0,312,7,6,115,442,4,78,3,3,1,309,7,6,115,442,4,78,3,3,1,309,7,6,580,774,4,540,0,1,0,681,7,6,581,775,4,541,0,1,0,716,7,6,116,410,2,99,3,3,0,504,7,6,116,410,2,99,0,3,0,504,24,23,5,375,2,145,94,1,98,518,24,23,5,375,2,145,95,1,98,518,24,23,9,372,2,146,35,29,49,524,24,23,9,372,2,146,29,29,49,524,24,23,10,373,2,147,35,1,67,523,24,23,10,373,2,147,29,1,67,523,24,23,11,374,2,148,35,1,67,522,24,23,11,374,2,148,29,1,67,522,24,23,14,371,2,149,35,1,67,521,24,23,14,371,2,149,29,1,67,521,24,23,25,370,2,150,531,1,97,520,24,23,25,370,2,150,534,1,97,520,24,23,26,376,2,151,35,1,75,525,24,23,26,376,2,151,29,1,75,525,24,23,30,377,2,152,35,1,49,519,24,23,30,377,2,152,29,1,49,519,24,23,36,752,4,626,0,1,0,927,24,23,37,378,2,153,3,1,0,526,24,23,37,378,2,153,0,1,0,526,24,23,38,754,8,627,1,1,0,928,24,23,47,753,4,628,0,1,0,926,24,23,51,751,4,629,0,1,0,925,24,23,43,501,2,242,3,1,0,254,24,23,43,501,2,242,0,1,0,254],"strings":["1","0","TUMB","-1","BTN","3001","17","UFC","LEV","3002","3003","3004","24","25","3005","MFD_LEFT","MFD_RIGHT","2","39","CONTROL_INTERFACE","INTERCOM","19","MMC","37","UHF_CONTROL_PANEL","3006","3007","32","CMDS","0.1","3008","35","IFF_CONTROL_PANEL","6","ENGINE_INTERFACE","-0.1","3009","3010","3011","11","4","EXTLIGHTS_SYSTEM","FUEL_INTERFACE","3014","33","RWR","10","3012","CPT_MECH","0.3","12","3013","CPTLIGHTS_SYSTEM","7","GEAR_INTERFACE","22","3","3015","ELEC_INTERFACE","0.5","42","8","OXYGEN_INTERFACE","SMS","3016","KY58","0.4","0.9","13","28","3017","3018","ECS_INTERFACE","EHSI","-0.5","0.2","0.7","184","185","3027","45","60","3019","3020","3021","3022","3023","3024","3025","3026","3028","51","AAU34","CLOCK","-0.05","0.05","0.6","0.75","0.95","100","103","105","108","109","14","15","158","159","183","186","188","189","3032","3033","3034","3035","3038","31","320","321","322","323","346","347","348","349","354","355","356","357","358","360","362","365","366","367","368","371","373","374","375","377","378","401","41","410","411","412","413","414","415","416","417","419","425","434","435","443","447","448","449","450","451","46","47","510","527","528","529","531","532","533","534","536","540","541","542","543","544","545","547","549","551","553","555","556","557","558","559","564","566","567","568","572","573","574","576","578","579","585","59","600","601","602","606","61","670","671","672","673","675","676","677","678","679","680","681","682","691","693","694","695","696","701","705","706","707","710","711","712","715","716","717","718","719","720","721","722","723","726","727","728","734","785","786","796","97","AB RESET Switch, AB RESET/NORM/ENG DATA","ADV MODE Switch","AIR REFUEL Switch, OPEN/CLOSE","AIR SOURCE Knob, OFF/NORM/DUMP/RAM","ALT FLAPS Switch, NORM/EXTEND","ANTI-COLL Knob, OFF/1/2/3/4/A/B/C","ANTI-SKID Switch, PARKING BRAKE/ANTI-SKID/OFF","Access Door, OPEN/CLOSE","Autopilot PITCH Switch, ATT HOLD/ A/P OFF/ ALT HOLD","Autopilot ROLL Switch, STRG SEL/ATT HOLD/HDG SEL","BIT Switch, OFF/BIT","BRAKES Channel Switch, CHAN 1/CHAN 2","C & I Knob, UFC/BACKUP","CANOPY JETTISON T-Handle, PULL/STOW","CH Expendable Category Switch, ON/OFF","COMM 1 (UHF) Mode Knob","COMM 2 (VHF) Mode Knob","CRS Set / Brightness Control Knob","Canopy Handle, UP/DOWN","Canopy Switch, OPEN/HOLD/CLOSE(momentarily)","Clock Winding and Setting Knob","DEFOG Lever","DIGITAL BACKUP Switch, OFF/BACKUP","DL Switch, DL/OFF","Diluter Lever, 100 percent/NORM","ENG CONT Switch Cover, OPEN/CLOSE","ENG CONT Switch, PRI/SEC","ENGINE FEED Knob, OFF/NORM/AFT/FWD","EPU Switch Cover for OFF, OPEN/CLOSE","EPU Switch Cover for ON, OPEN/CLOSE","EPU Switch, ON/NORM/OFF","EPU/GEN Test Switch, EPU/GEN /OFF","Ejection Safety Lever, ARMED/LOCKED","Emergency Lever, EMERGENCY/NORMAL/TEST MASK(momentarily)","Engine ANTI ICE Switch, ON/AUTO/OFF","External Fuel Transfer Switch, NORM/ WING FIRST","FCR","FCR Switch, FCR/OFF","FL Expendable Category Switch, ON/OFF","FLASH STEADY Switch, FLASH/STEADY","FLCS PWR TEST Switch, MAINT/NORM/TEST(momentarily)","FLCS RESET Switch, OFF/RESET","FUEL MASTER Switch Cover, OPEN/CLOSE","FUEL MASTER Switch, MASTER/OFF","FUEL QTY SEL Knob, TEST(momentarily)/NORM/RSVR/INT WING/EXT WING/EXT CTR","FUSELAGE Switch, BRT/OFF/DIM","GND JETT ENABLE Switch, ENABLE/OFF","GPS","GPS Switch, GPS/OFF","HDG Set Knob","HOOK Switch, UP/DN","HOT MIC CIPHER Switch, HOT MIC / OFF / CIPHER","HUD Altitude Switch, RADAR / BARO / AUTO","HUD Brightness Control Switch, DAY / AUTO BRT / NIGHT","HUD DED/PFLD Data Switch, DED / PFL / OFF","HUD Depressible Reticle Switch, STBY / PRI / OFF","HUD Flightpath Marker Switch, ATT/FPM / FPM / OFF","HUD Scales Switch, VV/VAH / VAH / OFF","HUD TEST Switch, STEP / ON / OFF","HUD Velocity Switch, CAS / TAS / GND SPD","Hide Stick toggle","ICP DRIFT CUTOUT/WARN RESET Switch, DRIFT C/O /NORM/WARN RESET","ICP Data Control Switch, DN","ICP Data Control Switch, RTN","ICP Data Control Switch, SEQ","ICP Data Control Switch, UP","ICP FLIR GAIN/LEVEL Switch, GAIN/LVL/AUTO","IDM","IFF ANT SEL Switch, LOWER/NORM/UPPER","IFF ENABLE Switch, M1/M3 /OFF/ M3/MS","IFF M-4 CODE Switch, HOLD/ A/B /ZERO","IFF MASTER Knob, OFF/STBY/LOW/NORM/EMER","IFF MODE 1 Selector Lever, DIGIT 1","IFF MODE 1 Selector Lever, DIGIT 2","IFF MODE 3 Selector Lever, DIGIT 1","IFF MODE 3 Selector Lever, DIGIT 2","IFF MODE 4 MONITOR Switch, OUT/AUDIO","IFF MODE 4 REPLY Switch, OUT/A/B","INS","INS Knob, OFF/STOR HDG/NORM/NAV/CAL/INFLT ALIGN/ATT","JFS Switch, START 1/OFF/START 2","JMR Source Switch, ON/OFF","Jettison Switch, JETT/OFF","KY-58 FILL Knob, Z 1-5/1/2/3/4/5/6/Z ALL","KY-58 MODE Knob, P/C/LD/RV","KY-58 Power Knob, OFF/ON/TD","LANDING TAXI LIGHTS Switch, LANDING/OFF/TAXI","LASER ARM Switch, ARM/OFF","LE FLAPS Switch, AUTO/LOCK","LEFT HDPT Switch, ON/OFF","LG Handle, UP/DN","Left MFD BRT Rocker Switch, Down/Decrease","Left MFD BRT Rocker Switch, Up/Increase","Left MFD CON Rocker Switch, Down/Decrease","Left MFD CON Rocker Switch, Up/Increase","Left MFD GAIN Rocker Switch, Down/Decrease","Left MFD GAIN Rocker Switch, Up/Increase","Left MFD SYM Rocker Switch, Down/Decrease","Left MFD SYM Rocker Switch, Up/Increase","MAIN PWR Switch, MAIN PWR/BATT/OFF","MAL & IND LTS Switch, BRT/Center/DIM","MANUAL PITCH Override Switch, OVRD/NORM","MANUAL TF FLYUP Switch, ENABLE/DISABLE","MAP","MAP Switch, MAP/OFF","MASTER ARM Switch, MASTER ARM/OFF/SIMULATE","MASTER Switch, OFF/ALL/A-C/FORM/NORM","MAX POWER Switch (is inoperative), MAX POWER/OFF","MFD Switch, MFD/OFF","MIDS","MIDS LVT Knob, ZERO/OFF/ON","MMC Switch, MMC/OFF","MODE Knob, OFF/STBY/MAN/SEMI/AUTO/BYP","MWS Source Switch, ON/OFF (no function)","Mode Lever, ELEC/OFF/PNEU","O1 Expendable Category Switch, ON/OFF","O2 Expendable Category Switch, ON/OFF","OBOGS BIT Switch, BIT/OFF","PLAIN Cipher Switch, CRAD 1/PLAIN/CRAD 2","PROBE HEAT Switch, PROBE HEAT/OFF/TEST(momentarily)","PROGRAM Knob, BIT/1/2/3/4","PTR-AIRCOND-TMB-SRC-693","PTR-ALT-TMB-MODE-60","PTR-ANARC164-0.025MHZ-SEL-415","PTR-ANARC164-0.1MHZ-SEL-414","PTR-ANARC164-100MHZ-SEL-411","PTR-ANARC164-10MHZ-SEL-412","PTR-ANARC164-1MHZ-SEL-413","PTR-ANARC164-CHNL-SELECTOR-410","PTR-ANARC164-FREQMODE-416","PTR-ANARC164-FUNCTION-417","PTR-ANARC164-SQUELCH-419","PTR-ANTICE-TMB-ENG-710","PTR-ANTICE-TMB-IFF-711","PTR-ANTICE-TMB-UHF-712","PTR-AUDIO1-TMB-COMM1-434","PTR-AUDIO1-TMB-COMM2-435","PTR-AUDIO2-TMB-MODE-443","PTR-AUXCOM-LVR-MODE-540","PTR-AUXCOM-TMB-CHNL1-545","PTR-AUXCOM-TMB-CHNL2-547","PTR-AUXCOM-TMB-CHNL3-549","PTR-AUXCOM-TMB-CHNL4-551","PTR-AUXCOM-TMB-CNI-542","PTR-AUXCOM-TMB-M4-541","PTR-AUXCOM-TMB-MONITOR-544","PTR-AUXCOM-TMB-REPLY-543","PTR-AUXCOM-TMB-TACAN-553","PTR-AVIPWR-LVR-INS-719","PTR-AVIPWR-LVR-MIDS-723","PTR-AVIPWR-TMB-DL-721","PTR-AVIPWR-TMB-GPS-720","PTR-AVIPWR-TMB-MAP-722","PTR-AVIPWR-TMB-MFD-717","PTR-AVIPWR-TMB-MMC-715","PTR-AVIPWR-TMB-STSTA-716","PTR-AVIPWR-TMB-UFC-718","PTR-CDCP-TMB-FMODE-158","PTR-CDCP-TMB-FTRANS-159","PTR-CLCP-BTN-ADV-97","PTR-CLCP-TMB-LASER-103","PTR-CLCP-TMB-MASTER-105","PTR-CLCP-TMB-PITCH-109","PTR-CLCP-TMB-RF-100","PTR-CLCP-TMB-ROLL-108","PTR-EHSI-LVR-CRS-44","PTR-EHSI-LVR-HDG-45","PTR-ELEC-TMB-MPWR-510","PTR-ENGSTART-CVR-ENGCNT-448","PTR-ENGSTART-TMB-ABENG-450","PTR-ENGSTART-TMB-ENGCNT-449","PTR-ENGSTART-TMB-JETFUEL-447","PTR-ENGSTART-TMB-MAXPWR-451","PTR-EPU-CVR-EPUTMB-527","PTR-EPU-CVR-EPUTMB-529","PTR-EPU-TMB-EPUTMB-528","PTR-EXTLGT-TMB-ANTCOL-531","PTR-EXTLGT-TMB-FLSH-532","PTR-EXTLGT-TMB-FUS-534","PTR-EXTLGT-TMB-MASTER-536","PTR-EXTLGT-TMB-WNGTAIL-533","PTR-FLTCP-TMB-AFLP-567","PTR-FLTCP-TMB-BIT-574","PTR-FLTCP-TMB-DIGITAL-566","PTR-FLTCP-TMB-FLCS-573","PTR-FLTCP-TMB-LEFLP-572","PTR-FLTCP-TMB-MAN-568","PTR-FUELCP-CVR-MASTER-558","PTR-FUELCP-TMB-ENGFEED-556","PTR-FUELCP-TMB-MASTER-559","PTR-FUELCP-TMB-REFUEL-555","PTR-FUELCP-TMB-TANK-557","PTR-ICP-TMB-DRIFT-186","PTR-ICP-TMB-GAIN-189","PTR-ICP-TMB-RTN-184","PTR-ICP-TMB-RTNSEQ-DN-185","PTR-ICP-TMB-RTNSEQ-UP-185","PTR-ICP-TMB-SEQ-184","PTR-KY58-LVR-MODE1-705","PTR-KY58-LVR-MODE2-706","PTR-KY58-LVR-MODE3-707","PTR-LARMS-CNPJETT-601","PTR-LARMS-CNPOPN-600","PTR-LARMS-DEFOG-602","PTR-LARMS-TMB-OPN-606","PTR-LGCP-ARM-LG-362","PTR-LGCP-TMB-BRK-356","PTR-LGCP-TMB-GNDJETT-355","PTR-LGCP-TMB-HOOK-354","PTR-LGCP-TMB-LIGHTS-360","PTR-LGCP-TMB-PRKNG-357","PTR-LGCP-TMB-STCONF-358","PTR-LPAN-CMDS-BTN-OSB1-365","PTR-LPAN-CMDS-BTN-OSB2-366","PTR-LPAN-CMDS-BTN-OSB3-367","PTR-LPAN-CMDS-BTN-OSB4-368","PTR-LPAN-CMDS-LVR-MODE-378","PTR-LPAN-CMDS-LVR-PRGM-377","PTR-LPAN-CMDS-TMB-JMR-374","PTR-LPAN-CMDS-TMB-JTSN-371","PTR-LPAN-CMDS-TMB-MWS-373","PTR-LPAN-CMDS-TMB-RWR-375","PTR-MANTRIM-TMB-MODE-564","PTR-MPCP-TMB-MP-425","PTR-NUCLR-TMB-PLAIN-701","PTR-OXYCP-LVR-DUL-727","PTR-OXYCP-LVR-EMRG-726","PTR-OXYCP-LVR-SUPP-728","PTR-RHUD-TMB-ALT-680","PTR-RHUD-TMB-ATT-676","PTR-RHUD-TMB-CAS-679","PTR-RHUD-TMB-DAYNGT-681","PTR-RHUD-TMB-DED-677","PTR-RHUD-TMB-DEPR-678","PTR-RHUD-TMB-TEST-682","PTR-RHUD-TMB-WVAH-675","PTR-RLGT-TMB-MALIND-691","PTR-SAI-LVR-CAGE-P-66","PTR-SEAT-ARM-LOCK-785","PTR-SEAT-TMB-ADJ-786","PTR-SNSR-TMB-FCR-672","PTR-SNSR-TMB-LEFT-670","PTR-SNSR-TMB-RDR-673","PTR-SNSR-TMB-RDR-674","PTR-SNSR-TMB-RIGHT-671","PTR-STICK-HIDE-796","PTR-TESTCP-TMB-EPU-579","PTR-TESTCP-TMB-OXY-576","PTR-TESTCP-TMB-PROBE-578","PTR-TESTCP-TMB-TEST-585","PTR-TWAP-BTN-PWR-401","PTR-ZROIZE-CVR-ZERO-694","PTR-ZROIZE-TMB-VOICE-696","PTR-ZROIZE-TMB-ZERO-695","PTR_ANARC164-CHNL-SELECTOR01-734","RALT","RDR ALT Switch, RDR ALT/STBY/OFF","RF Switch, SILENT/QUIET/NORM","RIGHT HDPT Switch, ON/OFF","RWR 555 Switch, ON/OFF","RWR Indicator Control POWER Button","SAI","SAI Cage Knob, (LMB) Pull to cage /(MW) Adjust aircraft reference symbol","SEAT ADJ Switch, UP/OFF/DOWN","ST STA Switch, ST STA/OFF","STORES CONFIG Switch, CAT III/CAT I","Supply Lever, PBG/ON/OFF","TANK INERTING Switch, TANK INERTING /OFF","TRIM/AP DISC Switch, DISC/NORM","UFC Switch, UFC/OFF","UHF ANT SEL Switch, LOWER/NORM/UPPER","UHF CHAN Knob","UHF Function Knob","UHF Manual Frequency Knob 0.025 MHz","UHF Manual Frequency Knob 0.1 MHz","UHF Manual Frequency Knob 1 MHz","UHF Manual Frequency Knob 10 MHz","UHF Manual Frequency Knob 100 MHz","UHF Mode Knob","UHF SQUELCH Switch","Voice Message Inhibit Switch, VOICE MESSAGE/INHIBIT","WING/TAIL Switch, BRT/OFF/DIM","ZEROIZE Switch Cover, OPEN/CLOSE","ZEROIZE Switch, OFP/OFF/DATA","-0.25","-0.3","0.04","0.25","0.375","0.625","0.8","104","116","122","125","140","141","143","145","147","149","151","165","166","167","168","169","170","171","172","173","174","175","176","177","178","179","180","181","182","187","190","191","192","193","30","300","301","302","3029","303","3030","3031","3036","3037","304","305","306","307","308","309","310","311","312","313","314","315","316","317","318","319","326","327","328","329","330","331","332","333","334","335","336","337","338","339","340","341","342","343","344","345","353","359","361","392","395","397","399","404","418","420","421","422","43","430","431","432","433","436","437","44","440","441","442","50","511","535","537","560","562","565","575","577","604","62","625","626","628","66","67","685","686","687","688","690","692","708","71","794","795","ADI","AERIAL REFUELING Knob","ALT REL Button - Push to release","AMI","AOA Indexer Dimming Lever","AR Status Indicator Dimming Lever","Barometric Setting Knob","CHAFF/FLARE Dispense Button - Push to dispense","COMM 1 Power Knob","COMM 2 Power Knob","Clock Elapsed Time Knob","DN LOCK REL Button - Push to reset","ELEC CAUTION RESET Button - Push to reset","EMER STORES JETTISON Button - Push to jettison","F-ACK Button","FIRE & OHEAT DETECT Test Button - Push to test","FLOOD CONSOLES BRT Knob","FLOOD INST PNL BRT Knob","FORM Knob","HMCS","HMCS SYMBOLOGY INT Knob","HORN SILENCER Button - Push to reset","ICP COM Override Button, COM1(UHF)","ICP COM Override Button, COM2(VHF)","ICP DED Increment/Decrement Switch, Down","ICP DED Increment/Decrement Switch, Up","ICP Enter Button, ENTR","ICP FLIR Increment/Decrement Switch, Down","ICP FLIR Increment/Decrement Switch, Up","ICP FLIR Polarity Button, Wx","ICP HUD Symbology Intensity Knob","ICP IFF Override Button, IFF","ICP LIST Override Button, LIST","ICP Master Mode Button, A-A","ICP Master Mode Button, A-G","ICP Priority Function Button, 0(M-SEL)","ICP Priority Function Button, 1(T-ILS)","ICP Priority Function Button, 2/N(ALOW)","ICP Priority Function Button, 3","ICP Priority Function Button, 4/W(STPT)","ICP Priority Function Button, 5(CRUS)","ICP Priority Function Button, 6/E(TIME)","ICP Priority Function Button, 7(MARK)","ICP Priority Function Button, 8/S(FIX)","ICP Priority Function Button, 9(A-CAL)","ICP Raster Contrast Knob","ICP Raster Intensity Knob","ICP Recall Button, RCL","ICP Reticle Depression Control Knob","IFF IDENT Button","ILS Power Knob","INTERCOM Knob","KY-58 VOLUME Knob","Left MFD OSB 1","Left MFD OSB 10","Left MFD OSB 11","Left MFD OSB 12","Left MFD OSB 13","Left MFD OSB 14","Left MFD OSB 15","Left MFD OSB 16","Left MFD OSB 17","Left MFD OSB 18","Left MFD OSB 19","Left MFD OSB 2","Left MFD OSB 20","Left MFD OSB 3","Left MFD OSB 4","Left MFD OSB 5","Left MFD OSB 6","Left MFD OSB 7","Left MFD OSB 8","Left MFD OSB 9","MAL & IND LTS Test Button - Push to test","MSL Tone Knob","Master Caution Button - Push to reset","Mode (M) Button","PITCH TRIM Wheel","PRIMARY CONSOLES BRT Knob","PRIMARY DATA ENTRY DISPLAY BRT Knob","PRIMARY INST PNL BRT Knob","PTR-ADI-LVR-KNOB-22","PTR-AIRCOND-TMB-TEMP-692","PTR-ALT-LVR-SET-62","PTR-ANARC164-STATUS-422","PTR-ANARC164-T-TONE-418","PTR-ANARC164-TEST-DISPLAY-421","PTR-ANARC164-VOLUME-420","PTR-AOA-LVL-794","PTR-AR-LVL-795","PTR-AUDIO1-LVR-COMM1-430","PTR-AUDIO1-LVR-COMM2-431","PTR-AUDIO1-LVR-MSL-433","PTR-AUDIO1-LVR-SV-432","PTR-AUDIO1-LVR-TF-436","PTR-AUDIO1-LVR-THREAT-437","PTR-AUDIO2-LVR-ILS-442","PTR-AUDIO2-LVR-INTERCOM-440","PTR-AUDIO2-LVR-TACAN-441","PTR-CLCP-TMB-ALT-104","PTR-CMSC-BTN-HNDOFF-141","PTR-CMSC-BTN-LNCH-143","PTR-CMSC-BTN-MODE-145","PTR-CMSC-BTN-OBJ-147","PTR-CMSC-BTN-STEST-149","PTR-CMSC-BTN-T-151","PTR-CMSC-LVR-BRT-140","PTR-CPBC-BTN-FACK-122","PTR-CPBC-BTN-IFF-125","PTR-CPBC-BTN-MCAUT-116","PTR-EHSI-BTN-M-46","PTR-ELEC-BTN-CRES-511","PTR-EXTLGT-LVR-AREF-537","PTR-EXTLGT-LVR-FORM-535","PTR-HMDP-LVR-SMBINT-392","PTR-ICP-BTN-AA-169","PTR-ICP-BTN-AG-170","PTR-ICP-BTN-COM1-165","PTR-ICP-BTN-COM2-166","PTR-ICP-BTN-ENTR-178","PTR-ICP-BTN-IFF-167","PTR-ICP-BTN-LIST-168","PTR-ICP-BTN-NMB0-182","PTR-ICP-BTN-NMB1-171","PTR-ICP-BTN-NMB2-172","PTR-ICP-BTN-NMB3-173","PTR-ICP-BTN-NMB4-175","PTR-ICP-BTN-NMB5-176","PTR-ICP-BTN-NMB6-177","PTR-ICP-BTN-NMB7-179","PTR-ICP-BTN-NMB8-180","PTR-ICP-BTN-NMB9-181","PTR-ICP-BTN-RCL-174","PTR-ICP-BTN-WX-187","PTR-ICP-LVR-BRT-191","PTR-ICP-LVR-CONT-193","PTR-ICP-LVR-RET-192","PTR-ICP-LVR-SYM-190","PTR-ICP-RS-FLIR-DN-188","PTR-ICP-RS-FLIR-UP-188","PTR-ICP-RS-OFF-DN-183","PTR-ICP-RS-OFF-UP-183","PTR-KY58-LVR-VOL-708","PTR-LGCP-BTN-DNLOCK-361","PTR-LGCP-BTN-ESJETT-353","PTR-LGCP-BTN-HORN-359","PTR-LMFCD-BTN-OSB1-300","PTR-LMFCD-BTN-OSB10-309","PTR-LMFCD-BTN-OSB11-310","PTR-LMFCD-BTN-OSB12-311","PTR-LMFCD-BTN-OSB13-312","PTR-LMFCD-BTN-OSB14-313","PTR-LMFCD-BTN-OSB15-314","PTR-LMFCD-BTN-OSB16-315","PTR-LMFCD-BTN-OSB17-316","PTR-LMFCD-BTN-OSB18-317","PTR-LMFCD-BTN-OSB19-318","PTR-LMFCD-BTN-OSB2-301","PTR-LMFCD-BTN-OSB20-319","PTR-LMFCD-BTN-OSB3-302","PTR-LMFCD-BTN-OSB4-303","PTR-LMFCD-BTN-OSB5-304","PTR-LMFCD-BTN-OSB6-305","PTR-LMFCD-BTN-OSB7-306","PTR-LMFCD-BTN-OSB8-307","PTR-LMFCD-BTN-OSB9-308","PTR-LMFCD-RS-BRT-DN-323","PTR-LMFCD-RS-BRT-UP-323","PTR-LMFCD-RS-CON-DN-322","PTR-LMFCD-RS-CON-UP-322","PTR-LMFCD-RS-GAIN-DN-320","PTR-LMFCD-RS-GAIN-UP-320","PTR-LMFCD-RS-SYM-DN-321","PTR-LMFCD-RS-SYM-UP-321","PTR-LSIDE-BTN-CHAFF-604","PTR-MANTRIM-LVR-PITCH-562","PTR-MANTRIM-LVR-ROLL-560","PTR-MANTRIM-LVR-YAW-565","PTR-RLGT-LVR-FLDCNS-688","PTR-RLGT-LVR-FLDPNL-690","PTR-RLGT-LVR-PRICNS-685","PTR-RLGT-LVR-PRIDATA-687","PTR-RLGT-LVR-PRIPNL-686","PTR-RMFCD-BTN-OSB1-326","PTR-RMFCD-BTN-OSB10-335","PTR-RMFCD-BTN-OSB11-336","PTR-RMFCD-BTN-OSB12-337","PTR-RMFCD-BTN-OSB13-338","PTR-RMFCD-BTN-OSB14-339","PTR-RMFCD-BTN-OSB15-340","PTR-RMFCD-BTN-OSB16-341","PTR-RMFCD-BTN-OSB17-342","PTR-RMFCD-BTN-OSB18-343","PTR-RMFCD-BTN-OSB19-344","PTR-RMFCD-BTN-OSB2-327","PTR-RMFCD-BTN-OSB20-345","PTR-RMFCD-BTN-OSB3-328","PTR-RMFCD-BTN-OSB4-329","PTR-RMFCD-BTN-OSB5-330","PTR-RMFCD-BTN-OSB6-331","PTR-RMFCD-BTN-OSB7-332","PTR-RMFCD-BTN-OSB8-333","PTR-RMFCD-BTN-OSB9-334","PTR-RMFCD-RS-BRT-DN-349","PTR-RMFCD-RS-BRT-UP-349","PTR-RMFCD-RS-CON-DN-348","PTR-RMFCD-RS-CON-UP-348","PTR-RMFCD-RS-GAIN-DN-346","PTR-RMFCD-RS-GAIN-UP-346","PTR-RMFCD-RS-SYM-DN-347","PTR-RMFCD-RS-SYM-UP-347","PTR-RPAN-WATCH-BTN-CTRL-627","PTR-SPD-LVR-SET-71","PTR-TESTCP-BTN-FIRE-575","PTR-TESTCP-BTN-MAL-577","PTR-TWAP-BTN-ACTPWR-397","PTR-TWAP-BTN-ALT-399","PTR-TWAP-BTN-SRCH-395","PTR-TWAP-LVR-DIM-404","Pitch Trim Knob","ROLL TRIM Wheel","RWR Indicator Control ACT/PWR Button","RWR Indicator Control ALTITUDE Button","RWR Indicator Control DIM Knob - Rotate to adjust brightness","RWR Indicator Control HANDOFF Button","RWR Indicator Control LAUNCH Button","RWR Indicator Control MODE Button","RWR Indicator Control SEARCH Button","RWR Indicator Control SYS TEST Button","RWR Indicator Control T Button","RWR Indicator Control UNKNOWN SHIP Button","RWR Intensity Knob - Rotate to adjust brightness","Right MFD OSB 1","Right MFD OSB 10","Right MFD OSB 11","Right MFD OSB 12","Right MFD OSB 13","Right MFD OSB 14","Right MFD OSB 15","Right MFD OSB 16","Right MFD OSB 17","Right MFD OSB 18","Right MFD OSB 19","Right MFD OSB 2","Right MFD OSB 20","Right MFD OSB 3","Right MFD OSB 4","Right MFD OSB 5","Right MFD OSB 6","Right MFD OSB 7","Right MFD OSB 8","Right MFD OSB 9","SECURE VOICE Knob","SET INDEX Knob","TACAN Knob","TEMP Knob","TF Tone Knob","THREAT Tone Knob","UHF STATUS Button","UHF TEST DISPLAY Button","UHF Tone Button","UHF VOL Knob","YAW TRIM Knob"]});
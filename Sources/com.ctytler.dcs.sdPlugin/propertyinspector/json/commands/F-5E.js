@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"F-5E","rows":[68,1,10,484,2,1,3,1,0,74,68,1,10,484,2,1,0,1,0,74,68,1,12,485,2,1,3,1,0,74,68,1,12,485,2,1,0,1,0,74,82,80,7,519,6,273,0,1,0,302,82,80,10,519,6,273,3,3,1,302,82,80,12,769,8,660,91,1,0,704,684,619,7,766,6,678,0,1,0,703,67,65,7,750,6,599,0,1,0,717,67,65,10,523,2,118,0,1,0,371,67,65,12,523,6,118,3,3,1,371,67,65,15,507,2,134,19,1,13,413,67,65,15,507,2,134,13,1,13,413,686,627,7,767,8,598,589,1,0,685,702,604,7,765,8,597,92,92,588,831,42,39,7,780,8,628,38,3,0,690,42,39,15,543,2,192,19,1,27,286,42,39,15,543,2,192,13,1,27,286,42,39,20,509,2,193,19,1,27,285,42,39,20,509,2,193,13,1,27,285,42,39,21,763,6,626,0,1,0,687,42,39,25,784,8,661,38,1,0,693,42,39,28,781,8,666,38,1,0,688,42,39,40,782,8,665,38,1,0,691,42,39,32,785,8,664,38,1,0,694,42,39,41,740,8,663,38,1,0,689,42,39,48,783,8,662,1,585,587,692,54,52,7,510,2,239,19,1,55,299,54,52,7,510,2,239,13,1,55,299,54,52,10,789,8,643,1,1,0,700,54,52,12,790,8,46,1,1,0,701,54,52,15,435,2,261,3,3,0,298,54,52,15,435,2,261,0,3,0,298,54,52,25,817,6,595,0,1,0,699,83,81,7,512,6,647,0,1,0,284,83,81,10,512,8,646,91,1,0,284,83,81,12,791,6,648,0,1,0,683,44,43,7,504,2,240,19,1,27,367,44,43,7,504,2,240,13,1,27,367,44,43,10,505,2,241,19,1,51,385,44,43,10,505,2,241,13,1,51,385,44,43,12,436,2,242,3,1,0,383,44,43,12,436,2,242,0,1,0,383,44,43,15,521,2,243,3,1,0,384,44,43,15,521,2,243,0,1,0,384,44,43,20,748,6,641,0,1,0,709,44,43,21,749,6,642,0,1,0,718,44,43,25,814,6,590,0,1,0,719,26,24,7,549,2,195,3,1,0,581,26,24,7,549,2,195,0,1,0,581,26,24,10,548,2,194,3,1,0,564,26,24,10,548,2,194,0,1,0,564,26,24,12,788,8,629,1,3,0,835,26,24,15,805,6,593,0,1,0,819,26,24,20,431,2,98,3,3,0,382,26,24,20,431,2,98,0,3,0,382,26,24,21,562,2,97,3,3,0,310,26,24,21,562,2,97,0,3,0,310,26,24,25,561,2,96,3,3,0,577,26,24,25,561,2,96,0,3,0,577,26,24,32,807,6,99,3,3,1,843,26,24,41,810,6,99,0,1,0,844,26,24,48,808,6,100,0,1,0,842,26,24,69,809,6,100,3,3,1,845,26,24,59,508,2,135,1,1,0,571,26,24,59,508,2,135,0,1,0,571,49,47,7,429,2,1,1,1,0,365,49,47,7,429,2,1,0,1,0,365,49,47,10,301,6,282,19,1,0,374,49,47,10,301,6,282,13,1,0,374,49,47,12,550,6,278,0,1,0,573,49,47,15,550,6,278,3,3,1,573,49,47,20,430,2,235,1,1,0,366,49,47,20,430,2,235,0,1,0,366,30,29,7,544,2,225,90,1,0,362,30,29,7,544,2,225,38,1,0,362,30,29,10,489,2,224,3,1,0,361,30,29,10,489,2,224,0,1,0,361,30,29,12,545,2,226,19,1,93,363,30,29,12,545,2,226,13,1,93,363,30,29,15,787,8,636,1,3,0,707,30,29,20,786,8,637,1,1,0,708,30,29,21,563,8,639,0,3,0,370,30,29,25,563,8,638,3,3,0,370,30,29,28,417,8,667,0,3,0,368,30,29,40,417,8,668,3,3,0,368,30,29,32,741,8,671,1,3,0,710,30,29,41,418,8,669,0,3,0,369,30,29,48,418,8,670,3,3,0,369,30,29,69,742,8,672,1,3,0,711,5,4,7,553,2,236,3,1,0,312,5,4,7,553,2,236,0,1,0,312,5,4,10,557,2,237,0,1,0,411,5,4,12,557,6,237,3,3,1,411,5,4,15,558,2,238,0,1,0,570,5,4,20,558,6,238,3,3,1,570,5,4,21,547,2,227,3,1,0,565,5,4,21,547,2,227,0,1,0,565,5,4,25,524,6,122,0,1,0,386,5,4,28,524,6,122,3,3,1,386,5,4,53,475,2,139,1,1,0,357,5,4,53,475,2,139,0,1,0,357,5,4,70,472,2,136,1,1,0,356,5,4,70,472,2,136,0,1,0,356,5,4,71,473,2,137,1,1,0,355,5,4,71,473,2,137,0,1,0,355,5,4,149,474,2,138,1,1,0,358,5,4,149,474,2,138,0,1,0,358,5,4,150,477,2,141,1,1,0,359,5,4,150,477,2,141,0,1,0,359,5,4,151,476,2,140,1,1,0,353,5,4,151,476,2,140,0,1,0,353,5,4,66,479,2,143,1,1,0,360,5,4,66,479,2,143,0,1,0,360,5,4,78,480,2,144,1,1,0,354,5,4,78,480,2,144,0,1,0,354,5,4,79,482,2,146,1,1,0,333,5,4,79,482,2,146,0,1,0,333,5,4,152,483,2,147,1,1,0,344,5,4,152,483,2,147,0,1,0,344,5,4,153,478,2,142,1,1,0,328,5,4,153,478,2,142,0,1,0,328,5,4,154,481,2,145,1,1,0,323,5,4,154,481,2,145,0,1,0,323,5,4,155,471,2,123,1,1,0,339,5,4,155,471,2,123,0,1,0,339,5,4,156,469,2,124,1,1,0,343,5,4,156,469,2,124,0,1,0,343,5,4,157,464,2,125,1,1,0,319,5,4,157,464,2,125,0,1,0,319,5,4,158,467,2,126,1,1,0,327,5,4,158,467,2,126,0,1,0,327,5,4,159,466,2,127,1,1,0,341,5,4,159,466,2,127,0,1,0,341,5,4,160,465,2,128,1,1,0,321,5,4,160,465,2,128,0,1,0,321,5,4,161,470,2,129,1,1,0,338,5,4,161,470,2,129,0,1,0,338,5,4,162,468,2,130,1,1,0,332,5,4,162,468,2,130,0,1,0,332,5,4,163,439,2,244,1,1,0,334,5,4,163,439,2,244,0,1,0,334,5,4,164,440,2,250,1,1,0,345,5,4,164,440,2,250,0,1,0,345,5,4,165,451,2,245,1,1,0,335,5,4,165,451,2,245,0,1,0,335,5,4,166,452,2,251,1,1,0,346,5,4,166,452,2,251,0,1,0,346,5,4,167,438,2,246,1,1,0,315,5,4,167,438,2,246,0,1,0,315,5,4,168,441,2,247,1,1,0,316,5,4,168,441,2,247,0,1,0,316,5,4,169,445,2,248,1,1,0,322,5,4,169,445,2,248,0,1,0,322,5,4,170,447,2,249,1,1,0,324,5,4,170,447,2,249,0,1,0,324,5,4,171,462,2,253,1,1,0,351,5,4,171,462,2,253,0,1,0,351,5,4,172,442,2,254,1,1,0,317,5,4,172,442,2,254,0,1,0,317,5,4,173,461,2,255,1,1,0,350,5,4,173,461,2,255,0,1,0,350,5,4,174,456,2,256,1,1,0,330,5,4,174,456,2,256,0,1,0,330,5,4,175,446,2,257,1,1,0,320,5,4,175,446,2,257,0,1,0,320,5,4,176,450,2,258,1,1,0,325,5,4,176,450,2,258,0,1,0,325,5,4,177,443,2,259,1,1,0,318,5,4,177,443,2,259,0,1,0,318,5,4,178,458,2,260,1,1,0,349,5,4,178,458,2,260,0,1,0,349,5,4,179,457,2,262,1,1,0,340,5,4,179,457,2,262,0,1,0,340,5,4,180,444,2,263,1,1,0,329,5,4,180,444,2,263,0,1,0,329,5,4,181,453,2,264,1,1,0,326,5,4,181,453,2,264,0,1,0,326,5,4,182,448,2,265,1,1,0,331,5,4,182,448,2,265,0,1,0,331,5,4,183,449,2,266,1,1,0,342,5,4,183,449,2,266,0,1,0,342,5,4,184,463,2,267,1,1,0,352,5,4,184,463,2,267,0,1,0,352,5,4,185,454,2,268,1,1,0,336,5,4,185,454,2,268,0,1,0,336,5,4,186,455,2,269,1,1,0,347,5,4,186,455,2,269,0,1,0,347,5,4,187,459,2,270,1,1,0,337,5,4,187,459,2,270,0,1,0,337,5,4,188,460,2,271,1,1,0,348,5,4,188,460,2,271,0,1,0,348,73,72,7,757,6,631,0,1,0,732,73,72,10,758,6,632,0,1,0,833,73,72,12,546,2,228,3,1,0,377,73,72,12,546,2,228,0,1,0,377,61,56,7,777,8,611,1,1,0,716,61,56,10,776,8,612,1,1,0,715,61,56,12,525,2,121,3,1,0,380,61,56,12,525,2,121,0,1,0,380,61,56,15,538,2,217,3,1,0,406,61,56,15,538,2,217,0,1,0,406,23,22,7,540,2,219,3,1,0,410,23,22,7,540,2,219,0,1,0,410,23,22,10,541,2,221,3,1,0,569,23,22,10,541,2,221,0,1,0,569,23,22,12,556,2,230,3,1,0,379,23,22,12,556,2,230,0,1,0,379,23,22,15,555,2,229,3,1,0,378,23,22,15,555,2,229,0,1,0,378,23,22,20,554,2,232,3,1,0,372,23,22,20,554,2,232,0,1,0,372,23,22,21,552,6,234,3,3,1,311,23,22,25,552,6,234,0,1,0,311,23,22,28,559,2,231,3,1,0,408,23,22,28,559,2,231,0,1,0,408,23,22,40,560,2,233,3,1,0,567,23,22,40,560,2,233,0,1,0,567,23,22,32,487,2,218,3,1,0,409,23,22,32,487,2,218,0,1,0,409,23,22,41,488,2,220,3,1,0,568,23,22,41,488,2,220,0,1,0,568,34,33,7,432,2,280,1,1,0,407,34,33,7,432,2,280,0,1,0,407,34,33,10,746,6,682,0,1,0,729,34,33,12,751,6,676,0,1,0,731,34,33,15,804,6,592,0,1,0,739,34,33,20,433,2,283,1,1,0,387,34,33,20,433,2,283,0,1,0,387,34,33,21,542,2,131,3,1,0,414,34,33,21,542,2,131,0,1,0,414,34,33,25,755,6,675,0,1,0,730,34,33,28,752,6,679,0,1,0,733,34,33,40,753,6,680,0,1,0,738,34,33,32,754,6,681,0,1,0,834,34,33,59,747,6,677,0,1,0,706,390,199,7,772,8,620,1,1,0,723,390,199,10,771,8,621,1,1,0,722,724,622,7,768,8,601,1,1,0,726,11,9,7,491,2,112,19,1,45,392,11,9,7,491,2,112,13,1,45,392,11,9,10,492,2,113,19,1,27,393,11,9,10,492,2,113,13,1,27,393,11,9,12,493,2,114,19,1,45,394,11,9,12,493,2,114,13,1,45,394,11,9,15,494,2,115,19,1,45,395,11,9,15,494,2,115,13,1,45,395,11,9,20,495,2,116,19,1,45,396,11,9,20,495,2,116,13,1,45,396,11,9,21,496,2,117,19,1,45,397,11,9,21,496,2,117,13,1,45,397,11,9,25,86,6,102,3,3,1,85,11,9,25,86,6,102,0,1,0,85,11,9,28,87,2,103,19,1,55,84,11,9,28,87,2,103,13,1,55,84,11,9,40,498,2,104,3,3,0,399,11,9,40,498,2,104,0,3,0,399,11,9,32,500,6,105,0,1,0,400,11,9,32,500,2,105,1,3,1,400,11,9,41,501,6,106,0,1,0,401,11,9,41,501,2,106,1,3,1,401,11,9,48,502,6,107,0,1,0,402,11,9,48,502,2,107,1,3,1,402,11,9,69,503,6,108,0,1,0,403,11,9,69,503,2,108,1,3,1,403,11,9,59,499,6,109,0,1,0,404,11,9,59,499,2,109,1,3,1,404,11,9,77,490,6,110,0,1,0,391,11,9,77,490,2,110,1,3,1,391,11,9,53,497,2,111,3,1,0,398,11,9,53,497,2,111,0,1,0,398,11,9,70,761,6,606,0,1,0,734,11,9,71,762,6,605,0,1,0,832,11,9,66,86,8,602,0,1,0,85,11,9,78,87,8,603,0,1,0,84,725,613,7,815,6,594,0,1,0,696,35,31,7,434,2,252,3,1,0,300,35,31,7,434,2,252,0,1,0,300,35,31,10,522,2,277,3,1,0,412,35,31,10,522,2,277,0,1,0,412,35,31,12,775,8,607,1,1,0,721,35,31,15,818,8,608,1,1,0,720,35,31,20,774,8,609,1,1,0,714,35,31,21,773,8,610,1,1,0,712,35,31,25,778,8,633,1,1,0,705,35,31,28,527,6,120,0,1,0,580,35,31,28,527,6,120,0,1,0,580,35,31,40,526,6,119,0,1,0,314,35,31,32,526,6,119,3,3,1,314,35,31,41,760,6,600,0,1,0,735,62,57,7,437,2,222,3,1,0,375,62,57,7,437,2,222,0,1,0,375,62,57,10,756,6,634,0,1,0,713,62,57,12,539,2,223,3,3,0,574,62,57,12,539,2,223,0,3,0,574,62,57,15,759,6,635,0,1,0,836,727,640,25,792,6,614,0,1,0,728,63,60,7,515,2,276,3,1,0,415,63,60,7,515,2,276,0,1,0,415,63,60,10,513,2,275,3,1,0,373,63,60,10,513,2,275,0,1,0,373,63,60,12,514,2,274,0,1,0,376,63,60,15,514,6,274,3,3,1,376,37,36,7,797,6,649,0,1,0,826,37,36,10,798,6,650,0,1,0,827,37,36,12,795,6,651,0,1,0,824,37,36,15,794,6,653,0,1,0,821,37,36,20,801,6,654,0,1,0,829,37,36,21,800,6,655,0,1,0,828,37,36,25,799,6,656,0,1,0,830,37,36,28,516,2,272,3,1,0,566,37,36,28,516,2,272,0,1,0,566,37,36,40,796,6,652,0,1,0,825,37,36,32,793,6,657,0,1,0,820,37,36,41,803,8,659,94,1,0,823,37,36,48,802,8,658,94,1,0,822,572,204,7,416,6,644,0,1,0,364,572,204,10,416,8,645,38,1,0,364,64,58,7,551,2,279,3,1,0,575,64,58,7,551,2,279,0,1,0,575,64,58,10,770,8,674,1,1,27,837,64,58,12,511,2,281,19,1,27,576,64,58,12,511,2,281,13,1,27,576,64,58,15,764,6,673,0,1,0,838,50,46,7,811,8,615,13,1,0,839,50,46,10,88,8,616,13,1,0,89,50,46,12,88,2,132,3,1,0,89,50,46,12,88,2,132,0,1,0,89,50,46,15,812,6,617,0,1,0,841,50,46,20,813,8,618,76,1,0,840,50,46,21,518,2,133,19,1,55,578,50,46,21,518,2,133,13,1,55,578,18,17,7,424,2,148,582,1,95,296,18,17,7,424,2,148,586,1,95,296,18,17,10,421,2,196,19,1,27,292,18,17,10,421,2,196,13,1,27,292,18,17,12,422,2,197,19,13,0,291,18,17,12,422,2,197,13,13,0,291,18,17,15,423,2,198,19,13,0,290,18,17,15,423,2,198,13,13,0,290,18,17,20,420,2,200,19,13,0,289,18,17,20,420,2,200,13,13,0,289,18,17,21,419,2,201,584,75,0,288,18,17,21,419,2,201,75,75,0,288,18,17,25,426,2,189,19,1,51,294,18,17,25,426,2,189,13,1,51,294,18,17,28,427,2,191,19,1,27,295,18,17,28,427,2,191,13,1,27,295,18,17,40,744,6,624,0,1,0,697,18,17,32,428,2,190,3,1,0,297,18,17,32,428,2,190,0,1,0,297,18,17,41,745,8,623,0,1,0,698,18,17,53,520,2,203,90,1,0,293,18,17,53,520,2,203,38,1,0,293,18,17,66,425,2,202,3,1,0,287,18,17,66,425,2,202,0,1,0,287,18,17,79,743,6,625,0,1,0,695,16,14,7,528,2,210,3,1,0,306,16,14,7,528,2,210,0,1,0,306,16,14,10,529,2,211,3,1,0,305,16,14,10,529,2,211,0,1,0,305,16,14,12,530,2,212,3,1,0,304,16,14,12,530,2,212,0,1,0,304,16,14,15,531,2,213,3,1,0,303,16,14,15,531,2,213,0,1,0,303,16,14,20,532,2,214,3,1,0,307,16,14,20,532,2,214,0,1,0,307,16,14,21,533,2,215,3,1,0,308,16,14,21,533,2,215,0,1,0,308,16,14,25,534,2,216,3,1,0,309,16,14,25,534,2,216,0,1,0,309,16,14,28,537,2,205,3,3,0,405,16,14,28,537,2,205,0,3,0,405,16,14,40,535,2,206,583,51,76,313,16,14,40,535,2,206,51,51,76,313,16,14,32,486,2,207,3,1,0,388,16,14,32,486,2,207,0,1,0,388,16,14,41,536,2,208,3,3,0,389,16,14,41,536,2,208,0,3,0,389,16,14,48,506,2,209,19,1,27,381,16,14,48,506,2,209,13,1,27,381,16,14,59,816,6,596,0,1,0,736,16,14,77,779,8,630,38,1,0,737,16,14,53,517,6,101,38,1,38,579,16,14,70,517,6,101,0,1,0,579,16,14,71,806,6,591,0,1,0,846],"strings":["1","0","TUMB","-1","3","ELEC_INTERFACE","BTN","3001","LEV","22","3002","IFF","3003","0.1","15","3004","WEAPONS_CONTROL","23","UHF_RADIO","-0.1","3005","3006","4","FUEL_INTERFACE","2","3007","CONTROL_INTERFACE","0.3","3008","9","ECS_INTERFACE","12","3010","7","GEAR_INTERFACE","INTLIGHTS_SYSTEM","19","RWR_IC","0.5","17","3009","3011","AN_APQ159","13","CMDS","0.7","41","10","3012","CPT_MECH","TACAN_CTRL_PANEL","0.2","18","3016","AN_ASG31","0.4","11","14","21","3014","8","EXTLIGHTS_SYSTEM","JETTISON_SYSTEM","OXYGEN_INTERFACE","SIGHT_CAMERA","16","3022","AHRS","","3013","3017","3018","6","ENGINE_INTERFACE","Toggle Mirrors","0.25","0.8","3015","3023","3024","31","35","AAU34","CLOCK","IFF MASTER Control Selector, EMER(use MW to pull switch)/NORM/LOW/STBY/OFF","IFF MODE 4 CODE Selector, ZERO(use MW to pull switch)/B/A/HOLD","PTR-IFFCP-CODE-199","PTR-IFFCP-MASTER-200","PTR-TACAN-CHANNEL-SELECTOR-2-257","TACAN Channel Selector (Ones) / X/Y Mode - Right mouse click to select X/Y. Rotate mouse wheel to make channel selection","-0.5","0.04","0.15","0.6","0.9","0.95","101","115","116","125","126","127","199","200","201","202","203","204","205","206","207","208","209","210","211","212","213","214","220","225","226","229","230","231","233","234","238","239","244","245","246","250","258","262","273","278","280","281","282","283","284","285","286","287","288","289","290","291","300","3019","3020","3021","3025","3026","3027","3028","3029","3030","3031","3032","3034","3035","3036","3037","3038","3039","3040","3041","3042","3043","3044","3045","3046","3047","3048","3049","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","307","308","311","315","316","322","323","327","328","329","33","330","331","335","336","34","340","341","342","343","344","346","347","348","349","350","351","352","353","359","360","361","362","364","367","370","371","372","375","376","377","378","380","381","382","383","384","387","388","389","40","400","404","408","409","450","451","453","454","455","456","457","458","46","460","461","462","463","464","467","468","469","47","471","472","473","474","475","476","477","478","479","480","575","60","601","602","603","613","772","80","83","84","91","98","ABU-11 Clock Winding and Setting Knob","AN/APQ-159 Radar Mode Selector Switch, OFF/STBY/OPER/TEST","AN/APQ-159 Radar Range Selector Switch [nm], 5/10/20/40","AN/ARC-164, Hinged Access Door, OPEN/CLOSE","AN/ARC-164, UHF Radio 0.025 MHz Frequency Selector Knob","AN/ARC-164, UHF Radio 0.1 MHz Frequency Selector Knob","AN/ARC-164, UHF Radio 1 MHz Frequency Selector Knob","AN/ARC-164, UHF Radio 10 MHz Frequency Selector Knob","AN/ARC-164, UHF Radio 100 MHz Frequency Selector Knob","AN/ARC-164, UHF Radio Antenna Selector Switch, UPPER/AUTO/LOWER","AN/ARC-164, UHF Radio Frequency Mode Selector Switch, MANUAL/PRESET/GUARD","AN/ARC-164, UHF Radio Function Selector Switch, OFF/MAIN/BOTH/ADF","AN/ARC-164, UHF Radio Preset Channel Selector Knob","AN/ARC-164, UHF Radio Squelch Switch, ON/OFF","AN/ASG-31 Sight BIT Switch, BIT 1/OFF/BIT 2","AN/ASG-31 Sight Mode Selector, OFF/MSL/A/A1 GUNS/A/A2 GUNS/MAN","AN/ASG-31 Sight Panel Light Button, ON/OFF","ARM-DRAG-CHUTE-91","Altimeter Mode Control Lever, ELECT(rical)/PNEU(matic)","Armament Position Selector Switch - CENTERLINE, ON/OFF","Armament Position Selector Switch - LEFT INBD, ON/OFF","Armament Position Selector Switch - LEFT OUTBD, ON/OFF","Armament Position Selector Switch - LEFT WINGTIP, ON/OFF","Armament Position Selector Switch - RIGHT INBD, ON/OFF","Armament Position Selector Switch - RIGHT OUTBD, ON/OFF","Armament Position Selector Switch - RIGHT WINGTIP, ON/OFF","Auto Flap System Thumb Switch, UP/FIXED/AUTO","Autobalance Switch, LEFT/NEUT/RIGHT","Battery Switch, BATT/OFF","Bombs Arm Switch, SAFE/TAIL/NOSE & TAIL/NOSE","Bright/Dim Switch, BRT/NEUT/DIM","CB 26 VOLT AC POWER, ON/OFF","CB ATTD & HDG REF SYS A, ON/OFF","CB ATTD & HDG REF SYS B, ON/OFF","CB ATTD & HDG REF SYS C, ON/OFF","CB CABIN AIR VALVES, ON/OFF","CB CABIN COND, ON/OFF","CB CAUTION & WARN LIGHTS-DIM, ON/OFF","CB CENTRAL AIR DATA COMPUTER, ON/OFF","CB EMERGENCY ALL JETTISON, ON/OFF","CB ENG IGN L ENG INST & HYD IND, ON/OFF","CB FUEL QTY PRIMARY, ON/OFF","CB IGNITION INVERTER POWER, ON/OFF","CB INST LIGHTS, ON/OFF","CB JETTISON CONTROL, ON/OFF","CB L BOOST CL & TIP TANK FUEL CONT, ON/OFF","CB L ENG AUX DOOR, ON/OFF","CB L ENG START & AB CONT, ON/OFF","CB LDG-TAXI LAMP PWR, ON/OFF","CB LEFT AIM-9 CONT, ON/OFF","CB LEFT AIM-9 POWER, ON/OFF","CB LEFT GUN FIRING, ON/OFF","CB LEFT LE FLAP CONT, ON/OFF","CB LEFT TE FLAP CONT, ON/OFF","CB OXY QTY & CANOPY SEAL, ON/OFF","CB PITOT HEATER, ON/OFF","CB PYLON TANK FUEL CONT, ON/OFF","CB R ENG AUX DOORS, ON/OFF","CB R ENG START & AB CONT, ON/OFF","CB R OIL & HYD IND FUEL QTY SEL, ON/OFF","CB RIGHT AIM-9 CONT, ON/OFF","CB RIGHT AIM-9 POWER, ON/OFF","CB RIGHT GUN FIRING, ON/OFF","CB RIGHT LE FLAP CONT, ON/OFF","CB RIGHT TE FLAP CONT & IND, ON/OFF","CB TACAN, ON/OFF","CB TOTAL TEMP PROBE HTR, ON/OFF","CB TRIM CONTROL, ON/OFF","CB UHF COMMAND RADIO, ON/OFF","CB WPN ARMING, ON/OFF","CB WPN MODE SEL & AIM-9-INTLK, ON/OFF","CB WPN PWR CENTER LINE, ON/OFF","CB WPN PWR LEFT INBD, ON/OFF","CB WPN PWR LEFT OUTBD, ON/OFF","CB WPN PWR RIGHT INBD, ON/OFF","CB WPN PWR RIGHT OUTBD, ON/OFF","CB WPN RELEASE, ON/OFF","Cabin Press Switch Cover, OPEN/CLOSED","Cabin Press Switch, DEFOG ONLY/NORMAL/RAM DUMP","Cabin Temp Switch, AUTO/CENTER/MAN COLD/MAN HOT","Cage/Pitch Trim Knob","Canopy Handle, OPEN/CLOSE","Canopy Jettison T-Handle, PULL/PUSH","Chaff Mode Selector, OFF/SINGLE/PRGM/MULT","Cockpit Left Air Inlet 1","Cockpit Left Air Inlet 2","Cockpit Right Air Inlet","Compass Switch, DIR GYRO/MAG/FAST SLAVE","Crossfeed Switch, OPEN/CLOSED","Diluter Lever","Drag Chute T-Handle, PULL/PUSH","Emergency All Jettison Button Cover, OPEN","Emergency Lever, EMERGENCY/NORMAL/TEST MASK","Engine Anti-Ice Switch, ENGINE/OFF","Ext Fuel Cl Switch, ON/OFF","Ext Fuel Pylons Switch, ON/OFF","Exterior Lights Beacon Switch, BEACON/OFF","External Stores Selector, RIPL/BOMB/SAFE/RKT DISP","Flaps Lever, EMER UP/THUMB SW/FULL","Flare Jettison Switch Cover, OPEN/CLOSED","Flare Jettison Switch, OFF/UP","Flare Mode Selector, OFF/SINGLE/PRGM","Fuel & Oxygen Switch, GAGE TEST/OFF/QTY CHECK","Gear Alternate Release Reset Control, OFF/RESET","Guns, Missile and Camera Switch Cover, OPEN/CLOSE","Guns, Missile and Camera Switch, GUNS MSL & CAMR/OFF/CAMR ONLY","HSI","IFF Identification of Position (IP) Switch, IDENT/OUT/MIC","IFF MODE 1 Code Selector Wheel 1","IFF MODE 1 Code Selector Wheel 2","IFF MODE 3/A Code Selector Wheel 1","IFF MODE 3/A Code Selector Wheel 2","IFF MODE 3/A Code Selector Wheel 3","IFF MODE 3/A Code Selector Wheel 4","IFF MODE 4 Control Switch, ON/OUT","IFF MODE 4 Monitor Control Switch, AUDIO/OUT/LIGHT","IFF Mode Select/TEST Switch, M-1 /ON/OUT","IFF Mode Select/TEST Switch, M-2 /ON/OUT","IFF Mode Select/TEST Switch, M-3/A /ON/OUT","IFF Mode Select/TEST Switch, M-C /ON/OUT","IFF RAD TEST/MON Switch, RAD TEST/OUT/MON","Interval Switch [sec], .06/.10/.14","Landing & Taxi Light Switch, ON/OFF","Landing Gear Lever, LG UP/LG DOWN","Left Boost Pump Switch, ON/OFF","Left Fuel Shutoff Switch Cover, OPEN/CLOSED","Left Fuel Shutoff Switch, OPEN/CLOSED","Left Generator Switch, L GEN/OFF/RESET","Magnetic Compass Light Switch, LIGHT/OFF","Nav Mode Selector Switch, DF/TACAN","Nose Strut Switch, EXTEND/RETRACT","Oxygen Supply Lever, ON/OFF","PNT-LVR-SAI-CAGE-441","PTR-AIR-INLET-L-1","PTR-AIR-INLET-L-2","PTR-ANARC164-0.025MHZ-SELECTOR-306","PTR-ANARC164-0.1MHZ-SELECTOR-305","PTR-ANARC164-100MHZ-SELECTOR-302","PTR-ANARC164-10MHZ-SELECTOR-303","PTR-ANARC164-1MHZ-SELECTOR-304","PTR-ANARC164-CHANNEL-SELECTOR-300","PTR-ANARC164-COVER-335","PTR-ANARC164-FREQMODE-307","PTR-ANARC164-FUNCTION-311","PTR-ANARC164-SQUELCH-308","PTR-ARM-CANOPY-712","PTR-ARM-CNP-JETT-384","PTR-ARM-FLAP-LEVER-116","PTR-ARM-LAND-GEAR-83","PTR-ARM-LG-RESET-98","PTR-BTN-SGT-PNLT-46","PTR-BTN-SGT-PNLT-47","PTR-CAP-CMD-JETT-408","PTR-CAP-LVP-EMER-JETT-364","PTR-CIRQ-L-28V-AC-453","PTR-CIRQ-L-AIM9-L-450","PTR-CIRQ-L-AIM9-R-457","PTR-CIRQ-L-ATTD-A-454","PTR-CIRQ-L-ATTD-B-461","PTR-CIRQ-L-ATTD-C-468","PTR-CIRQ-L-BOOST-472","PTR-CIRQ-L-C-AD-COMP-455","PTR-CIRQ-L-CAB-COND-464","PTR-CIRQ-L-ENG-IGN-456","PTR-CIRQ-L-ENG-L-474","PTR-CIRQ-L-ENG-R-475","PTR-CIRQ-L-FUEL-QTY-467","PTR-CIRQ-L-GUN-L-451","PTR-CIRQ-L-GUN-R-458","PTR-CIRQ-L-IGN-INV-473","PTR-CIRQ-L-LE-L-477","PTR-CIRQ-L-LE-R-478","PTR-CIRQ-L-LENG-AUX-463","PTR-CIRQ-L-PYL-TANK-471","PTR-CIRQ-L-TACAN-469","PTR-CIRQ-L-TE-L-479","PTR-CIRQ-L-TE-R-480","PTR-CIRQ-L-TOT-TEMP-462","PTR-CIRQ-L-TRIM-460","PTR-CIRQ-L-UHF-COMM-476","PTR-CIRQ-R-CAB-VALV-234","PTR-CIRQ-R-CAUT-LGT-244","PTR-CIRQ-R-ENG-R-AUX-239","PTR-CIRQ-R-INS-LGT-238","PTR-CIRQ-R-LDG-TAXI-246","PTR-CIRQ-R-OIL-HYD-233","PTR-CIRQ-R-OXY-QTY-245","PTR-CIRQ-R-PITOT-HEAT-231","PTR-CIRQUIT-C-01-280","PTR-CIRQUIT-C-02-281","PTR-CIRQUIT-C-03-282","PTR-CIRQUIT-C-04-283","PTR-CIRQUIT-C-05-284","PTR-CIRQUIT-C-06-285","PTR-CIRQUIT-C-07-286","PTR-CIRQUIT-C-08-287","PTR-CIRQUIT-C-09-288","PTR-CIRQUIT-C-10-289","PTR-CIRQUIT-C-11-290","PTR-CIRQUIT-C-12-291","PTR-CNPY-MIRROR-L-4","PTR-CNPY-MIRROR-R-4","PTR-CVR-LVP-GUM-MSL-CAM-342","PTR-CVR-LVP-SHOOTOFF-L-359","PTR-CVR-LVP-SHOOTOFF-R-361","PTR-CVR-RVP-CAB-PRESS-370","PTR-IFFCP-MIC-IDENT-207","PTR-IFFCP-MODE1-WHEEL1-209","PTR-IFFCP-MODE1-WHEEL2-210","PTR-IFFCP-MODE3A-WHEEL1-211","PTR-IFFCP-MODE3A-WHEEL2-212","PTR-IFFCP-MODE3A-WHEEL3-213","PTR-IFFCP-MODE3A-WHEEL4-214","PTR-IFFCP-ON-OUT-208","PTR-IFFCP-OUT-AUDIO-LGT-201","PTR-IFFCP-RADTEST-206","PTR-IFFCP-TEST-M-1-202","PTR-IFFCP-TEST-M-2-203","PTR-IFFCP-TEST-M-3A-204","PTR-IFFCP-TEST-M-C-205","PTR-LVR-CMD-CHF-MODE-400","PTR-LVR-CMD-FLR-MODE-404","PTR-LVR-LVP-EXT-STORE-344","PTR-LVR-NAVMODE-273","PTR-LVR-PEDAL-ADJ-278","PTR-LVR-RCP-MODE-316","PTR-LVR-SGT-MODE-40","PTR-LVR-SGT-OVRRUN-84","PTR-LVR-WATCH-SET-510","PTR-OXYCP-LVR-DUL-602","PTR-OXYCP-LVR-EMRG-601","PTR-OXYCP-LVR-SUPP-603","PTR-RWR-BTN-POWER-575","PTR-STICK-BTN-TRGG-127","PTR-TACAN-MODE-262","PTR-TMB-ALT-MODE-60","PTR-TMB-ANT-SELECT-336","PTR-TMB-CMD-JETT-409","PTR-TMB-COMPASS-LGT-613","PTR-TMB-COMPASS-MODE-220","PTR-TMB-FOCP-FUELOXY-230","PTR-TMB-LCP-BEAKON-229","PTR-TMB-LCP-BRT-225","PTR-TMB-LCP-TEST-226","PTR-TMB-LVP-ARMPOS1-346","PTR-TMB-LVP-ARMPOS2-347","PTR-TMB-LVP-ARMPOS3-348","PTR-TMB-LVP-ARMPOS4-349","PTR-TMB-LVP-ARMPOS5-350","PTR-TMB-LVP-ARMPOS6-351","PTR-TMB-LVP-ARMPOS7-352","PTR-TMB-LVP-BOMB-ARM-341","PTR-TMB-LVP-GUM-MSL-CAM-343","PTR-TMB-LVP-INTERVAL-340","PTR-TMB-LVP-LIGHTS-LAND-353","PTR-TMB-LVP-SEL-JETT-367","PTR-TMB-LVP-SHOOTOFF-L-360","PTR-TMB-LVP-SHOOTOFF-R-362","PTR-TMB-NOSE-STRUT-250","PTR-TMB-RCP-RANGE-315","PTR-TMB-RVP-CAB-PRESS-371","PTR-TMB-RVP-CPT-TEMP-372","PTR-TMB-RVP-ENG-ANTICE-376","PTR-TMB-RVP-PITOT-HEAT-375","PTR-TMB-SACP-PITCH-322","PTR-TMB-SACP-YAW-323","PTR-TMB-SEAT-ADJ-772","PTR-TMB-SGT-FPS-80","PTR-TMB-VRP-AUTO-BAL-383","PTR-TMB-VRP-BATT-387","PTR-TMB-VRP-CRSS-BOOST-381","PTR-TMB-VRP-FUEL-TRANS-FUZ-377","PTR-TMB-VRP-FUEL-TRANS-PYL-378","PTR-TMB-VRP-GEN-L-388","PTR-TMB-VRP-GEN-R-389","PTR-TMB-VRP-LFT-BOOST-380","PTR-TMB-VRP-RGT-BOOST-382","PTR-TRTL-BRK-101","PTR-TRTL-FLPS-115","PTR-VRP-AIR-INLET-385","Pitch Damper Switch, PITCH/OFF","Pitot Anti-Ice Switch, PITOT/OFF","RWR Indicator Control POWER Button","Right Boost Pump Switch, ON/OFF","Right Fuel Shutoff Switch Cover, OPEN/CLOSED","Right Fuel Shutoff Switch, OPEN/CLOSED","Right Generator Switch, R GEN/OFF/RESET","Rudder Pedal Adjust T-Handle, PULL/STOW","SAI","Seat Adjust Switch, DOWN/NEUTRAL/UP","Select Jettison Switch, SELECT POSITION/OFF/ALL PYLONS","Sight Camera FPS Select Switch, 24/48","Sight Camera Overrun Selector, 0/3/10/20","Speed Brake Switch, OUT/OFF/IN","TACAN Mode Selector Switch","Trigger Button, FIRST DETENT(LMB)/SECOND DETENT(RMB)","Warning Test Switch, Press to test","Yaw Damper Switch, YAW/OFF","-0.05","-0.2","-0.25","-0.75","0.05","0.75","0.85","0.875","117","128","131","132","135","136","137","140","150","166","172","180","197","198","20","215","217","221","222","223","224","227","228","24","252","256","257","259","261","27","271","272","28","309","310","314","317","32","321","324","345","357","358","363","365","366","373","374","385","386","39","403","407","42","441","442","510","511","512","551","554","556","559","561","564","567","570","573","577","578","62","65","66","67","68","69","70","715","716","717","718","719","720","79","82","87","88","89","904","92","93","94","95","ABU-11 Clock Elapsed Time Knob","ACCELEROMETER","AI Pitch Trim Knob","AI_ARU20","AN/APQ-159 Radar Acquisition Button","AN/APQ-159 Radar Bright Knob - Rotate to adjust brightness","AN/APQ-159 Radar Cursor Knob - Rotate to adjust indication brightness","AN/APQ-159 Radar Elevation Antenna Tilt Control Knob - Rotate to adjust antenna elevation","AN/APQ-159 Radar Persistence Knob - Rotate to adjust persistence","AN/APQ-159 Radar Pitch Knob - Rotate to adjust horizon bar","AN/APQ-159 Radar Scale Knob - Rotate to adjust scale brightness","AN/APQ-159 Radar Video Knob - Rotate to adjust video intensity","AN/ARC-164, Preset Channel Set Button - Press to set channel frequency","AN/ARC-164, UHF Radio Microphone Button","AN/ARC-164, UHF Radio Tone Button","AN/ARC-164, UHF Radio Volume Knob","AN/ASG-31 Sight Cage Switch - Press and hold to cage","AN/ASG-31 Sight Reticle Depression Knob - Rotate to adjust manual mode depression angle","AN/ASG-31 Sight Reticle Intensity Knob - Rotate to adjust brightness","AN_ALR87","Accelerometer - Push to set","Altimeter Zero Setting Knob","Armament Panel Lights Knob","Arresting Hook Button","Cabin Temperature Knob","Canopy Defog Knob","Chaff Counter Reset Button - Push to reset","Cockpit Left Air Inlet 1 Valve","Cockpit Left Air Inlet 2 Valve","Console Lights Knob","Emergency All Jettison Button - Push to jettison","Engine Instruments Lights Knob","Exterior Lights Formation Knob Knob","Exterior Lights Nav Knob","Fast Erect Button - Push to erect","Flare Counter Reset Button - Push to reset","Flare-Chaff Button - Push to dispense","Flight Instruments Lights Knob","Flood Lights Knob","HSI Course Set Knob","HSI Heading Set Knob","IAS_MACH_INDICATOR","INTERCOM","Index Setting Pointer Knob","KNEEBOARD","Kneeboard, ON/OFF","Landing Gear Alternate Release Handle, Pull and Hold","Landing Gear And Flap Warning Silence Button","Landing Gear Downlock Override Button - Push and hold to override locking solenoid","Left Engine Start Button - Push to start","Left Landing Gear Lamp - Press to test(LMB)","MODE 4 REPLY Light - Press to test(LMB)","Master Caution Button - Push to reset","Missile Uncage Switch - Press and hold to uncage missile seeker head","Missile Volume Knob - Rotate to adjust volume","Nose Landing Gear Lamp - Press to test(LMB)","Nosewheel Steering Button - Press and Hold to engage nosewheel control","PRT-LVR-RDR-DSP-CUR-67","PTR-AIR-VLV-L1-719","PTR-AIR-VLV-L2-720","PTR-ANARC164-LOAD-314","PTR-ANARC164-T-TONE-310","PTR-ANARC164-VOLUME-309","PTR-ARM-LG-EMERG-95","PTR-BTN-ARREST-HOOK-89","PTR-BTN-CMD-CHF-RESET-403","PTR-BTN-CMD-FLR-RESET-407","PTR-BTN-FSTERECT-166","PTR-BTN-LG-DWNLOCK-88","PTR-BTN-LG-L-92","PTR-BTN-LG-L-93","PTR-BTN-LG-L-94","PTR-BTN-LG-WARN-87","PTR-BTN-LVP-EMER-JETT-365","PTR-BTN-LVP-ENG-START-L-357","PTR-BTN-LVP-ENG-START-R-358","PTR-BTN-LVP-SEL-JETT-366","PTR-BTN-MASTER-CAUTION-172","PTR-BTN-PANIFF-REPLY-215","PTR-BTN-PANIFF-TEST-217","PTR-BTN-RCP-ASQ-317","PTR-BTN-SGT-RUN-79","PTR-CMSC-LVR-BRT-140","PTR-LVR-ACC-RESET-904","PTR-LVR-ADI-TRIM-150","PTR-LVR-AIRSPD-SET-180","PTR-LVR-ALT-SET-62","PTR-LVR-CAMERA-MODE-82","PTR-LVR-HSI-CRS-272","PTR-LVR-HSI-HDG-271","PTR-LVR-LCP-CON-224","PTR-LVR-LCP-ENG-223","PTR-LVR-LCP-FLOOD-221","PTR-LVR-LCP-FORM-228","PTR-LVR-LCP-NAV-227","PTR-LVR-LVP-ARM-LGT-363","PTR-LVR-LVP-MISSILE-VOL-345","PTR-LVR-RCP-ANT-ELEV-321","PTR-LVR-RDR-DSP-BRT-70","PTR-LVR-RDR-DSP-PER-69","PTR-LVR-RDR-DSP-PITCH-66","PTR-LVR-RDR-DSP-SCL-65","PTR-LVR-RDR-DSP-VID-68","PTR-LVR-RVP-CPT-DEFOG-374","PTR-LVR-RVP-CPT-TEMP-373","PTR-LVR-SACP-TRIM-324","PTR-LVR-SGT-RET-DPR-42","PTR-LVR-SGT-RET-INT-41","PTR-LVR-WATCH-ELPS-512","PTR-MAP-CASE-252","PTR-RWR-BTN-ACTPWR-573","PTR-RWR-BTN-ALT-561","PTR-RWR-BTN-HNDOFF-556","PTR-RWR-BTN-LAUNCH-559","PTR-RWR-BTN-MODE-551","PTR-RWR-BTN-SEARCH-554","PTR-RWR-BTN-SHIP-570","PTR-RWR-BTN-SYSTST-567","PTR-RWR-BTN-T-564","PTR-RWR-LVR-AUDIO-577","PTR-RWR-LVR-DIM-578","PTR-STICK-BTN-NOSE-131","PTR-STICK-BTN-PTCH-132","PTR-STICK-BTN-WPN-128","PTR-STICK-TRIM-DN-125","PTR-STICK-TRIM-L-125","PTR-STICK-TRIM-R-125","PTR-STICK-TRIM-UP-125","PTR-TACAN-CHANNEL-SELECTOR-1-256","PTR-TACAN-TEST-259","PTR-TACAN-VOL-261","PTR-TRTL-CHFF-117","PTR-TRTL-MIC-135","PTR-TRTL-MSSL-136","PTR-TRTL-SGHT-137","PTRLVR-LCP-FLT-222","Pitch Damper Cutoff Switch - Push to cutoff","RWR Indicator Control ACT/PWR Button","RWR Indicator Control ALTITUDE Button","RWR Indicator Control AUDIO Knob - Rotate to adjust volume","RWR Indicator Control DIM Knob - Rotate to adjust brightness","RWR Indicator Control HANDOFF Button","RWR Indicator Control LAUNCH Button","RWR Indicator Control MODE Button","RWR Indicator Control SEARCH Button","RWR Indicator Control SYS TEST Button","RWR Indicator Control T Button","RWR Indicator Control UNKNOWN SHIP Button","RWR Indicator INT Knob - Rotate to adjust brightness","Radiation TEST and Monitor Light - Press to test(LMB)","Right Engine Start Button - Push to start","Right Landing Gear Lamp - Press to test(LMB)","Rudder Trim Knob","Select Jettison Button - Push to jettison","Sight Camera Lens f-Stop Selector, 2.8(dull)..22(bright)","Sight Camera Run (Test) Switch, ON/OFF","TACAN Channel Selector (Tens) - Rotate mouse wheel to select","TACAN Signal Volume Knob","TACAN Signal on HSI Test Button","Trimmer Switch, LEFT WING DOWN","Trimmer Switch, PULL(CLIMB)","Trimmer Switch, PUSH(DESCEND)","Trimmer Switch, RIGHT WING DOWN","Weapon Release Button - Press to release"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"F-86","rows":[86,1,8,403,2,36,3,1,0,445,86,1,8,403,2,36,0,1,0,445,22,20,8,630,10,507,34,1,0,532,22,20,12,611,10,512,34,1,467,531,22,20,40,424,2,167,33,1,58,449,22,20,40,424,2,167,19,1,58,449,22,20,44,443,2,166,461,1,0,450,22,20,44,443,2,166,28,1,0,450,22,20,54,607,10,508,34,1,0,627,22,20,63,552,10,509,34,3,0,549,22,20,48,432,2,135,15,3,0,227,22,20,48,432,2,135,9,3,0,227,22,20,41,437,10,178,0,463,468,228,22,20,64,437,2,178,0,1,0,228,22,20,75,610,5,476,0,1,0,528,22,20,65,360,10,97,0,3,0,229,22,20,65,360,2,97,0,0,0,229,22,20,76,605,5,473,0,1,0,530,533,470,8,540,5,469,0,1,0,539,14,13,8,311,2,141,15,3,0,307,14,13,8,311,2,141,9,3,0,307,14,13,11,312,2,142,15,3,0,308,14,13,11,312,2,142,9,3,0,308,14,13,12,413,2,138,15,3,0,414,14,13,12,413,2,138,9,3,0,414,14,13,21,558,10,513,1,1,0,557,14,13,24,309,2,172,33,1,28,306,14,13,24,309,2,172,19,1,28,306,14,13,32,310,2,171,3,1,0,305,14,13,32,310,2,171,0,1,0,305,14,13,39,246,2,137,3,3,0,334,14,13,39,246,2,137,0,3,0,334,14,13,25,251,2,174,3,3,0,250,14,13,25,251,2,174,0,3,0,250,14,13,37,629,5,498,0,1,0,628,14,13,56,453,2,92,1,1,0,452,14,13,56,453,2,92,0,1,0,452,538,475,8,606,10,506,34,1,0,529,31,29,8,374,2,221,33,1,59,234,31,29,8,374,2,221,19,1,59,234,31,29,11,375,2,150,3,3,0,235,31,29,11,375,2,150,0,3,0,235,31,29,12,376,2,151,15,3,0,236,31,29,12,376,2,151,9,3,0,236,31,29,21,371,5,220,0,1,3,232,31,29,21,371,5,220,0,1,3,232,31,29,24,372,2,219,3,1,0,231,31,29,24,372,2,219,0,1,0,231,31,29,30,373,2,93,3,1,0,233,31,29,30,373,2,93,0,1,0,233,50,47,8,448,2,218,458,1,88,239,50,47,8,448,2,218,464,1,88,239,50,47,11,625,10,517,89,19,60,534,50,47,12,447,2,217,33,1,27,238,50,47,12,447,2,217,19,1,27,238,50,47,21,590,5,477,0,1,0,589,26,23,8,393,2,157,33,1,59,242,26,23,8,393,2,157,19,1,59,242,26,23,11,259,2,216,33,1,27,241,26,23,11,259,2,216,19,1,27,241,26,23,12,615,10,515,27,1,0,537,26,23,21,626,10,516,89,19,60,535,26,23,24,392,5,156,3,3,1,243,26,23,24,392,5,156,0,1,0,243,26,23,32,417,2,149,3,1,0,240,26,23,32,417,2,149,0,1,0,240,26,23,39,418,2,148,3,3,0,245,26,23,39,418,2,148,0,3,0,245,26,23,25,608,10,524,34,1,0,536,248,102,8,601,5,505,0,1,0,578,248,102,11,600,10,471,69,1,0,579,546,500,8,545,10,479,1,1,0,544,67,61,11,80,5,100,0,1,0,85,67,61,11,80,5,100,0,1,0,85,67,61,12,80,10,483,465,1,0,85,67,61,21,556,5,525,0,1,0,567,38,35,8,313,5,165,0,1,0,266,38,35,8,313,2,165,3,3,1,266,38,35,25,330,2,224,0,1,0,325,38,35,37,267,2,223,1,1,0,264,38,35,37,267,2,223,0,1,0,264,38,35,30,268,2,222,1,1,0,265,38,35,30,268,2,222,0,1,0,265,38,35,41,329,2,99,462,1,70,324,38,35,41,329,2,99,70,1,70,324,38,35,55,330,2,224,1,1,0,325,17,16,8,457,2,170,3,3,0,456,17,16,8,457,2,170,0,3,0,456,17,16,21,622,5,95,3,3,1,591,17,16,24,623,5,95,0,1,0,594,17,16,32,621,5,94,0,1,0,593,17,16,39,624,5,94,3,3,1,592,17,16,25,82,5,78,27,1,27,81,17,16,25,82,5,78,28,1,28,81,17,16,25,82,10,78,19,1,19,81,17,16,37,84,5,79,27,1,27,83,17,16,37,84,5,79,28,1,28,83,17,16,37,84,10,79,19,1,19,83,17,16,30,431,5,140,3,3,1,430,17,16,30,431,5,140,0,1,0,430,17,16,40,402,2,173,3,1,0,401,17,16,40,402,2,173,0,1,0,401,17,16,44,617,5,493,0,1,0,616,4,0,8,257,5,144,3,3,1,260,4,0,8,257,2,144,0,1,0,260,4,0,11,377,2,136,15,3,0,378,4,0,11,377,2,136,9,3,0,378,4,0,12,612,5,489,0,1,0,613,4,0,21,337,2,143,15,3,0,336,4,0,21,337,2,143,9,3,0,336,4,0,24,358,5,159,3,3,1,357,4,0,24,358,2,159,0,1,0,357,4,0,32,359,2,160,3,1,0,356,4,0,32,359,2,160,0,1,0,356,4,0,39,572,5,497,0,1,0,571,4,0,25,586,5,490,0,1,0,584,4,0,37,555,5,491,0,1,0,554,4,0,30,587,5,492,0,1,0,585,4,0,40,269,2,179,3,1,0,261,4,0,40,269,2,179,0,1,0,261,4,0,44,270,2,180,3,1,0,262,4,0,44,270,2,180,0,1,0,262,4,0,54,271,2,181,3,1,0,368,4,0,54,271,2,181,0,1,0,368,4,0,48,272,2,182,3,1,0,122,4,0,48,272,2,182,0,1,0,122,4,0,41,273,2,183,3,1,0,446,4,0,41,273,2,183,0,1,0,446,4,0,64,274,2,184,3,1,0,429,4,0,64,274,2,184,0,1,0,429,4,0,55,275,2,185,3,1,0,252,4,0,55,275,2,185,0,1,0,252,4,0,56,276,2,186,3,1,0,249,4,0,56,276,2,186,0,1,0,249,4,0,71,277,2,187,3,1,0,390,4,0,71,277,2,187,0,1,0,390,4,0,72,278,2,188,3,1,0,391,4,0,72,278,2,188,0,1,0,391,4,0,73,279,2,189,3,1,0,340,4,0,73,279,2,189,0,1,0,340,4,0,74,280,2,190,3,1,0,263,4,0,74,280,2,190,0,1,0,263,4,0,75,281,2,191,3,1,0,438,4,0,75,281,2,191,0,1,0,438,4,0,65,282,2,192,3,1,0,344,4,0,65,282,2,192,0,1,0,344,4,0,76,283,2,193,3,1,0,389,4,0,76,283,2,193,0,1,0,389,4,0,103,284,2,194,3,1,0,387,4,0,103,284,2,194,0,1,0,387,4,0,104,285,2,195,3,1,0,388,4,0,104,285,2,195,0,1,0,388,4,0,105,286,2,196,3,1,0,346,4,0,105,286,2,196,0,1,0,346,4,0,106,287,2,197,3,1,0,253,4,0,106,287,2,197,0,1,0,253,4,0,107,288,2,198,3,1,0,436,4,0,107,288,2,198,0,1,0,436,4,0,108,289,2,199,3,1,0,435,4,0,108,289,2,199,0,1,0,435,4,0,109,290,2,200,3,1,0,433,4,0,109,290,2,200,0,1,0,433,4,0,110,291,2,201,3,1,0,244,4,0,110,291,2,201,0,1,0,244,4,0,111,292,2,202,3,1,0,333,4,0,111,292,2,202,0,1,0,333,4,0,112,293,2,203,3,1,0,332,4,0,112,293,2,203,0,1,0,332,4,0,113,294,2,204,3,1,0,349,4,0,113,294,2,204,0,1,0,349,4,0,114,295,2,205,3,1,0,379,4,0,114,295,2,205,0,1,0,379,4,0,115,296,2,206,3,1,0,400,4,0,115,296,2,206,0,1,0,400,4,0,116,297,2,207,3,1,0,316,4,0,116,297,2,207,0,1,0,316,4,0,117,298,2,208,3,1,0,345,4,0,117,298,2,208,0,1,0,345,4,0,118,299,2,209,3,1,0,454,4,0,118,299,2,209,0,1,0,454,4,0,119,300,2,210,3,1,0,455,4,0,119,300,2,210,0,1,0,455,4,0,120,301,2,211,3,1,0,399,4,0,120,301,2,211,0,1,0,399,4,0,121,302,2,212,3,1,0,434,4,0,121,302,2,212,0,1,0,434,4,0,77,303,2,213,3,1,0,230,4,0,77,303,2,213,0,1,0,230,4,0,66,304,2,214,3,1,0,237,4,0,66,304,2,214,0,1,0,237,51,49,8,327,2,169,3,3,1,322,51,49,8,327,2,169,0,3,1,322,51,49,11,328,2,168,3,1,0,321,51,49,11,328,2,168,0,1,0,321,51,49,12,326,2,124,15,3,0,323,51,49,12,326,2,124,9,3,0,323,68,62,8,341,2,129,3,1,0,335,68,62,8,341,2,129,0,1,0,335,68,62,11,569,5,495,0,1,0,570,68,62,12,568,5,496,0,1,0,541,42,36,8,350,2,161,15,3,0,348,42,36,8,350,2,161,9,3,0,348,42,36,11,351,2,162,3,1,0,347,42,36,11,351,2,162,0,1,0,347,42,36,12,380,2,153,33,1,69,320,42,36,12,380,2,153,19,1,69,320,42,36,21,614,5,501,0,1,0,565,42,36,24,618,5,499,0,1,0,597,354,91,8,563,10,1,34,1,0,559,354,91,12,564,5,488,0,1,0,562,18,9,8,397,2,123,1,1,0,396,18,9,8,397,2,123,0,1,0,396,18,9,11,566,5,504,0,1,0,580,18,9,12,343,5,139,3,3,1,342,18,9,12,343,2,139,0,1,0,342,18,9,21,370,2,125,3,3,0,369,18,9,21,370,2,125,0,3,0,369,18,9,24,440,2,98,3,3,0,439,18,9,24,440,2,98,0,3,0,439,18,9,39,543,5,494,0,1,0,542,18,9,25,255,2,164,3,1,0,254,18,9,25,255,2,164,0,1,0,254,18,9,37,573,5,521,0,1,0,581,18,9,30,398,2,225,1,1,0,395,18,9,30,398,2,225,0,1,0,395,18,9,63,603,5,478,0,1,0,602,18,9,41,596,5,474,0,1,0,595,57,53,8,561,10,519,1,1,0,560,57,53,11,577,10,520,1,1,0,575,57,53,12,576,10,518,1,1,0,574,57,53,21,315,2,145,15,3,0,314,57,53,21,315,2,145,9,3,0,314,52,46,8,442,2,152,3,3,0,394,52,46,8,442,2,152,0,3,0,394,52,46,11,415,2,147,3,3,0,416,52,46,11,415,2,147,0,3,0,416,52,46,12,338,2,146,15,3,0,339,52,46,12,338,2,146,9,3,0,339,45,43,8,409,2,163,3,1,0,410,45,43,8,409,2,163,0,1,0,410,45,43,11,604,10,503,1,1,0,598,45,43,32,451,2,101,3,1,0,412,45,43,32,451,2,101,0,1,0,412,45,43,25,331,10,480,0,3,0,411,45,43,30,331,5,484,0,1,0,411,7,6,8,367,2,158,33,87,58,362,7,6,8,367,2,158,19,87,58,362,7,6,11,404,2,155,33,1,27,364,7,6,11,404,2,155,19,1,27,364,7,6,12,365,5,130,3,3,1,361,7,6,12,365,2,130,0,1,0,361,7,6,21,258,2,154,15,3,0,407,7,6,21,258,2,154,9,3,0,407,7,6,24,599,10,514,34,1,0,588,7,6,32,256,2,133,15,3,0,318,7,6,32,256,2,133,9,3,0,318,7,6,39,247,2,134,3,3,0,317,7,6,39,247,2,134,0,3,0,317,7,6,25,441,2,177,33,1,28,319,7,6,25,441,2,177,19,1,28,319,7,6,37,427,2,176,3,3,0,423,7,6,37,427,2,176,0,3,0,423,7,6,30,428,2,175,3,1,0,422,7,6,30,428,2,175,0,1,0,422,7,6,40,352,2,132,3,3,0,419,7,6,40,352,2,132,0,3,0,419,7,6,44,426,2,131,15,3,0,421,7,6,44,426,2,131,9,3,0,421,7,6,54,384,2,126,15,3,0,382,7,6,54,384,2,126,9,3,0,382,7,6,63,385,2,127,15,3,0,383,7,6,63,385,2,127,9,3,0,383,7,6,48,386,2,128,15,3,0,381,7,6,48,386,2,128,9,3,0,381,7,6,41,444,2,215,460,1,60,406,7,6,41,444,2,215,27,1,60,406,7,6,64,551,5,502,0,1,0,548,7,6,55,405,2,226,3,3,0,408,7,6,55,405,2,226,0,3,0,408,7,6,56,583,10,522,0,1,0,620,7,6,71,582,5,523,0,1,0,609,7,6,72,619,10,510,34,1,0,527,7,6,485,553,10,511,34,1,0,526,7,6,73,425,2,90,459,1,0,420,7,6,74,425,2,90,466,1,0,420,7,6,77,550,5,472,0,1,0,547,7,6,66,366,5,96,28,1,28,363,7,6,66,366,5,96,0,1,0,363,7,6,486,355,5,481,0,1,0,353,7,6,487,355,10,482,0,1,28,353],"strings":["1","0","TUMB","-1","ELEC_INTERFACE","BTN","5","WEAPON_SYSTEM","3001","2","LEV","3002","3003","16","AIR_INTERFACE","-2","13","CONTROL_INTERFACE","HYDRO_INTERFACE","0.1","22","3004","A4_GUNSIGHT","27","3005","3008","AN_ARN_6_RADIO_COMPASS","0.3","0.5","29","3010","AN_APX6_IFF","3006","-0.1","0.0215","25","3","3009","COCKPIT_MECHANICS","3007","3011","3016","FUEL_INTERFACE","14","3012","OXYGEN_INTERFACE","18","26","3015","4","AN_ARC_27_COMMAND_SET","ENGINE_INTERFACE","NAV_LIGHTS_INTERFACE","17","3013","3018","3019","LIGHT_INTERFACE","0.2","0.4","0.9","10","15","3014","3017","3026","3048","CLOCK","FIRE_DETECTION_INTERFACE","0.6","0.83","3020","3021","3023","3024","3025","3027","3047","649","739","Clock_button_1","Lateral Alternate Trim Switch - Left mouse button for LEFT/OFF, Right mouse button for RIGHT/OFF, Mouse wheel for NORMAL/OFF","Lateral_Alternate_Trim_Switch","Longitudinal Alternate Trim Switch - Mouse wheel for NORMAL GRIP CONT/OFF, Left mouse button for NOSE UP/OFF, Right mouse button for NOSE DOWN/OFF","Longitudinal_Alternate_Trim_Switch","Set Clock Knob","","-0.2","0.18","0.8","1001","20","202","203","204","205","206","210","211","220","227","230","24","3028","3029","3030","3031","3032","3033","3034","3035","3036","3037","3038","3039","3040","3041","3042","3043","3044","3045","3046","3f Inverter","599","630","631","632","633","634","635","636","637","638","639","641","642","643","645","646","647","648","650","651","652","653","654","655","656","657","658","659","660","661","662","663","665","666","667","668","670","671","672","673","703","706","718","720","721","732","733","735","736","737","738","741","750","751","752","755","760","761","762","763","764","765","766","767","768","769","770","771","772","773","774","775","776","777","778","779","780","781","782","783","784","785","786","787","788","789","790","791","792","793","794","795","796","803","805","807","808","809","810","816","817","818","819","820","A-4 Sight Filament Selector Switch, SECONDARY/PRIMARY","A-4 Sight Mechanical Caging Lever, CAGE/UNCAGE","A-4 Sight Rotating Grip - Mouse Wheel for manual ranging, Right Click for return to CCW spring-loaded position","AN/APC 3 Radio","AN/APX-6 IFF Destruct Switch Cover","AN/APX-6 IFF Destruct Switch, OFF/ON","AN/APX-6 IFF Dial Stop Button","AN/APX-6 IFF Master Switch, EMERGENCY/NORM/LOW/STDBY/OFF","AN/APX-6 IFF Mode 2 Switch, MODE 2/OUT/I/P","AN/APX-6 IFF Mode 3 Switch, MODE 3/OUT","AN/APX-6 Radio IFF","AN/ARC-27 UHF Power Switch, OFF/T/R/T/R + G REC/ADF","AN/ARC-27 UHF Preset Channel Selector","AN/ARN-6 CW-VOICE Switch, CW/VOICE","AN/ARN-6 Frequency Band Switch","AN/ARN-6 Function Selector Switch, OFF/COMP/ANT./LOOP/CONT.","AN/ARN-6 LOOP L-R Switch","AN/ARN-6 Radio Compass","AN/ARN-6 Scale Light Switch, HI/OFF/LO","ANTI-ICE_Switch","ARM_SWITCH","ATTITUDE_INDICATOR","Ail & Horiz. Trim & Alt Horiz. Trim","Air Outlet Selector Lever, FLOOR/BOTH/DEFROST","Air_Outlet_Selector_Lever","Alt Ail. Trim","Alt Emerg. Hyd. Cont. & Hyd. Press Ind.","Alternate Hydraulic Emergency Override Handle, IN/OUT","Alternate_Hydraulic_Override_Switch","Auto_Release_Switch","BATTERY-STARTER_SWITCH","BOMB_NORMAL_Switch","Bandswitch","Battery-Starter Switch, BATTERY/OFF/STARTER","Bomb Rocket Tank Salvo","Bomb Sel.","Bus Tie-In Control","Canopy Alternate Emergency Jettison Handle, IN/OUT","Canopy Declutch Handle, IN/OUT","Canopy Switch, OPEN/OFF/CLOSE","Canopy_Alternate_Emergency_Jettison_Handle","Canopy_declutch_handle","Circuit_Breaker_LP_001","Circuit_Breaker_LP_002","Circuit_Breaker_LP_003","Circuit_Breaker_LP_004","Circuit_Breaker_LP_005","Circuit_Breaker_LP_006","Circuit_Breaker_LP_007","Circuit_Breaker_LP_008","Circuit_Breaker_LP_009","Circuit_Breaker_LP_010","Circuit_Breaker_LP_011","Circuit_Breaker_LP_012","Circuit_Breaker_LP_013","Circuit_Breaker_LP_014","Circuit_Breaker_LP_015","Circuit_Breaker_LP_016","Circuit_Breaker_LP_017","Circuit_Breaker_LP_018","Circuit_Breaker_LP_019","Circuit_Breaker_LP_020","Circuit_Breaker_LP_021","Circuit_Breaker_LP_022","Circuit_Breaker_LP_023","Circuit_Breaker_RP_001","Circuit_Breaker_RP_002","Circuit_Breaker_RP_003","Circuit_Breaker_RP_004","Circuit_Breaker_RP_005","Circuit_Breaker_RP_006","Circuit_Breaker_RP_007","Circuit_Breaker_RP_008","Circuit_Breaker_RP_009","Circuit_Breaker_RP_010","Circuit_Breaker_RP_011","Circuit_Breaker_RP_012","Circuit_Breaker_RP_013","Cockpit Air Temperature Control Switch Cover","Cockpit Air Temperature Control Switch, AUTO/OFF/HOT/COLD","Cockpit Pressure Control Switch, PRESS/RAM","Cockpit Pressure Schedule Selector Switch, 5 PSI/2.75 PSI","Cockpit_Air_Temperature_Control_Switch","Cockpit_Air_Temperature_Control_Switch_Cover","Cockpit_Pressure_Control_Switch","Cockpit_Pressure_Schedule_Selector_Switch","Cockpit_Switch_ON-OFF","Compass Light Switch, ON/OFF","Compass_Switch","Console & Ped LTS","Demolition Bomb Arming Switch (Fuze Selection), ARM NOSE&TAIL/OFF/TAIL ONLY","Demolition Bomb Release Selector Switch, AUTO RELEASE/MANUAL RELEASE","Demolition Bomb Sequence Selector Switch, ALL/OFF/LEFT/RIGHT","Drop Tank Selector Switch","Emergency (In-air) Ignition Switch Cover","Emergency (In-air) Ignition Switch, ON/OFF","Emergency Fuel Switch, ON/OFF","Emergency Jettison Handle Cover, OPEN/CLOSE","Emergency Jettison Handle, IN/RELEASE ALL(LMB)/RELEASE OUTBD ONLY(RMB)","Emergency_Fuel_Switch","Emergency_Ingition_Switch","Emergency_Ingition_Switch_Cover","Emergency_Jettison_Cover","Emergency_Jettison_Handle","Emergency_Test","Eng. Ign.","Eng. Master Fuel Shut-Off","Engine Anti-Ice & Screen Switch, EXTEND/RET./ANTI-ICE","Engine Fire Warning Light Test Switch","Engine Master Switch, ON/OFF","Engine_Master_Switch","Ext. Ltng. Bright Switch","Exterior Lighting Dimmer Switch, BRIGHT/DIM","Fire Warn.","Fire-Warning Light Test Button","Flight Control Switch, ALTERNATE ON/NORMAL/RESET","Flight_Control_Switch","Free Air & Oil Temp & Air Sel.","Fuel Boost FWD","Fuel Booster AFT","Fuel Densitometer Selection Switch Cover","Fuel Densitometer Selection Switch, IN/OUT","Fuel Level","Fuel_density_correction_Switch","Fuel_density_correction_Switch_Cover","Fuze_Delay_Switch","G-Limit Light - Push to test(LMB), Rotate to adjust brightness(MW)","GYROMAG_COMPASS","G_LIMIT","Generator Switch Cover","Generator Switch, ON/OFF/RESET","Generator_Switch","Generator_Switch_Cover","Grip_Rotation","Gun Heater Switch, HEATER/OFF/(N/F)","Gun Selector Switch","Gun Trigger, SECOND DETENT(LMB)/FIRST DETENT(RMB)","Gun-Missile Selector Switch, OFF/SIGHT CAMERA & RADAR/GUNS/MISSILE","Gun_Heater_Switch","Gun_Trigger","Guns_Selector","Gyr'Syn Compass","Hydraulic Pressure Gage and Selector Switch, UTILITY/NORMAL/ALTERNATE","Hydraulic_Pressure_Gage_Selector_Switch","IFF_Destruct_Switch","IFF_Destruct_Switch_Cover","IFF_Dial_Stop_Button","IFF_Master_Mode_Selector_Knob","IFF_PANEL_MODE2","IFF_PANEL_MODE3","INSTRUMENT_POWER_ALTERNATE","Instrument Power Switch, ALTERNATE/NORMAL","Inv Gen. Failure Overvolt LTS Test","JETT_SELECTOR","LABS Change-over Switch, LABS/A-4","LABS Gyro Caging Switch, UNCAGE/CAGE","LABS Start Switch, ON/OFF","LABS_Selector_Switch_1","LABS_Selector_Switch_2","LABS_Selector_Switch_3","LDG Gear Control","LDG Gear Pos Ind.","LDG Gear Warn.","LDG Light Control","LDG Lights","LOOP L-R_Switch","LOOP-ANT-COMP-OFF_Switch","Landing & Taxi Lights Switch, EXTEND&ON/OFF/RETRACT","Landing Gear Emergency Release Handle","Landing Gear Handle, UP/DOWN","Landing_Gear_Handle","Landing_gear_emergency_release_handle","Light Fluor","Light Post IndCode","Longitudinal Alternate Trim Switch Cover","Longitudinal_Alternate_Trim_Switch_Cover","MIRRORS","MISSILE_GUNS_RADAR-Selector","MISSILE_Switch_LH-RH-SALVO","Manual Pip Control Change Calibrated Dials (Presets)","Manual Pip Control Switch, BOMB/NORMAL","Missile Control Switch, LH & RH/RH/SALVO","OXYGEN_SWITCH","Oxygen Regulator Diluter Lever, NORMAL OXYGEN/100% OXYGEN","Oxygen Regulator Emergency Lever","Oxygen Regulator Warning Light Switch, ON/OFF","PITOT_Switch","Pitot Heater Switch, ON/OFF","Pos. Lt. Steady_Switch","Position and Fuselage Light Selector Switch, STEADY/OFF/FLASH","RADIO_COMPASS_PANEL_CW / VOICE","RADIO_COMPASS_PANEL_LIGHTS","Rocket Fuze (Arming) Switch, DELAY/OFF/INSTANT","Rocket Intervalometer","Rocket Jettison Switch, READY/OFF","Rocket Release Selector Switch Cover","Rocket Release Selector Switch, SINGLE/OFF/AUTO","Rocket-Gun-Bomb_selector","Rocket_Intervalometer","Rockets_Jett_Switch","Rockets_switch","Rockets_switch_cover","Rudder Trim & Take-Off Ind.","Rudder Trim Switch, LEFT/OFF/RIGHT","Rudder_Trim_Switch","SIGHT_FILAMENT_SWITCH","Sight A.C. Power Unit","Sight Control","Sight Heater","Sight Power","Sight_mechanical_caging_lever","Speed Brake","Speed Brake Switch, OUT/HOLD/IN","Speed_Brake_Switch","Station_selector_switch","TMB-TAXILGT_Switch","Target_speed_switch","Templates_rotation_helper","Toggle Mirrors","Turn Bank Ind.","UHF_Power_Switch","UHF_Preset_Channel_Selector","Variable Sight Selector Unit - Sight Function Selector Lever, ROCKET/GUN/BOMB","Variable Sight Selector Unit - Target Speed Switch, TR/HI/LO","Warning_System_Off","Windshield Anti-Icing Lever, ON/OFF","Windshield_Anti-icing_Lever","Wing Flap LH.","Wing Flap RH.","Wing Flaps Handle","Wing_Flap_Lever","-0.01","-0.0625","-0.3","-0.5","-0.83","0.001","0.01","0.04","0.0625","0.74","0.999","1004","12","200","207","208","209","21","212","213","217","218","223","225","226","228","229","3022","3053","3054","598","664","680","681","682","683","684","685","686","687","691","695","7","701","702","704","710","714","715","716","722","727","729","731","734","740","797","801","802","806","811","812","813","815","821","822","826","831","A-4 Sight Bombing Altimeter Index Altitude Handle","A-4 Sight Bombing Altimeter Target Altitude Knob","A-4 Sight Electrical Caging Button","A-4 Sight Radar Range Sweep Rheostat","A-4 Sight Radar Target Selector Button","A-4 Sight Reticle Dimmer Control","A-4 Sight Wing Span Adjustment Knob","ACCELEROMETER","AN/ARC-27 UHF Audio Volume Knob","AN/ARN-6 Audio Volume Control","AN/ARN-6 East/West Variation Knob","AN/ARN-6 Tuning Crank","AN_APG_30","Accelerometer Reset Button - Push to reset","Accelerometer_button","Aft Engine Compartment Fire-warning Light (Push to test)","Alternate-on Warning Light (Push to test)","Alternate-on_Warning_Light","Altimeter reference pressure adjusting knob","Altimeter_Pressure","BARO_ALTIMETER","Bomb-Rocket Release Button - Push to release","Bomb-Rocket-Tank Jettison Button","Bomb-Target Wind Control Knob","Bomb_Rocket_Release_Button","Bomb_Rocket_Tank Jettison Button","Bomb_wind_control","Bombing_Altimeter_Handler1","Both Instrument (Main and alternate three-phase) Inverter Failure Warning Light (Push to test)","Both_Instrument_Failure_Warning_Light","Clock_button_2","Cockpit Air Temperature Control Rheostat","Cockpit_Air_Temperature_Control_Rheostat","Compass Correction","Console and Panel Light Rheostat","Console_Panel_Light_Control","Directional Indicator Fast Slaving Button - Push for fast slaving","Directional_Indicator","Directional_Indicator_Fast_Slaving_Switch","Drop Tank Jettison Button - Push to release drop tank(s)","EMERG_UP","Elapsed Time Mechanism Button","Fire-Warning_AFT_Light","Fire-Warning_FWD_Light","Forward Engine Compartment Fire-warning Light (Push to test)","Generator Warning Light (Push To Test)","Generator_Warning_Light","Horn_Cutout_Button","Instrument Panel Auxiliary Light Rheostat","Instrument Panel Primary Light Rheostat","Instrument_Panel_Auxiliary_Light_Control","Instrument_Panel_Primary_Light_Control","J-8 Attitude Indicator Cage Knob - Pull to cage","J-8 Attitude Indicator Pitch Trim Knob","Landing Gear Emergency-up Button (Ground-use only! Hold in until gear retracts completely)","Landing Gear Warning Horn Cutout Button (Push to silence horn)","MISSILE_PANEL_SAFE_LAUNCH","MISSILE_PANEL_TONE_VOLUME","Main Instrument (Three-phase) Inverter Failure Warning Light (Push to test)","Main Radar (Single-phase) Inverter Failure Warning Light (Push to test)","Main_Instrument_Failure_Warning_Light","Main_Radar_Failure_Warning_Light","Manual Pip Control Knob","Microphone Button","Microphone_Button","Normal Trim Switch, LEFT/OFF","Normal Trim Switch, NOSE DOWN/OFF","Normal Trim Switch, NOSE UP/OFF","Normal Trim Switch, RIGHT/OFF","Nose Wheel Steering Button","Nose_Wheel_Steering_Button","Outboard Drop Tank Empty Indicator Light (Push to test)","Oxygen Regulator Supply Lever","PIP_adjustment_knob","PITCH_ TRIM_ KNOB","PULL_TO_CAGE","Parking Brake Handle, ON/OFF","Parking_Brake","Pressure_demand_oxygen_regulator","Radar_Target_Selector_Button","Radar_range_sweep","Rocket_depression_angle_pointer","Rotating_compass_cart_Helper","Safe Launch Button","Sight_Electrical_Caging_Button","Sight_reticle_dimmer_control_knob","Stop Starter Button","Stop-Starter Button (Push to de-energize starter in case of malfunction)","TANKS_JETTISON","TUNING_CONTROL","Take-off (Trim) Position Indicator Light (Push to test)","Take-off_Position_Indicator_Light","Tanks_Empty_Warning_Light","Target_altitude_knob","Tone Volume","Trim_Switch_Down","Trim_Switch_Left","Trim_Switch_Right","Trim_Switch_Up","UHF_Volume_Knob","VOLUME_CONTROL","Variable Sight Selector Unit - Rocket Depression Angle Selector","Windshield Anti-Ice Overheat Warning Light (Push to test)","Windshield_anti-icing_overheat_Warning_Light","Wing_span_adjustment_knob"]});
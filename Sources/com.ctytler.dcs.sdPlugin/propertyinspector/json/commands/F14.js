@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"F14","rows":[62,62,1261,1610,4,1206,0,1,0,1520,62,62,1263,1609,4,1205,0,1,0,1521,1464,266,1377,1646,4,1247,0,1,0,1476,44,39,283,912,2,244,3,1,0,628,44,39,283,912,2,244,0,1,0,628,44,39,284,913,2,245,3,1,0,629,44,39,284,913,2,245,0,1,0,629,44,39,285,914,2,246,3,1,0,630,44,39,285,914,2,246,0,1,0,630,44,39,286,915,2,247,3,3,0,675,44,39,286,915,2,247,0,3,0,675,44,39,287,917,2,249,3,1,0,672,44,39,287,917,2,249,0,1,0,672,44,39,288,918,2,250,3,3,0,674,44,39,288,918,2,250,0,3,0,674,44,39,289,919,2,251,73,3,0,673,44,39,289,919,2,251,16,3,0,673,71,63,1341,1010,4,1216,0,1,0,686,71,63,1342,1010,8,1455,0,3,0,686,71,63,455,1011,2,587,3,3,0,687,71,63,455,1011,2,587,0,3,0,687,71,63,456,1012,2,588,3,1,0,688,71,63,456,1012,2,588,0,1,0,688,71,63,1343,1690,8,1456,1,1,0,1509,92,80,273,906,2,238,3,1,0,1084,92,80,273,906,2,238,0,1,0,1084,92,80,274,907,2,239,3,1,0,1085,92,80,274,907,2,239,0,1,0,1085,93,81,369,1020,2,595,3,1,0,734,93,81,369,1020,2,595,0,1,0,734,93,81,370,1022,2,169,64,1,0,666,93,81,370,1022,2,169,65,1,0,666,23,20,1321,1556,8,1154,0,1,0,1109,23,20,1322,1741,4,1203,0,1,0,1110,23,20,1323,1672,8,1441,0,1,0,1109,23,20,1324,1671,4,1440,0,1,0,1110,23,20,1327,1631,8,1233,1,1,0,1739,23,20,1328,1664,8,1433,1,1,0,1740,23,20,1329,1629,8,1231,1,1,0,1735,23,20,427,891,2,224,3,1,0,1108,23,20,427,891,2,224,0,1,0,1108,23,20,428,886,2,219,3,3,1,1103,23,20,428,886,2,219,0,0,1,1103,23,20,429,884,2,217,3,3,1,1104,23,20,429,884,2,217,0,0,1,1104,23,20,430,883,2,216,3,3,1,1102,23,20,430,883,2,216,0,0,1,1102,23,20,431,882,2,215,3,3,1,1101,23,20,431,882,2,215,0,0,1,1101,23,20,432,890,2,223,1140,1,86,1106,23,20,432,890,2,223,1149,1,86,1106,23,20,433,888,2,221,119,1,85,1107,23,20,433,888,2,221,122,1,85,1107,23,20,434,889,2,222,51,1,0,1105,23,20,434,889,2,222,18,1,0,1105,23,20,1330,1688,4,1453,0,1,0,1737,23,20,1331,1611,4,1213,0,1,0,1736,23,20,1332,1612,4,1214,0,1,0,1738,29,28,1325,1555,8,1153,0,1,0,1747,29,28,1326,1749,4,1202,0,1,0,1748,29,28,1337,1658,8,1382,1,1,0,1746,29,28,1338,1633,8,1235,1,1,0,1745,29,28,1339,1659,8,1413,1,1,0,1744,29,28,440,942,2,473,3,1,0,1123,29,28,440,942,2,473,0,1,0,1123,29,28,441,944,2,478,3,3,1,1117,29,28,441,944,2,478,0,0,1,1117,29,28,442,945,2,479,3,3,1,1118,29,28,442,945,2,479,0,0,1,1118,29,28,443,946,2,480,3,3,1,1116,29,28,443,946,2,480,0,0,1,1116,29,28,444,947,2,481,3,3,1,1115,29,28,444,947,2,481,0,0,1,1115,29,28,445,948,2,482,54,1,0,1121,29,28,445,948,2,482,55,1,0,1121,29,28,446,943,2,475,119,1,85,1122,29,28,446,943,2,475,122,1,85,1122,29,28,447,1056,2,476,68,1,0,1120,29,28,447,1056,2,476,69,1,0,1120,29,28,448,949,2,488,3,1,0,1119,29,28,448,949,2,488,0,1,0,1119,77,70,1376,1657,8,1262,1,1,0,663,77,70,467,935,2,307,3,3,1,94,77,70,467,935,2,307,0,0,1,94,77,70,1378,1630,8,1232,1,1,0,663,77,70,468,887,2,220,3,3,1,94,77,70,468,887,2,220,0,0,1,94,676,113,1265,1039,2,1459,1143,1,1150,788,676,113,1266,1039,2,1208,0,1,0,788,1479,260,1260,1571,4,1167,0,1,0,1544,19,17,1383,1583,4,1178,0,1,0,1494,19,17,1384,1582,4,1177,0,1,0,1496,19,17,1385,1581,4,1176,0,1,0,1497,19,17,1386,1579,4,1175,0,1,0,1498,19,17,1387,1580,4,1174,0,1,0,1499,19,17,1388,1590,4,1184,0,1,0,1500,19,17,1389,1589,4,1183,0,1,0,1501,19,17,1390,1588,4,1182,0,1,0,1502,19,17,1391,1587,4,1181,0,1,0,1503,19,17,1392,1585,4,1180,0,1,0,1495,19,17,1393,1584,4,1179,0,1,0,1493,19,17,1394,1591,4,1185,0,1,0,1489,19,17,477,1050,2,620,68,1,0,681,19,17,477,1050,2,620,69,1,0,681,19,17,1395,1606,4,1199,0,1,0,1504,19,17,1396,1605,4,1198,0,1,0,1491,19,17,1397,1604,4,1197,0,1,0,1487,19,17,1398,1607,4,1200,0,1,0,1505,19,17,1399,1602,4,1195,0,1,0,1483,19,17,1400,1594,4,1188,0,1,0,1485,19,17,1401,1595,4,1189,0,1,0,1488,19,17,1402,1599,4,1192,0,1,0,1492,19,17,1403,1601,4,1194,0,1,0,1482,19,17,1404,1603,4,1196,0,1,0,1490,19,17,1405,1593,4,1187,0,1,0,1486,19,17,1406,1596,4,1190,0,1,0,1480,19,17,1407,1598,4,1191,0,1,0,1484,19,17,1408,1600,4,1193,0,1,0,1481,95,82,1256,1568,8,1166,18,1,0,684,95,82,1257,1696,4,1168,0,1,0,683,95,82,1428,1569,8,62,18,1,0,684,95,82,1429,1570,4,1442,0,1,0,683,6,5,347,1023,2,597,3,1,0,1096,6,5,347,1023,2,597,0,1,0,1096,6,5,348,1029,2,601,3,3,0,102,6,5,348,1029,2,601,0,3,0,102,6,5,349,1026,2,599,3,3,0,111,6,5,349,1026,2,599,0,3,0,111,6,5,350,1019,2,594,3,3,0,1068,6,5,350,1019,2,594,0,3,0,1068,6,5,351,1021,2,596,3,3,0,1067,6,5,351,1021,2,596,0,3,0,1067,6,5,352,1024,2,598,3,1,0,1066,6,5,352,1024,2,598,0,1,0,1066,6,5,353,1028,2,600,3,1,0,664,6,5,353,1028,2,600,0,1,0,664,6,5,354,1018,2,168,64,1,0,627,6,5,354,1018,2,168,65,1,0,627,6,5,355,1025,2,170,64,1,0,101,6,5,355,1025,2,170,65,1,0,101,6,5,356,1027,2,171,64,1,0,97,6,5,356,1027,2,171,65,1,0,97,6,5,357,1030,2,172,64,1,0,711,6,5,357,1030,2,172,65,1,0,711,6,5,89,900,2,88,1,1,0,96,6,5,89,900,2,88,0,1,0,96,6,5,89,930,2,88,1,1,0,96,6,5,89,930,2,88,0,1,0,96,6,5,358,898,2,231,1,1,0,702,6,5,358,898,2,231,0,1,0,702,6,5,359,1057,2,545,1,1,0,98,6,5,359,1057,2,545,0,1,0,98,6,5,360,970,2,548,1,1,0,98,6,5,360,970,2,548,0,1,0,98,6,5,361,1000,2,574,3,1,0,1065,6,5,361,1000,2,574,0,1,0,1065,6,5,362,838,2,163,3,1,0,1070,6,5,362,838,2,163,0,1,0,1070,6,5,363,1043,2,613,3,1,0,682,6,5,363,1043,2,613,0,1,0,682,6,5,364,1034,2,605,3,1,0,660,6,5,364,1034,2,605,0,1,0,660,6,5,365,1038,2,609,3,1,0,659,6,5,365,1038,2,609,0,1,0,659,6,5,366,1035,2,606,3,1,0,658,6,5,366,1035,2,606,0,1,0,658,6,5,367,1036,2,607,3,1,0,661,6,5,367,1036,2,607,0,1,0,661,6,5,368,1037,2,608,3,1,0,657,6,5,368,1037,2,608,0,1,0,657,6,5,497,839,2,164,1,1,0,1083,6,5,497,839,2,164,0,1,0,1083,6,5,499,864,2,197,3,3,0,102,6,5,499,864,2,197,0,3,0,102,6,5,500,843,2,175,3,3,0,111,6,5,500,843,2,175,0,3,0,111,6,5,501,863,2,196,64,1,0,101,6,5,501,863,2,196,65,1,0,101,6,5,502,862,2,195,64,1,0,97,6,5,502,862,2,195,65,1,0,97,6,5,521,1046,2,616,3,3,0,1131,6,5,521,1046,2,616,0,3,0,1131,6,5,522,1048,2,618,64,1,0,1098,6,5,522,1048,2,618,65,1,0,1098,6,5,523,1044,2,614,3,1,0,1097,6,5,523,1044,2,614,0,1,0,1097,6,5,524,1042,2,612,3,1,0,1074,6,5,524,1042,2,612,0,1,0,1074,13,12,391,963,2,540,3,3,0,647,13,12,391,963,2,540,0,3,0,647,13,12,392,962,2,539,3,3,1,633,13,12,392,962,2,539,0,0,1,633,13,12,393,961,2,538,3,3,1,636,13,12,393,961,2,538,0,0,1,636,13,12,394,960,2,537,3,3,1,640,13,12,394,960,2,537,0,0,1,640,13,12,1309,1667,4,1437,0,1,0,1471,13,12,395,965,2,542,3,3,0,638,13,12,395,965,2,542,0,3,0,638,13,12,1310,1666,8,1436,0,1,0,1469,13,12,1311,1665,8,1435,0,1,0,1470,13,12,1312,1668,8,1438,0,1,0,1472,13,12,396,901,2,233,51,1,0,645,13,12,396,901,2,233,18,1,0,645,13,12,397,902,2,234,51,1,0,646,13,12,397,902,2,234,18,1,0,646,13,12,398,904,2,236,51,1,0,648,13,12,398,904,2,236,18,1,0,648,13,12,399,903,2,235,51,1,0,649,13,12,399,903,2,235,18,1,0,649,13,12,400,916,2,248,41,1,0,643,13,12,400,916,2,248,42,1,0,643,13,12,401,920,2,252,41,1,0,642,13,12,401,920,2,252,42,1,0,642,13,12,402,921,2,253,41,1,0,641,13,12,402,921,2,253,42,1,0,641,13,12,403,892,2,225,121,1,0,644,13,12,403,892,2,225,124,1,0,644,13,12,1313,1642,4,1244,0,1,0,1473,13,12,404,925,2,257,68,1,0,632,13,12,404,925,2,257,69,1,0,632,13,12,405,927,2,259,68,1,0,631,13,12,405,927,2,259,69,1,0,631,13,12,406,885,2,218,1137,1,0,635,13,12,406,885,2,218,1145,1,0,635,13,12,407,880,2,213,54,1,0,634,13,12,407,880,2,213,55,1,0,634,13,12,408,899,2,232,68,1,0,639,13,12,408,899,2,232,69,1,0,639,13,12,409,905,2,237,54,1,0,637,13,12,409,905,2,237,55,1,0,637,26,22,483,861,2,194,3,3,0,691,26,22,483,861,2,194,0,3,0,691,26,22,484,866,2,199,41,1,0,698,26,22,484,866,2,199,42,1,0,698,26,22,485,865,2,198,41,1,0,699,26,22,485,865,2,198,42,1,0,699,26,22,486,867,2,200,41,1,0,697,26,22,486,867,2,200,42,1,0,697,26,22,487,968,2,546,3,3,0,693,26,22,487,968,2,546,0,3,0,693,26,22,489,855,2,187,3,1,0,690,26,22,489,855,2,187,0,1,0,690,26,22,490,856,2,188,3,1,0,694,26,22,490,856,2,188,0,1,0,694,26,22,491,857,2,189,3,1,0,692,26,22,491,857,2,189,0,1,0,692,26,22,492,928,2,261,41,1,0,695,26,22,492,928,2,261,42,1,0,695,26,22,493,929,2,262,41,1,0,696,26,22,493,929,2,262,42,1,0,696,26,22,528,1049,2,619,3,3,0,677,26,22,528,1049,2,619,0,3,0,677,26,22,1426,1577,4,1173,0,1,0,1465,26,22,529,837,2,162,1139,1,126,678,26,22,529,837,2,162,1147,1,126,678,118,91,386,842,2,174,68,1,0,689,118,91,386,842,2,174,69,1,0,689,118,91,1304,1694,8,1461,1,1,0,1514,701,117,1302,1627,8,1229,1,1,0,1515,701,117,1303,1628,4,1230,0,1,0,1516,38,36,275,1041,2,611,3,3,0,782,38,36,275,1041,2,611,0,3,0,782,38,36,276,1040,2,610,3,3,0,1080,38,36,276,1040,2,610,0,3,0,1080,38,36,277,1032,2,603,3,1,0,705,38,36,277,1032,2,603,0,1,0,705,38,36,278,1031,2,602,3,1,0,704,38,36,278,1031,2,602,0,1,0,704,38,36,451,1008,2,585,3,1,0,761,38,36,451,1008,2,585,0,1,0,761,38,36,452,1009,2,586,3,1,0,800,38,36,452,1009,2,586,0,1,0,800,38,36,453,1014,2,590,3,1,0,760,38,36,453,1014,2,590,0,1,0,760,38,36,454,1013,2,589,3,1,0,799,38,36,454,1013,2,589,0,1,0,799,31,27,290,910,2,242,3,3,0,1099,31,27,290,910,2,242,0,3,0,1099,31,27,291,909,2,241,3,3,0,1100,31,27,291,909,2,241,0,3,0,1100,31,27,292,1045,2,615,3,3,0,710,31,27,292,1045,2,615,0,3,0,710,31,27,293,911,2,243,3,1,0,708,31,27,293,911,2,243,0,1,0,708,31,27,294,908,2,240,3,3,0,709,31,27,294,908,2,240,0,3,0,709,31,27,295,846,2,178,3,1,0,781,31,27,295,846,2,178,0,1,0,781,31,27,296,847,2,179,3,1,0,1079,31,27,296,847,2,179,0,1,0,1079,31,27,297,845,2,177,3,1,0,668,31,27,297,845,2,177,0,1,0,668,31,27,298,844,2,176,3,1,0,669,31,27,298,844,2,176,0,1,0,669,31,27,318,1061,2,165,3,1,0,780,31,27,318,1061,2,165,0,1,0,780,31,27,319,1062,2,166,3,1,0,1078,31,27,319,1062,2,166,0,1,0,1078,1519,190,1258,1644,8,1245,0,1,0,1522,37,34,299,823,2,148,1,1,0,717,37,34,299,823,2,148,0,1,0,717,37,34,300,841,2,173,1,1,0,716,37,34,300,841,2,173,0,1,0,716,37,34,301,832,2,157,3,3,1,715,37,34,301,832,2,157,0,0,1,715,37,34,302,833,2,158,3,1,0,714,37,34,302,833,2,158,0,1,0,714,37,34,303,834,2,159,3,3,0,713,37,34,303,834,2,159,0,3,0,713,37,34,304,801,2,127,3,3,0,1132,37,34,304,801,2,127,0,3,0,1132,37,34,305,830,2,155,3,1,0,712,37,34,305,830,2,155,0,1,0,712,37,34,306,829,2,154,3,3,0,1077,37,34,306,829,2,154,0,3,0,1077,37,34,1264,1567,8,1165,0,1,0,1477,46,43,279,933,2,265,1,1,0,1064,46,43,279,933,2,265,0,1,0,1064,46,43,280,828,2,153,3,3,0,665,46,43,280,828,2,153,0,3,0,665,46,43,1251,939,2,1306,0,1,0,778,46,43,281,831,2,156,3,3,1,798,46,43,281,831,2,156,0,0,1,798,46,43,1252,934,2,1248,0,1,0,735,46,43,1253,934,2,1204,0,1,0,735,46,43,1420,939,2,1217,0,1,0,778,46,43,1421,1680,4,1445,0,1,0,1542,46,43,526,969,2,547,3,1,0,779,46,43,526,969,2,547,0,1,0,779,67,58,308,873,2,206,3,1,0,719,67,58,308,873,2,206,0,1,0,719,67,58,309,874,2,207,3,1,0,721,67,58,309,874,2,207,0,1,0,721,67,58,310,875,2,208,3,1,0,718,67,58,310,875,2,208,0,1,0,718,67,58,311,877,2,210,3,1,0,720,67,58,311,877,2,210,0,1,0,720,59,52,373,807,2,133,3,1,0,724,59,52,373,807,2,133,0,1,0,724,59,52,384,815,2,141,3,1,0,722,59,52,384,815,2,141,0,1,0,722,59,52,385,816,2,142,3,1,0,723,59,52,385,816,2,142,0,1,0,723,59,52,1298,1565,8,1163,1,1,0,1526,59,52,1299,1562,8,1160,1,1,0,1528,59,52,1300,1563,8,1161,1,1,0,1527,59,52,1301,1564,4,1162,0,1,0,1529,32,30,371,808,2,134,3,1,0,731,32,30,371,808,2,134,0,1,0,731,32,30,374,814,2,140,3,1,0,732,32,30,374,814,2,140,0,1,0,732,32,30,375,813,2,139,3,1,0,728,32,30,375,813,2,139,0,1,0,728,32,30,376,812,2,138,3,1,0,726,32,30,376,812,2,138,0,1,0,726,32,30,377,811,2,137,3,1,0,727,32,30,377,811,2,137,0,1,0,727,32,30,378,810,2,136,3,1,0,730,32,30,378,810,2,136,0,1,0,730,32,30,1291,1553,8,1151,0,1,0,1531,32,30,381,820,2,146,3,1,0,729,32,30,381,820,2,146,0,1,0,729,32,30,382,819,2,145,3,1,0,725,32,30,382,819,2,145,0,1,0,725,32,30,383,822,2,147,1,1,0,733,32,30,383,822,2,147,0,1,0,733,32,30,1292,1557,8,1155,0,1,0,1532,32,30,1296,1560,8,1158,0,1,0,1530,49,45,267,978,2,554,3,1,0,740,49,45,267,978,2,554,0,1,0,740,49,45,268,980,2,556,3,1,0,741,49,45,268,980,2,556,0,1,0,741,49,45,269,1033,2,604,3,3,0,736,49,45,269,1033,2,604,0,3,0,736,49,45,270,999,2,552,3,1,0,737,49,45,270,999,2,552,0,1,0,737,49,45,271,981,2,557,3,1,0,739,49,45,271,981,2,557,0,1,0,739,49,45,272,982,2,558,1,1,0,738,49,45,272,982,2,558,0,1,0,738,24,16,1305,1641,8,1243,0,1,0,1474,24,16,1333,1636,8,1238,1,1,0,742,24,16,435,897,2,230,51,1,0,99,24,16,435,897,2,230,18,1,0,99,24,16,436,896,2,229,3,3,0,100,24,16,436,896,2,229,0,3,0,100,24,16,1334,1670,8,1439,1,1,0,742,24,16,437,966,2,543,51,1,0,99,24,16,437,966,2,543,18,1,0,99,24,16,438,967,2,544,3,3,0,100,24,16,438,967,2,544,0,3,0,100,24,16,1335,1635,8,1237,1,1,0,1468,24,16,1336,1634,8,1236,1,1,0,1722,24,16,439,957,2,535,3,3,0,1133,24,16,439,957,2,535,0,3,0,1133,24,16,449,836,2,161,51,1,0,773,24,16,449,836,2,161,18,1,0,773,24,16,450,835,2,160,51,1,0,774,24,16,450,835,2,160,18,1,0,774,24,16,1340,1660,4,1415,0,1,0,1539,24,16,494,840,2,167,3,1,0,775,24,16,494,840,2,167,0,1,0,775,24,16,495,958,2,536,3,3,0,772,24,16,495,958,2,536,0,3,0,772,24,16,496,956,2,534,3,1,0,1111,24,16,496,956,2,534,0,1,0,1111,15,14,505,848,2,180,3,3,0,756,15,14,505,848,2,180,0,3,0,756,15,14,506,849,2,181,3,3,0,744,15,14,506,849,2,181,0,3,0,744,15,14,507,850,2,182,3,3,0,747,15,14,507,850,2,182,0,3,0,747,15,14,508,851,2,183,3,3,0,752,15,14,508,851,2,183,0,3,0,752,15,14,509,852,2,184,3,3,0,754,15,14,509,852,2,184,0,3,0,754,15,14,510,853,2,185,3,3,0,755,15,14,510,853,2,185,0,3,0,755,15,14,511,854,2,186,3,3,0,743,15,14,511,854,2,186,0,3,0,743,15,14,512,858,2,191,3,1,0,753,15,14,512,858,2,191,0,1,0,753,15,14,513,859,2,192,121,1,0,757,15,14,513,859,2,192,124,1,0,757,15,14,514,860,2,193,54,1,0,758,15,14,514,860,2,193,55,1,0,758,15,14,1416,1620,4,1223,0,1,0,1534,15,14,1417,1621,4,1224,0,1,0,1533,15,14,515,932,2,264,72,1,56,748,15,14,515,932,2,264,74,1,56,748,15,14,516,931,2,263,72,1,56,749,15,14,516,931,2,263,74,1,56,749,15,14,517,868,2,201,72,1,56,750,15,14,517,868,2,201,74,1,56,750,15,14,518,869,2,202,72,1,56,751,15,14,518,869,2,202,74,1,56,751,15,14,519,870,2,203,72,1,79,745,15,14,519,870,2,203,74,1,79,745,15,14,520,876,2,209,72,1,56,746,15,14,520,876,2,209,74,1,56,746,84,76,415,1016,2,592,3,1,0,656,84,76,415,1016,2,592,0,1,0,656,84,76,1314,1691,4,1457,0,1,0,1475,84,76,416,1017,2,593,1135,1,0,655,84,76,416,1017,2,593,1142,1,0,655,759,90,314,971,2,90,1138,1,125,792,759,90,314,971,2,90,1146,1,125,792,78,66,474,987,2,562,3,1,0,776,78,66,474,987,2,562,0,1,0,776,78,66,527,986,2,561,51,1,0,777,78,66,527,986,2,561,18,1,0,777,78,66,1425,1685,4,1450,0,1,0,1540,78,66,1427,1683,4,1448,0,1,0,1541,784,114,1379,937,8,1268,18,1,0,662,784,114,1380,937,2,1242,0,1,0,662,50,48,315,972,2,63,1136,1,86,700,50,48,315,972,2,63,1144,1,86,700,50,48,410,802,2,128,3,1,0,796,50,48,410,802,2,128,0,1,0,796,50,48,411,803,2,129,3,1,0,794,50,48,411,803,2,129,0,1,0,794,50,48,412,805,2,131,3,1,0,797,50,48,412,805,2,131,0,1,0,797,50,48,413,806,2,132,3,1,0,795,50,48,413,806,2,132,0,1,0,795,50,48,414,804,2,130,3,1,0,793,50,48,414,804,2,130,0,1,0,793,11,10,313,879,2,212,3,3,0,1125,11,10,313,879,2,212,0,3,0,1125,11,10,457,997,2,572,112,1,75,1073,11,10,457,997,2,572,79,1,75,1073,11,10,458,998,2,573,112,1,75,1072,11,10,458,998,2,573,79,1,75,1072,11,10,1344,1687,8,1452,1,3,0,1720,11,10,1345,1689,8,1454,1,3,0,1719,11,10,459,1002,2,576,3,3,1,1124,11,10,459,1002,2,576,0,0,1,1124,11,10,460,1001,2,575,3,1,0,1082,11,10,460,1001,2,575,0,1,0,1082,11,10,1346,1669,4,30,0,1,0,1710,11,10,1347,1673,4,52,0,1,0,1706,11,10,1348,1674,4,53,0,1,0,1708,11,10,1349,1675,4,33,0,1,0,1711,11,10,1350,1676,4,117,0,1,0,1707,11,10,1351,1677,4,1443,0,1,0,1709,11,10,1352,1697,4,3,0,1,0,1513,11,10,1353,1551,4,113,0,1,0,1714,11,10,1354,1572,4,5,0,1,0,1718,11,10,1355,1578,4,45,0,1,0,1717,11,10,1356,1586,4,80,0,1,0,1716,11,10,1357,1597,4,36,0,1,0,1712,11,10,1358,1608,4,1201,0,1,0,1715,11,10,1359,1693,4,1460,0,1,0,1713,11,10,1360,1615,4,43,0,1,0,1511,11,10,1361,1616,4,190,0,1,0,1510,11,10,1362,1622,4,27,0,1,0,1512,11,10,461,940,2,116,3,3,0,667,11,10,461,940,2,116,0,3,0,667,11,10,462,941,2,472,3,3,0,685,11,10,462,941,2,472,0,3,0,685,11,10,463,950,2,498,3,3,0,1095,11,10,463,950,2,498,0,3,0,1095,11,10,464,951,2,40,3,3,0,785,11,10,464,951,2,40,0,3,0,785,11,10,465,955,2,66,73,3,0,671,11,10,465,955,2,66,16,3,0,671,11,10,466,964,2,541,73,3,0,1063,11,10,466,964,2,541,16,3,0,1063,11,10,1363,1623,8,34,18,1,0,1535,11,10,1364,1637,8,39,18,1,0,1537,11,10,1365,1643,8,260,18,1,0,1536,11,10,1366,1647,8,17,18,1,0,1478,11,10,1367,1649,8,266,18,1,0,1705,11,10,1368,1650,8,81,18,1,0,1518,11,10,1369,1651,8,82,18,1,0,1704,11,10,1370,1652,8,114,18,1,0,1467,11,10,1371,1653,8,70,18,1,0,1538,11,10,1372,1654,8,115,18,1,0,1550,11,10,1373,1656,8,83,18,1,0,1549,11,10,1418,1625,4,1227,0,1,0,1703,11,10,1419,1626,4,1228,0,1,0,1543,11,10,1422,1617,4,1220,0,1,0,1507,11,10,1423,1618,4,1221,0,1,0,1506,11,10,1424,1619,4,1222,0,1,0,1508,11,10,530,1047,2,617,3,3,0,783,11,10,530,1047,2,617,0,3,0,783,1069,115,1374,936,8,1267,18,1,0,1071,1069,115,1375,936,4,1219,0,1,0,1071,60,57,387,923,2,255,3,3,1,652,60,57,387,923,2,255,0,0,1,652,60,57,388,922,2,254,54,1,0,651,60,57,388,922,2,254,55,1,0,651,60,57,389,924,2,256,3,1,0,653,60,57,389,924,2,256,0,1,0,653,60,57,390,926,2,258,3,3,1,654,60,57,390,926,2,258,0,0,1,654,60,57,1307,1613,8,1215,0,1,0,650,60,57,1308,1663,8,1432,0,1,0,650,103,83,1409,821,2,62,0,1,0,104,103,83,1410,821,8,1225,18,1,0,104,103,83,1411,1055,2,1446,0,1,0,104,103,83,1412,1055,8,1447,18,1,0,104,25,21,1315,1655,4,1250,0,1,0,1087,25,21,1316,1592,4,1186,0,1,0,1087,25,21,417,893,2,226,54,1,0,108,25,21,417,893,2,226,55,1,0,108,25,21,1317,1632,8,1234,1,1,0,1088,25,21,418,1059,2,579,120,1,0,106,25,21,418,1059,2,579,123,1,0,106,25,21,419,1058,2,580,41,1,0,105,25,21,419,1058,2,580,42,1,0,105,25,21,1318,1640,4,1241,0,1,0,1086,25,21,420,894,2,227,73,3,0,109,25,21,420,894,2,227,16,3,0,109,25,21,421,895,2,228,73,3,0,107,25,21,421,895,2,228,16,3,0,107,25,21,422,954,2,533,54,1,0,108,25,21,422,954,2,533,55,1,0,108,25,21,1319,1662,8,1431,1,1,0,1088,25,21,423,1060,2,582,120,1,0,106,25,21,423,1060,2,582,123,1,0,106,25,21,424,1005,2,581,41,1,0,105,25,21,424,1005,2,581,42,1,0,105,25,21,1320,1661,4,1430,0,1,0,1086,25,21,425,953,2,532,3,1,0,109,25,21,425,953,2,532,0,1,0,109,25,21,426,952,2,531,3,1,0,107,25,21,426,952,2,531,0,1,0,107,47,40,312,878,2,211,3,3,0,1094,47,40,312,878,2,211,0,3,0,1094,47,40,469,1004,2,578,73,3,0,1090,47,40,469,1004,2,578,16,3,0,1090,47,40,470,1003,2,577,3,3,0,1089,47,40,470,1003,2,577,0,3,0,1089,47,40,471,1006,2,583,3,3,0,1091,47,40,471,1006,2,583,0,3,0,1091,47,40,503,1007,2,584,3,3,0,1076,47,40,503,1007,2,584,0,3,0,1076,47,40,504,1015,2,591,54,1,0,1075,47,40,504,1015,2,591,55,1,0,1075,47,40,1414,1614,8,1218,0,1,0,1721,35,33,316,871,2,204,112,1,75,1092,35,33,316,871,2,204,79,1,75,1092,35,33,317,872,2,205,51,3,0,1093,35,33,317,872,2,205,18,3,0,1093,35,33,1269,1645,4,1246,0,1,0,1730,35,33,1270,1576,4,1172,0,1,0,1728,35,33,1271,1575,4,1171,0,1,0,1727,35,33,1272,1574,4,1170,0,1,0,1732,35,33,1273,1573,4,1169,0,1,0,1724,35,33,1274,1624,4,1226,0,1,0,1731,35,33,1275,1638,4,1239,0,1,0,1729,35,33,1276,1639,4,1240,0,1,0,1733,35,33,1277,1681,4,22,0,1,0,1754,35,33,1278,1682,4,91,0,1,0,1734,35,33,1279,1678,8,76,0,1,0,1725,35,33,1280,1679,8,1444,0,1,0,1726,35,33,1290,1695,4,1462,0,1,0,1548,35,33,1381,1684,4,1449,0,1,0,1752,61,53,372,809,2,135,3,1,0,1114,61,53,372,809,2,135,0,1,0,1114,61,53,379,818,2,144,3,1,0,1112,61,53,379,818,2,144,0,1,0,1112,61,53,380,817,2,143,3,1,0,1113,61,53,380,817,2,143,0,1,0,1113,61,53,1293,1558,8,1156,0,1,0,1751,61,53,1294,1561,8,1159,0,1,0,1742,61,53,1295,1559,8,1157,0,1,0,1750,61,53,1297,1702,4,3,0,1,0,1743,1753,116,1259,1692,4,1458,0,1,0,1545,9,7,1281,1698,4,1209,0,1,0,1525,9,7,1282,1552,8,62,0,1,0,1524,9,7,1283,1554,8,1152,0,1,0,1523,9,7,320,826,2,151,1,1,0,626,9,7,320,826,2,151,0,1,0,626,9,7,321,824,2,149,1,1,0,786,9,7,321,824,2,149,0,1,0,786,9,7,322,825,2,150,3,3,0,787,9,7,322,825,2,150,0,3,0,787,9,7,1284,1566,4,1164,0,1,0,1466,9,7,1285,1701,4,1210,0,1,0,1723,9,7,1286,1700,4,1211,0,1,0,1547,9,7,1287,1699,4,1212,0,1,0,1546,9,7,1288,1648,4,1249,0,1,0,1517,9,7,323,974,2,549,1134,1,0,1130,9,7,323,974,2,549,1141,1,0,1130,9,7,324,1052,2,622,41,1,0,1126,9,7,324,1052,2,622,42,1,0,1126,9,7,325,1051,2,621,41,1,0,1127,9,7,325,1051,2,621,42,1,0,1127,9,7,326,1053,2,623,41,1,1148,1128,9,7,326,1053,2,623,42,62,62,1128,9,7,327,1054,2,624,41,1,0,1129,9,7,327,1054,2,624,42,1,0,1129,9,7,328,881,2,214,54,1,0,670,9,7,328,881,2,214,55,1,0,670,9,7,329,973,2,58,54,1,0,703,9,7,329,973,2,58,55,1,0,703,9,7,330,993,2,568,68,1,0,791,9,7,330,993,2,568,69,1,0,791,9,7,331,996,2,571,3,3,1,1081,9,7,331,996,2,571,0,0,1,1081,9,7,332,979,2,555,3,3,0,789,9,7,332,979,2,555,0,3,0,789,9,7,333,995,2,570,3,3,0,790,9,7,333,995,2,570,0,3,0,790,9,7,334,975,2,550,3,1,0,679,9,7,334,975,2,550,0,1,0,679,9,7,335,976,2,551,3,1,0,680,9,7,335,976,2,551,0,1,0,680,9,7,336,977,2,553,3,1,0,625,9,7,336,977,2,553,0,1,0,625,9,7,337,985,2,560,3,1,0,764,9,7,337,985,2,560,0,1,0,764,9,7,1289,1686,4,1451,0,1,0,1463,9,7,338,989,2,564,3,3,0,766,9,7,338,989,2,564,0,3,0,766,9,7,339,994,2,569,3,1,0,763,9,7,339,994,2,569,0,1,0,763,9,7,340,984,2,559,3,1,0,767,9,7,340,984,2,559,0,1,0,767,9,7,341,990,2,565,3,1,0,768,9,7,341,990,2,565,0,1,0,768,9,7,342,991,2,566,3,1,0,769,9,7,342,991,2,566,0,1,0,769,9,7,343,983,2,14,3,1,0,770,9,7,343,983,2,14,0,1,0,770,9,7,344,988,2,563,3,1,0,765,9,7,344,988,2,563,0,1,0,765,9,7,346,992,2,567,3,3,0,771,9,7,346,992,2,567,0,3,0,771,9,7,525,827,2,152,1,1,0,762,9,7,525,827,2,152,0,1,0,762,110,87,282,938,2,345,1,1,0,707,110,87,282,938,2,345,0,1,0,707,110,87,1254,959,2,1207,3,1,0,706,110,87,1255,959,8,1434,0,1,0,706],"strings":["1","0","TUMB","-1","BTN","11","COCKPITMECHANICS","55","LEV","WEAPONS","39","RADAR","5","COUNTERMEASURES","64","IFF","2","23","0.5","CAP","3","47","52","ARC159","ICS","TACAN","DATALINK","19","4","ARC182","40","ENGINE","HUD","43","20","TID","14","FUELSYSTEM","ELECTRICS","21","37","-0.11111111111111","0.11111111111111","17","AFCS","12","GEARHOOK","TCS","46","HYDRAULICS","NAV_INTERFACE","-0.5","41","42","-0.25","0.25","0.77777","54","58","HSD","RWR","VDI","","51","-0.125","0.125","38","HCU","-0.2","0.2","28","AHRS","-0.11111","-2","0.11111","0.99999","48","BAROALTIMETER","LANTIRN","0.33333","13","25","26","30","ILS","0.9166666663","0.999999","16","224","3184","50","53","AICS","AOASYSTEM","Altimeter Mode Switch","CLOCK","Canopy Jettison","Console Light Intensity","Ejection Seat Safety","ICS Amplifier Selector","ICS Function Selector","Instrument Light Intensity","Red Flood Light","STDBYAI","Standby ADI Knob","TACAN Channel Lever (Ones)","TACAN Channel Wheel (Tens)","TACAN Channel X/Y","TACAN Mode","TACAN Mode Normal/Inverse","WINGSWEEP","White Flood Light","-0.33333","10","27","29","34","44","DECM","-0.0833333333","-0.083333333333333","-0.33333333333333","0.0833333333","0.083333333333333","0.33333333333333","1.0000002","1.000002","1001","1002","1003","1004","1005","1006","1008","1009","1010","1011","1012","1013","1014","1015","1016","1017","1018","1019","1020","1021","1033","1044","1046","1047","1049","1069","1072","1073","1074","1075","1076","1094","1095","115","116","118","119","122","12300","12301","150","15005","15006","15007","15008","15009","15081","151","159","16005","16006","16007","16008","161","162","163","164","165","166","167","175","176","177","18","181","183","184","191","192","193","194","195","196","197","198","199","200","2005","2006","2007","2008","2009","201","2010","2011","2012","202","2022","2026","2028","2029","203","2030","20307","2032","2033","2034","2035","204","2041","2042","2043","2044","2045","2049","205","206","207","208","209","210","2100","2101","2102","2103","2104","2105","2106","2107","2108","2109","211","2110","2111","2112","212","213","2136","2137","2139","214","2140","215","22","222","223","2261","2262","237","24","3001","3002","3003","3004","3005","3006","3007","3008","3009","3010","3011","3012","3013","3014","3019","3029","3034","3035","3036","3037","3038","3039","3040","3045","3047","3049","3050","3051","3052","3053","3054","3055","3061","3062","3063","3064","3065","3066","3067","3068","307","3096","3097","3098","3099","3100","3101","3106","3109","3112","3113","3128","3129","3133","3135","3136","3146","3147","3148","3149","3150","3151","3152","3153","3154","3155","3156","3157","3158","3159","3160","3163","3164","3165","3166","3167","3168","3169","317","3170","3171","3172","3173","3174","3175","3176","3177","3178","3179","3180","3181","3185","3186","3187","3190","3191","3192","3193","3194","3195","3196","3197","3211","3212","3213","3214","3215","3216","3217","3218","3219","3220","3224","3225","3226","3227","3228","3235","3239","3252","3256","3257","3259","3261","3267","3269","3270","3271","3273","3281","3283","3285","3287","3289","3291","3293","3295","3298","3300","3302","3304","3306","3308","3314","3315","3316","3317","3318","3319","3322","3326","3330","3332","3335","3336","3338","3342","3344","3347","3348","3365","3367","3368","3369","3370","3371","3373","3375","3382","3383","3389","3390","3399","3407","3409","3410","3411","3412","3413","3415","3417","3419","3423","3425","3428","3429","3430","3431","3434","3436","3442","3443","3448","3449","3467","3468","3469","3470","3471","3472","3487","3490","3494","3495","3496","35","351","3516","352","353","3530","354","355","356","357","358","3585","3586","3587","3588","3589","359","3590","3591","3592","3593","3594","3595","3597","3598","3599","36","3600","3601","3602","3603","3604","3605","3613","3614","3615","3616","3617","3618","3619","3620","3621","3622","3625","3626","3627","3628","3629","3630","3634","3635","3636","3637","3655","3660","3676","3678","3680","3681","372","373","374","380","381","382","387","388","389","390","3900","398","401","402","404","413","496","498","59","60","61","615","62","629","63","630","631","632","65","66","667","668","67","68","69","70","71","72","73","75","78","79","80","8114","83","84","87","88","8888","8889","8890","8891","89","90","902","903","905","906","907","908","91","910","912","913","915","916","918","919","921","923","924","926","927","928","929","930","931","932","933","936","937","938","939","940","941","942","95","950","96","98","9960","9961","9962","9963","A/G gun mode","ACM Cover","ACM Panel Light Intensity","AFCS Stability Augmentation - Pitch","AFCS Stability Augmentation - Roll","AFCS Stability Augmentation - Yaw","AN/ALE-37 Chaff Burst Interval","AN/ALE-37 Chaff Burst Quantity","AN/ALE-37 Chaff Dispense","AN/ALE-37 Chaff Salvo Interval","AN/ALE-37 Chaff Salvo Quantity","AN/ALE-37 Flare Dispense","AN/ALE-37 Flare Interval","AN/ALE-37 Flare Mode","AN/ALE-37 Flare Quantity","AN/ALE-37 Jammer Dispense","AN/ALE-37 Jammer Interval Hundreds","AN/ALE-37 Jammer Interval Tens","AN/ALE-37 Jammer Interval Units","AN/ALE-37 Jammer Quantity","AN/ALE-37 L10 Load Type","AN/ALE-37 L20 Load Type","AN/ALE-37 Power/Mode","AN/ALE-37 R10 Load Type","AN/ALE-37 R20 Load Type","AN/ALR-67 Display Brightness","AN/ALR-67 Display Type","AN/ALR-67 Mode","AN/ALR-67 Power","AN/ALR-67 Test","AN/ARA-63 Channel Knob","AN/ARA-63 Power Switch","Air Source Both Engines","Air Source Left Engine","Air Source Off","Air Source Ram","Air Source Right Engine","Airspeed Indicator Bug Knob","Altimeter Pressure Setting","Anti-Collision Lights","Anti-Skid Spoiler BK Switch","AoA Indexer Light Intensity","Aspect","Asymmetric Thrust Limiter","Asymmetric Thrust Limiter Cover","Attack mode","Automatic Gain Control (no function)","Autopilot - Altitude Hold","Autopilot - Engage","Autopilot - Heading / Ground Track","Autopilot - Vector / Automatic Carrier Landing","BITPANEL","Beacon Power","Beacon mode","Bomb single/pairs","Bomb step/ripple","CAP category","Cabin Pressure Dump","Clock Timer Start/Stop/Reset","Clock Wind","Closing Velocity scale","Compass HDG Slave Knob/nPush (Left Mouse Button) and rotate (Right Mouse Button)","Compass Mode","Compass N-S Hemisphere","DECM ALQ-100 Power/Mode","Datalink Antenna (no function)","Datalink Antijam (no function)","Datalink CAINS/TAC","Datalink Power","Datalink Reply (no function)","Datalink address high","Datalink address low","Datalink freq 100kHz","Datalink freq 10MHz","Datalink freq 1MHz","Destination Mode","ECMD","Ejection CMD Lever","Elec fuse","Emergency Generator Switch","Emergency Generator Switch Cover","Emergency Wing Sweep Handle (Click to pop out)","Emergency Wing Sweep Handle Cover","Engine Airstart","Engine Crank","Engine/Probe Anti-Ice","Formation Light Intensity","Fuel Dump","Fuel Feed","Fuel Feed Cover","Fuel Quantity Selector","Fuel Shutoff - Left","Fuel Shutoff - Right","HCU DDD mode","HCU TCS mode","HCU TID mode","HCU radar mode","HSD Display Mode","HSD ECM Override","HSD/ECMD Power On/Off","HUD AWL Mode","HUD Air-to-Air Mode","HUD Air-to-Ground Mode","HUD Cruise Mode","HUD De-clutter On/Off","HUD Landing Mode","HUD Power On/Off","HUD Take-Off Mode","HUD filter","Hook Bypass","Hook Extension Handle (RB cycle emergency mode)","Hydraulic Emergency Flight Control Switch","Hydraulic Emergency Flight Control Switch Cover","Hydraulic Hand Pump","Hydraulic Isolation Switch","Hydraulic Transfer Pump Switch","Hydraulic Transfer Pump Switch Cover","ICS Volume","IFF Ident (no function)","IFF M1 (no function)","IFF M1 code -x (no function)","IFF M1 code x- (no function)","IFF M2 (no function)","IFF M3 code ---x (no function)","IFF M3 code --x- (no function)","IFF M3 code -x-- (no function)","IFF M3 code x--- (no function)","IFF M3/A (no function)","IFF M4 (no function)","IFF MC (no function)","IFF RAD (no function)","IFF audio/light (no function)","IFF code (no function)","IFF master (no function)","INS","Inboard Spoiler Override","Inboard Spoiler Override Cover","Jettison aux guard","Jettison left tank","Jettison racks/weapons","Jettison right tank","Jettison station 1","Jettison station 3","Jettison station 4","Jettison station 5","Jettison station 6","Jettison station 8","KY MODE Switch","KY-28 Power Mode","KY-28 Radio Selector","KY-28 ZEROIZE Cover","LANTIRN Laser Arm Switch","LANTIRN Power","Landing Gear Lever (RB emergency extend)","Launch Bar Abort Switch Cover","Left Engine Fuel Cutoff","Left Engine Mode","Left Generator Switch","Liquid cooling","MACHANDAIRSPEED","Main Lobe Clutter filter","Master Arm Cover","Master Arm Switch","Master Test Selector (LB to rotate, RB to pull/push)","Mech fuse","Missile option","Missile speed gate","Navigation Mode","Navigation Steer Commands: AWL PCD","Navigation Steer Commands: Destination","Navigation Steer Commands: Manual","Navigation Steer Commands: TACAN","Navigation Steer Commands: Vector","Nose Strut Compression Switch","Outboard Spoiler Override","Outboard Spoiler Override Cover","PNT_1001","PNT_1002","PNT_1003","PNT_1004","PNT_1005","PNT_1006","PNT_1008","PNT_1009","PNT_1010","PNT_1011","PNT_1012","PNT_1013","PNT_1014","PNT_1015","PNT_1016","PNT_1017","PNT_1018","PNT_1019","PNT_1020","PNT_1021","PNT_1032","PNT_1033","PNT_1044","PNT_1046","PNT_1047","PNT_1049","PNT_1069","PNT_1072","PNT_1073","PNT_1074","PNT_1075","PNT_1076","PNT_1094","PNT_1095","PNT_115","PNT_116","PNT_118","PNT_119","PNT_122","PNT_150","PNT_15081","PNT_151","PNT_159","PNT_16005","PNT_16006","PNT_16007","PNT_16008","PNT_161","PNT_162","PNT_163","PNT_164","PNT_165","PNT_166","PNT_167","PNT_175","PNT_176","PNT_177","PNT_181","PNT_183","PNT_184","PNT_191","PNT_192","PNT_193","PNT_194","PNT_195","PNT_196","PNT_197","PNT_198","PNT_199","PNT_200","PNT_2005","PNT_2006","PNT_2007","PNT_2008","PNT_2009","PNT_201","PNT_2010","PNT_2011","PNT_2012","PNT_202","PNT_2022","PNT_2026","PNT_2028","PNT_2029","PNT_203","PNT_2030","PNT_20307","PNT_2032","PNT_2033","PNT_2034","PNT_2035","PNT_204","PNT_2041","PNT_2042","PNT_2043","PNT_2044","PNT_2045","PNT_2049","PNT_205","PNT_2051","PNT_206","PNT_207","PNT_208","PNT_209","PNT_210","PNT_2100","PNT_2101","PNT_2102","PNT_2103","PNT_2104","PNT_2105","PNT_2106","PNT_2107","PNT_2108","PNT_2109","PNT_211","PNT_2110","PNT_2111","PNT_2112","PNT_212","PNT_213","PNT_2136","PNT_2137","PNT_2139","PNT_214","PNT_2140","PNT_215","PNT_222","PNT_223","PNT_224","PNT_2261","PNT_2262","PNT_237","PNT_238","PNT_307","PNT_308","PNT_310","PNT_317","PNT_326","PNT_34","PNT_35","PNT_351","PNT_352","PNT_354","PNT_355","PNT_356","PNT_357","PNT_358","PNT_359","PNT_36","PNT_37","PNT_372","PNT_373","PNT_374","PNT_38","PNT_380","PNT_381","PNT_382","PNT_384","PNT_387","PNT_388","PNT_389","PNT_390","PNT_3900","PNT_398","PNT_401","PNT_402","PNT_413","PNT_496","PNT_498","PNT_50","PNT_51","PNT_58","PNT_59","PNT_60","PNT_61","PNT_62","PNT_629","PNT_63","PNT_630","PNT_631","PNT_632","PNT_64","PNT_65","PNT_66","PNT_667","PNT_668","PNT_67","PNT_68","PNT_69","PNT_70","PNT_71","PNT_72","PNT_73","PNT_75","PNT_78","PNT_79","PNT_80","PNT_8100","PNT_8114","PNT_83","PNT_84","PNT_87","PNT_88","PNT_8890","PNT_89","PNT_90","PNT_902","PNT_903","PNT_904","PNT_905","PNT_906","PNT_907","PNT_908","PNT_91","PNT_910","PNT_912","PNT_913","PNT_913_22","PNT_915","PNT_916","PNT_917","PNT_918","PNT_919","PNT_920","PNT_921","PNT_922","PNT_923","PNT_924","PNT_925","PNT_926","PNT_927","PNT_928","PNT_929","PNT_930","PNT_931","PNT_932","PNT_933","PNT_934","PNT_936","PNT_937","PNT_938","PNT_939","PNT_940","PNT_941","PNT_942","PNT_95","PNT_950","PNT_96","PNT_98","PNT_9960","PNT_9961","PNT_9962","PNT_9963","PNT_RIO_STBY_ADI_PULL","PNT_RIO_UHF_OUTER","PNT_Seat_Safety","PNT_TACAN_LEVER_PILOT","PNT_TACAN_OUTER_TWIST_PILOT","PNT_TACAN_OUTER_TWIST_RIO","PNT_THROT_L","PNT_THROT_R","Parametric amplifier (no function)","Parking Brake Handle","Pilot Oxygen On","Position Lights Flash","Position Lights Tail","Position Lights Wing","RADARALTIMETER","RIO Oxygen On","Radar Altimeter Control Knob","Radar azimuth scan","Radar elevation scan","Ram Air","Record mode (no function)","Record power (no function)","Refuel Probe","Right Engine Fuel Cutoff","Right Engine Mode","Right Generator Switch","Selective jettison","Stabilize","Storage","Stow Inlet Ramps Left Switch","Stow Inlet Ramps Right Switch","TACAN BIT","TACAN CMD Button","TACAN Volume","TCS Acquisition","TCS FOV","TCS Slave","TID Mode","TID Range","TV/IR switch","Target size (no function)","Taxi Light","Temp Auto / Man","Temperature","Throttle Mode","Throttle Temp","UHF ARC-159 0.025MHz","UHF ARC-159 0.1MHz","UHF ARC-159 100MHz & 10MHz","UHF ARC-159 1MHz","UHF ARC-159 Freq Mode","UHF ARC-159 Function","UHF ARC-159 Preset Channel Selector","UHF ARC-159 Squelch Switch","UHF Radio Remote Display Brightness","UHF Radio Remote Display Test","V/UHF 2 ANT Switch","VDI Display Mode","VDI Landing Mode","VDI Power On/Off","VHF/UHF ARC-182 0.025MHz","VHF/UHF ARC-182 0.1MHz","VHF/UHF ARC-182 100MHz & 10MHz","VHF/UHF ARC-182 1MHz","VHF/UHF ARC-182 FM/AM Switch","VHF/UHF ARC-182 Freq Mode","VHF/UHF ARC-182 MODE","VHF/UHF ARC-182 Preset Channel Selector","VHF/UHF ARC-182 Squelch Switch","VSL switch","WCS switch","Weapon Interval x100ms","Weapon Interval x10ms","Weapon Quantity 10s","Weapon Quantity 1s","Weapon type wheel","Wind Shield Air","Wing/Ext Trans","XMTR SEL Switch","-0.023255813953488","-0.052631578947368","-0.142857","-0.16666666666667","-0.1666667","-0.166667","-0.333333","0.023255813953488","0.052631578947368","0.090909090909091","0.142857","0.16666666666667","0.1666667","0.166667","0.3333","0.333333","0.90909090909091","1007","1022","1030","1031","1034","1035","1036","1037","1038","1039","1040","1041","1043","1048","1050","1051","1071","1099","1115","1116","1117","1118","117","123","124","125","126","127","128","129","130","131","132","133","134","135","136","137","138","139","140","141","142","143","144","145","146","147","148","149","15","15003","15004","15078","15082","15083","15096","15098","16000","16001","16002","16003","16009","16010","16011","16014","16015","16016","16020","1812","1813","1814","185","186","19101","2004","2013","2014","2023","2024","2027","20306","2031","2036","2038","2039","2040","2048","2113","2114","2115","2127","2138","216","225","226","228","238","239","292","3016","3021","3022","3030","3031","3042","3043","3044","3056","3058","3059","306","3060","3069","3076","3077","308","310","3114","3115","3116","3117","3118","3119","3120","3121","3122","3123","3124","3125","3130","3131","3132","3138","3139","3140","3141","3142","3161","3162","3223","3229","3230","3231","3232","3233","3234","3240","3241","3242","3243","3245","3246","3253","3254","326","3262","3263","3272","3275","3277","3279","3297","3321","3324","3325","3328","3334","3340","3346","3350","3352","3353","3355","3356","3358","3359","3361","3363","3377","3378","3379","3380","3387","3395","3397","3401","3403","3405","3427","3432","3433","3438","3446","3447","3450","3451","3452","3453","3454","3455","3456","3457","3458","3459","3460","3461","3462","3463","3464","3465","3466","3473","3474","3475","3476","3477","3478","3479","3480","3481","3482","3483","3484","3485","3486","3488","3489","3491","3492","3498","350","3518","3519","3520","3521","3522","3523","3524","3525","3526","3527","3528","3529","3531","3532","3533","3534","3535","3536","3537","3538","3539","3540","3541","3542","3543","3544","3545","3546","3547","3548","360","3609","361","3623","3624","3631","3632","3633","3659","3673","3674","3675","3677","3679","3691","3697","3698","371","375","376","383","384","385","386","391","399","400","405","406","4153","45","49","497","6155","6156","669","670","671","74","81","8115","82","904","909","911","9199","934","9916","9950","9964","A/A Launch","ACCELEROMETER","ACLS test","ACM Jettison","ACM threshold (no function)","ALR-67 Volume","AN/ALE-37 Chaff Counter","AN/ALE-37 Flare Counter","AN/ALE-37 Flare Salvo","AN/ALE-37 Jammer Counter","AN/ALE-37 Programmer Reset","AN/ALR-67 Volume","AN/ARA-63 BIT Button","Accelerometer Reset","BINGO Fuel Level Knob","Brightness","CADC","CAP 7","CAP 9","CAP ALT 4","CAP BRG 0","CAP HDG 8","CAP LAT 1","CAP LONG 6","CAP N+E","CAP NBR 2","CAP PGM RSTRT","CAP RNG 5","CAP S-W","CAP SPD 3","CAP TNG NBR","CAP btn 1","CAP btn 10","CAP btn 2","CAP btn 3","CAP btn 4","CAP btn 5","CAP btn 6","CAP btn 7","CAP btn 8","CAP btn 9","CAP clear","CAP enter","CCM ALT DIFF (no function)","CCM SPL (no function)","CCM VGS (no function)","Compass LAT Correction","DDD Infrared (no function)","DDD Interrogate Friend or Foe","DDD RADAR","DDD filter","DECM ALQ-100 Volume","ECMD Brightness","ECMD Test","Emergency stores jettison","Erase","FLAPS","Fire Ext Bottle - Left","Fire Ext Bottle - Right","Flaps Lever","Gun Ammunition Counter Adjustment","Gun Elevation Lead Adjustment","Gun rate","HSD Brightness","HSD Selected Course","HSD Selected Heading","HSD Test","HUD Brightness","HUD Pitch Ladder Brightness","HUD Trim","IFF reply (no function)","IFF test (no function)","IR gain (no function)","IR threshold (no function)","IR volume (no function)","JAM/JET (no function)","KY-28 ZEROIZE","LANTIRN IBIT","LANTIRN Operate Mode (Unstow)","Launch Bar Abort","Light test","MASTER RESET","Master Caution Reset","Missile mode","Missile prepare","Next Launch","PD threshold clear (no function)","PD threshold clutter","PNT_10","PNT_1000","PNT_1007","PNT_1022","PNT_1030","PNT_1031","PNT_1034","PNT_1035","PNT_1036","PNT_1037","PNT_1038","PNT_1039","PNT_1040","PNT_1041","PNT_1043","PNT_1048","PNT_1050","PNT_1051","PNT_1052","PNT_1053","PNT_1071","PNT_11","PNT_1115","PNT_1116","PNT_1117","PNT_1118","PNT_117","PNT_12","PNT_123","PNT_124","PNT_125","PNT_126","PNT_127","PNT_128","PNT_129","PNT_13","PNT_130","PNT_131","PNT_132","PNT_133","PNT_134","PNT_135","PNT_136","PNT_137","PNT_138","PNT_139","PNT_14","PNT_140","PNT_141","PNT_142","PNT_143","PNT_144","PNT_145","PNT_146","PNT_147","PNT_148","PNT_149","PNT_15","PNT_15082","PNT_15083","PNT_16009","PNT_16010","PNT_16011","PNT_16016","PNT_17","PNT_18","PNT_1812","PNT_1813","PNT_1814","PNT_185","PNT_186","PNT_19","PNT_20","PNT_2004","PNT_2013","PNT_2014","PNT_2023","PNT_2024","PNT_2027","PNT_20306","PNT_2031","PNT_2036","PNT_2038","PNT_2039","PNT_2040","PNT_2047","PNT_21","PNT_2113","PNT_2114","PNT_2115","PNT_2138","PNT_216","PNT_22","PNT_225","PNT_226","PNT_228","PNT_23","PNT_239","PNT_24","PNT_25","PNT_26","PNT_27","PNT_28","PNT_29","PNT_292","PNT_30","PNT_306","PNT_350","PNT_360","PNT_361","PNT_371","PNT_375","PNT_376","PNT_383","PNT_385","PNT_386","PNT_391","PNT_399","PNT_40","PNT_400","PNT_405","PNT_406","PNT_41","PNT_42","PNT_43","PNT_44","PNT_45","PNT_48","PNT_49","PNT_497","PNT_52","PNT_53","PNT_669","PNT_670","PNT_671","PNT_74","PNT_81","PNT_8115","PNT_82","PNT_909","PNT_911","PNT_9199","PNT_9916","PNT_9950","PNT_9964","PNT_CLOCK_RESET","PNT_DDD_CENTRw","PNT_GUN_RATE","PNT_MSL_MODE","PNT_MSL_PREP","PNT_SW_COOL","PNT_VDI","Power reset","Pulse gain","Pulse video","RADAR 10 NM","RADAR 100 NM","RADAR 20 NM","RADAR 200 NM","RADAR 5 NM","RADAR 50 NM","RADAR pulse doppler search","RADAR pulse doppler single target track","RADAR pulse search","RADAR pulse single target track","RADAR range while scan","RADAR track while scan auto","RADAR track while scan manual","Radar azimuth center","Radar elevation center","Record reset (no function)","Sidewinder Volume","Sidewinder cool","TID Alt num","TID Brightness","TID Contrast","TID Data link","TID Jam strobe","TID Launch zone","TID Non attack","TID Reject Image Device disable (no function)","TID Sym Elem","TID Velocity vector","TID track hold","UHF ARC-159 Display Brightness","UHF ARC-159 Load","UHF ARC-159 Read","UHF ARC-159 Tone","UHF ARC-159 Volume Pilot","UHF ARC-159 Volume RIO","UHF_BIT_TEST","VDI Screen Contrast","VDI filter","VHF/UHF ARC-182 Display Brightness","VHF/UHF ARC-182 Volume Pilot","VHF/UHF ARC-182 Volume RIO","VHF/UHF Radio Remote Display Brightness","VHF/UHF Radio Remote Display Test","VHF_BIT_TEST","VSDI Screen Brightness","VSDI Screen Trim","Video Output Toggle (TCS/LANTIRN)","WARNINGLIGHTS","collision steering"]});
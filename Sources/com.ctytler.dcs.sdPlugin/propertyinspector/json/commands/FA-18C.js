@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"FA-18C","rows":[25,1,11,437,2,1,4,1,0,76,25,1,11,437,2,1,0,1,0,76,25,1,12,438,2,1,4,1,0,76,25,1,12,438,2,1,0,1,0,76,25,1,15,439,2,1,4,1,0,76,25,1,15,439,2,1,0,1,0,76,25,1,143,440,2,214,4,1,0,312,25,1,143,440,2,214,0,1,0,312,25,1,144,355,2,121,4,4,0,324,25,1,144,355,2,121,0,4,0,324,25,1,145,356,2,122,4,4,0,325,25,1,145,356,2,122,0,4,0,325,25,1,146,375,2,150,4,4,0,311,25,1,146,375,2,150,0,4,0,311,25,1,549,796,3,32,0,1,0,687,25,1,147,364,2,135,33,1,82,255,25,1,147,364,2,135,38,1,82,255,25,1,550,878,3,553,0,1,0,721,25,1,551,879,3,554,0,1,0,755,25,1,552,872,5,534,1,1,0,631,630,532,6,867,5,526,452,1,0,629,14,13,6,864,5,521,1,1,0,643,14,13,11,837,3,123,0,1,0,641,14,13,12,836,3,123,4,4,1,642,14,13,15,839,3,124,0,1,0,665,14,13,28,838,3,124,4,4,1,664,14,13,29,843,3,126,0,1,0,638,14,13,24,842,3,126,4,4,1,637,14,13,31,841,3,125,0,1,0,640,14,13,26,840,3,125,4,4,1,639,14,13,41,844,3,501,0,1,0,644,14,13,46,845,3,502,0,1,0,655,14,13,47,846,3,503,0,1,0,657,14,13,57,847,3,504,0,1,0,658,14,13,65,848,3,505,0,1,0,659,14,13,55,849,3,506,0,1,0,660,14,13,58,850,3,507,0,1,0,661,14,13,59,851,3,508,0,1,0,662,14,13,66,852,3,509,0,1,0,663,14,13,67,853,3,510,0,1,0,645,14,13,68,854,3,511,0,1,0,646,14,13,69,855,3,512,0,1,0,647,14,13,70,856,3,513,0,1,0,648,14,13,71,857,3,514,0,1,0,649,14,13,77,858,3,515,0,1,0,650,14,13,78,859,3,516,0,1,0,651,14,13,85,860,3,517,0,1,0,652,14,13,86,861,3,518,0,1,0,653,14,13,87,862,3,519,0,1,0,654,14,13,88,863,3,520,0,1,0,656,89,80,6,400,2,175,4,4,0,245,89,80,6,400,2,175,0,4,0,245,89,80,11,401,2,176,4,4,0,288,89,80,11,401,2,176,0,4,0,288,81,72,6,447,2,221,33,1,40,253,81,72,6,447,2,221,38,1,40,253,81,72,11,894,3,569,0,1,0,676,81,72,12,446,2,220,4,1,0,254,81,72,12,446,2,220,0,1,0,254,30,27,6,882,5,557,1,4,0,729,30,27,11,883,3,558,0,1,0,760,30,27,12,884,3,559,0,1,0,680,30,27,15,434,3,211,0,1,0,265,30,27,15,434,3,211,0,1,0,265,30,27,28,389,2,164,4,1,0,270,30,27,28,389,2,164,0,1,0,270,30,27,29,388,2,163,4,1,0,271,30,27,29,388,2,163,0,1,0,271,30,27,24,359,2,129,4,4,0,266,30,27,24,359,2,129,0,4,0,266,30,27,31,344,2,110,4,1,0,327,30,27,31,344,2,110,0,1,0,327,30,27,26,343,2,109,4,1,0,328,30,27,26,343,2,109,0,1,0,328,30,27,54,101,5,544,0,1,0,98,30,27,41,101,2,140,4,4,0,98,30,27,41,101,2,140,0,4,0,98,30,27,46,912,5,584,1,1,0,762,49,48,6,898,5,573,1,1,0,672,49,48,11,899,5,574,1,1,0,696,49,48,12,900,5,575,1,1,0,681,49,48,15,419,2,195,4,4,0,309,49,48,15,419,2,195,0,4,0,309,49,48,28,902,5,577,1,1,0,671,49,48,29,901,5,576,1,1,0,793,49,48,24,418,3,194,0,1,0,307,49,48,24,418,3,194,0,1,0,307,49,48,31,824,3,489,0,1,0,722,49,48,26,363,3,133,0,1,0,278,49,48,26,363,3,133,0,1,0,278,35,32,6,429,3,206,0,1,0,249,35,32,11,429,3,206,4,4,1,249,35,32,12,420,2,79,4,1,0,250,35,32,12,420,2,79,0,1,0,250,35,32,15,903,3,578,0,1,0,674,35,32,29,442,2,216,4,1,0,258,35,32,29,442,2,216,0,1,0,258,35,32,24,443,2,217,4,1,0,257,35,32,24,443,2,217,0,1,0,257,35,32,31,915,3,587,0,1,0,678,35,32,26,444,2,218,4,1,0,326,35,32,26,444,2,218,0,1,0,326,35,32,54,445,3,219,4,4,1,322,35,32,41,445,3,219,0,1,0,322,35,32,46,871,3,533,0,1,0,756,35,32,47,448,2,222,4,1,0,285,35,32,47,448,2,222,0,1,0,285,37,34,6,417,2,193,33,1,56,236,37,34,6,417,2,193,38,1,56,236,37,34,11,897,3,572,0,1,0,670,37,34,12,413,2,189,4,4,0,256,37,34,12,413,2,189,0,4,0,256,37,34,15,414,2,190,4,4,0,248,37,34,15,414,2,190,0,4,0,248,37,34,28,905,5,580,1,4,0,675,37,34,29,896,5,571,1,1,0,673,37,34,24,895,5,570,1,1,0,759,37,34,31,371,3,141,0,1,0,229,37,34,31,371,3,141,0,1,0,229,37,34,26,428,2,205,4,4,0,337,37,34,26,428,2,205,0,4,0,337,37,34,54,913,5,585,1,1,0,698,37,34,41,914,5,586,1,1,0,732,8,7,6,412,2,188,4,4,0,235,8,7,6,412,2,188,0,4,0,235,8,7,11,410,2,186,4,1,0,305,8,7,11,410,2,186,0,1,0,305,8,7,12,411,2,187,4,1,0,318,8,7,12,411,2,187,0,1,0,318,8,7,15,381,2,156,4,4,1,263,8,7,28,381,3,156,0,1,0,263,8,7,29,404,2,179,4,1,0,273,8,7,29,404,2,179,0,1,0,273,8,7,24,405,2,180,4,1,0,272,8,7,24,405,2,180,0,1,0,272,8,7,31,377,3,152,0,1,0,274,8,7,26,377,3,152,4,4,1,274,8,7,54,378,3,153,0,1,0,275,8,7,41,378,3,153,4,4,1,275,8,7,46,379,3,154,0,1,0,276,8,7,47,379,3,154,4,4,1,276,8,7,57,380,3,155,0,1,0,277,8,7,65,380,3,155,4,4,1,277,8,7,55,415,3,191,0,1,0,314,8,7,55,415,3,191,0,1,0,314,8,7,58,406,2,181,1,1,0,237,8,7,58,406,2,181,0,1,0,237,8,7,59,407,2,182,1,1,0,238,8,7,59,407,2,182,0,1,0,238,8,7,66,408,2,183,1,1,0,244,8,7,66,408,2,183,0,1,0,244,8,7,67,409,2,184,1,1,0,242,8,7,67,409,2,184,0,1,0,242,8,7,68,430,2,207,1,1,0,239,8,7,68,430,2,207,0,1,0,239,8,7,69,431,2,208,1,1,0,240,8,7,69,431,2,208,0,1,0,240,8,7,70,432,2,209,1,1,0,241,8,7,70,432,2,209,0,1,0,241,8,7,71,433,2,210,1,1,0,243,8,7,71,433,2,210,0,1,0,243,8,7,77,398,3,173,0,1,0,308,8,7,78,398,3,173,4,4,1,308,39,36,6,402,3,177,0,1,0,227,39,36,6,402,3,177,0,1,0,227,39,36,11,403,3,178,4,4,1,260,39,36,12,403,3,178,0,1,0,260,39,36,29,376,3,151,0,1,0,268,39,36,24,376,3,151,4,4,1,268,39,36,31,908,3,583,0,1,0,683,39,36,26,372,2,84,4,1,0,228,39,36,26,372,2,84,0,1,0,228,39,36,54,339,2,34,0,1,0,304,39,36,41,367,2,538,0,1,0,317,39,36,46,339,2,36,0,1,0,304,39,36,47,367,2,541,0,1,0,317,39,36,57,416,2,192,4,4,0,259,39,36,57,416,2,192,0,4,0,259,74,73,6,881,5,556,1,1,0,728,74,73,11,880,5,555,1,1,0,682,74,73,12,382,2,157,4,4,0,321,74,73,12,382,2,157,0,4,0,321,74,73,15,361,2,131,4,1,0,300,74,73,15,361,2,131,0,1,0,300,52,51,6,383,2,158,4,1,0,296,52,51,6,383,2,158,0,1,0,296,52,51,11,384,2,159,4,4,0,315,52,51,11,384,2,159,0,4,0,315,52,51,12,387,3,162,0,1,0,269,52,51,12,387,3,162,0,1,0,269,52,51,15,386,2,161,4,4,0,262,52,51,15,386,2,161,0,4,0,262,52,51,28,385,2,160,4,4,0,264,52,51,28,385,2,160,0,4,0,264,45,44,6,99,2,127,4,1,0,93,45,44,6,99,2,127,0,1,0,93,45,44,11,99,5,527,0,1,0,93,45,44,12,868,3,528,0,1,0,677,45,44,15,362,2,132,4,1,0,231,45,44,15,362,2,132,0,1,0,231,45,44,28,100,5,531,0,1,0,92,45,44,29,100,3,134,454,1,105,92,45,44,24,100,2,134,451,1,105,92,45,44,31,358,3,128,0,1,0,303,45,44,31,358,3,128,0,1,0,303,45,44,26,370,2,139,4,1,0,232,45,44,26,370,2,139,0,1,0,232,685,223,6,823,5,488,1,1,455,684,279,107,142,436,2,213,4,1,0,261,279,107,142,436,2,213,0,1,0,261,43,42,6,345,2,111,33,1,40,281,43,42,6,345,2,111,38,1,40,281,43,42,11,825,5,490,1,1,0,686,43,42,12,346,2,112,4,1,0,280,43,42,12,346,2,112,0,1,0,280,43,42,15,826,5,491,1,1,0,669,43,42,28,347,2,113,33,1,40,282,43,42,28,347,2,113,38,1,40,282,43,42,29,827,5,492,1,1,0,668,43,42,24,828,5,493,1,1,0,666,43,42,31,348,2,114,4,1,0,230,43,42,31,348,2,114,0,1,0,230,43,42,26,349,2,115,4,4,0,233,43,42,26,349,2,115,0,4,0,233,283,185,6,399,2,174,4,1,0,286,283,185,6,399,2,174,0,1,0,286,287,84,6,369,3,543,0,1,0,316,287,84,11,369,5,542,0,1,0,316,63,60,6,829,3,494,0,1,0,692,63,60,11,830,3,495,0,1,0,693,63,60,12,831,3,496,0,1,0,694,63,60,15,832,3,497,0,1,0,690,63,60,28,833,3,498,0,1,0,695,63,60,29,834,3,499,0,1,0,691,63,60,24,835,5,500,103,1,0,689,293,197,6,424,2,201,33,1,83,294,293,197,6,424,2,201,38,1,83,294,21,20,11,885,5,560,1,1,0,792,21,20,12,886,5,561,1,1,0,688,21,20,15,887,5,562,1,1,0,731,21,20,28,888,5,563,1,1,0,794,21,20,29,890,5,565,1,1,0,723,21,20,24,889,5,564,1,1,0,724,21,20,31,891,5,566,1,1,0,761,21,20,26,892,5,567,1,1,0,667,21,20,54,390,2,165,4,4,0,251,21,20,54,390,2,165,0,4,0,251,21,20,41,391,2,166,4,4,0,246,21,20,41,391,2,166,0,4,0,246,21,20,46,396,2,171,4,1,0,289,21,20,46,396,2,171,0,1,0,289,21,20,47,395,2,170,4,4,0,290,21,20,47,395,2,170,0,4,0,290,21,20,57,394,3,169,4,4,1,247,21,20,65,394,3,169,0,1,0,247,21,20,55,393,2,168,4,1,0,292,21,20,55,393,2,168,0,1,0,292,21,20,58,392,2,167,450,1,104,291,21,20,58,392,2,167,453,1,104,291,21,20,59,869,3,529,0,1,0,795,64,61,6,425,2,202,33,1,56,298,64,61,6,425,2,202,38,1,56,298,64,61,11,426,2,203,33,1,83,297,64,61,11,426,2,203,38,1,83,297,64,61,15,427,2,204,33,1,40,299,64,61,15,427,2,204,38,1,40,299,64,61,28,904,5,579,1,1,0,697,17,16,6,441,2,215,33,1,40,306,17,16,6,441,2,215,38,1,40,306,17,16,11,916,5,588,1,1,0,699,17,16,12,917,5,50,1,1,0,700,17,16,15,373,3,148,0,1,0,284,17,16,28,373,3,148,4,4,1,284,17,16,29,374,3,149,0,1,0,252,17,16,24,374,3,149,4,4,1,252,17,16,41,918,3,72,0,1,0,701,17,16,46,919,3,589,0,1,0,712,17,16,47,920,3,590,0,1,0,714,17,16,57,921,3,591,0,1,0,715,17,16,65,922,3,223,0,1,0,716,17,16,55,923,3,592,0,1,0,717,17,16,58,924,3,593,0,1,0,718,17,16,59,925,3,594,0,1,0,719,17,16,66,926,3,62,0,1,0,720,17,16,67,927,3,595,0,1,0,702,17,16,68,928,3,596,0,1,0,703,17,16,69,929,3,597,0,1,0,704,17,16,70,930,3,598,0,1,0,705,17,16,71,931,3,599,0,1,0,706,17,16,77,932,3,600,0,1,0,707,17,16,78,933,3,601,0,1,0,708,17,16,85,934,3,602,0,1,0,709,17,16,86,935,3,603,0,1,0,710,17,16,87,936,3,604,0,1,0,711,17,16,88,937,3,605,0,1,0,713,19,18,6,449,2,224,33,1,40,319,19,18,6,449,2,224,38,1,40,319,19,18,11,938,5,606,1,1,0,733,19,18,12,939,5,607,1,1,0,734,19,18,41,940,3,608,0,1,0,735,19,18,46,941,3,609,0,1,0,746,19,18,47,942,3,610,0,1,0,748,19,18,57,943,3,611,0,1,0,749,19,18,65,944,3,612,0,1,0,750,19,18,55,945,3,613,0,1,0,751,19,18,58,946,3,614,0,1,0,752,19,18,59,947,3,615,0,1,0,753,19,18,66,948,3,616,0,1,0,754,19,18,67,949,3,617,0,1,0,736,19,18,68,950,3,618,0,1,0,737,19,18,69,951,3,619,0,1,0,738,19,18,70,952,3,620,0,1,0,739,19,18,71,953,3,621,0,1,0,740,19,18,77,954,3,622,0,1,0,741,19,18,78,955,3,623,0,1,0,742,19,18,85,956,3,624,0,1,0,743,19,18,86,957,3,625,0,1,0,744,19,18,87,958,3,626,0,1,0,745,19,18,88,959,3,627,0,1,0,747,94,90,6,397,2,172,4,1,0,313,94,90,6,397,2,172,0,1,0,313,94,90,11,893,5,568,0,1,0,727,95,79,6,102,2,198,33,1,56,96,95,79,6,102,2,198,38,1,56,96,95,79,11,102,5,1,0,1,0,96,53,50,6,368,2,138,4,1,0,226,53,50,6,368,2,138,0,1,0,226,53,50,11,877,3,540,0,1,0,633,53,50,12,876,3,539,0,1,0,636,53,50,15,875,3,537,0,1,0,635,53,50,28,874,3,536,0,1,0,632,53,50,29,873,5,535,1,1,0,634,53,50,24,366,2,137,33,1,82,225,53,50,24,366,2,137,38,1,82,225,53,50,31,866,5,525,1,1,0,730,97,91,6,865,3,524,0,1,0,757,97,91,11,357,3,522,0,1,0,320,97,91,12,357,5,523,103,1,0,320,23,22,6,906,3,581,0,1,0,725,23,22,11,907,3,582,0,1,0,726,23,22,12,435,2,212,4,1,0,310,23,22,12,435,2,212,0,1,0,310,23,22,15,911,3,80,0,1,0,679,23,22,28,350,2,116,4,1,0,329,23,22,28,350,2,116,0,1,0,329,23,22,29,351,2,117,4,1,0,330,23,22,29,351,2,117,0,1,0,330,23,22,24,352,2,118,4,1,0,331,23,22,24,352,2,118,0,1,0,331,23,22,31,353,2,119,4,1,0,332,23,22,31,353,2,119,0,1,0,332,23,22,26,354,2,120,4,1,0,333,23,22,26,354,2,120,0,1,0,333,23,22,54,870,3,530,0,1,0,758,23,22,41,360,2,130,33,33,56,323,23,22,41,360,2,130,38,33,56,323,23,22,46,365,2,136,4,1,0,234,23,22,46,365,2,136,0,1,0,234,23,22,47,342,2,108,33,1,40,295,23,22,47,342,2,108,38,1,40,295,75,62,6,421,2,196,4,4,0,267,75,62,6,421,2,196,0,4,0,267,75,62,11,422,2,199,4,4,1,302,75,62,12,422,3,199,0,1,0,302,75,62,15,423,2,200,4,1,0,301,75,62,15,423,2,200,0,1,0,301,10,9,6,816,3,481,0,1,0,767,10,9,11,817,3,482,0,1,0,770,10,9,12,818,3,483,0,1,0,773,10,9,15,819,3,484,0,1,0,771,10,9,28,820,3,485,0,1,0,769,10,9,29,821,3,486,0,1,0,768,10,9,24,822,3,487,0,1,0,772,10,9,31,340,3,478,0,1,0,335,10,9,26,341,3,480,0,1,0,336,10,9,54,797,3,456,0,1,0,787,10,9,41,798,3,457,0,1,0,788,10,9,46,799,3,458,0,1,0,789,10,9,47,800,3,459,0,1,0,790,10,9,57,801,3,460,0,1,0,791,10,9,65,960,3,628,0,1,0,774,10,9,55,338,2,106,4,4,0,334,10,9,55,338,2,106,0,4,0,334,10,9,58,804,3,463,0,1,0,766,10,9,59,814,3,473,0,1,0,775,10,9,66,805,3,464,0,1,0,776,10,9,67,806,3,465,0,1,0,777,10,9,68,807,3,466,0,1,0,778,10,9,69,808,3,467,0,1,0,779,10,9,70,809,3,468,0,1,0,780,10,9,71,810,3,469,0,1,0,781,10,9,77,811,3,470,0,1,0,782,10,9,78,812,3,471,0,1,0,783,10,9,85,813,3,472,0,1,0,784,10,9,86,909,3,474,0,1,0,785,10,9,87,910,3,475,0,1,0,786,10,9,88,802,5,461,1,1,0,764,10,9,545,815,5,476,1,1,0,765,10,9,546,803,5,462,1,1,0,763,10,9,547,340,5,477,0,1,0,335,10,9,548,341,5,479,0,1,0,336],"strings":["1","0","TUMB","BTN","-1","LEV","3001","3","ELEC_INTERFACE","25","UFC","3002","3003","37","AMPCD","3004","35","MDI_LEFT","36","MDI_RIGHT","40","INTERCOM","23","SMS","3007","","3009","2","3005","3006","CONTROL_INTERFACE","3008","7","-0.1","11","CPT_MECHANICS","12","ECS_INTERFACE","0.1","ENGINES_INTERFACE","0.2","3011","34","HUD","5","GEAR_INTERFACE","3012","3013","9","CPT_LIGTHS","53","6","FUEL_INTERFACE","RWR","3010","3016","0.3","3014","3017","3018","33","41","62","IFEI","KY58","3015","3019","3020","3021","3022","3023","3024","54","8","EXT_LIGHTS","TGP_INTERFACE","Toggle Mirrors","3025","3026","42","50","CMDS","0.4","0.7","30","3027","3028","3029","3030","ANTENNA_SELECTOR","10","32","Emergency/Parking Brake Handle, (LMB)Rotate Left/(RMB)Rotate Right/(MW)Pull-Stow","Landing Gear Control Handle, (RMB)UP/(LMB)DOWN/(MW)EMERGENCY DOWN","OXYGEN_INTERFACE","RADAR","RADAR Switch (MW to pull), OFF/STBY/OPR/EMERG(PULL)","SAI","Wing Fold Control Handle, (RMB)CW/(LMB)CCW/ (MW)PULL/STOW","pnt_226","pnt_240","pnt_295","pnt_440","0.5","0.95","0.999","107","13","135","138","139","140","142","144","147","148","153","155","157","159","161","175","176","177","179","180","182","226","233","234","236","237","238","239","241","248","258","261","277","293","295","297","3041","3100","3104","3105","3106","3116","312","313","314","331","332","333","334","335","336","339","340","341","342","343","344","347","348","350","351","352","353","354","355","356","365","368","369","373","374","375","377","378","379","381","382","383","384","4","402","403","404","405","408","409","410","411","416","419","439","44","440","441","442","443","444","446","447","452","453","454","455","456","457","470","49","494","507","51","511","512","513","514","515","517","575","58","76","ALR-67 DIS TYPE Switch, N/I/A/U/F","ALR-67 POWER Pushbutton","APU Control Switch, ON/OFF","APU Fire Warning/Extinguisher Light","AV COOL Switch, NORM/EMERG","Altitude Switch, BARO/RDR","Anti Skid Switch, ON/OFF","Arresting Hook Handle, UP/DOWN","Attitude Selector Switch, INS/AUTO/STBY","Auxiliary Release Switch, ENABLE/NORM","Battery Switch, ON/OFF/ORIDE","Bleed Air Knob, R OFF/NORM/L OFF/OFF","CB FCS CHAN 1, ON/OFF","CB FCS CHAN 2, ON/OFF","CB FCS CHAN 3, ON/OFF","CB FCS CHAN 4, ON/OFF","CB HOOK, ON/OFF","CB LAUNCH BAR, ON/OFF","CB LG, ON/OFF","CB SPD BRK, ON/OFF","COMM 1 Antenna Selector Switch, UPPER/AUTO/LOWER","COMM G XMT Switch, COMM 1/OFF/COMM 2","CRYPTO Switch, HOLD/NORM/ZERO","Cabin Pressure Switch, NORM/DUMP/ RAM/DUMP","Canopy Control Switch, OPEN/HOLD/CLOSE","Canopy Jettison Handle - Pull to jettison","Comm Relay Switch, CIPHER/OFF/PLAIN","Course Set Switch","DISPENSER Switch, BYPASS/ON/OFF","ECM JETT JETT SEL Button - Push to jettison","ECM Mode Switch, XMIT/REC/BIT/STBY/OFF","ECS Mode Switch, AUTO/MAN/ OFF/RAM","Ejection Seat Manual Override Handle, PULL/PUSH","Ejection Seat SAFE/ARMED Handle, SAFE/ARMED","Engine Anti-Ice Switch, ON/OFF/TEST","Engine Crank Switch, LEFT/OFF/RIGHT","Exterior Lights Switch, ON/OFF","External Centerline Tank Fuel Control Switch, STOP/NORM/ORIDE","External Power Switch, RESET/NORM/OFF","External Wing Tanks Fuel Control Switch, STOP/NORM/ORIDE","FCS BIT Switch","FLAP Switch, AUTO/HALF/FULL","FLIR Switch, ON/STBY/OFF","Fire and Bleed Air Test Switch, (RMB) TEST A/(LMB) TEST B","Fuel Dump Switch, ON/OFF","GAIN Switch Cover, OPEN/CLOSE","GAIN Switch, NORM/ORIDE","Generator TIE Control Switch Cover, OPEN/CLOSE","Generator TIE Control Switch, NORM/RESET","Ground Power Switch 1, A ON/AUTO/B ON","Ground Power Switch 2, A ON/AUTO/B ON","Ground Power Switch 3, A ON/AUTO/B ON","Ground Power Switch 4, A ON/AUTO/B ON","HOOK BYPASS Switch, FIELD/CARRIER","HOTAS","HUD Symbology Brightness Selector Knob, DAY/NIGHT","HUD Symbology Reject Switch, NORM/REJ 1/REJ 2","HUD Video Control Switch, W/B /VID/OFF","HYDRAULIC_INTERFACE","Heading Set Switch","Hide Stick toggle","Hydraulic Isolate Override Switch, NORM/ORIDE","ID2163A","IFF Antenna Selector Switch, UPPER/BOTH/LOWER","IFF Master Switch, EMER/NORM","IFF Mode 4 Switch, DIS/AUD /DIS/OFF","ILS Channel Selector Switch","ILS UFC/MAN Switch, UFC/MAN","INS","INS Switch, OFF/CV/GND/NAV/IFA/GYRO/GB/TEST","IR Cooling Switch, ORIDE/NORM/OFF","Internal Wing Tank Fuel Control Switch, INHIBIT/NORM","KY-58 Fill Select Knob, Z 1-5/1/2/3/4/5/6/Z ALL","KY-58 Mode Select Knob, P/C/LD/RV","KY-58 Power Select Knob, OFF/ON/TD","LDG/TAXI LIGHT Switch, ON/OFF","LST/NFLR Switch, ON/OFF","LTD/R Switch, ARM/SAFE/AFT","Launch Bar Control Switch, EXTEND/RETRACT","Left Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control","Left Generator Control Switch, NORM/OFF","Left MDI Brightness Selector Knob, OFF/NIGHT/DAY","Lights Test Switch, TEST/OFF","MC Switch, 1 OFF/NORM/2 OFF","MODE Switch, NVG/NITE/DAY","Master Arm Switch, ARM/SAFE","Mode Selector Switch, MAN/OFF/AUTO","NUC WPN Switch, ENABLE/DISABLE (no function)","OBOGS Control Switch, ON/OFF","Pitot Heater Switch, ON/AUTO","Probe Control Switch, EXTEND/RETRACT/EMERG EXTD","Push to Test Switch, (LMB) activate BIT checks/(MW) rotate clockwise to apply power and set low altitude index pointer","Right Engine/AMAD Fire Warning/Extinguisher Light - (LMB) depress/(RMB) cover control","Right Generator Control Switch, NORM/OFF","Right MDI Brightness Selector Knob, OFF/NIGHT/DAY","SAI Cage Knob, (LMB) Pull to cage (hold RMB and rotate MW to uncage)/(MW) Adjust miniature airplane","STROBE Lights Switch, BRT/OFF/DIM","Seat Height Adjustment Switch, UP/HOLD/DOWN","Selective Jettison Knob, L FUS MSL/SAFE/R FUS MSL/ RACK/LCHR /STORES","Selector Switch, HMD/LDDI/RDDI","Selector Switch, HUD/LDIR/RDDI","Shoulder Harness Control Handle, LOCK/UNLOCK","Spin Recovery Switch Cover, OPEN/CLOSE","Spin Recovery Switch, RCVY/NORM","Station Jettison Select Button, CENTER","Station Jettison Select Button, LEFT IN","Station Jettison Select Button, LEFT OUT","Station Jettison Select Button, RIGHT IN","Station Jettison Select Button, RIGHT OUT","UFC ADF Function Select Switch, 1/OFF/2","UFC COMM 1 Channel Selector Knob","UFC COMM 2 Channel Selector Knob","Windshield Anti-Ice/Rain Switch, ANTI ICE/OFF/RAIN","pnt_107","pnt_11","pnt_124","pnt_126","pnt_135","pnt_138","pnt_139","pnt_140","pnt_142","pnt_144","pnt_147","pnt_148","pnt_153","pnt_155","pnt_157","pnt_159","pnt_161","pnt_175","pnt_176","pnt_213","pnt_233","pnt_234","pnt_236","pnt_237","pnt_238","pnt_239","pnt_248","pnt_258","pnt_261","pnt_27","pnt_277","pnt_291","pnt_293","pnt_297","pnt_30","pnt_312","pnt_313","pnt_314","pnt_331","pnt_332","pnt_333","pnt_334","pnt_335","pnt_336","pnt_339","pnt_340","pnt_341","pnt_342","pnt_343","pnt_344","pnt_347","pnt_348","pnt_350","pnt_351","pnt_352","pnt_353","pnt_354","pnt_355","pnt_356","pnt_365","pnt_368","pnt_369","pnt_373","pnt_374","pnt_375","pnt_377","pnt_378","pnt_379","pnt_381","pnt_382","pnt_383","pnt_384","pnt_402","pnt_403","pnt_404","pnt_405","pnt_408","pnt_409","pnt_410","pnt_411","pnt_416","pnt_419","pnt_42","pnt_439","pnt_441","pnt_442","pnt_443","pnt_444","pnt_446","pnt_447","pnt_452","pnt_453","pnt_454","pnt_455","pnt_456","pnt_457","pnt_470","pnt_49","pnt_494","pnt_497","pnt_498","pnt_499","pnt_507","pnt_51","pnt_511","pnt_512","pnt_513","pnt_514","pnt_515","pnt_517","pnt_575","pnt_76","-0.05","-0.666","0.04","0.05","0.333","0.75","100","101","102","103","106","108","109","110","111","112","113","114","115","116","117","118","119","120","121","122","123","124","125","126","127","128","129","130","131","132","133","134","136","14","141","143","145","146","168","169","170","171","172","173","174","183","184","185","186","187","188","189","190","191","192","193","194","195","196","197","198","199","200","201","202","203","213","214","215","216","224","228","229","230","235","240","26","260","262","263","266","269","27","272","275","28","291","292","296","3031","3032","3033","3034","3107","3127","3128","3130","315","318","337","338","345","346","349","357","358","359","360","361","362","363","364","366","380","406","407","412","413","414","415","417","418","43","445","451","458","459","46","504","505","506","510","52","55","56","57","59","60","61","63","64","65","66","67","68","69","70","72","73","75","77","78","79","80","81","82","83","84","85","86","87","88","89","90","91","92","93","94","95","96","97","98","99","AAU-52 Altimeter Pressure Setting Knob","AAU52","ALR-67 AUDIO Control Knob (no function)","ALR-67 BIT Pushbutton","ALR-67 DISPLAY Pushbutton","ALR-67 DMR Control Knob","ALR-67 OFFSET Pushbutton","ALR-67 SPECIAL Pushbutton","AMPCD Contrast Control Switch, DOWN","AMPCD Contrast Control Switch, UP","AMPCD Gain Control Switch, DOWN","AMPCD Gain Control Switch, UP","AMPCD Night/Day Brightness Selector, DAY","AMPCD Night/Day Brightness Selector, NGT","AMPCD Off/Brightness Control Knob","AMPCD PB 1","AMPCD PB 10","AMPCD PB 11","AMPCD PB 12","AMPCD PB 13","AMPCD PB 14","AMPCD PB 15","AMPCD PB 16","AMPCD PB 17","AMPCD PB 18","AMPCD PB 19","AMPCD PB 2","AMPCD PB 20","AMPCD PB 3","AMPCD PB 4","AMPCD PB 5","AMPCD PB 6","AMPCD PB 7","AMPCD PB 8","AMPCD PB 9","AMPCD Symbology Control Switch, DOWN","AMPCD Symbology Control Switch, UP","AOA Indexer Control Knob","AUX Volume Control Knob","Balance Control Knob","Black Level Control Knob","Bleed Air Knob, AUG PULL","CHART Light Dimmer Control","CONSOLES Lights Dimmer Control","Cabin Temperature Knob","Canopy Jettison Handle Unlock Button - Press to unlock","Defog Handle","Dispense Button - Push to dispense flares and chaff","Down Lock Override Button - Push to unlock","Ejection Control Handle (3 times)","Emergency Jettison Button","FCS RESET Button","FLOOD Light Dimmer Control","FORMATION Lights Dimmer Control","Fire Extinguisher Pushbutton","HMD OFF/BRT Knob","HMD_INTERFACE","HUD Symbology Brightness Control Knob","HUD Video BIT Initiate Pushbutton - Push to initiate BIT","ICS Volume Control Knob","IFEI Brightness Control Knob","IFEI Down Arrow Button","IFEI ET Button","IFEI Mode Button","IFEI QTY Button","IFEI Up Arrow Button","IFEI ZONE Button","INST PNL Dimmer Control","KY-58 Volume Control Knob","Left Louver","Left MDI Brightness Control Knob","Left MDI Contrast Control Knob","Left MDI PB 1","Left MDI PB 10","Left MDI PB 11","Left MDI PB 12","Left MDI PB 13","Left MDI PB 14","Left MDI PB 15","Left MDI PB 16","Left MDI PB 17","Left MDI PB 18","Left MDI PB 19","Left MDI PB 2","Left MDI PB 20","Left MDI PB 3","Left MDI PB 4","Left MDI PB 5","Left MDI PB 6","Left MDI PB 7","Left MDI PB 8","Left MDI PB 9","Left Video Sensor BIT Initiate Pushbutton - Push to initiate BIT","MASTER CAUTION Reset Button - Press to reset","MIDS A Volume Control Knob","MIDS B Volume Control Knob","Master Mode Button, A/A","Master Mode Button, A/G","OXY Flow Knob","POSITION Lights Dimmer Control","RUD TRIM Control","RWR Intensity Knob","RWR Volume Control Knob","Right Louver","Right MDI Brightness Control Knob","Right MDI Contrast Control Knob","Right MDI PB 1","Right MDI PB 10","Right MDI PB 11","Right MDI PB 12","Right MDI PB 13","Right MDI PB 14","Right MDI PB 15","Right MDI PB 16","Right MDI PB 17","Right MDI PB 18","Right MDI PB 19","Right MDI PB 2","Right MDI PB 20","Right MDI PB 3","Right MDI PB 4","Right MDI PB 5","Right MDI PB 6","Right MDI PB 7","Right MDI PB 8","Right MDI PB 9","Right Video Sensor BIT Initiate Pushbutton - Push to initiate BIT","Rudder Pedal Adjust Lever","SAI Test Button - Push to test","Selective Jettison Pushbutton","Suit Temperature Knob","T/O TRIM Button","TACAN Volume Control Knob","Throttles Friction Adjusting Lever","UFC Brightness Control Knob","UFC COMM 1 Volume Control Knob","UFC COMM 2 Volume Control Knob","UFC Emission Control Pushbutton","UFC Function Selector Pushbutton, A/P","UFC Function Selector Pushbutton, BCN","UFC Function Selector Pushbutton, D/L","UFC Function Selector Pushbutton, IFF","UFC Function Selector Pushbutton, ILS","UFC Function Selector Pushbutton, ON/OFF","UFC Function Selector Pushbutton, TCN","UFC I/P Pushbutton","UFC Keyboard Pushbutton, 0","UFC Keyboard Pushbutton, 1","UFC Keyboard Pushbutton, 2","UFC Keyboard Pushbutton, 3","UFC Keyboard Pushbutton, 4","UFC Keyboard Pushbutton, 5","UFC Keyboard Pushbutton, 6","UFC Keyboard Pushbutton, 7","UFC Keyboard Pushbutton, 8","UFC Keyboard Pushbutton, 9","UFC Keyboard Pushbutton, CLR","UFC Keyboard Pushbutton, ENT","UFC Option Select Pushbutton 1","UFC Option Select Pushbutton 2","UFC Option Select Pushbutton 3","UFC Option Select Pushbutton 4","UFC Option Select Pushbutton 5","VOX Volume Control Knob","WARN/CAUTION Dimmer Control","WPN Volume Control Knob","Warning Tone Silence Button - Push to silence","pnt_07","pnt_100","pnt_101","pnt_102","pnt_103","pnt_106","pnt_108","pnt_109","pnt_110","pnt_111","pnt_112","pnt_113","pnt_114","pnt_115","pnt_116","pnt_117","pnt_118","pnt_119","pnt_120","pnt_123","pnt_128","pnt_129","pnt_130","pnt_131","pnt_132","pnt_133","pnt_134","pnt_136","pnt_14","pnt_141","pnt_143","pnt_145","pnt_146","pnt_168","pnt_169","pnt_170","pnt_171","pnt_172","pnt_173","pnt_174","pnt_177_1","pnt_177_2","pnt_179_1","pnt_179_2","pnt_180_1","pnt_180_2","pnt_182_1","pnt_182_2","pnt_183","pnt_184","pnt_185","pnt_186","pnt_187","pnt_188","pnt_189","pnt_190","pnt_191","pnt_192","pnt_193","pnt_194","pnt_195","pnt_196","pnt_197","pnt_198","pnt_199","pnt_200","pnt_201","pnt_202","pnt_203","pnt_215","pnt_216","pnt_224","pnt_229","pnt_230","pnt_235","pnt_260","pnt_262","pnt_263","pnt_266","pnt_269","pnt_272","pnt_275","pnt_315","pnt_318","pnt_337","pnt_338","pnt_345","pnt_346","pnt_349","pnt_357","pnt_358","pnt_359","pnt_360","pnt_361","pnt_362","pnt_363","pnt_364","pnt_366","pnt_380","pnt_406","pnt_407","pnt_412","pnt_413","pnt_414","pnt_415","pnt_417","pnt_418","pnt_43","pnt_445","pnt_451","pnt_458","pnt_459","pnt_46","pnt_47_121","pnt_47_122","pnt_50","pnt_504","pnt_505","pnt_506","pnt_510","pnt_52","pnt_53","pnt_54","pnt_55","pnt_56","pnt_57","pnt_58","pnt_59","pnt_60","pnt_61","pnt_62","pnt_63","pnt_64","pnt_65","pnt_66","pnt_67","pnt_68","pnt_69","pnt_70","pnt_72","pnt_73","pnt_75","pnt_77","pnt_78","pnt_79","pnt_80","pnt_81","pnt_82","pnt_83","pnt_84","pnt_85","pnt_86","pnt_87","pnt_88","pnt_89","pnt_90","pnt_91","pnt_92","pnt_93","pnt_94","pnt_95","pnt_96","pnt_97","pnt_98","pnt_99"]});
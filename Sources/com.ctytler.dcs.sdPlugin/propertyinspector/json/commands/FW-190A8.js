@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"FW-190A8","rows":[285,38,8,387,12,268,0,1,0,289,286,59,8,388,12,269,1,153,0,340,29,19,8,299,12,221,1,1,0,308,29,19,26,298,12,222,1,1,0,307,29,19,15,91,5,67,6,1,0,94,29,19,15,91,5,67,0,1,0,94,29,19,21,300,2,223,0,1,0,309,11,10,8,123,5,75,6,1,0,100,11,10,8,123,5,75,0,1,0,100,11,10,32,124,5,76,6,1,0,99,11,10,32,124,5,76,0,1,0,99,11,10,20,125,5,77,6,1,0,98,11,10,20,125,5,77,0,1,0,98,11,10,33,126,5,78,6,1,0,106,11,10,33,126,5,78,0,1,0,106,11,10,15,127,5,79,6,1,0,107,11,10,15,127,5,79,0,1,0,107,11,10,34,128,5,80,6,1,0,105,11,10,34,128,5,80,0,1,0,105,11,10,21,135,5,87,6,1,0,104,11,10,21,135,5,87,0,1,0,104,11,10,36,130,5,82,1,6,1,116,11,10,36,130,5,82,0,1,0,116,11,10,28,433,12,187,0,152,4,316,48,25,8,403,12,156,1,1,0,303,48,25,15,142,5,58,6,1,0,92,48,25,15,142,5,58,0,1,0,92,3,0,8,146,5,62,6,1,0,37,3,0,8,146,5,62,0,1,0,37,3,0,33,415,2,169,0,1,4,321,3,0,15,417,2,171,0,1,4,339,3,0,34,419,2,173,0,1,4,348,3,0,21,421,2,175,0,1,4,356,3,0,35,423,2,177,0,1,4,302,3,0,68,425,2,179,0,1,4,305,3,0,27,427,2,181,0,1,4,361,3,0,36,429,2,183,0,1,4,343,3,0,28,431,2,185,0,1,4,334,3,0,41,435,2,189,0,1,4,337,3,0,42,437,2,191,0,1,4,297,3,0,43,405,2,158,0,1,4,326,3,0,69,407,2,160,0,1,4,328,3,0,70,409,2,162,0,1,4,288,3,0,224,411,2,164,0,1,4,323,3,0,44,413,2,166,0,1,4,293,3,0,225,439,2,193,0,1,4,330,3,0,45,441,2,195,0,1,4,382,3,0,226,443,2,197,0,1,4,352,3,0,46,445,2,199,0,1,4,366,3,0,227,447,2,201,0,1,4,364,3,0,228,449,2,203,0,1,4,378,3,0,229,451,2,205,0,1,4,291,3,0,230,453,2,207,0,1,4,354,3,0,231,455,2,209,0,1,4,371,3,0,232,457,2,211,0,1,4,380,3,0,233,459,2,213,0,1,4,332,3,0,234,465,2,219,0,1,4,358,3,0,235,461,2,215,0,1,4,345,3,0,236,463,2,217,0,1,4,319,3,0,237,416,2,170,0,1,4,320,3,0,238,418,2,172,0,1,4,338,3,0,239,420,2,174,0,1,4,347,3,0,240,422,2,176,0,1,4,355,3,0,241,424,2,178,0,1,4,301,3,0,242,426,2,180,0,1,4,304,3,0,243,428,2,182,0,1,4,360,3,0,244,430,2,184,0,1,4,342,3,0,245,432,2,186,0,1,4,333,3,0,246,436,2,190,0,1,4,336,3,0,247,438,2,192,0,1,4,296,3,0,248,404,2,157,0,1,4,325,3,0,249,406,2,159,0,1,4,327,3,0,250,408,2,161,0,1,4,287,3,0,251,410,2,163,0,1,4,322,3,0,252,412,2,165,0,1,4,292,3,0,253,440,2,194,0,1,4,329,3,0,254,442,2,196,0,1,4,381,3,0,255,444,2,198,0,1,4,351,3,0,256,446,2,200,0,1,4,365,3,0,257,448,2,202,0,1,4,363,3,0,258,450,2,204,0,1,4,377,3,0,259,452,2,206,0,1,4,290,3,0,260,454,2,208,0,1,4,353,3,0,261,456,2,210,0,1,4,370,3,0,262,458,2,212,0,1,4,379,3,0,263,460,2,214,0,1,4,331,3,0,264,466,2,220,0,1,4,357,3,0,265,462,2,216,0,1,4,344,3,0,266,464,2,218,0,1,4,318,3,0,267,395,2,277,0,1,0,324,3,0,71,147,5,63,6,1,0,37,3,0,71,147,5,63,0,1,0,37,14,13,26,129,5,81,150,1,53,108,14,13,26,129,5,81,18,1,53,108,14,13,15,138,5,54,6,1,0,117,14,13,15,138,5,54,0,1,0,117,14,13,21,139,2,55,1,1,24,118,14,13,35,139,2,55,0,24,0,118,14,13,27,149,5,66,6,1,0,119,14,13,27,149,5,66,0,1,0,119,14,13,28,141,5,57,6,1,0,93,14,13,28,141,5,57,0,1,0,93,14,13,41,383,2,25,0,1,0,311,14,13,42,384,2,25,6,1,0,310,14,13,69,401,2,284,0,1,0,372,23,22,8,136,5,88,30,1,18,102,23,22,8,136,5,88,31,1,18,102,23,22,32,137,5,89,151,1,0,101,23,22,32,137,5,89,24,1,0,101,23,22,35,434,2,188,0,1,0,362,23,22,68,399,2,282,0,1,0,335,49,39,8,134,5,86,6,6,0,103,49,39,8,134,5,86,0,6,0,103,49,39,20,398,2,280,0,1,0,341,350,275,8,394,12,276,1,1,0,346,50,47,8,148,5,65,6,1,0,112,50,47,8,148,5,65,0,1,0,112,50,47,20,402,12,155,1,1,24,359,51,40,8,414,12,167,24,1,0,306,51,40,26,143,5,60,6,1,0,95,51,40,26,143,5,60,0,1,0,95,367,168,8,389,12,270,1,1,0,317,17,16,8,132,5,84,30,1,18,113,17,16,8,132,5,84,31,1,18,113,17,16,20,397,12,279,1,1,0,369,17,16,15,133,5,85,6,1,0,97,17,16,15,133,5,85,0,1,0,97,17,16,21,396,12,278,1,1,0,368,17,16,72,131,5,83,30,1,18,114,17,16,72,131,5,83,31,1,18,114,9,7,8,121,5,73,6,1,0,110,9,7,8,121,5,73,0,1,0,110,9,7,20,390,12,271,0,1,0,373,9,7,33,391,12,272,0,1,0,374,9,7,34,392,12,273,0,1,0,375,9,7,35,393,12,274,0,1,0,376,9,7,27,120,5,38,6,1,0,96,9,7,27,120,5,38,0,1,0,96,9,7,36,294,2,19,0,1,0,312,9,7,28,385,2,281,0,1,0,313,9,7,41,386,2,154,0,1,0,314,9,7,42,295,2,59,0,1,0,315,9,7,43,140,5,56,30,1,52,90,9,7,43,140,5,56,31,1,52,90,9,7,70,400,2,283,0,1,0,349,9,7,44,122,5,74,6,1,0,111,9,7,44,122,5,74,0,1,0,111,9,7,45,144,5,61,6,1,0,109,9,7,45,144,5,61,0,1,0,109,9,7,46,145,5,64,6,1,0,115,9,7,46,145,5,64,0,1,0,115],"strings":["1","0","BTN","ELEC_INTERFACE","","TUMB","-1","20","3001","WEAPON_SYSTEM","8","CONTROL_SYSTEM","LEV","2","ENGINE_SYSTEM","3006","15","VHF_RADIO","0.3","13","3003","3008","6","FUEL_SYSTEM","0.5","3","3004","3011","3013","CLOCK","-0.1","0.1","3002","3005","3007","3009","3012","Circuit Breakers Cover","10","16","21","3014","3015","3016","3020","3022","3024","4","CPT_MECH","IFF","OXYGEN_SYSTEM","PILOT_SIGHT","0.4","0.9","104","105","109","111","115","12","134","135","138","139","140","190","200","27","3010","3017","3018","3077","3111","48","49","62","63","64","65","66","67","75","77","80","81","84","86","89","90","99","Bomb Fusing Selector","CLK_SET","Canopy Emergency Release Handle","Cockpit.Bf109K4.cb_e103","Cockpit.Bf109K4.clock_stop","Cockpit.Bf109K4.gun_sight_tint","Cockpit.FW190A8.safety","FT FT / Y ZF Mode Switch","Flaps Landing","Flaps Take Off","Flaps Up","Fuel Gauge Selector (FORWARD/NONE/AFT)","Fuel Tank Selector Valve (CLOSE/FORWARD/BOTH/AFT)","IFF Channel Selector","Landing Gear Emergency Release Handle","Landing Gears Extending","Landing Gears Retraction","Landing Gears Retraction Cover","Magneto Switch","Main Rocket Switch","Master Arm","Outer Wing Guns Arm","Oxygen Emergency Knob","Radio Channel Selector","Radio WIP","Rocket Emergency Release","Stabilizer Trimmer Up/Down","Starter Switch Cover","Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch","Throttle Lock","pntr_010","pntr_048","pntr_049","pntr_062","pntr_063","pntr_064","pntr_065","pntr_066","pntr_067","pntr_075","pntr_077","pntr_080","pntr_081","pntr_084","pntr_086","pntr_089","pntr_090","pntr_099","pntr_104","pntr_105","pntr_109","pntr_111","pntr_115","pntr_134","pntr_135","pntr_136","pntr_138","pntr_139","pntr_190","pntr_200","-0.3","-0.5","0.01","0.511","11","110","114","120","121","122","123","124","125","126","127","128","129","133","14","141","142","143","144","145","146","147","148","149","150","151","152","153","154","155","156","157","158","159","162","170","171","172","173","174","175","176","177","178","179","180","181","182","183","184","185","186","187","188","189","191","192","196","197","201","202","203","211","212","213","214","215","25","26","28","3019","3021","3023","3025","3026","3027","3028","3029","3030","3031","3032","3033","3034","3040","3041","3042","3043","3044","3045","3046","3047","3048","3049","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","3063","3064","3065","3066","3067","3068","3069","3075","34","39","43","51","54","57","60","7","78","79","82","83","88","9","91","92","93","ALTIMETER","ARTIFICIAL_HORIZON","Aft Tank Fuel Pump cb_Off","Aft Tank Fuel Pump cb_On","Altimeter Pressure Set","Artificial Horizon cb_Off","Artificial Horizon cb_On","Aux. Tank Fuel Pump cb_Off","Aux. Tank Fuel Pump cb_On","BUTTON_A","BUTTON_T","Battery cb_Off","Battery cb_On","CLK_PINION","CLK_SCALE","CLK_SW","Cabin Illumination cb_Off","Cabin Illumination cb_On","Canopy Hand Crank","Clothes Heating cb_Off","Clothes Heating cb_On","Cockpit.Bf109K4.cb_p112","Cockpit.Bf109K4.clock_pinion","Cockpit.Bf109K4.clock_scale","Cockpit.Bf109K4.clock_stopwatch","Cockpit.Bf109K4.pitch_minus","Cockpit.Bf109K4.pitch_plus","Cockpit.FW190A8.trigger_a","Cockpit.FW190A8.trigger_b1","Cockpit.FW190A8.trigger_b2","Cockpit.FW190A8.trigger_t","Cooling Flaps Control","Course Set","Cowling Guns cb_Off","Cowling Guns cb_On","Drop Ordnance & Optional Armament cb_Off","Drop Ordnance & Optional Armament cb_On","Drop Tank Fuel Pump cb_Off","Drop Tank Fuel Pump cb_On","Electric Kill-switch","External Power cb_Off","External Power cb_On","Fore Tank Fuel Pump cb_Off","Fore Tank Fuel Pump cb_On","FuG 16 ZY Radio cb_Off","FuG 16 ZY Radio cb_On","FuG 25a IFF Self-Destruct cb_Off","FuG 25a IFF Self-Destruct cb_On","FuG 25a IFF cb_Off","FuG 25a IFF cb_On","Fuel cross-feed valve","Generator cb_Off","Generator cb_On","Gun Sight and Gun Camera cb_Off","Gun Sight and Gun Camera cb_On","Horizon Cage","IFF Check","Ignition cb_Off","Ignition cb_On","Inner Wing Guns cb_Off","Inner Wing Guns cb_On","Instrument Lights Brightness","Instruments cb_Off","Instruments cb_On","Jettison Fuselage Stores","LIGHT_SYSTEM","Landing Flaps cb_Off","Landing Flaps cb_On","Motor-Generator cb_Off","Motor-Generator cb_On","Navigation Lights cb_Off","Navigation Lights cb_On","Outer Wing Guns cb_Off","Outer Wing Guns cb_On","Oxygen Flow Valve","Pitot Heating cb_Off","Pitot Heating cb_On","Primer Pump","Prop. Pitch Controls cb_Off","Prop. Pitch Controls cb_On","Prop. Pitch Drive cb_Off","Prop. Pitch Drive cb_On","REMOTE_COMPASS","Radio Tuning (+/-30 kHz)","Radio Volume","Repeater Compass cb_Off","Repeater Compass cb_On","Retract starter brushes","Set Gun 1 Ammunition Count","Set Gun 2 Ammunition Count","Set Gun 3 Ammunition Count","Set Gun 4 Ammunition Count","Stabilizer Trim cb_Off","Stabilizer Trim cb_On","Undercarriage Controls cb_Off","Undercarriage Controls cb_On","Undercarriage Drives cb_Off","Undercarriage Drives cb_On","pntr_003_1","pntr_003_2","pntr_009","pntr_011","pntr_034","pntr_039","pntr_043","pntr_051","pntr_054","pntr_057","pntr_060","pntr_078","pntr_079","pntr_082","pntr_083","pntr_088","pntr_091","pntr_092","pntr_093","pntr_110","pntr_114","pntr_120","pntr_121","pntr_122","pntr_123","pntr_124","pntr_125","pntr_126","pntr_127","pntr_128","pntr_129","pntr_133","pntr_141","pntr_142","pntr_143","pntr_144","pntr_145","pntr_146","pntr_147","pntr_148","pntr_149","pntr_150","pntr_151","pntr_152","pntr_153","pntr_154","pntr_155","pntr_156","pntr_157","pntr_158","pntr_159","pntr_162","pntr_170","pntr_171","pntr_172","pntr_173","pntr_174","pntr_175","pntr_176","pntr_177","pntr_178","pntr_179","pntr_180","pntr_181","pntr_182","pntr_183","pntr_184","pntr_185","pntr_186","pntr_187","pntr_188","pntr_189","pntr_191","pntr_192","pntr_196","pntr_197","pntr_201","pntr_202","pntr_203","pntr_211","pntr_212","pntr_213","pntr_214","pntr_215"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"FW-190D9","rows":[216,144,7,275,8,202,0,1,0,219,217,147,7,276,8,203,1,143,0,245,31,27,7,272,8,181,1,1,0,226,31,27,29,273,8,182,1,1,0,225,31,27,14,110,2,61,5,1,0,82,31,27,14,110,2,61,0,1,0,82,31,27,20,274,3,183,0,1,0,227,10,9,7,112,2,63,5,1,0,89,10,9,7,112,2,63,0,1,0,89,10,9,28,113,2,64,5,1,0,88,10,9,28,113,2,64,0,1,0,88,10,9,16,114,2,65,5,1,0,87,10,9,16,114,2,65,0,1,0,87,10,9,33,115,2,66,5,1,0,95,10,9,33,115,2,66,0,1,0,95,10,9,14,116,2,67,5,1,0,96,10,9,14,116,2,67,0,1,0,96,10,9,24,117,2,68,5,1,0,94,10,9,24,117,2,68,0,1,0,94,10,9,20,123,2,75,5,1,0,93,10,9,20,123,2,75,0,1,0,93,10,9,30,119,2,70,1,5,1,106,10,9,30,119,2,70,0,1,0,106,10,9,34,316,8,177,0,1,0,263,43,39,7,287,8,146,1,1,0,224,43,39,14,132,2,53,5,1,0,80,43,39,14,132,2,53,0,1,0,80,4,0,7,135,2,56,5,1,0,81,4,0,7,135,2,56,0,1,0,81,4,0,33,300,3,161,0,1,6,236,4,0,14,302,3,163,0,1,6,253,4,0,24,304,3,165,0,1,6,260,4,0,20,306,3,167,0,1,6,242,4,0,40,308,3,169,0,1,6,240,4,0,41,310,3,171,0,1,6,249,4,0,22,312,3,173,0,1,6,244,4,0,30,314,3,175,0,1,6,223,4,0,34,289,3,149,0,1,6,257,4,0,184,291,3,151,0,1,6,238,4,0,42,293,3,153,0,1,6,266,4,0,185,295,3,155,0,1,6,221,4,0,186,297,3,157,0,1,6,255,4,0,187,301,3,162,0,1,6,235,4,0,188,303,3,164,0,1,6,252,4,0,189,305,3,166,0,1,6,259,4,0,190,307,3,168,0,1,6,241,4,0,191,309,3,170,0,1,6,239,4,0,192,311,3,172,0,1,6,248,4,0,193,313,3,174,0,1,6,243,4,0,194,315,3,176,0,1,6,222,4,0,195,288,3,148,0,1,6,256,4,0,196,290,3,150,0,1,6,237,4,0,197,292,3,152,0,1,6,218,4,0,198,294,3,154,0,1,6,220,4,0,199,296,3,156,0,1,6,254,4,0,200,282,3,211,0,1,0,233,4,0,201,318,3,179,0,1,0,234,15,13,29,118,2,69,141,1,47,100,15,13,29,118,2,69,26,1,47,100,15,13,14,127,2,48,5,1,0,107,15,13,14,127,2,48,0,1,0,107,15,13,20,128,3,49,1,1,32,108,15,13,40,128,3,49,0,32,0,108,15,13,22,139,2,60,5,1,0,109,15,13,22,139,2,60,0,1,0,109,15,13,34,125,2,77,5,1,0,97,15,13,34,125,2,77,0,1,0,97,15,13,42,122,2,73,5,1,0,98,15,13,42,122,2,73,0,1,0,98,21,19,7,133,2,54,5,1,0,84,21,19,7,133,2,54,0,1,0,84,21,19,28,298,8,158,0,1,0,232,21,19,16,271,8,35,0,1,0,231,21,19,29,299,8,159,0,1,0,230,21,19,22,134,2,55,5,1,0,85,21,19,22,134,2,55,0,1,0,85,21,19,30,319,8,180,0,1,0,229,18,17,7,124,2,76,36,1,26,91,18,17,7,124,2,76,37,1,26,91,18,17,28,126,2,78,142,1,0,90,18,17,28,126,2,78,32,1,0,90,18,17,16,137,2,58,5,1,0,99,18,17,16,137,2,58,0,1,0,99,18,17,24,136,2,57,5,5,0,83,18,17,24,136,2,57,0,5,0,83,18,17,40,317,3,178,0,1,0,261,44,38,7,140,2,74,5,5,0,92,44,38,7,140,2,74,0,5,0,92,44,38,16,321,3,214,0,1,0,246,251,209,7,281,8,210,1,1,0,247,45,35,7,138,2,59,5,1,0,103,45,35,7,138,2,59,0,1,0,103,45,35,16,286,8,145,1,1,32,258,262,160,7,320,8,204,1,1,0,228,25,23,7,120,2,71,36,1,26,104,25,23,7,120,2,71,37,1,26,104,25,23,16,284,8,213,1,1,0,265,25,23,14,121,2,72,5,1,0,86,25,23,14,121,2,72,0,1,0,86,25,23,20,283,8,212,1,1,0,264,12,11,16,111,2,62,5,1,0,102,12,11,16,111,2,62,0,1,0,102,12,11,29,277,8,205,0,1,0,267,12,11,33,278,8,206,0,1,0,268,12,11,14,279,8,207,0,1,0,269,12,11,24,280,8,208,0,1,0,270,12,11,20,129,2,50,5,1,0,101,12,11,20,129,2,50,0,1,0,101,12,11,41,130,2,51,5,1,0,105,12,11,41,130,2,51,0,1,0,105,12,11,22,131,2,52,36,1,46,79,12,11,22,131,2,52,37,1,46,79,12,11,30,285,3,215,0,1,0,250],"strings":["1","0","TUMB","BTN","ELEC_INTERFACE","-1","","3001","LEV","8","CONTROL_SYSTEM","20","WEAPON_SYSTEM","2","3006","ENGINE_SYSTEM","3003","6","FUEL_SYSTEM","21","3008","EZ42_GUNSIGHT","3011","15","3007","VHF_RADIO","0.3","13","3002","3004","3012","CLOCK","0.5","3005","3013","4","-0.1","0.1","16","3","3009","3010","3015","CPT_MECH","IFF","OXYGEN_SYSTEM","0.4","0.9","104","105","107","108","109","115","132","134","138","160","161","190","200","26","48","62","63","64","65","66","67","75","77","81","84","85","86","89","90","91","99","Bomb Fusing Selector","Canopy Emergency Release Handle","Circuit Breakers Cover","Cockpit.Bf109K4.clock_stop","Cold Start/Wind Screen Washer","EZ42 Gunsight Gyro Power Switch, ON/OFF","EZ42 Gunsight Night Lens Filter, ON/OFF","FT FT / Y ZF Mode Switch","Flaps Landing","Flaps Take Off","Flaps Up","Fuel Gauge Selector (FORWARD/NONE/AFT)","Fuel Tank Selector Valve (CLOSE/FORWARD/AFT/BOTH)","IFF Channel Selector","Landing Gear Emergency Release Handle","Landing Gears Extending","Landing Gears Retraction","Landing Gears Retraction Cover","MBG Emergency Mode Handle","MW-50 Switch","MW-B4 Selector (Not Functional)","Magneto Switch","Main Rocket Switch","Master Arm","Oxygen Emergency Knob","Radio Channel Selector","Rocket Emergency Release","Stabilizer Trimmer Up/Down","Starter Switch Cover","Starter Switch. Left Button - Starter Power. Right Button - Magnetic Clutch","Throttle Lock","pntr_026","pntr_048","pntr_062","pntr_063","pntr_064","pntr_065","pntr_066","pntr_067","pntr_075","pntr_077","pntr_081","pntr_084","pntr_085","pntr_089","pntr_090","pntr_091","pntr_099","pntr_104","pntr_105","pntr_107","pntr_108","pntr_109","pntr_115","pntr_132","pntr_134","pntr_138","pntr_160","pntr_161","pntr_190","pntr_200","pntr_86","-0.3","-0.5","0.511","10","110","114","12","120","121","122","123","124","125","126","127","128","129","131","135","14","141","142","143","144","145","146","147","148","149","150","151","152","153","154","155","156","159","162","163","191","24","25","28","3014","3016","3017","3018","3019","3020","3021","3022","3023","3024","3025","3026","3027","3028","3029","3030","3031","3032","34","39","43","51","54","57","60","7","78","79","82","83","88","92","ALTIMETER","ARTIFICIAL_HORIZON","Aft Tank Pump Off","Altimeter Pressure Set","Auxiliary Tank Pump Off","Auxiliary Tank Pump On","Battery Off","Battery On","Canopy Hand Crank","Cockpit.Bf109K4.clock_pinion","Cockpit.Bf109K4.clock_scale","Cockpit.Bf109K4.clock_stopwatch","Course Set","EZ42 Gunsight Altitude Aiming Correction Adjusting Knob I","EZ42 Gunsight Brightness Control","EZ42 Gunsight Target Distance Control","EZ42 Gunsight Target Wingspan Knob","Electric Kill-switch","Emergency Equipment Destruction","Flaps, Trimmer, Artificial Horizon Power Off","Flaps, Trimmer, Artificial Horizon Power On","Forward Tank Pump Off","Forward Tank Pump On","FuG16ZY Off","FuG16ZY On","FuG25a Off","FuG25a On","Generator Off","Generator On","Horizon Cage","IFF Check","Instrument Lights Brightness","Instrument Lights, Gun-sight, Indicators, Compass, Starter Off","Instrument Lights, Gun-sight, Indicators, Compass, Starter On","Jettison Fuselage Stores","LIGHT_SYSTEM","Landing Gear Power Off","Landing Gear Power On","MW-50 Off","MW-50 On","Navigation Lights Off","Navigation Lights On","Oxygen Flow Valve","Pitot and Heating Cover Off","Pitot and Heating Cover On","Primer Pump","REMOTE_COMPASS","Radiator Flaps Control","Radio Tuning (+/-30 kHz)","Radio Volume","Rear Tank Pump On","Set Gun 1 Ammunition Count","Set Gun 2 Ammunition Count","Set Gun 3 Ammunition Count","Set Gun 4 Ammunition Count","pntr_004","pntr_024","pntr_025","pntr_028","pntr_034","pntr_039","pntr_051","pntr_054","pntr_057","pntr_060","pntr_078","pntr_079","pntr_082","pntr_083","pntr_092","pntr_110","pntr_114","pntr_120","pntr_121","pntr_122","pntr_123","pntr_124","pntr_125","pntr_126","pntr_127","pntr_128","pntr_129","pntr_131","pntr_135","pntr_141","pntr_142","pntr_143","pntr_144","pntr_145","pntr_146","pntr_147","pntr_148","pntr_149","pntr_150","pntr_151","pntr_152","pntr_153","pntr_154","pntr_155","pntr_156","pntr_159","pntr_162","pntr_163","pntr_191","pntr_43","pntr_88"]});
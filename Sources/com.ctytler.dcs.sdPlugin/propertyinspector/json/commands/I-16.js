@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"I-16","rows":[9,0,122,177,12,139,1,1,0,151,9,0,43,99,2,57,107,1,0,80,9,0,43,99,2,57,110,1,0,80,9,0,126,181,12,143,1,1,0,165,9,0,44,100,2,58,1,1,0,70,9,0,44,100,2,58,0,1,0,70,9,0,45,101,2,59,1,1,0,77,9,0,45,101,2,59,0,1,0,77,9,0,46,102,2,60,1,1,0,72,9,0,46,102,2,60,0,1,0,72,9,0,51,105,2,61,1,1,0,82,9,0,51,105,2,61,0,1,0,82,4,3,30,86,2,23,10,1,0,66,4,3,30,86,2,23,0,1,0,66,4,3,31,87,2,24,10,1,0,74,4,3,31,87,2,24,0,1,0,74,4,3,32,88,2,25,10,1,0,73,4,3,32,88,2,25,0,1,0,73,4,3,33,89,2,26,10,1,0,64,4,3,33,89,2,26,0,1,0,64,4,3,34,90,2,27,10,1,0,81,4,3,34,90,2,27,0,1,0,81,4,3,35,91,2,28,10,1,0,76,4,3,35,91,2,28,0,1,0,76,4,3,115,170,7,113,0,0,8,152,4,3,116,171,7,133,0,0,8,153,4,3,117,172,7,134,0,0,8,160,4,3,119,174,12,136,1,1,0,166,4,3,120,175,12,137,1,1,0,150,4,3,132,187,7,149,0,0,8,168,15,14,39,95,2,53,1,1,0,69,15,14,39,95,2,53,0,1,0,69,15,14,40,96,2,54,1,1,0,68,15,14,40,96,2,54,0,1,0,68,15,14,41,97,2,55,1,1,0,65,15,14,41,97,2,55,0,1,0,65,6,5,29,85,2,22,108,1,21,71,6,5,29,85,2,22,111,1,21,71,6,5,114,169,7,112,0,0,8,159,6,5,118,173,7,135,0,0,8,164,6,5,36,92,7,49,1,16,1,83,6,5,36,92,7,49,0,16,0,83,6,5,37,93,2,50,19,1,0,75,6,5,37,93,2,50,16,1,0,75,6,5,121,176,12,138,8,1,0,167,6,5,38,94,2,52,19,1,0,84,6,5,38,94,2,52,16,1,0,84,6,5,42,98,2,56,10,1,0,67,6,5,42,98,2,56,0,1,0,67,6,5,125,180,7,142,0,0,8,158,18,17,129,184,12,146,1,1,0,161,18,17,130,185,12,147,1,1,0,162,18,17,131,186,12,148,1,1,0,163,13,11,123,178,7,140,0,0,8,156,13,11,124,179,7,141,0,0,8,157,13,11,127,182,7,144,0,0,8,154,13,11,128,183,7,145,0,0,8,155,13,11,47,103,2,62,106,1,20,78,13,11,47,103,2,62,109,1,20,78,13,11,48,104,2,63,10,1,0,79,13,11,48,104,2,63,0,1,0,79],"strings":["1","0","TUMB","5","ELECTRIC_SYSTEM","2","MOTOR_SYSTEM","BTN","","COMMON_SYSTEM","-1","7","LEV","WEAPON_SYSTEM","3","GEAR_SYSTEM","0.5","6","OXYGEN_SYSTEM","-0.5","0.935","1.002","22","23","24","25","26","27","28","3022","3023","3024","3025","3026","3027","3028","3036","3037","3046","3050","3051","3055","3062","3065","3067","3068","3069","3087","3088","36","37","3700","46","50","51","55","62","65","67","68","69","700","87","88","Accumulator","Brake spring handle","Clock heat","Fuel valve","Gear direction","Gear lock","Left door","Magneto","Mech sight","Nav light","Pitot heat","Primary fuel switch","Radio","Right door","Rockets/bombs counter","Rockets/bombs master arm","Seat level","Shunt","Sight filter","Starter handle","Supercharge speed 1 - 0 - 2","pnt_022","pnt_023","pnt_024","pnt_025","pnt_026","pnt_027","pnt_028","pnt_036","pnt_037","pnt_046","pnt_050","pnt_051","pnt_055","pnt_062","pnt_065","pnt_067","pnt_068","pnt_069","pnt_087","pnt_088","pnt_700","-0.055","-0.25","-0.334","0.055","0.25","0.334","29","30","3029","3030","3031","3032","3033","3034","3035","3038","3040","3060","3061","3064","3066","3070","3071","3074","3075","3076","3089","31","32","33","34","35","38","40","60","61","64","66","70","71","74","75","76","89","Cockpit light rheostat","Course cage knob","Fire left torch","Fire right torch","Gun nose left recharge","Gun nose right recharge","Gun wing left recharge","Gun wing right recharge","Manual ratchet relay","Motor shutdown","Nav light test","Oxygen adjusting valve","Oxygen emergency valve","Oxygen shutoff valve","Ratchet relay","Set pressure","Sight dimmer rheostat","Start pump","Torches jettison","pnt_029","pnt_030","pnt_031","pnt_032","pnt_033","pnt_034","pnt_035","pnt_039","pnt_040","pnt_060","pnt_061","pnt_064","pnt_066","pnt_070","pnt_071","pnt_074","pnt_075","pnt_076","pnt_089"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"JF-17","rows":[32,1,52,357,3,211,6,1,0,261,32,1,52,357,3,211,0,1,0,261,12,11,112,338,3,192,6,1,0,268,12,11,112,338,3,192,0,1,0,268,12,11,548,1082,13,756,1,1,0,822,12,11,114,340,3,194,6,1,0,267,12,11,114,340,3,194,0,1,0,267,12,11,549,1083,2,757,0,1,0,799,12,11,550,1084,2,758,0,1,0,53,12,11,551,1085,2,759,0,1,0,53,12,11,552,1086,2,760,0,1,0,53,12,11,553,1087,2,761,0,1,0,804,12,11,554,1088,2,762,0,1,0,815,12,11,555,1089,2,763,0,1,0,800,12,11,556,1090,2,764,0,1,0,807,12,11,557,1091,2,765,0,1,0,811,12,11,558,1092,2,766,0,1,0,814,12,11,559,1093,2,767,0,1,0,809,12,11,560,1094,2,768,0,1,0,812,12,11,561,1095,2,769,0,1,0,802,12,11,562,1096,2,770,0,1,0,803,12,11,563,1097,2,771,0,1,0,808,12,11,564,1098,2,772,0,1,0,805,12,11,565,1099,2,773,0,1,0,806,12,11,566,1100,2,774,0,1,0,817,12,11,567,1101,2,775,0,1,0,818,12,11,568,1102,2,776,0,1,0,813,12,11,569,1103,2,777,0,1,0,801,12,11,570,1104,2,778,0,1,0,816,12,11,571,1105,2,779,0,1,0,810,27,26,572,1106,13,780,1,1,0,823,27,26,115,341,3,195,6,1,0,271,27,26,115,341,3,195,0,1,0,271,27,26,116,342,3,196,6,1,0,365,27,26,116,342,3,196,0,1,0,365,27,26,117,343,3,197,6,1,0,371,27,26,117,343,3,197,0,1,0,371,27,26,573,1107,13,781,1,1,0,824,27,26,574,1108,13,782,1,1,0,1171,27,26,575,1109,13,783,1,1,0,913,820,711,536,1070,13,744,51,1,0,821,34,33,107,333,3,186,6,1,0,242,34,33,107,333,3,186,0,1,0,242,34,33,541,1075,2,749,0,1,0,862,34,33,542,1076,2,750,0,1,0,863,34,33,543,1077,2,751,0,1,0,865,34,33,544,1078,2,752,0,1,0,864,240,187,580,1114,2,788,0,1,0,860,240,187,587,1122,2,796,0,1,0,859,39,37,118,344,3,198,379,1,56,227,39,37,118,344,3,198,381,1,56,227,39,37,119,345,3,199,42,1,0,244,39,37,119,345,3,199,44,1,0,244,39,37,576,1110,2,784,0,1,0,861,35,0,109,335,3,189,6,1,0,232,35,0,109,335,3,189,0,1,0,232,35,0,110,336,3,190,6,1,0,278,35,0,110,336,3,190,0,1,0,278,35,0,111,337,3,191,6,1,0,239,35,0,111,337,3,191,0,1,0,239,866,614,383,1121,2,795,0,1,0,798,17,16,74,300,3,153,6,1,0,254,17,16,74,300,3,153,0,1,0,254,17,16,75,301,3,154,6,1,0,225,17,16,75,301,3,154,0,1,0,225,17,16,387,920,2,592,0,1,0,874,17,16,76,302,3,155,6,6,0,255,17,16,76,302,3,155,0,6,0,255,17,16,77,303,3,156,6,1,0,368,17,16,77,303,3,156,0,1,0,368,17,16,78,304,3,157,6,1,0,224,17,16,78,304,3,157,0,1,0,224,17,16,79,305,3,158,6,1,0,229,17,16,79,305,3,158,0,1,0,229,17,16,80,306,3,159,6,6,0,373,17,16,80,306,3,159,0,6,0,373,17,16,98,324,3,177,6,1,0,226,17,16,98,324,3,177,0,1,0,226,17,16,405,938,13,610,1,32,32,1174,17,16,406,939,2,611,0,1,0,1175,17,16,407,940,2,612,0,1,0,1172,17,16,408,941,2,613,0,1,0,1173,10,9,68,294,3,147,43,6,0,259,10,9,68,294,3,147,46,6,0,259,10,9,81,307,3,160,6,1,0,366,10,9,81,307,3,160,0,1,0,366,10,9,82,308,3,161,6,1,0,245,10,9,82,308,3,161,0,1,0,245,10,9,83,309,3,162,6,1,0,378,10,9,83,309,3,162,0,1,0,378,10,9,84,310,3,163,6,1,0,243,10,9,84,310,3,163,0,1,0,243,10,9,85,311,3,164,6,1,0,230,10,9,85,311,3,164,0,1,0,230,10,9,86,312,2,165,6,1,0,377,10,9,86,312,2,165,0,6,1,377,10,9,87,313,3,166,6,1,0,262,10,9,87,313,3,166,0,1,0,262,10,9,88,314,3,167,6,1,0,263,10,9,88,314,3,167,0,1,0,263,10,9,89,315,3,168,6,1,0,221,10,9,89,315,3,168,0,1,0,221,10,9,90,316,3,169,6,1,0,218,10,9,90,316,3,169,0,1,0,218,10,9,390,923,2,595,0,1,0,869,10,9,103,329,3,182,6,6,0,241,10,9,103,329,3,182,0,6,0,241,10,9,128,354,3,208,6,1,0,237,10,9,128,354,3,208,0,1,0,237,10,9,129,355,3,209,42,1,0,236,10,9,129,355,3,209,44,1,0,236,10,9,581,1115,13,789,1,1,0,825,25,24,69,295,3,148,6,1,0,258,25,24,69,295,3,148,0,1,0,258,25,24,70,296,3,149,6,1,0,257,25,24,70,296,3,149,0,1,0,257,25,24,71,297,3,150,6,1,0,223,25,24,71,297,3,150,0,1,0,223,25,24,72,298,3,151,6,1,0,222,25,24,72,298,3,151,0,1,0,222,25,24,73,299,3,152,6,1,0,265,25,24,73,299,3,152,0,1,0,265,25,24,101,327,3,180,6,6,0,220,25,24,101,327,3,180,0,6,0,220,22,20,384,917,2,589,0,1,0,880,22,20,59,285,3,138,6,1,0,274,22,20,59,285,3,138,0,1,0,274,22,20,60,286,3,139,6,1,0,273,22,20,60,286,3,139,0,1,0,273,22,20,385,918,13,590,1,1,0,879,22,20,61,287,3,140,6,1,0,272,22,20,61,287,3,140,0,1,0,272,22,20,65,291,3,144,6,6,0,234,22,20,65,291,3,144,0,6,0,234,22,20,66,292,3,145,43,6,0,233,22,20,66,292,3,145,46,6,0,233,22,20,537,1071,13,745,1,1,0,867,22,20,126,352,3,206,6,1,0,252,22,20,126,352,3,206,0,1,0,252,22,20,127,353,3,207,380,1,0,253,22,20,127,353,3,207,382,1,0,253,269,57,113,339,3,193,42,1,0,270,269,57,113,339,3,193,44,1,0,270,19,18,391,924,13,596,1,32,32,1137,19,18,96,322,3,175,6,1,0,372,19,18,96,322,3,175,0,1,0,372,19,18,97,323,3,176,49,1,0,364,19,18,97,323,3,176,50,1,0,364,19,18,392,925,2,597,0,1,0,1136,19,18,393,926,2,598,0,1,0,1126,19,18,394,927,2,599,0,1,0,1127,19,18,395,928,2,600,0,1,0,1128,19,18,396,929,2,601,0,1,0,1129,19,18,397,930,2,602,0,1,0,1130,19,18,398,931,2,603,0,1,0,1131,19,18,399,932,2,604,0,1,0,1132,19,18,400,933,2,605,0,1,0,1133,19,18,401,934,2,606,0,1,0,1134,19,18,402,935,2,607,0,1,0,1135,19,18,403,936,2,608,0,1,0,1125,19,18,404,937,2,609,0,1,0,1124,15,14,67,293,3,146,6,6,0,276,15,14,67,293,3,146,0,6,0,276,15,14,577,1111,13,785,1,1,0,878,15,14,578,1112,13,786,1,1,0,858,15,14,579,1113,13,787,1,1,0,873,15,14,120,346,3,200,6,6,0,256,15,14,120,346,3,200,0,6,0,256,15,14,121,347,3,201,49,1,0,264,15,14,121,347,3,201,50,1,0,264,15,14,122,348,3,202,49,1,0,228,15,14,122,348,3,202,50,1,0,228,15,14,123,349,3,203,6,6,0,279,15,14,123,349,3,203,0,6,0,279,15,14,124,350,3,204,43,6,0,280,15,14,124,350,3,204,46,6,0,280,15,14,125,351,3,205,6,6,0,277,15,14,125,351,3,205,0,6,0,277,15,14,130,356,3,210,43,6,0,219,15,14,130,356,3,210,46,6,0,219,15,14,582,1116,13,790,1,1,0,819,15,14,583,1117,13,791,1,1,0,47,15,14,584,1118,13,792,1,1,0,47,15,14,585,1119,13,793,1,1,0,47,15,14,586,1120,13,794,1,1,0,47,5,4,441,974,2,647,0,1,0,906,5,4,442,975,2,648,0,1,0,907,5,4,443,976,2,649,0,1,0,908,5,4,444,977,2,650,0,1,0,909,5,4,445,978,2,651,0,1,0,910,5,4,446,979,2,652,0,1,0,911,5,4,447,980,2,653,0,1,0,912,5,4,104,330,3,183,6,1,0,275,5,4,104,330,3,183,0,1,0,275,5,4,448,981,2,654,0,1,0,890,5,4,449,982,2,655,0,1,0,891,5,4,450,983,2,656,0,1,0,892,5,4,451,984,2,657,0,1,0,893,5,4,452,985,2,658,0,1,0,894,5,4,453,986,2,659,0,1,0,895,5,4,454,987,2,660,0,1,0,896,5,4,455,988,2,661,0,1,0,897,5,4,456,989,2,662,0,1,0,898,5,4,457,990,2,663,0,1,0,899,5,4,458,991,2,664,0,1,0,900,5,4,459,992,2,665,0,1,0,901,5,4,52,993,2,666,0,1,0,902,5,4,460,994,2,667,0,1,0,903,5,4,461,995,2,668,0,1,0,904,5,4,462,996,2,669,0,1,0,905,5,4,463,997,2,670,0,1,0,883,5,4,464,998,2,671,0,1,0,884,5,4,465,999,2,672,0,1,0,885,5,4,466,1000,2,673,0,1,0,886,5,4,467,1001,2,674,0,1,0,887,5,4,468,1002,2,675,0,1,0,888,5,4,469,1003,2,676,0,1,0,889,5,4,470,1004,2,677,0,1,0,881,5,4,471,1005,2,678,0,1,0,882,5,4,472,1006,2,679,0,1,0,851,5,4,473,1007,2,680,0,1,0,852,5,4,474,1008,2,681,0,1,0,853,5,4,475,1009,2,682,0,1,0,854,5,4,476,1010,2,683,0,1,0,855,5,4,477,1011,2,684,0,1,0,856,5,4,478,1012,2,685,0,1,0,857,5,4,105,331,3,184,6,1,0,238,5,4,105,331,3,184,0,1,0,238,5,4,479,1013,2,686,0,1,0,835,5,4,480,1014,2,687,0,1,0,836,5,4,481,1015,2,688,0,1,0,837,5,4,482,1016,2,689,0,1,0,838,5,4,483,1017,2,690,0,1,0,839,5,4,484,1018,2,691,0,1,0,840,5,4,485,1019,2,692,0,1,0,841,5,4,486,1020,2,693,0,1,0,842,5,4,487,1021,2,694,0,1,0,843,5,4,488,1022,2,695,0,1,0,844,5,4,489,1023,2,696,0,1,0,845,5,4,490,1024,2,697,0,1,0,846,5,4,491,1025,2,698,0,1,0,847,5,4,492,1026,2,699,0,1,0,848,5,4,493,1027,2,700,0,1,0,849,5,4,494,1028,2,701,0,1,0,850,5,4,495,1029,2,702,0,1,0,830,5,4,496,1030,2,703,0,1,0,831,5,4,497,1031,2,704,0,1,0,832,5,4,498,1032,2,705,0,1,0,833,5,4,499,1033,2,706,0,1,0,834,5,4,500,1034,2,707,0,1,0,828,5,4,501,1035,2,708,0,1,0,829,5,4,502,1036,2,709,0,1,0,826,5,4,503,1037,2,710,0,1,0,827,5,4,504,1038,2,712,0,1,0,1163,5,4,505,1039,2,713,0,1,0,1164,5,4,506,1040,2,714,0,1,0,1165,5,4,507,1041,2,715,0,1,0,1166,5,4,508,1042,2,716,0,1,0,1167,5,4,509,1043,2,717,0,1,0,1168,5,4,510,1044,2,718,0,1,0,1169,5,4,106,332,3,185,6,1,0,367,5,4,106,332,3,185,0,1,0,367,5,4,511,1045,2,719,0,1,0,1147,5,4,512,1046,2,720,0,1,0,1148,5,4,513,1047,2,721,0,1,0,1149,5,4,514,1048,2,722,0,1,0,1150,5,4,515,1049,2,723,0,1,0,1151,5,4,516,1050,2,724,0,1,0,1152,5,4,517,1051,2,725,0,1,0,1153,5,4,518,1052,2,726,0,1,0,1154,5,4,519,1053,2,727,0,1,0,1155,5,4,520,1054,2,728,0,1,0,1156,5,4,521,1055,2,729,0,1,0,1157,5,4,522,1056,2,730,0,1,0,1158,5,4,523,1057,2,731,0,1,0,1159,5,4,524,1058,2,732,0,1,0,1160,5,4,525,1059,2,733,0,1,0,1161,5,4,526,1060,2,734,0,1,0,1162,5,4,527,1061,2,735,0,1,0,1142,5,4,528,1062,2,736,0,1,0,1143,5,4,529,1063,2,737,0,1,0,1144,5,4,530,1064,2,738,0,1,0,1145,5,4,531,1065,2,739,0,1,0,1146,5,4,532,1066,2,740,0,1,0,1140,5,4,533,1067,2,741,0,1,0,1141,5,4,534,1068,2,742,0,1,0,1138,5,4,535,1069,2,743,0,1,0,1139,23,21,91,317,3,170,6,1,0,260,23,21,91,317,3,170,0,1,0,260,23,21,388,921,2,593,0,1,0,872,23,21,92,318,3,171,6,1,0,250,23,21,92,318,3,171,0,1,0,250,23,21,93,319,3,172,6,1,0,369,23,21,93,319,3,172,0,1,0,369,23,21,99,325,3,178,6,1,0,235,23,21,99,325,3,178,0,1,0,235,23,21,100,326,3,179,6,1,0,283,23,21,100,326,3,179,0,1,0,283,23,21,131,358,3,212,6,1,0,374,23,21,131,358,3,212,0,1,0,374,23,21,132,359,3,213,6,1,0,248,23,21,132,359,3,213,0,1,0,248,23,21,133,360,3,214,6,1,0,247,23,21,133,360,3,214,0,1,0,247,31,30,134,361,3,215,6,1,0,282,31,30,134,361,3,215,0,1,0,282,31,30,588,1123,13,797,1,1,0,916,31,30,135,362,3,216,6,1,0,281,31,30,135,362,3,216,0,1,0,281,31,30,136,363,3,217,6,1,0,246,31,30,136,363,3,217,0,1,0,246,40,36,62,288,3,141,6,1,0,266,40,36,62,288,3,141,0,1,0,266,40,36,63,289,3,142,6,1,0,251,40,36,63,289,3,142,0,1,0,251,40,36,386,919,2,591,0,1,0,868,8,7,409,942,2,615,0,1,0,1193,8,7,410,943,2,616,0,1,0,1201,8,7,411,944,2,617,0,1,0,1178,8,7,412,945,2,618,0,1,0,1186,8,7,413,946,2,619,0,1,0,1194,8,7,414,947,2,620,0,1,0,1191,8,7,415,948,2,621,0,1,0,1190,8,7,416,949,2,622,0,1,0,1181,8,7,417,950,2,623,0,1,0,1200,8,7,418,951,2,624,0,1,0,1199,8,7,419,952,2,625,0,1,0,1187,8,7,420,953,2,626,0,1,0,1195,8,7,421,954,2,627,0,1,0,1192,8,7,422,955,2,628,0,1,0,1184,8,7,423,956,2,629,0,1,0,1183,8,7,424,957,2,630,0,1,0,1185,8,7,425,958,2,631,0,1,0,1179,8,7,426,959,2,632,0,1,0,1188,8,7,427,960,2,633,0,1,0,1196,8,7,428,961,2,634,0,1,0,1180,8,7,429,962,2,635,0,1,0,1182,8,7,430,963,2,636,0,1,0,1198,8,7,431,964,2,637,0,1,0,1177,8,7,432,965,2,638,0,1,0,54,8,7,433,966,2,639,0,1,0,1189,8,7,434,967,2,640,0,1,0,1197,8,7,435,968,2,641,0,1,0,54,8,7,436,969,2,642,0,1,0,54,8,7,437,970,13,643,51,1,0,877,8,7,438,971,13,644,51,1,0,876,8,7,102,328,2,181,6,6,1,55,8,7,102,328,2,181,0,1,0,55,8,7,439,972,13,645,1,1,0,875,8,7,440,973,13,646,1,1,0,1176,29,28,538,1072,2,746,0,1,0,914,29,28,539,1073,2,747,0,1,0,871,29,28,540,1074,2,748,0,1,0,870,29,28,108,334,3,188,6,1,0,375,29,28,108,334,3,188,0,1,0,375,29,28,545,1079,13,753,1,1,0,1202,29,28,546,1080,2,754,0,1,0,1203,29,28,547,1081,13,755,1,1,0,915,48,45,58,284,3,137,42,1,0,231,48,45,58,284,3,137,44,1,0,231,48,45,64,290,3,143,6,6,0,376,48,45,64,290,3,143,0,6,0,376,41,38,94,320,3,173,6,1,0,249,41,38,94,320,3,173,0,1,0,249,41,38,95,321,3,174,6,1,0,370,41,38,95,321,3,174,0,1,0,370,41,38,389,922,2,594,0,1,0,1170],"strings":["1","0","BTN","TUMB","47","MFCD","-1","46","UFCP","35","FCS","7","AAP","LEV","4","LIGHTS","34","ENGINE","24","INTERCOM","32","38","GEAR","MISC","33","FUEL","29","ACP","5","WARNING_SYSTEM","31","OXYGEN","","49","CLOCK","ELECTRIC_SYSTEM","16","30","37","ECS","SMS","ZCP","-0.33333333333333","-2","0.33333333333333","11","2","Flood Light Direction","WCS","-0.2","0.2","0.5","3256","AAP N/A","UFCP Button N/A","+/,/- Switch","0.91666666666667","18","3002","3004","3005","3007","3008","3009","3011","3012","3013","3014","3015","3016","3017","3018","3019","3020","3021","3022","3024","3025","3026","3027","3028","3029","3030","3031","3032","3033","3034","3035","3036","3037","3038","3039","3041","3042","3043","3044","3048","3049","3063","3064","3065","3066","3232","3235","3243","3276","3309","3347","3402","3406","3407","3408","3409","3410","3412","3437","3438","3439","3443","3444","3449","3450","3451","3452","3453","3454","3456","3457","3459","3460","3465","3472","3474","3475","3477","3479","3480","500","502","503","505","506","507","509","510","511","512","513","514","515","516","517","518","519","520","522","523","524","525","526","527","528","529","530","531","532","533","534","535","536","537","539","540","541","542","546","547","561","562","563","564","730","733","741","774","807","845","9","900","904","905","906","907","908","910","935","936","937","941","942","947","948","949","950","951","952","954","955","957","958","963","969","970","972","973","975","977","978","AA/AG Switch","AAR Light Switch","AAR Switch","AG1/AG2 Switch","Active Fuel Cut-off Valve","Active Fuel Cut-off Valve Cover","Afterburner Switch","Air Start Button","Air Start Button Cover","Air Temp Knob Selector","Anti-Collision Light Knob Selector","Anti-Surge Switch","BIT Button","Backup SAIU Knob Selector","Battery Switch","Brake Park/Norm","Brake Test","CSS Handle","Canopy Open/Close Handle","Canopy Seal Handle","Center MFCD Power","DC Gen Switch","DTC","Deploy/Jettison Parachute","Digital Clock Switch","Direct Mode Switch","ECS Mode Knob Selector","EFCS Switch","Eject Seat Emergency O2","Eject Seat Firing Handle Safety Pin","Eject Seat Safe/Arm Handle","Ejection Seat Activate Destruct","Emergency Hydraulic Pump Switch","Emergency Jettison Button Cover","Emergency Landing Gear Cover","Emergency Landing Gear Handle","Engine Control Switch","Engine Mode Switch","Exterior Light Master Switch","Feed Cut-off Valve","Feed Cut-off Valve Cover","Flap Switch - Up/Down","Flare Dispense Button Cover","Flash Light","Flight Test Switch 1","Flight Test Switch 2","Formation Light Knob Selector","Fuel Pump Switch","Ground Jettison Switch","HUD Symbology Reject Switch","HUD/MFCD Day/Night Switch","INS","INS Mode Knob Selector","Intercom Switch","Landing Gear Lever","Landing Gear Override Button","Landing Gear Override Button Cover","Left MFCD Power","Light Switch - Land/Off/Taxi","Light Switch - Tow/Off/Anti-Collision","Main AC Gen Switch","Navigation Light Switch - Bright/Off/Dim","Navigation Light Switch - Flash/Steady","Oxygen 100% O2","Oxygen Tube Connector","P.H. Test Switch","PNT_500","PNT_502","PNT_503","PNT_505","PNT_506","PNT_507","PNT_509","PNT_510","PNT_511","PNT_512","PNT_513","PNT_514","PNT_515","PNT_516","PNT_517","PNT_518","PNT_519","PNT_520","PNT_522","PNT_523","PNT_524","PNT_525","PNT_526","PNT_527","PNT_528","PNT_529","PNT_530","PNT_531","PNT_532","PNT_533","PNT_534","PNT_535","PNT_536","PNT_537","PNT_539","PNT_540","PNT_541","PNT_542","PNT_546","PNT_547","PNT_561","PNT_562","PNT_563","PNT_564","PNT_730","PNT_733","PNT_741","PNT_774","PNT_807","PNT_845","PNT_900","PNT_904","PNT_905","PNT_906","PNT_907","PNT_908","PNT_910","PNT_935","PNT_936","PNT_937","PNT_941","PNT_942","PNT_947","PNT_948","PNT_949","PNT_950","PNT_951","PNT_952","PNT_954","PNT_955","PNT_957","PNT_958","PNT_963","PNT_969","PNT_970","PNT_972","PNT_973","PNT_975","PNT_977","PNT_978","Radio Mode Selector","Radio Top/Bottom Antenna Switch","Record Switch","Right MFCD Power","SEC EEC Switch","SHARS Switch","Self Destruct Button Cover","Speaker Control Box Channel Antenna Switch","Squelch OFF/SQL/ACKN","Start Mode Selector - START/ENG COLD/STARTER COLD","Stick Show/Hide","Warning Panel Day/Night Switch","Weapon Master Arm Switch","Yaw Trim Switch","Yaw/Roll CAS Switch","-0.083333333333333","-0.25","0.083333333333333","0.25","10060","3003","3006","3010","3023","3040","3045","3046","3047","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","3072","3073","3074","3075","3202","3203","3204","3205","3206","3207","3208","3209","3210","3211","3212","3213","3214","3215","3216","3217","3218","3219","3220","3221","3222","3223","3224","3225","3226","3227","3228","3229","3230","3231","3233","3234","3236","3237","3238","3239","3240","3241","3242","3244","3245","3246","3247","3248","3249","3250","3251","3252","3253","3254","3255","3257","3258","3259","3260","3261","3262","3263","3264","3265","3266","3267","3268","3269","3270","3271","3272","3273","3274","3275","3277","3278","3279","3280","3281","3282","3283","3284","3285","3286","3287","3288","3289","3290","3291","3292","3293","3294","3295","3296","3297","3298","3299","3300","3301","3302","3303","3304","3305","3306","3307","3308","3310","3311","3312","3313","3314","3315","3316","3317","3318","3319","3320","3321","3322","3323","3324","3325","3326","3327","3328","3329","3330","3331","3332","3333","3334","3342","3343","3344","3345","3346","3348","3349","3350","3351","3403","3404","3405","3411","3413","3414","3415","3416","3417","3418","3419","3420","3421","3422","3423","3424","3425","3426","3427","3428","3429","3430","3431","3432","3433","3434","3435","3436","3440","3441","3442","3445","3446","3447","3448","3455","3461","3466","3467","3468","3469","3470","3476","3478","501","504","508","521","538","543","544","545","548","549","550","551","552","553","554","555","556","557","558","559","560","570","571","572","573","6","700","701","702","703","704","705","706","707","708","709","710","711","712","713","714","715","716","717","718","719","720","721","722","723","724","725","726","727","728","729","731","732","734","735","736","737","738","739","740","742","743","744","745","746","747","748","749","750","751","752","753","754","755","756","757","758","759","760","761","762","763","764","765","766","767","768","769","770","771","772","773","775","776","777","778","779","780","781","782","783","784","785","786","787","788","789","790","791","792","793","794","795","796","797","798","799","8","800","801","802","803","804","805","806","808","809","810","811","812","813","814","815","816","817","818","819","820","821","822","823","824","825","826","827","828","829","830","831","832","840","841","842","843","844","846","847","848","849","901","902","903","909","911","912","913","914","915","916","917","918","919","920","921","922","923","924","925","926","927","928","929","930","931","932","933","934","938","939","940","943","944","945","946","953","959","964","965","966","967","968","971","974","976","A/P Disengage","AAP ACMI","AAP CLDP","AAP CMBT","AAP COM1","AAP COM2","AAP HMD","AAP IFF","AAP INS","AAP IRST","AAP NAV","AAP OESP","AAP OFF","AAP RDR","AAP RWR","AAP SAIU","AAP SLNK","AAP SPJ","AAP TRAIN","AAP WMMC1","AAP WMMC2","AAR Light Brightness Knob","ADC","BARO Altitude Setting Knob","Brightness Knob","COM1 Volume Knob","COM2 Volume Knob","Canopy Manual Open/Close Crank","Center MFCD Brt +","Center MFCD Brt -","Center MFCD Cont +","Center MFCD Cont -","Center MFCD D1","Center MFCD D2","Center MFCD D3","Center MFCD D4","Center MFCD D5","Center MFCD L1","Center MFCD L2","Center MFCD L3","Center MFCD L4","Center MFCD L5","Center MFCD L6","Center MFCD L7","Center MFCD L8","Center MFCD R1","Center MFCD R2","Center MFCD R3","Center MFCD R4","Center MFCD R5","Center MFCD R6","Center MFCD R7","Center MFCD R8","Center MFCD Sym +","Center MFCD Sym -","Center MFCD U1","Center MFCD U2","Center MFCD U3","Center MFCD U4","Center MFCD U5","Console Light Knob","DTC Card Ejection","DTC Card Insertion","Defog Switch","Digital Clock Brightness +","Digital Clock Brightness -","Digital Clock CHR","Digital Clock UTC","EMMC","Emergency Brake Handle","Emergency Jettison Button","FCS Reset Button","FCS Warning","Fire Warning","Flare Dispense Button","Flood Light Knob","Ground Start Button","HUD Backup Reticle Knob","HUD Brightness Knob","HUD Contrast Knob","Inst. Light Knob","Landing Gear Indicator Light Knob","Landing Gear Indicator Light Test Button","Left MFCD Brt +","Left MFCD Brt -","Left MFCD Cont +","Left MFCD Cont -","Left MFCD D1","Left MFCD D2","Left MFCD D3","Left MFCD D4","Left MFCD D5","Left MFCD L1","Left MFCD L2","Left MFCD L3","Left MFCD L4","Left MFCD L5","Left MFCD L6","Left MFCD L7","Left MFCD L8","Left MFCD R1","Left MFCD R2","Left MFCD R3","Left MFCD R4","Left MFCD R5","Left MFCD R6","Left MFCD R7","Left MFCD R8","Left MFCD Sym +","Left MFCD Sym -","Left MFCD U1","Left MFCD U2","Left MFCD U3","Left MFCD U4","Left MFCD U5","MSL Volume Knob","Master Warning","Oxygen Indicator Brightness Knob","Oxygen Supply Valve","PNT_501","PNT_504","PNT_508","PNT_521","PNT_538","PNT_543","PNT_544","PNT_545","PNT_548","PNT_549","PNT_550","PNT_551","PNT_552","PNT_553","PNT_554","PNT_555","PNT_556","PNT_557","PNT_558","PNT_559","PNT_560","PNT_570","PNT_571","PNT_572","PNT_573","PNT_700","PNT_701","PNT_702","PNT_703","PNT_704","PNT_705","PNT_706","PNT_707","PNT_708","PNT_709","PNT_710","PNT_711","PNT_712","PNT_713","PNT_714","PNT_715","PNT_716","PNT_717","PNT_718","PNT_719","PNT_720","PNT_721","PNT_722","PNT_723","PNT_724","PNT_725","PNT_726","PNT_727","PNT_728","PNT_729","PNT_731","PNT_732","PNT_734","PNT_735","PNT_736","PNT_737","PNT_738","PNT_739","PNT_740","PNT_742","PNT_743","PNT_744","PNT_745","PNT_746","PNT_747","PNT_748","PNT_749","PNT_750","PNT_751","PNT_752","PNT_753","PNT_754","PNT_755","PNT_756","PNT_757","PNT_758","PNT_759","PNT_760","PNT_761","PNT_762","PNT_763","PNT_764","PNT_765","PNT_766","PNT_767","PNT_768","PNT_769","PNT_770","PNT_771","PNT_772","PNT_773","PNT_775","PNT_776","PNT_777","PNT_778","PNT_779","PNT_780","PNT_781","PNT_782","PNT_783","PNT_784","PNT_785","PNT_786","PNT_787","PNT_788","PNT_789","PNT_790","PNT_791","PNT_792","PNT_793","PNT_794","PNT_795","PNT_796","PNT_797","PNT_798","PNT_799","PNT_800","PNT_801","PNT_802","PNT_803","PNT_804","PNT_805","PNT_806","PNT_808","PNT_809","PNT_810","PNT_811","PNT_812","PNT_813","PNT_814","PNT_815","PNT_816","PNT_817","PNT_818","PNT_819","PNT_820","PNT_821","PNT_822","PNT_823","PNT_824","PNT_825","PNT_826","PNT_827","PNT_828","PNT_829","PNT_830","PNT_831","PNT_832","PNT_840","PNT_841","PNT_842","PNT_843","PNT_844","PNT_846","PNT_847","PNT_848","PNT_849","PNT_901","PNT_902","PNT_903","PNT_909","PNT_911","PNT_912","PNT_913","PNT_914","PNT_915","PNT_916","PNT_917","PNT_918","PNT_919","PNT_920","PNT_921","PNT_922","PNT_923","PNT_924","PNT_925","PNT_926","PNT_927","PNT_928","PNT_929","PNT_930","PNT_931","PNT_932","PNT_933","PNT_934","PNT_938","PNT_939","PNT_940","PNT_943","PNT_944","PNT_945","PNT_946","PNT_953","PNT_959","PNT_964","PNT_965","PNT_966","PNT_967","PNT_968","PNT_971","PNT_974","PNT_976","Radio Button ->/ENT","Radio Button 0/PRE","Radio Button 1/TONE","Radio Button 2/-","Radio Button 3/+","Radio Button 4/H","Radio Button 5/A","Radio Button 6/M","Radio Button 7/P","Radio Button 8/C","Radio Button 9/T","Radio Button <-/MAN","Radio Control Handover","Radio Volume Knob","Right MFCD Brt +","Right MFCD Brt -","Right MFCD Cont +","Right MFCD Cont -","Right MFCD D1","Right MFCD D2","Right MFCD D3","Right MFCD D4","Right MFCD D5","Right MFCD L1","Right MFCD L2","Right MFCD L3","Right MFCD L4","Right MFCD L5","Right MFCD L6","Right MFCD L7","Right MFCD L8","Right MFCD R1","Right MFCD R2","Right MFCD R3","Right MFCD R4","Right MFCD R5","Right MFCD R6","Right MFCD R7","Right MFCD R8","Right MFCD Sym +","Right MFCD Sym -","Right MFCD U1","Right MFCD U2","Right MFCD U3","Right MFCD U4","Right MFCD U5","Self Destruct Button","TCN/ILS Volume Knob","Throttle Cage: Idle To Stop","Throttle Emergency Button","Throttle Friction Handle","Throttle Uncage: Stop To Idle","UFCP Brightness Knob","UFCP Button 0","UFCP Button 3","UFCP Button 9","UFCP Button A/P","UFCP Button DST/4","UFCP Button FPM","UFCP Button FUL/7","UFCP Button HNS","UFCP Button IFF/8","UFCP Button L1","UFCP Button L2","UFCP Button L3","UFCP Button L4","UFCP Button MRK","UFCP Button OAP","UFCP Button P.U","UFCP Button PFL/1","UFCP Button R1","UFCP Button R2","UFCP Button R3","UFCP Button R4","UFCP Button RTN","UFCP Button TOD/6","UFCP Button TOT/5","UFCP Button VRC/2","Warning Panel Brightness Knob","Warning Panel Test Button"]});
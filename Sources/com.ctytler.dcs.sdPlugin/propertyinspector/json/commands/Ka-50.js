@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Ka-50","rows":[77,1,24,334,2,209,3,1,0,522,77,1,24,334,2,209,0,1,0,522,77,1,27,384,2,160,3,1,0,577,77,1,27,384,2,160,0,1,0,577,77,1,21,727,22,155,138,1,0,729,55,46,6,844,4,675,0,1,0,701,55,46,7,845,4,676,0,1,0,702,55,46,9,846,4,677,0,1,0,703,55,46,8,847,4,678,0,1,0,704,55,46,15,848,4,679,0,1,0,705,55,46,26,309,22,681,138,1,0,306,55,46,24,309,4,686,0,1,0,306,55,46,27,706,22,680,59,1,0,700,55,46,21,308,2,156,3,1,0,307,55,46,21,308,2,156,0,1,0,307,707,694,6,766,4,689,0,1,0,716,108,105,6,774,22,585,79,1,0,710,108,105,7,554,2,295,3,1,0,143,108,105,7,554,2,295,0,1,0,143,108,105,9,918,4,586,0,1,0,143,56,47,6,568,2,233,20,1,98,314,56,47,7,568,2,233,12,1,98,314,56,47,9,415,2,242,78,1,0,313,56,47,9,415,2,242,80,1,0,313,56,47,8,557,2,232,3,1,0,339,56,47,8,557,2,232,0,1,0,339,56,47,15,556,2,231,3,1,0,555,56,47,15,556,2,231,0,1,0,555,56,47,26,928,22,641,59,1,0,709,56,47,24,714,4,642,0,1,0,708,69,66,6,826,4,633,0,1,0,720,69,66,7,827,4,635,0,1,0,722,69,66,9,828,4,634,0,1,0,723,69,66,8,829,4,636,0,1,0,719,69,66,15,825,4,637,0,1,0,721,69,66,26,326,2,228,78,1,0,322,69,66,26,326,2,228,80,1,0,322,112,83,6,416,2,279,3,1,0,418,112,83,6,416,2,279,0,1,0,418,112,83,7,407,2,280,3,1,0,417,112,83,7,407,2,280,0,1,0,417,90,84,6,144,4,305,0,1,0,146,90,84,7,144,4,305,3,3,1,146,90,84,9,144,22,674,138,1,0,146,90,84,8,330,4,696,0,1,0,449,90,84,15,330,22,687,59,582,584,449,37,36,6,400,2,302,3,1,0,404,37,36,6,400,2,302,0,1,0,404,37,36,7,460,2,272,3,1,0,133,37,36,7,460,2,272,0,1,0,133,37,36,9,459,2,273,3,1,0,133,37,36,9,459,2,273,0,1,0,133,37,36,8,319,2,303,3,1,0,131,37,36,8,319,2,303,0,1,0,131,37,36,15,318,2,304,3,1,0,131,37,36,15,318,2,304,0,1,0,131,37,36,26,574,2,159,12,1,44,578,37,36,24,574,4,159,71,1,71,578,37,36,27,476,2,289,3,1,0,499,37,36,27,476,2,289,0,1,0,499,37,36,21,489,2,161,3,1,0,498,37,36,21,489,2,161,0,1,0,498,37,36,35,778,4,592,0,1,0,890,25,23,6,833,4,593,5,1,5,747,25,23,7,832,4,591,5,1,5,746,25,23,9,831,4,595,5,1,5,744,25,23,8,830,4,83,5,1,5,147,25,23,15,842,4,594,5,1,5,751,25,23,26,838,4,596,5,1,5,752,25,23,24,839,4,597,5,1,5,753,25,23,27,840,4,598,5,1,5,754,25,23,21,841,4,16,5,1,5,755,25,23,35,834,4,600,5,1,5,748,25,23,41,835,4,32,5,1,5,749,25,23,51,836,4,99,5,1,5,750,25,23,52,837,4,88,5,1,5,745,25,23,63,360,2,226,20,1,44,362,25,23,63,360,2,226,12,1,44,362,25,23,72,359,2,227,20,1,44,361,25,23,72,359,2,227,12,1,44,361,25,23,73,492,2,225,3,1,0,451,25,23,73,492,2,225,0,1,0,451,25,23,64,335,2,207,3,1,0,523,25,23,64,335,2,207,0,1,0,523,25,23,65,338,2,208,3,1,0,524,25,23,65,338,2,208,0,1,0,524,49,48,6,518,2,164,3,1,0,377,49,48,6,518,2,164,0,1,0,377,49,48,7,519,2,165,3,1,0,378,49,48,7,519,2,165,0,1,0,378,49,48,9,520,2,166,3,1,0,379,49,48,9,520,2,166,0,1,0,379,49,48,8,517,2,167,3,1,0,376,49,48,8,517,2,167,0,1,0,376,49,48,15,345,2,274,20,1,96,375,49,48,15,345,2,274,12,1,96,375,49,48,26,737,4,670,0,1,0,760,31,30,6,365,2,183,3,1,0,115,31,30,6,365,2,183,0,1,0,115,31,30,7,368,2,184,3,1,0,115,31,30,7,368,2,184,0,1,0,115,31,30,9,367,2,291,3,1,0,111,31,30,9,367,2,291,0,1,0,111,31,30,8,370,2,292,3,1,0,111,31,30,8,370,2,292,0,1,0,111,31,30,15,366,2,185,3,1,0,110,31,30,15,366,2,185,0,1,0,110,31,30,26,369,2,186,3,1,0,110,31,30,26,369,2,186,0,1,0,110,31,30,24,514,2,187,3,1,0,310,31,30,24,514,2,187,0,1,0,310,31,30,27,401,2,188,3,1,0,311,31,30,27,401,2,188,0,1,0,311,31,30,21,402,2,189,3,1,0,312,31,30,21,402,2,189,0,1,0,312,31,30,35,351,2,190,20,1,5,356,31,30,41,351,2,190,12,1,5,356,11,10,6,372,2,210,3,1,0,116,11,10,6,372,2,210,0,1,0,116,11,10,7,371,2,211,3,1,0,116,11,10,7,371,2,211,0,1,0,116,11,10,9,374,2,212,3,1,0,117,11,10,9,374,2,212,0,1,0,117,11,10,8,373,2,213,3,1,0,117,11,10,8,373,2,213,0,1,0,117,11,10,15,911,4,655,0,1,0,915,11,10,26,912,4,656,0,1,0,777,11,10,24,913,4,657,0,1,0,916,11,10,27,540,2,258,20,1,44,382,11,10,27,540,2,258,12,1,44,382,11,10,21,363,2,296,3,1,0,435,11,10,21,363,2,296,0,1,0,435,11,10,35,364,2,67,3,1,0,527,11,10,35,364,2,688,0,1,0,527,11,10,41,328,2,297,3,1,0,528,11,10,41,328,2,297,0,1,0,528,11,10,51,541,2,257,20,1,5,381,11,10,51,541,2,257,12,1,5,381,11,10,52,475,2,162,3,1,0,529,11,10,52,475,2,162,0,1,0,529,11,10,63,474,2,163,78,1,0,383,11,10,63,474,2,163,80,1,0,383,11,10,72,471,2,214,3,1,0,118,11,10,72,471,2,214,0,1,0,118,11,10,73,465,2,299,3,1,0,118,11,10,73,465,2,299,0,1,0,118,11,10,64,472,2,215,20,1,5,119,11,10,64,472,2,215,12,1,5,119,11,10,65,466,2,300,3,1,0,119,11,10,65,466,2,300,0,1,0,119,11,10,101,899,4,667,0,1,0,787,11,10,102,900,4,668,0,1,0,902,11,10,140,898,4,669,0,1,0,761,11,10,103,741,4,589,0,1,0,905,11,10,104,740,4,590,0,1,0,917,11,10,141,515,2,181,20,1,5,526,11,10,141,515,2,181,12,1,5,526,38,33,6,851,4,602,0,1,0,788,38,33,7,852,4,603,0,1,0,713,38,33,9,853,4,604,0,1,0,903,38,33,8,854,4,605,0,1,0,929,38,33,15,387,2,178,20,1,5,121,38,33,26,387,2,178,12,1,5,121,38,33,24,385,2,179,3,1,0,121,38,33,24,385,2,179,0,1,0,121,38,33,27,386,2,180,3,1,0,396,38,33,27,386,2,180,0,1,0,396,38,33,21,325,2,176,3,1,0,120,38,33,21,325,2,176,0,1,0,120,38,33,35,324,2,177,3,1,0,120,38,33,35,324,2,177,0,1,0,120,38,33,41,757,4,139,12,1,12,599,38,33,51,758,4,139,5,1,5,606,38,33,52,759,4,139,44,1,44,649,19,18,6,393,2,191,3,1,0,398,19,18,6,393,2,191,0,1,0,398,19,18,7,392,2,192,3,1,0,525,19,18,7,392,2,192,0,1,0,525,19,18,9,394,2,193,3,1,0,420,19,18,9,394,2,193,0,1,0,420,19,18,8,395,2,194,3,1,0,457,19,18,8,395,2,194,0,1,0,457,19,18,15,391,2,195,3,1,0,399,19,18,15,391,2,195,0,1,0,399,19,18,26,468,2,196,3,1,0,129,19,18,26,468,2,196,0,1,0,129,19,18,24,462,2,197,3,1,0,129,19,18,24,462,2,197,0,1,0,129,19,18,27,469,2,198,3,1,0,134,19,18,27,469,2,198,0,1,0,134,19,18,21,463,2,199,3,1,0,134,19,18,21,463,2,199,0,1,0,134,19,18,35,470,2,200,3,1,0,109,19,18,35,470,2,200,0,1,0,109,19,18,41,464,2,201,3,1,0,109,19,18,41,464,2,201,0,1,0,109,19,18,51,467,2,202,3,1,0,122,19,18,51,467,2,202,0,1,0,122,19,18,52,461,2,203,3,1,0,122,19,18,52,461,2,203,0,1,0,122,19,18,63,739,4,695,0,1,0,765,145,99,6,858,22,652,59,1,0,773,145,99,7,497,2,268,3,1,0,414,145,99,7,497,2,268,0,1,0,414,91,85,6,897,22,155,79,1,0,768,91,85,7,896,22,588,79,1,0,769,91,85,9,919,4,587,0,1,0,770,91,85,8,580,2,290,3,1,0,408,91,85,8,580,2,290,0,1,0,408,76,68,6,849,22,45,59,1,0,771,76,68,7,481,2,46,3,3,0,410,76,68,7,481,2,46,0,3,0,410,76,68,9,843,4,68,0,1,0,772,76,68,8,480,2,288,3,1,0,409,76,68,8,480,2,288,0,1,0,409,123,106,6,413,2,170,3,1,0,130,123,106,6,413,2,170,0,1,0,130,123,106,7,412,2,171,3,1,0,130,123,106,7,412,2,171,0,1,0,130,124,86,6,539,2,168,3,1,0,125,124,86,6,539,2,168,0,1,0,125,124,86,7,352,2,169,3,1,0,125,124,86,7,352,2,169,0,1,0,125,40,39,6,357,2,220,3,1,0,440,40,39,6,357,2,220,0,1,0,440,40,39,7,726,22,692,12,1,0,791,40,39,9,315,2,218,3,1,0,437,40,39,9,315,2,218,0,1,0,437,40,39,8,724,22,673,12,1,0,789,40,39,15,458,2,271,3,1,0,438,40,39,15,458,2,271,0,1,0,438,40,39,26,824,22,666,12,1,0,790,40,39,24,358,2,219,3,1,0,441,40,39,24,358,2,219,0,1,0,441,40,39,27,725,22,672,12,1,0,792,40,39,21,427,2,154,3,1,0,439,40,39,21,427,2,154,0,1,0,439,126,107,6,473,2,172,3,1,0,455,126,107,6,473,2,172,0,1,0,455,126,107,7,424,2,267,3,1,0,423,126,107,7,424,2,267,0,1,0,423,70,62,6,495,2,269,3,1,0,434,70,62,6,495,2,269,0,1,0,434,70,62,7,430,2,89,3,1,0,128,70,62,7,430,2,89,0,1,0,128,70,62,9,431,2,298,3,1,0,128,70,62,9,431,2,298,0,1,0,128,70,62,8,730,4,67,0,1,0,785,127,74,6,779,4,640,0,1,0,782,127,74,7,426,2,301,3,1,0,432,127,74,7,426,2,301,0,1,0,432,127,74,9,780,4,691,0,1,0,783,92,75,6,486,2,254,3,1,0,411,92,75,6,486,2,254,0,1,0,411,92,75,8,406,2,182,3,1,0,550,92,75,8,406,2,182,0,1,0,550,92,75,15,712,22,697,79,1,0,728,60,58,6,350,2,216,3,1,0,558,60,58,6,350,2,216,0,1,0,558,60,58,7,390,2,217,20,1,44,397,60,58,7,390,2,217,12,1,44,397,60,58,9,389,2,173,3,1,0,320,60,58,9,389,2,173,0,1,0,320,60,58,8,316,2,158,12,1,44,454,60,58,15,316,4,158,71,1,71,454,132,100,6,403,2,174,12,1,5,405,132,100,7,403,2,174,20,1,5,405,132,100,9,579,2,229,78,1,0,323,132,100,9,579,2,229,80,1,0,323,43,42,6,477,2,275,20,1,0,317,43,42,6,477,2,275,12,1,0,317,43,42,9,479,2,277,20,1,153,553,43,42,9,479,2,277,12,1,153,553,43,42,8,425,2,278,3,1,0,355,43,42,8,425,2,278,0,1,0,355,43,42,24,711,4,671,0,1,0,914,43,42,27,572,2,281,3,1,0,380,43,42,27,572,2,281,0,1,0,380,43,42,21,521,2,282,3,1,0,551,43,42,21,521,2,282,0,1,0,551,43,42,35,388,2,283,3,1,0,571,43,42,35,388,2,283,0,1,0,571,148,89,6,781,22,639,151,1,0,786,148,89,7,450,2,230,3,1,0,456,148,89,7,450,2,230,0,1,0,456,17,16,6,859,4,620,5,1,5,797,17,16,7,860,4,611,5,1,5,798,17,16,9,861,4,612,5,1,5,799,17,16,8,862,4,613,5,1,5,800,17,16,15,863,4,614,5,1,5,801,17,16,26,864,4,615,5,1,5,802,17,16,24,865,4,616,5,1,5,803,17,16,27,866,4,617,5,1,5,804,17,16,21,867,4,618,5,1,5,805,17,16,35,868,4,619,5,1,5,806,17,16,41,882,4,623,5,1,5,821,17,16,51,883,4,682,5,1,5,814,17,16,52,880,4,624,5,1,5,813,17,16,63,884,4,683,5,1,5,817,17,16,72,870,4,625,5,1,5,807,17,16,73,878,4,684,5,1,5,816,17,16,64,881,4,626,5,1,5,819,17,16,65,874,4,621,5,1,5,812,17,16,101,872,4,622,5,1,5,810,17,16,102,879,4,685,5,1,5,815,17,16,140,876,4,627,5,1,5,818,17,16,103,877,4,628,5,1,5,811,17,16,104,873,4,629,5,1,5,822,17,16,141,875,4,630,5,1,5,820,17,16,607,869,4,631,5,1,5,808,17,16,608,490,2,223,20,1,96,453,17,16,609,490,2,223,12,1,96,453,17,16,222,491,2,224,3,1,0,452,17,16,222,491,2,224,0,1,0,452,17,16,610,871,22,632,79,1,0,809,511,142,6,895,22,698,12,1,0,756,511,142,7,920,4,699,0,1,0,901,29,28,6,910,4,658,0,1,0,891,29,28,7,343,2,259,3,1,0,505,29,28,7,343,2,259,0,1,0,505,29,28,9,341,2,261,3,1,0,507,29,28,9,341,2,261,0,1,0,507,29,28,8,342,2,262,3,1,0,504,29,28,8,342,2,262,0,1,0,504,29,28,15,340,2,260,3,1,0,506,29,28,15,340,2,260,0,1,0,506,29,28,26,344,2,263,3,1,0,508,29,28,26,344,2,263,0,1,0,508,29,28,24,346,2,3,3,3,0,500,29,28,24,346,2,3,0,3,0,500,29,28,27,347,2,3,3,3,0,501,29,28,27,347,2,3,0,3,0,501,29,28,21,348,2,3,3,3,0,502,29,28,21,348,2,3,0,3,0,502,29,28,35,349,2,3,3,3,0,503,29,28,35,349,2,3,0,3,0,503,29,28,41,337,2,206,3,1,0,570,29,28,41,337,2,206,0,1,0,570,61,53,6,329,2,235,20,1,98,509,61,53,6,329,2,235,12,1,98,509,61,53,7,894,22,643,59,1,0,892,61,53,9,715,4,644,0,1,0,893,61,53,8,512,2,236,3,1,0,510,61,53,8,512,2,236,0,1,0,510,61,53,15,336,2,205,3,1,0,569,61,53,15,336,2,205,0,1,0,569,50,45,6,484,2,252,3,1,0,419,50,45,6,484,2,252,0,1,0,419,50,45,7,857,22,653,59,1,0,775,50,45,9,856,22,654,59,1,0,776,50,45,8,488,2,255,3,1,0,147,50,45,8,488,2,255,0,1,0,147,50,45,15,487,2,256,20,1,97,530,50,45,15,487,2,256,12,1,97,530,50,45,26,567,2,221,20,1,97,544,50,45,26,567,2,221,12,1,97,544,50,45,24,933,4,601,0,1,0,906,57,54,6,532,2,238,3,1,0,545,57,54,6,532,2,238,0,1,0,545,57,54,7,531,2,237,3,1,0,546,57,54,7,531,2,237,0,1,0,546,57,54,9,533,2,239,3,1,0,548,57,54,9,533,2,239,0,1,0,548,57,54,8,534,2,240,3,1,0,549,57,54,8,534,2,240,0,1,0,549,57,54,15,535,2,241,3,1,0,547,57,54,15,535,2,241,0,1,0,547,135,87,6,429,2,243,78,1,0,436,135,87,6,429,2,243,80,1,0,436,135,87,7,428,2,244,3,1,0,442,135,87,7,428,2,244,0,1,0,442,136,88,6,333,2,204,3,1,0,421,136,88,6,333,2,204,0,1,0,421,136,88,7,513,2,264,581,1,152,537,136,88,7,513,2,264,583,1,152,537,93,67,6,149,4,157,0,1,0,150,93,67,7,149,4,157,3,3,1,150,93,67,9,149,22,693,0,1,0,150,93,67,8,516,2,175,3,1,0,552,93,67,8,516,2,175,0,1,0,552,94,82,6,742,4,87,5,1,5,796,94,82,7,738,4,58,0,1,0,784,94,82,9,793,4,47,5,1,5,904,94,82,8,327,2,53,3,1,0,446,94,82,8,327,2,53,0,1,0,446,34,32,6,560,2,74,20,1,5,332,34,32,7,560,2,74,12,1,5,332,34,32,9,563,2,234,20,1,12,331,34,32,9,563,2,234,12,1,12,331,34,32,8,925,4,142,0,1,0,733,34,32,15,922,4,647,0,1,0,732,34,32,26,924,4,75,0,1,0,731,34,32,24,926,4,659,0,1,0,735,34,32,27,923,4,86,0,1,0,734,34,32,21,927,4,33,0,1,0,736,34,32,35,562,2,284,3,1,0,114,34,32,35,562,2,284,0,1,0,114,34,32,41,565,2,286,3,1,0,113,34,32,41,565,2,286,0,1,0,113,34,32,51,561,2,285,3,1,0,114,34,32,51,561,2,285,0,1,0,114,34,32,52,564,2,287,3,1,0,113,34,32,52,564,2,287,0,1,0,113,95,81,6,908,4,645,0,1,0,931,95,81,7,536,2,245,3,1,0,573,95,81,7,536,2,245,0,1,0,573,95,81,9,909,4,646,0,1,0,932,95,81,8,907,4,665,0,1,0,930,14,13,6,443,2,246,3,1,0,448,14,13,6,443,2,246,0,1,0,448,14,13,7,855,4,650,0,1,0,823,14,13,9,850,4,651,0,1,0,763,14,13,8,538,2,250,20,1,5,575,14,13,8,538,2,250,12,1,5,575,14,13,15,482,2,251,3,1,0,447,14,13,15,482,2,251,0,1,0,447,14,13,26,483,2,249,3,1,0,354,14,13,26,483,2,249,0,1,0,354,14,13,24,485,2,253,20,1,5,433,14,13,24,485,2,253,12,1,5,433,14,13,21,494,2,266,3,1,0,559,14,13,21,494,2,266,0,1,0,559,14,13,35,885,4,660,0,1,0,718,14,13,41,889,4,661,0,1,0,717,14,13,51,887,4,662,0,1,0,764,14,13,52,886,4,663,0,1,0,767,14,13,63,496,2,265,20,1,71,576,14,13,72,496,2,265,12,1,71,576,14,13,73,888,4,664,0,1,0,921,14,13,64,493,2,270,3,1,0,321,14,13,64,493,2,270,0,1,0,321,14,13,65,543,2,293,3,1,0,137,14,13,65,543,2,293,0,1,0,137,14,13,101,542,2,294,3,1,0,137,14,13,101,542,2,294,0,1,0,137,14,13,102,445,2,248,3,1,0,353,14,13,102,445,2,248,0,1,0,353,14,13,140,794,4,648,0,1,0,762,14,13,103,444,2,247,3,1,0,422,14,13,103,444,2,247,0,1,0,422,14,13,104,478,2,276,20,1,0,566,14,13,104,478,2,276,12,1,0,566,934,690,6,743,22,638,151,1,0,795],"strings":["1","0","TUMB","-1","BTN","0.2","3001","3002","3004","3003","4","ENGINE_INTERFACE","0.1","12","WEAP_INTERFACE","3005","20","PVI","3","FUELSYS_INTERFACE","-0.1","3009","LEV","25","3007","DATALINK","3006","3008","48","R_800","2","ELEC_INTERFACE","22","40","UV_26","3010","34","CPT_MECH","FIRE_EXTING_INTERFACE","51","ILLUMINATION_INTERFACE","3011","32","PPK","0.3","8","9","46","6","EJECT_SYS_INTERFACE","SHKVAL","3012","3013","49","52","ABRIS","ARK_22","SIGNAL_FLARE_DISPENSER","45","0.05","NAVLIGHT_SYSTEM","R_828","11","3014","3017","3018","33","55","7","AUTOPILOT","LASERRANGER","0.4","3015","3016","36","41","HUD","","-0.5","0.001","0.5","13","14","15","29","30","42","44","50","57","CLOCK","HSI","MISC_SYSTEMS_INTERFACE","STBY_ADI","SYST_CONTROLLER","VMS","0.6","0.7","0.9","23","28","3019","3020","3022","3023","31","5","59","ADI","APU fuel shutoff valve","Battery 1","Battery 2","C061K","CMD BIT","CMD Power","DC ground power","EEG Left engine Electronic Engine Governor","EEG Right engine Electronic Engine Governor","EEG gas generator test â Operate switch","EEG power turbine channel 1 test â Operate â EEG power turbine channel 2 test, three-switch contactor","Fire extinguisher First (Auto) / Second (Manual) selector","Fire extinguisher Work â Off â Test switch","Fuel crossfeed valve","HYDRO_SYS_INTERFACE","IFF","IFF power","K041","LASER_WARNING_SYSTEM","Laser rangefinder / designator - mode switch","Left engine fuel shutoff valve","Main hydraulics","Main/Common hydraulics for emergency gear","NAV_INTERFACE","Power plant, hydraulics, EKRAN self-test systems switch","Right engine fuel shutoff valve","SPOTLIGHT_SYSTEM","SPU_9","Weapons Ñontrol system","0.04","251","3021","3024","38","ADI Test","CLOCK-LEFT-LEVER-PTR","HELMET","Mech clock left lever","N/A","PShK_7","RES-AGD-PTR","Standby Attitude Indicator Cage/control test handle","0.12","0.33","0.8","1001","126","130","141","146","147","148","151","153","154","214","215","216","217","218","219","220","221","222","228","229","230","246","247","248","249","250","258","259","262","263","264","265","267","268","269","270","271","272","273","274","275","276","277","278","279","280","281","282","283","284","285","286","287","288","289","290","291","292","293","294","295","296","297","298","299","300","301","3028","324","325","326","328","329","335","336","341","354","356","357","37","371","374","376","377","378","379","380","381","382","383","386","387","396","398","399","400","403","404","408","409","410","411","415","416","417","420","421","422","423","428","431","432","433","434","435","436","450","452","453","462","483","484","485","486","487","488","490","491","492","496","497","498","499","510","539","54","543","544","547","548","550","554","556","56","569","570","583","65","66","67","76","ABRIS Cursor Ñontrol (rot/push)","ABRIS Power","ABRIS-POWER_PTR","ABRIS_SHUNT_PTR","AC ground power","AC left generator","AC right generator","ADF Inner-Auto-Outer NDB switch","ADF channel switch","AGR-PKP-PTR","ANO-PTR","ATGM Temperature selector","AVAR-GEAR-COVER-PTR","AVAR-GEAR-PTR","Anticollision Light","Automatic Tracking / gun sight","Autopilot BARO/RALT altitude hold mode","Autopilot Desired heading - Desired track","BALOONS-COVER-PTR","BALOONS-PTR","BAR-RV-PTR","BKO-PTR","BRAKE-ROTOR-LOW-PTR01","CHANNEL-PTR","CLOCK-RIGHT-LEVER-PTR","CMD Amount flares counter/Programming","CMD Select Left/Both/Right board flares dispensers","COMM-PWR-AVSK-PTR","COMM-PWR-SA-TLF-PTR","COMM-PWR-TLK-PTR","COMM-PWR-UKV-1-PTR","COMM-PWR-UKV-2-PTR","COMM-PWR-UKV-TLK-PTR","COMPASS-ANTENNA modes","CONTR-RADIO-50-100-PTR01","CONTR-RADIO-AP-PTR","CONTR-RADIO-ARK-PTR","CONTR-RADIO-CHM-AM-PTR","CONTR-RADIO-PSH-PTR","CONTR-SAPROTATE-PTR","CONTROLLER-FREQ-1-PTR","CONTROLLER-FREQ-2-PTR","CONTROLLER-FREQ-3-PTR","CONTROLLER-FREQ-4-PTR","CONTUR-LIGHT-PTR","CONVERTER-PTR","COVER-SRO-PTR","Cannon rate of fire setting","Cannon round selector switch HE/AP","Control computers BIT switch","DC/AC inverter","DESK-PTR","DEVICES-PTR","DTLK-MASTER-MODES-PTR","DTLK-SELF-ID-PTR","Datalink Master mode","Datalink self ID","EMERGENCY-BRAKE ENGINE-LEFT-PTR","EMERGENCY-BRAKE ENGINE-RIGHT-PTR","ENERG-AER-RIT-PTR","ENERG-AKK1-PTR","ENERG-AKK2-PTR","ENERG-COVER-AER-RIT-PTR","ENERG-COVER-AKK1-PTR","ENERG-COVER-AKK2-PTR","ERD-LEFT-COVER-PTR","ERD-LEFT-PTR","ERD-RIGHT-COVER-PTR","ERD-RIGHT-PTR","Ejecting system circuit selector","Ejecting system power","Ejecting system power 1","Ejecting system power 2","Ejecting system power 3","Emergency INU alignment switch","Engine Startup/Crank/False Start selector","Engine selector","Engines de-icing / dust-protection systems switch","FEEDING-OZH-PTR","FIREEXT-COVER-PTR","FIREEXT-INDICATION-PTR","FIREEXT-PTR","FKP-PTR","FLASHER-PTR","FORMATION-PTR","FUEL-METER-PTR","FUEL-PUMP-BACK-PTR","FUEL-PUMP-FRONT-PTR","FUEL-PUMP-INNER-PTR","FUEL-PUMP-OUTER-PTR","Fire signaling","Formation Lights","Forward fuel tank pumps","Fuelmeter power","GEAR-PTR","GEN-LEFT-PTR","GEN-RIGHT-PTR","GYRO-MAG-MAN-HEADING-PTR","Gear lever","Gyro/Mag/Manual heading","HANGER-PTR","HEAT_IKV-PTR","HSI Desired track angle - Desired heading, Auto - Manual","HUD Filter","HUD Modes Reticle/Night/Day","HUD/TV declutter switch","HYDRO-COVER-PTR02","HYDRO-PTR","Helmet-mounted sight system power switch","IANDING LIGHTS-DIR-LIGHT-PTR01","IKV-PTR","INU Heater switch","INU Power switch","IT-23 Black-White indication switch","Inner external fuel tanks pumps","Intercom","Jettison arm mode - arm fuse/disarm fuse","K-041 Targeting-navigation system power switch","K-041-PTR","KCVM-PTR","L140-SWITCH","LAMP-PTR","LANDING LIGHTS-BASE-RESERV-PTR","LANDING LIGHTS-DIR-LIGHT-PTR","LD-LDP-COVER-PTR","LDP-LD-PTR","LWS Power switch","Laser code selector","Laser standby ON/OFF switch","Left engine cut-off valve","Light landing-search. On/Retraction/Off","Lighting ADI and SAI switch","Lighting auxiliary panel switch","Lighting cockpit interior lamp switch","Lighting cockpit panel switch","Lighting night vision cockpit switch","Lights landing-search change. Main/Reserved","MASTER-ARM-PTR","MASTER-EXPLODE-PTR","MT-PTR","MWS operation mode (not functional)","Manual/Auto weapon system control switch","Master Arm","Mech clock right lever","N-S-PTR","NAV Datalink power","NAV INU fixtaking method","NAV Master modes","Navigation Lights 10% / 30% / 100% / Off","Navigation system power","North/South latitude selection","Outer external fuel tanks pumps","P-CONTR-ILLUM-PTR","P-CONTR-VMG-HYDRO-COVER-PTR","P-CONTR-VMG-HYDRO-PTR","PAV-CRANE-COVER-CYKLIZATION-PTR","PAV-CRANE-COVER-ENGINE-LEFT-PTR","PAV-CRANE-COVER-ENGINE-RIGHT-PTR","PAV-CRANE-COVER-VSU-PTR","PAV-CRANE-COVER-VSU-PTR01","PAV-CRANE-COVER-VSU-PTR02","PAV-CRANE-CYKLIZATION-PTR","PAV-CRANE-ENGINE-LEFT-PTR","PAV-CRANE-ENGINE-RIGHT-PTR","PAV-CRANE-VSU-PTR","PAV-CRANE-VSU-PTR01","PAV-CRANE-VSU-PTR02","PNK-PTR","POS-ENGINE-PZU-PTR","POS-ROTORS-PTR","PPD-DUAS-PTR","PPK-BBTZ-PTR","PPK-NRAKS-PTR","PPK-RNP-PTR","PTR_HUD-FILTER","PTR_HUD-TMB-SETKA02","PUI800-AUTO-PTR","PUI800-OFBR-PTR","PUR-BACKGROUND-PTR","PUR-LIT-PTR","PUR-OGR-INF-PTR","PUR-SF-PTR","PUR-TR-PTR","PVD-CLOCK-PTR","PVI-SWITCH-PTR","PVI_I251V_PTR","PVI_VCU_PTR","PVR-AS-PM-PTR","PVR-DRILL-PTR","PVR-IZL-PTR","PVR-MODE-PTR","PVR-OBZ-PTR","Pitot ram air and clock heat switch","Pitot static port and AoA sensors heat switch","R-800 (VHF-2) 1st rotary","R-800 (VHF-2) 2nd rotary","R-800 (VHF-2) 3rd rotary","R-800 (VHF-2) 4th rotary","R-800 (VHF-2) ADF switch","R-800 (VHF-2) AM-FM toggle switch","R-800 (VHF-2) Data transfer rate switch","R-800 (VHF-2) Emergency receiver","R-800 (VHF-2) Squelch","R-828 (VHF-1) Radio channel selector","R-828 (VHF-1) Squelch","RADAR_ALTIMETER","RADIO-PSH-SWITCH-PTR","RADIO-RATE-PTR","RAMP-POWER-PTR","REDUCTOR-PTR","RES-AG-PTR","RIGHT-COVER-EMERG-VACATION-PTR","RIGHT-EMERG-SW1-PTR","RIGHT-EMERG-SW2-PTR","RIGHT-EMERG-SW3-PTR","ROPE-PTR","Radio equipment datalink SA-TLF power switch","Radio equipment datalink TLK power switch","Radio equipment datalink UHF TLK power switch","Rear fuel tank pumps","Reducing gear box oil pressure indication selector","Right engine cut-off valve","Rotor brake","Rotor de-icing system switch","SHKVAL Optics adjustment","SIGNAL-FLARE-1-PTR","SIGNAL-FLARE-2-PTR","SIGNAL-FLARE-3-PTR","SIGNAL-FLARE-4-PTR","SIGNAL-FLARE-SWITCH-PTR","SPEECH-INFO-AVAR-PTR","SPU-9 Radio communicator selector","SR-PTR","SRO-PTR","START-ENGINE-SELECTOR-PTR","START-PANEL-ROLLING-PTR","SUO-COVER-PTR","SUO-PTR","Shkval scan rate","Signal flare green","Signal flare red","Signal flare system power","Signal flare white","Signal flare yellow","Sling load Auto/Manual","Stabilisation and indication of hanger cable switch","Standby Attitude Indicator power switch","Systems BIT selector","TEST-COVER-IKP-PTR","TLF-TLG modes","TLF-TLG-PTR","TLF-TLG-PTR01","Tip Lights","Training mode","UV26-BOARD-PTR","UV26-POWER-COVER-PTR","UV26-POWER-PTR","UV26-PROGR-PTR","UV26-TEST-COVER-PTR","UV26-TEST-PTR","Unguided rocket and gun pods ballistics data settings selector","V-SCAN-PTR","VARK-VOLUME-PTR01","VHF-1 (R828) power switch","VHF-2 (R-800) power switch","Video Tape Recorder switch","VnK-PTR","Voice message system emergency on","WINDSCREEN-WIPER-PTR","Weapon mode switch - Burst Length","Weapon system mode selector","Windshield washer fluid switch","Windshield wiper switch","ZK-LZP-PTR","ZPU-ZK-PTR","-0.11","-0.15","0.11","0.15","105","110","113","129","131","132","150","156","159","16","161","17","18","19","1st fire warning sensors group BIT","21","224","236","238","240","242","2nd fire warning sensors group BIT","3025","3026","3027","3029","303","304","305","306","307","308","309","310","311","312","313","314","315","316","317","318","319","320","321","322","323","327","330","331","332","333","334","338","340","35","353","355","372","373","384","385","39","397","3rd fire warning sensors group BIT","401","402","405","406","407","412","413","414","418","43","437","438","439","440","441","442","451","457","458","459","460","489","507","508","511","512","513","514","515","516","517","518","519","520","521","522","523","525","555","572","58","584","593","597","61","616","77","90","91","96","ABRIS Brightness","ABRIS Pushbutton 1","ABRIS Pushbutton 2","ABRIS Pushbutton 3","ABRIS Pushbutton 4","ABRIS Pushbutton 5","ABRIS_BRIGHTNESS_PTR","ACCELEROMETER","ADF Test","ADF Volume","ADI Zero pitch trim","AKS-PTR","ALTIMETER-BARO-PTR","APU extinguisher","ARK-CONTROL-PTR","ASU-PTR","Accelerometer reset","Airborne Target","Automatic turn on target mode","Autopilot Altitude hold","Autopilot Bank hold","Autopilot Director control","Autopilot Heading hold","Autopilot Pitch hold","BRIGHT-AGR-PKP-PTR","BRIGHT-DEV-PTR","BRIGHT-LEFT-RIGHT-PTR","BRIGHTNESS-PTR","Baro pressure QFE knob","Brightness","CHOP-LDP-PTR","CMD Dispense interval","CMD Num in sequence","CMD Num of sequences","CMD Reset to default program","CMD Start dispense","CMD Stop dispense","CONTR-SAP-PTR","CONTROL-ALARM-PTR","CONTROL-OIL-PTR","CONTROL-TEMP-NOTWORK-PTR","CONTROL-TEMP-WORK-PTR","CSO-PTR","DCLIN-PTR","DLNK Erase","DLNK Ingress point","DLNK Ingress to target","DLNK Send/Memory","DLNK Target #1/Vehicle","DLNK Target #2/SAM","DLNK Target #3/Other Type","DLNK to ALL","DLNK to Wingman 1","DLNK to Wingman 2","DLNK to Wingman 3","DLNK to Wingman 4","Dangerous RALT set rotary","EXTING-GROUPS-CTRL-01","EXTING-GROUPS-CTRL-02","EXTING-GROUPS-CTRL-03","Ejecting system circuit test","Engines vibrations monitoring system control button","Expedite emergency ATGM launch","External stores jettison","Forward hemisphere (head-on) air target aspect","Fuel quantity indicator self test button","G--PTR","Ground moving target","HSI Commanded course rotary","HSI Commanded heading rotary","HSI test","HUD Brightness","HUD Test","Helmet device brightness","IKP-TANGAGE-PTR","IT-23 display brightness","IT-23 display contrast","Interrupt start-up button","KONTR-PVD-PTR","L-140-RESET-PTR","L140-CNOB","LATITUDE-PTR","LWS Reset button","LWS self-test button","Lamps test","Laser designator reset","Latitude selection rotaty","Left EGT control threshold governor button","Left engine extinguisher","Lighting HSI and ADI brightness knob","Lighting auxiliary panel brightness knob","Lighting cockpit panel brightness knob","Lighting night vision cockpit brightness knob","MAIN-ROTOR-PTR","MASTER-UNLOAD-PTR","Magnetic variation selection rotaty","Master caution push-light","NAV '0' Btn","NAV '1' Btn","NAV '2' Btn","NAV '3' Btn","NAV '4' Btn","NAV '5' Btn","NAV '6' Btn","NAV '7' Btn","NAV '8' Btn","NAV '9' Btn","NAV Airfields","NAV Bearing/Range to target","NAV Brightness","NAV Cancel","NAV Course:Course Deviation/Time/Range to WPT","NAV Enter","NAV Fixpoints","NAV Inflight INU Realignment","NAV Initial Nav Pos","NAV Normal INU Alignment","NAV Precise INU Alignment","NAV Self coordinates","NAV Targets","NAV True Heading/Time/Range to final WPT","NAV Waypoints","NAV Wind Heading/Speed","Not implemented","P-CONTR-BRIGHT-PTR","PPR-DIRUPR-PTR05","PPR-K-PTR01","PPR-N-PTR03","PPR-T-PTR02","PPR-V-PTR04","PRC-CLEAN-PTR","PRC-ERASE-PTR","PRC-ESCAPE-PTR","PRC-SEND-PTR","PRC-TARGET-1-PTR","PRC-TARGET-2-PTR","PRC-TARGET-3-PTR","PRC-TARGET-POINT-PTR","PRC-WINGMAN-1-PTR","PRC-WINGMAN-2-PTR","PRC-WINGMAN-3-PTR","PRC-WINGMAN-4-PTR","PRC-WINGMAN-ALL-PTR","PTR-HUD-TEST","PTR_BTN-ABRIS-01","PTR_BTN-ABRIS-02","PTR_BTN-ABRIS-03","PTR_BTN-ABRIS-04","PTR_BTN-ABRIS-05","PTR_HUD-BRIGHTNESS","PUI800-AVARCHOP-PTR","PUI800-AVARCHOP-PTR01","PUI800-AVARCHOP-PTR02","PUI800-AVARCHOP-PTR03","PUI800-AVARCHOP-PTR04","PUI800-AVARSTART-PTR","PUR-CONTRAST-PTR","PUR-LIGHTIT-PTR","PUR-LIGHTNVU-PTR","PVI-0-PTR","PVI-1-PTR","PVI-2-PTR","PVI-3-PTR","PVI-4-PTR","PVI-5-PTR","PVI-6-PTR","PVI-7-PTR","PVI-8-PTR","PVI-9-PTR","PVI-ACDC-PTR","PVI-AER-PTR","PVI-BRIGHTNESS-PTR","PVI-CANCEL-PTR","PVI-DU-PTR","PVI-ENTER-PTR","PVI-FII-PTR","PVI-FILAMBDA-PTR","PVI-FIZ-PTR","PVI-HB-PTR","PVI-KC-PTR","PVI-OP-PTR","PVI-OT-PTR","PVI-PPM-PTR","PVI-PZ-PTR","PVI-TB-PTR","PVR-ADV-PTR","PVR-NPC-PTR","PVR-PPS-PTR","PVR-RESET-PTR","PVR-VC-PTR","Pitot heat system test","R-800 (VHF-2) BIT button","R-828 (VHF-1) Radio Volume","R-828 (VHF-1) Tuner button","RADIO-VOLUME-PTR","ROTARY-DANGEROUS-HIGHT-PTR","ROTARY-ZK-PTR","ROTARY-ZPU-PTR","RT-12-6-IV-PTR","RT-12-6-LEFT-PTR","RT-12-6-RIGHT-PTR","Radar altimeter test","Right EGT control threshold governor button","Right engine extinguisher","Rotor RPM warning push-light","Running engines exhaust gas temperature indicator test button","SHKVAL windscreen wiper","SPEECH-BIT-PTR","SPEECH-INFO-OFF-PTR01","SPEECH-INFO-RETRY-PTR","START-PANEL-CONTROL-PTR","START-PANEL-START-PTR","START-PANEL-STOP-START-PTR","START-PANEL-STOP-START-PTR01","Self test system push-button","Start-up selected engine button","Stop APU button","Stopped engines exhaust gas temperature indicator test button","TEST-IKP-PTR","TEST-PNP-PTR03","TEST-RADIO-HIGHT-PTR","Targeting mode reset","UV26-BURST-PTR","UV26-CANCELPRG-PTR","UV26-INTERVAL-PTR","UV26-SERIES-PTR","UV26-START-PTR","UV26-STOP-PTR","VARK-VOLUME-PTR","Ventilator extinguisher","Voice message system check","Voice message system messages off","Voice message system messages repeat","WIPER-PTR","ZMS_3"]});
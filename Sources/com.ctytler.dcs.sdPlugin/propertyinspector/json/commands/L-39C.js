@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"L-39C","rows":[48,1,14,563,2,360,3,1,0,566,48,1,14,563,2,360,0,1,0,566,776,730,12,808,6,774,0,1,0,857,28,27,12,830,7,216,1,1,0,463,28,27,13,831,7,216,1,1,0,463,28,27,14,786,7,696,37,1,0,788,28,27,15,383,2,171,75,1,79,458,28,27,15,383,2,171,77,1,79,458,28,27,18,870,7,684,37,1,0,791,28,27,16,630,2,146,75,1,79,462,28,27,16,630,2,146,77,1,79,462,28,27,22,368,2,343,3,3,0,460,28,27,22,368,2,343,0,3,0,460,28,27,17,440,2,342,3,1,0,459,28,27,17,440,2,342,0,1,0,459,28,27,23,369,2,172,49,1,59,461,28,27,23,369,2,172,31,1,59,461,28,27,38,790,6,700,0,1,0,837,28,27,39,809,6,724,0,1,0,811,28,27,32,523,2,285,53,1,0,527,28,27,32,523,2,285,37,1,0,527,28,27,52,874,7,725,37,1,0,810,51,0,12,862,7,681,1,1,0,780,51,0,13,894,7,683,1,1,0,779,51,0,14,622,2,141,3,1,0,374,51,0,14,622,2,141,0,1,0,374,51,0,15,863,7,680,1,1,0,777,51,0,39,621,2,143,1,1,0,373,51,0,39,621,2,143,0,1,0,373,51,0,32,623,2,142,1,1,0,372,51,0,32,623,2,142,0,1,0,372,51,0,55,861,7,682,1,1,0,778,73,68,12,133,6,303,0,1,0,66,73,68,13,133,6,303,3,3,1,66,73,68,14,133,7,732,139,1,0,66,73,68,15,435,6,733,0,1,0,109,73,68,18,435,7,734,1,1,80,109,74,69,12,134,6,306,0,1,0,66,74,69,13,134,6,306,3,3,1,66,74,69,14,134,7,741,139,1,0,66,74,69,15,436,6,742,0,1,0,109,74,69,18,436,7,743,1,1,80,109,20,19,12,799,6,709,0,1,0,508,20,19,13,801,6,710,0,1,0,510,20,19,14,803,6,711,0,1,0,509,20,19,15,800,6,746,0,1,0,508,20,19,18,802,6,747,0,1,0,510,20,19,16,804,6,748,0,1,0,509,20,19,22,366,2,689,0,1,0,90,20,19,17,366,6,688,0,1,0,90,20,19,23,367,6,358,3,3,1,90,20,19,23,367,6,358,0,1,0,90,20,19,39,546,2,144,3,3,0,107,20,19,39,546,2,144,0,3,0,107,20,19,32,547,2,307,53,53,0,107,20,19,32,547,2,307,37,53,0,107,20,19,55,782,7,302,1,3,0,796,20,19,61,783,7,758,1,1,0,795,20,19,56,668,2,359,3,1,0,670,20,19,56,668,2,359,0,1,0,670,20,19,64,564,2,301,3,1,0,567,20,19,64,564,2,301,0,1,0,567,20,19,71,784,2,302,1,1,0,832,5,4,12,378,2,147,3,1,0,382,5,4,12,378,2,147,0,1,0,382,5,4,13,548,2,148,3,1,0,552,5,4,13,548,2,148,0,1,0,552,5,4,14,574,2,149,3,1,0,493,5,4,14,574,2,149,0,1,0,493,5,4,15,556,2,334,3,1,0,560,5,4,15,556,2,334,0,1,0,560,5,4,18,876,6,726,0,1,0,671,5,4,16,455,2,289,3,1,0,130,5,4,16,455,2,289,0,1,0,130,5,4,22,877,6,754,0,1,0,671,5,4,17,456,2,325,3,1,0,130,5,4,17,456,2,325,0,1,0,130,5,4,23,669,2,288,3,1,0,665,5,4,23,669,2,288,0,1,0,665,5,4,38,457,2,287,3,1,0,664,5,4,38,457,2,287,0,1,0,664,5,4,39,785,6,727,0,1,0,495,5,4,32,445,2,298,3,1,0,101,5,4,32,445,2,298,0,1,0,101,5,4,52,794,6,755,0,1,0,495,5,4,57,446,2,330,3,1,0,101,5,4,57,446,2,330,0,1,0,101,5,4,58,490,2,291,3,1,0,127,5,4,58,490,2,291,0,1,0,127,5,4,55,447,2,290,3,1,0,128,5,4,55,447,2,290,0,1,0,128,5,4,61,491,2,327,3,1,0,127,5,4,61,491,2,327,0,1,0,127,5,4,62,448,2,326,3,1,0,128,5,4,62,448,2,326,0,1,0,128,5,4,63,629,2,295,49,1,59,497,5,4,63,629,2,295,31,1,59,497,5,4,70,454,2,294,3,1,0,496,5,4,70,454,2,294,0,1,0,496,5,4,56,470,2,293,3,1,0,95,5,4,56,470,2,293,0,1,0,95,5,4,64,441,2,292,3,1,0,96,5,4,64,441,2,292,0,1,0,96,5,4,85,471,2,329,3,1,0,95,5,4,85,471,2,329,0,1,0,95,5,4,71,442,2,328,3,1,0,96,5,4,71,442,2,328,0,1,0,96,5,4,86,488,2,150,3,1,0,398,5,4,86,488,2,150,0,1,0,398,5,4,132,365,2,151,3,1,0,388,5,4,132,365,2,151,0,1,0,388,5,4,87,438,2,152,3,1,0,405,5,4,87,438,2,152,0,1,0,405,5,4,244,439,2,153,3,1,0,406,5,4,244,439,2,153,0,1,0,406,5,4,245,608,2,154,3,1,0,414,5,4,245,608,2,154,0,1,0,414,5,4,247,551,2,155,3,1,0,407,5,4,247,551,2,155,0,1,0,407,5,4,248,532,2,156,3,1,0,417,5,4,248,532,2,156,0,1,0,417,5,4,249,474,2,157,3,1,0,402,5,4,249,474,2,157,0,1,0,402,5,4,250,473,2,158,3,1,0,416,5,4,250,473,2,158,0,1,0,416,5,4,251,675,2,159,3,1,0,432,5,4,251,675,2,159,0,1,0,432,5,4,252,575,2,160,3,1,0,415,5,4,252,575,2,160,0,1,0,415,5,4,253,125,2,161,3,1,0,420,5,4,253,125,2,161,0,1,0,420,5,4,255,631,2,189,3,1,0,391,5,4,255,631,2,189,0,1,0,391,5,4,256,632,2,190,3,1,0,392,5,4,256,632,2,190,0,1,0,392,5,4,257,633,2,191,3,1,0,412,5,4,257,633,2,191,0,1,0,412,5,4,258,634,2,192,3,1,0,413,5,4,258,634,2,192,0,1,0,413,5,4,259,635,2,193,3,1,0,411,5,4,259,635,2,193,0,1,0,411,5,4,260,636,2,194,3,1,0,389,5,4,260,636,2,194,0,1,0,389,5,4,261,637,2,195,3,1,0,421,5,4,261,637,2,195,0,1,0,421,5,4,262,638,2,196,3,1,0,423,5,4,262,638,2,196,0,1,0,423,5,4,263,639,2,197,3,1,0,400,5,4,263,639,2,197,0,1,0,400,5,4,264,640,2,198,3,1,0,395,5,4,264,640,2,198,0,1,0,395,5,4,265,641,2,199,3,1,0,425,5,4,265,641,2,199,0,1,0,425,5,4,266,642,2,200,3,1,0,410,5,4,266,642,2,200,0,1,0,410,5,4,267,643,2,201,3,1,0,426,5,4,267,643,2,201,0,1,0,426,5,4,268,644,2,202,3,1,0,427,5,4,268,644,2,202,0,1,0,427,5,4,269,645,2,203,3,1,0,418,5,4,269,645,2,203,0,1,0,418,5,4,270,646,2,204,3,1,0,431,5,4,270,646,2,204,0,1,0,431,5,4,271,647,2,205,3,1,0,428,5,4,271,647,2,205,0,1,0,428,5,4,272,648,2,206,3,1,0,394,5,4,272,648,2,206,0,1,0,394,5,4,273,649,2,207,3,1,0,403,5,4,273,649,2,207,0,1,0,403,5,4,274,650,2,209,3,1,0,404,5,4,274,650,2,209,0,1,0,404,5,4,275,651,2,210,3,1,0,397,5,4,275,651,2,210,0,1,0,397,5,4,276,652,2,211,3,1,0,399,5,4,276,652,2,211,0,1,0,399,5,4,277,653,2,212,3,1,0,396,5,4,277,653,2,212,0,1,0,396,5,4,278,654,2,213,3,1,0,419,5,4,278,654,2,213,0,1,0,419,5,4,279,618,2,335,3,1,0,422,5,4,279,618,2,335,0,1,0,422,5,4,280,624,2,336,3,1,0,424,5,4,280,624,2,336,0,1,0,424,5,4,281,371,2,337,3,1,0,430,5,4,281,371,2,337,0,1,0,430,5,4,282,531,2,344,3,1,0,401,5,4,282,531,2,344,0,1,0,401,5,4,720,869,6,716,0,1,0,872,5,4,721,868,6,714,0,1,0,873,5,4,722,822,6,717,0,1,0,824,5,4,723,821,6,715,0,1,0,825,5,4,284,489,2,170,3,1,0,492,5,4,284,489,2,170,0,1,0,492,29,26,12,787,6,729,0,1,0,815,29,26,13,449,2,299,3,1,0,104,29,26,13,449,2,299,0,1,0,104,29,26,14,797,6,728,0,1,0,506,29,26,15,450,2,331,3,1,0,104,29,26,15,450,2,331,0,1,0,104,29,26,18,798,6,756,0,1,0,506,29,26,16,667,6,230,3,3,1,507,29,26,16,667,6,230,0,1,0,507,29,26,22,453,2,296,3,1,0,603,29,26,22,453,2,296,0,1,0,603,29,26,17,561,2,297,3,1,0,604,29,26,17,561,2,297,0,1,0,604,29,26,23,607,2,215,3,1,0,605,29,26,23,607,2,215,0,1,0,605,29,26,38,666,2,214,3,3,0,606,29,26,38,666,2,214,0,3,0,606,29,26,39,437,2,333,3,1,0,464,29,26,39,437,2,333,0,1,0,464,102,72,12,659,2,310,53,1,0,663,102,72,12,659,2,310,37,1,0,663,102,72,13,660,2,309,53,1,0,512,102,72,13,660,2,309,37,1,0,512,103,88,13,504,2,242,1,1,0,105,103,88,13,504,2,242,0,1,0,105,103,88,14,505,2,320,1,1,0,105,103,88,14,505,2,320,0,1,0,105,45,43,13,520,2,185,137,3,0,516,45,43,13,520,2,185,40,3,0,516,45,43,14,521,6,186,3,3,1,518,45,43,14,521,6,186,0,1,0,518,45,43,15,519,2,187,137,3,0,517,45,43,15,519,2,187,40,3,0,517,45,43,18,522,6,188,3,3,1,515,45,43,18,522,6,188,0,1,0,515,45,43,16,807,7,706,1,1,678,806,45,43,32,859,6,685,0,1,0,550,45,43,52,860,6,745,0,1,0,550,45,43,57,820,7,764,1,1,0,823,35,34,12,481,2,184,3,1,0,108,35,34,12,481,2,184,0,1,0,108,35,34,13,482,2,357,3,1,0,108,35,34,13,482,2,357,0,1,0,108,35,34,14,477,2,181,3,1,0,99,35,34,14,477,2,181,0,1,0,99,35,34,15,478,2,354,3,1,0,99,35,34,15,478,2,354,0,1,0,99,35,34,18,475,2,182,3,1,0,94,35,34,18,475,2,182,0,1,0,94,35,34,16,476,2,355,3,1,0,94,35,34,16,476,2,355,0,1,0,94,35,34,22,479,2,183,3,1,0,112,35,34,22,479,2,183,0,1,0,112,35,34,17,480,2,356,3,1,0,112,35,34,17,480,2,356,0,1,0,112,65,60,13,816,6,41,0,1,0,539,65,60,14,818,7,72,1,3,0,540,65,60,17,655,2,313,3,1,0,364,65,60,17,655,2,313,0,1,0,364,65,60,23,656,2,314,3,1,0,363,65,60,23,656,2,314,0,1,0,363,541,208,13,817,6,735,0,1,0,539,541,208,14,819,7,736,1,3,0,540,24,21,14,555,2,174,53,1,0,559,24,21,14,555,2,174,37,1,0,559,24,21,15,554,2,173,53,1,0,558,24,21,15,554,2,173,37,1,0,558,24,21,18,472,2,217,3,1,0,494,24,21,18,472,2,217,0,1,0,494,24,21,16,542,2,286,3,3,0,129,24,21,16,542,2,286,0,3,0,129,24,21,22,543,2,324,3,3,0,129,24,21,22,543,2,324,0,3,0,129,24,21,17,529,2,300,3,3,0,106,24,21,17,529,2,300,0,3,0,106,24,21,23,813,7,731,37,31,50,536,24,21,38,530,2,332,3,3,0,106,24,21,38,530,2,332,0,3,0,106,24,21,39,814,7,757,37,31,50,536,24,21,32,892,7,704,0,1,0,677,24,21,52,889,6,705,0,1,0,676,24,21,57,893,7,765,0,1,0,677,24,21,58,891,6,766,0,1,0,676,46,40,12,384,2,361,3,1,0,92,46,40,12,384,2,361,0,1,0,92,46,40,13,385,2,362,3,1,0,92,46,40,13,385,2,362,0,1,0,92,46,40,16,525,2,140,3,1,0,535,46,40,16,525,2,140,0,1,0,535,46,40,22,386,2,237,1,1,0,511,46,40,22,386,2,237,0,1,0,511,46,40,17,387,2,323,1,1,0,613,46,40,17,387,2,323,0,1,0,613,46,40,23,792,6,707,0,1,0,805,46,40,38,793,6,767,0,1,0,856,135,131,12,827,7,751,1,1,0,526,135,131,13,658,2,311,3,1,0,514,135,131,13,658,2,311,0,1,0,514,557,218,12,828,7,737,1,1,0,526,557,218,13,890,6,763,0,1,0,789,42,41,12,878,7,719,1,1,0,562,42,41,13,879,7,752,1,1,0,562,42,41,14,781,7,753,1,1,0,829,42,41,15,483,2,246,3,1,0,100,42,41,15,483,2,246,0,1,0,100,42,41,18,484,2,321,3,1,0,100,42,41,18,484,2,321,0,1,0,100,42,41,16,661,2,254,3,1,0,93,42,41,16,661,2,254,0,1,0,93,42,41,22,662,2,322,3,1,0,93,42,41,22,662,2,322,0,1,0,93,42,41,17,673,2,283,3,1,0,528,42,41,17,673,2,283,0,1,0,528,111,84,12,609,7,773,31,1,0,122,111,84,13,609,6,772,0,1,0,122,111,84,15,610,7,740,31,1,0,122,111,84,18,610,6,739,0,1,0,122,9,8,12,844,7,691,0,48,48,579,9,8,13,594,2,163,3,1,0,118,9,8,13,594,2,163,0,1,0,118,9,8,14,590,2,164,49,1,81,116,9,8,14,590,2,164,31,1,81,116,9,8,15,840,7,694,1,1,0,577,9,8,18,582,2,166,76,1,54,114,9,8,18,582,2,166,78,1,54,114,9,8,16,580,2,167,49,1,50,115,9,8,16,580,2,167,31,1,50,115,9,8,22,842,7,695,1,1,0,578,9,8,17,586,2,168,76,1,54,119,9,8,17,586,2,168,78,1,54,119,9,8,23,584,2,169,49,1,50,120,9,8,23,584,2,169,31,1,50,120,9,8,38,588,6,165,3,3,1,117,9,8,38,588,6,165,0,1,0,117,9,8,39,379,2,145,3,1,0,121,9,8,39,379,2,145,0,1,0,121,9,8,32,592,2,162,3,1,0,113,9,8,32,592,2,162,0,1,0,113,9,8,52,838,7,693,0,48,48,576,9,8,57,845,7,759,0,48,48,579,9,8,58,595,2,346,3,1,0,118,9,8,58,595,2,346,0,1,0,118,9,8,55,591,2,347,49,1,81,116,9,8,55,591,2,347,31,1,81,116,9,8,61,841,7,761,1,1,0,577,9,8,62,583,2,349,76,1,54,114,9,8,62,583,2,349,78,1,54,114,9,8,63,581,2,350,49,1,50,115,9,8,63,581,2,350,31,1,50,115,9,8,70,843,7,762,1,1,0,578,9,8,56,587,2,351,76,1,54,119,9,8,56,587,2,351,78,1,54,119,9,8,64,585,2,352,49,1,50,120,9,8,64,585,2,352,31,1,50,120,9,8,85,589,6,348,3,3,1,117,9,8,85,589,6,348,0,1,0,117,9,8,71,380,2,308,3,1,0,121,9,8,71,380,2,308,0,1,0,121,9,8,86,593,2,345,3,1,0,113,9,8,86,593,2,345,0,1,0,113,9,8,132,839,7,760,0,48,48,576,9,8,87,657,2,312,3,1,0,370,9,8,87,657,2,312,0,1,0,370,30,25,12,601,2,176,49,1,59,599,30,25,12,601,2,176,31,1,59,599,30,25,13,812,6,697,0,1,0,848,30,25,14,875,6,698,0,1,0,851,30,25,15,849,7,699,1,1,0,846,30,25,18,855,7,701,1,1,67,852,30,25,16,619,6,177,3,3,1,533,30,25,16,619,6,177,0,1,0,533,30,25,22,620,6,178,3,3,1,534,30,25,22,620,6,178,0,1,0,534,30,25,17,433,2,179,136,1,83,600,30,25,17,433,2,179,138,1,83,600,30,25,23,434,2,180,136,1,83,598,30,25,23,434,2,180,138,1,83,598,30,25,38,858,6,702,0,1,0,871,30,25,39,853,7,703,1,1,0,847,30,25,32,854,6,718,0,1,0,850,30,25,52,487,2,353,3,1,0,597,30,25,52,487,2,353,0,1,0,597,47,44,12,568,2,236,75,1,82,110,47,44,12,568,2,236,77,1,82,110,47,44,13,570,2,238,3,1,0,126,47,44,13,570,2,238,0,1,0,126,47,44,14,572,2,239,3,1,0,123,47,44,14,572,2,239,0,1,0,123,47,44,15,569,2,315,75,1,82,110,47,44,15,569,2,315,77,1,82,110,47,44,18,571,2,316,3,1,0,126,47,44,18,571,2,316,0,1,0,126,47,44,16,573,2,317,3,1,0,123,47,44,16,573,2,317,0,1,0,123,615,304,12,503,2,243,3,1,0,616,615,304,12,503,2,243,0,1,0,616,125,305,12,602,2,175,3,1,0,617,125,305,12,602,2,175,0,1,0,617,36,33,12,866,7,712,37,1,67,538,36,33,13,835,7,713,37,1,67,612,36,33,14,627,2,241,3,1,0,89,36,33,14,627,2,241,0,1,0,89,36,33,15,625,2,240,3,1,0,124,36,33,15,625,2,240,0,1,0,124,36,33,18,833,6,687,0,1,0,611,36,33,16,864,6,686,0,1,0,537,36,33,22,867,7,749,37,1,67,538,36,33,17,836,7,750,37,1,67,612,36,33,23,628,2,319,3,1,0,89,36,33,23,628,2,319,0,1,0,89,36,33,38,626,2,318,3,1,0,124,36,33,38,626,2,318,0,1,0,124,36,33,39,834,6,769,0,1,0,611,36,33,32,865,6,768,0,1,0,537,880,690,12,887,7,770,0,1,0,674,881,692,12,888,7,744,0,1,0,674,882,775,12,884,7,771,0,1,0,381,883,679,12,885,7,738,0,1,0,381,11,10,12,549,2,219,3,1,0,393,11,10,12,549,2,219,0,1,0,393,11,10,13,672,2,220,3,1,0,429,11,10,13,672,2,220,0,1,0,429,11,10,14,375,2,221,3,1,0,390,11,10,14,375,2,221,0,1,0,390,11,10,15,524,2,222,3,1,0,409,11,10,15,524,2,222,0,1,0,409,11,10,18,513,2,223,3,1,0,408,11,10,18,513,2,223,0,1,0,408,11,10,16,886,7,708,0,1,0,826,11,10,22,565,2,224,3,1,0,553,11,10,22,565,2,224,0,1,0,553,11,10,17,451,2,225,3,1,0,91,11,10,17,451,2,225,0,1,0,91,11,10,23,544,2,226,3,1,0,376,11,10,23,544,2,226,0,1,0,376,11,10,38,443,2,227,3,1,0,97,11,10,38,443,2,227,0,1,0,97,11,10,39,485,2,228,3,1,0,98,11,10,39,485,2,228,0,1,0,98,11,10,32,596,2,229,49,31,80,614,11,10,32,596,2,229,31,31,80,614,11,10,52,498,2,231,3,1,0,467,11,10,52,498,2,231,0,1,0,467,11,10,57,499,2,233,3,1,0,465,11,10,57,499,2,233,0,1,0,465,11,10,58,500,2,234,3,1,0,466,11,10,58,500,2,234,0,1,0,466,11,10,55,501,2,235,3,1,0,468,11,10,55,501,2,235,0,1,0,468,11,10,61,502,2,232,3,1,0,469,11,10,61,502,2,232,0,1,0,469,11,10,62,452,2,340,3,1,0,91,11,10,62,452,2,340,0,1,0,91,11,10,63,545,2,341,3,3,0,377,11,10,63,545,2,341,0,3,0,377,11,10,70,444,2,338,3,1,0,97,11,10,70,444,2,338,0,1,0,97,11,10,56,486,2,339,3,1,0,98,11,10,56,486,2,339,0,1,0,98],"strings":["1","0","TUMB","-1","4","ELEC_INTERFACE","BTN","LEV","21","RKL_41","3","WEAPON_SYSTEM","3001","3002","3003","3004","3006","3008","3005","37","CTRL_INTERFACE","20","3007","3009","LIGHTS","31","6","7","AIR_INTERFACE","ENGINE_INTERFACE","RSBN_5","0.1","3012","34","35","HYDRO_INTERFACE","SPU_9","0.5","3010","3011","2","30","OXYGEN","17","19","GMK1AE","MECHANICS","R_832M","","-0.1","0.9","ASP_3NM","3013","-0.5","0.938","3016","3021","3014","3015","0.2","22","3017","3018","3019","3022","KPP_1273K","Mech clock left lever","0.8","12","13","3020","3024","39","CLOCK","CLOCK_INSTRUCTOR","-0.05","-0.0588","0.05","0.0588","0.25","0.3","0.4","0.95","0.975","14","3023","3025","3027","5","ADF Audio Switch, ADF/OFF","Air Brake Switch","Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE","Canopy Handle","Diluter Demand Switch, 100% / MIX","Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)","Emergency Fuel Switch","Emergency Fuel Switch Cover, Open/Close","Emergency Jettison Switch Cover, OPEN/CLOSE","Emergency Jettison Switch, ON/OFF","Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)","Emergency Oxygen Switch, ON/OFF","Engine Button Cover, Open/Close","FAILURES_PANEL","FUEL_INTERFACE","Fire Extinguish Button Cover, OPEN/CLOSE","Fuel Shut-Off Lever","Instrument Lighting Switch, Red/OFF/White","Landing Gear Control Lever","Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)","Mech clock right lever","R-832M Preset Channel Selector Knob","RADAR_ALTIMETER","RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)","RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL","RKL-41 ADF Far NDB 100kHz rotary","RKL-41 ADF Far NDB 10kHz rotary","RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP","RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT","RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)","RKL-41 ADF Near NDB 100kHz rotary","RKL-41 ADF Near NDB 10kHz rotary","RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch","RV-5M Radio Altimeter Test Button/Decision Height Knob","Radio Control Switch - Flip switch to take control","Reserve Intercom Switch, ON/OFF","SDU","Squelch Switch, ON/OFF","Stop Engine Switch","Stop Engine Switch Cover, Open/Close","Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING","Turbo Button Cover, Open/Close","24","3026","CLOCK_LEFT_BTN","CLOCK_LEFT_BTN_CPT2","NPP","-0.025","-2","0.025","0.04","1000","101","104","105","118","119","121","141","142","143","144","145","146","147","148","149","150","151","152","153","154","155","158","159","160","162","163","164","166","167","169","172","174","175","176","177","178","187","188","191","192","194","195","196","197","204","205","207","208","211","212","213","214","215","216","217","218","219","220","221","222","223","224","225","226","227","228","229","23","230","231","232","233","234","242","243","245","249","25","254","255","256","257","258","260","267","268","269","270","271","272","273","274","275","276","277","284","285","286","287","290","291","296","298","3028","3029","303","3030","3031","3032","3033","3034","3035","3036","304","3040","3041","3042","3043","3044","3045","3046","3047","3048","3049","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","3063","3064","3065","3066","3067","307","3072","308","311","312","313","314","317","318","319","320","321","322","323","324","325","327","330","333","334","335","36","41","412","437","440","456","457","458","459","460","461","468","469","470","473","474","475","479","480","485","486","487","489","490","491","492","493","495","497","499","502","503","504","505","506","507","508","509","510","511","512","515","516","517","519","520","521","523","524","527","533","534","535","536","548","549","627","998","999","AGD Bank Failure","AGD Pitch Failure","AGD_GMK","AIR_BRAKE_BTN","AIR_BRAKE_BTN_CPT2","AIR_COND","ANTI_ICING","ARK Failure","ARMS","ASP-3NMU Gunsight Color Filter, ON/OFF","ASP-3NMU Gunsight Fixed Reticle Mask Lever","ASP-3NMU Gunsight Mode, GYRO/FIXED","ASP_FKP","Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK","Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK","BATTERY","BEACON_SWITCH","BEACON_SWITCH_CPT2","Baro pressure QFE knob","Battery Switch, ON/OFF","CABIN_HEATING_MODE","CANOPY_CPT1","CANOPY_CPT2","CANOPY_LOCK","CANOPY_LOCK_CPT2","CB AGD-GMK Switch, ON/OFF","CB ARC, ON/OFF","CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF","CB Air Conditioning, ON/OFF","CB Anti-Ice, ON/OFF","CB Armament System Power Switch, ON/OFF","CB Booster Pump, ON/OFF","CB Control, ON/OFF","CB Emergency Jettison, ON/OFF","CB Engine Instruments, ON/OFF","CB Engine Switch, ON/OFF","CB Fire, ON/OFF","CB Gears, ON/OFF","CB Ground Intercom, ON/OFF","CB IFF (SRO) Emergency Connection Switch, ON/OFF","CB Ignition 1, ON/OFF","CB Ignition 2, ON/OFF","CB Inverter 1 (AC 115V) Switch, ON/OFF","CB Inverter 2 (AC 115V) Switch, ON/OFF","CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF","CB Missile Seeker Glowing Circuit Power Switch, ON/OFF","CB Missile Seeker Heating Circuit Power Switch, ON/OFF","CB Nav. Lights, ON/OFF","CB PT-500C, ON/OFF","CB Pitot Left, ON/OFF","CB Pitot Right, ON/OFF","CB RDO (ICS and Radio) Switch, ON/OFF","CB RIO-3 De-Icing Signal Switch, ON/OFF","CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF","CB RSBN (ISKRA) Switch, ON/OFF","CB Red Lights, ON/OFF","CB SARPP, ON/OFF","CB SDU Switch, ON/OFF","CB SRO, ON/OFF","CB Seat, ON/OFF","CB Seat-Helmet, ON/OFF","CB Signal, ON/OFF","CB Signaling, ON/OFF","CB Spotlight Left, ON/OFF","CB Spotlight Right, ON/OFF","CB Start Panel, ON/OFF","CB UB-16 Rocket Firing Control Circuit Power Switch, ON/OFF","CB Weapon Switch, ON/OFF","CB White Lights, ON/OFF","CB Wing Tanks Switch, ON/OFF","CHANNEL_NAVIGATION","CHANNEL_RANGE","CLOCK_RIGHT_BTN","CLOCK_RIGHT_BTN_CPT2","CONTROL_EGT_IND","CONVERTER_1","CONVERTER_2","COVER_AIR_COND","COVER_EMERCENCY_FUEL","COVER_EMERCENCY_FUEL_CPT2","COVER_EMER_JETTISON","COVER_EMER_JETTISON_CPT2","COVER_ENGINE","COVER_ENGINE_CPT2","COVER_ENGINE_STOP","COVER_ENGINE_STOP_CPT2","COVER_FIRE","COVER_FIRE_CPT2","COVER_LIVE","COVER_LIVE_CPT2","COVER_OFF_RT12","COVER_START_MODE","COVER_TURBO","COVER_TURBO_CPT2","COVER_TURBO_STOP","Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC","Conditioning Shutoff Switch Cover, OPEN/CLOSE","Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE","De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF","Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL","ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON","EGT Indicator Switch, FRONT/REAR","EKSR-46 Green Signal Flare Launch Button","EKSR-46 Red Signal Flare Launch Button","EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF","EKSR-46 White Signal Flare Launch Button","EKSR-46 Yellow Signal Flare Launch Button","EMERCENCY_FUEL","EMERCENCY_FUEL_CPT2","EMERGENCY_LIGHT","EMERGENCY_ON_ISKRA","EMERGENCY_ON_SRO","EMERGENCY_VALVE_FLAPS","EMERGENCY_VALVE_FLAPS_CPT2","EMERGENCY_VALVE_GEAR","EMERGENCY_VALVE_GEAR_CPT2","EMERGENCY_VALVE_GENERATOR","EMERGENCY_VALVE_GENERATOR_CPT2","EMERGENCY_VALVE_HYDRAULIC","EMERGENCY_VALVE_HYDRAULIC_CPT2","EMERG_OXYGEN","EMERG_OXYGEN_CPT2","EMER_JETTISON","EMER_JETTISON_CPT2","EMER_LANDING_ON","ENGINE","ENGINE_INDICAT_EMERG","ENGINE_STOP","ENGINE_STOP_CPT2","Emergency Engine Instruments Power Switch, ON/OFF","Emergency Generator Switch, ON/OFF","Emergency Instrument Light Switch, ON/OFF","Engine Button","Engine Start Mode Switch Cover, Open/Close","Engine Start Mode Switch, START/FALSE START/COLD CRANKING","FLARES_DISPENSER","FLARE_GREEN","FLARE_RED","FLARE_WHITE","FLARE_YELLOW","FLIGHT_REC_SWITCH","FUEL_SHUT_OFF","FUEL_SHUT_OFF_CPT2","Fire Extinguish Button - Push to extinguish","Fire Warning Signal Test Switch, I/OFF/II","Flaps Flight Position (0 degrees) Button","Flaps Landing Position (44 degrees) Button","Flaps Takeoff Position (25 degrees) Button","Forward Canopy Lock Handle","Full Pressure Failure Lever, ON/STBY/FAILURE","GLOWING_SS","GMK Failure","GMK-1AE GMC Course Selector Switch, CCW/OFF/CW","GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)","GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)","GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy","GMK_MODE","GMK_SELECT","GMK_TEST","GMK_ZK","HEATING_HELMET_MODE","HEATING_SS","HOOD","HSI Course set knob","Helmet Heating Mode Switch, AUTO/OFF/ON","Helmet Ventilation Switch, ON/OFF","INSTRUMENT_LIGHTING","INSTRUMENT_LIGHTING_CPT2","INTERCOM_GRND","ISKRA","Initial Azimuth","Initial Range","Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT","Instrument Lights Intensity Knob","Intercom Button","Intercom Volume Knob","KPP-1273K Attitude Director Indicator (ADI) Cage Button","KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob","KPP_1273K_INSTRUCTOR","LANDING_LIGHTS","LANDING_LIGHTS_CPT2","LIVE","LIVE_CPT2","L_G_CONTRIOL_LEVEL","L_G_CONTRIOL_LEVEL_CPT2","MAIN_GENERATOR","MASTER_ARM","MC Synchronization Button - Push to synchronize (level flight only)","MRP_RV","Main Generator Switch, ON/OFF","Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)","NAVIG_LIGHTS_BRIGHTNESS","NAVIG_LIGHTS_FLICKER","NETW","NPP_INSTRUCTOR","Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)","Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED","Net Switch, ON/OFF","OFF_RT12","Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)","PANEL_HOOD","PITOT_CONTROL","PORT_STARB_BOTH","Panel Visor Extend","Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)","RADIO_CHANNEL","RADIO_CHANNEL_CPT2","RADIO_NOISE_SUPPR","RADIO_NOISE_SUPPR_CPT2","RADIO_REMOTE","RADIO_REMOTE_CPT2","RESERVE_GENERATOR","RIO","RKL-41 ADF Brightness Knob","RKL-41 ADF Far NDB Frequency Tune","RKL-41 ADF Near NDB Frequency Tune","RKL-41 ADF Volume Knob","RKL_FREQ_1_00XX","RKL_FREQ_1_00XX_CPT2","RKL_FREQ_1_XX00","RKL_FREQ_1_XX_CPT2","RKL_FREQ_2_00XX","RKL_FREQ_2_00XX_CPT2","RKL_FREQ_2_XX00","RKL_FREQ_2_XX_CPT2","RKL_L_R","RKL_L_R_CPT2","RKL_MODE","RKL_MODE_CPT2","RKL_REMOTE","RKL_REMOTE_CPT2","RKL_TLF_TLG","RKL_TLF_TLG_CPT2","ROCKETS_MODE_SELECTOR","RSBN Emergency Landing Switch, ON/OFF","RSBN Landing Channel Selector Knob","RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH","RSBN Navigation Channel Selector Knob","RSBN_MODE","RSBN_SDU","RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE","RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED","RT-12 JPT Regulator Power Switch, ON/OFF","RT-12 JPT Regulator Test Switch, I/OFF/II","RT12","RTL","RV_SELECT_ALT","RV_SELECT_ALT_CPT2","Radio Button","Radio Volume Knob","Rearward Canopy Lock Handle","Rockets Firing Mode Selector Switch, AUT./2RS/4RS","SARPP","SARPP Flight Recorder, ON/OFF","SDU Switch, ON/OFF","SEAT","SETTING_AZ","SETTING_RANGE","SIGHT_MECH","SIGHT_MODE","SIGHT_SUN_FILTER","SIGNAL","SPU_REZ","SPU_REZ_CPT2","SPU_RK","SPU_RK_CPT2","START_MODE","SUIT_COND_MODE","SWITCH_001","SWITCH_002","SWITCH_003","SWITCH_004","SWITCH_005","SWITCH_006","SWITCH_007","SWITCH_008","SWITCH_009","SWITCH_010","SWITCH_011","SWITCH_012","SWITCH_013","SWITCH_014","SWITCH_015","SWITCH_016","SWITCH_017","SWITCH_018","SWITCH_019","SWITCH_020","SWITCH_021","SWITCH_022","SWITCH_023","SWITCH_024","SWITCH_AGD_PITCH","SWITCH_AGD_ROLL","SWITCH_ARK","SWITCH_GMK","SWITCH_STATIC_PRESSURE","SWITCH_TOTAL_PRESSURE","SWITSH_OXYGEN","SWITSH_OXYGEN_CPT2","Static Pressure Failure Lever, ON/STBY/FAILURE","Stop Turbo Switch Cover, Open/Close","Stop Turbo Switch, ON/OFF","TEST_RT12","TEST_SSP","THROTTLE_LIMIT","TURBO_STOP","Throttle Limiter","Turbo Button","UB_16","VENT_HELMET","Variometer adjustment knob","WING_TANK","Warning-Light Check Button - Push to check","Warning-Light Intensity Knob","0.728","10","102","103","106","107","120","124","133","134","135","136","15","157","16","161","165","168","173","179","180","181","183","184","193","201","202","203","209","244","259","281","282","283","288","289","292","293","294","295","297","306","3068","3069","3070","3071","309","310","315","326","328","329","33","331","336","337","338","367","376","385","394","398","399","413","414","415","419","444","465","466","467","471","472","48","482","484","488","494","496","498","501","514","518","522","525","526","532","537","538","539","546","547","569","57","60","61","89","9","ACCELEROMETER","ASP-3NMU Gunsight Brightness Knob","ASP-3NMU Gunsight Mirror Depression","ASP-3NMU Gunsight Target Distance","ASP-3NMU Gunsight Target Wingspan Adjustment Dial (meters)","BOTTLES_ INTERCON","BRAKE_CONTROL","BRAKE_CONTROL_CPT2","BRAKE_CONTROL_LOCK","BTN_ENGINE","CABIN_TEMP","CONTROL_IV300","Cabin Air Temperature Controller Rheostat","Course Accordance","DE_ICE","Diffuser and Flight Suit Temperature Rheostat","EJECT_CANOPY","EJECT_CANOPY_CPT2","ENGINE_CPT2","Emergency Wheel Brake Lever","Emergency/Parking Wheel Brake Lever","FIRE","FIRE_CPT2","FLAPS_00","FLAPS_00_CPT2","FLAPS_25","FLAPS_25_CPT2","FLAPS_44","FLAPS_44_CPT2","Forward Canopy Emergency Jettison Handle","GMK-1AE GMC Latitude Selector Knob","GMK_LATITUDE","G_RESET","HEATING_QUICK","Helmet Heating Temperature Rheostat","Helmet Visor Quick Heating Button - Push to heat","IDENTIF","INSTRUMENT_LIGHTING_CONTROL","INSTRUMENT_LIGHTING_CONTROL_CPT2","IV-300 Engine Vibration Test Button - Push to test","KPP_ARRETIR","KPP_ARRETIR_CPT2","KPP_SET_0","KPP_SET_0_CPT2","MAGNETIC_VAR_KNOB","MAIN-OFF","MAIN-ON","Magnetic Declination set knob","Main (Right) Pitot Tube Heating Button - Push to turn heating on","Main (Right) Pitot Tube Heating Off Button - Push to turn heating off","Missile Seeker Tone Volume Knob","NPP_COURSE","NPP_COURSE_CPT2","Oxygen Interconnaction Valve (CLOSE - CW, OPEN - CCW)","PRESSUR","PRESSUR_CPT2","Parking Brake Lever Flag - Push to remove parking brake","RADIO_BTN","RADIO_BTN_CPT2","RADIO_VOLUME","RADIO_VOLUME_CPT2","RIO-3 De-Icing Sensor Heating Circuit Check Button - Push to test","RKL_BRIGHTNESS","RKL_BRIGHTNESS_CPT2","RKL_FREQ_1_TUNING","RKL_FREQ_1_TUNING_CPT2","RKL_FREQ_2_TUNING","RKL_FREQ_2_TUNING_CPT2","RKL_VOLUME","RKL_VOLUME_CPT2","RSBN Control Box Lighting Intensity Knob","RSBN Field Elevation Knob","RSBN Identification Button","RSBN LIGHTING","RSBN Listen Callsign Button - Push to listen","RSBN Test Button - Push to test","RSBN Volume Knob","RSBN_ALT_SELECTOR","RSBN_BEACON_AUDIO","RSBN_VOLUME","Rearward Canopy Emergency Jettison Handle","Reset Limits","SETTING_0_AZ","SET_GIRO","SET_GIRO_CPT2","SIGHT_ANGLE_REFLECTOR","SIGHT_BASE","SIGHT_BRIGHTNESS","SPU_BTN","SPU_BTN_CPT2","SPU_VOLUME","SPU_VOLUME_CPT2","STAND-BY-OFF","STAND-BY-ON","SUIT_TEMPR","Set 0 Azimuth","Standby (Left) Pitot Tube Heating Button - Push to turn heating on","Standby (Left) Pitot Tube Heating Off Button - Push to turn heating off","TEMP_CONTROL_HELMET","TESTING","TURBO","TURBO_CPT2","VALVE_OXYGEN","VALVE_OXYGEN_CPT2","VARIOMETER","VARIOMETER_INSTRUCTOR","VD_20","VD_20_INSTRUCTOR","VD_PRESSUR","VD_PRESSUR_CPT2","VOLUME_SS","VV_SET_0","VV_SET_0_CPT2","WARNING_LIGHT_CHECK","WARNING_LIGHT_CHECK003","WARNING_LIGHT_CHECK_CPT2","WARNING_LIGHT_INTENSITY","WARNING_LIGHT_INTENSITY_CPT2","pnt_107"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"L-39ZA","rows":[48,1,14,610,2,376,3,1,0,618,48,1,14,610,2,376,0,1,0,618,836,785,12,872,8,834,0,1,0,926,28,27,12,896,9,234,1,1,0,492,28,27,13,897,9,234,1,1,0,492,28,27,14,846,9,750,31,1,0,849,28,27,15,409,2,189,74,1,79,485,28,27,15,409,2,189,76,1,79,485,28,27,18,940,9,738,31,1,0,854,28,27,16,684,2,164,74,1,79,491,28,27,16,684,2,164,76,1,79,491,28,27,22,386,2,344,3,3,0,489,28,27,22,386,2,344,0,3,0,489,28,27,17,469,2,343,3,1,0,488,28,27,17,469,2,343,0,1,0,488,28,27,23,387,2,190,51,1,78,490,28,27,23,387,2,190,37,1,78,490,28,27,39,852,8,754,0,1,0,906,28,27,40,873,8,779,0,1,0,875,28,27,32,567,2,286,52,1,0,571,28,27,32,567,2,286,31,1,0,571,28,27,53,944,9,780,31,1,0,874,50,0,12,931,9,735,1,1,0,840,50,0,13,964,9,737,1,1,0,839,50,0,14,675,2,159,3,1,0,394,50,0,14,675,2,159,0,1,0,394,50,0,15,932,9,734,1,1,0,837,50,0,40,674,2,161,1,1,0,393,50,0,40,674,2,161,0,1,0,393,50,0,32,676,2,160,1,1,0,392,50,0,32,676,2,160,0,1,0,392,50,0,55,930,9,736,1,1,0,838,72,67,12,152,8,304,0,1,0,65,72,67,13,152,8,304,3,3,1,65,72,67,14,152,9,787,157,1,0,65,72,67,15,464,8,788,0,1,0,123,72,67,18,464,9,789,1,1,80,123,73,68,12,153,8,307,0,1,0,65,73,68,13,153,8,307,3,3,1,65,73,68,14,153,9,796,157,1,0,65,73,68,15,465,8,797,0,1,0,123,73,68,18,465,9,798,1,1,80,123,20,19,12,863,8,763,0,1,0,547,20,19,13,865,8,764,0,1,0,549,20,19,14,867,8,765,0,1,0,548,20,19,15,864,8,801,0,1,0,547,20,19,18,866,8,802,0,1,0,549,20,19,16,868,8,803,0,1,0,548,20,19,22,384,2,743,0,1,0,105,20,19,17,384,8,742,0,1,0,105,20,19,23,385,8,359,3,3,1,105,20,19,23,385,8,359,0,1,0,105,20,19,40,592,2,162,3,3,0,121,20,19,40,592,2,162,0,3,0,121,20,19,32,593,2,308,52,52,0,121,20,19,32,593,2,308,31,52,0,121,20,19,55,842,9,303,1,3,0,860,20,19,60,843,9,813,1,1,0,859,20,19,56,722,2,360,3,1,0,724,20,19,56,722,2,360,0,1,0,724,20,19,63,611,2,302,3,1,0,619,20,19,63,611,2,302,0,1,0,619,20,19,70,844,2,303,1,1,0,900,5,4,12,401,2,165,3,1,0,407,5,4,12,401,2,165,0,1,0,407,5,4,13,594,2,166,3,1,0,598,5,4,13,594,2,166,0,1,0,598,5,4,14,627,2,167,3,1,0,525,5,4,14,627,2,167,0,1,0,525,5,4,15,602,2,335,3,1,0,606,5,4,15,602,2,335,0,1,0,606,5,4,18,946,8,781,0,1,0,725,5,4,16,482,2,290,3,1,0,144,5,4,16,482,2,290,0,1,0,144,5,4,22,947,8,809,0,1,0,725,5,4,17,483,2,326,3,1,0,144,5,4,17,483,2,326,0,1,0,144,5,4,23,723,2,289,3,1,0,719,5,4,23,723,2,289,0,1,0,719,5,4,39,484,2,288,3,1,0,718,5,4,39,484,2,288,0,1,0,718,5,4,40,845,8,782,0,1,0,534,5,4,32,473,2,299,3,1,0,115,5,4,32,473,2,299,0,1,0,115,5,4,53,857,8,810,0,1,0,534,5,4,57,474,2,331,3,1,0,115,5,4,57,474,2,331,0,1,0,115,5,4,58,522,2,292,3,1,0,141,5,4,58,522,2,292,0,1,0,141,5,4,55,475,2,291,3,1,0,142,5,4,55,475,2,291,0,1,0,142,5,4,60,523,2,328,3,1,0,141,5,4,60,523,2,328,0,1,0,141,5,4,61,476,2,327,3,1,0,142,5,4,61,476,2,327,0,1,0,142,5,4,62,683,2,296,3,3,0,536,5,4,62,683,2,296,0,3,0,536,5,4,69,481,2,295,3,1,0,535,5,4,69,481,2,295,0,1,0,535,5,4,56,499,2,294,3,1,0,111,5,4,56,499,2,294,0,1,0,111,5,4,63,470,2,293,3,1,0,112,5,4,63,470,2,293,0,1,0,112,5,4,85,500,2,330,3,1,0,111,5,4,85,500,2,330,0,1,0,111,5,4,70,471,2,329,3,1,0,112,5,4,70,471,2,329,0,1,0,112,5,4,86,520,2,168,3,1,0,425,5,4,86,520,2,168,0,1,0,425,5,4,147,383,2,169,3,1,0,415,5,4,147,383,2,169,0,1,0,415,5,4,87,467,2,170,3,1,0,433,5,4,87,467,2,170,0,1,0,433,5,4,262,468,2,171,3,1,0,434,5,4,262,468,2,171,0,1,0,434,5,4,263,661,2,172,3,1,0,443,5,4,263,661,2,172,0,1,0,443,5,4,265,597,2,173,3,1,0,435,5,4,265,597,2,173,0,1,0,435,5,4,266,576,2,174,3,1,0,446,5,4,266,576,2,174,0,1,0,446,5,4,267,503,2,175,3,1,0,430,5,4,267,503,2,175,0,1,0,430,5,4,268,502,2,176,3,1,0,445,5,4,268,502,2,176,0,1,0,445,5,4,269,729,2,177,3,1,0,459,5,4,269,729,2,177,0,1,0,459,5,4,270,628,2,178,3,1,0,444,5,4,270,628,2,178,0,1,0,444,5,4,271,139,2,179,3,1,0,449,5,4,271,139,2,179,0,1,0,449,5,4,272,388,2,377,3,1,0,429,5,4,272,388,2,377,0,1,0,429,5,4,273,391,2,378,3,1,0,107,5,4,273,391,2,378,0,1,0,107,5,4,275,685,2,207,3,1,0,418,5,4,275,685,2,207,0,1,0,418,5,4,88,686,2,208,3,1,0,419,5,4,88,686,2,208,0,1,0,419,5,4,89,687,2,209,3,1,0,441,5,4,89,687,2,209,0,1,0,441,5,4,90,688,2,210,3,1,0,442,5,4,90,688,2,210,0,1,0,442,5,4,91,689,2,211,3,1,0,440,5,4,91,689,2,211,0,1,0,440,5,4,92,690,2,212,3,1,0,416,5,4,92,690,2,212,0,1,0,416,5,4,148,691,2,213,3,1,0,450,5,4,148,691,2,213,0,1,0,450,5,4,93,692,2,214,3,1,0,452,5,4,93,692,2,214,0,1,0,452,5,4,94,693,2,215,3,1,0,427,5,4,94,693,2,215,0,1,0,427,5,4,149,694,2,216,3,1,0,422,5,4,149,694,2,216,0,1,0,422,5,4,95,695,2,217,3,1,0,454,5,4,95,695,2,217,0,1,0,454,5,4,150,696,2,218,3,1,0,439,5,4,150,696,2,218,0,1,0,439,5,4,96,697,2,219,3,1,0,455,5,4,96,697,2,219,0,1,0,455,5,4,97,698,2,220,3,1,0,456,5,4,97,698,2,220,0,1,0,456,5,4,98,699,2,221,3,1,0,447,5,4,98,699,2,221,0,1,0,447,5,4,151,700,2,222,3,1,0,458,5,4,151,700,2,222,0,1,0,458,5,4,99,701,2,223,3,1,0,457,5,4,99,701,2,223,0,1,0,457,5,4,100,702,2,224,3,1,0,421,5,4,100,702,2,224,0,1,0,421,5,4,101,703,2,225,3,1,0,431,5,4,101,703,2,225,0,1,0,431,5,4,102,704,2,227,3,1,0,432,5,4,102,704,2,227,0,1,0,432,5,4,276,705,2,228,3,1,0,424,5,4,276,705,2,228,0,1,0,424,5,4,277,706,2,229,3,1,0,426,5,4,277,706,2,229,0,1,0,426,5,4,278,707,2,230,3,1,0,423,5,4,278,707,2,230,0,1,0,423,5,4,279,708,2,231,3,1,0,448,5,4,279,708,2,231,0,1,0,448,5,4,280,671,2,336,3,1,0,451,5,4,280,671,2,336,0,1,0,451,5,4,281,677,2,337,3,1,0,453,5,4,281,677,2,337,0,1,0,453,5,4,282,390,2,338,3,1,0,107,5,4,282,390,2,338,0,1,0,107,5,4,283,575,2,345,3,1,0,428,5,4,283,575,2,345,0,1,0,428,5,4,774,939,8,770,0,1,0,942,5,4,775,938,8,768,0,1,0,943,5,4,776,887,8,771,0,1,0,889,5,4,777,886,8,769,0,1,0,890,5,4,285,521,2,188,3,1,0,524,5,4,285,521,2,188,0,1,0,524,29,26,12,848,8,784,0,1,0,879,29,26,13,477,2,300,3,1,0,118,29,26,13,477,2,300,0,1,0,118,29,26,14,861,8,783,0,1,0,545,29,26,15,478,2,332,3,1,0,118,29,26,15,478,2,332,0,1,0,118,29,26,18,862,8,811,0,1,0,545,29,26,16,721,8,248,3,3,1,546,29,26,16,721,8,248,0,1,0,546,29,26,22,480,2,297,3,1,0,656,29,26,22,480,2,297,0,1,0,656,29,26,17,607,2,298,3,1,0,657,29,26,17,607,2,298,0,1,0,657,29,26,23,660,2,233,3,1,0,658,29,26,23,660,2,233,0,1,0,658,29,26,39,720,2,232,3,3,0,659,29,26,39,720,2,232,0,3,0,659,29,26,40,466,2,334,3,1,0,493,29,26,40,466,2,334,0,1,0,493,116,71,12,713,2,311,52,1,0,717,116,71,12,713,2,311,31,1,0,717,116,71,13,714,2,310,52,1,0,551,116,71,13,714,2,310,31,1,0,551,117,103,13,543,2,260,1,1,0,119,117,103,13,543,2,260,0,1,0,119,117,103,14,544,2,321,1,1,0,119,117,103,14,544,2,321,0,1,0,119,45,43,13,559,2,203,145,3,0,555,45,43,13,559,2,203,38,3,0,555,45,43,14,560,8,204,3,3,1,557,45,43,14,560,8,204,0,1,0,557,45,43,15,558,2,205,145,3,0,556,45,43,15,558,2,205,38,3,0,556,45,43,18,561,8,206,3,3,1,554,45,43,18,561,8,206,0,1,0,554,45,43,16,871,9,760,1,1,732,870,45,43,32,928,8,739,0,1,0,596,45,43,53,929,8,800,0,1,0,596,45,43,57,885,9,819,1,1,0,888,35,34,12,510,2,202,3,1,0,122,35,34,12,510,2,202,0,1,0,122,35,34,13,511,2,358,3,1,0,122,35,34,13,511,2,358,0,1,0,122,35,34,14,506,2,199,3,1,0,113,35,34,14,506,2,199,0,1,0,113,35,34,15,507,2,355,3,1,0,113,35,34,15,507,2,355,0,1,0,113,35,34,18,504,2,200,3,1,0,110,35,34,18,504,2,200,0,1,0,110,35,34,16,505,2,356,3,1,0,110,35,34,16,505,2,356,0,1,0,110,35,34,22,508,2,201,3,1,0,126,35,34,22,508,2,201,0,1,0,126,35,34,17,509,2,357,3,1,0,126,35,34,17,509,2,357,0,1,0,126,64,59,13,881,8,41,0,1,0,584,64,59,14,883,9,71,1,3,0,585,64,59,17,709,2,314,3,1,0,382,64,59,17,709,2,314,0,1,0,382,64,59,23,710,2,315,3,1,0,381,64,59,23,710,2,315,0,1,0,381,586,226,13,882,8,790,0,1,0,584,586,226,14,884,9,791,1,3,0,585,24,21,14,601,2,192,52,1,0,605,24,21,14,601,2,192,31,1,0,605,24,21,15,600,2,191,52,1,0,604,24,21,15,600,2,191,31,1,0,604,24,21,18,501,2,235,3,1,0,526,24,21,18,501,2,235,0,1,0,526,24,21,16,587,2,287,3,3,0,143,24,21,16,587,2,287,0,3,0,143,24,21,22,588,2,325,3,3,0,143,24,21,22,588,2,325,0,3,0,143,24,21,17,573,2,301,3,3,0,120,24,21,17,573,2,301,0,3,0,120,24,21,23,877,9,786,31,37,49,581,24,21,39,574,2,333,3,3,0,120,24,21,39,574,2,333,0,3,0,120,24,21,40,878,9,812,31,37,49,581,24,21,32,962,9,758,0,1,0,731,24,21,53,959,8,759,0,1,0,730,24,21,57,963,9,820,0,1,0,731,24,21,58,961,8,821,0,1,0,730,46,38,12,411,2,379,3,1,0,108,46,38,12,411,2,379,0,1,0,108,46,38,13,412,2,380,3,1,0,108,46,38,13,412,2,380,0,1,0,108,46,38,16,569,2,158,3,1,0,580,46,38,16,569,2,158,0,1,0,580,46,38,22,413,2,255,1,1,0,550,46,38,22,413,2,255,0,1,0,550,46,38,17,414,2,324,1,1,0,666,46,38,17,414,2,324,0,1,0,666,46,38,23,855,8,761,0,1,0,869,46,38,39,856,8,822,0,1,0,925,154,146,12,892,9,806,1,1,0,570,154,146,13,712,2,312,3,1,0,553,154,146,13,712,2,312,0,1,0,553,603,236,12,893,9,792,1,1,0,570,603,236,13,960,8,818,0,1,0,850,42,41,12,948,9,773,1,1,0,609,42,41,13,949,9,807,1,1,0,609,42,41,14,841,9,808,1,1,0,895,42,41,15,512,2,264,3,1,0,114,42,41,15,512,2,264,0,1,0,114,42,41,18,513,2,322,3,1,0,114,42,41,18,513,2,322,0,1,0,114,42,41,16,715,2,274,3,1,0,109,42,41,16,715,2,274,0,1,0,109,42,41,22,716,2,323,3,1,0,109,42,41,22,716,2,323,0,1,0,109,42,41,17,727,2,284,3,1,0,572,42,41,17,727,2,284,0,1,0,572,125,84,12,662,9,833,37,1,0,136,125,84,13,662,8,832,0,1,0,136,125,84,15,663,9,795,37,1,0,136,125,84,18,663,8,794,0,1,0,136,11,10,12,913,9,745,0,48,48,632,11,10,13,647,2,181,3,1,0,132,11,10,13,647,2,181,0,1,0,132,11,10,14,643,2,182,51,1,81,130,11,10,14,643,2,182,37,1,81,130,11,10,15,909,9,748,1,1,0,630,11,10,18,635,2,184,75,1,54,128,11,10,18,635,2,184,77,1,54,128,11,10,16,633,2,185,51,1,49,129,11,10,16,633,2,185,37,1,49,129,11,10,22,911,9,749,1,1,0,631,11,10,17,639,2,186,75,1,54,133,11,10,17,639,2,186,77,1,54,133,11,10,23,637,2,187,51,1,49,134,11,10,23,637,2,187,37,1,49,134,11,10,39,641,8,183,3,3,1,131,11,10,39,641,8,183,0,1,0,131,11,10,40,402,2,163,3,1,0,135,11,10,40,402,2,163,0,1,0,135,11,10,32,645,2,180,3,1,0,127,11,10,32,645,2,180,0,1,0,127,11,10,53,907,9,747,0,48,48,629,11,10,57,914,9,814,0,48,48,632,11,10,58,648,2,347,3,1,0,132,11,10,58,648,2,347,0,1,0,132,11,10,55,644,2,348,51,1,81,130,11,10,55,644,2,348,37,1,81,130,11,10,60,910,9,816,1,1,0,630,11,10,61,636,2,350,75,1,54,128,11,10,61,636,2,350,77,1,54,128,11,10,62,634,2,351,51,1,49,129,11,10,62,634,2,351,37,1,49,129,11,10,69,912,9,817,1,1,0,631,11,10,56,640,2,352,75,1,54,133,11,10,56,640,2,352,77,1,54,133,11,10,63,638,2,353,51,1,49,134,11,10,63,638,2,353,37,1,49,134,11,10,85,642,8,349,3,3,1,131,11,10,85,642,8,349,0,1,0,131,11,10,70,403,2,309,3,1,0,135,11,10,70,403,2,309,0,1,0,135,11,10,86,646,2,346,3,1,0,127,11,10,86,646,2,346,0,1,0,127,11,10,147,908,9,815,0,48,48,629,11,10,87,711,2,313,3,1,0,389,11,10,87,711,2,313,0,1,0,389,30,25,12,654,2,194,51,1,78,652,30,25,12,654,2,194,37,1,78,652,30,25,13,876,8,751,0,1,0,917,30,25,14,945,8,752,0,1,0,920,30,25,15,918,9,753,1,1,0,915,30,25,18,924,9,755,1,1,66,921,30,25,16,672,8,195,3,3,1,578,30,25,16,672,8,195,0,1,0,578,30,25,22,673,8,196,3,3,1,579,30,25,22,673,8,196,0,1,0,579,30,25,17,460,2,197,155,1,83,653,30,25,17,460,2,197,156,1,83,653,30,25,23,461,2,198,155,1,83,651,30,25,23,461,2,198,156,1,83,651,30,25,39,927,8,756,0,1,0,941,30,25,40,922,9,757,1,1,0,916,30,25,32,923,8,772,0,1,0,919,30,25,53,519,2,354,3,1,0,650,30,25,53,519,2,354,0,1,0,650,47,44,12,621,2,254,74,1,82,124,47,44,12,621,2,254,76,1,82,124,47,44,13,623,2,256,3,1,0,140,47,44,13,623,2,256,0,1,0,140,47,44,14,625,2,257,3,1,0,137,47,44,14,625,2,257,0,1,0,137,47,44,15,622,2,316,74,1,82,124,47,44,15,622,2,316,76,1,82,124,47,44,18,624,2,317,3,1,0,140,47,44,18,624,2,317,0,1,0,140,47,44,16,626,2,318,3,1,0,137,47,44,16,626,2,318,0,1,0,137,668,305,12,542,2,261,3,1,0,669,668,305,12,542,2,261,0,1,0,669,139,306,12,655,2,193,3,1,0,670,139,306,12,655,2,193,0,1,0,670,36,33,12,935,9,766,31,1,66,583,36,33,13,904,9,767,31,1,66,665,36,33,14,680,2,259,3,1,0,104,36,33,14,680,2,259,0,1,0,104,36,33,15,678,2,258,3,1,0,138,36,33,15,678,2,258,0,1,0,138,36,33,18,902,8,741,0,1,0,664,36,33,16,933,8,740,0,1,0,582,36,33,22,936,9,804,31,1,66,583,36,33,17,905,9,805,31,1,66,665,36,33,23,681,2,320,3,1,0,104,36,33,23,681,2,320,0,1,0,104,36,33,39,679,2,319,3,1,0,138,36,33,39,679,2,319,0,1,0,138,36,33,40,903,8,824,0,1,0,664,36,33,32,934,8,823,0,1,0,582,950,744,12,957,9,825,0,1,0,728,951,746,12,958,9,799,0,1,0,728,952,835,12,954,9,826,0,1,0,406,953,733,12,955,9,793,0,1,0,406,7,6,12,595,2,237,3,1,0,420,7,6,12,595,2,237,0,1,0,420,7,6,13,726,2,238,3,1,0,436,7,6,13,726,2,238,0,1,0,436,7,6,14,395,2,239,3,1,0,417,7,6,14,395,2,239,0,1,0,417,7,6,15,568,2,240,3,1,0,438,7,6,15,568,2,240,0,1,0,438,7,6,18,552,2,241,3,1,0,437,7,6,18,552,2,241,0,1,0,437,7,6,16,956,9,762,0,1,0,891,7,6,22,614,2,242,145,3,0,599,7,6,22,614,2,242,38,3,0,599,7,6,17,590,2,243,3,1,0,106,7,6,17,590,2,243,0,1,0,106,7,6,23,589,2,244,3,1,0,399,7,6,23,589,2,244,0,1,0,399,7,6,39,517,2,245,3,1,0,529,7,6,39,517,2,245,0,1,0,529,7,6,40,514,2,246,3,1,0,530,7,6,40,514,2,246,0,1,0,530,7,6,32,649,2,247,51,37,80,667,7,6,32,649,2,247,37,37,80,667,7,6,53,537,2,249,3,1,0,496,7,6,53,537,2,249,0,1,0,496,7,6,57,538,2,251,3,1,0,494,7,6,57,538,2,251,0,1,0,494,7,6,58,539,2,252,3,1,0,495,7,6,58,539,2,252,0,1,0,495,7,6,55,540,2,253,3,1,0,497,7,6,55,540,2,253,0,1,0,497,7,6,60,541,2,250,3,1,0,498,7,6,60,541,2,250,0,1,0,498,7,6,61,479,2,341,3,1,0,106,7,6,61,479,2,341,0,1,0,106,7,6,62,591,2,342,3,3,0,400,7,6,62,591,2,342,0,3,0,400,7,6,69,472,2,339,3,1,0,531,7,6,69,472,2,339,0,1,0,531,7,6,56,518,2,340,3,1,0,532,7,6,56,518,2,340,0,1,0,532,7,6,88,613,2,364,3,1,0,566,7,6,88,613,2,364,0,1,0,566,7,6,89,612,2,365,3,1,0,565,7,6,89,612,2,365,0,1,0,565,7,6,90,516,2,369,3,1,0,527,7,6,90,516,2,369,0,1,0,527,7,6,91,515,2,370,3,1,0,528,7,6,91,515,2,370,0,1,0,528,7,6,92,617,2,375,52,1,0,620,7,6,92,617,2,375,31,1,0,620,7,6,148,847,8,827,0,1,0,901,7,6,93,410,2,361,3,1,0,564,7,6,93,410,2,361,0,1,0,564,7,6,94,616,2,367,3,1,0,608,7,6,94,616,2,367,0,1,0,608,7,6,149,899,8,828,0,1,0,894,7,6,95,615,2,368,3,1,0,577,7,6,95,615,2,368,0,1,0,577,7,6,150,898,8,829,0,1,0,880,7,6,96,463,2,362,3,1,0,487,7,6,96,463,2,362,0,1,0,487,7,6,97,462,2,363,3,1,0,486,7,6,97,462,2,363,0,1,0,486,7,6,98,682,2,371,3,1,0,533,7,6,98,682,2,371,0,1,0,533,7,6,151,937,8,830,0,1,0,858,7,6,99,563,2,373,3,1,0,398,7,6,99,563,2,373,0,1,0,398,7,6,100,562,2,374,3,1,0,397,7,6,100,562,2,374,0,1,0,397,7,6,101,404,2,372,3,1,0,396,7,6,101,404,2,372,0,1,0,396,7,6,102,405,2,366,3,3,0,408,7,6,102,405,2,366,0,3,0,408,7,6,778,851,8,831,0,1,0,853],"strings":["1","0","TUMB","-1","4","ELEC_INTERFACE","3","WEAPON_SYSTEM","BTN","LEV","21","RKL_41","3001","3002","3003","3004","3006","3008","3005","37","CTRL_INTERFACE","20","3007","3009","LIGHTS","31","6","7","AIR_INTERFACE","ENGINE_INTERFACE","RSBN_5","0.5","3012","34","35","HYDRO_INTERFACE","SPU_9","0.1","2","3010","3011","30","OXYGEN","17","19","GMK1AE","MECHANICS","R_832M","","0.9","ASP_3NM","-0.1","-0.5","3013","0.938","3016","3021","3014","3015","22","3017","3018","3019","3022","KPP_1273K","Mech clock left lever","0.8","12","13","3020","3024","39","CLOCK","CLOCK_INSTRUCTOR","-0.05","-0.0588","0.05","0.0588","0.2","0.25","0.3","0.4","0.95","0.975","14","3023","3025","3027","3041","3042","3043","3044","3045","3047","3048","3050","3052","3053","3054","3056","3057","3058","3059","5","ADF Audio Switch, ADF/OFF","Air Brake Switch","Arm/Safe Bombs Emergency Jettison Switch Cover, OPEN/CLOSE","CB Weapon Switch, ON/OFF","Canopy Handle","Diluter Demand Switch, 100% / MIX","Emergency Flaps Extension Lever, FORWARD(OFF)/BACKWARD(ON)","Emergency Fuel Switch","Emergency Fuel Switch Cover, Open/Close","Emergency Landing Gear Extension Lever, FORWARD(OFF)/BACKWARD(ON)","Emergency Oxygen Switch, ON/OFF","Engine Button Cover, Open/Close","FAILURES_PANEL","FUEL_INTERFACE","Fire Extinguish Button Cover, OPEN/CLOSE","Fuel Shut-Off Lever","Instrument Lighting Switch, Red/OFF/White","Landing Gear Control Lever","Main and Emergency Hydraulic Systems Interconnection Lever, FORWARD(OFF)/BACKWARD(ON)","Mech clock right lever","R-832M Preset Channel Selector Knob","RADAR_ALTIMETER","RAT (Emergency Generator) Emergency Lever, FORWARD(OFF)/BACKWARD(ON)","RKL-41 ADF Control Switch, TAKE CONTROL/HAND OVER CONTROL","RKL-41 ADF Far NDB 100kHz rotary","RKL-41 ADF Far NDB 10kHz rotary","RKL-41 ADF Function Selector Switch, OFF/COMP(AUTO)/COMP(MAN)/ANT/LOOP","RKL-41 ADF Loop Switch, LEFT/OFF/RIGHT","RKL-41 ADF Mode Switch, TLF(A3)/TLG(A1,A2)","RKL-41 ADF Near NDB 100kHz rotary","RKL-41 ADF Near NDB 10kHz rotary","RKL-41 ADF Outer-Inner Beacon (Far-Near NDB) Switch","RV-5M Radio Altimeter Test Button/Decision Height Knob","Radio Control Switch - Flip switch to take control","Reserve Intercom Switch, ON/OFF","SDU","Squelch Switch, ON/OFF","Stop Engine Switch","Stop Engine Switch Cover, Open/Close","Taxi and Landing Lights (Searchlights) Control Switch, TAXI/OFF/LANDING","Turbo Button Cover, Open/Close","-2","24","3026","3046","3049","3051","3055","CLOCK_LEFT_BTN","CLOCK_LEFT_BTN_CPT2","NPP","-0.025","0.025","0.04","1000","101","104","105","118","119","121","141","142","143","144","145","146","147","148","149","150","151","152","153","154","155","158","159","160","162","163","164","166","167","169","172","174","175","176","177","178","187","188","191","192","194","195","196","197","204","205","207","208","211","212","213","214","215","216","217","218","219","220","221","222","223","224","225","226","227","228","229","23","230","231","232","233","234","242","243","245","249","25","254","255","256","257","258","260","267","268","269","270","271","272","273","274","275","276","277","284","285","286","287","290","291","296","298","3028","3029","303","3030","3031","3032","3033","3034","3035","3036","3037","3038","304","3040","3060","3061","3062","3063","3064","3065","3066","3067","307","3072","308","311","312","313","314","317","318","319","320","321","322","323","324","325","327","330","333","334","335","36","41","412","437","440","456","457","458","459","460","461","468","469","470","473","474","475","479","480","485","486","487","489","490","491","492","493","495","497","499","502","503","504","505","506","507","508","509","510","511","512","515","516","517","519","520","521","523","524","527","533","534","535","536","548","549","576","577","578","582","583","584","585","587","589","590","591","596","597","598","607","627","628","629","998","999","AGD Bank Failure","AGD Pitch Failure","AGD_GMK","AIR_BRAKE_BTN","AIR_BRAKE_BTN_CPT2","AIR_COND","ANTI_ICING","AOA_HTR","ARK Failure","ARMS","ARMS_CPT1","ASP-3NMU Gunsight Color Filter, ON/OFF","ASP-3NMU Gunsight Fixed Reticle Mask Lever","ASP-3NMU Gunsight Mode, GYRO/FIXED","ASP_FKP","Arm Bombs","Arm Inner Guns","Arm Outer Guns","Arm/Safe Bombs Emergency Jettison Switch, LIVE/BLANK","Arm/Safe Bombs Emergency Jettison Switch, LIVE/BOMBS/BLANK","BATTERY","BEACON_SWITCH","BEACON_SWITCH_CPT2","BOMBS","BOMBS_SERIES","Baro pressure QFE knob","Battery Switch, ON/OFF","Bombs Series","CABIN_HEATING_MODE","CANNON_GS","CANOPY_CPT1","CANOPY_CPT2","CANOPY_LOCK","CANOPY_LOCK_CPT2","CB AGD-GMK Switch, ON/OFF","CB ARC, ON/OFF","CB ASP-FKP (Gunsight and Gun Camera) Power Switch, ON/OFF","CB Air Conditioning, ON/OFF","CB Anti-Ice, ON/OFF","CB Armament System Power Switch, ON/OFF","CB Booster Pump, ON/OFF","CB Control, ON/OFF","CB Emergency Jettison, ON/OFF","CB Engine Instruments, ON/OFF","CB Engine Switch, ON/OFF","CB Fire, ON/OFF","CB Gears, ON/OFF","CB Ground Intercom, ON/OFF","CB Heating AOA Sensor Switch, ON/OFF","CB IFF (SRO) Emergency Connection Switch, ON/OFF","CB Ignition 1, ON/OFF","CB Ignition 2, ON/OFF","CB Inverter 1 (AC 115V) Switch, ON/OFF","CB Inverter 2 (AC 115V) Switch, ON/OFF","CB MRP-RV (Marker Beacon Receiver and Radio Altimeter) Switch, ON/OFF","CB Missile Firing Control Circuit Power Switch, ON/OFF","CB Missile Seeker Glowing Circuit Power Switch, ON/OFF","CB Missile Seeker Heating Circuit Power Switch, ON/OFF","CB Nav. Lights, ON/OFF","CB PT-500C, ON/OFF","CB Pitot Left, ON/OFF","CB Pitot Right, ON/OFF","CB RDO (ICS and Radio) Switch, ON/OFF","CB RIO-3 De-Icing Signal Switch, ON/OFF","CB RSBN (ISKRA) Emergency Connection Switch, ON/OFF","CB RSBN (ISKRA) Switch, ON/OFF","CB Red Lights, ON/OFF","CB SARPP, ON/OFF","CB SDU Switch, ON/OFF","CB SRO, ON/OFF","CB Seat, ON/OFF","CB Seat-Helmet, ON/OFF","CB Signal, ON/OFF","CB Signaling, ON/OFF","CB Spotlight Left, ON/OFF","CB Spotlight Right, ON/OFF","CB Start Panel, ON/OFF","CB White Lights, ON/OFF","CB Wing Tanks Switch, ON/OFF","CHANNEL_NAVIGATION","CHANNEL_RANGE","CHARGE_GUNS_INNER","CHARGE_GUNS_OUTER","CLOCK_RIGHT_BTN","CLOCK_RIGHT_BTN_CPT2","CONTROL_EGT_IND","CONVERTER_1","CONVERTER_2","COVER_AIR_COND","COVER_EMERCENCY_FUEL","COVER_EMERCENCY_FUEL_CPT2","COVER_EMER_JETTISON_CPT2","COVER_ENGINE","COVER_ENGINE_CPT2","COVER_ENGINE_STOP","COVER_ENGINE_STOP_CPT2","COVER_FIRE","COVER_FIRE_CPT2","COVER_LIVE_CPT2","COVER_OFF_RT12","COVER_START_MODE","COVER_TURBO","COVER_TURBO_CPT2","COVER_TURBO_STOP","Cabin Air Conditioning Control Switch, OFF/HEAT/COOL/AUTOMATIC","Charge Inner Guns","Charge Outer Guns","Conditioning Shutoff Switch Cover, OPEN/CLOSE","Conditioning Shutoff Switch, OPEN/FRONT PILOT CONTROL/CLOSE","De-Icing Mode Switch, MANUAL/AUTOMATIC/OFF","Diffuser and Flight Suit Air Conditioning Control Switch, HEAT/AUTO/COOL","ECS and Pressurization Handle, OFF/CANOPIES SEALED/ECS ON","EGT Indicator Switch, FRONT/REAR","EKSR-46 Green Signal Flare Launch Button","EKSR-46 Red Signal Flare Launch Button","EKSR-46 Signal Flare Dispenser Power Switch, ON/OFF","EKSR-46 White Signal Flare Launch Button","EKSR-46 Yellow Signal Flare Launch Button","EMERCENCY_FUEL","EMERCENCY_FUEL_CPT2","EMERGENCY_LIGHT","EMERGENCY_ON_ISKRA","EMERGENCY_ON_SRO","EMERGENCY_VALVE_FLAPS","EMERGENCY_VALVE_FLAPS_CPT2","EMERGENCY_VALVE_GEAR","EMERGENCY_VALVE_GEAR_CPT2","EMERGENCY_VALVE_GENERATOR","EMERGENCY_VALVE_GENERATOR_CPT2","EMERGENCY_VALVE_HYDRAULIC","EMERGENCY_VALVE_HYDRAULIC_CPT2","EMERG_OXYGEN","EMERG_OXYGEN_CPT2","EMER_JETTISON","EMER_JETTISON2","EMER_JETTISON2_COVER","EMER_JETTISON_COVER","EMER_JETTISON_CPT2","EMER_LANDING_ON","ENGINE","ENGINE_INDICAT_EMERG","ENGINE_STOP","ENGINE_STOP_CPT2","Emergency Engine Instruments Power Switch, ON/OFF","Emergency Generator Switch, ON/OFF","Emergency Instrument Light Switch, ON/OFF","Emergency Jettison Inboard Stations Switch Cover, OPEN/CLOSE","Emergency Jettison Inboard Stations Switch, ON/OFF","Emergency Jettison Outboard Stations Switch Cover, OPEN/CLOSE","Emergency Jettison Outboard Stations Switch, ON/OFF","Emergency Jettison Switch Cover, OPEN/CLOSE","Emergency Jettison Switch, ON/OFF","Emergency Launch Missiles Cover","Engine Button","Engine Start Mode Switch Cover, Open/Close","Engine Start Mode Switch, FALSE START/START/COLD CRANKING","FLARES_DISPENSER","FLARE_GREEN","FLARE_RED","FLARE_WHITE","FLARE_YELLOW","FLIGHT_REC_SWITCH","FUEL_SHUT_OFF","FUEL_SHUT_OFF_CPT2","Fire Extinguish Button - Push to extinguish","Fire Warning Signal Test Switch, I/OFF/II","Flaps Flight Position (0 degrees) Button","Flaps Landing Position (44 degrees) Button","Flaps Takeoff Position (25 degrees) Button","Forward Canopy Lock Handle","Full Pressure Failure Lever, ON/STBY/FAILURE","GLOWING_SS","GMK Failure","GMK-1AE GMC Course Selector Switch, CCW/OFF/CW","GMK-1AE GMC Hemisphere Selection Switch, N(orth)/S(outh)","GMK-1AE GMC Mode Switch, MC(Magnetic Compass Mode)/GC(Directional Gyro Mode)","GMK-1AE GMC Test Switch, 0(degrees)/OFF/300(degrees) - Use to check heading indication accuracy","GMK_MODE","GMK_SELECT","GMK_TEST","GMK_ZK","GUNS_WING_INNER","GUNS_WING_OUTER","Gsh-23 Arm/Safe","Gun+PK3 Switch","Gun+PK3 Switch Cover, OPEN/CLOSE","HEATING_HELMET_MODE","HEATING_SS","HOOD","HSI Course set knob","Helmet Heating Mode Switch, AUTO/OFF/ON","Helmet Ventilation Switch, ON/OFF","INSTRUMENT_LIGHTING","INSTRUMENT_LIGHTING_CPT2","INTERCOM_GRND","ISKRA","Inboard Stations Select","Initial Azimuth","Initial Range","Instrument Flight Practice Hood Control Handle, EXTEND/RETRACT","Instrument Lights Intensity Knob","Intercom Button","Intercom Volume Knob","KPP-1273K Attitude Director Indicator (ADI) Cage Button","KPP-1273K Attitude Director Indicator (ADI) Pitch Trim Knob","KPP_1273K_INSTRUCTOR","LANDING_LIGHTS","LANDING_LIGHTS_CPT2","LIVE","LIVE_COVER","LIVE_CPT2","L_G_CONTRIOL_LEVEL","L_G_CONTRIOL_LEVEL_CPT2","MAIN_GENERATOR","MASTER_ARM","MC Synchronization Button - Push to synchronize (level flight only)","MRP_RV","Main Generator Switch, ON/OFF","Missile/Bomb Release Selector Switch, PORT(Left)/STARB-BOTH(Right for Missiles/Both)","NAVIG_LIGHTS_BRIGHTNESS","NAVIG_LIGHTS_FLICKER","NETW","NPP_INSTRUCTOR","Navigation Lights Intensity Control Switch, DIM(30%)/BRT(60%)/MAX(100%)","Navigation Lights Mode Control Switch, FLICKER/OFF/FIXED","Net Switch, ON/OFF","OFF_RT12","Outboard Stations Select","Oxygen Supply Valve (CLOSE - CW, OPEN - CCW)","PANEL_HOOD","PITOT_CONTROL","PK3_GS","PK3_GS_COVER","PORT_STARB_BOTH","PYLON_INN_ON","PYLON_OUT_ON","PYRO","Panel Visor Extend","Pitot Tube Selector Lever, STBY(Left)/MAIN(Right)","Pyro Charge Select","RADIO_CHANNEL","RADIO_CHANNEL_CPT2","RADIO_NOISE_SUPPR","RADIO_NOISE_SUPPR_CPT2","RADIO_REMOTE","RADIO_REMOTE_CPT2","RESERVE_GENERATOR","RIO","RKL-41 ADF Brightness Knob","RKL-41 ADF Far NDB Frequency Tune","RKL-41 ADF Near NDB Frequency Tune","RKL-41 ADF Volume Knob","RKL_FREQ_1_00XX","RKL_FREQ_1_00XX_CPT2","RKL_FREQ_1_XX00","RKL_FREQ_1_XX_CPT2","RKL_FREQ_2_00XX","RKL_FREQ_2_00XX_CPT2","RKL_FREQ_2_XX00","RKL_FREQ_2_XX_CPT2","RKL_L_R","RKL_L_R_CPT2","RKL_MODE","RKL_MODE_CPT2","RKL_REMOTE","RKL_REMOTE_CPT2","RKL_TLF_TLG","RKL_TLF_TLG_CPT2","ROCKETS_MODE_SELECTOR","RSBN Emergency Landing Switch, ON/OFF","RSBN Landing Channel Selector Knob","RSBN Mode Switch, LANDING/NAVIGATION/GLIDE PATH","RSBN Navigation Channel Selector Knob","RSBN_MODE","RSBN_SDU","RT-12 JPT Regulator Manual Disable Switch Cover, OPEN/CLOSE","RT-12 JPT Regulator Manual Disable Switch, RT-12 DISABLED/RT-12 ENABLED","RT-12 JPT Regulator Power Switch, ON/OFF","RT-12 JPT Regulator Test Switch, I/OFF/II","RT12","RTL","RV_SELECT_ALT","RV_SELECT_ALT_CPT2","Radio Button","Radio Volume Knob","Rearward Canopy Lock Handle","Rockets Firing Mode Selector Switch, AUT./2RS/4RS","SARPP","SARPP Flight Recorder, ON/OFF","SDU Switch, ON/OFF","SEAT","SETTING_AZ","SETTING_RANGE","SIGHT_MECH","SIGHT_MODE","SIGHT_SUN_FILTER","SIGNAL","SPU_REZ","SPU_REZ_CPT2","SPU_RK","SPU_RK_CPT2","SS_COVER","START_MODE","SUIT_COND_MODE","SWITCH_001","SWITCH_002","SWITCH_003","SWITCH_004","SWITCH_005","SWITCH_006","SWITCH_007","SWITCH_008","SWITCH_009","SWITCH_010","SWITCH_011","SWITCH_012","SWITCH_013","SWITCH_014","SWITCH_015","SWITCH_016","SWITCH_017","SWITCH_018","SWITCH_019","SWITCH_020","SWITCH_021","SWITCH_022","SWITCH_023","SWITCH_024","SWITCH_AGD_PITCH","SWITCH_AGD_ROLL","SWITCH_ARK","SWITCH_GMK","SWITCH_STATIC_PRESSURE","SWITCH_TOTAL_PRESSURE","SWITSH_OXYGEN","SWITSH_OXYGEN_CPT2","Static Pressure Failure Lever, ON/STBY/FAILURE","Stop Turbo Switch Cover, Open/Close","Stop Turbo Switch, ON/OFF","TEST_RT12","TEST_SSP","THROTTLE_LIMIT","TURBO_STOP","Throttle Limiter","Turbo Button","UB_16","VENT_HELMET","Variometer adjustment knob","WING_TANK","Warning-Light Check Button - Push to check","Warning-Light Intensity Knob","0.728","10","102","103","106","107","120","124","133","134","135","136","15","157","16","161","165","168","173","179","180","181","183","184","193","201","202","203","209","244","259","281","282","283","288","289","292","293","294","295","297","306","3068","3069","3070","3071","3077","309","310","315","326","328","329","33","331","336","337","338","367","376","385","394","398","399","413","414","415","419","444","465","466","467","471","472","48","482","484","488","494","496","498","501","514","518","522","525","526","532","537","538","539","546","547","569","57","579","586","588","592","599","60","61","89","9","ACCELEROMETER","ASP-3NMU Gunsight Brightness Knob","ASP-3NMU Gunsight Mirror Depression","ASP-3NMU Gunsight Target Distance","ASP-3NMU Gunsight Target Wingspan Adjustment Dial (meters)","BOTTLES_ INTERCON","BRAKE_CONTROL","BRAKE_CONTROL_CPT2","BRAKE_CONTROL_LOCK","BTN_ENGINE","CABIN_TEMP","CHARGE_GS","CONTROL_IV300","Cabin Air Temperature Controller Rheostat","Course Accordance","DEBLOCK_GUNS","DE_ICE","Deblock Guns","Diffuser and Flight Suit Temperature Rheostat","EJECT_CANOPY","EJECT_CANOPY_CPT2","ENGINE_CPT2","Emergency Launch Missiles","Emergency Wheel Brake Lever","Emergency/Parking Wheel Brake Lever","FIRE","FIRE_CPT2","FLAPS_00","FLAPS_00_CPT2","FLAPS_25","FLAPS_25_CPT2","FLAPS_44","FLAPS_44_CPT2","Forward Canopy Emergency Jettison Handle","GMK-1AE GMC Latitude Selector Knob","GMK_LATITUDE","G_RESET","HEATING_QUICK","Helmet Heating Temperature Rheostat","Helmet Visor Quick Heating Button - Push to heat","IDENTIF","INSTRUMENT_LIGHTING_CONTROL","INSTRUMENT_LIGHTING_CONTROL_CPT2","IV-300 Engine Vibration Test Button - Push to test","Inboard Stations Deselect","KPP_ARRETIR","KPP_ARRETIR_CPT2","KPP_SET_0","KPP_SET_0_CPT2","MAGNETIC_VAR_KNOB","MAIN-OFF","MAIN-ON","Magnetic Declination set knob","Main (Right) Pitot Tube Heating Button - Push to turn heating on","Main (Right) Pitot Tube Heating Off Button - Push to turn heating off","Missile Seeker Tone Volume Knob","NPP_COURSE","NPP_COURSE_CPT2","Outboard Stations Deselect","Oxygen Interconnaction Valve (CLOSE - CW, OPEN - CCW)","PRESSUR","PRESSUR_CPT2","PYLON_INN_OFF","PYLON_OUT_OFF","Parking Brake Lever Flag - Push to remove parking brake","Pyro Charge Apply","RADIO_BTN","RADIO_BTN_CPT2","RADIO_VOLUME","RADIO_VOLUME_CPT2","RIO-3 De-Icing Sensor Heating Circuit Check Button - Push to test","RKL_BRIGHTNESS","RKL_BRIGHTNESS_CPT2","RKL_FREQ_1_TUNING","RKL_FREQ_1_TUNING_CPT2","RKL_FREQ_2_TUNING","RKL_FREQ_2_TUNING_CPT2","RKL_VOLUME","RKL_VOLUME_CPT2","RSBN Control Box Lighting Intensity Knob","RSBN Field Elevation Knob","RSBN Identification Button","RSBN LIGHTING","RSBN Listen Callsign Button - Push to listen","RSBN Test Button - Push to test","RSBN Volume Knob","RSBN_ALT_SELECTOR","RSBN_BEACON_AUDIO","RSBN_VOLUME","Rearward Canopy Emergency Jettison Handle","Reset Limits","SETTING_0_AZ","SET_GIRO","SET_GIRO_CPT2","SIGHT_ANGLE_REFLECTOR","SIGHT_BASE","SIGHT_BRIGHTNESS","SPU_BTN","SPU_BTN_CPT2","SPU_VOLUME","SPU_VOLUME_CPT2","SS","STAND-BY-OFF","STAND-BY-ON","SUIT_TEMPR","Set 0 Azimuth","Standby (Left) Pitot Tube Heating Button - Push to turn heating on","Standby (Left) Pitot Tube Heating Off Button - Push to turn heating off","TEMP_CONTROL_HELMET","TESTING","TURBO","TURBO_CPT2","VALVE_OXYGEN","VALVE_OXYGEN_CPT2","VARIOMETER","VARIOMETER_INSTRUCTOR","VD_20","VD_20_INSTRUCTOR","VD_PRESSUR","VD_PRESSUR_CPT2","VOLUME_SS","VV_SET_0","VV_SET_0_CPT2","WARNING_LIGHT_CHECK","WARNING_LIGHT_CHECK003","WARNING_LIGHT_CHECK_CPT2","WARNING_LIGHT_INTENSITY","WARNING_LIGHT_INTENSITY_CPT2","pnt_107"]});
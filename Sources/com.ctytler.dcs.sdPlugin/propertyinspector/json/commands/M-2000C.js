@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"M-2000C","rows":[22,21,827,1040,4,796,1,0,5,967,22,21,828,1041,4,797,1,0,5,963,22,21,829,1042,4,798,1,0,5,1117,22,21,830,1043,4,799,1,0,5,964,22,21,138,557,2,100,26,1,12,427,22,21,138,557,2,100,20,1,12,427,22,21,140,558,2,101,26,1,17,426,22,21,140,558,2,101,20,1,17,426,22,21,141,559,2,104,26,1,17,428,22,21,141,559,2,104,20,1,17,428,22,21,831,1044,4,800,1,0,5,966,22,21,839,1049,4,900,0,1,0,982,22,21,198,616,2,331,3,1,0,471,22,21,198,616,2,331,0,1,0,471,22,21,199,617,2,332,3,1,0,470,22,21,199,617,2,332,0,1,0,470,22,21,211,630,2,345,1,1,0,746,22,21,211,630,2,345,0,1,0,746,22,21,212,631,4,346,3,1,0,723,22,21,212,631,4,346,0,3,1,723,22,21,213,632,2,347,3,1,0,434,22,21,213,632,2,347,0,1,0,434,22,21,214,633,2,348,3,1,0,433,22,21,214,633,2,348,0,1,0,433,22,21,215,634,2,349,3,1,0,477,22,21,215,634,2,349,0,1,0,477,22,21,216,635,2,350,27,1,0,476,22,21,216,635,2,350,12,1,0,476,449,99,235,652,2,367,27,1,0,448,449,99,235,652,2,367,12,1,0,448,32,31,249,665,2,380,3,1,0,458,32,31,249,665,2,380,0,1,0,458,32,31,867,1077,4,929,0,0,5,975,32,31,868,1078,4,930,0,0,5,976,32,31,250,666,2,381,3,1,0,456,32,31,250,666,2,381,0,1,0,456,32,31,251,667,2,382,3,1,0,455,32,31,251,667,2,382,0,1,0,455,32,31,869,1079,25,931,46,3,0,977,32,31,252,668,2,383,3,1,0,457,32,31,252,668,2,383,0,1,0,457,32,31,289,694,2,409,3,1,0,498,32,31,289,694,2,409,0,1,0,498,32,31,290,695,4,410,0,12,0,500,32,31,290,695,2,410,1,1,12,500,32,31,291,696,2,411,3,1,0,499,32,31,291,696,2,411,0,1,0,499,37,36,144,563,2,139,3,1,0,475,37,36,144,563,2,139,0,1,0,475,37,36,165,583,2,298,3,1,0,474,37,36,165,583,2,298,0,1,0,474,37,36,166,584,2,299,3,1,0,473,37,36,166,584,2,299,0,1,0,473,37,36,167,585,2,300,3,1,0,472,37,36,167,585,2,300,0,1,0,472,37,36,183,601,2,316,3,1,0,497,37,36,183,601,2,316,0,1,0,497,37,36,184,602,2,317,3,1,0,496,37,36,184,602,2,317,0,1,0,496,37,36,263,679,4,394,0,12,0,462,37,36,263,679,2,394,1,1,12,462,24,23,108,527,2,69,27,1,0,722,24,23,108,527,2,69,12,1,0,722,24,23,187,605,2,320,3,1,0,463,24,23,187,605,2,320,0,1,0,463,24,23,842,1052,25,903,46,1,0,979,24,23,843,1053,4,904,0,1,0,980,24,23,188,606,2,321,3,1,0,468,24,23,188,606,2,321,0,1,0,468,24,23,192,610,2,325,3,1,0,727,24,23,192,610,2,325,0,1,0,727,24,23,193,611,2,326,3,1,0,728,24,23,193,611,2,326,0,1,0,728,24,23,194,612,2,327,3,1,0,464,24,23,194,612,2,327,0,1,0,464,24,23,195,613,2,328,27,1,0,465,24,23,195,613,2,328,12,1,0,465,24,23,253,669,2,384,3,1,0,469,24,23,253,669,2,384,0,1,0,469,24,23,254,670,2,385,3,1,0,732,24,23,254,670,2,385,0,1,0,732,24,23,876,1086,4,938,1,0,5,981,24,23,257,673,2,388,27,1,0,761,24,23,257,673,2,388,12,1,0,761,24,23,258,674,2,389,3,1,0,481,24,23,258,674,2,389,0,1,0,481,24,23,259,675,2,390,3,1,0,480,24,23,259,675,2,390,0,1,0,480,51,0,832,1045,25,801,0,1,0,969,51,0,142,560,2,106,3,1,0,421,51,0,142,560,2,106,0,1,0,421,51,0,143,561,2,107,3,1,0,420,51,0,143,561,2,107,0,1,0,420,51,0,833,562,4,816,0,1,0,437,51,0,834,562,25,826,1,3,0,437,59,57,102,525,2,54,3,1,0,725,59,57,102,525,2,54,0,1,0,725,59,57,103,524,2,0,3,1,0,519,59,57,103,524,2,0,0,1,0,519,11,10,146,565,2,222,3,1,0,479,11,10,146,565,2,222,0,1,0,479,11,10,147,566,2,226,26,1,17,438,11,10,147,566,2,226,20,1,17,438,11,10,148,567,2,237,26,1,17,439,11,10,148,567,2,237,20,1,17,439,11,10,149,568,2,272,26,1,17,511,11,10,149,568,2,272,20,1,17,511,11,10,150,569,2,273,26,1,17,509,11,10,150,569,2,273,20,1,17,509,11,10,151,570,2,274,26,1,17,517,11,10,151,570,2,274,20,1,17,517,11,10,152,571,2,275,26,1,17,513,11,10,152,571,2,275,20,1,17,513,11,10,153,572,2,277,26,1,17,516,11,10,153,572,2,277,20,1,17,516,11,10,154,573,2,278,26,1,17,514,11,10,154,573,2,278,20,1,17,514,11,10,155,574,2,279,3,3,0,495,11,10,155,574,2,279,0,3,0,495,11,10,156,575,2,280,3,1,0,510,11,10,156,575,2,280,0,1,0,510,11,10,157,576,2,281,3,1,0,512,11,10,157,576,2,281,0,1,0,512,11,10,158,577,2,282,3,1,0,515,11,10,158,577,2,282,0,1,0,515,11,10,159,578,2,283,3,1,0,518,11,10,159,578,2,283,0,1,0,518,11,10,162,581,2,296,1,1,0,502,11,10,162,581,2,296,0,1,0,502,11,10,163,582,2,297,1,1,0,501,11,10,163,582,2,297,0,1,0,501,11,10,190,608,2,323,3,1,0,415,11,10,190,608,2,323,0,1,0,415,11,10,191,609,2,324,3,1,0,414,11,10,191,609,2,324,0,1,0,414,11,10,196,614,2,329,3,1,0,483,11,10,196,614,2,329,0,1,0,483,11,10,197,615,2,330,3,1,0,482,11,10,197,615,2,330,0,1,0,482,11,10,255,671,2,386,3,1,0,466,11,10,255,671,2,386,0,1,0,466,11,10,256,672,2,387,3,1,0,467,11,10,256,672,2,387,0,1,0,467,29,28,161,580,2,295,3,1,0,447,29,28,161,580,2,295,0,1,0,447,29,28,180,598,2,313,1,1,0,454,29,28,180,598,2,313,0,1,0,454,29,28,181,599,2,314,3,1,0,431,29,28,181,599,2,314,0,1,0,431,29,28,182,600,2,315,3,1,0,430,29,28,182,600,2,315,0,1,0,430,29,28,265,681,2,396,3,1,0,700,29,28,265,681,2,396,0,1,0,700,29,28,266,682,2,397,3,1,0,701,29,28,266,682,2,397,0,1,0,701,29,28,268,684,2,399,1,1,0,699,29,28,268,684,2,399,0,1,0,699,29,28,276,688,4,403,3,3,1,522,29,28,276,688,4,403,0,1,0,522,29,28,284,689,4,404,3,1,0,726,29,28,284,689,4,404,0,3,1,726,29,28,288,693,2,408,3,1,0,507,29,28,288,693,2,408,0,1,0,507,61,54,835,1046,25,837,0,1,0,984,61,54,145,564,2,164,26,1,55,485,61,54,145,564,2,164,20,1,55,485,16,15,130,549,2,91,3,1,0,506,16,15,130,549,2,91,0,1,0,506,16,15,810,1025,4,781,1,0,5,1011,16,15,811,1026,4,782,1,0,5,1012,16,15,812,1027,4,783,1,0,5,1013,16,15,813,1028,4,784,1,0,5,1014,16,15,814,1029,4,785,1,0,5,1015,16,15,815,1030,4,786,1,0,5,983,16,15,131,550,2,92,3,1,0,730,16,15,131,550,2,92,0,1,0,730,16,15,132,551,2,93,3,1,0,729,16,15,132,551,2,93,0,1,0,729,16,15,817,1031,4,787,1,0,5,1140,16,15,818,1032,4,788,1,0,5,1141,16,15,819,1033,4,789,1,0,5,1142,16,15,820,1034,4,790,1,0,5,1143,16,15,821,1035,4,791,1,0,5,1144,16,15,133,552,2,94,3,3,0,508,16,15,133,552,2,94,0,3,0,508,16,15,822,1036,4,792,1,0,5,1116,16,15,823,1037,4,793,1,0,5,962,16,15,824,1038,4,794,1,0,5,1005,16,15,134,553,4,95,3,3,1,523,16,15,134,553,4,95,0,1,0,523,16,15,135,554,2,96,27,1,0,440,16,15,135,554,2,96,12,1,0,440,16,15,136,555,4,97,3,1,0,442,16,15,136,555,4,97,0,3,1,442,16,15,137,556,4,98,3,1,0,441,16,15,137,556,4,98,0,3,1,441,16,15,825,1039,4,795,1,0,5,909,16,15,838,1048,4,899,1,0,5,978,16,15,186,604,2,319,3,1,0,484,16,15,186,604,2,319,0,1,0,484,19,18,802,1016,4,771,1,0,5,1000,19,18,803,1017,4,772,1,0,5,1002,19,18,848,1058,4,910,1,0,5,1001,19,18,849,1059,4,911,1,0,5,998,19,18,223,641,2,356,26,1,0,493,19,18,223,641,2,356,20,1,0,493,19,18,851,1061,4,913,1,0,5,1010,19,18,852,1062,4,914,1,0,5,1003,19,18,853,1063,4,915,1,0,5,1139,19,18,854,1064,4,916,1,0,5,1007,19,18,855,1065,4,917,1,0,5,988,19,18,856,1066,4,918,1,0,5,989,19,18,857,1067,4,919,1,0,5,990,19,18,858,1068,4,920,1,0,5,991,19,18,859,1069,4,921,1,0,5,992,19,18,860,1070,4,922,1,0,5,993,19,18,861,1071,4,923,1,0,5,994,19,18,862,1072,4,924,1,0,5,995,19,18,863,1073,4,925,1,0,5,996,19,18,864,1074,4,926,1,0,5,987,19,18,865,1075,4,927,1,0,5,997,19,18,866,1076,4,928,1,0,5,999,19,18,247,663,2,378,26,1,44,491,19,18,247,663,2,378,20,1,44,491,19,18,248,664,2,379,26,1,64,492,19,18,248,664,2,379,20,1,64,492,19,18,267,683,2,398,27,1,0,490,19,18,267,683,2,398,12,1,0,490,19,18,285,690,2,405,3,1,0,461,19,18,285,690,2,405,0,1,0,461,40,39,217,636,2,351,3,1,0,505,40,39,217,636,2,351,0,1,0,505,40,39,218,637,2,352,3,1,0,460,40,39,218,637,2,352,0,1,0,460,40,39,219,638,2,353,3,1,0,424,40,39,219,638,2,353,0,1,0,424,40,39,220,639,2,354,3,1,0,425,40,39,220,639,2,354,0,1,0,425,40,39,221,640,4,355,3,1,0,504,40,39,221,640,4,355,0,3,1,504,40,39,260,676,2,391,3,1,0,423,40,39,260,676,2,391,0,1,0,423,9,8,5,624,2,339,3,1,0,419,9,8,5,624,2,339,0,1,0,419,9,8,105,526,2,68,3,3,0,717,9,8,105,526,2,68,0,3,0,717,9,8,200,618,2,333,27,3,12,716,9,8,200,618,2,333,12,3,12,716,9,8,844,1054,4,905,1,0,5,1113,9,8,845,1055,4,906,1,0,5,1112,9,8,201,619,2,334,3,1,0,707,9,8,201,619,2,334,0,1,0,707,9,8,202,620,2,335,27,3,12,706,9,8,202,620,2,335,12,3,12,706,9,8,203,621,2,336,62,1,53,718,9,8,203,621,2,336,63,1,53,718,9,8,846,1056,25,907,45,5,5,1111,9,8,204,622,2,337,3,1,0,417,9,8,204,622,2,337,0,1,0,417,9,8,205,623,2,338,3,1,0,418,9,8,205,623,2,338,0,1,0,418,9,8,206,625,2,340,3,1,0,708,9,8,206,625,2,340,0,1,0,708,9,8,207,626,2,341,3,1,0,744,9,8,207,626,2,341,0,1,0,744,9,8,208,627,2,342,27,1,0,720,9,8,208,627,2,342,12,1,0,720,9,8,209,628,4,343,3,1,0,719,9,8,209,628,4,343,0,3,1,719,9,8,847,1057,4,908,1,0,5,961,9,8,210,629,2,344,27,1,0,705,9,8,210,629,2,344,12,1,0,705,9,8,224,642,2,357,765,1,0,714,9,8,224,642,2,357,769,1,0,714,9,8,225,643,2,358,3,1,0,713,9,8,225,643,2,358,0,1,0,713,9,8,227,644,2,359,27,1,0,715,9,8,227,644,2,359,12,1,0,715,9,8,228,645,2,360,26,1,17,712,9,8,228,645,2,360,20,1,17,712,9,8,229,646,2,361,26,1,17,711,9,8,229,646,2,361,20,1,17,711,9,8,230,647,2,362,26,1,17,710,9,8,230,647,2,362,20,1,17,710,9,8,231,648,2,363,26,1,17,709,9,8,231,648,2,363,20,1,17,709,9,8,271,687,2,402,3,1,0,737,9,8,271,687,2,402,0,1,0,737,43,42,232,649,2,364,3,3,0,459,43,42,232,649,2,364,0,3,0,459,43,42,233,650,2,365,27,1,0,436,43,42,233,650,2,365,12,1,0,436,43,42,234,651,2,366,27,1,0,703,43,42,234,651,2,366,12,1,0,703,43,42,236,653,2,368,27,1,0,450,43,42,236,653,2,368,12,1,0,450,43,42,238,654,2,369,26,1,0,451,43,42,238,654,2,369,20,1,0,451,43,42,898,1108,4,960,1,0,5,974,35,34,160,579,2,292,3,1,0,489,35,34,160,579,2,292,0,1,0,489,35,34,836,1047,25,892,12,5,5,1109,35,34,179,597,2,312,1,1,0,444,35,34,179,597,2,312,0,1,0,444,35,34,185,603,2,318,3,3,0,731,35,34,185,603,2,318,0,3,0,731,35,34,261,677,2,392,3,1,0,445,35,34,261,677,2,392,0,1,0,445,35,34,262,678,2,393,27,1,0,446,35,34,262,678,2,393,12,1,0,446,35,34,286,691,2,406,3,1,0,58,35,34,286,691,2,406,0,1,0,58,35,34,287,692,2,407,3,1,0,58,35,34,287,692,2,407,0,1,0,58,14,13,5,1094,25,946,45,5,5,1115,14,13,773,1018,4,774,1,0,5,965,14,13,809,1024,25,780,45,5,5,1110,14,13,173,591,2,306,3,1,0,702,14,13,173,591,2,306,0,1,0,702,14,13,174,592,2,307,27,1,0,503,14,13,174,592,2,307,12,1,0,503,14,13,175,593,2,308,27,1,0,724,14,13,175,593,2,308,12,1,0,724,14,13,176,594,2,309,27,1,0,429,14,13,176,594,2,309,12,1,0,429,14,13,177,595,2,310,27,1,0,521,14,13,177,595,2,310,12,1,0,521,14,13,178,596,2,311,27,1,0,478,14,13,178,596,2,311,12,1,0,478,14,13,850,1060,25,912,45,5,5,1004,14,13,870,1080,25,932,45,5,5,973,14,13,871,1081,25,933,45,5,5,972,14,13,872,1082,25,934,45,5,5,1114,14,13,873,1083,25,935,45,5,5,971,14,13,874,1084,25,936,45,5,5,970,14,13,875,1085,25,937,45,5,5,1145,14,13,264,680,2,395,3,1,0,432,14,13,264,680,2,395,0,1,0,432,14,13,269,685,2,400,3,1,0,520,14,13,269,685,2,400,0,1,0,520,14,13,270,686,2,401,3,1,0,422,14,13,270,686,2,401,0,1,0,422,14,13,877,1087,25,939,46,1,0,1138,14,13,878,1088,25,940,46,1,0,1118,14,13,879,1089,25,941,46,1,0,1006,14,13,880,1090,25,942,46,1,0,1119,14,13,881,1091,25,943,46,1,0,1008,14,13,882,1092,25,944,46,1,0,1122,14,13,883,1093,25,945,46,1,0,1124,49,47,243,659,2,374,763,1,66,734,49,47,243,659,2,374,767,1,66,734,49,47,244,660,2,375,3,1,0,736,49,47,244,660,2,375,0,1,0,736,49,47,245,661,2,376,26,1,17,733,49,47,245,661,2,376,20,1,17,733,49,47,246,662,2,377,62,1,53,735,49,47,246,662,2,377,63,1,53,735,41,38,168,586,2,301,3,1,0,750,41,38,168,586,2,301,0,1,0,750,41,38,169,587,2,302,3,1,0,751,41,38,169,587,2,302,0,1,0,751,41,38,170,588,4,303,3,1,0,747,41,38,170,588,4,303,0,3,1,747,41,38,840,1050,4,901,0,1,0,1121,41,38,171,589,2,304,766,1,65,749,41,38,171,589,2,304,770,1,65,749,41,38,841,1051,4,902,0,1,0,1123,41,38,172,590,2,305,60,52,0,748,41,38,172,590,2,305,52,52,0,748,33,30,293,697,2,412,26,1,55,753,33,30,293,697,2,412,20,1,55,753,33,30,294,698,2,413,60,1,56,752,33,30,294,698,2,413,52,1,56,752,33,30,884,1095,4,947,0,1,0,1136,33,30,885,1096,4,948,0,1,0,1137,33,30,886,1097,4,949,0,1,0,1126,33,30,887,1098,4,950,0,1,0,1127,33,30,888,1099,4,951,0,1,0,1128,33,30,889,1100,4,952,0,1,0,1129,33,30,890,1101,4,953,0,1,0,1130,33,30,891,1102,4,954,0,1,0,1131,33,30,893,1103,4,955,0,1,0,1132,33,30,894,1104,4,956,0,1,0,1133,33,30,895,1105,4,957,0,1,0,1134,33,30,896,1106,4,958,0,1,0,1125,33,30,897,1107,4,959,0,1,0,1135,50,48,239,655,2,370,764,20,67,755,50,48,239,655,2,370,768,20,67,755,50,48,240,656,2,371,3,1,0,756,50,48,240,656,2,371,0,1,0,756,50,48,241,657,2,372,60,1,56,754,50,48,241,657,2,372,52,1,56,754,50,48,242,658,2,373,3,1,0,757,50,48,242,658,2,373,0,1,0,757,7,6,804,1019,25,775,1,1,0,1009,7,6,109,528,2,70,27,1,0,488,7,6,109,528,2,70,12,1,0,488,7,6,805,1020,25,776,1,1,0,985,7,6,110,529,4,71,3,1,0,487,7,6,110,529,4,71,0,3,1,487,7,6,111,530,2,72,27,1,0,486,7,6,111,530,2,72,12,1,0,486,7,6,112,531,2,73,27,1,0,704,7,6,112,531,2,73,12,1,0,704,7,6,113,532,2,74,3,1,0,435,7,6,113,532,2,74,0,1,0,435,7,6,806,1021,25,777,1,1,0,968,7,6,114,533,2,75,3,1,0,416,7,6,114,533,2,75,0,1,0,416,7,6,807,1022,25,778,1,1,53,1120,7,6,808,1023,4,779,1,0,5,986,7,6,115,534,4,76,3,1,0,741,7,6,115,534,4,76,0,3,1,741,7,6,116,535,4,77,3,1,0,443,7,6,116,535,4,77,0,3,1,443,7,6,117,536,4,78,3,1,0,745,7,6,117,536,4,78,0,3,1,745,7,6,118,537,4,79,3,1,0,740,7,6,118,537,4,79,0,3,1,740,7,6,119,538,4,80,3,1,0,742,7,6,119,538,4,80,0,3,1,742,7,6,120,539,4,81,3,1,0,739,7,6,120,539,4,81,0,3,1,739,7,6,121,540,4,82,3,1,0,743,7,6,121,540,4,82,0,3,1,743,7,6,122,541,4,83,3,1,0,738,7,6,122,541,4,83,0,3,1,738,7,6,123,542,2,84,3,1,0,760,7,6,123,542,2,84,0,1,0,760,7,6,124,543,4,85,3,1,0,758,7,6,124,543,4,85,0,3,1,758,7,6,125,544,2,86,3,1,0,759,7,6,125,544,2,86,0,1,0,759,7,6,126,545,2,87,26,1,44,494,7,6,126,545,2,87,20,1,44,494,7,6,127,546,2,88,26,1,44,762,7,6,127,546,2,88,20,1,44,762,7,6,128,547,2,89,26,1,44,453,7,6,128,547,2,89,20,1,44,453,7,6,129,548,2,90,26,1,44,452,7,6,129,548,2,90,20,1,44,452,7,6,189,607,2,322,3,1,0,721,7,6,189,607,2,322,0,1,0,721],"strings":["1","0","TUMB","-1","BTN","","5","VTH_VTB","11","RADAR","4","INSTPANEL","0.5","16","SYSLIGHTS","6","PCA_PPA","0.9","9","PCN_NAV","0.1","17","AFCS","7","ENGPANEL","LEV","-0.1","-0.5","22","MISCPANELS","19","25","ECS","VHF","14","SUBSYSTEMS","3","ENGINE","20","8","PWRPNL","UHF","13","RWR","0.7","10","0.8","23","24","TACAN","VORILS","FLIGHTINST","0.05","0.99","2","0.6","0.95","31","Canopy Handle","Helmet_NVG","-0.05","NAVINST","-0.33","0.33","0.4","0.75","0.923076","1.0090909090909","109","193","201","203","204","205","206","208","213","214","215","216","217","218","219","220","221","222","223","224","225","226","227","234","248","249","265","275","276","277","278","28","299","300","3001","3002","301","3109","314","315","3193","3201","3203","3204","3205","3206","3208","3213","3214","3215","3216","3217","3218","3219","3220","3221","3222","3223","3224","3225","3226","3227","3234","3248","3249","3265","3275","3276","3277","3278","3299","330","3300","3301","3314","3315","3330","3341","3357","3360","3361","3377","3378","3379","3380","3381","3382","3383","3384","3385","3386","3387","3395","3400","3404","3408","341","3420","3421","3422","3429","3430","3431","3433","3435","3449","3450","3452","3453","3454","3455","3456","3457","3458","3459","3460","3461","3462","3463","3464","3468","3470","3471","3472","3473","3474","3475","3476","3477","3478","3479","3480","3481","3484","3485","3486","3491","3493","3499","3500","3502","3503","3506","3508","3509","3514","3515","3516","3517","3520","3521","3522","3523","3524","357","3574","3598","3599","360","3600","3601","3602","3603","3604","3605","3606","3607","3608","3609","361","3610","3616","3617","3618","3619","3623","3624","3625","3626","3627","3629","3630","3635","3636","3638","3645","3646","3647","3648","3650","3651","3652","3654","3655","3656","3657","3658","3659","3660","3665","3666","3672","3700","3710","377","378","379","380","3807","381","382","383","384","385","386","387","3900","3905","3907","3908","3909","3910","3911","3912","395","3950","3951","400","404","408","420","421","422","429","430","431","433","435","449","450","452","453","454","455","456","457","458","459","460","461","462","463","464","468","470","471","472","473","474","475","476","477","478","479","480","481","484","485","486","491","493","495","499","500","502","503","506","508","509","514","515","516","517","520","521","522","523","524","574","598","599","600","601","602","603","604","605","606","607","608","609","610","616","617","618","619","623","624","625","626","627","629","630","635","636","638","645","646","647","648","650","651","652","654","655","656","657","658","659","660","665","666","672","700","710","807","900","905","907","908","909","910","911","912","950","951","A/B Emergency Cutoff Switch","A/B Emergency Cutoff Switch Cover","A/G Gun Reticle Switch","A/G Radar A Mode Switch","A/G Radar DEC Mode Switch","A/G Radar VISU Mode Switch","ADI Backlight Switch","ADI Cage Lever","AMPLIS Selector Knob","Alert Network (QRA) Switch","Alternator 1 Switch","Alternator 2 Switch","Altitude 1,000 ft Selector","Altitude 10,000 ft Selector","Altitude 100 ft Selector","Anti-Collision Lights Switch","Anti-Skid Switch","Anti-Skid Switch Cover","Audio Warning Switch","Autopilot Test Switch","Autopilot Test Switch Cover","Auxiliary Gunsight","BR Power Switch","Backup ADI Cage/Pitch Adjust Knob","Bingo Fuel 1,000 kg Selector","Bingo Fuel 100 kg Selector","Bomb Fuze Selector Switch","Bomb Release Interval Selector Switch","Bomb Release Quantity Selector Switch","Bullseye Waypoint Selector","Canopy Jettison","Canopy Lock","Canopy Lock/Neutral/Lower Lever","Cockpit Clock","D2M Power Switch","DDM_IND","Decoy Release Mode Switch","Decoy Release Program Knob","Display Brightness","Display Contrast","Drag Chute Lever","ECS Air Exchange Switch","ECS Cond Switch","ECS Defog Switch","ECS Main Mode Switch","EW Mode Selector Switch","Electric Power Transfer Switch","Emergency Compass","Emergency Hydraulic Pump Switch","Emergency Throttle Cover","Engine Emergency Control Cover","Engine Emergency Control Switch","Engine Fuel Left Boost Pump Switch","Engine Fuel Right Boost Pump Switch","Engine In-Flight Start Switch","Engine Start Switch Cover","FBW Channel 5 Switch","FBW Channel 5 Switch Cover","FBW G-Limiter Switch","FBW Gain Mode Switch","FBW Gain Mode Switch Cover","FBW Spin Mode Switch","FBW Test Switch","FBW Test Switch Cover","Formation Lights Switch","Fuel Crossfeeed Switch","Fuel Cutoff Switch","Fuel Cutoff Switch Cover","Fuel Dump Switch","Fuel Dump Switch Cover","Gun Arm/Safe Switch","HSI Mode Selector Switch","HUD Altimeter Selector Switch","HUD Declutter Switch","HUD Power Switch","Hydraulic System Selector","INS Auxiliary Heading/Horizon","INS Mode Selector","INS Operational Mode","INS Parameter Selector","Icons and Rulers Brightness","Ident Power Switch","Intake Cones Operation Switch","Intake Slats Operation Switch","LOX Dilution Lever","LOX Emergency Supply","LOX Test Switch","Landing Gear Emergency Release Lever","Landing Gear Lever","Landing Lights Switch","Lights Test Switch","Main Battery Switch","Master Arm Switch","Mirror Rendering Toggle","Missile Selector Switch","Mode-1 Ones Selector","Mode-1 Switch","Mode-1 Tens Selector","Mode-2 Switch","Mode-3A Hundreds Selector","Mode-3A Ones Selector","Mode-3A Switch","Mode-3A Tens Selector","Mode-3A Thousands Selector","Mode-C Switch","Mount/Unmount NVG on Helmet","NVG Lights Filter Switch","Navigation Lights Switch","Nose Wheel Steering / IFF Interrogation Button","PPA Test Switch","PTN_1001","PTN_1002","PTN_109","PTN_193","PTN_201","PTN_203","PTN_204","PTN_205","PTN_206","PTN_208","PTN_213","PTN_214","PTN_215","PTN_216","PTN_217","PTN_218","PTN_219","PTN_220","PTN_221","PTN_222","PTN_223","PTN_224","PTN_225","PTN_226","PTN_227","PTN_234","PTN_248","PTN_249","PTN_265","PTN_275","PTN_276","PTN_277","PTN_278","PTN_299","PTN_300","PTN_301","PTN_314","PTN_315","PTN_325","PTN_330","PTN_341","PTN_357","PTN_360","PTN_361","PTN_377","PTN_378","PTN_379","PTN_380","PTN_381","PTN_382","PTN_383","PTN_384","PTN_385","PTN_386","PTN_387","PTN_395","PTN_400","PTN_404","PTN_408","PTN_420","PTN_421","PTN_422","PTN_429","PTN_430","PTN_431","PTN_433","PTN_435","PTN_449","PTN_450","PTN_452","PTN_453","PTN_454","PTN_455","PTN_456","PTN_457","PTN_458","PTN_459","PTN_460","PTN_461","PTN_462","PTN_463","PTN_464","PTN_468","PTN_470","PTN_471","PTN_472","PTN_473","PTN_474","PTN_475","PTN_476","PTN_477","PTN_478","PTN_479","PTN_480","PTN_481","PTN_484","PTN_485","PTN_486","PTN_491","PTN_493","PTN_495","PTN_499","PTN_500","PTN_502","PTN_503","PTN_506","PTN_508","PTN_509","PTN_514","PTN_515","PTN_516","PTN_517","PTN_520","PTN_521","PTN_522","PTN_523","PTN_524","PTN_574","PTN_598","PTN_599","PTN_600","PTN_601","PTN_602","PTN_603","PTN_604","PTN_605","PTN_606","PTN_607","PTN_608","PTN_609","PTN_610","PTN_616","PTN_617","PTN_618","PTN_619","PTN_623","PTN_624","PTN_625","PTN_626","PTN_627","PTN_629","PTN_630","PTN_635","PTN_636","PTN_638","PTN_645","PTN_646","PTN_647","PTN_648","PTN_650","PTN_651","PTN_652","PTN_654","PTN_655","PTN_656","PTN_657","PTN_658","PTN_659","PTN_660","PTN_665","PTN_666","PTN_672","PTN_700","PTN_710","PTN_807","PTN_900","PTN_905","PTN_907","PTN_908","PTN_909","PTN_910","PTN_911","PTN_912","PTN_950","PTN_951","Parking Brake Lever","Pitot Heat Cover","Pitot Heat Switch","Police Lights Switch","RWR Power Switch","Radar Altimeter Power Switch","Radar Azimuth Selector","Radar Contrast Switch","Radar Doppler Reject Switch","Radar Grid Selector Switch","Radar IFF Code-1 Selector","Radar IFF Code-2 Selector","Radar IFF Code-3 Selector","Radar IFF Code-4 Selector","Radar IFF L/R Selector","Radar IFF Mode Switch","Radar IFF Power Switch","Radar Illumination Switch","Radar PRF Switch","Radar Power Selector","Radar Range Selector Switch","Radar Scan Lines Selector","Radar WOW Emitter Authorize Switch","Refuel Transfer Switch","Rudder Trim Paddle","SERPAM Recorder Switch","STOW/UNSTOW NVG","Seat Adjustment Switch","Secondary Oil Control Cover","Secondary Oil Control Switch","Selective Jettison Switch","Selective Jettison Switch Cover","Slats Operation Switch","Starter Fuel Pump Switch","TACAN Channel 1 Selector","TACAN Channel 10 Selector","TACAN Mode Select","TACAN X/Y Select","TDC Mode Switch","Target Age","Target Altitude","Target Bearing from Bullseye","Target Data Manual Entry Begin/End","Target Heading","Target Mach Number","Target Memory Time Selector Switch","Target Range from Bullseye","Trim Control Mode Dial","UHF E+A2 Switch","UHF Knob","UHF Mode Switch","UHF Power 5W/25W Switch","UHF SIL Switch","VHF CH Sel","VHF MODE","VOR/ILS Frequency Change Decimal","VOR/ILS Frequency Change Whole","VOR/ILS Power Dial","VOR/ILS Test Dial","VTB Declutter","VTB Orientation Selector (Inop)","VTB Power Switch","Ventilation Selector Switch","Video Brightness","-0.076923","-0.090909090909091","-0.2","-0.25","0.076923","0.090909090909091","0.2","0.25","110","111","144","191","192","202","207","209","210","228","235","237","239","241","243","245","250","253","256","259","262","266","269","272","279","282","285","288","294","302","309","3110","3111","3192","3202","3207","3209","3210","3228","3235","3237","3239","3241","3243","3245","325","3250","3253","3256","3259","3262","3266","3269","3272","3279","328","3282","3285","3288","3294","3302","3309","3325","3328","3340","3396","340","3409","3423","3432","3434","3465","3467","3482","3483","3488","3504","3570","3572","3575","3576","3578","3580","3582","3584","3585","3586","3587","3588","3589","3590","3591","3592","3593","3594","3596","3631","3633","3637","3639","3640","3641","3642","3643","3644","3649","3701","3702","3703","3704","3705","3706","3707","3952","3953","3954","3955","3956","3957","3958","3959","396","3960","3961","3962","3963","3964","3990","409","423","432","434","465","467","482","483","488","504","530D/Rockets/Guns Firing Mode Selector","570","572","575","576","578","580","582","584","585","586","587","588","589","590","591","592","593","594","596","631","633","637","639","640","641","642","643","644","649","701","702","703","704","705","706","707","920","952","953","954","955","956","957","958","959","960","961","962","963","964","990","A/A Radar STT Selector Button","AUTO/MAN Button","Altitude Hold Button","Approach Hold Button","Audio Warning Reset","Autopilot Lights Test Button","Autopilot Master Button","Auxiliary Gunsight Deflection","Barometric Pressure Calibration","Casution/Advisory Lights Rheostat","Console Panel Lights Knob","Dashboard Panel Lights Knob","Dashboard U.V. Lights Knob","ECM Box Clear Button","ECS C Button","ECS F Button","ECS Temperature Select Knob","Emergency Jettison","Emergency Throttle Handle","Engine Shutdown Button","Engine Start Switch","FBW Reset Button","Gun Mode Button","HSI VAD Selector","HUD Brightness Knob","HUD Clear Button","INS Button 0","INS Button 1","INS Button 2","INS Button 3","INS Button 4","INS Button 5","INS Button 6","INS Button 7","INS Button 8","INS Button 9","INS Clear Button","INS DEST Switch","INS ENTER Button","INS Next Waypoint Button","INS PREP Switch","INS Previous Waypoint Button","INS Update","Light Brightnes Control/Test","MAGIC Standby","MAGIC Tone Volume Knob","Mark Position","Marker Signal Volume Knob","Minimum Altitude Selector","Offset Waypoint/Target","PCA Button 1","PCA Button 2","PCA Button 3","PCA Button 4","PCA Button 5","PTN_110","PTN_111","PTN_191","PTN_192","PTN_202","PTN_207","PTN_209","PTN_210","PTN_228","PTN_235","PTN_237","PTN_239","PTN_241","PTN_243","PTN_245","PTN_250","PTN_253","PTN_256","PTN_259","PTN_262","PTN_266","PTN_269","PTN_272","PTN_279","PTN_282","PTN_285","PTN_288","PTN_294","PTN_302","PTN_309","PTN_340","PTN_396","PTN_409","PTN_423","PTN_432","PTN_434","PTN_465","PTN_467","PTN_482","PTN_483","PTN_488","PTN_504","PTN_570","PTN_572","PTN_575","PTN_576","PTN_578","PTN_580","PTN_582","PTN_584","PTN_585","PTN_586","PTN_587","PTN_588","PTN_589","PTN_590","PTN_591","PTN_592","PTN_593","PTN_594","PTN_596","PTN_631","PTN_633","PTN_637","PTN_639","PTN_640","PTN_641","PTN_642","PTN_643","PTN_644","PTN_649","PTN_701","PTN_702","PTN_703","PTN_704","PTN_705","PTN_706","PTN_707","PTN_920","PTN_952","PTN_953","PTN_954","PTN_955","PTN_956","PTN_957","PTN_958","PTN_959","PTN_960","PTN_961","PTN_962","PTN_963","PTN_964","PTN_990","Pedal Adjustment Lever","RWR Light Brightnes Control","Radar Gain Dial","Radar Rearm Button","Radar Test Button","Red Flood Lights Knob","Refuel Lights Brightness Knob","S530 Standby","Selected Altitude Hold Button","TACAN Volume Knob","TB APP Volume Knob","Target Wingspan Knob","UHF CDE Switch","UHF Radio Volume Knob","UHF TEST Switch","V/UHF Radio Volume Knob","VHF 0","VHF 1/READ","VHF 2/SQL","VHF 3/GR","VHF 4","VHF 5/20/LOW","VHF 6/TONE","VHF 7","VHF 8/TOD","VHF 9/ZERO","VHF CONF","VHF MEM/CLR","VHF VLD/XFR","VOR/ILS Volume Knob","Validate Data Entry","Weapons Selector Button 1","Weapons Selector Button 2","Weapons Selector Button 3","Weapons Selector Button 4","Weapons Selector Button 5","White Flood Lights Knob"]});
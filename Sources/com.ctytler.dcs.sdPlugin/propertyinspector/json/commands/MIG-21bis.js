@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"MIG-21bis","rows":[955,903,770,1036,4,733,0,1,0,968,46,44,211,512,2,131,3,1,0,410,46,44,211,512,2,131,0,1,0,410,46,44,212,499,2,118,3,1,0,652,46,44,212,499,2,118,0,1,0,652,46,44,213,500,2,119,3,1,0,653,46,44,213,500,2,119,0,1,0,653,46,44,214,507,2,126,3,1,0,452,46,44,214,507,2,126,0,1,0,452,411,117,275,603,2,309,3,1,0,426,411,117,275,603,2,309,0,1,0,426,412,397,339,587,2,202,102,1,42,433,412,397,339,587,2,202,107,1,42,433,956,846,793,1053,7,751,1,3,32,972,15,14,240,517,2,136,3,1,0,415,15,14,240,517,2,136,0,1,0,415,15,14,781,1019,7,725,1,1,0,967,15,14,782,1022,4,728,0,1,0,966,15,14,38,1023,2,35,1,96,96,957,15,14,38,1024,2,35,1,70,70,958,15,14,38,1025,2,35,1,106,106,959,15,14,38,1026,2,35,1,108,108,960,15,14,38,1027,2,35,1,18,18,961,15,14,38,1028,2,35,1,109,109,962,15,14,38,1029,2,35,1,110,110,963,15,14,38,1030,2,35,1,111,111,964,15,14,38,1031,2,35,1,113,113,965,15,14,241,532,2,152,101,1,77,416,15,14,241,532,2,152,105,1,77,416,15,14,242,539,2,158,3,1,0,414,15,14,242,539,2,158,0,1,0,414,15,14,243,566,2,185,3,1,0,487,15,14,243,566,2,185,0,1,0,487,86,78,274,589,2,204,3,1,0,418,86,78,274,589,2,204,0,1,0,418,86,78,816,590,2,205,3,3,1,417,86,78,817,590,2,205,0,0,1,417,13,12,304,529,2,149,3,1,0,423,13,12,304,529,2,149,0,1,0,423,13,12,305,559,2,178,3,1,0,419,13,12,305,559,2,178,0,1,0,419,13,12,306,560,2,179,3,1,0,420,13,12,306,560,2,179,0,1,0,420,13,12,307,561,2,180,3,1,0,422,13,12,307,561,2,180,0,1,0,422,13,12,308,562,2,181,3,1,0,421,13,12,308,562,2,181,0,1,0,421,13,12,310,563,2,182,3,1,0,655,13,12,310,563,2,182,0,1,0,655,13,12,311,564,2,183,3,1,0,464,13,12,311,564,2,183,0,1,0,464,13,12,905,1042,7,739,1,1,0,1161,13,12,906,1043,7,740,1,1,0,999,13,12,907,1044,7,741,1,1,0,1153,13,12,908,1045,7,742,1,1,0,1118,13,12,909,1046,7,743,1,1,0,990,13,12,912,1091,7,922,1,1,0,1160,31,30,301,612,2,368,3,1,0,479,31,30,301,612,2,368,0,1,0,479,31,30,302,613,2,369,3,1,0,697,31,30,302,613,2,369,0,1,0,697,31,30,830,1085,4,916,0,1,0,976,31,30,831,1041,4,738,0,1,0,974,31,30,303,550,2,169,3,1,0,431,31,30,303,550,2,169,0,1,0,431,31,30,844,1092,4,923,0,1,0,975,31,30,367,640,2,408,1,1,0,432,31,30,367,640,2,408,0,1,0,432,87,79,820,1063,4,767,0,1,0,1135,87,79,286,596,2,235,3,1,0,441,87,79,286,596,2,235,0,1,0,441,87,79,821,1064,4,783,0,1,0,980,40,39,863,1110,4,936,0,1,0,1165,40,39,864,1109,4,937,0,1,0,1163,40,39,865,1112,4,938,0,1,0,1137,40,39,866,1113,4,939,0,1,0,1138,40,39,867,1117,4,940,0,1,0,1158,40,39,868,1114,4,941,0,1,0,1155,40,39,869,1115,4,942,0,1,0,1156,40,39,870,1116,4,943,0,1,0,1157,40,39,886,1111,4,953,0,1,0,992,978,896,847,1052,7,750,103,32,32,1166,63,0,208,508,2,127,3,1,0,429,63,0,208,508,2,127,0,1,0,429,63,0,209,501,2,120,3,1,0,428,63,0,209,501,2,120,0,1,0,428,63,0,210,509,2,128,3,1,0,436,63,0,210,509,2,128,0,1,0,436,64,62,228,598,2,255,3,1,0,427,64,62,228,598,2,255,0,1,0,427,64,62,229,592,2,207,3,1,0,424,64,62,229,592,2,207,0,1,0,424,64,62,230,606,2,333,3,1,0,449,64,62,230,606,2,333,0,1,0,449,47,37,221,594,2,225,3,1,0,413,47,37,221,594,2,225,0,1,0,413,47,37,222,585,2,200,3,1,0,459,47,37,222,585,2,200,0,1,0,459,47,37,769,1060,4,764,0,1,0,1154,47,37,223,593,2,217,3,1,0,460,47,37,223,593,2,217,0,1,0,460,47,37,860,1100,4,934,0,1,0,986,74,73,231,595,2,233,3,1,0,463,74,73,231,595,2,233,0,1,0,463,74,73,232,609,2,354,3,1,0,462,74,73,232,609,2,354,0,1,0,462,74,73,771,1069,4,872,0,1,0,988,54,52,283,600,2,272,3,1,0,466,54,52,283,600,2,272,0,1,0,466,54,52,284,601,2,279,3,1,0,467,54,52,284,601,2,279,0,1,0,467,54,52,285,602,2,287,3,1,0,465,54,52,285,602,2,287,0,1,0,465,54,52,819,1066,4,824,0,1,0,991,65,61,218,502,2,121,3,1,0,469,65,61,218,502,2,121,0,1,0,469,65,61,219,503,2,122,3,1,0,468,65,61,219,503,2,122,0,1,0,468,65,61,220,504,2,123,3,1,0,440,65,61,220,504,2,123,0,1,0,440,987,931,768,1058,7,760,1,1,0,993,55,51,280,610,2,360,3,1,0,471,55,51,280,610,2,360,0,1,0,471,55,51,281,611,2,365,3,3,0,472,55,51,281,611,2,365,0,3,0,472,55,51,818,1033,7,730,70,1,0,1006,55,51,282,578,2,195,3,1,0,494,55,51,282,578,2,195,0,1,0,494,66,57,276,591,2,206,3,1,0,409,66,57,276,591,2,206,0,1,0,409,66,57,277,557,2,176,3,1,0,497,66,57,277,557,2,176,0,1,0,497,66,57,278,556,2,175,3,1,0,450,66,57,278,556,2,175,0,1,0,450,88,80,215,505,2,124,3,1,0,473,88,80,215,505,2,124,0,1,0,473,88,80,216,506,2,125,3,1,0,435,88,80,216,506,2,125,0,1,0,435,75,72,337,597,2,248,3,1,0,477,75,72,337,597,2,248,0,1,0,477,75,72,848,1065,4,807,0,1,0,996,75,72,338,621,2,97,3,1,0,478,75,72,338,621,2,97,0,1,0,478,997,932,780,1067,4,829,0,1,0,1133,48,43,289,513,2,132,3,1,0,496,48,43,289,513,2,132,0,1,0,496,48,43,290,599,2,261,3,1,0,495,48,43,290,599,2,261,0,1,0,495,48,43,823,1040,7,737,95,1,0,1013,48,43,361,646,2,403,3,1,0,115,48,43,361,646,2,403,0,1,0,115,48,43,878,1103,4,945,0,1,0,720,89,82,294,520,2,139,3,1,0,481,89,82,294,520,2,139,0,1,0,481,89,82,825,1050,4,748,0,1,0,1000,89,82,826,1051,7,749,103,32,32,1001,90,81,295,521,2,140,3,1,0,492,90,81,295,521,2,140,0,1,0,492,90,81,827,1049,4,747,0,1,0,1011,90,81,828,1054,7,752,0,1,0,1012,49,45,234,536,2,157,102,1,42,493,49,45,234,536,2,157,107,1,42,493,49,45,856,1016,7,933,1,1,0,977,49,45,857,1017,7,721,1,1,0,998,49,45,858,1018,7,722,1,3,1,1007,49,45,859,1032,7,729,1,1,0,1008,49,45,370,608,2,353,50,1,0,482,49,45,370,608,2,353,18,1,0,482,22,21,772,537,4,97,0,1,0,27,22,21,773,538,4,910,0,1,0,27,22,21,774,572,4,911,0,1,0,27,22,21,775,579,4,913,0,1,0,27,22,21,776,580,4,914,0,1,0,27,22,21,777,607,4,915,0,1,0,27,22,21,778,567,4,745,0,1,0,684,22,21,794,537,7,723,18,1,0,27,22,21,795,538,7,724,18,1,0,27,22,21,796,572,7,759,18,1,0,27,22,21,797,579,7,762,18,1,0,27,22,21,798,580,7,763,18,1,0,27,22,21,799,607,7,850,18,1,0,27,22,21,887,567,7,954,18,1,0,684,91,84,292,514,2,133,3,1,0,451,91,84,292,514,2,133,0,1,0,451,91,84,293,605,2,328,3,1,0,425,91,84,293,605,2,328,0,1,0,425,28,25,330,624,2,380,3,1,0,453,28,25,330,624,2,380,0,1,0,453,28,25,331,625,2,381,3,1,0,454,28,25,331,625,2,381,0,1,0,454,28,25,332,626,2,382,3,1,0,702,28,25,332,626,2,382,0,1,0,702,28,25,334,627,2,383,3,1,0,698,28,25,334,627,2,383,0,1,0,698,28,25,335,628,2,384,3,1,0,430,28,25,335,628,2,384,0,1,0,430,28,25,336,629,2,385,3,1,0,438,28,25,336,629,2,385,0,1,0,438,67,58,298,582,2,197,3,1,0,476,67,58,298,582,2,197,0,1,0,476,67,58,299,583,2,198,3,1,0,456,67,58,299,583,2,198,0,1,0,456,67,58,300,584,2,199,3,1,0,491,67,58,300,584,2,199,0,1,0,491,68,59,224,552,2,171,3,1,0,656,68,59,224,552,2,171,0,1,0,656,68,59,226,576,2,193,3,1,0,657,68,59,226,576,2,193,0,1,0,657,68,59,227,577,2,194,3,1,0,696,68,59,227,577,2,194,0,1,0,696,11,10,265,544,2,163,50,1,0,667,11,10,265,544,2,163,18,1,0,667,11,10,266,545,2,164,50,1,0,484,11,10,266,545,2,164,18,1,0,484,11,10,267,546,2,165,3,1,0,483,11,10,267,546,2,165,0,1,0,483,11,10,804,1055,4,754,0,1,0,1132,11,10,805,1070,4,888,0,1,0,1123,11,10,806,1071,4,889,0,1,0,1129,11,10,808,1072,4,890,0,1,0,1126,11,10,809,1073,4,891,0,1,0,1130,11,10,810,1074,4,892,0,1,0,1124,11,10,811,1075,4,893,0,1,0,1125,11,10,812,1076,4,894,0,1,0,1128,11,10,813,1077,4,895,0,1,0,1127,11,10,841,1088,4,919,0,1,0,1005,11,10,861,1101,7,935,1,1,0,1131,11,10,355,651,2,398,3,1,0,669,11,10,355,651,2,398,0,1,0,669,11,10,356,642,2,399,3,1,0,668,11,10,356,642,2,399,0,1,0,668,41,36,236,516,2,135,3,1,0,673,41,36,236,516,2,135,0,1,0,673,41,36,237,547,2,166,3,1,0,670,41,36,237,547,2,166,0,1,0,670,41,36,238,548,2,167,3,1,0,699,41,36,238,548,2,167,0,1,0,699,41,36,779,1021,7,727,1,1,0,1134,41,36,239,549,2,168,711,1,114,672,41,36,239,549,2,168,95,1,114,672,93,83,296,518,2,137,3,1,0,671,93,83,296,518,2,137,0,1,0,671,93,83,297,581,2,196,101,1,77,437,93,83,297,581,2,196,105,1,77,437,17,16,244,519,2,138,3,1,0,666,17,16,244,519,2,138,0,1,0,666,17,16,245,558,2,177,50,1,0,664,17,16,245,558,2,177,18,1,0,664,17,16,246,614,2,371,3,1,0,661,17,16,246,614,2,371,0,1,0,661,17,16,784,1061,4,765,0,1,0,1119,17,16,785,1081,7,900,1,1,0,1121,17,16,247,617,2,374,100,1,42,665,17,16,247,617,2,374,104,1,42,665,17,16,249,618,2,375,100,1,42,654,17,16,249,618,2,375,104,1,42,654,17,16,786,1084,4,904,0,1,0,1120,17,16,250,619,2,376,3,1,0,662,17,16,250,619,2,376,0,1,0,662,17,16,251,620,2,377,3,1,0,663,17,16,251,620,2,377,0,1,0,663,17,16,800,1082,4,901,0,1,0,1122,675,396,340,641,2,156,3,1,0,676,675,396,340,641,2,156,0,1,0,676,29,26,252,522,2,141,3,1,0,677,29,26,252,522,2,141,0,1,0,677,29,26,253,523,2,143,3,1,0,678,29,26,253,523,2,143,0,1,0,678,29,26,787,1080,4,899,0,1,0,1142,29,26,788,1086,4,917,0,1,0,1144,29,26,789,1087,4,918,0,1,0,1141,29,26,254,615,2,372,3,1,0,679,29,26,254,615,2,372,0,1,0,679,29,26,790,1078,4,897,0,1,0,1140,29,26,791,1079,4,898,0,1,0,1139,29,26,792,1083,4,902,0,1,0,1143,56,53,262,540,2,159,3,1,0,680,56,53,262,540,2,159,0,1,0,680,56,53,803,1020,4,726,0,1,0,1147,56,53,263,541,2,160,50,1,0,682,56,53,263,541,2,160,18,1,0,682,56,53,264,543,2,162,715,1,0,681,56,53,264,543,2,162,719,1,0,681,683,142,291,586,2,201,3,1,0,461,683,142,291,586,2,201,0,1,0,461,69,60,256,542,2,161,3,1,0,686,69,60,256,542,2,161,0,1,0,686,69,60,801,1035,4,732,0,1,0,1148,69,60,257,551,2,170,3,1,0,685,69,60,257,551,2,170,0,1,0,685,69,60,802,1034,7,731,1,1,0,1149,34,33,268,510,2,129,3,1,0,689,34,33,268,510,2,129,0,1,0,689,34,33,269,511,2,130,3,1,0,687,34,33,269,511,2,130,0,1,0,687,34,33,270,565,2,184,3,1,0,688,34,33,270,565,2,184,0,1,0,688,34,33,271,604,2,315,3,1,0,690,34,33,271,604,2,315,0,1,0,690,34,33,814,1047,4,744,0,1,0,1151,34,33,815,1068,4,834,0,1,0,1150,691,116,273,588,2,203,3,1,0,692,691,116,273,588,2,203,0,1,0,692,20,19,343,630,2,386,3,1,0,92,20,19,343,630,2,386,0,1,0,92,20,19,344,631,2,387,3,1,0,703,20,19,344,631,2,387,0,1,0,703,20,19,345,632,2,388,3,1,0,658,20,19,345,632,2,388,0,1,0,658,20,19,346,633,2,389,3,1,0,434,20,19,346,633,2,389,0,1,0,434,20,19,849,1094,4,925,0,1,0,1162,20,19,347,634,2,390,3,1,0,439,20,19,347,634,2,390,0,1,0,439,20,19,348,635,2,391,50,1,0,498,20,19,348,635,2,391,18,1,0,498,20,19,349,636,2,392,3,1,0,486,20,19,349,636,2,392,0,1,0,486,20,19,851,1095,4,926,0,1,0,1009,24,23,258,531,2,151,3,1,0,694,24,23,258,531,2,151,0,1,0,694,24,23,259,535,2,155,712,1,112,693,24,23,259,535,2,155,717,1,112,693,24,23,260,616,2,373,3,1,0,480,24,23,260,616,2,373,0,1,0,480,24,23,341,533,2,153,3,1,0,457,24,23,341,533,2,153,0,1,0,457,24,23,342,534,2,154,3,1,0,458,24,23,342,534,2,154,0,1,0,458,24,23,352,639,2,395,3,1,0,695,24,23,352,639,2,395,0,1,0,695,24,23,855,1099,4,930,0,1,0,1152,94,85,288,515,2,134,3,1,0,704,94,85,288,515,2,134,0,1,0,704,94,85,822,622,2,378,3,3,1,705,94,85,862,622,2,378,0,0,1,705,9,8,877,1102,7,944,1,1,0,994,9,8,357,643,2,400,3,1,0,447,9,8,357,643,2,400,0,1,0,447,9,8,358,644,2,401,3,1,0,446,9,8,358,644,2,401,0,1,0,446,9,8,359,645,2,402,3,1,0,448,9,8,359,645,2,402,0,1,0,448,9,8,879,1104,4,946,0,1,0,973,9,8,880,1015,4,948,0,1,0,1145,9,8,881,1014,4,947,0,1,0,1146,9,8,882,1105,4,949,0,1,0,984,9,8,362,647,2,404,3,1,0,445,9,8,362,647,2,404,0,1,0,445,9,8,363,648,2,405,3,1,0,707,9,8,363,648,2,405,0,1,0,707,9,8,364,649,2,406,3,1,0,706,9,8,364,649,2,406,0,1,0,706,9,8,883,1106,7,950,1,1,0,1159,9,8,366,650,2,407,3,1,0,475,9,8,366,650,2,407,0,1,0,475,9,8,884,1107,7,951,70,32,32,995,9,8,885,1108,7,952,70,32,32,1164,6,5,312,524,2,144,3,1,0,489,6,5,312,524,2,144,0,1,0,489,6,5,313,525,2,145,3,1,0,490,6,5,313,525,2,145,0,1,0,490,6,5,314,526,2,146,3,1,0,659,6,5,314,526,2,146,0,1,0,659,6,5,316,527,2,147,3,1,0,660,6,5,316,527,2,147,0,1,0,660,6,5,317,528,2,148,3,1,0,470,6,5,317,528,2,148,0,1,0,470,6,5,318,530,2,150,3,1,0,474,6,5,318,530,2,150,0,1,0,474,6,5,319,574,2,191,3,1,0,701,6,5,319,574,2,191,0,1,0,701,6,5,320,575,2,192,3,1,0,700,6,5,320,575,2,192,0,1,0,700,6,5,321,573,2,190,3,1,0,455,6,5,321,573,2,190,0,1,0,455,6,5,832,1059,4,761,0,1,0,985,6,5,322,568,2,186,3,1,0,444,6,5,322,568,2,186,0,1,0,444,6,5,833,1048,4,746,0,1,0,983,6,5,323,570,2,188,3,1,0,443,6,5,323,570,2,188,0,1,0,443,6,5,835,1056,4,757,0,1,0,982,6,5,324,571,2,189,3,1,0,442,6,5,324,571,2,189,0,1,0,442,6,5,836,1057,4,758,0,1,0,981,6,5,325,553,2,172,3,1,0,708,6,5,325,553,2,172,0,1,0,708,6,5,326,554,2,173,50,1,0,709,6,5,326,554,2,173,18,1,0,709,6,5,837,1037,4,734,0,1,0,969,6,5,838,1038,4,735,0,1,0,970,6,5,839,1039,4,736,0,1,0,971,6,5,327,555,2,174,713,1,0,710,6,5,327,555,2,174,96,1,0,710,6,5,840,1062,7,766,1,1,0,1010,6,5,842,1089,4,920,0,1,0,989,6,5,329,623,2,379,3,1,0,674,6,5,329,623,2,379,0,1,0,674,6,5,843,1090,4,921,0,1,0,1136,6,5,845,1093,4,924,0,1,0,979,6,5,350,637,2,393,3,1,0,92,6,5,350,637,2,393,0,1,0,92,6,5,351,638,2,394,3,1,0,485,6,5,351,638,2,394,0,1,0,485,6,5,852,1096,4,927,37,18,32,1002,6,5,853,1098,4,929,0,1,0,1003,6,5,854,1097,4,928,0,1,0,1004,76,71,871,99,4,187,0,1,0,98,76,71,873,99,4,187,3,3,1,98,76,71,874,99,7,753,716,1,0,98,76,71,875,569,4,756,0,1,0,488,76,71,876,569,7,755,95,714,718,488],"strings":["1","0","TUMB","-1","BTN","42","WEAPON_CONTROL","LEV","51","UNCLASSIFIED","40","RADAR","41","ASP","24","ARK","25","RSBN","0.5","57","SPS_CONTROL","47","LIGHTS_WARNING","38","SRZO","56","8","Check Warning Lights - Set Warning Light Day/Night","NUKE_CONTROL","SAU","43","CANOPY","","48","SPRD","213","22","3","3050","7","CONTROL_SYSTEM","RADIO","0.99","17","2","46","AC_BUS","ENGINE_START_DEVICE","KONUS","LIGHTS","-0.5","14","15","39","FLAPS","GEARS","SOD","13","19","27","37","4","6","DC_BUS","ENGINE","FUEL_PUMPS","GEAR_BRAKES","OXYGENE_SYSTEM","PITOT_TUBES","SPO","0.2","26","45","53","FIRE_EXTINGUISHER","HELMET_VISOR","avAChS","0.98","11","16","21","23","28","33","44","9","ARU","CHUTE","GYRO_DEVICES","KPP","KSI","MAIN_HYDRO","On / Off","RADIO_ALTIMETER","TRIMER","0.05","0.1","369","Mech clock left lever","PNT_264","-0.01","-0.14","-0.33","0.0001","0.01","0.14","0.3","0.33","0.4","0.6","0.7","0.8","0.88","0.9","0.95","1.5 Mach Test Button - Cover","10","12","153","154","155","159","160","161","162","163","164","165","166","167","168","169","170","171","172","173","174","175","176","177","178","179","18","180","181","182","183","184","185","186","187","188","189","190","191","192","193","194","197","200","201","202","204","205","206","207","208","209","211","224","227","229","230","231","235","237","238","240","241","242","243","244","249","250","252","254","256","265","269","271","275","277","278","279","280","281","284","285","286","287","288","291","292","293","295","296","299","300","3001","3002","3003","3004","3005","3006","3007","3008","3009","301","3010","3011","3012","3014","3015","3017","3019","302","3020","3021","3022","3023","3024","3025","3026","303","3032","304","3041","3042","3043","3045","3047","3051","3052","3053","3054","3055","3056","3059","306","3060","3062","3063","3064","3065","3069","308","3083","3085","3087","3088","3089","309","3090","3092","3093","3094","3095","3096","3106","3107","3108","3109","311","3112","3113","3116","3117","3118","3119","312","3120","3121","3123","3124","3125","3126","3129","313","3131","3133","3134","3136","3137","3138","3139","3142","3145","3146","3147","3148","3149","3150","3151","3154","3155","3156","3157","3158","3159","316","3160","3161","3167","3168","3169","317","3170","3171","3172","3173","3174","3175","3177","3179","3181","3183","3184","3188","319","3192","3197","3198","3199","320","3200","3201","3202","3205","3207","3208","3209","3210","3211","3214","3215","3216","3217","3219","3220","3221","3223","3224","3229","323","324","3254","3255","3257","3258","3259","326","3260","3266","3267","3268","327","3270","3272","328","329","3333","340","344","346","351","352","367","368","379","383","387","388","389","390","391","392","393","394","395","396","398","399","400","420","421","427","49","50","632","633","635","636","637","638","644","645","646","648","649","ABS Off/On","AC Generator On/Off","AIRBRAKE","AIR_CONDITIONING","APU On/Off","ARK Mode - Antenna / Compass","ARK On/Off","ARK Zone","ARU System - Low Speed/Neutral/High Speed","ARU System - Manual/Auto","ASP Main Mode - Manual/Auto","ASP Mode - Bombardment/Shooting","ASP Mode - Giro/Missile","ASP Mode - Missiles-Rockets/Gun","ASP Optical sight On/Off","Afterburner/Maximum Off/On","Aileron Booster - Off/On","Airbrake - Out/In","Anti surge doors - Auto/Manual","Battery Heat On/Off","Battery On/Off","Brake Chute","Canopy Emergency Release Handle","Canopy Ventilation System","Cockpit Air Condition Off/Cold/Auto/Warm","Continuous / Impulse","DA-200 Signal, Giro, NPP, RLS, SAU Power On/Off","DC Generator On/Off","Dangerous Altitude Warning Set","Detonation Air / Ground","Dispenser Auto / Manual","Drain Fuel Tank, Fuel Pump","Drop Drag Chute Cover","Drop Payload - Inner Pylons Cover","Drop Payload - Outer Pylons Cover","Drop Wing Fuel Tanks Cover","Ejection Seat Emergency Oxygen","Electric Bus Nr.1","Electric Bus Nr.1 - Cover","Electric Bus Nr.2","Emergency Afterburner Off/On","Emergency Brake","Emergency Hydraulic Pump On/Off","Emergency Inverter","Emergency Jettison","Emergency Jettison Armed / Not Armed","Emergency Missile/Rocket Launcher Cover","Emergency Oxygen Off/On","Emergency Transmitter Cover","Emergency Transmitter On/Off","Engine Cold / Normal Start","Engine Emergency Air Start","Engine Nozzle 2 Position Emergency Control","Fire Extinguisher Cover","Fire Extinguisher Off/On","Fix net On/Off","Flaps Landing","Flaps Neutral","Flaps Take-Off","Fuel Tanks 1st Group, Fuel Pump","Fuel Tanks 3rd Group, Fuel Pump","GS-23 Gun On/Off","Gear Handle Fixator","Gear Up/Neutral/Down","Giro, NPP, SAU, RLS Signal, KPP Power On/Off","Guncam On/Off","Harness Separation","Helmet Air Condition Off/On","Helmet Heat - Manual/Auto","Helmet visor - off/on.","Hermetize Canopy","IFF System 'Type 81' On/Off","KPP Main/Emergency","Landing Lights Off/Taxi/Land","Locked Beam On/Off","Low Altitude Off/Comp/On","MAIN GUN / UPK Guns","Manual Activation button - Cover","Marker Far/Near","Mech clock right lever","Missiles - Rockets Heat On/Off","Missiles - Rockets Launch On/Off","Mixture/Oxygen","NPP On/Off","Navigation Lights Off/Min/Med/Max","Nose Gear Emergency Release Handle","Nosecone Control - Manual/Auto","Nosecone On/Off","Nosegear Brake Off/On","Off / Parallel / Full","PNT_153","PNT_154","PNT_155","PNT_159","PNT_160","PNT_161","PNT_162","PNT_163","PNT_164","PNT_165","PNT_166","PNT_167","PNT_168","PNT_169","PNT_170","PNT_171","PNT_172","PNT_173","PNT_174","PNT_175","PNT_176","PNT_177","PNT_178","PNT_179","PNT_180","PNT_181","PNT_182","PNT_183","PNT_184","PNT_185","PNT_186","PNT_187","PNT_188","PNT_189","PNT_190","PNT_191","PNT_192","PNT_194","PNT_195","PNT_196","PNT_197","PNT_200","PNT_201","PNT_202","PNT_204","PNT_205","PNT_206","PNT_207","PNT_208","PNT_209","PNT_211","PNT_224","PNT_227","PNT_229","PNT_230","PNT_231","PNT_235","PNT_237","PNT_238","PNT_240","PNT_241","PNT_242","PNT_243","PNT_244","PNT_249","PNT_250","PNT_252","PNT_254","PNT_255","PNT_256","PNT_268","PNT_269","PNT_271","PNT_273","PNT_275","PNT_277","PNT_278","PNT_279","PNT_280","PNT_281","PNT_282","PNT_283","PNT_284","PNT_285","PNT_286","PNT_287","PNT_288","PNT_291","PNT_292","PNT_293","PNT_295","PNT_296","PNT_299","PNT_300","PNT_301","PNT_302","PNT_303","PNT_304","PNT_306","PNT_308","PNT_309","PNT_311","PNT_312","PNT_313","PNT_316","PNT_317","PNT_319","PNT_320","PNT_322","PNT_323","PNT_324","PNT_326","PNT_327","PNT_328","PNT_329","PNT_340","PNT_344","PNT_346","PNT_349","PNT_350","PNT_367","PNT_368","PNT_369","PNT_379","PNT_383","PNT_387","PNT_388","PNT_389","PNT_390","PNT_391","PNT_392","PNT_393","PNT_394","PNT_395","PNT_396","PNT_398","PNT_399","PNT_400","PNT_420","PNT_421","PNT_427","PNT_431","PNT_433","PNT_434","PNT_436","PNT_437","PNT_438","PNT_439","PNT_443","PNT_444","PNT_445","PNT_447","PNT_450","PO-750 Inverter #1 On/Off","PO-750 Inverter #2 On/Off","PRMG Landing","Pipper On/Off","Pitot tube Selector Main/Emergency","Pitot tube/Periscope/Clock Heat","Program I / II","Pylon 1-2 Power On/Off","Pylon 3-4 Power On/Off","RSBN / ARK","RSBN Bearing","RSBN Distance","RSBN Mode Land/Navigation/Descend","RSBN Navigation","RSBN On/Off","Radar Off/Prep/On","Radar emission - Combat/Training","Radar emission - Cover","Radio / Compass","Radio Altimeter/Marker On/Off","Radio Channel","Radio System On/Off","Release Weapon Cover","SARPP","SARPP-12 Flight Data Recorder On/Off","SAU On/Off","SAU Pitch On/Off","SAU Preset - Limit Altitude","SOD IFF On/Off","SOD Modes","SOD Wave Selector 3/1/2","SOPLO","SORC","SPO-10 Night / Day","SPO-10 RWR On/Off","SPRD (RATO) Drop System On/Off","SPRD (RATO) Start Cover","SPRD (RATO) System On/Off","SPRD (RATO)t Drop Cover","SPS","SPS System Off/On","SRZO Codes","SRZO IFF Coder/Decoder On/Off","SRZO Self Destruct Cover","Secondary Pitot Tube Heat","Secure Canopy","Special AB / Missile-Rocket-Bombs-Cannon","Squelch On/Off","Tactical Drop","Tactical Drop Cover","Tactical Jettison","Transmit / Receive","Trimmer On/Off","Trimmer Pitch Up/Down","UK-2M Mic Amplifier GS/KM","UK-2M Mic Amplifier M/L","Weapon Mode - Air/Ground","Weapon Mode - IR Missile/Neutral/SAR Missile","Weapon Selector","-0.05","-0.08","-0.1","-0.15","-0.25","0.04","0.08","0.15","0.25","1.5 Mach Test Button","156","157","195","196","198","199","210","212","222","223","225","226","228","232","233","234","236","239","245","246","247","248","251","253","255","257","258","259","260","261","262","263","264","266","267","268","270","272","273","274","276","282","283","289","294","297","298","3013","3016","3018","3027","3034","3035","3036","3037","3038","3039","3040","3044","3046","3048","3049","305","3057","3058","3061","3066","3067","3068","3070","3071","3072","3073","3074","3075","3076","3077","3078","3079","3080","3084","3086","3091","3097","3098","3099","310","3100","3101","3102","3103","3104","3105","3110","3111","3114","3115","3122","3127","3128","3130","3132","3135","314","3140","3141","3143","3144","315","3152","3153","3176","3178","318","3180","3182","3185","3186","3187","3189","3190","3191","3193","3194","3196","32","3203","3206","3218","322","3222","3225","3226","3227","3230","3231","3232","3233","3234","3238","3239","3240","3241","3242","3243","3244","3245","3246","3247","3248","3249","325","3250","3251","3252","3253","3256","3261","3262","3263","3264","3265","3269","3273","3274","3276","3277","330","331","332","333","334","335","336","337","34","341","342","343","345","347","348","35","366","3662","3663","3664","3665","3666","370","371","3713","372","373","374","375","376","377","378","381","382","384","385","386","397","401","422","424","425","428","5","55","612","616","623","624","625","626","627","628","629","630","631","634","639","640","641","642","643","647","650","651","654","657","ACCELEROMETER","ALTIMETER","ARK 1","ARK 2","ARK 3","ARK 4","ARK 5","ARK 6","ARK 7","ARK 8","ARK 9","ARK Change","ARK Sound","Accelerometer Reset","Activate Gun Loading Pyro - 1","Activate Gun Loading Pyro - 2","Activate Gun Loading Pyro - 3","Altimeter pressure knob","BU-45 Buster System Separation","Canopy Anti Ice","Canopy Close","Canopy Open","Cockpit Texts Back-light","DA_200","Drop Center Fuel Tank","Drop Drag Chute","Drop Payload - Inner Pylons","Drop Payload - Outer Pylons","Drop Wing Fuel Tanks","Eject","Emergency Missile/Rocket Launcher","Engine Stop/Lock","FUEL_SYSTEM","Fire Extinguisher","Fire Gun","Fix Net light control","Flaps Reset buttons","Force Feedback On/Off","Fuel Quantity Set","G-Suit Max/Min valve","Harness Loose/Tight","Helmet Quick Heat","INTERCOM","Instruments Back-light","Intercept Angle","KPP Cage","KPP Set","LOAD 1","LOAD 2","LOAD 3","Lock Target","Main Gears Emergency Release Handle","Main Red Lights","Main White Lights","Manual Activation button","Missile Seeker Sound","NPP Adjust","NPP Course set","Nosecone manual position controller","PNT_150","PNT_151","PNT_152","PNT_156","PNT_157","PNT_198","PNT_199","PNT_210","PNT_212","PNT_213","PNT_214","PNT_215","PNT_216","PNT_217","PNT_218","PNT_219","PNT_220","PNT_221","PNT_222","PNT_223","PNT_225","PNT_226","PNT_228","PNT_232","PNT_233","PNT_234","PNT_236","PNT_239","PNT_245","PNT_246","PNT_247","PNT_248","PNT_251","PNT_253","PNT_257","PNT_258","PNT_259","PNT_260","PNT_261","PNT_262","PNT_263","PNT_266","PNT_270","PNT_272","PNT_274","PNT_276","PNT_289","PNT_294","PNT_297","PNT_298","PNT_305","PNT_310","PNT_314","PNT_315","PNT_318","PNT_325","PNT_330","PNT_331","PNT_332","PNT_333","PNT_334","PNT_335","PNT_336","PNT_337","PNT_341","PNT_342","PNT_343","PNT_345","PNT_347","PNT_348","PNT_366","PNT_375","PNT_376","PNT_377","PNT_378","PNT_381","PNT_382","PNT_384","PNT_385","PNT_386","PNT_397","PNT_401","PNT_422","PNT_424","PNT_425","PNT_428","PNT_430","PNT_432","PNT_435","PNT_440","PNT_441","PNT_442","PNT_446","PNT_448","PNT_449","PNT_ENG_DEC","PNT_ENG_INC","PNT_FF","PNT_RUD_LEFT","PNT_RUD_RIGHT","PNT_STICK_DOWN","PNT_STICK_LEFT","PNT_STICK_RIGHT","PNT_STICK_UP","Pipper light control","RSBN Identify","RSBN Reset","RSBN Sound","RSBN self-test","Radar Interferes - Continues","Radar Interferes - IFF","Radar Interferes - Low Speed","Radar Interferes - Passive","Radar Interferes - Reset","Radar Interferes - Self-test","Radar Interferes - Temporary","Radar Interferes - Weather","Radar Polar Filter","Radar Screen Magnetic Reset","Radio PTT","Radio Volume","Release Drag Chute","Release Weapon","Rudder Left","Rudder Right","SAU - Landing - Auto","SAU - Landing - Command","SAU - Recovery","SAU - Stabilize","SAU Reset/Off","SAU cancel current mode","SOD Control PBU-1","SOD Control PBU-2","SOD Identify","SPO-10 Test","SPO-10 Volume","SPRD (RATO) Drop","SPRD (RATO) Start","SRZO Self Destruct","Scale Backlights control","Start Engine","Stick Down","Stick Left","Stick Right","Stick Up","Suit Ventilation","TDC Range / Pipper Span control","Target Size","Test","Throttle Decrease","Throttle Fixation","Throttle Increase","Variometer Set"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Mi-8MTV2","rows":[132,130,13,1294,5,83,0,1,0,1270,132,130,12,1296,10,1070,1,1,0,1271,132,130,14,823,2,270,3,1,0,674,132,130,14,823,2,270,0,1,0,674,133,131,13,1295,5,1196,0,1,0,1428,133,131,12,1297,10,1192,1,1,0,1429,133,131,14,920,2,338,3,1,0,1013,133,131,14,920,2,338,0,1,0,1013,36,35,11,1397,10,1127,0,1,0,1208,36,35,13,943,2,315,3,1,0,510,36,35,13,943,2,315,0,1,0,510,36,35,12,937,2,316,18,1,43,509,36,35,12,937,2,316,16,1,43,509,36,35,14,1396,10,1128,1,166,57,1206,36,35,17,939,2,454,142,1,110,503,36,35,17,939,2,454,109,1,110,503,36,35,15,938,2,318,18,1,65,504,36,35,15,938,2,318,16,1,65,504,36,35,23,1395,10,1129,1,166,57,1207,36,35,27,936,2,455,142,1,110,507,36,35,27,936,2,455,109,1,110,507,36,35,34,935,2,319,18,1,65,508,36,35,34,935,2,319,16,1,65,508,36,35,30,942,5,317,3,3,1,506,36,35,30,942,5,317,0,1,0,506,36,35,45,947,2,327,3,1,0,505,36,35,45,947,2,327,0,1,0,505,53,52,11,929,2,322,18,1,57,513,53,52,11,929,2,322,16,1,57,513,53,52,13,940,2,320,3,1,0,514,53,52,13,940,2,320,0,1,0,514,53,52,12,941,2,321,3,1,0,515,53,52,12,941,2,321,0,1,0,515,53,52,14,930,2,323,18,1,25,511,53,52,14,930,2,323,16,1,25,511,53,52,17,1393,10,1130,1,1,0,1212,53,52,15,1391,5,1151,0,1,0,1209,53,52,23,1389,5,1152,0,1,0,1210,53,52,27,1390,5,1153,0,1,0,1211,53,52,38,921,2,334,3,1,0,512,53,52,38,921,2,334,0,1,0,512,37,33,11,722,5,1079,0,1,0,518,37,33,13,726,5,1076,0,1,0,521,37,33,12,725,5,1073,0,1,0,520,37,33,14,721,5,1080,0,1,0,517,37,33,17,724,5,1074,0,1,0,519,37,33,15,723,2,175,0,1,0,516,37,33,23,723,5,175,3,3,1,516,37,33,27,1304,10,1077,0,1,0,1224,37,33,34,1303,10,1075,0,1,0,1220,37,33,30,1306,10,1078,0,1,0,1223,37,33,86,725,10,1178,1,1,58,520,37,33,67,724,10,1179,1,1,58,519,37,33,62,726,10,1180,1,1,58,521,37,33,74,722,10,1181,1,1,58,518,37,33,75,721,10,1182,1,1,58,517,37,33,88,1307,5,1082,0,1,0,1221,37,33,89,1308,5,1088,0,1,0,1222,37,33,104,1414,5,1083,0,1,0,1447,37,33,90,1415,5,1089,0,1,0,1448,1226,207,11,1298,10,98,0,1,0,524,1227,1091,11,1299,10,1202,0,1,0,524,79,77,11,164,5,48,0,1,0,162,79,77,13,164,5,48,3,3,1,162,79,77,12,164,10,1147,0,1,0,162,79,77,14,986,5,1149,0,1,0,695,79,77,17,986,10,1150,109,1062,1065,695,79,77,15,971,2,361,3,1,0,616,79,77,15,971,2,361,0,1,0,616,608,156,11,828,2,271,3,1,0,1058,608,156,11,828,2,271,0,1,0,1058,26,24,15,1407,5,1200,0,1,0,1214,26,24,85,751,2,202,167,1,82,675,26,24,85,751,2,202,82,1,82,675,26,24,99,752,2,203,167,1,82,1014,26,24,99,752,2,203,82,1,82,1014,26,24,100,1418,5,1183,0,1,0,1455,26,24,67,827,2,269,3,1,0,683,26,24,67,827,2,269,0,1,0,683,26,24,62,928,2,339,3,1,0,1022,26,24,62,928,2,339,0,1,0,1022,26,24,101,987,2,498,3,1,0,988,26,24,101,987,2,498,0,1,0,988,26,24,87,1354,2,106,43,43,43,1280,26,24,87,1355,2,106,57,57,57,1281,26,24,87,1356,2,106,1,1,1,1278,26,24,87,1357,5,106,58,1,58,1279,26,24,87,1358,2,106,16,16,16,1282,26,24,68,1383,2,107,57,57,57,1439,26,24,68,1384,2,107,43,43,43,1438,26,24,68,1385,2,107,1,1,1,1436,26,24,68,1386,2,107,16,16,16,1440,26,24,68,1387,5,107,58,1,58,1437,46,44,11,922,2,335,3,1,0,625,46,44,11,922,2,335,0,1,0,625,46,44,13,1325,5,1167,0,1,0,1449,46,44,12,1326,5,1168,0,1,0,1451,46,44,14,1323,5,1165,0,1,0,1249,46,44,17,1327,5,1166,0,1,0,1264,46,44,15,1324,5,1163,0,1,0,1250,46,44,23,1330,5,1164,0,1,0,1265,46,44,27,1328,5,1161,0,1,0,1248,46,44,34,1329,5,1162,0,1,0,1263,46,44,30,788,2,479,18,1,57,624,46,44,30,788,2,479,16,1,57,624,46,44,45,777,2,474,3,1,0,1054,46,44,45,777,2,474,0,1,0,1054,46,44,38,778,2,475,3,1,0,672,46,44,38,778,2,475,0,1,0,672,4,0,11,964,2,344,3,1,0,1049,4,0,11,964,2,344,0,1,0,1049,4,0,13,951,2,343,3,1,0,526,4,0,13,951,2,343,0,1,0,526,4,0,12,950,2,342,3,1,0,525,4,0,12,950,2,342,0,1,0,525,4,0,14,949,2,349,3,1,0,620,4,0,14,949,2,349,0,1,0,620,4,0,17,962,2,347,3,1,0,1010,4,0,17,962,2,347,0,1,0,1010,4,0,15,963,2,348,3,1,0,1011,4,0,15,963,2,348,0,1,0,1011,4,0,23,961,2,345,3,1,0,1009,4,0,23,961,2,345,0,1,0,1009,4,0,27,948,2,341,18,1,73,621,4,0,27,948,2,341,16,1,73,621,4,0,34,966,2,350,3,1,0,635,4,0,34,966,2,350,0,1,0,635,4,0,30,1406,10,1137,25,1,0,1444,4,0,45,1331,10,1139,25,1,0,1257,4,0,38,783,2,369,3,3,0,171,4,0,38,783,2,369,0,3,0,171,4,0,60,784,2,370,3,3,0,289,4,0,60,784,2,370,0,3,0,289,4,0,66,780,2,368,3,1,0,499,4,0,66,780,2,368,0,1,0,499,4,0,85,781,2,366,3,1,0,648,4,0,85,781,2,366,0,1,0,648,4,0,99,782,2,367,3,1,0,649,4,0,99,782,2,367,0,1,0,649,4,0,100,779,2,365,18,1,0,500,4,0,100,779,2,365,16,1,0,500,4,0,144,1332,10,1140,25,1,0,1258,4,0,86,736,2,177,3,1,0,698,4,0,86,736,2,177,0,1,0,698,4,0,67,747,2,178,3,3,0,290,4,0,67,747,2,178,0,3,0,290,4,0,62,728,2,176,3,1,0,697,4,0,62,728,2,176,0,1,0,697,4,0,74,1333,5,1184,0,1,0,1229,4,0,75,1336,5,1187,0,1,0,1230,4,0,101,1339,5,1190,0,1,0,1231,4,0,87,1334,5,1185,0,1,0,1232,4,0,68,1337,5,1188,0,1,0,1233,4,0,102,1340,5,1191,0,1,0,1234,4,0,103,1335,5,1186,0,1,0,1235,4,0,88,1338,5,1189,0,1,0,1236,4,0,89,1341,5,1193,0,1,0,1237,4,0,104,797,2,380,3,1,0,537,4,0,104,797,2,380,0,1,0,537,4,0,90,796,2,381,3,1,0,554,4,0,90,796,2,381,0,1,0,554,4,0,111,794,2,382,3,1,0,539,4,0,111,794,2,382,0,1,0,539,4,0,112,795,2,383,3,1,0,553,4,0,112,795,2,383,0,1,0,553,4,0,113,817,2,384,3,1,0,588,4,0,113,817,2,384,0,1,0,588,4,0,145,818,2,385,3,1,0,589,4,0,145,818,2,385,0,1,0,589,4,0,114,819,2,386,3,1,0,545,4,0,114,819,2,386,0,1,0,545,4,0,115,793,2,387,3,1,0,530,4,0,115,793,2,387,0,1,0,530,4,0,116,802,2,388,3,1,0,571,4,0,116,802,2,388,0,1,0,571,4,0,146,803,2,389,3,1,0,572,4,0,146,803,2,389,0,1,0,572,4,0,105,804,2,390,3,1,0,567,4,0,105,804,2,390,0,1,0,567,4,0,117,805,2,391,3,1,0,568,4,0,117,805,2,391,0,1,0,568,4,0,147,806,2,392,3,1,0,569,4,0,147,806,2,392,0,1,0,569,4,0,118,807,2,393,3,1,0,570,4,0,118,807,2,393,0,1,0,570,4,0,119,801,2,394,3,1,0,546,4,0,119,801,2,394,0,1,0,546,4,0,225,800,2,395,3,1,0,547,4,0,225,800,2,395,0,1,0,547,4,0,226,814,2,396,3,1,0,583,4,0,226,814,2,396,0,1,0,583,4,0,227,808,2,397,3,1,0,549,4,0,227,808,2,397,0,1,0,549,4,0,120,810,2,398,3,1,0,550,4,0,120,810,2,398,0,1,0,550,4,0,91,809,2,399,3,1,0,548,4,0,91,809,2,399,0,1,0,548,4,0,92,811,2,401,3,1,0,599,4,0,92,811,2,401,0,1,0,599,4,0,93,907,2,402,3,1,0,533,4,0,93,907,2,402,0,1,0,533,4,0,94,906,2,403,3,1,0,532,4,0,94,906,2,403,0,1,0,532,4,0,121,905,2,404,3,1,0,552,4,0,121,905,2,404,0,1,0,552,4,0,229,904,2,405,3,1,0,551,4,0,229,904,2,405,0,1,0,551,4,0,230,902,2,406,3,1,0,587,4,0,230,902,2,406,0,1,0,587,4,0,231,865,2,407,3,1,0,582,4,0,231,865,2,407,0,1,0,582,4,0,232,980,2,408,3,1,0,580,4,0,232,980,2,408,0,1,0,580,4,0,233,981,2,409,3,1,0,581,4,0,233,981,2,409,0,1,0,581,4,0,234,916,2,410,3,1,0,601,4,0,234,916,2,410,0,1,0,601,4,0,235,872,2,411,3,1,0,536,4,0,235,872,2,411,0,1,0,536,4,0,236,871,2,412,3,1,0,535,4,0,236,871,2,412,0,1,0,535,4,0,122,870,2,413,3,1,0,534,4,0,122,870,2,413,0,1,0,534,4,0,123,875,2,414,3,1,0,579,4,0,123,875,2,414,0,1,0,579,4,0,237,874,2,415,3,1,0,578,4,0,237,874,2,415,0,1,0,578,4,0,238,900,2,416,3,1,0,597,4,0,238,900,2,416,0,1,0,597,4,0,148,893,2,417,3,1,0,591,4,0,148,893,2,417,0,1,0,591,4,0,149,896,2,418,3,1,0,592,4,0,149,896,2,418,0,1,0,592,4,0,150,899,2,419,3,1,0,590,4,0,150,899,2,419,0,1,0,590,4,0,151,910,2,420,3,1,0,560,4,0,151,910,2,420,0,1,0,560,4,0,152,909,2,421,3,1,0,564,4,0,152,909,2,421,0,1,0,564,4,0,153,911,2,422,3,1,0,566,4,0,153,911,2,422,0,1,0,566,4,0,239,912,2,423,3,1,0,562,4,0,239,912,2,423,0,1,0,562,4,0,124,913,2,424,3,1,0,561,4,0,124,913,2,424,0,1,0,561,4,0,240,914,2,425,3,1,0,563,4,0,240,914,2,425,0,1,0,563,4,0,125,915,2,426,3,1,0,565,4,0,125,915,2,426,0,1,0,565,4,0,126,908,2,427,3,1,0,600,4,0,126,908,2,427,0,1,0,600,4,0,241,903,2,428,3,1,0,598,4,0,241,903,2,428,0,1,0,598,4,0,242,892,2,429,3,1,0,559,4,0,242,892,2,429,0,1,0,559,4,0,243,888,2,430,3,1,0,555,4,0,243,888,2,430,0,1,0,555,4,0,244,889,2,431,3,1,0,556,4,0,244,889,2,431,0,1,0,556,4,0,154,890,2,432,3,1,0,557,4,0,154,890,2,432,0,1,0,557,4,0,155,891,2,433,3,1,0,558,4,0,155,891,2,433,0,1,0,558,4,0,127,894,2,434,3,1,0,594,4,0,127,894,2,434,0,1,0,594,4,0,128,895,2,435,3,1,0,595,4,0,128,895,2,435,0,1,0,595,4,0,245,897,2,436,3,1,0,593,4,0,245,897,2,436,0,1,0,593,4,0,246,898,2,437,3,1,0,596,4,0,246,898,2,437,0,1,0,596,4,0,247,876,2,438,3,1,0,573,4,0,247,876,2,438,0,1,0,573,4,0,248,878,2,439,3,1,0,574,4,0,248,878,2,439,0,1,0,574,4,0,249,877,2,440,3,1,0,575,4,0,249,877,2,440,0,1,0,575,4,0,250,879,2,441,3,1,0,576,4,0,250,879,2,441,0,1,0,576,4,0,251,869,2,442,3,1,0,531,4,0,251,869,2,442,0,1,0,531,4,0,252,919,2,443,3,1,0,602,4,0,252,919,2,443,0,1,0,602,4,0,253,882,2,444,3,1,0,538,4,0,253,882,2,444,0,1,0,538,4,0,254,978,2,495,3,1,0,584,4,0,254,978,2,495,0,1,0,584,4,0,255,979,2,496,3,1,0,585,4,0,255,979,2,496,0,1,0,585,4,0,256,883,2,445,3,1,0,540,4,0,256,883,2,445,0,1,0,540,4,0,129,885,2,446,3,1,0,542,4,0,129,885,2,446,0,1,0,542,4,0,257,886,2,447,3,1,0,544,4,0,257,886,2,447,0,1,0,544,4,0,258,887,2,448,3,1,0,543,4,0,258,887,2,448,0,1,0,543,4,0,259,884,2,449,3,1,0,541,4,0,259,884,2,449,0,1,0,541,4,0,260,917,2,450,3,1,0,603,4,0,260,917,2,450,0,1,0,603,4,0,261,918,2,451,3,1,0,604,4,0,261,918,2,451,0,1,0,604,4,0,262,881,2,452,3,1,0,586,4,0,262,881,2,452,0,1,0,586,4,0,263,880,2,453,3,1,0,577,4,0,263,880,2,453,0,1,0,577,4,0,264,968,2,362,3,1,0,527,4,0,264,968,2,362,0,1,0,527,7,6,11,737,2,187,3,1,0,678,7,6,11,737,2,187,0,1,0,678,7,6,12,738,2,193,3,1,0,1017,7,6,12,738,2,193,0,1,0,1017,7,6,17,1311,5,1125,0,1,0,1255,7,6,15,1310,5,1126,0,1,0,1213,7,6,23,1321,5,1124,0,1,0,1205,7,6,27,763,2,300,3,3,0,633,7,6,27,763,2,300,0,3,0,633,7,6,34,785,2,199,3,1,0,682,7,6,34,785,2,199,0,1,0,682,7,6,30,786,2,200,3,1,0,1021,7,6,30,786,2,200,0,1,0,1021,7,6,45,985,2,201,3,1,0,1031,7,6,45,985,2,201,0,1,0,1031,7,6,38,776,2,299,3,3,0,502,7,6,38,776,2,299,0,3,0,502,7,6,86,1365,5,1105,0,1,0,1272,7,6,67,1366,5,1106,0,1,0,1430,7,6,62,1364,5,1102,0,1,0,1454,7,6,74,1362,5,1104,0,1,0,1260,7,6,75,1363,5,1103,0,1,0,1246,7,6,68,1322,5,1123,0,1,0,1204,7,6,102,764,2,301,3,3,0,634,7,6,102,764,2,301,0,3,0,634,7,6,103,959,2,357,3,1,0,677,7,6,103,959,2,357,0,1,0,677,7,6,88,960,2,358,3,1,0,1016,7,6,88,960,2,358,0,1,0,1016,7,6,89,835,2,283,3,1,0,622,7,6,89,835,2,283,0,1,0,622,7,6,104,1359,5,1111,0,1,0,1251,7,6,90,838,2,284,3,1,0,681,7,6,90,838,2,284,0,1,0,681,7,6,111,839,2,285,3,1,0,1020,7,6,111,839,2,285,0,1,0,1020,7,6,112,833,2,286,3,1,0,650,7,6,112,833,2,286,0,1,0,650,7,6,113,840,2,287,3,1,0,660,7,6,113,840,2,287,0,1,0,660,7,6,145,1360,5,1112,0,1,0,1262,7,6,114,830,2,292,18,1,65,623,7,6,114,830,2,292,16,1,65,623,7,6,115,969,2,359,3,1,0,687,7,6,115,969,2,359,0,1,0,687,7,6,116,970,2,360,3,1,0,1026,7,6,116,970,2,360,0,1,0,1026,7,6,146,1352,5,1109,0,1,0,1275,7,6,105,1353,5,1134,0,1,0,1433,7,6,91,743,5,189,3,3,1,680,7,6,91,743,5,189,0,1,0,680,7,6,92,744,5,191,3,3,1,1019,7,6,92,744,5,191,0,1,0,1019,7,6,93,734,2,188,3,1,0,679,7,6,93,734,2,188,0,1,0,679,7,6,94,735,2,192,3,1,0,1018,7,6,94,735,2,192,0,1,0,1018,7,6,121,746,5,190,3,3,1,609,7,6,121,746,5,190,0,1,0,609,7,6,122,976,5,198,3,3,1,141,7,6,122,976,5,198,0,1,0,141,7,6,123,977,5,490,3,3,1,141,7,6,123,977,5,490,0,1,0,141,7,6,148,700,10,1,1,3,0,134,7,6,149,701,10,1,1,3,0,134,7,6,150,700,10,1,1,3,0,134,7,6,151,701,10,1,1,3,0,134,7,6,152,1409,10,1,1,3,0,1273,7,6,153,1410,10,1,1,3,0,1431,7,6,124,765,5,302,3,3,1,632,7,6,124,765,5,302,0,1,0,632,71,69,11,1412,5,1087,0,1,0,1446,71,69,13,975,2,197,3,1,0,1052,71,69,13,975,2,197,0,1,0,1052,71,69,12,1411,5,1085,0,1,0,1253,71,69,14,974,2,196,3,1,0,630,71,69,14,974,2,196,0,1,0,630,71,69,17,858,2,266,3,1,0,636,71,69,17,858,2,266,0,1,0,636,50,47,11,1313,5,1113,0,1,0,1286,50,47,13,1314,5,1114,0,1,0,1287,50,47,12,1315,5,1115,0,1,0,1285,50,47,14,1316,5,1116,0,1,0,1284,50,47,17,1317,5,1117,0,1,0,1218,50,47,15,1318,5,1118,0,1,0,1219,50,47,23,1319,5,1119,0,1,0,1217,50,47,27,1320,5,1120,0,1,0,1216,50,47,34,1312,5,1121,0,1,0,1450,50,47,30,761,2,293,3,1,0,639,50,47,30,761,2,293,0,1,0,639,50,47,45,762,2,294,3,1,0,1048,50,47,45,762,2,294,0,1,0,1048,50,47,38,760,2,295,18,1,73,613,50,47,38,760,2,295,16,1,73,613,637,206,11,973,2,483,18,1,58,1050,637,206,11,973,2,483,16,1,58,1050,21,19,11,769,2,304,3,1,0,689,21,19,11,769,2,304,0,1,0,689,21,19,13,771,2,306,3,1,0,1028,21,19,13,771,2,306,0,1,0,1028,21,19,12,774,2,313,3,1,0,690,21,19,12,774,2,313,0,1,0,690,21,19,14,773,2,308,3,1,0,619,21,19,14,773,2,308,0,1,0,619,21,19,17,775,2,314,3,1,0,1029,21,19,17,775,2,314,0,1,0,1029,21,19,15,772,2,312,3,1,0,638,21,19,15,772,2,312,0,1,0,638,21,19,23,770,2,310,3,1,0,529,21,19,23,770,2,310,0,1,0,529,21,19,27,787,2,400,18,1,25,642,21,19,27,787,2,400,16,1,25,642,21,19,34,756,2,303,3,1,0,688,21,19,34,756,2,303,0,1,0,688,21,19,30,758,2,305,3,1,0,1027,21,19,30,758,2,305,0,1,0,1027,21,19,45,759,2,307,3,1,0,618,21,19,45,759,2,307,0,1,0,618,21,19,38,757,2,309,3,1,0,528,21,19,38,757,2,309,0,1,0,528,21,19,66,768,2,311,143,1,0,1012,21,19,66,768,2,311,25,1,0,1012,61,59,11,923,2,337,3,1,0,647,61,59,11,923,2,337,0,1,0,647,61,59,13,933,2,328,3,1,0,645,61,59,13,933,2,328,0,1,0,645,61,59,12,931,5,330,3,3,1,643,61,59,12,931,5,330,0,1,0,643,61,59,14,932,2,329,3,3,0,646,61,59,14,932,2,329,0,3,0,646,61,59,17,934,5,331,3,3,1,644,61,59,17,934,5,331,0,1,0,644,61,59,15,1394,10,1133,1,1,1067,1256,72,70,11,1392,5,1131,0,1,0,1268,72,70,13,946,2,326,3,1,0,668,72,70,13,946,2,326,0,1,0,668,72,70,12,945,2,324,3,3,0,669,72,70,12,945,2,324,0,3,0,669,72,70,14,944,2,325,3,3,0,670,72,70,14,944,2,325,0,3,0,670,72,70,17,1398,10,1132,1066,1,0,1269,160,157,11,1378,10,207,1,1,0,652,160,157,12,748,2,488,3,1,0,653,160,157,12,748,2,488,0,1,0,653,1259,158,11,1379,10,1071,1,1,0,652,80,76,11,767,2,296,3,1,0,694,80,76,11,767,2,296,0,1,0,694,80,76,13,766,2,298,3,1,0,523,80,76,13,766,2,298,0,1,0,523,80,76,12,1309,5,1122,0,1,0,1225,80,76,15,755,2,297,3,1,0,522,80,76,15,755,2,297,0,1,0,522,55,48,11,855,2,224,18,1,43,659,55,48,11,855,2,224,16,1,43,659,55,48,13,862,2,223,3,1,0,655,55,48,13,862,2,223,0,1,0,655,55,48,12,861,2,222,3,1,0,654,55,48,12,861,2,222,0,1,0,654,55,48,14,853,2,219,3,1,0,658,55,48,14,853,2,219,0,1,0,658,55,48,17,1367,5,1098,0,1,0,1261,55,48,15,854,2,220,3,1,0,656,55,48,15,854,2,220,0,1,0,656,55,48,23,860,2,221,3,1,0,657,55,48,23,860,2,221,0,1,0,657,41,39,11,715,2,467,143,1,0,665,41,39,11,715,2,467,25,1,0,665,41,39,13,712,2,468,18,1,0,664,41,39,13,712,2,468,16,1,0,664,41,39,12,713,2,469,18,1,0,662,41,39,12,713,2,469,16,1,0,662,41,39,14,714,2,470,18,1,0,663,41,39,14,714,2,470,16,1,0,663,41,39,17,163,2,471,18,1,0,161,41,39,17,163,2,471,16,1,0,161,41,39,15,163,10,1160,16,1,0,161,41,39,23,1292,10,1159,1,1,0,1267,41,39,27,716,2,466,1063,1,73,667,41,39,27,716,2,466,73,1,73,667,41,39,34,1293,5,1158,0,1,0,1266,41,39,60,927,2,336,3,1,0,666,41,39,60,927,2,336,0,1,0,666,42,40,13,824,2,268,3,3,0,676,42,40,13,824,2,268,0,3,0,676,42,40,12,926,2,340,3,3,0,1015,42,40,12,926,2,340,0,3,0,1015,42,40,14,925,2,332,3,1,0,346,42,40,14,925,2,332,0,1,0,346,42,40,17,1373,10,1092,1,1,0,1276,42,40,15,1374,10,1093,1,1,0,1277,42,40,23,1404,10,1135,1,1,0,1434,42,40,27,1405,10,1136,1,1,0,1435,42,40,34,1401,10,1194,1,1,0,1244,42,40,30,1402,10,1195,1,1,0,1245,42,40,45,1403,10,1199,1,1,0,1138,42,40,74,955,2,351,3,1,0,612,42,40,74,955,2,351,0,1,0,612,42,40,75,952,2,352,3,1,0,611,42,40,75,952,2,352,0,1,0,611,1283,1086,11,1376,5,1108,0,1,0,1215,51,49,38,953,2,353,3,3,0,501,51,49,38,953,2,353,0,3,0,501,51,49,60,957,2,354,3,3,0,641,51,49,60,957,2,354,0,3,0,641,51,49,66,956,2,355,3,1,0,1055,51,49,66,956,2,355,0,1,0,1055,51,49,85,954,2,356,3,1,0,1051,51,49,85,954,2,356,0,1,0,1051,51,49,99,1375,5,1107,0,1,0,1203,51,49,100,821,2,480,3,1,0,1053,51,49,100,821,2,480,0,1,0,1053,51,49,144,820,2,481,3,3,0,685,51,49,144,820,2,481,0,3,0,685,51,49,86,822,2,482,3,3,0,1024,51,49,86,822,2,482,0,3,0,1024,96,95,11,1348,10,1148,1,1,0,1442,96,95,12,1377,10,1172,1,1,1069,1443,96,95,17,866,2,487,3,1,25,1037,96,95,17,866,2,487,0,1,25,1037,96,95,15,867,2,491,3,1,0,702,96,95,15,867,2,491,0,1,0,702,138,98,11,1300,10,1094,16,1,0,1247,138,98,13,1301,5,156,0,1,0,1426,138,98,12,720,2,158,3,1,0,1007,138,98,12,720,2,158,0,1,0,1007,165,159,11,863,2,228,3,1,0,1008,165,159,11,863,2,228,0,1,0,1008,165,159,13,1372,10,1100,1,1,1068,1427,64,63,11,711,2,464,18,1,65,992,64,63,11,711,2,464,16,1,65,992,64,63,13,1291,10,1156,1,1,0,1421,64,63,12,1290,5,1157,0,1,0,1420,64,63,14,719,2,465,3,1,0,993,64,63,14,719,2,465,0,1,0,993,64,63,17,718,2,472,3,1,0,991,64,63,17,718,2,472,0,1,0,991,64,63,15,717,2,473,3,1,0,990,64,63,15,717,2,473,0,1,0,990,29,28,11,831,2,288,3,1,0,1000,29,28,11,831,2,288,0,1,0,1000,29,28,13,739,2,174,3,1,0,1003,29,28,13,739,2,174,0,1,0,1003,29,28,12,829,2,291,142,1,169,1001,29,28,12,829,2,291,109,1,169,1001,29,28,14,740,2,182,3,1,0,1002,29,28,14,740,2,182,0,1,0,1002,29,28,17,1305,10,1081,1,1,0,1422,29,28,15,729,2,183,18,1,0,995,29,28,15,729,2,183,16,1,0,995,29,28,23,730,2,184,18,1,0,996,29,28,23,730,2,184,16,1,0,996,29,28,27,731,2,185,18,1,0,994,29,28,27,731,2,185,16,1,0,994,29,28,34,732,2,186,18,1,0,997,29,28,34,732,2,186,16,1,0,997,29,28,30,733,2,180,3,1,0,999,29,28,30,733,2,180,0,1,0,999,29,28,45,741,2,181,3,1,0,998,29,28,45,741,2,181,0,1,0,998,1033,371,11,859,2,265,3,1,0,1032,1033,371,11,859,2,265,0,1,0,1032,32,31,11,856,2,208,3,1,0,1042,32,31,11,856,2,208,0,1,0,1042,32,31,13,846,2,211,3,1,0,1038,32,31,13,846,2,211,0,1,0,1038,32,31,12,845,2,210,3,1,0,1039,32,31,12,845,2,210,0,1,0,1039,32,31,14,848,2,213,3,1,0,1040,32,31,14,848,2,213,0,1,0,1040,32,31,17,847,2,212,3,1,0,1041,32,31,17,847,2,212,0,1,0,1041,32,31,15,857,2,209,3,1,0,1047,32,31,15,857,2,209,0,1,0,1047,32,31,23,850,2,215,3,1,0,1043,32,31,23,850,2,215,0,1,0,1043,32,31,27,849,2,214,3,1,0,1044,32,31,27,849,2,214,0,1,0,1044,32,31,34,852,2,217,3,1,0,1045,32,31,34,852,2,217,0,1,0,1045,32,31,30,851,2,216,3,1,0,1046,32,31,30,851,2,216,0,1,0,1046,81,78,11,727,2,172,3,1,0,1034,81,78,11,727,2,172,0,1,0,1034,81,78,13,1302,10,1072,0,1,0,1441,81,78,12,742,5,173,3,3,1,1036,81,78,14,742,2,173,0,1,0,1036,81,78,17,826,2,267,3,1,0,1035,81,78,17,826,2,267,0,1,0,1035,22,20,11,1349,10,1142,1,1,0,617,22,20,13,1350,10,1141,1,1,0,692,22,20,12,792,2,372,18,1,25,139,22,20,12,792,2,372,16,1,25,139,22,20,14,815,2,374,3,1,0,140,22,20,14,815,2,374,0,1,0,140,22,20,15,924,2,333,3,1,0,673,22,20,15,924,2,333,0,1,0,673,22,20,23,798,2,373,3,1,0,137,22,20,23,798,2,373,0,1,0,137,22,20,27,1345,5,1143,0,1,0,615,22,20,34,1381,10,1170,1,1,0,617,22,20,30,1382,10,1169,1,1,0,692,22,20,45,868,2,484,18,1,25,139,22,20,45,868,2,484,16,1,25,139,22,20,38,901,2,486,3,1,0,140,22,20,38,901,2,486,0,1,0,140,22,20,60,873,2,485,3,1,0,137,22,20,60,873,2,485,0,1,0,137,22,20,66,1380,5,1171,0,1,0,615,22,20,62,864,2,218,3,1,0,1004,22,20,62,864,2,218,0,1,0,1004,22,20,75,749,5,194,25,1,25,691,22,20,75,749,5,194,0,1,0,691,22,20,101,750,5,204,25,1,25,1030,22,20,101,750,5,204,0,1,0,1030,97,84,17,967,2,363,3,1,0,640,97,84,17,967,2,363,0,1,0,640,97,84,15,965,2,364,3,1,0,1056,97,84,15,965,2,364,0,1,0,1056,97,84,23,745,2,179,3,3,0,614,97,84,23,745,2,179,0,3,0,614,56,54,13,982,2,489,143,1,0,605,56,54,13,982,2,489,25,1,0,605,56,54,12,984,2,494,3,1,0,606,56,54,12,984,2,494,0,1,0,606,56,54,14,1342,5,1198,0,1,0,1240,56,54,17,1344,5,1174,0,1,0,1239,56,54,15,1343,5,1173,0,1,0,1238,56,54,23,1408,5,1177,0,1,0,1242,56,54,27,1388,5,1175,0,1,0,1241,56,54,34,1413,5,1176,0,1,0,1243,56,54,30,983,2,493,3,1,0,607,56,54,30,983,2,493,0,1,0,607,56,54,60,1371,5,1197,0,1,0,1445,1452,1099,11,1416,10,24,0,1,0,1059,1453,1101,11,1417,10,1201,0,1,0,1059,108,83,12,1369,5,1096,0,1,0,1425,108,83,14,1370,5,1097,0,1,0,1423,108,83,17,1368,5,1095,0,1,0,1424,108,83,15,825,2,272,3,1,0,1005,108,83,15,825,2,272,0,1,0,1005,9,8,13,709,2,459,3,1,0,693,9,8,13,709,2,459,0,1,0,693,9,8,14,799,2,376,3,1,0,136,9,8,14,799,2,376,0,1,0,136,9,8,17,1351,5,1144,0,1,0,1254,9,8,15,834,2,276,3,3,0,610,9,8,15,834,2,276,0,3,0,610,9,8,23,708,2,457,3,1,0,136,9,8,23,708,2,457,0,1,0,136,9,8,38,710,2,461,3,1,0,626,9,8,38,710,2,461,0,1,0,626,9,8,60,707,2,460,18,1,25,989,9,8,60,707,2,460,16,1,25,989,9,8,66,1288,5,1155,0,1,0,671,9,8,67,842,2,273,3,3,0,476,9,8,67,842,2,273,0,3,0,476,9,8,62,843,2,274,3,3,0,170,9,8,62,843,2,274,0,3,0,170,9,8,74,841,2,275,3,3,0,1057,9,8,74,841,2,275,0,3,0,1057,9,8,68,1347,5,1146,0,1,0,671,9,8,102,972,2,497,3,1,0,1060,9,8,102,972,2,497,0,1,0,1060,9,8,103,704,2,463,3,1,0,628,9,8,103,704,2,463,0,1,0,628,9,8,88,703,2,462,1061,1,168,627,9,8,88,703,2,462,1064,1,168,627,9,8,89,816,2,379,3,1,0,1006,9,8,89,816,2,379,0,1,0,1006,9,8,104,1346,5,1145,0,1,0,1419,9,8,90,1289,5,1154,0,1,0,1252,9,8,105,813,2,279,3,1,0,478,9,8,105,813,2,279,0,1,0,478,9,8,117,844,2,277,18,1,43,661,9,8,117,844,2,277,16,1,43,661,9,8,147,1361,10,1110,1,1,0,1228,9,8,118,836,2,280,18,1,43,686,9,8,118,836,2,280,16,1,43,686,9,8,119,837,2,281,18,1,43,1025,9,8,119,837,2,281,16,1,43,1025,9,8,120,705,2,456,3,1,0,135,9,8,120,705,2,456,0,1,0,135,9,8,91,706,2,458,3,1,0,629,9,8,91,706,2,458,0,1,0,629,9,8,92,789,2,375,3,1,0,135,9,8,92,789,2,375,0,1,0,135,9,8,93,791,2,377,3,1,0,631,9,8,93,791,2,377,0,1,0,631,9,8,94,790,2,278,3,1,0,477,9,8,94,790,2,278,0,1,0,477,9,8,125,812,2,378,3,1,0,696,9,8,125,812,2,378,0,1,0,696,9,8,126,958,2,492,3,1,0,699,9,8,126,958,2,492,0,1,0,699,9,8,154,1399,5,1084,0,1,0,1274,9,8,155,1400,5,1090,0,1,0,1432,9,8,127,753,2,195,3,1,0,684,9,8,127,753,2,195,0,1,0,684,9,8,128,754,2,205,3,1,0,1023,9,8,128,754,2,205,0,1,0,1023,9,8,129,832,2,282,3,1,0,651,9,8,129,832,2,282,0,1,0,651],"strings":["1","0","TUMB","-1","ELEC_INTERFACE","BTN","3","ENGINE_INTERFACE","12","WEAPON_SYS","LEV","3001","3003","3002","3004","3006","0.1","3005","-0.1","2","36","FUELSYS_INTERFACE","SPU_7","3007","17","0.5","CPT_MECH","3008","38","R_863","3010","52","SIGNAL_FLARES","16","3009","40","ARC_9","AUTOPILOT","3012","37","46","JADRO_1A","LIGHT_SYSTEM","0.3","15","3011","DISS_15","19","57","9","FIRE_EXTING_INTERFACE","NAVLIGHT_SYSTEM","41","ARC_UD","48","IFF","UV_26","0.4","0.2","14","3013","GMK1A","3021","39","R_828","0.9","3014","3020","3026","51","53","EXT_CARGO_EQUIPMENT","HEATER_KO50","0.7","3022","3023","4","45","8","CLOCK","HYDRO_SYS_INTERFACE","SPUU_52","0.64","11","21","3015","3019","3025","3029","3030","3032","3050","3051","3052","3053","47","PKV","SYS_CONTROLLER","18","3016","3017","3024","3027","3028","3031","3041","331","478","VMS","0.05","0.55","3033","3034","3035","3037","3038","3039","3042","3044","3045","3049","3054","3063","3064","3074","3076","3077","3084","3085","3098","6","7","AGB_3K_LEFT","AGB_3K_RIGHT","Collective (LMB press, hold and move) / Throttle (RMB press, hold and move)","Emergency Explode Switch Cover, OPEN/CLOSE","Emergency Explode Switch, ON/OFF","Network 1/2 Switch (N/F)","RADAR_ALTIMETER","Radio Source Selector Switch, R-863/JADRO-1A/R-828/NF/ARC-9/ARC-UD","Radio/ICS Switch","Readjust Free Turbine RPM Switch, MORE/OFF/LESS","-0.05","-0.5","3018","3036","3040","3043","3067","3068","3069","3070","3071","3072","3082","3083","32","34","35","56","HSI_L","Jadro 1A, Frequency Selector, Left mouse - 1kHz/ Right mouse - 100Hz ","Mech clock left lever","PTR-ADDSECPLT-LVR-DIG6","PTR-WATCH-LVR-L","RECORDER_P503B","-0.2","-0.64","0.8325","0.949768","1-2-5-6/AUTO/3-4 Switch","115V Inverter Switch, MANUAL/OFF/AUTO","127","129","132","146","147","148","149","150","153","154","155","163","164","165","166","167","168","169","170","171","172","173","182","185","197","199","202","204","206","208","215","216","225","228","25","26","282","283","284","285","286","287","288","289","290","291","295","296","298","299","300","301","304","3046","3047","3048","305","3055","3056","3057","3058","3059","3060","3061","3062","3065","3066","3073","3075","3078","3079","3080","3081","3086","3087","3088","3089","3090","3091","3092","3093","3094","3095","3096","3097","3099","3100","3101","3102","3103","3104","3105","3106","315","324","332","333","334","335","336","338","342","343","344","345","347","348","349","350","351","352","353","355","356","357","358","369","36V Inverter Switch, MANUAL/OFF/AUTO","36V Transformer Switch, MAIN/OFF/AUXILIARY","370","372","399","400","401","406","409","410","412","422","423","425","426","427","428","429","430","431","432","433","437","438","439","440","444","446","447","450","452","453","454","456","457","465","466","467","469","470","472","476","477","479","480","481","483","484","485","487","488","489","494","495","496","497","499","5.5V Lights Switch, ON/OFF","500","501","502","503","511","512","513","514","515","516","517","518","519","520","521","522","523","525","535","538","539","540","541","542","55","550","551","553","569","570","571","573","575","590","591","592","593","594","595","596","597","598","599","600","601","602","603","604","605","606","607","608","609","61","610","611","612","613","614","615","616","617","618","619","620","621","622","623","624","625","626","627","628","629","630","631","632","633","634","635","636","637","638","639","640","641","642","643","644","645","646","647","648","649","650","651","652","653","656","657","658","659","660","661","662","663","664","675","678","706","707","708","717","719","720","730","731","735","739","741","744","745","746","747","748","756","757","797","798","8/16/4 Switch","800 or 624_622_800 Switch Cover, OPEN/CLOSE","800_or_624_622_800 Switch","826","836","837","838","839","842","843","845","856","858","859","867","903","905","910","913","918","919","921","930","AC Ground Power Switch, ON/OFF","AC Voltmeter Selector","ANO Switch, BRIGHT/OFF/DIM","APU Start Mode Switch, START/COLD CRANKING/FALSE START","ARC-9, Backup 100kHz Rotary Knob","ARC-9, Backup 10kHz Rotary Knob","ARC-9, Dialer Switch, MAIN/BACKUP","ARC-9, Loop Control Switch, LEFT/OFF/RIGHT","ARC-9, Main 100kHz Rotary Knob","ARC-9, Main 10kHz Rotary Knob","ARC-9, Mode Selector Switch, OFF/COMP/ANT/LOOP","ARC-9, TLF/TLG Switch","ARC-UD, Channel Selector Switch, 1/2/3/4/5/6","ARC-UD, Lock Switch, LOCK/UNLOCK","ARC-UD, Mode Switch, OFF/NARROW/WIDE/PULSE/RC","ARC-UD, Sensitivity Switch, MORE/LESS","ARC-UD, Wave Switch, MW/DW","Autopilot Altitude Channel Control (Right Button - UP; Left Button - Down)","Autopilot Altitude OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity","Autopilot Altitude ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity","Autopilot Heading OFF Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity","Autopilot Heading ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity","Autopilot Pitch/Roll ON Button/Lamp Intensity Knob. Rotate mouse wheel to set lamp intensity","Auxiliary Hydraulic Switch Cover, OPEN/CLOSE","Auxiliary Hydraulic Switch, ON/OFF","Baro Pressure QFE Knob","Battery 1 Switch, ON/OFF","Battery 2 Switch, ON/OFF","Battery Heating Switch, ON/OFF","Bypass Switch Cover, OPEN/CLOSE","Bypass Switch, ON/OFF","CB 311, ON/OFF","CB ANO, ON/OFF","CB APU Ignition, ON/OFF","CB APU Start, ON/OFF","CB Autopilot: Electric Clutches, ON/OFF","CB Autopilot: Friction, ON/OFF","CB Autopilot: Main, ON/OFF","CB BW ESBR, ON/OFF","CB Check Lamps/Flasher, ON/OFF","CB Control, ON/OFF_mi8","CB Defrost System: Control, ON/OFF","CB Defrost System: Glass, ON/OFF","CB Defrost System: Left Engine, ON/OFF","CB Defrost System: RIO-3, ON/OFF","CB Defrost System: Right Engine, ON/OFF","CB ESBR Heating, ON/OFF","CB Electric Launch 800 Left, ON/OFF","CB Electric Launch 800 Right, ON/OFF","CB Emergency Jettison: Armed, ON/OFF","CB Emergency Jettison: Bombs and GUV, ON/OFF","CB Emergency Jettison: Power, ON/OFF","CB Engine Ignition, ON/OFF","CB Engine Start, ON/OFF","CB Equipment, ON/OFF","CB Explode, ON/OFF","CB Fire Protection System: 1 Queue Left, ON/OFF","CB Fire Protection System: 1 Queue Right, ON/OFF","CB Fire Protection System: 2 Queue Left, ON/OFF","CB Fire Protection System: 2 Queue Right, ON/OFF","CB Fire Protection System: Signalization, ON/OFF","CB Fuel System: Bypass Valve, ON/OFF","CB Fuel System: Center Tank Pump, ON/OFF","CB Fuel System: Fuelmeter, ON/OFF","CB Fuel System: Left Tank Pump, ON/OFF","CB Fuel System: Left Valve, ON/OFF","CB Fuel System: Right Tank Pump, ON/OFF","CB Fuel System: Right Valve, ON/OFF","CB GUV: Inner Left 622 Left, ON/OFF","CB GUV: Inner Left 622 Right, ON/OFF","CB GUV: Inner Right 622 Left, ON/OFF","CB GUV: Inner Right 622 Right, ON/OFF","CB GUV: Outer 800 Left, ON/OFF","CB GUV: Outer 800 Right, ON/OFF","CB Headlights: Left: Control, ON/OFF","CB Headlights: Left: Light, ON/OFF","CB Headlights: Right: Control, ON/OFF","CB Headlights: Right: Light, ON/OFF","CB Heater KO-50, ON/OFF","CB Hydraulics: Auxiliary, ON/OFF","CB Hydraulics: Main, ON/OFF","CB Lock Opening Control Main, ON/OFF","CB Lock Opening Control Reserve, ON/OFF","CB NONAME, ON/OFF","CB PKT, ON/OFF","CB PRF-4 Light Left, ON/OFF","CB PRF-4 Light Right, ON/OFF","CB RIO-3, ON/OFF","CB RPM CONTROL, ON/OFF","CB RS/GUV Fire, ON/OFF","CB RS/GUV Warning, ON/OFF","CB Radio: 6201, ON/OFF","CB Radio: Altimeter, ON/OFF","CB Radio: Command Radio Station (R-863), ON/OFF","CB Radio: Doppler Navigator, ON/OFF","CB Radio: Radio Compass MW(ARC-9), ON/OFF","CB Radio: Radio Compass VHF(ARC-UD), ON/OFF","CB Radio: Radio Meter, ON/OFF","CB Radio: SPU (Intercom), ON/OFF","CB SPUU-52, ON/OFF","CB Signal Flare, ON/OFF","CB T-819, ON/OFF","CB TURN INDICATOR, ON/OFF","CB Wing Lights, ON/OFF","CB Wiper Left, ON/OFF","CB Wiper Right, ON/OFF","CMD Board Flares Dispensers Switch, LEFT/BOTH/RIGHT","CMD Flares Amount Switch, COUNTER/PROGRAMMING","CMD Power Switch, ON/OFF","CORRECTION_INTERRUPT","CT Check Switch, RIGHT/WORK/LEFT","CUTOFF Switch, ON/OFF","Cargo Cabin Common Lights Switch, ON/OFF","Cargo Cabin Duty Lights Switch, ON/OFF","Check Fire Circuits Switch, OFF/CONTROL/1/2/3/4/5/6","Check Switch, LAMPS/OFF/FLASHER","Circular Call Button (N/F)","Clock Heating Switch, ON/OFF","Common Volume Knob","Crossfeed Switch Cover, OPEN/CLOSE","Crossfeed Switch, ON/OFF","DC Ground Power Switch, ON/OFF","DC Voltmeter Selector","Defrost Mode Switch, AUTO/MANUAL","Defrost System Amperemeter Selector Switch","Doppler Navigator Mode Switch","Doppler Navigator Power Switch, ON/OFF","ESBR Heating Switch, ON/OFF","ESBR Position Selector Switch","ESBR Switch, ON/OFF","Emergency Bomb Release Switch Cover, OPEN/CLOSE","Emergency Cargo Release Button Cover, OPEN/CLOSE","Emergency Release Switch Cover, OPEN/CLOSE","Engine Ignition Check Switch, LEFT/OFF/RIGHT","Engine Selector Switch, LEFT/OFF/RIGHT","Engine Start Mode Switch, START/OFF/COLD CRANKING","Equipment Test Switch, ON/OFF","External Cargo Automatic Dropping, ON/OFF","FM_PROXY","Feed Tank Pump Switch, ON/OFF","Fire Detector Test Switch","Flasher Switch, ON/OFF","Formation Lights Switch, BRIGHT/OFF/DIM","Fuel Meter Switch, OFF/SUM/LEFT/RIGHT/FEED/ADDITIONAL","GMC Control Switch, 0/CONTROL/300","GMC Course Setting Switch, CCW/OFF/CW)","GMC Hemisphere Selection Switch, NORTH/SOUTH","GMC Mode Switch, MC/DG/AC(N/F)","GMC Power Switch, ON/OFF","Generator 1 Switch, ON/OFF","Generator 2 Switch, ON/OFF","Glass Heater Switch, MANUAL/AUTO","Gun Camera Switch, ON/OFF","HSI Course Set Knob","HSI Radio Compass Selector Switch, ARC-9/ARC-UD","IFF Transponder Device Mode Switch, 1/2","IFF Transponder Device Selector Switch, WORK/RESERVE","IFF Transponder Disaster Switch Cover, OPEN/CLOSE","IFF Transponder Disaster Switch, ON/OFF","IFF Transponder Erase Button Cover, OPEN/CLOSE","IFF Transponder Mode Selector Switch, AUTO/KD/+-15/KP","Ice Detector Heater Switch, MANUAL/AUTO","In800Out/800inOr624/622 Switch","Jadro 1A, Frequency Selector, 100kHz","Jadro 1A, Frequency Selector, 10kHz","Jadro 1A, Frequency Selector, 1MHz","Jadro 1A, Mode Switch, OFF/OM/AM","Jadro 1A, Power Switch, ON/OFF","Jadro 1A, Squelch Switch","KO-50 Fan Switch, ON/OFF","KO-50 Heater Mode Switch, MANUAL/OFF/AUTO","KO-50 Heater Regime Switch, FILLING/FULL/MEDIUM","Lamps Check Button - Push to check","Land/Sea Switch","Laryngophone Switch, ON/OFF","Left Attitude Indicator Power Switch, ON/OFF","Left Blister, OPEN/CLOSE","Left Ceiling Light Switch, RED/OFF/WHITE","Left Engine Dust Protection Switch, ON/OFF","Left Engine EEC Switch, ON/OFF","Left Engine ER Switch, ON/OFF","Left Engine FT Check Switch, ST1/WORK/ST2","Left Engine Heater Switch, ON/OFF","Left Engine Stop Lever","Left Fan Switch, ON/OFF","Left Fire RS Button Cover, OPEN/CLOSE","Left Landing Light Switch, LIGHT/OFF/RETRACT","Left PYROCARTRIDGE Switch, I/II/III","Left Pitot Heater Switch, ON/OFF","Left Shutoff Valve Switch Cover, OPEN/CLOSE","Left Shutoff Valve Switch, ON/OFF","Left Tank Pump Switch, ON/OFF","Left Trigger Button, RADIO(LMB)/ICS(RMB)","Listening Volume Knob","Main Bombs Switch, ON/OFF","Main Hydraulic Switch, ON/OFF","Mech clock right lever","Mine Arms Main Switch, ON/OFF","Net on Rectifier Switch Cover, OPEN/CLOSE","Net on Rectifier Switch, ON/OFF","PKT Selector Switch, FLIGHT ENGINEER/PILOT","PKT-TROTTLE_L","PKT-TROTTLE_R","PKV Filter","PTR-ADDESBR-LVR-MODE","PTR-ADDESBR-LVR-ONOFF","PTR-ADDPBV-CVR-EMRGEXP","PTR-ADDPBV-CVR-EMRGJET","PTR-ADDPBV-LVR-MODE","PTR-ADDPBV-TMB-EMRGEXP","PTR-ADDPBV-TMB-MAINOFF","PTR-ADDPBV-TMB-WARM","PTR-ADDSECPLT-LVR-CHNL","PTR-ADDSECPLT-LVR-DIG12","PTR-ADDSECPLT-LVR-DIG3","PTR-ADDSECPLT-LVR-DIG4","PTR-ADDSECPLT-LVR-ONOFF","PTR-ADDSECPLT-LVR-PSH","PTR-ADDSECPLT-TMB-MODSEL","PTR-ADDSECPLT-TMB-P828","PTR-ADDSECPLT-TMB-PSH","PTR-ALTR-TMB-ONOFF","PTR-APP-BTN-ALTOFF","PTR-APP-BTN-ALTON","PTR-APP-BTN-CONTR","PTR-APP-BTN-DIROFF","PTR-APP-BTN-DIRON","PTR-APP-BTN-KTON","PTR-APP-BTN-OFF","PTR-APP-CVR-CIRC","PTR-APP-LVR-SEL1","PTR-APP-LVR-SEL2","PTR-APP-LVR-SEL3","PTR-APP-LVR-SEL4","PTR-APP-TMB-AP","PTR-APP-TMB-CHR-L","PTR-APP-TMB-CHR-R","PTR-APP-TMB-CIRC","PTR-APP-TMB-ERD-L","PTR-APP-TMB-ERD-R","PTR-APP-TMB-NU","PTR-APP-TMB-PS","PTR-APP-TMB-RK","PTR-APP-TMB-RT","PTR-APP-TMB-ST-L","PTR-APP-TMB-ST-R","PTR-APP-TMB-TEST","PTR-APP-TMB-TKLR","PTR-APP-TMB-TRNS","PTR-ARKSV-ARKUKV","PTR-ARMS-L","PTR-ARMS-R","PTR-BLISTER-LOCK-L","PTR-BLISTER-LOCK-R","PTR-COVER-RS-L","PTR-COVER-RS-R","PTR-CPE-CVR-HYDRO-DBL","PTR-CPE-CVR-PUMP-L","PTR-CPE-CVR-PUMP-PASS","PTR-CPE-CVR-PUMP-R","PTR-CPE-CVR-PUMP-RING","PTR-CPE-LVR-CONTR-MODE","PTR-CPE-TMB-CONTR-FIRE","PTR-CPE-TMB-CONTR-PYRO","PTR-CPE-TMB-ENGSTART-LFTRGT","PTR-CPE-TMB-ENGSTART-ROLL","PTR-CPE-TMB-ENGSTART-TEST","PTR-CPE-TMB-HYDRO-DBL","PTR-CPE-TMB-HYDRO-MAIN","PTR-CPE-TMB-PUMP-CONTR","PTR-CPE-TMB-PUMP-L","PTR-CPE-TMB-PUMP-PASS","PTR-CPE-TMB-PUMP-R","PTR-CPE-TMB-PUMP-RATE","PTR-CPE-TMB-PUMP-RING","PTR-CPE-TMB-PUMPTNK-L","PTR-CPE-TMB-PUMPTNK-R","PTR-CPE-TMB-TURBOSTART-ST","PTR-DISS-SELECTOR-KR","PTR-DISS-SELECTOR-SM","PTR-EEP-LVR-MODE","PTR-EEP-TMB-AER","PTR-EEP-TMB-GEN1","PTR-EEP-TMB-GEN2","PTR-EEP-TMB-PO","PTR-EEP-TMB-PT","PTR-ENGSTOP-ARM-L","PTR-ENGSTOP-ARM-R","PTR-FUEL-LVR-MODE","PTR-IND-DISS-SELECTOR","PTR-LAZS-CVR-EMRGEXP","PTR-LAZS-CVR-EMRGEXP01","PTR-LAZS-CVR-EMRGJET","PTR-LAZS-LVR-MODES","PTR-LAZS-TMB-311","PTR-LAZS-TMB-BV-DIR","PTR-LAZS-TMB-BV-EQU","PTR-LAZS-TMB-BV-EXP","PTR-LAZS-TMB-BV-ZSBR","PTR-LAZS-TMB-CIRC","PTR-LAZS-TMB-EMRGEXP","PTR-LAZS-TMB-ES-622R","PTR-LAZS-TMB-ES-800L","PTR-LAZS-TMB-GUOUT-800L","PTR-LAZS-TMB-GUOUT-800R","PTR-LAZS-TMB-GUOUTL-622L","PTR-LAZS-TMB-GUOUTL-622R","PTR-LAZS-TMB-GUOUTR-622L","PTR-LAZS-TMB-GUOUTR-622R","PTR-LAZS-TMB-JETBOMB","PTR-LAZS-TMB-JETEXPL","PTR-LAZS-TMB-JETPWR","PTR-LAZS-TMB-JETRCKT","PTR-LAZS-TMB-MAINOFF","PTR-LAZS-TMB-MAINOFF05","PTR-LAZS-TMB-PKT","PTR-LAZS-TMB-RADSPU","PTR-LAZS-TMB-RSGUV","PTR-LAZS-TMB-RSGUV-FIRE","PTR-LAZS-TMB-RSGUV-SIGN","PTR-LAZS-TMB-RSGUV-WARM","PTR-LEFT-TAXI-L-POS-SW","PTR-LEFT-TAXI-L-SW","PTR-LEFT-TAXI-R-POS-SW","PTR-LES-TMB-AG","PTR-LES-TMB-PLF","PTR-LES-TMB-RK85","PTR-LES-TMB-SPPU52","PTR-LES-TMB-VENT","PTR-LES-TMB-VK53","PTR-LPE-LVR-CHANNEL","PTR-LPE-LVR-FEEDMODE","PTR-LPE-TMB-COMAND","PTR-LPE-TMB-FKP","PTR-LPE-TMB-GLASS","PTR-LPE-TMB-GUV","PTR-LPE-TMB-MANAUT","PTR-LPE-TMB-PYRO-L","PTR-LPE-TMB-PYRO-R","PTR-LPE-TMB-PZU-L","PTR-LPE-TMB-PZU-R","PTR-LPE-TMB-RIO","PTR-LPE-TMB-RS","PTR-LPE-TMB-SHOOT1","PTR-LPE-TMB-SHOOT2","PTR-LPE-TMB-VAR","PTR-LSPE-BTN-RCKT11","PTR-LSPE-BTN-RCKT12","PTR-LSPE-BTN-RCKT13","PTR-LSPE-BTN-RCKT14","PTR-LSPE-BTN-RCKT21","PTR-LSPE-BTN-RCKT22","PTR-LSPE-BTN-RCKT23","PTR-LSPE-BTN-RCKT24","PTR-LSPE-CVR-EMRG-ERASE","PTR-LSPE-CVR-EMRG-MAYDAY","PTR-LSPE-LVR-MODE","PTR-LSPE-TMB-ALRMRKT1","PTR-LSPE-TMB-ALRMRKT2","PTR-LSPE-TMB-BRK-OUT","PTR-LSPE-TMB-CONTR-AUTMAN","PTR-LSPE-TMB-EMRG-MAYDAY","PTR-LSPE-TMB-RADIO-MODE12","PTR-LSPE-TMB-RADIO-WRK","PTR-LSPE-TMB-REC","PTR-LSPE-TMB-RI65-AMP","PTR-NONAME","PTR-PKV-DOUBLE","PTR-PKV-GLASS-FILTER","PTR-RAZS-LVR-MODES002","PTR-RAZS-TMB-ANO","PTR-RAZS-TMB-APELCT","PTR-RAZS-TMB-APFRICT","PTR-RAZS-TMB-APMAIN","PTR-RAZS-TMB-CIRC002","PTR-RAZS-TMB-GSDBL","PTR-RAZS-TMB-GSMAIN","PTR-RAZS-TMB-HLGT-DIR-L","PTR-RAZS-TMB-HLGT-DIR-R","PTR-RAZS-TMB-HLGT-ON-L","PTR-RAZS-TMB-HLGT-ON-R","PTR-RAZS-TMB-KO50","PTR-RAZS-TMB-L1800","PTR-RAZS-TMB-LAMPTEST","PTR-RAZS-TMB-POSDIR","PTR-RAZS-TMB-POSGLS","PTR-RAZS-TMB-POSPZUENG-L","PTR-RAZS-TMB-POSPZUENG-R","PTR-RAZS-TMB-POSRIO3","PTR-RAZS-TMB-PPSQUE1-L","PTR-RAZS-TMB-PPSQUE1-R","PTR-RAZS-TMB-PPSQUE2-L","PTR-RAZS-TMB-PPSQUE2-R","PTR-RAZS-TMB-PPSSIGN","PTR-RAZS-TMB-RADALT","PTR-RAZS-TMB-RADCMP-SV","PTR-RAZS-TMB-RADCMP-UKV","PTR-RAZS-TMB-RADCOMM","PTR-RAZS-TMB-RADDISS","PTR-RAZS-TMB-RADRNTG","PTR-RAZS-TMB-RADRS","PTR-RAZS-TMB-RADSPU","PTR-RAZS-TMB-RADSPU002","PTR-RAZS-TMB-RPM","PTR-RAZS-TMB-SPPU52","PTR-RAZS-TMB-START-ENGIGN","PTR-RAZS-TMB-START-ENGON","PTR-RAZS-TMB-START-TRBIGN","PTR-RAZS-TMB-START-TRBON","PTR-RAZS-TMB-T819","PTR-RAZS-TMB-TSCOCK-L","PTR-RAZS-TMB-TSCOCK-ON","PTR-RAZS-TMB-TSCOCK-R","PTR-RAZS-TMB-TSCOUNT","PTR-RAZS-TMB-TSPMP-C","PTR-RAZS-TMB-TSPMP-L","PTR-RAZS-TMB-TSPMP-R","PTR-RAZS-TMB-TURN","PTR-RAZS-TMB-WIPER-L","PTR-RAZS-TMB-WIPER-R","PTR-RAZS-TMB-WNGLGT","PTR-RES-TMB-AG","PTR-RES-TMB-BLOCK","PTR-RES-TMB-DISS","PTR-RES-TMB-GMK","PTR-RES-TMB-LARING","PTR-RES-TMB-LGT","PTR-RES-TMB-PLF","PTR-RES-TMB-RS","PTR-RES-TMB-VENT","PTR-RPE-LVR-ARKMODE1","PTR-RPE-LVR-ARKMODE2","PTR-RPE-LVR-CRDCONTR","PTR-RPE-LVR-CRDMK","PTR-RPE-LVR-CRDNS","PTR-RPE-LVR-CRDZK","PTR-RPE-LVR-FRQMAIN","PTR-RPE-LVR-FRQMAIN-SEC","PTR-RPE-LVR-FRQMODE","PTR-RPE-LVR-FRQRES","PTR-RPE-LVR-FRQRES-SEC","PTR-RPE-TMB-ARKSENS","PTR-RPE-TMB-ARKUKV","PTR-RPE-TMB-FRQFRAME","PTR-RPE-TMB-FRQTLG","PTR-RPE-TMB-KO50FILL","PTR-RPE-TMB-KO50MODE","PTR-RPE-TMB-KO50VENT","PTR-RPE-TMB-NEARFAR","PTR-RSPE-LVR-FEEDMODE","PTR-RSPE-TMB-AERF","PTR-RSPE-TMB-AKK1","PTR-RSPE-TMB-AKK2","PTR-RSPE-TMB-ALL","PTR-RSPE-TMB-ANO","PTR-RSPE-TMB-BEAC","PTR-RSPE-TMB-DUTY","PTR-RSPE-TMB-LGTCONT","PTR-RSPE-TMB-LGTWING","PTR-RSPE-TMB-PKT","PTR-RSPE-TMB-PZUENG-L","PTR-RSPE-TMB-PZUENG-R","PTR-RSPE-TMB-RECT1","PTR-RSPE-TMB-RECT2","PTR-RSPE-TMB-RECT3","PTR-RSPE-TMB-RESGEN","PTR-RSPE-TMB-TAB","PTR-RSPE-TMB-TESTEQU","PTR-RSPE-TMB-WINK","PTR-RSPE-TMB-WRMAKK","PTR-RSPE-TMB-WRMPVD-L","PTR-RSPE-TMB-WRMPVD-R","PTR-RSPE-TMB-WRMWTCH","PTR-SAFE-WEAPON","PTR-STAT-PRESS","PTR-STKSG-CVR-EMRGJET","PTR-STKSG-CVR-TACTJET","PTR-STKSGR-TMB-RPM-LEFT","PTR-STKSGR-TMB-RPM-RIGHT","PTR-SW-LIGHT-PRF4-LEFT","PTR-SW-LIGHT-PRF4-RIGHT","PTR-SW-LOCKER-BASE","PTR-SW-LOCKER-RES","PTR-UV26-BOARD","PTR-UV26-ONOFF","PTR-UV26-PROG","PTR-VINTBRAKE-ARM","PTR-WATCH-LVR-R","PTR-WHEELBRKFIX-ARM","Parking Brake Handle","Pod Variants Selector Switch","R-828, Compass Switch, COMM/NAV","R-828, Power Switch, ON/OFF","R-828, Radio Channel Selector Knob","R-828, Squelch Switch, ON/OFF","R-863, 100kHz Rotary Knob","R-863, 10MHz Rotary Knob","R-863, 1MHz Rotary Knob","R-863, 1kHz Rotary Knob","R-863, ARC Switch, ON/OFF (N/F)","R-863, Emergency Receiver Switch, ON/OFF (N/F)","R-863, Modulation Switch, FM/AM","R-863, Radio Channel Selector Knob","R-863, Squelch Switch, ON/OFF","R-863, Unit Switch, DIAL/MEMORY","RI-65 Amplifier Switch, ON/OFF","RI-65 Power Switch, ON/OFF","RS/GUV Selector Switch, ON/OFF","Radar Altimeter Power Switch, ON/OFF","Recorder P-503B Power Switch, ON/OFF","Rectifier 1 Switch, ON/OFF","Rectifier 2 Switch, ON/OFF","Rectifier 3 Switch, ON/OFF","Refueling Control Switch, REFUEL/OFF/CHECK","Right Attitude Indicator Power Switch, ON/OFF","Right Blister, OPEN/CLOSE","Right Ceiling Light Switch, RED/OFF/WHITE","Right Engine Dust Protection Switch, ON/OFF","Right Engine EEC Switch, ON/OFF","Right Engine ER Switch, ON/OFF","Right Engine FT Check Switch, ST1/WORK/ST2","Right Engine Heater Switch, MANUAL/AUTO","Right Engine Stop Lever","Right Fan Switch, ON/OFF","Right Fire RS Button Cover, OPEN/CLOSE","Right Landing Light Switch, LIGHT/OFF/RETRACT","Right PYROCARTRIDGE Switch, I/II/III","Right Pitot Heater Switch, ON/OFF","Right Shutoff Valve Switch Cover, OPEN/CLOSE","Right Shutoff Valve Switch, ON/OFF","Right Tank Pump Switch, ON/OFF","Right Trigger Button, RADIO(LMB)/ICS(RMB)","Rotor Brake Handle, UP/DOWN","SARPP-12 Mode Switch, MANUAL/AUTO","SARPP12DM","SPUU-52 Control Engage Button","SPUU-52 Power Switch, ON/OFF","SPUU-52 Test Switch, P/OFF/t)","Sight Double","Signal Flares Cassette 1 Launch Green Button","Signal Flares Cassette 1 Launch Red Button","Signal Flares Cassette 1 Launch White Button","Signal Flares Cassette 1 Launch Yellow Button","Signal Flares Cassette 1 Power Switch, ON/OFF","Signal Flares Cassette 2 Launch Green Button","Signal Flares Cassette 2 Launch Red Button","Signal Flares Cassette 2 Launch White Button","Signal Flares Cassette 2 Launch Yellow Button","Signal Flares Cassette 2 Power Switch, ON/OFF","Squib Test Switch","Standby Generator Switch, ON/OFF","Static Pressure System Mode Selector, LEFT/COMMON/RIGHT","Strobe Light Switch, ON/OFF","Tactical Cargo Release Button Cover, OPEN/CLOSE","Taxi Light Switch, ON/OFF","Test/Work Switch","Tip Lights Switch, ON/OFF","Transparent Switch, DAY/NIGHT","UPK/PKT/RS Switch","VK-53 Power Switch, ON/OFF","Variometer Adjustment Knob","Weapon Safe/Armed Switch, ON/OFF","-0.0555","-0.15","-0.7","0.0555","0.15","0.25","0.728","0.8","0.807","10","102","128","134","135","136","138","140","142","144","145","156","183","184","186","198","20","200","226","227","229","27","280","281","29","292","293","294","297","30","308","31","310","311","312","313","314","322","323","339","346","354","359","389","390","391","392","393","394","395","396","397","411","413","415","419","421","448","449","451","455","464","468","474","482","491","492","498","5.5V Lights Brightness Rheostat","536","537","548","549","552","572","574","576","58","589","59","60","672","673","674","709","718","737","738","742","743","749","803","804","809","810","815","816","818","819","840","841","846","855","862","863","864","865","866","868","869","870","871","872","881","882","883","884","885","886","887","888","889","89","890","894","895","90","911","914","924","925","96","97","ANO Code Button","APU Start Button - Push to start APU","APU Stop Button - Push to stop APU","ARC-9, Backup Frequency Tune Knob","ARC-9, Main Frequency Tune Knob","ARC-9, Volume Knob","ARC-UD, Control Button","ARC-UD, Left Antenna Button","ARC-UD, Right Antenna Button","ARC-UD, Volume Knob","Abort Start Engine Button - Push to abort start","Accelerometer Reset Button - Push to reset","Alarm Bell Button - Push to turn on","Alternate Discharge APU GEAR Button","Alternate Discharge KO-50 Button","Alternate Discharge Left Engine Button","Alternate Discharge Right Engine Button","Autopilot Heading Adjustment Knob","Autopilot Off Left Button","Autopilot Off Right Button","Autopilot Pitch Adjustment Knob","Autopilot Roll Adjustment Knob","Auxiliary Hydraulic Shut Off Button - Push to shut off","BAR_ALTIMETER_L","BAR_ALTIMETER_R","Burst Length Knob","CB Group 1 ON","CB Group 2 ON","CB Group 3 ON","CB Group 4 ON","CB Group 5 ON","CB Group 6 ON","CB Group 7 ON","CB Group 8 ON","CB Group 9 ON","CMD Dispense Interval Button","CMD Num in Sequence Button","CMD Num of Sequences Button","CMD Reset to Default Program Button","CMD Start Dispense Button","CMD Stop Dispense Button","Central Red Lights Brightness Group 1 Rheostat","Central Red Lights Brightness Group 2 Rheostat","Cold Temperature Sensor Test Button - Push to test","Dangerous RALT Knob","Decrease Deviation KM Button","Decrease Map Angle Button","Decrease Path KM Button","Defrost OFF Button - Push to turn off","Emergency Bomb Release Switch, ON/OFF","Emergency Cargo Release Button - Push to release","Emergency Release Switch","Engine Start Button - Push to start engine","GMC Latitude Selection Knob","Generator 1 Voltage Adjustment Rheostat","Generator 2 Voltage Adjustment Rheostat","HSI_R","Hot Temperature Sensor Test Button - Push to test","IFF Transponder Erase Button - Push to erase","Ice Detector Heater Test Button - Push to test","Increase Deviation KM Button","Increase Map Angle Button","Increase Path KM Button","Jadro 1A, Control Button","Jadro 1A, Volume Knob","KO-50 Heater Start Button - Push to start","KO-50 Target Temperature Knob","Left Attitude Indicator Cage Knob - Push to cage","Left Attitude Indicator Zero Pitch Knob","Left Engine Temperature Regulator Test Button - Push to test","Left Engine Throttle","Left Fire RS Button","Left Pitot Heater Test Button - Push to test","Left Red Lights Brightness Group 1 Rheostat","Left Red Lights Brightness Group 2 Rheostat","Left Windscreen Wiper Control Switch, OFF","Left Windscreen Wiper Control Switch, RESET","Left Windscreen Wiper Control Switch, SPEED 1","Left Windscreen Wiper Control Switch, SPEED 2","Left Windscreen Wiper Control Switch, START","MISC_SYSTEMS_INTERFACE","Main Discharge APU GEAR Button","Main Discharge KO-50 Button","Main Discharge Left Engine Button","Main Discharge Right Engine Button","PTR-ADDPBV-BTN-LAMPTEST","PTR-ADDPBV-TMB-EMRGJET","PTR-ADDSECPLT-BTN-ASU","PTR-ADDSECPLT-LVR-VOL","PTR-ADDSECPLT-LVR-VOLUM","PTR-ADDSECPLT-TMB-CONTR","PTR-AGB-LVR-KNOB","PTR-AGB-LVR-KNOB-R","PTR-AGB-LVR-SET","PTR-AGB-LVR-SET-R","PTR-ALTB-LVR-SET","PTR-ALTB-LVR-SET-R","PTR-ALTR-LVR-SET","PTR-ALTR-LVR-TEST","PTR-APP-LVR-ADJ","PTR-APP-LVR-DIR","PTR-APP-LVR-K","PTR-APP-LVR-LEVEL","PTR-APP-LVR-T","PTR-AUTOPILOT-OFF-L","PTR-AUTOPILOT-OFF-R","PTR-CPE-BTN-DBLOFF","PTR-CPE-BTN-ENGSTART-OFF","PTR-CPE-BTN-ENGSTART-ON","PTR-CPE-BTN-FIRE-OFF","PTR-CPE-BTN-QUE1-1","PTR-CPE-BTN-QUE1-2","PTR-CPE-BTN-QUE1-3","PTR-CPE-BTN-QUE1-4","PTR-CPE-BTN-QUE2-1","PTR-CPE-BTN-QUE2-2","PTR-CPE-BTN-QUE2-3","PTR-CPE-BTN-QUE2-4","PTR-CPE-BTN-TURBOSTART-OFF","PTR-CPE-BTN-TURBOSTART-ON","PTR-DISS-BTN-MINUS","PTR-DISS-BTN-N","PTR-DISS-BTN-OFF","PTR-DISS-BTN-ON","PTR-DISS-BTN-PLUS","PTR-DISS-BTN-TOLE","PTR-DISS-BTN-TORI","PTR-DISS-BTN-V","PTR-EEP-LVR-ADJV1","PTR-EEP-LVR-ADJV2","PTR-GRAZS-1","PTR-GRAZS-2","PTR-GRAZS-3","PTR-GRAZS-4","PTR-GRAZS-5","PTR-GRAZS-6","PTR-GRAZS-7","PTR-GRAZS-8","PTR-GRAZS-9","PTR-L45-BTN","PTR-L68-BTN","PTR-L8-BTN","PTR-LAZS-BTN-CB","PTR-LAZS-BTN-ENTER","PTR-LAZS-BTN-LAMPTEST","PTR-LAZS-LVR-AIMLGT","PTR-LAZS-LVR-ALL","PTR-LAZS-LVR-AUDIT","PTR-LAZS-TMB-EMRGJET","PTR-LES-BTN-CONTRPVD","PTR-LES-BTN-CONTRPVD01","PTR-LES-TMB-GLSCLN-HISPEED","PTR-LES-TMB-GLSCLN-LOWSPEED","PTR-LES-TMB-GLSCLN-OFF","PTR-LES-TMB-GLSCLN-RESET","PTR-LES-TMB-GLSCLN-START","PTR-LPE-BTN-OVR","PTR-LPE-BTN-RIOCONTR","PTR-LPE-LVR-SHELL","PTR-LSPE-BTN-CONTR-AIR","PTR-LSPE-BTN-CONTR-GRND","PTR-LSPE-BTN-CONTR-IV500","PTR-LSPE-BTN-CONTR-RTL","PTR-LSPE-BTN-CONTR-RTR","PTR-LSPE-BTN-EMRG-ERASE","PTR-LSPE-BTN-RI65-OFF","PTR-LSPE-BTN-RI65-RETRY","PTR-LSPE-BTN-RI65-TEST","PTR-LSPE-BTN-UV26-START","PTR-LSPE-LVR-LGTSEL","PTR-LSPE-LVR-REDGRP1","PTR-LSPE-LVR-REDGRP2","PTR-LSPE-TMB-AIR-CODE","PTR-LSPE-TMB-AIR-SIREN","PTR-PKV-ROTARY","PTR-PNP-LVR-SET","PTR-PNP-LVR-SET-R","PTR-RAZS-BTN-CB002","PTR-RAZS-LVR-ALL002","PTR-RAZS-LVR-AUDIT002","PTR-RES-TMB-GLSCLN-HISPEED","PTR-RES-TMB-GLSCLN-LOWSPEED","PTR-RES-TMB-GLSCLN-OFF","PTR-RES-TMB-GLSCLN-RESET","PTR-RES-TMB-GLSCLN-START","PTR-RESET-PROG-BTN","PTR-RPE-BTN-ANTL","PTR-RPE-BTN-ANTR","PTR-RPE-BTN-CONTR","PTR-RPE-BTN-KO50START","PTR-RPE-LVR-ARKVOL","PTR-RPE-LVR-CRDLAT","PTR-RPE-LVR-FRQADJMAIN","PTR-RPE-LVR-FRQADJRES","PTR-RPE-LVR-FRQVOLUME","PTR-RPE-LVR-KO50TMP","PTR-RS-L","PTR-RS-R","PTR-RSPE-LVR-REDGRP003","PTR-RSPE-LVR-REDGRP004","PTR-RSPE-LVR-REDGRP005","PTR-RSPE-LVR-REDGRP1","PTR-RSPE-LVR-REDGRP2","PTR-RSPE-LVR-V","PTR-RSPE-TMB-WINK002","PTR-START-BTN","PTR-STKSEC-ARM-L","PTR-STKSEC-ARM-R","PTR-STKSG-BTN-EMRGJET","PTR-STKSG-BTN-TACTJET","PTR-STOP-BTN","PTR-TRIMMER-ON-L","PTR-TRIMMER-ON-R","PTR-VARIO-LVR-SET-L","PTR-VARIO-LVR-SET-R","PTR-WHEELBRK-ARM","PUS Arming Button - Push to arm","R-828, Radio Tuner Button","R-828, Volume Knob","R-863, Volume Knob","RI-65 Check Button","RI-65 OFF Button","RI-65 Repeat Button","Radio Altimeter Test Button - Push to test","Recorder P-503B Backlight Brightness Knob","Right Attitude Indicator Cage Knob - Push to cage","Right Attitude Indicator Zero Pitch Knob","Right Engine Temperature Regulator Test Button - Push to test","Right Engine Throttle","Right Fire RS Button","Right Pitot Heater Test Button - Push to test","Right Red Lights Brightness Group 1 Rheostat","Right Red Lights Brightness Group 2 Rheostat","Right Windscreen Wiper Control Switch, OFF","Right Windscreen Wiper Control Switch, RESET","Right Windscreen Wiper Control Switch, SPEED 1","Right Windscreen Wiper Control Switch, SPEED 2","Right Windscreen Wiper Control Switch, START","SPUU-52 Adjustment Knob","Sight Brightness Knob","Sight Limb Knob","Standby Generator Voltage Adjustment Rheostat","Start/Stop Dispense Button","Tactical Cargo Release Button - Push to release","Trimmer Left Button","Trimmer Right Button","Turn Off Coordinates Calculator Button","Turn Off Fire Signal Button","Turn On Coordinates Calculator Button","VARIOMETER_L","VARIOMETER_R","Vibration Sensor Test Button - Push to test","Wheel Brakes Handle"]});
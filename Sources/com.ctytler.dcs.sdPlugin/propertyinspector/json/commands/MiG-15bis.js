@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"MiG-15bis","rows":[61,50,9,213,2,19,3,1,0,149,61,50,9,213,2,19,0,1,0,149,61,50,10,369,6,28,1,1,0,321,150,141,8,397,6,294,1,1,0,336,150,141,9,375,6,316,1,1,0,367,12,11,8,391,6,288,39,32,46,322,12,11,9,264,2,113,3,1,0,159,12,11,9,264,2,113,0,1,0,159,12,11,10,265,2,114,66,1,44,153,12,11,10,265,2,114,32,1,44,153,12,11,13,266,2,115,66,1,68,152,12,11,13,266,2,115,32,1,68,152,12,11,15,390,6,38,44,1,0,325,12,11,21,267,7,116,3,3,1,154,12,11,21,267,7,116,0,1,0,154,12,11,34,392,6,289,39,32,46,323,12,11,30,393,7,290,0,1,0,324,12,11,29,234,2,83,3,1,0,158,12,11,29,234,2,83,0,1,0,158,12,11,35,244,2,93,3,1,0,155,12,11,35,244,2,93,0,1,0,155,12,11,36,245,2,94,3,1,0,156,12,11,36,245,2,94,0,1,0,156,12,11,37,246,2,95,3,1,0,157,12,11,37,246,2,95,0,1,0,157,26,23,8,381,6,280,1,1,0,328,26,23,9,402,6,300,1,1,0,327,26,23,10,223,2,72,3,1,0,162,26,23,10,223,2,72,0,1,0,162,26,23,13,380,6,279,1,1,0,326,26,23,36,226,2,75,1,1,56,161,26,23,36,226,2,75,56,1,56,161,26,23,37,225,2,74,1,1,0,160,26,23,37,225,2,74,0,1,0,160,334,295,8,370,6,14,0,1,0,335,42,41,8,65,7,123,0,1,0,60,42,41,9,65,7,123,3,3,1,60,42,41,10,65,6,308,0,1,0,60,42,41,13,214,7,50,0,1,0,147,42,41,15,214,6,23,277,276,278,147,22,20,8,243,7,92,3,3,1,165,22,20,8,243,7,92,0,1,0,165,22,20,9,228,7,77,3,3,1,171,22,20,9,228,7,77,0,1,0,171,22,20,10,270,2,119,67,3,45,212,22,20,10,270,2,119,45,3,45,212,22,20,13,400,7,298,0,1,0,332,22,20,15,235,2,84,3,1,0,167,22,20,15,235,2,84,0,1,0,167,22,20,21,269,2,118,1,1,0,183,22,20,21,269,2,118,0,1,0,183,43,40,10,409,2,38,54,3,0,349,43,40,13,408,2,38,54,3,0,364,43,40,15,410,2,38,54,3,0,329,43,40,21,272,2,122,1,1,0,172,43,40,21,272,2,122,0,1,0,172,5,4,8,249,2,98,3,1,0,164,5,4,8,249,2,98,0,1,0,164,5,4,9,250,2,99,3,1,0,181,5,4,9,250,2,99,0,1,0,181,5,4,10,401,7,299,0,1,0,344,5,4,13,271,2,121,3,1,0,178,5,4,13,271,2,121,0,1,0,178,5,4,15,247,2,96,3,1,0,166,5,4,15,247,2,96,0,1,0,166,5,4,21,252,2,101,3,1,0,148,5,4,21,252,2,101,0,1,0,148,5,4,34,374,7,315,0,1,0,333,5,4,30,258,2,107,3,1,0,190,5,4,30,258,2,107,0,1,0,190,5,4,29,259,2,108,3,1,0,189,5,4,29,259,2,108,0,1,0,189,5,4,35,254,2,103,3,1,0,168,5,4,35,254,2,103,0,1,0,168,5,4,36,219,2,143,3,1,0,195,5,4,36,219,2,143,0,1,0,195,5,4,37,251,2,100,3,1,0,211,5,4,37,251,2,100,0,1,0,211,5,4,127,248,2,97,3,1,0,191,5,4,127,248,2,97,0,1,0,191,5,4,128,255,2,104,3,1,0,202,5,4,128,255,2,104,0,1,0,202,5,4,129,256,2,105,3,1,0,151,5,4,129,256,2,105,0,1,0,151,5,4,130,257,2,106,3,1,0,201,5,4,130,257,2,106,0,1,0,201,5,4,131,231,2,80,3,1,0,210,5,4,131,231,2,80,0,1,0,210,5,4,132,229,2,78,3,1,0,169,5,4,132,229,2,78,0,1,0,169,5,4,133,233,2,82,3,1,0,184,5,4,133,233,2,82,0,1,0,184,5,4,134,260,2,109,3,1,0,163,5,4,134,260,2,109,0,1,0,163,5,4,135,253,2,102,3,1,0,173,5,4,135,253,2,102,0,1,0,173,5,4,136,230,2,79,3,1,0,185,5,4,136,230,2,79,0,1,0,185,5,4,137,261,2,110,3,1,0,203,5,4,137,261,2,110,0,1,0,203,62,57,8,404,6,302,3,1,0,345,62,57,9,232,2,81,3,1,0,186,62,57,9,232,2,81,0,1,0,186,51,49,8,385,7,283,0,1,0,343,51,49,9,241,2,90,3,1,0,177,51,49,9,241,2,90,0,1,0,177,51,49,10,384,7,282,0,1,0,342,180,71,8,220,2,144,3,1,0,170,180,71,8,220,2,144,0,1,0,170,31,28,8,217,2,140,67,1,0,188,31,28,8,217,2,140,45,1,0,188,31,28,9,221,2,145,3,1,0,187,31,28,9,221,2,145,0,1,0,187,31,28,10,373,7,314,0,1,0,347,31,28,13,405,7,303,0,1,0,350,31,28,15,406,7,304,0,1,0,365,27,19,8,389,6,287,0,1,0,338,27,19,9,388,6,286,0,1,0,339,27,19,10,263,2,112,3,1,0,174,27,19,10,263,2,112,0,1,0,174,27,19,13,262,2,111,3,1,0,175,27,19,13,262,2,111,0,1,0,175,27,19,15,396,6,293,0,1,0,341,27,19,21,414,6,310,0,1,0,331,27,19,34,413,6,309,0,1,0,337,63,58,8,394,6,291,1,69,70,351,63,58,9,395,6,292,1,69,70,366,63,58,10,407,6,305,1,32,46,359,52,47,8,227,2,76,3,1,0,179,52,47,8,227,2,76,0,1,0,179,52,47,9,218,2,142,3,1,0,192,52,47,9,218,2,142,0,1,0,192,64,59,8,386,6,284,1,1,0,358,64,59,9,415,6,311,1,1,0,357,64,59,10,387,6,285,1,1,0,330,53,48,10,216,2,139,1,1,55,193,53,48,10,216,2,139,55,1,55,193,53,48,13,215,2,138,3,1,0,194,53,48,13,215,2,138,0,1,0,194,196,120,8,371,6,312,0,1,0,348,196,120,10,372,7,313,0,1,0,346,16,14,8,382,6,281,39,32,46,361,16,14,9,403,7,301,0,1,0,352,16,14,10,383,6,38,44,1,0,362,16,14,13,412,6,307,39,1,0,363,16,14,15,274,2,125,1,1,33,200,16,14,15,274,2,125,33,1,33,200,16,14,21,411,6,306,39,1,0,360,16,14,34,273,2,124,1,1,33,197,16,14,34,273,2,124,33,1,33,197,16,14,30,242,2,91,3,1,0,199,16,14,30,242,2,91,0,1,0,199,16,14,29,275,2,126,3,1,0,198,16,14,29,275,2,126,0,1,0,198,25,24,8,236,2,85,3,1,0,206,25,24,8,236,2,85,0,1,0,206,25,24,9,238,2,87,3,1,0,204,25,24,9,238,2,87,0,1,0,204,25,24,10,239,2,88,3,1,0,205,25,24,10,239,2,88,0,1,0,205,25,24,13,240,2,89,3,1,0,207,25,24,13,240,2,89,0,1,0,207,25,24,15,237,2,86,3,1,0,208,25,24,15,237,2,86,0,1,0,208,18,17,8,398,7,296,0,1,0,353,18,17,10,399,7,297,0,1,0,368,18,17,13,379,7,320,0,1,0,340,18,17,15,378,7,319,0,1,0,354,18,17,21,376,7,317,0,1,0,356,18,17,34,377,7,318,0,1,0,355,18,17,30,222,2,146,3,1,0,209,18,17,30,222,2,146,0,1,0,209,18,17,29,224,2,73,3,1,0,176,18,17,29,224,2,73,0,1,0,176,18,17,35,268,2,117,3,1,0,182,18,17,35,268,2,117,0,1,0,182],"strings":["1","0","TUMB","-1","2","ELEC_INTERFACE","LEV","BTN","3001","3002","3003","29","ARC_5","3004","30","3005","RSI_6K","4","WEAPON_SYSTEM","12","3","3006","CONTROL_INTERFACE","26","28","SIGNAL_FLARE_DISPENSER","ASP_3N","HYDROSYS_INTERFACE","13","3009","3008","GEAR_INTERFACE","0.1","0.75","3007","3010","3011","3012","","0.8","15","7","CLOCK","CPT_MECH","0.3","0.5","0.9","14","16","17","25","FIRE_EXTING_INTERFACE","NAVLIGHT_SYSTEM","RADAR_ALTIMETER","-2","0.25","0.95","11","22","9","AChS-1 Cockpit Chronograph Left Knob","AGK47B","ENGINE_INTERFACE","LIGHT_SYSTEM","OXYGEN_INTERFACE","pnt_023","-0.1","-0.5","0.2","0.23","0.82","10","101","104","105","106","111","114","115","116","117","118","120","123","125","129","130","131","132","133","136","140","142","146","147","148","149","151","152","153","154","155","156","157","158","159","160","161","162","163","164","166","170","173","174","177","178","196","203","207","21","214","221","23","231","233","240","3013","3014","3015","3016","3017","3018","3019","3020","3021","3022","3023","36","37","71","8","80","81","82","85","96","AChS-1 Cockpit Chronograph Right Knob","AGK-47B Artificial Horizon + DGMK-3 Switch, ON/OFF","AGK-47B Artificial Horizon Cage - Pull to cage","AIR_INTERFACE","ARC Switch, ON/OFF","ARK-5 Frequency Band Switch","ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP","ARK-5 LOOP L-R Switch","ARK-5 NDB 1 Switch, ON/OFF","ARK-5 NDB 2 Switch, ON/OFF","ARK-5 NDB 3 Switch, ON/OFF","ARK-5 Near/Far NDB Switch, NEAR/FAR","ARK-5 TLG-TLF Switch, TLG/TLF","ASP-3N Gunsight Color Filter, ON/OFF","ASP-3N Gunsight Fixed Reticle Mask Lever, SET UP/REMOVE","ASP-3N Gunsight Mode, GYRO/FIXED","ASP-3N Gunsight Switch, ON/OFF","Accumulator Switch, ON/OFF","Aileron Trimmer Switch, LEFT/OFF/RIGHT","Air Start Switch, ON/OFF","Airbrake Switch, CLOSE/OPEN","Bombs Switch, ON/OFF","Booster Pump Switch, ON/OFF","Drop Tank Signal Switch, ON/OFF","Elevator Trimmer Switch, PULL(CLIMB)/OFF/PUSH(DESCEND)","Emergency Canopy Jettison - Pull to jettison","Emergency Drop Switch, ON/OFF","Emergency Flaps Valve Cover, OPEN/CLOSE","Emergency Gears Valve Cover, OPEN/CLOSE","Emergency Release Button Cover, OPEN/CLOSE","Engine Fire Extinguisher Button Cover, OPEN/CLOSE","Engine Start Button Cover, Cover/Uncover","External Lights Switch, ON/OFF","FUELSYS_INTERFACE","Generator Switch, ON/OFF","Guns Safety Cover, OPEN/CLOSE","Hydro Booster Lever, ON/OFF","Ignition Switch, ON/OFF","Instruments and Lights Switch, ON/OFF","Isolating Valve Switch, ON/OFF","Landing Gear Handle Lock, Lock/Unlock","Landing Gear Handle, UP/DOWN","N-37D Cannon Switch, ON/OFF","NR-23 Cannon Switch, ON/OFF","Nose Light Master Switch, ON/OFF","Nose Light Switch, ON/OFF","PRV-46 Radar Altimeter Indicator Power Switch, ON/OFF","PRV-46 Radar Altimeter Indicator Range Switch, 120m/1200m AGL","Pitot and Clock Heater Switch, ON/OFF","REMOTE_COMPASS","RSI-6K Antenna Control Handle Lock/Unlock","RSI-6K Forced Mode Switch, ON/OFF","RSI-6K Receive/ARC Switch, RECEIVE/ARC","RSI-6K Wave Control Handle Lock/Unlock","RV-2 Radio Altimeter Switch, ON/OFF","Radio Switch, ON/OFF","S-13 Gun Camera Switch, ON/OFF","Signal Flare Green Button - Push to launch","Signal Flare Red Button - Push to launch","Signal Flare Switch, ON/OFF","Signal Flare White Button - Push to launch","Signal Flare Yellow Button - Push to launch","Tactical Release Switch, ON/OFF","Transfer Pump Switch, ON/OFF","Trim Master Switch, ON/OFF","Wing Flaps Handle, RETRACT/NEUTRAL/20 degrees/55 degrees","pnt_012","pnt_025","pnt_036","pnt_037","pnt_071","pnt_080","pnt_081","pnt_082","pnt_085","pnt_096","pnt_101","pnt_104","pnt_105","pnt_106","pnt_111","pnt_114","pnt_115","pnt_116","pnt_117","pnt_118","pnt_120","pnt_123","pnt_125","pnt_129","pnt_130","pnt_131","pnt_132","pnt_133","pnt_136","pnt_140","pnt_142","pnt_146","pnt_147","pnt_148","pnt_149","pnt_151","pnt_152","pnt_153","pnt_154","pnt_155","pnt_156","pnt_157","pnt_158","pnt_159","pnt_160","pnt_161","pnt_162","pnt_163","pnt_164","pnt_166","pnt_170","pnt_173","pnt_174","pnt_177","pnt_178","pnt_196","pnt_203","pnt_207","pnt_214","pnt_221","pnt_231","pnt_233","pnt_240","-0.15","0.05","0.15","102","103","126","137","138","141","143","167","171","180","181","182","184","185","186","187","19","193","195","198","200","201","202","208","209","210","220","230","232","24","241","242","243","34","61","72","84","86","90","91","92","97","AGK-47B Artificial Horizon Zero Pitch Trim Knob","ARK-5 Audio Volume Knob","ARK-5 Scale Light Knob","ARK-5 Take Control Button - Push to take control","ARK-5 Tuning Crank","ASP-3N Gunsight Brightness Knob","ASP-3N Gunsight Target Distance Knob","ASP-3N Gunsight Target Wingspan Adjustment Dial (meters)","Aft Canopy Lever, CLOSE","Air Diluter Valve","Air Net Valve","Airbrake Button, Hold to extend","Ampere- & Voltmeter - Push to view Volts","BAR_ALTIMETER","Barometric Pressure QFE Knob","Cockpit Air Valve","Cockpit Filling Valve","Emergency Flaps Valve","Emergency Gears Valve","Emergency Release Button - Push to release","Emergency System Filling Valve","Engine Fire Extinguisher Button - Push to extinguish","Engine Fire Warning Light Test Button - Push to test","Engine Start Button - Push to start","Engine Stop Lever, CLOSE/OPEN","Fast Slave Button","Gear Lamps Test Button - Push to test","Heading Knob","Left Canopy Lever, OPEN","Left Emergency Gear Release Handle - Pull to release","Left UV Light Rheostat","Microphone Button - Push to talk","N-37D Cannon Fire Button - Push to fire","N-37D Cannon Reload Button - Press and hold to reload","NR-23 (Bottom) Cannon Reload Button - Press and hold to reload","NR-23 (Top) Cannon Reload Button - Press and hold to reload","Oxygen Emergency Valve","Oxygen Supply Valve","Panels Light Rheostat","RSI-6K Antenna Control Handle","RSI-6K Audio Volume Knob","RSI-6K Receiver Tuning Knob","RSI-6K Wave Control Handle","Right Canopy Lever, OPEN","Right Emergency Gear Release Handle - Pull to release","Right UV Light Rheostat","Ventilation Valve","Weapon Release Button - Push to release","pnt_013","pnt_030","pnt_034","pnt_061","pnt_072","pnt_084","pnt_086","pnt_090","pnt_091","pnt_092","pnt_097","pnt_102","pnt_103","pnt_126","pnt_128","pnt_137","pnt_138","pnt_141","pnt_143","pnt_167","pnt_171","pnt_175","pnt_180","pnt_181","pnt_182","pnt_184","pnt_185","pnt_186","pnt_187","pnt_193","pnt_195","pnt_198","pnt_200","pnt_201","pnt_202","pnt_208","pnt_209","pnt_210","pnt_220","pnt_222","pnt_223","pnt_224","pnt_230","pnt_232","pnt_241","pnt_242","pnt_243"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"MiG-19P","rows":[21,20,529,641,2,491,0,1,0,635,21,20,215,420,2,229,34,1,0,268,21,20,215,420,2,229,36,1,0,268,21,20,226,430,2,247,3,1,0,270,21,20,226,430,2,247,0,1,0,270,21,20,227,431,2,248,34,1,0,265,21,20,227,431,2,248,36,1,0,265,21,20,228,432,2,249,33,1,28,266,21,20,228,432,2,249,35,1,28,266,21,20,230,433,10,251,3,1,0,267,21,20,230,433,10,251,0,3,1,267,21,20,570,680,13,587,1,1,0,608,21,20,571,681,13,589,1,1,0,606,21,20,572,682,13,590,1,1,0,607,12,11,176,386,2,94,3,1,0,300,12,11,176,386,2,94,0,1,0,300,12,11,181,390,2,98,3,1,0,289,12,11,181,390,2,98,0,1,0,289,12,11,540,651,10,501,0,1,0,619,12,11,541,652,10,502,0,1,0,616,12,11,542,653,10,503,0,1,0,617,12,11,543,654,10,504,0,1,0,618,12,11,199,406,2,114,1,1,0,312,12,11,199,406,2,114,0,1,0,312,12,11,545,656,10,506,0,1,0,627,12,11,546,657,10,507,0,1,0,633,12,11,547,658,10,508,0,1,0,709,12,11,200,407,2,115,1,1,0,468,12,11,200,407,2,115,0,1,0,468,12,11,548,659,10,509,0,1,0,710,12,11,216,421,2,232,3,3,0,470,12,11,216,421,2,232,0,3,0,470,12,11,217,422,2,235,3,1,0,469,12,11,217,422,2,235,0,1,0,469,12,11,223,427,2,244,33,1,28,272,12,11,223,427,2,244,35,1,28,272,12,11,225,429,2,246,3,1,0,286,12,11,225,429,2,246,0,1,0,286,12,11,581,689,13,599,1,1,0,632,12,11,582,690,13,600,1,1,0,708,7,6,158,369,2,77,3,1,0,479,7,6,158,369,2,77,0,1,0,479,7,6,159,370,2,78,3,1,0,480,7,6,159,370,2,78,0,1,0,480,7,6,160,371,2,79,3,1,0,481,7,6,160,371,2,79,0,1,0,481,7,6,161,372,2,80,3,1,0,482,7,6,161,372,2,80,0,1,0,482,7,6,164,375,2,83,3,1,0,308,7,6,164,375,2,83,0,1,0,308,7,6,165,376,2,84,3,1,0,310,7,6,165,376,2,84,0,1,0,310,7,6,167,377,2,85,3,1,0,462,7,6,167,377,2,85,0,1,0,462,7,6,168,378,2,86,3,1,0,322,7,6,168,378,2,86,0,1,0,322,7,6,169,379,2,87,3,1,0,458,7,6,169,379,2,87,0,1,0,458,7,6,170,380,2,88,3,1,0,318,7,6,170,380,2,88,0,1,0,318,7,6,187,396,2,104,1,1,0,323,7,6,187,396,2,104,0,1,0,323,7,6,188,397,2,105,1,1,0,463,7,6,188,397,2,105,0,1,0,463,7,6,531,642,10,492,0,1,0,631,7,6,532,643,10,493,0,1,0,707,7,6,190,399,2,107,1,1,0,320,7,6,190,399,2,107,0,1,0,320,7,6,191,400,2,108,1,1,0,460,7,6,191,400,2,108,0,1,0,460,7,6,535,646,10,496,0,1,0,626,7,6,536,647,10,497,0,1,0,620,7,6,193,401,2,109,1,1,0,321,7,6,193,401,2,109,0,1,0,321,7,6,194,402,2,110,1,1,0,461,7,6,194,402,2,110,0,1,0,461,7,6,195,403,2,111,1,1,0,309,7,6,195,403,2,111,0,1,0,309,7,6,537,648,10,498,0,1,0,621,7,6,538,649,10,499,0,1,0,630,7,6,539,650,10,500,0,1,0,706,7,6,557,668,10,518,0,1,0,634,7,6,558,669,10,519,0,1,0,614,7,6,210,415,2,192,3,1,0,319,7,6,210,415,2,192,0,1,0,319,7,6,211,416,2,196,3,1,0,459,7,6,211,416,2,196,0,1,0,459,18,17,143,354,2,62,3,1,0,299,18,17,143,354,2,62,0,1,0,299,18,17,144,355,2,63,3,1,6,297,18,17,144,355,2,63,0,1,6,297,18,17,157,368,2,76,3,3,0,298,18,17,157,368,2,76,0,3,0,298,18,17,162,373,2,81,3,1,0,296,18,17,162,373,2,81,0,1,0,296,18,17,197,404,2,112,3,1,0,290,18,17,197,404,2,112,0,1,0,290,18,17,550,661,13,511,1,1,0,636,18,17,204,410,2,118,3,3,0,476,18,17,204,410,2,118,0,3,0,476,18,17,205,411,2,119,3,1,0,331,18,17,205,411,2,119,0,1,0,331,31,29,178,387,2,95,485,1,0,326,31,29,178,387,2,95,486,1,0,326,31,29,179,388,2,96,3,3,0,329,31,29,179,388,2,96,0,3,0,329,9,8,141,352,2,60,1,1,0,313,9,8,141,352,2,60,0,1,0,313,9,8,142,353,2,61,1,1,0,311,9,8,142,353,2,61,0,1,0,311,9,8,145,356,2,64,3,1,0,306,9,8,145,356,2,64,0,1,0,306,9,8,163,374,2,82,3,1,0,280,9,8,163,374,2,82,0,1,0,280,9,8,171,381,2,89,3,1,0,302,9,8,171,381,2,89,0,1,0,302,9,8,172,382,2,90,1,3,1,304,9,8,172,382,2,90,0,1,0,304,9,8,173,383,2,91,3,1,0,301,9,8,173,383,2,91,0,1,0,301,9,8,174,384,2,92,1,3,1,277,9,8,174,384,2,92,0,1,0,277,9,8,175,385,2,93,3,1,0,281,9,8,175,385,2,93,0,1,0,281,9,8,189,398,2,106,3,1,0,478,9,8,189,398,2,106,0,1,0,478,9,8,533,644,10,494,0,1,0,712,9,8,198,405,2,113,1,1,0,477,9,8,198,405,2,113,0,1,0,477,9,8,544,655,10,505,0,1,0,711,9,8,549,660,10,510,0,1,0,609,9,8,202,408,2,116,1,1,0,305,9,8,202,408,2,116,0,1,0,305,9,8,203,409,2,117,1,1,0,327,9,8,203,409,2,117,0,1,0,327,9,8,551,664,2,514,0,1,0,623,9,8,552,663,2,513,0,1,0,624,9,8,553,662,2,512,0,1,0,622,9,8,554,665,10,515,0,1,0,625,9,8,207,412,2,120,3,1,0,278,9,8,207,412,2,120,0,1,0,278,9,8,212,417,2,201,3,3,0,314,9,8,212,417,2,201,0,3,0,314,9,8,213,418,2,206,3,1,0,315,9,8,213,418,2,206,0,1,0,315,9,8,239,437,2,256,3,1,0,291,9,8,239,437,2,256,0,1,0,291,9,8,241,438,2,257,3,1,0,292,9,8,241,438,2,257,0,1,0,292,9,8,242,439,2,258,3,1,0,293,9,8,242,439,2,258,0,1,0,293,15,14,524,638,10,488,0,1,0,629,15,14,186,395,2,103,3,1,0,444,15,14,186,395,2,103,0,1,0,444,15,14,534,645,10,495,0,1,0,714,15,14,214,419,2,219,33,1,39,454,15,14,214,419,2,219,35,1,39,454,15,14,576,686,13,594,1,1,0,628,15,14,577,687,13,595,1,3,0,604,15,14,233,435,2,254,3,1,0,263,15,14,233,435,2,254,0,1,0,263,15,14,578,688,13,596,1,1,0,615,15,14,579,436,2,597,0,1,0,262,15,14,580,38,13,598,1,1,0,37,15,14,234,38,10,255,3,3,1,37,15,14,234,38,2,255,0,1,0,37,15,14,586,436,10,602,0,0,484,262,15,14,588,692,10,603,0,1,0,605,27,26,555,666,13,516,1,1,0,612,27,26,224,428,2,245,3,1,0,276,27,26,224,428,2,245,0,1,0,276,27,26,231,434,2,253,3,1,0,273,27,26,231,434,2,253,0,1,0,273,27,26,573,683,13,591,1,1,0,613,27,26,574,684,13,592,1,1,0,611,27,26,575,685,13,593,1,1,0,610,32,30,525,639,13,489,1,1,0,704,32,30,526,640,13,490,1,1,0,705,32,30,252,442,2,261,3,1,0,466,32,30,252,442,2,261,0,1,0,466,5,4,121,332,2,40,3,1,0,457,5,4,121,332,2,40,0,1,0,457,5,4,122,333,2,41,3,1,0,264,5,4,122,333,2,41,0,1,0,264,5,4,123,334,2,42,3,1,0,456,5,4,123,334,2,42,0,1,0,456,5,4,124,335,2,43,3,1,0,284,5,4,124,335,2,43,0,1,0,284,5,4,125,336,2,44,3,1,0,303,5,4,125,336,2,44,0,1,0,303,5,4,126,337,2,45,3,1,0,483,5,4,126,337,2,45,0,1,0,483,5,4,127,338,2,46,3,1,0,455,5,4,127,338,2,46,0,1,0,455,5,4,128,339,2,47,3,1,0,443,5,4,128,339,2,47,0,1,0,443,5,4,129,340,2,48,3,1,0,307,5,4,129,340,2,48,0,1,0,307,5,4,130,341,2,49,3,1,0,283,5,4,130,341,2,49,0,1,0,283,5,4,131,342,2,50,3,1,0,324,5,4,131,342,2,50,0,1,0,324,5,4,132,343,2,51,3,1,0,464,5,4,132,343,2,51,0,1,0,464,5,4,133,344,2,52,3,1,0,274,5,4,133,344,2,52,0,1,0,274,5,4,134,345,2,53,3,1,0,275,5,4,134,345,2,53,0,1,0,275,5,4,135,346,2,54,3,1,0,446,5,4,135,346,2,54,0,1,0,446,5,4,136,347,2,55,3,1,0,330,5,4,136,347,2,55,0,1,0,330,5,4,137,348,2,56,3,1,0,325,5,4,137,348,2,56,0,1,0,325,5,4,138,349,2,57,3,1,0,465,5,4,138,349,2,57,0,1,0,465,5,4,139,350,2,58,3,1,0,295,5,4,139,350,2,58,0,1,0,295,5,4,140,351,2,59,3,1,0,328,5,4,140,351,2,59,0,1,0,328,5,4,146,357,2,65,3,1,0,294,5,4,146,357,2,65,0,1,0,294,5,4,147,358,2,66,3,1,0,279,5,4,147,358,2,66,0,1,0,279,5,4,148,359,2,67,3,1,0,271,5,4,148,359,2,67,0,1,0,271,5,4,149,360,2,68,3,1,0,285,5,4,149,360,2,68,0,1,0,285,5,4,150,361,2,69,3,1,0,287,5,4,150,361,2,69,0,1,0,287,5,4,151,362,2,70,3,1,0,288,5,4,151,362,2,70,0,1,0,288,5,4,152,363,2,71,3,1,0,269,5,4,152,363,2,71,0,1,0,269,5,4,153,364,2,72,3,1,0,316,5,4,153,364,2,72,0,1,0,316,5,4,154,365,2,73,3,1,0,317,5,4,154,365,2,73,0,1,0,317,5,4,155,366,2,74,3,1,0,282,5,4,155,366,2,74,0,1,0,282,5,4,156,367,2,75,3,1,0,467,5,4,156,367,2,75,0,1,0,467,19,16,180,389,2,97,3,1,0,451,19,16,180,389,2,97,0,1,0,451,19,16,218,423,2,236,3,1,0,445,19,16,218,423,2,236,0,1,0,445,19,16,568,678,10,583,0,1,0,693,19,16,220,424,2,237,3,1,0,447,19,16,220,424,2,237,0,1,0,447,19,16,221,425,2,238,34,1,0,448,19,16,221,425,2,238,36,1,0,448,19,16,569,679,13,584,1,3,0,694,19,16,222,426,2,240,3,1,0,449,19,16,222,426,2,240,0,1,0,449,19,16,243,440,2,259,3,1,0,450,19,16,243,440,2,259,0,1,0,450,19,16,585,691,13,601,1,1,0,695,23,22,556,667,10,517,0,1,0,702,23,22,559,670,2,520,0,1,0,696,23,22,560,671,2,521,0,1,0,697,23,22,561,672,2,522,0,1,0,698,23,22,562,673,2,523,0,1,0,699,23,22,563,674,2,527,0,1,0,700,23,22,564,675,2,528,0,1,0,701,23,22,208,413,2,166,3,1,0,452,23,22,208,413,2,166,0,1,0,452,23,22,209,414,2,177,3,1,0,453,23,22,209,414,2,177,0,1,0,453,23,22,565,676,13,530,1,1,0,703,25,24,182,391,2,99,1,1,0,475,25,24,182,391,2,99,0,1,0,475,25,24,183,392,2,100,3,1,0,474,25,24,183,392,2,100,0,1,0,474,25,24,184,393,2,101,1,1,0,472,25,24,184,393,2,101,0,1,0,472,25,24,185,394,2,102,3,1,0,473,25,24,185,394,2,102,0,1,0,473,25,24,250,441,2,260,3,1,0,471,25,24,250,441,2,260,0,1,0,471,713,487,567,677,10,566,0,1,0,637],"strings":["1","0","TUMB","-1","3","PWRGEN_CONTROLS","2","ENGDEV_CONTROLS","4","FLIGHT_CONTROLS","BTN","7","ARMNT_CONTROL","LEV","9","FLIGHT_INST","14","8","ENVMNT_CONTROL","RADAR_RP5","20","ARK5_CONTROL","17","RADIO_RSIU4V","16","SENSORS_CONTROL","11","GUNSIGHTS","0.3","5","6","EXTLTS_CONTROLS","INTLTS_CONTROLS","-0.1","-0.5","0.1","0.5","AChS-1 Chronograph Left Knob","PTN_365","0.9","200","201","202","203","206","207","208","209","210","211","212","213","214","215","216","217","218","219","220","221","222","223","225","228","229","230","231","232","233","234","235","236","237","238","239","240","241","242","243","244","245","246","247","248","249","250","251","252","253","254","255","256","257","258","259","261","262","263","264","265","266","267","268","269","270","271","274","277","278","281","282","283","291","292","294","298","301","302","304","305","316","3200","3201","3202","3203","3206","3207","3208","3209","3210","3211","3212","3213","3214","3215","3216","3217","3218","3219","3220","3221","3222","3223","3225","3228","3229","3230","3231","3232","3233","3234","3235","3236","3237","3238","3239","3240","3241","3242","3243","3244","3245","3246","3247","3248","3249","325","3250","3251","3252","3253","3254","3255","3256","3257","3258","3259","326","3261","3262","3263","3264","3265","3266","3267","3268","3269","3270","3271","3274","3277","3278","328","3281","3282","3283","329","3291","3292","3294","3298","330","3301","3302","3304","3305","331","3316","3325","3326","3328","3329","3330","3331","3334","3335","3336","3337","3338","334","3340","3341","3343","3344","3345","3346","3347","3348","3349","335","3350","3355","336","3361","3366","337","338","340","341","3429","343","3430","3431","3434","344","345","346","347","348","349","3495","350","3522","355","361","366","429","430","431","434","495","522","AChS-1 Chronograph Right Knob","AGI-1 Artificial Horizon Cage Button - Push to cage","AGI-1 Emergency Power","ARK-5 FAR/NDB Frequency Band Selector Switch ","ARK-5 Function Selector Switch, OFF/COMP/ANT./LOOP","ARK-5 Loop Antenna Rotation Switch, L(EFT)/R(IGHT)","ARK-5 NEAR Frequency Band Selector Switch","ARK-5 Radio Navigation System Circuit Breaker","ARK-5 Receiver Mode Switch, TLG(Telegraph)/TLF(Telephony)","ARU-2V Flight Control System Circuit Breaker","ASP-5 Sight Aiming Mode","ASP-5 Sight Cage/Uncage","ASP-5 Sight Heater","ASP-5 Sight On/Off","ASP-5 Sight Operational Mode (Radar/Optic)","Aileron Trimmer Switch, LEFT/RIGHT","Airbrake Switch","Aircraft External Lights Circuit Breaker","Anti-Skid Brake","BU-13M Aileron Hydraulic Booster Switch, ON/OFF","BU-13M Aileron and BU-14M Stabilizer Hydraulic Booster Circuit Breaker","Battery Connect/Disconnect","Beacon and Radio Altimeter Electric Power","Bomb Fuzing System Circuit Breaker","Bomb Release Mode (Single/Auto)","Bomb Release System Circuit Breaker","Bomb, Drop Tank and Rocket Emergency Jettison System Circuit Breaker","Bombs Arm Switch","Canopy Front Anti Freeze","Canopy Lock Lever L","Canopy Lock Lever R","Canopy Pressurization Switch","Circuit Breakers Panel Lock","Cockpit Gun Camera Power","Cockpit Heating","Cockpit Pressurization Lever","Cockpit Temperature Select","Cockpit Ventilation Switch, OPEN/CLOSE","EKSR-46 Signal Flare Dispenser Switch, OFF/ARMED","Elevator Actuator Switch, HYDRAULIC(BU-14M BOOSTER)/ELECTRIC(MUS-2 SYSTEM)","Elevator Control (ARU-2V) Mode (Automatic/Manual) ","Elevator Control Electric Power","Elevator Control Manual Mode Selector (Long/Short)","Emergency Brake","Emergency Canopy Release Lever","Emergency Pitot Heater Electric Power","Engine Start Power Switch","Fire Extinguisher Cover","Fire Extinguisher Power Switch","Flaps Emergency Deployment","Fuel Tanks/Bombs Jettison Button Cover","Landing Gear Emergency Deployment","Landing Gear Lever","Landing Gear Lever Lock","Landing Gear, Airbrake and Flaps Annunciator Lights Circuit Breaker","Landing Gear, Airbrake and Flaps Systems Circuit Breaker","Left Engine Afterburner Cut","Left Engine Air Start","Left Engine Air Start Button Cover","Left Engine Fuel Cutoff Cover","Left Engine Oil Cutoff","Left Engine Start Button Cover","Left Generator Connect/Disconnect","Left Gun Electric Power","Navigation Lights","Nose Gear Brake System On/Off","Nose Gun Camera Power","Nose Lights Switch, LANDING/OFF/TAXI","ORO-57K Rocket Pods Electric Power","Oxygen-Air Diluter Lever, MIXTURE/100% O2","PTN_200","PTN_201","PTN_202","PTN_203","PTN_206","PTN_207","PTN_208","PTN_209","PTN_210","PTN_211","PTN_212","PTN_213","PTN_214","PTN_215","PTN_216","PTN_217","PTN_218","PTN_219","PTN_220","PTN_221","PTN_222","PTN_223","PTN_225","PTN_228","PTN_229","PTN_230","PTN_231","PTN_232","PTN_233","PTN_234","PTN_235","PTN_236","PTN_237","PTN_238","PTN_239","PTN_240","PTN_241","PTN_242","PTN_243","PTN_244","PTN_245","PTN_246","PTN_247","PTN_248","PTN_249","PTN_250","PTN_251","PTN_252","PTN_253","PTN_254","PTN_255","PTN_256","PTN_257","PTN_258","PTN_259","PTN_261","PTN_262","PTN_263","PTN_264","PTN_265","PTN_266","PTN_267","PTN_268","PTN_269","PTN_270","PTN_271","PTN_274","PTN_277","PTN_278","PTN_281","PTN_282","PTN_283","PTN_291","PTN_292","PTN_294","PTN_298","PTN_301","PTN_302","PTN_304","PTN_305","PTN_316","PTN_325","PTN_326","PTN_328","PTN_329","PTN_330","PTN_331","PTN_334","PTN_335","PTN_336","PTN_337","PTN_338","PTN_340","PTN_341","PTN_343","PTN_344","PTN_345","PTN_346","PTN_347","PTN_348","PTN_349","PTN_350","PTN_355","PTN_361","PTN_364","PTN_429","PTN_430","PTN_431","PTN_434","PTN_495","PTN_522","Pitot Heater Electric Power","Pitot Tube Selector, MAIN(PVD-4)/EMERGENCY(TP-156)","RP-5 Radar ECCM Mode Switch, ON/OFF","RP-5 Radar Electric Power","RP-5 Radar Gauge Display Mode Switch, VOLTAGE[V]/AIR PRESSURE[kg/cmÂ²]","RP-5 Radar Mode Control Switch, ON/STANDBY/OFF","RP-5 Radar Screen Mode Switch, DAY/NIGHT","RP-5 Radar Target Lock Switch (AR-18-16 Tracking Antenna), ON/OFF","RP-5 Radar/Telemetry Selector","RSIU-4V Audio Output: ADF/Radio","RSIU-4V Interference Suppression Switch, ON/OFF","RV-5 Radio Altimeter Minimum Altitude Selector","Radio Navigation Electric Power","Radios Electric Power","Radios Emergency Power","Right Engine Afterburner Cut","Right Engine Air Start","Right Engine Air Start Button Cover","Right Engine Fuel Cutoff Cover","Right Engine Oil Cutoff","Right Engine Start Button Cover","Right Generator Connect/Disconnect","Right Gun Electric Power","Right Side Flood Lamp Switch, ON/OFF","Rocket Pods Circuit Breaker","Rocket pods Jettison Button Cover","Rockets Counter Mode (day/night)","Rockets Salvo Mode Selector","SPO-2 SIRENA RWR Power Switch","SRO-2 IFF Power Switch Cover","SRO-2 IFF Power Switch, ON/OFF","SRO-2 IFF Self-destruct Button - Press to activate self-destruction","SRO-2 IFF Self-destruct Button Cover","Suit Oxygen Supply Lever, AUTOMATIC TURN-OFF/N(EUTRAL)/SUIT TURN-ON","TP-19 Braking Parachute Deploy Button Cover","TP-19 Braking Parachute Jettison Button Cover","Tank 1 Fuel Pump","Tank 2 Fuel Pump","Tank 3 Fuel Pump","Tank 4 Fuel Pump","Trim System Electric Power","","-0.2","0.2","10","224","226","227","260","272","273","275","276","279","280","284","285","286","287","288","289","290","293","295","296","297","299","300","303","306","307","308","309","314","315","317","318","319","320","321","322","3224","3226","3227","323","324","3260","327","3272","3273","3275","3276","3279","3280","3284","3285","3286","3287","3288","3289","3290","3293","3295","3296","3297","3299","3300","3303","3306","3307","3308","3309","3314","3315","3317","3318","3319","3320","3321","3322","3323","3324","3327","333","3333","3339","3342","3351","3352","3353","3356","3357","3358","3359","3360","3362","3364","3365","3368","3369","339","342","3486","3508","351","3515","352","353","356","357","358","359","360","362","364","365","368","369","486","508","515","AGI-1 Artificial Horizon Pitch Trim Knob","AM-10 Accelerometer Min/Max G Reset Button","ARK-5 Audio Volume Knob","ARK-5 Frequency Fine Tuning Handle","ARK-5 Frequency Scale Backlight Knob","ARU-2V Lamp Test Button","ASP-5 Brightness","ASP-5 Mil Depression Setting","ASP-5 Target Distance Selector","ASP-5 Target Wingspan Selector","Afterburner Enable","Barometric Altimeter Setting (bars)","EKSR-46 Green Signal Flare Release Button","EKSR-46 Red Signal Flare Release Button","EKSR-46 White Signal Flare Release Button","EKSR-46 Yellow Signal Flare Release Button","Engine Fire Lamp Test Button","Fire Extinguisher","Flaps Landing","Flaps Off","Flaps Take Off","Flaps buttons reset","Fuel Tanks 2,3,4 Warning Lamps Test Button","Fuel Tanks/Bombs Jettison","GIK-1 Course Selector","GIK-1 Needle Alignment","Left Engine Fuel Cutoff","Left Engine Start","Left Gun Ammo Counter Reset","Left Gun Arm","Mil-power Limit/Afterburner Disable","Near/Far Beacon","Oxygen shut-off valve","PPS-2 Landing Gear Lights Test Button - Push to test","PTN_224","PTN_226","PTN_227","PTN_260","PTN_272","PTN_273","PTN_275","PTN_276","PTN_279","PTN_280","PTN_284","PTN_285","PTN_286","PTN_287","PTN_288","PTN_289","PTN_290","PTN_293","PTN_295","PTN_296","PTN_297","PTN_299","PTN_300","PTN_303","PTN_306","PTN_307","PTN_308","PTN_309","PTN_314","PTN_315","PTN_317","PTN_318","PTN_319","PTN_320","PTN_321","PTN_322","PTN_323","PTN_324","PTN_327","PTN_333","PTN_339","PTN_342","PTN_351","PTN_352","PTN_353","PTN_356","PTN_357","PTN_358","PTN_359","PTN_360","PTN_362","PTN_368","PTN_369","PTN_486","PTN_515","RP-5 Radar Built-In Test (BIT) Button - Press 2 seconds to start test","RP-5 Radar Electronic Horizon Elevation Adjustment Knob","RP-5 Radar Screen Brightness Adjustment Knob","RSIU-4V Preset Radio Channel 1","RSIU-4V Preset Radio Channel 2","RSIU-4V Preset Radio Channel 3","RSIU-4V Preset Radio Channel 4","RSIU-4V Preset Radio Channel 5","RSIU-4V Preset Radio Channel 6","RSIU-4V Transmit Button - Push to Transmit","RSIU-4V Volume Control Knob","RUFO-45 Left Side ARUFOSH UV Lamp Intensity Control Knob","RUFO-45 Right Side ARUFOSH UV Lamp Intensity Control Knob","Right Engine Fuel Cutoff","Right Engine Start","Right Gun Ammo Counter Reset","Right Gun Arm","Rocket pods Jettison","TP-19 Braking Parachute Deploy Button - Press to deploy drag chute","TP-19 Braking Parachute Jettison Button - Press to jettison drag chute","WACLTS_INST","Warning Button"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"P-51D","rows":[104,1,9,229,2,118,1,1,0,172,104,1,9,229,2,118,0,1,0,172,295,273,9,489,7,269,105,1,105,327,296,116,9,490,15,95,0,1,0,409,100,84,9,228,7,84,0,1,0,146,100,84,16,488,15,116,0,1,0,379,100,84,12,228,15,271,41,1,248,146,145,121,9,238,7,286,0,1,0,196,145,121,16,238,15,66,246,1,0,196,32,29,12,221,2,82,3,1,0,92,32,29,12,221,2,82,0,1,0,92,32,29,12,222,2,82,3,1,0,92,32,29,12,222,2,82,0,1,0,92,32,29,18,541,7,289,0,1,0,378,32,29,27,540,7,288,0,1,0,422,32,29,34,558,15,291,1,3,0,297,32,29,39,559,15,292,1,3,0,320,32,29,85,560,15,293,1,3,0,402,32,29,30,227,7,117,0,1,0,191,32,29,31,227,7,117,0,1,0,191,32,29,274,539,7,287,0,1,0,403,53,50,9,498,7,279,0,1,0,372,53,50,12,220,2,113,3,1,0,147,53,50,12,220,2,113,0,1,0,147,53,50,34,478,15,264,1,1,0,309,53,50,39,230,2,120,3,1,0,136,53,50,39,230,2,120,0,1,0,136,149,95,9,461,15,260,1,1,0,318,149,95,16,462,15,261,1,1,0,319,150,119,9,210,15,10,41,1,0,159,150,119,12,210,7,270,0,1,0,159,21,19,9,504,2,97,1,1,1,414,21,19,9,505,2,97,6,6,6,416,21,19,9,506,7,97,8,6,8,415,21,19,16,235,2,129,3,1,0,190,21,19,16,235,2,129,0,1,0,190,21,19,23,507,7,282,0,1,0,337,21,19,18,236,2,88,3,1,0,152,21,19,18,236,2,88,0,1,0,152,21,19,27,511,7,130,0,1,0,175,21,19,34,512,7,283,0,1,0,413,21,19,39,237,2,131,3,1,0,189,21,19,39,237,2,131,0,1,0,189,21,19,59,513,7,132,0,1,0,178,21,19,44,508,2,88,1,1,1,323,21,19,44,509,2,88,0,0,0,324,21,19,45,510,7,130,0,1,0,175,21,19,35,514,7,132,0,1,0,178,22,20,9,549,7,98,6,1,6,311,22,20,9,550,2,98,8,1,8,300,22,20,9,551,7,98,17,1,17,376,22,20,16,552,7,99,6,1,6,312,22,20,16,553,2,99,8,1,8,301,22,20,16,554,7,99,17,1,17,377,22,20,12,225,2,114,3,1,0,148,22,20,12,225,2,114,0,1,0,148,22,20,23,226,2,115,3,1,0,174,22,20,23,226,2,115,0,1,0,174,22,20,59,234,2,63,42,1,8,173,22,20,59,234,2,63,6,1,8,173,22,20,44,502,15,280,1,1,0,371,22,20,35,503,15,281,1,1,0,370,22,20,61,499,2,63,1,1,1,374,22,20,61,500,2,63,1,6,6,375,22,20,61,501,2,63,1,8,8,373,102,94,9,485,15,266,1,1,0,317,102,94,16,486,15,267,1,1,0,314,102,94,12,487,15,268,1,1,0,344,11,10,9,532,15,284,0,1,0,313,11,10,16,138,2,51,42,1,17,168,11,10,16,138,2,51,6,1,17,168,11,10,18,515,2,51,1,1,1,362,11,10,18,516,2,51,1,6,6,363,11,10,18,517,2,51,1,8,8,361,11,10,18,518,2,51,1,17,17,360,11,10,27,139,2,64,3,3,0,157,11,10,27,139,2,64,0,3,0,157,11,10,34,533,7,285,0,1,0,412,11,10,39,141,2,65,3,3,0,170,11,10,39,141,2,65,0,3,0,170,11,10,85,142,2,67,3,3,0,182,11,10,85,142,2,67,0,3,0,182,11,10,59,140,2,52,42,1,17,181,11,10,59,140,2,52,6,1,17,181,11,10,44,519,2,64,3,3,3,308,11,10,44,520,2,64,1,1,1,331,11,10,44,521,2,64,0,0,0,332,11,10,45,526,2,65,3,3,3,367,11,10,45,527,2,65,1,1,1,366,11,10,45,528,2,65,0,0,0,368,11,10,35,529,2,67,3,3,3,393,11,10,35,530,2,67,1,1,1,392,11,10,35,531,2,67,0,0,0,394,11,10,30,522,2,52,1,1,1,306,11,10,30,523,2,52,6,6,6,305,11,10,30,524,2,52,8,8,8,304,11,10,30,525,2,52,17,17,17,396,37,36,9,144,2,48,42,1,46,153,37,36,9,144,2,48,6,1,46,153,37,36,16,242,2,90,3,1,0,154,37,36,16,242,2,90,0,1,0,154,37,36,23,542,2,48,46,46,46,405,37,36,23,543,2,48,6,6,6,406,37,36,23,544,2,48,8,8,8,404,37,36,23,545,2,48,17,17,17,408,37,36,23,546,2,48,1,1,1,407,37,36,18,547,2,90,1,1,1,325,37,36,18,548,2,90,0,0,0,326,40,38,9,223,2,57,42,1,8,160,40,38,9,223,2,57,6,1,8,160,40,38,16,224,2,83,3,1,0,161,40,38,16,224,2,83,0,1,0,161,40,38,12,484,7,265,0,1,0,343,40,38,18,479,2,57,1,1,1,342,40,38,18,480,2,57,6,6,6,338,40,38,18,481,2,57,8,8,8,339,40,38,58,482,2,83,1,1,1,340,40,38,58,483,2,83,0,0,0,341,158,96,9,241,2,134,3,1,0,162,158,96,9,241,2,134,0,1,0,162,14,13,9,216,2,80,3,1,0,166,14,13,9,216,2,80,0,1,0,166,14,13,16,215,2,43,42,1,41,163,14,13,16,215,2,43,6,1,41,163,14,13,12,217,2,56,3,3,0,167,14,13,12,217,2,56,0,3,0,167,14,13,23,218,2,112,3,1,0,164,14,13,23,218,2,112,0,1,0,164,14,13,18,219,2,81,3,1,0,165,14,13,18,219,2,81,0,1,0,165,14,13,27,476,7,262,0,1,0,351,14,13,34,477,7,263,0,1,0,352,14,13,35,469,2,80,1,1,1,357,14,13,35,470,2,80,0,0,0,358,14,13,30,474,2,81,1,1,1,353,14,13,30,475,2,81,0,0,0,354,14,13,31,463,2,43,1,1,1,345,14,13,31,464,2,43,1,6,6,346,14,13,31,465,2,43,1,8,8,347,14,13,31,466,2,43,1,17,17,348,14,13,31,467,2,43,1,46,46,349,14,13,31,468,2,43,1,41,41,350,14,13,60,471,2,56,3,3,3,359,14,13,60,472,2,56,1,1,1,355,14,13,60,473,2,56,0,0,0,356,33,0,12,232,2,62,42,1,8,187,33,0,12,232,2,62,6,1,8,187,33,0,23,233,2,87,3,1,0,188,33,0,23,233,2,87,0,1,0,188,33,0,18,497,15,278,0,1,0,335,33,0,58,231,2,128,3,1,0,151,33,0,58,231,2,128,0,1,0,151,33,0,30,495,2,87,1,1,1,410,33,0,30,496,2,87,0,0,0,411,33,0,31,492,2,62,1,1,1,321,33,0,31,493,2,62,6,6,6,322,33,0,31,494,2,62,8,8,8,336,69,54,16,557,15,290,1,1,0,369,69,54,12,243,2,91,3,1,0,169,69,54,12,243,2,91,0,1,0,169,69,54,27,555,2,91,1,1,1,364,69,54,27,556,2,91,0,0,0,365,93,66,9,211,2,108,245,1,41,176,93,66,9,211,2,108,41,1,41,176,93,66,12,212,2,109,3,1,0,137,93,66,12,212,2,109,0,1,0,137,382,272,9,491,15,96,0,1,0,315,5,4,9,199,2,71,3,1,0,101,5,4,9,199,2,71,0,1,0,101,5,4,12,198,2,70,3,1,0,103,5,4,12,198,2,70,0,1,0,103,5,4,18,201,2,73,3,1,0,177,5,4,18,201,2,73,0,1,0,177,5,4,27,425,15,249,1,1,0,395,5,4,34,202,2,74,3,3,0,197,5,4,34,202,2,74,0,3,0,197,5,4,39,203,2,75,3,3,0,193,5,4,39,203,2,75,0,3,0,193,5,4,44,428,2,71,1,1,1,101,5,4,44,429,2,71,0,0,0,303,5,4,45,426,2,70,1,1,1,103,5,4,45,427,2,70,0,0,0,328,5,4,35,432,2,73,1,1,1,380,5,4,35,433,2,73,0,0,0,381,5,4,30,434,2,74,3,3,1,424,5,4,30,435,2,74,0,1,0,423,5,4,31,436,2,75,3,3,1,418,5,4,31,437,2,75,0,1,0,417,5,4,61,200,2,72,3,1,0,156,5,4,61,200,2,72,0,1,0,156,5,4,86,204,2,76,3,3,0,180,5,4,86,204,2,76,0,3,0,180,5,4,122,205,2,77,3,3,0,155,5,4,122,205,2,77,0,3,0,155,5,4,123,206,2,78,3,3,0,135,5,4,123,206,2,78,0,3,0,135,5,4,276,444,7,250,0,1,0,389,5,4,277,445,7,251,0,1,0,310,5,4,124,430,2,72,1,1,1,333,5,4,124,431,2,72,0,0,0,334,5,4,125,438,2,76,0,1,0,391,5,4,125,439,2,76,3,3,1,390,5,4,126,440,2,77,0,1,0,330,5,4,126,441,2,77,3,3,1,329,5,4,127,442,2,78,0,1,0,299,5,4,127,443,2,78,3,3,1,298,49,47,9,207,2,79,3,1,0,194,49,47,9,207,2,79,0,1,0,194,49,47,12,449,7,106,0,1,0,195,49,47,23,446,15,252,0,1,0,419,49,47,27,447,2,79,1,1,1,420,49,47,27,448,2,79,0,0,0,421,49,47,34,450,7,106,0,1,0,195,28,26,9,452,7,254,0,1,0,388,28,26,16,453,7,255,0,1,0,294,28,26,12,454,7,256,0,1,0,302,28,26,23,455,7,257,0,1,0,307,28,26,18,456,7,258,0,1,0,316,28,26,58,457,15,259,0,1,0,384,28,26,27,208,2,55,0,1,0,179,28,26,34,208,7,55,3,3,1,179,28,26,30,451,15,253,0,1,0,383,28,26,60,209,2,107,3,1,0,192,28,26,60,209,2,107,0,1,0,192,28,26,275,458,7,55,3,3,1,387,28,26,86,459,2,55,1,1,1,385,28,26,86,460,2,55,0,0,0,386,25,24,12,213,2,110,3,1,0,171,25,24,12,213,2,110,0,1,0,171,25,24,23,214,2,111,3,1,0,183,25,24,23,214,2,111,0,1,0,183,25,24,27,534,2,68,1,1,1,400,25,24,27,535,2,68,6,6,6,401,25,24,27,536,2,68,8,8,8,399,25,24,34,239,2,89,3,1,0,185,25,24,34,239,2,89,0,1,0,185,25,24,39,240,2,133,244,1,0,184,25,24,85,240,2,133,247,1,0,184,25,24,45,143,2,68,42,1,8,186,25,24,45,143,2,68,6,1,8,186,25,24,35,537,2,89,0,0,0,397,25,24,35,538,2,89,1,1,1,398],"strings":["1","0","TUMB","-1","14","RIGHT_SWITCH_PANEL","0.1","BTN","0.2","3001","13","FRONT_SWITCH_BOX","3003","27","IFF","LEV","3002","0.3","3005","15","5","ENGINE_CONTROL_PANEL","ENGINE_SYSTEM","3004","4","WEAPON_CONTROL","24","3007","VHF_RADIO","12","3015","3016","CONTROL_SYSTEM","K14_GUNSIGHT","3008","3014","9","FUEL_SYSTEM","28","3009","HOMING_ADAPTER","0.5","-0.1","139","3012","3013","0.4","25","85","TAIL_WARNING_RADAR","6","66","68","CPT_MECH","10","128","141","152","3006","3011","3017","3019","40","47","67","69","7","70","73","LIGHT_SYSTEM","102","103","104","105","106","107","108","109","110","114","140","143","150","153","19","3010","3021","41","61","74","86","89","Landing Gear Control Handle","OXYGEN_SYSTEM","11","26","3","57","87","88","ARTIFICIAL_HORIZON","Battery Disconnect","ENVIRONMENT_SYSTEM","Generator Disconnect","","0.6","115","129","130","131","132","133","142","149","168","169","17","173","183","20","200","22","3022","3023","3026","3027","3028","3029","39","58","62","64","65","75","79","Amber Recognition Light Key/Off/Steady","Arm rest","Auto-Mix On-Off","CLK_VAR2_pnt_66","CLK_VAR2_pnt_67","CLK_VAR2_pnt_68","CLK_VAR2_pnt_69","CLK_VAR2_pnt_70","CLK_VAR2_pnt_73","CLK_VAR2_pnt_85","CLOCK","Cage","Canopy Emergency Release Handle","Coolant Control Cover","DETROLA","DIRECTIONAL_GYRO","Fixed Reticle Mask Lever","Fuel Booster On/Off","Fuel Selector Valve","Fuel Shut-Off Valve","Green Recognition Light Key/Off/Steady","Gun Heating","Gun control","HYDRAULIC_SYSTEM","Heading Set/Cage","Homing Adapter Mode","Homing Adapter On/Off","Hydraulic Release Knob","IFF Code Selector","IFF Detonator Circuit On/Off","IFF Distress Signal","IFF Power On/Off","IFF TIME/OFF/ON","Ignition","Landing Light On/Off","Left Bomb Arm/Chemical","Left Payload Salvo","Mirror","Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH","Oil Control Cover","Oil Dilute Activate","Oxygen Emergency By-pass","Pitot Heating","Primer Activate","Radio Mode","Red Recognition Light Key/Off/Steady","Release Mode","Right Bomb Arm/Chemical","Right Payload Salvo","Rockets Counter Control","Rockets Delay Switch","Rockets Release Mode","Sight Mode","Sight On/Off","Starter Switch Cover","Supercharger Switch Cover","Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position","Switch Locking Lever","Tail Position Lights Bright/Off/Dim","Tail Warning Radar Power","Tail Warning Radar Test","Winding/Adjustment Clock","Wing Position Lights Bright/Off/Dim","pnt_102","pnt_103","pnt_104","pnt_105","pnt_106","pnt_107","pnt_108","pnt_109","pnt_110","pnt_114","pnt_128","pnt_129","pnt_13","pnt_130","pnt_131","pnt_132","pnt_133","pnt_139","pnt_140","pnt_141","pnt_142","pnt_143","pnt_149","pnt_150","pnt_151","pnt_152","pnt_153","pnt_168","pnt_169","pnt_173","pnt_18","pnt_183","pnt_200","pnt_39","pnt_40","pnt_41","pnt_47","pnt_58","pnt_61","pnt_64","pnt_7","pnt_74","pnt_76","pnt_79","pnt_86","pnt_89","-0.090909090909091","-0.5","0.04","0.090909090909091","0.14","100","111","112","113","116","117","118","119","120","121","127","137","138","145","146","147","154","157","158","159","176","179","18","23","30","3018","3020","3024","3025","42","44","48","49","60","63","71","72","8","81","83","84","90","91","92","93","A Channel Activate","ACCELEROMETER","ALTIMETER","Aileron Trim","Amber Recognition Light Key/Off","Amber Recognition Light Steady/Off","Automatic Coolant Control","Automatic Oil Control","B Channel Activate","Battery Connect","Bombs Both Release","Bombs Train Release","Bombs and Rockets Safe","C Channel Activate","Camera On","Canopy Hand Crank","Circuit Protectors Reset","Close Coolant Control","Close Oil Control","Cockpit Lights","Cold Air","Course Set","D Channel Activate","Defroster","Detrola Frequency Selector","Detrola Volume","Elevator Trim","Fixed Sight","Fixed-Gyro Sight","Fuel Booster Off","Fuel Booster On","Fuel Shut-Off Valve Off","Fuel Shut-Off Valve On","G-meter reset","Generator Connect","Green Recognition Light Key/Off","Green Recognition Light Steady/Off","Gun And Camera Off","Gun And Camera On","Gun Heating Off","Gun Heating On","Gun Sight Brightness","Gyro Sight","High Blower Lamp Test ","Homing Adapter COMM.","Homing Adapter HOMING","Homing Adapter Power Off","Homing Adapter Power On","Homing Adapter TRANSMIT","Homing Adapter's Circuit Breaker","Hot Air","IFF CODE 1","IFF CODE 2","IFF CODE 3","IFF CODE 4","IFF CODE 5","IFF CODE 6","IFF Detonator Left","IFF Detonator Right","IFF Distress Signal Off","IFF Distress Signal On","IFF OFF","IFF ON","IFF Power Off","IFF Power On","IFF TIME","Ignition Both","Ignition Left","Ignition Off","Ignition Right","Landing Light Off","Landing Light On","Left Bomb Arm Off","Left Bomb Arm On","Left Chemical Release","Left Fluorescent Light","Lock Propeller & Mixture","Lock Throttle","Microphone On","Mixture EMERGENCY FULL RICH","Mixture IDLE","Mixture RUN","Open Coolant Control","Open Oil Control","Parking Brake Handle","Pitch Adjustment","Pitot Heating Off","Pitot Heating On","REMOTE_COMPASS","Radio Audio Volume ","Radio Lights Dimmer","Radio Mode Receive","Radio Mode Remote","Radio Mode Transmit","Radio ON/OFF","Recognition Lights Key","Red Recognition Light Key/Off","Red Recognition Light Steady/Off","Right Bomb Arm Off","Right Bomb Arm On","Right Chemical Release","Right Fluorescent Light","Rockets Arm","Rockets Delay","Rockets Int","Rockets Release Auto","Rockets Release Off","Rockets Release Single","Rudder Trim","Safe Landing Gear Light Test","Select Fuselage Tank","Select Left Combat Tank","Select Left Main Tank","Select Right Combat Tank","Select Right Main Tank","Set Pressure","Sight Off","Sight On","Silence Landing Gear Warning Horn Cut Off","Starter Activate","Supercharger AUTO","Supercharger HIGH","Supercharger LOW","Tail Position Lights Bright/Off","Tail Position Lights Dim/Off","Tail Warning Radar Light Control","Tail Warning Radar Power Off","Tail Warning Radar Power On","Unsafe Landing Gear Light Test","Wing Position Lights Bright/Off","Wing Position Lights Dim/Off","pnt_100","pnt_102_0","pnt_102_1","pnt_103_0","pnt_103_1","pnt_104_0","pnt_104_1","pnt_105_0","pnt_105_1","pnt_106_0","pnt_106_1","pnt_107_0","pnt_107_1","pnt_108_0","pnt_108_1","pnt_109_0","pnt_109_1","pnt_110_0","pnt_110_1","pnt_111","pnt_112","pnt_113","pnt_114_0","pnt_114_1","pnt_115","pnt_115_1","pnt_116","pnt_117","pnt_118","pnt_119","pnt_120","pnt_121","pnt_127","pnt_128_-1","pnt_128_0","pnt_128_1","pnt_137","pnt_138","pnt_139_1","pnt_139_2","pnt_139_3","pnt_139_4","pnt_139_5","pnt_139_6","pnt_140_0","pnt_140_1","pnt_141_-1","pnt_141_0","pnt_141_1","pnt_143_0","pnt_143_1","pnt_145","pnt_146","pnt_147_1","pnt_152_0","pnt_152_1","pnt_152_2","pnt_153_0","pnt_153_1","pnt_154","pnt_157","pnt_158","pnt_159","pnt_17","pnt_176","pnt_26","pnt_3","pnt_40_0","pnt_40_1","pnt_40_2","pnt_41_0","pnt_41_1","pnt_42","pnt_44","pnt_47_0","pnt_47_1","pnt_47_2","pnt_48","pnt_49","pnt_57_0","pnt_57_1","pnt_57_2","pnt_60","pnt_61_0","pnt_61_1","pnt_62","pnt_62_1","pnt_63","pnt_65","pnt_65_1","pnt_66_0","pnt_66_1","pnt_66_2","pnt_66_3","pnt_67_-1","pnt_67_0","pnt_67_1","pnt_68_0","pnt_68_1","pnt_68_2","pnt_68_3","pnt_69_-1","pnt_69_0","pnt_69_1","pnt_70_-1","pnt_70_0","pnt_70_1","pnt_71","pnt_72","pnt_73_0","pnt_73_1","pnt_73_2","pnt_74_0","pnt_74_1","pnt_81","pnt_83","pnt_84","pnt_85_0","pnt_85_1","pnt_85_2","pnt_85_3","pnt_85_4","pnt_86_0","pnt_86_1","pnt_87_0","pnt_87_1","pnt_87_2","pnt_88_0","pnt_88_1","pnt_88_2","pnt_89_0","pnt_89_1","pnt_90","pnt_91","pnt_92","pnt_93"]});
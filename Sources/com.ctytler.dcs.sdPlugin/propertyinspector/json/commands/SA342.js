@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"SA342","rows":[24,22,6,148,2,84,3,1,0,208,24,22,6,148,2,84,0,1,0,208,24,22,9,149,2,85,3,1,0,209,24,22,9,149,2,85,0,1,0,209,24,22,16,147,2,89,65,1,41,207,24,22,16,147,2,89,66,1,41,207,24,22,18,423,5,331,1,1,0,478,24,22,30,425,5,325,1,1,0,479,24,22,27,426,5,326,1,1,0,480,24,22,31,424,5,327,1,1,0,481,24,22,35,428,5,328,1,1,0,482,24,22,49,429,5,329,1,1,0,483,24,22,36,427,5,330,1,1,0,484,45,43,6,292,2,78,65,1,41,262,45,43,6,292,2,78,66,1,41,262,45,43,9,571,5,319,1,1,0,495,45,43,16,291,2,79,3,1,0,206,45,43,16,291,2,79,0,1,0,206,45,43,18,570,5,320,1,1,0,496,14,13,6,189,2,20,3,1,0,213,14,13,6,189,2,20,0,1,0,213,14,13,9,192,2,121,3,1,0,254,14,13,9,192,2,121,0,1,0,254,14,13,16,191,2,122,3,1,0,259,14,13,16,191,2,122,0,1,0,259,14,13,18,188,2,125,3,1,0,281,14,13,18,188,2,125,0,1,0,281,14,13,30,190,2,126,3,3,0,245,14,13,30,190,2,126,0,3,0,245,14,13,27,287,2,142,3,1,0,268,14,13,27,287,2,142,0,1,0,268,14,13,31,166,2,146,3,1,0,241,14,13,31,166,2,146,0,1,0,241,14,13,35,440,4,346,0,1,0,487,14,13,38,554,4,345,0,1,0,533,14,13,40,171,2,93,3,1,0,232,14,13,40,171,2,93,0,1,0,232,14,13,51,172,2,94,3,1,0,233,14,13,51,172,2,94,0,1,0,233,14,13,52,170,2,95,3,3,0,240,14,13,52,170,2,95,0,3,0,240,14,13,53,169,2,82,55,1,0,216,14,13,53,169,2,82,56,1,0,216,14,13,117,468,4,335,0,1,0,488,432,333,6,431,5,420,1,1,0,489,62,58,6,154,5,395,26,1,0,280,62,58,9,434,4,402,0,1,0,534,62,58,16,433,4,403,0,1,0,531,62,58,18,154,4,344,0,1,0,280,435,417,6,436,4,404,0,1,0,502,8,7,6,153,2,108,3,1,0,214,8,7,6,153,2,108,0,1,0,214,8,7,9,150,2,109,3,1,0,211,8,7,9,150,2,109,0,1,0,211,8,7,16,168,2,111,3,1,0,231,8,7,16,168,2,111,0,1,0,231,8,7,18,569,4,410,0,1,0,551,8,7,30,198,2,87,3,1,0,255,8,7,30,198,2,87,0,1,0,255,8,7,27,167,2,113,3,1,0,229,8,7,27,167,2,113,0,1,0,229,8,7,31,204,2,110,3,1,0,210,8,7,31,204,2,110,0,1,0,210,8,7,35,181,2,141,3,3,0,264,8,7,35,181,2,141,0,3,0,264,8,7,49,555,4,407,0,1,0,537,8,7,36,155,2,139,3,3,0,219,8,7,36,155,2,139,0,3,0,219,8,7,37,156,2,140,3,3,0,253,8,7,37,156,2,140,0,3,0,253,8,7,38,283,2,143,3,1,0,70,8,7,38,283,2,143,0,1,0,70,8,7,50,441,4,409,0,1,0,498,8,7,40,472,4,411,0,1,0,485,8,7,51,473,4,412,0,1,0,497,8,7,52,203,2,144,3,1,0,218,8,7,52,203,2,144,0,1,0,218,8,7,53,162,2,145,3,1,0,261,8,7,53,162,2,145,0,1,0,261,8,7,116,437,4,405,0,1,0,553,33,32,6,159,2,98,3,3,0,225,33,32,6,159,2,98,0,3,0,225,33,32,9,157,2,99,3,1,0,226,33,32,9,157,2,99,0,1,0,226,33,32,16,160,2,100,3,3,0,227,33,32,16,160,2,100,0,3,0,227,33,32,18,158,2,92,3,1,0,224,33,32,18,158,2,92,0,1,0,224,33,32,30,438,4,334,0,1,0,493,46,44,6,173,5,313,26,1,0,234,46,44,9,173,4,314,0,1,0,234,46,44,16,284,5,336,26,1,0,260,46,44,18,284,4,337,0,1,0,260,46,44,31,152,2,96,65,1,41,263,46,44,31,152,2,96,66,1,41,263,63,59,6,165,2,114,55,1,0,221,63,59,6,165,2,114,56,1,0,221,63,59,9,164,2,115,306,1,73,220,63,59,9,164,2,115,310,1,73,220,29,28,6,176,5,413,26,1,0,272,29,28,9,174,5,415,26,1,0,222,29,28,16,175,5,414,26,1,0,270,29,28,60,176,4,396,0,1,0,272,29,28,68,174,4,397,0,1,0,222,29,28,61,175,4,398,0,1,0,270,29,28,118,179,5,416,26,1,0,273,29,28,119,177,5,419,26,1,0,223,29,28,120,178,5,418,26,1,0,271,29,28,357,179,4,399,0,1,0,273,29,28,358,177,4,400,0,1,0,223,29,28,359,178,4,401,0,1,0,271,39,34,6,465,5,338,1,1,0,503,39,34,9,469,5,22,1,1,0,492,39,34,16,443,5,321,1,1,0,549,39,34,18,180,2,10,3,1,0,248,39,34,18,180,2,10,0,1,0,248,39,34,30,442,5,322,1,1,0,532,39,34,27,184,2,83,3,1,0,258,39,34,27,184,2,83,0,1,0,258,15,10,6,455,5,360,1,1,0,523,15,10,9,186,2,123,71,1,0,246,15,10,9,186,2,123,72,1,0,246,15,10,16,187,2,124,71,1,0,247,15,10,16,187,2,124,72,1,0,247,15,10,18,459,4,361,0,1,0,519,15,10,30,456,4,362,0,1,0,516,15,10,27,454,4,363,0,1,0,515,15,10,31,462,4,364,0,1,0,522,15,10,35,457,4,365,0,1,0,517,15,10,49,444,4,379,0,1,0,505,15,10,36,445,4,366,0,1,0,506,15,10,37,446,4,367,0,1,0,507,15,10,38,447,4,368,0,1,0,508,15,10,50,448,4,370,0,1,0,509,15,10,40,449,4,371,0,1,0,510,15,10,51,450,4,372,0,1,0,511,15,10,52,451,4,374,0,1,0,512,15,10,53,452,4,375,0,1,0,513,15,10,116,453,4,376,0,1,0,514,15,10,348,463,4,369,0,1,0,524,15,10,349,461,4,373,0,1,0,521,15,10,60,464,4,377,0,1,0,525,15,10,68,460,4,378,0,1,0,520,15,10,61,458,4,380,0,1,0,518,23,21,6,151,2,80,3,3,0,249,23,21,6,151,2,80,0,3,0,249,23,21,9,163,2,101,3,3,0,212,23,21,9,163,2,101,0,3,0,212,23,21,16,183,2,75,3,3,0,238,23,21,16,183,2,75,0,3,0,238,23,21,18,182,4,76,3,3,1,237,23,21,27,182,2,76,0,1,0,237,23,21,35,199,2,137,3,1,0,251,23,21,35,199,2,137,0,1,0,251,23,21,36,430,5,347,1,1,0,486,23,21,37,161,2,102,3,1,0,228,23,21,37,161,2,102,0,1,0,228,23,21,38,439,5,339,1,1,0,494,12,11,6,466,4,382,0,1,0,491,12,11,9,467,4,383,0,1,0,550,12,11,16,196,2,128,0,1,0,282,12,11,18,196,4,128,3,3,1,282,12,11,30,195,2,129,308,1,0,217,12,11,30,195,2,129,26,1,0,217,12,11,27,193,2,130,3,1,0,256,12,11,27,193,2,130,0,1,0,256,12,11,31,194,2,131,55,1,0,244,12,11,31,194,2,131,56,1,0,244,12,11,60,299,2,103,3,1,0,239,12,11,60,299,2,103,0,1,0,239,12,11,68,575,4,340,0,1,0,501,12,11,61,300,2,104,3,1,0,243,12,11,61,300,2,104,0,1,0,243,12,11,350,576,4,341,0,1,0,504,12,11,351,574,4,342,0,1,0,500,12,11,352,573,4,343,0,1,0,499,12,11,353,304,4,105,3,3,1,236,12,11,117,304,2,105,0,1,0,236,12,11,354,301,4,106,3,3,1,230,12,11,355,301,2,106,0,1,0,230,12,11,118,303,4,107,3,3,1,235,12,11,119,303,2,107,0,1,0,235,12,11,120,302,4,97,3,3,1,266,12,11,356,302,2,97,0,1,0,266,54,48,6,201,2,90,55,1,0,289,54,48,6,201,2,90,56,1,0,289,54,48,9,200,2,91,305,1,0,265,54,48,9,200,2,91,309,1,0,265,54,48,16,470,5,332,1,1,0,490,69,67,6,471,5,422,1,1,0,530,69,67,9,202,5,421,26,1,0,250,69,67,16,202,4,312,0,1,0,250,47,42,6,205,2,81,3,3,0,257,47,42,6,205,2,81,0,3,0,257,47,42,9,476,4,323,0,1,0,528,47,42,16,477,4,324,0,1,0,529,47,42,18,474,5,315,1,1,0,526,47,42,30,475,5,316,1,1,0,527,285,86,6,286,4,408,0,1,0,215,285,86,9,286,5,406,26,1,0,215,64,57,6,288,2,77,3,1,0,267,64,57,6,288,2,77,0,1,0,267,64,57,9,557,5,318,1,1,0,536,64,57,16,556,5,317,1,1,0,535,25,20,6,290,2,138,307,1,74,269,25,20,6,290,2,138,311,1,74,269,25,20,16,568,4,384,0,1,0,548,25,20,27,559,4,385,0,1,0,539,25,20,31,560,4,386,0,1,0,540,25,20,35,561,4,387,0,1,0,541,25,20,49,562,4,388,0,1,0,542,25,20,36,563,4,389,0,1,0,543,25,20,37,564,4,390,0,1,0,544,25,20,38,565,4,391,0,1,0,545,25,20,50,566,4,392,0,1,0,546,25,20,40,567,4,393,0,1,0,547,25,20,51,558,4,394,0,1,0,538,19,17,6,185,2,112,3,1,0,242,19,17,6,185,2,112,0,1,0,242,19,17,9,197,2,88,3,1,0,252,19,17,9,197,2,88,0,1,0,252,19,17,18,293,2,127,3,3,0,274,19,17,18,293,2,127,0,3,0,274,19,17,49,572,5,381,1,1,0,552,19,17,36,294,2,132,3,1,0,275,19,17,36,294,2,132,0,1,0,275,19,17,37,295,2,133,3,1,0,276,19,17,37,295,2,133,0,1,0,276,19,17,38,296,2,134,3,1,0,277,19,17,38,296,2,134,0,1,0,277,19,17,50,297,2,135,3,1,0,278,19,17,50,297,2,135,0,1,0,278,19,17,40,298,2,136,3,1,0,279,19,17,40,298,2,136,0,1,0,279],"strings":["1","0","TUMB","-1","BTN","LEV","3001","2","ELECTRIC","3002","23","16","PE","7","AUTOPILOT","NADIR","3003","26","3004","WEAPONS","31","15","21","NAVLIGHTS","ADF","UHF_RADIO","0.5","3006","4","INTERCOM","3005","3007","25","FD","14","3008","3010","3011","3012","LIGHTS","3014","0.99","24","5","9","AM_RADIO","FLIGHT_CONTROLS","RWR","27","3009","3013","3015","3016","3017","PH","-0.25","0.25","13","20","28","3021","3023","CLOCK","FM_RADIO","TV","-0.33","0.33","18","3022","RADAR_ALTIMETER","","-0.2","0.2","1.001","1.002","105","106","124","128","130","146","148","153","154","166","167","17","170","172","178","180","181","194","197","198","199","218","219","220","221","222","228","229","255","257","261","262","263","264","265","267","268","269","271","272","273","3018","3028","3031","3032","3033","32","33","331","332","34","35","354","365","366","367","370","372","373","374","375","376","382","383","48","49","56","60","61","63","64","65","ADF_MODE_PTR","ADF_SELECT_PTR","ADF_TONESWITCH_PTR","ALTER-PTR","ANO-PTR","ArtVisVhfDop-PTR","BATTERIE-PTR","CLOCK-WINDER-PTR","EG-COPILOTE-PTR","EG-PILOTE-PTR","FD-CC-SEQ-PTR","FD-FIRE-BUTTON-CAP-PTR","FD-OPE-PTR","FD-VE-PTR","FEUX-FORMATION-INTER-PTR","FILTAS-PTR","FLASHER-PTR","FM-CHNL-PTR","FM-MAIN-PTR","FMAG-PTR","FUEL-PUMP-FRONT-PTR","GENE-PTR","GYRO-KNOB-GD-PTR","GYRO-SWITCH-GD-PTR","GYRO-TEST-COVER-PTR","GYRO-TEST-SWITCH-PTR","HA-PTR","IC1-FM1-PTR","IC1-UHF-PTR","IC1-VHF-PTR","IC2-FM1-PTR","IC2-UHF-PTR","IC2-VHF-PTR","INTER-BNL-PTR","INTER-MA-PTR","LANDING-LIGHT-EXTEND-PTR","LANDING-LIGHT-PTR","LENTILLE_PTR","MASTER_ARM_PTR","NADIR_DOPPLER","NADIR_VENT","PA_LACET_PTR","PA_MASTER_PTR","PA_MODE_PTR","PA_ROULIS_PTR","PA_TANGAGE_PTR","PE_ALI","PE_MODE","PE_TLM","PE_ZOOM","PILOTSIGHT-PTR","PITOT-PTR","PUPITRE-PLANCHEBORD-PTR","PV-GISEMENT-PTR","PV_CLE_PTR","RALT-ONOFF-PTR","RCONV-PTR","RSUPP-PTR","RWR-ON-OFF-PTR","SA342 25/50kHz Selector","SA342 ADF Mode","SA342 ADF Select","SA342 ADF Tone","SA342 Additionnal Fuel Tank","SA342 Alternator","SA342 Anticollision Light NOR / OFF / ATT","SA342 Autopilot On/Off","SA342 Battery","SA342 Bug/Test","SA342 CM/A/GM/D/GD","SA342 CTH","SA342 Convoy Tank On/Off","SA342 Copilot Wiper","SA342 FM Chnl Selector","SA342 FM Main Selector","SA342 FM Radio Volume","SA342 FM Radio Volume 2","SA342 Flare Dispenser Fire Button Cap","SA342 Flare Dispenser G/G+D/D","SA342 Flare Dispenser Mode","SA342 Flare Dispenser Off/Speed","SA342 Formation Lights On/Off","SA342 Fuel Pump","SA342 Gain","SA342 Generator","SA342 Gyro Test Cover On/Off","SA342 Gyro Test Switch On/Off","SA342 HA Unlock","SA342 Image Brightness","SA342 Image Focus","SA342 Landing Light Extend/Retract","SA342 Landing Light Off/Vario/On","SA342 Lasing Button Cover","SA342 Left/Center/Right","SA342 Magnetic Brake On/Off","SA342 Master arm On/Off","SA342 Missile Launch Cover","SA342 Mode","SA342 Mode Speed / OFF / Altitude","SA342 NADIR Mode","SA342 NADIR Parameter","SA342 NORM/BNL","SA342 Navigation Lights CLI / OFF / FIX","SA342 On/Off - Test","SA342 Panels Lighting On/Off","SA342 Pilot Sight","SA342 Pilot Wiper","SA342 Pitch On/Off","SA342 Pitot","SA342 Power","SA342 RWR On/Off Croc","SA342 Red Lens On/Off","SA342 Roll On/Off","SA342 STDBYHA Unlock","SA342 Sand Filter On/Off","SA342 Selector","SA342 Source","SA342 Starter Start/Stop/Air","SA342 Station Select","SA342 Symbology Brightness","SA342 TV On/Off","SA342 Trim On/Off","SA342 UHF MODE","SA342 UHF Radio Volume","SA342 UHF Radio Volume 2","SA342 VHF AM Radio Volume","SA342 VHF AM Radio Volume 2","SA342 WP1 OnOff","SA342 WP2 Ma Left","SA342 WP2 Ma Left Cover","SA342 WP2 Ma Right","SA342 WP2 Ma Right Cover","SA342 WP2 Seq","SA342 Winder","SA342 Yaw On/Off","SA342 Zoom","SPACE-PTR","StdbyHA-PTR","TORQUE","TORQUE-PTR","TRIM-PTR","TV-INTER-PTR","Test/On/Off","UHF_KNOB","VHF-FREQ-BAS-PTR","VHF-SQ-BAS-PTR","WP1_ONOFF","WP2_MA_LEFT","WP2_MA_LEFT_COVER","WP2_MA_RIGHT","WP2_MA_RIGHT_COVER","WP2_SEQ","WS_CACHE_TELEMETRE_PTR","WS_CACHE_TIR_PTR","WS_GAIN_PTR","WS_INCRUST_PTR","WS_LUM_PTR","WS_NET_PTR","-0.125","-0.143","-0.167","-0.5","0.125","0.143","0.167","100","115","116","121","122","123","125","129","131","145","147","149","150","168","169","173","174","175","176","179","182","19","195","209","215","216","22","230","256","258","259","260","270","293","294","30","3019","3020","3024","3025","3026","3027","3029","3030","3034","3051","3052","3053","330","333","334","335","336","337","338","339","340","341","342","343","344","345","346","347","348","349","350","351","352","357","362","364","385","388","389","390","391","392","393","394","395","396","397","45","452","453","454","455","456","457","46","47","50","53","54","57","58","59","62","66","67","68","69","70","79","8","80","81","89","91","96","ADF_GAIN_PTR","ADF_LHIGHKNOB_PTR","ADF_LLOWKNOB_PTR","ADF_LMIDKNOB_PTR","ADF_RHIGHKNOB_PTR","ADF_RLOWKNOB_PTR","ADF_RMIDKNOB_PTR","ANTICOLL-INTENSITY-PTR","BALT-PTR","BARO_ALTIMETER","CLOCK-RESET-PTR","CLOCK-STARTSTOP-PTR","CONTROLS","DEB-EFF-PTR","EG-STICK-PTR","FD-FIRE-BUTTON-PTR","FEUX-FORMATION-INTENSITY-PTR","HOVER-PTR","HYD-PTR","KNOB-PLAFOND-PTR","LABELS-PTR","NADIR_0","NADIR_1","NADIR_2","NADIR_3","NADIR_4","NADIR_5","NADIR_6","NADIR_7","NADIR_8","NADIR_9","NADIR_AUX","NADIR_BRT","NADIR_DES","NADIR_DOWN","NADIR_EFF","NADIR_ENT","NADIR_GEL","NADIR_GEO","NADIR_IC","NADIR_POL","NADIR_POS","PBO-PTR","PE_CENTERING","PE_VDOVTH","PILOT-STICK-PA-PTR","PUP-PTR","PV_LUM_PTR","RALT-DANGERALT-PTR","REARM-ALTER-PTR","REARM-GENE-PTR","RWR-AUDIO-PTR","RWR-BRT-PTR","RWR-MARQUEUR-PTR","RWR-PAGE-PTR","SA342 ADF Gain","SA342 ADF Nav1 Hundred","SA342 ADF Nav1 Ten","SA342 ADF Nav1 Unit","SA342 ADF Nav2 Hundred","SA342 ADF Nav2 Ten","SA342 ADF Nav2 Unit","SA342 Alter Rearm","SA342 AntiCollision Light Intensity","SA342 Auto-Hover","SA342 Autopilot Button","SA342 Baro pressure QFE knob","SA342 Brightness","SA342 Centering","SA342 Console Lighting","SA342 Flare Dispenser Fire Button","SA342 Formation Lights Intensity","SA342 Freq decimals","SA342 Freq dial","SA342 Gene Rearm","SA342 HYD Test","SA342 Inversed Image Toggle","SA342 Inversed Symbology Toggle","SA342 Lasing Button","SA342 Magnetic Brake","SA342 Main Dashboard Lighting","SA342 Missile Launch Button","SA342 NADIR 0","SA342 NADIR 1","SA342 NADIR 2","SA342 NADIR 3","SA342 NADIR 4","SA342 NADIR 5","SA342 NADIR 6","SA342 NADIR 7","SA342 NADIR 8","SA342 NADIR 9","SA342 NADIR AUX","SA342 NADIR DES","SA342 NADIR DOWN","SA342 NADIR EFF","SA342 NADIR ENT","SA342 NADIR GEL","SA342 NADIR GEO","SA342 NADIR IC","SA342 NADIR Off/Brightness","SA342 NADIR POL","SA342 NADIR POS","SA342 RWR Audio","SA342 RWR Brt","SA342 RWR Marker","SA342 RWR Page","SA342 Radar Alt Bug","SA342 Reset","SA342 Roof Lamp Knob","SA342 Slave","SA342 Start/Stop","SA342 TV Brightness","SA342 TV Contrast","SA342 Test","SA342 UHF 0","SA342 UHF 1","SA342 UHF 2","SA342 UHF 3","SA342 UHF 4","SA342 UHF 5","SA342 UHF 6","SA342 UHF 7","SA342 UHF 8","SA342 UHF 9","SA342 UHF VLD","SA342 UV Lighting","SA342 VDO/VTH","SA342 Voltmeter Test","SA342 WP1 Brt","SA342 Wiper once","SLAVE-PTR","TEST-TA-PTR","TV-BRT-PTR","TV-LUM-PTR","UHF_0","UHF_1","UHF_2","UHF_3","UHF_4","UHF_5","UHF_6","UHF_7","UHF_8","UHF_9","UHF_VLD","VATEST-PTR","VHF-FREQ-HAUT-PTR","VHF-SQ-HAUT-PTR","WP1_BRT","WS_INV_FOND_PTR","WS_INV_INCRUST_PTR","WS_TELEMETRE_PTR","WS_TIR_PTR"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"SpitfireLFMkIX","rows":[88,59,23,87,12,189,38,1,0,92,88,59,32,87,2,188,0,1,0,92,6,0,60,208,12,202,1,1,0,245,6,0,31,250,7,187,0,1,0,221,6,0,16,145,2,69,5,1,0,109,6,0,16,145,2,69,0,1,0,109,6,0,24,130,2,70,1,1,0,95,6,0,24,130,2,70,0,1,0,95,6,0,25,160,2,71,1,1,0,125,6,0,25,160,2,71,0,1,0,125,6,0,15,213,12,197,1,1,0,217,6,0,17,127,2,80,1,1,0,93,6,0,17,127,2,80,0,1,0,93,6,0,33,270,7,201,0,1,0,244,6,0,18,159,2,52,5,1,0,124,6,0,18,159,2,52,0,1,0,124,6,0,63,269,12,171,1,5,0,242,6,0,28,150,2,47,5,1,0,114,6,0,28,150,2,47,0,1,0,114,6,0,34,148,2,48,5,1,0,111,6,0,34,148,2,48,0,1,0,111,6,0,35,206,12,176,0,1,0,214,6,0,36,247,12,186,0,1,0,218,6,0,183,267,12,172,1,5,0,243,6,0,29,135,2,53,5,1,0,90,6,0,29,135,2,53,0,1,0,90,6,0,67,254,7,170,0,1,0,216,6,0,30,156,2,51,5,1,0,119,6,0,30,156,2,51,0,1,0,119,4,3,24,141,2,45,1,1,0,108,4,3,24,141,2,45,0,1,0,108,4,3,26,139,2,72,5,1,0,106,4,3,26,139,2,72,0,1,0,106,4,3,15,140,2,73,5,1,0,107,4,3,15,140,2,73,0,1,0,107,4,3,27,84,2,74,5,1,0,122,4,3,27,84,2,74,0,1,0,122,4,3,17,157,2,75,5,1,0,120,4,3,17,157,2,75,0,1,0,120,4,3,33,268,7,193,0,1,0,236,4,3,18,85,2,76,5,1,0,89,4,3,18,85,2,76,0,1,0,89,4,3,181,207,7,194,0,1,0,215,4,3,63,149,12,195,38,1,0,112,4,3,182,149,7,196,0,1,0,112,4,3,28,158,2,77,1,1,0,123,4,3,28,158,2,77,0,1,0,123,4,3,34,271,7,203,0,1,0,246,4,3,35,131,2,39,1,1,0,97,4,3,35,131,2,39,0,1,0,97,4,3,36,129,2,83,1,1,0,96,4,3,36,129,2,83,0,1,0,96,4,3,64,132,2,49,5,1,0,98,4,3,64,132,2,49,0,1,0,98,4,3,65,86,2,50,1,1,0,91,4,3,65,86,2,50,0,1,0,91,4,3,29,128,2,56,5,1,0,94,4,3,29,128,2,56,0,1,0,94,4,3,184,248,7,173,0,1,0,219,4,3,66,144,2,57,5,1,0,121,4,3,66,144,2,57,0,1,0,121,4,3,67,258,7,174,0,1,0,237,4,3,30,151,2,58,5,1,0,113,4,3,30,151,2,58,0,1,0,113,4,3,185,261,7,175,0,1,0,230,4,3,68,161,2,46,5,1,0,126,4,3,68,161,2,46,0,1,0,126,146,20,22,147,2,44,1,1,0,110,146,20,22,147,2,44,0,1,0,110,10,8,21,259,12,191,19,1,0,227,10,8,23,260,12,192,19,1,0,228,10,8,16,143,2,81,37,1,0,102,10,8,16,143,2,81,19,1,0,102,10,8,25,142,2,82,37,1,0,101,10,8,25,142,2,82,19,1,0,101,10,8,26,257,7,204,0,1,0,229,10,8,15,136,2,40,5,1,0,103,10,8,15,136,2,40,0,1,0,103,10,8,27,138,2,41,5,1,0,105,10,8,27,138,2,41,0,1,0,105,10,8,17,137,2,42,5,1,0,104,10,8,17,137,2,42,0,1,0,104,10,8,33,255,7,162,0,1,0,225,10,8,18,256,7,163,0,1,0,226,14,13,21,266,7,164,0,1,0,231,14,13,60,262,7,165,0,1,0,232,14,13,22,263,7,166,0,1,0,233,14,13,23,264,7,167,0,1,0,234,14,13,31,265,7,168,0,1,0,235,14,13,32,152,2,43,5,1,0,115,14,13,32,152,2,43,0,1,0,115,14,13,16,153,2,55,0,1,0,117,14,13,177,153,7,55,5,5,1,117,14,13,15,154,2,54,5,1,0,116,14,13,15,154,2,54,0,1,0,116,11,9,21,155,2,20,5,1,0,118,11,9,21,155,2,20,0,1,0,118,11,9,22,212,7,8,0,1,0,238,11,9,23,210,7,9,0,1,0,239,11,9,31,211,7,190,0,1,0,240,11,9,16,253,12,198,1,1,0,223,11,9,178,251,12,199,1,1,0,224,11,9,179,249,7,205,0,1,0,220,11,9,26,209,7,169,0,1,0,241,11,9,61,134,2,78,1,1,0,100,11,9,61,134,2,78,0,1,0,100,11,9,62,133,2,79,5,1,0,99,11,9,62,133,2,79,0,1,0,99,11,9,180,252,12,200,1,1,0,222],"strings":["1","0","TUMB","2","ENGINE_CONTROLS","-1","CONTROLS","BTN","4","5","TERTIARY_CONTROLS","WEAPONS","LEV","15","VHF_RADIO","3017","3007","3021","3025","0.5","3","3001","3003","3004","3009","3011","3015","3019","3033","3051","3059","3005","3006","3023","3035","3037","3041","-0.5","0.04","100","106","107","108","125","13","130","131","133","134","135","137","147","148","149","155","156","157","159","161","17","3002","3016","3018","3029","3043","3045","3055","3057","3099","46","47","50","56","57","58","64","66","70","79","80","87","92","93","98","BLOWER","BOOSTER_COVER","CARB_AIR","CLK_PINION","CLOCK","Cockpit.SpitfireLFMkIX.booster_cover","Cockpit.SpitfireLFMkIX.canopy_operate","Cockpit.SpitfireLFMkIX.carburettor_flap","Cockpit.SpitfireLFMkIX.clock","Cockpit.SpitfireLFMkIX.deicer","Cockpit.SpitfireLFMkIX.dilution_cover","Cockpit.SpitfireLFMkIX.flaps","Cockpit.SpitfireLFMkIX.fuel_cock_droptank","Cockpit.SpitfireLFMkIX.fuel_cock_primary","Cockpit.SpitfireLFMkIX.fuel_pump","Cockpit.SpitfireLFMkIX.gun_sight_master","Cockpit.SpitfireLFMkIX.gun_sight_tint","Cockpit.SpitfireLFMkIX.id_lamp_down_mode","Cockpit.SpitfireLFMkIX.id_lamp_up_mode","Cockpit.SpitfireLFMkIX.iff_b","Cockpit.SpitfireLFMkIX.iff_cover","Cockpit.SpitfireLFMkIX.iff_d","Cockpit.SpitfireLFMkIX.magneto0","Cockpit.SpitfireLFMkIX.magneto1","Cockpit.SpitfireLFMkIX.mix","Cockpit.SpitfireLFMkIX.nav_lights","Cockpit.SpitfireLFMkIX.oxygen_valve","Cockpit.SpitfireLFMkIX.pitot","Cockpit.SpitfireLFMkIX.primer","Cockpit.SpitfireLFMkIX.radiator_cover","Cockpit.SpitfireLFMkIX.radiator_mode","Cockpit.SpitfireLFMkIX.radio_dimmer","Cockpit.SpitfireLFMkIX.radio_lock","Cockpit.SpitfireLFMkIX.radio_mode","Cockpit.SpitfireLFMkIX.safety","Cockpit.SpitfireLFMkIX.sidedoor_operate","Cockpit.SpitfireLFMkIX.starter_cover","Cockpit.SpitfireLFMkIX.supercharger_cover","Cockpit.SpitfireLFMkIX.supercharger_mode","Cockpit.SpitfireLFMkIX.tank_pressurizer","Cockpit.SpitfireLFMkIX.uc","Cockpit.SpitfireLFMkIX.uc_blind","Cockpit.SpitfireLFMkIX.uc_down_indication","DEICER","DILUTER_COVER","DROPTANK_COCK","FLAPS","FUEL_COCK","FUEL_PUMP","GUNSIGHT_SWITCH","GUNSIGHT_TINT","HATCH","IFF_B","IFF_COVER","IFF_D","MAGNETO0","MAGNETO1","MIX","MORSE_DN","MORSE_UP","MS_TEST_COVER","NAV_LIGHTS","OXYGEN","OXY_VALVE","PITOT","PRIMER","RADIATOR","RAD_TEST_COVER","RCTRL_DIM","RCTRL_T","RCTRL_TLOCK","SAFETY","SIDE_DOOR","STARTER_COVER","TANK_PRS","UC","UC_BLIND","UC_DOWN_C","109","110","115","116","117","118","119","128","140","145","146","158","160","162","30","3008","3010","3013","3020","3027","3030","3044","3053","3061","32","44","54","55","6","60","61","65","67","68","69","74","77","78","81","88","9","90","94","99","ALT_MBAR","BOOSTER","BRAKES","BUTTON_BOMB","BUTTON_CAN","BUTTON_LINKED","BUTTON_MG","COMPASS_RING","Cockpit.SpitfireLFMkIX.altimeter","Cockpit.SpitfireLFMkIX.booster","Cockpit.SpitfireLFMkIX.canopy_jettison","Cockpit.SpitfireLFMkIX.compass","Cockpit.SpitfireLFMkIX.di","Cockpit.SpitfireLFMkIX.dilution","Cockpit.SpitfireLFMkIX.droptank_release","Cockpit.SpitfireLFMkIX.fuel_gauge","Cockpit.SpitfireLFMkIX.gun_sight_illumination","Cockpit.SpitfireLFMkIX.gun_sight_range","Cockpit.SpitfireLFMkIX.gun_sight_span","Cockpit.SpitfireLFMkIX.iff_0","Cockpit.SpitfireLFMkIX.iff_1","Cockpit.SpitfireLFMkIX.illumination_lh","Cockpit.SpitfireLFMkIX.illumination_rh","Cockpit.SpitfireLFMkIX.morse_key","Cockpit.SpitfireLFMkIX.radiator_test","Cockpit.SpitfireLFMkIX.radio_0","Cockpit.SpitfireLFMkIX.radio_a","Cockpit.SpitfireLFMkIX.radio_b","Cockpit.SpitfireLFMkIX.radio_c","Cockpit.SpitfireLFMkIX.radio_d","Cockpit.SpitfireLFMkIX.starter","Cockpit.SpitfireLFMkIX.supercharger_test","Cockpit.SpitfireLFMkIX.trigger_0","Cockpit.SpitfireLFMkIX.trigger_1","Cockpit.SpitfireLFMkIX.trigger_2","Cockpit.SpitfireLFMkIX.trigger_bomb","Cockpit.SpitfireLFMkIX.trim_elevator","Cockpit.SpitfireLFMkIX.trim_rudder","Cockpit.SpitfireLFMkIX.uc_emergency","Cockpit.SpitfireLFMkIX.wheel_brakes","Cockpit.SpitfireLFMkIX.wobble","DI","DILUTER","DROPTANK_JETT","FUEL_GAUGE","GUNSIGHT_BASE","GUNSIGHT_DIMMER","GUNSIGHT_RANGE","HATCH_JETTISON","IFF_0","IFF_1","MORSE_KEY","MS_TEST","PITLITE_LH","PITLITE_RH","RAD_TEST","RCTRL_A","RCTRL_B","RCTRL_C","RCTRL_D","RCTRL_OFF","RTRIM_WHEEL","STARTER","TRIM_WHEEL","UC_EMER","WOBBLE_PUMP"]});
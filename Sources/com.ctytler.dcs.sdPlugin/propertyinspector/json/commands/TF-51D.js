@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"TF-51D","rows":[97,1,7,206,2,110,1,1,0,157,97,1,7,206,2,110,0,1,0,157,262,241,7,445,6,237,99,1,99,292,263,108,7,446,14,86,98,1,0,367,93,76,7,205,6,76,0,1,0,133,93,76,16,444,14,108,0,1,0,342,93,76,15,205,14,239,34,1,216,133,132,112,7,211,6,253,0,1,0,175,132,112,16,211,14,59,98,1,0,175,27,25,15,198,2,74,3,1,0,83,27,25,15,198,2,74,0,1,0,83,27,25,15,199,2,74,3,1,0,83,27,25,15,199,2,74,0,1,0,83,27,25,19,486,6,256,0,1,0,341,27,25,28,485,6,255,0,1,0,378,27,25,35,503,14,258,1,3,0,264,27,25,42,504,14,259,1,3,0,287,27,25,89,505,14,260,1,3,0,360,27,25,32,204,6,109,0,1,0,170,27,25,37,204,6,109,0,1,0,170,27,25,242,484,6,254,0,1,0,361,82,78,7,448,6,246,0,1,0,335,82,78,15,197,2,105,3,1,0,134,82,78,15,197,2,105,0,1,0,134,82,78,35,434,14,232,1,1,0,276,136,86,7,417,14,228,1,1,0,285,136,86,16,418,14,229,1,1,0,286,137,111,7,189,14,8,34,1,0,145,137,111,15,189,6,238,0,1,0,145,21,18,7,454,2,90,1,1,1,370,21,18,7,455,2,90,9,9,9,372,21,18,7,456,6,90,11,9,11,371,21,18,16,208,2,119,3,1,0,169,21,18,16,208,2,119,0,1,0,169,21,18,26,457,6,249,0,1,0,300,21,18,19,209,2,79,3,1,0,138,21,18,19,209,2,79,0,1,0,138,21,18,28,461,6,120,0,1,0,160,21,18,35,462,6,250,0,1,0,369,21,18,42,210,2,121,3,1,0,168,21,18,42,210,2,121,0,1,0,168,21,18,53,463,6,122,0,1,0,163,21,18,39,458,2,79,1,1,1,288,21,18,39,459,2,79,0,0,0,289,21,18,46,460,6,120,0,1,0,160,21,18,36,464,6,122,0,1,0,163,22,20,7,494,6,91,9,1,9,278,22,20,7,495,2,91,11,1,11,267,22,20,7,496,6,91,17,1,17,339,22,20,16,497,6,92,9,1,9,279,22,20,16,498,2,92,11,1,11,268,22,20,16,499,6,92,17,1,17,340,22,20,15,202,2,106,3,1,0,135,22,20,15,202,2,106,0,1,0,135,22,20,26,203,2,107,3,1,0,159,22,20,26,203,2,107,0,1,0,159,22,20,53,207,2,56,45,1,11,158,22,20,53,207,2,56,9,1,11,158,22,20,39,452,14,247,1,1,0,334,22,20,36,453,14,248,1,1,0,333,22,20,55,449,2,56,1,1,1,337,22,20,55,450,2,56,1,9,9,338,22,20,55,451,2,56,1,11,11,336,95,85,7,441,14,234,1,1,0,284,95,85,16,442,14,235,1,1,0,281,95,85,15,443,14,236,1,1,0,307,10,8,7,482,14,251,0,1,0,280,10,8,16,126,2,47,45,1,17,154,10,8,16,126,2,47,9,1,17,154,10,8,19,465,2,47,1,1,1,325,10,8,19,466,2,47,1,9,9,326,10,8,19,467,2,47,1,11,11,324,10,8,19,468,2,47,1,17,17,323,10,8,28,127,2,57,3,3,0,143,10,8,28,127,2,57,0,3,0,143,10,8,35,483,6,252,0,1,0,368,10,8,42,129,2,58,3,3,0,156,10,8,42,129,2,58,0,3,0,156,10,8,89,130,2,60,3,3,0,167,10,8,89,130,2,60,0,3,0,167,10,8,53,128,2,48,45,1,17,166,10,8,53,128,2,48,9,1,17,166,10,8,39,469,2,57,3,3,3,275,10,8,39,470,2,57,1,1,1,296,10,8,39,471,2,57,0,0,0,297,10,8,46,476,2,58,3,3,3,330,10,8,46,477,2,58,1,1,1,329,10,8,46,478,2,58,0,0,0,331,10,8,36,479,2,60,3,3,3,356,10,8,36,480,2,60,1,1,1,355,10,8,36,481,2,60,0,0,0,357,10,8,32,472,2,48,1,1,1,273,10,8,32,473,2,48,9,9,9,272,10,8,32,474,2,48,11,11,11,271,10,8,32,475,2,48,17,17,17,359,30,29,7,131,2,43,45,1,40,139,30,29,7,131,2,43,9,1,40,139,30,29,16,213,2,80,3,1,0,140,30,29,16,213,2,80,0,1,0,140,30,29,26,487,2,43,40,40,40,363,30,29,26,488,2,43,9,9,9,364,30,29,26,489,2,43,11,11,11,362,30,29,26,490,2,43,17,17,17,366,30,29,26,491,2,43,1,1,1,365,30,29,19,492,2,80,1,1,1,290,30,29,19,493,2,80,0,0,0,291,33,31,7,200,2,52,45,1,11,146,33,31,7,200,2,52,9,1,11,146,33,31,16,201,2,75,3,1,0,147,33,31,16,201,2,75,0,1,0,147,33,31,15,440,6,233,0,1,0,306,33,31,19,435,2,52,1,1,1,305,33,31,19,436,2,52,9,9,9,301,33,31,19,437,2,52,11,11,11,302,33,31,88,438,2,75,1,1,1,303,33,31,88,439,2,75,0,0,0,304,144,87,7,212,2,123,3,1,0,148,144,87,7,212,2,123,0,1,0,148,13,12,7,193,2,72,3,1,0,152,13,12,7,193,2,72,0,1,0,152,13,12,16,192,2,38,45,1,34,149,13,12,16,192,2,38,9,1,34,149,13,12,15,194,2,51,3,3,0,153,13,12,15,194,2,51,0,3,0,153,13,12,26,195,2,104,3,1,0,150,13,12,26,195,2,104,0,1,0,150,13,12,19,196,2,73,3,1,0,151,13,12,19,196,2,73,0,1,0,151,13,12,28,432,6,230,0,1,0,314,13,12,35,433,6,231,0,1,0,315,13,12,36,425,2,72,1,1,1,320,13,12,36,426,2,72,0,0,0,321,13,12,32,430,2,73,1,1,1,316,13,12,32,431,2,73,0,0,0,317,13,12,37,419,2,38,1,1,1,308,13,12,37,420,2,38,1,9,9,309,13,12,37,421,2,38,1,11,11,310,13,12,37,422,2,38,1,17,17,311,13,12,37,423,2,38,1,40,40,312,13,12,37,424,2,38,1,34,34,313,13,12,54,427,2,51,3,3,3,322,13,12,54,428,2,51,1,1,1,318,13,12,54,429,2,51,0,0,0,319,61,49,16,502,14,257,1,1,0,332,61,49,15,214,2,81,3,1,0,155,61,49,15,214,2,81,0,1,0,155,61,49,28,500,2,81,1,1,1,327,61,49,28,501,2,81,0,0,0,328,84,59,7,190,2,102,215,1,34,161,84,59,7,190,2,102,34,1,34,161,84,59,15,191,2,103,3,1,0,125,84,59,15,191,2,103,0,1,0,125,345,240,7,447,14,87,0,1,0,282,5,4,7,178,2,63,3,1,0,94,5,4,7,178,2,63,0,1,0,94,5,4,15,177,2,62,3,1,0,96,5,4,15,177,2,62,0,1,0,96,5,4,19,180,2,65,3,1,0,162,5,4,19,180,2,65,0,1,0,162,5,4,28,381,14,217,1,1,0,358,5,4,35,181,2,66,3,3,0,176,5,4,35,181,2,66,0,3,0,176,5,4,42,182,2,67,3,3,0,172,5,4,42,182,2,67,0,3,0,172,5,4,39,384,2,63,1,1,1,94,5,4,39,385,2,63,0,0,0,270,5,4,46,382,2,62,1,1,1,96,5,4,46,383,2,62,0,0,0,293,5,4,36,388,2,65,1,1,1,343,5,4,36,389,2,65,0,0,0,344,5,4,32,390,2,66,3,3,1,380,5,4,32,391,2,66,0,1,0,379,5,4,37,392,2,67,3,3,1,374,5,4,37,393,2,67,0,1,0,373,5,4,55,179,2,64,3,1,0,142,5,4,55,179,2,64,0,1,0,142,5,4,77,183,2,68,3,3,0,165,5,4,77,183,2,68,0,3,0,165,5,4,113,184,2,69,3,3,0,141,5,4,113,184,2,69,0,3,0,141,5,4,114,185,2,70,3,3,0,124,5,4,114,185,2,70,0,3,0,124,5,4,244,400,6,218,0,1,0,352,5,4,245,401,6,219,0,1,0,277,5,4,115,386,2,64,1,1,1,298,5,4,115,387,2,64,0,0,0,299,5,4,116,394,2,68,0,1,0,354,5,4,116,395,2,68,3,3,1,353,5,4,117,396,2,69,0,1,0,295,5,4,117,397,2,69,3,3,1,294,5,4,118,398,2,70,0,1,0,266,5,4,118,399,2,70,3,3,1,265,44,41,7,186,2,71,3,1,0,173,44,41,7,186,2,71,0,1,0,173,44,41,15,405,6,100,0,1,0,174,44,41,26,402,14,220,0,1,0,375,44,41,28,403,2,71,1,1,1,376,44,41,28,404,2,71,0,0,0,377,44,41,35,406,6,100,0,1,0,174,24,23,7,408,6,222,0,1,0,351,24,23,16,409,6,223,0,1,0,261,24,23,15,410,6,224,0,1,0,269,24,23,26,411,6,225,0,1,0,274,24,23,19,412,6,226,0,1,0,283,24,23,88,413,14,227,0,1,0,347,24,23,28,187,2,50,0,1,0,164,24,23,35,187,6,50,3,3,1,164,24,23,32,407,14,221,0,1,0,346,24,23,54,188,2,101,3,1,0,171,24,23,54,188,2,101,0,1,0,171,24,23,243,414,6,50,3,3,1,350,24,23,77,415,2,50,1,1,1,348,24,23,77,416,2,50,0,0,0,349],"strings":["1","0","TUMB","-1","14","RIGHT_SWITCH_PANEL","BTN","3001","13","0.1","FRONT_SWITCH_BOX","0.2","27","IFF","LEV","3003","3002","0.3","15","3005","5","ENGINE_CONTROL_PANEL","ENGINE_SYSTEM","24","VHF_RADIO","12","3004","CONTROL_SYSTEM","3007","9","FUEL_SYSTEM","28","3015","HOMING_ADAPTER","0.5","3008","3014","3016","139","3012","0.4","25","3009","85","TAIL_WARNING_RADAR","-0.1","3013","66","68","10","128","141","152","3011","3017","3019","47","67","69","7","70","LIGHT_SYSTEM","102","103","104","105","106","107","108","109","110","114","140","143","150","153","19","3021","6","61","86","89","CPT_MECH","Landing Gear Control Handle","OXYGEN_SYSTEM","11","26","3","3006","3010","57","87","88","ARTIFICIAL_HORIZON","Battery Disconnect","ENVIRONMENT_SYSTEM","Generator Disconnect","","0.04","0.6","115","129","130","131","142","149","168","169","17","173","183","20","22","3022","3023","3026","3027","3028","3029","58","62","64","65","79","Amber Recognition Light Key/Off/Steady","Auto-Mix On-Off","CLK_VAR2_pnt_66","CLK_VAR2_pnt_67","CLK_VAR2_pnt_68","CLK_VAR2_pnt_69","CLK_VAR2_pnt_70","CLK_VAR2_pnt_85","CLOCK","Cage","Canopy Emergency Release Handle","Coolant Control Cover","DETROLA","DIRECTIONAL_GYRO","Fuel Booster On/Off","Fuel Selector Valve","Fuel Shut-Off Valve","Green Recognition Light Key/Off/Steady","Gun Heating","Gun control","HYDRAULIC_SYSTEM","Heading Set/Cage","Homing Adapter Mode","Homing Adapter On/Off","Hydraulic Release Knob","IFF Code Selector","IFF Detonator Circuit On/Off","IFF Distress Signal","IFF Power On/Off","IFF TIME/OFF/ON","Ignition","Landing Light On/Off","Left Bomb Arm/Chemical","Mirror","Mixture Control Select IDLE CUT OFF/RUN/EMERGENCY FULL RICH","Oil Control Cover","Oil Dilute Activate","Oxygen Emergency By-pass","Pitot Heating","Primer Activate","Radio Mode","Red Recognition Light Key/Off/Steady","Release Mode","Right Bomb Arm/Chemical","Starter Switch Cover","Supercharger Switch Cover","Surface Control Lock Plunger. Left Button - Lock Stick in the Forward Position', Right Button - Lock Stick in the Neutral Position","Switch Locking Lever","Tail Position Lights Bright/Off/Dim","Tail Warning Radar Power","Tail Warning Radar Test","Winding/Adjustment Clock","Wing Position Lights Bright/Off/Dim","pnt_102","pnt_103","pnt_104","pnt_105","pnt_106","pnt_107","pnt_108","pnt_109","pnt_110","pnt_114","pnt_128","pnt_129","pnt_13","pnt_130","pnt_131","pnt_139","pnt_140","pnt_141","pnt_142","pnt_143","pnt_149","pnt_150","pnt_151","pnt_152","pnt_153","pnt_168","pnt_169","pnt_173","pnt_18","pnt_183","pnt_47","pnt_58","pnt_61","pnt_64","pnt_7","pnt_79","pnt_86","pnt_89","-0.5","0.14","100","111","112","113","116","117","118","119","120","121","127","137","138","145","146","147","154","157","158","159","176","179","18","23","30","3018","3020","3024","3025","44","48","49","60","63","71","72","8","81","83","84","90","91","92","93","A Channel Activate","ACCELEROMETER","ALTIMETER","Aileron Trim","Amber Recognition Light Key/Off","Amber Recognition Light Steady/Off","Automatic Coolant Control","Automatic Oil Control","B Channel Activate","Battery Connect","Bombs Both Release","Bombs Train Release","Bombs and Rockets Safe","C Channel Activate","Camera On","Canopy Hand Crank","Circuit Protectors Reset","Close Coolant Control","Close Oil Control","Cockpit Lights","Cold Air","Course Set","D Channel Activate","Defroster","Detrola Frequency Selector","Detrola Volume","Elevator Trim","Fuel Booster Off","Fuel Booster On","Fuel Shut-Off Valve Off","Fuel Shut-Off Valve On","G-meter reset","Generator Connect","Green Recognition Light Key/Off","Green Recognition Light Steady/Off","Gun And Camera Off","Gun And Camera On","Gun Heating Off","Gun Heating On","High Blower Lamp Test ","Homing Adapter COMM.","Homing Adapter HOMING","Homing Adapter Power Off","Homing Adapter Power On","Homing Adapter TRANSMIT","Homing Adapter's Circuit Breaker","Hot Air","IFF CODE 1","IFF CODE 2","IFF CODE 3","IFF CODE 4","IFF CODE 5","IFF CODE 6","IFF Detonator Left","IFF Detonator Right","IFF Distress Signal Off","IFF Distress Signal On","IFF OFF","IFF ON","IFF Power Off","IFF Power On","IFF TIME","Ignition Both","Ignition Left","Ignition Off","Ignition Right","Landing Light Off","Landing Light On","Left Bomb Arm Off","Left Bomb Arm On","Left Chemical Release","Left Fluorescent Light","Lock Propeller & Mixture","Lock Throttle","Microphone On","Mixture EMERGENCY FULL RICH","Mixture IDLE","Mixture RUN","Open Coolant Control","Open Oil Control","Parking Brake Handle","Pitch Adjustment","Pitot Heating Off","Pitot Heating On","REMOTE_COMPASS","Radio Audio Volume ","Radio Lights Dimmer","Radio Mode Receive","Radio Mode Remote","Radio Mode Transmit","Radio ON/OFF","Recognition Lights Key","Red Recognition Light Key/Off","Red Recognition Light Steady/Off","Right Bomb Arm Off","Right Bomb Arm On","Right Chemical Release","Right Fluorescent Light","Rockets Arm","Rudder Trim","Safe Landing Gear Light Test","Select Fuselage Tank","Select Left Combat Tank","Select Left Main Tank","Select Right Combat Tank","Select Right Main Tank","Set Pressure","Silence Landing Gear Warning Horn Cut Off","Starter Activate","Supercharger AUTO","Supercharger HIGH","Supercharger LOW","Tail Position Lights Bright/Off","Tail Position Lights Dim/Off","Tail Warning Radar Light Control","Tail Warning Radar Power Off","Tail Warning Radar Power On","Unsafe Landing Gear Light Test","Wing Position Lights Bright/Off","Wing Position Lights Dim/Off","pnt_100","pnt_102_0","pnt_102_1","pnt_103_0","pnt_103_1","pnt_104_0","pnt_104_1","pnt_105_0","pnt_105_1","pnt_106_0","pnt_106_1","pnt_107_0","pnt_107_1","pnt_108_0","pnt_108_1","pnt_109_0","pnt_109_1","pnt_110_0","pnt_110_1","pnt_111","pnt_112","pnt_113","pnt_114_0","pnt_114_1","pnt_115","pnt_115_1","pnt_116","pnt_117","pnt_118","pnt_119","pnt_120","pnt_121","pnt_127","pnt_128_-1","pnt_128_0","pnt_128_1","pnt_137","pnt_138","pnt_139_1","pnt_139_2","pnt_139_3","pnt_139_4","pnt_139_5","pnt_139_6","pnt_140_0","pnt_140_1","pnt_141_-1","pnt_141_0","pnt_141_1","pnt_143_0","pnt_143_1","pnt_145","pnt_146","pnt_147_1","pnt_152_0","pnt_152_1","pnt_152_2","pnt_153_0","pnt_153_1","pnt_154","pnt_157","pnt_158","pnt_159","pnt_17","pnt_176","pnt_26","pnt_3","pnt_44","pnt_47_0","pnt_47_1","pnt_47_2","pnt_48","pnt_49","pnt_57_0","pnt_57_1","pnt_57_2","pnt_60","pnt_61_0","pnt_61_1","pnt_62","pnt_62_1","pnt_63","pnt_65","pnt_65_1","pnt_66_0","pnt_66_1","pnt_66_2","pnt_66_3","pnt_67_-1","pnt_67_0","pnt_67_1","pnt_68_0","pnt_68_1","pnt_68_2","pnt_68_3","pnt_69_-1","pnt_69_0","pnt_69_1","pnt_70_-1","pnt_70_0","pnt_70_1","pnt_71","pnt_72","pnt_81","pnt_83","pnt_84","pnt_85_0","pnt_85_1","pnt_85_2","pnt_85_3","pnt_85_4","pnt_86_0","pnt_86_1","pnt_87_0","pnt_87_1","pnt_87_2","pnt_88_0","pnt_88_1","pnt_88_2","pnt_89_0","pnt_89_1","pnt_90","pnt_91","pnt_92","pnt_93"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Uh-1H","rows":[737,108,5,803,6,696,1,1,0,597,738,107,5,788,6,697,1,1,0,597,25,19,5,93,2,292,16,1,26,94,25,19,5,93,2,292,11,1,26,94,25,19,10,98,2,270,3,3,0,99,25,19,10,98,2,270,0,3,0,99,25,19,13,98,6,714,16,1,0,99,25,19,17,93,6,717,16,1,0,94,25,19,14,774,2,44,1,1,1,779,25,19,14,534,9,44,11,32,11,334,25,19,14,534,9,44,26,32,26,334,25,19,14,775,9,44,11,32,11,780,25,19,14,776,2,44,32,32,32,781,25,19,14,777,2,44,36,36,36,782,25,19,14,778,9,44,26,32,26,783,25,19,24,353,2,78,3,1,0,352,25,19,24,353,2,78,0,1,0,352,337,89,5,741,9,689,0,1,0,750,337,89,10,794,6,692,1,1,0,349,338,79,5,790,6,691,1,1,0,349,338,79,10,789,6,690,1,1,0,740,51,40,5,100,6,66,11,1,0,53,51,40,10,91,6,730,11,1,0,54,51,40,13,100,2,306,16,70,0,53,51,40,13,100,2,306,11,70,0,53,51,40,17,91,2,307,16,1,68,54,51,40,17,91,2,307,11,1,68,54,439,72,5,670,9,688,0,1,0,673,439,72,10,670,6,687,679,1,0,673,443,78,5,763,9,698,0,1,0,480,443,78,10,764,9,699,0,1,0,480,749,148,5,744,6,693,0,1,0,756,52,47,5,672,9,133,3,3,1,675,52,47,5,672,9,133,0,1,0,675,52,47,10,671,2,131,3,3,0,674,52,47,10,671,2,131,0,3,0,674,52,47,14,757,9,715,0,1,0,576,52,47,24,758,9,716,0,1,0,576,4,0,5,351,2,123,3,1,0,356,4,0,5,351,2,123,0,1,0,356,4,0,10,543,9,120,0,1,0,564,4,0,10,543,2,120,1,3,1,564,4,0,13,634,2,124,3,1,0,642,4,0,13,634,2,124,0,1,0,642,4,0,17,664,2,122,16,1,36,452,4,0,17,664,2,122,11,1,36,452,4,0,14,570,2,125,3,1,0,573,4,0,14,570,2,125,0,1,0,573,4,0,28,578,2,118,16,1,32,333,4,0,28,578,2,118,11,1,32,333,4,0,38,519,2,119,3,3,0,522,4,0,38,519,2,119,0,3,0,522,4,0,64,562,2,135,3,1,0,593,4,0,64,562,2,135,0,1,0,593,4,0,85,542,2,121,3,1,0,565,4,0,85,542,2,121,0,1,0,565,4,0,43,510,2,145,3,1,0,395,4,0,43,510,2,145,0,1,0,395,4,0,158,511,2,146,3,1,0,396,4,0,158,511,2,146,0,1,0,396,4,0,86,590,2,147,3,1,0,418,4,0,86,590,2,147,0,1,0,418,4,0,87,545,2,149,3,1,0,409,4,0,87,545,2,149,0,1,0,409,4,0,159,663,2,150,3,1,0,432,4,0,159,663,2,150,0,1,0,432,4,0,160,532,2,151,3,1,0,404,4,0,160,532,2,151,0,1,0,404,4,0,74,516,2,152,3,1,0,400,4,0,74,516,2,152,0,1,0,400,4,0,161,517,2,153,3,1,0,401,4,0,161,517,2,153,0,1,0,401,4,0,75,343,2,252,3,1,0,363,4,0,75,343,2,252,0,1,0,363,4,0,88,502,2,254,3,1,0,389,4,0,88,502,2,254,0,1,0,389,4,0,163,503,2,255,3,1,0,390,4,0,163,503,2,255,0,1,0,390,4,0,164,464,2,256,3,1,0,378,4,0,164,464,2,256,0,1,0,378,4,0,165,660,2,257,3,1,0,430,4,0,165,660,2,257,0,1,0,430,4,0,76,465,2,258,3,1,0,377,4,0,76,465,2,258,0,1,0,377,4,0,166,666,2,260,3,1,0,431,4,0,166,666,2,260,0,1,0,431,4,0,168,584,2,236,3,1,0,413,4,0,168,584,2,236,0,1,0,413,4,0,169,610,2,250,3,1,0,421,4,0,169,610,2,250,0,1,0,421,4,0,170,609,2,251,3,1,0,423,4,0,170,609,2,251,0,1,0,423,4,0,171,668,2,154,3,1,0,434,4,0,171,668,2,154,0,1,0,434,4,0,172,669,2,162,3,1,0,435,4,0,172,669,2,162,0,1,0,435,4,0,173,525,2,180,3,1,0,403,4,0,173,525,2,180,0,1,0,403,4,0,174,635,2,282,3,1,0,427,4,0,174,635,2,282,0,1,0,427,4,0,175,627,2,200,3,1,0,425,4,0,175,627,2,200,0,1,0,425,4,0,176,526,2,220,3,1,0,407,4,0,176,526,2,220,0,1,0,407,4,0,177,531,2,231,3,1,0,406,4,0,177,531,2,231,0,1,0,406,4,0,178,340,2,232,3,1,0,364,4,0,178,340,2,232,0,1,0,364,4,0,179,477,2,261,3,1,0,385,4,0,179,477,2,261,0,1,0,385,4,0,181,569,2,262,3,1,0,410,4,0,181,569,2,262,0,1,0,410,4,0,182,456,2,263,3,1,0,374,4,0,182,456,2,263,0,1,0,374,4,0,183,440,2,264,3,1,0,369,4,0,183,440,2,264,0,1,0,369,4,0,184,361,2,265,3,1,0,368,4,0,184,361,2,265,0,1,0,368,4,0,185,442,2,266,3,1,0,370,4,0,185,442,2,266,0,1,0,370,4,0,186,513,2,267,3,1,0,397,4,0,186,513,2,267,0,1,0,397,4,0,187,514,2,268,3,1,0,398,4,0,187,514,2,268,0,1,0,398,4,0,188,575,2,237,3,1,0,366,4,0,188,575,2,237,0,1,0,366,4,0,189,339,2,238,3,1,0,365,4,0,189,339,2,238,0,1,0,365,4,0,190,611,2,249,3,1,0,422,4,0,190,611,2,249,0,1,0,422,4,0,191,617,2,239,3,1,0,420,4,0,191,617,2,239,0,1,0,420,4,0,192,342,2,240,3,1,0,376,4,0,192,342,2,240,0,1,0,376,4,0,193,462,2,242,3,1,0,381,4,0,193,462,2,242,0,1,0,381,4,0,194,533,2,243,3,1,0,405,4,0,194,533,2,243,0,1,0,405,4,0,195,651,2,244,3,1,0,429,4,0,195,651,2,244,0,1,0,429,4,0,196,643,2,245,3,1,0,428,4,0,196,643,2,245,0,1,0,428,4,0,197,504,2,246,3,1,0,391,4,0,197,504,2,246,0,1,0,391,4,0,198,466,2,248,3,1,0,379,4,0,198,466,2,248,0,1,0,379,4,0,199,359,2,269,3,1,0,367,4,0,199,359,2,269,0,1,0,367,4,0,201,460,2,271,3,1,0,375,4,0,201,460,2,271,0,1,0,375,4,0,202,631,2,272,3,1,0,426,4,0,202,631,2,272,0,1,0,426,4,0,203,518,2,273,3,1,0,402,4,0,203,518,2,273,0,1,0,402,4,0,204,544,2,274,3,1,0,408,4,0,204,544,2,274,0,1,0,408,4,0,205,488,2,275,3,1,0,386,4,0,205,488,2,275,0,1,0,386,4,0,206,636,2,276,3,1,0,424,4,0,206,636,2,276,0,1,0,424,4,0,207,489,2,277,3,1,0,387,4,0,207,489,2,277,0,1,0,387,4,0,208,508,2,278,3,1,0,394,4,0,208,508,2,278,0,1,0,394,4,0,209,613,2,279,3,1,0,419,4,0,209,613,2,279,0,1,0,419,4,0,210,474,2,280,3,1,0,383,4,0,210,474,2,280,0,1,0,383,4,0,211,475,2,281,3,1,0,384,4,0,211,475,2,281,0,1,0,384,4,0,212,499,2,233,3,1,0,392,4,0,212,499,2,233,0,1,0,392,4,0,213,500,2,234,3,1,0,393,4,0,213,500,2,234,0,1,0,393,4,0,214,665,2,235,3,1,0,433,4,0,214,665,2,235,0,1,0,433,4,0,215,512,2,283,3,1,0,399,4,0,215,512,2,283,0,1,0,399,4,0,216,579,2,285,3,1,0,411,4,0,216,579,2,285,0,1,0,411,4,0,217,580,2,286,3,1,0,412,4,0,217,580,2,286,0,1,0,412,4,0,218,444,2,287,3,1,0,371,4,0,218,444,2,287,0,1,0,371,4,0,219,445,2,288,3,1,0,372,4,0,219,445,2,288,0,1,0,372,4,0,221,493,2,289,3,1,0,388,4,0,221,493,2,289,0,1,0,388,4,0,222,473,2,290,3,1,0,382,4,0,222,473,2,290,0,1,0,382,4,0,223,649,2,291,3,1,0,362,4,0,223,649,2,291,0,1,0,362,4,0,224,461,2,293,3,1,0,380,4,0,224,461,2,293,0,1,0,380,4,0,225,587,2,294,3,1,0,415,4,0,225,587,2,294,0,1,0,415,4,0,226,588,2,295,3,1,0,416,4,0,226,588,2,295,0,1,0,416,4,0,227,589,2,296,3,1,0,417,4,0,227,589,2,296,0,1,0,417,4,0,228,586,2,297,3,1,0,414,4,0,228,586,2,297,0,1,0,414,4,0,229,446,2,298,3,1,0,373,4,0,229,446,2,298,0,1,0,373,21,20,10,453,2,328,3,1,0,457,21,20,10,453,2,328,0,1,0,457,21,20,49,438,2,330,1,3,1,450,21,20,49,438,2,330,0,1,0,450,21,20,62,490,2,329,3,1,0,496,21,20,62,490,2,329,0,1,0,496,21,20,63,491,2,112,1,3,1,495,21,20,63,491,2,112,0,1,0,495,21,20,43,535,2,326,3,1,0,541,21,20,43,535,2,326,0,1,0,541,21,20,86,761,9,711,0,1,0,766,21,20,87,808,6,138,0,3,36,811,21,20,74,459,2,114,3,1,0,658,21,20,74,459,2,114,0,1,0,658,21,20,75,492,2,116,1,3,1,494,21,20,75,492,2,116,0,1,0,494,21,20,88,809,6,138,0,3,36,812,80,66,5,742,9,700,0,1,0,752,80,66,10,743,9,701,0,1,0,751,80,66,13,360,2,132,3,1,0,447,80,66,13,360,2,132,0,1,0,447,90,65,5,804,6,712,0,1,0,807,90,65,13,629,2,284,3,3,0,639,90,65,13,629,2,284,0,3,0,639,92,83,5,472,2,327,3,1,0,563,92,83,5,472,2,327,0,1,0,563,92,83,10,765,9,708,0,1,0,810,55,46,10,454,2,137,3,1,0,498,55,46,10,454,2,137,0,1,0,498,55,46,13,768,6,695,0,1,0,770,55,46,17,335,2,106,3,1,0,336,55,46,17,335,2,106,0,1,0,336,55,46,14,769,6,694,0,1,0,754,501,305,5,354,2,134,16,1,36,357,501,305,5,354,2,134,11,1,36,357,81,77,13,505,2,332,3,1,0,506,81,77,13,505,2,332,0,1,0,506,81,77,17,467,2,331,3,1,0,481,81,77,17,467,2,331,0,1,0,481,8,7,5,547,2,319,677,1,102,556,8,7,5,547,2,319,682,1,102,556,8,7,10,548,2,320,57,1,37,557,8,7,10,548,2,320,58,1,37,557,8,7,13,549,2,321,57,1,37,558,8,7,13,549,2,321,58,1,37,558,8,7,17,550,2,322,57,1,37,559,8,7,17,550,2,322,58,1,37,559,8,7,14,551,2,323,57,1,37,560,8,7,14,551,2,323,58,1,37,560,8,7,24,552,2,324,57,1,37,561,8,7,24,552,2,324,58,1,37,561,8,7,28,441,9,309,3,3,1,451,8,7,28,441,9,309,0,1,0,451,8,7,38,546,2,310,16,1,36,567,8,7,38,546,2,310,11,1,36,567,8,7,41,574,2,311,3,3,0,350,8,7,41,574,2,311,0,3,0,350,8,7,61,645,9,312,0,1,0,654,8,7,61,645,2,312,1,3,1,654,8,7,73,646,9,313,0,1,0,655,8,7,73,646,2,313,1,3,1,655,8,7,84,647,9,314,0,1,0,656,8,7,84,647,2,314,1,3,1,656,8,7,49,648,9,315,0,1,0,657,8,7,49,648,2,315,1,3,1,657,8,7,62,599,9,316,0,1,0,598,8,7,62,599,2,316,1,3,1,598,8,7,63,507,9,317,0,1,0,520,8,7,63,507,2,317,1,3,1,520,8,7,64,553,2,318,3,1,0,509,8,7,64,553,2,318,0,1,0,509,8,7,155,608,9,732,0,1,0,622,8,7,156,644,9,733,0,1,0,653,8,7,157,608,6,734,42,1,0,622,8,7,43,644,6,735,42,1,0,653,22,18,5,602,2,23,3,1,0,662,22,18,5,602,2,23,0,1,0,662,22,18,10,603,2,136,3,1,0,659,22,18,10,603,2,136,0,1,0,659,22,18,13,604,2,40,3,1,0,661,22,18,13,604,2,40,0,1,0,661,22,18,17,605,2,60,3,1,0,620,22,18,17,605,2,60,0,1,0,620,22,18,14,606,2,19,3,1,0,515,22,18,14,606,2,19,0,1,0,515,22,18,24,607,2,144,3,1,0,621,22,18,24,607,2,144,0,1,0,621,22,18,28,801,6,148,0,26,0,771,22,18,38,650,2,72,16,1,42,521,22,18,38,650,2,72,11,1,42,521,22,18,41,601,2,109,678,1,0,619,22,18,41,601,2,109,42,1,0,619,96,60,5,815,6,731,0,1,0,785,96,60,10,628,2,308,3,1,0,566,96,60,10,628,2,308,0,1,0,566,15,12,5,571,2,126,16,1,42,572,15,12,5,571,2,126,11,1,42,572,15,12,10,637,2,127,3,3,0,595,15,12,10,637,2,127,0,3,0,595,15,12,13,455,2,128,3,1,0,594,15,12,13,455,2,128,0,1,0,594,15,12,17,341,2,129,3,1,0,346,15,12,17,341,2,129,0,1,0,346,15,12,14,527,2,111,3,1,0,540,15,12,14,527,2,111,0,1,0,540,15,12,24,630,2,110,3,3,0,638,15,12,24,630,2,110,0,3,0,638,15,12,28,528,2,113,3,3,0,538,15,12,28,528,2,113,0,3,0,538,15,12,63,747,6,702,0,1,0,786,15,12,64,787,6,703,0,1,0,796,15,12,155,802,6,704,0,1,0,805,15,12,156,759,6,705,0,1,0,760,15,12,85,748,6,706,0,1,0,755,15,12,157,791,6,707,0,1,0,797,15,12,43,478,2,130,3,3,0,458,15,12,43,478,2,130,0,3,0,458,15,12,76,530,2,115,3,1,0,539,15,12,76,530,2,115,0,1,0,539,15,12,167,529,2,117,3,3,0,537,15,12,167,529,2,117,0,3,0,537,56,50,5,792,6,718,1,1,0,798,56,50,13,793,6,719,0,3,0,806,56,50,14,581,2,1,3,1,0,592,56,50,14,581,2,1,0,1,0,592,56,50,24,582,2,299,3,1,0,591,56,50,24,582,2,299,0,1,0,591,67,59,5,583,9,721,0,1,0,652,67,59,10,795,6,720,0,1,0,784,67,59,13,583,6,722,1,1,0,652,67,59,28,600,2,300,3,1,0,618,67,59,28,600,2,300,0,1,0,618,82,48,5,612,2,103,1,3,1,623,82,48,5,612,2,103,0,1,0,623,82,48,10,355,2,104,1,3,1,358,82,48,10,355,2,104,0,1,0,358,34,27,5,585,2,105,676,1,101,596,34,27,5,585,2,105,680,1,101,596,34,27,10,686,6,107,0,1,0,685,34,27,13,684,6,108,0,1,0,683,34,27,17,681,6,39,0,1,0,729,34,27,14,554,2,48,16,1,32,484,34,27,14,554,2,48,11,1,32,484,34,27,24,476,2,7,16,1,26,487,34,27,24,476,2,7,11,1,26,487,34,27,28,632,2,27,3,1,0,640,34,27,28,632,2,27,0,1,0,640,34,27,38,813,6,18,0,1,0,667,33,23,5,468,2,230,16,26,69,486,33,23,5,468,2,230,11,26,69,486,33,23,10,469,2,65,16,1,71,485,33,23,10,469,2,65,11,1,71,485,33,23,13,470,2,241,16,1,71,482,33,23,13,470,2,241,11,1,71,482,33,23,17,471,2,247,16,1,11,483,33,23,17,471,2,247,11,1,11,483,33,23,14,633,2,259,16,1,32,641,33,23,14,633,2,259,11,1,32,641,33,23,24,814,6,713,0,26,0,667,33,23,28,555,2,253,16,1,26,568,33,23,28,555,2,253,11,1,26,568,45,39,5,97,2,79,16,70,0,53,45,39,5,97,2,79,11,70,0,53,45,39,10,746,9,89,0,1,0,753,45,39,13,95,2,30,16,1,68,54,45,39,13,95,2,30,11,1,68,54,45,39,17,97,6,12,11,1,0,53,45,39,14,95,6,736,11,1,0,54,35,30,38,345,2,139,3,3,0,348,35,30,38,345,2,139,0,3,0,348,35,30,41,536,2,140,3,3,0,497,35,30,41,536,2,140,0,3,0,497,35,30,61,325,2,141,3,3,0,347,35,30,61,325,2,141,0,3,0,347,35,30,73,616,2,142,16,1,69,626,35,30,73,616,2,142,11,1,69,626,35,30,84,799,9,709,0,1,0,800,35,30,49,523,2,143,3,3,0,524,35,30,49,523,2,143,0,3,0,524,35,30,62,772,9,710,0,1,0,773,31,29,5,614,2,301,3,1,0,624,31,29,5,614,2,301,0,1,0,624,31,29,10,615,2,302,3,1,0,625,31,29,10,615,2,302,0,1,0,625,31,29,13,463,9,724,0,1,0,479,31,29,17,463,6,723,1,1,0,479,31,29,14,436,2,303,3,1,0,344,31,29,14,436,2,303,0,1,0,344,31,29,24,762,9,728,0,1,0,767,31,29,28,437,9,726,0,1,0,449,31,29,38,437,6,725,1,1,0,449,31,29,41,577,2,304,3,1,0,448,31,29,41,577,2,304,0,1,0,448,31,29,61,745,9,727,0,1,0,739],"strings":["1","0","TUMB","-1","ELEC_INTERFACE","3001","LEV","17","IFF","BTN","3002","0.1","7","3003","3005","NAVLIGHT_SYSTEM","-0.1","3004","21","27","3","ENGINE_INTERFACE","INTERCOM","23","3006","ADF_ARN_83","0.3","22","3007","50","9","XM_130","0.2","VHF_ARC_131","UHF_ARC_51","WEAPON_SYS","0.4","0.77","3008","20","25","3009","0.5","3021","42","VHF_ARC_134","10","12","15","3013","49","ARN_82","CPT_MECH","Frequency MHz / Power. Right mouse click to cycle power. Rotate mouse wheel to change frequency value","Frequency kHz / Volume. Rotate mouse wheel to change frequency value. Left or Right click to adjust volume","GMCS","PILOT_SIGHT","-0.11","0.11","13","26","3010","3014","3015","3016","32","52","RADAR_ALTIMETER","0.65","0.7","0.8","0.9","30","3011","3027","3029","3034","4","41","5","EXT_CARGO_EQUIPMENT","HYDRO_SYS_INTERFACE","SYS_CONTROLLER","2","3012","3019","3023","3024","3030","6","FLEX_SIGHT","FRACTIONAL-MHZ-SELECTOR-KNOB-KNOB-PTR","FUELSYS_INTERFACE","GAIN-CONTROL-PTR","Gain control / Mode. Right mouse click to cycle mode. Rotate mouse wheel to adjust gain","KHZ-SELECTOR-PTR","MARKER_BEACON","MHZ-SELECTOR-PTR","TUNE-CONTROL-PTR","Tune control / Band selection. Right mouse click to select a band. Rotate mouse wheel to adjust tune","WHOLE-MHZ-SELECTOR-KNOB-PTR","0.95","0.99","111","112","16","164","18","19","194","201","202","203","205","206","209","210","212","214","215","216","217","218","219","220","221","222","223","224","225","226","227","228","229","236","238","24","241","250","252","253","256","257","259","28","285","287","289","29","291","293","295","297","299","301","3017","3018","3020","3022","3025","3026","3028","303","3031","3032","3033","3035","3036","3037","3039","3040","3041","3042","3043","3044","3045","3046","3047","3048","3049","305","3050","3051","3052","3053","3054","3055","3056","3057","3058","3059","3060","3061","3062","3063","3064","3065","3066","3068","3069","307","3070","3071","3072","3073","3074","3075","3076","3077","3078","3079","3080","3081","3082","3083","3085","3086","3087","3088","3089","309","3090","3091","3092","3093","3094","3095","3096","3097","3098","31","311","313","315","317","319","321","323","325","327","329","33","331","333","335","337","339","34","341","343","345","347","349","35","351","353","355","357","359","36","361","363","365","367","369","371","373","375","377","379","38","381","383","385","387","389","391","393","395","397","399","401","403","405","408","423","424","425","426","427","428","429","43","430","431","432","433","434","435","439","449","450","451","456","459","47","51","54","55","58","59","60","61","62","63","64","65","66","67","68","69","70","71","72","73","762-SWITCH-PTR","80","81","84","85","86","89","90","AC Voltmeter Selector","ADF Loop Antenna Speed Switch, L/R","ADF-VOR-PTR","ADF/VOR Control Switch","ADI_OPERATOR","ADI_PILOT","AIR-VALVE-PTR","ANTI-COLL-CB-PTR","ANTI-COLL-PTR","ANTI-ICE-PTR","ARC-102-PTR","ARM Switch, SAFE/ARM","ARMED-SWITCH-PTR","Anti-Collision Lights Switch, ON/OFF","Armament Selector Switch, 7.62/2.75/40","Armament Switch, ARMED/SAFE/OFF","Attitude Indicator Pitch Trim Knob","Audio/light Switch","BAT-SWITCHER-PTR","BFO Switch (N/F), BFO/OFF","BFO-SWITCH-PTR","BLEND-AIR-PTR","BRIGHT-DIM-SWITCH-PTR","Battery Switch, ON/OFF","Bleed Air Switch, OFF/1/2/3/4","Bright/Dim switch","CARGO-HOOK-PTR","CARGO-REL-PTR","CAUTION-LIGHTS-PTR","CB 28V Trans(N/F), ON/OFF","CB ARC-102 HF Static INVTR(N/F), ON/OFF","CB Anticollision light(N/F), ON/OFF","CB Cabin heater (Air valve)(N/F), ON/OFF","CB Cabin heater (Outlet valve)(N/F), ON/OFF","CB Cargo hook release(N/F), ON/OFF","CB Caution lights(N/F), ON/OFF","CB Cockpit lights(N/F), ON/OFF","CB Console lights(N/F), ON/OFF","CB Copilot ATTD1(N/F), ON/OFF","CB Copilot ATTD2(N/F), ON/OFF","CB Course Ind(N/F), ON/OFF","CB Dome lights(N/F), ON/OFF","CB EXT Stores jettison(N/F), ON/OFF","CB Engine anti-ice(N/F), ON/OFF","CB FM 2 Radio(N/F), ON/OFF","CB FM Radio, ON/OFF","CB FORCE Trim(N/F), ON/OFF","CB Fail Relay(N/F), ON/OFF","CB Fire detector(N/F), ON/OFF","CB Fuel Quantity(N/F), ON/OFF","CB Fuel TRANS(N/F), ON/OFF","CB Fuel valves(N/F), ON/OFF","CB Fuselage lights(N/F), ON/OFF","CB Generator & Bus Reset(N/F), ON/OFF","CB Governor Control(N/F), ON/OFF","CB Gyro Cmps(N/F), ON/OFF","CB HF ANT COUPLR(N/F), ON/OFF","CB HF ARC-102(N/F), ON/OFF","CB HYD Control(N/F), ON/OFF","CB Heated blanket 1(N/F), ON/OFF","CB Heated blanket 2(N/F), ON/OFF","CB IDLE Stop release(N/F), ON/OFF","CB IFF APX 1 (N/F), ON/OFF","CB IFF APX 2 (N/F), ON/OFF","CB INST Panel lights(N/F), ON/OFF","CB INST SEC lights(N/F), ON/OFF","CB Ignition system(N/F), ON/OFF","CB Intercom CPLT(N/F), ON/OFF","CB Intercom PLT, ON/OFF","CB Inverter CTRL (N/F), ON/OFF","CB KY-28 voice security(N/F), ON/OFF","CB LF Nav. (ARN-83), ON/OFF","CB LH fuel boost pump(N/F), ON/OFF","CB Landing & Search light control(N/F), ON/OFF","CB Landing light power(N/F), ON/OFF","CB Main inverter PWR(N/F), ON/OFF","CB Marker beacon, ON/OFF","CB Navigation lights(N/F), ON/OFF","CB Pilot ATTD1(N/F), ON/OFF","CB Pilot ATTD2(N/F), ON/OFF","CB Pitot tube(N/F), ON/OFF","CB Pressure Eng(N/F), ON/OFF","CB Pressure Fuel(N/F), ON/OFF","CB Pressure Torque(N/F), ON/OFF","CB Pressure XMSN(N/F), ON/OFF","CB Prox. warn.(N/F), ON/OFF","CB RH fuel boost pump(N/F), ON/OFF","CB RPM Warning system(N/F), ON/OFF","CB Rescue hoist CTL(N/F), ON/OFF","CB Rescue hoist PWR(N/F), ON/OFF","CB Rescue hoist cable cutter N/F), ON/OFF","CB STBY Generator Field(N/F), ON/OFF","CB Search light power(N/F), ON/OFF","CB Spare inverter PWR(N/F), ON/OFF","CB Starter Relay(N/F), ON/OFF","CB TEMP indicator(N/F), ON/OFF","CB Turn & Slip indicator, ON/OFF","CB UHF Radio, ON/OFF","CB VHF AM Radio, ON/OFF","CB VHF Nav. (ARN-82), ON/OFF","CB Voltmeter Non Ess Bus(N/F), ON/OFF","CB Wind wiper CPLT, ON/OFF","CB Wind wiper PLT, ON/OFF","CHAFF-ARM-SWITCH-PTR","CHAFF-PTR","CHIP-DET-PTR","CLOCK","COCKPIT-LIGHTS-PTR","CODE-PTR","CONSOLE-LIGHTS-PTR","CONTROL_SYSTEM","COPILOT-ATTD1-PTR","COPILOT-ATTD2--PTR","COURSE-IND-PTR","Cargo Safety","Chaff Mode Switch, MAN/PGRM","Chaff counter Reset. Rotate mouse wheel to set Number","Chip Detector Switch, LMB - Tail Rotor / RMB - XMSN","Code Knob","DC Voltmeter Selector","DE-ICE-PTR","DG-SLAVE-PTR","DIM-BRIGHT-PTR","DOME-LIGHTS-PTR","De-Ice Switch, ON/OFF","Dome Light Switch, WHITE/OFF/GREEN","ENGINE-BTN-1-PTR","EXT-STORES-PTR","FAIL-RELAY-PTR","FIRE-PTR","FLARE-PTR","FM-ARC-54-PTR","FM2-ARC-114-PTR","FORCE-TRIM-CB-PTR","FORCE-TRIM-PTR","FREQUENCY-SELECTOR-1-PTR","FREQUENCY-SELECTOR-2-PTR","FREQUENCY-SELECTOR-3-PTR","FREQUENCY-SELECTOR-4-PTR","FUEL-PTR","FUEL-QTY-PTR","FUEL-TRANS-PTR","FUEL-VALVES-PTR","FUNCTION-SELECT-SWITCH-PTR","FUS-LIGHTS-PTR","FWD-PTR","Flare counter Reset. Rotate mouse wheel to set Number","Force Trim Button","Force Trim Switch, ON/OFF","Frequency Decimals MHz Selector","Frequency Hundredths MHz Selector","Frequency Mode Dial","Frequency Ones MHz Selector","Frequency Tens MHz Selector","Function Dial","GEN-BUS-PTR","GOV-CONT-PTR","GOV-PTR","GOV-RPM-1-PTR","GOV-RPM-2-PTR","GYRO-CMPS-PTR","Governor RPM Switch Copilot, Decrease/Increase","Governor RPM Switch, Decrease/Increase","Governor Switch, EMER/AUTO","Gun Selector Switch, LEFT/ALL/RIGHT","Gyro Mode Switch, DG/Slave","HEATED-BLANKET-PTR","HEATED-BLANKET2-PTR","HEATING_SYSTEM","HF-ANT-PTR","HF-ARC-102-PTR","HYD-CONT-CB-PTR","HYD-CONT-PTR","Hydraulic Control Switch, ON/OFF","IDENT-MIC SWITCH-PTR","IDLE-STOP-PTR","IFF On/Out Switch","IFF-API-PTR","IFF-APX-PTR","IGNITER-SOL-PTR","INST-PANEL-LIGHTS-PTR","INST-SEC-LIGHTS-PTR","INT Receiver Switch, ON/OFF","INTER-COM-CPLT-PTR","INTER-COM-PLT-PTR","INVTR-PTR","INVTR-SWITCHER-PTR","Ident/Mic Switch","Intercom Mode (PVT - hot line; INT - interphone; 1 - VHF FM transmitter; 2 - UHF transmitter; 3 - VHF AM transmitter; 4 - Not used)","Inverter Switch, MAIN/OFF/SPARE","JETT-COVER-PTR","Jettison Switch Cover, OPEN/CLOSE","K-Y20-PTR","LDG-LIGHT-PTR","LDG-LT-1-PTR","LDG-LT-2-1-PTR","LDG-LT-2-2-PTR","LDG-LT-2-PTR","LDG-SEARCH-PTR","LF-NAV-PTR","LH-FUEL-PTR","LOOP-L-R-SWITCH-PTR","LOW-RPM-PTR","LRGUN-SWITCH-PTR","Landing Light Control Switch Copilot, EXT/OFF/RETR","Landing Light Control Switch, EXT/OFF/RETR","Landing Light Switch Copilot, ON/OFF","Landing Light Switch, ON/OFF","Low RPM Warning Switch, AUDIO/OFF","MAIN-GEN-SWITCHER-COVER-PTR","MAIN-GEN-SWITCHER-PTR","MAIN-INVTR-PTR","MARKER-BEACON-PTR","MASTER-CONTROL-PTR","MODE-1-WHEEL-1-WINDOW-PTR","MODE-1-WHEEL-2-WINDOW-PTR","MODE-3A-WHEEL-1-WINDOW-PTR","MODE-3A-WHEEL-2-WINDOW-PTR","MODE-3A-WHEEL-3-WINDOW-PTR","MODE-3A-WHEEL-4-WINDOW-PTR","MODE-4-SWITCH-PTR","MODE-SELECT-SWITCH-PTR","MODE-SWITCH-PTR","MODE1-WHEEL1","MODE1-WHEEL2","MODE3A-WHEEL1","MODE3A-WHEEL2","MODE3A-WHEEL3","MODE3A-WHEEL4","MTR-PTR","Main Fuel Switch, ON/OFF","Main generator Switch (Left button - ON/OFF. Right button RESET)","Main generator switch cover, OPEN/CLOSE","Marker Beacon Sensing Switch, HIGH/LOW","Master Knob, OFF/STBY/LOW/NORM/EMER","Mode Switch, OFF/TR/RETRAN(N/F)/HOME(N/F)","NAV-LIGHTS-PTR","NON-ESS-BUS-SWITCHERr-PTR","NVG-POSITION-LTS-PTR","Navigation Lights Switch, OFF/1/2/3/4/BRT","Non-Essential Bus Switch, NORMAL/MANUAL","OUT-(AUDIO-LIGHT)-PTR","OUTLET-VALVE-PTR","Open Doors","PGRM-SWITCH-PTR","PHASE-SWITCHER-PTR","PILOT-ATTD1-PTR","PILOT-ATTD2-PTR","PILOT-SIGHT-POS-PTR","PILOT-SIGHT-SWITCH-PTR","PITCH-HI-ALT-PTR","PITOT-TUBE-PTR","PRESET-CHANNEL-PTR","PRESS-ENG-PTR","PRESS-FUEL-PTR","PRESS-TORQ-PTR","PRESS-XMSN-PTR","PROX-WARN-PTR","Pilot Sight Switch, ON/OFF","Pilot Sight, Armed/Safe","Pitot Heater Switch, ON/OFF","Position Lights Switch, DIM/BRIGHT","Position Lights Switch, STEADY/OFF/FLASH","Preset Channel Selector","Pressure Adjustment Knob","RAD Switch, TEST/MON","RAD-TEST-MON-SWITCH-PTR","RADAR-ALT-PTR","RADIO/ICS-1-PTR","RECEIVER-1-PTR","RECEIVER-2-PTR","RECEIVER-3-PTR","RECEIVER-4-PTR","RECEIVER-INT-PTR","RECEIVER-NAV-PTR","REPLY-LIGHT-PTR","RESCUE-CABLE-PTR","RESCUE-CONT-PTR","RESCUE-POWER-PTR","RESET-TEST-SWITCH-PTR","RH-FUEL-PTR","RIPPLE-FIRE-COVER-PTR","RIPPLE-FIRE-PTR","RKT-PAIR-PTR","RPM-WARN-PTR","Radar Altimeter Power Switch, ON/OFF","Radio/ICS Switch","Receiver 4 N/F Switch, ON/OFF","Receiver NAV Switch, ON/OFF","Reply Button","Reset/Test switch","Ripple Fire Cover, OPEN/CLOSE","Ripple Fire Switch, ON/OFF","Rocket Pair Selector Switch","SEARCH-LIGHT-PTR","SENSING-SWITCH-PTR","SIGHT-TUMB-PTR","SL-ON-OFF-STOW-1-PTR","SPARE-INVTR-PTR","SQ-DISABLE-SWITCH-PTR","SQUELCH-SWITCH-PTR","STARTER-GEN-SWITCHERr-PTR","STARTER-RELAY-PTR","STBY-GEN-PTR","STEADY-OFF-FLASH-PTR","Search Light Switch, ON/OFF/STOW","Sighting Station Lamp Switch, BACKUP/OFF/MAIN","Squelch Disable Switch, ON/OFF","Squelch Mode Switch, DIS/CARR/TONE","Starter/Stdby GEN Switch","TEMP-IND-PTR","TEST-LIGHT-PTR","TEST-M-1-PTR","TEST-M-2-PTR","TEST-M-3A-PTR","TEST-M-3C-PTR","TRANS-28V-PTR","TRANSMIT-INTERPHONE-SWITCH-PTR","TURN-SLIP-PTR","Test / Hight Set. Left mouse click to Test. Rotate mouse wheel to set Hight","Test Button","Test M-1 Switch","Test M-2 Switch","Test M-3A Switch","Test M-C Switch","Throttle Stop Switch, ON/OFF","UHF Radio Receiver Switch, ON/OFF","UHF-ARC-51-PTR","VHF AM Radio Receiver Switch, ON/OFF","VHF FM Radio Receiver Switch, ON/OFF","VHF-NAV-PTR","VM-SWITCHER-PTR","VOLT-METER-PTR","VXFXCVR-COMM-PTR","Volume Knob","WIND-SHIELD-CB-PTR","WIND-SHIELD2-CB-PTR","WINDING/ADJUSTMENT-KNOB-PULL/PUSH-PTR","WIPER PILOT-BOTH-COPILOT-PTR","WIPERS-PTR","Winding/Adjustment Clock","Wiper Selector Switch, PILOT/BOTH/COPILOT","Wipers Speed Switch, PARK/OFF/LOW/MED/HIGH","-0.05","-0.33","-0.5","0.04","0.05","0.05-MHZ-CONTROL-PTR","0.33","1 MHz Selector","1-MHZ-CONTROL-PTR","10 MHz Selector","10-MHZ-CONTROL-PTR","130","131","140","144","145","146","155","161","163","172","181","189","193","195","198","230","231","232","233","234","235","240","258","260","278","281","37","39","419","421","44","440","441","445","446","448","452","453","454","455","457","464","50 kHz Selector","53","57","74","75","78","79","8","AAU32","AAU7","Armed Lamp Test Button - Push to test","Attitude Indicator Roll Trim Knob","CAGING-KNOB-ROTATION-PTR","CARGO-RELEASE-1-PTR","CARGO-RELEASE-2-PTR","CDI-OBS-PTR","CHAFF-ARM-TEST-PTR","COMMUNICATION-TEST-SWITCH-PTR","CONSOLE-PTR","COPILOT-PTR","COURSE_IND","Cage Copilot's Attitude Indicator - Pull to cage","Cargo Release CoPilot","Cargo Release Pilot","Comm Test Button - Push to test","Compass Synchronizing Knob","Copilot Instrument Lights Brightness Rheostat","Course Select Knob","DOOR_L-PTR","DOOR_R-PTR","ENGINE-PTR","Engine Instrument Lights Brightness Rheostat","FIRE-DETECTOR-PTR","FLARE-DISP-PTR","FORCE-TRIM-1-PTR","FORCE-TRIM-2-PTR","FUEL-GAUGE-PTR","Fire Detector Test Button - Push to test","Flare Dispense Button - Push to dispense","HDG-SET-PTR","HDG-SYNC-PTR","Heading Set Knob","Intercom Volume Knob","JETT-SWITCH-PTR","Jettison Switch","LOOP-L-PTR","LOOP-L1-PTR","LOOP-O-PTR","LOOP-R-PTR","LOOP-R1-PTR","Loop Left Hight Speed","Loop Left Low Speed","Loop Off","Loop Right Hight Speed","Loop Right Low Speed","Low Altitude Setting Knob","Marker Beacon Knob, ON/OFF/Volume","Overhead Console Panel Lights Brightness Rheostat","PED-PTR","PILOT-ALT-SET-KNOB-PTR","PILOT-ATT-PITCH-ADJ-KNOB-PTR","PILOT-ATT-ROLL-ADJ-KNOB-PTR","PILOT-PTR","PILOT-SIGHT-BRIGHT-PTR","PILOT-SIGHT-SCALE-PTR","PITCH-ADJUSTMENT-PTR","PITCH-LO-ALT-PTR","Pedestal Lights Brightness Rheostat","Pilot Instrument Lights Brightness Rheostat","Pilot Sighting Station Intensity Knob","RKT-RESET-PTR","Rocket Reset Button - Push to reset","SDP-VOLUME-CONTROL-PTR","SEC-PTR","SET-PRESSURE-KNOB-PTR","SIGHT-BRIGHT-SWITCHER-PTR","Secondary Instrument Lights Brightness Rheostat","Sight Elevation Knob","Sighting Station Intensity Knob","THROTTLE-1-PTR","THROTTLE-2-PTR","Test Fuel Gauge Button - Push to Test","Throttle","Throttle Copilot","UHF-VOLUME-CONTROL-PTR","VOLUME-CONTROL-PTR","VOLUME-OFF-INCR-CONTROL-PTR"]});
@@ -0,0 +1 @@
+registerCommandShard({"columns":["device","device_id","command","element","class","arg","arg_value","arg_lim_min","arg_lim_max","hint"],"module":"Yak-52","rows":[360,335,16,377,15,342,1,1,0,244,14,13,16,395,15,339,1,1,0,255,14,13,26,302,3,132,0,1,0,67,14,13,26,302,3,132,0,1,0,67,14,13,24,298,2,130,4,1,0,66,14,13,24,298,2,130,0,1,0,66,14,13,37,296,3,133,0,1,0,65,14,13,37,296,3,133,0,1,0,65,14,13,41,300,2,131,4,1,0,68,14,13,41,300,2,131,0,1,0,68,14,13,80,294,2,129,31,1,43,64,14,13,80,294,2,129,32,1,43,64,14,13,82,193,2,96,4,1,0,58,14,13,82,193,2,96,0,1,0,58,14,13,30,396,15,340,1,1,0,255,14,13,39,303,3,137,0,1,0,67,14,13,39,303,3,137,0,1,0,67,14,13,54,299,2,135,4,1,0,66,14,13,54,299,2,135,0,1,0,66,14,13,40,297,3,138,0,1,0,65,14,13,40,297,3,138,0,1,0,65,14,13,164,301,2,136,4,1,0,68,14,13,164,301,2,136,0,1,0,68,14,13,165,295,2,134,31,1,43,64,14,13,165,295,2,134,32,1,43,64,14,13,166,194,2,97,4,1,0,58,14,13,166,194,2,97,0,1,0,58,10,9,16,316,2,145,4,4,0,71,10,9,16,316,2,145,0,4,0,71,10,9,29,314,2,168,4,1,0,72,10,9,29,314,2,168,0,1,0,72,10,9,26,317,2,146,4,4,0,71,10,9,26,317,2,146,0,4,0,71,10,9,27,315,2,169,4,1,0,72,10,9,27,315,2,169,0,1,0,72,10,9,37,266,2,115,77,1,0,60,10,9,37,266,2,115,22,1,0,60,10,9,46,267,2,116,77,1,0,60,10,9,46,267,2,116,22,1,0,60,10,9,41,365,15,343,1,1,0,264,10,9,80,366,15,344,1,1,0,264,10,9,83,191,3,5,0,1,0,73,10,9,83,191,3,5,0,1,0,73,10,9,84,192,3,11,0,1,0,73,10,9,84,192,3,11,0,1,0,73,10,9,156,190,3,114,0,1,0,265,10,9,156,190,3,114,0,1,0,265,10,9,349,398,15,333,1,4,0,262,10,9,86,399,15,334,1,4,0,262,10,9,52,196,2,151,4,1,0,240,10,9,52,196,2,151,0,1,0,240,10,9,30,274,2,143,4,1,0,28,10,9,30,274,2,143,0,1,0,28,10,9,39,275,2,144,4,1,0,28,10,9,39,275,2,144,0,1,0,28,10,9,162,272,3,149,0,1,0,28,10,9,162,272,3,149,0,1,0,28,10,9,163,273,3,150,0,1,0,28,10,9,163,273,3,150,0,1,0,28,6,5,16,195,2,182,77,1,0,221,6,5,16,195,2,182,22,1,0,221,6,5,26,199,2,183,4,1,0,223,6,5,26,199,2,183,0,1,0,223,6,5,24,200,2,184,4,1,0,224,6,5,24,200,2,184,0,1,0,224,6,5,37,203,2,185,4,1,0,228,6,5,37,203,2,185,0,1,0,228,6,5,46,198,2,119,4,1,0,222,6,5,46,198,2,119,0,1,0,222,6,5,153,202,3,125,0,1,0,226,6,5,153,202,3,125,0,1,0,226,6,5,155,197,2,126,4,1,0,234,6,5,155,197,2,126,0,1,0,234,6,5,48,207,2,127,4,1,0,233,6,5,48,207,2,127,0,1,0,233,6,5,81,204,2,124,4,1,0,230,6,5,81,204,2,124,0,1,0,230,6,5,50,201,2,123,4,1,0,225,6,5,50,201,2,123,0,1,0,225,6,5,85,214,2,122,4,1,0,227,6,5,85,214,2,122,0,1,0,227,6,5,157,212,2,121,4,1,0,239,6,5,157,212,2,121,0,1,0,239,6,5,51,213,2,120,4,1,0,229,6,5,51,213,2,120,0,1,0,229,6,5,38,205,2,118,4,1,0,231,6,5,38,205,2,118,0,1,0,231,6,5,158,206,2,117,4,1,0,232,6,5,158,206,2,117,0,1,0,232,6,5,160,283,3,173,0,1,0,62,6,5,160,283,3,173,0,1,0,62,6,5,30,208,2,92,4,1,0,236,6,5,30,208,2,92,0,1,0,236,6,5,39,210,2,94,4,1,0,235,6,5,39,210,2,94,0,1,0,235,6,5,54,209,2,93,4,1,0,237,6,5,54,209,2,93,0,1,0,237,6,5,40,211,2,95,4,1,0,238,6,5,40,211,2,95,0,1,0,238,6,5,167,284,3,180,0,1,0,62,6,5,167,284,3,180,0,1,0,62,8,7,16,276,2,99,4,1,0,245,8,7,16,276,2,99,0,1,0,245,8,7,45,285,2,33,31,1,42,63,8,7,45,285,2,33,32,1,42,63,8,7,27,382,2,33,1,1,1,246,8,7,27,383,2,33,1,1,1,247,8,7,27,384,2,33,1,1,1,248,8,7,27,385,2,33,1,1,1,249,8,7,152,286,2,34,31,1,42,63,8,7,152,286,2,34,32,1,42,63,8,7,36,386,2,34,1,1,1,246,8,7,36,387,2,34,1,1,1,247,8,7,36,388,2,34,1,1,1,248,8,7,36,389,2,34,1,1,1,249,8,7,86,310,2,100,4,1,0,70,8,7,86,310,2,100,0,1,0,70,8,7,51,311,2,44,4,1,0,70,8,7,51,311,2,44,0,1,0,70,8,7,38,312,3,102,0,1,0,69,8,7,38,312,3,102,0,1,0,69,8,7,52,313,3,35,0,1,0,69,8,7,52,313,3,35,0,1,0,69,8,7,53,391,2,88,1,1,1,369,8,7,53,392,2,88,1,1,1,368,8,7,53,393,2,88,1,1,1,370,8,7,351,288,15,354,0,4,0,251,8,7,352,288,3,353,0,1,0,251,8,7,87,268,3,147,0,1,0,61,8,7,87,268,3,147,0,1,0,61,8,7,159,269,3,148,0,1,0,61,8,7,159,269,3,148,0,1,0,61,8,7,40,287,2,128,4,1,0,250,8,7,40,287,2,128,0,1,0,250,375,332,16,376,15,331,1,1,0,244,25,23,16,306,2,139,4,1,0,258,25,23,16,306,2,139,0,1,0,258,25,23,45,307,2,140,4,4,1,259,25,23,45,307,2,140,0,4,1,259,25,23,27,304,3,141,4,4,1,256,25,23,27,304,3,141,0,1,0,256,25,23,24,305,3,142,4,4,1,257,25,23,24,305,3,142,0,1,0,257,25,23,78,397,15,341,1,1,0,372,20,19,16,378,15,355,1,1,0,217,20,19,26,379,15,356,1,1,0,218,20,19,24,277,2,174,4,1,0,56,20,19,24,277,2,174,0,1,0,56,20,19,78,278,2,175,4,1,0,55,20,19,78,278,2,175,0,1,0,55,20,19,79,380,15,357,1,1,0,217,20,19,346,381,15,358,1,1,0,218,20,19,154,279,2,176,4,1,0,56,20,19,154,279,2,176,0,1,0,56,20,19,41,280,2,177,4,1,0,55,20,19,41,280,2,177,0,1,0,55,75,35,16,270,3,107,0,1,0,243,75,35,16,270,3,107,0,1,0,243,75,35,29,271,2,108,4,1,0,242,75,35,29,271,2,108,0,1,0,242,309,105,16,320,3,170,0,1,0,261,309,105,16,320,3,170,0,1,0,261,12,11,16,186,3,171,0,1,0,57,12,11,16,186,3,171,0,1,0,57,12,11,29,187,3,172,0,1,0,57,12,11,29,187,3,172,0,1,0,57,12,11,26,363,15,321,0,1,0,220,12,11,24,364,15,322,0,1,0,220,12,11,345,361,15,329,1,1,0,219,12,11,347,362,15,330,1,1,0,219,12,11,47,188,3,103,0,1,0,59,12,11,47,188,3,103,0,1,0,59,12,11,48,189,3,104,0,1,0,59,12,11,48,189,3,104,0,1,0,59,12,11,49,89,3,98,0,22,0,21,12,11,49,89,2,98,22,1,22,21,12,11,81,89,15,323,91,1,0,21,12,11,82,215,3,324,0,1,0,21,12,11,348,215,15,325,0,1,0,21,12,11,50,90,3,101,0,22,0,21,12,11,50,90,2,101,22,1,22,21,12,11,83,90,15,326,91,1,0,21,12,11,84,216,3,327,0,1,0,21,12,11,85,216,15,328,0,1,0,21,12,11,38,308,2,109,4,1,0,260,12,11,38,308,2,109,0,1,0,260,12,11,350,390,15,336,1,1,0,367,12,11,53,373,15,337,1,1,0,241,12,11,87,374,15,338,1,1,0,241,318,44,16,319,3,106,0,1,0,263,318,44,16,319,3,106,0,1,0,263,18,17,16,292,3,110,0,1,0,76,18,17,16,292,3,110,0,1,0,76,18,17,29,394,15,359,1,1,0,371,18,17,36,290,2,179,31,1,0,253,18,17,36,290,2,179,32,1,0,253,18,17,79,289,2,178,31,1,0,254,18,17,79,289,2,178,32,1,0,254,18,17,47,291,2,181,4,1,0,252,18,17,47,291,2,181,0,1,0,252,18,17,49,281,3,111,0,1,0,74,18,17,49,281,3,111,0,1,0,74,18,17,30,293,3,112,0,1,0,76,18,17,30,293,3,112,0,1,0,76,18,17,161,282,3,113,0,1,0,74,18,17,161,282,3,113,0,1,0,74],"strings":["1","0","TUMB","BTN","-1","4","ELECTRICAL_CONTROLS","3","ENGINE_CONTROLS","2","CONTROLS","6","TERTIARY_CONTROLS","21","ARK15M","LEV","3001","27","VHF_RADIO","28","INTERCOM","Cockpit.Yak52.clock","0.5","20","3007","GMK1A","3004","3005","Cockpit.Yak52.canopy_operate","3002","3051","-0.1","0.1","10","11","16","3008","3010","3039","3054","3060","3019","0.3","0.4","15","3003","3013","3020","3021","3023","3027","3036","3040","3044","3057","Cockpit.Generic.intercom_rdf_switch","Cockpit.Generic.intercom_stby_distributive_switch","Cockpit.Yak52.accelerometer","Cockpit.Yak52.adf_marker","Cockpit.Yak52.ah_arretir","Cockpit.Yak52.flaps","Cockpit.Yak52.fuel_cock","Cockpit.Yak52.lamps_test","Cockpit.Yak52.magnetos","Cockpit.Yak52.rdf_channel","Cockpit.Yak52.rdf_control","Cockpit.Yak52.rdf_listen_mode","Cockpit.Yak52.rdf_loop","Cockpit.Yak52.rdf_mode","Cockpit.Yak52.starter","Cockpit.Yak52.starter_cover","Cockpit.Yak52.uc","Cockpit.Yak52.uc_lock","Cockpit.Yak52.wheel_brakes_lock","INT Button","IUT3","Radio Button","-0.5","3009","3011","3022","3024","3025","3028","3029","3030","3035","3047","76","CLK_PINION1_P0","CLK_PINION1_P1","0.04","100","101","102","103","104","105","119","12","13","131","14","145","151","17","176","177","178","190","192","194","196","197","212","215","218","219","220","221","222","223","224","225","226","232","233","234","238","244","245","246","248","249","251","252","253","255","256","258","259","260","261","267","271","277","278","286","287","291","292","293","3006","3016","3017","3018","3031","3033","3042","3048","3049","3052","3064","3065","3069","3072","3075","3099","33","35","41","45","49","8","82","83","86","87","88","89","9","91","96","97","98","99","ACCMETER_P0","ACCMETER_P1","AH_ARRETIR_P0","AH_ARRETIR_P1","BRAKES_CUT_P1","BRAKES_L_P0","BRAKES_L_P1","CB_ADF_P0","CB_ADF_P1","CB_BATTERY_P0","CB_BRAKES_CUT_P1","CB_E_HEAT_P0","CB_E_INSTR_P0","CB_GENERATOR_P0","CB_IGNITION_P0","CB_INTERCOM_P0","CB_OILDIL_P0","CB_PITOT_P0","CB_RADIO_P0","CB_RDF_P0","CB_SDG_P0","CB_STALL_P0","CB_TPANEL_P1_0","CB_TPANEL_P1_1","CB_TPANEL_P1_2","CB_TPANEL_P1_3","CB_UC_P0","CB_UMFORMER1_P0","CB_UMFORMER2_P0","CLK_PINION2_P0","CLK_PINION2_P1","Cockpit.Generic.intercom_volume_knob","Cockpit.Generic.radio_volume_knob","Cockpit.Yak52.ah_zeroing","Cockpit.Yak52.altimeter","Cockpit.Yak52.cb_battery","Cockpit.Yak52.cb_engine_instrumentation","Cockpit.Yak52.cb_generator","Cockpit.Yak52.cb_ignition","Cockpit.Yak52.cb_intercom","Cockpit.Yak52.cb_oil_dilution","Cockpit.Yak52.cb_pag1","Cockpit.Yak52.cb_pitot","Cockpit.Yak52.cb_pt200","Cockpit.Yak52.cb_radio","Cockpit.Yak52.cb_rdf","Cockpit.Yak52.cb_sdg","Cockpit.Yak52.cb_stall_warning","Cockpit.Yak52.cb_stall_warning_heater","Cockpit.Yak52.cb_trainer_ah","Cockpit.Yak52.cb_trainer_master","Cockpit.Yak52.cb_trainer_speedo","Cockpit.Yak52.cb_trainer_statics","Cockpit.Yak52.cb_uc_indication","Cockpit.Yak52.cb_wheel_brakes_purge","Cockpit.Yak52.emergency_valve","Cockpit.Yak52.fuel_gauge_dimmer","Cockpit.Yak52.fuel_gauge_test","Cockpit.Yak52.hsi","Cockpit.Yak52.ignitionsource","Cockpit.Yak52.magnetos_0","Cockpit.Yak52.magnetos_1","Cockpit.Yak52.magnetos_2","Cockpit.Yak52.magnetos_3","Cockpit.Yak52.mix_heat","Cockpit.Yak52.primer","Cockpit.Yak52.radio_squelch","Cockpit.Yak52.radio_tune_khz","Cockpit.Yak52.radio_tune_mhz","Cockpit.Yak52.rdf_volume","Cockpit.Yak52.sdg_checkup","Cockpit.Yak52.sdg_course","Cockpit.Yak52.sdg_hemisphere","Cockpit.Yak52.sdg_mode","Cockpit.Yak52.smoke_apparatus","Cockpit.Yak52.stall_warning_test","Cockpit.Yak52.trim_elevator","Cockpit.Yak52.voltamperemeter","Cockpit.Yak52.wheel_brakes","Cockpit.Yak52.wheel_brakes_purge","FLAPS_P0","FLAPS_P1","FUEL_COCK_P0","FUEL_COCK_P1","FUEL_CONTROL_P0","FUEL_DIMMER_P0","HATCH_B_P0","HATCH_B_P1","HATCH_L_P0","HATCH_L_P1","IGNITION_S_P1","INTERCOM_P0_S1","INTERCOM_P0_S2","INTERCOM_P1_S1","INTERCOM_P1_S2","INTERCOM_TX_P0","INTERCOM_TX_P1","L_CTRL_P0","L_CTRL_P1","MAGNETO_P0","MAGNETO_P1","MIXHEAT_P0","PRIMER_P0","RADIO_P0_HRKNOB","RADIO_P0_LRKNOB","RADIO_P0_SQ","RADIO_TX_P0","RADIO_TX_P1","RDF_CHANNEL_P0","RDF_CHANNEL_P1","RDF_CSWITCH_P0","RDF_CSWITCH_P1","RDF_LISTEN_P0","RDF_LISTEN_P1","RDF_MODE_12_P0","RDF_MODE_12_P1","RDF_MODE_3_P0","RDF_MODE_3_P1","SDG_CONTROL_P0","SDG_COURSE_P0","SDG_HEMI_P0","SDG_MODE_P0","SMOKER_SWITCH_P0","SSKUA1","STARTER_COVER_P0","STARTER_COVER_P1","STARTER_P0","STARTER_P1","UC_LOCK_P0","UC_LOCK_P1","UC_P0","UC_P1","VA2","VA_KNOB_P0","pnt041","114","118","120","121","122","132","133","134","143","149","155","22","228","229","23","230","239","241","247","254","262","279","283","284","3012","3014","3015","3026","3032","3041","3045","3046","78","79","80","81","84","85","90","AFT_UGR4UK","AH_PINION_P0","AH_PINION_P1","ALT_MMHG_P0","ALT_MMHG_P1","BRAKES_P0","BRAKES_P1","Cockpit.Yak52.pneumatics_valve","Cockpit.Yak52.primer_cylinders","Cockpit.Yak52.primer_off","Cockpit.Yak52.primer_trunk","Cockpit.Yak52.radio_volume","Cockpit.Yak52.sdg_latitude","EMER_VALVE_P0","EMER_VALVE_P1","FORE_UGR4UK","HSI_KNOB_P0","HSI_KNOB_P1","INTERCOM_P0_RH1","INTERCOM_P0_RH2","INTERCOM_P1_RH1","INTERCOM_P1_RH2","MAGNETO_P0_0","MAGNETO_P0_1","MAGNETO_P0_2","MAGNETO_P0_3","MAGNETO_P1_0","MAGNETO_P1_1","MAGNETO_P1_2","MAGNETO_P1_3","PNEM_VALVE_P0","PRIMER_P0_0","PRIMER_P0_P","PRIMER_P0_S","RADIO_P0_VOL","RDF_VOLUME_P0","RDF_VOLUME_P1","SDG_LAT_P0","TRIM_WHEEL_P0","TRIM_WHEEL_P1"]});
@@ -8,6 +8,9 @@ devenv %cd%\Sources\Windows\com.ctytler.dcs.sdPlugin.sln /build "Release|x64"
 :: Copy C++ executable to StreamDeck Plugin package:
 copy Sources\Windows\x64\Release\dcs_interface.exe Sources\com.ctytler.dcs.sdPlugin\
 
+:: Regenerate the per-module command database from a DCS installation, if its path is given as the first argument:
+if not "%~1"=="" Sources\Windows\x64\Release\CommandDbGenerator.exe "%~1" Sources\com.ctytler.dcs.sdPlugin\propertyinspector\json\commands Sources\com.ctytler.dcs.sdPlugin\extract_clickabledata.lua
+
 :: Remove any prior build of the Plugin:
 del Release\com.ctytler.dcs.streamDeckPlugin
 